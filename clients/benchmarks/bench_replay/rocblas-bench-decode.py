@@ -0,0 +1,245 @@
+#!/usr/bin/env python3
+# ########################################################################
+# Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+# ########################################################################
+
+"""Decode a binary rocBLAS bench log into rocblas-bench YAML or command lines.
+
+rocBLAS writes the binary bench log when bench logging is enabled (ROCBLAS_LAYER & 2) and
+ROCBLAS_LOG_BENCH_BINARY_PATH names the file; the format is described in
+library/src/include/logging.hpp. Each call becomes one YAML test, named after its position in
+the log so that repeated calls are kept, with its time, thread, handle and stream in a comment.
+The YAML is run with rocblas-bench --yaml, and rocblas-bench-replay.py replays the log with the
+concurrency of its threads and streams.
+
+A text bench log written to ROCBLAS_LOG_BENCH_PATH is decoded too, one call per line, without
+the times, threads, handles and streams. With --unique, the repeated calls of either log become
+one test with a call_count, and rocblas-bench --yaml runs every problem in one process and
+prints their times weighted by their call_count, estimating the BLAS time of the application.
+
+Example:
+    ROCBLAS_LAYER=2 ROCBLAS_LOG_BENCH_BINARY_PATH=calls.bin ./my_application
+    rocblas-bench-decode.py calls.bin -o calls.yaml
+    ./rocblas-bench --yaml calls.yaml
+
+    ROCBLAS_LAYER=2 ROCBLAS_LOG_BENCH_PATH=calls.txt ./my_application
+    rocblas-bench-decode.py calls.txt --unique -o problems.yaml
+    ./rocblas-bench --yaml problems.yaml
+"""
+
+import argparse
+import json
+import re
+import struct
+import sys
+
+MAGIC = b"RBBENCH1"
+RECORD_STRING, RECORD_CALL = 1, 2
+CALL_HEADER = struct.Struct("=QQQQBH")
+
+# rocblas-bench options without a value
+SWITCHES = {"atomics_allowed", "atomics_not_allowed", "atomics_deterministic", "outofplace",
+            "fortran", "log_function_name", "log_datatype"}
+
+# short rocblas-bench options
+SHORT = {"m": "sizem", "n": "sizen", "k": "sizek", "f": "function", "r": "precision",
+         "v": "verify", "i": "iters", "j": "cold_iters"}
+
+# rocblas-bench options whose Arguments member has another name
+FIELDS = {"sizem": "M", "sizen": "N", "sizek": "K", "kl": "KL", "ku": "KU",
+          "transposeA": "transA", "transposeB": "transB", "verify": "norm_check",
+          "geam_ex_op": "geam_op", "workspace": "user_allocated_workspace"}
+
+TYPES = ("a_type", "b_type", "c_type", "d_type", "compute_type")
+
+
+def read_text_calls(data):
+    """Yield the calls of a text bench log, whose lines are rocblas-bench command lines"""
+    for line in data.decode().splitlines():
+        if line.strip():
+            yield {"time_ns": None, "thread": None, "handle": None, "stream": None,
+                   "device_pointer_mode": False, "command": line.strip()}
+
+
+def read_calls(path):
+    """Yield the calls of a binary or text bench log as dictionaries, in the order they were
+    made"""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:len(MAGIC)] != MAGIC:
+        yield from read_text_calls(data)
+        return
+
+    strings = {}
+    pos = len(MAGIC)
+    while pos < len(data):
+        kind = data[pos]
+        pos += 1
+        if kind == RECORD_STRING:
+            sid, length = struct.unpack_from("=II", data, pos)
+            pos += 8
+            strings[sid] = data[pos:pos + length].decode()
+            pos += length
+        elif kind == RECORD_CALL:
+            time_ns, thread, handle, stream, pointer_mode, count = \
+                CALL_HEADER.unpack_from(data, pos)
+            pos += CALL_HEADER.size
+            tokens = []
+            for _ in range(count):
+                tag = data[pos]
+                pos += 1
+                if tag == 0:
+                    tokens.append(str(struct.unpack_from("=q", data, pos)[0]))
+                    pos += 8
+                elif tag == 1:
+                    tokens.append(str(struct.unpack_from("=Q", data, pos)[0]))
+                    pos += 8
+                elif tag == 2:
+                    tokens.append(repr(struct.unpack_from("=d", data, pos)[0]))
+                    pos += 8
+                elif tag == 3:
+                    tokens.append(chr(data[pos]))
+                    pos += 1
+                elif tag == 4:
+                    tokens.append(strings[struct.unpack_from("=I", data, pos)[0]])
+                    pos += 4
+                elif tag == 5:
+                    length = struct.unpack_from("=I", data, pos)[0]
+                    tokens.append(data[pos + 4:pos + 4 + length].decode())
+                    pos += 4 + length
+                else:
+                    raise ValueError("bad argument tag %d at offset %d of %s"
+                                     % (tag, pos - 1, path))
+            yield {"time_ns": time_ns, "thread": thread, "handle": handle, "stream": stream,
+                   "device_pointer_mode": pointer_mode == 1, "command": " ".join(tokens)}
+        else:
+            raise ValueError("bad record kind %d at offset %d of %s" % (kind, pos - 1, path))
+
+
+def parse_value(text):
+    for convert in (int, float):
+        try:
+            return convert(text)
+        except ValueError:
+            pass
+    return text
+
+
+def bench_arguments(call):
+    """Arguments of the rocblas-bench command line of a call, named as in rocblas_common.yaml"""
+    tokens = call["command"].split()
+    if tokens and not tokens[0].startswith("-"):
+        tokens = tokens[1:]  # ./rocblas-bench
+
+    test, precision, i = {}, "f32_r", 0
+    while i < len(tokens):
+        option = SHORT.get(tokens[i].lstrip("-"), tokens[i].lstrip("-"))
+        i += 1
+        if option in SWITCHES:
+            if option in ("atomics_not_allowed", "atomics_deterministic"):
+                test["atomics_mode"] = option
+            elif option == "outofplace":
+                test["outofplace"] = True
+            continue
+        value = tokens[i] if i < len(tokens) else ""
+        i += 1
+        if option == "precision":
+            precision = value
+        else:
+            test[FIELDS.get(option, option)] = parse_value(value)
+
+    for name in TYPES:
+        test.setdefault(name, precision)
+    test["pointer_mode_host"] = not call["device_pointer_mode"]
+    test["pointer_mode_device"] = call["device_pointer_mode"]
+    return test
+
+
+def yaml_value(value):
+    if isinstance(value, bool):
+        return "true" if value else "false"
+    if isinstance(value, str) and not re.match(r"^[A-Za-z_][\w.]*$", value):
+        return json.dumps(value)
+    return str(value)
+
+
+def yaml_test(index, call, extra=None):
+    """One-line YAML test of a call, with the time, thread, handle and stream of a binary log
+    call in a comment"""
+    test = dict(name="replay_%d" % index, **bench_arguments(call))
+    test.update(extra or {})
+    fields = ", ".join("%s: %s" % (key, yaml_value(value)) for key, value in test.items())
+    if call["time_ns"] is None:
+        return "- { %s }\n" % fields
+    return "- { %s } # time_ns: %d, thread: %#x, handle: %#x, stream: %#x\n" % (
+        fields, call["time_ns"], call["thread"], call["handle"], call["stream"])
+
+
+def unique_calls(calls):
+    """Distinct calls in the order of their first call, with the number of their calls"""
+    result = {}
+    for index, call in calls:
+        key = (call["command"], call["device_pointer_mode"])
+        if key in result:
+            result[key][2] += 1
+        else:
+            result[key] = [index, call, 1]
+    return result.values()
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__.splitlines()[0],
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter)
+    parser.add_argument("log", help="binary bench log written by rocBLAS")
+    parser.add_argument("-o", "--output", help="output file, standard output if not given")
+    parser.add_argument("--commands", action="store_true",
+                        help="write the rocblas-bench command lines instead of YAML")
+    parser.add_argument("--unique", action="store_true",
+                        help="write each distinct call once, with the number of its calls")
+    parser.add_argument("--iters", type=int, help="timed iterations of each call")
+    parser.add_argument("--cold_iters", type=int, help="warm-up iterations of each call")
+    args = parser.parse_args()
+
+    extra = {key: getattr(args, key) for key in ("iters", "cold_iters")
+             if getattr(args, key) is not None}
+    out = open(args.output, "w") if args.output else sys.stdout
+    calls = enumerate(read_calls(args.log))
+    if args.unique:
+        for index, call, count in unique_calls(calls):
+            if args.commands:
+                out.write("%s # calls: %d\n" % (call["command"], count))
+            else:
+                out.write(yaml_test(index, call, dict(extra, call_count=count)))
+    else:
+        for index, call in calls:
+            if args.commands:
+                out.write(call["command"] + "\n")
+            else:
+                out.write(yaml_test(index, call, extra))
+    if out is not sys.stdout:
+        out.close()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+# ########################################################################
+# Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+# ########################################################################
+
+"""Replay the calls of a binary rocBLAS bench log with rocblas-bench.
+
+The calls of each thread and stream of the log are one sequence, which is replayed in order by
+one rocblas-bench process. The sequences run concurrently, each started at the offset of its
+first call in the log, so the calls overlap as they did in the application. The rocblas-bench
+output with the times of the calls is written as <output>/replay_<thread>_<stream>.csv, in the
+order of the log, and the wall time of every sequence is printed. rocblas-bench initializes the data of each
+call itself, so the gaps between the calls of a sequence are not reproduced.
+
+Example:
+    ROCBLAS_LAYER=2 ROCBLAS_LOG_BENCH_BINARY_PATH=calls.bin ./my_application
+    rocblas-bench-replay.py calls.bin -o replay/
+"""
+
+import argparse
+import importlib.util
+import os
+import subprocess
+import sys
+import threading
+import time
+
+spec = importlib.util.spec_from_file_location(
+    "rocblas_bench_decode",
+    os.path.join(os.path.dirname(os.path.abspath(__file__)), "rocblas-bench-decode.py"))
+decode = importlib.util.module_from_spec(spec)
+spec.loader.exec_module(decode)
+
+
+def sequences(path):
+    """Calls of the log by thread and stream, with their index in the log"""
+    result = {}
+    for index, call in enumerate(decode.read_calls(path)):
+        result.setdefault((call["thread"], call["stream"]), []).append((index, call))
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__.splitlines()[0],
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter)
+    parser.add_argument("log", help="binary bench log written by rocBLAS")
+    parser.add_argument("--bench", default="./rocblas-bench", help="path of rocblas-bench")
+    parser.add_argument("--device", type=int, default=0, help="device to replay on")
+    parser.add_argument("--iters", type=int, default=1, help="timed iterations of each call")
+    parser.add_argument("--cold_iters", type=int, default=0, help="warm-up iterations of each call")
+    parser.add_argument("--serial", action="store_true",
+                        help="replay the sequences one after the other instead of concurrently")
+    parser.add_argument("-o", "--output", default=".", help="directory for the YAML and times")
+    args = parser.parse_args()
+
+    os.makedirs(args.output, exist_ok=True)
+    extra = {"iters": args.iters, "cold_iters": args.cold_iters}
+    groups = sequences(args.log)
+    if not groups:
+        print("no calls in", args.log)
+        return 0
+    first = min(calls[0][1]["time_ns"] for calls in groups.values())
+
+    runs = []
+    for (thread, stream), calls in sorted(groups.items(), key=lambda g: g[1][0][1]["time_ns"]):
+        name = "replay_%x_%x" % (thread, stream)
+        yaml = os.path.join(args.output, name + ".yaml")
+        with open(yaml, "w") as f:
+            for index, call in calls:
+                f.write(decode.yaml_test(index, call, extra))
+        runs.append({"name": name, "yaml": yaml, "calls": len(calls),
+                     "offset": (calls[0][1]["time_ns"] - first) * 1e-9})
+
+    def replay(run, start):
+        if not args.serial:
+            # start the sequence at the offset of its first call in the log
+            time.sleep(max(0.0, run["offset"] - (time.monotonic() - start)))
+        with open(os.path.join(args.output, run["name"] + ".csv"), "w") as out:
+            run["start"] = time.monotonic()
+            run["status"] = subprocess.run(
+                [args.bench, "--yaml", run["yaml"], "--device", str(args.device)],
+                stdout=out, stderr=subprocess.DEVNULL).returncode
+            run["end"] = time.monotonic()
+
+    start = time.monotonic()
+    threads = [threading.Thread(target=replay, args=(run, start)) for run in runs]
+    for thread in threads:
+        thread.start()
+        if args.serial:
+            thread.join()
+    for thread in threads:
+        thread.join()
+
+    status = 0
+    for run in runs:
+        if run["status"]:
+            print(run["name"], "failed, see", run["yaml"])
+            status = 1
+        print("%s: %d calls, %.3f s" % (run["name"], run["calls"], run["end"] - run["start"]))
+    print("replayed %d sequences in %.3f s" % (len(runs), time.monotonic() - start))
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+# ########################################################################
+# Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+# ########################################################################
+
+"""Generate a synthetic rocBLAS workload from a bench log as a binary bench log.
+
+The calls of the log, binary or text, are the call mix of the workload: each call of the
+synthetic workload is drawn from them with the frequency of its command line and pointer mode in
+the log, keeping the sizes and pointer modes of the application. The times between the calls of
+each thread and stream of a binary log are drawn the same way, so the synthetic calls arrive as
+the logged ones did; a text log has no times, and --gap_us gives the time between its calls.
+
+The workload has --threads threads with --streams streams each, every one a sequence of --calls
+calls, and is written in the binary bench log format, so it is decoded with
+rocblas-bench-decode.py and run concurrently with rocblas-bench-replay.py, as a log of the
+application would be, at a scale other than the one logged.
+
+Example:
+    ROCBLAS_LAYER=2 ROCBLAS_LOG_BENCH_BINARY_PATH=calls.bin ./my_application
+    rocblas-bench-workload.py calls.bin --threads 8 --streams 2 --calls 1000 -o workload.bin
+    rocblas-bench-replay.py workload.bin -o workload/
+"""
+
+import argparse
+import collections
+import importlib.util
+import os
+import random
+import struct
+import sys
+
+spec = importlib.util.spec_from_file_location(
+    "rocblas_bench_decode",
+    os.path.join(os.path.dirname(os.path.abspath(__file__)), "rocblas-bench-decode.py"))
+decode = importlib.util.module_from_spec(spec)
+spec.loader.exec_module(decode)
+
+STRING_TAG = 5
+
+
+def call_mix(calls):
+    """Distinct calls of the log, with the number of their calls"""
+    mix = collections.Counter()
+    for call in calls:
+        mix[(call["command"], call["device_pointer_mode"])] += 1
+    return mix
+
+
+def arrival_gaps(calls):
+    """Times in nanoseconds between the consecutive calls of each thread and stream of the log"""
+    last, gaps = {}, []
+    for call in calls:
+        if call["time_ns"] is None:
+            continue
+        key = (call["thread"], call["stream"])
+        if key in last:
+            gaps.append(call["time_ns"] - last[key])
+        last[key] = call["time_ns"]
+    return gaps
+
+
+def write_call(out, time_ns, thread, stream, command, device_pointer_mode):
+    """Write a call record of the binary bench log, its tokens as inline strings"""
+    tokens = command.split()
+    out.write(bytes([decode.RECORD_CALL]))
+    out.write(decode.CALL_HEADER.pack(time_ns, thread, 0, stream,
+                                      1 if device_pointer_mode else 0, len(tokens)))
+    for token in tokens:
+        data = token.encode()
+        out.write(bytes([STRING_TAG]) + struct.pack("=I", len(data)) + data)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__.splitlines()[0],
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter)
+    parser.add_argument("log", help="binary or text bench log written by rocBLAS")
+    parser.add_argument("-o", "--output", required=True, help="binary bench log to write")
+    parser.add_argument("--threads", type=int, default=1, help="threads of the workload")
+    parser.add_argument("--streams", type=int, default=1, help="streams of each thread")
+    parser.add_argument("--calls", type=int, help="calls of each stream, as many as the log "
+                        "has per thread and stream if not given")
+    parser.add_argument("--gap_us", type=float, default=0.0,
+                        help="time between the calls of a text log, which has no times")
+    parser.add_argument("--time_scale", type=float, default=1.0,
+                        help="factor of the times between calls, less than 1 for a busier "
+                        "workload")
+    parser.add_argument("--seed", type=int, default=0, help="seed of the random draws")
+    args = parser.parse_args()
+
+    calls = list(decode.read_calls(args.log))
+    if not calls:
+        print("no calls in", args.log)
+        return 1
+    if args.threads < 1 or args.streams < 1:
+        parser.error("--threads and --streams must be at least 1")
+
+    mix = call_mix(calls)
+    keys, weights = list(mix.keys()), list(mix.values())
+    gaps = arrival_gaps(calls) or [int(args.gap_us * 1000)]
+    sequences = len({(call["thread"], call["stream"]) for call in calls})
+    count = args.calls if args.calls is not None else max(1, len(calls) // sequences)
+
+    rng = random.Random(args.seed)
+    records = []
+    for thread in range(1, args.threads + 1):
+        for stream in range(1, args.streams + 1):
+            time_ns = int(rng.choice(gaps) * args.time_scale)  # staggered first calls
+            for _ in range(count):
+                command, device_pointer_mode = rng.choices(keys, weights)[0]
+                records.append((time_ns, thread, stream, command, device_pointer_mode))
+                time_ns += int(rng.choice(gaps) * args.time_scale)
+
+    # the binary log is in the order the calls were made
+    records.sort(key=lambda record: record[0])
+    with open(args.output, "wb") as out:
+        out.write(decode.MAGIC)
+        for record in records:
+            write_call(out, *record)
+
+    span_s = records[-1][0] * 1e-9
+    print("%d distinct calls of %d in %s" % (len(keys), len(calls), args.log))
+    print("wrote %d calls on %d threads with %d streams each over %.3f s to %s"
+          % (len(records), args.threads, args.streams, span_s, args.output))
+    for (command, device_pointer_mode), logged in mix.most_common(10):
+        print("%6.2f%% %s%s" % (100.0 * logged / len(calls), command,
+                                " (device pointer mode)" if device_pointer_mode else ""))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
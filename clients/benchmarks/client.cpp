@@ -31,13 +31,17 @@
 #include "type_dispatch.hpp"
 #include <algorithm>
 #include <cctype>
+#include <cmath>
 #include <cstdio>
 #include <cstring>
 #include <iostream>
 #include <map>
+#include <numeric>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 #include "frequency_monitor.hpp"
 
@@ -978,7 +982,7 @@ int run_bench_test(bool               init,
     arg.unit_check = 0;
 
     // enable timing check,otherwise no performance data collected
-    arg.timing = 1;
+    arg.timing = std::max<int8_t>(arg.timing, 1);
 
     // One stream and one thread (0 indicates to use default behavior)
     arg.streams = 0;
@@ -1276,9 +1280,31 @@ int rocblas_bench_datafile(const std::string& filter,
                            bool               any_stride)
 {
     int ret = 0;
+
+    // Total time of the problems weighted by their call_count, estimating the time of the
+    // workload they were captured from
+    size_t   problems    = 0;
+    uint64_t calls       = 0;
+    double   weighted_us = 0;
+
     for(Arguments arg : RocBLAS_TestData())
+    {
         ret |= run_bench_test(true, arg, filter, name_filter, any_stride, true);
+
+        double gpu_us = ArgumentModel_take_logged_time();
+        if(gpu_us != ArgumentLogging::NA_value)
+        {
+            problems++;
+            calls += arg.call_count;
+            weighted_us += gpu_us * arg.call_count;
+        }
+    }
     test_cleanup::cleanup();
+
+    if(problems)
+        rocblas_cout << std::endl
+                     << "problems,calls,weighted-total-us" << std::endl
+                     << problems << "," << calls << "," << weighted_us << std::endl;
     return ret;
 }
 
@@ -1296,16 +1322,58 @@ void gpu_thread_init_device(int                id,
     run_bench_test(false, a, filter, name_filter, any_stride, false);
 }
 
-void gpu_thread_run_bench(int id, const Arguments& arg, const std::string& filter, bool any_stride)
+void gpu_thread_run_bench(int                id,
+                          const Arguments&   arg,
+                          const std::string& filter,
+                          bool               any_stride,
+                          double*            gpu_us)
 {
     CHECK_HIP_ERROR(hipSetDevice(id));
 
     Arguments   a(arg);
     std::string name_filter = "";
     run_bench_test(false, a, filter, name_filter, any_stride, false);
+    *gpu_us = ArgumentModel_take_logged_time();
+}
+
+// Host to device bandwidth of device id in GB/s, copying from pinned memory, or 0 if it cannot be
+// measured
+void gpu_thread_h2d_bandwidth(int id, double* gbps)
+{
+    constexpr size_t bytes  = size_t(64) << 20;
+    constexpr int    copies = 10;
+
+    void*      host   = nullptr;
+    void*      device = nullptr;
+    hipEvent_t start  = nullptr;
+    hipEvent_t stop   = nullptr;
+    float      ms     = 0;
+
+    bool measured = hipSetDevice(id) == hipSuccess && hipHostMalloc(&host, bytes) == hipSuccess
+                    && hipMalloc(&device, bytes) == hipSuccess
+                    && hipEventCreate(&start) == hipSuccess && hipEventCreate(&stop) == hipSuccess
+                    && hipMemcpy(device, host, bytes, hipMemcpyHostToDevice) == hipSuccess
+                    && hipEventRecord(start, 0) == hipSuccess;
+    for(int i = 0; measured && i < copies; i++)
+        measured = hipMemcpyAsync(device, host, bytes, hipMemcpyHostToDevice, 0) == hipSuccess;
+    measured = measured && hipEventRecord(stop, 0) == hipSuccess
+               && hipEventSynchronize(stop) == hipSuccess
+               && hipEventElapsedTime(&ms, start, stop) == hipSuccess && ms > 0;
+
+    *gbps = measured ? bytes * copies / (ms * 1e6) : 0;
+
+    if(stop)
+        (void)hipEventDestroy(stop);
+    if(start)
+        (void)hipEventDestroy(start);
+    if(device)
+        (void)hipFree(device);
+    if(host)
+        (void)hipHostFree(host);
 }
 
 void run_bench_gpu_test(int                parallel_devices,
+                        int                parallel_handles,
                         Arguments&         arg,
                         const std::string& filter,
                         bool               any_stride)
@@ -1313,7 +1381,7 @@ void run_bench_gpu_test(int                parallel_devices,
     int count;
     CHECK_HIP_ERROR(hipGetDeviceCount(&count));
 
-    if(parallel_devices > count || parallel_devices < 1)
+    if(parallel_devices > count || parallel_devices < 1 || parallel_handles < 1)
         GTEST_ASSERT_TRUE(false);
 
     // initialization
@@ -1328,14 +1396,81 @@ void run_bench_gpu_test(int                parallel_devices,
     for(int id = 0; id < parallel_devices; ++id)
         thread_init[id].join();
 
-    // synchronized launch of cold & hot calls
-    auto thread = std::make_unique<std::thread[]>(parallel_devices);
+    // run on device 0 alone, the baseline of the scaling
+    double solo_us = ArgumentLogging::NA_value;
+    std::thread(::gpu_thread_run_bench, 0, arg, filter, any_stride, &solo_us).join();
+
+    // synchronized launch of cold & hot calls, with parallel_handles threads and so handles on
+    // each device
+    int  threads = parallel_devices * parallel_handles;
+    auto thread  = std::make_unique<std::thread[]>(threads);
+
+    std::vector<double> gpu_us(threads, ArgumentLogging::NA_value);
+    for(int i = 0; i < threads; ++i)
+        thread[i] = std::thread(
+            ::gpu_thread_run_bench, i % parallel_devices, arg, filter, any_stride, &gpu_us[i]);
+
+    for(int i = 0; i < threads; ++i)
+        thread[i].join();
+
+    if(solo_us == ArgumentLogging::NA_value)
+        return;
+    for(double us : gpu_us)
+        if(us == ArgumentLogging::NA_value)
+            return;
 
+    // Mean time of a call on each device, and the aggregate calls per second of all the handles
+    // against the one of device 0 alone
+    rocblas_cout << std::endl << "device,handles,us" << std::endl;
+
+    std::vector<double> device_us(parallel_devices, 0);
+    double              calls_per_sec = 0;
+    for(int i = 0; i < threads; ++i)
+    {
+        device_us[i % parallel_devices] += gpu_us[i] / parallel_handles;
+        calls_per_sec += 1e6 / gpu_us[i];
+    }
+
+    double mean = 0, variance = 0;
     for(int id = 0; id < parallel_devices; ++id)
-        thread[id] = std::thread(::gpu_thread_run_bench, id, arg, filter, any_stride);
+    {
+        rocblas_cout << id << "," << parallel_handles << "," << device_us[id] << std::endl;
+        mean += device_us[id] / parallel_devices;
+    }
+    for(double us : device_us)
+        variance += (us - mean) * (us - mean) / parallel_devices;
+    auto [min_us, max_us] = std::minmax_element(device_us.begin(), device_us.end());
 
+    double solo_calls_per_sec = 1e6 / solo_us;
+    rocblas_cout << std::endl
+                 << "devices,handles-per-device,solo-us,mean-us,stddev-us,min-us,max-us,"
+                    "aggregate-calls/s,speedup,scaling-efficiency"
+                 << std::endl
+                 << parallel_devices << "," << parallel_handles << "," << solo_us << "," << mean
+                 << "," << std::sqrt(variance) << "," << *min_us << "," << *max_us << ","
+                 << calls_per_sec << "," << calls_per_sec / solo_calls_per_sec << ","
+                 << calls_per_sec / (solo_calls_per_sec * parallel_devices) << std::endl;
+
+    // Host to device bandwidth of device 0 alone and of every device at once, which is bound by
+    // a shared PCIe or xGMI link when the devices get much less than device 0 did alone
+    double solo_gbps;
+    gpu_thread_h2d_bandwidth(0, &solo_gbps);
+
+    std::vector<double> h2d_gbps(parallel_devices);
     for(int id = 0; id < parallel_devices; ++id)
-        thread[id].join();
+        thread_init[id] = std::thread(::gpu_thread_h2d_bandwidth, id, &h2d_gbps[id]);
+    for(int id = 0; id < parallel_devices; ++id)
+        thread_init[id].join();
+
+    double min_gbps = *std::min_element(h2d_gbps.begin(), h2d_gbps.end());
+    double sum_gbps = std::accumulate(h2d_gbps.begin(), h2d_gbps.end(), 0.0);
+    if(!solo_gbps || !min_gbps)
+        return;
+
+    rocblas_cout << std::endl
+                 << "h2d-solo-GB/s,h2d-min-GB/s,h2d-aggregate-GB/s,host-link-bound" << std::endl
+                 << solo_gbps << "," << min_gbps << "," << sum_gbps << ","
+                 << (min_gbps < 0.8 * solo_gbps ? "yes" : "no") << std::endl;
 }
 
 // Replace --batch with --batch_count for backward compatibility
@@ -1370,21 +1505,31 @@ try
     std::string initialization;
     std::string filter;
     std::string name_filter;
-    int32_t     device_id           = 0;
-    int32_t     parallel_devices    = 0;
-    int32_t     flags               = 0;
-    int32_t     geam_ex_op          = 0;
-    int32_t     api                 = 0;
-    bool        datafile            = rocblas_parse_data(argc, argv);
-    bool        atomics_allowed     = true;
-    bool        atomics_not_allowed = false;
-    bool        log_function_name   = false;
-    bool        log_datatype        = false;
-    bool        any_stride          = false;
-    uint32_t    math_mode           = 0;
-    uint64_t    flush_batch_count   = 1;
-    uint64_t    flush_memory_size   = 0;
-    bool        fortran             = false;
+    int32_t     device_id             = 0;
+    int32_t     parallel_devices      = 0;
+    int32_t     parallel_handles      = 1;
+    int32_t     flags                 = 0;
+    int32_t     geam_ex_op            = 0;
+    int32_t     api                   = 0;
+    bool        datafile              = rocblas_parse_data(argc, argv);
+    bool        atomics_allowed       = true;
+    bool        atomics_not_allowed   = false;
+    bool        atomics_deterministic = false;
+    bool        log_function_name     = false;
+    bool        log_datatype          = false;
+    bool        log_roofline          = false;
+    std::string results_path;
+    std::string baseline_path;
+    std::string hot_operands;
+    std::string timing;
+    double      compare_threshold     = 5;
+    double      peak_gflops           = 0;
+    double      peak_gbps             = 0;
+    bool        any_stride            = false;
+    uint32_t    math_mode             = 0;
+    uint64_t    flush_batch_count     = 1;
+    uint64_t    flush_memory_size     = 0;
+    bool        fortran               = false;
 
     arg.init(); // set all defaults
 
@@ -1563,6 +1708,12 @@ try
          value<int32_t>(&arg.cold_iters)->default_value(2),
          "Cold Iterations to run before entering the timing loop")
 
+        ("timing",
+         value<std::string>(&timing)->default_value("calls"),
+         "calls = time the calls of the timing loop, graph = also capture one call into a hipGraph"
+         " and time iters replays of it, reported as graph-us with the host overhead of a call"
+         " (gemm and copy)")
+
         ("algo",
          value<uint32_t>(&arg.algo)->default_value(0),
          "extended precision gemm algorithm")
@@ -1587,6 +1738,10 @@ try
          bool_switch(&atomics_not_allowed)->default_value(false),
          "Atomic operations with non-determinism in results are not allowed (default false)")
 
+        ("atomics_deterministic",
+         bool_switch(&atomics_deterministic)->default_value(false),
+         "Atomic operations are allowed only where results stay reproducible (default false)")
+
         ("device",
          value<int32_t>(&device_id)->default_value(0),
          "Set default device to be used for subsequent program runs")
@@ -1595,6 +1750,10 @@ try
          value<int32_t>(&parallel_devices)->default_value(0),
          "Set number of devices used for parallel runs (device 0 to parallel_devices-1)")
 
+        ("parallel_handles",
+         value<int32_t>(&parallel_handles)->default_value(1),
+         "Set number of handles, each run by its own thread, on each device of parallel runs")
+
         ("outofplace",
          bool_switch(&arg.outofplace)->default_value(false),
          "for gemm_ex C and D are stored in separate memory, for trmm B and C are stored in separate memory")
@@ -1619,6 +1778,36 @@ try
          bool_switch(&log_datatype)->default_value(false),
          "Include datatypes used in output.")
 
+        ("log_roofline",
+         bool_switch(&log_roofline)->default_value(false),
+         "Include the arithmetic intensity, the percentages of peak Gflops and GB/s and whether "
+         "the run is compute or memory bound in output.")
+
+        ("results",
+         value<std::string>(&results_path),
+         "Append the problem, device, driver, rocBLAS and Tensile commits and timing of each run "
+         "to this results store, one line of JSON per run.")
+
+        ("compare",
+         value<std::string>(&baseline_path),
+         "Compare each run with the run of the same problem in this results store, and report "
+         "significant regressions. The exit status is 1 if there are any.")
+
+        ("compare_threshold",
+         value<double>(&compare_threshold)->default_value(5),
+         "Percentage by which a run must be slower than its baseline to be a regression with "
+         "--compare.")
+
+        ("peak_gflops",
+         value<double>(&peak_gflops)->default_value(0),
+         "Peak Gflops for --log_roofline, estimated from the FP32 vector rate of the device if 0. "
+         "Set it to the matrix core rate of the precision for gemm based functions.")
+
+        ("peak_gbps",
+         value<double>(&peak_gbps)->default_value(0),
+         "Peak memory GB/s for --log_roofline, estimated from the memory clock and bus width of "
+         "the device if 0.")
+
         ("function_filter",
          value<std::string>(&filter),
          "Simple strstr filter on function name only without wildcards")
@@ -1651,6 +1840,22 @@ try
          " dimensions is not loaded to cache and not included in the problem_memory_footprint."
          " If you specify flush_memory_size you cannot also specify flush_batch_count")
 
+        ("hot_operands",
+         value<std::string>(&hot_operands)->default_value(""),
+         "Operands of gemm_ex, any of A, B and C, which are not cycled through the"
+         " flush_batch_count copies, so that they stay in cache across the timed calls, e.g. --hot_operands A for a"
+         " weight matrix reused by an application")
+
+        ("cache_flush",
+         bool_switch(&arg.cache_flush)->default_value(false),
+         "Flush the device caches before each timed gemm_ex call by writing a buffer larger than"
+         " the last level cache, and time only the calls")
+
+        ("noise_bytes",
+         value<uint64_t>(&arg.noise_bytes)->default_value(0),
+         "Bytes copied on the device before each timed gemm_ex call, standing in for the work an"
+         " application does between its calls, which evicts part of the cache")
+
         ("name_filter",
          value<std::string>(&name_filter),
          "Simple strstr filter on test name only without wildcards, only used with --yaml or --data")
@@ -1718,7 +1923,9 @@ try
 
     // transfer local variable state
 
-    arg.atomics_mode = atomics_not_allowed ? rocblas_atomics_not_allowed : rocblas_atomics_allowed;
+    arg.atomics_mode = atomics_not_allowed     ? rocblas_atomics_not_allowed
+                       : atomics_deterministic ? rocblas_atomics_deterministic
+                                               : rocblas_atomics_allowed;
 
     if(api)
         arg.api = rocblas_client_api(api);
@@ -1773,8 +1980,51 @@ try
     FrequencyMonitor& freq_monitor = getFrequencyMonitor();
     freq_monitor.set_device_id(device_id);
 
+    if(!results_path.empty() || !baseline_path.empty())
+    {
+        hipDeviceProp_t props;
+        int             driver_version = 0, runtime_version = 0;
+        CHECK_HIP_ERROR(hipGetDeviceProperties(&props, device_id));
+        CHECK_HIP_ERROR(hipDriverGetVersion(&driver_version));
+        CHECK_HIP_ERROR(hipRuntimeGetVersion(&runtime_version));
+
+        size_t size;
+        rocblas_get_version_string_size(&size);
+        std::string blas_version(size - 1, '\0');
+        rocblas_get_version_string(blas_version.data(), size);
+
+#if BUILD_WITH_TENSILE
+        const char* tensile_commit = rocblas_tensile_commit_hash[1];
+#else
+        const char* tensile_commit = "N/A";
+#endif
+        auto quoted = [](const std::string& s) { return "\"" + s + "\""; };
+
+        rocblas_internal_ostream environment;
+        environment << quoted("arch") << ": " << quoted(props.gcnArchName) << ", "
+                    << quoted("device") << ": " << quoted(props.name) << ", " << quoted("driver")
+                    << ": " << driver_version << ", " << quoted("hip_runtime") << ": "
+                    << runtime_version << ", " << quoted("rocblas") << ": "
+                    << quoted(blas_version) << ", " << quoted("rocblas_commit") << ": "
+                    << quoted(rocblas_tensile_commit_hash[0]) << ", " << quoted("tensile_commit")
+                    << ": " << quoted(tensile_commit);
+        ArgumentModel_set_results(
+            results_path, baseline_path, environment.str(), compare_threshold);
+    }
+
+    if(log_roofline)
+    {
+        rocblas_device_peaks peaks = query_device_peaks(device_id);
+        ArgumentModel_set_roofline(peak_gflops ? peak_gflops : peaks.gflops,
+                                   peak_gbps ? peak_gbps : peaks.gbps,
+                                   peak_gflops ? 0 : peaks.sclk_mhz);
+    }
+
     if(datafile)
-        return rocblas_bench_datafile(filter, name_filter, any_stride);
+    {
+        int ret = rocblas_bench_datafile(filter, name_filter, any_stride);
+        return ret ? ret : ArgumentModel_get_regressions() ? 1 : 0;
+    }
 
     // single bench run
 
@@ -1825,17 +2075,27 @@ try
     if(copied <= 0 || copied >= sizeof(arg.function))
         throw std::invalid_argument("Invalid value for --function");
 
+    copied = snprintf(arg.hot_operands, sizeof(arg.hot_operands), "%s", hot_operands.c_str());
+    if(copied < 0 || copied >= sizeof(arg.hot_operands)
+       || hot_operands.find_first_not_of("ABC") != std::string::npos)
+        throw std::invalid_argument("Invalid value for --hot_operands " + hot_operands);
+
+    if(timing == "graph")
+        arg.timing = Arguments::c_timing_graph;
+    else if(timing != "calls")
+        throw std::invalid_argument("Invalid value for --timing " + timing);
+
     if(!parallel_devices)
     {
         std::string name_filter = "";
         run_bench_test(true, arg, filter, name_filter, any_stride);
     }
     else
-        run_bench_gpu_test(parallel_devices, arg, filter, any_stride);
+        run_bench_gpu_test(parallel_devices, parallel_handles, arg, filter, any_stride);
 
     freeFrequencyMonitor();
 
-    int status = 0;
+    int status = ArgumentModel_get_regressions() ? 1 : 0;
     // TODO: query for any failed tests
 
     return status;
@@ -23,13 +23,22 @@
 
 #include "type_dispatch.hpp"
 
+#include <atomic>
+#include <fstream>
+#include <iterator>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_set>
+#include <vector>
 
 static const auto DELIM = ",";
 
+// Guards the warn-once sets below, since problems are tuned concurrently across devices
+static std::mutex displayed_mutex;
+
 template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
 struct GEMMTunerDispatch
 {
@@ -41,6 +50,7 @@ struct GEMMTunerDispatch
         ss << arg.a_type << arg.c_type << arg.compute_type;
         std::string key = ss.str();
 
+        std::lock_guard<std::mutex> lock(displayed_mutex);
         if(!displayed.count(key))
         {
             displayed.insert(key);
@@ -75,6 +85,7 @@ struct GEMMTunerDispatch<Ti, To, Tc, std::enable_if_t<!std::is_same_v<Tc, void>>
 
             std::string key(arg.function);
 
+            std::lock_guard<std::mutex> lock(displayed_mutex);
             if(!displayed.count(key))
             {
                 displayed.insert(key);
@@ -95,6 +106,70 @@ struct GEMMTunerDispatch<Ti, To, Tc, std::enable_if_t<!std::is_same_v<Tc, void>>
     }
 };
 
+// A unique problem to tune, and where its result is logged
+struct gemm_tune_problem
+{
+    Arguments   arg;
+    std::string key;
+    bool        strided;
+    int         best_solution_index;
+};
+
+// Tune every problem. With more than one device, problems are handed out to one worker
+// thread per device; otherwise each problem runs on the device given in its entry.
+static void gemm_tune_problems(std::vector<gemm_tune_problem>& problems,
+                               const std::vector<int>&         devices)
+{
+    std::atomic<size_t> next{0};
+
+    auto worker = [&](int device) {
+        for(size_t i = next++; i < problems.size(); i = next++)
+        {
+            Arguments arg = problems[i].arg;
+            if(devices.size() > 1)
+                arg.devices = device;
+
+            problems[i].best_solution_index = rocblas_gemm_dispatch<GEMMTunerDispatch>(arg);
+        }
+    };
+
+    if(devices.size() == 1)
+    {
+        worker(devices[0]);
+    }
+    else
+    {
+        std::vector<std::thread> threads;
+        for(int id : devices)
+            threads.emplace_back(worker, id);
+        for(auto& t : threads)
+            t.join();
+    }
+}
+
+// Devices 0 to count-1 which are identical to device 0, so that a solution tuned on any of them
+// is the best one on all of them
+static std::vector<int> identical_devices(int count)
+{
+    std::vector<int> devices{0};
+    hipDeviceProp_t  first;
+    CHECK_HIP_ERROR(hipGetDeviceProperties(&first, 0));
+    for(int id = 1; id < count; ++id)
+    {
+        hipDeviceProp_t props;
+        CHECK_HIP_ERROR(hipGetDeviceProperties(&props, id));
+        if(!strcmp(props.gcnArchName, first.gcnArchName)
+           && props.multiProcessorCount == first.multiProcessorCount
+           && props.clockRate == first.clockRate)
+            devices.push_back(id);
+        else
+            rocblas_cout << "rocblas-gemm-tune INFO: skipping device " << id << " (" << props.name
+                         << " " << props.gcnArchName << "), which differs from device 0"
+                         << std::endl;
+    }
+    return devices;
+}
+
 int main(int argc, char* argv[])
 {
 #if BUILD_WITH_TENSILE
@@ -103,7 +178,12 @@ int main(int argc, char* argv[])
     {
         rocblas_cout << "Usage:"
                      << "\n"
-                     << "  <path> points to file generated by profile logging."
+                     << "  " << argv[0]
+                     << " [ --data <path> | --yaml <path> ] [ -o <override path> ]"
+                        " [ --devices <count> ] [ --plan <index path> [ --candidates <count> ] ]"
+                     << "\n\n"
+                     << "  <path> points to file generated by profile logging, or to a yaml"
+                        " file of problems."
                      << "\n\n"
                      << "  To activate profile logging use environment variable ROCBLAS_LAYER:"
                      << "\n"
@@ -114,11 +194,64 @@ int main(int argc, char* argv[])
                      << "  - {'rocblas_function': 'rocblas_sgemm', 'transA': 'T', 'transB': 'N', "
                         "'M': 512, 'N': 8320, 'K': 512, 'alpha': 1, 'lda': 512, 'ldb': 512, "
                         "'beta': 0, 'ldc': 512, 'device': 0, 'cold_iters': 5, 'iters': 20}"
+                     << "\n\n"
+                     << "  -o <override path> writes the results to a file which can be loaded"
+                        " with ROCBLAS_TENSILE_GEMM_OVERRIDE_PATH."
+                     << "\n"
+                     << "  --devices <count> tunes on the devices among 0 to count-1 which are"
+                        " identical to device 0 in parallel (default: all visible devices)."
+                     << "\n"
+                     << "  --exhaustive times every solution with cold_iters + iters calls,"
+                        " instead of pruning the slower ones by successive halving."
+                     << "\n"
+                     << "  --plan <index path> writes a plan of the problems instead: each is run"
+                        " once with the solution rocBLAS selects, autotuned over up to"
+                        " --candidates solutions (default: 16), and the selections, with their"
+                        " code objects and workspace sizes, are written as a solution index which"
+                        " is loaded with ROCBLAS_TENSILE_SOLUTION_INDEX."
                      << std::endl;
         return EXIT_FAILURE;
     }
 
-    rocblas_parallel_initialize(1);
+    std::string override_path, plan_path;
+    int         devices    = 0;
+    int         candidates = 16;
+    for(int i = 1; i < argc; ++i)
+    {
+        if((!strcmp(argv[i], "-o") || !strcmp(argv[i], "--output")) && i + 1 < argc)
+            override_path = argv[++i];
+        else if(!strcmp(argv[i], "--devices") && i + 1 < argc)
+            devices = atoi(argv[++i]);
+        else if(!strcmp(argv[i], "--exhaustive"))
+            gemm_tune_pruning = false;
+        else if(!strcmp(argv[i], "--plan") && i + 1 < argc)
+            plan_path = argv[++i];
+        else if(!strcmp(argv[i], "--candidates") && i + 1 < argc)
+            candidates = atoi(argv[++i]);
+        else
+        {
+            rocblas_cerr << "rocblas-gemm-tune ERROR: unrecognized option: " << argv[i]
+                         << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    int device_count;
+    CHECK_HIP_ERROR(hipGetDeviceCount(&device_count));
+    if(devices <= 0 || devices > device_count)
+        devices = device_count;
+
+    // The selections of a plan are recorded from the start, as the file is read by the devices
+    // when they are initialized
+    std::string selections_path = plan_path + ".selections";
+    if(!plan_path.empty())
+    {
+        gemm_tune_plan_candidates = std::max(candidates, 1);
+        remove(selections_path.c_str());
+        CHECK_ROCBLAS_ERROR(rocblas_set_solution_cache_file(selections_path.c_str()));
+    }
+
+    rocblas_parallel_initialize(devices);
     rocblas_cout << "\n";
 
     // Keep separate streams for strided/non-strided since param numbers are different
@@ -140,16 +273,15 @@ int main(int argc, char* argv[])
                        << "solution_index"
                        << "\n";
 
-    rocblas_internal_ostream* current_os;
-    bool*                     current_entry;
-
     // Track unique args to avoid duplicates
     std::unordered_set<std::string> processed{};
+    std::vector<gemm_tune_problem>  problems;
 
-    // Benchmark each case
+    // Collect each case
     for(const Arguments& arg : RocBLAS_TestData())
     {
         std::stringstream ss;
+        bool              strided;
 
         // Build log entry, which doubles as set key for duplicate check
         if(!strcmp(arg.function, "gemm") || !strcmp(arg.function, "gemm_ex")
@@ -162,8 +294,7 @@ int main(int argc, char* argv[])
                << rocblas_datatype2string(arg.c_type) << DELIM
                << rocblas_datatype2string(arg.compute_type);
 
-            current_os    = &gemm_ex_os;
-            current_entry = &gemm_ex_has_entries;
+            strided = false;
         }
         else
         {
@@ -176,40 +307,103 @@ int main(int argc, char* argv[])
                << rocblas_datatype2string(arg.c_type) << DELIM
                << rocblas_datatype2string(arg.compute_type);
 
-            current_os    = &gemm_strided_ex_os;
-            current_entry = &gemm_strided_ex_has_entries;
+            strided = true;
         }
 
         std::string arg_key = ss.str();
         if(!processed.count(arg_key))
         {
             processed.insert(arg_key);
+            problems.push_back({arg, arg_key, strided, -1});
+        }
+    }
+
+    // run benchmarks
+    gemm_tune_problems(problems, devices > 1 ? identical_devices(devices) : std::vector<int>{0});
+
+    if(!plan_path.empty())
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_solution_cache_file(nullptr));
+        if(rocblas_build_solution_index(selections_path.c_str(), plan_path.c_str())
+           != rocblas_status_success)
+        {
+            rocblas_cerr << "rocblas-gemm-tune ERROR: could not write the plan " << plan_path
+                         << " from " << selections_path << std::endl;
+            return EXIT_FAILURE;
+        }
 
-            // run benchmark
-            int best_solution_index = rocblas_gemm_dispatch<GEMMTunerDispatch>(arg);
+        // The selections are lines of <arch> <solution index> <xf32 fallback> <code objects>
+        // <signature size> <signature...> <workspace size> <solution name>
+        std::ifstream selections(selections_path);
+        std::string   line;
+        size_t        planned = 0;
+        while(std::getline(selections, line))
+        {
+            std::istringstream       is(line);
+            std::vector<std::string> fields{std::istream_iterator<std::string>(is),
+                                            std::istream_iterator<std::string>()};
+            if(fields.size() < 7)
+                continue;
+            rocblas_cout << "rocblas-gemm-tune INFO: " << fields[0] << " solution "
+                         << fields[1] << " workspace " << fields[fields.size() - 2] << " "
+                         << fields.back() << std::endl;
+            planned++;
+        }
+        rocblas_cout << "rocblas-gemm-tune INFO: wrote the plan of " << planned << " selections to "
+                     << plan_path << ", load it with ROCBLAS_TENSILE_SOLUTION_INDEX=" << plan_path
+                     << std::endl;
+
+        test_cleanup::cleanup();
+        return EXIT_SUCCESS;
+    }
 
-            // log result, if solution is found
-            if(best_solution_index > 0)
+    // log results in input order, if solution is found
+    for(const auto& problem : problems)
+    {
+        if(problem.best_solution_index > 0)
+        {
+            if(problem.strided)
             {
-                *current_entry = true;
-                *current_os << arg_key << DELIM << best_solution_index << "\n";
+                gemm_strided_ex_has_entries = true;
+                gemm_strided_ex_os << problem.key << DELIM << problem.best_solution_index << "\n";
+            }
+            else
+            {
+                gemm_ex_has_entries = true;
+                gemm_ex_os << problem.key << DELIM << problem.best_solution_index << "\n";
             }
         }
     }
 
     // final log
+    std::ostringstream log;
     if(gemm_ex_has_entries)
     {
-        rocblas_cout << gemm_ex_os;
+        log << gemm_ex_os.str();
 
         if(gemm_strided_ex_has_entries)
-            rocblas_cout << "\n";
+            log << "\n";
     }
 
     if(gemm_strided_ex_has_entries)
-        rocblas_cout << gemm_strided_ex_os;
+        log << gemm_strided_ex_os.str();
+
+    rocblas_cout << log.str() << std::endl;
 
-    rocblas_cout << std::endl;
+    if(!override_path.empty())
+    {
+        std::ofstream override_file(override_path);
+        override_file << log.str();
+        if(!override_file)
+        {
+            rocblas_cerr << "rocblas-gemm-tune ERROR: could not write " << override_path
+                         << std::endl;
+            return EXIT_FAILURE;
+        }
+        rocblas_cout << "rocblas-gemm-tune INFO: wrote overrides to " << override_path
+                     << ", load them with ROCBLAS_TENSILE_GEMM_OVERRIDE_PATH=" << override_path
+                     << std::endl;
+    }
 
     test_cleanup::cleanup();
     return EXIT_SUCCESS;
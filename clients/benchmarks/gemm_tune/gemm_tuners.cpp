@@ -21,6 +21,11 @@
  * ************************************************************************ */
 #include "gemm_tuners.hpp"
 
+#include <algorithm>
+
+bool gemm_tune_pruning         = true;
+int  gemm_tune_plan_candidates = 0;
+
 /* COMMON */
 template <typename Tc>
 GEMMTunerBase<Tc>::GEMMTunerBase(const Arguments& arg)
@@ -66,9 +71,27 @@ GEMMTunerBase<Tc>::GEMMTunerBase(const Arguments& arg)
     }
 }
 
+template <typename Tc>
+int GEMMTunerBase<Tc>::run_selected()
+{
+    CHECK_HIP_ERROR(hipSetDevice(m_device));
+    CHECK_ROCBLAS_ERROR(rocblas_set_autotune(m_handle, gemm_tune_plan_candidates, 0));
+
+    // solution index 0 leaves the selection to rocBLAS
+    CHECK_ROCBLAS_ERROR(run_with_solution(0));
+
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(m_handle, &stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    return 0;
+}
+
 template <typename Tc>
 int GEMMTunerBase<Tc>::get_best_solution()
 {
+    if(gemm_tune_plan_candidates)
+        return run_selected();
+
     CHECK_HIP_ERROR(hipSetDevice(m_device));
 
     // Get all solutions
@@ -78,39 +101,73 @@ int GEMMTunerBase<Tc>::get_best_solution()
     std::vector<rocblas_int> solutions(n_solutions);
     CHECK_ROCBLAS_ERROR(get_solutions(solutions.data(), &n_solutions));
 
-    // Benchmark each and return best
-    double         best_time = std::numeric_limits<double>::max();
-    rocblas_int    best_sol  = -1;
-    rocblas_status status;
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(m_handle, &stream));
 
-    for(auto sol : solutions)
-    {
+    // Average time of a solution over iters calls, after cold_iters calls
+    auto time_solution = [&](rocblas_int sol, rocblas_int cold_iters, rocblas_int iters) {
         // warmup
-        for(rocblas_int c = 0; c < m_cold_iters; ++c)
+        for(rocblas_int c = 0; c < cold_iters; ++c)
         {
             CHECK_ROCBLAS_ERROR(run_with_solution(sol));
         }
-        hipStream_t stream;
-        CHECK_ROCBLAS_ERROR(rocblas_get_stream(m_handle, &stream));
         double time = get_time_us_sync(stream); // in microseconds
 
         // timing loop
-        for(rocblas_int c = 0; c < m_iters; ++c)
+        for(rocblas_int c = 0; c < iters; ++c)
         {
             CHECK_ROCBLAS_ERROR(run_with_solution(sol));
         }
         time = get_time_us_sync(stream) - time;
+        return iters ? (time / iters) : 0;
+    };
 
-        // track winner
-        double avg_time = m_iters ? (time / m_iters) : 0;
-        if(avg_time < best_time)
+    if(!gemm_tune_pruning || solutions.size() < 2)
+    {
+        // Benchmark each and return best
+        double      best_time = std::numeric_limits<double>::max();
+        rocblas_int best_sol  = -1;
+
+        for(auto sol : solutions)
         {
-            best_sol  = sol;
-            best_time = avg_time;
+            // track winner
+            double avg_time = time_solution(sol, m_cold_iters, m_iters);
+            if(avg_time < best_time)
+            {
+                best_sol  = sol;
+                best_time = avg_time;
+            }
         }
+
+        return best_sol;
+    }
+
+    // Successive halving: every solution is timed with a few iterations, the faster half is kept
+    // and timed with twice as many, until the last two are timed with m_iters. Solutions are
+    // warmed up with m_cold_iters calls once, and with one call in the later rounds.
+    int rounds = 0;
+    for(size_t n = solutions.size(); n > 1; n = (n + 1) / 2)
+        rounds++;
+
+    std::vector<std::pair<double, rocblas_int>> timed;
+    for(int round = 0; round < rounds; ++round)
+    {
+        rocblas_int iters      = std::max(m_iters >> (rounds - 1 - round), 1);
+        rocblas_int cold_iters = round ? std::min(m_cold_iters, 1) : m_cold_iters;
+
+        timed.clear();
+        for(auto sol : solutions)
+            timed.emplace_back(time_solution(sol, cold_iters, iters), sol);
+        std::stable_sort(timed.begin(), timed.end(), [](const auto& a, const auto& b) {
+            return a.first < b.first;
+        });
+
+        solutions.resize((solutions.size() + 1) / 2);
+        for(size_t i = 0; i < solutions.size(); ++i)
+            solutions[i] = timed[i].second;
     }
 
-    return best_sol;
+    return solutions.front();
 }
 
 /* GEMM Ex */
@@ -34,6 +34,15 @@
 #include "rocblas_matrix.hpp"
 #include "rocblas_parse_data.hpp"
 
+// Whether get_best_solution prunes the slower solutions by successive halving, instead of timing
+// every solution with cold_iters + iters calls
+extern bool gemm_tune_pruning;
+
+// When nonzero, get_best_solution does not time the solutions itself, but runs the problem once
+// with the selection of rocBLAS, autotuned over up to this many solutions, so that the selection
+// is recorded in the solution cache file of a plan
+extern int gemm_tune_plan_candidates;
+
 template <typename Tc>
 class GEMMTunerBase
 {
@@ -43,6 +52,9 @@ public:
 
     int get_best_solution();
 
+    // Run the problem once with the solution rocBLAS selects, returning 0
+    int run_selected();
+
 private:
     // These two methods marshall the GEMM calls depending on function type
     // They are both required for `get_best_solution()` to run
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+# ########################################################################
+# Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+# ########################################################################
+
+
+"""Tune the gemmt path selection of rocBLAS for the current device.
+
+The thresholds of the gemmt selection table (library/src/blas_ex/rocblas_blas_ex_threshold.hpp)
+bound the sizes n and k from which gemmt uses the GEMM based block recursive algorithm instead of
+the direct gemmt kernels. For every precision rocblas-bench times gemmt over a range of n at a
+fixed large k, once with the recursive algorithm forced on and once forced off through a temporary
+table, and recursive_n_lower is placed after the last n at which the recursive algorithm loses.
+recursive_k_lower is tuned likewise over a range of k at a fixed large n. The result is written as
+GemmtTuning_<arch>.txt, which rocBLAS loads when ROCBLAS_GEMMT_TUNING_PATH names the directory
+containing it.
+
+Example:
+    rocblas-gemmt-tune.py --arch gfx942 --sizes 256:4096:128 -o tuning/
+    ROCBLAS_GEMMT_TUNING_PATH=tuning/ ./my_application
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+
+PRECISIONS = "sdcz"
+
+# thresholds written to the table, in the order of the file
+MEMBERS = ["recursive_n_lower", "recursive_k_lower"]
+
+
+def parse_sizes(text):
+    first, last, step = (int(v) for v in text.split(":"))
+    return list(range(first, last + 1, step))
+
+
+def write_table(directory, arch, table):
+    path = os.path.join(directory, "GemmtTuning_" + arch + ".txt")
+    with open(path, "w") as f:
+        f.write("# " + " ".join(["threshold"] + list(PRECISIONS)) + "\n")
+        for name in MEMBERS:
+            if name in table:
+                f.write(" ".join([name] + table[name]) + "\n")
+    return path
+
+
+def time_us(args, env, precision, n, k):
+    # A is n x k and B is k x n before their operations
+    lda = n if args.transA == "N" else k
+    ldb = k if args.transB == "N" else n
+    command = [args.bench, "-f", "gemmt", "-r", precision, "--uplo", args.uplo,
+               "--transposeA", args.transA, "--transposeB", args.transB, "-n", str(n),
+               "-k", str(k), "--lda", str(lda), "--ldb", str(ldb), "--ldc", str(n),
+               "-i", str(args.iters), "-j", str(args.cold_iters), "--device", str(args.device)]
+    output = subprocess.run(command, env=env, capture_output=True, text=True, check=True).stdout
+    lines = output.splitlines()
+    for i, line in enumerate(lines[:-1]):
+        names = [v.strip() for v in line.split(",")]
+        if "us" in names:
+            return float(lines[i + 1].split(",")[names.index("us")])
+    raise RuntimeError("no timing in output of " + " ".join(command))
+
+
+def tune(args, name, precision):
+    """First size of the sweep from which the recursive algorithm wins at every size."""
+    problems = ([(size, args.k) for size in args.sizes] if name == "recursive_n_lower"
+                else [(args.n, size) for size in args.sizes])
+    with tempfile.TemporaryDirectory() as directory:
+        env = dict(os.environ, ROCBLAS_GEMMT_TUNING_PATH=directory)
+        times = {}
+        for variant, value in (("off", "max"), ("on", "0")):
+            write_table(directory, args.arch, {m: [value] * len(PRECISIONS) for m in MEMBERS})
+            times[variant] = [time_us(args, env, precision, n, k) for n, k in problems]
+
+    wins = [(size, t_on < t_off)
+            for size, t_off, t_on in zip(args.sizes, times["off"], times["on"])]
+    losses = [size for size, win in wins if not win]
+    value = "0" if not losses else "max" if losses[-1] == args.sizes[-1] else str(losses[-1] + 1)
+    if args.verbose:
+        print(name, precision, " ".join("%d:%s" % (s, "on" if w else "off") for s, w in wins))
+    return value
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__.splitlines()[0],
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter)
+    parser.add_argument("--arch", required=True,
+                        help="architecture of the device, e.g. gfx942, naming the table")
+    parser.add_argument("--bench", default="./rocblas-bench", help="path of rocblas-bench")
+    parser.add_argument("--device", type=int, default=0, help="device to tune")
+    parser.add_argument("--sizes", type=parse_sizes, default="256:4096:128",
+                        help="sizes n or k as first:last:step")
+    parser.add_argument("-n", type=int, default=4096, help="n of the recursive_k_lower problems")
+    parser.add_argument("-k", type=int, default=4096, help="k of the recursive_n_lower problems")
+    parser.add_argument("--uplo", default="U", choices="UL", help="triangle of C")
+    parser.add_argument("--transA", default="N", choices="NTC", help="operation on A")
+    parser.add_argument("--transB", default="T", choices="NTC", help="operation on B")
+    parser.add_argument("--iters", type=int, default=10, help="timed iterations per size")
+    parser.add_argument("--cold_iters", type=int, default=2, help="warm-up iterations per size")
+    parser.add_argument("--thresholds", nargs="+", default=MEMBERS, choices=MEMBERS,
+                        metavar="THRESHOLD", help="thresholds to tune")
+    parser.add_argument("-o", "--output", default=".", help="directory for the table")
+    parser.add_argument("-v", "--verbose", action="store_true",
+                        help="print which path wins at each size")
+    args = parser.parse_args()
+
+    table = {name: [tune(args, name, p) for p in PRECISIONS] for name in args.thresholds}
+
+    print("wrote", write_table(args.output, args.arch, table))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,329 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * rocblas-latency-bench measures the latency of rocBLAS functions at tiny sizes, where the host
+ * overhead of a call and the time to launch and complete its kernels dominate:
+ *
+ *   api-us           host time from entering the function to its return, which is after its
+ *                    kernels are launched, of calls made back to back
+ *   latency-us       host time from entering the function to the completion of its kernels,
+ *                    synchronizing the stream after each call
+ *   graph-launch-us  host time of hipGraphLaunch of a graph capturing one call, back to back
+ *   graph-latency-us host time from hipGraphLaunch to the completion of the graph
+ *
+ * The scalars and results are in device memory, so that every call can be captured. The output
+ * is CSV headed by the rocBLAS version, so that the results of releases can be kept and given
+ * again with --baseline, which adds the ratios of the latencies to those of the baseline.
+ *
+ * The _fast functions, which skip the argument checks and logging, are measured next to the
+ * functions they match. With --fast-budget the run fails if the api-us of a _fast function
+ * exceeds the budget, so that the host overhead of the fast tier is held to it.
+ */
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_test.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+static const auto DELIM = ",";
+
+struct latency_case
+{
+    const char*                                   function;
+    std::function<rocblas_status(rocblas_handle)> call;
+};
+
+struct latency_result
+{
+    double api_us;
+    double latency_us;
+    double graph_launch_us;
+    double graph_latency_us;
+};
+
+static latency_result measure(rocblas_handle handle, const latency_case& c, int iters)
+{
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    // warm up, which also loads the kernels and selects the Tensile solutions
+    for(int i = 0; i < 10; i++)
+        CHECK_ROCBLAS_ERROR(c.call(handle));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    latency_result result{};
+
+    double start = get_time_us_no_sync();
+    for(int i = 0; i < iters; i++)
+        CHECK_ROCBLAS_ERROR(c.call(handle));
+    result.api_us = (get_time_us_no_sync() - start) / iters;
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    start = get_time_us_no_sync();
+    for(int i = 0; i < iters; i++)
+    {
+        CHECK_ROCBLAS_ERROR(c.call(handle));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+    result.latency_us = (get_time_us_no_sync() - start) / iters;
+
+#if HIP_VERSION >= 50500000
+    hipGraph_t     graph;
+    hipGraphExec_t instance;
+    CHECK_HIP_ERROR(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    CHECK_ROCBLAS_ERROR(c.call(handle));
+    CHECK_HIP_ERROR(hipStreamEndCapture(stream, &graph));
+    CHECK_HIP_ERROR(hipGraphInstantiate(&instance, graph, nullptr, nullptr, 0));
+
+    CHECK_HIP_ERROR(hipGraphLaunch(instance, stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    start = get_time_us_no_sync();
+    for(int i = 0; i < iters; i++)
+        CHECK_HIP_ERROR(hipGraphLaunch(instance, stream));
+    result.graph_launch_us = (get_time_us_no_sync() - start) / iters;
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    start = get_time_us_no_sync();
+    for(int i = 0; i < iters; i++)
+    {
+        CHECK_HIP_ERROR(hipGraphLaunch(instance, stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+    result.graph_latency_us = (get_time_us_no_sync() - start) / iters;
+
+    CHECK_HIP_ERROR(hipGraphExecDestroy(instance));
+    CHECK_HIP_ERROR(hipGraphDestroy(graph));
+#endif
+
+    return result;
+}
+
+// latency-us and graph-latency-us of each function of a previous output
+static std::map<std::string, std::pair<double, double>> read_baseline(const std::string& path)
+{
+    std::map<std::string, std::pair<double, double>> baseline;
+    std::ifstream                                    file(path);
+    std::string                                      line;
+    while(std::getline(file, line))
+    {
+        std::vector<std::string> fields;
+        std::stringstream        ss(line);
+        for(std::string field; std::getline(ss, field, ',');)
+            fields.push_back(field);
+        if(fields.size() >= 6 && fields[0] != "function")
+            baseline[fields[0] + DELIM + fields[1]]
+                = {std::atof(fields[3].c_str()), std::atof(fields[5].c_str())};
+    }
+    return baseline;
+}
+
+int main(int argc, char** argv)
+{
+    int         device = 0;
+    int         iters  = 1000;
+    int64_t     n      = 16;
+    double      fast_budget_us = 0;
+    std::string output_path;
+    std::string baseline_path;
+    for(int i = 1; i < argc; ++i)
+    {
+        if((!strcmp(argv[i], "-o") || !strcmp(argv[i], "--output")) && i + 1 < argc)
+            output_path = argv[++i];
+        else if(!strcmp(argv[i], "--baseline") && i + 1 < argc)
+            baseline_path = argv[++i];
+        else if(!strcmp(argv[i], "--fast-budget") && i + 1 < argc)
+            fast_budget_us = atof(argv[++i]);
+        else if(!strcmp(argv[i], "--device") && i + 1 < argc)
+            device = atoi(argv[++i]);
+        else if((!strcmp(argv[i], "-i") || !strcmp(argv[i], "--iters")) && i + 1 < argc)
+            iters = std::max(atoi(argv[++i]), 1);
+        else if((!strcmp(argv[i], "-n") || !strcmp(argv[i], "--sizen")) && i + 1 < argc)
+            n = std::max(atoi(argv[++i]), 1);
+        else
+        {
+            rocblas_cerr << "Usage: " << argv[0]
+                         << " [-n <size, default 16>] [-i <iters, default 1000>]"
+                            " [--device <id>] [-o <csv path>] [--baseline <csv path>]"
+                            " [--fast-budget <api-us of the _fast functions>]"
+                         << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    CHECK_HIP_ERROR(hipSetDevice(device));
+    rocblas_initialize();
+
+    rocblas_handle handle;
+    CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, stream));
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+    // square n by n matrices, with an identity diagonal for the triangular solves
+    constexpr int64_t  batch_count = 4;
+    std::vector<float> hA(n * n * batch_count, 0.5f / n), hx(n * batch_count, 1.0f);
+    for(int64_t b = 0; b < batch_count; b++)
+        for(int64_t i = 0; i < n; i++)
+            hA[b * n * n + i * n + i] = 1.0f;
+    float  h_scalars[2] = {1.0f, 0.0f};
+    float *dA, *dB, *dC, *dx, *dy, *d_scalars, *d_result;
+    CHECK_HIP_ERROR(hipMalloc(&dA, hA.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dB, hA.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dC, hA.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dx, hx.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dy, hx.size() * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&d_scalars, sizeof(h_scalars)));
+    CHECK_HIP_ERROR(hipMalloc(&d_result, sizeof(float)));
+    for(float* d : {dA, dB, dC})
+        CHECK_HIP_ERROR(
+            hipMemcpy(d, hA.data(), hA.size() * sizeof(float), hipMemcpyHostToDevice));
+    for(float* d : {dx, dy})
+        CHECK_HIP_ERROR(
+            hipMemcpy(d, hx.data(), hx.size() * sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_scalars, h_scalars, sizeof(h_scalars), hipMemcpyHostToDevice));
+
+    const float*      alpha = d_scalars;
+    const float*      beta  = d_scalars + 1;
+    const rocblas_int N     = rocblas_int(n);
+    const auto        nn    = rocblas_stride(n * n);
+
+    // clang-format off
+    const latency_case cases[] = {
+        {"scal", [&](rocblas_handle h) { return rocblas_sscal(h, N, beta, dy, 1); }},
+        {"scal_fast", [&](rocblas_handle h) { return rocblas_sscal_fast(h, N, beta, dy, 1); }},
+        {"axpy", [&](rocblas_handle h) { return rocblas_saxpy(h, N, alpha, dx, 1, dy, 1); }},
+        {"axpy_fast", [&](rocblas_handle h) {
+             return rocblas_saxpy_fast(h, N, alpha, dx, 1, dy, 1);
+         }},
+        {"dot",  [&](rocblas_handle h) { return rocblas_sdot(h, N, dx, 1, dy, 1, d_result); }},
+        {"nrm2", [&](rocblas_handle h) { return rocblas_snrm2(h, N, dx, 1, d_result); }},
+        {"gemv", [&](rocblas_handle h) {
+             return rocblas_sgemv(h, rocblas_operation_none, N, N, alpha, dA, N, dx, 1, beta, dy,
+                                  1);
+         }},
+        {"gemv_fast", [&](rocblas_handle h) {
+             return rocblas_sgemv_fast(h, rocblas_operation_none, N, N, alpha, dA, N, dx, 1, beta,
+                                       dy, 1);
+         }},
+        {"symv", [&](rocblas_handle h) {
+             return rocblas_ssymv(h, rocblas_fill_upper, N, alpha, dA, N, dx, 1, beta, dy, 1);
+         }},
+        {"ger", [&](rocblas_handle h) { return rocblas_sger(h, N, N, beta, dx, 1, dy, 1, dC, N); }},
+        {"trsv", [&](rocblas_handle h) {
+             return rocblas_strsv(h, rocblas_fill_lower, rocblas_operation_none,
+                                  rocblas_diagonal_unit, N, dA, N, dy, 1);
+         }},
+        {"gemm", [&](rocblas_handle h) {
+             return rocblas_sgemm(h, rocblas_operation_none, rocblas_operation_none, N, N, N,
+                                  alpha, dA, N, dB, N, beta, dC, N);
+         }},
+        {"gemm_fast", [&](rocblas_handle h) {
+             return rocblas_sgemm_fast(h, rocblas_operation_none, rocblas_operation_none, N, N, N,
+                                       alpha, dA, N, dB, N, beta, dC, N);
+         }},
+        {"gemm_strided_batched", [&](rocblas_handle h) {
+             return rocblas_sgemm_strided_batched(h, rocblas_operation_none, rocblas_operation_none,
+                                                  N, N, N, alpha, dA, N, nn, dB, N, nn, beta, dC,
+                                                  N, nn, batch_count);
+         }},
+        {"trsm", [&](rocblas_handle h) {
+             return rocblas_strsm(h, rocblas_side_left, rocblas_fill_lower,
+                                  rocblas_operation_none, rocblas_diagonal_unit, N, N, alpha, dA,
+                                  N, dC, N);
+         }},
+    };
+    // clang-format on
+
+    auto baseline = baseline_path.empty() ? std::map<std::string, std::pair<double, double>>{}
+                                          : read_baseline(baseline_path);
+
+    size_t size;
+    rocblas_get_version_string_size(&size);
+    std::string version(size - 1, '\0');
+    rocblas_get_version_string(version.data(), size);
+
+    rocblas_internal_ostream os;
+    os << "rocBLAS version: " << version << "\n"
+       << "function" << DELIM << "n" << DELIM << "api-us" << DELIM << "latency-us" << DELIM
+       << "graph-launch-us" << DELIM << "graph-latency-us";
+    if(!baseline.empty())
+        os << DELIM << "latency-vs-baseline" << DELIM << "graph-latency-vs-baseline";
+    os << "\n";
+
+    std::vector<std::string> over_budget;
+    for(const latency_case& c : cases)
+    {
+        latency_result r = measure(handle, c, iters);
+        if(fast_budget_us > 0 && strstr(c.function, "_fast") && r.api_us > fast_budget_us)
+            over_budget.push_back(c.function);
+        os << c.function << DELIM << n << DELIM << r.api_us << DELIM << r.latency_us << DELIM
+           << r.graph_launch_us << DELIM << r.graph_latency_us;
+
+        auto b = baseline.find(std::string(c.function) + DELIM + std::to_string(n));
+        if(!baseline.empty())
+        {
+            if(b == baseline.end() || !b->second.first || !b->second.second)
+                os << DELIM << DELIM;
+            else
+                os << DELIM << r.latency_us / b->second.first << DELIM
+                   << r.graph_latency_us / b->second.second;
+        }
+        os << "\n";
+    }
+
+    rocblas_cout << os.str() << std::flush;
+
+    if(!output_path.empty())
+    {
+        std::ofstream output_file(output_path);
+        output_file << os.str();
+        if(!output_file)
+        {
+            rocblas_cerr << "rocblas-latency-bench ERROR: could not write " << output_path
+                         << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    for(float* d : {dA, dB, dC, dx, dy, d_scalars, d_result})
+        CHECK_HIP_ERROR(hipFree(d));
+    CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+
+    for(const std::string& function : over_budget)
+        rocblas_cerr << "rocblas-latency-bench ERROR: api-us of " << function
+                     << " exceeds the budget of " << fast_budget_us << " us" << std::endl;
+    return over_budget.empty() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,180 @@
+#!/usr/bin/env python3
+# ########################################################################
+# Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+# ########################################################################
+
+"""Tune the gemv and symv kernel selection of rocBLAS for the current device.
+
+Each threshold of the Level-2 selection table (library/src/blas2/rocblas_level2_threshold.hpp)
+decides whether one kernel variant is used for a problem size. For every threshold and precision
+the variant is timed with rocblas-bench over a range of square sizes, once forced on and once
+forced off through a temporary table, and the threshold is placed where the variant stops or
+starts winning. Thresholds and precisions which are not tuned are written as "-", keeping the
+defaults of the architecture. The result is written as Level2Tuning_<arch>.txt, which rocBLAS
+loads when ROCBLAS_LEVEL2_TUNING_PATH names the directory containing it.
+
+Example:
+    rocblas-level2-tune.py --arch gfx942 --sizes 1024:32768:1024 -o tuning/
+    ROCBLAS_LEVEL2_TUNING_PATH=tuning/ ./my_application
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+
+PRECISIONS = "sdczh"
+
+# threshold: (function, operation option, selected when, size alignment, size offset,
+#             table entries forcing the variant off, on, and clearing earlier variants)
+# A variant selected "below" the threshold is taken for sizes under it, one selected "above"
+# for sizes over it. The alignment and offset give the sizes the variant is considered for.
+TUNABLES = {
+    "gemvn_upper": ("gemv", ("--transposeA", "N"), "below", 1, 0,
+                    {"gemvn_upper": "0", "gemvn_lower": "max"}, {"gemvn_upper": "max"}, {}),
+    "gemvn_lower": ("gemv", ("--transposeA", "N"), "above", 1, 0,
+                    {"gemvn_upper": "0", "gemvn_lower": "max"}, {"gemvn_lower": "0"}, {}),
+    "gemvt_double_buffered_lower": ("gemv", ("--transposeA", "T"), "above", 128, 0,
+                                    {"gemvt_double_buffered_lower": "max"},
+                                    {"gemvt_double_buffered_lower": "0"}, {}),
+    "gemvt_warp_reduce_upper": ("gemv", ("--transposeA", "T"), "below", 1, 0,
+                                {"gemvt_warp_reduce_upper": "0"},
+                                {"gemvt_warp_reduce_upper": "max"},
+                                {"gemvt_double_buffered_lower": "max"}),
+    "gemvt_shared_upper": ("gemv", ("--transposeA", "T"), "below", 1, 0,
+                           {"gemvt_shared_upper": "0"}, {"gemvt_shared_upper": "max"},
+                           {"gemvt_double_buffered_lower": "max",
+                            "gemvt_warp_reduce_upper": "0"}),
+    "symv_U_aligned": ("symv", ("--uplo", "U"), "below", 32, 0,
+                       {"symv_U_aligned": "0"}, {"symv_U_aligned": "max"}, {}),
+    "symv_U_unaligned_upper": ("symv", ("--uplo", "U"), "below", 32, 1,
+                               {"symv_U_unaligned_upper": "0", "symv_U_unaligned_lower": "max"},
+                               {"symv_U_unaligned_upper": "max"}, {}),
+    "symv_U_unaligned_lower": ("symv", ("--uplo", "U"), "above", 32, 1,
+                               {"symv_U_unaligned_upper": "0", "symv_U_unaligned_lower": "max"},
+                               {"symv_U_unaligned_lower": "0"}, {}),
+    "symv_L_aligned": ("symv", ("--uplo", "L"), "below", 32, 0,
+                       {"symv_L_aligned": "0"}, {"symv_L_aligned": "max"}, {}),
+    "symv_L_unaligned_upper": ("symv", ("--uplo", "L"), "below", 32, 1,
+                               {"symv_L_unaligned_upper": "0", "symv_L_unaligned_lower": "max"},
+                               {"symv_L_unaligned_upper": "max"}, {}),
+    "symv_L_unaligned_lower": ("symv", ("--uplo", "L"), "above", 32, 1,
+                               {"symv_L_unaligned_upper": "0", "symv_L_unaligned_lower": "max"},
+                               {"symv_L_unaligned_lower": "0"}, {}),
+}
+
+# the double buffered gemv (transpose) kernels exist in single and double precision only
+TUNED_PRECISIONS = {"gemvt_double_buffered_lower": "sd"}
+
+
+def parse_sizes(text):
+    first, last, step = (int(v) for v in text.split(":"))
+    return list(range(first, last + 1, step))
+
+
+def write_table(directory, arch, table):
+    path = os.path.join(directory, "Level2Tuning_" + arch + ".txt")
+    with open(path, "w") as f:
+        f.write("# " + " ".join(["threshold"] + list(PRECISIONS)) + "\n")
+        for name in TUNABLES:
+            if name in table:
+                f.write(" ".join([name] + table[name]) + "\n")
+    return path
+
+
+def time_us(args, env, function, precision, option, size):
+    command = [args.bench, "-f", function, "-r", precision, option[0], option[1],
+               "-m", str(size), "-n", str(size), "--lda", str(size),
+               "-i", str(args.iters), "-j", str(args.cold_iters), "--device", str(args.device)]
+    output = subprocess.run(command, env=env, capture_output=True, text=True, check=True).stdout
+    lines = output.splitlines()
+    for i, line in enumerate(lines[:-1]):
+        names = [v.strip() for v in line.split(",")]
+        if "us" in names:
+            return float(lines[i + 1].split(",")[names.index("us")])
+    raise RuntimeError("no timing in output of " + " ".join(command))
+
+
+def tune(args, name, precision):
+    function, option, selected, alignment, offset, off, on, clear = TUNABLES[name]
+    with tempfile.TemporaryDirectory() as directory:
+        env = dict(os.environ, ROCBLAS_LEVEL2_TUNING_PATH=directory)
+        times = {}
+        for variant, entries in (("off", off), ("on", on)):
+            table = {key: [value] * len(PRECISIONS)
+                     for key, value in list(clear.items()) + list(entries.items())}
+            write_table(directory, args.arch, table)
+            times[variant] = []
+            for size in args.sizes:
+                size = max(size - size % alignment, alignment) + offset
+                times[variant].append((size, time_us(args, env, function, precision, option,
+                                                     size)))
+
+    wins = [(s, t_on < t_off) for (s, t_off), (_, t_on) in zip(times["off"], times["on"])]
+    losses = [s for s, win in wins if not win]
+    if selected == "below":
+        # the variant is taken below the first size at which it loses
+        value = str(losses[0]) if losses else "max"
+        if losses and name == "gemvn_upper":  # selected for m and n <= gemvn_upper
+            value = str(losses[0] - 1)
+    else:
+        # the variant is taken above the last size at which it loses
+        value = str(losses[-1]) if losses else "0"
+        if losses and name == "gemvn_lower":  # selected for m and n >= gemvn_lower
+            value = str(losses[-1] + 1)
+    if args.verbose:
+        print(name, precision, " ".join("%d:%s" % (s, "on" if w else "off") for s, w in wins))
+    return value
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__.splitlines()[0],
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter)
+    parser.add_argument("--arch", required=True,
+                        help="architecture of the device, e.g. gfx942, naming the table")
+    parser.add_argument("--bench", default="./rocblas-bench", help="path of rocblas-bench")
+    parser.add_argument("--device", type=int, default=0, help="device to tune")
+    parser.add_argument("--sizes", type=parse_sizes, default="1024:32768:1024",
+                        help="square problem sizes as first:last:step")
+    parser.add_argument("--iters", type=int, default=20, help="timed iterations per size")
+    parser.add_argument("--cold_iters", type=int, default=2, help="warm-up iterations per size")
+    parser.add_argument("--thresholds", nargs="+", default=list(TUNABLES), choices=TUNABLES,
+                        metavar="THRESHOLD", help="thresholds to tune")
+    parser.add_argument("-o", "--output", default=".", help="directory for the table")
+    parser.add_argument("-v", "--verbose", action="store_true",
+                        help="print which variant wins at each size")
+    args = parser.parse_args()
+
+    # thresholds and precisions which are not tuned keep the defaults of the architecture
+    table = {}
+    for name in args.thresholds:
+        precisions = TUNED_PRECISIONS.get(name, "sdcz")
+        table[name] = [tune(args, name, p) if p in precisions else "-" for p in PRECISIONS]
+
+    print("wrote", write_table(args.output, args.arch, table))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
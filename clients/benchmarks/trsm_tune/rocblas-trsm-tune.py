@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+# ########################################################################
+# Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+# ########################################################################
+
+
+"""Tune the trsm strategy selection of rocBLAS for the current device.
+
+The thresholds of the trsm selection table (library/src/blas3/rocblas_trsm_threshold.hpp) bound
+the order k of A for which the substitution kernels are used instead of the inversion based
+kernels, for few right-hand sides in a batch and for a moderate number of right-hand sides. For
+every threshold and precision rocblas-bench times trsm over a range of k, once with the
+substitution kernels forced on and once forced off through a temporary table, and the threshold
+is placed below the first k at which substitution loses. Thresholds which are not tuned are left
+out of the table, keeping the defaults. The result is written as TrsmTuning_<arch>.txt,
+which rocBLAS loads when ROCBLAS_TRSM_TUNING_PATH names the directory containing it.
+
+Example:
+    rocblas-trsm-tune.py --arch gfx942 --sizes 64:1024:32 -o tuning/
+    ROCBLAS_TRSM_TUNING_PATH=tuning/ ./my_application
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+
+PRECISIONS = "sdcz"
+
+# threshold: (side, whether the problem has few right-hand sides in a batch)
+TUNABLES = {
+    "left_small_k_upper": ("L", True),
+    "left_k_upper": ("L", False),
+    "right_small_k_upper": ("R", True),
+    "right_k_upper": ("R", False),
+}
+
+# thresholds written to the table, in the order of the file
+MEMBERS = ["left_small_nrhs_upper", "left_small_batch_lower", "left_small_k_upper",
+           "left_nrhs_upper", "left_k_upper", "right_small_nrhs_upper",
+           "right_small_batch_lower", "right_small_k_upper", "right_nrhs_upper", "right_k_upper",
+           "special_mem_limit"]
+
+
+def parse_sizes(text):
+    first, last, step = (int(v) for v in text.split(":"))
+    return list(range(first, last + 1, step))
+
+
+def write_table(directory, arch, table):
+    path = os.path.join(directory, "TrsmTuning_" + arch + ".txt")
+    with open(path, "w") as f:
+        f.write("# " + " ".join(["threshold"] + list(PRECISIONS)) + "\n")
+        for name in MEMBERS:
+            if name in table:
+                f.write(" ".join([name] + table[name]) + "\n")
+    return path
+
+
+def problem(args, small):
+    """Right-hand sides and batch count timed for a threshold."""
+    return (args.small_nrhs, args.batch_count) if small else (args.nrhs, 1)
+
+
+def entries(args, name, small, value):
+    """Table forcing the substitution kernels on ("max") or off ("0") for the problem of name."""
+    side = name.split("_")[0]
+    if small:
+        return {side + "_small_nrhs_upper": str(args.small_nrhs),
+                side + "_small_batch_lower": str(args.batch_count), name: value}
+    return {side + "_small_nrhs_upper": str(args.small_nrhs),
+            side + "_nrhs_upper": str(args.nrhs), name: value}
+
+
+def time_us(args, env, precision, side, k, nrhs, batch_count):
+    m, n = (k, nrhs) if side == "L" else (nrhs, k)
+    command = [args.bench, "-f", "trsm_strided_batched" if batch_count > 1 else "trsm",
+               "-r", precision, "--side", side, "--uplo", "L", "--transposeA", "N",
+               "--diag", "N", "-m", str(m), "-n", str(n), "--lda", str(k), "--ldb", str(m),
+               "--stride_a", str(k * k), "--stride_b", str(m * n),
+               "--batch_count", str(batch_count),
+               "-i", str(args.iters), "-j", str(args.cold_iters), "--device", str(args.device)]
+    output = subprocess.run(command, env=env, capture_output=True, text=True, check=True).stdout
+    lines = output.splitlines()
+    for i, line in enumerate(lines[:-1]):
+        names = [v.strip() for v in line.split(",")]
+        if "us" in names:
+            return float(lines[i + 1].split(",")[names.index("us")])
+    raise RuntimeError("no timing in output of " + " ".join(command))
+
+
+def tune(args, name, precision):
+    side, small = TUNABLES[name]
+    nrhs, batch_count = problem(args, small)
+    with tempfile.TemporaryDirectory() as directory:
+        env = dict(os.environ, ROCBLAS_TRSM_TUNING_PATH=directory)
+        times = {}
+        for variant, value in (("off", "0"), ("on", "max")):
+            table = {key: [v] * len(PRECISIONS)
+                     for key, v in entries(args, name, small, value).items()}
+            write_table(directory, args.arch, table)
+            times[variant] = [(k, time_us(args, env, precision, side, k, nrhs, batch_count))
+                              for k in args.sizes]
+
+    # substitution is used for k <= the threshold, up to the first k at which it loses
+    wins = [(k, t_on < t_off) for (k, t_off), (_, t_on) in zip(times["off"], times["on"])]
+    losses = [k for k, win in wins if not win]
+    value = str(losses[0] - 1) if losses else "max"
+    if args.verbose:
+        print(name, precision, " ".join("%d:%s" % (k, "on" if w else "off") for k, w in wins))
+    return value
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__.splitlines()[0],
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter)
+    parser.add_argument("--arch", required=True,
+                        help="architecture of the device, e.g. gfx942, naming the table")
+    parser.add_argument("--bench", default="./rocblas-bench", help="path of rocblas-bench")
+    parser.add_argument("--device", type=int, default=0, help="device to tune")
+    parser.add_argument("--sizes", type=parse_sizes, default="64:1024:32",
+                        help="orders k of A as first:last:step")
+    parser.add_argument("--small_nrhs", type=int, default=32,
+                        help="right-hand sides of the *_small_k_upper problems")
+    parser.add_argument("--batch_count", type=int, default=64,
+                        help="batch count of the *_small_k_upper problems")
+    parser.add_argument("--nrhs", type=int, default=128,
+                        help="right-hand sides of the *_k_upper problems")
+    parser.add_argument("--iters", type=int, default=20, help="timed iterations per size")
+    parser.add_argument("--cold_iters", type=int, default=2, help="warm-up iterations per size")
+    parser.add_argument("--thresholds", nargs="+", default=list(TUNABLES), choices=TUNABLES,
+                        metavar="THRESHOLD", help="thresholds to tune")
+    parser.add_argument("-o", "--output", default=".", help="directory for the table")
+    parser.add_argument("-v", "--verbose", action="store_true",
+                        help="print which strategy wins at each size")
+    args = parser.parse_args()
+
+    if args.nrhs <= args.small_nrhs:
+        parser.error("--nrhs must be larger than --small_nrhs")
+
+    # the bounds on the right-hand sides and the batch count keep their defaults, the tuned
+    # problems lie within them unless --small_nrhs, --batch_count or --nrhs move them out
+    table = {name: [tune(args, name, p) for p in PRECISIONS] for name in args.thresholds}
+
+    print("wrote", write_table(args.output, args.arch, table))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -22,6 +22,17 @@
 
 #include "argument_model.hpp"
 #include "frequency_monitor.hpp"
+#include "rocblas_datatype2string.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
 
 // this should have been a member variable but due to the complex variadic template this singleton allows global control
 static bool log_function_name = false;
@@ -86,3 +97,349 @@ void ArgumentModel_log_frequencies(rocblas_internal_ostream& name_line,
     name_line << ",median-MCLK";
     val_line << "," << frequency_monitor.getMedianMEMCLK();
 }
+
+void ArgumentModel_log_power(rocblas_internal_ostream& name_line,
+                             rocblas_internal_ostream& val_line,
+                             double                    gpu_us,
+                             double                    gflops_per_sec)
+{
+    FrequencyMonitor& frequency_monitor = getFrequencyMonitor();
+    if(!frequency_monitor.enabled() || !frequency_monitor.powerReport())
+        return;
+
+    double watts = frequency_monitor.getAveragePower();
+
+    name_line << ",avg-W";
+    val_line << "," << watts;
+
+    name_line << ",max-temp-C";
+    val_line << "," << frequency_monitor.getMaxTemperature();
+
+    name_line << ",J/call";
+    val_line << "," << watts * gpu_us * 1e-6;
+
+    if(gflops_per_sec != ArgumentLogging::NA_value && watts > 0)
+    {
+        name_line << ",Gflops/W";
+        val_line << "," << gflops_per_sec / watts;
+    }
+}
+
+static double roofline_gflops = 0, roofline_gbps = 0, roofline_sclk_mhz = 0;
+
+void ArgumentModel_set_roofline(double peak_gflops, double peak_gbps, double peak_sclk_mhz)
+{
+    roofline_gflops   = peak_gflops;
+    roofline_gbps     = peak_gbps;
+    roofline_sclk_mhz = peak_sclk_mhz;
+}
+
+void ArgumentModel_log_roofline(rocblas_internal_ostream& name_line,
+                                rocblas_internal_ostream& val_line,
+                                double                    gflops_per_sec,
+                                double                    gbytes_per_sec)
+{
+    if(!roofline_gflops && !roofline_gbps)
+        return;
+
+    bool   has_flops   = gflops_per_sec != ArgumentLogging::NA_value;
+    bool   has_bytes   = gbytes_per_sec != ArgumentLogging::NA_value;
+    double peak_gflops = roofline_gflops;
+
+    FrequencyMonitor& frequency_monitor = getFrequencyMonitor();
+    if(roofline_sclk_mhz && frequency_monitor.enabled())
+    {
+        double sclk_mhz = frequency_monitor.getLowestAverageSYSCLK();
+        if(sclk_mhz > 0)
+            peak_gflops *= sclk_mhz / roofline_sclk_mhz;
+    }
+
+    if(has_flops && has_bytes && gbytes_per_sec > 0)
+    {
+        // flops per byte, memory bound below the ridge point of the peaks
+        double intensity = gflops_per_sec / gbytes_per_sec;
+        name_line << ",AI";
+        val_line << "," << intensity;
+
+        if(peak_gflops && roofline_gbps)
+        {
+            name_line << ",bound";
+            val_line << "," << (intensity < peak_gflops / roofline_gbps ? "memory" : "compute");
+        }
+    }
+
+    if(has_flops && peak_gflops)
+    {
+        name_line << ",%peak-Gflops";
+        val_line << "," << 100 * gflops_per_sec / peak_gflops;
+    }
+
+    if(has_bytes && roofline_gbps)
+    {
+        name_line << ",%peak-GB/s";
+        val_line << "," << 100 * gbytes_per_sec / roofline_gbps;
+    }
+}
+
+// per thread, for the concurrent runs of rocblas-bench --parallel_devices
+static thread_local double logged_time_us = ArgumentLogging::NA_value;
+
+void ArgumentModel_set_logged_time(double gpu_us)
+{
+    logged_time_us = gpu_us;
+}
+
+double ArgumentModel_take_logged_time()
+{
+    double gpu_us  = logged_time_us;
+    logged_time_us = ArgumentLogging::NA_value;
+    return gpu_us;
+}
+
+static thread_local double graph_time_us = ArgumentLogging::NA_value;
+
+void ArgumentModel_set_graph_time(double graph_us)
+{
+    graph_time_us = graph_us;
+}
+
+void ArgumentModel_log_graph_time(rocblas_internal_ostream& name_line,
+                                  rocblas_internal_ostream& val_line,
+                                  double                    gpu_us)
+{
+    double graph_us = graph_time_us;
+    graph_time_us   = ArgumentLogging::NA_value;
+    if(graph_us == ArgumentLogging::NA_value)
+        return;
+
+    name_line << ",graph-us,host-overhead-us";
+    val_line << "," << graph_us << "," << gpu_us - graph_us;
+}
+
+static thread_local std::vector<double> iteration_times_us;
+
+// mean, standard deviation and number of the iteration times most recently logged
+static thread_local double iteration_mean_us = 0, iteration_stddev_us = 0;
+static thread_local size_t iteration_count = 0;
+
+void ArgumentModel_set_iteration_times(std::vector<double> times_us)
+{
+    iteration_times_us = std::move(times_us);
+}
+
+// Median, 90th and 99th percentiles, minimum and coefficient of variation of the iteration times,
+// and the number of outliers outside Tukey's fences (1.5 interquartile ranges beyond the
+// quartiles)
+void ArgumentModel_log_iteration_stats(rocblas_internal_ostream& name_line,
+                                       rocblas_internal_ostream& val_line)
+{
+    std::vector<double> us = std::move(iteration_times_us);
+    iteration_times_us.clear();
+    iteration_count = us.size();
+    if(us.empty())
+        return;
+
+    // Nearest-rank percentiles
+    std::sort(us.begin(), us.end());
+    size_t n          = us.size();
+    auto   percentile = [&](double p) {
+        size_t rank = std::max(size_t(std::ceil(p * n)), size_t(1));
+        return us[rank - 1];
+    };
+
+    double median = n % 2 ? us[n / 2] : (us[n / 2 - 1] + us[n / 2]) / 2;
+    double mean   = 0;
+    for(double t : us)
+        mean += t;
+    mean /= n;
+    double variance = 0;
+    for(double t : us)
+        variance += (t - mean) * (t - mean);
+    variance /= n;
+
+    iteration_mean_us   = mean;
+    iteration_stddev_us = n > 1 ? std::sqrt(variance * n / (n - 1)) : 0.0;
+
+    double q1 = percentile(0.25), q3 = percentile(0.75);
+    double lower = q1 - 1.5 * (q3 - q1), upper = q3 + 1.5 * (q3 - q1);
+    size_t outliers
+        = std::count_if(us.begin(), us.end(), [&](double t) { return t < lower || t > upper; });
+
+    name_line << ",median-us,p90-us,p99-us,min-us,cv,outliers";
+    val_line << "," << median << "," << percentile(0.90) << "," << percentile(0.99) << ","
+             << us.front() << "," << (mean > 0 ? std::sqrt(variance) / mean : 0.0) << ","
+             << outliers;
+}
+
+// Mean, standard deviation and number of iteration times of one benchmark in the results store
+struct result_timing
+{
+    double us;
+    double stddev_us;
+    size_t iterations;
+};
+
+static std::mutex                                     results_mutex;
+static std::ofstream                                  results_file;
+static std::string                                    results_environment;
+static std::unordered_map<std::string, result_timing> baseline_results;
+static double                                         regression_threshold = 0;
+static std::atomic<size_t>                            regressions{0};
+
+static std::string json_string(const std::string& s)
+{
+    std::string json = "\"";
+    for(char c : s)
+    {
+        if(c == '"' || c == '\\')
+            json += '\\';
+        if(c >= 0 && c < ' ')
+            continue;
+        json += c;
+    }
+    return json + "\"";
+}
+
+// Fields of a comma-separated line, without the quotes of CSV strings
+static std::vector<std::string> csv_fields(const std::string& line)
+{
+    std::vector<std::string> fields;
+    std::stringstream        ss(line);
+    for(std::string field; std::getline(ss, field, ',');)
+    {
+        field.erase(0, field.find_first_not_of(" '\""));
+        field.erase(field.find_last_not_of(" '\"") + 1);
+        fields.push_back(field);
+    }
+    return fields;
+}
+
+// Value of a member of a JSON line written by ArgumentModel_log_results
+static std::string json_member(const std::string& line, const char* name)
+{
+    std::string key = json_string(name) + ": ";
+    size_t      pos = line.find(key);
+    if(pos == std::string::npos)
+        return "";
+    pos += key.size();
+    if(line[pos] == '"')
+        return line.substr(pos + 1, line.find('"', pos + 1) - pos - 1);
+    return line.substr(pos, line.find_first_of(",}", pos) - pos);
+}
+
+void ArgumentModel_set_results(const std::string& path,
+                               const std::string& baseline_path,
+                               const std::string& environment,
+                               double             threshold_percent)
+{
+    results_environment  = environment;
+    regression_threshold = threshold_percent;
+
+    if(!path.empty())
+    {
+        results_file.open(path, std::ios::app);
+        if(!results_file)
+            throw std::invalid_argument("Cannot open the results store " + path);
+        results_file << std::setprecision(10);
+    }
+
+    if(!baseline_path.empty())
+    {
+        std::ifstream baseline(baseline_path);
+        if(!baseline)
+            throw std::invalid_argument("Cannot open the baseline " + baseline_path);
+
+        // the latest result of each problem
+        for(std::string line; std::getline(baseline, line);)
+        {
+            std::string key = json_member(line, "key");
+            if(!key.empty())
+                baseline_results[key] = {atof(json_member(line, "us").c_str()),
+                                         atof(json_member(line, "stddev_us").c_str()),
+                                         size_t(atoll(json_member(line, "iterations").c_str()))};
+        }
+    }
+}
+
+size_t ArgumentModel_get_regressions()
+{
+    return regressions;
+}
+
+void ArgumentModel_log_results(rocblas_internal_ostream& name_line,
+                               rocblas_internal_ostream& val_line,
+                               const Arguments&          arg,
+                               const std::string&        problem_names,
+                               const std::string&        problem_values)
+{
+    if(!results_file.is_open() && baseline_results.empty())
+        return;
+
+    double gpu_us = logged_time_us;
+    if(gpu_us == ArgumentLogging::NA_value)
+        return;
+
+    result_timing timing{gpu_us, 0, 0};
+    if(iteration_count > 1)
+        timing = {gpu_us, iteration_stddev_us, iteration_count};
+    iteration_count = 0;
+
+    // the problem is the function, its types and its arguments
+    std::vector<std::string> names  = csv_fields(problem_names);
+    std::vector<std::string> values = csv_fields(problem_values);
+
+    std::string key = std::string(arg.function) + "," + rocblas_datatype2string(arg.a_type) + ","
+                      + rocblas_datatype2string(arg.c_type) + ","
+                      + rocblas_datatype2string(arg.compute_type);
+    rocblas_internal_ostream problem;
+    problem << "{";
+    for(size_t i = 0; i < names.size() && i < values.size(); ++i)
+    {
+        key += "," + names[i] + "=" + values[i];
+        problem << (i ? ", " : "") << json_string(names[i]) << ": " << json_string(values[i]);
+    }
+    problem << "}";
+
+    auto baseline = baseline_results.find(key);
+    if(baseline != baseline_results.end() && baseline->second.us > 0)
+    {
+        const result_timing& base   = baseline->second;
+        double               change = 100 * (timing.us - base.us) / base.us;
+
+        bool regression = change > regression_threshold;
+        if(regression && timing.iterations > 1 && base.iterations > 1)
+        {
+            double se = std::sqrt(timing.stddev_us * timing.stddev_us / timing.iterations
+                                  + base.stddev_us * base.stddev_us / base.iterations);
+            regression = se > 0 ? (timing.us - base.us) / se > 3 : true;
+        }
+        if(regression)
+            regressions++;
+
+        name_line << ",baseline-us,change-%,regression";
+        val_line << "," << base.us << "," << change << "," << (regression ? "yes" : "no");
+    }
+
+    if(!results_file.is_open())
+        return;
+
+    auto now = std::chrono::duration_cast<std::chrono::seconds>(
+                   std::chrono::system_clock::now().time_since_epoch())
+                   .count();
+
+    std::lock_guard<std::mutex> lock(results_mutex);
+    results_file << "{" << json_string("key") << ": " << json_string(key) << ", "
+                 << json_string("function") << ": " << json_string(arg.function) << ", "
+                 << json_string("a_type") << ": "
+                 << json_string(rocblas_datatype2string(arg.a_type)) << ", "
+                 << json_string("c_type") << ": "
+                 << json_string(rocblas_datatype2string(arg.c_type)) << ", "
+                 << json_string("compute_type") << ": "
+                 << json_string(rocblas_datatype2string(arg.compute_type)) << ", "
+                 << json_string("problem") << ": " << problem.str() << ", "
+                 << json_string("solution_index") << ": " << arg.solution_index << ", "
+                 << results_environment << ", " << json_string("time") << ": " << now << ", "
+                 << json_string("us") << ": " << timing.us << ", " << json_string("stddev_us")
+                 << ": " << timing.stddev_us << ", " << json_string("iterations") << ": "
+                 << timing.iterations << "}" << std::endl;
+}
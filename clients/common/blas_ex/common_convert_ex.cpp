@@ -0,0 +1,41 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#define ROCBLAS_BETA_FEATURES_API
+
+#include "../common_helpers.hpp"
+#include "testing_convert_ex.hpp"
+
+#define INSTANTIATE(Tx_, Ty_) INSTANTIATE_TESTS(convert_ex, Tx_, Ty_)
+
+#define INSTANTIATE_TO(Tx_)                \
+    INSTANTIATE(Tx_, float)            \
+    INSTANTIATE(Tx_, rocblas_half)     \
+    INSTANTIATE(Tx_, rocblas_bfloat16) \
+    INSTANTIATE(Tx_, rocblas_f8)       \
+    INSTANTIATE(Tx_, rocblas_bf8)
+
+INSTANTIATE_TO(float)
+INSTANTIATE_TO(rocblas_half)
+INSTANTIATE_TO(rocblas_bfloat16)
+INSTANTIATE_TO(rocblas_f8)
+INSTANTIATE_TO(rocblas_bf8)
@@ -265,6 +265,25 @@ void set_device(rocblas_int device_id)
     }
 }
 
+rocblas_device_peaks query_device_peaks(rocblas_int device_id)
+{
+    hipDeviceProp_t props;
+    if(hipGetDeviceProperties(&props, device_id) != hipSuccess)
+        return {0, 0, 0};
+
+    // One FMA (two flops) per lane of each SIMD per clock, doubled by the packed FP32
+    // instructions of gfx90a and gfx94x
+    std::string arch          = props.gcnArchName;
+    bool        packed_fp32   = !arch.compare(0, 6, "gfx90a") || !arch.compare(0, 5, "gfx94");
+    double      flops_per_clk = props.multiProcessorCount * 64 * 2 * (packed_fp32 ? 2 : 1);
+
+    // clockRate and memoryClockRate are in kHz, and memory transfers twice per clock
+    double sclk_mhz = props.clockRate / 1000.0;
+    double gflops   = flops_per_clk * sclk_mhz / 1000.0;
+    double gbps     = props.memoryClockRate * 2.0 * (props.memoryBusWidth / 8) / 1e6;
+    return {gflops, gbps, sclk_mhz};
+}
+
 /*********************************************
  * callback function
  *********************************************/
@@ -367,17 +386,22 @@ void rocblas_local_handle::rocblas_stream_begin_capture()
 
 void rocblas_local_handle::rocblas_stream_end_capture()
 {
-    hipGraph_t     graph;
     hipGraphExec_t instance;
+    rocblas_stream_end_capture(&instance);
+
+    CHECK_HIP_ERROR(hipGraphLaunch(instance, m_old_stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(m_old_stream));
+    CHECK_HIP_ERROR(hipGraphExecDestroy(instance));
+}
+
+void rocblas_local_handle::rocblas_stream_end_capture(hipGraphExec_t* instance)
+{
+    hipGraph_t graph;
 
     // END GRAPH CAPTURE
     CHECK_HIP_ERROR(hipStreamEndCapture(m_graph_stream, &graph));
-    CHECK_HIP_ERROR(hipGraphInstantiate(&instance, graph, NULL, NULL, 0));
-
+    CHECK_HIP_ERROR(hipGraphInstantiate(instance, graph, NULL, NULL, 0));
     CHECK_HIP_ERROR(hipGraphDestroy(graph));
-    CHECK_HIP_ERROR(hipGraphLaunch(instance, m_graph_stream));
-    CHECK_HIP_ERROR(hipStreamSynchronize(m_graph_stream));
-    CHECK_HIP_ERROR(hipGraphExecDestroy(instance));
 
     CHECK_ROCBLAS_ERROR(rocblas_set_stream(m_handle, m_old_stream));
     CHECK_HIP_ERROR(hipStreamDestroy(m_graph_stream));
@@ -386,6 +410,24 @@ void rocblas_local_handle::rocblas_stream_end_capture()
     m_handle->set_stream_order_memory_allocation(false);
 }
 
+rocblas_local_mgpu_handles::rocblas_local_mgpu_handles(const Arguments& arg, int max_devices)
+{
+    int current, count;
+    CHECK_HIP_ERROR(hipGetDevice(&current));
+    CHECK_HIP_ERROR(hipGetDeviceCount(&count));
+
+    for(int i = 0; i < count && int(m_handles.size()) < max_devices; ++i)
+    {
+        // the current device first, then the others in order
+        int device = i == 0 ? current : i <= current ? i - 1 : i;
+        CHECK_HIP_ERROR(hipSetDevice(device));
+        m_local.push_back(std::make_unique<rocblas_local_handle>(arg));
+        m_handles.push_back(*m_local.back());
+        m_devices.push_back(device);
+    }
+    CHECK_HIP_ERROR(hipSetDevice(current));
+}
+
 void rocblas_parallel_initialize_thread(int id, size_t& memory_used)
 {
     size_t before_init, after_init, total_memory;
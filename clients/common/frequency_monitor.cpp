@@ -24,7 +24,9 @@
 #include "frequency_monitor.hpp"
 #include "rocblas.hpp"
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <future>
 #include <memory>
@@ -97,8 +99,10 @@ inline std::string concatenate(Ts&&... vals)
 class FrequencyMonitorImp : public FrequencyMonitor
 {
 public:
-    const double cHzToMHz = 0.000001;
-    const double cMhzToHz = 1000000;
+    const double cHzToMHz     = 0.000001;
+    const double cMhzToHz     = 1000000;
+    const double cMicroToUnit = 0.000001;
+    const double cMilliToUnit = 0.001;
 
     // deleting copy constructor
     FrequencyMonitorImp(const FrequencyMonitorImp& obj) = delete;
@@ -109,7 +113,13 @@ public:
     {
         static const char* env1 = getenv("ROCBLAS_BENCH_FREQ");
         static const char* env2 = getenv("ROCBLAS_BENCH_FREQ_ALL");
-        return env1 != nullptr || (env2 != nullptr && m_isMultiXCDSupported);
+        return env1 != nullptr || (env2 != nullptr && m_isMultiXCDSupported) || powerReport();
+    }
+
+    bool powerReport()
+    {
+        static const char* env = getenv("ROCBLAS_BENCH_POWER");
+        return env != nullptr;
     }
 
     bool detailedReport()
@@ -153,6 +163,8 @@ public:
             return;
 
         clearValues();
+        m_thermalStart = std::chrono::steady_clock::now();
+        m_thermalSamples.clear();
         runBetweenEvents();
     }
 
@@ -254,6 +266,48 @@ public:
         return medianValueMHz(m_MEMCLK_array);
     }
 
+    double getAveragePower()
+    {
+        assertNotActive();
+        return m_power_count ? m_power_sum * cMicroToUnit / m_power_count : 0.0;
+    }
+
+    double getMaxTemperature()
+    {
+        assertNotActive();
+        return m_temperature_max * cMilliToUnit;
+    }
+
+    bool thermalSteady()
+    {
+        static const char* env = getenv("ROCBLAS_BENCH_THERMAL_STEADY");
+        if(!env || !enabled())
+            return true;
+
+        constexpr size_t cSteadySamples = 5;
+        constexpr double cSteadyRange   = 1000; // millidegrees
+
+        auto now     = std::chrono::steady_clock::now();
+        auto elapsed = std::chrono::duration<double>(now - m_thermalStart).count();
+        if(elapsed >= atof(env))
+            return true;
+        if(elapsed < m_thermalSamples.size())
+            return false;
+
+        int64_t temperature;
+        if(rsmi_dev_temp_metric_get(
+               m_smiDeviceIndex, RSMI_TEMP_TYPE_JUNCTION, RSMI_TEMP_CURRENT, &temperature)
+           != RSMI_STATUS_SUCCESS)
+            return true;
+        m_thermalSamples.push_back(temperature);
+
+        if(m_thermalSamples.size() < cSteadySamples)
+            return false;
+        auto [lo, hi]
+            = std::minmax_element(m_thermalSamples.end() - cSteadySamples, m_thermalSamples.end());
+        return *hi - *lo <= cSteadyRange;
+    }
+
 private:
     void initThread()
     {
@@ -346,6 +400,22 @@ private:
                 m_MEMCLK_array.push_back(freq.frequency[freq.current]);
             }
 
+            if(powerReport())
+            {
+                uint64_t power;
+                if(rsmi_dev_power_ave_get(m_smiDeviceIndex, 0, &power) == RSMI_STATUS_SUCCESS)
+                {
+                    m_power_sum += power;
+                    m_power_count++;
+                }
+
+                int64_t temperature;
+                if(rsmi_dev_temp_metric_get(
+                       m_smiDeviceIndex, RSMI_TEMP_TYPE_JUNCTION, RSMI_TEMP_CURRENT, &temperature)
+                   == RSMI_STATUS_SUCCESS)
+                    m_temperature_max = std::max(m_temperature_max, temperature);
+            }
+
             // collect freq every 50ms regardless of success
             std::this_thread::sleep_for(std::chrono::milliseconds(50));
 
@@ -370,6 +440,10 @@ private:
         m_SYSCLK_array = std::vector<std::vector<uint64_t>>(m_XCDCount, std::vector<uint64_t>{});
         m_MEMCLK_sum   = 0;
         m_MEMCLK_array.clear();
+
+        m_power_sum       = 0;
+        m_power_count     = 0;
+        m_temperature_max = 0;
     }
 
     void wait()
@@ -467,6 +541,13 @@ private:
     uint64_t                           m_MEMCLK_sum;
     std::vector<uint64_t>              m_MEMCLK_array;
 
+    uint64_t m_power_sum; // microwatts
+    uint64_t m_power_count;
+    int64_t  m_temperature_max; // millidegrees
+
+    std::chrono::steady_clock::time_point m_thermalStart;
+    std::vector<int64_t>                  m_thermalSamples; // millidegrees, one per second
+
 #else // WIN32
 
     // not supporting windows for now
@@ -521,6 +602,26 @@ public:
     {
         return 0.0;
     }
+
+    bool powerReport()
+    {
+        return false;
+    }
+
+    double getAveragePower()
+    {
+        return 0.0;
+    }
+
+    double getMaxTemperature()
+    {
+        return 0.0;
+    }
+
+    bool thermalSteady()
+    {
+        return true;
+    }
 #endif
 };
 
@@ -119,10 +119,15 @@ void Arguments::init()
 
     math_mode = rocblas_default_math;
 
+    call_count  = 1;
+    noise_bytes = 0;
+
     os_flags = rocblas_client_os::ALL;
 
     gpu_arch[0] = 0; // 4 chars so 32bit
 
+    hot_operands[0] = 0;
+
     api = rocblas_client_api::C;
 
     // memory padding for testing write out of bounds
@@ -151,6 +156,7 @@ void Arguments::init()
     HMM                 = false;
     graph_test          = false;
     repeatability_check = false;
+    cache_flush         = false;
 }
 
 bool Arguments::validate()
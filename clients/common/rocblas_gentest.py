@@ -357,7 +357,8 @@ def setdefaults(test):
                 setkey_product(test, 'stride_a', ['N', 'lda', 'stride_scale'])
 
         elif function_name in ('trsm_strided_batched',
-                                'trsm_strided_batched_ex'):
+                                'trsm_strided_batched_ex',
+                                'trsm_strided_batched_mgpu'):
             setkey_product(test, 'stride_b', ['N', 'ldb', 'stride_scale'])
 
             if test['side'].upper() == 'L':
@@ -0,0 +1,152 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include <cstring>
+#include <string>
+
+namespace
+{
+    // Host pointer mode results written asynchronously are the ones written synchronously
+    // once the host results event has completed
+    template <typename...>
+    struct testing_async_host_results : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            hipEvent_t event = nullptr;
+            EXPECT_ROCBLAS_STATUS(rocblas_set_async_host_results(nullptr, true),
+                                  rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_get_host_results_event(nullptr, &event),
+                                  rocblas_status_invalid_handle);
+
+            rocblas_local_handle handle{arg};
+            EXPECT_ROCBLAS_STATUS(rocblas_get_host_results_event(handle, nullptr),
+                                  rocblas_status_invalid_pointer);
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            const rocblas_int  N    = arg.N;
+            const rocblas_int  incx = arg.incx;
+            const size_t       size = size_t(N) * incx;
+            host_vector<float> hx(size), hy(size);
+            rocblas_seedrand();
+            rocblas_init<float>(hx, 1, N, incx);
+            rocblas_init<float>(hy, 1, N, incx);
+
+            device_vector<float> dx(size), dy(size);
+            CHECK_DEVICE_ALLOCATION(dx.memcheck());
+            CHECK_DEVICE_ALLOCATION(dy.memcheck());
+            CHECK_HIP_ERROR(dx.transfer_from(hx));
+            CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+            auto reductions = [&](rocblas_handle h, float* r, rocblas_int* index) {
+                CHECK_ROCBLAS_ERROR(rocblas_sdot(h, N, dx, incx, dy, incx, r));
+                CHECK_ROCBLAS_ERROR(rocblas_sasum(h, N, dx, incx, r + 1));
+                CHECK_ROCBLAS_ERROR(rocblas_snrm2(h, N, dy, incx, r + 2));
+                CHECK_ROCBLAS_ERROR(rocblas_isamax(h, N, dx, incx, index));
+                CHECK_ROCBLAS_ERROR(rocblas_isamin(h, N, dy, incx, index + 1));
+            };
+
+            host_pinned_vector<float>       h_results(3), h_gold(3);
+            host_pinned_vector<rocblas_int> h_index(2), h_index_gold(2);
+            CHECK_HIP_ERROR(h_results.memcheck());
+            CHECK_HIP_ERROR(h_gold.memcheck());
+            CHECK_HIP_ERROR(h_index.memcheck());
+            CHECK_HIP_ERROR(h_index_gold.memcheck());
+            reductions(handle, h_gold, h_index_gold);
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_async_host_results(handle, true));
+            CHECK_ROCBLAS_ERROR(rocblas_get_host_results_event(handle, &event));
+            EXPECT_NE(event, nullptr);
+
+            reductions(handle, h_results, h_index);
+            hipEvent_t latest = nullptr;
+            CHECK_ROCBLAS_ERROR(rocblas_get_host_results_event(handle, &latest));
+            EXPECT_EQ(latest, event);
+            CHECK_HIP_ERROR(hipEventSynchronize(event));
+
+            unit_check_general<float>(1, 3, 1, h_gold, h_results);
+            unit_check_general<rocblas_int>(1, 2, 1, h_index_gold, h_index);
+
+            // A clone returns without waiting as well, with an event of its own
+            rocblas_handle clone;
+            CHECK_ROCBLAS_ERROR(rocblas_clone_handle(handle, &clone));
+            for(int i = 0; i < 3; i++)
+                h_results[i] = 0;
+            h_index[0] = h_index[1] = 0;
+            reductions(clone, h_results, h_index);
+            hipEvent_t clone_event = nullptr;
+            CHECK_ROCBLAS_ERROR(rocblas_get_host_results_event(clone, &clone_event));
+            EXPECT_NE(clone_event, event);
+            CHECK_HIP_ERROR(hipEventSynchronize(clone_event));
+            unit_check_general<float>(1, 3, 1, h_gold, h_results);
+            unit_check_general<rocblas_int>(1, 2, 1, h_index_gold, h_index);
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(clone));
+
+            // Disabled, results are written when the call returns
+            CHECK_ROCBLAS_ERROR(rocblas_set_async_host_results(handle, false));
+            for(int i = 0; i < 3; i++)
+                h_results[i] = 0;
+            h_index[0] = h_index[1] = 0;
+            reductions(handle, h_results, h_index);
+            unit_check_general<float>(1, 3, 1, h_gold, h_results);
+            unit_check_general<rocblas_int>(1, 2, 1, h_index_gold, h_index);
+        }
+    };
+
+    struct async_host_results : RocBLAS_Test<async_host_results, testing_async_host_results>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "async_host_results");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<async_host_results> name(arg.name);
+            name << '_' << arg.N << '_' << arg.incx;
+            return std::move(name);
+        }
+    };
+
+    TEST_P(async_host_results, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_async_host_results<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(async_host_results)
+
+} // namespace
@@ -0,0 +1,126 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "blas3/common_batched_mgpu.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // batched_mgpu test template
+    template <template <typename...> class FILTER>
+    struct batched_mgpu_template : RocBLAS_Test<batched_mgpu_template<FILTER>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<
+                batched_mgpu_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "gemm_strided_batched_ex_mgpu")
+                   || !strcmp(arg.function, "gemm_strided_batched_ex_mgpu_bad_arg")
+                   || !strcmp(arg.function, "trsm_strided_batched_mgpu")
+                   || !strcmp(arg.function, "trsm_strided_batched_mgpu_bad_arg");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<batched_mgpu_template> name(arg.name);
+
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                if(strstr(arg.function, "trsm") != nullptr)
+                    name << '_' << (char)std::toupper(arg.side) << (char)std::toupper(arg.uplo)
+                         << (char)std::toupper(arg.transA) << (char)std::toupper(arg.diag) << '_'
+                         << arg.M << '_' << arg.N << '_' << arg.alpha << '_' << arg.lda << '_'
+                         << arg.stride_a << '_' << arg.ldb << '_' << arg.stride_b;
+                else
+                    name << '_' << (char)std::toupper(arg.transA)
+                         << (char)std::toupper(arg.transB) << '_' << arg.M << '_' << arg.N << '_'
+                         << arg.K << '_' << arg.alpha << '_' << arg.lda << '_' << arg.stride_a
+                         << '_' << arg.ldb << '_' << arg.stride_b << '_' << arg.beta << '_'
+                         << arg.ldc << '_' << arg.stride_c << '_' << arg.ldd << '_'
+                         << arg.stride_d << (arg.outofplace ? "_outofplace" : "_inplace");
+
+                name << '_' << arg.batch_count << '_' << int(arg.devices) << "_devices";
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename, typename = void>
+    struct batched_mgpu_testing : rocblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    template <typename T>
+    struct batched_mgpu_testing<T,
+                                std::enable_if_t<std::is_same_v<T, float>
+                                                 || std::is_same_v<T, double>
+                                                 || std::is_same_v<T, rocblas_float_complex>
+                                                 || std::is_same_v<T, rocblas_double_complex>>>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemm_strided_batched_ex_mgpu"))
+                testing_gemm_strided_batched_ex_mgpu<T>(arg);
+            else if(!strcmp(arg.function, "gemm_strided_batched_ex_mgpu_bad_arg"))
+                testing_gemm_strided_batched_ex_mgpu_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "trsm_strided_batched_mgpu"))
+                testing_trsm_strided_batched_mgpu<T>(arg);
+            else if(!strcmp(arg.function, "trsm_strided_batched_mgpu_bad_arg"))
+                testing_trsm_strided_batched_mgpu_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using batched_mgpu = batched_mgpu_template<batched_mgpu_testing>;
+    TEST_P(batched_mgpu, blas3_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<batched_mgpu_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(batched_mgpu);
+
+} // namespace
@@ -0,0 +1,122 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "blas_ex/common_fast.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // fast test template
+    template <template <typename...> class FILTER>
+    struct fast_template : RocBLAS_Test<fast_template<FILTER>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<fast_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "scal_fast") || !strcmp(arg.function, "scal_fast_bad_arg")
+                   || !strcmp(arg.function, "axpy_fast")
+                   || !strcmp(arg.function, "axpy_fast_bad_arg")
+                   || !strcmp(arg.function, "gemv_fast")
+                   || !strcmp(arg.function, "gemv_fast_bad_arg")
+                   || !strcmp(arg.function, "gemm_fast")
+                   || !strcmp(arg.function, "gemm_fast_bad_arg");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<fast_template> name(arg.name);
+
+            name << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                name << '_' << (char)std::toupper(arg.transA) << '_'
+                     << (char)std::toupper(arg.transB) << '_' << arg.M << '_' << arg.N << '_'
+                     << arg.K << '_' << arg.lda << '_' << arg.ldb << '_' << arg.ldc << '_'
+                     << arg.incx << '_' << arg.incy << '_' << arg.alpha << '_' << arg.beta;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename, typename = void>
+    struct fast_testing : rocblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    template <typename T>
+    struct fast_testing<T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>>>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "scal_fast"))
+                testing_scal_fast<T>(arg);
+            else if(!strcmp(arg.function, "scal_fast_bad_arg"))
+                testing_scal_fast_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "axpy_fast"))
+                testing_axpy_fast<T>(arg);
+            else if(!strcmp(arg.function, "axpy_fast_bad_arg"))
+                testing_axpy_fast_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "gemv_fast"))
+                testing_gemv_fast<T>(arg);
+            else if(!strcmp(arg.function, "gemv_fast_bad_arg"))
+                testing_gemv_fast_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "gemm_fast"))
+                testing_gemm_fast<T>(arg);
+            else if(!strcmp(arg.function, "gemm_fast_bad_arg"))
+                testing_gemm_fast_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using fast = fast_template<fast_testing>;
+    TEST_P(fast, blas_ex)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<fast_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(fast);
+
+} // namespace
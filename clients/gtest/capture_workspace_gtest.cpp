@@ -0,0 +1,203 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace
+{
+    uint64_t workspace_allocations(rocblas_handle handle)
+    {
+        rocblas_handle_stats stats{};
+        CHECK_ROCBLAS_ERROR(rocblas_get_handle_stats(handle, &stats));
+        return stats.workspace_allocations;
+    }
+
+    // A sequence run once before capture reserves the device memory its capture needs
+    template <typename...>
+    struct testing_capture_workspace : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            EXPECT_ROCBLAS_STATUS(rocblas_set_capture_workspace_reserve(nullptr, true),
+                                  rocblas_status_invalid_handle);
+
+            const rocblas_int M = arg.M, N = arg.N, lda = M, ldb = M;
+            const float       alpha = 2;
+
+            rocblas_handle handle;
+            hipStream_t    stream;
+            CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+            CHECK_HIP_ERROR(hipStreamCreate(&stream));
+            CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, stream));
+
+            // a well conditioned triangle, and the norms of the columns of the solution
+            host_vector<float> hA(size_t(lda) * M), hB(size_t(ldb) * N);
+            host_vector<float> hX(size_t(ldb) * N), hX_gold(size_t(ldb) * N), hr(N), hr_gold(N);
+            rocblas_seedrand();
+            rocblas_init<float>(hA, M, M, lda);
+            rocblas_init<float>(hB, M, N, ldb);
+            for(rocblas_int i = 0; i < M; i++)
+                hA[i + size_t(i) * lda] = float(10 * M);
+
+            device_vector<float> dA(size_t(lda) * M), dB(size_t(ldb) * N), dr(N);
+            CHECK_DEVICE_ALLOCATION(dA.memcheck());
+            CHECK_DEVICE_ALLOCATION(dB.memcheck());
+            CHECK_DEVICE_ALLOCATION(dr.memcheck());
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+            auto sequence = [&]() {
+                return rocblas_strsm(handle,
+                                     rocblas_side_left,
+                                     rocblas_fill_lower,
+                                     rocblas_operation_none,
+                                     rocblas_diagonal_non_unit,
+                                     M,
+                                     N,
+                                     &alpha,
+                                     dA,
+                                     lda,
+                                     dB,
+                                     ldb)
+                               == rocblas_status_success
+                           ? rocblas_snrm2_strided_batched(handle, M, dB, 1, ldb, N, dr)
+                           : rocblas_status_internal_error;
+            };
+
+            CHECK_HIP_ERROR(dB.transfer_from(hB));
+            CHECK_ROCBLAS_ERROR(sequence());
+            CHECK_HIP_ERROR(hX_gold.transfer_from(dB));
+            CHECK_HIP_ERROR(hr_gold.transfer_from(dr));
+
+            // The reservation holds the memoized requirement and the default size
+            size_t cached = 0, size = 0;
+            CHECK_ROCBLAS_ERROR(rocblas_set_capture_workspace_reserve(handle, true));
+            CHECK_ROCBLAS_ERROR(rocblas_get_cached_device_memory_size(handle, &cached));
+            CHECK_ROCBLAS_ERROR(rocblas_get_device_memory_size(handle, &size));
+            EXPECT_GE(size, cached);
+            EXPECT_GT(size, 0u);
+
+            // Nothing is allocated while the sequence is captured
+            uint64_t allocations = workspace_allocations(handle);
+            CHECK_HIP_ERROR(dB.transfer_from(hB));
+            CHECK_HIP_ERROR(hipMemset(dr, 0, sizeof(float) * N));
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+            hipGraph_t     graph;
+            hipGraphExec_t instance;
+            CHECK_HIP_ERROR(hipStreamBeginCapture(stream, hipStreamCaptureModeThreadLocal));
+            EXPECT_ROCBLAS_STATUS(rocblas_set_capture_workspace_reserve(handle, true),
+                                  rocblas_status_invalid_value);
+            EXPECT_ROCBLAS_STATUS(sequence(), rocblas_status_success);
+            CHECK_HIP_ERROR(hipStreamEndCapture(stream, &graph));
+            EXPECT_EQ(workspace_allocations(handle), allocations);
+
+            CHECK_HIP_ERROR(hipGraphInstantiate(&instance, graph, nullptr, nullptr, 0));
+            CHECK_HIP_ERROR(hipGraphLaunch(instance, stream));
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+            CHECK_HIP_ERROR(hipGraphExecDestroy(instance));
+            CHECK_HIP_ERROR(hipGraphDestroy(graph));
+            EXPECT_EQ(workspace_allocations(handle), allocations);
+
+            CHECK_HIP_ERROR(hX.transfer_from(dB));
+            CHECK_HIP_ERROR(hr.transfer_from(dr));
+            unit_check_general<float>(M, N, ldb, hX_gold, hX);
+            unit_check_general<float>(1, N, 1, hr_gold, hr);
+
+            // A workspace larger than the reservation is not allocated during capture: the norms
+            // of many batches of a column, with a stride of 0, need one partial sum per block
+            const rocblas_int n_big       = 1 << 16;
+            rocblas_int       batch_count = 1024;
+            size_t            query       = 0;
+            while(query <= size && batch_count < (1 << 24))
+            {
+                batch_count *= 2;
+                CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+                CHECK_ALLOC_QUERY(rocblas_snrm2_strided_batched(
+                    handle, n_big, nullptr, 1, 0, batch_count, nullptr));
+                CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &query));
+            }
+            ASSERT_GT(query, size);
+
+            device_vector<float> dx(n_big), d_norms(batch_count);
+            CHECK_DEVICE_ALLOCATION(dx.memcheck());
+            CHECK_DEVICE_ALLOCATION(d_norms.memcheck());
+            allocations = workspace_allocations(handle);
+
+            CHECK_HIP_ERROR(hipStreamBeginCapture(stream, hipStreamCaptureModeThreadLocal));
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_snrm2_strided_batched(handle, n_big, dx, 1, 0, batch_count, d_norms),
+                rocblas_status_memory_error);
+            CHECK_HIP_ERROR(hipStreamEndCapture(stream, &graph));
+            CHECK_HIP_ERROR(hipGraphDestroy(graph));
+            EXPECT_EQ(workspace_allocations(handle), allocations);
+
+            // Outside of capture the handle grows as before
+            CHECK_ROCBLAS_ERROR(rocblas_set_capture_workspace_reserve(handle, false));
+            CHECK_ROCBLAS_ERROR(
+                rocblas_snrm2_strided_batched(handle, n_big, dx, 1, 0, batch_count, d_norms));
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+            CHECK_HIP_ERROR(hipStreamDestroy(stream));
+        }
+    };
+
+    struct capture_workspace : RocBLAS_Test<capture_workspace, testing_capture_workspace>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "capture_workspace");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<capture_workspace> name(arg.name);
+            name << '_' << arg.M << '_' << arg.N;
+            return std::move(name);
+        }
+    };
+
+    TEST_P(capture_workspace, auxiliary_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_capture_workspace<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(capture_workspace)
+
+} // namespace
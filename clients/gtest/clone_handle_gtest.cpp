@@ -0,0 +1,219 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace
+{
+    // The configuration of the source handle is copied, but not its stream
+    template <typename...>
+    struct testing_clone_handle : rocblas_test_valid
+    {
+        void operator()(const Arguments&)
+        {
+            rocblas_handle src, clone;
+            CHECK_ROCBLAS_ERROR(rocblas_create_handle(&src));
+
+            hipStream_t stream;
+            CHECK_HIP_ERROR(hipStreamCreate(&stream));
+            CHECK_ROCBLAS_ERROR(rocblas_set_stream(src, stream));
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(src, rocblas_pointer_mode_device));
+            CHECK_ROCBLAS_ERROR(rocblas_set_atomics_mode(src, rocblas_atomics_not_allowed));
+            CHECK_ROCBLAS_ERROR(rocblas_set_gemm_backend(src, rocblas_gemm_backend_auto));
+            CHECK_ROCBLAS_ERROR(rocblas_set_pinned_staging_size(src, 4096));
+
+            EXPECT_ROCBLAS_STATUS(rocblas_clone_handle(nullptr, &clone),
+                                  rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_clone_handle(src, nullptr),
+                                  rocblas_status_invalid_handle);
+            CHECK_ROCBLAS_ERROR(rocblas_clone_handle(src, &clone));
+
+            rocblas_pointer_mode pointer_mode;
+            rocblas_atomics_mode atomics_mode;
+            rocblas_gemm_backend backend;
+            size_t               staging_size = 0;
+            hipStream_t          clone_stream = stream;
+            CHECK_ROCBLAS_ERROR(rocblas_get_pointer_mode(clone, &pointer_mode));
+            CHECK_ROCBLAS_ERROR(rocblas_get_atomics_mode(clone, &atomics_mode));
+            CHECK_ROCBLAS_ERROR(rocblas_get_gemm_backend(clone, &backend));
+            CHECK_ROCBLAS_ERROR(rocblas_get_pinned_staging_size(clone, &staging_size));
+            CHECK_ROCBLAS_ERROR(rocblas_get_stream(clone, &clone_stream));
+            EXPECT_EQ(rocblas_pointer_mode_device, pointer_mode);
+            EXPECT_EQ(rocblas_atomics_not_allowed, atomics_mode);
+            EXPECT_EQ(rocblas_gemm_backend_auto, backend);
+            EXPECT_EQ(staging_size, 4096u);
+            EXPECT_EQ(clone_stream, hipStream_t(0));
+
+            // The handles are independent, and the clone outlives its source
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(src, rocblas_pointer_mode_host));
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(src));
+            CHECK_ROCBLAS_ERROR(rocblas_get_pointer_mode(clone, &pointer_mode));
+            EXPECT_EQ(rocblas_pointer_mode_device, pointer_mode);
+
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(clone));
+            CHECK_HIP_ERROR(hipStreamDestroy(stream));
+        }
+    };
+
+    // The gemm epilogue of the source handle, which points to its device memory, is not copied
+    template <typename...>
+    struct testing_clone_handle_epilogue : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            rocblas_int M = arg.M, N = arg.N, K = arg.K;
+            if(M <= 0 || N <= 0 || K <= 0)
+                return;
+
+            rocblas_handle src, clone;
+            CHECK_ROCBLAS_ERROR(rocblas_create_handle(&src));
+
+            // Entries of 0 and 1, so that the products are exact
+            size_t             size_A = size_t(M) * K, size_B = size_t(K) * N;
+            size_t             size_D = size_t(M) * N;
+            host_vector<float> hA(size_A), hB(size_B), hBias(N);
+            host_vector<float> hD_src(size_D), hD_clone(size_D), hD_gold(size_D);
+            for(size_t i = 0; i < size_A; i++)
+                hA[i] = i % 3 == 0 ? 1.0f : 0.0f;
+            for(size_t i = 0; i < size_B; i++)
+                hB[i] = i % 5 == 0 ? 1.0f : 0.0f;
+            for(rocblas_int j = 0; j < N; j++)
+                hBias[j] = 1.0f;
+
+            device_vector<float> dA(size_A), dB(size_B), dD(size_D), dBias(N);
+            CHECK_DEVICE_ALLOCATION(dA.memcheck());
+            CHECK_DEVICE_ALLOCATION(dB.memcheck());
+            CHECK_DEVICE_ALLOCATION(dD.memcheck());
+            CHECK_DEVICE_ALLOCATION(dBias.memcheck());
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+            CHECK_HIP_ERROR(dB.transfer_from(hB));
+            CHECK_HIP_ERROR(dBias.transfer_from(hBias));
+
+            rocblas_gemm_epilogue epilogue{};
+            epilogue.bias_mode = rocblas_gemm_epilogue_bias_column;
+            epilogue.bias      = dBias;
+            CHECK_ROCBLAS_ERROR(rocblas_set_gemm_epilogue(src, &epilogue));
+            CHECK_ROCBLAS_ERROR(rocblas_clone_handle(src, &clone));
+
+            float alpha = 1.0f, beta = 0.0f;
+            auto  gemm  = [&](rocblas_handle handle, host_vector<float>& hD) {
+                CHECK_HIP_ERROR(hipMemset(dD, 0, size_D * sizeof(float)));
+                CHECK_ROCBLAS_ERROR(rocblas_gemm_ex(handle,
+                                                    rocblas_operation_none,
+                                                    rocblas_operation_none,
+                                                    M,
+                                                    N,
+                                                    K,
+                                                    &alpha,
+                                                    dA,
+                                                    rocblas_datatype_f32_r,
+                                                    M,
+                                                    dB,
+                                                    rocblas_datatype_f32_r,
+                                                    K,
+                                                    &beta,
+                                                    dD,
+                                                    rocblas_datatype_f32_r,
+                                                    M,
+                                                    dD,
+                                                    rocblas_datatype_f32_r,
+                                                    M,
+                                                    rocblas_datatype_f32_r,
+                                                    rocblas_gemm_algo_standard,
+                                                    0,
+                                                    0));
+                CHECK_HIP_ERROR(hD.transfer_from(dD));
+            };
+            gemm(src, hD_src);
+            gemm(clone, hD_clone);
+
+            for(rocblas_int j = 0; j < N; j++)
+                for(rocblas_int i = 0; i < M; i++)
+                {
+                    float sum = 0;
+                    for(rocblas_int k = 0; k < K; k++)
+                        sum += hA[i + size_t(k) * M] * hB[k + size_t(j) * K];
+                    hD_gold[i + size_t(j) * M] = sum;
+                }
+            unit_check_general<float>(M, N, M, hD_gold, hD_clone);
+
+            for(size_t i = 0; i < size_D; i++)
+                hD_gold[i] += 1.0f;
+            unit_check_general<float>(M, N, M, hD_gold, hD_src);
+
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(clone));
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(src));
+        }
+    };
+
+    template <template <typename...> class TESTING>
+    struct clone_handle_template : RocBLAS_Test<clone_handle_template<TESTING>, TESTING>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            if(std::is_same_v<TESTING<>, testing_clone_handle<>>)
+                return !strcmp(arg.function, "clone_handle");
+            return !strcmp(arg.function, "clone_handle_epilogue");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<clone_handle_template> name(arg.name);
+            if(!std::is_same_v<TESTING<>, testing_clone_handle<>>)
+                name << '_' << arg.M << '_' << arg.N << '_' << arg.K;
+            return std::move(name);
+        }
+    };
+
+    using clone_handle = clone_handle_template<testing_clone_handle>;
+    TEST_P(clone_handle, auxiliary_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_clone_handle<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(clone_handle)
+
+    using clone_handle_epilogue = clone_handle_template<testing_clone_handle_epilogue>;
+    TEST_P(clone_handle_epilogue, auxiliary_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_clone_handle_epilogue<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(clone_handle_epilogue)
+
+} // namespace
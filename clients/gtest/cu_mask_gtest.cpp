@@ -0,0 +1,170 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // A handle restricted to part of the compute units runs on a stream of its own and computes
+    // the same results as an unrestricted handle. The inputs are small integers so that the
+    // results do not depend on the solutions selected for the partition.
+    template <typename...>
+    struct testing_cu_mask : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            const uint32_t one_cu = 1;
+            EXPECT_ROCBLAS_STATUS(rocblas_set_cu_mask(nullptr, 1, &one_cu),
+                                  rocblas_status_invalid_handle);
+
+            rocblas_local_handle handle{arg}, reference{arg};
+            EXPECT_ROCBLAS_STATUS(rocblas_set_cu_mask(handle, -1, &one_cu),
+                                  rocblas_status_invalid_size);
+            EXPECT_ROCBLAS_STATUS(rocblas_set_cu_mask(handle, 1, nullptr),
+                                  rocblas_status_invalid_pointer);
+
+            // a mask enabling none of the compute units of the device is rejected
+            int device, device_cus;
+            CHECK_HIP_ERROR(hipGetDevice(&device));
+            CHECK_HIP_ERROR(
+                hipDeviceGetAttribute(&device_cus, hipDeviceAttributeMultiprocessorCount, device));
+            const rocblas_int     words = (device_cus + 31) / 32;
+            std::vector<uint32_t> cu_mask(words + 1, 0);
+            EXPECT_ROCBLAS_STATUS(rocblas_set_cu_mask(handle, words + 1, cu_mask.data()),
+                                  rocblas_status_invalid_value);
+
+            // the first half of the compute units
+            const int enabled = (device_cus + 1) / 2;
+            for(int cu = 0; cu < enabled; cu++)
+                cu_mask[cu / 32] |= 1u << (cu % 32);
+
+            hipStream_t saved_stream, masked_stream;
+            CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &saved_stream));
+            CHECK_ROCBLAS_ERROR(rocblas_set_cu_mask(handle, words, cu_mask.data()));
+            CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &masked_stream));
+            EXPECT_NE(masked_stream, saved_stream);
+            EXPECT_EQ(static_cast<rocblas_handle>(handle)->get_cu_mask_count(), enabled);
+
+            // the stream cannot be replaced while the mask is set
+            EXPECT_ROCBLAS_STATUS(rocblas_set_stream(handle, saved_stream),
+                                  rocblas_status_invalid_value);
+
+            const rocblas_int M     = arg.M;
+            const rocblas_int N     = arg.N;
+            const rocblas_int K     = arg.K;
+            const float       alpha = 1;
+            const float       beta  = 0;
+
+            host_vector<float> hA(size_t(M) * K), hB(size_t(K) * N);
+            host_vector<float> hC(size_t(M) * N), hC_gold(size_t(M) * N);
+            for(size_t i = 0; i < hA.size(); i++)
+                hA[i] = float(int(i % 7) - 3);
+            for(size_t i = 0; i < hB.size(); i++)
+                hB[i] = float(int(i % 5) - 2);
+
+            device_vector<float> dA(hA.size()), dB(hB.size()), dC(hC.size());
+            CHECK_DEVICE_ALLOCATION(dA.memcheck());
+            CHECK_DEVICE_ALLOCATION(dB.memcheck());
+            CHECK_DEVICE_ALLOCATION(dC.memcheck());
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+            CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+            auto run = [&](rocblas_handle h, host_vector<float>& C, float& asum) {
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(h, rocblas_pointer_mode_host));
+                CHECK_ROCBLAS_ERROR(rocblas_sgemm(h,
+                                                  rocblas_operation_none,
+                                                  rocblas_operation_none,
+                                                  M,
+                                                  N,
+                                                  K,
+                                                  &alpha,
+                                                  dA,
+                                                  M,
+                                                  dB,
+                                                  K,
+                                                  &beta,
+                                                  dC,
+                                                  M));
+                // the host pointer mode result waits for the stream of the handle
+                CHECK_ROCBLAS_ERROR(rocblas_sasum(h, M * N, dC, 1, &asum));
+                CHECK_HIP_ERROR(C.transfer_from(dC));
+            };
+
+            float asum, asum_gold;
+            run(reference, hC_gold, asum_gold);
+            run(handle, hC, asum);
+            unit_check_general<float>(M, N, M, hC_gold, hC);
+            EXPECT_EQ(asum, asum_gold);
+
+            // removing the mask restores the stream of the handle
+            hipStream_t stream;
+            CHECK_ROCBLAS_ERROR(rocblas_set_cu_mask(handle, 0, nullptr));
+            CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+            EXPECT_EQ(stream, saved_stream);
+            EXPECT_EQ(static_cast<rocblas_handle>(handle)->get_cu_mask_count(), 0);
+            CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, saved_stream));
+
+            run(handle, hC, asum);
+            unit_check_general<float>(M, N, M, hC_gold, hC);
+            EXPECT_EQ(asum, asum_gold);
+        }
+    };
+
+    struct cu_mask : RocBLAS_Test<cu_mask, testing_cu_mask>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "cu_mask");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<cu_mask> name(arg.name);
+            name << '_' << arg.M << '_' << arg.N << '_' << arg.K;
+            return std::move(name);
+        }
+    };
+
+    TEST_P(cu_mask, auxiliary_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_cu_mask<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(cu_mask)
+
+} // namespace
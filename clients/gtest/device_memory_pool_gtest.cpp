@@ -0,0 +1,155 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "../../library/src/include/rocblas_device_malloc.hpp"
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "unit.hpp"
+#include <cstring>
+#include <string>
+
+namespace
+{
+    uint64_t workspace_allocations(rocblas_handle handle)
+    {
+        rocblas_handle_stats stats{};
+        CHECK_ROCBLAS_ERROR(rocblas_get_handle_stats(handle, &stats));
+        return stats.workspace_allocations;
+    }
+
+    // With the pool enabled, a request which does not fit while the device memory is in use is
+    // served from an arena, arenas are reused, and the device memory grows to the high-water
+    // mark once nothing is in use
+    template <typename...>
+    struct testing_device_memory_pool : rocblas_test_valid
+    {
+        void operator()(const Arguments&)
+        {
+            rocblas_handle handle;
+            size_t         size = 0, high_water = 0;
+            CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+
+            EXPECT_ROCBLAS_STATUS(rocblas_set_device_memory_pool(nullptr, true),
+                                  rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_get_device_memory_high_water_mark(nullptr, &high_water),
+                                  rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_get_device_memory_high_water_mark(handle, nullptr),
+                                  rocblas_status_invalid_pointer);
+
+            if(!rocblas_is_managing_device_memory(handle))
+            {
+                CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+                GTEST_SKIP() << "the device memory of the handle is not rocBLAS-managed";
+                return;
+            }
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_pool(handle, true));
+            {
+                rocblas_device_malloc held(handle, size_t(1));
+                ASSERT_TRUE(bool(held));
+                CHECK_ROCBLAS_ERROR(rocblas_get_device_memory_size(handle, &size));
+                ASSERT_GT(size, 0u);
+
+                // The device memory cannot grow while it is held, so the pool serves the request
+                {
+                    rocblas_device_malloc overflow(handle, size);
+                    ASSERT_TRUE(bool(overflow));
+                    void* ptr = static_cast<void*>(overflow);
+                    EXPECT_NE(ptr, nullptr);
+                    EXPECT_NE(ptr, static_cast<void*>(held));
+                    CHECK_HIP_ERROR(hipMemset(ptr, 0, size));
+                    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+                    CHECK_ROCBLAS_ERROR(
+                        rocblas_get_device_memory_high_water_mark(handle, &high_water));
+                    EXPECT_GT(high_water, size);
+
+                    // Arenas cannot be released while they are in use
+                    EXPECT_ROCBLAS_STATUS(rocblas_set_device_memory_pool(handle, false),
+                                          rocblas_status_internal_error);
+                }
+
+                // An idle arena of the same size class is reused
+                uint64_t allocations = workspace_allocations(handle);
+                {
+                    rocblas_device_malloc overflow(handle, size);
+                    ASSERT_TRUE(bool(overflow));
+                    EXPECT_EQ(workspace_allocations(handle), allocations);
+                }
+            }
+
+            // Once nothing is in use, the arenas are replaced by device memory which covers the
+            // high-water mark, and serves the same requests without the pool
+            {
+                rocblas_device_malloc held(handle, size_t(1));
+                ASSERT_TRUE(bool(held));
+                size_t new_size = 0;
+                CHECK_ROCBLAS_ERROR(rocblas_get_device_memory_size(handle, &new_size));
+                EXPECT_GE(new_size, high_water);
+
+                uint64_t              allocations = workspace_allocations(handle);
+                rocblas_device_malloc overflow(handle, size);
+                ASSERT_TRUE(bool(overflow));
+                EXPECT_EQ(workspace_allocations(handle), allocations);
+            }
+
+            size_t latest = 0;
+            CHECK_ROCBLAS_ERROR(rocblas_get_device_memory_high_water_mark(handle, &latest));
+            EXPECT_EQ(latest, high_water);
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_pool(handle, false));
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+        }
+    };
+
+    struct device_memory_pool : RocBLAS_Test<device_memory_pool, testing_device_memory_pool>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "device_memory_pool");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<device_memory_pool>(arg.name);
+        }
+    };
+
+    TEST_P(device_memory_pool, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_device_memory_pool<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(device_memory_pool)
+
+} // namespace
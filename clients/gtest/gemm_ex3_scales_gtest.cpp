@@ -0,0 +1,255 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+
+namespace
+{
+    // gemm_strided_batched_ex3 with f8 inputs and f32 outputs, with and without the scales set on
+    // the handle. The inputs are small integers and the scales powers of two, so that the results
+    // and their maximum magnitude are exact.
+    template <typename...>
+    struct testing_gemm_ex3_scales : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            const rocblas_int    M           = arg.M;
+            const rocblas_int    N           = arg.N;
+            const rocblas_int    K           = arg.K;
+            const rocblas_int    batch_count = arg.batch_count;
+            const float          alpha       = arg.get_alpha<float>();
+            const float          beta        = arg.get_beta<float>();
+            const rocblas_stride stride_a    = rocblas_stride(M) * K;
+            const rocblas_stride stride_b    = rocblas_stride(K) * N;
+            const rocblas_stride stride_c    = rocblas_stride(M) * N;
+
+            rocblas_gemm_ex3_scales scales{};
+            EXPECT_ROCBLAS_STATUS(rocblas_set_gemm_ex3_scales(nullptr, &scales),
+                                  rocblas_status_invalid_handle);
+
+            rocblas_local_handle handle{arg};
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            host_vector<rocblas_f8> hA(stride_a * batch_count), hB(stride_b * batch_count);
+            host_vector<float>      hC(stride_c * batch_count), hD(stride_c * batch_count);
+            host_vector<float>      hAB(stride_c * batch_count), hD_gold(stride_c * batch_count);
+            for(size_t i = 0; i < hA.size(); i++)
+                hA[i] = rocblas_f8(float(int(i % 5) - 2));
+            for(size_t i = 0; i < hB.size(); i++)
+                hB[i] = rocblas_f8(float(int(i % 7) % 3 - 1));
+            for(size_t i = 0; i < hC.size(); i++)
+                hC[i] = float(int(i % 9) - 4);
+
+            // the unscaled products
+            for(rocblas_int b = 0; b < batch_count; b++)
+                for(rocblas_int j = 0; j < N; j++)
+                    for(rocblas_int i = 0; i < M; i++)
+                    {
+                        float sum = 0;
+                        for(rocblas_int l = 0; l < K; l++)
+                            sum += float(hA[b * stride_a + i + l * size_t(M)])
+                                   * float(hB[b * stride_b + l + j * size_t(K)]);
+                        hAB[b * stride_c + i + j * size_t(M)] = sum;
+                    }
+
+            device_vector<rocblas_f8> dA(hA.size()), dB(hB.size());
+            device_vector<float>      dC(hC.size()), dD(hD.size()), d_amax(1);
+            CHECK_DEVICE_ALLOCATION(dA.memcheck());
+            CHECK_DEVICE_ALLOCATION(dB.memcheck());
+            CHECK_DEVICE_ALLOCATION(dC.memcheck());
+            CHECK_DEVICE_ALLOCATION(dD.memcheck());
+            CHECK_DEVICE_ALLOCATION(d_amax.memcheck());
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+            CHECK_HIP_ERROR(dB.transfer_from(hB));
+            CHECK_HIP_ERROR(dC.transfer_from(hC));
+
+            auto gemm = [&]() {
+                CHECK_ROCBLAS_ERROR(rocblas_gemm_strided_batched_ex3(handle,
+                                                                     rocblas_operation_none,
+                                                                     rocblas_operation_none,
+                                                                     M,
+                                                                     N,
+                                                                     K,
+                                                                     &alpha,
+                                                                     dA,
+                                                                     rocblas_datatype_f8_r,
+                                                                     M,
+                                                                     stride_a,
+                                                                     dB,
+                                                                     rocblas_datatype_f8_r,
+                                                                     K,
+                                                                     stride_b,
+                                                                     &beta,
+                                                                     dC,
+                                                                     rocblas_datatype_f32_r,
+                                                                     M,
+                                                                     stride_c,
+                                                                     dD,
+                                                                     rocblas_datatype_f32_r,
+                                                                     M,
+                                                                     stride_c,
+                                                                     batch_count,
+                                                                     rocblas_compute_type_f32,
+                                                                     rocblas_gemm_algo_standard,
+                                                                     0,
+                                                                     rocblas_gemm_flags_none));
+                CHECK_HIP_ERROR(hD.transfer_from(dD));
+            };
+
+            // the maximum is reset by each call, so it is set above any result before the call
+            auto reset_amax = [&]() {
+                const float huge = 1e30f;
+                CHECK_HIP_ERROR(hipMemcpy(d_amax, &huge, sizeof(float), hipMemcpyHostToDevice));
+            };
+            auto check_amax = [&]() {
+                float h_amax = 0, amax_gold = 0;
+                CHECK_HIP_ERROR(hipMemcpy(&h_amax, d_amax, sizeof(float), hipMemcpyDeviceToHost));
+                for(auto v : hD_gold)
+                    amax_gold = std::max(amax_gold, std::abs(v));
+                EXPECT_EQ(h_amax, amax_gold);
+            };
+
+            for(size_t i = 0; i < hD_gold.size(); i++)
+                hD_gold[i] = alpha * hAB[i] + beta * hC[i];
+            gemm();
+            unit_check_general<float>(M, N, M, stride_c, hD_gold, hD, batch_count);
+
+            // per-channel and per-block scales of op(A) and op(B)
+            for(int64_t block : {1, 3})
+            {
+                const int64_t        blocks_a = (M + block - 1) / block;
+                const int64_t        blocks_b = (N + block + 1) / (block + 2);
+                host_vector<float>   h_scale_a(blocks_a * batch_count);
+                host_vector<float>   h_scale_b(blocks_b * batch_count);
+                const float          h_scale_d = 0.5f;
+                device_vector<float> d_scale_a(h_scale_a.size()), d_scale_b(h_scale_b.size());
+                device_vector<float> d_scale_d(1);
+                CHECK_DEVICE_ALLOCATION(d_scale_a.memcheck());
+                CHECK_DEVICE_ALLOCATION(d_scale_b.memcheck());
+                CHECK_DEVICE_ALLOCATION(d_scale_d.memcheck());
+
+                for(size_t i = 0; i < h_scale_a.size(); i++)
+                    h_scale_a[i] = std::ldexp(1.0f, int(i % 3) - 1);
+                for(size_t i = 0; i < h_scale_b.size(); i++)
+                    h_scale_b[i] = std::ldexp(1.0f, int(i % 4) - 2);
+                CHECK_HIP_ERROR(d_scale_a.transfer_from(h_scale_a));
+                CHECK_HIP_ERROR(d_scale_b.transfer_from(h_scale_b));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(d_scale_d, &h_scale_d, sizeof(float), hipMemcpyHostToDevice));
+
+                scales.scale_a        = d_scale_a;
+                scales.block_a        = block;
+                scales.stride_scale_a = blocks_a;
+                scales.scale_b        = d_scale_b;
+                scales.block_b        = block + 2;
+                scales.stride_scale_b = blocks_b;
+                scales.scale_d        = d_scale_d;
+                scales.amax_d         = d_amax;
+                CHECK_ROCBLAS_ERROR(rocblas_set_gemm_ex3_scales(handle, &scales));
+                reset_amax();
+
+                for(rocblas_int b = 0; b < batch_count; b++)
+                    for(rocblas_int j = 0; j < N; j++)
+                        for(rocblas_int i = 0; i < M; i++)
+                        {
+                            size_t idx = b * stride_c + i + j * size_t(M);
+                            float  ab  = alpha * hAB[idx] * h_scale_a[b * blocks_a + i / block]
+                                       * h_scale_b[b * blocks_b + j / (block + 2)];
+                            hD_gold[idx] = h_scale_d * (ab + beta * hC[idx]);
+                        }
+                gemm();
+                unit_check_general<float>(M, N, M, stride_c, hD_gold, hD, batch_count);
+                check_amax();
+            }
+
+            // the maximum alone
+            rocblas_gemm_ex3_scales amax_only{};
+            amax_only.amax_d = d_amax;
+            CHECK_ROCBLAS_ERROR(rocblas_set_gemm_ex3_scales(handle, &amax_only));
+            reset_amax();
+            for(size_t i = 0; i < hD_gold.size(); i++)
+                hD_gold[i] = alpha * hAB[i] + beta * hC[i];
+            gemm();
+            unit_check_general<float>(M, N, M, stride_c, hD_gold, hD, batch_count);
+            check_amax();
+
+            // invalid block sizes and strides are rejected
+            rocblas_gemm_ex3_scales bad = scales;
+            bad.block_a                 = 0;
+            EXPECT_ROCBLAS_STATUS(rocblas_set_gemm_ex3_scales(handle, &bad),
+                                  rocblas_status_invalid_size);
+            bad                = scales;
+            bad.stride_scale_b = -1;
+            EXPECT_ROCBLAS_STATUS(rocblas_set_gemm_ex3_scales(handle, &bad),
+                                  rocblas_status_invalid_size);
+
+            // clearing the scales restores the unscaled results
+            CHECK_ROCBLAS_ERROR(rocblas_set_gemm_ex3_scales(handle, nullptr));
+            for(size_t i = 0; i < hD_gold.size(); i++)
+                hD_gold[i] = alpha * hAB[i] + beta * hC[i];
+            gemm();
+            unit_check_general<float>(M, N, M, stride_c, hD_gold, hD, batch_count);
+        }
+    };
+
+    struct gemm_ex3_scales : RocBLAS_Test<gemm_ex3_scales, testing_gemm_ex3_scales>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "gemm_ex3_scales");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<gemm_ex3_scales> name(arg.name);
+            name << '_' << arg.M << '_' << arg.N << '_' << arg.K << '_' << arg.alpha << '_'
+                 << arg.beta << '_' << arg.batch_count;
+            return std::move(name);
+        }
+    };
+
+    TEST_P(gemm_ex3_scales, auxiliary_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_gemm_ex3_scales<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_ex3_scales)
+
+} // namespace
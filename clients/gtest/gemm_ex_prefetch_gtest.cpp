@@ -0,0 +1,198 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "cblas_interface.hpp"
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include <cstring>
+#include <string>
+
+namespace
+{
+    // A prefetched problem has its solution selected on the background thread, without any
+    // work on the stream of the handle, and the later call computes the expected result
+    template <typename...>
+    struct testing_gemm_ex_prefetch : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            const rocblas_int      M     = arg.M;
+            const rocblas_int      N     = arg.N;
+            const rocblas_int      K     = arg.K;
+            const float            alpha = arg.get_alpha<float>();
+            const float            beta  = arg.get_beta<float>();
+            const rocblas_datatype f32   = rocblas_datatype_f32_r;
+
+            rocblas_local_handle handle{arg};
+            CHECK_ROCBLAS_ERROR(rocblas_set_gemm_backend(handle, rocblas_gemm_backend_tensile));
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            auto prefetch = [&](rocblas_handle   h,
+                                rocblas_int      m,
+                                rocblas_int      ldc,
+                                const float*     a,
+                                rocblas_datatype b_type) {
+                return rocblas_gemm_ex_prefetch(h,
+                                                rocblas_operation_none,
+                                                rocblas_operation_none,
+                                                m,
+                                                N,
+                                                K,
+                                                a,
+                                                f32,
+                                                M,
+                                                0,
+                                                b_type,
+                                                K,
+                                                0,
+                                                &beta,
+                                                f32,
+                                                ldc,
+                                                0,
+                                                1,
+                                                f32,
+                                                rocblas_gemm_flags_none);
+            };
+
+            EXPECT_ROCBLAS_STATUS(prefetch(nullptr, M, M, &alpha, f32),
+                                  rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(prefetch(handle, -1, M, &alpha, f32),
+                                  rocblas_status_invalid_size);
+            EXPECT_ROCBLAS_STATUS(prefetch(handle, M, M - 1, &alpha, f32),
+                                  rocblas_status_invalid_size);
+            EXPECT_ROCBLAS_STATUS(prefetch(handle, M, M, nullptr, f32),
+                                  rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(prefetch(handle, M, M, &alpha, rocblas_datatype_f64_r),
+                                  rocblas_status_not_implemented);
+            CHECK_ROCBLAS_ERROR(prefetch(handle, 0, M, &alpha, f32));
+
+            host_vector<float> hA(size_t(M) * K), hB(size_t(K) * N), hC(size_t(M) * N);
+            host_vector<float> hC_gold(size_t(M) * N);
+            rocblas_seedrand();
+            rocblas_init<float>(hA, M, K, M);
+            rocblas_init<float>(hB, K, N, K);
+            rocblas_init<float>(hC, M, N, M);
+            hC_gold = hC;
+
+            device_vector<float> dA(size_t(M) * K), dB(size_t(K) * N), dC(size_t(M) * N);
+            CHECK_DEVICE_ALLOCATION(dA.memcheck());
+            CHECK_DEVICE_ALLOCATION(dB.memcheck());
+            CHECK_DEVICE_ALLOCATION(dC.memcheck());
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+            CHECK_HIP_ERROR(dB.transfer_from(hB));
+            CHECK_HIP_ERROR(dC.transfer_from(hC));
+
+            size_t hits_0, misses_0, hits_1, misses_1;
+            CHECK_ROCBLAS_ERROR(rocblas_get_solution_cache_stats(handle, &hits_0, &misses_0));
+            CHECK_ROCBLAS_ERROR(prefetch(handle, M, M, &alpha, f32));
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_ex_prefetch_synchronize());
+            CHECK_ROCBLAS_ERROR(rocblas_get_solution_cache_stats(handle, &hits_1, &misses_1));
+            EXPECT_GT(hits_1 + misses_1, hits_0 + misses_0);
+
+            // Nothing was enqueued on the stream of the handle
+            hipStream_t stream;
+            CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+            CHECK_HIP_ERROR(hC.transfer_from(dC));
+            unit_check_general<float>(M, N, M, hC_gold, hC);
+
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_ex(handle,
+                                                rocblas_operation_none,
+                                                rocblas_operation_none,
+                                                M,
+                                                N,
+                                                K,
+                                                &alpha,
+                                                dA,
+                                                f32,
+                                                M,
+                                                dB,
+                                                f32,
+                                                K,
+                                                &beta,
+                                                dC,
+                                                f32,
+                                                M,
+                                                dC,
+                                                f32,
+                                                M,
+                                                f32,
+                                                rocblas_gemm_algo_standard,
+                                                0,
+                                                rocblas_gemm_flags_none));
+            CHECK_HIP_ERROR(hC.transfer_from(dC));
+
+            ref_gemm<float, float, float>(rocblas_operation_none,
+                                          rocblas_operation_none,
+                                          M,
+                                          N,
+                                          K,
+                                          alpha,
+                                          hA,
+                                          M,
+                                          hB,
+                                          K,
+                                          beta,
+                                          hC_gold,
+                                          M);
+            unit_check_general<float>(M, N, M, hC_gold, hC);
+        }
+    };
+
+    struct gemm_ex_prefetch : RocBLAS_Test<gemm_ex_prefetch, testing_gemm_ex_prefetch>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "gemm_ex_prefetch");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<gemm_ex_prefetch> name(arg.name);
+            name << '_' << arg.M << '_' << arg.N << '_' << arg.K << '_' << arg.alpha << '_'
+                 << arg.beta;
+            return std::move(name);
+        }
+    };
+
+    TEST_P(gemm_ex_prefetch, auxiliary_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_gemm_ex_prefetch<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_ex_prefetch)
+
+} // namespace
@@ -672,6 +672,53 @@ namespace
                                                                  is_input);
 
         EXPECT_EQ(status, rocblas_status_check_numerics_fail);
+
+        //==============================================================================================
+        // Asynchronous checks accumulate in the flags of the handle until they are reported
+        //==============================================================================================
+        EXPECT_EQ(rocblas_get_check_numerics_status(nullptr), rocblas_status_invalid_handle);
+
+        rocblas_check_numerics_mode async_check_numerics = rocblas_check_numerics_mode(
+            rocblas_check_numerics_mode_fail | rocblas_check_numerics_mode_async);
+        rocblas_handle async_handle  = handle;
+        async_handle->check_numerics = async_check_numerics;
+
+        auto check_async = [&](int64_t n, const T* x, int64_t inc) {
+            return rocblas_internal_check_numerics_vector_template(function_name,
+                                                                   async_handle,
+                                                                   n,
+                                                                   x,
+                                                                   offset_x,
+                                                                   inc,
+                                                                   stride_x,
+                                                                   1,
+                                                                   async_check_numerics,
+                                                                   is_input);
+        };
+
+        rocblas_init_vector(h_x, arg, rocblas_client_never_set_nan, true);
+        CHECK_HIP_ERROR(d_x.transfer_from(h_x));
+        EXPECT_EQ(check_async(N, d_x, inc_x), rocblas_status_success);
+        EXPECT_EQ(rocblas_get_check_numerics_status(async_handle), rocblas_status_success);
+
+        // the flags are sticky: a NaN is reported after a later call on a normal value
+        host_vector<T>   h_one(1);
+        device_vector<T> d_one(1);
+        CHECK_DEVICE_ALLOCATION(d_one.memcheck());
+        h_one[0] = T(1);
+        CHECK_HIP_ERROR(d_one.transfer_from(h_one));
+
+        rocblas_init_nan_range<T>((T*)h_x, 0, 1);
+        CHECK_HIP_ERROR(d_x.transfer_from(h_x));
+        EXPECT_EQ(check_async(N, d_x, inc_x), rocblas_status_success);
+        EXPECT_EQ(check_async(1, d_one, 1), rocblas_status_success);
+        EXPECT_EQ(rocblas_get_check_numerics_status(async_handle),
+                  rocblas_status_check_numerics_fail);
+
+        // reporting the flags clears them
+        EXPECT_EQ(rocblas_get_check_numerics_status(async_handle), rocblas_status_success);
+        EXPECT_EQ(check_async(1, d_one, 1), rocblas_status_success);
+        EXPECT_EQ(rocblas_get_check_numerics_status(async_handle), rocblas_status_success);
     };
 
     // By default, arbitrary type combinations are invalid.
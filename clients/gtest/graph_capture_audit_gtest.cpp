@@ -0,0 +1,203 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include <cstring>
+#include <string>
+
+namespace
+{
+    rocblas_int audit_count(rocblas_handle handle)
+    {
+        rocblas_int count = 0;
+        CHECK_ROCBLAS_ERROR(rocblas_get_graph_capture_audit(handle, &count, nullptr));
+        return count;
+    }
+
+    // Host pointer mode reduction results are written by the graph, and the paths which cannot
+    // be captured fail without enqueueing work and are recorded by the audit
+    template <typename...>
+    struct testing_graph_capture_audit : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            rocblas_int count = 1;
+            const char* path  = nullptr;
+            EXPECT_ROCBLAS_STATUS(rocblas_set_graph_capture_audit(nullptr, true),
+                                  rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_get_graph_capture_audit(nullptr, &count, &path),
+                                  rocblas_status_invalid_handle);
+
+            rocblas_handle handle;
+            hipStream_t    stream;
+            CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+            CHECK_HIP_ERROR(hipStreamCreate(&stream));
+            CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, stream));
+            EXPECT_ROCBLAS_STATUS(rocblas_get_graph_capture_audit(handle, nullptr, &path),
+                                  rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(rocblas_get_graph_capture_audit(handle, &count, nullptr),
+                                  rocblas_status_invalid_pointer);
+            EXPECT_EQ(audit_count(handle), 0);
+
+            const rocblas_int  N = arg.N;
+            host_vector<float> hx(N), hy(N);
+            rocblas_seedrand();
+            rocblas_init<float>(hx, 1, N, 1);
+            rocblas_init<float>(hy, 1, N, 1);
+
+            device_vector<float> dx(N), dy(N);
+            CHECK_DEVICE_ALLOCATION(dx.memcheck());
+            CHECK_DEVICE_ALLOCATION(dy.memcheck());
+            CHECK_HIP_ERROR(dx.transfer_from(hx));
+            CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+            // dot, asum, nrm2 and the index of the largest and smallest magnitudes
+            auto reductions = [&](float* r, rocblas_int* index) {
+                CHECK_ROCBLAS_ERROR(rocblas_sdot(handle, N, dx, 1, dy, 1, r));
+                CHECK_ROCBLAS_ERROR(rocblas_sasum(handle, N, dx, 1, r + 1));
+                CHECK_ROCBLAS_ERROR(rocblas_snrm2(handle, N, dx, 1, r + 2));
+                CHECK_ROCBLAS_ERROR(rocblas_isamax(handle, N, dy, 1, index));
+                CHECK_ROCBLAS_ERROR(rocblas_isamin(handle, N, dy, 1, index + 1));
+            };
+
+            host_pinned_vector<float>       h_results(3), h_gold(3);
+            host_pinned_vector<rocblas_int> h_index(2), h_index_gold(2);
+            CHECK_HIP_ERROR(h_results.memcheck());
+            CHECK_HIP_ERROR(h_gold.memcheck());
+            CHECK_HIP_ERROR(h_index.memcheck());
+            CHECK_HIP_ERROR(h_index_gold.memcheck());
+            reductions(h_gold, h_index_gold);
+
+            for(int i = 0; i < 3; i++)
+                h_results[i] = 0;
+            h_index[0] = h_index[1] = 0;
+
+            hipGraph_t     graph;
+            hipGraphExec_t instance;
+            CHECK_HIP_ERROR(hipStreamBeginCapture(stream, hipStreamCaptureModeThreadLocal));
+            reductions(h_results, h_index);
+
+            // Device pointer mode scalars of Level 3 functions are read on the host
+            device_vector<float> d_scalars(2);
+            device_vector<float> dC(1);
+            CHECK_DEVICE_ALLOCATION(d_scalars.memcheck());
+            CHECK_DEVICE_ALLOCATION(dC.memcheck());
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+            auto sgemm = [&]() {
+                return rocblas_sgemm(handle,
+                                     rocblas_operation_none,
+                                     rocblas_operation_none,
+                                     1,
+                                     1,
+                                     N,
+                                     d_scalars,
+                                     dx,
+                                     1,
+                                     dy,
+                                     N,
+                                     (float*)d_scalars + 1,
+                                     dC,
+                                     1);
+            };
+            EXPECT_ROCBLAS_STATUS(sgemm(), rocblas_status_not_implemented);
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            CHECK_HIP_ERROR(hipStreamEndCapture(stream, &graph));
+            EXPECT_GE(audit_count(handle), 1);
+
+            // Nothing is written before the graph is launched
+            EXPECT_EQ(h_results[0], 0.0f);
+            CHECK_HIP_ERROR(hipGraphInstantiate(&instance, graph, nullptr, nullptr, 0));
+            CHECK_HIP_ERROR(hipGraphLaunch(instance, stream));
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+            CHECK_HIP_ERROR(hipGraphExecDestroy(instance));
+            CHECK_HIP_ERROR(hipGraphDestroy(graph));
+
+            unit_check_general<float>(1, 3, 1, h_gold, h_results);
+            unit_check_general<rocblas_int>(1, 2, 1, h_index_gold, h_index);
+
+            // With the audit enabled, the paths are recorded outside of capture as well
+            CHECK_ROCBLAS_ERROR(rocblas_set_graph_capture_audit(handle, true));
+            EXPECT_EQ(audit_count(handle), 0);
+            CHECK_HIP_ERROR(hipMemset(d_scalars, 0, 2 * sizeof(float)));
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+            CHECK_ROCBLAS_ERROR(sgemm());
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            count = audit_count(handle);
+            EXPECT_GE(count, 1);
+            std::vector<const char*> paths(count);
+            CHECK_ROCBLAS_ERROR(rocblas_get_graph_capture_audit(handle, &count, paths.data()));
+            for(auto p : paths)
+                EXPECT_TRUE(p && *p);
+
+            // Capturable calls are not recorded, and disabling the audit clears it
+            CHECK_ROCBLAS_ERROR(rocblas_set_graph_capture_audit(handle, true));
+            reductions(h_results, h_index);
+            EXPECT_EQ(audit_count(handle), 0);
+            CHECK_ROCBLAS_ERROR(rocblas_set_graph_capture_audit(handle, false));
+            EXPECT_EQ(audit_count(handle), 0);
+
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+            CHECK_HIP_ERROR(hipStreamDestroy(stream));
+        }
+    };
+
+    struct graph_capture_audit
+        : RocBLAS_Test<graph_capture_audit, testing_graph_capture_audit>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "graph_capture_audit");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<graph_capture_audit> name(arg.name);
+            name << '_' << arg.N;
+            return std::move(name);
+        }
+    };
+
+    TEST_P(graph_capture_audit, auxiliary_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_graph_capture_audit<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(graph_capture_audit)
+
+} // namespace
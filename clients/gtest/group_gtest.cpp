@@ -0,0 +1,212 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include <cstring>
+#include <string>
+
+namespace
+{
+    // Independent calls issued in a group compute what they compute outside of one, and groups
+    // are neither nested nor closed twice
+    template <typename...>
+    struct testing_group : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            rocblas_int N = arg.N;
+            if(N <= 0)
+                return;
+
+            rocblas_handle handle;
+            CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+            hipStream_t stream, handle_stream = nullptr, other;
+            CHECK_HIP_ERROR(hipStreamCreate(&stream));
+            CHECK_HIP_ERROR(hipStreamCreate(&other));
+            CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, stream));
+
+            EXPECT_ROCBLAS_STATUS(rocblas_group_begin(nullptr, 0), rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_group_end(nullptr), rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_group_begin(handle, -1), rocblas_status_invalid_size);
+            EXPECT_ROCBLAS_STATUS(rocblas_group_end(handle), rocblas_status_invalid_value);
+
+            CHECK_ROCBLAS_ERROR(rocblas_group_begin(handle, 0));
+            EXPECT_ROCBLAS_STATUS(rocblas_group_begin(handle, 2), rocblas_status_invalid_value);
+            EXPECT_ROCBLAS_STATUS(rocblas_set_stream(handle, other), rocblas_status_invalid_value);
+            CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &handle_stream));
+            EXPECT_EQ(handle_stream, stream);
+            CHECK_ROCBLAS_ERROR(rocblas_group_end(handle));
+            EXPECT_ROCBLAS_STATUS(rocblas_group_end(handle), rocblas_status_invalid_value);
+
+            // Each chain scales x, adds it to y, multiplies A by x into z and takes the norm of
+            // y, which uses the workspace of the handle. The chains are independent of each
+            // other, but the calls of a chain are not, so each group holds one call of every
+            // chain. The vectors of chain c are the columns c of N x chains matrices.
+            const int          chains = 6;
+            size_t             size_A = size_t(N) * N, size_x = size_t(N) * chains;
+            host_vector<float> hA(size_A), hx(size_x), hy(size_x), h_alpha(chains);
+            host_vector<float> hx_gold(size_x), hy_gold(size_x), hz_gold(size_x), hnrm_gold(chains);
+            host_vector<float> hx_group(size_x), hy_group(size_x), hz_group(size_x);
+            host_vector<float> hnrm_group(chains);
+            for(size_t i = 0; i < size_A; i++)
+                hA[i] = float(i % 7) - 3.0f;
+            for(size_t i = 0; i < size_x; i++)
+            {
+                hx[i] = float(i % 5) - 2.0f;
+                hy[i] = float(i % 3);
+            }
+            for(int c = 0; c < chains; c++)
+                h_alpha[c] = float(c + 1);
+
+            device_vector<float> dA(size_A), dx(size_x), dy(size_x), dz(size_x);
+            device_vector<float> d_nrm(chains), d_alpha(chains);
+            CHECK_DEVICE_ALLOCATION(dA.memcheck());
+            CHECK_DEVICE_ALLOCATION(dx.memcheck());
+            CHECK_DEVICE_ALLOCATION(dy.memcheck());
+            CHECK_DEVICE_ALLOCATION(dz.memcheck());
+            CHECK_DEVICE_ALLOCATION(d_nrm.memcheck());
+            CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+            CHECK_HIP_ERROR(d_alpha.transfer_from(h_alpha));
+
+            float one = 1.0f, zero = 0.0f;
+            auto  run = [&](bool grouped, rocblas_int num_streams) {
+                CHECK_HIP_ERROR(dx.transfer_from(hx));
+                CHECK_HIP_ERROR(dy.transfer_from(hy));
+                CHECK_HIP_ERROR(hipMemset(dz, 0, size_x * sizeof(float)));
+                CHECK_HIP_ERROR(hipMemset(d_nrm, 0, chains * sizeof(float)));
+
+                auto group_begin = [&] {
+                    if(grouped)
+                        CHECK_ROCBLAS_ERROR(rocblas_group_begin(handle, num_streams));
+                };
+                auto group_end = [&] {
+                    if(grouped)
+                        CHECK_ROCBLAS_ERROR(rocblas_group_end(handle));
+                };
+                float* x = dx;
+                float* y = dy;
+                float* z = dz;
+
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+                group_begin();
+                for(int c = 0; c < chains; c++)
+                    CHECK_ROCBLAS_ERROR(
+                        rocblas_sscal(handle, N, (float*)d_alpha + c, x + size_t(c) * N, 1));
+                group_end();
+
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+                group_begin();
+                for(int c = 0; c < chains; c++)
+                    CHECK_ROCBLAS_ERROR(rocblas_saxpy(
+                        handle, N, &one, x + size_t(c) * N, 1, y + size_t(c) * N, 1));
+                group_end();
+
+                group_begin();
+                for(int c = 0; c < chains; c++)
+                    CHECK_ROCBLAS_ERROR(rocblas_sgemv(handle,
+                                                      rocblas_operation_none,
+                                                      N,
+                                                      N,
+                                                      &one,
+                                                      dA,
+                                                      N,
+                                                      x + size_t(c) * N,
+                                                      1,
+                                                      &zero,
+                                                      z + size_t(c) * N,
+                                                      1));
+                group_end();
+
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+                group_begin();
+                for(int c = 0; c < chains; c++)
+                    CHECK_ROCBLAS_ERROR(
+                        rocblas_snrm2(handle, N, y + size_t(c) * N, 1, (float*)d_nrm + c));
+                group_end();
+            };
+
+            run(false, 0);
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+            CHECK_HIP_ERROR(hx_gold.transfer_from(dx));
+            CHECK_HIP_ERROR(hy_gold.transfer_from(dy));
+            CHECK_HIP_ERROR(hz_gold.transfer_from(dz));
+            CHECK_HIP_ERROR(hnrm_gold.transfer_from(d_nrm));
+
+            // The stream of the handle waits for the calls of the group when it is closed
+            for(rocblas_int num_streams : {0, 1, 3, chains + 1})
+            {
+                run(true, num_streams);
+                CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+                CHECK_HIP_ERROR(hx_group.transfer_from(dx));
+                CHECK_HIP_ERROR(hy_group.transfer_from(dy));
+                CHECK_HIP_ERROR(hz_group.transfer_from(dz));
+                CHECK_HIP_ERROR(hnrm_group.transfer_from(d_nrm));
+                unit_check_general<float>(N, chains, N, hx_gold, hx_group);
+                unit_check_general<float>(N, chains, N, hy_gold, hy_group);
+                unit_check_general<float>(N, chains, N, hz_gold, hz_group);
+                unit_check_general<float>(1, chains, 1, hnrm_gold, hnrm_group);
+            }
+
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+            CHECK_HIP_ERROR(hipStreamDestroy(other));
+            CHECK_HIP_ERROR(hipStreamDestroy(stream));
+        }
+    };
+
+    struct group : RocBLAS_Test<group, testing_group>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "group");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<group> name(arg.name);
+            name << '_' << arg.N;
+            return std::move(name);
+        }
+    };
+
+    TEST_P(group, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_group<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(group)
+
+} // namespace
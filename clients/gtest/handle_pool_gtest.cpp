@@ -0,0 +1,178 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+
+namespace
+{
+    // Handles lent by a pool are reset when they are released, and threads wait for a handle
+    // when all of them are lent
+    template <typename...>
+    struct testing_handle_pool : rocblas_test_valid
+    {
+        void operator()(const Arguments&)
+        {
+            rocblas_handle_pool pool = nullptr;
+            rocblas_handle      handle, other;
+
+            EXPECT_ROCBLAS_STATUS(rocblas_create_handle_pool(nullptr, 2, 0),
+                                  rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(rocblas_create_handle_pool(&pool, 0, 0),
+                                  rocblas_status_invalid_size);
+            EXPECT_EQ(pool, nullptr);
+            EXPECT_ROCBLAS_STATUS(rocblas_destroy_handle_pool(nullptr),
+                                  rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(rocblas_handle_pool_acquire(nullptr, 0, &handle),
+                                  rocblas_status_invalid_pointer);
+
+            CHECK_ROCBLAS_ERROR(rocblas_create_handle_pool(&pool, 2, 0));
+            EXPECT_ROCBLAS_STATUS(rocblas_handle_pool_acquire(pool, 0, nullptr),
+                                  rocblas_status_invalid_pointer);
+
+            hipStream_t stream, handle_stream = nullptr;
+            CHECK_HIP_ERROR(hipStreamCreate(&stream));
+
+            // The handle enqueues on the stream it is lent with
+            CHECK_ROCBLAS_ERROR(rocblas_handle_pool_acquire(pool, stream, &handle));
+            CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &handle_stream));
+            EXPECT_EQ(handle_stream, stream);
+
+            rocblas_pointer_mode pointer_mode;
+            rocblas_atomics_mode atomics_mode, pool_atomics_mode;
+            CHECK_ROCBLAS_ERROR(rocblas_get_atomics_mode(handle, &pool_atomics_mode));
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+            atomics_mode = pool_atomics_mode == rocblas_atomics_allowed
+                               ? rocblas_atomics_not_allowed
+                               : rocblas_atomics_allowed;
+            CHECK_ROCBLAS_ERROR(rocblas_set_atomics_mode(handle, atomics_mode));
+
+            // Work enqueued with the handle need not have completed when it is released
+            device_vector<float> dx(1024);
+            CHECK_DEVICE_ALLOCATION(dx.memcheck());
+            host_vector<float> hx(1024), hx_gold(1024);
+            for(size_t i = 0; i < hx.size(); i++)
+                hx[i] = float(i % 17);
+            CHECK_HIP_ERROR(dx.transfer_from(hx));
+            device_vector<float> d_alpha(1);
+            CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+            float alpha = 2.0f;
+            CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(float), hipMemcpyHostToDevice));
+            CHECK_ROCBLAS_ERROR(rocblas_sscal(handle, 1024, d_alpha, dx, 1));
+
+            EXPECT_ROCBLAS_STATUS(rocblas_handle_pool_release(nullptr, handle),
+                                  rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(rocblas_handle_pool_release(pool, nullptr),
+                                  rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_destroy_handle_pool(pool), rocblas_status_invalid_value);
+            CHECK_ROCBLAS_ERROR(rocblas_handle_pool_release(pool, handle));
+            EXPECT_ROCBLAS_STATUS(rocblas_handle_pool_release(pool, handle),
+                                  rocblas_status_invalid_handle);
+
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+            CHECK_HIP_ERROR(hx.transfer_from(dx));
+            for(size_t i = 0; i < hx_gold.size(); i++)
+                hx_gold[i] = 2.0f * float(i % 17);
+            unit_check_general<float>(1, 1024, 1, hx_gold, hx);
+
+            // Handles which are not lent by the pool cannot be released to it
+            rocblas_handle foreign;
+            CHECK_ROCBLAS_ERROR(rocblas_create_handle(&foreign));
+            EXPECT_ROCBLAS_STATUS(rocblas_handle_pool_release(pool, foreign),
+                                  rocblas_status_invalid_handle);
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(foreign));
+
+            // The thread gets back the handle it released, reset to the configuration of the
+            // pool, on its per-thread default stream
+            CHECK_ROCBLAS_ERROR(rocblas_handle_pool_acquire(pool, 0, &other));
+            EXPECT_EQ(other, handle);
+            CHECK_ROCBLAS_ERROR(rocblas_get_stream(other, &handle_stream));
+            EXPECT_EQ(handle_stream, hipStreamPerThread);
+            CHECK_ROCBLAS_ERROR(rocblas_get_pointer_mode(other, &pointer_mode));
+            CHECK_ROCBLAS_ERROR(rocblas_get_atomics_mode(other, &atomics_mode));
+            EXPECT_EQ(pointer_mode, rocblas_pointer_mode_host);
+            EXPECT_EQ(atomics_mode, pool_atomics_mode);
+
+            // With both handles lent, another thread waits until one of them is released
+            CHECK_ROCBLAS_ERROR(rocblas_handle_pool_acquire(pool, stream, &handle));
+            EXPECT_NE(handle, other);
+
+            std::atomic<bool> acquired{false};
+            rocblas_handle    waited = nullptr;
+            std::thread       waiter([&] {
+                CHECK_ROCBLAS_ERROR(rocblas_handle_pool_acquire(pool, stream, &waited));
+                acquired = true;
+                CHECK_ROCBLAS_ERROR(rocblas_handle_pool_release(pool, waited));
+            });
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            EXPECT_FALSE(acquired);
+
+            CHECK_ROCBLAS_ERROR(rocblas_handle_pool_release(pool, handle));
+            waiter.join();
+            EXPECT_TRUE(acquired);
+            EXPECT_EQ(waited, handle);
+
+            CHECK_ROCBLAS_ERROR(rocblas_handle_pool_release(pool, other));
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle_pool(pool));
+            CHECK_HIP_ERROR(hipStreamDestroy(stream));
+        }
+    };
+
+    struct handle_pool : RocBLAS_Test<handle_pool, testing_handle_pool>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "handle_pool");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<handle_pool>(arg.name);
+        }
+    };
+
+    TEST_P(handle_pool, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_handle_pool<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(handle_pool)
+
+} // namespace
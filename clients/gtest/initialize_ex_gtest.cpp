@@ -0,0 +1,148 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include <cstring>
+#include <string>
+
+namespace
+{
+    // Initializing the current device for the datatype of the test leaves the current device
+    // unchanged, and initializing it again loads nothing
+    template <typename...>
+    struct testing_initialize_ex : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            const rocblas_datatype types[] = {arg.a_type, rocblas_datatype_i32_r};
+            double                 seconds = -1;
+            size_t                 bytes   = 1;
+
+            EXPECT_ROCBLAS_STATUS(rocblas_initialize_ex(1, types, -1, nullptr, nullptr),
+                                  rocblas_status_invalid_size);
+            EXPECT_ROCBLAS_STATUS(rocblas_initialize_ex(1, nullptr, 1, nullptr, nullptr),
+                                  rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(rocblas_initialize_ex(1, types, 2, nullptr, nullptr),
+                                  rocblas_status_invalid_value);
+
+            // No device selected
+            CHECK_ROCBLAS_ERROR(rocblas_initialize_ex(0, types, 1, &seconds, &bytes));
+            EXPECT_GE(seconds, 0.0);
+            EXPECT_EQ(bytes, 0u);
+
+            int device;
+            CHECK_HIP_ERROR(hipGetDevice(&device));
+            const uint64_t mask = uint64_t(1) << device;
+
+            seconds = -1;
+            CHECK_ROCBLAS_ERROR(rocblas_initialize_ex(mask, types, 1, &seconds, &bytes));
+            EXPECT_GE(seconds, 0.0);
+
+            int current;
+            CHECK_HIP_ERROR(hipGetDevice(&current));
+            EXPECT_EQ(current, device);
+
+            // Devices are only initialized once, whatever the datatypes requested
+            bytes = 1;
+            CHECK_ROCBLAS_ERROR(rocblas_initialize_ex(mask, types, 1, nullptr, &bytes));
+            EXPECT_EQ(bytes, 0u);
+            CHECK_ROCBLAS_ERROR(rocblas_initialize_ex(mask, nullptr, 0, nullptr, nullptr));
+
+            // Bits of devices which do not exist are ignored
+            int count;
+            CHECK_HIP_ERROR(hipGetDeviceCount(&count));
+            if(count < 64)
+            {
+                bytes = 1;
+                CHECK_ROCBLAS_ERROR(
+                    rocblas_initialize_ex(~uint64_t(0) << count, types, 1, nullptr, &bytes));
+                EXPECT_EQ(bytes, 0u);
+            }
+
+            // GEMM runs on the initialized device
+            rocblas_local_handle handle{arg};
+            const rocblas_int    N     = arg.N;
+            const float          alpha = 1, beta = 0;
+            host_vector<float>   hA(size_t(N) * N), hC(size_t(N) * N);
+            for(size_t i = 0; i < hA.size(); i++)
+                hA[i] = i % (N + 1) ? 0.0f : 1.0f;
+
+            device_vector<float> dA(size_t(N) * N), dC(size_t(N) * N);
+            CHECK_DEVICE_ALLOCATION(dA.memcheck());
+            CHECK_DEVICE_ALLOCATION(dC.memcheck());
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+            CHECK_ROCBLAS_ERROR(rocblas_sgemm(handle,
+                                              rocblas_operation_none,
+                                              rocblas_operation_none,
+                                              N,
+                                              N,
+                                              N,
+                                              &alpha,
+                                              dA,
+                                              N,
+                                              dA,
+                                              N,
+                                              &beta,
+                                              dC,
+                                              N));
+            CHECK_HIP_ERROR(hC.transfer_from(dC));
+            unit_check_general<float>(N, N, N, hA, hC);
+        }
+    };
+
+    struct initialize_ex : RocBLAS_Test<initialize_ex, testing_initialize_ex>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "initialize_ex");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<initialize_ex> name(arg.name);
+            name << rocblas_datatype2string(arg.a_type) << '_' << arg.N;
+            return std::move(name);
+        }
+    };
+
+    TEST_P(initialize_ex, auxiliary_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_initialize_ex<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(initialize_ex)
+
+} // namespace
@@ -0,0 +1,247 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace
+{
+    // Invalid arguments, and plans ended without being begun or begun twice
+    template <typename...>
+    struct testing_plan : rocblas_test_valid
+    {
+        void operator()(const Arguments&)
+        {
+            rocblas_handle handle;
+            rocblas_plan   plan = nullptr;
+            CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+
+            hipStream_t stream, handle_stream = nullptr;
+            CHECK_HIP_ERROR(hipStreamCreate(&stream));
+            CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, stream));
+
+            EXPECT_ROCBLAS_STATUS(rocblas_plan_begin(nullptr, 0), rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_plan_end(nullptr, &plan), rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_plan_end(handle, nullptr),
+                                  rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(rocblas_plan_end(handle, &plan), rocblas_status_invalid_value);
+            EXPECT_ROCBLAS_STATUS(rocblas_plan_launch(nullptr, stream),
+                                  rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(rocblas_plan_destroy(nullptr), rocblas_status_success);
+
+            // One plan is recorded at a time, on its own stream
+            CHECK_ROCBLAS_ERROR(rocblas_plan_begin(handle, 0));
+            EXPECT_ROCBLAS_STATUS(rocblas_plan_begin(handle, 0), rocblas_status_invalid_value);
+            CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &handle_stream));
+            EXPECT_NE(handle_stream, stream);
+
+            // An empty plan can be launched, and the stream of the handle is restored
+            CHECK_ROCBLAS_ERROR(rocblas_plan_end(handle, &plan));
+            CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &handle_stream));
+            EXPECT_EQ(handle_stream, stream);
+            EXPECT_ROCBLAS_STATUS(rocblas_plan_end(handle, &plan), rocblas_status_invalid_value);
+            CHECK_ROCBLAS_ERROR(rocblas_plan_launch(plan, stream));
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+            CHECK_ROCBLAS_ERROR(rocblas_plan_destroy(plan));
+
+            // A plan still being recorded is abandoned when its handle is destroyed
+            CHECK_ROCBLAS_ERROR(rocblas_plan_begin(handle, 0));
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+            CHECK_HIP_ERROR(hipStreamDestroy(stream));
+        }
+    };
+
+    // Chains launched from a plan compute what the calls do when they are not recorded
+    template <typename...>
+    struct testing_plan_chain : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            rocblas_int M = arg.M, N = arg.N, K = arg.K;
+            if(M <= 0 || N <= 0 || K <= 0)
+                return;
+
+            rocblas_handle handle;
+            CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+            hipStream_t stream;
+            CHECK_HIP_ERROR(hipStreamCreate(&stream));
+            CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, stream));
+
+            // Small integers, so that the results are exact whatever the order of the sums
+            size_t             size_A = size_t(M) * K, size_B = size_t(K) * N;
+            size_t             size_C = size_t(M) * N;
+            host_vector<float> hA(size_A), hB(size_B), hC(size_C), hD(size_C);
+            host_vector<float> hC_plan(size_C), hD_plan(size_C), hC_gold(size_C), hD_gold(size_C);
+            for(size_t i = 0; i < size_A; i++)
+                hA[i] = float(i % 3) - 1.0f;
+            for(size_t i = 0; i < size_B; i++)
+                hB[i] = float(i % 4);
+            for(size_t i = 0; i < size_C; i++)
+            {
+                hC[i] = float(i % 5);
+                hD[i] = float(i % 7) - 3.0f;
+            }
+
+            device_vector<float> dA(size_A), dB(size_B), dC(size_C), dD(size_C), dScalars(3);
+            CHECK_DEVICE_ALLOCATION(dA.memcheck());
+            CHECK_DEVICE_ALLOCATION(dB.memcheck());
+            CHECK_DEVICE_ALLOCATION(dC.memcheck());
+            CHECK_DEVICE_ALLOCATION(dD.memcheck());
+            CHECK_DEVICE_ALLOCATION(dScalars.memcheck());
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+            CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+            // C = alpha A B + beta C with scalars in device memory, then D = D + gamma C with a
+            // scalar on the host, which is fixed in the plan
+            float gamma = 2.0f;
+            auto  chain = [&]() {
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+                CHECK_ROCBLAS_ERROR(rocblas_sgemm(handle,
+                                                  rocblas_operation_none,
+                                                  rocblas_operation_none,
+                                                  M,
+                                                  N,
+                                                  K,
+                                                  dScalars,
+                                                  dA,
+                                                  M,
+                                                  dB,
+                                                  K,
+                                                  (float*)dScalars + 1,
+                                                  dC,
+                                                  M));
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+                CHECK_ROCBLAS_ERROR(rocblas_saxpy(handle, M * N, &gamma, dC, 1, dD, 1));
+            };
+            auto reset = [&](float alpha, float beta) {
+                float scalars[3] = {alpha, beta, 0.0f};
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dScalars, scalars, sizeof(scalars), hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(dC.transfer_from(hC));
+                CHECK_HIP_ERROR(dD.transfer_from(hD));
+            };
+
+            CHECK_ROCBLAS_ERROR(rocblas_plan_begin(handle, 0));
+            chain();
+            rocblas_plan plan = nullptr;
+            CHECK_ROCBLAS_ERROR(rocblas_plan_end(handle, &plan));
+
+            // New scalars in device memory are read when the plan runs, and the host scalar is
+            // the one it was recorded with
+            const float scalars[][2] = {{1.0f, 0.0f}, {2.0f, -1.0f}, {-1.0f, 3.0f}};
+            for(auto& alpha_beta : scalars)
+            {
+                reset(alpha_beta[0], alpha_beta[1]);
+                gamma = 2.0f;
+                chain();
+                CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+                CHECK_HIP_ERROR(hC_gold.transfer_from(dC));
+                CHECK_HIP_ERROR(hD_gold.transfer_from(dD));
+
+                reset(alpha_beta[0], alpha_beta[1]);
+                gamma = 5.0f;
+                CHECK_ROCBLAS_ERROR(rocblas_plan_launch(plan, stream));
+                CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+                CHECK_HIP_ERROR(hC_plan.transfer_from(dC));
+                CHECK_HIP_ERROR(hD_plan.transfer_from(dD));
+
+                unit_check_general<float>(M, N, M, hC_gold, hC_plan);
+                unit_check_general<float>(M, N, M, hD_gold, hD_plan);
+            }
+
+            // The plan owns its workspace and outlives the handle it was recorded with
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+            reset(scalars[1][0], scalars[1][1]);
+            CHECK_ROCBLAS_ERROR(rocblas_plan_launch(plan, stream));
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+            CHECK_HIP_ERROR(hC_plan.transfer_from(dC));
+            CHECK_HIP_ERROR(hD_plan.transfer_from(dD));
+
+            for(rocblas_int j = 0; j < N; j++)
+                for(rocblas_int i = 0; i < M; i++)
+                {
+                    float sum = 0;
+                    for(rocblas_int k = 0; k < K; k++)
+                        sum += hA[i + size_t(k) * M] * hB[k + size_t(j) * K];
+                    size_t ij   = i + size_t(j) * M;
+                    hC_gold[ij] = scalars[1][0] * sum + scalars[1][1] * hC[ij];
+                    hD_gold[ij] = hD[ij] + 2.0f * hC_gold[ij];
+                }
+            unit_check_general<float>(M, N, M, hC_gold, hC_plan);
+            unit_check_general<float>(M, N, M, hD_gold, hD_plan);
+
+            CHECK_ROCBLAS_ERROR(rocblas_plan_destroy(plan));
+            CHECK_HIP_ERROR(hipStreamDestroy(stream));
+        }
+    };
+
+    template <template <typename...> class TESTING>
+    struct plan_template : RocBLAS_Test<plan_template<TESTING>, TESTING>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            if(std::is_same_v<TESTING<>, testing_plan<>>)
+                return !strcmp(arg.function, "plan");
+            return !strcmp(arg.function, "plan_chain");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<plan_template> name(arg.name);
+            if(!std::is_same_v<TESTING<>, testing_plan<>>)
+                name << '_' << arg.M << '_' << arg.N << '_' << arg.K;
+            return std::move(name);
+        }
+    };
+
+    using plan = plan_template<testing_plan>;
+    TEST_P(plan, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_plan<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(plan)
+
+    using plan_chain = plan_template<testing_plan_chain>;
+    TEST_P(plan_chain, auxiliary_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_plan_chain<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(plan_chain)
+
+} // namespace
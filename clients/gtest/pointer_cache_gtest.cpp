@@ -0,0 +1,220 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace
+{
+    rocblas_handle_stats get_stats(rocblas_handle handle)
+    {
+        rocblas_handle_stats stats{};
+        CHECK_ROCBLAS_ERROR(rocblas_get_handle_stats(handle, &stats));
+        return stats;
+    }
+
+    // Pointers into memory classified before are hits, until the cache is cleared
+    template <typename...>
+    struct testing_pointer_cache : rocblas_test_valid
+    {
+        void operator()(const Arguments&)
+        {
+            rocblas_handle handle;
+            CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+            CHECK_ROCBLAS_ERROR(rocblas_reset_handle_stats(handle));
+
+            device_vector<float> dx(1024);
+            host_vector<float>   hx(16);
+            CHECK_DEVICE_ALLOCATION(dx.memcheck());
+            float* d = dx;
+            float* h = hx;
+
+            rocblas_pointer_mode mode;
+            auto                 classify = [&](const void* ptr,
+                                rocblas_pointer_mode       expected,
+                                uint64_t                   hits,
+                                uint64_t                   misses) {
+                CHECK_ROCBLAS_ERROR(rocblas_pointer_to_mode_cached(handle, ptr, &mode));
+                EXPECT_EQ(mode, expected);
+                auto stats = get_stats(handle);
+                EXPECT_EQ(stats.pointer_cache_hits, hits);
+                EXPECT_EQ(stats.pointer_cache_misses, misses);
+            };
+
+            // a miss caches the whole device allocation, and the page of a host pointer
+            classify(d, rocblas_pointer_mode_device, 0, 1);
+            classify(d + 1000, rocblas_pointer_mode_device, 1, 1);
+            classify(h, rocblas_pointer_mode_host, 1, 2);
+            classify(h + 1, rocblas_pointer_mode_host, 2, 2);
+            EXPECT_EQ(rocblas_pointer_to_mode(d), rocblas_pointer_mode_device);
+
+            // after clearing, the pointers are classified by the driver again
+            CHECK_ROCBLAS_ERROR(rocblas_clear_pointer_cache(handle));
+            classify(d + 1000, rocblas_pointer_mode_device, 2, 3);
+            classify(d, rocblas_pointer_mode_device, 3, 3);
+
+            EXPECT_ROCBLAS_STATUS(rocblas_pointer_to_mode_cached(nullptr, d, &mode),
+                                  rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_pointer_to_mode_cached(handle, d, nullptr),
+                                  rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(rocblas_clear_pointer_cache(nullptr),
+                                  rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_set_managed_prefetch(nullptr, true),
+                                  rocblas_status_invalid_handle);
+
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+        }
+    };
+
+    // A gemm on managed memory gives the same result with the prefetch, which classifies its
+    // operands through the cache when Tensile runs the gemm
+    template <typename...>
+    struct testing_managed_prefetch : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            rocblas_int M = arg.M, N = arg.N, K = arg.K;
+            if(M <= 0 || N <= 0 || K <= 0)
+                return;
+
+            int device, managed = 0;
+            CHECK_HIP_ERROR(hipGetDevice(&device));
+            CHECK_HIP_ERROR(
+                hipDeviceGetAttribute(&managed, hipDeviceAttributeManagedMemory, device));
+            if(!managed)
+                return;
+
+            rocblas_handle handle;
+            CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+
+            size_t size_A = size_t(M) * K, size_B = size_t(K) * N, size_C = size_t(M) * N;
+            float *A, *B, *C;
+            CHECK_HIP_ERROR(hipMallocManaged(&A, size_A * sizeof(float)));
+            CHECK_HIP_ERROR(hipMallocManaged(&B, size_B * sizeof(float)));
+            CHECK_HIP_ERROR(hipMallocManaged(&C, size_C * sizeof(float)));
+
+            // Entries of 0 and 1, so that the products are exact
+            for(size_t i = 0; i < size_A; i++)
+                A[i] = i % 3 == 0 ? 1.0f : 0.0f;
+            for(size_t i = 0; i < size_B; i++)
+                B[i] = i % 5 == 0 ? 1.0f : 0.0f;
+
+            host_vector<float> hC_gold(size_C);
+            for(rocblas_int j = 0; j < N; j++)
+                for(rocblas_int i = 0; i < M; i++)
+                {
+                    float sum = 0;
+                    for(rocblas_int k = 0; k < K; k++)
+                        sum += A[i + size_t(k) * M] * B[k + size_t(j) * K];
+                    hC_gold[i + size_t(j) * M] = sum;
+                }
+
+            hipStream_t stream;
+            CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+            float alpha = 1.0f, beta = 0.0f;
+            for(bool prefetch : {false, true, true})
+            {
+                CHECK_ROCBLAS_ERROR(rocblas_set_managed_prefetch(handle, prefetch));
+                CHECK_ROCBLAS_ERROR(rocblas_reset_handle_stats(handle));
+                memset(C, 0, size_C * sizeof(float));
+
+                CHECK_ROCBLAS_ERROR(rocblas_sgemm(handle,
+                                                  rocblas_operation_none,
+                                                  rocblas_operation_none,
+                                                  M,
+                                                  N,
+                                                  K,
+                                                  &alpha,
+                                                  A,
+                                                  M,
+                                                  B,
+                                                  K,
+                                                  &beta,
+                                                  C,
+                                                  M));
+                CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+                unit_check_general<float>(M, N, M, hC_gold, C);
+
+                auto stats = get_stats(handle);
+                if(!prefetch || stats.source_gemm_calls || stats.hipblaslt_gemm_calls)
+                    EXPECT_EQ(stats.pointer_cache_hits + stats.pointer_cache_misses, 0u);
+                else
+                    EXPECT_EQ(stats.pointer_cache_hits + stats.pointer_cache_misses, 3u);
+            }
+
+            CHECK_HIP_ERROR(hipFree(A));
+            CHECK_HIP_ERROR(hipFree(B));
+            CHECK_HIP_ERROR(hipFree(C));
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+        }
+    };
+
+    template <template <typename...> class TESTING>
+    struct pointer_cache_template : RocBLAS_Test<pointer_cache_template<TESTING>, TESTING>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            if(std::is_same_v<TESTING<>, testing_pointer_cache<>>)
+                return !strcmp(arg.function, "pointer_cache");
+            return !strcmp(arg.function, "managed_prefetch");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<pointer_cache_template> name(arg.name);
+            if(!std::is_same_v<TESTING<>, testing_pointer_cache<>>)
+                name << '_' << arg.M << '_' << arg.N << '_' << arg.K;
+            return std::move(name);
+        }
+    };
+
+    using pointer_cache = pointer_cache_template<testing_pointer_cache>;
+    TEST_P(pointer_cache, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_pointer_cache<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(pointer_cache)
+
+    using managed_prefetch = pointer_cache_template<testing_managed_prefetch>;
+    TEST_P(managed_prefetch, auxiliary_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_managed_prefetch<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(managed_prefetch)
+
+} // namespace
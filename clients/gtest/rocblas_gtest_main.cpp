@@ -20,7 +20,17 @@
  *
  * ************************************************************************ */
 
+#include <fstream>
+#include <iterator>
+#include <sstream>
 #include <string>
+#include <vector>
+#ifndef WIN32
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+extern char** environ;
+#endif
 
 #include "rocblas_data.hpp"
 #include "rocblas_parse_data.hpp"
@@ -279,6 +289,98 @@ static void rocblas_set_test_device()
     set_device(device_id);
 }
 
+#ifndef WIN32
+// Number of device workers set by ROCBLAS_TEST_PARALLEL_DEVICES, a count or "all"
+static int rocblas_parallel_devices()
+{
+    const char* env = getenv("ROCBLAS_TEST_PARALLEL_DEVICES");
+    if(!env || !*env || getenv("ROCBLAS_TEST_SHARD"))
+        return 1;
+
+    int device_count = 0;
+    if(hipGetDeviceCount(&device_count) != hipSuccess || device_count < 1)
+        return 1;
+    int workers = strcmp(env, "all") ? atoi(env) : device_count;
+    return std::max(std::min(workers, device_count), 1);
+}
+
+// Runs the cases in one worker process per device, each running the cases assigned to it by
+// rocblas_client_shard_filter() on its own device, and prints their output in turn as they end.
+// Worker 0 sees all devices and runs the cases needing several.
+static int rocblas_run_device_workers(int workers, char** argv)
+{
+    // The device IDs visible to this process are the ones of the workers
+    std::vector<std::string> visible;
+    if(const char* env = getenv("HIP_VISIBLE_DEVICES"))
+    {
+        std::istringstream list(env);
+        for(std::string id; std::getline(list, id, ',');)
+            visible.push_back(id);
+    }
+    if(visible.size() < size_t(workers))
+        for(int i = visible.size(); i < workers; ++i)
+            visible.push_back(std::to_string(i));
+
+    const char* tmpdir = getenv("TMPDIR");
+    std::string logdir = tmpdir && *tmpdir ? tmpdir : "/tmp";
+
+    std::vector<pid_t>       pids(workers, -1);
+    std::vector<std::string> logs(workers);
+    for(int i = 0; i < workers; ++i)
+    {
+        std::vector<std::string> env;
+        for(char** e = environ; *e; ++e)
+            if(strncmp(*e, "ROCBLAS_TEST_SHARD=", 19)
+               && (i == 0 || strncmp(*e, "HIP_VISIBLE_DEVICES=", 20)))
+                env.push_back(*e);
+        env.push_back("ROCBLAS_TEST_SHARD=" + std::to_string(i) + "/" + std::to_string(workers));
+        if(i > 0)
+            env.push_back("HIP_VISIBLE_DEVICES=" + visible[i]);
+
+        std::vector<char*> envp;
+        for(auto& e : env)
+            envp.push_back(&e[0]);
+        envp.push_back(nullptr);
+
+        std::string log = logdir + "/rocblas-test-device" + std::to_string(i) + "-XXXXXX";
+        int         fd  = mkstemp(&log[0]);
+        if(fd < 0)
+        {
+            rocblas_cerr << "Error: cannot create the log of device worker " << i << std::endl;
+            continue;
+        }
+        logs[i] = log;
+
+        posix_spawn_file_actions_t actions;
+        posix_spawn_file_actions_init(&actions);
+        posix_spawn_file_actions_adddup2(&actions, fd, STDOUT_FILENO);
+        posix_spawn_file_actions_adddup2(&actions, fd, STDERR_FILENO);
+        posix_spawn_file_actions_addclose(&actions, fd);
+        if(posix_spawnp(&pids[i], argv[0], &actions, nullptr, argv, envp.data()))
+            pids[i] = -1;
+        posix_spawn_file_actions_destroy(&actions);
+        close(fd);
+    }
+
+    int status = EXIT_SUCCESS;
+    for(int i = 0; i < workers; ++i)
+    {
+        int  wstatus = 0;
+        bool passed  = pids[i] >= 0 && waitpid(pids[i], &wstatus, 0) >= 0 && WIFEXITED(wstatus)
+                      && !WEXITSTATUS(wstatus);
+        if(!passed)
+            status = EXIT_FAILURE;
+
+        std::ifstream log(logs[i]);
+        rocblas_cout << std::string(std::istreambuf_iterator<char>(log), {}) << std::endl;
+        rocblas_cout << "rocblas-test INFO: device worker " << i << " of " << workers
+                     << (passed ? " passed" : " failed") << std::endl;
+        unlink(logs[i].c_str());
+    }
+    return status;
+}
+#endif
+
 /*****************
  * Main function *
  *****************/
@@ -305,6 +407,19 @@ int main(int argc, char** argv)
     // Warn users if using older reference library
     print_reference_lib_warning();
 
+#ifndef WIN32
+    // Run the cases on all devices at once when ROCBLAS_TEST_PARALLEL_DEVICES is set
+    int workers = rocblas_parallel_devices();
+    if(workers > 1)
+    {
+        rocblas_cout << "rocblas-test INFO: running the cases on " << workers << " devices"
+                     << std::endl;
+        int status = rocblas_run_device_workers(workers, argv);
+        rocblas_print_args(args);
+        return status;
+    }
+#endif
+
     // Set test device
     rocblas_set_test_device();
 
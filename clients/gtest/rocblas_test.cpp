@@ -22,10 +22,12 @@
 
 #include "rocblas_test.hpp"
 #include "client_utility.hpp"
+#include "flops.hpp"
 
 #include <cstdlib>
 #include <exception>
 #include <regex>
+#include <set>
 #ifdef WIN32
 #include <windows.h>
 #define strcasecmp(A, B) _stricmp(A, B)
@@ -232,6 +234,98 @@ bool rocblas_client_global_filters(const Arguments& args)
     return true;
 }
 
+/*********************************************
+ * device worker sharding functions
+ *********************************************/
+// Estimated cost of a case in GFLOP, the flops of its operation plus a fixed cost of its setup
+static double rocblas_client_case_cost(const Arguments& arg)
+{
+    static const std::set<std::string> level1{"asum",
+                                              "axpy",
+                                              "copy",
+                                              "dot",
+                                              "dotc",
+                                              "iamax",
+                                              "iamin",
+                                              "nrm2",
+                                              "rot",
+                                              "rotg",
+                                              "rotm",
+                                              "rotmg",
+                                              "scal",
+                                              "swap"};
+    static const std::set<std::string> level3{"gemm",
+                                              "gemmt",
+                                              "symm",
+                                              "hemm",
+                                              "syrk",
+                                              "herk",
+                                              "syr2k",
+                                              "her2k",
+                                              "syrkx",
+                                              "herkx",
+                                              "trmm",
+                                              "trsm",
+                                              "trtri",
+                                              "dgmm",
+                                              "geam"};
+
+    // Strip the precision prefix of the legacy names and the variant suffixes
+    std::string name = arg.function;
+    for(const char* suffix : {"_64", "_ex", "_strided_batched", "_batched"})
+    {
+        size_t len = strlen(suffix);
+        if(name.size() > len && !name.compare(name.size() - len, len, suffix))
+            name.erase(name.size() - len);
+    }
+    if(!level1.count(name) && !level3.count(name) && name.size() > 1
+       && (level1.count(name.substr(1)) || level3.count(name.substr(1))))
+        name.erase(0, 1);
+
+    int64_t M     = std::max<int64_t>(arg.M, 1);
+    int64_t N     = std::max<int64_t>(arg.N, 1);
+    int64_t K     = std::max<int64_t>(arg.K, 1);
+    int64_t batch = std::max<int64_t>(arg.batch_count, 1);
+
+    double gflop;
+    if(level1.count(name))
+        gflop = axpy_gflop_count<float>(N);
+    else if(level3.count(name))
+        gflop = gemm_gflop_count<float>(M, N, K);
+    else
+        gflop = gemv_gflop_count<float>(rocblas_operation_none, M, N);
+
+    // The host reference, the initialization and the checks scale with the flops as well
+    return 1e-3 + gflop * batch;
+}
+
+bool rocblas_client_shard_filter(const Arguments& args)
+{
+    // ROCBLAS_TEST_SHARD=<index>/<count> is set by rocblas-test for its device workers
+    static const auto shard = [] {
+        int         index = 0, count = 1;
+        const char* env   = getenv("ROCBLAS_TEST_SHARD");
+        if(!env || sscanf(env, "%d/%d", &index, &count) != 2 || index < 0 || index >= count)
+            index = 0, count = 1;
+        return std::make_pair(index, count);
+    }();
+    static std::vector<double> load(shard.second);
+
+    if(shard.second == 1)
+        return true;
+
+    // Every worker generates the same cases in the same order, so each assigns a case to the
+    // same worker, the least loaded so far. The cases needing several devices go to worker 0,
+    // which sees all devices.
+    int worker = 0;
+    if(args.devices <= 1)
+        for(int i = 1; i < shard.second; ++i)
+            if(load[i] < load[worker])
+                worker = i;
+    load[worker] += rocblas_client_case_cost(args);
+    return worker == shard.first;
+}
+
 /********************************************************************************************
  * Function which matches Arguments with a category, accounting for arg.known_bug_platforms *
  ********************************************************************************************/
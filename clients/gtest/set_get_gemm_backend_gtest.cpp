@@ -0,0 +1,213 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#ifndef WIN32
+#include <dlfcn.h>
+#endif
+
+namespace
+{
+    // Whether the libhipblaslt which rocBLAS would dlopen can be loaded
+    bool hipblaslt_loadable()
+    {
+#ifndef WIN32
+        void* lib = dlopen("libhipblaslt.so", RTLD_NOW | RTLD_LOCAL);
+        if(!lib)
+            lib = dlopen("libhipblaslt.so.0", RTLD_NOW | RTLD_LOCAL);
+        if(lib)
+            dlclose(lib);
+        return lib != nullptr;
+#else
+        return false;
+#endif
+    }
+
+    template <typename...>
+    struct testing_set_get_gemm_backend : rocblas_test_valid
+    {
+        void operator()(const Arguments&)
+        {
+            rocblas_handle handle;
+            CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+
+            // Make sure set()/get() functions work, whether hipBLASLt can be loaded or not
+            rocblas_gemm_backend backend = rocblas_gemm_backend_tensile;
+            for(auto mode : {rocblas_gemm_backend_hipblaslt,
+                             rocblas_gemm_backend_auto,
+                             rocblas_gemm_backend_tensile})
+            {
+                CHECK_ROCBLAS_ERROR(rocblas_set_gemm_backend(handle, mode));
+                CHECK_ROCBLAS_ERROR(rocblas_get_gemm_backend(handle, &backend));
+                EXPECT_EQ(mode, backend);
+            }
+
+            // An invalid backend is rejected and leaves the backend unchanged
+            EXPECT_ROCBLAS_STATUS(rocblas_set_gemm_backend(handle, rocblas_gemm_backend(3)),
+                                  rocblas_status_invalid_value);
+            CHECK_ROCBLAS_ERROR(rocblas_get_gemm_backend(handle, &backend));
+            EXPECT_EQ(rocblas_gemm_backend_tensile, backend);
+
+            EXPECT_ROCBLAS_STATUS(rocblas_set_gemm_backend(nullptr, rocblas_gemm_backend_tensile),
+                                  rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_get_gemm_backend(nullptr, &backend),
+                                  rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(rocblas_get_gemm_backend(handle, nullptr),
+                                  rocblas_status_invalid_pointer);
+
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+        }
+    };
+
+    // A gemm_ex which hipBLASLt may run gives the result of Tensile with every backend, and
+    // is run by Tensile when hipBLASLt cannot be loaded
+    template <typename...>
+    struct testing_gemm_backend : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            rocblas_int M = arg.M, N = arg.N, K = arg.K;
+            if(M <= 0 || N <= 0 || K <= 0)
+                return;
+
+            rocblas_handle handle;
+            CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+
+            // Entries of 0 and 1 with K <= 2048, so that every sum is exact in f16
+            size_t                   size_A = size_t(M) * K, size_B = size_t(K) * N;
+            size_t                   size_C = size_t(M) * N;
+            host_vector<rocblas_half> hA(size_A), hB(size_B), hC(size_C), hC_gold(size_C);
+            for(size_t i = 0; i < size_A; i++)
+                hA[i] = rocblas_half(i % 3 == 0 ? 1.0f : 0.0f);
+            for(size_t i = 0; i < size_B; i++)
+                hB[i] = rocblas_half(i % 5 == 0 ? 1.0f : 0.0f);
+
+            device_vector<rocblas_half> dA(size_A), dB(size_B), dC(size_C);
+            CHECK_DEVICE_ALLOCATION(dA.memcheck());
+            CHECK_DEVICE_ALLOCATION(dB.memcheck());
+            CHECK_DEVICE_ALLOCATION(dC.memcheck());
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+            CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+            float alpha = 1.0f, beta = 0.0f;
+            auto  gemm  = [&](rocblas_gemm_backend backend) {
+                CHECK_ROCBLAS_ERROR(rocblas_set_gemm_backend(handle, backend));
+                CHECK_HIP_ERROR(hipMemset(dC, 0, size_C * sizeof(rocblas_half)));
+                CHECK_ROCBLAS_ERROR(rocblas_gemm_ex(handle,
+                                                    rocblas_operation_none,
+                                                    rocblas_operation_none,
+                                                    M,
+                                                    N,
+                                                    K,
+                                                    &alpha,
+                                                    dA,
+                                                    rocblas_datatype_f16_r,
+                                                    M,
+                                                    dB,
+                                                    rocblas_datatype_f16_r,
+                                                    K,
+                                                    &beta,
+                                                    dC,
+                                                    rocblas_datatype_f16_r,
+                                                    M,
+                                                    dC,
+                                                    rocblas_datatype_f16_r,
+                                                    M,
+                                                    rocblas_datatype_f32_r,
+                                                    rocblas_gemm_algo_standard,
+                                                    0,
+                                                    0));
+            };
+
+            gemm(rocblas_gemm_backend_tensile);
+            CHECK_HIP_ERROR(hC_gold.transfer_from(dC));
+
+            bool lt_loadable = hipblaslt_loadable();
+            for(auto backend : {rocblas_gemm_backend_hipblaslt, rocblas_gemm_backend_auto})
+            {
+                CHECK_ROCBLAS_ERROR(rocblas_reset_handle_stats(handle));
+                gemm(backend);
+                CHECK_HIP_ERROR(hC.transfer_from(dC));
+                unit_check_general<rocblas_half>(M, N, M, hC_gold, hC);
+
+                rocblas_handle_stats stats;
+                CHECK_ROCBLAS_ERROR(rocblas_get_handle_stats(handle, &stats));
+                if(!lt_loadable)
+                    EXPECT_EQ(stats.hipblaslt_gemm_calls, 0u);
+            }
+
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+        }
+    };
+
+    template <template <typename...> class TESTING>
+    struct gemm_backend_template : RocBLAS_Test<gemm_backend_template<TESTING>, TESTING>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            if(std::is_same_v<TESTING<>, testing_set_get_gemm_backend<>>)
+                return !strcmp(arg.function, "set_get_gemm_backend");
+            return !strcmp(arg.function, "gemm_backend");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<gemm_backend_template> name(arg.name);
+            if(!std::is_same_v<TESTING<>, testing_set_get_gemm_backend<>>)
+                name << '_' << arg.M << '_' << arg.N << '_' << arg.K;
+            return std::move(name);
+        }
+    };
+
+    using set_get_gemm_backend = gemm_backend_template<testing_set_get_gemm_backend>;
+    TEST_P(set_get_gemm_backend, auxiliary_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_set_get_gemm_backend<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(set_get_gemm_backend)
+
+    using gemm_backend = gemm_backend_template<testing_gemm_backend>;
+    TEST_P(gemm_backend, auxiliary_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_gemm_backend<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_backend)
+
+} // namespace
@@ -22,6 +22,7 @@
 
 #include "rocblas_data.hpp"
 #include "rocblas_datatype2string.hpp"
+#include "testing_copy_matrix_peer.hpp"
 #include "testing_set_get_matrix.hpp"
 #include "testing_set_get_matrix_async.hpp"
 #include "type_dispatch.hpp"
@@ -34,6 +35,7 @@ namespace
     {
         SET_GET_MATRIX,
         SET_GET_MATRIX_ASYNC,
+        COPY_MATRIX_PEER,
     };
 
     template <template <typename...> class FILTER, sync_type TRANSFER_TYPE>
@@ -56,6 +58,9 @@ namespace
                 return !strcmp(arg.function, "set_get_matrix");
             case SET_GET_MATRIX_ASYNC:
                 return !strcmp(arg.function, "set_get_matrix_async");
+            case COPY_MATRIX_PEER:
+                return !strcmp(arg.function, "copy_matrix_peer")
+                       || !strcmp(arg.function, "copy_matrix_peer_strided_batched");
             }
             return false;
         }
@@ -76,6 +81,11 @@ namespace
                 name << arg.M << '_' << arg.N << '_' << arg.lda << '_' << arg.ldb << '_' << arg.ldd;
             }
 
+            if(strstr(arg.function, "_strided_batched") != nullptr)
+            {
+                name << '_' << arg.stride_a << '_' << arg.stride_b << '_' << arg.batch_count;
+            }
+
             if(arg.api & c_API_64)
             {
                 name << "_I64";
@@ -108,6 +118,9 @@ namespace
                 testing_set_get_matrix<T>(arg);
             else if(!strcmp(arg.function, "set_get_matrix_async"))
                 testing_set_get_matrix_async<T>(arg);
+            else if(!strcmp(arg.function, "copy_matrix_peer")
+                    || !strcmp(arg.function, "copy_matrix_peer_strided_batched"))
+                testing_copy_matrix_peer<T>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -130,4 +143,12 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(set_get_matrix_async);
 
+    using copy_matrix_peer = matrix_set_get_template<set_get_matrix_testing, COPY_MATRIX_PEER>;
+    TEST_P(copy_matrix_peer, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<set_get_matrix_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(copy_matrix_peer);
+
 } // namespace
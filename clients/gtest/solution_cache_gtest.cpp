@@ -0,0 +1,154 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include <cstring>
+#include <string>
+
+namespace
+{
+    // A problem seen before finds its solution in the solution selection cache of the device,
+    // and computes the same result as when the solution was selected
+    template <typename...>
+    struct testing_solution_cache : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            size_t hits = 0, misses = 0;
+            EXPECT_ROCBLAS_STATUS(rocblas_get_solution_cache_stats(nullptr, &hits, &misses),
+                                  rocblas_status_invalid_handle);
+
+            rocblas_local_handle handle{arg};
+            EXPECT_ROCBLAS_STATUS(rocblas_get_solution_cache_stats(handle, nullptr, nullptr),
+                                  rocblas_status_invalid_pointer);
+            CHECK_ROCBLAS_ERROR(rocblas_get_solution_cache_stats(handle, &hits, nullptr));
+            CHECK_ROCBLAS_ERROR(rocblas_get_solution_cache_stats(handle, nullptr, &misses));
+
+            // The cache is in front of the Tensile solution selection
+            CHECK_ROCBLAS_ERROR(rocblas_set_gemm_backend(handle, rocblas_gemm_backend_tensile));
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            const rocblas_int M     = arg.M;
+            const rocblas_int N     = arg.N;
+            const rocblas_int K     = arg.K;
+            const float       alpha = arg.get_alpha<float>();
+            const float       beta  = arg.get_beta<float>();
+
+            host_vector<float> hA(size_t(M) * K), hB(size_t(K) * N), hC(size_t(M) * N);
+            host_vector<float> hC_1(size_t(M) * N), hC_2(size_t(M) * N);
+            rocblas_seedrand();
+            rocblas_init<float>(hA, M, K, M);
+            rocblas_init<float>(hB, K, N, K);
+            rocblas_init<float>(hC, M, N, M);
+
+            device_vector<float> dA(size_t(M) * K), dB(size_t(K) * N), dC(size_t(M) * N);
+            CHECK_DEVICE_ALLOCATION(dA.memcheck());
+            CHECK_DEVICE_ALLOCATION(dB.memcheck());
+            CHECK_DEVICE_ALLOCATION(dC.memcheck());
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+            CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+            auto sgemm = [&](host_vector<float>& result) {
+                CHECK_HIP_ERROR(dC.transfer_from(hC));
+                CHECK_ROCBLAS_ERROR(rocblas_sgemm(handle,
+                                                  rocblas_operation_none,
+                                                  rocblas_operation_none,
+                                                  M,
+                                                  N,
+                                                  K,
+                                                  &alpha,
+                                                  dA,
+                                                  M,
+                                                  dB,
+                                                  K,
+                                                  &beta,
+                                                  dC,
+                                                  M));
+                CHECK_HIP_ERROR(result.transfer_from(dC));
+            };
+
+            // Either the problem was seen earlier in the process or its solution is selected and
+            // cached now
+            size_t hits_0, misses_0, hits_1, misses_1, hits_2, misses_2;
+            CHECK_ROCBLAS_ERROR(rocblas_get_solution_cache_stats(handle, &hits_0, &misses_0));
+            sgemm(hC_1);
+            CHECK_ROCBLAS_ERROR(rocblas_get_solution_cache_stats(handle, &hits_1, &misses_1));
+            EXPECT_GE(hits_1, hits_0);
+            EXPECT_GE(misses_1, misses_0);
+            EXPECT_GT(hits_1 + misses_1, hits_0 + misses_0);
+
+            // Repeating it is a hit
+            sgemm(hC_2);
+            CHECK_ROCBLAS_ERROR(rocblas_get_solution_cache_stats(handle, &hits_2, &misses_2));
+            EXPECT_GT(hits_2, hits_1);
+            EXPECT_EQ(misses_2, misses_1);
+
+            unit_check_general<float>(M, N, M, hC_1, hC_2);
+
+            // The cache is per device, so another handle on it sees the same counters
+            rocblas_handle other;
+            CHECK_ROCBLAS_ERROR(rocblas_create_handle(&other));
+            CHECK_ROCBLAS_ERROR(rocblas_get_solution_cache_stats(other, &hits, &misses));
+            EXPECT_EQ(hits, hits_2);
+            EXPECT_EQ(misses, misses_2);
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(other));
+        }
+    };
+
+    struct solution_cache : RocBLAS_Test<solution_cache, testing_solution_cache>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "solution_cache");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<solution_cache> name(arg.name);
+            name << '_' << arg.M << '_' << arg.N << '_' << arg.K << '_' << arg.alpha << '_'
+                 << arg.beta;
+            return std::move(name);
+        }
+    };
+
+    TEST_P(solution_cache, auxiliary_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_solution_cache<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(solution_cache)
+
+} // namespace
@@ -0,0 +1,121 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include <cstring>
+#include <string>
+
+namespace
+{
+    // The startup times cover the devices initialized so far, and are not changed by the calls
+    // made once the device is initialized
+    template <typename...>
+    struct testing_startup_times : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            EXPECT_ROCBLAS_STATUS(rocblas_get_startup_times(nullptr),
+                                  rocblas_status_invalid_pointer);
+
+            rocblas_initialize();
+
+            rocblas_startup_times times{};
+            CHECK_ROCBLAS_ERROR(rocblas_get_startup_times(&times));
+            EXPECT_GE(times.device_initializations, 1u);
+            EXPECT_GT(times.total_ns, 0u);
+            EXPECT_GE(times.total_ns, times.hardware_query_ns);
+            EXPECT_GE(times.total_ns, times.code_object_load_ns);
+            EXPECT_GE(times.total_ns, times.library_wait_ns);
+            EXPECT_GE(times.total_ns, times.solution_cache_seed_ns);
+
+            // a GEMM on the initialized device, which may load code objects lazily
+            rocblas_local_handle handle{arg};
+            const rocblas_int    N     = arg.N;
+            const float          alpha = 1;
+            const float          beta  = 0;
+
+            device_vector<float> dA(size_t(N) * N), dC(size_t(N) * N);
+            CHECK_DEVICE_ALLOCATION(dA.memcheck());
+            CHECK_DEVICE_ALLOCATION(dC.memcheck());
+            CHECK_HIP_ERROR(hipMemset(dA, 0, sizeof(float) * N * N));
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+            CHECK_ROCBLAS_ERROR(rocblas_sgemm(handle,
+                                              rocblas_operation_none,
+                                              rocblas_operation_none,
+                                              N,
+                                              N,
+                                              N,
+                                              &alpha,
+                                              dA,
+                                              N,
+                                              dA,
+                                              N,
+                                              &beta,
+                                              dC,
+                                              N));
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+            rocblas_startup_times later{};
+            CHECK_ROCBLAS_ERROR(rocblas_get_startup_times(&later));
+            EXPECT_EQ(later.device_initializations, times.device_initializations);
+            EXPECT_EQ(later.total_ns, times.total_ns);
+            EXPECT_EQ(later.code_object_load_ns, times.code_object_load_ns);
+            EXPECT_EQ(later.code_objects_loaded, times.code_objects_loaded);
+        }
+    };
+
+    struct startup_times : RocBLAS_Test<startup_times, testing_startup_times>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "startup_times");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<startup_times> name(arg.name);
+            name << '_' << arg.N;
+            return std::move(name);
+        }
+    };
+
+    TEST_P(startup_times, auxiliary_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_startup_times<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(startup_times)
+
+} // namespace
@@ -0,0 +1,170 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include <cmath>
+#include <cstring>
+#include <string>
+
+namespace
+{
+    uint64_t pool_attribute(hipMemPool_t pool, hipMemPoolAttr attr)
+    {
+        uint64_t value = 0;
+        CHECK_HIP_ERROR(hipMemPoolGetAttribute(pool, attr, &value));
+        return value;
+    }
+
+    // The workspace of a handle with stream-ordered allocation comes from the pool attached to
+    // it, which keeps up to its release threshold, and which the handle does not trim
+    template <typename...>
+    struct testing_stream_order_pool : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            EXPECT_ROCBLAS_STATUS(rocblas_set_stream_order_memory_pool(nullptr, nullptr, 0),
+                                  rocblas_status_invalid_handle);
+
+            int device, pools_supported = 0;
+            CHECK_HIP_ERROR(hipGetDevice(&device));
+            CHECK_HIP_ERROR(hipDeviceGetAttribute(
+                &pools_supported, hipDeviceAttributeMemoryPoolsSupported, device));
+
+            rocblas_handle handle;
+            CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+            if(!pools_supported
+               || rocblas_set_stream_order_memory_pool(handle, nullptr, 0)
+                      == rocblas_status_not_implemented)
+            {
+                CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+                GTEST_SKIP() << "stream-ordered memory pools are not supported";
+                return;
+            }
+
+            hipMemPoolProps props{};
+            props.allocType     = hipMemAllocationTypePinned;
+            props.location.type = hipMemLocationTypeDevice;
+            props.location.id   = device;
+            hipMemPool_t pool;
+            CHECK_HIP_ERROR(hipMemPoolCreate(&pool, &props));
+
+            // A nonzero threshold is set on the pool, and 0 leaves it as it is
+            const uint64_t threshold = uint64_t(64) << 20;
+            CHECK_ROCBLAS_ERROR(rocblas_set_stream_order_memory_pool(handle, pool, threshold));
+            EXPECT_EQ(pool_attribute(pool, hipMemPoolAttrReleaseThreshold), threshold);
+            CHECK_ROCBLAS_ERROR(rocblas_set_stream_order_memory_pool(handle, pool, 0));
+            EXPECT_EQ(pool_attribute(pool, hipMemPoolAttrReleaseThreshold), threshold);
+
+            // Without a pool, the threshold goes to the default pool of the device
+            hipMemPool_t default_pool;
+            CHECK_HIP_ERROR(hipDeviceGetDefaultMemPool(&default_pool, device));
+            uint64_t default_threshold
+                = pool_attribute(default_pool, hipMemPoolAttrReleaseThreshold);
+            CHECK_ROCBLAS_ERROR(
+                rocblas_set_stream_order_memory_pool(handle, nullptr, default_threshold + 4096));
+            EXPECT_EQ(pool_attribute(default_pool, hipMemPoolAttrReleaseThreshold),
+                      default_threshold + 4096);
+            CHECK_HIP_ERROR(hipMemPoolSetAttribute(
+                default_pool, hipMemPoolAttrReleaseThreshold, &default_threshold));
+
+            // The norms of many batches of a column, with a stride of 0, need a workspace larger
+            // than the reduction workspace kept by the handle
+            const rocblas_int  n = arg.N, batch_count = arg.batch_count;
+            host_vector<float> hx(n), h_norms(batch_count), h_gold(batch_count);
+            for(auto& x : hx)
+                x = 1;
+            for(auto& r : h_gold)
+                r = std::sqrt(float(n));
+
+            device_vector<float> dx(n), d_norms(batch_count);
+            CHECK_DEVICE_ALLOCATION(dx.memcheck());
+            CHECK_DEVICE_ALLOCATION(d_norms.memcheck());
+            CHECK_HIP_ERROR(dx.transfer_from(hx));
+
+            size_t workspace = 0;
+            CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+            CHECK_ALLOC_QUERY(
+                rocblas_snrm2_strided_batched(handle, n, nullptr, 1, 0, batch_count, nullptr));
+            CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &workspace));
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_stream_order_memory_pool(handle, pool, threshold));
+            handle->set_stream_order_memory_allocation(true);
+
+            hipStream_t stream;
+            CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+            CHECK_ROCBLAS_ERROR(
+                rocblas_snrm2_strided_batched(handle, n, dx, 1, 0, batch_count, d_norms));
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+            CHECK_HIP_ERROR(h_norms.transfer_from(d_norms));
+            unit_check_general<float>(1, batch_count, 1, h_gold, h_norms);
+
+            // The workspace was taken from the pool, and stays reserved below the threshold
+            EXPECT_GE(pool_attribute(pool, hipMemPoolAttrUsedMemHigh), workspace);
+            uint64_t reserved = pool_attribute(pool, hipMemPoolAttrReservedMemCurrent);
+            EXPECT_GE(reserved, workspace);
+
+            // The handle does not trim a pool it does not own
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+            EXPECT_EQ(pool_attribute(pool, hipMemPoolAttrReservedMemCurrent), reserved);
+
+            CHECK_HIP_ERROR(hipMemPoolTrimTo(pool, 0));
+            CHECK_HIP_ERROR(hipMemPoolDestroy(pool));
+        }
+    };
+
+    struct stream_order_pool : RocBLAS_Test<stream_order_pool, testing_stream_order_pool>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "stream_order_pool");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<stream_order_pool> name(arg.name);
+            name << '_' << arg.N << '_' << arg.batch_count;
+            return std::move(name);
+        }
+    };
+
+    TEST_P(stream_order_pool, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_stream_order_pool<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(stream_order_pool)
+
+} // namespace
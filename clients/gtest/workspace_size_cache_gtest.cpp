@@ -0,0 +1,207 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "../../library/src/include/rocblas_device_malloc.hpp"
+#include "client_utility.hpp"
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace
+{
+    uint64_t workspace_allocations(rocblas_handle handle)
+    {
+        rocblas_handle_stats stats{};
+        CHECK_ROCBLAS_ERROR(rocblas_get_handle_stats(handle, &stats));
+        return stats.workspace_allocations;
+    }
+
+    size_t cached_size(rocblas_handle handle)
+    {
+        size_t size = 0;
+        CHECK_ROCBLAS_ERROR(rocblas_get_cached_device_memory_size(handle, &size));
+        return size;
+    }
+
+    // The workspace requirements of size queries and real calls are memoized, the largest of
+    // them is reported, and the device memory grows to it so that known shapes do not reallocate
+    template <typename...>
+    struct testing_workspace_size_cache : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            size_t size = 0;
+            EXPECT_ROCBLAS_STATUS(rocblas_get_cached_device_memory_size(nullptr, &size),
+                                  rocblas_status_invalid_handle);
+
+            rocblas_handle handle;
+            CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+            EXPECT_ROCBLAS_STATUS(rocblas_get_cached_device_memory_size(handle, nullptr),
+                                  rocblas_status_invalid_pointer);
+            EXPECT_EQ(cached_size(handle), 0u);
+
+            const rocblas_int M = arg.M, N = arg.N, K = arg.K, big = 2 * arg.M;
+            const float       alpha = 1, beta = 0;
+
+            auto trsm = [&](rocblas_int m, const float* A, float* B) {
+                return rocblas_strsm(handle,
+                                     rocblas_side_left,
+                                     rocblas_fill_lower,
+                                     rocblas_operation_none,
+                                     rocblas_diagonal_non_unit,
+                                     m,
+                                     N,
+                                     &alpha,
+                                     A,
+                                     m,
+                                     B,
+                                     m);
+            };
+            // a high precision accumulation gemm_ex, whose workspace is that of Tensile
+            auto gemm = [&]() {
+                return rocblas_gemm_ex(handle,
+                                       rocblas_operation_none,
+                                       rocblas_operation_none,
+                                       M,
+                                       N,
+                                       K,
+                                       &alpha,
+                                       nullptr,
+                                       rocblas_datatype_f16_r,
+                                       M,
+                                       nullptr,
+                                       rocblas_datatype_f16_r,
+                                       K,
+                                       &beta,
+                                       nullptr,
+                                       rocblas_datatype_f16_r,
+                                       M,
+                                       nullptr,
+                                       rocblas_datatype_f16_r,
+                                       M,
+                                       rocblas_datatype_f32_r,
+                                       rocblas_gemm_algo_standard,
+                                       0,
+                                       0);
+            };
+            auto query = [&](auto&& call) {
+                size_t bytes = 0;
+                CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+                CHECK_ALLOC_QUERY(call());
+                CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &bytes));
+                return bytes;
+            };
+
+            // A size query is memoized, and a repeated query gives the same size
+            size_t small_size = query([&] { return trsm(M, nullptr, nullptr); });
+            EXPECT_EQ(cached_size(handle), small_size);
+            EXPECT_EQ(query([&] { return trsm(M, nullptr, nullptr); }), small_size);
+
+            size_t big_size = query([&] { return trsm(big, nullptr, nullptr); });
+            EXPECT_GE(big_size, small_size);
+            EXPECT_EQ(cached_size(handle), big_size);
+
+            size_t gemm_size = query(gemm);
+            EXPECT_EQ(query(gemm), gemm_size);
+
+            // The largest requirement is kept when smaller problems follow
+            size_t largest = std::max(big_size, gemm_size);
+            EXPECT_EQ(cached_size(handle), largest);
+            EXPECT_EQ(query([&] { return trsm(M, nullptr, nullptr); }), small_size);
+            EXPECT_EQ(cached_size(handle), largest);
+
+            // a well conditioned triangle for the real calls
+            host_vector<float> hA(size_t(big) * big), hB(size_t(big) * N);
+            rocblas_seedrand();
+            rocblas_init<float>(hA, big, big, big);
+            rocblas_init<float>(hB, big, N, big);
+            for(rocblas_int i = 0; i < big; i++)
+                hA[i + size_t(i) * big] = float(10 * big);
+
+            device_vector<float> dA(size_t(big) * big), dB(size_t(big) * N);
+            CHECK_DEVICE_ALLOCATION(dA.memcheck());
+            CHECK_DEVICE_ALLOCATION(dB.memcheck());
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+            CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+            // The first call allocates the default size, and the next reallocation grows it to
+            // the largest requirement
+            CHECK_ROCBLAS_ERROR(trsm(M, dA, dB));
+            CHECK_ROCBLAS_ERROR(rocblas_get_device_memory_size(handle, &size));
+            {
+                rocblas_device_malloc mem(handle, size + 1);
+                ASSERT_TRUE(bool(mem));
+            }
+            CHECK_ROCBLAS_ERROR(rocblas_get_device_memory_size(handle, &size));
+            EXPECT_GE(size, largest);
+
+            // Real calls of the shapes seen before then run without reallocating
+            uint64_t allocations = workspace_allocations(handle);
+            CHECK_ROCBLAS_ERROR(trsm(big, dA, dB));
+            CHECK_ROCBLAS_ERROR(trsm(M, dA, dB));
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+            EXPECT_EQ(workspace_allocations(handle), allocations);
+            EXPECT_EQ(cached_size(handle), largest);
+
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+        }
+    };
+
+    struct workspace_size_cache
+        : RocBLAS_Test<workspace_size_cache, testing_workspace_size_cache>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "workspace_size_cache");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<workspace_size_cache> name(arg.name);
+            name << '_' << arg.M << '_' << arg.N << '_' << arg.K;
+            return std::move(name);
+        }
+    };
+
+    TEST_P(workspace_size_cache, auxiliary_tensile)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_workspace_size_cache<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(workspace_size_cache)
+
+} // namespace
@@ -23,6 +23,7 @@
 #pragma once
 
 #include "rocblas_arguments.hpp"
+#include <vector>
 
 namespace ArgumentLogging
 {
@@ -38,6 +39,66 @@ bool ArgumentModel_get_log_datatype();
 void ArgumentModel_log_frequencies(rocblas_internal_ostream& name_line,
                                    rocblas_internal_ostream& val_line);
 
+// Device times of the timed iterations of the latest benchmark, in microseconds, which log_perf
+// summarizes after the mean time. They are cleared once they have been logged.
+void ArgumentModel_set_iteration_times(std::vector<double> times_us);
+
+void ArgumentModel_log_iteration_stats(rocblas_internal_ostream& name_line,
+                                       rocblas_internal_ostream& val_line);
+
+// Mean device time of the latest benchmark logged by this thread, in microseconds, or NA_value
+// if none was logged since it was last taken
+void   ArgumentModel_set_logged_time(double gpu_us);
+double ArgumentModel_take_logged_time();
+
+// Mean time of a graph replay of one call of the latest benchmark, in microseconds, which log_perf
+// reports after the mean time with the host overhead of a call it saves. It is cleared once it
+// has been logged.
+void ArgumentModel_set_graph_time(double graph_us);
+
+void ArgumentModel_log_graph_time(rocblas_internal_ostream& name_line,
+                                  rocblas_internal_ostream& val_line,
+                                  double                    gpu_us);
+
+// Peak GFLOP/s and GB/s of the device, which log_perf compares the throughput of each benchmark
+// with. With peak_sclk_mhz nonzero and the frequency monitor enabled, the peak GFLOP/s is scaled
+// by the SCLK measured during the benchmark. The roofline is not logged while both peaks are 0.
+void ArgumentModel_set_roofline(double peak_gflops, double peak_gbps, double peak_sclk_mhz);
+
+// Arithmetic intensity, percentages of the peaks and whether the benchmark is compute or memory
+// bound, from its GFLOP/s and GB/s, either of which may be NA_value
+void ArgumentModel_log_roofline(rocblas_internal_ostream& name_line,
+                                rocblas_internal_ostream& val_line,
+                                double                    gflops_per_sec,
+                                double                    gbytes_per_sec);
+
+// Average power and maximum temperature sampled by the frequency monitor, and the energy of a
+// call and the GFLOP/s per watt, when the monitor samples power
+void ArgumentModel_log_power(rocblas_internal_ostream& name_line,
+                             rocblas_internal_ostream& val_line,
+                             double                    gpu_us,
+                             double                    gflops_per_sec);
+
+// Results store: with a path set, the problem, environment and timing of each benchmark are
+// appended to it as a line of JSON. environment is the JSON members describing the device and
+// the rocBLAS and Tensile builds. With a baseline path set, the results of an earlier run are
+// read from it, and each benchmark of the same problem is compared with its baseline: it is a
+// regression if it is more than threshold_percent slower and, when both have per-iteration times,
+// Welch's t statistic of the difference exceeds 3.
+void ArgumentModel_set_results(const std::string& path,
+                               const std::string& baseline_path,
+                               const std::string& environment,
+                               double             threshold_percent);
+
+// Number of regressions found against the baseline
+size_t ArgumentModel_get_regressions();
+
+void ArgumentModel_log_results(rocblas_internal_ostream& name_line,
+                               rocblas_internal_ostream& val_line,
+                               const Arguments&          arg,
+                               const std::string&        problem_names,
+                               const std::string&        problem_values);
+
 // ArgumentModel template has a variadic list of argument enums
 template <rocblas_argument... Args>
 class ArgumentModel
@@ -80,10 +141,13 @@ public:
         // per/us to per/sec *10^6
         const double c_per_usec_to_per_sec = 1e6;
 
+        double rocblas_gflops = ArgumentLogging::NA_value;
+        double rocblas_GBps   = ArgumentLogging::NA_value;
+
         // append performance fields
         if(gflops != ArgumentLogging::NA_value)
         {
-            double rocblas_gflops = gflops * batch_count / gpu_us * c_per_usec_to_per_sec;
+            rocblas_gflops = gflops * batch_count / gpu_us * c_per_usec_to_per_sec;
 
             name_line << ",rocblas-Gflops";
             val_line << ", " << rocblas_gflops;
@@ -91,7 +155,7 @@ public:
 
         if(gbytes != ArgumentLogging::NA_value)
         {
-            double rocblas_GBps = gbytes * batch_count / gpu_us * c_per_usec_to_per_sec;
+            rocblas_GBps = gbytes * batch_count / gpu_us * c_per_usec_to_per_sec;
 
             // GB/s not usually reported for non-memory bound functions
             name_line << ",rocblas-GB/s";
@@ -101,6 +165,16 @@ public:
         name_line << ",us";
         val_line << ", " << gpu_us;
 
+        ArgumentModel_set_logged_time(gpu_us);
+
+        ArgumentModel_log_iteration_stats(name_line, val_line);
+
+        ArgumentModel_log_graph_time(name_line, val_line, gpu_us);
+
+        ArgumentModel_log_roofline(name_line, val_line, rocblas_gflops, rocblas_GBps);
+
+        ArgumentModel_log_power(name_line, val_line, gpu_us, rocblas_gflops);
+
         if(arg.unit_check || arg.norm_check)
         {
             if(cpu_us != ArgumentLogging::NA_value)
@@ -223,6 +297,11 @@ public:
 #endif
 
         if(arg.timing)
+        {
+            // the arguments of the problem, which the results store and the comparison key on
+            std::string problem_names  = name_list.str();
+            std::string problem_values = value_list.str();
+
             log_perf(name_list,
                      value_list,
                      arg,
@@ -235,6 +314,9 @@ public:
                      norm3,
                      norm4);
 
+            ArgumentModel_log_results(name_list, value_list, arg, problem_names, problem_values);
+        }
+
         str << name_list << "\n" << value_list << std::endl;
     }
 };
@@ -22,6 +22,13 @@
 
 #pragma once
 
+#include "argument_model.hpp"
+#include "client_utility.hpp"
+#include "frequency_monitor.hpp"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 //!
 //! @brief Implementation of a common benchmark code
 //!
@@ -35,43 +42,212 @@ public:
     //! @param stream                  The Hip stream.
     //! @param arg                     Arguments struct, arguments to run benchmark
     //! @param flush_batch_count       number of copies of arrays in rotating buffer, set to 1 for no rotating buffer
+    //! @param handle                  handle the lambda calls rocBLAS with, to time graph replays
     //!
-    Benchmark(LAMBDA           lambda_to_benchmark,
-              hipStream_t      stream,
-              const Arguments& arg,
-              size_t           flush_batch_count)
+    Benchmark(LAMBDA                lambda_to_benchmark,
+              hipStream_t           stream,
+              const Arguments&      arg,
+              size_t                flush_batch_count,
+              rocblas_local_handle* handle = nullptr)
         : m_lambda_to_benchmark(lambda_to_benchmark)
         , m_stream(stream)
         , m_arg(arg)
-        , m_flush_batch_count(flush_batch_count){};
+        , m_flush_batch_count(flush_batch_count)
+        , m_handle(handle){};
 
     double timer();
 
 private:
-    LAMBDA      m_lambda_to_benchmark;
-    Arguments   m_arg;
-    hipStream_t m_stream;
-    size_t      m_flush_batch_count;
+    void graph_timer();
+
+    LAMBDA                m_lambda_to_benchmark;
+    Arguments             m_arg;
+    hipStream_t           m_stream;
+    size_t                m_flush_batch_count;
+    rocblas_local_handle* m_handle;
 };
 
 // timer calls m_lambda_to_benchmark in a loop m_arg.iters + m_arg.cold_iters times
+// timer first calls it until the frequency monitor reports thermal steady state, if requested
 // timer returns the time to call the lambda m_arg.iters times
 // timer rotates through m_flush_batch_count copies of arrays to flush MALL
+// timer records an event before each timed call and one after the last, and passes the device
+// time of each call to ArgumentModel_set_iteration_times for the statistics of log_perf. The
+// calls are not timed individually if any of the events fails.
+// With m_arg.timing set to Arguments::c_timing_graph and a handle, timer also times replays of a
+// graph of one call.
 template <typename LAMBDA>
 double Benchmark<LAMBDA>::timer()
 {
+    int                     iters = m_arg.iters > 0 ? m_arg.iters : 0;
+    std::vector<hipEvent_t> events(iters + 1, nullptr);
+    bool                    timed = true;
+    for(auto& event : events)
+        timed = timed && hipEventCreate(&event) == hipSuccess;
+
+    FrequencyMonitor& freq_monitor = getFrequencyMonitor();
+    while(!freq_monitor.thermalSteady())
+        m_lambda_to_benchmark(0);
+
     double time_used;
     for(int iter = 0; iter < m_arg.iters + m_arg.cold_iters; iter++)
     {
         if(iter == m_arg.cold_iters)
             time_used = get_time_us_sync(m_stream);
 
+        if(timed && iter >= m_arg.cold_iters)
+            timed = hipEventRecord(events[iter - m_arg.cold_iters], m_stream) == hipSuccess;
+
         int flush_index = (iter + 1) % m_flush_batch_count;
 
         m_lambda_to_benchmark(flush_index);
     }
+    timed = timed && hipEventRecord(events.back(), m_stream) == hipSuccess;
 
     time_used = get_time_us_sync(m_stream) - time_used;
 
+    std::vector<double> times_us(iters);
+    for(int iter = 0; timed && iter < iters; iter++)
+    {
+        float ms;
+        timed          = hipEventElapsedTime(&ms, events[iter], events[iter + 1]) == hipSuccess;
+        times_us[iter] = ms * 1000.0;
+    }
+    for(auto& event : events)
+        if(event)
+            (void)hipEventDestroy(event);
+    ArgumentModel_set_iteration_times(timed ? std::move(times_us) : std::vector<double>{});
+
+    if(m_arg.timing == Arguments::c_timing_graph && m_handle)
+        graph_timer();
+
     return time_used;
 }
+
+// graph_timer captures one call of the lambda, with the first copies of the rotating buffers, into
+// a graph, and replays it m_arg.cold_iters + m_arg.iters times. The mean time of the timed replays
+// is passed to ArgumentModel_set_graph_time, which log_perf reports next to the time of the calls,
+// so that their difference is the host overhead of the API a graph saves.
+template <typename LAMBDA>
+void Benchmark<LAMBDA>::graph_timer()
+{
+    hipGraphExec_t instance;
+    m_handle->capture_graph(instance, [&] { m_lambda_to_benchmark(0); });
+
+    double time_used;
+    for(int iter = 0; iter < m_arg.iters + m_arg.cold_iters; iter++)
+    {
+        if(iter == m_arg.cold_iters)
+            time_used = get_time_us_sync(m_stream);
+        CHECK_HIP_ERROR(hipGraphLaunch(instance, m_stream));
+    }
+    time_used = get_time_us_sync(m_stream) - time_used;
+    CHECK_HIP_ERROR(hipGraphExecDestroy(instance));
+
+    ArgumentModel_set_graph_time(time_used / std::max(m_arg.iters, 1));
+}
+
+//!
+//! @brief Cache state before each timed call of a benchmark
+//!
+//! With arg.cache_flush, the L2 and MALL are flushed before each call by writing a buffer larger
+//! than them, and with arg.noise_bytes a device to device copy of that many bytes runs before
+//! the call, as other work of an application would. The calls are then timed with events
+//! recorded around each of them, so that neither is included in the time.
+//!
+class BenchmarkCacheState
+{
+public:
+    // bytes written to flush the cache, more than the L2 and MALL of current devices
+    static constexpr size_t c_flush_bytes = size_t(512) << 20;
+
+    BenchmarkCacheState(const Arguments& arg, hipStream_t stream)
+        : m_stream(stream)
+        , m_flush(arg.cache_flush)
+        , m_noise_bytes(arg.noise_bytes)
+    {
+        if(active())
+            allocate(std::max(arg.iters, 0));
+    }
+
+    ~BenchmarkCacheState()
+    {
+        for(auto& event : m_events)
+            if(event)
+                (void)hipEventDestroy(event);
+        if(m_flush_buffer)
+            (void)hipFree(m_flush_buffer);
+        if(m_noise_buffer)
+            (void)hipFree(m_noise_buffer);
+    }
+
+    BenchmarkCacheState(const BenchmarkCacheState&) = delete;
+    BenchmarkCacheState& operator=(const BenchmarkCacheState&) = delete;
+
+    bool active() const
+    {
+        return m_flush || m_noise_bytes;
+    }
+
+    // Whether an operand, such as 'A', stays at the first copy of the rotating buffers
+    static bool hot(const Arguments& arg, char operand)
+    {
+        return strchr(arg.hot_operands, operand) != nullptr;
+    }
+
+    // Flush the cache and run the noise before timed call iter
+    void before_call(int iter)
+    {
+        if(!active())
+            return;
+        if(m_flush)
+            CHECK_HIP_ERROR(hipMemsetAsync(m_flush_buffer, iter & 0xff, c_flush_bytes, m_stream));
+        if(m_noise_bytes)
+        {
+            char* noise = static_cast<char*>(m_noise_buffer);
+            CHECK_HIP_ERROR(hipMemcpyAsync(
+                noise, noise + m_noise_bytes, m_noise_bytes, hipMemcpyDeviceToDevice, m_stream));
+        }
+        CHECK_HIP_ERROR(hipEventRecord(m_events[2 * iter], m_stream));
+    }
+
+    void after_call(int iter)
+    {
+        if(active())
+            CHECK_HIP_ERROR(hipEventRecord(m_events[2 * iter + 1], m_stream));
+    }
+
+    // Total time of the timed calls in microseconds, after the stream is synchronized, or
+    // ArgumentLogging::NA_value if the events cannot be read
+    double time_us()
+    {
+        double time = 0;
+        for(size_t i = 0; i < m_events.size(); i += 2)
+        {
+            float ms;
+            if(hipEventElapsedTime(&ms, m_events[i], m_events[i + 1]) != hipSuccess)
+                return ArgumentLogging::NA_value;
+            time += ms * 1000.0;
+        }
+        return time;
+    }
+
+private:
+    void allocate(int iters)
+    {
+        m_events.resize(2 * iters, nullptr);
+        for(auto& event : m_events)
+            CHECK_HIP_ERROR(hipEventCreate(&event));
+        if(m_flush)
+            CHECK_HIP_ERROR(hipMalloc(&m_flush_buffer, c_flush_bytes));
+        if(m_noise_bytes)
+            CHECK_HIP_ERROR(hipMalloc(&m_noise_buffer, 2 * m_noise_bytes));
+    }
+
+    hipStream_t             m_stream;
+    bool                    m_flush;
+    uint64_t                m_noise_bytes;
+    void*                   m_flush_buffer = nullptr;
+    void*                   m_noise_buffer = nullptr;
+    std::vector<hipEvent_t> m_events;
+};
@@ -0,0 +1,167 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+template <typename T>
+void testing_axpby_nrm2_bad_arg(const Arguments& arg)
+{
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        rocblas_int N = 100, incx = 1, incy = 1;
+
+        device_vector<T> d_alpha(1), d_beta(1), dx(N, incx), dy(N, incy), d_result(1);
+        CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+        CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+        CHECK_DEVICE_ALLOCATION(dx.memcheck());
+        CHECK_DEVICE_ALLOCATION(dy.memcheck());
+        CHECK_DEVICE_ALLOCATION(d_result.memcheck());
+
+        // the scalars are not read before an argument is refused
+        T        h_alpha(1), h_beta(1);
+        bool     host  = pointer_mode == rocblas_pointer_mode_host;
+        const T* alpha = host ? &h_alpha : (T*)d_alpha;
+        const T* beta  = host ? &h_beta : (T*)d_beta;
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpby_nrm2<T>(nullptr, N, alpha, dx, incx, beta, dy, incy, d_result),
+            rocblas_status_invalid_handle);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpby_nrm2<T>(handle, N, nullptr, dx, incx, beta, dy, incy, d_result),
+            rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpby_nrm2<T>(handle, N, alpha, nullptr, incx, beta, dy, incy, d_result),
+            rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpby_nrm2<T>(handle, N, alpha, dx, incx, nullptr, dy, incy, d_result),
+            rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpby_nrm2<T>(handle, N, alpha, dx, incx, beta, nullptr, incy, d_result),
+            rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpby_nrm2<T>(handle, N, alpha, dx, incx, beta, dy, incy, nullptr),
+            rocblas_status_invalid_pointer);
+
+        // n <= 0 zeroes the result without reading the vectors
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpby_nrm2<T>(
+                handle, 0, nullptr, nullptr, incx, nullptr, nullptr, incy, d_result),
+            rocblas_status_success);
+    }
+}
+
+template <typename T>
+void testing_axpby_nrm2(const Arguments& arg)
+{
+    rocblas_int N     = arg.N;
+    rocblas_int incx  = arg.incx;
+    rocblas_int incy  = arg.incy;
+    T           alpha = arg.get_alpha<T>();
+    T           beta  = arg.get_beta<T>();
+
+    rocblas_local_handle handle{arg};
+
+    if(N <= 0)
+    {
+        device_vector<T> d_result(1);
+        CHECK_DEVICE_ALLOCATION(d_result.memcheck());
+
+        T h_result(1), gpu_result(1), cpu_0(0);
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_axpby_nrm2<T>(
+            handle, N, nullptr, nullptr, incx, nullptr, nullptr, incy, &h_result));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_axpby_nrm2<T>(
+            handle, N, nullptr, nullptr, incx, nullptr, nullptr, incy, d_result));
+        CHECK_HIP_ERROR(hipMemcpy(&gpu_result, d_result, sizeof(T), hipMemcpyDeviceToHost));
+        unit_check_general<T>(1, 1, 1, &cpu_0, &h_result);
+        unit_check_general<T>(1, 1, 1, &cpu_0, &gpu_result);
+        return;
+    }
+
+    host_vector<T>   hx(N, incx), hy(N, incy), hy_gold(N, incy), h_alpha(1), h_beta(1);
+    device_vector<T> dx(N, incx), dy(N, incy), d_alpha(1), d_beta(1), d_result(1);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_result.memcheck());
+
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_beta_sets_nan, false, true);
+    h_alpha[0] = alpha;
+    h_beta[0]  = beta;
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(d_alpha.transfer_from(h_alpha));
+    CHECK_HIP_ERROR(d_beta.transfer_from(h_beta));
+
+    // CPU BLAS
+    T cpu_result;
+    hy_gold = hy;
+    ref_scal(N, beta, (T*)hy_gold, incy);
+    ref_axpy<T>(N, alpha, hx, incx, hy_gold, incy);
+    ref_nrm2<T>(N, hy_gold, incy, &cpu_result);
+
+    const double tol = sum_near_tolerance<T>(N, cpu_result);
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        if(pointer_mode == rocblas_pointer_mode_host ? !arg.pointer_mode_host
+                                                     : !arg.pointer_mode_device)
+            continue;
+
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        T gpu_result;
+        if(pointer_mode == rocblas_pointer_mode_host)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_axpby_nrm2<T>(
+                handle, N, &alpha, dx, incx, &beta, dy, incy, &gpu_result));
+        }
+        else
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_axpby_nrm2<T>(
+                handle, N, d_alpha, dx, incx, d_beta, dy, incy, d_result));
+            CHECK_HIP_ERROR(hipMemcpy(&gpu_result, d_result, sizeof(T), hipMemcpyDeviceToHost));
+        }
+
+        host_vector<T> hy_gpu(N, incy);
+        CHECK_HIP_ERROR(hy_gpu.transfer_from(dy));
+
+        if(arg.unit_check)
+        {
+            if(arg.initialization == rocblas_initialization::hpl)
+                near_check_general<T>(1, N, incy, hy_gold, hy_gpu, sum_error_tolerance<T>);
+            else
+                unit_check_general<T>(1, N, incy, hy_gold, hy_gpu);
+            near_check_general<T>(1, 1, 1, &cpu_result, &gpu_result, tol);
+        }
+    }
+}
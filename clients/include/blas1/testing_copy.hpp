@@ -160,7 +160,7 @@ void testing_copy(const Arguments& arg)
         };
 
         Benchmark<decltype(lambda_to_benchmark)> benchmark_copy(
-            lambda_to_benchmark, stream, arg, flush_batch_count);
+            lambda_to_benchmark, stream, arg, flush_batch_count, &handle);
 
         gpu_time_used = benchmark_copy.timer();
 
@@ -0,0 +1,142 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+template <typename T>
+void testing_dot2_bad_arg(const Arguments& arg)
+{
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        rocblas_int N = 100, incx = 1, incy = 1, incz = 1;
+
+        device_vector<T> dx(N, incx), dy(N, incy), dz(N, incz), d_result(2);
+        CHECK_DEVICE_ALLOCATION(dx.memcheck());
+        CHECK_DEVICE_ALLOCATION(dy.memcheck());
+        CHECK_DEVICE_ALLOCATION(dz.memcheck());
+        CHECK_DEVICE_ALLOCATION(d_result.memcheck());
+
+        // don't write to result so device pointer fine for both host and device mode
+        EXPECT_ROCBLAS_STATUS(rocblas_dot2<T>(nullptr, N, dx, incx, dy, incy, dz, incz, d_result),
+                              rocblas_status_invalid_handle);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_dot2<T>(handle, N, nullptr, incx, dy, incy, dz, incz, d_result),
+            rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_dot2<T>(handle, N, dx, incx, nullptr, incy, dz, incz, d_result),
+            rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_dot2<T>(handle, N, dx, incx, dy, incy, nullptr, incz, d_result),
+            rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(rocblas_dot2<T>(handle, N, dx, incx, dy, incy, dz, incz, nullptr),
+                              rocblas_status_invalid_pointer);
+    }
+}
+
+template <typename T>
+void testing_dot2(const Arguments& arg)
+{
+    rocblas_int N    = arg.N;
+    rocblas_int incx = arg.incx;
+    rocblas_int incy = arg.incy;
+    rocblas_int incz = arg.incx;
+
+    rocblas_local_handle handle{arg};
+
+    if(N <= 0)
+    {
+        device_vector<T> d_result(2);
+        CHECK_DEVICE_ALLOCATION(d_result.memcheck());
+
+        T h_result[2] = {T(1), T(1)}, gpu_result[2] = {T(1), T(1)}, cpu_0[2] = {T(0), T(0)};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_dot2<T>(handle, N, nullptr, incx, nullptr, incy, nullptr, incz, h_result));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_dot2<T>(handle, N, nullptr, incx, nullptr, incy, nullptr, incz, d_result));
+        CHECK_HIP_ERROR(hipMemcpy(gpu_result, d_result, 2 * sizeof(T), hipMemcpyDeviceToHost));
+        unit_check_general<T>(1, 2, 1, cpu_0, h_result);
+        unit_check_general<T>(1, 2, 1, cpu_0, gpu_result);
+        return;
+    }
+
+    host_vector<T>   hx(N, incx), hy(N, incy), hz(N, incz);
+    device_vector<T> dx(N, incx), dy(N, incy), dz(N, incz), d_result(2);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dz.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_result.memcheck());
+
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_alpha_sets_nan, false, true);
+    rocblas_init_vector(hz, arg, rocblas_client_alpha_sets_nan, false);
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIP_ERROR(dz.transfer_from(hz));
+
+    // CPU BLAS
+    T cpu_result[2];
+    ref_dot<T, T>(N, hx, incx, hy, incy, &cpu_result[0]);
+    ref_dot<T, T>(N, hx, incx, hz, incz, &cpu_result[1]);
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        if(pointer_mode == rocblas_pointer_mode_host ? !arg.pointer_mode_host
+                                                     : !arg.pointer_mode_device)
+            continue;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        T gpu_result[2];
+        if(pointer_mode == rocblas_pointer_mode_host)
+        {
+            CHECK_ROCBLAS_ERROR(
+                rocblas_dot2<T>(handle, N, dx, incx, dy, incy, dz, incz, gpu_result));
+        }
+        else
+        {
+            CHECK_ROCBLAS_ERROR(
+                rocblas_dot2<T>(handle, N, dx, incx, dy, incy, dz, incz, d_result));
+            CHECK_HIP_ERROR(
+                hipMemcpy(gpu_result, d_result, 2 * sizeof(T), hipMemcpyDeviceToHost));
+        }
+
+        if(arg.unit_check)
+        {
+            for(int i = 0; i < 2; i++)
+                near_check_general<T>(1,
+                                      1,
+                                      1,
+                                      &cpu_result[i],
+                                      &gpu_result[i],
+                                      sum_near_tolerance<T>(N, cpu_result[i]));
+        }
+    }
+}
@@ -0,0 +1,238 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "rocblas_iamax_iamin_ref.hpp"
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// The vectors of a batch are reduced by the strided batched function, and by the single vector
+// function for a batch of one
+template <typename T, bool AMAX, bool STRIDED>
+rocblas_status rocblas_iamax_iamin_value_call(rocblas_handle handle,
+                                              rocblas_int    n,
+                                              const T*       x,
+                                              rocblas_int    incx,
+                                              rocblas_stride stridex,
+                                              rocblas_int    batch_count,
+                                              rocblas_int*   index,
+                                              real_t<T>*     value)
+{
+    if constexpr(STRIDED)
+        return (AMAX ? rocblas_iamax_value_strided_batched<T>
+                     : rocblas_iamin_value_strided_batched<T>)(
+            handle, n, x, incx, stridex, batch_count, index, value);
+    else
+        return (AMAX ? rocblas_iamax_value<T> : rocblas_iamin_value<T>)(
+            handle, n, x, incx, index, value);
+}
+
+template <typename T, bool AMAX, bool STRIDED>
+void testing_iamax_iamin_value_bad_arg(const Arguments& arg)
+{
+    using S   = real_t<T>;
+    auto func = rocblas_iamax_iamin_value_call<T, AMAX, STRIDED>;
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        rocblas_int    N = 100, incx = 1, batch_count = STRIDED ? 2 : 1;
+        rocblas_stride stridex = N;
+
+        device_vector<T>           dx(stridex * batch_count);
+        device_vector<rocblas_int> d_index(batch_count);
+        device_vector<S>           d_value(batch_count);
+        CHECK_DEVICE_ALLOCATION(dx.memcheck());
+        CHECK_DEVICE_ALLOCATION(d_index.memcheck());
+        CHECK_DEVICE_ALLOCATION(d_value.memcheck());
+
+        // don't write to the results so device pointers fine for both host and device mode
+        EXPECT_ROCBLAS_STATUS(func(nullptr, N, dx, incx, stridex, batch_count, d_index, d_value),
+                              rocblas_status_invalid_handle);
+        EXPECT_ROCBLAS_STATUS(
+            func(handle, N, nullptr, incx, stridex, batch_count, d_index, d_value),
+            rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(func(handle, N, dx, incx, stridex, batch_count, nullptr, d_value),
+                              rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(func(handle, N, dx, incx, stridex, batch_count, d_index, nullptr),
+                              rocblas_status_invalid_pointer);
+    }
+}
+
+template <typename T, bool AMAX, bool STRIDED>
+void testing_iamax_iamin_value(const Arguments& arg)
+{
+    using S   = real_t<T>;
+    auto func = rocblas_iamax_iamin_value_call<T, AMAX, STRIDED>;
+
+    rocblas_int    N           = arg.N;
+    rocblas_int    incx        = arg.incx;
+    rocblas_int    batch_count = STRIDED ? arg.batch_count : 1;
+    rocblas_stride stridex     = STRIDED ? arg.stride_x : 0;
+
+    rocblas_local_handle handle{arg};
+
+    // the quick returns write index 0 and value 0 for every vector of the batch
+    if(N <= 0 || incx <= 0 || batch_count <= 0)
+    {
+        size_t count = std::max(batch_count, 1);
+
+        host_vector<rocblas_int>   h_index(count), cpu_index(count), gpu_index(count);
+        host_vector<S>             h_value(count), cpu_value(count), gpu_value(count);
+        device_vector<rocblas_int> d_index(count);
+        device_vector<S>           d_value(count);
+        CHECK_DEVICE_ALLOCATION(d_index.memcheck());
+        CHECK_DEVICE_ALLOCATION(d_value.memcheck());
+
+        for(size_t b = 0; b < count; b++)
+        {
+            h_index[b]   = 1;
+            h_value[b]   = S(1);
+            cpu_index[b] = batch_count > 0 ? 0 : 1;
+            cpu_value[b] = batch_count > 0 ? S(0) : S(1);
+        }
+        CHECK_HIP_ERROR(d_index.transfer_from(h_index));
+        CHECK_HIP_ERROR(d_value.transfer_from(h_value));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(
+            func(handle, N, nullptr, incx, stridex, batch_count, h_index, h_value));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(
+            func(handle, N, nullptr, incx, stridex, batch_count, d_index, d_value));
+        CHECK_HIP_ERROR(gpu_index.transfer_from(d_index));
+        CHECK_HIP_ERROR(gpu_value.transfer_from(d_value));
+
+        unit_check_general<rocblas_int>(1, count, 1, cpu_index, h_index);
+        unit_check_general<rocblas_int>(1, count, 1, cpu_index, gpu_index);
+        unit_check_general<S>(1, count, 1, cpu_value, h_value);
+        unit_check_general<S>(1, count, 1, cpu_value, gpu_value);
+        return;
+    }
+
+    size_t size_x = size_t(N) * incx + size_t(stridex) * (batch_count - 1);
+
+    host_vector<T>             hx(size_x);
+    host_vector<rocblas_int>   cpu_index(batch_count), gpu_index(batch_count);
+    host_vector<S>             cpu_value(batch_count), gpu_value(batch_count);
+    device_vector<T>           dx(size_x);
+    device_vector<rocblas_int> d_index(batch_count);
+    device_vector<S>           d_value(batch_count);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_index.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_value.memcheck());
+
+    // stridex may be smaller than the vectors, so that they overlap as the columns of a matrix
+    rocblas_init<T>(hx, size_x, 1, size_x);
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+
+    // CPU BLAS
+    for(rocblas_int b = 0; b < batch_count; b++)
+    {
+        int64_t  index;
+        const T* x = hx.data() + b * stridex;
+        (AMAX ? rocblas_iamax_iamin_ref::iamax<T> : rocblas_iamax_iamin_ref::iamin<T>)(
+            N, x, incx, &index);
+        cpu_index[b] = rocblas_int(index);
+        cpu_value[b] = rocblas_iamax_iamin_ref::iamax_iamin_abs(x[(index - 1) * incx]);
+    }
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        if(pointer_mode == rocblas_pointer_mode_host ? !arg.pointer_mode_host
+                                                     : !arg.pointer_mode_device)
+            continue;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        if(pointer_mode == rocblas_pointer_mode_host)
+        {
+            CHECK_ROCBLAS_ERROR(
+                func(handle, N, dx, incx, stridex, batch_count, gpu_index, gpu_value));
+        }
+        else
+        {
+            CHECK_ROCBLAS_ERROR(
+                func(handle, N, dx, incx, stridex, batch_count, d_index, d_value));
+            CHECK_HIP_ERROR(gpu_index.transfer_from(d_index));
+            CHECK_HIP_ERROR(gpu_value.transfer_from(d_value));
+        }
+
+        // the value is the magnitude of an element of x, so it is exact
+        if(arg.unit_check)
+        {
+            unit_check_general<rocblas_int>(1, batch_count, 1, cpu_index, gpu_index);
+            unit_check_general<S>(1, batch_count, 1, cpu_value, gpu_value);
+        }
+    }
+}
+
+template <typename T>
+void testing_iamax_value_bad_arg(const Arguments& arg)
+{
+    testing_iamax_iamin_value_bad_arg<T, true, false>(arg);
+}
+
+template <typename T>
+void testing_iamin_value_bad_arg(const Arguments& arg)
+{
+    testing_iamax_iamin_value_bad_arg<T, false, false>(arg);
+}
+
+template <typename T>
+void testing_iamax_value(const Arguments& arg)
+{
+    testing_iamax_iamin_value<T, true, false>(arg);
+}
+
+template <typename T>
+void testing_iamin_value(const Arguments& arg)
+{
+    testing_iamax_iamin_value<T, false, false>(arg);
+}
+
+template <typename T>
+void testing_iamax_value_strided_batched_bad_arg(const Arguments& arg)
+{
+    testing_iamax_iamin_value_bad_arg<T, true, true>(arg);
+}
+
+template <typename T>
+void testing_iamin_value_strided_batched_bad_arg(const Arguments& arg)
+{
+    testing_iamax_iamin_value_bad_arg<T, false, true>(arg);
+}
+
+template <typename T>
+void testing_iamax_value_strided_batched(const Arguments& arg)
+{
+    testing_iamax_iamin_value<T, true, true>(arg);
+}
+
+template <typename T>
+void testing_iamin_value_strided_batched(const Arguments& arg)
+{
+    testing_iamax_iamin_value<T, false, true>(arg);
+}
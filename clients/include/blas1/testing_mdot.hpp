@@ -0,0 +1,149 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+template <typename T>
+void testing_mdot_bad_arg(const Arguments& arg)
+{
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        rocblas_int N = 100, K = 10, incx = 1, ldy = 100;
+
+        device_vector<T> dx(N, incx), dY(size_t(ldy) * K), d_result(K);
+        CHECK_DEVICE_ALLOCATION(dx.memcheck());
+        CHECK_DEVICE_ALLOCATION(dY.memcheck());
+        CHECK_DEVICE_ALLOCATION(d_result.memcheck());
+
+        // don't write to result so device pointer fine for both host and device mode
+        EXPECT_ROCBLAS_STATUS(rocblas_mdot<T>(nullptr, N, K, dx, incx, dY, ldy, d_result),
+                              rocblas_status_invalid_handle);
+        EXPECT_ROCBLAS_STATUS(rocblas_mdot<T>(handle, N, -1, dx, incx, dY, ldy, d_result),
+                              rocblas_status_invalid_size);
+        EXPECT_ROCBLAS_STATUS(rocblas_mdot<T>(handle, N, K, dx, incx, dY, N - 1, d_result),
+                              rocblas_status_invalid_size);
+        EXPECT_ROCBLAS_STATUS(rocblas_mdot<T>(handle, N, K, nullptr, incx, dY, ldy, d_result),
+                              rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(rocblas_mdot<T>(handle, N, K, dx, incx, nullptr, ldy, d_result),
+                              rocblas_status_invalid_pointer);
+        EXPECT_ROCBLAS_STATUS(rocblas_mdot<T>(handle, N, K, dx, incx, dY, ldy, nullptr),
+                              rocblas_status_invalid_pointer);
+
+        // k == 0 is a quick return
+        EXPECT_ROCBLAS_STATUS(rocblas_mdot<T>(handle, N, 0, nullptr, incx, nullptr, ldy, nullptr),
+                              rocblas_status_success);
+    }
+}
+
+template <typename T>
+void testing_mdot(const Arguments& arg)
+{
+    rocblas_int N    = arg.N;
+    rocblas_int K    = arg.K;
+    rocblas_int incx = arg.incx;
+    rocblas_int ldy  = arg.lda;
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = K < 0 || ldy < std::max(N, 1);
+    if(invalid_size || !K)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_mdot<T>(handle, N, K, nullptr, incx, nullptr, ldy, nullptr),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    device_vector<T> d_result(K);
+    CHECK_DEVICE_ALLOCATION(d_result.memcheck());
+
+    if(N <= 0)
+    {
+        host_vector<T> h_result(K), gpu_result(K), cpu_0(K);
+        for(rocblas_int j = 0; j < K; j++)
+        {
+            h_result[j] = T(1);
+            cpu_0[j]    = T(0);
+        }
+        CHECK_HIP_ERROR(d_result.transfer_from(h_result));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_mdot<T>(handle, N, K, nullptr, incx, nullptr, ldy, h_result));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_mdot<T>(handle, N, K, nullptr, incx, nullptr, ldy, d_result));
+        CHECK_HIP_ERROR(gpu_result.transfer_from(d_result));
+        unit_check_general<T>(1, K, 1, cpu_0, h_result);
+        unit_check_general<T>(1, K, 1, cpu_0, gpu_result);
+        return;
+    }
+
+    host_vector<T>   hx(N, incx), hY(size_t(ldy) * K), cpu_result(K), gpu_result(K);
+    device_vector<T> dx(N, incx), dY(size_t(ldy) * K);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dY.memcheck());
+
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init<T>(hY, N, K, ldy);
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dY.transfer_from(hY));
+
+    // CPU BLAS
+    for(rocblas_int j = 0; j < K; j++)
+        ref_dot<T, T>(N, hx, incx, hY.data() + size_t(j) * ldy, 1, &cpu_result[j]);
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        if(pointer_mode == rocblas_pointer_mode_host ? !arg.pointer_mode_host
+                                                     : !arg.pointer_mode_device)
+            continue;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        if(pointer_mode == rocblas_pointer_mode_host)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_mdot<T>(handle, N, K, dx, incx, dY, ldy, gpu_result));
+        }
+        else
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_mdot<T>(handle, N, K, dx, incx, dY, ldy, d_result));
+            CHECK_HIP_ERROR(gpu_result.transfer_from(d_result));
+        }
+
+        if(arg.unit_check)
+        {
+            for(rocblas_int j = 0; j < K; j++)
+                near_check_general<T>(1,
+                                      1,
+                                      1,
+                                      &cpu_result[j],
+                                      &gpu_result[j],
+                                      sum_near_tolerance<T>(N, cpu_result[j]));
+        }
+    }
+}
@@ -0,0 +1,189 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+template <typename T>
+void testing_normalize_strided_batched_bad_arg(const Arguments& arg)
+{
+    using Tr                                  = real_t<T>;
+    auto rocblas_normalize_strided_batched_fn = rocblas_normalize_strided_batched<T>;
+
+    const rocblas_int    N = 100, incx = 1, batch_count = 2;
+    const rocblas_stride stridex = N;
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+    device_vector<T>  dx(stridex * batch_count);
+    device_vector<Tr> d_results(batch_count);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_results.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_normalize_strided_batched_fn(nullptr, N, dx, incx, stridex, batch_count, d_results),
+        rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_normalize_strided_batched_fn(
+                              handle, N, nullptr, incx, stridex, batch_count, d_results),
+                          rocblas_status_invalid_pointer);
+
+    // the norms are optional, and nothing is read for an empty batch
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_normalize_strided_batched_fn(handle, N, dx, incx, stridex, batch_count, nullptr),
+        rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_normalize_strided_batched_fn(handle, N, nullptr, incx, stridex, 0, nullptr),
+        rocblas_status_success);
+}
+
+template <typename T>
+void testing_normalize_strided_batched(const Arguments& arg)
+{
+    using Tr                                  = real_t<T>;
+    auto rocblas_normalize_strided_batched_fn = rocblas_normalize_strided_batched<T>;
+
+    rocblas_int N           = arg.N;
+    rocblas_int incx        = arg.incx;
+    rocblas_int batch_count = arg.batch_count;
+
+    // algo 1 does not ask for the norms
+    bool with_results = arg.algo != 1;
+
+    rocblas_local_handle handle{arg};
+
+    // x is not read for n <= 0 or incx <= 0, and only the norms are set, to zero
+    if(N <= 0 || incx <= 0 || batch_count <= 0)
+    {
+        size_t            size_results = std::max(batch_count, 1);
+        host_vector<Tr>   h_results(size_results), h_zero(size_results);
+        device_vector<Tr> d_results(size_results);
+        CHECK_DEVICE_ALLOCATION(d_results.memcheck());
+
+        for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+        {
+            bool host = pointer_mode == rocblas_pointer_mode_host;
+
+            rocblas_init_nan<Tr>(h_results, 1, size_results, 1);
+            CHECK_HIP_ERROR(d_results.transfer_from(h_results));
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+            CHECK_ROCBLAS_ERROR(rocblas_normalize_strided_batched_fn(
+                handle,
+                N,
+                nullptr,
+                incx,
+                N,
+                batch_count,
+                with_results ? (host ? (Tr*)h_results : (Tr*)d_results) : nullptr));
+
+            if(with_results && batch_count > 0)
+            {
+                if(!host)
+                    CHECK_HIP_ERROR(h_results.transfer_from(d_results));
+                unit_check_general<Tr>(1, batch_count, 1, h_zero, h_results);
+            }
+        }
+        return;
+    }
+
+    // the vectors are padded, so that a stride mistake writes outside of them
+    rocblas_stride stridex = rocblas_stride(N) * incx + 3;
+    size_t         size_x  = stridex * (batch_count - 1) + size_t(N - 1) * incx + 1;
+
+    host_vector<T>    hx(size_x), hx_gold(size_x);
+    host_vector<Tr>   h_results(batch_count), h_results_gold(batch_count);
+    device_vector<T>  dx(size_x);
+    device_vector<Tr> d_results(batch_count);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_results.memcheck());
+
+    rocblas_seedrand();
+    if(arg.initialization == rocblas_initialization::hpl)
+        rocblas_init_vector(random_hpl_generator<T>, (T*)hx, size_x, 1);
+    else
+        rocblas_init<T>(hx, 1, size_x, 1);
+
+    // the first vector of a batch is zero, which is left as it is with a zero norm
+    if(batch_count > 1)
+        for(rocblas_int i = 0; i < N; i++)
+            hx[size_t(i) * incx] = T(0);
+
+    // CPU reference, scaling by the reciprocal of the norm as the kernels do
+    hx_gold = hx;
+    for(rocblas_int b = 0; b < batch_count; b++)
+    {
+        T* x = hx_gold + b * stridex;
+        ref_nrm2<T>(N, x, incx, h_results_gold + b);
+        if(h_results_gold[b] != 0)
+        {
+            Tr scale = Tr(1) / h_results_gold[b];
+            for(rocblas_int i = 0; i < N; i++)
+                x[size_t(i) * incx] *= scale;
+        }
+    }
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        if(pointer_mode == rocblas_pointer_mode_host && !arg.pointer_mode_host)
+            continue;
+        if(pointer_mode == rocblas_pointer_mode_device && !arg.pointer_mode_device)
+            continue;
+
+        bool host = pointer_mode == rocblas_pointer_mode_host;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+        CHECK_HIP_ERROR(dx.transfer_from(hx));
+
+        CHECK_ROCBLAS_ERROR(rocblas_normalize_strided_batched_fn(
+            handle,
+            N,
+            dx,
+            incx,
+            stridex,
+            batch_count,
+            with_results ? (host ? (Tr*)h_results : (Tr*)d_results) : nullptr));
+
+        if(arg.unit_check)
+        {
+            // the normalized elements are within the relative error of the norms, and the
+            // elements between and after the vectors are left as they were
+            host_vector<T> hx_gpu(size_x);
+            CHECK_HIP_ERROR(hx_gpu.transfer_from(dx));
+            near_check_general<T>(1, size_x, 1, hx_gold, hx_gpu, sum_near_tolerance<T>(N, 1));
+
+            if(with_results)
+            {
+                if(!host)
+                    CHECK_HIP_ERROR(h_results.transfer_from(d_results));
+                for(rocblas_int b = 0; b < batch_count; b++)
+                    near_check_general<Tr>(1,
+                                           1,
+                                           1,
+                                           h_results_gold + b,
+                                           h_results + b,
+                                           sum_near_tolerance<T>(N, h_results_gold[b]));
+            }
+        }
+    }
+}
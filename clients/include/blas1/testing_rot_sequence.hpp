@@ -0,0 +1,132 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_common.hpp"
+
+// Rotations by the angles first, first + 1, ..., so that the sequence keeps the norms of the
+// rows of A
+template <typename T>
+void rot_sequence_init(rocblas_int n, T* c, T* s, rocblas_int first = 1)
+{
+    for(rocblas_int k = 0; k < n - 1; k++)
+    {
+        c[k] = T(std::cos(double(first + k)));
+        s[k] = T(std::sin(double(first + k)));
+    }
+}
+
+// Apply the rotations one column pair at a time with the reference rot
+template <typename T>
+void ref_rot_sequence(rocblas_int m, rocblas_int n, const T* c, const T* s, T* A, rocblas_int lda)
+{
+    for(rocblas_int k = 0; k < n - 1; k++)
+        ref_rot<T, T, T, T>(m, A + size_t(k) * lda, 1, A + size_t(k + 1) * lda, 1, c + k, s + k);
+}
+
+template <typename T>
+double rot_sequence_tolerance(rocblas_int n)
+{
+    // the carried column grows to the norm of its row, with one rounding per rotation
+    return 10.0 * std::sqrt(double(n)) * n * sum_error_tolerance<T>;
+}
+
+/* ============================================================================================ */
+
+template <typename T>
+void testing_rot_sequence_bad_arg(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+
+    rocblas_int M = 100, N = 10, lda = 100;
+
+    device_vector<T> dc(N), ds(N), dA(size_t(lda) * N);
+    CHECK_DEVICE_ALLOCATION(dc.memcheck());
+    CHECK_DEVICE_ALLOCATION(ds.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence<T>(nullptr, M, N, dc, ds, dA, lda),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence<T>(handle, -1, N, dc, ds, dA, lda),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence<T>(handle, M, -1, dc, ds, dA, lda),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence<T>(handle, M, N, dc, ds, dA, M - 1),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence<T>(handle, M, N, nullptr, ds, dA, lda),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence<T>(handle, M, N, dc, nullptr, dA, lda),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence<T>(handle, M, N, dc, ds, nullptr, lda),
+                          rocblas_status_invalid_pointer);
+
+    // a single column has no rotation to apply
+    EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence<T>(handle, M, 1, nullptr, nullptr, nullptr, lda),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence<T>(handle, 0, N, nullptr, nullptr, nullptr, lda),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_rot_sequence(const Arguments& arg)
+{
+    rocblas_int M   = arg.M;
+    rocblas_int N   = arg.N;
+    rocblas_int lda = arg.lda;
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || lda < std::max(M, 1);
+    if(invalid_size || !M || N <= 1)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_rot_sequence<T>(handle, M, N, nullptr, nullptr, nullptr, lda),
+            invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    size_t size_A = size_t(lda) * N;
+
+    host_vector<T>   hc(N - 1), hs(N - 1), hA(size_A), hA_gold(size_A);
+    device_vector<T> dc(N - 1), ds(N - 1), dA(size_A);
+    CHECK_DEVICE_ALLOCATION(dc.memcheck());
+    CHECK_DEVICE_ALLOCATION(ds.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+
+    rot_sequence_init<T>(N, hc, hs);
+    rocblas_init<T>(hA, M, N, lda);
+    hA_gold = hA;
+
+    CHECK_HIP_ERROR(dc.transfer_from(hc));
+    CHECK_HIP_ERROR(ds.transfer_from(hs));
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    CHECK_ROCBLAS_ERROR(rocblas_rot_sequence<T>(handle, M, N, dc, ds, dA, lda));
+    CHECK_HIP_ERROR(hA.transfer_from(dA));
+
+    // CPU BLAS
+    ref_rot_sequence<T>(M, N, hc, hs, hA_gold, lda);
+
+    if(arg.unit_check)
+        near_check_general<T>(M, N, lda, hA_gold, hA, rot_sequence_tolerance<T>(N));
+}
@@ -0,0 +1,143 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_rot_sequence.hpp"
+
+/* ============================================================================================ */
+
+template <typename T>
+void testing_rot_sequence_strided_batched_bad_arg(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+
+    rocblas_int    M = 100, N = 10, lda = 100, batch_count = 2;
+    rocblas_stride stride_c = N, stride_s = N, stride_A = rocblas_stride(lda) * N;
+
+    device_vector<T> dc(stride_c * batch_count), ds(stride_s * batch_count);
+    device_vector<T> dA(stride_A * batch_count);
+    CHECK_DEVICE_ALLOCATION(dc.memcheck());
+    CHECK_DEVICE_ALLOCATION(ds.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+
+#define ROT_SEQUENCE_ARGS(handle_, m_, n_, c_, s_, A_, lda_, batch_count_) \
+    handle_, m_, n_, c_, stride_c, s_, stride_s, A_, lda_, stride_A, batch_count_
+
+    EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence_strided_batched<T>(
+                              ROT_SEQUENCE_ARGS(nullptr, M, N, dc, ds, dA, lda, batch_count)),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence_strided_batched<T>(
+                              ROT_SEQUENCE_ARGS(handle, -1, N, dc, ds, dA, lda, batch_count)),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence_strided_batched<T>(
+                              ROT_SEQUENCE_ARGS(handle, M, N, dc, ds, dA, M - 1, batch_count)),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence_strided_batched<T>(
+                              ROT_SEQUENCE_ARGS(handle, M, N, dc, ds, dA, lda, -1)),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence_strided_batched<T>(
+                              ROT_SEQUENCE_ARGS(handle, M, N, nullptr, ds, dA, lda, batch_count)),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence_strided_batched<T>(
+                              ROT_SEQUENCE_ARGS(handle, M, N, dc, nullptr, dA, lda, batch_count)),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence_strided_batched<T>(
+                              ROT_SEQUENCE_ARGS(handle, M, N, dc, ds, nullptr, lda, batch_count)),
+                          rocblas_status_invalid_pointer);
+
+    // no batch is a quick return
+    EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence_strided_batched<T>(
+                              ROT_SEQUENCE_ARGS(handle, M, N, nullptr, nullptr, nullptr, lda, 0)),
+                          rocblas_status_success);
+
+#undef ROT_SEQUENCE_ARGS
+}
+
+template <typename T>
+void testing_rot_sequence_strided_batched(const Arguments& arg)
+{
+    rocblas_int M           = arg.M;
+    rocblas_int N           = arg.N;
+    rocblas_int lda         = arg.lda;
+    rocblas_int batch_count = arg.batch_count;
+
+    // the sequences are padded, so that a stride mistake reads the wrong rotations
+    rocblas_stride stride_c = std::max(N, 1) + 1;
+    rocblas_stride stride_s = std::max(N, 1) + 2;
+    rocblas_stride stride_A = rocblas_stride(lda) * std::max(N, 1) + arg.M;
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || lda < std::max(M, 1) || batch_count < 0;
+    if(invalid_size || !M || N <= 1 || !batch_count)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_rot_sequence_strided_batched<T>(handle,
+                                                                      M,
+                                                                      N,
+                                                                      nullptr,
+                                                                      stride_c,
+                                                                      nullptr,
+                                                                      stride_s,
+                                                                      nullptr,
+                                                                      lda,
+                                                                      stride_A,
+                                                                      batch_count),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    host_vector<T>   hc(stride_c * batch_count), hs(stride_s * batch_count);
+    host_vector<T>   hA(stride_A * batch_count), hA_gold(stride_A * batch_count);
+    device_vector<T> dc(stride_c * batch_count), ds(stride_s * batch_count);
+    device_vector<T> dA(stride_A * batch_count);
+    CHECK_DEVICE_ALLOCATION(dc.memcheck());
+    CHECK_DEVICE_ALLOCATION(ds.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+
+    // each batch takes its own angles
+    for(rocblas_int b = 0; b < batch_count; b++)
+        rot_sequence_init<T>(N, hc.data() + b * stride_c, hs.data() + b * stride_s, 2 * b + 1);
+    rocblas_init<T>(hA, M, N, lda, stride_A, batch_count);
+    hA_gold = hA;
+
+    CHECK_HIP_ERROR(dc.transfer_from(hc));
+    CHECK_HIP_ERROR(ds.transfer_from(hs));
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    CHECK_ROCBLAS_ERROR(rocblas_rot_sequence_strided_batched<T>(
+        handle, M, N, dc, stride_c, ds, stride_s, dA, lda, stride_A, batch_count));
+    CHECK_HIP_ERROR(hA.transfer_from(dA));
+
+    // CPU BLAS
+    for(rocblas_int b = 0; b < batch_count; b++)
+        ref_rot_sequence<T>(M,
+                            N,
+                            hc.data() + b * stride_c,
+                            hs.data() + b * stride_s,
+                            hA_gold.data() + b * stride_A,
+                            lda);
+
+    if(arg.unit_check)
+        near_check_general<T>(
+            M, N, lda, stride_A, hA_gold, hA, batch_count, rot_sequence_tolerance<T>(N));
+}
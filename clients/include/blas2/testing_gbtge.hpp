@@ -0,0 +1,240 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// gbtge for TO_FULL, getgb otherwise, with the band storage first
+template <typename T, bool TO_FULL>
+rocblas_status rocblas_gbtge_getgb(rocblas_handle handle,
+                                   rocblas_int    m,
+                                   rocblas_int    n,
+                                   rocblas_int    kl,
+                                   rocblas_int    ku,
+                                   T*             AB,
+                                   rocblas_int    ldab,
+                                   rocblas_stride stride_ab,
+                                   T*             A,
+                                   rocblas_int    lda,
+                                   rocblas_stride stride_a,
+                                   rocblas_int    batch_count)
+{
+    if constexpr(TO_FULL)
+        return rocblas_gbtge_strided_batched<T>(
+            handle, m, n, kl, ku, AB, ldab, stride_ab, A, lda, stride_a, batch_count);
+    else
+        return rocblas_getgb_strided_batched<T>(
+            handle, m, n, kl, ku, A, lda, stride_a, AB, ldab, stride_ab, batch_count);
+}
+
+// Element (i, j) of the band is in row ku + i - j of column j of AB, the full matrix gets zeros
+// outside the band and the band storage outside the matrix is not written
+template <typename T, bool TO_FULL>
+void ref_gbtge_getgb(rocblas_int m,
+                     rocblas_int n,
+                     rocblas_int kl,
+                     rocblas_int ku,
+                     T*          AB,
+                     rocblas_int ldab,
+                     T*          A,
+                     rocblas_int lda)
+{
+    for(rocblas_int j = 0; j < n; j++)
+        for(rocblas_int i = 0; i < m; i++)
+        {
+            bool in_band = i >= j - ku && i <= j + kl;
+            T&   a       = A[i + size_t(j) * lda];
+            T*   ab      = AB + (ku + i - j) + size_t(j) * ldab;
+            if(TO_FULL)
+                a = in_band ? *ab : T(0);
+            else if(in_band)
+                *ab = a;
+        }
+}
+
+template <typename T, bool TO_FULL>
+void testing_gbtge_getgb_bad_arg(const Arguments& arg)
+{
+    auto func = rocblas_gbtge_getgb<T, TO_FULL>;
+
+    const rocblas_int    M = 100, N = 100, KL = 3, KU = 2, batch_count = 2;
+    const rocblas_int    ldab = KL + KU + 1, lda = 100;
+    const rocblas_stride stride_ab = rocblas_stride(ldab) * N, stride_a = rocblas_stride(lda) * N;
+
+    rocblas_local_handle handle{arg};
+
+    device_vector<T> dAB(stride_ab * batch_count), dA(stride_a * batch_count);
+    CHECK_DEVICE_ALLOCATION(dAB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+
+    // the calls below share the strides
+    auto call = [&](rocblas_handle h,
+                    rocblas_int    m,
+                    rocblas_int    n,
+                    rocblas_int    kl,
+                    rocblas_int    ku,
+                    T*             AB,
+                    rocblas_int    ldab_,
+                    T*             A,
+                    rocblas_int    lda_,
+                    rocblas_int    batch_count_) {
+        return func(h, m, n, kl, ku, AB, ldab_, stride_ab, A, lda_, stride_a, batch_count_);
+    };
+
+    EXPECT_ROCBLAS_STATUS(call(nullptr, M, N, KL, KU, dAB, ldab, dA, lda, batch_count),
+                          rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(call(handle, -1, N, KL, KU, dAB, ldab, dA, lda, batch_count),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, -1, KL, KU, dAB, ldab, dA, lda, batch_count),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, N, -1, KU, dAB, ldab, dA, lda, batch_count),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, N, KL, -1, dAB, ldab, dA, lda, batch_count),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, N, KL, KU, dAB, ldab - 1, dA, lda, batch_count),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, N, KL, KU, dAB, ldab, dA, M - 1, batch_count),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, N, KL, KU, dAB, ldab, dA, lda, -1),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(call(handle, M, N, KL, KU, nullptr, ldab, dA, lda, batch_count),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, N, KL, KU, dAB, ldab, nullptr, lda, batch_count),
+                          rocblas_status_invalid_pointer);
+
+    // quick returns do not read or write the matrices
+    EXPECT_ROCBLAS_STATUS(call(handle, 0, N, KL, KU, nullptr, ldab, nullptr, lda, batch_count),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, 0, KL, KU, nullptr, ldab, nullptr, lda, batch_count),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, N, KL, KU, nullptr, ldab, nullptr, lda, 0),
+                          rocblas_status_success);
+}
+
+template <typename T, bool TO_FULL>
+void testing_gbtge_getgb(const Arguments& arg)
+{
+    auto func = rocblas_gbtge_getgb<T, TO_FULL>;
+
+    rocblas_int M           = arg.M;
+    rocblas_int N           = arg.N;
+    rocblas_int KL          = arg.KL;
+    rocblas_int KU          = arg.KU;
+    rocblas_int ldab        = arg.lda;
+    rocblas_int lda         = arg.ldb;
+    rocblas_int batch_count = arg.batch_count;
+
+    // the batches are padded, so that a stride mistake moves the bands
+    rocblas_stride stride_ab = rocblas_stride(ldab) * std::max(N, 0) + 3;
+    rocblas_stride stride_a  = rocblas_stride(lda) * std::max(N, 0) + 5;
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || KL < 0 || KU < 0 || ldab < int64_t(KL) + KU + 1
+                        || lda < std::max(M, 1) || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        EXPECT_ROCBLAS_STATUS(func(handle,
+                                   M,
+                                   N,
+                                   KL,
+                                   KU,
+                                   nullptr,
+                                   ldab,
+                                   stride_ab,
+                                   nullptr,
+                                   lda,
+                                   stride_a,
+                                   batch_count),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    size_t size_AB = stride_ab * (batch_count - 1) + size_t(ldab) * N;
+    size_t size_A  = stride_a * (batch_count - 1) + size_t(lda) * N;
+
+    host_vector<T>   hAB(size_AB), hA(size_A), hAB_gold(size_AB), hA_gold(size_A);
+    device_vector<T> dAB(size_AB), dA(size_A);
+    CHECK_DEVICE_ALLOCATION(dAB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+
+    // the destination starts with other values, so that every element written is checked
+    rocblas_init<T>(hAB, size_AB, 1, size_AB);
+    rocblas_init<T>(hA, size_A, 1, size_A);
+    hAB_gold = hAB;
+    hA_gold  = hA;
+
+    CHECK_HIP_ERROR(dAB.transfer_from(hAB));
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    CHECK_ROCBLAS_ERROR(
+        func(handle, M, N, KL, KU, dAB, ldab, stride_ab, dA, lda, stride_a, batch_count));
+
+    // CPU reference
+    for(rocblas_int b = 0; b < batch_count; b++)
+        ref_gbtge_getgb<T, TO_FULL>(M,
+                                    N,
+                                    KL,
+                                    KU,
+                                    hAB_gold.data() + b * stride_ab,
+                                    ldab,
+                                    hA_gold.data() + b * stride_a,
+                                    lda);
+
+    // the rows of the band outside the matrix, the padding and the source are left as they were
+    if(arg.unit_check)
+    {
+        CHECK_HIP_ERROR(hAB.transfer_from(dAB));
+        CHECK_HIP_ERROR(hA.transfer_from(dA));
+        unit_check_general<T>(1, size_AB, 1, hAB_gold, hAB);
+        unit_check_general<T>(1, size_A, 1, hA_gold, hA);
+    }
+}
+
+template <typename T>
+void testing_gbtge_strided_batched_bad_arg(const Arguments& arg)
+{
+    testing_gbtge_getgb_bad_arg<T, true>(arg);
+}
+
+template <typename T>
+void testing_gbtge_strided_batched(const Arguments& arg)
+{
+    testing_gbtge_getgb<T, true>(arg);
+}
+
+template <typename T>
+void testing_getgb_strided_batched_bad_arg(const Arguments& arg)
+{
+    testing_gbtge_getgb_bad_arg<T, false>(arg);
+}
+
+template <typename T>
+void testing_getgb_strided_batched(const Arguments& arg)
+{
+    testing_gbtge_getgb<T, false>(arg);
+}
@@ -0,0 +1,348 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// gamma of a gemv epilogue, from the member of the union matching T
+template <typename T>
+void rocblas_gemv_epilogue_set_gamma(rocblas_gemv_epilogue& epilogue, T gamma)
+{
+    if constexpr(std::is_same_v<T, float>)
+        epilogue.gamma.s = gamma;
+    else if constexpr(std::is_same_v<T, double>)
+        epilogue.gamma.d = gamma;
+    else if constexpr(std::is_same_v<T, rocblas_float_complex>)
+        epilogue.gamma.c = gamma;
+    else
+        epilogue.gamma.z = gamma;
+}
+
+template <typename T>
+void testing_gemv_epilogue_bad_arg(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+
+    device_vector<T> d_bias(16), dz(16);
+    CHECK_DEVICE_ALLOCATION(d_bias.memcheck());
+    CHECK_DEVICE_ALLOCATION(dz.memcheck());
+
+    rocblas_gemv_epilogue epilogue{};
+    epilogue.bias = d_bias;
+    epilogue.z    = dz;
+    epilogue.incz = 1;
+    rocblas_gemv_epilogue_set_gamma(epilogue, T(1));
+
+    EXPECT_ROCBLAS_STATUS(rocblas_set_gemv_epilogue(nullptr, &epilogue),
+                          rocblas_status_invalid_handle);
+
+    rocblas_gemv_epilogue bad = epilogue;
+    bad.activation            = rocblas_gemm_epilogue_activation(7);
+    EXPECT_ROCBLAS_STATUS(rocblas_set_gemv_epilogue(handle, &bad), rocblas_status_invalid_value);
+    bad             = epilogue;
+    bad.stride_bias = -1;
+    EXPECT_ROCBLAS_STATUS(rocblas_set_gemv_epilogue(handle, &bad), rocblas_status_invalid_size);
+    bad          = epilogue;
+    bad.stride_z = -1;
+    EXPECT_ROCBLAS_STATUS(rocblas_set_gemv_epilogue(handle, &bad), rocblas_status_invalid_size);
+    bad      = epilogue;
+    bad.incz = 0;
+    EXPECT_ROCBLAS_STATUS(rocblas_set_gemv_epilogue(handle, &bad), rocblas_status_invalid_size);
+
+    // incz is not used without z
+    bad.z = nullptr;
+    CHECK_ROCBLAS_ERROR(rocblas_set_gemv_epilogue(handle, &bad));
+    CHECK_ROCBLAS_ERROR(rocblas_set_gemv_epilogue(handle, nullptr));
+}
+
+template <typename T>
+void testing_gemv_epilogue(const Arguments& arg)
+{
+    auto rocblas_gemv_fn                    = rocblas_gemv<T>;
+    auto rocblas_gemv_fn_64                 = rocblas_gemv_64<T>;
+    auto rocblas_gemv_batched_fn            = rocblas_gemv_batched<T>;
+    auto rocblas_gemv_strided_batched_fn    = rocblas_gemv_strided_batched<T>;
+    auto rocblas_gemv_strided_batched_fn_64 = rocblas_gemv_strided_batched_64<T>;
+
+    rocblas_operation transA      = char2rocblas_operation(arg.transA);
+    rocblas_int       M           = arg.M;
+    rocblas_int       N           = arg.N;
+    rocblas_int       lda         = arg.lda;
+    rocblas_int       incx        = arg.incx;
+    rocblas_int       incy        = arg.incy;
+    rocblas_int       batch_count = arg.batch_count;
+
+    if(M <= 0 || N <= 0 || lda < M || incx <= 0 || incy <= 0 || batch_count <= 0)
+        return;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+    T h_gamma = T(2);
+
+    rocblas_local_handle handle{arg};
+
+    // z has an increment of its own, and the bias and z of each batch are apart
+    const rocblas_int incz     = 2;
+    int64_t           len_x    = transA == rocblas_operation_none ? N : M;
+    int64_t           len_y    = transA == rocblas_operation_none ? M : N;
+    rocblas_stride    stride_a = rocblas_stride(lda) * N;
+    rocblas_stride    stride_x = len_x * incx;
+    rocblas_stride    stride_y = len_y * incy;
+    rocblas_stride    stride_z = len_y * incz + 1;
+    rocblas_stride    stride_b = len_y + 3;
+
+    host_vector<T> hA(stride_a * batch_count), hx(stride_x * batch_count),
+        hy(stride_y * batch_count), hy_gold(stride_y * batch_count),
+        hy_plain(stride_y * batch_count), hy_gpu(stride_y * batch_count),
+        h_bias(stride_b * batch_count), hz(stride_z * batch_count);
+    host_vector<T*> hA_array(batch_count), hx_array(batch_count), hy_array(batch_count);
+
+    device_vector<T>  dA(stride_a * batch_count), dx(stride_x * batch_count),
+        dy(stride_y * batch_count), d_bias(stride_b * batch_count), dz(stride_z * batch_count);
+    device_vector<T*> dA_array(batch_count), dx_array(batch_count), dy_array(batch_count);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_bias.memcheck());
+    CHECK_DEVICE_ALLOCATION(dz.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA_array.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx_array.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy_array.memcheck());
+
+    // integer data keeps the results exact, but for GELU
+    rocblas_seedrand();
+    rocblas_init<T>(hA, M, size_t(N) * batch_count, lda);
+    rocblas_init<T>(hx, 1, len_x * batch_count, incx);
+    rocblas_init<T>(hy, 1, len_y * batch_count, incy);
+    rocblas_init<T>(h_bias, 1, stride_b * batch_count, 1);
+    rocblas_init<T>(hz, 1, stride_z * batch_count, 1);
+
+    for(rocblas_int b = 0; b < batch_count; b++)
+    {
+        hA_array[b] = (T*)dA + b * stride_a;
+        hx_array[b] = (T*)dx + b * stride_x;
+        hy_array[b] = (T*)dy + b * stride_y;
+    }
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(d_bias.transfer_from(h_bias));
+    CHECK_HIP_ERROR(dz.transfer_from(hz));
+    CHECK_HIP_ERROR(dA_array.transfer_from(hA_array));
+    CHECK_HIP_ERROR(dx_array.transfer_from(hx_array));
+    CHECK_HIP_ERROR(dy_array.transfer_from(hy_array));
+
+    // the results without epilogue
+    hy_plain = hy;
+    for(rocblas_int b = 0; b < batch_count; b++)
+        ref_gemv<T>(transA,
+                    M,
+                    N,
+                    h_alpha,
+                    &hA[b * stride_a],
+                    lda,
+                    &hx[b * stride_x],
+                    incx,
+                    h_beta,
+                    &hy_plain[b * stride_y],
+                    incy);
+
+    auto check = [&](const host_vector<T>& hy_ref, rocblas_int batches, bool gelu) {
+        CHECK_HIP_ERROR(hy_gpu.transfer_from(dy));
+        if(!arg.unit_check)
+            return;
+        if(!gelu)
+        {
+            unit_check_general<T>(1, len_y, incy, stride_y, hy_ref, hy_gpu, batches);
+            return;
+        }
+
+        // tanh is rounded differently on the device
+        double max_abs = 0;
+        for(size_t i = 0; i < hy_ref.size(); i++)
+            max_abs = std::max(max_abs, double(rocblas_abs(hy_ref[i])));
+        double tol = max_abs * std::numeric_limits<real_t<T>>::epsilon() * 64;
+        near_check_general<T>(1, len_y, incy, stride_y, hy_ref, hy_gpu, batches, tol);
+    };
+
+    struct epilogue_case
+    {
+        bool                             bias, z;
+        rocblas_gemm_epilogue_activation activation;
+    };
+    const epilogue_case cases[] = {
+        {true, false, rocblas_gemm_epilogue_activation_none},
+        {false, true, rocblas_gemm_epilogue_activation_none},
+        {true, true, rocblas_gemm_epilogue_activation_none},
+        {false, false, rocblas_gemm_epilogue_activation_relu},
+        {true, true, rocblas_gemm_epilogue_activation_relu},
+        {true, false, rocblas_gemm_epilogue_activation_gelu},
+    };
+
+    for(const auto& c : cases)
+    {
+        rocblas_gemv_epilogue epilogue{};
+        epilogue.bias        = c.bias ? (const T*)d_bias : nullptr;
+        epilogue.stride_bias = stride_b;
+        epilogue.z           = c.z ? (const T*)dz : nullptr;
+        epilogue.incz        = incz;
+        epilogue.stride_z    = stride_z;
+        epilogue.activation  = c.activation;
+        rocblas_gemv_epilogue_set_gamma(epilogue, h_gamma);
+        CHECK_ROCBLAS_ERROR(rocblas_set_gemv_epilogue(handle, &epilogue));
+
+        bool activation = c.activation != rocblas_gemm_epilogue_activation_none;
+        bool gelu       = c.activation == rocblas_gemm_epilogue_activation_gelu;
+
+        // the activations apply to real datatypes only
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        if(rocblas_is_complex<T> && activation)
+        {
+            EXPECT_ROCBLAS_STATUS(rocblas_gemv_strided_batched_fn(handle,
+                                                                  transA,
+                                                                  M,
+                                                                  N,
+                                                                  &h_alpha,
+                                                                  dA,
+                                                                  lda,
+                                                                  stride_a,
+                                                                  dx,
+                                                                  incx,
+                                                                  stride_x,
+                                                                  &h_beta,
+                                                                  dy,
+                                                                  incy,
+                                                                  stride_y,
+                                                                  batch_count),
+                                  rocblas_status_not_implemented);
+            continue;
+        }
+
+        hy_gold = hy_plain;
+        for(rocblas_int b = 0; b < batch_count; b++)
+            for(int64_t i = 0; i < len_y; i++)
+            {
+                T& v = hy_gold[b * stride_y + i * incy];
+                if(c.bias)
+                    v += h_bias[b * stride_b + i];
+                if(c.z)
+                    v += h_gamma * hz[b * stride_z + i * incz];
+                if constexpr(!rocblas_is_complex<T>)
+                {
+                    if(c.activation == rocblas_gemm_epilogue_activation_relu)
+                        v = v > T(0) ? v : T(0);
+                    else if(gelu)
+                        v = T(0.5 * v
+                              * (1 + std::tanh(0.7978845608028654 * (v + 0.044715 * v * v * v))));
+                }
+            }
+
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_strided_batched_fn(handle,
+                                                            transA,
+                                                            M,
+                                                            N,
+                                                            &h_alpha,
+                                                            dA,
+                                                            lda,
+                                                            stride_a,
+                                                            dx,
+                                                            incx,
+                                                            stride_x,
+                                                            &h_beta,
+                                                            dy,
+                                                            incy,
+                                                            stride_y,
+                                                            batch_count));
+        check(hy_gold, batch_count, gelu);
+
+        // gemv applies the epilogue of the first batch
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_gemv_fn(handle, transA, M, N, &h_alpha, dA, lda, dx, incx, &h_beta, dy, incy));
+        check(hy_gold, 1, gelu);
+
+        // gemv_batched and the 64-bit interfaces ignore the epilogue
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_batched_fn(handle,
+                                                    transA,
+                                                    M,
+                                                    N,
+                                                    &h_alpha,
+                                                    dA_array,
+                                                    lda,
+                                                    dx_array,
+                                                    incx,
+                                                    &h_beta,
+                                                    dy_array,
+                                                    incy,
+                                                    batch_count));
+        check(hy_plain, batch_count, false);
+
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_strided_batched_fn_64(handle,
+                                                               transA,
+                                                               M,
+                                                               N,
+                                                               &h_alpha,
+                                                               dA,
+                                                               lda,
+                                                               stride_a,
+                                                               dx,
+                                                               incx,
+                                                               stride_x,
+                                                               &h_beta,
+                                                               dy,
+                                                               incy,
+                                                               stride_y,
+                                                               batch_count));
+        check(hy_plain, batch_count, false);
+
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_fn_64(
+            handle, transA, M, N, &h_alpha, dA, lda, dx, incx, &h_beta, dy, incy));
+        check(hy_plain, 1, false);
+    }
+
+    // Clearing the epilogue restores gemv
+    CHECK_ROCBLAS_ERROR(rocblas_set_gemv_epilogue(handle, nullptr));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_ROCBLAS_ERROR(rocblas_gemv_strided_batched_fn(handle,
+                                                        transA,
+                                                        M,
+                                                        N,
+                                                        &h_alpha,
+                                                        dA,
+                                                        lda,
+                                                        stride_a,
+                                                        dx,
+                                                        incx,
+                                                        stride_x,
+                                                        &h_beta,
+                                                        dy,
+                                                        incy,
+                                                        stride_y,
+                                                        batch_count));
+    check(hy_plain, batch_count, false);
+}
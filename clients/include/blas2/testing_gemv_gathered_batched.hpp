@@ -0,0 +1,286 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+template <typename T>
+void testing_gemv_gathered_batched_bad_arg(const Arguments& arg)
+{
+    auto rocblas_gemv_gathered_batched_fn = rocblas_gemv_gathered_batched<T>;
+
+    const rocblas_operation op = rocblas_operation_none;
+    const rocblas_int       M = 100, N = 100, lda = 200, incx = 1, incy = 1, batch_count = 2;
+    const rocblas_stride    stride_index = M, stridex = N, stridey = M;
+
+    const T alpha = T(1), beta = T(2), zero = T(0), one = T(1);
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    device_vector<T>           dA(size_t(lda) * N), dx(stridex * batch_count),
+        dy(stridey * batch_count);
+    device_vector<rocblas_int> d_index(stride_index * batch_count);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_index.memcheck());
+
+    // the calls below share N, the leading dimension, the strides and the batch
+    auto call = [&](rocblas_handle     h,
+                    rocblas_operation  transA,
+                    rocblas_int        m,
+                    const T*           a,
+                    const T*           A,
+                    const rocblas_int* index,
+                    const T*           x,
+                    rocblas_int        incx_,
+                    const T*           b,
+                    T*                 y,
+                    rocblas_int        incy_) {
+        return rocblas_gemv_gathered_batched_fn(h,
+                                                transA,
+                                                m,
+                                                N,
+                                                a,
+                                                A,
+                                                lda,
+                                                index,
+                                                stride_index,
+                                                x,
+                                                incx_,
+                                                stridex,
+                                                b,
+                                                y,
+                                                incy_,
+                                                stridey,
+                                                batch_count);
+    };
+
+    EXPECT_ROCBLAS_STATUS(call(nullptr, op, M, &alpha, dA, d_index, dx, incx, &beta, dy, incy),
+                          rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(call(handle,
+                               (rocblas_operation)rocblas_fill_full,
+                               M,
+                               &alpha,
+                               dA,
+                               d_index,
+                               dx,
+                               incx,
+                               &beta,
+                               dy,
+                               incy),
+                          rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(call(handle, op, -1, &alpha, dA, d_index, dx, incx, &beta, dy, incy),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, op, M, &alpha, dA, d_index, dx, 0, &beta, dy, incy),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, op, M, &alpha, dA, d_index, dx, incx, &beta, dy, 0),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_gathered_batched_fn(handle,
+                                                           op,
+                                                           M,
+                                                           N,
+                                                           &alpha,
+                                                           dA,
+                                                           0,
+                                                           d_index,
+                                                           stride_index,
+                                                           dx,
+                                                           incx,
+                                                           stridex,
+                                                           &beta,
+                                                           dy,
+                                                           incy,
+                                                           stridey,
+                                                           batch_count),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(call(handle, op, M, nullptr, dA, d_index, dx, incx, &beta, dy, incy),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(call(handle, op, M, &alpha, dA, d_index, dx, incx, nullptr, dy, incy),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(call(handle, op, M, &alpha, nullptr, d_index, dx, incx, &beta, dy, incy),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(call(handle, op, M, &alpha, dA, nullptr, dx, incx, &beta, dy, incy),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(call(handle, op, M, &alpha, dA, d_index, nullptr, incx, &beta, dy, incy),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, &alpha, dA, d_index, dx, incx, &beta, nullptr, incy),
+        rocblas_status_invalid_pointer);
+
+    // quick returns do not read the table, the indices or the vectors
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, 0, nullptr, nullptr, nullptr, nullptr, incx, nullptr, nullptr, incy),
+        rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, &zero, nullptr, nullptr, nullptr, incx, &one, nullptr, incy),
+        rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, &zero, nullptr, nullptr, nullptr, incx, &beta, dy, incy),
+        rocblas_status_success);
+}
+
+template <typename T>
+void testing_gemv_gathered_batched(const Arguments& arg)
+{
+    auto rocblas_gemv_gathered_batched_fn = rocblas_gemv_gathered_batched<T>;
+
+    rocblas_operation transA       = char2rocblas_operation(arg.transA);
+    rocblas_int       M            = arg.M;
+    rocblas_int       N            = arg.N;
+    rocblas_int       lda          = arg.lda;
+    rocblas_int       incx         = arg.incx;
+    rocblas_int       incy         = arg.incy;
+    rocblas_int       batch_count  = arg.batch_count;
+    rocblas_stride    stride_index = M + 1;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || lda < 1 || !incx || !incy || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_gathered_batched_fn(handle,
+                                                               transA,
+                                                               M,
+                                                               N,
+                                                               nullptr,
+                                                               nullptr,
+                                                               lda,
+                                                               nullptr,
+                                                               stride_index,
+                                                               nullptr,
+                                                               incx,
+                                                               1,
+                                                               nullptr,
+                                                               nullptr,
+                                                               incy,
+                                                               1,
+                                                               batch_count),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    size_t         dim_x    = transA == rocblas_operation_none ? N : M;
+    size_t         dim_y    = transA == rocblas_operation_none ? M : N;
+    rocblas_stride stride_x = dim_x * std::abs(incx);
+    rocblas_stride stride_y = dim_y * std::abs(incy);
+
+    // The rows of the batches in the table, in other orders than the table's and with repeats.
+    // The index arrays are padded to check that only the first M entries of each are read.
+    host_vector<rocblas_int> h_index(stride_index * batch_count);
+    for(rocblas_int b = 0; b < batch_count; b++)
+        for(rocblas_int i = 0; i <= M; i++)
+            h_index[b * stride_index + i] = i < M ? (b * 7 + i * 13) % lda : -1;
+
+    host_matrix<T>                 hA(lda, N, lda), hG(M, N, M);
+    host_strided_batch_vector<T>   hx(dim_x, incx, stride_x, batch_count);
+    host_strided_batch_vector<T>   hy(dim_y, incy, stride_y, batch_count);
+    host_strided_batch_vector<T>   hy_gold(dim_y, incy, stride_y, batch_count);
+    host_vector<T>                 halpha(1), hbeta(1);
+    device_matrix<T>               dA(lda, N, lda);
+    device_strided_batch_vector<T> dx(dim_x, incx, stride_x, batch_count);
+    device_strided_batch_vector<T> dy(dim_y, incy, stride_y, batch_count);
+    device_vector<rocblas_int>     d_index(stride_index * batch_count);
+    device_vector<T>               d_alpha(1), d_beta(1);
+    CHECK_HIP_ERROR(hx.memcheck());
+    CHECK_HIP_ERROR(hy.memcheck());
+    CHECK_HIP_ERROR(hy_gold.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_index.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, false, true);
+    rocblas_init_vector(hy, arg, rocblas_client_beta_sets_nan);
+    halpha[0] = h_alpha;
+    hbeta[0]  = h_beta;
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(d_index.transfer_from(h_index));
+    CHECK_HIP_ERROR(d_alpha.transfer_from(halpha));
+    CHECK_HIP_ERROR(d_beta.transfer_from(hbeta));
+
+    // CPU reference, gemv of the rows of each batch gathered into a matrix
+    hy_gold.copy_from(hy);
+    const T* table = hA;
+    T*       G     = hG;
+    for(rocblas_int b = 0; b < batch_count; b++)
+    {
+        for(rocblas_int j = 0; j < N; j++)
+            for(rocblas_int i = 0; i < M; i++)
+                G[i + size_t(j) * M] = table[h_index[b * stride_index + i] + size_t(j) * lda];
+        ref_gemv<T>(transA, M, N, h_alpha, hG, M, hx[b], incx, h_beta, hy_gold[b], incy);
+    }
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        if(pointer_mode == rocblas_pointer_mode_host && !arg.pointer_mode_host)
+            continue;
+        if(pointer_mode == rocblas_pointer_mode_device && !arg.pointer_mode_device)
+            continue;
+
+        bool host = pointer_mode == rocblas_pointer_mode_host;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_gathered_batched_fn(handle,
+                                                             transA,
+                                                             M,
+                                                             N,
+                                                             host ? &h_alpha : d_alpha,
+                                                             dA,
+                                                             lda,
+                                                             d_index,
+                                                             stride_index,
+                                                             dx,
+                                                             incx,
+                                                             stride_x,
+                                                             host ? &h_beta : d_beta,
+                                                             dy,
+                                                             incy,
+                                                             stride_y,
+                                                             batch_count));
+
+        if(arg.unit_check)
+        {
+            host_strided_batch_vector<T> hy_gpu(dim_y, incy, stride_y, batch_count);
+            CHECK_HIP_ERROR(hy_gpu.memcheck());
+            CHECK_HIP_ERROR(hy_gpu.transfer_from(dy));
+            unit_check_general<T>(1, dim_y, incy, stride_y, hy_gold, hy_gpu, batch_count);
+        }
+    }
+}
@@ -0,0 +1,196 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+template <typename T>
+void testing_gemv_multi_bad_arg(const Arguments& arg)
+{
+    const rocblas_operation transA = rocblas_operation_none;
+
+    const rocblas_int M = 100, N = 90, K = 5, lda = 100, ldx = 90, ldy = 100;
+
+    const T alpha(1), beta(2), zero(0), one(1);
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    device_vector<T> dA(size_t(lda) * N), dX(size_t(ldx) * K), dY(size_t(ldy) * K);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dX.memcheck());
+    CHECK_DEVICE_ALLOCATION(dY.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_multi<T>(
+                              nullptr, transA, M, N, K, &alpha, dA, lda, dX, ldx, &beta, dY, ldy),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemv_multi<T>(
+            handle, (rocblas_operation)255, M, N, K, &alpha, dA, lda, dX, ldx, &beta, dY, ldy),
+        rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_multi<T>(
+                              handle, transA, M, N, -1, &alpha, dA, lda, dX, ldx, &beta, dY, ldy),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_multi<T>(
+                              handle, transA, M, N, K, &alpha, dA, M - 1, dX, ldx, &beta, dY, ldy),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_multi<T>(
+                              handle, transA, M, N, K, &alpha, dA, lda, dX, N - 1, &beta, dY, ldy),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_multi<T>(
+                              handle, transA, M, N, K, &alpha, dA, lda, dX, ldx, &beta, dY, M - 1),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_multi<T>(
+                              handle, transA, M, N, K, nullptr, dA, lda, dX, ldx, &beta, dY, ldy),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_multi<T>(
+                              handle, transA, M, N, K, &alpha, dA, lda, dX, ldx, nullptr, dY, ldy),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemv_multi<T>(
+            handle, transA, M, N, K, &alpha, nullptr, lda, dX, ldx, &beta, dY, ldy),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemv_multi<T>(
+            handle, transA, M, N, K, &alpha, dA, lda, nullptr, ldx, &beta, dY, ldy),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemv_multi<T>(
+            handle, transA, M, N, K, &alpha, dA, lda, dX, ldx, &beta, nullptr, ldy),
+        rocblas_status_invalid_pointer);
+
+    // no vector is a quick return, and alpha == 0 does not read A or X
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemv_multi<T>(
+            handle, transA, M, N, 0, nullptr, nullptr, lda, nullptr, ldx, nullptr, nullptr, ldy),
+        rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemv_multi<T>(
+            handle, transA, M, N, K, &zero, nullptr, lda, nullptr, ldx, &one, nullptr, ldy),
+        rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemv_multi<T>(
+            handle, transA, M, N, K, &zero, nullptr, lda, nullptr, ldx, &beta, dY, ldy),
+        rocblas_status_success);
+}
+
+template <typename T>
+void testing_gemv_multi(const Arguments& arg)
+{
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_int       M      = arg.M;
+    rocblas_int       N      = arg.N;
+    rocblas_int       K      = arg.K;
+    rocblas_int       lda    = arg.lda;
+    rocblas_int       ldx    = arg.ldb;
+    rocblas_int       ldy    = arg.ldc;
+    T                 alpha  = arg.get_alpha<T>();
+    T                 beta   = arg.get_beta<T>();
+
+    bool        none  = transA == rocblas_operation_none;
+    rocblas_int x_len = none ? N : M;
+    rocblas_int y_len = none ? M : N;
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < std::max(M, 1)
+                        || ldx < std::max(x_len, 1) || ldy < std::max(y_len, 1);
+    if(invalid_size || !M || !N || !K)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_multi<T>(handle,
+                                                    transA,
+                                                    M,
+                                                    N,
+                                                    K,
+                                                    nullptr,
+                                                    nullptr,
+                                                    lda,
+                                                    nullptr,
+                                                    ldx,
+                                                    nullptr,
+                                                    nullptr,
+                                                    ldy),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    size_t size_A = size_t(lda) * N, size_X = size_t(ldx) * K, size_Y = size_t(ldy) * K;
+
+    host_vector<T>   hA(size_A), hX(size_X), hY(size_Y), hY_gold(size_Y), hY_gpu(size_Y);
+    host_vector<T>   h_alpha(1), h_beta(1);
+    device_vector<T> dA(size_A), dX(size_X), dY(size_Y), d_alpha(1), d_beta(1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dX.memcheck());
+    CHECK_DEVICE_ALLOCATION(dY.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    rocblas_init<T>(hA, M, N, lda);
+    rocblas_init<T>(hX, x_len, K, ldx);
+    rocblas_init<T>(hY, y_len, K, ldy);
+    h_alpha[0] = alpha;
+    h_beta[0]  = beta;
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dX.transfer_from(hX));
+    CHECK_HIP_ERROR(d_alpha.transfer_from(h_alpha));
+    CHECK_HIP_ERROR(d_beta.transfer_from(h_beta));
+
+    // CPU BLAS, one gemv per vector
+    hY_gold = hY;
+    for(rocblas_int j = 0; j < K; j++)
+        ref_gemv<T>(transA,
+                    M,
+                    N,
+                    alpha,
+                    hA,
+                    lda,
+                    hX.data() + size_t(j) * ldx,
+                    1,
+                    beta,
+                    hY_gold.data() + size_t(j) * ldy,
+                    1);
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        if(pointer_mode == rocblas_pointer_mode_host ? !arg.pointer_mode_host
+                                                     : !arg.pointer_mode_device)
+            continue;
+
+        CHECK_HIP_ERROR(dY.transfer_from(hY));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        bool     host = pointer_mode == rocblas_pointer_mode_host;
+        const T* a    = host ? &alpha : (T*)d_alpha;
+        const T* b    = host ? &beta : (T*)d_beta;
+        CHECK_ROCBLAS_ERROR(
+            rocblas_gemv_multi<T>(handle, transA, M, N, K, a, dA, lda, dX, ldx, b, dY, ldy));
+        CHECK_HIP_ERROR(hY_gpu.transfer_from(dY));
+
+        // the padding between the columns of Y is left as it was
+        if(arg.unit_check)
+            unit_check_general<T>(ldy, K, ldy, hY_gold, hY_gpu);
+    }
+}
@@ -563,11 +563,10 @@ void testing_gemv_strided_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
-        for(int64_t b = 0; b < batch_count; ++b)
-        {
+        ref_batched(batch_count, gemv_gflop_count<Tex>(transA, M, N), [&](int64_t b) {
             ref_gemv<Ti, To>(
                 transA, M, N, h_alpha, hA[b], lda, hx[b], incx, h_beta, hy_gold[b], incy);
-        }
+        });
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
         auto compare_hy_to_gold = [&] {
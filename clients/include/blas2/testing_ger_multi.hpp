@@ -0,0 +1,180 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+template <typename T, bool CONJ>
+void testing_ger_multi_template_bad_arg(const Arguments& arg)
+{
+    auto rocblas_ger_multi_fn = rocblas_ger_multi<T, CONJ>;
+
+    const rocblas_int M = 100, N = 90, K = 5, ldx = 100, ldy = 90, lda = 100;
+
+    const T alpha(1), zero(0);
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    device_vector<T> dX(size_t(ldx) * K), dY(size_t(ldy) * K), dA(size_t(lda) * N);
+    CHECK_DEVICE_ALLOCATION(dX.memcheck());
+    CHECK_DEVICE_ALLOCATION(dY.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(rocblas_ger_multi_fn(nullptr, M, N, K, &alpha, dX, ldx, dY, ldy, dA, lda),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_ger_multi_fn(handle, M, N, -1, &alpha, dX, ldx, dY, ldy, dA, lda),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_ger_multi_fn(handle, M, N, K, &alpha, dX, M - 1, dY, ldy, dA, lda),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_ger_multi_fn(handle, M, N, K, &alpha, dX, ldx, dY, N - 1, dA, lda),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_ger_multi_fn(handle, M, N, K, &alpha, dX, ldx, dY, ldy, dA, M - 1),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_ger_multi_fn(handle, M, N, K, nullptr, dX, ldx, dY, ldy, dA, lda),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_ger_multi_fn(handle, M, N, K, &alpha, nullptr, ldx, dY, ldy, dA, lda),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_ger_multi_fn(handle, M, N, K, &alpha, dX, ldx, nullptr, ldy, dA, lda),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_ger_multi_fn(handle, M, N, K, &alpha, dX, ldx, dY, ldy, nullptr, lda),
+        rocblas_status_invalid_pointer);
+
+    // no update is a quick return, and alpha == 0 reads no matrix
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_ger_multi_fn(handle, M, N, 0, nullptr, nullptr, ldx, nullptr, ldy, nullptr, lda),
+        rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_ger_multi_fn(handle, M, N, K, &zero, nullptr, ldx, nullptr, ldy, nullptr, lda),
+        rocblas_status_success);
+}
+
+template <typename T, bool CONJ>
+void testing_ger_multi_template(const Arguments& arg)
+{
+    auto rocblas_ger_multi_fn = rocblas_ger_multi<T, CONJ>;
+
+    rocblas_int M     = arg.M;
+    rocblas_int N     = arg.N;
+    rocblas_int K     = arg.K;
+    rocblas_int ldx   = arg.ldb;
+    rocblas_int ldy   = arg.ldc;
+    rocblas_int lda   = arg.lda;
+    T           alpha = arg.get_alpha<T>();
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || K < 0 || ldx < std::max(M, 1) || ldy < std::max(N, 1)
+                        || lda < std::max(M, 1);
+    if(invalid_size || !M || !N || !K)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_ger_multi_fn(
+                handle, M, N, K, nullptr, nullptr, ldx, nullptr, ldy, nullptr, lda),
+            invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    size_t size_X = size_t(ldx) * K, size_Y = size_t(ldy) * K, size_A = size_t(lda) * N;
+
+    host_vector<T>   hX(size_X), hY(size_Y), hA(size_A), hA_gold(size_A), hA_gpu(size_A);
+    host_vector<T>   h_alpha(1);
+    device_vector<T> dX(size_X), dY(size_Y), dA(size_A), d_alpha(1);
+    CHECK_DEVICE_ALLOCATION(dX.memcheck());
+    CHECK_DEVICE_ALLOCATION(dY.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+
+    rocblas_init<T>(hX, M, K, ldx);
+    rocblas_init<T>(hY, N, K, ldy);
+    rocblas_init<T>(hA, M, N, lda);
+    h_alpha[0] = alpha;
+
+    CHECK_HIP_ERROR(dX.transfer_from(hX));
+    CHECK_HIP_ERROR(dY.transfer_from(hY));
+    CHECK_HIP_ERROR(d_alpha.transfer_from(h_alpha));
+
+    // CPU BLAS, one rank-1 update per pair of columns
+    hA_gold = hA;
+    for(rocblas_int j = 0; j < K; j++)
+        ref_ger<T, CONJ>(M,
+                         N,
+                         alpha,
+                         hX.data() + size_t(j) * ldx,
+                         1,
+                         hY.data() + size_t(j) * ldy,
+                         1,
+                         hA_gold,
+                         lda);
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        if(pointer_mode == rocblas_pointer_mode_host ? !arg.pointer_mode_host
+                                                     : !arg.pointer_mode_device)
+            continue;
+
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        const T* a = pointer_mode == rocblas_pointer_mode_host ? &alpha : (T*)d_alpha;
+        CHECK_ROCBLAS_ERROR(rocblas_ger_multi_fn(handle, M, N, K, a, dX, ldx, dY, ldy, dA, lda));
+        CHECK_HIP_ERROR(hA_gpu.transfer_from(dA));
+
+        if(arg.unit_check)
+            unit_check_general<T>(M, N, lda, hA_gold, hA_gpu);
+    }
+}
+
+// ger_multi is geru_multi for complex types
+template <typename T>
+void testing_ger_multi_bad_arg(const Arguments& arg)
+{
+    testing_ger_multi_template_bad_arg<T, false>(arg);
+}
+
+template <typename T>
+void testing_ger_multi(const Arguments& arg)
+{
+    testing_ger_multi_template<T, false>(arg);
+}
+
+template <typename T>
+void testing_gerc_multi_bad_arg(const Arguments& arg)
+{
+    testing_ger_multi_template_bad_arg<T, true>(arg);
+}
+
+template <typename T>
+void testing_gerc_multi(const Arguments& arg)
+{
+    testing_ger_multi_template<T, true>(arg);
+}
@@ -0,0 +1,366 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// hprk for HERM with a real alpha, hpr2k for HERM and TWO, spr2k for TWO and sprk otherwise
+template <typename T, bool HERM, bool TWO>
+using sprk_scalar_t = std::conditional_t<HERM && !TWO, real_t<T>, T>;
+
+template <typename T, bool HERM, bool TWO, typename U = sprk_scalar_t<T, HERM, TWO>>
+rocblas_status rocblas_sprk_hprk(rocblas_handle handle,
+                                 rocblas_fill   uplo,
+                                 rocblas_int    n,
+                                 rocblas_int    k,
+                                 const U*       alpha,
+                                 const T*       X,
+                                 rocblas_int    ldx,
+                                 rocblas_stride stride_x,
+                                 const T*       Y,
+                                 rocblas_int    ldy,
+                                 rocblas_stride stride_y,
+                                 T*             AP,
+                                 rocblas_stride stride_ap,
+                                 rocblas_int    batch_count)
+{
+    if constexpr(HERM && TWO)
+        return rocblas_hpr2k_strided_batched<T>(handle,
+                                                uplo,
+                                                n,
+                                                k,
+                                                alpha,
+                                                X,
+                                                ldx,
+                                                stride_x,
+                                                Y,
+                                                ldy,
+                                                stride_y,
+                                                AP,
+                                                stride_ap,
+                                                batch_count);
+    else if constexpr(TWO)
+        return rocblas_spr2k_strided_batched<T>(handle,
+                                                uplo,
+                                                n,
+                                                k,
+                                                alpha,
+                                                X,
+                                                ldx,
+                                                stride_x,
+                                                Y,
+                                                ldy,
+                                                stride_y,
+                                                AP,
+                                                stride_ap,
+                                                batch_count);
+    else if constexpr(HERM)
+        return rocblas_hprk_strided_batched<T>(
+            handle, uplo, n, k, alpha, X, ldx, stride_x, AP, stride_ap, batch_count);
+    else
+        return rocblas_sprk_strided_batched<T>(
+            handle, uplo, n, k, alpha, X, ldx, stride_x, AP, stride_ap, batch_count);
+}
+
+// The k updates one after another with the single update reference, column l of X and Y
+// being the vectors of update l
+template <typename T, bool HERM, bool TWO, typename U = sprk_scalar_t<T, HERM, TWO>>
+void ref_sprk_hprk(rocblas_fill uplo,
+                   rocblas_int  n,
+                   rocblas_int  k,
+                   U            alpha,
+                   T*           X,
+                   rocblas_int  ldx,
+                   T*           Y,
+                   rocblas_int  ldy,
+                   T*           AP)
+{
+    for(rocblas_int l = 0; l < k; l++)
+    {
+        T* x = X + size_t(l) * ldx;
+        T* y = TWO ? Y + size_t(l) * ldy : nullptr;
+        if constexpr(HERM && TWO)
+            ref_hpr2<T>(uplo, n, alpha, x, 1, y, 1, AP);
+        else if constexpr(TWO)
+            ref_spr2<T>(uplo, n, alpha, x, 1, y, 1, AP);
+        else if constexpr(HERM)
+            ref_hpr<T>(uplo, n, alpha, x, 1, AP);
+        else
+            ref_spr<T>(uplo, n, alpha, x, 1, AP);
+    }
+}
+
+template <typename T, bool HERM, bool TWO, typename U = sprk_scalar_t<T, HERM, TWO>>
+void testing_sprk_hprk_bad_arg(const Arguments& arg)
+{
+    auto func = rocblas_sprk_hprk<T, HERM, TWO>;
+
+    const rocblas_fill   uplo = rocblas_fill_upper;
+    const rocblas_int    N = 100, K = 10, ldx = 100, ldy = 100, batch_count = 2;
+    const rocblas_stride stride_x = rocblas_stride(ldx) * K, stride_y = rocblas_stride(ldy) * K;
+    const rocblas_stride stride_ap = N * (N + 1) / 2;
+
+    const U alpha = U(2), zero = U(0);
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    device_vector<T> dX(stride_x * batch_count), dY(stride_y * batch_count),
+        dAP(stride_ap * batch_count);
+    CHECK_DEVICE_ALLOCATION(dX.memcheck());
+    CHECK_DEVICE_ALLOCATION(dY.memcheck());
+    CHECK_DEVICE_ALLOCATION(dAP.memcheck());
+
+    // the calls below share the strides and the leading dimension of Y
+    auto call = [&](rocblas_handle h,
+                    rocblas_fill   uplo_,
+                    rocblas_int    n,
+                    rocblas_int    k,
+                    const U*       a,
+                    const T*       X,
+                    rocblas_int    ldx_,
+                    const T*       Y,
+                    T*             AP,
+                    rocblas_int    batch_count_) {
+        return func(
+            h, uplo_, n, k, a, X, ldx_, stride_x, Y, ldy, stride_y, AP, stride_ap, batch_count_);
+    };
+
+    EXPECT_ROCBLAS_STATUS(call(nullptr, uplo, N, K, &alpha, dX, ldx, dY, dAP, batch_count),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, rocblas_fill_full, N, K, &alpha, dX, ldx, dY, dAP, batch_count),
+        rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(call(handle, uplo, -1, K, &alpha, dX, ldx, dY, dAP, batch_count),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, uplo, N, -1, &alpha, dX, ldx, dY, dAP, batch_count),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, uplo, N, K, &alpha, dX, N - 1, dY, dAP, batch_count),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, uplo, N, K, &alpha, dX, ldx, dY, dAP, -1),
+                          rocblas_status_invalid_size);
+    if(TWO)
+        EXPECT_ROCBLAS_STATUS(func(handle,
+                                   uplo,
+                                   N,
+                                   K,
+                                   &alpha,
+                                   dX,
+                                   ldx,
+                                   stride_x,
+                                   dY,
+                                   N - 1,
+                                   stride_y,
+                                   dAP,
+                                   stride_ap,
+                                   batch_count),
+                              rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(call(handle, uplo, N, K, nullptr, dX, ldx, dY, dAP, batch_count),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(call(handle, uplo, N, K, &alpha, nullptr, ldx, dY, dAP, batch_count),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(call(handle, uplo, N, K, &alpha, dX, ldx, dY, nullptr, batch_count),
+                          rocblas_status_invalid_pointer);
+    if(TWO)
+        EXPECT_ROCBLAS_STATUS(
+            call(handle, uplo, N, K, &alpha, dX, ldx, nullptr, dAP, batch_count),
+            rocblas_status_invalid_pointer);
+
+    // quick returns do not read the matrices
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, uplo, 0, K, nullptr, nullptr, ldx, nullptr, nullptr, batch_count),
+        rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, uplo, N, 0, nullptr, nullptr, ldx, nullptr, nullptr, batch_count),
+        rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(call(handle, uplo, N, K, nullptr, nullptr, ldx, nullptr, nullptr, 0),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, uplo, N, K, &zero, nullptr, ldx, nullptr, nullptr, batch_count),
+        rocblas_status_success);
+}
+
+template <typename T, bool HERM, bool TWO, typename U = sprk_scalar_t<T, HERM, TWO>>
+void testing_sprk_hprk(const Arguments& arg)
+{
+    auto func = rocblas_sprk_hprk<T, HERM, TWO>;
+
+    rocblas_fill uplo        = char2rocblas_fill(arg.uplo);
+    rocblas_int  N           = arg.N;
+    rocblas_int  K           = arg.K;
+    rocblas_int  ldx         = arg.lda;
+    rocblas_int  ldy         = TWO ? arg.ldb : ldx;
+    rocblas_int  batch_count = arg.batch_count;
+
+    U h_alpha = arg.get_alpha<U>();
+
+    rocblas_local_handle handle{arg};
+
+    // the batches are padded, so that a stride mistake moves the matrices
+    size_t         size_ap   = size_t(std::max(N, 0)) * (N + 1) / 2;
+    rocblas_stride stride_ap = size_ap + 3;
+    rocblas_stride stride_x  = rocblas_stride(ldx) * std::max(K, 0) + 5;
+    rocblas_stride stride_y  = rocblas_stride(ldy) * std::max(K, 0) + 7;
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = N < 0 || K < 0 || ldx < std::max(N, 1) || (TWO && ldy < std::max(N, 1))
+                        || batch_count < 0;
+    if(invalid_size || !N || !K || !batch_count)
+    {
+        EXPECT_ROCBLAS_STATUS(func(handle,
+                                   uplo,
+                                   N,
+                                   K,
+                                   nullptr,
+                                   nullptr,
+                                   ldx,
+                                   stride_x,
+                                   nullptr,
+                                   ldy,
+                                   stride_y,
+                                   nullptr,
+                                   stride_ap,
+                                   batch_count),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    size_t size_AP = stride_ap * (batch_count - 1) + size_ap;
+    size_t size_X  = stride_x * (batch_count - 1) + size_t(ldx) * K;
+    size_t size_Y  = TWO ? stride_y * (batch_count - 1) + size_t(ldy) * K : 1;
+
+    host_vector<T>   hX(size_X), hY(size_Y), hAP(size_AP), hAP_gold(size_AP), hAP_gpu(size_AP);
+    device_vector<T> dX(size_X), dY(size_Y), dAP(size_AP);
+    device_vector<U> d_alpha(1);
+    CHECK_DEVICE_ALLOCATION(dX.memcheck());
+    CHECK_DEVICE_ALLOCATION(dY.memcheck());
+    CHECK_DEVICE_ALLOCATION(dAP.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+
+    // Integer values keep the sums of the k updates exact, whatever their order
+    rocblas_seedrand();
+    rocblas_init<T>(hX, size_X, 1, size_X);
+    rocblas_init<T>(hY, size_Y, 1, size_Y);
+    rocblas_init<T>(hAP, size_AP, 1, size_AP);
+    hAP_gold = hAP;
+
+    CHECK_HIP_ERROR(dX.transfer_from(hX));
+    CHECK_HIP_ERROR(dY.transfer_from(hY));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(U), hipMemcpyHostToDevice));
+
+    // CPU reference
+    for(rocblas_int b = 0; b < batch_count; b++)
+        ref_sprk_hprk<T, HERM, TWO>(uplo,
+                                    N,
+                                    K,
+                                    h_alpha,
+                                    hX.data() + b * stride_x,
+                                    ldx,
+                                    TWO ? hY.data() + b * stride_y : nullptr,
+                                    ldy,
+                                    hAP_gold.data() + b * stride_ap);
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        if(pointer_mode == rocblas_pointer_mode_host && !arg.pointer_mode_host)
+            continue;
+        if(pointer_mode == rocblas_pointer_mode_device && !arg.pointer_mode_device)
+            continue;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+        CHECK_HIP_ERROR(dAP.transfer_from(hAP));
+
+        CHECK_ROCBLAS_ERROR(func(handle,
+                                 uplo,
+                                 N,
+                                 K,
+                                 pointer_mode == rocblas_pointer_mode_host ? &h_alpha : d_alpha,
+                                 dX,
+                                 ldx,
+                                 stride_x,
+                                 TWO ? (const T*)dY : nullptr,
+                                 ldy,
+                                 stride_y,
+                                 dAP,
+                                 stride_ap,
+                                 batch_count));
+
+        // the padding between the packed matrices is left as it was
+        if(arg.unit_check)
+        {
+            CHECK_HIP_ERROR(hAP_gpu.transfer_from(dAP));
+            unit_check_general<T>(1, size_AP, 1, hAP_gold, hAP_gpu);
+        }
+    }
+}
+
+template <typename T>
+void testing_sprk_strided_batched_bad_arg(const Arguments& arg)
+{
+    testing_sprk_hprk_bad_arg<T, false, false>(arg);
+}
+
+template <typename T>
+void testing_sprk_strided_batched(const Arguments& arg)
+{
+    testing_sprk_hprk<T, false, false>(arg);
+}
+
+template <typename T>
+void testing_hprk_strided_batched_bad_arg(const Arguments& arg)
+{
+    testing_sprk_hprk_bad_arg<T, true, false>(arg);
+}
+
+template <typename T>
+void testing_hprk_strided_batched(const Arguments& arg)
+{
+    testing_sprk_hprk<T, true, false>(arg);
+}
+
+template <typename T>
+void testing_spr2k_strided_batched_bad_arg(const Arguments& arg)
+{
+    testing_sprk_hprk_bad_arg<T, false, true>(arg);
+}
+
+template <typename T>
+void testing_spr2k_strided_batched(const Arguments& arg)
+{
+    testing_sprk_hprk<T, false, true>(arg);
+}
+
+template <typename T>
+void testing_hpr2k_strided_batched_bad_arg(const Arguments& arg)
+{
+    testing_sprk_hprk_bad_arg<T, true, true>(arg);
+}
+
+template <typename T>
+void testing_hpr2k_strided_batched(const Arguments& arg)
+{
+    testing_sprk_hprk<T, true, true>(arg);
+}
@@ -0,0 +1,175 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// hermitize for HERM, symmetrize otherwise
+template <typename T, bool HERM>
+rocblas_status rocblas_symmetrize_hermitize(rocblas_handle handle,
+                                            rocblas_fill   uplo,
+                                            rocblas_int    n,
+                                            T*             A,
+                                            rocblas_int    lda,
+                                            rocblas_stride stride_a,
+                                            rocblas_int    batch_count)
+{
+    if constexpr(HERM)
+        return rocblas_hermitize_strided_batched<T>(handle, uplo, n, A, lda, stride_a, batch_count);
+    else
+        return rocblas_symmetrize_strided_batched<T>(
+            handle, uplo, n, A, lda, stride_a, batch_count);
+}
+
+// The uplo triangle of A is copied, conjugated for HERM, to the other one, and the imaginary
+// part of the diagonal is zeroed for HERM
+template <typename T, bool HERM>
+void ref_symmetrize_hermitize(bool upper, rocblas_int n, T* A, rocblas_int lda)
+{
+    for(rocblas_int j = 0; j < n; j++)
+        for(rocblas_int i = 0; i < n; i++)
+        {
+            T& a = A[i + size_t(j) * lda];
+            if(i == j)
+            {
+                if constexpr(HERM)
+                    a = std::real(a);
+            }
+            else if(upper ? i > j : i < j)
+            {
+                a = A[j + size_t(i) * lda];
+                if constexpr(HERM)
+                    a = conjugate(a);
+            }
+        }
+}
+
+template <typename T, bool HERM>
+void testing_symmetrize_hermitize_bad_arg(const Arguments& arg)
+{
+    auto func = rocblas_symmetrize_hermitize<T, HERM>;
+
+    const rocblas_fill   uplo = rocblas_fill_upper;
+    const rocblas_int    N = 100, lda = 100, batch_count = 2;
+    const rocblas_stride stride_a = rocblas_stride(lda) * N;
+
+    rocblas_local_handle handle{arg};
+
+    device_vector<T> dA(stride_a * batch_count);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(func(nullptr, uplo, N, dA, lda, stride_a, batch_count),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(func(handle, rocblas_fill_full, N, dA, lda, stride_a, batch_count),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(func(handle, uplo, -1, dA, lda, stride_a, batch_count),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(func(handle, uplo, N, dA, N - 1, stride_a, batch_count),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(func(handle, uplo, N, dA, lda, stride_a, -1),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(func(handle, uplo, N, nullptr, lda, stride_a, batch_count),
+                          rocblas_status_invalid_pointer);
+
+    // quick returns do not read or write the matrices
+    EXPECT_ROCBLAS_STATUS(func(handle, uplo, 0, nullptr, lda, stride_a, batch_count),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(func(handle, uplo, N, nullptr, lda, stride_a, 0),
+                          rocblas_status_success);
+}
+
+template <typename T, bool HERM>
+void testing_symmetrize_hermitize(const Arguments& arg)
+{
+    auto func = rocblas_symmetrize_hermitize<T, HERM>;
+
+    rocblas_fill uplo        = char2rocblas_fill(arg.uplo);
+    rocblas_int  N           = arg.N;
+    rocblas_int  lda         = arg.lda;
+    rocblas_int  batch_count = arg.batch_count;
+
+    // the batches are padded, so that a stride mistake moves the matrices
+    rocblas_stride stride_a = rocblas_stride(lda) * std::max(N, 0) + 5;
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = N < 0 || lda < std::max(N, 1) || batch_count < 0;
+    if(invalid_size || !N || !batch_count)
+    {
+        EXPECT_ROCBLAS_STATUS(func(handle, uplo, N, nullptr, lda, stride_a, batch_count),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    size_t size_A = stride_a * (batch_count - 1) + size_t(lda) * N;
+
+    host_vector<T>   hA(size_A), hA_gold(size_A);
+    device_vector<T> dA(size_A);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+
+    // both triangles start with different values, and the diagonal with an imaginary part
+    rocblas_init<T>(hA, size_A, 1, size_A);
+    hA_gold = hA;
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    CHECK_ROCBLAS_ERROR(func(handle, uplo, N, dA, lda, stride_a, batch_count));
+
+    // CPU reference
+    for(rocblas_int b = 0; b < batch_count; b++)
+        ref_symmetrize_hermitize<T, HERM>(
+            uplo == rocblas_fill_upper, N, hA_gold.data() + b * stride_a, lda);
+
+    // the rows below lda and the padding are left as they were
+    if(arg.unit_check)
+    {
+        CHECK_HIP_ERROR(hA.transfer_from(dA));
+        unit_check_general<T>(1, size_A, 1, hA_gold, hA);
+    }
+}
+
+template <typename T>
+void testing_symmetrize_strided_batched_bad_arg(const Arguments& arg)
+{
+    testing_symmetrize_hermitize_bad_arg<T, false>(arg);
+}
+
+template <typename T>
+void testing_symmetrize_strided_batched(const Arguments& arg)
+{
+    testing_symmetrize_hermitize<T, false>(arg);
+}
+
+template <typename T>
+void testing_hermitize_strided_batched_bad_arg(const Arguments& arg)
+{
+    testing_symmetrize_hermitize_bad_arg<T, true>(arg);
+}
+
+template <typename T>
+void testing_hermitize_strided_batched(const Arguments& arg)
+{
+    testing_symmetrize_hermitize<T, true>(arg);
+}
@@ -0,0 +1,180 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// syr_multi for HERM == false, her_multi with the real alpha U for HERM == true
+template <typename T, bool HERM, typename U = std::conditional_t<HERM, real_t<T>, T>>
+rocblas_status rocblas_syr_her_multi(rocblas_handle handle,
+                                     rocblas_fill   uplo,
+                                     rocblas_int    n,
+                                     rocblas_int    k,
+                                     const U*       alpha,
+                                     const T*       X,
+                                     rocblas_int    ldx,
+                                     T*             A,
+                                     rocblas_int    lda)
+{
+    if constexpr(HERM)
+        return rocblas_her_multi<T>(handle, uplo, n, k, alpha, X, ldx, A, lda);
+    else
+        return rocblas_syr_multi<T>(handle, uplo, n, k, alpha, X, ldx, A, lda);
+}
+
+template <typename T, bool HERM>
+void testing_syr_her_multi_bad_arg(const Arguments& arg)
+{
+    using U   = std::conditional_t<HERM, real_t<T>, T>;
+    auto func = rocblas_syr_her_multi<T, HERM>;
+
+    const rocblas_fill uplo = rocblas_fill_upper;
+    const rocblas_int  N = 100, K = 5, ldx = 100, lda = 100;
+
+    const U alpha(1), zero(0);
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    device_vector<T> dX(size_t(ldx) * K), dA(size_t(lda) * N);
+    CHECK_DEVICE_ALLOCATION(dX.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(func(nullptr, uplo, N, K, &alpha, dX, ldx, dA, lda),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(func(handle, rocblas_fill_full, N, K, &alpha, dX, ldx, dA, lda),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(func(handle, uplo, N, -1, &alpha, dX, ldx, dA, lda),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(func(handle, uplo, N, K, &alpha, dX, N - 1, dA, lda),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(func(handle, uplo, N, K, &alpha, dX, ldx, dA, N - 1),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(func(handle, uplo, N, K, nullptr, dX, ldx, dA, lda),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(func(handle, uplo, N, K, &alpha, nullptr, ldx, dA, lda),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(func(handle, uplo, N, K, &alpha, dX, ldx, nullptr, lda),
+                          rocblas_status_invalid_pointer);
+
+    // no update is a quick return, and alpha == 0 reads no matrix
+    EXPECT_ROCBLAS_STATUS(func(handle, uplo, N, 0, nullptr, nullptr, ldx, nullptr, lda),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(func(handle, uplo, N, K, &zero, nullptr, ldx, nullptr, lda),
+                          rocblas_status_success);
+}
+
+template <typename T, bool HERM>
+void testing_syr_her_multi(const Arguments& arg)
+{
+    using U   = std::conditional_t<HERM, real_t<T>, T>;
+    auto func = rocblas_syr_her_multi<T, HERM>;
+
+    rocblas_fill uplo  = char2rocblas_fill(arg.uplo);
+    rocblas_int  N     = arg.N;
+    rocblas_int  K     = arg.K;
+    rocblas_int  ldx   = arg.ldb;
+    rocblas_int  lda   = arg.lda;
+    U            alpha = arg.get_alpha<U>();
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = N < 0 || K < 0 || ldx < std::max(N, 1) || lda < std::max(N, 1);
+    if(invalid_size || !N || !K)
+    {
+        EXPECT_ROCBLAS_STATUS(func(handle, uplo, N, K, nullptr, nullptr, ldx, nullptr, lda),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    size_t size_X = size_t(ldx) * K, size_A = size_t(lda) * N;
+
+    host_vector<T>   hX(size_X), hA(size_A), hA_gold(size_A), hA_gpu(size_A);
+    host_vector<U>   h_alpha(1);
+    device_vector<T> dX(size_X), dA(size_A);
+    device_vector<U> d_alpha(1);
+    CHECK_DEVICE_ALLOCATION(dX.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+
+    rocblas_init<T>(hX, N, K, ldx);
+    rocblas_init<T>(hA, N, N, lda);
+    h_alpha[0] = alpha;
+
+    CHECK_HIP_ERROR(dX.transfer_from(hX));
+    CHECK_HIP_ERROR(d_alpha.transfer_from(h_alpha));
+
+    // CPU BLAS, one rank-1 update per column of X
+    hA_gold = hA;
+    for(rocblas_int j = 0; j < K; j++)
+    {
+        if constexpr(HERM)
+            ref_her<T>(uplo, N, alpha, hX.data() + size_t(j) * ldx, 1, hA_gold, lda);
+        else
+            ref_syr<T>(uplo, N, alpha, hX.data() + size_t(j) * ldx, 1, hA_gold, lda);
+    }
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        if(pointer_mode == rocblas_pointer_mode_host ? !arg.pointer_mode_host
+                                                     : !arg.pointer_mode_device)
+            continue;
+
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        const U* a = pointer_mode == rocblas_pointer_mode_host ? &alpha : (U*)d_alpha;
+        CHECK_ROCBLAS_ERROR(func(handle, uplo, N, K, a, dX, ldx, dA, lda));
+        CHECK_HIP_ERROR(hA_gpu.transfer_from(dA));
+
+        // the other triangle is left as it was
+        if(arg.unit_check)
+            unit_check_general<T>(N, N, lda, hA_gold, hA_gpu);
+    }
+}
+
+template <typename T>
+void testing_syr_multi_bad_arg(const Arguments& arg)
+{
+    testing_syr_her_multi_bad_arg<T, false>(arg);
+}
+
+template <typename T>
+void testing_syr_multi(const Arguments& arg)
+{
+    testing_syr_her_multi<T, false>(arg);
+}
+
+template <typename T>
+void testing_her_multi_bad_arg(const Arguments& arg)
+{
+    testing_syr_her_multi_bad_arg<T, true>(arg);
+}
+
+template <typename T>
+void testing_her_multi(const Arguments& arg)
+{
+    testing_syr_her_multi<T, true>(arg);
+}
@@ -0,0 +1,221 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// tpttr for TO_FULL, trttp otherwise, by the strided batched function or by the single matrix
+// function for a batch of one
+template <typename T, bool TO_FULL, bool STRIDED>
+rocblas_status rocblas_tpttr_trttp(rocblas_handle handle,
+                                   rocblas_fill   uplo,
+                                   rocblas_int    n,
+                                   T*             AP,
+                                   rocblas_stride stride_ap,
+                                   T*             A,
+                                   rocblas_int    lda,
+                                   rocblas_stride stride_a,
+                                   rocblas_int    batch_count)
+{
+    if constexpr(TO_FULL && STRIDED)
+        return rocblas_tpttr_strided_batched<T>(
+            handle, uplo, n, AP, stride_ap, A, lda, stride_a, batch_count);
+    else if constexpr(TO_FULL)
+        return rocblas_tpttr<T>(handle, uplo, n, AP, A, lda);
+    else if constexpr(STRIDED)
+        return rocblas_trttp_strided_batched<T>(
+            handle, uplo, n, A, lda, stride_a, AP, stride_ap, batch_count);
+    else
+        return rocblas_trttp<T>(handle, uplo, n, A, lda, AP);
+}
+
+// The packed columns of the triangle of A, with a leading dimension
+template <typename T, bool TO_FULL>
+void ref_tpttr_trttp(bool upper, rocblas_int n, T* AP, T* A, rocblas_int lda)
+{
+    size_t index = 0;
+    for(rocblas_int j = 0; j < n; j++)
+        for(rocblas_int i = upper ? 0 : j; i < (upper ? j + 1 : n); i++, index++)
+        {
+            if(TO_FULL)
+                A[i + size_t(j) * lda] = AP[index];
+            else
+                AP[index] = A[i + size_t(j) * lda];
+        }
+}
+
+template <typename T, bool TO_FULL, bool STRIDED>
+void testing_tpttr_trttp_bad_arg(const Arguments& arg)
+{
+    auto func = rocblas_tpttr_trttp<T, TO_FULL, STRIDED>;
+
+    const rocblas_fill   uplo = rocblas_fill_upper;
+    const rocblas_int    N = 100, lda = 100, batch_count = STRIDED ? 2 : 1;
+    const rocblas_stride stride_ap = N * (N + 1) / 2, stride_a = rocblas_stride(lda) * N;
+
+    rocblas_local_handle handle{arg};
+
+    device_vector<T> dAP(stride_ap * batch_count), dA(stride_a * batch_count);
+    CHECK_DEVICE_ALLOCATION(dAP.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(func(nullptr, uplo, N, dAP, stride_ap, dA, lda, stride_a, batch_count),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(
+        func(handle, rocblas_fill_full, N, dAP, stride_ap, dA, lda, stride_a, batch_count),
+        rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(func(handle, uplo, -1, dAP, stride_ap, dA, lda, stride_a, batch_count),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(func(handle, uplo, N, dAP, stride_ap, dA, N - 1, stride_a, batch_count),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        func(handle, uplo, N, nullptr, stride_ap, dA, lda, stride_a, batch_count),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        func(handle, uplo, N, dAP, stride_ap, nullptr, lda, stride_a, batch_count),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        func(handle, uplo, 0, nullptr, stride_ap, nullptr, lda, stride_a, batch_count),
+        rocblas_status_success);
+
+    if(STRIDED)
+    {
+        EXPECT_ROCBLAS_STATUS(func(handle, uplo, N, dAP, stride_ap, dA, lda, stride_a, -1),
+                              rocblas_status_invalid_size);
+        EXPECT_ROCBLAS_STATUS(func(handle, uplo, N, nullptr, stride_ap, nullptr, lda, stride_a, 0),
+                              rocblas_status_success);
+    }
+}
+
+template <typename T, bool TO_FULL, bool STRIDED>
+void testing_tpttr_trttp(const Arguments& arg)
+{
+    auto func = rocblas_tpttr_trttp<T, TO_FULL, STRIDED>;
+
+    rocblas_fill uplo        = char2rocblas_fill(arg.uplo);
+    rocblas_int  N           = arg.N;
+    rocblas_int  lda         = arg.lda;
+    rocblas_int  batch_count = STRIDED ? arg.batch_count : 1;
+
+    // the batches are padded, so that a stride mistake moves the triangles
+    size_t         size_ap   = size_t(std::max(N, 0)) * (N + 1) / 2;
+    rocblas_stride stride_ap = STRIDED ? size_ap + 3 : size_ap;
+    rocblas_stride stride_a  = STRIDED ? rocblas_stride(lda) * std::max(N, 0) + 5 : 0;
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = N < 0 || lda < std::max(N, 1) || batch_count < 0;
+    if(invalid_size || !N || !batch_count)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            func(handle, uplo, N, nullptr, stride_ap, nullptr, lda, stride_a, batch_count),
+            invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    size_t size_AP = stride_ap * (batch_count - 1) + size_ap;
+    size_t size_A  = stride_a * (batch_count - 1) + size_t(lda) * N;
+
+    host_vector<T>   hAP(size_AP), hA(size_A), hAP_gold(size_AP), hA_gold(size_A);
+    device_vector<T> dAP(size_AP), dA(size_A);
+    CHECK_DEVICE_ALLOCATION(dAP.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+
+    // the destination starts with other values, so that every element written is checked
+    rocblas_init<T>(hAP, size_AP, 1, size_AP);
+    rocblas_init<T>(hA, size_A, 1, size_A);
+    hAP_gold = hAP;
+    hA_gold  = hA;
+
+    CHECK_HIP_ERROR(dAP.transfer_from(hAP));
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    CHECK_ROCBLAS_ERROR(func(handle, uplo, N, dAP, stride_ap, dA, lda, stride_a, batch_count));
+
+    // CPU reference
+    for(rocblas_int b = 0; b < batch_count; b++)
+        ref_tpttr_trttp<T, TO_FULL>(uplo == rocblas_fill_upper,
+                                    N,
+                                    hAP_gold.data() + b * stride_ap,
+                                    hA_gold.data() + b * stride_a,
+                                    lda);
+
+    // the opposite triangle, the padding and the source are left as they were
+    if(arg.unit_check)
+    {
+        CHECK_HIP_ERROR(hAP.transfer_from(dAP));
+        CHECK_HIP_ERROR(hA.transfer_from(dA));
+        unit_check_general<T>(1, size_AP, 1, hAP_gold, hAP);
+        unit_check_general<T>(1, size_A, 1, hA_gold, hA);
+    }
+}
+
+template <typename T>
+void testing_tpttr_bad_arg(const Arguments& arg)
+{
+    testing_tpttr_trttp_bad_arg<T, true, false>(arg);
+}
+
+template <typename T>
+void testing_tpttr(const Arguments& arg)
+{
+    testing_tpttr_trttp<T, true, false>(arg);
+}
+
+template <typename T>
+void testing_trttp_bad_arg(const Arguments& arg)
+{
+    testing_tpttr_trttp_bad_arg<T, false, false>(arg);
+}
+
+template <typename T>
+void testing_trttp(const Arguments& arg)
+{
+    testing_tpttr_trttp<T, false, false>(arg);
+}
+
+template <typename T>
+void testing_tpttr_strided_batched_bad_arg(const Arguments& arg)
+{
+    testing_tpttr_trttp_bad_arg<T, true, true>(arg);
+}
+
+template <typename T>
+void testing_tpttr_strided_batched(const Arguments& arg)
+{
+    testing_tpttr_trttp<T, true, true>(arg);
+}
+
+template <typename T>
+void testing_trttp_strided_batched_bad_arg(const Arguments& arg)
+{
+    testing_tpttr_trttp_bad_arg<T, false, true>(arg);
+}
+
+template <typename T>
+void testing_trttp_strided_batched(const Arguments& arg)
+{
+    testing_tpttr_trttp<T, false, true>(arg);
+}
@@ -396,7 +396,8 @@ void testing_geam(const Arguments& arg)
         // inplace check for dC == dA
         if(arg.pointer_mode_host)
         {
-            bool invalid_size_in_place = lda != ldc || transA != rocblas_operation_none;
+            bool invalid_size_in_place
+                = lda != ldc || (transA != rocblas_operation_none && M != N);
 
             dC_in_place = dA;
 
@@ -443,7 +444,8 @@ void testing_geam(const Arguments& arg)
         // inplace check for dC == dB
         if(arg.pointer_mode_host)
         {
-            bool invalid_size_in_place = ldb != ldc || transB != rocblas_operation_none;
+            bool invalid_size_in_place
+                = ldb != ldc || (transB != rocblas_operation_none && M != N);
 
             dC_in_place = dB;
 
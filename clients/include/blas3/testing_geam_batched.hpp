@@ -570,7 +570,8 @@ void testing_geam_batched(const Arguments& arg)
         // inplace check for dC == dA
         if(arg.pointer_mode_host)
         {
-            bool invalid_size_in_place = lda != ldc || transA != rocblas_operation_none;
+            bool invalid_size_in_place
+                = lda != ldc || (transA != rocblas_operation_none && M != N);
 
             if((lda == ldc) && (transA == rocblas_operation_none))
                 CHECK_HIP_ERROR(dC_in_place.transfer_from(hA));
@@ -637,7 +638,8 @@ void testing_geam_batched(const Arguments& arg)
         // inplace check for dC == dB
         if(arg.pointer_mode_host)
         {
-            bool invalid_size_in_place = ldb != ldc || transB != rocblas_operation_none;
+            bool invalid_size_in_place
+                = ldb != ldc || (transB != rocblas_operation_none && M != N);
 
             if((ldb == ldc) && (transB == rocblas_operation_none))
                 CHECK_HIP_ERROR(dC_in_place.transfer_from(hB));
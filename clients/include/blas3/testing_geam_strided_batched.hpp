@@ -649,7 +649,8 @@ void testing_geam_strided_batched(const Arguments& arg)
         // inplace check for dC == dA
         if(arg.pointer_mode_host)
         {
-            bool invalid_size_in_place = lda != ldc || transA != rocblas_operation_none;
+            bool invalid_size_in_place
+                = lda != ldc || (transA != rocblas_operation_none && M != N);
 
             if((lda == ldc) && (transA == rocblas_operation_none))
                 CHECK_HIP_ERROR(dC_in_place.transfer_from(hA));
@@ -716,7 +717,8 @@ void testing_geam_strided_batched(const Arguments& arg)
         // inplace check for dC == dB
         if(arg.pointer_mode_host)
         {
-            bool invalid_size_in_place = ldb != ldc || transB != rocblas_operation_none;
+            bool invalid_size_in_place
+                = ldb != ldc || (transB != rocblas_operation_none && M != N);
 
             if((ldb == ldc) && (transB == rocblas_operation_none))
                 CHECK_HIP_ERROR(dC_in_place.transfer_from(hB));
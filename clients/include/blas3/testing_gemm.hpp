@@ -22,8 +22,12 @@
 
 #pragma once
 
+#include "benchmark.hpp"
 #include "blas3/rocblas_gemm.hpp"
+#include "device_reference.hpp"
+#include "freivalds.hpp"
 #include "frequency_monitor.hpp"
+#include "rocblas_device_init.hpp"
 #include "testing_common.hpp"
 
 template <typename T>
@@ -234,10 +238,17 @@ void testing_gemm(const Arguments& arg)
 #endif
 
     // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Without checks, the inputs generated on the device need no host copies
+    bool host_copies = !rocblas_device_init_only<T>(arg,
+                                                    {rocblas_client_alpha_sets_nan,
+                                                     rocblas_client_alpha_sets_nan,
+                                                     rocblas_client_beta_sets_nan});
+    auto host_dim    = [&](int64_t dim) { return host_copies ? dim : 1; };
+
     // Allocate host memory
-    host_matrix<T> hA(A_row, A_col, lda);
-    host_matrix<T> hB(B_row, B_col, ldb);
-    host_matrix<T> hC_1(M, N, ldc);
+    host_matrix<T> hA(host_dim(A_row), host_dim(A_col), host_dim(lda));
+    host_matrix<T> hB(host_dim(B_row), host_dim(B_col), host_dim(ldb));
+    host_matrix<T> hC_1(host_dim(M), host_dim(N), host_dim(ldc));
 
     // Allocate device memory
     device_matrix<T> dA(A_row, A_col, lda, HMM);
@@ -253,17 +264,13 @@ void testing_gemm(const Arguments& arg)
     CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
     CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
 
-    // Initialize data on host memory
-    rocblas_init_matrix(
-        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
-    rocblas_init_matrix(
-        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
-    rocblas_init_matrix(hC_1, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
-
-    // copy data from CPU to device
-    CHECK_HIP_ERROR(dA.transfer_from(hA));
-    CHECK_HIP_ERROR(dB.transfer_from(hB));
-    CHECK_HIP_ERROR(dC.transfer_from(hC_1));
+    // Initialize data on the device or on host memory, and copy it to the other as needed
+    rocblas_init_device_matrix(
+        dA, hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_device_matrix(
+        dB, hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_device_matrix(
+        dC, hC_1, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
 
     if(arg.unit_check || arg.norm_check)
     {
@@ -382,65 +389,151 @@ void testing_gemm(const Arguments& arg)
             type_to_xdl_math_op_type<rocblas_xfloat32, float>(hB.data(), hB.size());
         }
 
-        // now we can recycle gold matrix for reference purposes
-        cpu_time_used = get_time_us_no_sync();
+        // the xf32 rounding of A and B is only done on the host
+        bool device_reference = rocblas_client_device_reference(double(M) * N * K)
+                                && math_mode != rocblas_xf32_xdl_math_op;
+        if(device_reference)
+        {
+            device_matrix<T> dC_gold(M, N, ldc);
+            CHECK_DEVICE_ALLOCATION(dC_gold.memcheck());
+            CHECK_HIP_ERROR(dC_gold.transfer_from(hC_gold));
+
+            cpu_time_used = get_time_us_no_sync();
+
+            device_ref_gemm<T>(transA,
+                               transB,
+                               M,
+                               N,
+                               K,
+                               h_alpha,
+                               dA,
+                               lda,
+                               0,
+                               dB,
+                               ldb,
+                               0,
+                               h_beta,
+                               dC_gold,
+                               ldc,
+                               0,
+                               dC_gold,
+                               ldc,
+                               0);
+
+            cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+            auto device_compare_to_gold = [&] {
+                device_ref_comparison cmp;
+                device_ref_compare(cmp, M, N, (const T*)dC_gold, ldc, 0, (const T*)dC, ldc, 0);
+                if(arg.unit_check)
+                {
+                    if(std::is_same_v<T, rocblas_half>
+                       && (rocblas_handle(handle)->getArchMajor() == 11))
+                        device_near_check(cmp, K * sum_error_tolerance_for_gfx11<T, T, T>);
+                    else if(reduction_requires_near<T>(arg, K))
+                        device_near_check(cmp, K * sum_error_tolerance<T>);
+                    else
+                        device_unit_check<T>(cmp);
+                }
+                return arg.norm_check ? cmp.norm_error : 0.0;
+            };
 
-        ref_gemm<T>(transA, transB, M, N, K, h_alpha, hA, lda, hB, ldb, h_beta, (T*)hC_gold, ldc);
+            // dC holds the device mode results, then the host mode ones
+            if(arg.pointer_mode_device)
+                error_dev_ptr = device_compare_to_gold();
+            if(arg.pointer_mode_host)
+            {
+                CHECK_HIP_ERROR(dC.transfer_from(hC_1));
+                error_hst_ptr = device_compare_to_gold();
+            }
+            rocblas_error = error_dev_ptr > error_hst_ptr ? error_dev_ptr : error_hst_ptr;
+        }
+        else if(rocblas_client_freivalds(double(M) * N * K)
+                && math_mode != rocblas_xf32_xdl_math_op)
+        {
+            // hC_gold holds C before the gemm
+            bool   gfx11_half
+                = std::is_same_v<T, rocblas_half> && rocblas_handle(handle)->getArchMajor() == 11;
+            double eps = gfx11_half ? sum_error_tolerance_for_gfx11<T, T, T> : get_epsilon<T>();
+            auto   freivalds_check = [&] {
+                cpu_time_used = get_time_us_no_sync();
+                double residual = freivalds_gemm<T>(
+                    transA, transB, M, N, K, h_alpha, hA, lda, hB, ldb, h_beta, hC_gold, hC_1, ldc);
+                cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+                if(arg.unit_check)
+                    freivalds_unit_check(residual, (K + 2) * eps);
+                return arg.norm_check ? residual : 0.0;
+            };
+
+            if(arg.pointer_mode_host)
+                error_hst_ptr = freivalds_check();
+            if(arg.pointer_mode_device)
+            {
+                CHECK_HIP_ERROR(hC_1.transfer_from(dC));
+                error_dev_ptr = freivalds_check();
+            }
+            rocblas_error = error_dev_ptr > error_hst_ptr ? error_dev_ptr : error_hst_ptr;
+        }
+        else
+        {
+            // now we can recycle gold matrix for reference purposes
+            cpu_time_used = get_time_us_no_sync();
 
-        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+            ref_gemm<T>(
+                transA, transB, M, N, K, h_alpha, hA, lda, hB, ldb, h_beta, (T*)hC_gold, ldc);
 
-        //releasing already used host memory
-        hA = host_matrix<T>();
-        hB = host_matrix<T>();
+            cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
-        auto compare_to_gold = [&] {
-            if(arg.unit_check)
-            {
-                if(std::is_same_v<T,
-                                  rocblas_half> && (rocblas_handle(handle)->getArchMajor() == 11))
-                {
-                    const double tol = K * sum_error_tolerance_for_gfx11<T, T, T>;
-                    near_check_general<T>(M, N, ldc, hC_gold, hC_1, tol);
-                }
-                else if(reduction_requires_near<T>(arg, K))
+            //releasing already used host memory
+            hA = host_matrix<T>();
+            hB = host_matrix<T>();
+
+            auto compare_to_gold = [&] {
+                if(arg.unit_check)
                 {
-                    const double tol = K * sum_error_tolerance<T>;
-                    near_check_general<T>(M, N, ldc, hC_gold, hC_1, tol);
+                    if(std::is_same_v<T, rocblas_half>
+                       && (rocblas_handle(handle)->getArchMajor() == 11))
+                    {
+                        const double tol = K * sum_error_tolerance_for_gfx11<T, T, T>;
+                        near_check_general<T>(M, N, ldc, hC_gold, hC_1, tol);
+                    }
+                    else if(reduction_requires_near<T>(arg, K))
+                    {
+                        const double tol = K * sum_error_tolerance<T>;
+                        near_check_general<T>(M, N, ldc, hC_gold, hC_1, tol);
+                    }
+                    else
+                    {
+                        unit_check_general<T>(M, N, ldc, hC_gold, hC_1);
+                    }
                 }
-                else
+                double error = 0;
+                if(arg.norm_check)
                 {
-                    unit_check_general<T>(M, N, ldc, hC_gold, hC_1);
+                    error = std::abs(
+                        norm_check_general<T>('F', M, N, ldc, (T*)hC_gold, (T*)hC_1));
                 }
-            }
-            double error = 0;
-            if(arg.norm_check)
+                return error;
+            };
+
+            // check error and norm
+            if(arg.pointer_mode_host)
             {
-                error = std::abs(norm_check_general<T>('F', M, N, ldc, (T*)hC_gold, (T*)hC_1));
+                error_hst_ptr = compare_to_gold();
             }
-            return error;
-        };
-
-        // check error and norm
-        if(arg.pointer_mode_host)
-        {
-            error_hst_ptr = compare_to_gold();
-        }
-        if(arg.pointer_mode_device)
-        {
-            // fetch device mode GPU results
-            CHECK_HIP_ERROR(hC_1.transfer_from(dC));
+            if(arg.pointer_mode_device)
+            {
+                // fetch device mode GPU results
+                CHECK_HIP_ERROR(hC_1.transfer_from(dC));
 
-            error_dev_ptr = compare_to_gold();
+                error_dev_ptr = compare_to_gold();
+            }
+            rocblas_error = error_dev_ptr > error_hst_ptr ? error_dev_ptr : error_hst_ptr;
         }
-        rocblas_error = error_dev_ptr > error_hst_ptr ? error_dev_ptr : error_hst_ptr;
     }
 
     if(arg.timing)
     {
-        double gpu_time_used     = 0.0;
-        int    number_cold_calls = arg.cold_iters;
-        int    total_calls       = number_cold_calls + arg.iters;
-
         CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
 
         hipStream_t stream;
@@ -449,16 +542,16 @@ void testing_gemm(const Arguments& arg)
         FrequencyMonitor& freq_monitor = getFrequencyMonitor();
         freq_monitor.start();
 
-        for(int i = 0; i < total_calls; i++)
-        {
-            if(i == number_cold_calls)
-                gpu_time_used = get_time_us_sync(stream); // in microseconds
-
+        auto lambda_to_benchmark = [&](int) {
             DAPI_DISPATCH(
                 rocblas_gemm_fn,
                 (handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        };
+
+        Benchmark<decltype(lambda_to_benchmark)> benchmark_gemm(
+            lambda_to_benchmark, stream, arg, 1, &handle);
+
+        double gpu_time_used = benchmark_gemm.timer(); // in microseconds
 
         freq_monitor.stop();
 
@@ -24,6 +24,7 @@
 
 #include "blas3/rocblas_gemm.hpp"
 #include "frequency_monitor.hpp"
+#include "rocblas_device_init.hpp"
 #include "testing_common.hpp"
 
 template <typename T>
@@ -264,10 +265,19 @@ void testing_gemm_batched(const Arguments& arg)
 #endif
 
     // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Without checks, the inputs generated on the device need no host copies
+    bool host_copies = !rocblas_device_init_only<T>(arg,
+                                                    {rocblas_client_alpha_sets_nan,
+                                                     rocblas_client_alpha_sets_nan,
+                                                     rocblas_client_beta_sets_nan});
+    // batch matrices with an offset are initialized on the host
+    host_copies   = host_copies || offsetA || offsetB || offsetC;
+    auto host_dim = [&](int64_t dim) { return host_copies ? dim : 1; };
+
     // Allocate host memory
-    host_batch_matrix<T> hA(A_row, A_col, lda, batch_count);
-    host_batch_matrix<T> hB(B_row, B_col, ldb, batch_count);
-    host_batch_matrix<T> hC(M, N, ldc, batch_count);
+    host_batch_matrix<T> hA(host_dim(A_row), host_dim(A_col), host_dim(lda), batch_count);
+    host_batch_matrix<T> hB(host_dim(B_row), host_dim(B_col), host_dim(ldb), batch_count);
+    host_batch_matrix<T> hC(host_dim(M), host_dim(N), host_dim(ldc), batch_count);
     host_vector<T>       halpha(1);
     host_vector<T>       hbeta(1);
     halpha[0] = h_alpha;
@@ -292,16 +302,13 @@ void testing_gemm_batched(const Arguments& arg)
     CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
     CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
 
-    // Initialize data on host memory
-    rocblas_init_matrix(
-        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
-    rocblas_init_matrix(
-        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
-    rocblas_init_matrix(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
-
-    CHECK_HIP_ERROR(dA.transfer_from(hA));
-    CHECK_HIP_ERROR(dB.transfer_from(hB));
-    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    // Initialize data on the device or on host memory, and copy it to the other as needed
+    rocblas_init_device_matrix(
+        dA, hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_device_matrix(
+        dB, hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_device_matrix(
+        dC, hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
 
     if(arg.unit_check || arg.norm_check)
     {
@@ -464,11 +471,10 @@ void testing_gemm_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
-        for(int64_t b = 0; b < batch_count; b++)
-        {
+        ref_batched(batch_count, gemm_gflop_count<T>(M, N, K), [&](int64_t b) {
             ref_gemm<T>(
                 transA, transB, M, N, K, h_alpha, hA[b], lda, hB[b], ldb, h_beta, hC_gold[b], ldc);
-        }
+        });
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
         auto compare_to_gold = [&] {
@@ -0,0 +1,231 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+template <typename T>
+void testing_gemm_host_bad_arg(const Arguments& arg)
+{
+    auto rocblas_gemm_host_fn = rocblas_gemm_host<T>;
+
+    const rocblas_int M = 100, N = 101, K = 102;
+    const rocblas_int lda = 103, ldb = 103, ldc = 103;
+
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_operation transB = rocblas_operation_none;
+
+    const T alpha(1), beta(2);
+
+    rocblas_local_handle handle{arg};
+
+    // all matrices are on the host
+    host_matrix<T> hA(M, K, lda);
+    host_matrix<T> hB(K, N, ldb);
+    host_matrix<T> hC(M, N, ldc);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_host_fn(
+            nullptr, transA, transB, M, N, K, &alpha, hA, lda, hB, ldb, &beta, hC, ldc),
+        rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_host_fn(handle,
+                             (rocblas_operation)rocblas_fill_full,
+                             transB,
+                             M,
+                             N,
+                             K,
+                             &alpha,
+                             hA,
+                             lda,
+                             hB,
+                             ldb,
+                             &beta,
+                             hC,
+                             ldc),
+        rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_host_fn(
+            handle, transA, transB, M, N, K, nullptr, hA, lda, hB, ldb, &beta, hC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_host_fn(
+            handle, transA, transB, M, N, K, &alpha, nullptr, lda, hB, ldb, &beta, hC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_host_fn(
+            handle, transA, transB, M, N, K, &alpha, hA, lda, nullptr, ldb, &beta, hC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_host_fn(
+            handle, transA, transB, M, N, K, &alpha, hA, lda, hB, ldb, &beta, nullptr, ldc),
+        rocblas_status_invalid_pointer);
+
+    // The tiles and the workspace of their gemms must be reserved together; when the
+    // device memory of the handle is too small, the call fails without aborting
+    CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, 1024));
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_host_fn(
+            handle, transA, transB, M, N, K, &alpha, hA, lda, hB, ldb, &beta, hC, ldc),
+        rocblas_status_memory_error);
+}
+
+template <typename T>
+void testing_gemm_host(const Arguments& arg)
+{
+    auto rocblas_gemm_host_fn = rocblas_gemm_host<T>;
+
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    rocblas_int M = arg.M;
+    rocblas_int N = arg.N;
+    rocblas_int K = arg.K;
+
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+    rocblas_int ldc = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    double cpu_time_used;
+    double rocblas_error = 0.0;
+
+    rocblas_local_handle handle{arg};
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : std::max(K, 1);
+    rocblas_int A_col = transA == rocblas_operation_none ? std::max(K, 1) : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? std::max(K, 1) : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : std::max(K, 1);
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_host_fn(handle,
+                                                   transA,
+                                                   transB,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   nullptr,
+                                                   nullptr,
+                                                   lda,
+                                                   nullptr,
+                                                   ldb,
+                                                   nullptr,
+                                                   nullptr,
+                                                   ldc),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Naming: all matrices stay in CPU (host) memory, the library streams them through the device
+    host_matrix<T> hA(A_row, A_col, lda);
+    host_matrix<T> hB(B_row, B_col, ldb);
+    host_matrix<T> hC(M, N, ldc);
+    host_matrix<T> hC_gold(M, N, ldc);
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(
+        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+
+    hC_gold = hC;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_host_fn(
+            handle, transA, transB, M, N, K, &h_alpha, hA, lda, hB, ldb, &h_beta, hC, ldc));
+        handle.post_test(arg);
+
+        // the result is in host memory once the stream of the handle has finished
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+        // reference calculation for golden result
+        cpu_time_used = get_time_us_no_sync();
+        ref_gemm<T>(transA, transB, M, N, K, h_alpha, hA, lda, hB, ldb, h_beta, hC_gold, ldc);
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            if(std::is_same_v<T, rocblas_float_complex> || std::is_same_v<T, float>)
+            {
+                const double tol = K * sum_error_tolerance<T>;
+                near_check_general<T>(M, N, ldc, hC_gold, hC, tol);
+            }
+            else
+            {
+                unit_check_general<T>(M, N, ldc, hC_gold, hC);
+            }
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error = norm_check_general<T>('F', M, N, ldc, hC_gold, hC);
+        }
+    }
+
+    if(arg.timing)
+    {
+        double gpu_time_used;
+        int    number_cold_calls = arg.cold_iters;
+        int    total_calls       = number_cold_calls + arg.iters;
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+        for(int iter = 0; iter < total_calls; iter++)
+        {
+            if(iter == number_cold_calls)
+                gpu_time_used = get_time_us_sync(stream);
+
+            rocblas_gemm_host_fn(
+                handle, transA, transB, M, N, K, &h_alpha, hA, lda, hB, ldb, &h_beta, hC, ldc);
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+
+        ArgumentModel<e_transA, e_transB, e_M, e_N, e_K, e_alpha, e_lda, e_beta, e_ldb, e_ldc>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         gemm_gflop_count<T>(M, N, K),
+                         ArgumentLogging::NA_value,
+                         cpu_time_used,
+                         rocblas_error);
+    }
+}
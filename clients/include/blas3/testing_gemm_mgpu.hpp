@@ -0,0 +1,343 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// The link bandwidth assumed by the multi-GPU APIs is read once; a fast link makes them split
+// even the small problems of the tests over the devices, unless the environment sets another
+inline void rocblas_mgpu_test_split_small_problems()
+{
+    setenv("ROCBLAS_MGPU_LINK_GBPS", "1000000", 0);
+}
+
+template <typename T>
+void testing_gemm_mgpu_bad_arg(const Arguments& arg)
+{
+    auto rocblas_gemm_mgpu_fn = rocblas_gemm_mgpu<T>;
+
+    const rocblas_int M = 100, N = 101, K = 102;
+    const rocblas_int lda = 103, ldb = 103, ldc = 103;
+
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_operation transB = rocblas_operation_none;
+
+    const T alpha(1), beta(2);
+
+    rocblas_local_mgpu_handles handles{arg, 1};
+    rocblas_handle             handle = handles[0];
+    const rocblas_handle*      hs     = handles.data();
+
+    device_matrix<T> dA(M, K, lda);
+    device_matrix<T> dB(K, N, ldb);
+    device_matrix<T> dC(M, N, ldc);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_mgpu_fn(
+            nullptr, 1, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_mgpu_fn(
+            hs, 0, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_handle);
+
+    const rocblas_handle with_null[] = {handle, nullptr};
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_mgpu_fn(
+            with_null, 2, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_handle);
+
+    // every handle must be on a device of its own
+    const rocblas_handle same_device[] = {handle, handle};
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_mgpu_fn(
+            same_device, 2, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_mgpu_fn(hs,
+                                               1,
+                                               (rocblas_operation)rocblas_fill_full,
+                                               transB,
+                                               M,
+                                               N,
+                                               K,
+                                               &alpha,
+                                               dA,
+                                               lda,
+                                               dB,
+                                               ldb,
+                                               &beta,
+                                               dC,
+                                               ldc),
+                          rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_mgpu_fn(
+            hs, 1, transA, transB, M, N, K, nullptr, dA, lda, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_mgpu_fn(
+            hs, 1, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, nullptr, dC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_mgpu_fn(
+            hs, 1, transA, transB, M, N, K, &alpha, nullptr, lda, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_mgpu_fn(
+            hs, 1, transA, transB, M, N, K, &alpha, dA, lda, nullptr, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_mgpu_fn(
+            hs, 1, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, nullptr, ldc),
+        rocblas_status_invalid_pointer);
+
+    // The workspace of each device is taken when the problem is split, so a device memory size
+    // query of the first handle reports none
+    size_t size = 1;
+    CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_mgpu_fn(
+            hs, 1, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc),
+        rocblas_status_size_unchanged);
+    CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+    EXPECT_EQ(size, 0u);
+}
+
+template <typename T>
+void testing_gemm_mgpu(const Arguments& arg)
+{
+    auto rocblas_gemm_mgpu_fn = rocblas_gemm_mgpu<T>;
+
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    rocblas_int M = arg.M;
+    rocblas_int N = arg.N;
+    rocblas_int K = arg.K;
+
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+    rocblas_int ldc = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    double cpu_time_used;
+    double rocblas_error = 0.0;
+
+    // arg.devices limits the number of devices used, a single one or all visible ones
+    int max_devices = arg.devices ? arg.devices : std::numeric_limits<int>::max();
+
+    rocblas_mgpu_test_split_small_problems();
+    rocblas_local_mgpu_handles handles{arg, max_devices};
+    rocblas_handle             handle = handles[0];
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : std::max(K, 1);
+    rocblas_int A_col = transA == rocblas_operation_none ? std::max(K, 1) : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? std::max(K, 1) : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : std::max(K, 1);
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_mgpu_fn(handles.data(),
+                                                   handles.size(),
+                                                   transA,
+                                                   transB,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   nullptr,
+                                                   nullptr,
+                                                   lda,
+                                                   nullptr,
+                                                   ldb,
+                                                   nullptr,
+                                                   nullptr,
+                                                   ldc),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory of the first handle. hK is in CPU (host) memory
+    host_matrix<T> hA(A_row, A_col, lda);
+    host_matrix<T> hB(B_row, B_col, ldb);
+    host_matrix<T> hC(M, N, ldc);
+    host_matrix<T> hC_gold(M, N, ldc);
+
+    device_matrix<T> dA(A_row, A_col, lda);
+    device_matrix<T> dB(B_row, B_col, ldb);
+    device_matrix<T> dC(M, N, ldc);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(
+        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+
+    hC_gold = hC;
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // reference calculation for golden result
+        cpu_time_used = get_time_us_no_sync();
+        ref_gemm<T>(transA, transB, M, N, K, h_alpha, hA, lda, hB, ldb, h_beta, hC_gold, ldc);
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // alpha and beta are host pointers in both pointer modes, which are left unchanged
+        auto run = [&](rocblas_pointer_mode mode) {
+            for(rocblas_int d = 0; d < handles.size(); ++d)
+            {
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handles[d], mode));
+                CHECK_ROCBLAS_ERROR(rocblas_reset_handle_stats(handles[d]));
+            }
+
+            host_matrix<T> hC_result(M, N, ldc);
+            CHECK_HIP_ERROR(dC.transfer_from(hC));
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_mgpu_fn(handles.data(),
+                                                     handles.size(),
+                                                     transA,
+                                                     transB,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     &h_alpha,
+                                                     dA,
+                                                     lda,
+                                                     dB,
+                                                     ldb,
+                                                     &h_beta,
+                                                     dC,
+                                                     ldc));
+
+            // the stream of the first handle waits for the other devices
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+            CHECK_HIP_ERROR(hC_result.transfer_from(dC));
+
+            for(rocblas_int d = 0; d < handles.size(); ++d)
+            {
+                rocblas_pointer_mode handle_mode;
+                CHECK_ROCBLAS_ERROR(rocblas_get_pointer_mode(handles[d], &handle_mode));
+                EXPECT_EQ(handle_mode, mode);
+
+                // devices without peer access to the first device are not used
+                int can_access = 0;
+                if(d)
+                    CHECK_HIP_ERROR(hipDeviceCanAccessPeer(
+                        &can_access, handles.device(d), handles.device(0)));
+                if(d && !can_access)
+                {
+                    rocblas_handle_stats stats;
+                    CHECK_ROCBLAS_ERROR(rocblas_get_handle_stats(handles[d], &stats));
+                    EXPECT_EQ(stats.kernel_launches, 0u);
+                }
+            }
+
+            if(arg.unit_check)
+            {
+                if(std::is_same_v<T, rocblas_float_complex> || std::is_same_v<T, float>)
+                {
+                    const double tol = K * sum_error_tolerance<T>;
+                    near_check_general<T>(M, N, ldc, hC_gold, hC_result, tol);
+                }
+                else
+                {
+                    unit_check_general<T>(M, N, ldc, hC_gold, hC_result);
+                }
+            }
+
+            if(arg.norm_check)
+            {
+                rocblas_error = std::max(
+                    rocblas_error, norm_check_general<T>('F', M, N, ldc, hC_gold, hC_result));
+            }
+        };
+
+        if(arg.pointer_mode_host)
+            run(rocblas_pointer_mode_host);
+        if(arg.pointer_mode_device)
+            run(rocblas_pointer_mode_device);
+    }
+
+    if(arg.timing)
+    {
+        double gpu_time_used;
+        int    number_cold_calls = arg.cold_iters;
+        int    total_calls       = number_cold_calls + arg.iters;
+
+        for(int iter = 0; iter < total_calls; iter++)
+        {
+            if(iter == number_cold_calls)
+                gpu_time_used = get_time_us_sync(stream);
+
+            rocblas_gemm_mgpu_fn(handles.data(),
+                                 handles.size(),
+                                 transA,
+                                 transB,
+                                 M,
+                                 N,
+                                 K,
+                                 &h_alpha,
+                                 dA,
+                                 lda,
+                                 dB,
+                                 ldb,
+                                 &h_beta,
+                                 dC,
+                                 ldc);
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+
+        ArgumentModel<e_transA, e_transB, e_M, e_N, e_K, e_alpha, e_lda, e_beta, e_ldb, e_ldc>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         gemm_gflop_count<T>(M, N, K),
+                         ArgumentLogging::NA_value,
+                         cpu_time_used,
+                         rocblas_error);
+    }
+}
@@ -0,0 +1,197 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+template <typename T>
+void testing_gemm_ozaki_bad_arg(const Arguments& arg)
+{
+    rocblas_local_handle handle{arg};
+
+    rocblas_int slices = 0;
+    EXPECT_ROCBLAS_STATUS(rocblas_get_ozaki_slices(handle, &slices), rocblas_status_success);
+    EXPECT_EQ(slices, 7);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_set_ozaki_slices(nullptr, 4), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_ozaki_slices(nullptr, &slices),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_ozaki_slices(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // slices out of range leave the handle unchanged
+    EXPECT_ROCBLAS_STATUS(rocblas_set_ozaki_slices(handle, 0), rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_set_ozaki_slices(handle, 9), rocblas_status_invalid_value);
+    CHECK_ROCBLAS_ERROR(rocblas_get_ozaki_slices(handle, &slices));
+    EXPECT_EQ(slices, 7);
+
+    for(rocblas_int s = 1; s <= 8; s++)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_ozaki_slices(handle, s));
+        CHECK_ROCBLAS_ERROR(rocblas_get_ozaki_slices(handle, &slices));
+        EXPECT_EQ(slices, s);
+    }
+
+    rocblas_math_mode math_mode = rocblas_default_math;
+    CHECK_ROCBLAS_ERROR(rocblas_set_math_mode(handle, rocblas_dgemm_ozaki_math_op));
+    CHECK_ROCBLAS_ERROR(rocblas_get_math_mode(handle, &math_mode));
+    EXPECT_EQ(math_mode, rocblas_dgemm_ozaki_math_op);
+}
+
+template <typename T>
+void testing_gemm_ozaki(const Arguments& arg)
+{
+    auto rocblas_gemm_fn = rocblas_gemm<T>;
+
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+    rocblas_int       M      = arg.M;
+    rocblas_int       N      = arg.N;
+    rocblas_int       K      = arg.K;
+    rocblas_int       lda    = arg.lda;
+    rocblas_int       ldb    = arg.ldb;
+    rocblas_int       ldc    = arg.ldc;
+    rocblas_int       slices = arg.algo;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_math_mode(handle, rocblas_dgemm_ozaki_math_op));
+    CHECK_ROCBLAS_ERROR(rocblas_set_ozaki_slices(handle, slices));
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : K;
+    rocblas_int A_col = transA == rocblas_operation_none ? K : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? K : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : K;
+
+    // the sizes are valid, see testing_gemm for the argument checks shared with dgemm
+    size_t size_A = size_t(lda) * A_col;
+    size_t size_B = size_t(ldb) * B_col;
+    size_t size_C = size_t(ldc) * N;
+
+    host_vector<T>   hA(size_A), hB(size_B), hC(size_C), hC_gold(size_C), hC_gpu(size_C);
+    device_vector<T> dA(size_A), dB(size_B), dC(size_C), d_alpha(1), d_beta(1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // values spread over all the bits of a double, which a few slices do not hold exactly
+    rocblas_seedrand();
+    for(auto& a : hA)
+        a = random_hpl_generator<T>();
+    for(auto& b : hB)
+        b = random_hpl_generator<T>();
+    for(auto& c : hC)
+        c = random_hpl_generator<T>();
+    hC_gold = hC;
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // the size query reports the workspace of the scheme
+    size_t size_ozaki = size_t(slices) * (size_t(M) * K + size_t(K) * N)
+                        + size_t(M) * N * (sizeof(int32_t) + sizeof(double))
+                        + size_t(M + N) * sizeof(int);
+    size_t size;
+    CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+    CHECK_ALLOC_QUERY(rocblas_gemm_fn(
+        handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+    CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+    EXPECT_GE(size, size_ozaki);
+
+    if(!ROCBLAS_REALLOC_ON_DEMAND)
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+
+    // CPU reference
+    ref_gemm<T>(transA, transB, M, N, K, h_alpha, hA, lda, hB, ldb, h_beta, hC_gold, ldc);
+
+    // Each slice holds 7 bits of the elements of op(A) and op(B), scaled by the largest
+    // of their row or column, and the products of the slices dropped by the scheme are smaller
+    // still. The rest is the rounding of a dgemm.
+    double max_a = 0, max_b = 0, max_c = 0;
+    for(rocblas_int j = 0; j < A_col; j++)
+        for(rocblas_int i = 0; i < A_row; i++)
+            max_a = std::max(max_a, std::abs(hA[i + size_t(j) * lda]));
+    for(rocblas_int j = 0; j < B_col; j++)
+        for(rocblas_int i = 0; i < B_row; i++)
+            max_b = std::max(max_b, std::abs(hB[i + size_t(j) * ldb]));
+    for(rocblas_int j = 0; j < N; j++)
+        for(rocblas_int i = 0; i < M; i++)
+            max_c = std::max(max_c, std::abs(hC[i + size_t(j) * ldc]));
+
+    double eps       = std::numeric_limits<T>::epsilon();
+    double dgemm_err = eps * (K * max_a * max_b * std::abs(h_alpha) + std::abs(h_beta) * max_c);
+    double ozaki_err = std::ldexp(slices + 3.0, 2 - 7 * slices) * K * max_a * max_b;
+    double tolerance = ozaki_err * std::abs(h_alpha) + 2 * dgemm_err;
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        if(pointer_mode == rocblas_pointer_mode_host && !arg.pointer_mode_host)
+            continue;
+        if(pointer_mode == rocblas_pointer_mode_device && !arg.pointer_mode_device)
+            continue;
+
+        bool host = pointer_mode == rocblas_pointer_mode_host;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_fn(handle,
+                                            transA,
+                                            transB,
+                                            M,
+                                            N,
+                                            K,
+                                            host ? &h_alpha : d_alpha,
+                                            dA,
+                                            lda,
+                                            dB,
+                                            ldb,
+                                            host ? &h_beta : d_beta,
+                                            dC,
+                                            ldc));
+        CHECK_HIP_ERROR(hC_gpu.transfer_from(dC));
+
+        if(arg.unit_check)
+        {
+            near_check_general<T>(M, N, ldc, hC_gold, hC_gpu, tolerance);
+
+            // a single slice is far less accurate than dgemm, which shows the scheme was used
+            if(slices == 1 && h_alpha != 0)
+            {
+                double max_err = 0;
+                for(rocblas_int j = 0; j < N; j++)
+                    for(rocblas_int i = 0; i < M; i++)
+                        max_err = std::max(max_err,
+                                           std::abs(hC_gpu[i + size_t(j) * ldc]
+                                                    - hC_gold[i + size_t(j) * ldc]));
+                EXPECT_GT(max_err, 100 * dgemm_err);
+            }
+        }
+    }
+}
@@ -358,10 +358,9 @@ void testing_herk_batched(const Arguments& arg)
         cpu_time_used = get_time_us_no_sync();
 
         // cpu reference
-        for(size_t b = 0; b < batch_count; b++)
-        {
+        ref_batched(batch_count, herk_gflop_count<T>(N, K), [&](int64_t b) {
             ref_herk<T>(uplo, transA, N, K, h_alpha[0], hA[b], lda, h_beta[0], hC_gold[b], ldc);
-        }
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include "freivalds.hpp"
 #include "testing_common.hpp"
 
 template <typename T>
@@ -300,60 +301,84 @@ void testing_syrk(const Arguments& arg)
             }
         }
 
-        // CPU BLAS
-        cpu_time_used = get_time_us_no_sync();
+        if(rocblas_client_freivalds(double(N) * N * K))
+        {
+            // hC_gold holds C before the syrk
+            auto freivalds_check = [&] {
+                cpu_time_used   = get_time_us_no_sync();
+                double residual = freivalds_syrk<T>(
+                    uplo, transA, N, K, h_alpha[0], hA, lda, h_beta[0], hC_gold, hC, ldc);
+                cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+                if(arg.unit_check)
+                    freivalds_unit_check(residual, (K + 2) * get_epsilon<T>());
+                return arg.norm_check ? residual : 0.0;
+            };
+
+            if(arg.pointer_mode_host)
+                error_host = freivalds_check();
+            if(arg.pointer_mode_device)
+            {
+                CHECK_HIP_ERROR(hC.transfer_from(dC));
+                error_device = freivalds_check();
+            }
+        }
+        else
+        {
+            // CPU BLAS
+            cpu_time_used = get_time_us_no_sync();
 
-        ref_syrk<T>(uplo, transA, N, K, h_alpha[0], hA, lda, h_beta[0], hC_gold, ldc);
+            ref_syrk<T>(uplo, transA, N, K, h_alpha[0], hA, lda, h_beta[0], hC_gold, ldc);
 
-        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+            cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
-        if(arg.pointer_mode_host)
-        {
-            if(arg.unit_check)
+            if(arg.pointer_mode_host)
             {
-                if(std::is_same_v<
-                       T,
-                       rocblas_float_complex> || std::is_same_v<T, rocblas_double_complex>)
+                if(arg.unit_check)
                 {
-                    const double tol = K * sum_error_tolerance<T>;
-                    near_check_general<T>(N, N, ldc, hC_gold, hC, tol);
+                    if(std::is_same_v<
+                           T,
+                           rocblas_float_complex> || std::is_same_v<T, rocblas_double_complex>)
+                    {
+                        const double tol = K * sum_error_tolerance<T>;
+                        near_check_general<T>(N, N, ldc, hC_gold, hC, tol);
+                    }
+                    else
+                    {
+                        unit_check_general<T>(N, N, ldc, hC_gold, hC);
+                    }
                 }
-                else
+
+                if(arg.norm_check)
                 {
-                    unit_check_general<T>(N, N, ldc, hC_gold, hC);
+                    error_host = std::abs(norm_check_general<T>('F', N, N, ldc, hC_gold, hC));
                 }
             }
 
-            if(arg.norm_check)
+            if(arg.pointer_mode_device)
             {
-                error_host = std::abs(norm_check_general<T>('F', N, N, ldc, hC_gold, hC));
-            }
-        }
-
-        if(arg.pointer_mode_device)
-        {
-            // copy output from device to CPU
-            CHECK_HIP_ERROR(hC.transfer_from(dC));
+                // copy output from device to CPU
+                CHECK_HIP_ERROR(hC.transfer_from(dC));
 
-            if(arg.unit_check)
-            {
-                if(std::is_same_v<
-                       T,
-                       rocblas_float_complex> || std::is_same_v<T, rocblas_double_complex>)
+                if(arg.unit_check)
                 {
-                    const double tol = K * sum_error_tolerance<T>;
-                    near_check_general<T>(N, N, ldc, hC_gold, hC, tol);
+                    if(std::is_same_v<
+                           T,
+                           rocblas_float_complex> || std::is_same_v<T, rocblas_double_complex>)
+                    {
+                        const double tol = K * sum_error_tolerance<T>;
+                        near_check_general<T>(N, N, ldc, hC_gold, hC, tol);
+                    }
+                    else
+                    {
+                        unit_check_general<T>(N, N, ldc, hC_gold, hC);
+                    }
                 }
-                else
+
+                if(arg.norm_check)
                 {
-                    unit_check_general<T>(N, N, ldc, hC_gold, hC);
+                    error_device = std::abs(norm_check_general<T>('F', N, N, ldc, hC_gold, hC));
                 }
             }
-
-            if(arg.norm_check)
-            {
-                error_device = std::abs(norm_check_general<T>('F', N, N, ldc, hC_gold, hC));
-            }
         }
     }
 
@@ -0,0 +1,346 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// herk_diag for HERM, with real alpha, beta and weights, and syrk_diag otherwise
+template <typename T, bool HERM>
+using syrk_diag_scalar_t = std::conditional_t<HERM, real_t<T>, T>;
+
+template <typename T, bool HERM, typename U = syrk_diag_scalar_t<T, HERM>>
+rocblas_status rocblas_syrk_herk_diag(rocblas_handle    handle,
+                                      rocblas_fill      uplo,
+                                      rocblas_operation transA,
+                                      rocblas_int       n,
+                                      rocblas_int       k,
+                                      const U*          alpha,
+                                      const T*          A,
+                                      rocblas_int       lda,
+                                      const U*          d,
+                                      rocblas_int       incd,
+                                      const U*          beta,
+                                      T*                C,
+                                      rocblas_int       ldc)
+{
+    if constexpr(HERM)
+        return rocblas_herk_diag<T>(
+            handle, uplo, transA, n, k, alpha, A, lda, d, incd, beta, C, ldc);
+    else
+        return rocblas_syrk_diag<T>(
+            handle, uplo, transA, n, k, alpha, A, lda, d, incd, beta, C, ldc);
+}
+
+// C = alpha * op(A) * diag(d) * op(A)**T + beta * C in the uplo triangle, with **H and a real
+// diagonal for HERM
+template <typename T, bool HERM, typename U = syrk_diag_scalar_t<T, HERM>>
+void ref_syrk_herk_diag(rocblas_fill      uplo,
+                        rocblas_operation transA,
+                        rocblas_int       n,
+                        rocblas_int       k,
+                        U                 alpha,
+                        const T*          A,
+                        rocblas_int       lda,
+                        const U*          d,
+                        rocblas_int       incd,
+                        U                 beta,
+                        T*                C,
+                        rocblas_int       ldc)
+{
+    if((!k || alpha == U(0)) && beta == U(1))
+        return;
+
+    bool     trans = transA != rocblas_operation_none;
+    const U* d0    = incd < 0 ? d - int64_t(k - 1) * incd : d;
+
+    // element l of row r of op(A)
+    auto op_a = [&](int64_t r, int64_t l) {
+        T a = trans ? A[l + r * lda] : A[r + l * lda];
+        return HERM && trans ? conjugate(a) : a;
+    };
+
+    for(int64_t j = 0; j < n; j++)
+        for(int64_t i = uplo == rocblas_fill_upper ? 0 : j;
+            i < (uplo == rocblas_fill_upper ? j + 1 : n);
+            i++)
+        {
+            T sum = 0;
+            if(alpha != U(0))
+                for(int64_t l = 0; l < k; l++)
+                {
+                    T b = op_a(j, l);
+                    sum += op_a(i, l) * d0[l * incd] * (HERM ? conjugate(b) : b);
+                }
+
+            T& c = C[i + j * ldc];
+            c    = beta == U(0) ? alpha * sum : alpha * sum + beta * c;
+            if(HERM && i == j)
+                c = std::real(c);
+        }
+}
+
+template <typename T, bool HERM>
+void testing_syrk_herk_diag_bad_arg(const Arguments& arg)
+{
+    using U   = syrk_diag_scalar_t<T, HERM>;
+    auto func = rocblas_syrk_herk_diag<T, HERM>;
+
+    const rocblas_fill      uplo   = rocblas_fill_upper;
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_int       N = 100, K = 100, lda = 100, incd = 1, ldc = 100;
+    const U                 alpha = 1, beta = 1, zero = 0, one = 1;
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    device_matrix<T> dA(N, K, lda), dC(N, N, ldc);
+    device_vector<U> dd(K, incd);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dd.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(
+        func(nullptr, uplo, transA, N, K, &alpha, dA, lda, dd, incd, &beta, dC, ldc),
+        rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(
+        func(handle, rocblas_fill_full, transA, N, K, &alpha, dA, lda, dd, incd, &beta, dC, ldc),
+        rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(func(handle,
+                               uplo,
+                               (rocblas_operation)rocblas_fill_full,
+                               N,
+                               K,
+                               &alpha,
+                               dA,
+                               lda,
+                               dd,
+                               incd,
+                               &beta,
+                               dC,
+                               ldc),
+                          rocblas_status_invalid_value);
+
+    // complex syrk has no conjugate transpose, and herk no transpose
+    if(rocblas_is_complex<T>)
+    {
+        rocblas_operation invalid_trans
+            = HERM ? rocblas_operation_transpose : rocblas_operation_conjugate_transpose;
+        EXPECT_ROCBLAS_STATUS(
+            func(handle, uplo, invalid_trans, N, K, &alpha, dA, lda, dd, incd, &beta, dC, ldc),
+            rocblas_status_invalid_value);
+    }
+
+    EXPECT_ROCBLAS_STATUS(
+        func(handle, uplo, transA, -1, K, &alpha, dA, lda, dd, incd, &beta, dC, ldc),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        func(handle, uplo, transA, N, -1, &alpha, dA, lda, dd, incd, &beta, dC, ldc),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        func(handle, uplo, transA, N, K, &alpha, dA, N - 1, dd, incd, &beta, dC, ldc),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        func(handle, uplo, transA, N, K, &alpha, dA, lda, dd, 0, &beta, dC, ldc),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        func(handle, uplo, transA, N, K, &alpha, dA, lda, dd, incd, &beta, dC, N - 1),
+        rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(
+        func(handle, uplo, transA, N, K, nullptr, dA, lda, dd, incd, &beta, dC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        func(handle, uplo, transA, N, K, &alpha, dA, lda, dd, incd, nullptr, dC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        func(handle, uplo, transA, N, K, &alpha, nullptr, lda, dd, incd, &beta, dC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        func(handle, uplo, transA, N, K, &alpha, dA, lda, nullptr, incd, &beta, dC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        func(handle, uplo, transA, N, K, &alpha, dA, lda, dd, incd, &beta, nullptr, ldc),
+        rocblas_status_invalid_pointer);
+
+    // quick returns do not read the matrices or the weights
+    EXPECT_ROCBLAS_STATUS(func(handle,
+                               uplo,
+                               transA,
+                               0,
+                               K,
+                               nullptr,
+                               nullptr,
+                               lda,
+                               nullptr,
+                               incd,
+                               nullptr,
+                               nullptr,
+                               ldc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(
+        func(handle, uplo, transA, N, K, &zero, nullptr, lda, nullptr, incd, &one, nullptr, ldc),
+        rocblas_status_success);
+
+    // A and d are not read when alpha == 0
+    EXPECT_ROCBLAS_STATUS(
+        func(handle, uplo, transA, N, K, &zero, nullptr, lda, nullptr, incd, &beta, dC, ldc),
+        rocblas_status_success);
+}
+
+template <typename T, bool HERM>
+void testing_syrk_herk_diag(const Arguments& arg)
+{
+    using U   = syrk_diag_scalar_t<T, HERM>;
+    auto func = rocblas_syrk_herk_diag<T, HERM>;
+
+    rocblas_fill      uplo   = char2rocblas_fill(arg.uplo);
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_int       N      = arg.N;
+    rocblas_int       K      = arg.K;
+    rocblas_int       lda    = arg.lda;
+    rocblas_int       incd   = arg.incx;
+    rocblas_int       ldc    = arg.ldc;
+
+    U h_alpha = arg.get_alpha<U>();
+    U h_beta  = arg.get_beta<U>();
+
+    rocblas_local_handle handle{arg};
+
+    rocblas_int A_row = transA == rocblas_operation_none ? N : K;
+    rocblas_int A_col = transA == rocblas_operation_none ? K : N;
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size
+        = N < 0 || K < 0 || !incd || ldc < std::max(N, 1) || lda < std::max(A_row, 1);
+    if(invalid_size || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(func(handle,
+                                   uplo,
+                                   transA,
+                                   N,
+                                   K,
+                                   nullptr,
+                                   nullptr,
+                                   lda,
+                                   nullptr,
+                                   incd,
+                                   nullptr,
+                                   nullptr,
+                                   ldc),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    host_matrix<T> hA(A_row, A_col, lda);
+    host_vector<U> hd(K, incd);
+    host_matrix<T> hC(N, N, ldc), hC_gold(N, N, ldc), hC_gpu(N, N, ldc);
+
+    device_matrix<T> dA(A_row, A_col, lda);
+    device_vector<U> dd(K, incd);
+    device_matrix<T> dC(N, N, ldc);
+    device_vector<U> d_alpha(1), d_beta(1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dd.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_vector(hd, arg, rocblas_client_alpha_sets_nan, false);
+    rocblas_init_matrix(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+    hC_gold = hC;
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dd.transfer_from(hd));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(U), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(U), hipMemcpyHostToDevice));
+
+    ref_syrk_herk_diag<T, HERM>(
+        uplo, transA, N, K, h_alpha, hA, lda, hd, incd, h_beta, hC_gold, ldc);
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        if(pointer_mode == rocblas_pointer_mode_host && !arg.pointer_mode_host)
+            continue;
+        if(pointer_mode == rocblas_pointer_mode_device && !arg.pointer_mode_device)
+            continue;
+
+        bool host = pointer_mode == rocblas_pointer_mode_host;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        CHECK_ROCBLAS_ERROR(func(handle,
+                                 uplo,
+                                 transA,
+                                 N,
+                                 K,
+                                 host ? &h_alpha : d_alpha,
+                                 dA,
+                                 lda,
+                                 dd,
+                                 incd,
+                                 host ? &h_beta : d_beta,
+                                 dC,
+                                 ldc));
+        CHECK_HIP_ERROR(hC_gpu.transfer_from(dC));
+
+        // the opposite triangle is not written, so the whole of C is compared
+        if(arg.unit_check)
+        {
+            if(arg.initialization == rocblas_initialization::hpl)
+            {
+                double tol = K * sum_error_tolerance<T>;
+                near_check_general<T>(N, N, ldc, hC_gold, hC_gpu, tol);
+            }
+            else
+                unit_check_general<T>(N, N, ldc, hC_gold, hC_gpu);
+        }
+    }
+}
+
+template <typename T>
+void testing_syrk_diag_bad_arg(const Arguments& arg)
+{
+    testing_syrk_herk_diag_bad_arg<T, false>(arg);
+}
+
+template <typename T>
+void testing_syrk_diag(const Arguments& arg)
+{
+    testing_syrk_herk_diag<T, false>(arg);
+}
+
+template <typename T>
+void testing_herk_diag_bad_arg(const Arguments& arg)
+{
+    testing_syrk_herk_diag_bad_arg<T, true>(arg);
+}
+
+template <typename T>
+void testing_herk_diag(const Arguments& arg)
+{
+    testing_syrk_herk_diag<T, true>(arg);
+}
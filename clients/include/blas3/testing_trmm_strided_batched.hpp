@@ -806,10 +806,9 @@ void testing_trmm_strided_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
-        for(int64_t b = 0; b < batch_count; b++)
-        {
+        ref_batched(batch_count, trmm_gflop_count<T>(M, N, side), [&](int64_t b) {
             ref_trmm<T>(side, uplo, transA, diag, M, N, alpha, hA[b], lda, hB[b], ldb);
-        }
+        });
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
         // copy B matrix into C matrix
@@ -22,6 +22,8 @@
 
 #pragma once
 
+#include "device_reference.hpp"
+#include "freivalds.hpp"
 #include "testing_common.hpp"
 
 #include "blas3/rocblas_trsm.hpp"
@@ -318,12 +320,22 @@ void testing_trsm(const Arguments& arg)
 
     copy_matrix_with_different_leading_dimensions(hX, hB);
 
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    // B = A * B / alpha, on the device for large sizes
+    bool device_reference = rocblas_client_device_reference(double(M) * N * K);
+    auto trmm_reference   = [&](T* B, int64_t ld) {
+        if(device_reference)
+            device_ref_trmm<T>(side, uplo, transA, diag, M, N, 1.0 / alpha_h, dA, lda, B, ld);
+        else
+            ref_trmm<T>(side, uplo, transA, diag, M, N, 1.0 / alpha_h, hA, lda, B, ld);
+    };
+
     // Calculate hB = hA*hX;
-    ref_trmm<T>(side, uplo, transA, diag, M, N, 1.0 / alpha_h, hA, lda, hB, M);
+    trmm_reference(hB, M);
     copy_matrix_with_different_leading_dimensions(hB, hXorB_1);
 
-    // copy data from CPU to device
-    CHECK_HIP_ERROR(dA.transfer_from(hA));
     CHECK_HIP_ERROR(dXorB.transfer_from(hXorB_1));
 
     double error_eps_multiplier    = ERROR_EPS_MULTIPLIER;
@@ -332,6 +344,9 @@ void testing_trsm(const Arguments& arg)
     double err_host                = 0.0;
     double err_device              = 0.0;
 
+    // the residuals are checked by products with random vectors for large sizes
+    bool freivalds = rocblas_client_freivalds(double(M) * N * K);
+
     if(!ROCBLAS_REALLOC_ON_DEMAND)
     {
         // Compute size
@@ -448,11 +463,23 @@ void testing_trsm(const Arguments& arg)
                     trsm_err_res_check<T>(err_host, M, error_eps_multiplier, eps);
 
                 // hx_or_b contains A * (calculated X), so res = A * (calculated x) - b = hx_or_b - hb
-                ref_trmm<T>(side, uplo, transA, diag, M, N, 1.0 / alpha_h, hA, lda, hXorB_1, ldb);
-                double err_host_res = matrix_norm_1<T>(M, N, hXorB_1, ldb, hB, M);
+                double err_host_res;
+                if(freivalds)
+                {
+                    err_host_res = freivalds_trsm<T>(
+                        side, uplo, transA, diag, M, N, alpha_h, hA, lda, hXorB_1, ldb, hB, M);
+                    if(arg.unit_check)
+                        freivalds_unit_check(err_host_res,
+                                             (K + 2) * residual_eps_multiplier * eps);
+                }
+                else
+                {
+                    trmm_reference(hXorB_1, ldb);
+                    err_host_res = matrix_norm_1<T>(M, N, hXorB_1, ldb, hB, M);
 
-                if(arg.unit_check)
-                    trsm_err_res_check<T>(err_host_res, M, residual_eps_multiplier, eps);
+                    if(arg.unit_check)
+                        trsm_err_res_check<T>(err_host_res, M, residual_eps_multiplier, eps);
+                }
                 err_host = std::max(err_host, err_host_res);
             }
         }
@@ -506,11 +533,23 @@ void testing_trsm(const Arguments& arg)
                 if(arg.unit_check)
                     trsm_err_res_check<T>(err_device, M, error_eps_multiplier, eps);
 
-                ref_trmm<T>(side, uplo, transA, diag, M, N, 1.0 / alpha_h, hA, lda, hXorB_1, ldb);
-                double err_device_res = matrix_norm_1<T>(M, N, hXorB_1, ldb, hB, M);
+                double err_device_res;
+                if(freivalds)
+                {
+                    err_device_res = freivalds_trsm<T>(
+                        side, uplo, transA, diag, M, N, alpha_h, hA, lda, hXorB_1, ldb, hB, M);
+                    if(arg.unit_check)
+                        freivalds_unit_check(err_device_res,
+                                             (K + 2) * residual_eps_multiplier * eps);
+                }
+                else
+                {
+                    trmm_reference(hXorB_1, ldb);
+                    err_device_res = matrix_norm_1<T>(M, N, hXorB_1, ldb, hB, M);
 
-                if(arg.unit_check)
-                    trsm_err_res_check<T>(err_device_res, M, residual_eps_multiplier, eps);
+                    if(arg.unit_check)
+                        trsm_err_res_check<T>(err_device_res, M, residual_eps_multiplier, eps);
+                }
                 err_device = std::max(err_device, err_device_res);
             }
         }
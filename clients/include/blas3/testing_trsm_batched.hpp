@@ -452,11 +452,10 @@ void testing_trsm_batched(const Arguments& arg)
 
     copy_matrix_with_different_leading_dimensions(hX, hB);
 
-    for(int b = 0; b < batch_count; b++)
-    {
-        // Calculate hB = hA*hX
+    // Calculate hB = hA*hX
+    ref_batched(batch_count, trmm_gflop_count<T>(M, N, side), [&](int64_t b) {
         ref_trmm<T>(side, uplo, transA, diag, M, N, 1.0 / alpha_h, hA[b], lda, hB[b], M);
-    }
+    });
 
     copy_matrix_with_different_leading_dimensions(hB, hXorB_1);
 
@@ -756,8 +755,9 @@ void testing_trsm_batched(const Arguments& arg)
         // CPU cblas
         cpu_time_used = get_time_us_no_sync();
 
-        for(int64_t b = 0; b < batch_count; b++)
+        ref_batched(batch_count, trsm_gflop_count<T>(M, N, K), [&](int64_t b) {
             ref_trsm<T>(side, uplo, transA, diag, M, N, alpha_h, hA[b], lda, hXorB_1[b], ldb);
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
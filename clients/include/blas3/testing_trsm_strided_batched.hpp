@@ -520,8 +520,9 @@ void testing_trsm_strided_batched(const Arguments& arg)
     hB.copy_from(hX);
 
     // Calculate hB = hA*hX;
-    for(int64_t b = 0; b < batch_count; b++)
+    ref_batched(batch_count, trmm_gflop_count<T>(M, N, side), [&](int64_t b) {
         ref_trmm<T>(side, uplo, transA, diag, M, N, 1.0 / alpha_h, hA[b], lda, hB[b], ldb);
+    });
 
     hXorB_1.copy_from(hB);
 
@@ -823,8 +824,9 @@ void testing_trsm_strided_batched(const Arguments& arg)
         // CPU cblas
         cpu_time_used = get_time_us_no_sync();
 
-        for(int64_t b = 0; b < batch_count; b++)
+        ref_batched(batch_count, trsm_gflop_count<T>(M, N, K), [&](int64_t b) {
             ref_trsm<T>(side, uplo, transA, diag, M, N, alpha_h, hA[b], lda, hB[b], ldb);
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
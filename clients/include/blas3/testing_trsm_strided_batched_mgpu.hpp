@@ -0,0 +1,306 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "blas3/testing_gemm_mgpu.hpp"
+#include "testing_common.hpp"
+
+#define ERROR_EPS_MULTIPLIER 40
+#define RESIDUAL_EPS_MULTIPLIER 40
+
+template <typename T>
+void testing_trsm_strided_batched_mgpu_bad_arg(const Arguments& arg)
+{
+    auto rocblas_trsm_strided_batched_mgpu_fn = rocblas_trsm_strided_batched_mgpu<T>;
+
+    const rocblas_int    M = 100, N = 100, lda = 100, ldb = 100, batch_count = 2;
+    const rocblas_stride stride_A = 100 * 100, stride_B = 100 * 100;
+
+    const T alpha(1), zero(0);
+
+    const rocblas_side      side   = rocblas_side_left;
+    const rocblas_fill      uplo   = rocblas_fill_upper;
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_diagonal  diag   = rocblas_diagonal_non_unit;
+
+    rocblas_local_mgpu_handles handles{arg, 1};
+    rocblas_handle             handle = handles[0];
+    const rocblas_handle*      hs     = handles.data();
+
+    device_strided_batch_matrix<T> dA(M, M, lda, stride_A, batch_count);
+    device_strided_batch_matrix<T> dB(M, N, ldb, stride_B, batch_count);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+
+    // the arguments after num_handles, with the side, scalar and matrices which the checks
+    // below replace
+    auto call = [&](const rocblas_handle* handles_,
+                    rocblas_int           num_handles,
+                    rocblas_side          side_,
+                    const T*              alpha_,
+                    const T*              A,
+                    T*                    B) {
+        return rocblas_trsm_strided_batched_mgpu_fn(handles_,
+                                                    num_handles,
+                                                    side_,
+                                                    uplo,
+                                                    transA,
+                                                    diag,
+                                                    M,
+                                                    N,
+                                                    alpha_,
+                                                    A,
+                                                    lda,
+                                                    stride_A,
+                                                    B,
+                                                    ldb,
+                                                    stride_B,
+                                                    batch_count);
+    };
+
+    const rocblas_handle with_null[]   = {handle, nullptr};
+    const rocblas_handle same_device[] = {handle, handle};
+
+    EXPECT_ROCBLAS_STATUS(call(nullptr, 1, side, &alpha, dA, dB), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(call(hs, 0, side, &alpha, dA, dB), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(call(with_null, 2, side, &alpha, dA, dB),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(call(same_device, 2, side, &alpha, dA, dB),
+                          rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(call(hs, 1, rocblas_side_both, &alpha, dA, dB),
+                          rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(call(hs, 1, side, nullptr, dA, dB), rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(call(hs, 1, side, &alpha, nullptr, dB), rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(call(hs, 1, side, &alpha, dA, nullptr), rocblas_status_invalid_pointer);
+
+    // When alpha==0, A may be nullptr without error
+    EXPECT_ROCBLAS_STATUS(call(hs, 1, side, &zero, nullptr, dB), rocblas_status_success);
+
+    // The workspace of each device is taken when the batch is shared, so a device memory size
+    // query of the first handle reports none
+    size_t size = 1;
+    CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+    EXPECT_ROCBLAS_STATUS(call(hs, 1, side, &alpha, dA, dB), rocblas_status_size_unchanged);
+    CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+    EXPECT_EQ(size, 0u);
+}
+
+template <typename T>
+void testing_trsm_strided_batched_mgpu(const Arguments& arg)
+{
+    auto rocblas_trsm_strided_batched_mgpu_fn = rocblas_trsm_strided_batched_mgpu<T>;
+
+    rocblas_int    M           = arg.M;
+    rocblas_int    N           = arg.N;
+    rocblas_int    lda         = arg.lda;
+    rocblas_int    ldb         = arg.ldb;
+    rocblas_stride stride_A    = arg.stride_a;
+    rocblas_stride stride_B    = arg.stride_b;
+    rocblas_int    batch_count = arg.batch_count;
+
+    T alpha_h = arg.alpha;
+
+    rocblas_side      side   = char2rocblas_side(arg.side);
+    rocblas_fill      uplo   = char2rocblas_fill(arg.uplo);
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_diagonal  diag   = char2rocblas_diagonal(arg.diag);
+
+    rocblas_int K = side == rocblas_side_left ? M : N;
+
+    // arg.devices limits the number of devices used, a single one or all visible ones
+    int max_devices = arg.devices ? arg.devices : std::numeric_limits<int>::max();
+
+    rocblas_mgpu_test_split_small_problems();
+    rocblas_local_mgpu_handles handles{arg, max_devices};
+    rocblas_handle             handle = handles[0];
+
+    auto call = [&](const T* alpha, const T* A, T* B) {
+        return rocblas_trsm_strided_batched_mgpu_fn(handles.data(),
+                                                    handles.size(),
+                                                    side,
+                                                    uplo,
+                                                    transA,
+                                                    diag,
+                                                    M,
+                                                    N,
+                                                    alpha,
+                                                    A,
+                                                    lda,
+                                                    stride_A,
+                                                    B,
+                                                    ldb,
+                                                    stride_B,
+                                                    batch_count);
+    };
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || N < 0 || lda < K || ldb < M || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        EXPECT_ROCBLAS_STATUS(call(nullptr, nullptr, nullptr),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory of the first
+    // handle (eg dA).
+    host_strided_batch_matrix<T> hA(K, K, lda, stride_A, batch_count);
+    host_strided_batch_matrix<T> hB(M, N, ldb, stride_B, batch_count);
+    host_strided_batch_matrix<T> hX(M, N, ldb, stride_B, batch_count);
+    host_strided_batch_matrix<T> hXorB(M, N, ldb, stride_B, batch_count);
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_HIP_ERROR(hX.memcheck());
+    CHECK_HIP_ERROR(hXorB.memcheck());
+
+    device_strided_batch_matrix<T> dA(K, K, lda, stride_A, batch_count);
+    device_strided_batch_matrix<T> dXorB(M, N, ldb, stride_B, batch_count);
+    device_vector<T>               alpha_d(1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dXorB.memcheck());
+    CHECK_DEVICE_ALLOCATION(alpha_d.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(hA,
+                        arg,
+                        rocblas_client_never_set_nan,
+                        rocblas_client_diagonally_dominant_triangular_matrix,
+                        true);
+    rocblas_init_matrix(
+        hX, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, false, true);
+
+    //  make hA unit diagonal if diag == rocblas_diagonal_unit
+    if(diag == rocblas_diagonal_unit)
+    {
+        make_unit_diagonal(uplo, hA);
+    }
+
+    // Calculate hB = hA*hX / alpha, so that the solution is hX
+    hB.copy_from(hX);
+    if(alpha_h != T(0))
+        ref_batched(batch_count, trmm_gflop_count<T>(M, N, side), [&](int64_t b) {
+            ref_trmm<T>(side, uplo, transA, diag, M, N, 1.0 / alpha_h, hA[b], lda, hB[b], ldb);
+        });
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(hipMemcpy(alpha_d, &alpha_h, sizeof(T), hipMemcpyHostToDevice));
+
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    double error_eps_multiplier    = ERROR_EPS_MULTIPLIER;
+    double residual_eps_multiplier = RESIDUAL_EPS_MULTIPLIER;
+    double eps                     = std::numeric_limits<real_t<T>>::epsilon();
+    double rocblas_error           = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // The batch count need not divide evenly between the devices; in device pointer mode
+        // alpha is read from the device of the first handle
+        auto run = [&](rocblas_pointer_mode mode) {
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, mode));
+            CHECK_HIP_ERROR(dXorB.transfer_from(hB));
+            const T* alpha = mode == rocblas_pointer_mode_device ? (const T*)alpha_d : &alpha_h;
+            CHECK_ROCBLAS_ERROR(call(alpha, dA, dXorB));
+
+            // the stream of the first handle waits for the other devices
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+            CHECK_HIP_ERROR(hXorB.transfer_from(dXorB));
+
+            if(alpha_h == T(0))
+            {
+                // expecting 0 output
+                host_strided_batch_matrix<T> hZero(M, N, ldb, stride_B, batch_count);
+                rocblas_init_zero((T*)hZero, M, N, ldb, stride_B, batch_count);
+                if(arg.unit_check)
+                    unit_check_general<T>(M, N, ldb, stride_B, hZero, hXorB, batch_count);
+                return;
+            }
+
+            // the forward error E = hX - hXorB, and the residual of the host trsm system
+            // op(A) * (computed X) - alpha * B, both in the vector-induced-norm 1
+            for(rocblas_int b = 0; b < batch_count; b++)
+            {
+                double err = rocblas_abs(matrix_norm_1<T>(M, N, ldb, hX[b], hXorB[b]));
+                if(arg.unit_check)
+                    trsm_err_res_check<T>(err, M, error_eps_multiplier, eps);
+
+                ref_trmm<T>(
+                    side, uplo, transA, diag, M, N, 1.0 / alpha_h, hA[b], lda, hXorB[b], ldb);
+                double res = rocblas_abs(matrix_norm_1<T>(M, N, ldb, hXorB[b], hB[b]));
+                if(arg.unit_check)
+                    trsm_err_res_check<T>(res, M, residual_eps_multiplier, eps);
+
+                rocblas_error = std::max(rocblas_error, std::max(err, res));
+            }
+        };
+
+        if(arg.pointer_mode_host)
+            run(rocblas_pointer_mode_host);
+        if(arg.pointer_mode_device)
+            run(rocblas_pointer_mode_device);
+    }
+
+    if(arg.timing)
+    {
+        double gpu_time_used;
+        int    number_cold_calls = arg.cold_iters;
+        int    total_calls       = number_cold_calls + arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(dXorB.transfer_from(hB));
+
+        for(int iter = 0; iter < total_calls; iter++)
+        {
+            if(iter == number_cold_calls)
+                gpu_time_used = get_time_us_sync(stream);
+
+            call(&alpha_h, dA, dXorB);
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+
+        ArgumentModel<e_side,
+                      e_uplo,
+                      e_transA,
+                      e_diag,
+                      e_M,
+                      e_N,
+                      e_alpha,
+                      e_lda,
+                      e_stride_a,
+                      e_ldb,
+                      e_stride_b,
+                      e_batch_count>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         trsm_gflop_count<T>(M, N, K) * batch_count,
+                         ArgumentLogging::NA_value,
+                         ArgumentLogging::NA_value,
+                         rocblas_error);
+    }
+}
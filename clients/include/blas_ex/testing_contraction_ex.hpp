@@ -0,0 +1,382 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_common.hpp"
+
+#include <vector>
+
+/* ============================================================================================ */
+
+// The elements spanned by tensor t of A, B, C and D over the indices which index it
+inline size_t contraction_extent(const std::vector<rocblas_contraction_index>& indices, int t)
+{
+    size_t extent = 1;
+    for(const auto& index : indices)
+    {
+        bool indexes = index.kind == rocblas_contraction_index_batch
+                       || (index.kind == rocblas_contraction_index_bound ? t < 2
+                           : index.kind == rocblas_contraction_index_free_a ? t != 1
+                                                                            : t != 0);
+        const rocblas_stride strides[4]
+            = {index.stride_a, index.stride_b, index.stride_c, index.stride_d};
+        if(indexes && index.size > 1)
+            extent += size_t(index.size - 1) * strides[t];
+    }
+    return extent;
+}
+
+// CPU reference of the contraction, each element of D over all free and batch indices summing
+// over the bound ones, an empty sum when a bound index has size 0. C is not read when
+// beta == 0.
+template <typename T>
+void ref_contraction_ex(const std::vector<rocblas_contraction_index>& indices,
+                        T                                             alpha,
+                        const T*                                      A,
+                        const T*                                      B,
+                        T                                             beta,
+                        const T*                                      C,
+                        T*                                            D)
+{
+    std::vector<rocblas_contraction_index> outer, bound;
+    bool                                   k_zero = false;
+    for(const auto& index : indices)
+    {
+        bool is_bound = index.kind == rocblas_contraction_index_bound;
+        if(!index.size && !is_bound)
+            return;
+        k_zero = k_zero || !index.size;
+        (is_bound ? bound : outer).push_back(index);
+    }
+
+    // steps the odometer of the indices, false when it wraps around
+    auto next = [](const std::vector<rocblas_contraction_index>& dims, std::vector<int64_t>& i) {
+        for(size_t d = 0; d < dims.size(); d++)
+        {
+            if(++i[d] < dims[d].size)
+                return true;
+            i[d] = 0;
+        }
+        return false;
+    };
+
+    std::vector<int64_t> i(outer.size()), j(bound.size());
+    do
+    {
+        int64_t a = 0, b = 0, c = 0, d = 0;
+        for(size_t o = 0; o < outer.size(); o++)
+        {
+            auto kind = outer[o].kind;
+            a += kind != rocblas_contraction_index_free_b ? i[o] * outer[o].stride_a : 0;
+            b += kind != rocblas_contraction_index_free_a ? i[o] * outer[o].stride_b : 0;
+            c += i[o] * outer[o].stride_c;
+            d += i[o] * outer[o].stride_d;
+        }
+
+        T sum = T(0);
+        std::fill(j.begin(), j.end(), 0);
+        do
+        {
+            if(k_zero)
+                break;
+
+            int64_t ak = a, bk = b;
+            for(size_t o = 0; o < bound.size(); o++)
+            {
+                ak += j[o] * bound[o].stride_a;
+                bk += j[o] * bound[o].stride_b;
+            }
+            sum += A[ak] * B[bk];
+        } while(next(bound, j));
+
+        D[d] = alpha * sum + (beta == T(0) ? T(0) : beta * C[c]);
+    } while(next(outer, i));
+}
+
+template <typename T>
+void testing_contraction_ex_bad_arg(const Arguments& arg)
+{
+    const int64_t           M = 10, N = 10, K = 10;
+    const rocblas_datatype  type = rocblas_type2datatype<T>();
+    const rocblas_gemm_algo algo = rocblas_gemm_algo_standard;
+
+    const T alpha = T(1), beta = T(1);
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    device_vector<T> dA(M * K * 2), dB(K * N * 2), dC(M * N * 2), dD(M * N * 2);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+
+    // a column major GEMM, D = A * B + C with M by K A and K by N B
+    std::vector<rocblas_contraction_index> gemm
+        = {{rocblas_contraction_index_free_a, M, 1, 0, 1, 1},
+           {rocblas_contraction_index_free_b, N, 0, K, M, M},
+           {rocblas_contraction_index_bound, K, M, 1, 0, 0}};
+
+    // the calls below share alpha, beta, the types and the algorithm
+    auto call = [&](rocblas_handle                                h,
+                    const std::vector<rocblas_contraction_index>& indices,
+                    const T*                                      A,
+                    const T*                                      C,
+                    T*                                            D) {
+        return rocblas_contraction_ex(h,
+                                      int32_t(indices.size()),
+                                      indices.data(),
+                                      &alpha,
+                                      A,
+                                      type,
+                                      dB,
+                                      type,
+                                      &beta,
+                                      C,
+                                      type,
+                                      D,
+                                      type,
+                                      type,
+                                      algo,
+                                      0,
+                                      rocblas_gemm_flags_none);
+    };
+
+    EXPECT_ROCBLAS_STATUS(call(nullptr, gemm, dA, dC, dD), rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_contraction_ex(handle,
+                                                 -1,
+                                                 gemm.data(),
+                                                 &alpha,
+                                                 dA,
+                                                 type,
+                                                 dB,
+                                                 type,
+                                                 &beta,
+                                                 dC,
+                                                 type,
+                                                 dD,
+                                                 type,
+                                                 type,
+                                                 algo,
+                                                 0,
+                                                 rocblas_gemm_flags_none),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_contraction_ex(handle,
+                                                 3,
+                                                 nullptr,
+                                                 &alpha,
+                                                 dA,
+                                                 type,
+                                                 dB,
+                                                 type,
+                                                 &beta,
+                                                 dC,
+                                                 type,
+                                                 dD,
+                                                 type,
+                                                 type,
+                                                 algo,
+                                                 0,
+                                                 rocblas_gemm_flags_none),
+                          rocblas_status_invalid_pointer);
+
+    auto bad = gemm;
+    bad[0].kind = (rocblas_contraction_index_kind)4;
+    EXPECT_ROCBLAS_STATUS(call(handle, bad, dA, dC, dD), rocblas_status_invalid_value);
+
+    bad = gemm;
+    bad[1].size = -1;
+    EXPECT_ROCBLAS_STATUS(call(handle, bad, dA, dC, dD), rocblas_status_invalid_size);
+
+    bad = gemm;
+    bad[2].stride_b = -1;
+    EXPECT_ROCBLAS_STATUS(call(handle, bad, dA, dC, dD), rocblas_status_invalid_size);
+
+    // strides of the tensors an index does not index are ignored
+    bad = gemm;
+    bad[0].stride_b = -1;
+    EXPECT_ROCBLAS_STATUS(call(handle, bad, dA, dC, dD), rocblas_status_success);
+
+    EXPECT_ROCBLAS_STATUS(call(handle, gemm, nullptr, dC, dD), rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(call(handle, gemm, dA, dC, nullptr), rocblas_status_invalid_pointer);
+
+    // an empty free index is a quick return which does not read the tensors
+    bad = gemm;
+    bad[1].size = 0;
+    EXPECT_ROCBLAS_STATUS(call(handle, bad, nullptr, nullptr, nullptr), rocblas_status_success);
+
+    // in place, C and D must have the same layout
+    bad = gemm;
+    bad[1].stride_d = M + 1;
+    EXPECT_ROCBLAS_STATUS(call(handle, bad, dA, dD, dD), rocblas_status_invalid_size);
+
+    // two bound indices which do not merge are more than one GEMM
+    bad = gemm;
+    bad[2].size = K / 2;
+    bad.push_back({rocblas_contraction_index_bound, 2, M * K / 2 + 1, N * K, 0, 0});
+    EXPECT_ROCBLAS_STATUS(call(handle, bad, dA, dC, dD), rocblas_status_not_implemented);
+
+    // neither A nor B contiguous along a free or the bound index
+    bad = gemm;
+    bad[0].stride_a = 2;
+    bad[2].stride_a = 2 * M;
+    EXPECT_ROCBLAS_STATUS(call(handle, bad, dA, dC, dD), rocblas_status_not_implemented);
+}
+
+template <typename T>
+void testing_contraction_ex(const Arguments& arg)
+{
+    int64_t M           = arg.M;
+    int64_t N           = arg.N;
+    int64_t K           = arg.K;
+    int64_t batch_count = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    const rocblas_datatype  type = rocblas_type2datatype<T>();
+    const rocblas_gemm_algo algo = rocblas_gemm_algo_standard;
+
+    rocblas_local_handle handle{arg};
+
+    using index_list = std::vector<rocblas_contraction_index>;
+    auto free_a      = rocblas_contraction_index_free_a;
+    auto free_b      = rocblas_contraction_index_free_b;
+    auto bound       = rocblas_contraction_index_bound;
+    auto batch       = rocblas_contraction_index_batch;
+
+    // The matrices of A, B and D with padded leading dimensions, A and B contiguous along M and
+    // K as given by transA and transB, and D contiguous along M, or along N when it is swapped
+    bool    a_t = char2rocblas_operation(arg.transA) != rocblas_operation_none;
+    bool    b_t = char2rocblas_operation(arg.transB) != rocblas_operation_none;
+    int64_t am = a_t ? K + 1 : 1, ak = a_t ? 1 : M + 1;
+    int64_t bk = b_t ? N + 1 : 1, bn = b_t ? 1 : K + 1;
+    int64_t ea = (M + 1) * (K + 1), eb = (K + 1) * (N + 1), ed = (M + 2) * (N + 2);
+
+    auto gemm = [&](bool swapped) {
+        int64_t dm = swapped ? N + 2 : 1, dn = swapped ? 1 : M + 2;
+        return index_list{{free_a, M, am, 0, dm, dm},
+                          {free_b, N, 0, bn, dn, dn},
+                          {bound, K, ak, bk, 0, 0}};
+    };
+
+    std::vector<index_list> cases = {gemm(false), gemm(true)};
+
+    // the batch of the GEMM, and with B broadcast along it
+    auto batched = gemm(false);
+    batched.push_back({batch, batch_count, ea, eb, ed, ed});
+    cases.push_back(batched);
+    batched.back().stride_b = 0;
+    cases.push_back(batched);
+
+    // a free index split in two, merged back into M
+    if(M % 2 == 0)
+    {
+        auto split    = gemm(false);
+        split[0].size = M / 2;
+        split.push_back({free_a, 2, am * (M / 2), 0, M / 2, M / 2});
+        cases.push_back(split);
+    }
+
+    // two batch indices which do not merge, one looped over by the host
+    auto looped = gemm(false);
+    looped.push_back({batch, 3, ea, eb, ed, ed});
+    looped.push_back({batch, batch_count, 4 * ea, 4 * eb, 4 * ed, 4 * ed});
+    cases.push_back(looped);
+
+    device_vector<T> d_alpha(1), d_beta(1);
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    rocblas_seedrand();
+
+    for(const auto& indices : cases)
+    {
+        size_t size_A = contraction_extent(indices, 0), size_B = contraction_extent(indices, 1);
+        size_t size_C = contraction_extent(indices, 2), size_D = contraction_extent(indices, 3);
+
+        // integer data keeps the results exact
+        host_vector<T> hA(size_A), hB(size_B), hC(size_C), hD(size_D), hD_gold(size_D),
+            hD_gpu(size_D);
+        rocblas_init<T>(hA, 1, size_A, 1);
+        rocblas_init<T>(hB, 1, size_B, 1);
+        rocblas_init<T>(hD, 1, size_D, 1);
+
+        // C is not read when beta == 0
+        if(h_beta == T(0))
+            rocblas_init_nan<T>(hC, 1, size_C, 1);
+        else
+            rocblas_init<T>(hC, 1, size_C, 1);
+
+        device_vector<T> dA(size_A), dB(size_B), dC(size_C), dD(size_D);
+        CHECK_DEVICE_ALLOCATION(dA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dB.memcheck());
+        CHECK_DEVICE_ALLOCATION(dC.memcheck());
+        CHECK_DEVICE_ALLOCATION(dD.memcheck());
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+
+        // the elements of D which are not indexed are left as they were
+        hD_gold = hD;
+        ref_contraction_ex<T>(indices, h_alpha, hA, hB, h_beta, hC, hD_gold);
+
+        for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+        {
+            if(pointer_mode == rocblas_pointer_mode_host && !arg.pointer_mode_host)
+                continue;
+            if(pointer_mode == rocblas_pointer_mode_device && !arg.pointer_mode_device)
+                continue;
+
+            bool host = pointer_mode == rocblas_pointer_mode_host;
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+            CHECK_HIP_ERROR(dD.transfer_from(hD));
+
+            CHECK_ROCBLAS_ERROR(rocblas_contraction_ex(handle,
+                                                       int32_t(indices.size()),
+                                                       indices.data(),
+                                                       host ? &h_alpha : d_alpha,
+                                                       dA,
+                                                       type,
+                                                       dB,
+                                                       type,
+                                                       host ? &h_beta : d_beta,
+                                                       dC,
+                                                       type,
+                                                       dD,
+                                                       type,
+                                                       type,
+                                                       algo,
+                                                       0,
+                                                       rocblas_gemm_flags_none));
+
+            if(arg.unit_check)
+            {
+                CHECK_HIP_ERROR(hD_gpu.transfer_from(dD));
+                unit_check_general<T>(1, size_D, 1, hD_gold, hD_gpu);
+            }
+        }
+    }
+}
@@ -0,0 +1,356 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// the host reference of convert_ex, rounding to nearest even, or bounding the stochastically
+// rounded results by the results of the rounding towards zero and away from zero
+template <typename Tx, typename Ty, bool SR = false>
+void ref_convert_ex(int64_t   M,
+                    int64_t   N,
+                    const Tx* X,
+                    int64_t   ldx,
+                    Ty*       Y,
+                    int64_t   ldy,
+                    float     scale,
+                    float&    amax,
+                    uint32_t  rng = 0)
+{
+    amax = 0;
+    for(int64_t j = 0; j < N; j++)
+        for(int64_t i = 0; i < M; i++)
+        {
+            float v = float(X[i + j * ldx]);
+            amax    = std::max(amax, std::abs(v));
+
+            Y[i + j * ldy] = explicit_downcast<Ty, float, SR>(v * scale, rng);
+        }
+}
+
+template <typename Tx, typename Ty>
+void testing_convert_ex_bad_arg(const Arguments& arg)
+{
+    const rocblas_int      M = 100, N = 100, ldx = 100, ldy = 100, batch_count = 2;
+    const rocblas_stride   stride_x = ldx * N, stride_y = ldy * N;
+    const rocblas_datatype x_type = rocblas_type2datatype<Tx>();
+    const rocblas_datatype y_type = rocblas_type2datatype<Ty>();
+    const uint32_t         flags  = 0;
+
+    rocblas_local_handle handle{arg};
+
+    device_vector<Tx>    dX(size_t(stride_x) * batch_count);
+    device_vector<Ty>    dY(size_t(stride_y) * batch_count);
+    device_vector<float> d_scale(1), d_amax(batch_count);
+    CHECK_DEVICE_ALLOCATION(dX.memcheck());
+    CHECK_DEVICE_ALLOCATION(dY.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_scale.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_amax.memcheck());
+
+    const float one = 1.0f;
+    CHECK_HIP_ERROR(hipMemcpy(d_scale, &one, sizeof(float), hipMemcpyHostToDevice));
+
+    // the calls below share the strides, the scale, the maxima and the flags
+    auto call = [&](rocblas_handle   h,
+                    rocblas_int      m,
+                    rocblas_int      n,
+                    const void*      x,
+                    rocblas_datatype x_type_,
+                    rocblas_int      ldx_,
+                    void*            y,
+                    rocblas_datatype y_type_,
+                    rocblas_int      ldy_,
+                    rocblas_int      batch) {
+        return rocblas_convert_ex(h,
+                                  m,
+                                  n,
+                                  x,
+                                  x_type_,
+                                  ldx_,
+                                  stride_x,
+                                  y,
+                                  y_type_,
+                                  ldy_,
+                                  stride_y,
+                                  batch,
+                                  d_scale,
+                                  d_amax,
+                                  flags);
+    };
+
+    EXPECT_ROCBLAS_STATUS(call(nullptr, M, N, dX, x_type, ldx, dY, y_type, ldy, batch_count),
+                          rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(call(handle, -1, N, dX, x_type, ldx, dY, y_type, ldy, batch_count),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, -1, dX, x_type, ldx, dY, y_type, ldy, batch_count),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, N, dX, x_type, M - 1, dY, y_type, ldy, batch_count),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, N, dX, x_type, ldx, dY, y_type, M - 1, batch_count),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, N, dX, x_type, ldx, dY, y_type, ldy, -1),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, M, N, dX, rocblas_datatype_f64_r, ldx, dY, y_type, ldy, batch_count),
+        rocblas_status_not_implemented);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, M, N, dX, x_type, ldx, dY, rocblas_datatype_i8_r, ldy, batch_count),
+        rocblas_status_not_implemented);
+
+    EXPECT_ROCBLAS_STATUS(call(handle, M, N, nullptr, x_type, ldx, dY, y_type, ldy, batch_count),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, N, dX, x_type, ldx, nullptr, y_type, ldy, batch_count),
+                          rocblas_status_invalid_pointer);
+
+    // quick returns do not read the matrices
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, 0, N, nullptr, x_type, ldx, nullptr, y_type, ldy, batch_count),
+        rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, M, 0, nullptr, x_type, ldx, nullptr, y_type, ldy, batch_count),
+        rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, N, nullptr, x_type, ldx, nullptr, y_type, ldy, 0),
+                          rocblas_status_success);
+
+    // the scale and the maxima are optional
+    EXPECT_ROCBLAS_STATUS(rocblas_convert_ex(handle,
+                                             M,
+                                             N,
+                                             dX,
+                                             x_type,
+                                             ldx,
+                                             stride_x,
+                                             dY,
+                                             y_type,
+                                             ldy,
+                                             stride_y,
+                                             batch_count,
+                                             nullptr,
+                                             nullptr,
+                                             flags),
+                          rocblas_status_success);
+
+    // the stochastic rounding state of the handle
+    uint64_t seed = 0, offset = 0;
+    EXPECT_ROCBLAS_STATUS(rocblas_set_stochastic_rounding_seed(nullptr, 1, 2),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_stochastic_rounding_seed(nullptr, &seed, &offset),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_stochastic_rounding_seed(handle, nullptr, &offset),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_stochastic_rounding_seed(handle, &seed, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // a new handle has no seed until its first use
+    rocblas_handle unseeded;
+    CHECK_ROCBLAS_ERROR(rocblas_create_handle(&unseeded));
+    EXPECT_ROCBLAS_STATUS(rocblas_get_stochastic_rounding_seed(unseeded, &seed, &offset),
+                          rocblas_status_invalid_value);
+    CHECK_ROCBLAS_ERROR(rocblas_set_stochastic_rounding_seed(unseeded, 1, 2));
+    CHECK_ROCBLAS_ERROR(rocblas_get_stochastic_rounding_seed(unseeded, &seed, &offset));
+    EXPECT_EQ(seed, 1u);
+    EXPECT_EQ(offset, 2u);
+    CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(unseeded));
+}
+
+template <typename Tx, typename Ty>
+void testing_convert_ex(const Arguments& arg)
+{
+    rocblas_int    M           = arg.M;
+    rocblas_int    N           = arg.N;
+    rocblas_int    ldx         = arg.lda;
+    rocblas_int    ldy         = arg.ldb;
+    rocblas_stride stride_x    = arg.stride_a;
+    rocblas_stride stride_y    = arg.stride_b;
+    rocblas_int    batch_count = arg.batch_count;
+    uint32_t       flags       = arg.flags;
+
+    // a scale of one is passed as NULL
+    float h_scale = arg.get_alpha<float>();
+    bool  scaled  = h_scale != 1.0f;
+
+    // stochastic rounding only applies to the 8-bit output types
+    constexpr bool y_f8 = std::is_same_v<Ty, rocblas_f8> || std::is_same_v<Ty, rocblas_bf8>;
+    bool           sr   = y_f8 && (flags & rocblas_gemm_flags_stochastic_rounding);
+
+    rocblas_datatype x_type = rocblas_type2datatype<Tx>();
+    rocblas_datatype y_type = rocblas_type2datatype<Ty>();
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size
+        = M < 0 || N < 0 || batch_count < 0 || ldx < std::max(M, 1) || ldy < std::max(M, 1);
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        // the maxima of empty matrices are zero
+        device_vector<float> d_amax(std::max(batch_count, 1));
+        CHECK_DEVICE_ALLOCATION(d_amax.memcheck());
+        host_vector<float> h_amax(std::max(batch_count, 1));
+        for(auto& a : h_amax)
+            a = 1.0f;
+        CHECK_HIP_ERROR(d_amax.transfer_from(h_amax));
+
+        EXPECT_ROCBLAS_STATUS(rocblas_convert_ex(handle,
+                                                 M,
+                                                 N,
+                                                 nullptr,
+                                                 x_type,
+                                                 ldx,
+                                                 stride_x,
+                                                 nullptr,
+                                                 y_type,
+                                                 ldy,
+                                                 stride_y,
+                                                 batch_count,
+                                                 nullptr,
+                                                 d_amax,
+                                                 flags),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+
+        if(!invalid_size && batch_count)
+        {
+            CHECK_HIP_ERROR(h_amax.transfer_from(d_amax));
+            for(rocblas_int b = 0; b < batch_count; b++)
+                EXPECT_EQ(h_amax[b], 0.0f);
+        }
+        return;
+    }
+
+    host_strided_batch_matrix<Tx> hX(M, N, ldx, stride_x, batch_count);
+    host_strided_batch_matrix<Ty> hY(M, N, ldy, stride_y, batch_count);
+    // the reference, or the bounds of the stochastically rounded results
+    host_strided_batch_matrix<Ty> hY_lo(M, N, ldy, stride_y, batch_count);
+    host_strided_batch_matrix<Ty> hY_hi(M, N, ldy, stride_y, batch_count);
+    host_vector<float>            h_amax(batch_count), h_amax_gold(batch_count);
+    CHECK_HIP_ERROR(hX.memcheck());
+    CHECK_HIP_ERROR(hY.memcheck());
+
+    device_strided_batch_matrix<Tx> dX(M, N, ldx, stride_x, batch_count);
+    device_strided_batch_matrix<Ty> dY(M, N, ldy, stride_y, batch_count);
+    device_vector<float>            d_scale(1), d_amax(batch_count);
+    CHECK_DEVICE_ALLOCATION(dX.memcheck());
+    CHECK_DEVICE_ALLOCATION(dY.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_scale.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_amax.memcheck());
+
+    rocblas_seedrand();
+    for(rocblas_int b = 0; b < batch_count; b++)
+        for(rocblas_int j = 0; j < N; j++)
+            for(rocblas_int i = 0; i < M; i++)
+                hX[b][i + j * size_t(ldx)] = random_hpl_generator<Tx>();
+
+    // the maxima are reset by the call
+    for(auto& a : h_amax)
+        a = -1.0f;
+
+    CHECK_HIP_ERROR(dX.transfer_from(hX));
+    CHECK_HIP_ERROR(d_amax.transfer_from(h_amax));
+    CHECK_HIP_ERROR(hipMemcpy(d_scale, &h_scale, sizeof(float), hipMemcpyHostToDevice));
+
+    CHECK_ROCBLAS_ERROR(rocblas_convert_ex(handle,
+                                           M,
+                                           N,
+                                           dX,
+                                           x_type,
+                                           ldx,
+                                           stride_x,
+                                           dY,
+                                           y_type,
+                                           ldy,
+                                           stride_y,
+                                           batch_count,
+                                           scaled ? (const float*)d_scale : nullptr,
+                                           d_amax,
+                                           flags));
+    CHECK_HIP_ERROR(hY.transfer_from(dY));
+    CHECK_HIP_ERROR(h_amax.transfer_from(d_amax));
+
+    for(rocblas_int b = 0; b < batch_count; b++)
+    {
+        if(sr)
+        {
+            ref_convert_ex<Tx, Ty, true>(M, N, hX[b], ldx, hY_lo[b], ldy, h_scale, h_amax_gold[b]);
+            ref_convert_ex<Tx, Ty, true>(
+                M, N, hX[b], ldx, hY_hi[b], ldy, h_scale, h_amax_gold[b], 0xFFFFFFFFu);
+        }
+        else
+            ref_convert_ex<Tx, Ty>(M, N, hX[b], ldx, hY_lo[b], ldy, h_scale, h_amax_gold[b]);
+    }
+
+    if(arg.unit_check)
+    {
+        unit_check_general<float>(1, batch_count, 1, h_amax_gold, h_amax);
+
+        if(!sr)
+            unit_check_general<Ty>(M, N, ldy, stride_y, hY_lo, hY, batch_count);
+        else
+        {
+            // each result is one of the two neighbours of the scaled input
+            for(rocblas_int b = 0; b < batch_count; b++)
+                for(rocblas_int j = 0; j < N; j++)
+                    for(rocblas_int i = 0; i < M; i++)
+                    {
+                        size_t idx = i + j * size_t(ldy);
+                        float  y = float(hY[b][idx]), lo = float(hY_lo[b][idx]),
+                              hi = float(hY_hi[b][idx]);
+                        ASSERT_TRUE(y == lo || y == hi)
+                            << "batch " << b << ", element (" << i << ", " << j << "): " << y
+                            << " is neither " << lo << " nor " << hi;
+                    }
+
+            // the call advanced the counter by one, and restoring the seed and the counter of
+            // the call reproduces its rounding
+            uint64_t seed, offset, next_offset;
+            CHECK_ROCBLAS_ERROR(rocblas_get_stochastic_rounding_seed(handle, &seed, &offset));
+            ASSERT_GE(offset, 1u);
+            CHECK_ROCBLAS_ERROR(rocblas_set_stochastic_rounding_seed(handle, seed, offset - 1));
+
+            host_strided_batch_matrix<Ty> hY_2(M, N, ldy, stride_y, batch_count);
+            CHECK_HIP_ERROR(hY_2.memcheck());
+            CHECK_ROCBLAS_ERROR(rocblas_convert_ex(handle,
+                                                   M,
+                                                   N,
+                                                   dX,
+                                                   x_type,
+                                                   ldx,
+                                                   stride_x,
+                                                   dY,
+                                                   y_type,
+                                                   ldy,
+                                                   stride_y,
+                                                   batch_count,
+                                                   scaled ? (const float*)d_scale : nullptr,
+                                                   nullptr,
+                                                   flags));
+            CHECK_HIP_ERROR(hY_2.transfer_from(dY));
+            unit_check_general<Ty>(M, N, ldy, stride_y, hY, hY_2, batch_count);
+
+            CHECK_ROCBLAS_ERROR(rocblas_get_stochastic_rounding_seed(handle, &seed, &next_offset));
+            EXPECT_EQ(next_offset, offset);
+        }
+    }
+}
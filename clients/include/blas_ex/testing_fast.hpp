@@ -0,0 +1,465 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// The _fast functions check only the handle and the sizes with nothing to compute, so the bad
+// argument tests cover those, and the main tests compare the results of the _fast function
+// with those of the checked function on the same arguments, which must be identical as both
+// launch the same kernels
+
+template <typename T>
+void testing_scal_fast_bad_arg(const Arguments& arg)
+{
+    auto rocblas_scal_fast_fn = rocblas_scal_fast<T>;
+
+    const rocblas_int N = 100, incx = 1;
+    const T           alpha = T(2);
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    device_vector<T> dx(N, incx);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(rocblas_scal_fast_fn(nullptr, N, &alpha, dx, incx),
+                          rocblas_status_invalid_handle);
+
+    // nothing to compute, the pointers are not read
+    EXPECT_ROCBLAS_STATUS(rocblas_scal_fast_fn(handle, 0, nullptr, nullptr, incx),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocblas_scal_fast_fn(handle, -1, nullptr, nullptr, incx),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_scal_fast(const Arguments& arg)
+{
+    auto rocblas_scal_fn      = rocblas_scal<T>;
+    auto rocblas_scal_fast_fn = rocblas_scal_fast<T>;
+
+    rocblas_int N       = arg.N;
+    rocblas_int incx    = arg.incx;
+    T           h_alpha = arg.get_alpha<T>();
+
+    rocblas_local_handle handle{arg};
+
+    if(N <= 0 || incx <= 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_scal_fast_fn(handle, N, nullptr, nullptr, incx),
+                              rocblas_status_success);
+        return;
+    }
+
+    host_vector<T>   hx(N, incx), hx_gold(N, incx), hx_gpu(N, incx);
+    device_vector<T> dx(N, incx), d_alpha(1);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+
+    rocblas_seedrand();
+    rocblas_init_vector(hx, arg, rocblas_client_never_set_nan, true);
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        if(pointer_mode == rocblas_pointer_mode_host && !arg.pointer_mode_host)
+            continue;
+        if(pointer_mode == rocblas_pointer_mode_device && !arg.pointer_mode_device)
+            continue;
+
+        const T* alpha = pointer_mode == rocblas_pointer_mode_host ? &h_alpha : d_alpha;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        CHECK_HIP_ERROR(dx.transfer_from(hx));
+        CHECK_ROCBLAS_ERROR(rocblas_scal_fn(handle, N, alpha, dx, incx));
+        CHECK_HIP_ERROR(hx_gold.transfer_from(dx));
+
+        CHECK_HIP_ERROR(dx.transfer_from(hx));
+        CHECK_ROCBLAS_ERROR(rocblas_scal_fast_fn(handle, N, alpha, dx, incx));
+        CHECK_HIP_ERROR(hx_gpu.transfer_from(dx));
+
+        if(arg.unit_check)
+            unit_check_general<T>(1, N, incx, hx_gold, hx_gpu);
+    }
+}
+
+template <typename T>
+void testing_axpy_fast_bad_arg(const Arguments& arg)
+{
+    auto rocblas_axpy_fast_fn = rocblas_axpy_fast<T>;
+
+    const rocblas_int N = 100, incx = 1, incy = 1;
+    const T           alpha = T(2);
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    device_vector<T> dx(N, incx), dy(N, incy);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_fast_fn(nullptr, N, &alpha, dx, incx, dy, incy),
+                          rocblas_status_invalid_handle);
+
+    // nothing to compute, the pointers are not read
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_fast_fn(handle, 0, nullptr, nullptr, incx, nullptr, incy),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocblas_axpy_fast_fn(handle, -1, nullptr, nullptr, incx, nullptr, incy),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_axpy_fast(const Arguments& arg)
+{
+    auto rocblas_axpy_fn      = rocblas_axpy<T>;
+    auto rocblas_axpy_fast_fn = rocblas_axpy_fast<T>;
+
+    rocblas_int N       = arg.N;
+    rocblas_int incx    = arg.incx;
+    rocblas_int incy    = arg.incy;
+    T           h_alpha = arg.get_alpha<T>();
+
+    rocblas_local_handle handle{arg};
+
+    if(N <= 0)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_fast_fn(handle, N, nullptr, nullptr, incx, nullptr, incy),
+            rocblas_status_success);
+        return;
+    }
+
+    host_vector<T>   hx(N, incx), hy(N, incy), hy_gold(N, incy), hy_gpu(N, incy);
+    device_vector<T> dx(N, incx), dy(N, incy), d_alpha(1);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+
+    rocblas_seedrand();
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_never_set_nan, false);
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        if(pointer_mode == rocblas_pointer_mode_host && !arg.pointer_mode_host)
+            continue;
+        if(pointer_mode == rocblas_pointer_mode_device && !arg.pointer_mode_device)
+            continue;
+
+        const T* alpha = pointer_mode == rocblas_pointer_mode_host ? &h_alpha : d_alpha;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_fn(handle, N, alpha, dx, incx, dy, incy));
+        CHECK_HIP_ERROR(hy_gold.transfer_from(dy));
+
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_fast_fn(handle, N, alpha, dx, incx, dy, incy));
+        CHECK_HIP_ERROR(hy_gpu.transfer_from(dy));
+
+        if(arg.unit_check)
+            unit_check_general<T>(1, N, incy, hy_gold, hy_gpu);
+    }
+}
+
+template <typename T>
+void testing_gemv_fast_bad_arg(const Arguments& arg)
+{
+    auto rocblas_gemv_fast_fn = rocblas_gemv_fast<T>;
+
+    const rocblas_operation op = rocblas_operation_none;
+    const rocblas_int       M = 100, N = 100, lda = 100, incx = 1, incy = 1;
+    const T                 alpha = T(1), beta = T(1);
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    device_matrix<T> dA(M, N, lda);
+    device_vector<T> dx(N, incx), dy(M, incy);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemv_fast_fn(nullptr, op, M, N, &alpha, dA, lda, dx, incx, &beta, dy, incy),
+        rocblas_status_invalid_handle);
+
+    // nothing to compute, the pointers are not read
+    for(auto [m, n] : {std::pair{0, N}, std::pair{M, 0}})
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_fast_fn(handle,
+                                                   op,
+                                                   m,
+                                                   n,
+                                                   nullptr,
+                                                   nullptr,
+                                                   lda,
+                                                   nullptr,
+                                                   incx,
+                                                   nullptr,
+                                                   nullptr,
+                                                   incy),
+                              rocblas_status_success);
+
+    // the workspace of the transposed kernels can be queried as for rocblas_Xgemv
+    size_t size = 0;
+    CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_fast_fn(handle,
+                                               rocblas_operation_transpose,
+                                               M,
+                                               N,
+                                               nullptr,
+                                               nullptr,
+                                               lda,
+                                               nullptr,
+                                               incx,
+                                               nullptr,
+                                               nullptr,
+                                               incy),
+                          rocblas_status_size_increased);
+    CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+    EXPECT_GT(size, 0);
+}
+
+template <typename T>
+void testing_gemv_fast(const Arguments& arg)
+{
+    auto rocblas_gemv_fn      = rocblas_gemv<T>;
+    auto rocblas_gemv_fast_fn = rocblas_gemv_fast<T>;
+
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_int       M      = arg.M;
+    rocblas_int       N      = arg.N;
+    rocblas_int       lda    = arg.lda;
+    rocblas_int       incx   = arg.incx;
+    rocblas_int       incy   = arg.incy;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    rocblas_local_handle handle{arg};
+
+    if(M <= 0 || N <= 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_fast_fn(handle,
+                                                   transA,
+                                                   M,
+                                                   N,
+                                                   nullptr,
+                                                   nullptr,
+                                                   lda,
+                                                   nullptr,
+                                                   incx,
+                                                   nullptr,
+                                                   nullptr,
+                                                   incy),
+                              rocblas_status_success);
+        return;
+    }
+
+    size_t dim_x = transA == rocblas_operation_none ? N : M;
+    size_t dim_y = transA == rocblas_operation_none ? M : N;
+
+    host_matrix<T>   hA(M, N, lda);
+    host_vector<T>   hx(dim_x, incx), hy(dim_y, incy), hy_gold(dim_y, incy), hy_gpu(dim_y, incy);
+    device_matrix<T> dA(M, N, lda);
+    device_vector<T> dx(dim_x, incx), dy(dim_y, incy), d_alpha(1), d_beta(1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    rocblas_seedrand();
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, false, true);
+    rocblas_init_vector(hy, arg, rocblas_client_beta_sets_nan);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        if(pointer_mode == rocblas_pointer_mode_host && !arg.pointer_mode_host)
+            continue;
+        if(pointer_mode == rocblas_pointer_mode_device && !arg.pointer_mode_device)
+            continue;
+
+        bool     host  = pointer_mode == rocblas_pointer_mode_host;
+        const T* alpha = host ? &h_alpha : d_alpha;
+        const T* beta  = host ? &h_beta : d_beta;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_gemv_fn(handle, transA, M, N, alpha, dA, lda, dx, incx, beta, dy, incy));
+        CHECK_HIP_ERROR(hy_gold.transfer_from(dy));
+
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_gemv_fast_fn(handle, transA, M, N, alpha, dA, lda, dx, incx, beta, dy, incy));
+        CHECK_HIP_ERROR(hy_gpu.transfer_from(dy));
+
+        if(arg.unit_check)
+            unit_check_general<T>(1, dim_y, incy, hy_gold, hy_gpu);
+    }
+}
+
+template <typename T>
+void testing_gemm_fast_bad_arg(const Arguments& arg)
+{
+    auto rocblas_gemm_fast_fn = rocblas_gemm_fast<T>;
+
+    const rocblas_operation op = rocblas_operation_none;
+    const rocblas_int       M = 100, N = 100, K = 100, lda = 100, ldb = 100, ldc = 100;
+    const T                 alpha = T(1), beta = T(1);
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    device_matrix<T> dA(M, K, lda), dB(K, N, ldb), dC(M, N, ldc);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+    // the calls below share the operations, K and the leading dimensions
+    auto call = [&](rocblas_handle h,
+                    rocblas_int    m,
+                    rocblas_int    n,
+                    const T*       a,
+                    const T*       A,
+                    const T*       B,
+                    const T*       b,
+                    T*             C) {
+        return rocblas_gemm_fast_fn(h, op, op, m, n, K, a, A, lda, B, ldb, b, C, ldc);
+    };
+
+    EXPECT_ROCBLAS_STATUS(call(nullptr, M, N, &alpha, dA, dB, &beta, dC),
+                          rocblas_status_invalid_handle);
+
+    // nothing to compute, the pointers are not read
+    EXPECT_ROCBLAS_STATUS(call(handle, 0, N, nullptr, nullptr, nullptr, nullptr, nullptr),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, 0, nullptr, nullptr, nullptr, nullptr, nullptr),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_gemm_fast(const Arguments& arg)
+{
+    auto rocblas_gemm_fn      = rocblas_gemm<T>;
+    auto rocblas_gemm_fast_fn = rocblas_gemm_fast<T>;
+
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+    rocblas_int       M      = arg.M;
+    rocblas_int       N      = arg.N;
+    rocblas_int       K      = arg.K;
+    rocblas_int       lda    = arg.lda;
+    rocblas_int       ldb    = arg.ldb;
+    rocblas_int       ldc    = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    rocblas_local_handle handle{arg};
+
+    if(M <= 0 || N <= 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_fast_fn(handle,
+                                                   transA,
+                                                   transB,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   nullptr,
+                                                   nullptr,
+                                                   lda,
+                                                   nullptr,
+                                                   ldb,
+                                                   nullptr,
+                                                   nullptr,
+                                                   ldc),
+                              rocblas_status_success);
+        return;
+    }
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : std::max(K, 1);
+    rocblas_int A_col = transA == rocblas_operation_none ? std::max(K, 1) : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? std::max(K, 1) : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : std::max(K, 1);
+
+    host_matrix<T>   hA(A_row, A_col, lda), hB(B_row, B_col, ldb);
+    host_matrix<T>   hC(M, N, ldc), hC_gold(M, N, ldc), hC_gpu(M, N, ldc);
+    device_matrix<T> dA(A_row, A_col, lda), dB(B_row, B_col, ldb), dC(M, N, ldc);
+    device_vector<T> d_alpha(1), d_beta(1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    rocblas_seedrand();
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(
+        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        if(pointer_mode == rocblas_pointer_mode_host && !arg.pointer_mode_host)
+            continue;
+        if(pointer_mode == rocblas_pointer_mode_device && !arg.pointer_mode_device)
+            continue;
+
+        bool     host  = pointer_mode == rocblas_pointer_mode_host;
+        const T* alpha = host ? &h_alpha : d_alpha;
+        const T* beta  = host ? &h_beta : d_beta;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_fn(
+            handle, transA, transB, M, N, K, alpha, dA, lda, dB, ldb, beta, dC, ldc));
+        CHECK_HIP_ERROR(hC_gold.transfer_from(dC));
+
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_fast_fn(
+            handle, transA, transB, M, N, K, alpha, dA, lda, dB, ldb, beta, dC, ldc));
+        CHECK_HIP_ERROR(hC_gpu.transfer_from(dC));
+
+        if(arg.unit_check)
+            unit_check_general<T>(M, N, ldc, hC_gold, hC_gpu);
+    }
+}
@@ -0,0 +1,344 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+template <typename T>
+void testing_gemm_batch_scalars_bad_arg(const Arguments& arg)
+{
+    const rocblas_operation op = rocblas_operation_none;
+    const rocblas_int       M = 16, N = 16, K = 16, ld = 16, batch_count = 3;
+    const rocblas_stride    stride = rocblas_stride(ld) * N;
+    const rocblas_gemm_algo algo   = rocblas_gemm_algo_standard;
+
+    rocblas_local_handle handle{arg};
+
+    device_vector<T> d_alpha(batch_count), d_beta(batch_count);
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    rocblas_gemm_batch_scalars scalars{d_alpha, 1, d_beta, 1};
+    EXPECT_ROCBLAS_STATUS(rocblas_set_gemm_batch_scalars(nullptr, &scalars),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_set_gemm_batch_scalars(handle, nullptr), rocblas_status_success);
+
+    rocblas_gemm_batch_scalars bad = scalars;
+    bad.alpha                      = nullptr;
+    EXPECT_ROCBLAS_STATUS(rocblas_set_gemm_batch_scalars(handle, &bad),
+                          rocblas_status_invalid_pointer);
+    bad      = scalars;
+    bad.beta = nullptr;
+    EXPECT_ROCBLAS_STATUS(rocblas_set_gemm_batch_scalars(handle, &bad),
+                          rocblas_status_invalid_pointer);
+    bad              = scalars;
+    bad.stride_alpha = -1;
+    EXPECT_ROCBLAS_STATUS(rocblas_set_gemm_batch_scalars(handle, &bad),
+                          rocblas_status_invalid_size);
+    bad             = scalars;
+    bad.stride_beta = -1;
+    EXPECT_ROCBLAS_STATUS(rocblas_set_gemm_batch_scalars(handle, &bad),
+                          rocblas_status_invalid_size);
+
+    // The source kernels do not compute mixed precisions, here half inputs with float outputs
+    if constexpr(std::is_same_v<T, float>)
+    {
+        device_vector<rocblas_half> dA(stride * batch_count), dB(stride * batch_count);
+        device_vector<float>        dC(stride * batch_count), dD(stride * batch_count);
+        CHECK_DEVICE_ALLOCATION(dA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dB.memcheck());
+        CHECK_DEVICE_ALLOCATION(dC.memcheck());
+        CHECK_DEVICE_ALLOCATION(dD.memcheck());
+
+        const float alpha = 1.0f, beta = 0.0f;
+        auto        gemm  = [&]() {
+            return rocblas_gemm_strided_batched_ex(handle,
+                                                   op,
+                                                   op,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   &alpha,
+                                                   dA,
+                                                   rocblas_datatype_f16_r,
+                                                   ld,
+                                                   stride,
+                                                   dB,
+                                                   rocblas_datatype_f16_r,
+                                                   ld,
+                                                   stride,
+                                                   &beta,
+                                                   dC,
+                                                   rocblas_datatype_f32_r,
+                                                   ld,
+                                                   stride,
+                                                   dD,
+                                                   rocblas_datatype_f32_r,
+                                                   ld,
+                                                   stride,
+                                                   batch_count,
+                                                   rocblas_datatype_f32_r,
+                                                   algo,
+                                                   0,
+                                                   rocblas_gemm_flags_none);
+        };
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_gemm_batch_scalars(handle, &scalars));
+        EXPECT_ROCBLAS_STATUS(gemm(), rocblas_status_not_implemented);
+
+        // The 64-bit interface ignores the scalars
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_strided_batched_ex_64(handle,
+                                                                 op,
+                                                                 op,
+                                                                 M,
+                                                                 N,
+                                                                 K,
+                                                                 &alpha,
+                                                                 dA,
+                                                                 rocblas_datatype_f16_r,
+                                                                 ld,
+                                                                 stride,
+                                                                 dB,
+                                                                 rocblas_datatype_f16_r,
+                                                                 ld,
+                                                                 stride,
+                                                                 &beta,
+                                                                 dC,
+                                                                 rocblas_datatype_f32_r,
+                                                                 ld,
+                                                                 stride,
+                                                                 dD,
+                                                                 rocblas_datatype_f32_r,
+                                                                 ld,
+                                                                 stride,
+                                                                 batch_count,
+                                                                 rocblas_datatype_f32_r,
+                                                                 algo,
+                                                                 0,
+                                                                 rocblas_gemm_flags_none),
+                              rocblas_status_success);
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_gemm_batch_scalars(handle, nullptr));
+        EXPECT_ROCBLAS_STATUS(gemm(), rocblas_status_success);
+    }
+}
+
+template <typename T>
+void testing_gemm_batch_scalars(const Arguments& arg)
+{
+    rocblas_operation transA      = char2rocblas_operation(arg.transA);
+    rocblas_operation transB      = char2rocblas_operation(arg.transB);
+    rocblas_int       M           = arg.M;
+    rocblas_int       N           = arg.N;
+    rocblas_int       K           = arg.K;
+    rocblas_int       lda         = arg.lda;
+    rocblas_int       ldb         = arg.ldb;
+    rocblas_int       ldc         = arg.ldc;
+    rocblas_int       batch_count = arg.batch_count;
+
+    const rocblas_datatype  type = rocblas_type2datatype<T>();
+    const rocblas_gemm_algo algo = rocblas_gemm_algo_standard;
+
+    rocblas_local_handle handle{arg};
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : K;
+    rocblas_int A_col = transA == rocblas_operation_none ? K : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? K : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : K;
+
+    if(M <= 0 || N <= 0 || K < 0 || batch_count <= 0 || lda < A_row || ldb < B_row || ldc < M)
+        return;
+
+    rocblas_stride stride_a = rocblas_stride(lda) * std::max(A_col, 1);
+    rocblas_stride stride_b = rocblas_stride(ldb) * std::max(B_col, 1);
+    rocblas_stride stride_c = rocblas_stride(ldc) * N;
+
+    // alpha is contiguous and beta every other element, so that both strides are used. Some
+    // batches have alpha == 0 or beta == 0.
+    const rocblas_stride stride_alpha = 1, stride_beta = 2;
+    host_vector<T>       h_alpha(batch_count), h_beta(size_t(batch_count) * stride_beta);
+    for(rocblas_int i = 0; i < batch_count; i++)
+    {
+        h_alpha[i]                  = T(i % 4 - 1);
+        h_beta[i * stride_beta]     = T(i % 3);
+        h_beta[i * stride_beta + 1] = T(7);
+    }
+
+    host_vector<T> hA(stride_a * batch_count), hB(stride_b * batch_count),
+        hC(stride_c * batch_count), hD_gold(stride_c * batch_count), hD(stride_c * batch_count);
+    host_vector<T*> hA_array(batch_count), hB_array(batch_count), hC_array(batch_count),
+        hD_array(batch_count);
+
+    device_vector<T>  dA(stride_a * batch_count), dB(stride_b * batch_count),
+        dC(stride_c * batch_count), dD(stride_c * batch_count);
+    device_vector<T>  d_alpha(batch_count), d_beta(size_t(batch_count) * stride_beta),
+        d_one(1);
+    device_vector<T*> dA_array(batch_count), dB_array(batch_count), dC_array(batch_count),
+        dD_array(batch_count);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_one.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA_array.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB_array.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC_array.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD_array.memcheck());
+
+    // integer data keeps the results exact
+    rocblas_seedrand();
+    rocblas_init<T>(hA, lda, size_t(stride_a / lda) * batch_count, lda);
+    rocblas_init<T>(hB, ldb, size_t(stride_b / ldb) * batch_count, ldb);
+    rocblas_init<T>(hC, ldc, size_t(N) * batch_count, ldc);
+
+    // the pointer arrays of gemm_batched_ex point to the matrices of the strided buffers
+    for(rocblas_int i = 0; i < batch_count; i++)
+    {
+        hA_array[i] = (T*)dA + i * stride_a;
+        hB_array[i] = (T*)dB + i * stride_b;
+        hC_array[i] = (T*)dC + i * stride_c;
+        hD_array[i] = (T*)dD + i * stride_c;
+    }
+
+    const T h_one(1);
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(d_alpha.transfer_from(h_alpha));
+    CHECK_HIP_ERROR(d_beta.transfer_from(h_beta));
+    CHECK_HIP_ERROR(hipMemcpy(d_one, &h_one, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(dA_array.transfer_from(hA_array));
+    CHECK_HIP_ERROR(dB_array.transfer_from(hB_array));
+    CHECK_HIP_ERROR(dC_array.transfer_from(hC_array));
+    CHECK_HIP_ERROR(dD_array.transfer_from(hD_array));
+
+    // the CPU reference, with the scalars of each batch or with alpha and beta for all
+    auto reference = [&](bool per_batch, T alpha, T beta) {
+        hD_gold = hC;
+        for(rocblas_int i = 0; i < batch_count; i++)
+            ref_gemm<T>(transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        per_batch ? h_alpha[i * stride_alpha] : alpha,
+                        &hA[i * stride_a],
+                        lda,
+                        &hB[i * stride_b],
+                        ldb,
+                        per_batch ? h_beta[i * stride_beta] : beta,
+                        &hD_gold[i * stride_c],
+                        ldc);
+    };
+
+    auto run = [&](bool batched, const T* alpha, const T* beta) {
+        CHECK_HIP_ERROR(hipMemset(dD, 0, sizeof(T) * stride_c * batch_count));
+        if(batched)
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_batched_ex(handle,
+                                                        transA,
+                                                        transB,
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        alpha,
+                                                        dA_array,
+                                                        type,
+                                                        lda,
+                                                        dB_array,
+                                                        type,
+                                                        ldb,
+                                                        beta,
+                                                        dC_array,
+                                                        type,
+                                                        ldc,
+                                                        dD_array,
+                                                        type,
+                                                        ldc,
+                                                        batch_count,
+                                                        type,
+                                                        algo,
+                                                        0,
+                                                        rocblas_gemm_flags_none));
+        else
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_strided_batched_ex(handle,
+                                                                transA,
+                                                                transB,
+                                                                M,
+                                                                N,
+                                                                K,
+                                                                alpha,
+                                                                dA,
+                                                                type,
+                                                                lda,
+                                                                stride_a,
+                                                                dB,
+                                                                type,
+                                                                ldb,
+                                                                stride_b,
+                                                                beta,
+                                                                dC,
+                                                                type,
+                                                                ldc,
+                                                                stride_c,
+                                                                dD,
+                                                                type,
+                                                                ldc,
+                                                                stride_c,
+                                                                batch_count,
+                                                                type,
+                                                                algo,
+                                                                0,
+                                                                rocblas_gemm_flags_none));
+        CHECK_HIP_ERROR(hD.transfer_from(dD));
+    };
+
+    rocblas_gemm_batch_scalars scalars{d_alpha, stride_alpha, d_beta, stride_beta};
+    for(bool batched : {false, true})
+    {
+        // The alpha and beta arguments are not used while the scalars are set, whatever the
+        // pointer mode
+        CHECK_ROCBLAS_ERROR(rocblas_set_gemm_batch_scalars(handle, &scalars));
+        reference(true, T(0), T(0));
+        for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+        {
+            bool     host = pointer_mode == rocblas_pointer_mode_host;
+            const T* one  = host ? &h_one : (const T*)d_one;
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+            run(batched, one, one);
+            if(arg.unit_check)
+                unit_check_general<T>(M, N, ldc, stride_c, hD_gold, hD, batch_count);
+        }
+
+        // Clearing the scalars makes the calls use their arguments again
+        CHECK_ROCBLAS_ERROR(rocblas_set_gemm_batch_scalars(handle, nullptr));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        reference(false, h_one, h_one);
+        run(batched, &h_one, &h_one);
+        if(arg.unit_check)
+            unit_check_general<T>(M, N, ldc, stride_c, hD_gold, hD, batch_count);
+    }
+}
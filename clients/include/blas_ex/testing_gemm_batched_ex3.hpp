@@ -1095,6 +1095,53 @@ void testing_gemm_batched_ex3(const Arguments& arg)
         // copy output from device to CPU
         CHECK_HIP_ERROR(hD_2.transfer_from(dDref));
 
+        // The batches of the per-batch paths spread across auxiliary streams give the same results
+        if(batch_count > 1)
+        {
+            hipStream_t aux_streams[2];
+            for(auto& aux_stream : aux_streams)
+                CHECK_HIP_ERROR(hipStreamCreate(&aux_stream));
+            CHECK_ROCBLAS_ERROR(rocblas_set_auxiliary_streams(handle, 2, aux_streams));
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+            CHECK_HIP_ERROR(dC.transfer_from(hC));
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_batched_ex3_fn(handle,
+                                                            transA,
+                                                            transB,
+                                                            M,
+                                                            N,
+                                                            K,
+                                                            &h_alpha_Tc,
+                                                            dA.ptr_on_device(),
+                                                            arg.a_type,
+                                                            lda,
+                                                            dB.ptr_on_device(),
+                                                            arg.b_type,
+                                                            ldb,
+                                                            &h_beta_Tc,
+                                                            dC.ptr_on_device(),
+                                                            arg.c_type,
+                                                            ldc,
+                                                            dDref.ptr_on_device(),
+                                                            d_type,
+                                                            ldd,
+                                                            batch_count,
+                                                            arg.composite_compute_type,
+                                                            algo,
+                                                            solution_index,
+                                                            flags));
+
+            host_batch_matrix<To> hD_aux(M, N, ldd, batch_count);
+            CHECK_HIP_ERROR(hD_aux.memcheck());
+            CHECK_HIP_ERROR(hD_aux.transfer_from(dDref));
+            CHECK_ROCBLAS_ERROR(rocblas_set_auxiliary_streams(handle, 0, nullptr));
+            for(auto& aux_stream : aux_streams)
+                CHECK_HIP_ERROR(hipStreamDestroy(aux_stream));
+
+            if(arg.unit_check)
+                unit_check_general<To, To>(M, N, ldd, hD_1, hD_aux, batch_count);
+        }
+
         // copy C matrix into D matrix
         copy_matrix_with_different_leading_dimensions(hC, hD_gold);
 
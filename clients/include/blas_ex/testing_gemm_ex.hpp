@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include "benchmark.hpp"
 #include "frequency_monitor.hpp"
 #include "testing_common.hpp"
 
@@ -556,6 +557,9 @@ void testing_gemm_ex(const Arguments& arg)
         //   of dA, dB, dC, dD, and if flush_memory_size is large enough they will be evicted
         //   from cache before they are reused.
         // - The individual matrices are aligned on the same byte boundaries provided by hipMalloc.
+        // - arg.hot_operands names the operands which are not cycled, and stay in cache, and
+        //   arg.cache_flush and arg.noise_bytes set the cache state before each call, see
+        //   BenchmarkCacheState.
 
         rocblas_stride stride_a = lda * A_col;
         rocblas_stride stride_b = ldb * B_col;
@@ -617,36 +621,51 @@ void testing_gemm_ex(const Arguments& arg)
         hipStream_t stream;
         CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
 
+        BenchmarkCacheState cache_state(arg, stream);
+        bool                hot_A = BenchmarkCacheState::hot(arg, 'A');
+        bool                hot_B = BenchmarkCacheState::hot(arg, 'B');
+        bool                hot_C = BenchmarkCacheState::hot(arg, 'C');
+
         FrequencyMonitor& freq_monitor = getFrequencyMonitor();
         freq_monitor.start();
         gpu_time_used = get_time_us_sync(stream); // in microseconds
         for(int i = 0; i < number_hot_calls; i++)
         {
             int flush_index = (i + 1) % flush_batch_count;
+            int a_index     = hot_A ? 0 : flush_index;
+            int b_index     = hot_B ? 0 : flush_index;
+            int c_index     = hot_C ? 0 : flush_index;
+
+            cache_state.before_call(i);
             // clang-format off
             if(arg.outofplace)
             {
                 DAPI_DISPATCH(rocblas_gemm_ex_fn, (handle, transA, transB, M, N, K, &h_alpha_Tc,
-                                   dA[flush_index], arg.a_type, lda,
-                                   dB[flush_index], arg.b_type, ldb, &h_beta_Tc,
-                                   dC[flush_index], arg.c_type, ldc,
-                                   dD[          0],     d_type, ldd,
+                                   dA[a_index], arg.a_type, lda,
+                                   dB[b_index], arg.b_type, ldb, &h_beta_Tc,
+                                   dC[c_index], arg.c_type, ldc,
+                                   dD[      0],     d_type, ldd,
                                    arg.compute_type, algo, solution_index, flags));
             }
             else
             {
                 DAPI_DISPATCH(rocblas_gemm_ex_fn, (handle, transA, transB, M, N, K, &h_alpha_Tc,
-                                   dA[flush_index], arg.a_type, lda,
-                                   dB[flush_index], arg.b_type, ldb, &h_beta_Tc,
-                                   dC[flush_index], arg.c_type, ldc,
-                                   dD[flush_index],     d_type, ldd,
+                                   dA[a_index], arg.a_type, lda,
+                                   dB[b_index], arg.b_type, ldb, &h_beta_Tc,
+                                   dC[c_index], arg.c_type, ldc,
+                                   dD[c_index],     d_type, ldd,
                                    arg.compute_type, algo, solution_index, flags));
             }
             // clang-format on
+            cache_state.after_call(i);
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
         freq_monitor.stop();
 
+        // the calls alone, without the cache flushes and noise between them
+        if(cache_state.active())
+            gpu_time_used = cache_state.time_us();
+
         ArgumentModel<e_transA,
                       e_transB,
                       e_M,
@@ -0,0 +1,285 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+template <typename T>
+void testing_gemm_grouped_ex_bad_arg(const Arguments& arg)
+{
+    const rocblas_datatype  type   = rocblas_type2datatype<T>();
+    const rocblas_gemm_algo algo   = rocblas_gemm_algo_standard;
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_operation transB = rocblas_operation_none;
+
+    const rocblas_int M = 10, N = 11, K = 12, lda = 13, ldb = 13, ldc = 13, ldd = 13;
+    const rocblas_int group_size = 2;
+
+    const T alpha(1), beta(2);
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    // only the pointer arrays are read by the argument checks
+    device_vector<T*> dA(group_size), dB(group_size), dC(group_size), dD(group_size);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+
+#define GEMM_GROUPED_EX_ARGS(handle_, count_, m_, alpha_, a_, d_, lda_)                    \
+    handle_, count_, &transA, &transB, m_, &N, &K, alpha_, a_, type, lda_, dB, type, &ldb, \
+        &beta, dC, type, &ldc, d_, type, &ldd, &group_size, type, algo, 0, 0
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_grouped_ex(GEMM_GROUPED_EX_ARGS(nullptr, 1, &M, &alpha, dA, dD, &lda)),
+        rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_grouped_ex(GEMM_GROUPED_EX_ARGS(handle, -1, &M, &alpha, dA, dD, &lda)),
+        rocblas_status_invalid_size);
+
+    // no group is a quick return
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_grouped_ex(GEMM_GROUPED_EX_ARGS(
+                              handle, 0, nullptr, nullptr, nullptr, nullptr, nullptr)),
+                          rocblas_status_success);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_grouped_ex(GEMM_GROUPED_EX_ARGS(handle, 1, nullptr, &alpha, dA, dD, &lda)),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_grouped_ex(GEMM_GROUPED_EX_ARGS(handle, 1, &M, &alpha, dA, dD, nullptr)),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_grouped_ex(GEMM_GROUPED_EX_ARGS(handle, 1, &M, nullptr, dA, dD, &lda)),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_grouped_ex(GEMM_GROUPED_EX_ARGS(handle, 1, &M, &alpha, nullptr, dD, &lda)),
+        rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_grouped_ex(GEMM_GROUPED_EX_ARGS(handle, 1, &M, &alpha, dA, nullptr, &lda)),
+        rocblas_status_invalid_pointer);
+
+    const rocblas_int lda_small = M - 1;
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_gemm_grouped_ex(GEMM_GROUPED_EX_ARGS(handle, 1, &M, &alpha, dA, dD, &lda_small)),
+        rocblas_status_invalid_size);
+
+#undef GEMM_GROUPED_EX_ARGS
+}
+
+template <typename T>
+void testing_gemm_grouped_ex(const Arguments& arg)
+{
+    const rocblas_datatype  type   = rocblas_type2datatype<T>();
+    const rocblas_gemm_algo algo   = rocblas_gemm_algo_standard;
+    rocblas_operation       transA = char2rocblas_operation(arg.transA);
+    rocblas_operation       transB = char2rocblas_operation(arg.transB);
+
+    // group g has its own shape, leading dimensions, scalars and number of problems
+    const rocblas_int group_count = 3;
+
+    std::vector<rocblas_operation> trans_a(group_count, transA), trans_b(group_count, transB);
+    std::vector<rocblas_int>       m(group_count), n(group_count), k(group_count);
+    std::vector<rocblas_int>       lda(group_count), ldb(group_count), ldc(group_count);
+    std::vector<rocblas_int>       group_size(group_count);
+    host_vector<T>                 h_alpha(group_count), h_beta(group_count);
+
+    rocblas_int total = 0;
+    for(rocblas_int g = 0; g < group_count; g++)
+    {
+        m[g]          = arg.M + g;
+        n[g]          = arg.N + 2 * g;
+        k[g]          = arg.K + g;
+        lda[g]        = (transA == rocblas_operation_none ? m[g] : k[g]) + g;
+        ldb[g]        = (transB == rocblas_operation_none ? k[g] : n[g]) + 2 * g;
+        ldc[g]        = m[g] + g;
+        group_size[g] = arg.batch_count + g;
+        h_alpha[g]    = arg.get_alpha<T>() * T(g + 1);
+        h_beta[g]     = arg.get_beta<T>();
+        total += group_size[g];
+    }
+
+    rocblas_local_handle handle{arg};
+
+    // the problems of each group are contiguous, the pointer arrays list all the problems
+    std::vector<size_t>                            stride_a(group_count), stride_b(group_count);
+    std::vector<size_t>                            stride_c(group_count);
+    std::vector<host_vector<T>>                    hA, hB, hC, hD_gold;
+    std::vector<std::unique_ptr<device_vector<T>>> dA, dB, dC, dD;
+    host_vector<T*>                                hA_ptr(total), hB_ptr(total), hC_ptr(total);
+    host_vector<T*>                                hD_ptr(total);
+
+    for(rocblas_int g = 0, p = 0; g < group_count; g++)
+    {
+        stride_a[g] = size_t(lda[g]) * (transA == rocblas_operation_none ? k[g] : m[g]);
+        stride_b[g] = size_t(ldb[g]) * (transB == rocblas_operation_none ? n[g] : k[g]);
+        stride_c[g] = size_t(ldc[g]) * n[g];
+
+        hA.emplace_back(stride_a[g] * group_size[g]);
+        hB.emplace_back(stride_b[g] * group_size[g]);
+        hC.emplace_back(stride_c[g] * group_size[g]);
+        dA.emplace_back(std::make_unique<device_vector<T>>(hA[g].size()));
+        dB.emplace_back(std::make_unique<device_vector<T>>(hB[g].size()));
+        dC.emplace_back(std::make_unique<device_vector<T>>(hC[g].size()));
+        dD.emplace_back(std::make_unique<device_vector<T>>(hC[g].size()));
+        CHECK_DEVICE_ALLOCATION(dA[g]->memcheck());
+        CHECK_DEVICE_ALLOCATION(dB[g]->memcheck());
+        CHECK_DEVICE_ALLOCATION(dC[g]->memcheck());
+        CHECK_DEVICE_ALLOCATION(dD[g]->memcheck());
+
+        rocblas_init<T>(hA[g], hA[g].size(), 1, 1);
+        rocblas_init<T>(hB[g], hB[g].size(), 1, 1);
+        rocblas_init<T>(hC[g], hC[g].size(), 1, 1);
+        CHECK_HIP_ERROR(dA[g]->transfer_from(hA[g]));
+        CHECK_HIP_ERROR(dB[g]->transfer_from(hB[g]));
+        CHECK_HIP_ERROR(dC[g]->transfer_from(hC[g]));
+        CHECK_HIP_ERROR(dD[g]->transfer_from(hC[g]));
+
+        for(rocblas_int i = 0; i < group_size[g]; i++, p++)
+        {
+            hA_ptr[p] = (T*)*dA[g] + i * stride_a[g];
+            hB_ptr[p] = (T*)*dB[g] + i * stride_b[g];
+            hC_ptr[p] = (T*)*dC[g] + i * stride_c[g];
+            hD_ptr[p] = (T*)*dD[g] + i * stride_c[g];
+        }
+
+        // D = alpha*op(A)*op(B) + beta*C of every problem of the group
+        hD_gold.push_back(hC[g]);
+        for(rocblas_int i = 0; i < group_size[g]; i++)
+            ref_gemm<T>(transA,
+                        transB,
+                        m[g],
+                        n[g],
+                        k[g],
+                        h_alpha[g],
+                        hA[g].data() + i * stride_a[g],
+                        lda[g],
+                        hB[g].data() + i * stride_b[g],
+                        ldb[g],
+                        h_beta[g],
+                        hD_gold[g].data() + i * stride_c[g],
+                        ldc[g]);
+    }
+
+    device_vector<T*> dA_ptr(total), dB_ptr(total), dC_ptr(total), dD_ptr(total);
+    device_vector<T>  d_alpha(group_count), d_beta(group_count);
+    CHECK_DEVICE_ALLOCATION(dA_ptr.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB_ptr.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC_ptr.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD_ptr.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+    CHECK_HIP_ERROR(dA_ptr.transfer_from(hA_ptr));
+    CHECK_HIP_ERROR(dB_ptr.transfer_from(hB_ptr));
+    CHECK_HIP_ERROR(dC_ptr.transfer_from(hC_ptr));
+    CHECK_HIP_ERROR(dD_ptr.transfer_from(hD_ptr));
+    CHECK_HIP_ERROR(d_alpha.transfer_from(h_alpha));
+    CHECK_HIP_ERROR(d_beta.transfer_from(h_beta));
+
+    auto gemm_grouped_ex = [&](const T* alpha, const T* beta, const rocblas_int* lda_) {
+        return rocblas_gemm_grouped_ex(handle,
+                                       group_count,
+                                       trans_a.data(),
+                                       trans_b.data(),
+                                       m.data(),
+                                       n.data(),
+                                       k.data(),
+                                       alpha,
+                                       dA_ptr,
+                                       type,
+                                       lda_,
+                                       dB_ptr,
+                                       type,
+                                       ldb.data(),
+                                       beta,
+                                       dC_ptr,
+                                       type,
+                                       ldc.data(),
+                                       dD_ptr,
+                                       type,
+                                       ldc.data(),
+                                       group_size.data(),
+                                       type,
+                                       algo,
+                                       0,
+                                       0);
+    };
+
+    auto check_groups = [&](rocblas_int groups) {
+        for(rocblas_int g = 0; g < groups; g++)
+        {
+            host_vector<T> hD(hC[g].size());
+            CHECK_HIP_ERROR(hD.transfer_from(*dD[g]));
+            near_check_general<T>(m[g],
+                                  n[g],
+                                  ldc[g],
+                                  stride_c[g],
+                                  hD_gold[g],
+                                  hD,
+                                  group_size[g],
+                                  k[g] * sum_error_tolerance<T>);
+        }
+    };
+
+    if(arg.pointer_mode_host)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(gemm_grouped_ex(h_alpha, h_beta, lda.data()));
+        handle.post_test(arg);
+        check_groups(group_count);
+    }
+
+    if(arg.pointer_mode_device)
+    {
+        for(rocblas_int g = 0; g < group_count; g++)
+            CHECK_HIP_ERROR(dD[g]->transfer_from(hC[g]));
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        handle.pre_test(arg);
+        CHECK_ROCBLAS_ERROR(gemm_grouped_ex(d_alpha, d_beta, lda.data()));
+        handle.post_test(arg);
+        check_groups(group_count);
+    }
+
+    // An invalid last group fails the call before any group is computed
+    for(rocblas_int g = 0; g < group_count; g++)
+        CHECK_HIP_ERROR(dD[g]->transfer_from(hC[g]));
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    std::vector<rocblas_int> lda_bad = lda;
+    lda_bad[group_count - 1]         = 0;
+    EXPECT_ROCBLAS_STATUS(gemm_grouped_ex(h_alpha, h_beta, lda_bad.data()),
+                          rocblas_status_invalid_size);
+    for(rocblas_int g = 0; g < group_count; g++)
+    {
+        host_vector<T> hD(hC[g].size());
+        CHECK_HIP_ERROR(hD.transfer_from(*dD[g]));
+        unit_check_general<T>(m[g], n[g], ldc[g], stride_c[g], hC[g], hD, group_size[g]);
+    }
+}
@@ -0,0 +1,363 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// The int32_t or int64_t index form of gemm_indexed_batched_ex, by the index type I
+template <typename I, typename... Args>
+rocblas_status rocblas_gemm_indexed_batched_ex_fn(Args... args)
+{
+    if constexpr(std::is_same_v<I, int64_t>)
+        return rocblas_gemm_indexed_batched_ex_i64(args...);
+    else
+        return rocblas_gemm_indexed_batched_ex(args...);
+}
+
+template <typename T>
+void testing_gemm_indexed_batched_ex_bad_arg(const Arguments& arg)
+{
+    const rocblas_operation op = rocblas_operation_none;
+    const rocblas_int       M = 100, N = 100, K = 100, lda = 100, ldb = 100, ldc = 100;
+    const rocblas_int       batch_count = 5;
+    const rocblas_stride    stride      = rocblas_stride(lda) * K;
+    const rocblas_datatype  type        = rocblas_type2datatype<T>();
+    const rocblas_gemm_algo algo        = rocblas_gemm_algo_standard;
+
+    const T alpha = T(1), beta = T(1), zero = T(0);
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    device_vector<T>       dA(stride * batch_count), dB(stride * batch_count),
+        dC(stride * batch_count), dD(stride * batch_count);
+    device_vector<int32_t> d_index(batch_count);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_index.memcheck());
+
+    // the calls below share the operations, N, K, the leading dimensions and the indices
+    auto call = [&](rocblas_handle h,
+                    rocblas_int    m,
+                    const T*       a_,
+                    const T*       A,
+                    rocblas_stride stride_a,
+                    const T*       b_,
+                    const T*       C,
+                    T*             D,
+                    rocblas_int    batch) {
+        return rocblas_gemm_indexed_batched_ex(h,
+                                               op,
+                                               op,
+                                               m,
+                                               N,
+                                               K,
+                                               a_,
+                                               A,
+                                               type,
+                                               lda,
+                                               stride_a,
+                                               d_index,
+                                               dB,
+                                               type,
+                                               ldb,
+                                               stride,
+                                               d_index,
+                                               b_,
+                                               C,
+                                               type,
+                                               ldc,
+                                               stride,
+                                               d_index,
+                                               D,
+                                               type,
+                                               ldc,
+                                               stride,
+                                               d_index,
+                                               batch,
+                                               type,
+                                               algo,
+                                               0,
+                                               rocblas_gemm_flags_none);
+    };
+
+    EXPECT_ROCBLAS_STATUS(call(nullptr, M, &alpha, dA, stride, &beta, dC, dD, batch_count),
+                          rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(call(handle, -1, &alpha, dA, stride, &beta, dC, dD, batch_count),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, &alpha, dA, stride, &beta, dC, dD, -1),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, &alpha, dA, -1, &beta, dC, dD, batch_count),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(call(handle, M, nullptr, dA, stride, &beta, dC, dD, batch_count),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, &alpha, dA, stride, nullptr, dC, dD, batch_count),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, &alpha, nullptr, stride, &beta, dC, dD, batch_count),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, &alpha, dA, stride, &beta, dC, nullptr, batch_count),
+                          rocblas_status_invalid_pointer);
+
+    // quick returns do not read the matrices, and A is not read when alpha == 0
+    EXPECT_ROCBLAS_STATUS(call(handle, 0, nullptr, nullptr, stride, nullptr, nullptr, nullptr, 1),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, nullptr, nullptr, stride, nullptr, nullptr, nullptr, 0),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, &zero, nullptr, stride, &beta, dC, dD, batch_count),
+                          rocblas_status_success);
+
+    // the pointer arrays are allocated while the gemm runs, so the size of a query covers both
+    size_t size = 0;
+    CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+    CHECK_ALLOC_QUERY(call(handle, M, &alpha, dA, stride, &beta, dC, dD, batch_count));
+    CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+    EXPECT_GE(size, sizeof(void*) * 4 * batch_count);
+}
+
+template <typename T>
+void testing_gemm_indexed_batched_ex(const Arguments& arg)
+{
+    rocblas_operation transA      = char2rocblas_operation(arg.transA);
+    rocblas_operation transB      = char2rocblas_operation(arg.transB);
+    rocblas_int       M           = arg.M;
+    rocblas_int       N           = arg.N;
+    rocblas_int       K           = arg.K;
+    rocblas_int       lda         = arg.lda;
+    rocblas_int       ldb         = arg.ldb;
+    rocblas_int       ldc         = arg.ldc;
+    rocblas_int       batch_count = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    const rocblas_datatype  type = rocblas_type2datatype<T>();
+    const rocblas_gemm_algo algo = rocblas_gemm_algo_standard;
+
+    rocblas_local_handle handle{arg};
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : K;
+    rocblas_int A_col = transA == rocblas_operation_none ? K : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? K : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : K;
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || K < 0 || batch_count < 0 || lda < A_row || ldb < B_row
+                        || ldc < M;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_indexed_batched_ex(handle,
+                                                              transA,
+                                                              transB,
+                                                              M,
+                                                              N,
+                                                              K,
+                                                              nullptr,
+                                                              nullptr,
+                                                              type,
+                                                              lda,
+                                                              0,
+                                                              nullptr,
+                                                              nullptr,
+                                                              type,
+                                                              ldb,
+                                                              0,
+                                                              nullptr,
+                                                              nullptr,
+                                                              nullptr,
+                                                              type,
+                                                              ldc,
+                                                              0,
+                                                              nullptr,
+                                                              nullptr,
+                                                              type,
+                                                              ldc,
+                                                              0,
+                                                              nullptr,
+                                                              batch_count,
+                                                              type,
+                                                              algo,
+                                                              0,
+                                                              rocblas_gemm_flags_none),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Each operand is a pool of one more matrix than the batch. The indices read the pools of
+    // A and B in other orders than the batch, with repeats for B, and write the pool of D in
+    // reverse order, so that its slot 0 must be left as it was.
+    rocblas_int    slots    = batch_count + 1;
+    rocblas_stride stride_a = rocblas_stride(lda) * std::max(A_col, 1);
+    rocblas_stride stride_b = rocblas_stride(ldb) * std::max(B_col, 1);
+    rocblas_stride stride_c = rocblas_stride(ldc) * N;
+
+    // the index arrays of A, B, C and D, one after the other
+    host_vector<int64_t> h_index64(size_t(batch_count) * 4);
+    auto index = [&](int op, rocblas_int i) -> int64_t& {
+        return h_index64[op * size_t(batch_count) + i];
+    };
+    for(rocblas_int i = 0; i < batch_count; i++)
+    {
+        index(0, i) = batch_count - 1 - i;
+        index(1, i) = i / 2;
+        index(2, i) = (i + 1) % slots;
+        index(3, i) = slots - 1 - i;
+    }
+    host_vector<int32_t> h_index32(h_index64);
+
+    host_vector<T> hA(stride_a * slots), hB(stride_b * slots), hC(stride_c * slots),
+        hD(stride_c * slots), hD_gold(stride_c * slots), hD_gpu(stride_c * slots);
+
+    device_vector<T>       dA(stride_a * slots), dB(stride_b * slots), dC(stride_c * slots),
+        dD(stride_c * slots), d_alpha(1), d_beta(1);
+    device_vector<int32_t> d_index32(size_t(batch_count) * 4);
+    device_vector<int64_t> d_index64(size_t(batch_count) * 4);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_index32.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_index64.memcheck());
+
+    // integer data keeps the results exact
+    rocblas_seedrand();
+    rocblas_init<T>(hA, lda, size_t(stride_a / lda) * slots, lda);
+    rocblas_init<T>(hB, ldb, size_t(stride_b / ldb) * slots, ldb);
+    rocblas_init<T>(hD, ldc, size_t(N) * slots, ldc);
+
+    // C is not read when beta == 0
+    if(h_beta == T(0))
+        rocblas_init_nan<T>(hC, ldc, size_t(N) * slots, ldc);
+    else
+        rocblas_init<T>(hC, ldc, size_t(N) * slots, ldc);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(d_index32.transfer_from(h_index32));
+    CHECK_HIP_ERROR(d_index64.transfer_from(h_index64));
+
+    // the CPU reference for the indices, or for the batch as strided without them
+    auto reference = [&](bool indexed) {
+        hD_gold = hD;
+        for(rocblas_int i = 0; i < batch_count; i++)
+        {
+            size_t a = indexed ? index(0, i) : i, b = indexed ? index(1, i) : i;
+            size_t c = indexed ? index(2, i) : i, d = indexed ? index(3, i) : i;
+            T*     D = &hD_gold[d * stride_c];
+            std::copy(&hC[c * stride_c], &hC[c * stride_c] + stride_c, D);
+            ref_gemm<T>(transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        h_alpha,
+                        &hA[a * stride_a],
+                        lda,
+                        &hB[b * stride_b],
+                        ldb,
+                        h_beta,
+                        D,
+                        ldc);
+        }
+    };
+
+    auto run = [&](auto indices, const T* alpha, const T* beta) {
+        using I = std::remove_const_t<std::remove_pointer_t<decltype(indices)>>;
+        auto at = [&](int op) { return indices ? indices + op * size_t(batch_count) : nullptr; };
+        return rocblas_gemm_indexed_batched_ex_fn<I>(handle,
+                                                     transA,
+                                                     transB,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     alpha,
+                                                     (const T*)dA,
+                                                     type,
+                                                     lda,
+                                                     stride_a,
+                                                     at(0),
+                                                     (const T*)dB,
+                                                     type,
+                                                     ldb,
+                                                     stride_b,
+                                                     at(1),
+                                                     beta,
+                                                     (const T*)dC,
+                                                     type,
+                                                     ldc,
+                                                     stride_c,
+                                                     at(2),
+                                                     (T*)dD,
+                                                     type,
+                                                     ldc,
+                                                     stride_c,
+                                                     at(3),
+                                                     batch_count,
+                                                     type,
+                                                     algo,
+                                                     0,
+                                                     rocblas_gemm_flags_none);
+    };
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        if(pointer_mode == rocblas_pointer_mode_host && !arg.pointer_mode_host)
+            continue;
+        if(pointer_mode == rocblas_pointer_mode_device && !arg.pointer_mode_device)
+            continue;
+
+        bool     host  = pointer_mode == rocblas_pointer_mode_host;
+        const T* alpha = host ? &h_alpha : d_alpha;
+        const T* beta  = host ? &h_beta : d_beta;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        // int32_t and int64_t indices, then null indices which stride the batch
+        for(int form = 0; form < 3; form++)
+        {
+            CHECK_HIP_ERROR(dD.transfer_from(hD));
+            if(form == 0)
+                CHECK_ROCBLAS_ERROR(run((const int32_t*)d_index32, alpha, beta));
+            else if(form == 1)
+                CHECK_ROCBLAS_ERROR(run((const int64_t*)d_index64, alpha, beta));
+            else
+                CHECK_ROCBLAS_ERROR(run((const int32_t*)nullptr, alpha, beta));
+
+            if(arg.unit_check)
+            {
+                // the whole pool of D, so that the matrices not indexed are checked unchanged
+                reference(form < 2);
+                CHECK_HIP_ERROR(hD_gpu.transfer_from(dD));
+                unit_check_general<T>(ldc, size_t(N) * slots, ldc, hD_gold, hD_gpu);
+            }
+        }
+    }
+}
@@ -0,0 +1,381 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// Weight l of column j of the packed int4 matrix B, dequantized with its group's scale and
+// zero point, or symmetric around 8 without zero points
+template <typename T>
+float ref_gemm_int4_weight(const uint8_t* B,
+                           rocblas_int    ldb,
+                           const T*       scales,
+                           const T*       zeros,
+                           rocblas_int    groups,
+                           rocblas_int    group_size,
+                           rocblas_int    l,
+                           rocblas_int    j)
+{
+    uint8_t packed = B[size_t(j) * ldb + l / 2];
+    int     q      = (l & 1) ? packed >> 4 : packed & 0xf;
+    size_t  g      = l / group_size + size_t(j) * groups;
+    float   zero   = zeros ? float(zeros[g]) : 8.0f;
+    return float(scales[g]) * (float(q) - zero);
+}
+
+template <typename T>
+void ref_gemm_int4(rocblas_operation trans_a,
+                   rocblas_int       m,
+                   rocblas_int       n,
+                   rocblas_int       k,
+                   float             alpha,
+                   const T*          A,
+                   rocblas_int       lda,
+                   const uint8_t*    B,
+                   rocblas_int       ldb,
+                   const T*          scales,
+                   const T*          zeros,
+                   rocblas_int       group_size,
+                   float             beta,
+                   T*                C,
+                   rocblas_int       ldc)
+{
+    rocblas_int groups = k ? (k - 1) / group_size + 1 : 1;
+    for(rocblas_int j = 0; j < n; j++)
+    {
+        for(rocblas_int i = 0; i < m; i++)
+        {
+            double sum = 0;
+            for(rocblas_int l = 0; l < k; l++)
+            {
+                float a = float(trans_a == rocblas_operation_none ? A[i + size_t(l) * lda]
+                                                                  : A[l + size_t(i) * lda]);
+                sum += double(a)
+                       * ref_gemm_int4_weight(B, ldb, scales, zeros, groups, group_size, l, j);
+            }
+
+            T& c = C[i + size_t(j) * ldc];
+            c    = T(float(beta == 0 ? alpha * sum : alpha * sum + beta * double(float(c))));
+        }
+    }
+}
+
+template <typename T>
+void testing_gemm_int4_bad_arg(const Arguments& arg)
+{
+    auto rocblas_gemm_int4_fn = rocblas_gemm_int4<T>;
+
+    const rocblas_operation op = rocblas_operation_none;
+    const rocblas_int       M = 100, N = 100, K = 100, lda = 100, ldb = 50, ldc = 100;
+    const rocblas_int       gs = 32, groups = (K - 1) / gs + 1;
+
+    const float alpha = 1.0f, beta = 2.0f, zero = 0.0f, one = 1.0f;
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    device_vector<T>       dA(size_t(lda) * K), dC(size_t(ldc) * N);
+    device_vector<uint8_t> dB(size_t(ldb) * N);
+    device_vector<T>       dS(size_t(groups) * N), dzeros(size_t(groups) * N);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dS.memcheck());
+    CHECK_DEVICE_ALLOCATION(dzeros.memcheck());
+
+    // the calls below share N and the zero points, gs is the group size
+    auto call = [&](rocblas_handle    h,
+                    rocblas_operation trans,
+                    rocblas_int       m,
+                    rocblas_int       k,
+                    const float*      a,
+                    const T*          A,
+                    rocblas_int       lda_,
+                    const uint8_t*    B,
+                    rocblas_int       ldb_,
+                    const T*          scales,
+                    rocblas_int       gs_,
+                    const float*      b,
+                    T*                C,
+                    rocblas_int       ldc_) {
+        return rocblas_gemm_int4_fn(
+            h, trans, m, N, k, a, A, lda_, B, ldb_, scales, dzeros, gs_, b, C, ldc_);
+    };
+
+    EXPECT_ROCBLAS_STATUS(
+        call(nullptr, op, M, K, &alpha, dA, lda, dB, ldb, dS, gs, &beta, dC, ldc),
+        rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(call(handle,
+                               (rocblas_operation)rocblas_fill_full,
+                               M,
+                               K,
+                               &alpha,
+                               dA,
+                               lda,
+                               dB,
+                               ldb,
+                               dS,
+                               gs,
+                               &beta,
+                               dC,
+                               ldc),
+                          rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, -1, K, &alpha, dA, lda, dB, ldb, dS, gs, &beta, dC, ldc),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, -1, &alpha, dA, lda, dB, ldb, dS, gs, &beta, dC, ldc),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &alpha, dA, M - 1, dB, ldb, dS, gs, &beta, dC, ldc),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &alpha, dA, lda, dB, K / 2 - 1, dS, gs, &beta, dC, ldc),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &alpha, dA, lda, dB, ldb, dS, 0, &beta, dC, ldc),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &alpha, dA, lda, dB, ldb, dS, gs, &beta, dC, M - 1),
+        rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, nullptr, dA, lda, dB, ldb, dS, gs, &beta, dC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &alpha, dA, lda, dB, ldb, dS, gs, nullptr, dC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &alpha, nullptr, lda, dB, ldb, dS, gs, &beta, dC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &alpha, dA, lda, nullptr, ldb, dS, gs, &beta, dC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &alpha, dA, lda, dB, ldb, nullptr, gs, &beta, dC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &alpha, dA, lda, dB, ldb, dS, gs, &beta, nullptr, ldc),
+        rocblas_status_invalid_pointer);
+
+    // the zero points are optional
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_int4_fn(handle,
+                                               op,
+                                               M,
+                                               N,
+                                               K,
+                                               &alpha,
+                                               dA,
+                                               lda,
+                                               dB,
+                                               ldb,
+                                               dS,
+                                               nullptr,
+                                               gs,
+                                               &beta,
+                                               dC,
+                                               ldc),
+                          rocblas_status_success);
+
+    // quick return with an empty C, and with alpha == 0 and beta == 1
+    EXPECT_ROCBLAS_STATUS(call(handle,
+                               op,
+                               0,
+                               K,
+                               nullptr,
+                               nullptr,
+                               lda,
+                               nullptr,
+                               ldb,
+                               nullptr,
+                               gs,
+                               nullptr,
+                               nullptr,
+                               ldc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &zero, nullptr, lda, nullptr, ldb, nullptr, gs, &one, nullptr, ldc),
+        rocblas_status_success);
+
+    // A, B and the scales are not read when alpha == 0 or k == 0
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &zero, nullptr, lda, nullptr, ldb, nullptr, gs, &beta, dC, ldc),
+        rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, 0, &alpha, nullptr, lda, nullptr, ldb, nullptr, gs, &beta, dC, ldc),
+        rocblas_status_success);
+}
+
+template <typename T>
+void testing_gemm_int4(const Arguments& arg)
+{
+    auto rocblas_gemm_int4_fn = rocblas_gemm_int4<T>;
+
+    rocblas_operation trans_a    = char2rocblas_operation(arg.transA);
+    rocblas_int       M          = arg.M;
+    rocblas_int       N          = arg.N;
+    rocblas_int       K          = arg.K;
+    rocblas_int       lda        = arg.lda;
+    rocblas_int       ldb        = arg.ldb;
+    rocblas_int       ldc        = arg.ldc;
+    rocblas_int       group_size = arg.ldd;
+    bool              with_zeros = arg.algo;
+
+    float h_alpha = arg.get_alpha<float>();
+    float h_beta  = arg.get_beta<float>();
+
+    rocblas_local_handle handle{arg};
+
+    rocblas_int a_rows = trans_a == rocblas_operation_none ? M : K;
+    rocblas_int a_cols = trans_a == rocblas_operation_none ? K : M;
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || K < 0 || group_size < 1 || lda < std::max(a_rows, 1)
+                        || ldb < std::max((K + 1) / 2, 1) || ldc < std::max(M, 1);
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_int4_fn(handle,
+                                                   trans_a,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   nullptr,
+                                                   nullptr,
+                                                   lda,
+                                                   nullptr,
+                                                   ldb,
+                                                   nullptr,
+                                                   nullptr,
+                                                   group_size,
+                                                   nullptr,
+                                                   nullptr,
+                                                   ldc),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    rocblas_int groups  = K ? (K - 1) / group_size + 1 : 1;
+    size_t      size_A  = size_t(lda) * a_cols;
+    size_t      size_B  = size_t(ldb) * N;
+    size_t      size_C  = size_t(ldc) * N;
+    size_t      size_SZ = size_t(groups) * N;
+
+    host_vector<T>       hA(size_A), hC(size_C), hC_gold(size_C), hscales(size_SZ);
+    host_vector<T>       hzeros(size_SZ);
+    host_vector<uint8_t> hB(size_B);
+
+    device_vector<T>       dA(size_A), dC(size_C), dscales(size_SZ), dzeros(size_SZ);
+    device_vector<uint8_t> dB(size_B);
+    device_vector<float>   d_alpha(1), d_beta(1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dscales.memcheck());
+    CHECK_DEVICE_ALLOCATION(dzeros.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Small integers, power of two scales and integer zero points keep every product and sum
+    // exact in float, so the result only rounds once to T, as in the reference
+    rocblas_seedrand();
+    rocblas_init<T>(hA, a_rows, a_cols, lda);
+    for(auto& b : hB)
+        b = uint8_t(std::uniform_int_distribution<int>(0, 255)(t_rocblas_rng));
+    for(auto& s : hscales)
+        s = T(std::ldexp(1.0f, std::uniform_int_distribution<int>(-1, 1)(t_rocblas_rng)));
+    for(auto& z : hzeros)
+        z = T(float(std::uniform_int_distribution<int>(0, 15)(t_rocblas_rng)));
+
+    // C is not read when beta == 0
+    if(h_beta == 0)
+        rocblas_init_nan<T>(hC, M, N, ldc);
+    else
+        rocblas_init<T>(hC, M, N, ldc);
+    hC_gold = hC;
+
+    const T* d_zeros = with_zeros ? (const T*)dzeros : nullptr;
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dscales.transfer_from(hscales));
+    CHECK_HIP_ERROR(dzeros.transfer_from(hzeros));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(float), hipMemcpyHostToDevice));
+
+    // CPU reference
+    ref_gemm_int4<T>(trans_a,
+                     M,
+                     N,
+                     K,
+                     h_alpha,
+                     hA,
+                     lda,
+                     hB,
+                     ldb,
+                     hscales,
+                     with_zeros ? (const T*)hzeros : nullptr,
+                     group_size,
+                     h_beta,
+                     hC_gold,
+                     ldc);
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        if(pointer_mode == rocblas_pointer_mode_host && !arg.pointer_mode_host)
+            continue;
+        if(pointer_mode == rocblas_pointer_mode_device && !arg.pointer_mode_device)
+            continue;
+
+        bool host = pointer_mode == rocblas_pointer_mode_host;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_int4_fn(handle,
+                                                 trans_a,
+                                                 M,
+                                                 N,
+                                                 K,
+                                                 host ? &h_alpha : d_alpha,
+                                                 dA,
+                                                 lda,
+                                                 dB,
+                                                 ldb,
+                                                 dscales,
+                                                 d_zeros,
+                                                 group_size,
+                                                 host ? &h_beta : d_beta,
+                                                 dC,
+                                                 ldc));
+
+        if(arg.unit_check)
+        {
+            host_vector<T> hC_gpu(size_C);
+            CHECK_HIP_ERROR(hC_gpu.transfer_from(dC));
+            unit_check_general<T>(M, N, ldc, hC_gold, hC_gpu);
+        }
+    }
+}
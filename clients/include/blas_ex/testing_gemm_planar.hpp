@@ -0,0 +1,628 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// The real and imaginary parts of the interleaved complex z, or z from its parts for JOIN
+template <bool JOIN, typename T>
+void planar_split_join(host_vector<T>& z, host_vector<real_t<T>>& re, host_vector<real_t<T>>& im)
+{
+    for(size_t i = 0; i < z.size(); i++)
+    {
+        if(JOIN)
+            z[i] = T(re[i], im[i]);
+        else
+        {
+            re[i] = std::real(z[i]);
+            im[i] = std::imag(z[i]);
+        }
+    }
+}
+
+template <typename T>
+void testing_gemm_planar_bad_arg(const Arguments& arg)
+{
+    using U                     = real_t<T>;
+    auto rocblas_gemm_planar_fn = rocblas_gemm_planar<T>;
+
+    const rocblas_operation op = rocblas_operation_none;
+    const rocblas_int       M = 100, N = 100, K = 100, lda = 100, ldb = 100, ldc = 100;
+
+    const T alpha = T(1, 2), beta = T(2, 1), zero = T(0), one = T(1);
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    device_vector<U> dAr(size_t(lda) * K), dAi(size_t(lda) * K), dBr(size_t(ldb) * N),
+        dBi(size_t(ldb) * N), dCr(size_t(ldc) * N), dCi(size_t(ldc) * N);
+    CHECK_DEVICE_ALLOCATION(dAr.memcheck());
+    CHECK_DEVICE_ALLOCATION(dAi.memcheck());
+    CHECK_DEVICE_ALLOCATION(dBr.memcheck());
+    CHECK_DEVICE_ALLOCATION(dBi.memcheck());
+    CHECK_DEVICE_ALLOCATION(dCr.memcheck());
+    CHECK_DEVICE_ALLOCATION(dCi.memcheck());
+
+    // the calls below share N, transB and the leading dimensions of B and C
+    auto call = [&](rocblas_handle    h,
+                    rocblas_operation transA,
+                    rocblas_int       m,
+                    rocblas_int       k,
+                    const T*          a,
+                    const U*          Ar,
+                    const U*          Ai,
+                    rocblas_int       lda_,
+                    const U*          Br,
+                    const U*          Bi,
+                    const T*          b,
+                    U*                Cr,
+                    U*                Ci) {
+        return rocblas_gemm_planar_fn(
+            h, transA, op, m, N, k, a, Ar, Ai, lda_, Br, Bi, ldb, b, Cr, Ci, ldc);
+    };
+
+    EXPECT_ROCBLAS_STATUS(call(nullptr, op, M, K, &alpha, dAr, dAi, lda, dBr, dBi, &beta, dCr, dCi),
+                          rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(call(handle,
+                               (rocblas_operation)rocblas_fill_full,
+                               M,
+                               K,
+                               &alpha,
+                               dAr,
+                               dAi,
+                               lda,
+                               dBr,
+                               dBi,
+                               &beta,
+                               dCr,
+                               dCi),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_planar_fn(handle,
+                                                 op,
+                                                 (rocblas_operation)rocblas_fill_full,
+                                                 M,
+                                                 N,
+                                                 K,
+                                                 &alpha,
+                                                 dAr,
+                                                 dAi,
+                                                 lda,
+                                                 dBr,
+                                                 dBi,
+                                                 ldb,
+                                                 &beta,
+                                                 dCr,
+                                                 dCi,
+                                                 ldc),
+                          rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(call(handle, op, -1, K, &alpha, dAr, dAi, lda, dBr, dBi, &beta, dCr, dCi),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, op, M, -1, &alpha, dAr, dAi, lda, dBr, dBi, &beta, dCr, dCi),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &alpha, dAr, dAi, M - 1, dBr, dBi, &beta, dCr, dCi),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle,
+                               rocblas_operation_transpose,
+                               M,
+                               K + 1,
+                               &alpha,
+                               dAr,
+                               dAi,
+                               lda,
+                               dBr,
+                               dBi,
+                               &beta,
+                               dCr,
+                               dCi),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(call(handle, op, M, K, nullptr, dAr, dAi, lda, dBr, dBi, &beta, dCr, dCi),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &alpha, dAr, dAi, lda, dBr, dBi, nullptr, dCr, dCi),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &alpha, nullptr, dAi, lda, dBr, dBi, &beta, dCr, dCi),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &alpha, dAr, nullptr, lda, dBr, dBi, &beta, dCr, dCi),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &alpha, dAr, dAi, lda, nullptr, dBi, &beta, dCr, dCi),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &alpha, dAr, dAi, lda, dBr, nullptr, &beta, dCr, dCi),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &alpha, dAr, dAi, lda, dBr, dBi, &beta, nullptr, dCi),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &alpha, dAr, dAi, lda, dBr, dBi, &beta, dCr, nullptr),
+        rocblas_status_invalid_pointer);
+
+    // quick returns do not read the matrices
+    EXPECT_ROCBLAS_STATUS(call(handle,
+                               op,
+                               0,
+                               K,
+                               nullptr,
+                               nullptr,
+                               nullptr,
+                               lda,
+                               nullptr,
+                               nullptr,
+                               nullptr,
+                               nullptr,
+                               nullptr),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(call(handle,
+                               op,
+                               M,
+                               K,
+                               &zero,
+                               nullptr,
+                               nullptr,
+                               lda,
+                               nullptr,
+                               nullptr,
+                               &one,
+                               nullptr,
+                               nullptr),
+                          rocblas_status_success);
+
+    // A and B are not read when alpha == 0 or k == 0
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &zero, nullptr, nullptr, lda, nullptr, nullptr, &beta, dCr, dCi),
+        rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, 0, &alpha, nullptr, nullptr, lda, nullptr, nullptr, &beta, dCr, dCi),
+        rocblas_status_success);
+}
+
+template <typename T>
+void testing_gemm_planar(const Arguments& arg)
+{
+    using U                     = real_t<T>;
+    auto rocblas_gemm_planar_fn = rocblas_gemm_planar<T>;
+
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+    rocblas_int       M      = arg.M;
+    rocblas_int       N      = arg.N;
+    rocblas_int       K      = arg.K;
+    rocblas_int       lda    = arg.lda;
+    rocblas_int       ldb    = arg.ldb;
+    rocblas_int       ldc    = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    rocblas_local_handle handle{arg};
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : K;
+    rocblas_int A_col = transA == rocblas_operation_none ? K : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? K : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : K;
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < std::max(A_row, 1)
+                        || ldb < std::max(B_row, 1) || ldc < std::max(M, 1);
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_planar_fn(handle,
+                                                     transA,
+                                                     transB,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     nullptr,
+                                                     nullptr,
+                                                     nullptr,
+                                                     lda,
+                                                     nullptr,
+                                                     nullptr,
+                                                     ldb,
+                                                     nullptr,
+                                                     nullptr,
+                                                     nullptr,
+                                                     ldc),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    size_t size_A = size_t(lda) * std::max(A_col, 1);
+    size_t size_B = size_t(ldb) * std::max(B_col, 1);
+    size_t size_C = size_t(ldc) * N;
+
+    host_vector<T> hA(size_A), hB(size_B), hC(size_C), hC_gold(size_C), hC_gpu(size_C);
+    host_vector<U> hAr(size_A), hAi(size_A), hBr(size_B), hBi(size_B), hCr(size_C), hCi(size_C);
+
+    device_vector<U> dAr(size_A), dAi(size_A), dBr(size_B), dBi(size_B), dCr(size_C), dCi(size_C);
+    device_vector<T> d_alpha(1), d_beta(1);
+    CHECK_DEVICE_ALLOCATION(dAr.memcheck());
+    CHECK_DEVICE_ALLOCATION(dAi.memcheck());
+    CHECK_DEVICE_ALLOCATION(dBr.memcheck());
+    CHECK_DEVICE_ALLOCATION(dBi.memcheck());
+    CHECK_DEVICE_ALLOCATION(dCr.memcheck());
+    CHECK_DEVICE_ALLOCATION(dCi.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Integer parts keep the four real products and the complex scaling exact, so the planar
+    // result matches the interleaved reference exactly
+    rocblas_seedrand();
+    rocblas_init<T>(hA, A_row, A_col, lda);
+    rocblas_init<T>(hB, B_row, B_col, ldb);
+
+    // C is not read when beta == 0
+    if(h_beta == T(0))
+        rocblas_init_nan<T>(hC, M, N, ldc);
+    else
+        rocblas_init<T>(hC, M, N, ldc);
+    hC_gold = hC;
+
+    planar_split_join<false>(hA, hAr, hAi);
+    planar_split_join<false>(hB, hBr, hBi);
+    planar_split_join<false>(hC, hCr, hCi);
+
+    CHECK_HIP_ERROR(dAr.transfer_from(hAr));
+    CHECK_HIP_ERROR(dAi.transfer_from(hAi));
+    CHECK_HIP_ERROR(dBr.transfer_from(hBr));
+    CHECK_HIP_ERROR(dBi.transfer_from(hBi));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // CPU reference on the interleaved matrices
+    ref_gemm<T>(transA, transB, M, N, K, h_alpha, hA, lda, hB, ldb, h_beta, hC_gold, ldc);
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        if(pointer_mode == rocblas_pointer_mode_host && !arg.pointer_mode_host)
+            continue;
+        if(pointer_mode == rocblas_pointer_mode_device && !arg.pointer_mode_device)
+            continue;
+
+        bool host = pointer_mode == rocblas_pointer_mode_host;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+        CHECK_HIP_ERROR(dCr.transfer_from(hCr));
+        CHECK_HIP_ERROR(dCi.transfer_from(hCi));
+
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_planar_fn(handle,
+                                                   transA,
+                                                   transB,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   host ? &h_alpha : d_alpha,
+                                                   dAr,
+                                                   dAi,
+                                                   lda,
+                                                   dBr,
+                                                   dBi,
+                                                   ldb,
+                                                   host ? &h_beta : d_beta,
+                                                   dCr,
+                                                   dCi,
+                                                   ldc));
+
+        if(arg.unit_check)
+        {
+            host_vector<U> hCr_gpu(size_C), hCi_gpu(size_C);
+            CHECK_HIP_ERROR(hCr_gpu.transfer_from(dCr));
+            CHECK_HIP_ERROR(hCi_gpu.transfer_from(dCi));
+            planar_split_join<true>(hC_gpu, hCr_gpu, hCi_gpu);
+            unit_check_general<T>(M, N, ldc, hC_gold, hC_gpu);
+        }
+    }
+}
+
+template <typename T>
+void testing_gemv_planar_bad_arg(const Arguments& arg)
+{
+    using U                     = real_t<T>;
+    auto rocblas_gemv_planar_fn = rocblas_gemv_planar<T>;
+
+    const rocblas_operation op = rocblas_operation_none;
+    const rocblas_int       M = 100, N = 100, lda = 100, incx = 1, incy = 1;
+
+    const T alpha = T(1, 2), beta = T(2, 1), zero = T(0), one = T(1);
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    device_vector<U> dAr(size_t(lda) * N), dAi(size_t(lda) * N), dxr(N), dxi(N), dyr(M), dyi(M);
+    CHECK_DEVICE_ALLOCATION(dAr.memcheck());
+    CHECK_DEVICE_ALLOCATION(dAi.memcheck());
+    CHECK_DEVICE_ALLOCATION(dxr.memcheck());
+    CHECK_DEVICE_ALLOCATION(dxi.memcheck());
+    CHECK_DEVICE_ALLOCATION(dyr.memcheck());
+    CHECK_DEVICE_ALLOCATION(dyi.memcheck());
+
+    // the calls below share M, N and the leading dimension of A
+    auto call = [&](rocblas_handle    h,
+                    rocblas_operation transA,
+                    const T*          a,
+                    const U*          Ar,
+                    const U*          Ai,
+                    const U*          xr,
+                    const U*          xi,
+                    rocblas_int       incx_,
+                    const T*          b,
+                    U*                yr,
+                    U*                yi,
+                    rocblas_int       incy_) {
+        return rocblas_gemv_planar_fn(
+            h, transA, M, N, a, Ar, Ai, lda, xr, xi, incx_, b, yr, yi, incy_);
+    };
+
+    EXPECT_ROCBLAS_STATUS(
+        call(nullptr, op, &alpha, dAr, dAi, dxr, dxi, incx, &beta, dyr, dyi, incy),
+        rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(call(handle,
+                               (rocblas_operation)rocblas_fill_full,
+                               &alpha,
+                               dAr,
+                               dAi,
+                               dxr,
+                               dxi,
+                               incx,
+                               &beta,
+                               dyr,
+                               dyi,
+                               incy),
+                          rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_planar_fn(handle,
+                                                 op,
+                                                 -1,
+                                                 N,
+                                                 &alpha,
+                                                 dAr,
+                                                 dAi,
+                                                 lda,
+                                                 dxr,
+                                                 dxi,
+                                                 incx,
+                                                 &beta,
+                                                 dyr,
+                                                 dyi,
+                                                 incy),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_planar_fn(handle,
+                                                 op,
+                                                 M,
+                                                 N,
+                                                 &alpha,
+                                                 dAr,
+                                                 dAi,
+                                                 M - 1,
+                                                 dxr,
+                                                 dxi,
+                                                 incx,
+                                                 &beta,
+                                                 dyr,
+                                                 dyi,
+                                                 incy),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, op, &alpha, dAr, dAi, dxr, dxi, 0, &beta, dyr, dyi, incy),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, op, &alpha, dAr, dAi, dxr, dxi, incx, &beta, dyr, dyi, 0),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, nullptr, dAr, dAi, dxr, dxi, incx, &beta, dyr, dyi, incy),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, &alpha, dAr, dAi, dxr, dxi, incx, nullptr, dyr, dyi, incy),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, &alpha, nullptr, dAi, dxr, dxi, incx, &beta, dyr, dyi, incy),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, &alpha, dAr, nullptr, dxr, dxi, incx, &beta, dyr, dyi, incy),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, &alpha, dAr, dAi, nullptr, dxi, incx, &beta, dyr, dyi, incy),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, &alpha, dAr, dAi, dxr, nullptr, incx, &beta, dyr, dyi, incy),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, &alpha, dAr, dAi, dxr, dxi, incx, &beta, nullptr, dyi, incy),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, &alpha, dAr, dAi, dxr, dxi, incx, &beta, dyr, nullptr, incy),
+        rocblas_status_invalid_pointer);
+
+    // quick returns do not read the vectors
+    EXPECT_ROCBLAS_STATUS(rocblas_gemv_planar_fn(handle,
+                                                 op,
+                                                 0,
+                                                 N,
+                                                 nullptr,
+                                                 nullptr,
+                                                 nullptr,
+                                                 lda,
+                                                 nullptr,
+                                                 nullptr,
+                                                 incx,
+                                                 nullptr,
+                                                 nullptr,
+                                                 nullptr,
+                                                 incy),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(call(handle,
+                               op,
+                               &zero,
+                               nullptr,
+                               nullptr,
+                               nullptr,
+                               nullptr,
+                               incx,
+                               &one,
+                               nullptr,
+                               nullptr,
+                               incy),
+                          rocblas_status_success);
+
+    // A and x are not read when alpha == 0
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, &zero, nullptr, nullptr, nullptr, nullptr, incx, &beta, dyr, dyi, incy),
+        rocblas_status_success);
+}
+
+template <typename T>
+void testing_gemv_planar(const Arguments& arg)
+{
+    using U                     = real_t<T>;
+    auto rocblas_gemv_planar_fn = rocblas_gemv_planar<T>;
+
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_int       M      = arg.M;
+    rocblas_int       N      = arg.N;
+    rocblas_int       lda    = arg.lda;
+    rocblas_int       incx   = arg.incx;
+    rocblas_int       incy   = arg.incy;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    rocblas_local_handle handle{arg};
+
+    size_t dim_x = transA == rocblas_operation_none ? N : M;
+    size_t dim_y = transA == rocblas_operation_none ? M : N;
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || lda < std::max(M, 1) || !incx || !incy;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_planar_fn(handle,
+                                                     transA,
+                                                     M,
+                                                     N,
+                                                     nullptr,
+                                                     nullptr,
+                                                     nullptr,
+                                                     lda,
+                                                     nullptr,
+                                                     nullptr,
+                                                     incx,
+                                                     nullptr,
+                                                     nullptr,
+                                                     nullptr,
+                                                     incy),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    size_t size_A = size_t(lda) * N;
+
+    host_vector<T> hA(size_A), hx(dim_x, incx), hy(dim_y, incy), hy_gold(dim_y, incy),
+        hy_gpu(dim_y, incy);
+    host_vector<U> hAr(size_A), hAi(size_A), hxr(dim_x, incx), hxi(dim_x, incx),
+        hyr(dim_y, incy), hyi(dim_y, incy);
+
+    device_vector<U> dAr(size_A), dAi(size_A), dxr(dim_x, incx), dxi(dim_x, incx),
+        dyr(dim_y, incy), dyi(dim_y, incy);
+    device_vector<T> d_alpha(1), d_beta(1);
+    CHECK_DEVICE_ALLOCATION(dAr.memcheck());
+    CHECK_DEVICE_ALLOCATION(dAi.memcheck());
+    CHECK_DEVICE_ALLOCATION(dxr.memcheck());
+    CHECK_DEVICE_ALLOCATION(dxi.memcheck());
+    CHECK_DEVICE_ALLOCATION(dyr.memcheck());
+    CHECK_DEVICE_ALLOCATION(dyi.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Integer parts keep the four real products and the complex scaling exact, and the whole
+    // strided vectors are initialized and split, so that negative increments need no offsets
+    rocblas_seedrand();
+    rocblas_init<T>(hA, M, N, lda);
+    rocblas_init<T>(hx, 1, hx.size(), 1);
+
+    // y is not read when beta == 0
+    if(h_beta == T(0))
+        rocblas_init_nan<T>(hy, 1, hy.size(), 1);
+    else
+        rocblas_init<T>(hy, 1, hy.size(), 1);
+    hy_gold = hy;
+
+    planar_split_join<false>(hA, hAr, hAi);
+    planar_split_join<false>(hx, hxr, hxi);
+    planar_split_join<false>(hy, hyr, hyi);
+
+    CHECK_HIP_ERROR(dAr.transfer_from(hAr));
+    CHECK_HIP_ERROR(dAi.transfer_from(hAi));
+    CHECK_HIP_ERROR(dxr.transfer_from(hxr));
+    CHECK_HIP_ERROR(dxi.transfer_from(hxi));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // CPU reference on the interleaved vectors
+    ref_gemv<T>(transA, M, N, h_alpha, hA, lda, hx, incx, h_beta, hy_gold, incy);
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        if(pointer_mode == rocblas_pointer_mode_host && !arg.pointer_mode_host)
+            continue;
+        if(pointer_mode == rocblas_pointer_mode_device && !arg.pointer_mode_device)
+            continue;
+
+        bool host = pointer_mode == rocblas_pointer_mode_host;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+        CHECK_HIP_ERROR(dyr.transfer_from(hyr));
+        CHECK_HIP_ERROR(dyi.transfer_from(hyi));
+
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_planar_fn(handle,
+                                                   transA,
+                                                   M,
+                                                   N,
+                                                   host ? &h_alpha : d_alpha,
+                                                   dAr,
+                                                   dAi,
+                                                   lda,
+                                                   dxr,
+                                                   dxi,
+                                                   incx,
+                                                   host ? &h_beta : d_beta,
+                                                   dyr,
+                                                   dyi,
+                                                   incy));
+
+        if(arg.unit_check)
+        {
+            host_vector<U> hyr_gpu(dim_y, incy), hyi_gpu(dim_y, incy);
+            CHECK_HIP_ERROR(hyr_gpu.transfer_from(dyr));
+            CHECK_HIP_ERROR(hyi_gpu.transfer_from(dyi));
+            planar_split_join<true>(hy_gpu, hyr_gpu, hyi_gpu);
+            unit_check_general<T>(1, dim_y, incy, hy_gold, hy_gpu);
+        }
+    }
+}
@@ -0,0 +1,481 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// Keeps the 2 elements of largest magnitude of each group of 4 of a row, the lower index on
+// ties, with their 2 bit positions packed in a nibble per group and two groups per byte
+template <typename T>
+void ref_sparse24_compress(rocblas_int m,
+                           rocblas_int k,
+                           const T*    A,
+                           rocblas_int lda,
+                           T*          Ac,
+                           rocblas_int ldac,
+                           uint8_t*    meta,
+                           rocblas_int ldmeta)
+{
+    rocblas_int groups = k / 4;
+    for(rocblas_int i = 0; i < m; i++)
+        for(rocblas_int g = 0; g < groups; g++)
+        {
+            float mag[4];
+            for(int l = 0; l < 4; l++)
+                mag[l] = std::abs(float(A[i + (4 * size_t(g) + l) * lda]));
+
+            int first = 0;
+            for(int l = 1; l < 4; l++)
+                if(mag[l] > mag[first])
+                    first = l;
+            int second = first ? 0 : 1;
+            for(int l = 0; l < 4; l++)
+                if(l != first && mag[l] > mag[second])
+                    second = l;
+
+            int lo = std::min(first, second), hi = std::max(first, second);
+
+            Ac[i + 2 * size_t(g) * ldac]       = A[i + (4 * size_t(g) + lo) * lda];
+            Ac[i + (2 * size_t(g) + 1) * ldac] = A[i + (4 * size_t(g) + hi) * lda];
+
+            uint8_t& byte = meta[i + size_t(g / 2) * ldmeta];
+            if(g % 2 == 0)
+                byte = 0;
+            byte |= uint8_t((lo | hi << 2) << (4 * (g % 2)));
+        }
+}
+
+// C = alpha * A * op(B) + beta * C, with A given by its kept values and their positions
+template <typename T>
+void ref_gemm_sparse24(rocblas_operation trans_b,
+                       rocblas_int       m,
+                       rocblas_int       n,
+                       rocblas_int       k,
+                       float             alpha,
+                       const T*          Ac,
+                       rocblas_int       ldac,
+                       const uint8_t*    meta,
+                       rocblas_int       ldmeta,
+                       const T*          B,
+                       rocblas_int       ldb,
+                       float             beta,
+                       T*                C,
+                       rocblas_int       ldc)
+{
+    auto op_b = [&](size_t l, size_t j) {
+        return float(trans_b == rocblas_operation_none ? B[l + j * ldb] : B[j + l * ldb]);
+    };
+
+    for(rocblas_int j = 0; j < n; j++)
+        for(rocblas_int i = 0; i < m; i++)
+        {
+            double sum = 0;
+            for(rocblas_int q = 0; q < k / 2; q++)
+            {
+                // kept value q is in group q / 2 at the position of its 2 bits in the nibble
+                size_t  g   = q / 2;
+                uint8_t pos = (meta[i + g / 2 * ldmeta] >> (4 * (g % 2) + 2 * (q % 2))) & 3;
+                sum += double(float(Ac[i + size_t(q) * ldac])) * op_b(4 * g + pos, j);
+            }
+
+            T& c = C[i + size_t(j) * ldc];
+            c    = T(float(beta == 0 ? alpha * sum : alpha * sum + beta * double(float(c))));
+        }
+}
+
+template <typename T>
+void testing_gemm_sparse24_bad_arg(const Arguments& arg)
+{
+    auto rocblas_gemm_sparse24_fn = rocblas_gemm_sparse24<T>;
+
+    const rocblas_operation op = rocblas_operation_none;
+    const rocblas_int       M = 100, N = 100, K = 100, ldac = 100, ldmeta = 100, ldb = 100,
+                      ldc         = 100;
+
+    const float alpha = 1.0f, beta = 2.0f, zero = 0.0f, one = 1.0f;
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    device_vector<T>       dAc(size_t(ldac) * K / 2), dB(size_t(ldb) * N), dC(size_t(ldc) * N);
+    device_vector<uint8_t> dmeta(size_t(ldmeta) * (K + 7) / 8);
+    CHECK_DEVICE_ALLOCATION(dAc.memcheck());
+    CHECK_DEVICE_ALLOCATION(dmeta.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+    // the calls below share N and the leading dimension of meta
+    auto call = [&](rocblas_handle    h,
+                    rocblas_operation trans,
+                    rocblas_int       m,
+                    rocblas_int       k,
+                    const float*      a,
+                    const T*          Ac,
+                    rocblas_int       ldac_,
+                    const uint8_t*    meta,
+                    const T*          B,
+                    rocblas_int       ldb_,
+                    const float*      b,
+                    T*                C,
+                    rocblas_int       ldc_) {
+        return rocblas_gemm_sparse24_fn(
+            h, trans, m, N, k, a, Ac, ldac_, meta, ldmeta, B, ldb_, b, C, ldc_);
+    };
+
+    EXPECT_ROCBLAS_STATUS(
+        call(nullptr, op, M, K, &alpha, dAc, ldac, dmeta, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(call(handle,
+                               (rocblas_operation)rocblas_fill_full,
+                               M,
+                               K,
+                               &alpha,
+                               dAc,
+                               ldac,
+                               dmeta,
+                               dB,
+                               ldb,
+                               &beta,
+                               dC,
+                               ldc),
+                          rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, -1, K, &alpha, dAc, ldac, dmeta, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, -4, &alpha, dAc, ldac, dmeta, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K - 2, &alpha, dAc, ldac, dmeta, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &alpha, dAc, M - 1, dmeta, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &alpha, dAc, ldac, dmeta, dB, K - 1, &beta, dC, ldc),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &alpha, dAc, ldac, dmeta, dB, ldb, &beta, dC, M - 1),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_sparse24_fn(handle,
+                                                   op,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   &alpha,
+                                                   dAc,
+                                                   ldac,
+                                                   dmeta,
+                                                   M - 1,
+                                                   dB,
+                                                   ldb,
+                                                   &beta,
+                                                   dC,
+                                                   ldc),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, nullptr, dAc, ldac, dmeta, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &alpha, dAc, ldac, dmeta, dB, ldb, nullptr, dC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &alpha, nullptr, ldac, dmeta, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &alpha, dAc, ldac, nullptr, dB, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &alpha, dAc, ldac, dmeta, nullptr, ldb, &beta, dC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &alpha, dAc, ldac, dmeta, dB, ldb, &beta, nullptr, ldc),
+        rocblas_status_invalid_pointer);
+
+    // quick returns do not read the matrices
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, 0, K, nullptr, nullptr, ldac, nullptr, nullptr, ldb, nullptr, nullptr, 1),
+        rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &zero, nullptr, ldac, nullptr, nullptr, ldb, &one, nullptr, ldc),
+        rocblas_status_success);
+
+    // A and B are not read when alpha == 0 or k == 0
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, K, &zero, nullptr, ldac, nullptr, nullptr, ldb, &beta, dC, ldc),
+        rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, op, M, 0, &alpha, nullptr, ldac, nullptr, nullptr, ldb, &beta, dC, ldc),
+        rocblas_status_success);
+}
+
+template <typename T>
+void testing_gemm_sparse24(const Arguments& arg)
+{
+    auto rocblas_gemm_sparse24_fn = rocblas_gemm_sparse24<T>;
+
+    rocblas_operation trans_b = char2rocblas_operation(arg.transB);
+    rocblas_int       M       = arg.M;
+    rocblas_int       N       = arg.N;
+    rocblas_int       K       = arg.K;
+    rocblas_int       ldac    = arg.lda;
+    rocblas_int       ldb     = arg.ldb;
+    rocblas_int       ldc     = arg.ldc;
+    rocblas_int       ldmeta  = arg.ldd;
+
+    float h_alpha = arg.get_alpha<float>();
+    float h_beta  = arg.get_beta<float>();
+
+    rocblas_local_handle handle{arg};
+
+    rocblas_int b_rows = trans_b == rocblas_operation_none ? K : N;
+    rocblas_int b_cols = trans_b == rocblas_operation_none ? N : K;
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || K < 0 || K % 4 || ldac < std::max(M, 1)
+                        || ldmeta < std::max(M, 1) || ldb < std::max(b_rows, 1)
+                        || ldc < std::max(M, 1);
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_sparse24_fn(handle,
+                                                       trans_b,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       nullptr,
+                                                       nullptr,
+                                                       ldac,
+                                                       nullptr,
+                                                       ldmeta,
+                                                       nullptr,
+                                                       ldb,
+                                                       nullptr,
+                                                       nullptr,
+                                                       ldc),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // the dense A is only used to build a compressed A
+    rocblas_int lda       = M;
+    rocblas_int meta_cols = (K + 7) / 8;
+    size_t      size_A    = size_t(lda) * K;
+    size_t      size_Ac   = size_t(ldac) * std::max(K / 2, 1);
+    size_t      size_meta = size_t(ldmeta) * std::max(meta_cols, 1);
+    size_t      size_B    = size_t(ldb) * b_cols;
+    size_t      size_C    = size_t(ldc) * N;
+
+    host_vector<T>       hA(size_A), hAc(size_Ac), hB(size_B), hC(size_C), hC_gold(size_C);
+    host_vector<uint8_t> hmeta(size_meta);
+
+    device_vector<T>       dAc(size_Ac), dB(size_B), dC(size_C);
+    device_vector<uint8_t> dmeta(size_meta);
+    device_vector<float>   d_alpha(1), d_beta(1);
+    CHECK_DEVICE_ALLOCATION(dAc.memcheck());
+    CHECK_DEVICE_ALLOCATION(dmeta.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Small integers keep every product and sum exact in float, so the result only rounds once
+    // to T, as in the reference
+    rocblas_seedrand();
+    rocblas_init<T>(hA, M, K, lda);
+    rocblas_init<T>(hB, b_rows, b_cols, ldb);
+    ref_sparse24_compress<T>(M, K, hA, lda, hAc, ldac, hmeta, ldmeta);
+
+    // C is not read when beta == 0
+    if(h_beta == 0)
+        rocblas_init_nan<T>(hC, M, N, ldc);
+    else
+        rocblas_init<T>(hC, M, N, ldc);
+    hC_gold = hC;
+
+    CHECK_HIP_ERROR(dAc.transfer_from(hAc));
+    CHECK_HIP_ERROR(dmeta.transfer_from(hmeta));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(float), hipMemcpyHostToDevice));
+
+    // CPU reference
+    ref_gemm_sparse24<T>(
+        trans_b, M, N, K, h_alpha, hAc, ldac, hmeta, ldmeta, hB, ldb, h_beta, hC_gold, ldc);
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        if(pointer_mode == rocblas_pointer_mode_host && !arg.pointer_mode_host)
+            continue;
+        if(pointer_mode == rocblas_pointer_mode_device && !arg.pointer_mode_device)
+            continue;
+
+        bool host = pointer_mode == rocblas_pointer_mode_host;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_sparse24_fn(handle,
+                                                     trans_b,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     host ? &h_alpha : d_alpha,
+                                                     dAc,
+                                                     ldac,
+                                                     dmeta,
+                                                     ldmeta,
+                                                     dB,
+                                                     ldb,
+                                                     host ? &h_beta : d_beta,
+                                                     dC,
+                                                     ldc));
+
+        if(arg.unit_check)
+        {
+            host_vector<T> hC_gpu(size_C);
+            CHECK_HIP_ERROR(hC_gpu.transfer_from(dC));
+            unit_check_general<T>(M, N, ldc, hC_gold, hC_gpu);
+        }
+    }
+}
+
+template <typename T>
+void testing_sparse24_compress_bad_arg(const Arguments& arg)
+{
+    auto rocblas_sparse24_compress_fn = rocblas_sparse24_compress<T>;
+
+    const rocblas_int M = 100, K = 100, lda = 100, ldac = 100, ldmeta = 100;
+
+    rocblas_local_handle handle{arg};
+
+    device_vector<T>       dA(size_t(lda) * K), dAc(size_t(ldac) * K / 2);
+    device_vector<uint8_t> dmeta(size_t(ldmeta) * (K + 7) / 8);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dAc.memcheck());
+    CHECK_DEVICE_ALLOCATION(dmeta.memcheck());
+
+    auto call = [&](rocblas_handle h,
+                    rocblas_int    m,
+                    rocblas_int    k,
+                    const T*       A,
+                    rocblas_int    lda_,
+                    T*             Ac,
+                    rocblas_int    ldac_,
+                    uint8_t*       meta,
+                    rocblas_int    ldmeta_) {
+        return rocblas_sparse24_compress_fn(h, m, k, A, lda_, Ac, ldac_, meta, ldmeta_);
+    };
+
+    EXPECT_ROCBLAS_STATUS(call(nullptr, M, K, dA, lda, dAc, ldac, dmeta, ldmeta),
+                          rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(call(handle, -1, K, dA, lda, dAc, ldac, dmeta, ldmeta),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, -4, dA, lda, dAc, ldac, dmeta, ldmeta),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, K - 2, dA, lda, dAc, ldac, dmeta, ldmeta),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, K, dA, M - 1, dAc, ldac, dmeta, ldmeta),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, K, dA, lda, dAc, M - 1, dmeta, ldmeta),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, K, dA, lda, dAc, ldac, dmeta, M - 1),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(call(handle, M, K, nullptr, lda, dAc, ldac, dmeta, ldmeta),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, K, dA, lda, nullptr, ldac, dmeta, ldmeta),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, K, dA, lda, dAc, ldac, nullptr, ldmeta),
+                          rocblas_status_invalid_pointer);
+
+    // quick returns do not read or write the matrices
+    EXPECT_ROCBLAS_STATUS(call(handle, 0, K, nullptr, lda, nullptr, ldac, nullptr, ldmeta),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(call(handle, M, 0, nullptr, lda, nullptr, ldac, nullptr, ldmeta),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_sparse24_compress(const Arguments& arg)
+{
+    auto rocblas_sparse24_compress_fn = rocblas_sparse24_compress<T>;
+
+    rocblas_int M      = arg.M;
+    rocblas_int K      = arg.K;
+    rocblas_int lda    = arg.lda;
+    rocblas_int ldac   = arg.ldb;
+    rocblas_int ldmeta = arg.ldd;
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || K < 0 || K % 4 || lda < std::max(M, 1) || ldac < std::max(M, 1)
+                        || ldmeta < std::max(M, 1);
+    if(invalid_size || !M || !K)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_sparse24_compress_fn(
+                handle, M, K, nullptr, lda, nullptr, ldac, nullptr, ldmeta),
+            invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    rocblas_int meta_cols = (K + 7) / 8;
+    size_t      size_A    = size_t(lda) * K;
+    size_t      size_Ac   = size_t(ldac) * (K / 2);
+    size_t      size_meta = size_t(ldmeta) * meta_cols;
+
+    host_vector<T>       hA(size_A), hAc_gold(size_Ac), hAc(size_Ac);
+    host_vector<uint8_t> hmeta_gold(size_meta), hmeta(size_meta);
+
+    device_vector<T>       dA(size_A), dAc(size_Ac);
+    device_vector<uint8_t> dmeta(size_meta);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dAc.memcheck());
+    CHECK_DEVICE_ALLOCATION(dmeta.memcheck());
+
+    // small integers tie often, which checks that the lower index is kept on ties
+    rocblas_seedrand();
+    rocblas_init<T>(hA, M, K, lda);
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    ref_sparse24_compress<T>(M, K, hA, lda, hAc_gold, ldac, hmeta_gold, ldmeta);
+
+    CHECK_ROCBLAS_ERROR(
+        rocblas_sparse24_compress_fn(handle, M, K, dA, lda, dAc, ldac, dmeta, ldmeta));
+    CHECK_HIP_ERROR(hAc.transfer_from(dAc));
+    CHECK_HIP_ERROR(hmeta.transfer_from(dmeta));
+
+    if(arg.unit_check)
+    {
+        unit_check_general<T>(M, K / 2, ldac, hAc_gold, hAc);
+
+        host_vector<rocblas_int> hmeta_gold_32(hmeta_gold), hmeta_32(hmeta);
+        unit_check_general<rocblas_int>(M, meta_cols, ldmeta, hmeta_gold_32, hmeta_32);
+    }
+}
@@ -917,6 +917,16 @@ void testing_gemm_strided_batched_ex3_bad_arg(const Arguments& arg)
         // nullptr, a_type, lda, nullptr, b_type, ldb, zero, nullptr, c_type, ldc,
         // dD, d_type, ldd, composite_compute_type, algo, solution_index, flags), rocblas_status_success);
     }
+
+    rocblas_local_handle handle{arg};
+    hipStream_t          aux_stream = nullptr;
+    EXPECT_ROCBLAS_STATUS(rocblas_set_auxiliary_streams(nullptr, 1, &aux_stream),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_set_auxiliary_streams(handle, -1, &aux_stream),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocblas_set_auxiliary_streams(handle, 1, nullptr),
+                          rocblas_status_invalid_pointer);
+    CHECK_ROCBLAS_ERROR(rocblas_set_auxiliary_streams(handle, 0, nullptr));
 }
 
 template <typename TiA, typename TiB, typename To, typename Tc>
@@ -1221,6 +1231,57 @@ void testing_gemm_strided_batched_ex3(const Arguments& arg)
 
         CHECK_HIP_ERROR(hD_2.transfer_from(dDref));
 
+        // The batches of the per-batch paths spread across auxiliary streams give the same results
+        if(batch_count > 1)
+        {
+            hipStream_t aux_streams[2];
+            for(auto& aux_stream : aux_streams)
+                CHECK_HIP_ERROR(hipStreamCreate(&aux_stream));
+            CHECK_ROCBLAS_ERROR(rocblas_set_auxiliary_streams(handle, 2, aux_streams));
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+            CHECK_HIP_ERROR(dC.transfer_from(hC));
+            CHECK_ROCBLAS_ERROR(rocblas_gemm_strided_batched_ex3_fn(handle,
+                                                                    transA,
+                                                                    transB,
+                                                                    M,
+                                                                    N,
+                                                                    K,
+                                                                    &h_alpha_Tc,
+                                                                    dA,
+                                                                    arg.a_type,
+                                                                    lda,
+                                                                    stride_a,
+                                                                    dB,
+                                                                    arg.b_type,
+                                                                    ldb,
+                                                                    stride_b,
+                                                                    &h_beta_Tc,
+                                                                    dC,
+                                                                    arg.c_type,
+                                                                    ldc,
+                                                                    stride_c,
+                                                                    dDref,
+                                                                    d_type,
+                                                                    ldd,
+                                                                    stride_d,
+                                                                    batch_count,
+                                                                    arg.composite_compute_type,
+                                                                    algo,
+                                                                    solution_index,
+                                                                    flags));
+
+            host_strided_batch_matrix<To> hD_aux(M, N, ldd, stride_d, batch_count);
+            CHECK_HIP_ERROR(hD_aux.memcheck());
+            CHECK_HIP_ERROR(hD_aux.transfer_from(dDref));
+            CHECK_ROCBLAS_ERROR(rocblas_set_auxiliary_streams(handle, 0, nullptr));
+            for(auto& aux_stream : aux_streams)
+                CHECK_HIP_ERROR(hipStreamDestroy(aux_stream));
+
+            if(arg.unit_check)
+                unit_check_general<To, To>(M, N, ldd, stride_d, hD_1, hD_aux, batch_count);
+        }
+
         // copy C matrix into D matrix
         copy_matrix_with_different_leading_dimensions(hC, hD_gold);
 
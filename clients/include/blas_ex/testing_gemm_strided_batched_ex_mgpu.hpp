@@ -0,0 +1,374 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "blas3/testing_gemm_mgpu.hpp"
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+template <typename T>
+void testing_gemm_strided_batched_ex_mgpu_bad_arg(const Arguments& arg)
+{
+    auto rocblas_gemm_strided_batched_ex_mgpu_fn = rocblas_gemm_strided_batched_ex_mgpu;
+
+    const rocblas_int    M = 100, N = 101, K = 102, lda = 103, ldb = 103, ldc = 103, ldd = 103;
+    const rocblas_int    batch_count = 2;
+    const rocblas_stride stride      = 103 * 103;
+
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_operation transB = rocblas_operation_none;
+    const rocblas_datatype  type   = rocblas_type2datatype<T>();
+    const rocblas_gemm_algo algo   = rocblas_gemm_algo_standard;
+
+    const T alpha(1), beta(2);
+
+    rocblas_local_mgpu_handles handles{arg, 1};
+    rocblas_handle             handle = handles[0];
+    const rocblas_handle*      hs     = handles.data();
+
+    device_strided_batch_matrix<T> dA(M, K, lda, stride, batch_count);
+    device_strided_batch_matrix<T> dB(K, N, ldb, stride, batch_count);
+    device_strided_batch_matrix<T> dC(M, N, ldc, stride, batch_count);
+    device_strided_batch_matrix<T> dD(M, N, ldd, stride, batch_count);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+
+    // the arguments after num_handles, with the operations, scalars, matrices and stride of D
+    // which the checks below replace
+    auto call = [&](const rocblas_handle* handles_,
+                    rocblas_int           num_handles,
+                    rocblas_operation     transA_,
+                    const void*           alpha_,
+                    const void*           A,
+                    const void*           beta_,
+                    const void*           C,
+                    void*                 D,
+                    rocblas_stride        stride_d) {
+        return rocblas_gemm_strided_batched_ex_mgpu_fn(handles_,
+                                                       num_handles,
+                                                       transA_,
+                                                       transB,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       alpha_,
+                                                       A,
+                                                       type,
+                                                       lda,
+                                                       stride,
+                                                       dB,
+                                                       type,
+                                                       ldb,
+                                                       stride,
+                                                       beta_,
+                                                       C,
+                                                       type,
+                                                       ldc,
+                                                       stride,
+                                                       D,
+                                                       type,
+                                                       ldd,
+                                                       stride_d,
+                                                       batch_count,
+                                                       type,
+                                                       algo,
+                                                       0,
+                                                       rocblas_gemm_flags_none);
+    };
+
+    const rocblas_handle with_null[]   = {handle, nullptr};
+    const rocblas_handle same_device[] = {handle, handle};
+
+    EXPECT_ROCBLAS_STATUS(call(nullptr, 1, transA, &alpha, dA, &beta, dC, dD, stride),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(call(hs, 0, transA, &alpha, dA, &beta, dC, dD, stride),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(call(with_null, 2, transA, &alpha, dA, &beta, dC, dD, stride),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(call(same_device, 2, transA, &alpha, dA, &beta, dC, dD, stride),
+                          rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(
+        call(hs, 1, (rocblas_operation)rocblas_fill_full, &alpha, dA, &beta, dC, dD, stride),
+        rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(call(hs, 1, transA, nullptr, dA, &beta, dC, dD, stride),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(call(hs, 1, transA, &alpha, dA, nullptr, dC, dD, stride),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(call(hs, 1, transA, &alpha, nullptr, &beta, dC, dD, stride),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(call(hs, 1, transA, &alpha, dA, &beta, nullptr, dD, stride),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(call(hs, 1, transA, &alpha, dA, &beta, dC, nullptr, stride),
+                          rocblas_status_invalid_pointer);
+
+    // in place, C and D must have the same stride
+    EXPECT_ROCBLAS_STATUS(call(hs, 1, transA, &alpha, dA, &beta, dC, dC, stride + 1),
+                          rocblas_status_invalid_size);
+
+    // The workspace of each device is taken when the batch is shared, so a device memory size
+    // query of the first handle reports none
+    size_t size = 1;
+    CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+    EXPECT_ROCBLAS_STATUS(call(hs, 1, transA, &alpha, dA, &beta, dC, dD, stride),
+                          rocblas_status_size_unchanged);
+    CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+    EXPECT_EQ(size, 0u);
+}
+
+template <typename T>
+void testing_gemm_strided_batched_ex_mgpu(const Arguments& arg)
+{
+    auto rocblas_gemm_strided_batched_ex_mgpu_fn = rocblas_gemm_strided_batched_ex_mgpu;
+
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    rocblas_int M = arg.M, N = arg.N, K = arg.K;
+    rocblas_int lda = arg.lda, ldb = arg.ldb, ldc = arg.ldc;
+
+    // in place, D is C
+    rocblas_int    ldd         = arg.outofplace ? arg.ldd : ldc;
+    rocblas_stride stride_a    = arg.stride_a;
+    rocblas_stride stride_b    = arg.stride_b;
+    rocblas_stride stride_c    = arg.stride_c;
+    rocblas_stride stride_d    = arg.outofplace ? arg.stride_d : stride_c;
+    rocblas_int    batch_count = arg.batch_count;
+
+    const rocblas_datatype  type = rocblas_type2datatype<T>();
+    const rocblas_gemm_algo algo = rocblas_gemm_algo_standard;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    double cpu_time_used;
+    double rocblas_error = 0.0;
+
+    // arg.devices limits the number of devices used, a single one or all visible ones
+    int max_devices = arg.devices ? arg.devices : std::numeric_limits<int>::max();
+
+    rocblas_mgpu_test_split_small_problems();
+    rocblas_local_mgpu_handles handles{arg, max_devices};
+    rocblas_handle             handle = handles[0];
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : std::max(K, 1);
+    rocblas_int A_col = transA == rocblas_operation_none ? std::max(K, 1) : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? std::max(K, 1) : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : std::max(K, 1);
+
+    auto call = [&](const void* alpha,
+                    const void* A,
+                    const void* B,
+                    const void* beta,
+                    void*       C,
+                    void*       D) {
+        return rocblas_gemm_strided_batched_ex_mgpu_fn(handles.data(),
+                                                       handles.size(),
+                                                       transA,
+                                                       transB,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       alpha,
+                                                       A,
+                                                       type,
+                                                       lda,
+                                                       stride_a,
+                                                       B,
+                                                       type,
+                                                       ldb,
+                                                       stride_b,
+                                                       beta,
+                                                       C,
+                                                       type,
+                                                       ldc,
+                                                       stride_c,
+                                                       D,
+                                                       type,
+                                                       ldd,
+                                                       stride_d,
+                                                       batch_count,
+                                                       type,
+                                                       algo,
+                                                       0,
+                                                       rocblas_gemm_flags_none);
+    };
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M
+                        || ldd < M || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        EXPECT_ROCBLAS_STATUS(call(nullptr, nullptr, nullptr, nullptr, nullptr, nullptr),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory of the first handle. hK is in CPU (host) memory
+    host_strided_batch_matrix<T> hA(A_row, A_col, lda, stride_a, batch_count);
+    host_strided_batch_matrix<T> hB(B_row, B_col, ldb, stride_b, batch_count);
+    host_strided_batch_matrix<T> hC(M, N, ldc, stride_c, batch_count);
+    host_strided_batch_matrix<T> hD(M, N, ldd, stride_d, batch_count);
+    host_strided_batch_matrix<T> hD_gold(M, N, ldd, stride_d, batch_count);
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_HIP_ERROR(hC.memcheck());
+    CHECK_HIP_ERROR(hD.memcheck());
+    CHECK_HIP_ERROR(hD_gold.memcheck());
+
+    device_strided_batch_matrix<T> dA(A_row, A_col, lda, stride_a, batch_count);
+    device_strided_batch_matrix<T> dB(B_row, B_col, ldb, stride_b, batch_count);
+    device_strided_batch_matrix<T> dC(M, N, ldc, stride_c, batch_count);
+    device_strided_batch_matrix<T> dD
+        = arg.outofplace ? device_strided_batch_matrix<T>(M, N, ldd, stride_d, batch_count)
+                         : device_strided_batch_matrix<T>(0, 1, 1, 1, 1);
+    device_strided_batch_matrix<T>& dDref = arg.outofplace ? dD : dC;
+    device_vector<T>                d_alpha(1), d_beta(1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(
+        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // reference calculation for golden result
+        copy_matrix_with_different_leading_dimensions(hC, hD_gold);
+        cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < batch_count; b++)
+            ref_gemm<T>(
+                transA, transB, M, N, K, h_alpha, hA[b], lda, hB[b], ldb, h_beta, hD_gold[b], ldd);
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        // The batch count need not divide evenly between the devices; in device pointer mode
+        // alpha and beta are read from the device of the first handle
+        auto run = [&](rocblas_pointer_mode mode) {
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, mode));
+            bool device_mode = mode == rocblas_pointer_mode_device;
+
+            CHECK_HIP_ERROR(dC.transfer_from(hC));
+            CHECK_ROCBLAS_ERROR(call(device_mode ? (const T*)d_alpha : &h_alpha,
+                                     dA,
+                                     dB,
+                                     device_mode ? (const T*)d_beta : &h_beta,
+                                     dC,
+                                     dDref));
+
+            // the stream of the first handle waits for the other devices
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+            CHECK_HIP_ERROR(hD.transfer_from(dDref));
+
+            rocblas_pointer_mode handle_mode;
+            CHECK_ROCBLAS_ERROR(rocblas_get_pointer_mode(handle, &handle_mode));
+            EXPECT_EQ(handle_mode, mode);
+
+            if(arg.unit_check)
+            {
+                if(std::is_same_v<T, rocblas_float_complex> || std::is_same_v<T, float>)
+                {
+                    const double tol = K * sum_error_tolerance<T>;
+                    near_check_general<T>(M, N, ldd, stride_d, hD_gold, hD, batch_count, tol);
+                }
+                else
+                {
+                    unit_check_general<T>(M, N, ldd, stride_d, hD_gold, hD, batch_count);
+                }
+            }
+
+            if(arg.norm_check)
+            {
+                rocblas_error = std::max(
+                    rocblas_error,
+                    norm_check_general<T>('F', M, N, ldd, stride_d, hD_gold, hD, batch_count));
+            }
+        };
+
+        if(arg.pointer_mode_host)
+            run(rocblas_pointer_mode_host);
+        if(arg.pointer_mode_device)
+            run(rocblas_pointer_mode_device);
+    }
+
+    if(arg.timing)
+    {
+        double gpu_time_used;
+        int    number_cold_calls = arg.cold_iters;
+        int    total_calls       = number_cold_calls + arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < total_calls; iter++)
+        {
+            if(iter == number_cold_calls)
+                gpu_time_used = get_time_us_sync(stream);
+
+            call(&h_alpha, dA, dB, &h_beta, dC, dDref);
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+
+        ArgumentModel<e_transA,
+                      e_transB,
+                      e_M,
+                      e_N,
+                      e_K,
+                      e_alpha,
+                      e_lda,
+                      e_stride_a,
+                      e_ldb,
+                      e_stride_b,
+                      e_beta,
+                      e_ldc,
+                      e_stride_c,
+                      e_ldd,
+                      e_stride_d,
+                      e_batch_count>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         gemm_gflop_count<T>(M, N, K) * batch_count,
+                         ArgumentLogging::NA_value,
+                         cpu_time_used,
+                         rocblas_error);
+    }
+}
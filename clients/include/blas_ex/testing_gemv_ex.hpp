@@ -0,0 +1,316 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+template <typename Ta, typename Tx = Ta, typename Ty = Tx, typename Tc = Ty>
+void testing_gemv_ex_bad_arg(const Arguments& arg)
+{
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_int       M = 100, N = 100, lda = 100, incx = 1, incy = 1;
+    const Tc                alpha = 1, beta = 1, zero = 0;
+
+    const rocblas_datatype a_type = rocblas_type2datatype<Ta>();
+    const rocblas_datatype x_type = rocblas_type2datatype<Tx>();
+    const rocblas_datatype y_type = rocblas_type2datatype<Ty>();
+    const rocblas_datatype c_type = rocblas_type2datatype<Tc>();
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    device_matrix<Ta> dA(M, N, lda);
+    device_vector<Tx> dx(N, incx);
+    device_vector<Ty> dy(M, incy);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+    // the calls below share the datatypes of A, x and y
+    auto call = [&](rocblas_handle    h,
+                    rocblas_operation trans,
+                    rocblas_int       m,
+                    rocblas_int       n,
+                    const Tc*         alpha_,
+                    const void*       A,
+                    rocblas_int       lda_,
+                    const void*       x,
+                    rocblas_int       incx_,
+                    const Tc*         beta_,
+                    void*             y,
+                    rocblas_int       incy_,
+                    rocblas_datatype  compute_type) {
+        return rocblas_gemv_ex(h,
+                               trans,
+                               m,
+                               n,
+                               alpha_,
+                               A,
+                               a_type,
+                               lda_,
+                               x,
+                               x_type,
+                               incx_,
+                               beta_,
+                               y,
+                               y_type,
+                               incy_,
+                               compute_type);
+    };
+
+    EXPECT_ROCBLAS_STATUS(
+        call(nullptr, transA, M, N, &alpha, dA, lda, dx, incx, &beta, dy, incy, c_type),
+        rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(call(handle,
+                               (rocblas_operation)rocblas_fill_full,
+                               M,
+                               N,
+                               &alpha,
+                               dA,
+                               lda,
+                               dx,
+                               incx,
+                               &beta,
+                               dy,
+                               incy,
+                               c_type),
+                          rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, transA, -1, N, &alpha, dA, lda, dx, incx, &beta, dy, incy, c_type),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, transA, M, -1, &alpha, dA, lda, dx, incx, &beta, dy, incy, c_type),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, transA, M, N, &alpha, dA, M - 1, dx, incx, &beta, dy, incy, c_type),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, transA, M, N, &alpha, dA, lda, dx, 0, &beta, dy, incy, c_type),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, transA, M, N, &alpha, dA, lda, dx, incx, &beta, dy, 0, c_type),
+        rocblas_status_invalid_size);
+
+    // the mixed precisions compute in float only
+    if(!std::is_same_v<Ta, Tc>)
+        EXPECT_ROCBLAS_STATUS(call(handle,
+                                   transA,
+                                   M,
+                                   N,
+                                   &alpha,
+                                   dA,
+                                   lda,
+                                   dx,
+                                   incx,
+                                   &beta,
+                                   dy,
+                                   incy,
+                                   rocblas_datatype_f64_r),
+                              rocblas_status_not_implemented);
+
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, transA, M, N, nullptr, dA, lda, dx, incx, &beta, dy, incy, c_type),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, transA, M, N, &alpha, dA, lda, dx, incx, nullptr, dy, incy, c_type),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, transA, M, N, &alpha, nullptr, lda, dx, incx, &beta, dy, incy, c_type),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, transA, M, N, &alpha, dA, lda, nullptr, incx, &beta, dy, incy, c_type),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, transA, M, N, &alpha, dA, lda, dx, incx, &beta, nullptr, incy, c_type),
+        rocblas_status_invalid_pointer);
+
+    // quick returns do not read the matrix or the vectors
+    EXPECT_ROCBLAS_STATUS(call(handle,
+                               transA,
+                               0,
+                               N,
+                               nullptr,
+                               nullptr,
+                               lda,
+                               nullptr,
+                               incx,
+                               nullptr,
+                               nullptr,
+                               incy,
+                               c_type),
+                          rocblas_status_success);
+
+    // alpha == 0 and beta == 1 in host pointer mode
+    EXPECT_ROCBLAS_STATUS(call(handle,
+                               transA,
+                               M,
+                               N,
+                               &zero,
+                               nullptr,
+                               lda,
+                               nullptr,
+                               incx,
+                               &alpha,
+                               nullptr,
+                               incy,
+                               c_type),
+                          rocblas_status_success);
+
+    // A and x are not read when alpha == 0
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, transA, M, N, &zero, nullptr, lda, nullptr, incx, &beta, dy, incy, c_type),
+        rocblas_status_success);
+}
+
+template <typename Ta, typename Tx = Ta, typename Ty = Tx, typename Tc = Ty>
+void testing_gemv_ex(const Arguments& arg)
+{
+    rocblas_int       M      = arg.M;
+    rocblas_int       N      = arg.N;
+    rocblas_int       lda    = arg.lda;
+    rocblas_int       incx   = arg.incx;
+    rocblas_int       incy   = arg.incy;
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+
+    Tc h_alpha = arg.get_alpha<Tc>();
+    Tc h_beta  = arg.get_beta<Tc>();
+
+    const rocblas_datatype a_type = rocblas_type2datatype<Ta>();
+    const rocblas_datatype x_type = rocblas_type2datatype<Tx>();
+    const rocblas_datatype y_type = rocblas_type2datatype<Ty>();
+    const rocblas_datatype c_type = rocblas_type2datatype<Tc>();
+
+    rocblas_local_handle handle{arg};
+
+    size_t dim_x = transA == rocblas_operation_none ? N : M;
+    size_t dim_y = transA == rocblas_operation_none ? M : N;
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || lda < M || lda < 1 || !incx || !incy;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemv_ex(handle,
+                                              transA,
+                                              M,
+                                              N,
+                                              nullptr,
+                                              nullptr,
+                                              a_type,
+                                              lda,
+                                              nullptr,
+                                              x_type,
+                                              incx,
+                                              nullptr,
+                                              nullptr,
+                                              y_type,
+                                              incy,
+                                              c_type),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    host_matrix<Ta> hA(M, N, lda);
+    host_vector<Tx> hx(dim_x, incx);
+    host_vector<Ty> hy(dim_y, incy), hy_gold(dim_y, incy);
+
+    device_matrix<Ta> dA(M, N, lda);
+    device_vector<Tx> dx(dim_x, incx);
+    device_vector<Ty> dy(dim_y, incy);
+    device_vector<Tc> d_alpha(1), d_beta(1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, false, true);
+    rocblas_init_vector(hy, arg, rocblas_client_beta_sets_nan);
+    hy_gold = hy;
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Tc), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(Tc), hipMemcpyHostToDevice));
+
+    // CPU reference, with the 8-bit A widened to float
+    if constexpr(std::is_same_v<Ta, Tx>)
+        ref_gemv<Ta, Ty>(transA, M, N, h_alpha, hA, lda, hx, incx, h_beta, hy_gold, incy);
+    else
+    {
+        host_matrix<Tx> hA_x(M, N, lda);
+        const Ta*       a   = hA;
+        Tx*             a_x = hA_x;
+        for(size_t j = 0; j < size_t(N); j++)
+            for(size_t i = 0; i < size_t(M); i++)
+                a_x[i + j * lda] = Tx(a[i + j * lda]);
+        ref_gemv<Tx, Ty>(transA, M, N, h_alpha, hA_x, lda, hx, incx, h_beta, hy_gold, incy);
+    }
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        if(pointer_mode == rocblas_pointer_mode_host && !arg.pointer_mode_host)
+            continue;
+        if(pointer_mode == rocblas_pointer_mode_device && !arg.pointer_mode_device)
+            continue;
+
+        bool host = pointer_mode == rocblas_pointer_mode_host;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_ROCBLAS_ERROR(rocblas_gemv_ex(handle,
+                                            transA,
+                                            M,
+                                            N,
+                                            host ? &h_alpha : d_alpha,
+                                            dA,
+                                            a_type,
+                                            lda,
+                                            dx,
+                                            x_type,
+                                            incx,
+                                            host ? &h_beta : d_beta,
+                                            dy,
+                                            y_type,
+                                            incy,
+                                            c_type));
+
+        host_vector<Ty> hy_gpu(dim_y, incy);
+        CHECK_HIP_ERROR(hy_gpu.transfer_from(dy));
+
+        if(arg.unit_check)
+        {
+            if(reduction_requires_near<Ty>(arg, dim_x))
+            {
+                const double tol = dim_x * sum_error_tolerance<Ty>;
+                near_check_general<Ty>(1, dim_y, incy, hy_gold, hy_gpu, tol);
+            }
+            else
+                unit_check_general<Ty>(1, dim_y, incy, hy_gold, hy_gpu);
+        }
+    }
+}
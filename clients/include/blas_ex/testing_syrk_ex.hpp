@@ -0,0 +1,261 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+template <typename T>
+void testing_syrk_ex_bad_arg(const Arguments& arg)
+{
+    const rocblas_fill      uplo   = rocblas_fill_upper;
+    const rocblas_operation transA = rocblas_operation_none;
+
+    const rocblas_int      N = 100, K = 100, lda = 100, ldc = 100;
+    const float            alpha = 1.0f, beta = 2.0f, zero = 0.0f, one = 1.0f;
+    const rocblas_datatype type = rocblas_type2datatype<T>();
+    const rocblas_datatype f32  = rocblas_datatype_f32_r;
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    device_vector<T> dA(size_t(lda) * K), dC(size_t(ldc) * N);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+    // the calls below share K
+    auto call = [&](rocblas_handle    h,
+                    rocblas_fill      uplo_,
+                    rocblas_operation trans,
+                    rocblas_int       n,
+                    const float*      alpha_,
+                    const void*       A,
+                    rocblas_datatype  a_type,
+                    rocblas_int       lda_,
+                    const float*      beta_,
+                    void*             C,
+                    rocblas_datatype  c_type,
+                    rocblas_int       ldc_,
+                    rocblas_datatype  compute_type) {
+        return rocblas_syrk_ex(
+            h, uplo_, trans, n, K, alpha_, A, a_type, lda_, beta_, C, c_type, ldc_, compute_type);
+    };
+
+    EXPECT_ROCBLAS_STATUS(
+        call(nullptr, uplo, transA, N, &alpha, dA, type, lda, &beta, dC, type, ldc, f32),
+        rocblas_status_invalid_handle);
+
+    // only half or bfloat16 matrices with float computation
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, uplo, transA, N, &alpha, dA, f32, lda, &beta, dC, f32, ldc, f32),
+        rocblas_status_not_implemented);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, uplo, transA, N, &alpha, dA, type, lda, &beta, dC, f32, ldc, f32),
+        rocblas_status_not_implemented);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, uplo, transA, N, &alpha, dA, type, lda, &beta, dC, type, ldc, type),
+        rocblas_status_not_implemented);
+
+    EXPECT_ROCBLAS_STATUS(call(handle,
+                               rocblas_fill_full,
+                               transA,
+                               N,
+                               &alpha,
+                               dA,
+                               type,
+                               lda,
+                               &beta,
+                               dC,
+                               type,
+                               ldc,
+                               f32),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(call(handle,
+                               uplo,
+                               (rocblas_operation)rocblas_fill_full,
+                               N,
+                               &alpha,
+                               dA,
+                               type,
+                               lda,
+                               &beta,
+                               dC,
+                               type,
+                               ldc,
+                               f32),
+                          rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, uplo, transA, -1, &alpha, dA, type, lda, &beta, dC, type, ldc, f32),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, uplo, transA, N, &alpha, dA, type, N - 1, &beta, dC, type, ldc, f32),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, uplo, transA, N, &alpha, dA, type, lda, &beta, dC, type, N - 1, f32),
+        rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, uplo, transA, N, nullptr, dA, type, lda, &beta, dC, type, ldc, f32),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, uplo, transA, N, &alpha, dA, type, lda, nullptr, dC, type, ldc, f32),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, uplo, transA, N, &alpha, nullptr, type, lda, &beta, dC, type, ldc, f32),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, uplo, transA, N, &alpha, dA, type, lda, &beta, nullptr, type, ldc, f32),
+        rocblas_status_invalid_pointer);
+
+    // quick return with an empty C, and with alpha == 0 and beta == 1
+    EXPECT_ROCBLAS_STATUS(call(handle,
+                               uplo,
+                               transA,
+                               0,
+                               nullptr,
+                               nullptr,
+                               type,
+                               lda,
+                               nullptr,
+                               nullptr,
+                               type,
+                               ldc,
+                               f32),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, uplo, transA, N, &zero, nullptr, type, lda, &one, nullptr, type, ldc, f32),
+        rocblas_status_success);
+
+    // A is not read when alpha == 0
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, uplo, transA, N, &zero, nullptr, type, lda, &beta, dC, type, ldc, f32),
+        rocblas_status_success);
+}
+
+template <typename T>
+void testing_syrk_ex(const Arguments& arg)
+{
+    rocblas_fill      uplo   = char2rocblas_fill(arg.uplo);
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_int       N      = arg.N;
+    rocblas_int       K      = arg.K;
+    rocblas_int       lda    = arg.lda;
+    rocblas_int       ldc    = arg.ldc;
+
+    float h_alpha = arg.get_alpha<float>();
+    float h_beta  = arg.get_beta<float>();
+
+    rocblas_datatype type = rocblas_type2datatype<T>();
+
+    rocblas_local_handle handle{arg};
+
+    rocblas_int A_row = transA == rocblas_operation_none ? N : K;
+    rocblas_int A_col = transA == rocblas_operation_none ? K : N;
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = N < 0 || K < 0 || ldc < std::max(N, 1) || lda < std::max(A_row, 1);
+    if(invalid_size || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_syrk_ex(handle,
+                                              uplo,
+                                              transA,
+                                              N,
+                                              K,
+                                              nullptr,
+                                              nullptr,
+                                              type,
+                                              lda,
+                                              nullptr,
+                                              nullptr,
+                                              type,
+                                              ldc,
+                                              rocblas_datatype_f32_r),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    size_t size_A = size_t(lda) * A_col;
+    size_t size_C = size_t(ldc) * N;
+
+    host_vector<T>       hA(size_A), hC(size_C), hC_gpu(size_C);
+    device_vector<T>     dA(size_A), dC(size_C);
+    device_vector<float> d_alpha(1), d_beta(1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    rocblas_seedrand();
+    rocblas_init<T>(hA, A_row, A_col, lda);
+    rocblas_init<T>(hC, N, N, ldc);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(float), hipMemcpyHostToDevice));
+
+    // CPU reference in float, which holds the sums of the small integers of A and C exactly
+    host_vector<float> hA_32(hA), hC_gold(hC);
+    ref_syrk<float>(uplo, transA, N, K, h_alpha, hA_32, lda, h_beta, hC_gold, ldc);
+
+    // each element of C is rounded to T once, leaving the other triangle unchanged
+    double max_c = 0;
+    for(rocblas_int j = 0; j < N; j++)
+        for(rocblas_int i = 0; i < N; i++)
+            max_c = std::max(max_c, double(std::abs(hC_gold[i + size_t(j) * ldc])));
+    double tolerance = max_c * get_epsilon<T>();
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        if(pointer_mode == rocblas_pointer_mode_host && !arg.pointer_mode_host)
+            continue;
+        if(pointer_mode == rocblas_pointer_mode_device && !arg.pointer_mode_device)
+            continue;
+
+        bool host = pointer_mode == rocblas_pointer_mode_host;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        CHECK_ROCBLAS_ERROR(rocblas_syrk_ex(handle,
+                                            uplo,
+                                            transA,
+                                            N,
+                                            K,
+                                            host ? &h_alpha : d_alpha,
+                                            dA,
+                                            type,
+                                            lda,
+                                            host ? &h_beta : d_beta,
+                                            dC,
+                                            type,
+                                            ldc,
+                                            rocblas_datatype_f32_r));
+        CHECK_HIP_ERROR(hC_gpu.transfer_from(dC));
+
+        if(arg.unit_check)
+        {
+            host_vector<float> hC_gpu_32(hC_gpu);
+            near_check_general<float>(N, N, ldc, hC_gold, hC_gpu_32, tolerance);
+        }
+    }
+}
@@ -0,0 +1,243 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_common.hpp"
+
+#define ERROR_EPS_MULTIPLIER 40
+
+/* ============================================================================================ */
+
+template <typename T>
+void testing_trsm_ex2_bad_arg(const Arguments& arg)
+{
+    const rocblas_side      side   = rocblas_side_left;
+    const rocblas_fill      uplo   = rocblas_fill_upper;
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_diagonal  diag   = rocblas_diagonal_non_unit;
+
+    const rocblas_int      M = 100, N = 100, lda = 100, ldb = 100;
+    const float            alpha = 1.0f;
+    const rocblas_datatype type  = rocblas_type2datatype<T>();
+    const rocblas_datatype f32   = rocblas_datatype_f32_r;
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    device_vector<T> dA(size_t(lda) * M), dB(size_t(ldb) * N);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+
+    // the calls below share transA, diag and N
+    auto call = [&](rocblas_handle   h,
+                    rocblas_side     side_,
+                    rocblas_fill     uplo_,
+                    rocblas_int      m,
+                    const float*     alpha_,
+                    const void*      A,
+                    rocblas_datatype a_type,
+                    rocblas_int      lda_,
+                    void*            B,
+                    rocblas_datatype b_type,
+                    rocblas_int      ldb_,
+                    rocblas_datatype compute_type) {
+        return rocblas_trsm_ex2(h,
+                                side_,
+                                uplo_,
+                                transA,
+                                diag,
+                                m,
+                                N,
+                                alpha_,
+                                A,
+                                a_type,
+                                lda_,
+                                B,
+                                b_type,
+                                ldb_,
+                                compute_type);
+    };
+
+    EXPECT_ROCBLAS_STATUS(call(nullptr, side, uplo, M, &alpha, dA, type, lda, dB, type, ldb, f32),
+                          rocblas_status_invalid_handle);
+
+    // only half or bfloat16 matrices with float computation
+    EXPECT_ROCBLAS_STATUS(call(handle, side, uplo, M, &alpha, dA, f32, lda, dB, f32, ldb, f32),
+                          rocblas_status_not_implemented);
+    EXPECT_ROCBLAS_STATUS(call(handle, side, uplo, M, &alpha, dA, type, lda, dB, f32, ldb, f32),
+                          rocblas_status_not_implemented);
+    EXPECT_ROCBLAS_STATUS(call(handle, side, uplo, M, &alpha, dA, type, lda, dB, type, ldb, type),
+                          rocblas_status_not_implemented);
+
+    EXPECT_ROCBLAS_STATUS(call(handle,
+                               (rocblas_side)rocblas_fill_full,
+                               uplo,
+                               M,
+                               &alpha,
+                               dA,
+                               type,
+                               lda,
+                               dB,
+                               type,
+                               ldb,
+                               f32),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, side, rocblas_fill_full, M, &alpha, dA, type, lda, dB, type, ldb, f32),
+        rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(call(handle, side, uplo, -1, &alpha, dA, type, lda, dB, type, ldb, f32),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, side, uplo, M, &alpha, dA, type, M - 1, dB, type, ldb, f32),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, side, uplo, M, &alpha, dA, type, lda, dB, type, M - 1, f32),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(call(handle, side, uplo, M, nullptr, dA, type, lda, dB, type, ldb, f32),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, side, uplo, M, &alpha, nullptr, type, lda, dB, type, ldb, f32),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, side, uplo, M, &alpha, dA, type, lda, nullptr, type, ldb, f32),
+        rocblas_status_invalid_pointer);
+
+    // quick return with an empty B
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, side, uplo, 0, nullptr, nullptr, type, lda, nullptr, type, ldb, f32),
+        rocblas_status_success);
+}
+
+template <typename T>
+void testing_trsm_ex2(const Arguments& arg)
+{
+    rocblas_int M       = arg.M;
+    rocblas_int N       = arg.N;
+    rocblas_int lda     = arg.lda;
+    rocblas_int ldb     = arg.ldb;
+    float       alpha_h = arg.get_alpha<float>();
+
+    rocblas_side      side   = char2rocblas_side(arg.side);
+    rocblas_fill      uplo   = char2rocblas_fill(arg.uplo);
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_diagonal  diag   = char2rocblas_diagonal(arg.diag);
+
+    rocblas_datatype type = rocblas_type2datatype<T>();
+    rocblas_int      K    = side == rocblas_side_left ? M : N;
+
+    rocblas_local_handle handle{arg};
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || N < 0 || lda < K || ldb < M;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_trsm_ex2(handle,
+                                               side,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               M,
+                                               N,
+                                               nullptr,
+                                               nullptr,
+                                               type,
+                                               lda,
+                                               nullptr,
+                                               type,
+                                               ldb,
+                                               rocblas_datatype_f32_r),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    size_t size_A = size_t(lda) * K;
+    size_t size_B = size_t(ldb) * N;
+
+    host_vector<T>       hA(size_A), hB(size_B), hX_gpu(size_B);
+    device_vector<T>     dA(size_A), dXorB(size_B);
+    device_vector<float> d_alpha(1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dXorB.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+
+    rocblas_init_matrix(rocblas_client_diagonally_dominant_triangular_matrix,
+                        arg.uplo,
+                        random_generator<T>,
+                        hA,
+                        K,
+                        K,
+                        lda);
+    if(diag == rocblas_diagonal_unit)
+        make_unit_diagonal(uplo, (T*)hA, lda, K);
+    rocblas_init<T>(hB, M, N, ldb);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha_h, sizeof(float), hipMemcpyHostToDevice));
+
+    // CPU reference in float, from the values of A and B in their own precision
+    host_vector<float> hA_32(hA), hX_gold(hB);
+    ref_trsm<float>(side, uplo, transA, diag, M, N, alpha_h, hA_32, lda, hX_gold, ldb);
+
+    // the blocks of B are rounded to T after each update, so the error is that of a solve in T
+    double eps = get_epsilon<T>();
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        if(pointer_mode == rocblas_pointer_mode_host && !arg.pointer_mode_host)
+            continue;
+        if(pointer_mode == rocblas_pointer_mode_device && !arg.pointer_mode_device)
+            continue;
+
+        bool host = pointer_mode == rocblas_pointer_mode_host;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+        CHECK_HIP_ERROR(dXorB.transfer_from(hB));
+        CHECK_ROCBLAS_ERROR(rocblas_trsm_ex2(handle,
+                                             side,
+                                             uplo,
+                                             transA,
+                                             diag,
+                                             M,
+                                             N,
+                                             host ? &alpha_h : d_alpha,
+                                             dA,
+                                             type,
+                                             lda,
+                                             dXorB,
+                                             type,
+                                             ldb,
+                                             rocblas_datatype_f32_r));
+        CHECK_HIP_ERROR(hX_gpu.transfer_from(dXorB));
+
+        if(arg.unit_check)
+        {
+            host_vector<float> hX_gpu_32(hX_gpu);
+            if(alpha_h == 0)
+                unit_check_general<float>(M, N, ldb, hX_gold, hX_gpu_32);
+            else
+                trsm_err_res_check<double>(matrix_norm_1<float>(M, N, ldb, hX_gold, hX_gpu_32),
+                                           M,
+                                           ERROR_EPS_MULTIPLIER,
+                                           eps);
+        }
+    }
+}
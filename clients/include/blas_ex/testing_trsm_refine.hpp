@@ -0,0 +1,281 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "testing_common.hpp"
+
+#define ERROR_EPS_MULTIPLIER 40
+
+/* ============================================================================================ */
+
+template <typename T>
+void testing_trsm_refine_bad_arg(const Arguments& arg)
+{
+    auto rocblas_trsm_refine_fn = rocblas_trsm_refine<T>;
+
+    const rocblas_side      side   = rocblas_side_left;
+    const rocblas_fill      uplo   = rocblas_fill_upper;
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_diagonal  diag   = rocblas_diagonal_non_unit;
+
+    const rocblas_int M = 100, N = 100, lda = 100, ldb = 100, max_iter = 3;
+    const T           alpha = 1.0;
+    const real_t<T>   tol   = 1e-12;
+    rocblas_int       iterations;
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    device_vector<T> dA(size_t(lda) * M), dB(size_t(ldb) * N);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+
+    // the calls below share transA, diag, N and tol
+    auto call = [&](rocblas_handle h,
+                    rocblas_side   side_,
+                    rocblas_fill   uplo_,
+                    rocblas_int    m,
+                    const T*       alpha_,
+                    const T*       A,
+                    rocblas_int    lda_,
+                    T*             B,
+                    rocblas_int    ldb_,
+                    rocblas_int    max_iter_,
+                    rocblas_int*   iterations_) {
+        return rocblas_trsm_refine_fn(h,
+                                      side_,
+                                      uplo_,
+                                      transA,
+                                      diag,
+                                      m,
+                                      N,
+                                      alpha_,
+                                      A,
+                                      lda_,
+                                      B,
+                                      ldb_,
+                                      tol,
+                                      max_iter_,
+                                      iterations_);
+    };
+
+    EXPECT_ROCBLAS_STATUS(
+        call(nullptr, side, uplo, M, &alpha, dA, lda, dB, ldb, max_iter, &iterations),
+        rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(call(handle,
+                               (rocblas_side)rocblas_fill_full,
+                               uplo,
+                               M,
+                               &alpha,
+                               dA,
+                               lda,
+                               dB,
+                               ldb,
+                               max_iter,
+                               &iterations),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, side, rocblas_fill_full, M, &alpha, dA, lda, dB, ldb, max_iter, &iterations),
+        rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, side, uplo, -1, &alpha, dA, lda, dB, ldb, max_iter, &iterations),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, side, uplo, M, &alpha, dA, M - 1, dB, ldb, max_iter, &iterations),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, side, uplo, M, &alpha, dA, lda, dB, M - 1, max_iter, &iterations),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(call(handle, side, uplo, M, &alpha, dA, lda, dB, ldb, -1, &iterations),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, side, uplo, M, nullptr, dA, lda, dB, ldb, max_iter, &iterations),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, side, uplo, M, &alpha, nullptr, lda, dB, ldb, max_iter, &iterations),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, side, uplo, M, &alpha, dA, lda, nullptr, ldb, max_iter, &iterations),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(call(handle, side, uplo, M, &alpha, dA, lda, dB, ldb, max_iter, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with an empty B
+    EXPECT_ROCBLAS_STATUS(
+        call(handle, side, uplo, 0, nullptr, nullptr, lda, nullptr, ldb, max_iter, nullptr),
+        rocblas_status_success);
+}
+
+template <typename T>
+void testing_trsm_refine(const Arguments& arg)
+{
+    auto rocblas_trsm_refine_fn = rocblas_trsm_refine<T>;
+
+    rocblas_int M        = arg.M;
+    rocblas_int N        = arg.N;
+    rocblas_int lda      = arg.lda;
+    rocblas_int ldb      = arg.ldb;
+    rocblas_int max_iter = arg.algo;
+    T           alpha_h  = arg.get_alpha<T>();
+
+    rocblas_side      side   = char2rocblas_side(arg.side);
+    rocblas_fill      uplo   = char2rocblas_fill(arg.uplo);
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_diagonal  diag   = char2rocblas_diagonal(arg.diag);
+
+    rocblas_int K = side == rocblas_side_left ? M : N;
+
+    rocblas_local_handle handle{arg};
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || N < 0 || lda < K || ldb < M;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_trsm_refine_fn(handle,
+                                                     side,
+                                                     uplo,
+                                                     transA,
+                                                     diag,
+                                                     M,
+                                                     N,
+                                                     nullptr,
+                                                     nullptr,
+                                                     lda,
+                                                     nullptr,
+                                                     ldb,
+                                                     0,
+                                                     max_iter,
+                                                     nullptr),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    size_t size_A = size_t(lda) * K;
+    size_t size_B = size_t(ldb) * N;
+
+    host_vector<T>   hA(size_A), hX(size_B), hB(size_B), hX_gpu(size_B), hR(size_B);
+    device_vector<T> dA(size_A), dXorB(size_B), d_alpha(1);
+    device_vector<rocblas_int> d_iterations(1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dXorB.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_iterations.memcheck());
+
+    // A well conditioned for single precision, and B = op(A) * X / alpha for a known X
+    rocblas_init_matrix(rocblas_client_diagonally_dominant_triangular_matrix,
+                        arg.uplo,
+                        random_generator<T>,
+                        hA,
+                        K,
+                        K,
+                        lda);
+    if(diag == rocblas_diagonal_unit)
+        make_unit_diagonal(uplo, (T*)hA, lda, K);
+    rocblas_init<T>(hX, M, N, ldb);
+    hB = hX;
+    ref_trmm<T>(side, uplo, transA, diag, M, N, T(1) / alpha_h, hA, lda, hB, ldb);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha_h, sizeof(T), hipMemcpyHostToDevice));
+
+    // the largest elements bounding the rounding of the residual computed on the host
+    double max_a = 0, max_b = 0;
+    for(rocblas_int j = 0; j < K; j++)
+        for(rocblas_int i = 0; i < K; i++)
+            max_a = std::max(max_a, double(std::abs(hA[i + size_t(j) * lda])));
+    for(rocblas_int j = 0; j < N; j++)
+        for(rocblas_int i = 0; i < M; i++)
+            max_b = std::max(max_b, double(std::abs(alpha_h * hB[i + size_t(j) * ldb])));
+
+    double eps    = std::numeric_limits<T>::epsilon();
+    double eps_32 = std::numeric_limits<float>::epsilon();
+
+    // tol == 0 is never met, so every correction is applied
+    for(real_t<T> tol : {real_t<T>(1e-6), real_t<T>(1e-13), real_t<T>(0)})
+    {
+        for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+        {
+            if(pointer_mode == rocblas_pointer_mode_host && !arg.pointer_mode_host)
+                continue;
+            if(pointer_mode == rocblas_pointer_mode_device && !arg.pointer_mode_device)
+                continue;
+
+            bool        host       = pointer_mode == rocblas_pointer_mode_host;
+            rocblas_int iterations = -1;
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+            CHECK_HIP_ERROR(dXorB.transfer_from(hB));
+            CHECK_ROCBLAS_ERROR(rocblas_trsm_refine_fn(handle,
+                                                       side,
+                                                       uplo,
+                                                       transA,
+                                                       diag,
+                                                       M,
+                                                       N,
+                                                       host ? &alpha_h : d_alpha,
+                                                       dA,
+                                                       lda,
+                                                       dXorB,
+                                                       ldb,
+                                                       tol,
+                                                       max_iter,
+                                                       host ? &iterations : d_iterations));
+            if(!host)
+                CHECK_HIP_ERROR(hipMemcpy(
+                    &iterations, d_iterations, sizeof(rocblas_int), hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hX_gpu.transfer_from(dXorB));
+
+            if(!arg.unit_check)
+                continue;
+
+            EXPECT_GE(iterations, 0);
+            EXPECT_LE(iterations, max_iter);
+
+            // Stopping before max_iter means the residual of X met the tolerance
+            if(iterations < max_iter)
+            {
+                double max_x = 0, max_r = 0;
+                hR           = hX_gpu;
+                ref_trmm<T>(side, uplo, transA, diag, M, N, T(1), hA, lda, hR, ldb);
+                for(rocblas_int j = 0; j < N; j++)
+                {
+                    for(rocblas_int i = 0; i < M; i++)
+                    {
+                        size_t idx = i + size_t(j) * ldb;
+                        max_x      = std::max(max_x, double(std::abs(hX_gpu[idx])));
+                        max_r      = std::max(max_r, double(std::abs(alpha_h * hB[idx] - hR[idx])));
+                    }
+                }
+                EXPECT_LE(max_r, tol * max_b + 4 * K * eps * max_a * max_x);
+            }
+
+            // each correction gains about the accuracy of a single precision solve, up to the
+            // tolerance or double precision
+            double accuracy = std::max({eps, double(tol), std::pow(K * eps_32, iterations + 1)});
+            double err      = matrix_norm_1<T>(M, N, ldb, hX, hX_gpu);
+            trsm_err_res_check<double>(err, M, ERROR_EPS_MULTIPLIER, accuracy);
+        }
+    }
+}
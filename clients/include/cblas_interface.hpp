@@ -34,6 +34,42 @@ void ref_scal(int64_t n, T alpha, U x, int64_t incx);
 
 #include "lapack_utilities.hpp"
 
+/*
+ * ===========================================================================
+ *    batched references
+ * ===========================================================================
+ */
+
+// Problems below this size are too small for the reference library to thread well
+constexpr double REF_BATCHED_PARALLEL_GFLOP = 0.1;
+
+//!
+//! @brief Runs the reference ref(b) of each batch b. Small problems run in parallel across the
+//! batches, and large ones in turn, each threaded by the reference library, so that the cores are
+//! neither oversubscribed nor idle. This assumes an OpenMP threaded reference library and nested
+//! parallelism disabled (OMP_MAX_ACTIVE_LEVELS of 1, the default), so that a reference called in
+//! the parallel region runs single threaded; a library with its own thread pool oversubscribes the
+//! cores there.
+//! @param batch_count The batch count.
+//! @param gflop       The estimated GFLOP of the problem of one batch, from flops.hpp.
+//! @param ref         The reference of one batch, called with its batch index.
+//!
+template <typename F>
+void ref_batched(int64_t batch_count, double gflop, F&& ref)
+{
+    if(batch_count > 1 && gflop < REF_BATCHED_PARALLEL_GFLOP)
+    {
+#pragma omp parallel for schedule(dynamic)
+        for(int64_t b = 0; b < batch_count; b++)
+            ref(b);
+    }
+    else
+    {
+        for(int64_t b = 0; b < batch_count; b++)
+            ref(b);
+    }
+}
+
 /*
  * ===========================================================================
  *    level 1 BLAS
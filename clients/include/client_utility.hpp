@@ -112,6 +112,7 @@ class rocblas_local_handle
 
     void rocblas_stream_begin_capture();
     void rocblas_stream_end_capture();
+    void rocblas_stream_end_capture(hipGraphExec_t* instance);
 
 public:
     rocblas_local_handle();
@@ -148,6 +149,50 @@ public:
         arg.graph_test ? rocblas_stream_end_capture() : NOOP;
 #endif
     }
+
+    // Capture the rocBLAS calls of f on a stream of its own, as graph_test does, into a graph
+    // instance which the caller launches and destroys
+    template <typename F>
+    void capture_graph(hipGraphExec_t& instance, F&& f)
+    {
+        rocblas_stream_begin_capture();
+        f();
+        rocblas_stream_end_capture(&instance);
+    }
+};
+
+/* ============================================================================================ */
+/*! \brief  local handles of the multi-GPU APIs, one on each of the visible devices up to
+    max_devices, starting with the current device, which is current again once they are created */
+class rocblas_local_mgpu_handles
+{
+    std::vector<std::unique_ptr<rocblas_local_handle>> m_local;
+    std::vector<rocblas_handle>                        m_handles;
+    std::vector<int>                                   m_devices;
+
+public:
+    rocblas_local_mgpu_handles(const Arguments& arg, int max_devices);
+
+    rocblas_local_mgpu_handles(const rocblas_local_mgpu_handles&) = delete;
+    rocblas_local_mgpu_handles& operator=(const rocblas_local_mgpu_handles&) = delete;
+
+    // the array of handles passed to the multi-GPU APIs
+    const rocblas_handle* data() const
+    {
+        return m_handles.data();
+    }
+    rocblas_int size() const
+    {
+        return rocblas_int(m_handles.size());
+    }
+    rocblas_handle operator[](size_t i) const
+    {
+        return m_handles[i];
+    }
+    int device(size_t i) const
+    {
+        return m_devices[i];
+    }
 };
 
 /* ============================================================================================ */
@@ -157,6 +202,17 @@ rocblas_int query_device_property();
 /*  set current device to device_id */
 void set_device(rocblas_int device_id);
 
+/*  estimated peak FP32 vector GFLOP/s and memory GB/s of device_id at its maximum SCLK in MHz,
+    all 0 if its properties cannot be queried */
+struct rocblas_device_peaks
+{
+    double gflops;
+    double gbps;
+    double sclk_mhz;
+};
+
+rocblas_device_peaks query_device_peaks(rocblas_int device_id);
+
 /* ============================================================================================ */
 /*  timing: HIP only provides very limited timers function clock() and not general;
             rocblas sync CPU and device and use more accurate CPU timer*/
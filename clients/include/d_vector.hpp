@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include "host_staging.hpp"
 #include "rocblas.h"
 #include "rocblas_test.hpp"
 #include "singletons.hpp"
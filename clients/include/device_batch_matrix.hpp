@@ -217,8 +217,8 @@ public:
         if(m_batch_count > 0)
         {
             if(hipSuccess
-               != (hip_err
-                   = hipMemcpy((*this)[0], that[0], sizeof(T) * m_nmemb * m_batch_count, kind)))
+               != (hip_err = rocblas_client_memcpy(
+                       (*this)[0], that[0], sizeof(T) * m_nmemb * m_batch_count, kind)))
             {
                 return hip_err;
             }
@@ -259,10 +259,11 @@ public:
             if(m_batch_count > 0)
             {
                 if(hipSuccess
-                   != (hip_err = hipMemcpy((*this)[flush_batch_index],
-                                           that[0],
-                                           sizeof(T) * that.nmemb() * that.batch_count(),
-                                           kind)))
+                   != (hip_err
+                       = rocblas_client_memcpy((*this)[flush_batch_index],
+                                               that[0],
+                                               sizeof(T) * that.nmemb() * that.batch_count(),
+                                               kind)))
                 {
                     return hip_err;
                 }
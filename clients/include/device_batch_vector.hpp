@@ -199,8 +199,8 @@ public:
         if(m_batch_count > 0)
         {
             if(hipSuccess
-               != (hip_err
-                   = hipMemcpy((*this)[0], that[0], sizeof(T) * m_nmemb * m_batch_count, kind)))
+               != (hip_err = rocblas_client_memcpy(
+                       (*this)[0], that[0], sizeof(T) * m_nmemb * m_batch_count, kind)))
             {
                 return hip_err;
             }
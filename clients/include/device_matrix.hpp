@@ -136,10 +136,10 @@ public:
     //!
     hipError_t transfer_from(const host_matrix<T>& that)
     {
-        return hipMemcpy(m_data,
-                         (const T*)that,
-                         this->nmemb() * sizeof(T),
-                         this->use_HMM ? hipMemcpyHostToHost : hipMemcpyHostToDevice);
+        return rocblas_client_memcpy(m_data,
+                                     (const T*)that,
+                                     this->nmemb() * sizeof(T),
+                                     this->use_HMM ? hipMemcpyHostToHost : hipMemcpyHostToDevice);
     }
 
     hipError_t memcheck() const
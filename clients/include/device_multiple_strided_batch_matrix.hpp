@@ -229,10 +229,10 @@ public:
     //!
     hipError_t transfer_from(const host_multiple_strided_batch_matrix<T>& that)
     {
-        return hipMemcpy(this->data(),
-                         that.data(),
-                         sizeof(T) * this->m_nmemb,
-                         this->use_HMM ? hipMemcpyHostToHost : hipMemcpyHostToDevice);
+        return rocblas_client_memcpy(this->data(),
+                                     that.data(),
+                                     sizeof(T) * this->m_nmemb,
+                                     this->use_HMM ? hipMemcpyHostToHost : hipMemcpyHostToDevice);
     }
 
     //!
@@ -251,10 +251,11 @@ public:
         for(int64_t multiple_index = 0; multiple_index < m_multiple_count; multiple_index++)
         {
 
-            status = hipMemcpy(this->data() + (multiple_index * m_multiple_stride),
-                               that.data(),
-                               sizeof(T) * that.nmemb(),
-                               this->use_HMM ? hipMemcpyHostToHost : hipMemcpyHostToDevice);
+            status = rocblas_client_memcpy(this->data() + (multiple_index * m_multiple_stride),
+                                           that.data(),
+                                           sizeof(T) * that.nmemb(),
+                                           this->use_HMM ? hipMemcpyHostToHost
+                                                         : hipMemcpyHostToDevice);
 
             if(status != hipSuccess)
             {
@@ -0,0 +1,495 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*!\file
+ * \brief reference results computed on the device, and their comparison with the results of
+ * rocBLAS on the device, for problems whose host reference and checks take too long.
+ *
+ * The reference kernel is deliberately simple, one element of the result per thread with the
+ * products accumulated in double with error-free transformations, so it shares no code or
+ * blocking with the kernels under test, and its results are as accurate as those of the host
+ * reference. ROCBLAS_CLIENT_DEVICE_REFERENCE is the number of multiply-adds of a problem from
+ * which the tests use it; if it is not set, the references are always computed on the host.
+ */
+
+#pragma once
+
+#include "device_vector.hpp"
+#include "host_vector.hpp"
+#include "rocblas.h"
+#include "rocblas_math.hpp"
+#include "rocblas_test.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+inline bool rocblas_client_device_reference(double multiply_adds)
+{
+    static const double threshold = [] {
+        const char* env = getenv("ROCBLAS_CLIENT_DEVICE_REFERENCE");
+        return env && *env ? atof(env) : -1.0;
+    }();
+    return threshold >= 0 && multiply_adds >= threshold;
+}
+
+// Sum of products accumulated with the error-free transformations of Dot2 (Ogita, Rump and
+// Oishi), as accurate as if computed in twice the precision of double
+struct device_ref_dot2
+{
+    double s = 0;
+    double c = 0;
+
+    __device__ void add(double a, double b)
+    {
+        double p = a * b;
+        double e = fma(a, b, -p);
+        double t = s + p;
+        double z = t - s;
+        c += ((s - (t - z)) + (p - z)) + e;
+        s = t;
+    }
+
+    __device__ double sum() const
+    {
+        return s + c;
+    }
+};
+
+template <typename T>
+__device__ __host__ inline void device_ref_split(const T& x, double& re, double& im)
+{
+    if constexpr(rocblas_is_complex<T>)
+    {
+        re = x.real();
+        im = x.imag();
+    }
+    else if constexpr(std::is_same_v<T, rocblas_bfloat16>)
+    {
+        re = float(x);
+        im = 0;
+    }
+    else
+    {
+        re = double(x);
+        im = 0;
+    }
+}
+
+template <typename T>
+__device__ inline T device_ref_make(double re, double im)
+{
+    if constexpr(rocblas_is_complex<T>)
+        return T(re, im);
+    else if constexpr(std::is_same_v<T, rocblas_bfloat16>)
+        return T(float(re));
+    else
+        return T(re);
+}
+
+// A matrix operand op(X) of the reference, the uplo triangle of X with the diagonal diag if X is
+// triangular, rocblas_fill_full if it is general
+template <typename T>
+struct device_ref_operand
+{
+    const T*          data;
+    int64_t           ld;
+    rocblas_stride    stride;
+    rocblas_operation trans = rocblas_operation_none;
+    rocblas_fill      uplo  = rocblas_fill_full;
+    rocblas_diagonal  diag  = rocblas_diagonal_non_unit;
+};
+
+// Element (i, j) of op(X) of batch b
+template <typename T>
+__device__ inline void device_ref_element(
+    const device_ref_operand<T>& X, int64_t b, int64_t i, int64_t j, double& re, double& im)
+{
+    bool    none = X.trans == rocblas_operation_none;
+    int64_t r    = none ? i : j;
+    int64_t c    = none ? j : i;
+    if((X.uplo == rocblas_fill_upper && r > c) || (X.uplo == rocblas_fill_lower && r < c))
+    {
+        re = im = 0;
+        return;
+    }
+    if(X.uplo != rocblas_fill_full && X.diag == rocblas_diagonal_unit && r == c)
+    {
+        re = 1;
+        im = 0;
+        return;
+    }
+    device_ref_split(X.data[b * X.stride + r + c * X.ld], re, im);
+    if(X.trans == rocblas_operation_conjugate_transpose)
+        im = -im;
+}
+
+constexpr int DEVICE_REF_DIM = 16;
+constexpr int DEVICE_REF_NB  = 256;
+static_assert(DEVICE_REF_DIM * DEVICE_REF_DIM == DEVICE_REF_NB);
+
+// D = alpha * op(L) * op(R) + beta * C for the M x K op(L) and the K x N op(R), one element of
+// D per thread; C is not read if beta is 0 and may be D
+template <typename Ti, typename To, typename Tc>
+__global__ void __launch_bounds__(DEVICE_REF_NB)
+    device_ref_gemm_kernel(int64_t                M,
+                           int64_t                N,
+                           int64_t                K,
+                           Tc                     alpha,
+                           device_ref_operand<Ti> L,
+                           device_ref_operand<Ti> R,
+                           Tc                     beta,
+                           const To*              C,
+                           int64_t                ldc,
+                           rocblas_stride         stride_c,
+                           To*                    D,
+                           int64_t                ldd,
+                           rocblas_stride         stride_d,
+                           int64_t                batch_count)
+{
+    double ar, ai, br, bi;
+    device_ref_split(alpha, ar, ai);
+    device_ref_split(beta, br, bi);
+
+    int64_t i = blockIdx.x * int64_t(DEVICE_REF_DIM) + threadIdx.x;
+    if(i >= M)
+        return;
+
+    for(int64_t b = blockIdx.z; b < batch_count; b += gridDim.z)
+        for(int64_t j = blockIdx.y * int64_t(DEVICE_REF_DIM) + threadIdx.y; j < N;
+            j += gridDim.y * int64_t(DEVICE_REF_DIM))
+        {
+            device_ref_dot2 re, im;
+            if(ar != 0 || ai != 0)
+                for(int64_t k = 0; k < K; ++k)
+                {
+                    double lr, li, rr, ri;
+                    device_ref_element(L, b, i, k, lr, li);
+                    device_ref_element(R, b, k, j, rr, ri);
+                    re.add(lr, rr);
+                    if constexpr(rocblas_is_complex<Ti>)
+                    {
+                        re.add(-li, ri);
+                        im.add(lr, ri);
+                        im.add(li, rr);
+                    }
+                }
+
+            double sr = re.sum(), si = im.sum();
+            double dr = ar * sr - ai * si;
+            double di = ar * si + ai * sr;
+            if(br != 0 || bi != 0)
+            {
+                double cr, ci;
+                device_ref_split(C[b * stride_c + i + j * ldc], cr, ci);
+                dr += br * cr - bi * ci;
+                di += br * ci + bi * cr;
+            }
+            D[b * stride_d + i + j * ldd] = device_ref_make<To>(dr, di);
+        }
+}
+
+// Reference of gemm_strided_batched on the device, D = alpha * op(A) * op(B) + beta * C
+template <typename Ti, typename To = Ti, typename Tc = To>
+void device_ref_gemm(rocblas_operation transA,
+                     rocblas_operation transB,
+                     int64_t           M,
+                     int64_t           N,
+                     int64_t           K,
+                     Tc                alpha,
+                     const Ti*         A,
+                     int64_t           lda,
+                     rocblas_stride    stride_a,
+                     const Ti*         B,
+                     int64_t           ldb,
+                     rocblas_stride    stride_b,
+                     Tc                beta,
+                     const To*         C,
+                     int64_t           ldc,
+                     rocblas_stride    stride_c,
+                     To*               D,
+                     int64_t           ldd,
+                     rocblas_stride    stride_d,
+                     int64_t           batch_count = 1)
+{
+    if(M <= 0 || N <= 0 || batch_count <= 0)
+        return;
+
+    device_ref_operand<Ti> L{A, lda, stride_a, transA};
+    device_ref_operand<Ti> R{B, ldb, stride_b, transB};
+
+    // the results under test may have been computed on any stream
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+    dim3 threads(DEVICE_REF_DIM, DEVICE_REF_DIM);
+    dim3 grid((M - 1) / DEVICE_REF_DIM + 1,
+              std::min((N - 1) / DEVICE_REF_DIM + 1, int64_t(65535)),
+              std::min(batch_count, int64_t(65535)));
+    hipLaunchKernelGGL((device_ref_gemm_kernel<Ti, To, Tc>),
+                       grid,
+                       threads,
+                       0,
+                       0,
+                       M,
+                       N,
+                       K,
+                       alpha,
+                       L,
+                       R,
+                       beta,
+                       C,
+                       ldc,
+                       stride_c,
+                       D,
+                       ldd,
+                       stride_d,
+                       batch_count);
+    CHECK_HIP_ERROR(hipGetLastError());
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+}
+
+// Reference of trmm on the device for the host matrix B, B = alpha * op(A) * B or
+// alpha * B * op(A) with the triangular A on the device
+template <typename T>
+void device_ref_trmm(rocblas_side      side,
+                     rocblas_fill      uplo,
+                     rocblas_operation transA,
+                     rocblas_diagonal  diag,
+                     int64_t           M,
+                     int64_t           N,
+                     T                 alpha,
+                     const T*          dA,
+                     int64_t           lda,
+                     T*                hB,
+                     int64_t           ldb)
+{
+    if(M <= 0 || N <= 0)
+        return;
+
+    device_vector<T> dB(size_t(M) * N), dD(size_t(M) * N);
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+    CHECK_HIP_ERROR(hipMemcpy2D(
+        dB, M * sizeof(T), hB, ldb * sizeof(T), M * sizeof(T), N, hipMemcpyHostToDevice));
+
+    device_ref_operand<T> A{dA, lda, 0, transA, uplo, diag};
+    device_ref_operand<T> X{dB, M, 0};
+    bool                  left = side == rocblas_side_left;
+
+    dim3 threads(DEVICE_REF_DIM, DEVICE_REF_DIM);
+    dim3 grid((M - 1) / DEVICE_REF_DIM + 1,
+              std::min((N - 1) / DEVICE_REF_DIM + 1, int64_t(65535)));
+    hipLaunchKernelGGL((device_ref_gemm_kernel<T, T, T>),
+                       grid,
+                       threads,
+                       0,
+                       0,
+                       M,
+                       N,
+                       left ? M : N,
+                       alpha,
+                       left ? A : X,
+                       left ? X : A,
+                       T(0),
+                       (const T*)nullptr,
+                       M,
+                       0,
+                       (T*)dD,
+                       M,
+                       0,
+                       1);
+    CHECK_HIP_ERROR(hipGetLastError());
+    CHECK_HIP_ERROR(hipMemcpy2D(
+        hB, ldb * sizeof(T), dD, M * sizeof(T), M * sizeof(T), N, hipMemcpyDeviceToHost));
+}
+
+// The results of the comparison of a reference with a result on the device
+struct device_ref_comparison
+{
+    double  norm_error     = 0; // largest over the batches of ||ref - res||_F / ||ref||_F
+    double  max_error      = 0; // largest absolute difference of a real or imaginary part
+    double  max_rel_error  = 0; // largest difference of a part relative to that of ref
+    int64_t nan_mismatches = 0; // elements which are NaN in only one of ref and res
+};
+
+__device__ inline void device_ref_accumulate(
+    double r, double g, double& ref2, double& diff2, double& max_abs, double& max_rel)
+{
+    double d = r == g ? 0 : fabs(g - r);
+    ref2 += r * r;
+    diff2 += d * d;
+    max_abs = fmax(max_abs, d);
+    max_rel = fmax(max_rel, r != 0 ? d / fabs(r) : d != 0 ? INFINITY : 0);
+}
+
+// Per batch sums of the squares of ref and of the differences, and the largest differences as
+// the bits of the non-negative doubles, which order as they do
+template <typename T>
+__global__ void __launch_bounds__(DEVICE_REF_NB)
+    device_ref_compare_kernel(int64_t             M,
+                              int64_t             N,
+                              const T*            ref,
+                              int64_t             ld_ref,
+                              rocblas_stride      stride_ref,
+                              const T*            res,
+                              int64_t             ld_res,
+                              rocblas_stride      stride_res,
+                              int64_t             batch_count,
+                              double*             sums,
+                              unsigned long long* counts)
+{
+    __shared__ double s_ref2[DEVICE_REF_NB], s_diff2[DEVICE_REF_NB];
+    __shared__ double s_abs[DEVICE_REF_NB], s_rel[DEVICE_REF_NB];
+
+    int tid = threadIdx.x;
+    for(int64_t b = blockIdx.y; b < batch_count; b += gridDim.y)
+    {
+        double ref2 = 0, diff2 = 0, max_abs = 0, max_rel = 0;
+        for(int64_t e = blockIdx.x * int64_t(DEVICE_REF_NB) + tid; e < M * N;
+            e += gridDim.x * int64_t(DEVICE_REF_NB))
+        {
+            int64_t i = e % M, j = e / M;
+            double  rr, ri, gr, gi;
+            device_ref_split(ref[b * stride_ref + i + j * ld_ref], rr, ri);
+            device_ref_split(res[b * stride_res + i + j * ld_res], gr, gi);
+            bool ref_nan = isnan(rr) || isnan(ri);
+            bool res_nan = isnan(gr) || isnan(gi);
+            if(ref_nan || res_nan)
+            {
+                if(ref_nan != res_nan)
+                    atomicAdd(&counts[2], 1ull);
+                continue;
+            }
+            device_ref_accumulate(rr, gr, ref2, diff2, max_abs, max_rel);
+            device_ref_accumulate(ri, gi, ref2, diff2, max_abs, max_rel);
+        }
+
+        s_ref2[tid]  = ref2;
+        s_diff2[tid] = diff2;
+        s_abs[tid]   = max_abs;
+        s_rel[tid]   = max_rel;
+        __syncthreads();
+        for(int n = DEVICE_REF_NB / 2; n > 0; n /= 2)
+        {
+            if(tid < n)
+            {
+                s_ref2[tid] += s_ref2[tid + n];
+                s_diff2[tid] += s_diff2[tid + n];
+                s_abs[tid] = fmax(s_abs[tid], s_abs[tid + n]);
+                s_rel[tid] = fmax(s_rel[tid], s_rel[tid + n]);
+            }
+            __syncthreads();
+        }
+        if(tid == 0)
+        {
+            atomicAdd(&sums[2 * b], s_ref2[0]);
+            atomicAdd(&sums[2 * b + 1], s_diff2[0]);
+            atomicMax(&counts[0], (unsigned long long)__double_as_longlong(s_abs[0]));
+            atomicMax(&counts[1], (unsigned long long)__double_as_longlong(s_rel[0]));
+        }
+        __syncthreads();
+    }
+}
+
+// Compare the M x N result res with the reference ref, both on the device, into cmp in one pass
+// instead of the host loops of unit_check_general, near_check_general and norm_check_general
+template <typename T>
+void device_ref_compare(device_ref_comparison& cmp,
+                        int64_t                M,
+                        int64_t                N,
+                        const T*               ref,
+                        int64_t                ld_ref,
+                        rocblas_stride         stride_ref,
+                        const T*               res,
+                        int64_t                ld_res,
+                        rocblas_stride         stride_res,
+                        int64_t                batch_count = 1)
+{
+    cmp = device_ref_comparison{};
+    if(M <= 0 || N <= 0 || batch_count <= 0)
+        return;
+
+    device_vector<double>             d_sums(2 * batch_count);
+    device_vector<unsigned long long> d_counts(3);
+    CHECK_DEVICE_ALLOCATION(d_sums.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_counts.memcheck());
+    CHECK_HIP_ERROR(hipMemset(d_sums, 0, 2 * batch_count * sizeof(double)));
+    CHECK_HIP_ERROR(hipMemset(d_counts, 0, 3 * sizeof(unsigned long long)));
+
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+    int64_t blocks = std::min((M * N - 1) / DEVICE_REF_NB + 1, int64_t(1024));
+    dim3    grid(blocks, std::min(batch_count, int64_t(65535)));
+    hipLaunchKernelGGL((device_ref_compare_kernel<T>),
+                       grid,
+                       dim3(DEVICE_REF_NB),
+                       0,
+                       0,
+                       M,
+                       N,
+                       ref,
+                       ld_ref,
+                       stride_ref,
+                       res,
+                       ld_res,
+                       stride_res,
+                       batch_count,
+                       (double*)d_sums,
+                       (unsigned long long*)d_counts);
+    CHECK_HIP_ERROR(hipGetLastError());
+
+    host_vector<double>             sums(2 * batch_count);
+    host_vector<unsigned long long> counts(3);
+    CHECK_HIP_ERROR(hipMemcpy(
+        sums.data(), d_sums, 2 * batch_count * sizeof(double), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(
+        counts.data(), d_counts, 3 * sizeof(unsigned long long), hipMemcpyDeviceToHost));
+
+    for(int64_t b = 0; b < batch_count; ++b)
+    {
+        double error = std::sqrt(sums[2 * b + 1]) / std::sqrt(sums[2 * b]);
+        if(!(error <= cmp.norm_error))
+            cmp.norm_error = error;
+    }
+    memcpy(&cmp.max_error, &counts[0], sizeof(double));
+    memcpy(&cmp.max_rel_error, &counts[1], sizeof(double));
+    cmp.nan_mismatches = counts[2];
+}
+
+// The device counterpart of unit_check_general, within the four units in the last place of
+// ASSERT_FLOAT_EQ and ASSERT_DOUBLE_EQ
+template <typename T>
+inline void device_unit_check(const device_ref_comparison& cmp)
+{
+#ifdef GOOGLE_TEST
+    using R = std::conditional_t<std::is_same_v<real_t<T>, double>, double, float>;
+    ASSERT_EQ(cmp.nan_mismatches, 0);
+    ASSERT_LE(cmp.max_rel_error, 4 * std::numeric_limits<R>::epsilon());
+#endif
+}
+
+// The device counterpart of near_check_general
+inline void device_near_check(const device_ref_comparison& cmp, double abs_error)
+{
+#ifdef GOOGLE_TEST
+    ASSERT_EQ(cmp.nan_mismatches, 0);
+    ASSERT_LE(cmp.max_error, abs_error);
+#endif
+}
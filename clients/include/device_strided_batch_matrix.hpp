@@ -199,10 +199,10 @@ public:
     //!
     hipError_t transfer_from(const host_strided_batch_matrix<T>& that)
     {
-        return hipMemcpy(this->data(),
-                         that.data(),
-                         sizeof(T) * this->nmemb(),
-                         this->use_HMM ? hipMemcpyHostToHost : hipMemcpyHostToDevice);
+        return rocblas_client_memcpy(this->data(),
+                                     that.data(),
+                                     sizeof(T) * this->nmemb(),
+                                     this->use_HMM ? hipMemcpyHostToHost : hipMemcpyHostToDevice);
     }
 
     //!
@@ -215,10 +215,11 @@ public:
         hipError_t status = hipSuccess;
         for(int64_t batch_index = 0; batch_index < m_batch_count; batch_index++)
         {
-            status = hipMemcpy(this->data() + (batch_index * m_stride),
-                               that.data(),
-                               sizeof(T) * this->m_n * this->m_lda,
-                               this->use_HMM ? hipMemcpyHostToHost : hipMemcpyHostToDevice);
+            status = rocblas_client_memcpy(this->data() + (batch_index * m_stride),
+                                           that.data(),
+                                           sizeof(T) * this->m_n * this->m_lda,
+                                           this->use_HMM ? hipMemcpyHostToHost
+                                                         : hipMemcpyHostToDevice);
             if(status != hipSuccess)
                 break;
         }
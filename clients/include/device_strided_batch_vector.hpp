@@ -181,10 +181,10 @@ public:
     //!
     hipError_t transfer_from(const host_strided_batch_vector<T>& that)
     {
-        return hipMemcpy(data(),
-                         that.data(),
-                         sizeof(T) * this->nmemb(),
-                         this->use_HMM ? hipMemcpyHostToHost : hipMemcpyHostToDevice);
+        return rocblas_client_memcpy(data(),
+                                     that.data(),
+                                     sizeof(T) * this->nmemb(),
+                                     this->use_HMM ? hipMemcpyHostToHost : hipMemcpyHostToDevice);
     }
 
     //!
@@ -198,10 +198,11 @@ public:
         size_t     single_vector_size = 1 + ((m_n ? m_n : 1) - 1) * std::abs(m_inc ? m_inc : 1);
         for(int64_t batch_index = 0; batch_index < m_batch_count; batch_index++)
         {
-            status = hipMemcpy(this->data() + (batch_index * m_stride),
-                               that.data(),
-                               sizeof(T) * single_vector_size,
-                               this->use_HMM ? hipMemcpyHostToHost : hipMemcpyHostToDevice);
+            status = rocblas_client_memcpy(this->data() + (batch_index * m_stride),
+                                           that.data(),
+                                           sizeof(T) * single_vector_size,
+                                           this->use_HMM ? hipMemcpyHostToHost
+                                                         : hipMemcpyHostToDevice);
             if(status != hipSuccess)
                 break;
         }
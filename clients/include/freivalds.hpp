@@ -0,0 +1,355 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*!\file
+ * \brief probabilistic verification of level 3 results by Freivalds' algorithm, for problems whose
+ * host reference takes too long.
+ *
+ * A result is checked against products with random vectors of +1 and -1, e.g. D x against
+ * alpha * op(A) (op(B) x) + beta * C x for gemm, in O(n^2) operations instead of the O(n^3) of a
+ * reference. An incorrect result passes the check of one vector with a probability of at most one
+ * half, so ROCBLAS_CLIENT_FREIVALDS_CONFIDENCE, the probability of catching an incorrect result,
+ * by default 0.999999, sets the number of vectors. The products are accumulated in double along
+ * with the products of the absolute values, which bound the rounding errors of the result, and the
+ * residual of the check is the largest difference relative to that bound.
+ * ROCBLAS_CLIENT_FREIVALDS is the number of multiply-adds of a problem from which the tests use
+ * it; if it is not set, the results are always checked against a reference.
+ */
+
+#pragma once
+
+#include "device_reference.hpp"
+#include "rocblas.h"
+#include "rocblas_test.hpp"
+#include <cmath>
+#include <algorithm>
+#include <complex>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+inline bool rocblas_client_freivalds(double multiply_adds)
+{
+    static const double threshold = [] {
+        const char* env = getenv("ROCBLAS_CLIENT_FREIVALDS");
+        return env && *env ? atof(env) : -1.0;
+    }();
+    return threshold >= 0 && multiply_adds >= threshold;
+}
+
+// Number of random vectors of a check, each halving the probability of missing an error
+inline int rocblas_client_freivalds_vectors()
+{
+    static const int vectors = [] {
+        const char* env        = getenv("ROCBLAS_CLIENT_FREIVALDS_CONFIDENCE");
+        double      confidence = env && *env ? atof(env) : 0.999999;
+        if(!(confidence > 0 && confidence < 1))
+            confidence = 0.999999;
+        return std::max(1, int(std::ceil(-std::log2(1 - confidence))));
+    }();
+    return vectors;
+}
+
+// A vector of a check, and the products of the absolute values bounding its rounding errors
+struct freivalds_vector
+{
+    std::vector<std::complex<double>> value;
+    std::vector<double>               bound;
+
+    explicit freivalds_vector(int64_t n = 0)
+        : value(n)
+        , bound(n)
+    {
+    }
+};
+
+// A matrix operand op(X) of a check, the uplo triangle of X with the diagonal diag if X is
+// triangular, or the symmetric matrix of its uplo triangle if symmetric is set
+template <typename T>
+struct freivalds_operand
+{
+    const T*          data;
+    int64_t           ld;
+    rocblas_operation trans     = rocblas_operation_none;
+    rocblas_fill      uplo      = rocblas_fill_full;
+    rocblas_diagonal  diag      = rocblas_diagonal_non_unit;
+    bool              symmetric = false;
+
+    // Element (i, j) of op(X)
+    std::complex<double> operator()(int64_t i, int64_t j) const
+    {
+        bool    none = trans == rocblas_operation_none;
+        int64_t r    = none ? i : j;
+        int64_t c    = none ? j : i;
+        if((uplo == rocblas_fill_upper && r > c) || (uplo == rocblas_fill_lower && r < c))
+        {
+            if(!symmetric)
+                return 0;
+            std::swap(r, c);
+        }
+        if(uplo != rocblas_fill_full && !symmetric && diag == rocblas_diagonal_unit && r == c)
+            return 1;
+
+        double re, im;
+        device_ref_split(data[r + c * ld], re, im);
+        return {re, trans == rocblas_operation_conjugate_transpose ? -im : im};
+    }
+};
+
+// y = scale * op(X) x for the rows x cols op(X)
+template <typename T>
+void freivalds_product(const freivalds_operand<T>& X,
+                       int64_t                     rows,
+                       int64_t                     cols,
+                       const freivalds_vector&     x,
+                       freivalds_vector&           y,
+                       std::complex<double>        scale = 1)
+{
+    y = freivalds_vector(rows);
+    if(scale == 0.0)
+        return;
+
+    // Blocks of rows, whose columns are read contiguously if op(X) is not transposed
+    constexpr int64_t NB = 64;
+#pragma omp parallel for schedule(dynamic)
+    for(int64_t i0 = 0; i0 < rows; i0 += NB)
+    {
+        int64_t i1 = std::min(rows, i0 + NB);
+        if(X.trans == rocblas_operation_none)
+        {
+            for(int64_t j = 0; j < cols; ++j)
+                for(int64_t i = i0; i < i1; ++i)
+                {
+                    auto a = X(i, j);
+                    y.value[i] += a * x.value[j];
+                    y.bound[i] += std::abs(a) * x.bound[j];
+                }
+        }
+        else
+        {
+            for(int64_t i = i0; i < i1; ++i)
+                for(int64_t j = 0; j < cols; ++j)
+                {
+                    auto a = X(i, j);
+                    y.value[i] += a * x.value[j];
+                    y.bound[i] += std::abs(a) * x.bound[j];
+                }
+        }
+        for(int64_t i = i0; i < i1; ++i)
+        {
+            y.value[i] *= scale;
+            y.bound[i] *= std::abs(scale);
+        }
+    }
+}
+
+// The random vector v of a check
+inline freivalds_vector freivalds_random_vector(int64_t n, int v)
+{
+    freivalds_vector x(n);
+    std::mt19937     rng(v);
+    for(int64_t i = 0; i < n; ++i)
+    {
+        x.value[i] = rng() & 1 ? 1.0 : -1.0;
+        x.bound[i] = 1;
+    }
+    return x;
+}
+
+// Largest difference of lhs and rhs relative to the bounds of their rounding errors; a NaN in
+// only one of them is an infinite difference
+inline double freivalds_residual(const freivalds_vector& lhs, const freivalds_vector& rhs)
+{
+    double residual = 0;
+    for(size_t i = 0; i < lhs.value.size(); ++i)
+    {
+        auto l = lhs.value[i], r = rhs.value[i];
+        bool l_nan = std::isnan(l.real()) || std::isnan(l.imag());
+        bool r_nan = std::isnan(r.real()) || std::isnan(r.imag());
+        if(l_nan || r_nan)
+        {
+            if(l_nan != r_nan)
+                return std::numeric_limits<double>::infinity();
+            continue;
+        }
+        double diff  = std::abs(l - r);
+        double bound = lhs.bound[i] + rhs.bound[i];
+        if(diff > 0)
+            residual = std::max(residual,
+                                bound > 0 ? diff / bound : std::numeric_limits<double>::infinity());
+    }
+    return residual;
+}
+
+template <typename T>
+inline std::complex<double> freivalds_scalar(const T& alpha)
+{
+    double re, im;
+    device_ref_split(alpha, re, im);
+    return {re, im};
+}
+
+//!
+//! @brief Residual of D = alpha * op(A) * op(B) + beta * C for the M x K op(A) and K x N op(B),
+//! with C its value before the gemm. C is not read if beta is 0.
+//!
+template <typename T>
+double freivalds_gemm(rocblas_operation transA,
+                      rocblas_operation transB,
+                      int64_t           M,
+                      int64_t           N,
+                      int64_t           K,
+                      T                 alpha,
+                      const T*          A,
+                      int64_t           lda,
+                      const T*          B,
+                      int64_t           ldb,
+                      T                 beta,
+                      const T*          C,
+                      const T*          D,
+                      int64_t           ldc)
+{
+    freivalds_operand<T> opA{A, lda, transA}, opB{B, ldb, transB};
+    freivalds_operand<T> opC{C, ldc}, opD{D, ldc};
+    auto                 a = freivalds_scalar(alpha), b = freivalds_scalar(beta);
+
+    double residual = 0;
+    for(int v = 0; v < rocblas_client_freivalds_vectors(); ++v)
+    {
+        freivalds_vector x = freivalds_random_vector(N, v), Bx, rhs, Cx, lhs;
+        freivalds_product(opB, K, N, x, Bx);
+        freivalds_product(opA, M, K, Bx, rhs, a);
+        freivalds_product(opC, M, N, x, Cx, b);
+        for(int64_t i = 0; i < M; ++i)
+        {
+            rhs.value[i] += Cx.value[i];
+            rhs.bound[i] += Cx.bound[i];
+        }
+        freivalds_product(opD, M, N, x, lhs);
+        residual = std::max(residual, freivalds_residual(lhs, rhs));
+    }
+    return residual;
+}
+
+//!
+//! @brief Residual of the solution X of op(A) * X = alpha * B if side is left, or of
+//! X * op(A) = alpha * B if it is right, for the M x N X and B.
+//!
+template <typename T>
+double freivalds_trsm(rocblas_side      side,
+                      rocblas_fill      uplo,
+                      rocblas_operation transA,
+                      rocblas_diagonal  diag,
+                      int64_t           M,
+                      int64_t           N,
+                      T                 alpha,
+                      const T*          A,
+                      int64_t           lda,
+                      const T*          X,
+                      int64_t           ldx,
+                      const T*          B,
+                      int64_t           ldb)
+{
+    freivalds_operand<T> opA{A, lda, transA, uplo, diag}, opX{X, ldx}, opB{B, ldb};
+    int64_t              K = side == rocblas_side_left ? M : N;
+
+    double residual = 0;
+    for(int v = 0; v < rocblas_client_freivalds_vectors(); ++v)
+    {
+        freivalds_vector x = freivalds_random_vector(N, v), y, lhs, rhs;
+        if(side == rocblas_side_left)
+        {
+            freivalds_product(opX, M, N, x, y);
+            freivalds_product(opA, M, K, y, lhs);
+        }
+        else
+        {
+            freivalds_product(opA, N, K, x, y);
+            freivalds_product(opX, M, N, y, lhs);
+        }
+        freivalds_product(opB, M, N, x, rhs, freivalds_scalar(alpha));
+        residual = std::max(residual, freivalds_residual(lhs, rhs));
+    }
+    return residual;
+}
+
+//!
+//! @brief Residual of the uplo triangle of C = alpha * op(A) * op(A)^T + beta * C for the N x K
+//! op(A), with C its value before the syrk. The other triangle of D must be that of C.
+//!
+template <typename T>
+double freivalds_syrk(rocblas_fill      uplo,
+                      rocblas_operation transA,
+                      int64_t           N,
+                      int64_t           K,
+                      T                 alpha,
+                      const T*          A,
+                      int64_t           lda,
+                      T                 beta,
+                      const T*          C,
+                      const T*          D,
+                      int64_t           ldc)
+{
+    // the strict other triangle is not written
+    for(int64_t j = 0; j < N; ++j)
+        for(int64_t i = uplo == rocblas_fill_upper ? j + 1 : 0;
+            i < (uplo == rocblas_fill_upper ? N : j);
+            ++i)
+            if(memcmp(&C[i + j * ldc], &D[i + j * ldc], sizeof(T)))
+                return std::numeric_limits<double>::infinity();
+
+    rocblas_operation    transAT = transA == rocblas_operation_none ? rocblas_operation_transpose
+                                                                    : rocblas_operation_none;
+    freivalds_operand<T> opA{A, lda, transA}, opAT{A, lda, transAT};
+    freivalds_operand<T> opC{C, ldc, rocblas_operation_none, uplo};
+    freivalds_operand<T> opD{D, ldc, rocblas_operation_none, uplo};
+    opC.symmetric = opD.symmetric = true;
+    auto a = freivalds_scalar(alpha), b = freivalds_scalar(beta);
+
+    double residual = 0;
+    for(int v = 0; v < rocblas_client_freivalds_vectors(); ++v)
+    {
+        freivalds_vector x = freivalds_random_vector(N, v), ATx, rhs, Cx, lhs;
+        freivalds_product(opAT, K, N, x, ATx);
+        freivalds_product(opA, N, K, ATx, rhs, a);
+        freivalds_product(opC, N, N, x, Cx, b);
+        for(int64_t i = 0; i < N; ++i)
+        {
+            rhs.value[i] += Cx.value[i];
+            rhs.bound[i] += Cx.bound[i];
+        }
+        freivalds_product(opD, N, N, x, lhs);
+        residual = std::max(residual, freivalds_residual(lhs, rhs));
+    }
+    return residual;
+}
+
+// The check of the residual of a result, the rounding errors of a sum of k products bounded by
+// about k * eps relative to the products of the absolute values
+inline void freivalds_unit_check(double residual, double tolerance)
+{
+#ifdef GOOGLE_TEST
+    ASSERT_LE(residual, tolerance);
+#endif
+}
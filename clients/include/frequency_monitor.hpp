@@ -41,6 +41,16 @@ public:
     virtual std::vector<double> getAllMedianSYSCLK()     = 0;
     virtual double              getAverageMEMCLK()       = 0;
     virtual double              getMedianMEMCLK()        = 0;
+
+    // Power and temperature are sampled with the clocks when ROCBLAS_BENCH_POWER is set
+    virtual bool   powerReport()       = 0;
+    virtual double getAveragePower()   = 0; // W
+    virtual double getMaxTemperature() = 0; // junction, C
+
+    // With ROCBLAS_BENCH_THERMAL_STEADY set, false until the junction temperature sampled each
+    // second since start() has changed by at most 1 C over 5 s, or for at most the number of
+    // seconds it is set to; the benchmark calls the function being measured until it is true
+    virtual bool thermalSteady() = 0;
 };
 
 FrequencyMonitor& getFrequencyMonitor();
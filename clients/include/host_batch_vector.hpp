@@ -185,7 +185,8 @@ public:
 
         if(m_batch_count > 0)
         {
-            if(hipSuccess != (hip_err = hipMemcpy((*this)[0], that[0], num_bytes, kind)))
+            if(hipSuccess
+               != (hip_err = rocblas_client_memcpy((*this)[0], that[0], num_bytes, kind)))
             {
                 return hip_err;
             }
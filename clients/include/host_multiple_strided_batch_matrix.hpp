@@ -252,10 +252,10 @@ public:
         if(that.use_HMM && hipSuccess != (hip_err = hipDeviceSynchronize()))
             return hip_err;
 
-        return hipMemcpy(this->m_data,
-                         that.data(),
-                         sizeof(T) * this->m_nmemb,
-                         that.use_HMM ? hipMemcpyHostToHost : hipMemcpyDeviceToHost);
+        return rocblas_client_memcpy(this->m_data,
+                                     that.data(),
+                                     sizeof(T) * this->m_nmemb,
+                                     that.use_HMM ? hipMemcpyHostToHost : hipMemcpyDeviceToHost);
     }
 
     //!
@@ -270,10 +270,10 @@ public:
         if(that.use_HMM && hipSuccess != (hip_err = hipDeviceSynchronize()))
             return hip_err;
 
-        return hipMemcpy(this->m_data,
-                         that.data(),
-                         sizeof(T) * this->m_nmemb,
-                         that.use_HMM ? hipMemcpyHostToHost : hipMemcpyDeviceToHost);
+        return rocblas_client_memcpy(this->m_data,
+                                     that.data(),
+                                     sizeof(T) * this->m_nmemb,
+                                     that.use_HMM ? hipMemcpyHostToHost : hipMemcpyDeviceToHost);
     }
 
     //!
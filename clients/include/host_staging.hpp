@@ -0,0 +1,129 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "pinned_memory_allocator.hpp"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime.h>
+#include <new>
+#include <vector>
+
+//!
+//! @brief Size of the chunks of the pinned staging buffers of rocblas_client_memcpy.
+//!
+constexpr size_t HOST_STAGING_CHUNK = size_t(4) << 20;
+
+//!
+//! @brief Pinned staging buffers of the calling thread, allocated on its first staged copy.
+//!
+struct host_staging
+{
+    std::vector<char, pinned_memory_allocator<char>> buffer[2];
+
+    static host_staging& get()
+    {
+        static thread_local host_staging staging;
+        return staging;
+    }
+};
+
+//!
+//! @brief Synchronous copy like hipMemcpy. Large copies between pageable host memory and device
+//! memory are staged through the two pinned buffers of the thread, so that the host copy of a
+//! chunk runs while the DMA of the other is in flight, instead of the runtime staging the whole
+//! copy in turn. The copies are ordered on the null stream as hipMemcpy is.
+//! @param dst  Destination.
+//! @param src  Source.
+//! @param bytes Number of bytes.
+//! @param kind Direction of the copy.
+//! @return The hip error.
+//!
+inline hipError_t
+    rocblas_client_memcpy(void* dst, const void* src, size_t bytes, hipMemcpyKind kind)
+{
+    if((kind != hipMemcpyHostToDevice && kind != hipMemcpyDeviceToHost)
+       || bytes < 2 * HOST_STAGING_CHUNK)
+        return hipMemcpy(dst, src, bytes, kind);
+
+    auto& staging = host_staging::get();
+    try
+    {
+        for(auto& buffer : staging.buffer)
+            if(buffer.size() < HOST_STAGING_CHUNK)
+                buffer.resize(HOST_STAGING_CHUNK);
+    }
+    catch(const std::bad_alloc&)
+    {
+        return hipMemcpy(dst, src, bytes, kind);
+    }
+
+    hipEvent_t done[2]{};
+    hipError_t status = hipSuccess;
+    for(auto& event : done)
+        if(status == hipSuccess)
+            status = hipEventCreateWithFlags(&event, hipEventDisableTiming);
+
+    auto*  d      = static_cast<char*>(dst);
+    auto*  s      = static_cast<const char*>(src);
+    size_t chunks = (bytes + HOST_STAGING_CHUNK - 1) / HOST_STAGING_CHUNK;
+    auto   offset = [&](size_t c) { return c * HOST_STAGING_CHUNK; };
+    auto   length = [&](size_t c) { return std::min(HOST_STAGING_CHUNK, bytes - offset(c)); };
+
+    for(size_t c = 0; c < chunks && status == hipSuccess; ++c)
+    {
+        char* buffer = staging.buffer[c % 2].data();
+        if(kind == hipMemcpyHostToDevice)
+        {
+            // The buffer is free once the DMA of the chunk before the previous one is done
+            if(c >= 2)
+                status = hipEventSynchronize(done[c % 2]);
+            if(status == hipSuccess)
+            {
+                memcpy(buffer, s + offset(c), length(c));
+                status = hipMemcpyAsync(d + offset(c), buffer, length(c), kind, 0);
+            }
+        }
+        else
+        {
+            // The DMA of this chunk runs while the previous chunk is copied out of its buffer
+            status = hipMemcpyAsync(buffer, s + offset(c), length(c), kind, 0);
+            if(status == hipSuccess && c >= 1)
+                status = hipEventSynchronize(done[(c - 1) % 2]);
+            if(status == hipSuccess && c >= 1)
+                memcpy(d + offset(c - 1), staging.buffer[(c - 1) % 2].data(), length(c - 1));
+        }
+        if(status == hipSuccess)
+            status = hipEventRecord(done[c % 2], 0);
+    }
+
+    if(status == hipSuccess)
+        status = hipEventSynchronize(done[(chunks - 1) % 2]);
+    if(status == hipSuccess && kind == hipMemcpyDeviceToHost)
+        memcpy(d + offset(chunks - 1), staging.buffer[(chunks - 1) % 2].data(), length(chunks - 1));
+
+    for(auto& event : done)
+        if(event)
+            (void)hipEventDestroy(event);
+    return status;
+}
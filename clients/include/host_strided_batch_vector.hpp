@@ -208,10 +208,10 @@ public:
         if(that.use_HMM && hipSuccess != (hip_err = hipDeviceSynchronize()))
             return hip_err;
 
-        return hipMemcpy(m_data,
-                         that.data(),
-                         sizeof(T) * m_nmemb,
-                         that.use_HMM ? hipMemcpyHostToHost : hipMemcpyDeviceToHost);
+        return rocblas_client_memcpy(m_data,
+                                     that.data(),
+                                     sizeof(T) * m_nmemb,
+                                     that.use_HMM ? hipMemcpyHostToHost : hipMemcpyDeviceToHost);
     }
 
     //!
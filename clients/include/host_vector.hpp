@@ -103,10 +103,10 @@ struct host_vector : std::vector<T, host_memory_allocator<T>>
         if(that.use_HMM && hipSuccess != (hip_err = hipDeviceSynchronize()))
             return hip_err;
 
-        return hipMemcpy(*this,
-                         that,
-                         sizeof(T) * this->size(),
-                         that.use_HMM ? hipMemcpyHostToHost : hipMemcpyDeviceToHost);
+        return rocblas_client_memcpy(*this,
+                                     that,
+                                     sizeof(T) * this->size(),
+                                     that.use_HMM ? hipMemcpyHostToHost : hipMemcpyDeviceToHost);
     }
 
     //!
@@ -5120,6 +5120,782 @@ MAP2CF(rocblas_trtri_strided_batched, double, rocblas_dtrtri_strided_batched);
 MAP2CF(rocblas_trtri_strided_batched, rocblas_float_complex, rocblas_ctrtri_strided_batched);
 MAP2CF(rocblas_trtri_strided_batched, rocblas_double_complex, rocblas_ztrtri_strided_batched);
 
+/*
+ * ===========================================================================
+ *    beta features, C API only
+ *    defined by the translation units which define ROCBLAS_BETA_FEATURES_API
+ * ===========================================================================
+ */
+
+#ifdef ROCBLAS_BETA_FEATURES_API
+
+#define MAP2C(FN, A, PFN) \
+    template <>           \
+    static auto FN<A> = PFN
+
+// gemm_host
+template <typename T>
+static rocblas_status (*rocblas_gemm_host)(rocblas_handle    handle,
+                                           rocblas_operation transA,
+                                           rocblas_operation transB,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           rocblas_int       k,
+                                           const T*          alpha,
+                                           const T*          A,
+                                           rocblas_int       lda,
+                                           const T*          B,
+                                           rocblas_int       ldb,
+                                           const T*          beta,
+                                           T*                C,
+                                           rocblas_int       ldc);
+
+MAP2C(rocblas_gemm_host, float, rocblas_sgemm_host);
+MAP2C(rocblas_gemm_host, double, rocblas_dgemm_host);
+MAP2C(rocblas_gemm_host, rocblas_float_complex, rocblas_cgemm_host);
+MAP2C(rocblas_gemm_host, rocblas_double_complex, rocblas_zgemm_host);
+
+// gemm_mgpu
+template <typename T>
+static rocblas_status (*rocblas_gemm_mgpu)(const rocblas_handle* handles,
+                                           rocblas_int           num_handles,
+                                           rocblas_operation     transA,
+                                           rocblas_operation     transB,
+                                           rocblas_int           m,
+                                           rocblas_int           n,
+                                           rocblas_int           k,
+                                           const T*              alpha,
+                                           const T*              A,
+                                           rocblas_int           lda,
+                                           const T*              B,
+                                           rocblas_int           ldb,
+                                           const T*              beta,
+                                           T*                    C,
+                                           rocblas_int           ldc);
+
+MAP2C(rocblas_gemm_mgpu, float, rocblas_sgemm_mgpu);
+MAP2C(rocblas_gemm_mgpu, double, rocblas_dgemm_mgpu);
+MAP2C(rocblas_gemm_mgpu, rocblas_float_complex, rocblas_cgemm_mgpu);
+MAP2C(rocblas_gemm_mgpu, rocblas_double_complex, rocblas_zgemm_mgpu);
+
+// trsm_strided_batched_mgpu
+template <typename T>
+static rocblas_status (*rocblas_trsm_strided_batched_mgpu)(const rocblas_handle* handles,
+                                                           rocblas_int           num_handles,
+                                                           rocblas_side          side,
+                                                           rocblas_fill          uplo,
+                                                           rocblas_operation     transA,
+                                                           rocblas_diagonal      diag,
+                                                           rocblas_int           m,
+                                                           rocblas_int           n,
+                                                           const T*              alpha,
+                                                           const T*              A,
+                                                           rocblas_int           lda,
+                                                           rocblas_stride        stride_A,
+                                                           T*                    B,
+                                                           rocblas_int           ldb,
+                                                           rocblas_stride        stride_B,
+                                                           rocblas_int           batch_count);
+
+MAP2C(rocblas_trsm_strided_batched_mgpu, float, rocblas_strsm_strided_batched_mgpu);
+MAP2C(rocblas_trsm_strided_batched_mgpu, double, rocblas_dtrsm_strided_batched_mgpu);
+MAP2C(rocblas_trsm_strided_batched_mgpu, rocblas_float_complex, rocblas_ctrsm_strided_batched_mgpu);
+MAP2C(
+    rocblas_trsm_strided_batched_mgpu, rocblas_double_complex, rocblas_ztrsm_strided_batched_mgpu);
+
+// axpy_dot
+template <typename T>
+static rocblas_status (*rocblas_axpy_dot)(rocblas_handle handle,
+                                          rocblas_int    n,
+                                          const T*       alpha,
+                                          const T*       x,
+                                          rocblas_int    incx,
+                                          T*             y,
+                                          rocblas_int    incy,
+                                          const T*       z,
+                                          rocblas_int    incz,
+                                          T*             result);
+
+MAP2C(rocblas_axpy_dot, float, rocblas_saxpy_dot);
+MAP2C(rocblas_axpy_dot, double, rocblas_daxpy_dot);
+
+// axpby_nrm2
+template <typename T>
+static rocblas_status (*rocblas_axpby_nrm2)(rocblas_handle handle,
+                                            rocblas_int    n,
+                                            const T*       alpha,
+                                            const T*       x,
+                                            rocblas_int    incx,
+                                            const T*       beta,
+                                            T*             y,
+                                            rocblas_int    incy,
+                                            T*             result);
+
+MAP2C(rocblas_axpby_nrm2, float, rocblas_saxpby_nrm2);
+MAP2C(rocblas_axpby_nrm2, double, rocblas_daxpby_nrm2);
+
+// dot2
+template <typename T>
+static rocblas_status (*rocblas_dot2)(rocblas_handle handle,
+                                      rocblas_int    n,
+                                      const T*       x,
+                                      rocblas_int    incx,
+                                      const T*       y,
+                                      rocblas_int    incy,
+                                      const T*       z,
+                                      rocblas_int    incz,
+                                      T*             result);
+
+MAP2C(rocblas_dot2, float, rocblas_sdot2);
+MAP2C(rocblas_dot2, double, rocblas_ddot2);
+
+// mdot
+template <typename T>
+static rocblas_status (*rocblas_mdot)(rocblas_handle handle,
+                                      rocblas_int    n,
+                                      rocblas_int    k,
+                                      const T*       x,
+                                      rocblas_int    incx,
+                                      const T*       Y,
+                                      rocblas_int    ldy,
+                                      T*             result);
+
+MAP2C(rocblas_mdot, float, rocblas_smdot);
+MAP2C(rocblas_mdot, double, rocblas_dmdot);
+
+// rot_sequence
+template <typename T>
+static rocblas_status (*rocblas_rot_sequence)(rocblas_handle handle,
+                                              rocblas_int    m,
+                                              rocblas_int    n,
+                                              const T*       c,
+                                              const T*       s,
+                                              T*             A,
+                                              rocblas_int    lda);
+
+MAP2C(rocblas_rot_sequence, float, rocblas_srot_sequence);
+MAP2C(rocblas_rot_sequence, double, rocblas_drot_sequence);
+
+template <typename T>
+static rocblas_status (*rocblas_rot_sequence_strided_batched)(rocblas_handle handle,
+                                                              rocblas_int    m,
+                                                              rocblas_int    n,
+                                                              const T*       c,
+                                                              rocblas_stride stride_c,
+                                                              const T*       s,
+                                                              rocblas_stride stride_s,
+                                                              T*             A,
+                                                              rocblas_int    lda,
+                                                              rocblas_stride stride_A,
+                                                              rocblas_int    batch_count);
+
+MAP2C(rocblas_rot_sequence_strided_batched, float, rocblas_srot_sequence_strided_batched);
+MAP2C(rocblas_rot_sequence_strided_batched, double, rocblas_drot_sequence_strided_batched);
+
+// iamax_value and iamin_value
+template <typename T>
+static rocblas_status (*rocblas_iamax_value)(rocblas_handle handle,
+                                             rocblas_int    n,
+                                             const T*       x,
+                                             rocblas_int    incx,
+                                             rocblas_int*   index,
+                                             real_t<T>*     value);
+
+MAP2C(rocblas_iamax_value, float, rocblas_isamax_value);
+MAP2C(rocblas_iamax_value, double, rocblas_idamax_value);
+MAP2C(rocblas_iamax_value, rocblas_float_complex, rocblas_icamax_value);
+MAP2C(rocblas_iamax_value, rocblas_double_complex, rocblas_izamax_value);
+
+template <typename T>
+static rocblas_status (*rocblas_iamin_value)(rocblas_handle handle,
+                                             rocblas_int    n,
+                                             const T*       x,
+                                             rocblas_int    incx,
+                                             rocblas_int*   index,
+                                             real_t<T>*     value);
+
+MAP2C(rocblas_iamin_value, float, rocblas_isamin_value);
+MAP2C(rocblas_iamin_value, double, rocblas_idamin_value);
+MAP2C(rocblas_iamin_value, rocblas_float_complex, rocblas_icamin_value);
+MAP2C(rocblas_iamin_value, rocblas_double_complex, rocblas_izamin_value);
+
+template <typename T>
+static rocblas_status (*rocblas_iamax_value_strided_batched)(rocblas_handle handle,
+                                                             rocblas_int    n,
+                                                             const T*       x,
+                                                             rocblas_int    incx,
+                                                             rocblas_stride stridex,
+                                                             rocblas_int    batch_count,
+                                                             rocblas_int*   index,
+                                                             real_t<T>*     value);
+
+MAP2C(rocblas_iamax_value_strided_batched, float, rocblas_isamax_value_strided_batched);
+MAP2C(rocblas_iamax_value_strided_batched, double, rocblas_idamax_value_strided_batched);
+MAP2C(rocblas_iamax_value_strided_batched,
+      rocblas_float_complex,
+      rocblas_icamax_value_strided_batched);
+MAP2C(rocblas_iamax_value_strided_batched,
+      rocblas_double_complex,
+      rocblas_izamax_value_strided_batched);
+
+template <typename T>
+static rocblas_status (*rocblas_iamin_value_strided_batched)(rocblas_handle handle,
+                                                             rocblas_int    n,
+                                                             const T*       x,
+                                                             rocblas_int    incx,
+                                                             rocblas_stride stridex,
+                                                             rocblas_int    batch_count,
+                                                             rocblas_int*   index,
+                                                             real_t<T>*     value);
+
+MAP2C(rocblas_iamin_value_strided_batched, float, rocblas_isamin_value_strided_batched);
+MAP2C(rocblas_iamin_value_strided_batched, double, rocblas_idamin_value_strided_batched);
+MAP2C(rocblas_iamin_value_strided_batched,
+      rocblas_float_complex,
+      rocblas_icamin_value_strided_batched);
+MAP2C(rocblas_iamin_value_strided_batched,
+      rocblas_double_complex,
+      rocblas_izamin_value_strided_batched);
+
+// gemv_multi
+template <typename T>
+static rocblas_status (*rocblas_gemv_multi)(rocblas_handle    handle,
+                                            rocblas_operation transA,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            rocblas_int       k,
+                                            const T*          alpha,
+                                            const T*          A,
+                                            rocblas_int       lda,
+                                            const T*          X,
+                                            rocblas_int       ldx,
+                                            const T*          beta,
+                                            T*                Y,
+                                            rocblas_int       ldy);
+
+MAP2C(rocblas_gemv_multi, float, rocblas_sgemv_multi);
+MAP2C(rocblas_gemv_multi, double, rocblas_dgemv_multi);
+MAP2C(rocblas_gemv_multi, rocblas_float_complex, rocblas_cgemv_multi);
+MAP2C(rocblas_gemv_multi, rocblas_double_complex, rocblas_zgemv_multi);
+
+// ger_multi, geru_multi and gerc_multi
+template <typename T, bool CONJ = false>
+static rocblas_status (*rocblas_ger_multi)(rocblas_handle handle,
+                                           rocblas_int    m,
+                                           rocblas_int    n,
+                                           rocblas_int    k,
+                                           const T*       alpha,
+                                           const T*       X,
+                                           rocblas_int    ldx,
+                                           const T*       Y,
+                                           rocblas_int    ldy,
+                                           T*             A,
+                                           rocblas_int    lda);
+
+template <>
+static auto rocblas_ger_multi<float, false> = rocblas_sger_multi;
+template <>
+static auto rocblas_ger_multi<double, false> = rocblas_dger_multi;
+template <>
+static auto rocblas_ger_multi<rocblas_float_complex, false> = rocblas_cgeru_multi;
+template <>
+static auto rocblas_ger_multi<rocblas_double_complex, false> = rocblas_zgeru_multi;
+template <>
+static auto rocblas_ger_multi<rocblas_float_complex, true> = rocblas_cgerc_multi;
+template <>
+static auto rocblas_ger_multi<rocblas_double_complex, true> = rocblas_zgerc_multi;
+
+// syr_multi
+template <typename T>
+static rocblas_status (*rocblas_syr_multi)(rocblas_handle handle,
+                                           rocblas_fill   uplo,
+                                           rocblas_int    n,
+                                           rocblas_int    k,
+                                           const T*       alpha,
+                                           const T*       X,
+                                           rocblas_int    ldx,
+                                           T*             A,
+                                           rocblas_int    lda);
+
+MAP2C(rocblas_syr_multi, float, rocblas_ssyr_multi);
+MAP2C(rocblas_syr_multi, double, rocblas_dsyr_multi);
+MAP2C(rocblas_syr_multi, rocblas_float_complex, rocblas_csyr_multi);
+MAP2C(rocblas_syr_multi, rocblas_double_complex, rocblas_zsyr_multi);
+
+// her_multi
+template <typename T>
+static rocblas_status (*rocblas_her_multi)(rocblas_handle   handle,
+                                           rocblas_fill     uplo,
+                                           rocblas_int      n,
+                                           rocblas_int      k,
+                                           const real_t<T>* alpha,
+                                           const T*         X,
+                                           rocblas_int      ldx,
+                                           T*               A,
+                                           rocblas_int      lda);
+
+MAP2C(rocblas_her_multi, rocblas_float_complex, rocblas_cher_multi);
+MAP2C(rocblas_her_multi, rocblas_double_complex, rocblas_zher_multi);
+
+// tpttr and trttp
+template <typename T>
+static rocblas_status (*rocblas_tpttr)(
+    rocblas_handle handle, rocblas_fill uplo, rocblas_int n, const T* AP, T* A, rocblas_int lda);
+
+MAP2C(rocblas_tpttr, float, rocblas_stpttr);
+MAP2C(rocblas_tpttr, double, rocblas_dtpttr);
+MAP2C(rocblas_tpttr, rocblas_float_complex, rocblas_ctpttr);
+MAP2C(rocblas_tpttr, rocblas_double_complex, rocblas_ztpttr);
+
+template <typename T>
+static rocblas_status (*rocblas_trttp)(
+    rocblas_handle handle, rocblas_fill uplo, rocblas_int n, const T* A, rocblas_int lda, T* AP);
+
+MAP2C(rocblas_trttp, float, rocblas_strttp);
+MAP2C(rocblas_trttp, double, rocblas_dtrttp);
+MAP2C(rocblas_trttp, rocblas_float_complex, rocblas_ctrttp);
+MAP2C(rocblas_trttp, rocblas_double_complex, rocblas_ztrttp);
+
+template <typename T>
+static rocblas_status (*rocblas_tpttr_strided_batched)(rocblas_handle handle,
+                                                       rocblas_fill   uplo,
+                                                       rocblas_int    n,
+                                                       const T*       AP,
+                                                       rocblas_stride stride_ap,
+                                                       T*             A,
+                                                       rocblas_int    lda,
+                                                       rocblas_stride stride_a,
+                                                       rocblas_int    batch_count);
+
+MAP2C(rocblas_tpttr_strided_batched, float, rocblas_stpttr_strided_batched);
+MAP2C(rocblas_tpttr_strided_batched, double, rocblas_dtpttr_strided_batched);
+MAP2C(rocblas_tpttr_strided_batched, rocblas_float_complex, rocblas_ctpttr_strided_batched);
+MAP2C(rocblas_tpttr_strided_batched, rocblas_double_complex, rocblas_ztpttr_strided_batched);
+
+template <typename T>
+static rocblas_status (*rocblas_trttp_strided_batched)(rocblas_handle handle,
+                                                       rocblas_fill   uplo,
+                                                       rocblas_int    n,
+                                                       const T*       A,
+                                                       rocblas_int    lda,
+                                                       rocblas_stride stride_a,
+                                                       T*             AP,
+                                                       rocblas_stride stride_ap,
+                                                       rocblas_int    batch_count);
+
+MAP2C(rocblas_trttp_strided_batched, float, rocblas_strttp_strided_batched);
+MAP2C(rocblas_trttp_strided_batched, double, rocblas_dtrttp_strided_batched);
+MAP2C(rocblas_trttp_strided_batched, rocblas_float_complex, rocblas_ctrttp_strided_batched);
+MAP2C(rocblas_trttp_strided_batched, rocblas_double_complex, rocblas_ztrttp_strided_batched);
+
+// gbtge and getgb
+template <typename T>
+static rocblas_status (*rocblas_gbtge_strided_batched)(rocblas_handle handle,
+                                                       rocblas_int    m,
+                                                       rocblas_int    n,
+                                                       rocblas_int    kl,
+                                                       rocblas_int    ku,
+                                                       const T*       AB,
+                                                       rocblas_int    ldab,
+                                                       rocblas_stride stride_ab,
+                                                       T*             A,
+                                                       rocblas_int    lda,
+                                                       rocblas_stride stride_a,
+                                                       rocblas_int    batch_count);
+
+MAP2C(rocblas_gbtge_strided_batched, float, rocblas_sgbtge_strided_batched);
+MAP2C(rocblas_gbtge_strided_batched, double, rocblas_dgbtge_strided_batched);
+MAP2C(rocblas_gbtge_strided_batched, rocblas_float_complex, rocblas_cgbtge_strided_batched);
+MAP2C(rocblas_gbtge_strided_batched, rocblas_double_complex, rocblas_zgbtge_strided_batched);
+
+template <typename T>
+static rocblas_status (*rocblas_getgb_strided_batched)(rocblas_handle handle,
+                                                       rocblas_int    m,
+                                                       rocblas_int    n,
+                                                       rocblas_int    kl,
+                                                       rocblas_int    ku,
+                                                       const T*       A,
+                                                       rocblas_int    lda,
+                                                       rocblas_stride stride_a,
+                                                       T*             AB,
+                                                       rocblas_int    ldab,
+                                                       rocblas_stride stride_ab,
+                                                       rocblas_int    batch_count);
+
+MAP2C(rocblas_getgb_strided_batched, float, rocblas_sgetgb_strided_batched);
+MAP2C(rocblas_getgb_strided_batched, double, rocblas_dgetgb_strided_batched);
+MAP2C(rocblas_getgb_strided_batched, rocblas_float_complex, rocblas_cgetgb_strided_batched);
+MAP2C(rocblas_getgb_strided_batched, rocblas_double_complex, rocblas_zgetgb_strided_batched);
+
+// symmetrize and hermitize
+template <typename T>
+static rocblas_status (*rocblas_symmetrize_strided_batched)(rocblas_handle handle,
+                                                            rocblas_fill   uplo,
+                                                            rocblas_int    n,
+                                                            T*             A,
+                                                            rocblas_int    lda,
+                                                            rocblas_stride stride_a,
+                                                            rocblas_int    batch_count);
+
+MAP2C(rocblas_symmetrize_strided_batched, float, rocblas_ssymmetrize_strided_batched);
+MAP2C(rocblas_symmetrize_strided_batched, double, rocblas_dsymmetrize_strided_batched);
+MAP2C(rocblas_symmetrize_strided_batched,
+      rocblas_float_complex,
+      rocblas_csymmetrize_strided_batched);
+MAP2C(rocblas_symmetrize_strided_batched,
+      rocblas_double_complex,
+      rocblas_zsymmetrize_strided_batched);
+
+template <typename T>
+static rocblas_status (*rocblas_hermitize_strided_batched)(rocblas_handle handle,
+                                                           rocblas_fill   uplo,
+                                                           rocblas_int    n,
+                                                           T*             A,
+                                                           rocblas_int    lda,
+                                                           rocblas_stride stride_a,
+                                                           rocblas_int    batch_count);
+
+MAP2C(rocblas_hermitize_strided_batched, rocblas_float_complex, rocblas_chermitize_strided_batched);
+MAP2C(rocblas_hermitize_strided_batched,
+      rocblas_double_complex,
+      rocblas_zhermitize_strided_batched);
+
+// sprk, hprk, spr2k and hpr2k
+template <typename T>
+static rocblas_status (*rocblas_sprk_strided_batched)(rocblas_handle handle,
+                                                      rocblas_fill   uplo,
+                                                      rocblas_int    n,
+                                                      rocblas_int    k,
+                                                      const T*       alpha,
+                                                      const T*       X,
+                                                      rocblas_int    ldx,
+                                                      rocblas_stride stride_x,
+                                                      T*             AP,
+                                                      rocblas_stride stride_ap,
+                                                      rocblas_int    batch_count);
+
+MAP2C(rocblas_sprk_strided_batched, float, rocblas_ssprk_strided_batched);
+MAP2C(rocblas_sprk_strided_batched, double, rocblas_dsprk_strided_batched);
+MAP2C(rocblas_sprk_strided_batched, rocblas_float_complex, rocblas_csprk_strided_batched);
+MAP2C(rocblas_sprk_strided_batched, rocblas_double_complex, rocblas_zsprk_strided_batched);
+
+template <typename T>
+static rocblas_status (*rocblas_hprk_strided_batched)(rocblas_handle   handle,
+                                                      rocblas_fill     uplo,
+                                                      rocblas_int      n,
+                                                      rocblas_int      k,
+                                                      const real_t<T>* alpha,
+                                                      const T*         X,
+                                                      rocblas_int      ldx,
+                                                      rocblas_stride   stride_x,
+                                                      T*               AP,
+                                                      rocblas_stride   stride_ap,
+                                                      rocblas_int      batch_count);
+
+MAP2C(rocblas_hprk_strided_batched, rocblas_float_complex, rocblas_chprk_strided_batched);
+MAP2C(rocblas_hprk_strided_batched, rocblas_double_complex, rocblas_zhprk_strided_batched);
+
+template <typename T>
+static rocblas_status (*rocblas_spr2k_strided_batched)(rocblas_handle handle,
+                                                       rocblas_fill   uplo,
+                                                       rocblas_int    n,
+                                                       rocblas_int    k,
+                                                       const T*       alpha,
+                                                       const T*       X,
+                                                       rocblas_int    ldx,
+                                                       rocblas_stride stride_x,
+                                                       const T*       Y,
+                                                       rocblas_int    ldy,
+                                                       rocblas_stride stride_y,
+                                                       T*             AP,
+                                                       rocblas_stride stride_ap,
+                                                       rocblas_int    batch_count);
+
+MAP2C(rocblas_spr2k_strided_batched, float, rocblas_sspr2k_strided_batched);
+MAP2C(rocblas_spr2k_strided_batched, double, rocblas_dspr2k_strided_batched);
+
+template <typename T>
+static rocblas_status (*rocblas_hpr2k_strided_batched)(rocblas_handle handle,
+                                                       rocblas_fill   uplo,
+                                                       rocblas_int    n,
+                                                       rocblas_int    k,
+                                                       const T*       alpha,
+                                                       const T*       X,
+                                                       rocblas_int    ldx,
+                                                       rocblas_stride stride_x,
+                                                       const T*       Y,
+                                                       rocblas_int    ldy,
+                                                       rocblas_stride stride_y,
+                                                       T*             AP,
+                                                       rocblas_stride stride_ap,
+                                                       rocblas_int    batch_count);
+
+MAP2C(rocblas_hpr2k_strided_batched, rocblas_float_complex, rocblas_chpr2k_strided_batched);
+MAP2C(rocblas_hpr2k_strided_batched, rocblas_double_complex, rocblas_zhpr2k_strided_batched);
+
+// gemm_int4
+template <typename T>
+static rocblas_status (*rocblas_gemm_int4)(rocblas_handle    handle,
+                                           rocblas_operation trans_a,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           rocblas_int       k,
+                                           const float*      alpha,
+                                           const T*          A,
+                                           rocblas_int       lda,
+                                           const uint8_t*    B,
+                                           rocblas_int       ldb,
+                                           const T*          scales,
+                                           const T*          zeros,
+                                           rocblas_int       group_size,
+                                           const float*      beta,
+                                           T*                C,
+                                           rocblas_int       ldc);
+
+MAP2C(rocblas_gemm_int4, rocblas_half, rocblas_hgemm_int4);
+MAP2C(rocblas_gemm_int4, rocblas_bfloat16, rocblas_bfgemm_int4);
+
+// trsm_refine
+template <typename T>
+static rocblas_status (*rocblas_trsm_refine)(rocblas_handle    handle,
+                                             rocblas_side      side,
+                                             rocblas_fill      uplo,
+                                             rocblas_operation transA,
+                                             rocblas_diagonal  diag,
+                                             rocblas_int       m,
+                                             rocblas_int       n,
+                                             const T*          alpha,
+                                             const T*          A,
+                                             rocblas_int       lda,
+                                             T*                B,
+                                             rocblas_int       ldb,
+                                             real_t<T>         tol,
+                                             rocblas_int       max_iter,
+                                             rocblas_int*      iterations);
+
+MAP2C(rocblas_trsm_refine, double, rocblas_dtrsm_refine);
+
+// syrk_diag
+template <typename T>
+static rocblas_status (*rocblas_syrk_diag)(rocblas_handle    handle,
+                                           rocblas_fill      uplo,
+                                           rocblas_operation transA,
+                                           rocblas_int       n,
+                                           rocblas_int       k,
+                                           const T*          alpha,
+                                           const T*          A,
+                                           rocblas_int       lda,
+                                           const T*          d,
+                                           rocblas_int       incd,
+                                           const T*          beta,
+                                           T*                C,
+                                           rocblas_int       ldc);
+
+MAP2C(rocblas_syrk_diag, float, rocblas_ssyrk_diag);
+MAP2C(rocblas_syrk_diag, double, rocblas_dsyrk_diag);
+MAP2C(rocblas_syrk_diag, rocblas_float_complex, rocblas_csyrk_diag);
+MAP2C(rocblas_syrk_diag, rocblas_double_complex, rocblas_zsyrk_diag);
+
+// herk_diag
+template <typename T>
+static rocblas_status (*rocblas_herk_diag)(rocblas_handle    handle,
+                                           rocblas_fill      uplo,
+                                           rocblas_operation transA,
+                                           rocblas_int       n,
+                                           rocblas_int       k,
+                                           const real_t<T>*  alpha,
+                                           const T*          A,
+                                           rocblas_int       lda,
+                                           const real_t<T>*  d,
+                                           rocblas_int       incd,
+                                           const real_t<T>*  beta,
+                                           T*                C,
+                                           rocblas_int       ldc);
+
+MAP2C(rocblas_herk_diag, rocblas_float_complex, rocblas_cherk_diag);
+MAP2C(rocblas_herk_diag, rocblas_double_complex, rocblas_zherk_diag);
+
+// gemm_sparse24
+template <typename T>
+static rocblas_status (*rocblas_gemm_sparse24)(rocblas_handle    handle,
+                                               rocblas_operation trans_b,
+                                               rocblas_int       m,
+                                               rocblas_int       n,
+                                               rocblas_int       k,
+                                               const float*      alpha,
+                                               const T*          Ac,
+                                               rocblas_int       ldac,
+                                               const uint8_t*    meta,
+                                               rocblas_int       ldmeta,
+                                               const T*          B,
+                                               rocblas_int       ldb,
+                                               const float*      beta,
+                                               T*                C,
+                                               rocblas_int       ldc);
+
+MAP2C(rocblas_gemm_sparse24, rocblas_half, rocblas_hgemm_sparse24);
+MAP2C(rocblas_gemm_sparse24, rocblas_bfloat16, rocblas_bfgemm_sparse24);
+
+// sparse24_compress
+template <typename T>
+static rocblas_status (*rocblas_sparse24_compress)(rocblas_handle handle,
+                                                   rocblas_int    m,
+                                                   rocblas_int    k,
+                                                   const T*       A,
+                                                   rocblas_int    lda,
+                                                   T*             Ac,
+                                                   rocblas_int    ldac,
+                                                   uint8_t*       meta,
+                                                   rocblas_int    ldmeta);
+
+MAP2C(rocblas_sparse24_compress, rocblas_half, rocblas_hsparse24_compress);
+MAP2C(rocblas_sparse24_compress, rocblas_bfloat16, rocblas_bfsparse24_compress);
+
+// gemm_planar and gemv_planar
+template <typename T>
+static rocblas_status (*rocblas_gemm_planar)(rocblas_handle    handle,
+                                             rocblas_operation transA,
+                                             rocblas_operation transB,
+                                             rocblas_int       m,
+                                             rocblas_int       n,
+                                             rocblas_int       k,
+                                             const T*          alpha,
+                                             const real_t<T>*  Ar,
+                                             const real_t<T>*  Ai,
+                                             rocblas_int       lda,
+                                             const real_t<T>*  Br,
+                                             const real_t<T>*  Bi,
+                                             rocblas_int       ldb,
+                                             const T*          beta,
+                                             real_t<T>*        Cr,
+                                             real_t<T>*        Ci,
+                                             rocblas_int       ldc);
+
+MAP2C(rocblas_gemm_planar, rocblas_float_complex, rocblas_cgemm_planar);
+MAP2C(rocblas_gemm_planar, rocblas_double_complex, rocblas_zgemm_planar);
+
+template <typename T>
+static rocblas_status (*rocblas_gemv_planar)(rocblas_handle    handle,
+                                             rocblas_operation transA,
+                                             rocblas_int       m,
+                                             rocblas_int       n,
+                                             const T*          alpha,
+                                             const real_t<T>*  Ar,
+                                             const real_t<T>*  Ai,
+                                             rocblas_int       lda,
+                                             const real_t<T>*  xr,
+                                             const real_t<T>*  xi,
+                                             rocblas_int       incx,
+                                             const T*          beta,
+                                             real_t<T>*        yr,
+                                             real_t<T>*        yi,
+                                             rocblas_int       incy);
+
+MAP2C(rocblas_gemv_planar, rocblas_float_complex, rocblas_cgemv_planar);
+MAP2C(rocblas_gemv_planar, rocblas_double_complex, rocblas_zgemv_planar);
+
+// normalize_strided_batched
+template <typename T>
+static rocblas_status (*rocblas_normalize_strided_batched)(rocblas_handle handle,
+                                                           rocblas_int    n,
+                                                           T*             x,
+                                                           rocblas_int    incx,
+                                                           rocblas_stride stridex,
+                                                           rocblas_int    batch_count,
+                                                           real_t<T>*     results);
+
+MAP2C(rocblas_normalize_strided_batched, float, rocblas_snormalize_strided_batched);
+MAP2C(rocblas_normalize_strided_batched, double, rocblas_dnormalize_strided_batched);
+MAP2C(rocblas_normalize_strided_batched, rocblas_float_complex, rocblas_cnormalize_strided_batched);
+MAP2C(rocblas_normalize_strided_batched,
+      rocblas_double_complex,
+      rocblas_znormalize_strided_batched);
+
+// fast
+template <typename T>
+static rocblas_status (*rocblas_scal_fast)(
+    rocblas_handle handle, rocblas_int n, const T* alpha, T* x, rocblas_int incx);
+
+MAP2C(rocblas_scal_fast, float, rocblas_sscal_fast);
+MAP2C(rocblas_scal_fast, double, rocblas_dscal_fast);
+
+template <typename T>
+static rocblas_status (*rocblas_axpy_fast)(rocblas_handle handle,
+                                           rocblas_int    n,
+                                           const T*       alpha,
+                                           const T*       x,
+                                           rocblas_int    incx,
+                                           T*             y,
+                                           rocblas_int    incy);
+
+MAP2C(rocblas_axpy_fast, float, rocblas_saxpy_fast);
+MAP2C(rocblas_axpy_fast, double, rocblas_daxpy_fast);
+
+template <typename T>
+static rocblas_status (*rocblas_gemv_fast)(rocblas_handle    handle,
+                                           rocblas_operation transA,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           const T*          alpha,
+                                           const T*          A,
+                                           rocblas_int       lda,
+                                           const T*          x,
+                                           rocblas_int       incx,
+                                           const T*          beta,
+                                           T*                y,
+                                           rocblas_int       incy);
+
+MAP2C(rocblas_gemv_fast, float, rocblas_sgemv_fast);
+MAP2C(rocblas_gemv_fast, double, rocblas_dgemv_fast);
+
+template <typename T>
+static rocblas_status (*rocblas_gemm_fast)(rocblas_handle    handle,
+                                           rocblas_operation transA,
+                                           rocblas_operation transB,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           rocblas_int       k,
+                                           const T*          alpha,
+                                           const T*          A,
+                                           rocblas_int       lda,
+                                           const T*          B,
+                                           rocblas_int       ldb,
+                                           const T*          beta,
+                                           T*                C,
+                                           rocblas_int       ldc);
+
+MAP2C(rocblas_gemm_fast, float, rocblas_sgemm_fast);
+MAP2C(rocblas_gemm_fast, double, rocblas_dgemm_fast);
+
+// gemv_gathered_batched
+template <typename T>
+static rocblas_status (*rocblas_gemv_gathered_batched)(rocblas_handle     handle,
+                                                       rocblas_operation  transA,
+                                                       rocblas_int        m,
+                                                       rocblas_int        n,
+                                                       const T*           alpha,
+                                                       const T*           A,
+                                                       rocblas_int        lda,
+                                                       const rocblas_int* index,
+                                                       rocblas_stride     stride_index,
+                                                       const T*           x,
+                                                       rocblas_int        incx,
+                                                       rocblas_stride     stridex,
+                                                       const T*           beta,
+                                                       T*                 y,
+                                                       rocblas_int        incy,
+                                                       rocblas_stride     stridey,
+                                                       rocblas_int        batch_count);
+
+MAP2C(rocblas_gemv_gathered_batched, float, rocblas_sgemv_gathered_batched);
+MAP2C(rocblas_gemv_gathered_batched, double, rocblas_dgemv_gathered_batched);
+MAP2C(rocblas_gemv_gathered_batched, rocblas_float_complex, rocblas_cgemv_gathered_batched);
+MAP2C(rocblas_gemv_gathered_batched, rocblas_double_complex, rocblas_zgemv_gathered_batched);
+
+#undef MAP2C
+
+#endif // ROCBLAS_BETA_FEATURES_API
+
 #undef GET_MACRO
 #undef MAP2CF
 #undef MAP2CF3
@@ -71,6 +71,9 @@ struct Arguments
 {
     static constexpr int64_t c_scan_value = -999;
 
+    // timing value which also times replays of a graph of one call, in benchmarks which support it
+    static constexpr int8_t c_timing_graph = 2;
+
     /*************************************************************************
      *                    Beginning Of Arguments                             *
      *************************************************************************/
@@ -144,6 +147,10 @@ struct Arguments
     // '?' is wildcard char, empty string is default as valid on all
     char gpu_arch[4];
 
+    // operands which are not rotated through the flush_batch_count copies, so that they stay in
+    // cache, such as "B" for hot activations and cold weights; all are rotated if empty
+    char hot_operands[4];
+
     rocblas_client_api api;
 
     // memory padding for testing write out of bounds
@@ -155,6 +162,12 @@ struct Arguments
     uint64_t flush_batch_count;
     uint64_t flush_memory_size;
 
+    // number of calls of the problem in the measured workload, weighting its time in the total
+    uint64_t call_count;
+
+    // bytes of a device to device copy run before each timed call, as other work would
+    uint64_t noise_bytes;
+
     // 16 bit
     uint16_t threads;
     uint16_t streams;
@@ -181,6 +194,7 @@ struct Arguments
     bool HMM; // xnack+
     bool graph_test;
     bool repeatability_check;
+    bool cache_flush; // flush L2 and MALL before each timed call
 
     /*************************************************************************
      *                     End Of Arguments                                  *
@@ -242,11 +256,14 @@ struct Arguments
     OPER(atomics_mode) SEP           \
     OPER(os_flags) SEP               \
     OPER(gpu_arch) SEP               \
+    OPER(hot_operands) SEP           \
     OPER(api) SEP                    \
     OPER(pad) SEP                    \
     OPER(math_mode) SEP              \
     OPER(flush_batch_count) SEP             \
     OPER(flush_memory_size) SEP             \
+    OPER(call_count) SEP             \
+    OPER(noise_bytes) SEP            \
     OPER(threads) SEP                \
     OPER(streams) SEP                \
     OPER(devices) SEP                \
@@ -266,7 +283,8 @@ struct Arguments
     OPER(outofplace) SEP             \
     OPER(HMM) SEP                    \
     OPER(graph_test) SEP             \
-    OPER(repeatability_check)
+    OPER(repeatability_check) SEP    \
+    OPER(cache_flush)
     // clang-format on
 
     // Validate input format.
@@ -0,0 +1,390 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*!\file
+ * \brief initialization of matrices on the device, with a counter-based generator of the
+ * distributions of rocblas_random.hpp, for inputs whose host initialization and copy take
+ * longer than the benchmark itself.
+ *
+ * With ROCBLAS_CLIENT_DEVICE_INIT set to 1, the matrices are generated directly in device
+ * memory and copied to the host only when the results are checked; benchmarks which check
+ * nothing do not allocate the host copies at all. Each initialization draws
+ * its seed from t_rocblas_rng, so that the data are as repeatable as those of the host.
+ */
+
+#pragma once
+
+#include "rocblas_arguments.hpp"
+#include "rocblas_matrix.hpp"
+#include <cstdlib>
+#include <initializer_list>
+
+inline bool rocblas_client_device_init()
+{
+    static const bool enabled = [] {
+        const char* env = getenv("ROCBLAS_CLIENT_DEVICE_INIT");
+        return env && atoi(env) != 0;
+    }();
+    return enabled;
+}
+
+typedef enum rocblas_device_init_kind_
+{
+    rocblas_device_init_rand_int, // random_generator
+    rocblas_device_init_zero_one, // random_zero_one_generator
+    rocblas_device_init_hpl, // random_hpl_generator
+    rocblas_device_init_nan, // random_nan_generator
+    rocblas_device_init_zero
+} rocblas_device_init_kind;
+
+// Random 64 bits of element counter of the stream seed, the output of splitmix64 at that
+// position, so that every element is generated independently
+__device__ inline uint64_t rocblas_device_rng(uint64_t seed, uint64_t counter)
+{
+    uint64_t z = seed + (counter + 1) * 0x9E3779B97F4A7C15ull;
+    z          = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z          = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// NaN with random sign and significand bits, as rocblas_nan_rng
+template <typename T>
+__device__ inline T rocblas_device_random_nan(uint64_t bits)
+{
+    constexpr bool is_double = std::is_same_v<T, double>;
+    constexpr bool is_float  = std::is_same_v<T, float>;
+    constexpr bool is_half   = std::is_same_v<T, rocblas_half>;
+    constexpr int  SIG       = is_double ? 52 : is_float ? 23 : is_half ? 10 : 7;
+    constexpr int  EXP       = is_double ? 11 : is_half ? 5 : 8;
+    using UINT_T             = std::conditional_t<is_double,
+                                      uint64_t,
+                                      std::conditional_t<is_float, uint32_t, uint16_t>>;
+    static_assert(sizeof(UINT_T) == sizeof(T), "Type sizes do not match");
+
+    union
+    {
+        UINT_T u;
+        T      fp;
+    } x;
+    x.u = UINT_T(bits);
+    if(!(x.u & (((UINT_T)1 << SIG) - 1)))
+        x.u |= 1; // not Inf
+    x.u |= (((UINT_T)1 << EXP) - 1) << SIG;
+    return x.fp;
+}
+
+// Element counter of the generator of kind for the type T
+template <typename T>
+__device__ T rocblas_device_random(rocblas_device_init_kind kind, uint64_t seed, uint64_t counter)
+{
+    if constexpr(rocblas_is_complex<T>)
+    {
+        using R = real_t<T>;
+
+        // the host generators draw both parts only for random integers and NaN
+        if(kind == rocblas_device_init_rand_int || kind == rocblas_device_init_nan)
+            return T(rocblas_device_random<R>(kind, seed, 2 * counter),
+                     rocblas_device_random<R>(kind, seed, 2 * counter + 1));
+        return T(rocblas_device_random<R>(kind, seed, counter), R(0));
+    }
+    else
+    {
+        uint64_t bits = rocblas_device_rng(seed, counter);
+        switch(kind)
+        {
+        case rocblas_device_init_rand_int:
+            if constexpr(std::is_same_v<T, rocblas_half> || std::is_same_v<T, rocblas_bfloat16>)
+                return T(float(int(bits % 5) - 2));
+            else
+                return T(float(1 + bits % 10));
+        case rocblas_device_init_zero_one:
+            return T(float(bits & 1));
+        case rocblas_device_init_hpl:
+            if constexpr(std::is_same_v<T, rocblas_bfloat16>)
+                return T(float((bits >> 11) * 0x1.0p-53 - 0.5));
+            else
+                return T((bits >> 11) * 0x1.0p-53 - 0.5);
+        case rocblas_device_init_nan:
+            return rocblas_device_random_nan<T>(bits);
+        default:
+            return T(0.0f);
+        }
+    }
+}
+
+template <typename T>
+__device__ inline T* rocblas_device_init_batch(T* A, rocblas_stride stride, int64_t b)
+{
+    return A + b * stride;
+}
+
+template <typename T>
+__device__ inline T* rocblas_device_init_batch(T* const* A, rocblas_stride, int64_t b)
+{
+    return A[b];
+}
+
+constexpr int ROCBLAS_DEVICE_INIT_NB = 256;
+
+// One column of M elements of a batch per block row, the elements numbered in the order of a
+// strided batch of M x N matrices whatever lda is
+template <typename T, typename U>
+__global__ void __launch_bounds__(ROCBLAS_DEVICE_INIT_NB)
+    rocblas_device_init_kernel(U                         A,
+                               rocblas_stride            stride,
+                               int64_t                   M,
+                               int64_t                   N,
+                               int64_t                   lda,
+                               int64_t                   batch_count,
+                               rocblas_device_init_kind  kind,
+                               uint64_t                  seed,
+                               rocblas_check_matrix_type matrix_type,
+                               char                      uplo,
+                               bool                      alternating_sign)
+{
+    int64_t i = blockIdx.x * int64_t(ROCBLAS_DEVICE_INIT_NB) + threadIdx.x;
+    if(i >= M)
+        return;
+
+    for(int64_t b = blockIdx.z; b < batch_count; b += gridDim.z)
+    {
+        T* Ab = rocblas_device_init_batch(A, stride, b);
+        for(int64_t j = blockIdx.y; j < N; j += gridDim.y)
+        {
+            bool in_triangle = matrix_type != rocblas_client_triangular_matrix
+                               || (uplo == 'U' ? j >= i : j <= i);
+            T value = in_triangle ? rocblas_device_random<T>(kind, seed, (b * N + j) * M + i)
+                                  : T(0.0f);
+            if(alternating_sign && !((i ^ j) & 1))
+                value = -value;
+            Ab[i + j * lda] = value;
+        }
+    }
+}
+
+// The device generator of the initialization of a matrix of T by arg, if it has one and
+// ROCBLAS_CLIENT_DEVICE_INIT is set, with the choices of the host rocblas_init_matrix
+template <typename T>
+inline bool rocblas_device_init_kind_of(const Arguments&          arg,
+                                        rocblas_check_nan_init    nan_init,
+                                        rocblas_check_matrix_type matrix_type,
+                                        bool                      alternating_sign,
+                                        rocblas_device_init_kind& kind)
+{
+    constexpr bool device_type = std::is_same_v<T, float> || std::is_same_v<T, double>
+                                 || std::is_same_v<T, rocblas_half>
+                                 || std::is_same_v<T, rocblas_bfloat16> || rocblas_is_complex<T>;
+    if(!device_type || !rocblas_client_device_init()
+       || (matrix_type != rocblas_client_general_matrix
+           && matrix_type != rocblas_client_triangular_matrix))
+        return false;
+
+    if((nan_init == rocblas_client_alpha_sets_nan && rocblas_isnan(arg.alpha))
+       || (nan_init == rocblas_client_beta_sets_nan && rocblas_isnan(arg.beta)))
+        kind = rocblas_device_init_nan;
+    else if(arg.initialization == rocblas_initialization::hpl)
+        kind = rocblas_device_init_hpl;
+    else if(arg.initialization == rocblas_initialization::rand_int)
+        kind = rocblas_device_init_rand_int;
+    else if(arg.initialization == rocblas_initialization::rand_int_zero_one)
+        kind = alternating_sign ? rocblas_device_init_rand_int : rocblas_device_init_zero_one;
+    else if(arg.initialization == rocblas_initialization::zero)
+        kind = rocblas_device_init_zero;
+    else
+        return false;
+    return true;
+}
+
+//!
+//! @brief Whether all inputs of a test are generated on the device and its results are not
+//! checked, so that its host matrices are never used. Such a benchmark allocates 1 x 1 host
+//! matrices in place of the host copies, and runs the sizes which fit in device memory only.
+//! @param arg Specifies the argument class.
+//! @param inputs The nan_init of each general input matrix.
+//!
+template <typename T>
+inline bool rocblas_device_init_only(const Arguments&                              arg,
+                                     std::initializer_list<rocblas_check_nan_init> inputs)
+{
+    if(arg.unit_check || arg.norm_check)
+        return false;
+
+    rocblas_device_init_kind kind;
+    for(auto nan_init : inputs)
+        if(!rocblas_device_init_kind_of<T>(
+               arg, nan_init, rocblas_client_general_matrix, false, kind))
+            return false;
+    return true;
+}
+
+template <typename T, typename U>
+inline void rocblas_device_init_launch(U                         A,
+                                       rocblas_stride            stride,
+                                       int64_t                   M,
+                                       int64_t                   N,
+                                       int64_t                   lda,
+                                       int64_t                   batch_count,
+                                       rocblas_device_init_kind  kind,
+                                       rocblas_check_matrix_type matrix_type,
+                                       char                      uplo,
+                                       bool                      alternating_sign)
+{
+    if(M <= 0 || N <= 0 || batch_count <= 0)
+        return;
+
+    uint64_t seed   = std::uniform_int_distribution<uint64_t>{}(t_rocblas_rng);
+    int64_t  blocks = (M - 1) / ROCBLAS_DEVICE_INIT_NB + 1;
+    dim3     grid(blocks, std::min(N, int64_t(65535)), std::min(batch_count, int64_t(65535)));
+    hipLaunchKernelGGL((rocblas_device_init_kernel<T, U>),
+                       grid,
+                       dim3(ROCBLAS_DEVICE_INIT_NB),
+                       0,
+                       0,
+                       A,
+                       stride,
+                       M,
+                       N,
+                       lda,
+                       batch_count,
+                       kind,
+                       seed,
+                       matrix_type,
+                       uplo,
+                       alternating_sign);
+    CHECK_HIP_ERROR(hipGetLastError());
+}
+
+//!
+//! @brief Initialize a device_matrix and its host_matrix.
+//! With ROCBLAS_CLIENT_DEVICE_INIT set, the initialization of arg is generated on the device
+//! if it can be, and copied to hA only if arg checks the results; otherwise hA is initialized
+//! as by rocblas_init_matrix and copied to dA.
+//! @param dA The device_matrix.
+//! @param hA The host_matrix.
+//! @param arg Specifies the argument class.
+//! @param nan_init Initialize matrix with Nan's depending upon the rocblas_check_nan_init enum value.
+//! @param matrix_type Initialization of the matrix based upon the rocblas_check_matrix_type enum value.
+//! @param seedReset reset the seed if true, do not reset the seed otherwise.
+//! @param alternating_sign Initialize matrix so adjacent entries have alternating sign.
+//!
+template <typename T>
+inline void rocblas_init_device_matrix(device_matrix<T>&         dA,
+                                       host_matrix<T>&           hA,
+                                       const Arguments&          arg,
+                                       rocblas_check_nan_init    nan_init,
+                                       rocblas_check_matrix_type matrix_type,
+                                       bool                      seedReset        = false,
+                                       bool                      alternating_sign = false)
+{
+    rocblas_device_init_kind kind;
+    if(rocblas_device_init_kind_of<T>(arg, nan_init, matrix_type, alternating_sign, kind))
+    {
+        if(seedReset)
+            rocblas_seedrand();
+        rocblas_device_init_launch<T>(
+            (T*)dA, 0, dA.m(), dA.n(), dA.lda(), 1, kind, matrix_type, arg.uplo, alternating_sign);
+        if(arg.unit_check || arg.norm_check)
+            CHECK_HIP_ERROR(hA.transfer_from(dA));
+    }
+    else
+    {
+        rocblas_init_matrix(hA, arg, nan_init, matrix_type, seedReset, alternating_sign);
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+//!
+//! @brief Initialize a device_strided_batch_matrix and its host_strided_batch_matrix, as
+//! rocblas_init_device_matrix.
+//!
+template <typename T>
+inline void rocblas_init_device_matrix(device_strided_batch_matrix<T>& dA,
+                                       host_strided_batch_matrix<T>&   hA,
+                                       const Arguments&                arg,
+                                       rocblas_check_nan_init          nan_init,
+                                       rocblas_check_matrix_type       matrix_type,
+                                       bool                            seedReset        = false,
+                                       bool                            alternating_sign = false)
+{
+    rocblas_device_init_kind kind;
+    if(rocblas_device_init_kind_of<T>(arg, nan_init, matrix_type, alternating_sign, kind))
+    {
+        if(seedReset)
+            rocblas_seedrand();
+        rocblas_device_init_launch<T>(dA.data(),
+                                      dA.stride(),
+                                      dA.m(),
+                                      dA.n(),
+                                      dA.lda(),
+                                      dA.batch_count(),
+                                      kind,
+                                      matrix_type,
+                                      arg.uplo,
+                                      alternating_sign);
+        if(arg.unit_check || arg.norm_check)
+            CHECK_HIP_ERROR(hA.transfer_from(dA));
+    }
+    else
+    {
+        rocblas_init_matrix(hA, arg, nan_init, matrix_type, seedReset, alternating_sign);
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+//!
+//! @brief Initialize a device_batch_matrix and its host_batch_matrix, as
+//! rocblas_init_device_matrix; matrices with an offset are initialized on the host.
+//!
+template <typename T>
+inline void rocblas_init_device_matrix(device_batch_matrix<T>&   dA,
+                                       host_batch_matrix<T>&     hA,
+                                       const Arguments&          arg,
+                                       rocblas_check_nan_init    nan_init,
+                                       rocblas_check_matrix_type matrix_type,
+                                       bool                      seedReset        = false,
+                                       bool                      alternating_sign = false)
+{
+    rocblas_device_init_kind kind;
+    if(!dA.offset()
+       && rocblas_device_init_kind_of<T>(arg, nan_init, matrix_type, alternating_sign, kind))
+    {
+        if(seedReset)
+            rocblas_seedrand();
+        rocblas_device_init_launch<T>((T* const*)dA.ptr_on_device(),
+                                      0,
+                                      dA.m(),
+                                      dA.n(),
+                                      dA.lda(),
+                                      dA.batch_count(),
+                                      kind,
+                                      matrix_type,
+                                      arg.uplo,
+                                      alternating_sign);
+        if(arg.unit_check || arg.norm_check)
+            CHECK_HIP_ERROR(hA.transfer_from(dA));
+    }
+    else
+    {
+        rocblas_init_matrix(hA, arg, nan_init, matrix_type, seedReset, alternating_sign);
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
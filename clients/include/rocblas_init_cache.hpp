@@ -0,0 +1,313 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*!\file
+ * \brief per-thread cache of the initialized host matrices of rocblas_init_matrix.
+ *
+ * Test cases differing only in alpha, beta or the transposes initialize the same matrices from
+ * the same generator state. The cache keys a matrix by its container type, sizes, the choices
+ * of its initialization and the state of the generator of the calling thread after any seed
+ * reset, so a hit copies exactly the matrix the same initialization made before, and leaves the
+ * generator in the state the initialization left it. The cache holds up to
+ * ROCBLAS_CLIENT_INIT_CACHE_MB megabytes per thread, by default 1024 in rocblas-test and 0 in
+ * the benchmarks, which initialize each input once.
+ *
+ * When ROCBLAS_CLIENT_INIT_CACHE_DIR is set, the matrices are also written to binary files in that
+ * directory, named by a hash of the same key, and later runs memory-map the files instead of
+ * initializing the matrices again, so that repeated rocblas-bench sweeps with costly
+ * initializations such as hpl or trig_float start immediately.
+ */
+
+#pragma once
+
+#include "rocblas_arguments.hpp"
+#include "rocblas_random.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <list>
+#include <random>
+#include <sstream>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+inline size_t rocblas_init_cache_limit()
+{
+    static const size_t limit = [] {
+#ifdef GOOGLE_TEST
+        double mb = 1024;
+#else
+        double mb = 0;
+#endif
+        const char* env = getenv("ROCBLAS_CLIENT_INIT_CACHE_MB");
+        if(env && *env)
+            mb = atof(env);
+        return size_t(std::max(mb, 0.0) * 1024 * 1024);
+    }();
+    return limit;
+}
+
+inline const std::string& rocblas_init_cache_dir()
+{
+    static const std::string dir = [] {
+        const char* env = getenv("ROCBLAS_CLIENT_INIT_CACHE_DIR");
+        return std::string(env ? env : "");
+    }();
+    return dir;
+}
+
+// Smaller matrices are initialized about as fast as they are looked up
+constexpr size_t ROCBLAS_INIT_CACHE_MIN_ELEMENTS = 4096;
+
+struct rocblas_init_cache_entry
+{
+    std::string       params;
+    rocblas_rng_t     rng_before;
+    int               idx_before;
+    rocblas_rng_t     rng_after;
+    int               idx_after;
+    std::vector<char> data;
+};
+
+// Entries of the calling thread, the most recently used first
+struct rocblas_init_cache
+{
+    std::list<rocblas_init_cache_entry> entries;
+    size_t                              bytes = 0;
+
+    static rocblas_init_cache& get()
+    {
+        static thread_local rocblas_init_cache cache;
+        return cache;
+    }
+};
+
+//!
+//! @brief Lookup of the initialization of a host matrix in the cache, made after the seed is
+//! reset and before the matrix is initialized.
+//!
+template <typename U>
+class rocblas_init_cache_lookup
+{
+    U&            m_A;
+    bool          m_enabled;
+    std::string   m_params;
+    rocblas_rng_t m_rng;
+    int           m_idx;
+
+    // Bytes of the M columns of a batch
+    size_t column_bytes() const
+    {
+        return m_A.m() * sizeof(*m_A[0]);
+    }
+
+    // Copy the M x N elements of each batch from or to consecutive memory
+    void copy_from(const char* src)
+    {
+        for(int64_t b = 0; b < m_A.batch_count(); ++b)
+            for(size_t j = 0; j < m_A.n(); ++j, src += column_bytes())
+                memcpy(m_A[b] + j * m_A.lda(), src, column_bytes());
+    }
+
+    void copy_to(char* dst) const
+    {
+        for(int64_t b = 0; b < m_A.batch_count(); ++b)
+            for(size_t j = 0; j < m_A.n(); ++j, dst += column_bytes())
+                memcpy(dst, m_A[b] + j * m_A.lda(), column_bytes());
+    }
+
+    // The file key is the memory key with the generator state, as text
+    std::string file_key() const
+    {
+        std::ostringstream key;
+        key << m_params << ' ' << m_idx << ' ' << m_rng;
+        return key.str();
+    }
+
+    std::string file_path(const std::string& key) const
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "/%016zx.bin", std::hash<std::string>{}(key));
+        return rocblas_init_cache_dir() + name;
+    }
+
+    //
+    // A file holds the key and the generator state after the initialization on one line each,
+    // then the index after it and the data.
+    //
+    bool load_file()
+    {
+        if(rocblas_init_cache_dir().empty())
+            return false;
+
+        std::string   key = file_key();
+        std::ifstream file(file_path(key), std::ios::binary);
+        std::string   stored_key, rng_after;
+        int           idx_after;
+        if(!std::getline(file, stored_key) || stored_key != key || !std::getline(file, rng_after)
+           || !(file >> idx_after) || file.get() != '\n')
+            return false;
+
+        size_t bytes  = column_bytes() * m_A.n() * m_A.batch_count();
+        size_t offset = size_t(file.tellg());
+        file.seekg(0, std::ios::end);
+        if(size_t(file.tellg()) != offset + bytes)
+            return false;
+
+#ifndef WIN32
+        file.close();
+        int fd = open(file_path(key).c_str(), O_RDONLY);
+        if(fd < 0)
+            return false;
+        void* map = mmap(nullptr, offset + bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if(map == MAP_FAILED)
+            return false;
+        copy_from(static_cast<const char*>(map) + offset);
+        munmap(map, offset + bytes);
+#else
+        std::vector<char> data(bytes);
+        file.seekg(offset);
+        if(!file.read(data.data(), bytes))
+            return false;
+        copy_from(data.data());
+#endif
+
+        std::istringstream(rng_after) >> t_rocblas_rng;
+        t_rocblas_rand_idx = idx_after;
+        return true;
+    }
+
+    void save_file() const
+    {
+        if(rocblas_init_cache_dir().empty())
+            return;
+
+        // Written under a temporary name and renamed, so that no run reads a partial file
+        std::string key  = file_key();
+        std::string path = file_path(key);
+        std::string temp = path + "." + std::to_string(std::random_device{}()) + ".tmp";
+        {
+            std::ofstream     file(temp, std::ios::binary);
+            std::vector<char> data(column_bytes() * m_A.n() * m_A.batch_count());
+            copy_to(data.data());
+            file << key << '\n' << t_rocblas_rng << '\n' << t_rocblas_rand_idx << '\n';
+            file.write(data.data(), data.size());
+            if(!file)
+            {
+                file.close();
+                remove(temp.c_str());
+                return;
+            }
+        }
+        if(rename(temp.c_str(), path.c_str()))
+            remove(temp.c_str());
+    }
+
+public:
+    rocblas_init_cache_lookup(U&                        hA,
+                              const Arguments&          arg,
+                              rocblas_check_nan_init    nan_init,
+                              rocblas_check_matrix_type matrix_type,
+                              bool                      seedReset,
+                              bool                      alternating_sign,
+                              bool                      altInit)
+        : m_A(hA)
+        , m_enabled((rocblas_init_cache_limit() > 0 || !rocblas_init_cache_dir().empty())
+                    && hA.m() * hA.n() * hA.batch_count() >= ROCBLAS_INIT_CACHE_MIN_ELEMENTS)
+        , m_rng(t_rocblas_rng)
+        , m_idx(t_rocblas_rand_idx)
+    {
+        if(!m_enabled)
+            return;
+
+        bool nan = (nan_init == rocblas_client_alpha_sets_nan && rocblas_isnan(arg.alpha))
+                   || (nan_init == rocblas_client_beta_sets_nan && rocblas_isnan(arg.beta));
+        m_params = std::string(typeid(U).name()) + ' ' + std::to_string(hA.m()) + ' '
+                   + std::to_string(hA.n()) + ' ' + std::to_string(hA.lda()) + ' '
+                   + std::to_string(hA.batch_count()) + ' ' + std::to_string(nan) + ' '
+                   + std::to_string(int(arg.initialization)) + ' ' + std::to_string(matrix_type)
+                   + ' ' + arg.uplo + ' ' + std::to_string(seedReset)
+                   + std::to_string(alternating_sign) + std::to_string(altInit);
+    }
+
+    //!
+    //! @brief Copy the cached matrix into hA and restore the generator state after it, from memory
+    //! or else from the cache directory.
+    //! @return true if the matrix was cached.
+    //!
+    bool restore()
+    {
+        if(!m_enabled)
+            return false;
+
+        auto& cache = rocblas_init_cache::get();
+        for(auto it = cache.entries.begin(); it != cache.entries.end(); ++it)
+        {
+            if(it->params != m_params || it->idx_before != m_idx || !(it->rng_before == m_rng))
+                continue;
+
+            copy_from(it->data.data());
+            t_rocblas_rng      = it->rng_after;
+            t_rocblas_rand_idx = it->idx_after;
+            cache.entries.splice(cache.entries.begin(), cache.entries, it);
+            return true;
+        }
+        return load_file();
+    }
+
+    //!
+    //! @brief Cache hA as initialized, evicting the least recently used matrices over the limit,
+    //! and write it to the cache directory.
+    //!
+    void store()
+    {
+        if(!m_enabled)
+            return;
+        save_file();
+
+        size_t bytes = column_bytes() * m_A.n() * m_A.batch_count();
+        if(bytes > rocblas_init_cache_limit())
+            return;
+
+        auto& cache = rocblas_init_cache::get();
+        while(!cache.entries.empty() && cache.bytes + bytes > rocblas_init_cache_limit())
+        {
+            cache.bytes -= cache.entries.back().data.size();
+            cache.entries.pop_back();
+        }
+
+        rocblas_init_cache_entry entry{
+            m_params, m_rng, m_idx, t_rocblas_rng, t_rocblas_rand_idx, std::vector<char>(bytes)};
+        copy_to(entry.data.data());
+        cache.entries.push_front(std::move(entry));
+        cache.bytes += bytes;
+    }
+};
@@ -36,6 +36,7 @@
 #include "host_multiple_strided_batch_matrix.hpp"
 #include "host_strided_batch_matrix.hpp"
 #include "rocblas_init.hpp"
+#include "rocblas_init_cache.hpp"
 
 //!
 //! @brief Initialize a host_strided_batch_matrix.
@@ -57,6 +58,11 @@ inline void rocblas_init_matrix(host_strided_batch_matrix<T>& hA,
     if(seedReset)
         rocblas_seedrand();
 
+    rocblas_init_cache_lookup<host_strided_batch_matrix<T>> cached(
+        hA, arg, nan_init, matrix_type, seedReset, alternating_sign, altInit);
+    if(cached.restore())
+        return;
+
     if(nan_init == rocblas_client_alpha_sets_nan && rocblas_isnan(arg.alpha))
     {
         rocblas_init_matrix(matrix_type, arg.uplo, random_nan_generator<T>, hA);
@@ -119,6 +125,8 @@ inline void rocblas_init_matrix(host_strided_batch_matrix<T>& hA,
         rocblas_abort();
 #endif
     }
+
+    cached.store();
 }
 
 //!
@@ -141,6 +149,11 @@ inline void rocblas_init_matrix(host_batch_matrix<T>&     hA,
     if(seedReset)
         rocblas_seedrand();
 
+    rocblas_init_cache_lookup<host_batch_matrix<T>> cached(
+        hA, arg, nan_init, matrix_type, seedReset, alternating_sign, altInit);
+    if(cached.restore())
+        return;
+
     if(nan_init == rocblas_client_alpha_sets_nan && rocblas_isnan(arg.alpha))
     {
         rocblas_init_matrix(matrix_type, arg.uplo, random_nan_generator<T>, hA);
@@ -203,6 +216,8 @@ inline void rocblas_init_matrix(host_batch_matrix<T>&     hA,
         rocblas_abort();
 #endif
     }
+
+    cached.store();
 }
 
 //!
@@ -224,6 +239,11 @@ inline void rocblas_init_matrix(host_matrix<T>&           hA,
     if(seedReset)
         rocblas_seedrand();
 
+    rocblas_init_cache_lookup<host_matrix<T>> cached(
+        hA, arg, nan_init, matrix_type, seedReset, alternating_sign, altInit);
+    if(cached.restore())
+        return;
+
     if(nan_init == rocblas_client_alpha_sets_nan && rocblas_isnan(arg.alpha))
     {
         rocblas_init_matrix(matrix_type, arg.uplo, random_nan_generator<T>, hA);
@@ -286,4 +306,6 @@ inline void rocblas_init_matrix(host_matrix<T>&           hA,
         rocblas_abort();
 #endif
     }
+
+    cached.store();
 }
@@ -341,6 +341,9 @@ public:
 
 bool rocblas_client_global_filters(const Arguments& args);
 
+// Returns false for the cases assigned to other device workers of rocblas-test
+bool rocblas_client_shard_filter(const Arguments& args);
+
 // ----------------------------------------------------------------------------
 // RocBLAS_Test base class. All non-legacy rocBLAS Google tests derive from it.
 // It defines a type_filter_functor() and a PrintToStringParamName class
@@ -362,7 +365,11 @@ protected:
                 return false;
 
             // type filters
-            return static_cast<bool>(FILTER<T...>{});
+            if(!static_cast<bool>(FILTER<T...>{}))
+                return false;
+
+            // sharding across the device workers applied last, to the cases which run
+            return rocblas_client_shard_filter(args);
         }
     };
 
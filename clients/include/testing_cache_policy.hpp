@@ -0,0 +1,143 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "testing_common.hpp"
+
+// Check rocblas_set_cache_policy: unknown bits are rejected, the policy is copied into cloned
+// handles, and axpy, copy and gemv give the same results whether their operands are streamed
+// or not
+
+template <typename T>
+void testing_cache_policy(const Arguments& arg)
+{
+    auto rocblas_axpy_fn = rocblas_axpy<T>;
+    auto rocblas_copy_fn = rocblas_copy<T>;
+    auto rocblas_gemv_fn = rocblas_gemv<T>;
+
+    const uint32_t all_streamed = rocblas_cache_policy_stream_x | rocblas_cache_policy_stream_y
+                                  | rocblas_cache_policy_stream_a;
+
+    rocblas_local_handle handle{arg};
+
+    uint32_t policy = 0;
+    EXPECT_ROCBLAS_STATUS(rocblas_set_cache_policy(nullptr, 0), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_cache_policy(nullptr, &policy),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_cache_policy(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    CHECK_ROCBLAS_ERROR(rocblas_get_cache_policy(handle, &policy));
+    EXPECT_EQ(policy, uint32_t(rocblas_cache_policy_default));
+
+    // Unknown bits leave the policy unchanged
+    CHECK_ROCBLAS_ERROR(rocblas_set_cache_policy(handle, rocblas_cache_policy_stream_x));
+    EXPECT_ROCBLAS_STATUS(rocblas_set_cache_policy(handle, 0x8), rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocblas_set_cache_policy(handle, all_streamed | 0x80000000u),
+                          rocblas_status_invalid_value);
+    CHECK_ROCBLAS_ERROR(rocblas_get_cache_policy(handle, &policy));
+    EXPECT_EQ(policy, uint32_t(rocblas_cache_policy_stream_x));
+
+    // A clone copies the policy, and keeps it when the source changes
+    rocblas_handle clone;
+    uint32_t       clone_policy = 0;
+    CHECK_ROCBLAS_ERROR(rocblas_set_cache_policy(
+        handle, rocblas_cache_policy_stream_y | rocblas_cache_policy_stream_a));
+    CHECK_ROCBLAS_ERROR(rocblas_clone_handle(handle, &clone));
+    CHECK_ROCBLAS_ERROR(rocblas_set_cache_policy(handle, rocblas_cache_policy_default));
+    CHECK_ROCBLAS_ERROR(rocblas_get_cache_policy(clone, &clone_policy));
+    EXPECT_EQ(clone_policy,
+              uint32_t(rocblas_cache_policy_stream_y | rocblas_cache_policy_stream_a));
+    CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(clone));
+
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_int       M      = arg.M;
+    rocblas_int       N      = arg.N;
+    rocblas_int       lda    = arg.lda;
+    rocblas_int       incx   = arg.incx;
+    rocblas_int       incy   = arg.incy;
+
+    if(M <= 0 || N <= 0 || lda < M || incx <= 0 || incy <= 0)
+        return;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    // axpy and copy run on vectors of M * N elements, large enough for the wide kernels
+    int64_t n     = int64_t(M) * N;
+    int64_t len_y = transA == rocblas_operation_none ? M : N;
+
+    host_vector<T> hA(size_t(lda) * N), hx(n * incx), hy(n * incy);
+    host_vector<T> hy_axpy(n * incy), hy_copy(n * incy), hy_gemv(len_y * incy);
+    host_vector<T> hy_result(n * incy);
+
+    device_vector<T> dA(size_t(lda) * N), dx(n * incx), dy(n * incy);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+    rocblas_seedrand();
+    rocblas_init<T>(hA, M, N, lda);
+    rocblas_init<T>(hx, 1, n, incx);
+    rocblas_init<T>(hy, 1, n, incy);
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+
+    // The results of each function with default caching, then with all operands streamed
+    for(uint32_t streamed : {uint32_t(rocblas_cache_policy_default), all_streamed})
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_cache_policy(handle, streamed));
+        bool check = streamed != rocblas_cache_policy_default;
+
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_fn(handle, n, &h_alpha, dx, incx, dy, incy));
+        CHECK_HIP_ERROR(hy_result.transfer_from(dy));
+        if(check)
+            unit_check_general<T>(1, n, incy, hy_axpy, hy_result);
+        else
+            hy_axpy = hy_result;
+
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_ROCBLAS_ERROR(rocblas_copy_fn(handle, n, dx, incx, dy, incy));
+        CHECK_HIP_ERROR(hy_result.transfer_from(dy));
+        if(check)
+            unit_check_general<T>(1, n, incy, hy_copy, hy_result);
+        else
+            hy_copy = hy_result;
+
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_gemv_fn(handle, transA, M, N, &h_alpha, dA, lda, dx, incx, &h_beta, dy, incy));
+        CHECK_HIP_ERROR(hy_result.transfer_from(dy));
+        if(check)
+            unit_check_general<T>(1, len_y, incy, hy_gemv, hy_result);
+        else
+            std::copy(hy_result.begin(), hy_result.begin() + len_y * incy, hy_gemv.begin());
+    }
+
+    // copy is exact, so it is also checked against the host
+    hy_result = hy;
+    for(int64_t i = 0; i < n; i++)
+        hy_result[i * incy] = hx[i * incx];
+    unit_check_general<T>(1, n, incy, hy_result, hy_copy);
+}
@@ -0,0 +1,196 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "testing_common.hpp"
+
+template <typename T>
+void testing_copy_matrix_peer(const Arguments& arg)
+{
+    auto rocblas_copy_matrix_peer_async_fn    = rocblas_copy_matrix_peer_async;
+    auto rocblas_copy_matrix_peer_async_fn_64 = rocblas_copy_matrix_peer_async_64;
+    auto rocblas_copy_matrix_peer_strided_batched_async_fn
+        = rocblas_copy_matrix_peer_strided_batched_async;
+    auto rocblas_copy_matrix_peer_strided_batched_async_fn_64
+        = rocblas_copy_matrix_peer_strided_batched_async_64;
+
+    bool    batched     = !strcmp(arg.function, "copy_matrix_peer_strided_batched");
+    int64_t rows        = arg.M;
+    int64_t cols        = arg.N;
+    int64_t lda         = arg.lda;
+    int64_t ldb         = arg.ldb;
+    int64_t batch_count = batched ? arg.batch_count : 1;
+    int64_t stride_a    = batched ? arg.stride_a : lda * cols;
+    int64_t stride_b    = batched ? arg.stride_b : ldb * cols;
+
+    int device_count = 0;
+    CHECK_HIP_ERROR(hipGetDeviceCount(&device_count));
+    if(device_count < 2)
+    {
+        GTEST_SKIP() << TOO_FEW_DEVICES_PRESENT_STRING;
+        return;
+    }
+
+    auto copy_matrix_peer = [&](const T* a, int src_device, T* b, int dst_device, hipStream_t s) {
+        if(batched)
+            DAPI_CHECK(rocblas_copy_matrix_peer_strided_batched_async_fn,
+                       (rows,
+                        cols,
+                        sizeof(T),
+                        a,
+                        lda,
+                        stride_a,
+                        src_device,
+                        b,
+                        ldb,
+                        stride_b,
+                        dst_device,
+                        batch_count,
+                        s));
+        else
+            DAPI_CHECK(rocblas_copy_matrix_peer_async_fn,
+                       (rows, cols, sizeof(T), a, lda, src_device, b, ldb, dst_device, s));
+    };
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = rows < 0 || cols < 0 || lda <= 0 || ldb <= 0 || lda < rows || ldb < rows
+                        || batch_count < 0;
+    if(invalid_size || !rows || !cols || !batch_count)
+    {
+        rocblas_status status = !rows || !cols || !batch_count ? rocblas_status_success
+                                                               : rocblas_status_invalid_size;
+        if(batched)
+            DAPI_EXPECT(status,
+                        rocblas_copy_matrix_peer_strided_batched_async_fn,
+                        (rows,
+                         cols,
+                         sizeof(T),
+                         nullptr,
+                         lda,
+                         stride_a,
+                         0,
+                         nullptr,
+                         ldb,
+                         stride_b,
+                         1,
+                         batch_count,
+                         0));
+        else
+            DAPI_EXPECT(status,
+                        rocblas_copy_matrix_peer_async_fn,
+                        (rows, cols, sizeof(T), nullptr, lda, 0, nullptr, ldb, 1, 0));
+        return;
+    }
+
+    // The matrices are stride_a and stride_b elements apart, so the buffers include the padding
+    // of the leading dimensions and of the strides
+    size_t size_A = size_t(stride_a) * (batch_count - 1) + size_t(lda) * cols;
+    size_t size_B = size_t(stride_b) * (batch_count - 1) + size_t(ldb) * cols;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(size_A), hB(size_B), hB_init(size_B), hB_gold(size_B);
+    rocblas_seedrand();
+    rocblas_init<T>(hA, 1, size_A, 1);
+    rocblas_init<T>(hB_init, 1, size_B, 1);
+
+    // The padding of B is left as it was
+    hB_gold = hB_init;
+    for(int64_t i3 = 0; i3 < batch_count; i3++)
+        for(int64_t i2 = 0; i2 < cols; i2++)
+            for(int64_t i1 = 0; i1 < rows; i1++)
+                hB_gold[i1 + i2 * ldb + i3 * stride_b] = hA[i1 + i2 * lda + i3 * stride_a];
+
+    int saved_device = 0;
+    CHECK_HIP_ERROR(hipGetDevice(&saved_device));
+
+    // A is on src_device, B and the stream on dst_device
+    auto check_copy = [&](int src_device, int dst_device) {
+        CHECK_HIP_ERROR(hipSetDevice(src_device));
+        device_vector<T> dA(size_A);
+        CHECK_DEVICE_ALLOCATION(dA.memcheck());
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+        CHECK_HIP_ERROR(hipSetDevice(dst_device));
+        device_vector<T> dB(size_B);
+        CHECK_DEVICE_ALLOCATION(dB.memcheck());
+        CHECK_HIP_ERROR(dB.transfer_from(hB_init));
+        hipStream_t stream;
+        CHECK_HIP_ERROR(hipStreamCreate(&stream));
+
+        if(!src_device && !batched)
+        {
+            DAPI_EXPECT(rocblas_status_invalid_pointer,
+                        rocblas_copy_matrix_peer_async_fn,
+                        (rows, cols, sizeof(T), nullptr, lda, src_device, dB, ldb, dst_device, 0));
+            DAPI_EXPECT(rocblas_status_invalid_pointer,
+                        rocblas_copy_matrix_peer_async_fn,
+                        (rows, cols, sizeof(T), dA, lda, src_device, nullptr, ldb, dst_device, 0));
+            DAPI_EXPECT(rocblas_status_invalid_value,
+                        rocblas_copy_matrix_peer_async_fn,
+                        (rows, cols, sizeof(T), dA, lda, -1, dB, ldb, dst_device, 0));
+            DAPI_EXPECT(rocblas_status_invalid_value,
+                        rocblas_copy_matrix_peer_async_fn,
+                        (rows, cols, sizeof(T), dA, lda, src_device, dB, ldb, device_count, 0));
+        }
+
+        copy_matrix_peer(dA, src_device, dB, dst_device, stream);
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        CHECK_HIP_ERROR(hB.transfer_from(dB));
+        unit_check_general<T>(1, size_B, 1, hB_gold, hB);
+
+        // Without peer access the copy goes through the host. Peer access was enabled by the
+        // first copy if the devices support it, so it is disabled for a copy, then restored.
+        int src_to_dst = 0, dst_to_src = 0;
+        CHECK_HIP_ERROR(hipDeviceCanAccessPeer(&src_to_dst, src_device, dst_device));
+        CHECK_HIP_ERROR(hipDeviceCanAccessPeer(&dst_to_src, dst_device, src_device));
+        if(src_to_dst && dst_to_src)
+        {
+            CHECK_HIP_ERROR(hipDeviceDisablePeerAccess(src_device));
+            CHECK_HIP_ERROR(hipSetDevice(src_device));
+            CHECK_HIP_ERROR(hipDeviceDisablePeerAccess(dst_device));
+            CHECK_HIP_ERROR(hipSetDevice(dst_device));
+
+            CHECK_HIP_ERROR(dB.transfer_from(hB_init));
+            copy_matrix_peer(dA, src_device, dB, dst_device, stream);
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+            CHECK_HIP_ERROR(hB.transfer_from(dB));
+            unit_check_general<T>(1, size_B, 1, hB_gold, hB);
+
+            CHECK_HIP_ERROR(hipDeviceEnablePeerAccess(src_device, 0));
+            CHECK_HIP_ERROR(hipSetDevice(src_device));
+            CHECK_HIP_ERROR(hipDeviceEnablePeerAccess(dst_device, 0));
+            CHECK_HIP_ERROR(hipSetDevice(dst_device));
+        }
+
+        CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    };
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        check_copy(0, 1);
+        check_copy(1, 0);
+    }
+
+    CHECK_HIP_ERROR(hipSetDevice(saved_device));
+}
@@ -0,0 +1,315 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// Column major copy, with leading dimension rows, of the rows x cols row major matrix R
+template <typename T>
+host_vector<T>
+    row_major_to_col_major(rocblas_int rows, rocblas_int cols, const T* R, rocblas_int ld)
+{
+    host_vector<T> C(size_t(rows) * cols);
+    for(rocblas_int i = 0; i < rows; i++)
+        for(rocblas_int j = 0; j < cols; j++)
+            C[i + size_t(j) * rows] = R[size_t(i) * ld + j];
+    return C;
+}
+
+// Random rows x cols row major matrix, with leading dimension ld, on the host and the device
+template <typename T>
+void row_major_init(host_vector<T>&   hA,
+                    device_vector<T>& dA,
+                    rocblas_int       rows,
+                    rocblas_int       cols,
+                    rocblas_int       ld)
+{
+    rocblas_init<T>(hA, cols, rows, ld);
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+}
+
+// Compare the rows x cols row major result on the device with the column major reference
+template <typename T>
+void row_major_check(const host_vector<T>&   gold,
+                     const device_vector<T>& dC,
+                     rocblas_int             rows,
+                     rocblas_int             cols,
+                     rocblas_int             ld,
+                     rocblas_int             k)
+{
+    host_vector<T> hC(size_t(rows) * ld);
+    CHECK_HIP_ERROR(hC.transfer_from(dC));
+    host_vector<T> cC = row_major_to_col_major<T>(rows, cols, hC, ld);
+    near_check_general<T>(rows, cols, rows, gold, cC, std::max(k, 1) * sum_error_tolerance<T>);
+}
+
+// Check the functions of rocblas_set_order: each call on row major matrices must give the
+// result of its reference on the column major copies of the same matrices
+template <typename T>
+void testing_row_major_order(const Arguments& arg)
+{
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+    rocblas_fill      uplo   = char2rocblas_fill(arg.uplo);
+    rocblas_side      side   = char2rocblas_side(arg.side);
+
+    rocblas_int M = arg.M;
+    rocblas_int N = arg.N;
+    rocblas_int K = arg.K;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    rocblas_local_handle handle{arg};
+
+    rocblas_order order = rocblas_order_column_major;
+    CHECK_ROCBLAS_ERROR(rocblas_get_order(handle, &order));
+    EXPECT_EQ(rocblas_order_column_major, order);
+    CHECK_ROCBLAS_ERROR(rocblas_set_order(handle, rocblas_order_row_major));
+    CHECK_ROCBLAS_ERROR(rocblas_get_order(handle, &order));
+    EXPECT_EQ(rocblas_order_row_major, order);
+
+    // op(A) is M x K and op(B) is K x N; the leading dimensions of the row major matrices,
+    // the strides between their rows, are padded
+    rocblas_int A_row = transA == rocblas_operation_none ? M : K;
+    rocblas_int A_col = transA == rocblas_operation_none ? K : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? K : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : K;
+    rocblas_int lda   = A_col + 1;
+    rocblas_int ldb   = B_col + 2;
+    rocblas_int ldc   = N + 3;
+
+    host_vector<T>   hA(size_t(A_row) * lda), hB(size_t(B_row) * ldb), hC(size_t(M) * ldc);
+    device_vector<T> dA(hA.size()), dB(hB.size()), dC(hC.size()), dD(hC.size());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+
+    row_major_init<T>(hA, dA, A_row, A_col, lda);
+    row_major_init<T>(hB, dB, B_row, B_col, ldb);
+    row_major_init<T>(hC, dC, M, N, ldc);
+
+    host_vector<T> cA = row_major_to_col_major<T>(A_row, A_col, hA, lda);
+    host_vector<T> cB = row_major_to_col_major<T>(B_row, B_col, hB, ldb);
+
+    // gemm
+    {
+        host_vector<T> gold = row_major_to_col_major<T>(M, N, hC, ldc);
+        ref_gemm<T>(transA, transB, M, N, K, h_alpha, cA, A_row, cB, B_row, h_beta, gold, M);
+
+        CHECK_ROCBLAS_ERROR(rocblas_gemm<T>(
+            handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+        row_major_check<T>(gold, dC, M, N, ldc, K);
+
+        // gemm_ex writes D = alpha*op(A)*op(B) + beta*C, on the same C
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        rocblas_datatype type = rocblas_type2datatype<T>();
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_ex(handle,
+                                            transA,
+                                            transB,
+                                            M,
+                                            N,
+                                            K,
+                                            &h_alpha,
+                                            dA,
+                                            type,
+                                            lda,
+                                            dB,
+                                            type,
+                                            ldb,
+                                            &h_beta,
+                                            dC,
+                                            type,
+                                            ldc,
+                                            dD,
+                                            type,
+                                            ldc,
+                                            type,
+                                            rocblas_gemm_algo_standard,
+                                            0,
+                                            0));
+        row_major_check<T>(gold, dD, M, N, ldc, K);
+    }
+
+    // geam: C = alpha*op(A) + beta*op(B), with op(A) and op(B) M x N
+    {
+        rocblas_int gA_row = transA == rocblas_operation_none ? M : N;
+        rocblas_int gB_row = transB == rocblas_operation_none ? M : N;
+        rocblas_int gA_col = transA == rocblas_operation_none ? N : M;
+        rocblas_int gB_col = transB == rocblas_operation_none ? N : M;
+        rocblas_int glda = gA_col + 1, gldb = gB_col + 2;
+
+        host_vector<T>   gA(size_t(gA_row) * glda), gB(size_t(gB_row) * gldb);
+        device_vector<T> dgA(gA.size()), dgB(gB.size());
+        CHECK_DEVICE_ALLOCATION(dgA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dgB.memcheck());
+        row_major_init<T>(gA, dgA, gA_row, gA_col, glda);
+        row_major_init<T>(gB, dgB, gB_row, gB_col, gldb);
+
+        host_vector<T> cgA  = row_major_to_col_major<T>(gA_row, gA_col, gA, glda);
+        host_vector<T> cgB  = row_major_to_col_major<T>(gB_row, gB_col, gB, gldb);
+        host_vector<T> gold = row_major_to_col_major<T>(M, N, hC, ldc);
+        ref_geam<T>(transA, transB, M, N, &h_alpha, cgA, gA_row, &h_beta, cgB, gB_row, gold, M);
+
+        CHECK_ROCBLAS_ERROR(rocblas_geam<T>(
+            handle, transA, transB, M, N, &h_alpha, dgA, glda, &h_beta, dgB, gldb, dC, ldc));
+        row_major_check<T>(gold, dC, M, N, ldc, 1);
+    }
+
+    // dgmm: C = A*diag(x) or diag(x)*A, with A M x N
+    {
+        rocblas_int      x_len = side == rocblas_side_left ? M : N;
+        host_vector<T>   hx(x_len), hDA(size_t(M) * ldc);
+        device_vector<T> dx(x_len), dDA(hDA.size());
+        CHECK_DEVICE_ALLOCATION(dx.memcheck());
+        CHECK_DEVICE_ALLOCATION(dDA.memcheck());
+        row_major_init<T>(hx, dx, 1, x_len, x_len);
+        row_major_init<T>(hDA, dDA, M, N, ldc);
+
+        host_vector<T> cDA  = row_major_to_col_major<T>(M, N, hDA, ldc);
+        host_vector<T> gold = cDA;
+        ref_dgmm<T>(side, M, N, cDA, M, hx, 1, gold, M);
+
+        CHECK_ROCBLAS_ERROR(rocblas_dgmm<T>(handle, side, M, N, dDA, ldc, dx, 1, dC, ldc));
+        row_major_check<T>(gold, dC, M, N, ldc, 1);
+    }
+
+    // gemv: y = alpha*op(A)*x + beta*y, with A M x N
+    {
+        rocblas_int vlda  = N + 1;
+        rocblas_int x_len = transA == rocblas_operation_none ? N : M;
+        rocblas_int y_len = transA == rocblas_operation_none ? M : N;
+
+        host_vector<T>   hvA(size_t(M) * vlda), hx(x_len), hy(y_len);
+        device_vector<T> dvA(hvA.size()), dx(x_len), dy(y_len);
+        CHECK_DEVICE_ALLOCATION(dvA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dx.memcheck());
+        CHECK_DEVICE_ALLOCATION(dy.memcheck());
+        row_major_init<T>(hvA, dvA, M, N, vlda);
+        row_major_init<T>(hx, dx, 1, x_len, x_len);
+        row_major_init<T>(hy, dy, 1, y_len, y_len);
+
+        // op(A) = A^H of row major A has no column major equivalent
+        if(rocblas_is_complex<T> && transA == rocblas_operation_conjugate_transpose)
+        {
+            EXPECT_ROCBLAS_STATUS(rocblas_gemv<T>(handle,
+                                                  transA,
+                                                  M,
+                                                  N,
+                                                  &h_alpha,
+                                                  dvA,
+                                                  vlda,
+                                                  dx,
+                                                  1,
+                                                  &h_beta,
+                                                  dy,
+                                                  1),
+                                  rocblas_status_not_implemented);
+        }
+        else
+        {
+            host_vector<T> cvA  = row_major_to_col_major<T>(M, N, hvA, vlda);
+            host_vector<T> gold = hy;
+            ref_gemv<T>(transA, M, N, h_alpha, cvA, M, hx, 1, h_beta, gold, 1);
+
+            CHECK_ROCBLAS_ERROR(rocblas_gemv<T>(
+                handle, transA, M, N, &h_alpha, dvA, vlda, dx, 1, &h_beta, dy, 1));
+            row_major_check<T>(gold, dy, 1, y_len, y_len, x_len);
+        }
+    }
+
+    // syr and syr2k update the uplo triangle of the N x N matrix C
+    {
+        rocblas_int       sldc  = N + 1;
+        rocblas_operation trans = transA == rocblas_operation_none ? transA
+                                                                    : rocblas_operation_transpose;
+        rocblas_int       S_row = trans == rocblas_operation_none ? N : K;
+        rocblas_int       S_col = trans == rocblas_operation_none ? K : N;
+
+        host_vector<T>   hS(size_t(N) * sldc), hx(N);
+        device_vector<T> dS(hS.size()), dx(N);
+        CHECK_DEVICE_ALLOCATION(dS.memcheck());
+        CHECK_DEVICE_ALLOCATION(dx.memcheck());
+        row_major_init<T>(hS, dS, N, N, sldc);
+        row_major_init<T>(hx, dx, 1, N, N);
+
+        // syr: A = alpha*x*x^T + A
+        host_vector<T> gold = row_major_to_col_major<T>(N, N, hS, sldc);
+        ref_syr<T>(uplo, N, h_alpha, hx, 1, gold, N);
+
+        CHECK_ROCBLAS_ERROR(rocblas_syr<T>(handle, uplo, N, &h_alpha, dx, 1, dS, sldc));
+        row_major_check<T>(gold, dS, N, N, sldc, 1);
+
+        // syr2k: C = alpha*(op(A)*op(B)^T + op(B)*op(A)^T) + beta*C, on the result of syr
+        host_vector<T>   hA2(size_t(S_row) * (S_col + 1)), hB2(size_t(S_row) * (S_col + 2));
+        device_vector<T> dA2(hA2.size()), dB2(hB2.size());
+        CHECK_DEVICE_ALLOCATION(dA2.memcheck());
+        CHECK_DEVICE_ALLOCATION(dB2.memcheck());
+        row_major_init<T>(hA2, dA2, S_row, S_col, S_col + 1);
+        row_major_init<T>(hB2, dB2, S_row, S_col, S_col + 2);
+
+        host_vector<T> cA2 = row_major_to_col_major<T>(S_row, S_col, hA2, S_col + 1);
+        host_vector<T> cB2 = row_major_to_col_major<T>(S_row, S_col, hB2, S_col + 2);
+        ref_syr2k<T>(uplo, trans, N, K, h_alpha, cA2, S_row, cB2, S_row, h_beta, gold, N);
+
+        CHECK_ROCBLAS_ERROR(rocblas_syr2k<T>(handle,
+                                             uplo,
+                                             trans,
+                                             N,
+                                             K,
+                                             &h_alpha,
+                                             dA2,
+                                             S_col + 1,
+                                             dB2,
+                                             S_col + 2,
+                                             &h_beta,
+                                             dS,
+                                             sldc));
+        row_major_check<T>(gold, dS, N, N, sldc, 2 * K);
+
+        // Hermitian A of row major order is conj(A) of column major order
+        if constexpr(rocblas_is_complex<T>)
+        {
+            EXPECT_ROCBLAS_STATUS(rocblas_hemv<T>(handle,
+                                                  uplo,
+                                                  N,
+                                                  &h_alpha,
+                                                  dS,
+                                                  sldc,
+                                                  dx,
+                                                  1,
+                                                  &h_beta,
+                                                  dx,
+                                                  1),
+                                  rocblas_status_not_implemented);
+        }
+    }
+
+    // the column major order is restored
+    CHECK_ROCBLAS_ERROR(rocblas_set_order(handle, rocblas_order_column_major));
+    CHECK_ROCBLAS_ERROR(rocblas_get_order(handle, &order));
+    EXPECT_EQ(rocblas_order_column_major, order);
+}
@@ -110,6 +110,33 @@ void testing_set_get_matrix_async(const Arguments& arg)
         {
             rocblas_error = norm_check_general<T>('F', rows, cols, ldb, hB, hB_gold);
         }
+
+        // pageable host matrices on the stream of the handle go through its staging buffers,
+        // small enough that the copies are split into chunks
+        if(arg.unit_check)
+        {
+            host_vector<T> hA_pageable(cols * size_t(lda));
+            host_vector<T> hB_pageable(cols * size_t(ldb));
+            for(size_t i = 0; i < hA_pageable.size(); i++)
+                hA_pageable[i] = hA[i];
+
+            size_t staging_size = 0;
+            CHECK_ROCBLAS_ERROR(rocblas_set_pinned_staging_size(handle, 3 * sizeof(T)));
+            CHECK_ROCBLAS_ERROR(rocblas_get_pinned_staging_size(handle, &staging_size));
+            EXPECT_EQ(staging_size, 3 * sizeof(T));
+
+            CHECK_HIP_ERROR(hipMemset(dD, 0, sizeof(T) * cols * ldd));
+            DAPI_CHECK(rocblas_set_matrix_async_fn,
+                       (rows, cols, sizeof(T), hA_pageable, lda, dD, ldd, stream));
+            DAPI_CHECK(rocblas_get_matrix_async_fn,
+                       (rows, cols, sizeof(T), dD, ldd, hB_pageable, ldb, stream));
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+            unit_check_general<T>(rows, cols, ldb, hB_pageable, hB_gold);
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pinned_staging_size(handle, 0));
+            CHECK_ROCBLAS_ERROR(rocblas_get_pinned_staging_size(handle, &staging_size));
+            EXPECT_EQ(staging_size, 0u);
+        }
     }
 
     if(arg.timing)
@@ -123,6 +123,47 @@ auto rocblas_f8_dispatch(const Arguments& arg)
     }
 }
 
+// convert_ex, from the type a_type to the type b_type
+template <template <typename...> class TEST, typename Tx>
+auto rocblas_convert_ex_dispatch_to(const Arguments& arg)
+{
+    switch(arg.b_type)
+    {
+    case rocblas_datatype_f32_r:
+        return TEST<Tx, float>{}(arg);
+    case rocblas_datatype_f16_r:
+        return TEST<Tx, rocblas_half>{}(arg);
+    case rocblas_datatype_bf16_r:
+        return TEST<Tx, rocblas_bfloat16>{}(arg);
+    case rocblas_datatype_f8_r:
+        return TEST<Tx, rocblas_f8>{}(arg);
+    case rocblas_datatype_bf8_r:
+        return TEST<Tx, rocblas_bf8>{}(arg);
+    default:
+        return TEST<void>{}(arg);
+    }
+}
+
+template <template <typename...> class TEST>
+auto rocblas_convert_ex_dispatch(const Arguments& arg)
+{
+    switch(arg.a_type)
+    {
+    case rocblas_datatype_f32_r:
+        return rocblas_convert_ex_dispatch_to<TEST, float>(arg);
+    case rocblas_datatype_f16_r:
+        return rocblas_convert_ex_dispatch_to<TEST, rocblas_half>(arg);
+    case rocblas_datatype_bf16_r:
+        return rocblas_convert_ex_dispatch_to<TEST, rocblas_bfloat16>(arg);
+    case rocblas_datatype_f8_r:
+        return rocblas_convert_ex_dispatch_to<TEST, rocblas_f8>(arg);
+    case rocblas_datatype_bf8_r:
+        return rocblas_convert_ex_dispatch_to<TEST, rocblas_bf8>(arg);
+    default:
+        return TEST<void>{}(arg);
+    }
+}
+
 // BLAS1 functions
 template <template <typename...> class TEST>
 auto rocblas_blas1_dispatch(const Arguments& arg)
@@ -431,6 +472,39 @@ auto rocblas_gemv_batched_and_strided_batched_dispatch(const Arguments& arg)
     return TEST<void, void, void>{}(arg);
 }
 
+// gemv_ex, with the datatypes of A, x, y and the computation in a_type, b_type, c_type and
+// compute_type
+template <template <typename...> class TEST>
+auto rocblas_gemv_ex_dispatch(const Arguments& arg)
+{
+    const auto Ta = arg.a_type, Tx = arg.b_type, Ty = arg.c_type, Tc = arg.compute_type;
+
+    if(Ta == Tx && Tx == Ty && Ty == Tc)
+    {
+        // s, d, c, z precisions
+        if(Ta == rocblas_datatype_f32_r || Ta == rocblas_datatype_f64_r
+           || Ta == rocblas_datatype_f32_c || Ta == rocblas_datatype_f64_c)
+            return rocblas_simple_dispatch<TEST>(arg);
+    }
+    else if(Tc == rocblas_datatype_f32_r)
+    {
+        if(Ta == rocblas_datatype_f16_r && Tx == Ta && Ty == Ta)
+            return TEST<rocblas_half, rocblas_half, rocblas_half, float>{}(arg);
+        else if(Ta == rocblas_datatype_f16_r && Tx == Ta && Ty == Tc)
+            return TEST<rocblas_half, rocblas_half, float, float>{}(arg);
+        else if(Ta == rocblas_datatype_bf16_r && Tx == Ta && Ty == Ta)
+            return TEST<rocblas_bfloat16, rocblas_bfloat16, rocblas_bfloat16, float>{}(arg);
+        else if(Ta == rocblas_datatype_bf16_r && Tx == Ta && Ty == Tc)
+            return TEST<rocblas_bfloat16, rocblas_bfloat16, float, float>{}(arg);
+        else if(Ta == rocblas_datatype_f8_r && Tx == Tc && Ty == Tc)
+            return TEST<rocblas_f8, float, float, float>{}(arg);
+        else if(Ta == rocblas_datatype_bf8_r && Tx == Tc && Ty == Tc)
+            return TEST<rocblas_bf8, float, float, float>{}(arg);
+    }
+
+    return TEST<void>{}(arg);
+}
+
 // gemm functions
 template <template <typename...> class TEST>
 auto rocblas_gemm_dispatch(const Arguments& arg)
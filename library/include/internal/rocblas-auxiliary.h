@@ -39,18 +39,400 @@ extern "C" {
  */
 ROCBLAS_EXPORT rocblas_status rocblas_create_handle(rocblas_handle* handle);
 
+/*! \brief Create handle with the configuration of an existing handle
+    \details
+    The new handle uses the same device as src, and copies its pointer mode, atomics mode, math mode,
+    performance metric, numerical checking and logging configuration, without reading the
+    environment variables or querying the device again. The stream of the new handle is the
+    default stream. Device memory is not shared: the new handle allocates its own device memory on
+    first use, of the size managed by src, or the default size if src uses a user-owned workspace,
+    and its own pinned staging buffers of the size of those of src. The settings which point to
+    device memory of the user, the gemm epilogue, the gemm_ex3 scales and the gemm batch scalars,
+    are not copied.
+    @param[in]
+    src       handle whose configuration is copied
+    @param[out]
+    handle    the new handle
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_clone_handle(rocblas_handle src, rocblas_handle* handle);
+
 /*! \brief Destroy handle
  */
 ROCBLAS_EXPORT rocblas_status rocblas_destroy_handle(rocblas_handle handle);
 
+/*! \brief Create a pool of handles to share among threads
+    \details
+    A handle must not be used by several threads at once. A pool lends handles to threads, so
+    that a thread only holds a handle while it makes rocBLAS calls, and many threads share a
+    bounded number of handles and their device memory. The handles are created on the current
+    device when first needed, up to max_handles, with the configuration of a handle created
+    with rocblas_create_handle. Each has a workspace of workspace_size bytes, or the default
+    device memory size if workspace_size is 0, so that the device memory of the pool is at most
+    max_handles times the workspace size. Tensile solutions and kernels are loaded once per
+    device and shared by all handles.
+    @param[out]
+    pool            the pool
+    @param[in]
+    max_handles     number of handles, at least 1
+    @param[in]
+    workspace_size  size in bytes of the workspace of each handle, or 0 for the default size
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_create_handle_pool(rocblas_handle_pool* pool,
+                                                         rocblas_int          max_handles,
+                                                         size_t               workspace_size);
+
+/*! \brief Destroy a pool of handles
+    \details
+    Returns rocblas_status_invalid_value if a handle of the pool has not been released.
+    @param[in]
+    pool      the pool
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_destroy_handle_pool(rocblas_handle_pool pool);
+
+/*! \brief Borrow a handle from a pool
+    \details
+    The handle enqueues on stream, or on the per-thread default stream of the calling thread
+    (hipStreamPerThread) if stream is 0. A thread is lent the handle it released last when it is
+    available. If all the handles of the pool are lent, waits for one to be released.
+    The workspace of the handle is reused in stream order: work on stream waits for the work
+    enqueued with the handle by its previous borrower, without synchronizing the host.
+    @param[in]
+    pool      the pool
+    @param[in]
+    stream    stream of the handle, or 0 for the per-thread default stream
+    @param[out]
+    handle    the borrowed handle
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_handle_pool_acquire(rocblas_handle_pool pool,
+                                                          hipStream_t         stream,
+                                                          rocblas_handle*     handle);
+
+/*! \brief Return a borrowed handle to its pool
+    \details
+    The work enqueued with the handle need not have completed. The pointer mode and atomics
+    mode of the handle are reset to the defaults of the pool.
+    @param[in]
+    pool      the pool
+    @param[in]
+    handle    handle borrowed from pool
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_handle_pool_release(rocblas_handle_pool pool,
+                                                          rocblas_handle      handle);
+
 /*! \brief Set stream for handle
+    \details
+    The priority of the stream, as created with hipStreamCreateWithPriority, is the priority of
+    the work of the handle. The streams rocBLAS creates for the work of the handle, such as the
+    streams of asynchronous call groups and of the multi-GPU and host pipelines, are created with
+    the same priority, and work is not spread onto auxiliary streams of lower priority, so that
+    the calls of a handle on a high priority stream do not queue behind lower priority work.
  */
 ROCBLAS_EXPORT rocblas_status rocblas_set_stream(rocblas_handle handle, hipStream_t stream);
 
+/*! \brief Set auxiliary streams for handle
+    \details
+    Attaches count auxiliary streams to the handle. Functions which fall back to independent
+    per-batch work (such as the per-batch paths of gemm_batched_ex3 and gemm_strided_batched_ex3)
+    may spread the batches across the stream of the handle and the auxiliary streams. The auxiliary
+    streams wait for the work previously enqueued on the stream of the handle, and the stream of
+    the handle waits for the auxiliary streams before the function returns, so results are
+    ordered on the stream of the handle as usual.
+    Batches are only spread onto the auxiliary streams whose priority is at least that of the
+    stream of the handle when the function is called.
+    The streams remain owned by the user and must stay valid while attached. A count of 0
+    detaches all auxiliary streams.
+    @param[in]
+    handle    the handle
+    @param[in]
+    count     number of auxiliary streams
+    @param[in]
+    streams   array of count streams
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_set_auxiliary_streams(rocblas_handle     handle,
+                                                            rocblas_int        count,
+                                                            const hipStream_t* streams);
+
+/*! \brief Enable or disable the graph capture audit
+    \details
+    Functions called on a stream which is being captured into a HIP graph do not synchronize
+    the stream. Results returned to host memory in host pointer mode are written when the
+    graph is launched, so the host memory must stay valid until the graph has completed.
+    Paths which have to read device memory on the host before they can continue, such as
+    device pointer mode alpha and beta of Level 3 functions, cannot be captured and return
+    rocblas_status_not_implemented during capture without enqueueing any work.
+    Such paths are recorded by the handle while the stream is being captured. With the audit
+    enabled they are recorded outside of capture as well, so that a workload can be run once
+    without capture to find out what would prevent capturing it. Enabling or disabling the
+    audit clears the recorded paths.
+    @param[in]
+    handle    the handle
+    @param[in]
+    enable    true to record paths outside of capture
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_set_graph_capture_audit(rocblas_handle handle, bool enable);
+
+/*! \brief Get the paths recorded by the graph capture audit
+    \details
+    The paths are described by static strings which remain valid for the life of the process.
+    @param[in]
+    handle    the handle
+    @param[inout]
+    count     on input the number of entries of paths, on output the number of recorded paths
+    @param[out]
+    paths     array which receives up to the input value of count recorded paths. May be
+              nullptr if count is 0.
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_graph_capture_audit(rocblas_handle handle,
+                                                              rocblas_int*   count,
+                                                              const char**   paths);
+
+/*! \brief Begin recording a plan on the handle
+    \details
+    The rocBLAS calls made with the handle until rocblas_plan_end are recorded into a graph
+    instead of being run. While recording, the handle enqueues on a capture stream of its own
+    and uses a workspace owned by the plan, of workspace_size bytes, or the default device memory
+    size of the handle if workspace_size is 0. A call which needs more workspace than the plan
+    has returns rocblas_status_memory_error; the size a chain needs can be found with
+    rocblas_start_device_memory_size_query. Calls which cannot be captured, see
+    rocblas_set_graph_capture_audit, return rocblas_status_not_implemented and make
+    rocblas_plan_end fail. The stream and workspace of the handle must not be changed while
+    recording.
+    @param[in]
+    handle          the handle
+    @param[in]
+    workspace_size  size in bytes of the workspace of the plan, or 0 for the default size
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_plan_begin(rocblas_handle handle, size_t workspace_size);
+
+/*! \brief End recording a plan on the handle
+    \details
+    The stream and workspace of the handle are restored whether or not the plan could be
+    created. Returns rocblas_status_invalid_value if no plan is being recorded on the handle, and
+    rocblas_status_not_implemented if a recorded call could not be captured.
+    @param[in]
+    handle    the handle
+    @param[out]
+    plan      the recorded plan
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_plan_end(rocblas_handle handle, rocblas_plan* plan);
+
+/*! \brief Replay a plan on a stream
+    \details
+    The recorded kernels run with the solutions, launch parameters and workspace chosen when
+    they were recorded, without checking arguments, logging or selecting solutions again.
+    The calls read and write the buffers they were recorded with: to run the chain on new
+    data or with new scalars, update those buffers on the stream before the launch. alpha and
+    beta recorded in rocblas_pointer_mode_device are read from device memory when the plan
+    runs; scalars recorded in rocblas_pointer_mode_host are fixed in the plan. Launches of the
+    same plan share its workspace and must not run concurrently.
+    @param[in]
+    plan      the plan
+    @param[in]
+    stream    stream on the device of the handle the plan was recorded with
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_plan_launch(rocblas_plan plan, hipStream_t stream);
+
+/*! \brief Destroy a plan
+    \details
+    Releases the graph and workspace of the plan, once its launches have completed.
+    @param[in]
+    plan      the plan
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_plan_destroy(rocblas_plan plan);
+
+/*! \brief Enable or disable asynchronous host pointer mode results
+    \details
+    By default asum, nrm2, dot, iamax and iamin in host pointer mode synchronize the stream
+    before returning, so that the result can be read as soon as the call returns. With
+    asynchronous host results enabled, the result is copied to host memory in stream order and
+    the call returns without waiting for it, so that further work can be queued while the
+    reduction completes. The result must not be read before the event returned by
+    rocblas_get_host_results_event has completed. The result should be in pinned host memory,
+    as copies to pageable memory may not return before they complete.
+    @param[in]
+    handle    the handle
+    @param[in]
+    enable    true to return without waiting for host pointer mode results
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_set_async_host_results(rocblas_handle handle, bool enable);
+
+/*! \brief Get the event which completes when the latest host pointer mode results are written
+    \details
+    The event is recorded on the stream of the handle after each copy of results to host memory
+    made with asynchronous host results enabled, and is owned by the handle. It remains valid
+    until the handle is destroyed. Wait for it with hipEventSynchronize, or make another stream
+    wait for it with hipStreamWaitEvent.
+    @param[in]
+    handle    the handle
+    @param[out]
+    event     the host results event
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_host_results_event(rocblas_handle handle,
+                                                             hipEvent_t*    event);
+
+/*! \brief Open an asynchronous call group on the handle
+    \details
+    The rocBLAS calls made with the handle until rocblas_group_end are issued round-robin on
+    num_streams streams of the handle, or 4 streams if num_streams is 0, so that independent
+    calls too small to fill the device run concurrently. The group streams start after the work
+    enqueued on the stream of the handle before the group was opened, and the stream of the
+    handle waits for them when the group is closed. The calls of a group must therefore be
+    independent of each other: a call must not read the output of another call of the group.
+    Calls which use the workspace of the handle run after each other, concurrently with the
+    calls which do not. The stream of the handle cannot be changed while a group is open.
+    @param[in]
+    handle        the handle
+    @param[in]
+    num_streams   number of streams to issue the calls on, or 0 for the default
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_group_begin(rocblas_handle handle, rocblas_int num_streams);
+
+/*! \brief Close the asynchronous call group of the handle
+    \details
+    Makes the stream of the handle wait for the calls issued since rocblas_group_begin, without
+    synchronizing the host. Returns rocblas_status_invalid_value if no group is open.
+    @param[in]
+    handle    the handle
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_group_end(rocblas_handle handle);
+
+/*! \brief Report and clear the results of the asynchronous numerics checks
+    \details
+    With rocblas_check_numerics_mode_async in the check_numerics mode of the handle, the inputs
+    and outputs of its calls are checked on the device without waiting for the checks, and the
+    NaN, zero, infinity and denormal values found accumulate in flags held by the handle until
+    this function is called. It waits for the stream of the handle, reports the flags of the
+    inputs and of the outputs as the other check_numerics flags request, and clears them. The
+    flags are not attributed to the calls which set them. Flags which have not been reported are
+    printed when the handle is destroyed if the info or warn flag is set.
+    @param[in]
+    handle    the handle
+    @return   rocblas_status_check_numerics_fail if rocblas_check_numerics_mode_fail is set and a
+              NaN, infinity or denormal value was found, rocblas_status_not_implemented if the
+              stream is being captured, and rocblas_status_success otherwise
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_check_numerics_status(rocblas_handle handle);
+
+/*! \brief Set online autotuning of GEMM solution selection
+    \details
+    With autotuning enabled, the first time a problem of a Tensile-backed function is seen on a
+    device, up to max_candidates solutions, starting with the predicted one, are timed on the
+    stream of the handle and the fastest is remembered in the solution selection cache, where
+    it is also used by other handles. The call which tunes a problem synchronizes the stream.
+    Problems are only tuned when running them repeatedly gives the same result: strided or
+    non-batched problems whose D does not alias A or B, and does not alias C unless beta is 0.
+    Problems seen while the stream is being captured are not tuned.
+    @param[in]
+    handle          the handle
+    @param[in]
+    max_candidates  maximum number of solutions to time, or 0 or 1 to disable autotuning
+    @param[in]
+    budget_ms       no further candidates are timed once the time spent timing a problem
+                    exceeds budget_ms milliseconds. 0 means no limit.
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_set_autotune(rocblas_handle handle,
+                                                   rocblas_int    max_candidates,
+                                                   float          budget_ms);
+
+/*! \brief Set the library which runs the GEMM problems of Tensile-backed functions
+    \details
+    hipBLASLt is loaded with dlopen when it is first used, and only runs the strided or
+    non-batched problems with f16, bf16, f8 or bf8 inputs, f32 compute and an f16, bf16 or f32
+    output for which its heuristic finds an algorithm fitting in the available workspace, without
+    gemm flags, in the default math mode and while atomics are allowed. All other problems, and
+    all problems when hipBLASLt cannot be loaded, use Tensile.
+
+    With rocblas_gemm_backend_auto, the choice is made per problem shape and arch from the tuning
+    table named by the environment variable ROCBLAS_GEMM_BACKEND_TABLE, a text file with one
+    line per shape:
+
+        arch a_type b_type d_type transA transB M N K batch_count tensile|hipblaslt
+
+    for example "gfx942 f8_r f8_r f32_r N T 4096 4096 4096 1 hipblaslt". Shapes which are not in
+    the table are timed with both libraries the first time they are seen when rocblas_set_autotune
+    enables autotuning, under the same conditions as the autotuning of Tensile solutions, and
+    use Tensile otherwise. The choice of a shape is remembered per device.
+
+    The default backend comes from the environment variable ROCBLAS_GEMM_BACKEND, which may be
+    tensile, hipblaslt or auto.
+    @param[in]
+    handle    the handle
+    @param[in]
+    backend   the backend
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_set_gemm_backend(rocblas_handle       handle,
+                                                       rocblas_gemm_backend backend);
+
+/*! \brief Get the library which runs the GEMM problems of Tensile-backed functions, see
+    rocblas_set_gemm_backend
+    @param[in]
+    handle    the handle
+    @param[out]
+    backend   the backend
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_gemm_backend(rocblas_handle        handle,
+                                                       rocblas_gemm_backend* backend);
+
+/*! \brief Seed the stochastic rounding of gemm_ex3
+    \details
+    With rocblas_gemm_flags_stochastic_rounding, gemm_ex3 derives the seeds of the rounding of
+    A, B and D from a counter-based generator keyed by seed. The counter starts at offset and
+    advances by one per call, so a sequence of calls is reproducible from the seed and offset,
+    and the host cost per call is a few integer operations. A handle which is not seeded draws a
+    random seed on its first use. The environment variables SR_SEED_A, SR_SEED_B and SR_SEED_C,
+    read once per process, still fix the seed of the corresponding matrix for every call.
+    @param[in]
+    handle    the handle
+    @param[in]
+    seed      key of the generator
+    @param[in]
+    offset    counter of the next call
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_set_stochastic_rounding_seed(rocblas_handle handle,
+                                                                   uint64_t       seed,
+                                                                   uint64_t       offset);
+
+/*! \brief Get the stochastic rounding state of gemm_ex3
+    \details
+    Returns rocblas_status_invalid_value if the handle has not been seeded and has not yet used
+    stochastic rounding.
+    @param[in]
+    handle    the handle
+    @param[out]
+    seed      key of the generator
+    @param[out]
+    offset    counter of the next call
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_stochastic_rounding_seed(rocblas_handle handle,
+                                                                   uint64_t*      seed,
+                                                                   uint64_t*      offset);
+
 /*! \brief Get stream [0] from handle
  */
 ROCBLAS_EXPORT rocblas_status rocblas_get_stream(rocblas_handle handle, hipStream_t* stream);
 
+/*! \brief Run the kernels of the handle on a subset of the compute units of the device
+    \details
+    Creates a stream of the handle restricted to the compute units enabled in cu_mask, with
+    hipExtStreamCreateWithCUMask, and enqueues the work of the handle on it, so that the work of
+    the handle and of other streams on the same device do not contend for compute units.
+    Tensile solutions are selected for a device with the number of compute units enabled by
+    the mask, and the kernels of rocBLAS size their grids for it. The work already enqueued
+    with the handle is waited for before the stream changes. The stream of the handle cannot be
+    set while a mask is set; a cu_mask_size of 0 removes the mask and restores the stream the
+    handle had before the first mask was set.
+    @param[in]
+    handle        the handle
+    @param[in]
+    cu_mask_size  number of 32-bit words of cu_mask, or 0 to remove the mask
+    @param[in]
+    cu_mask       bit mask of the compute units to run on, bit i of word j enabling
+                  compute unit 32 * j + i
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_set_cu_mask(rocblas_handle  handle,
+                                                  rocblas_int     cu_mask_size,
+                                                  const uint32_t* cu_mask);
+
 /*! \brief Set rocblas_pointer_mode
  */
 ROCBLAS_EXPORT rocblas_status rocblas_set_pointer_mode(rocblas_handle       handle,
@@ -69,6 +451,11 @@ ROCBLAS_EXPORT rocblas_status rocblas_get_pointer_mode(rocblas_handle        han
  *
  *  Atomic operations can be turned on or off for a handle by calling rocblas_set_atomics_mode.
  *  By default, this is set to `rocblas_atomics_allowed`.
+ *
+ *  With `rocblas_atomics_deterministic`, the results are bit-wise reproducible as with
+ *  `rocblas_atomics_not_allowed`, but the implementations which reduce partial results in a
+ *  fixed order, such as the single kernel reductions of the Level-1 functions, keep using
+ *  atomic operations to synchronize their blocks.
  */
 ROCBLAS_DEPRECATED_MSG(
     "Atomic operations in rocBLAS will be turned off by default in future releases."
@@ -82,6 +469,29 @@ ROCBLAS_EXPORT rocblas_status rocblas_set_atomics_mode(rocblas_handle       hand
 ROCBLAS_EXPORT rocblas_status rocblas_get_atomics_mode(rocblas_handle        handle,
                                                        rocblas_atomics_mode* atomics_mode);
 
+/*! \brief Set the rocblas_cache_policy of a handle
+ *  \details
+ *  Large Level-1 and Level-2 operations read and write operands which are not reused, and
+ *  which evict the data of the kernels around them from the L2 cache and MALL. The operands
+ *  named by policy, a bitwise or of rocblas_cache_policy values, are loaded and stored with
+ *  nontemporal memory accesses by the source kernels which support it: x and y by axpy and
+ *  copy, and A by gemv with rocblas_operation_none. Other kernels, including Tensile gemm
+ *  kernels, are not affected.
+ *
+ *  By default, this is set to `rocblas_cache_policy_default`.
+ *
+ *  @param[in]
+ *  handle  rocblas_handle
+ *  @param[in]
+ *  policy  bitwise or of rocblas_cache_policy values,
+ *          rocblas_status_invalid_value is returned for unknown bits.
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_set_cache_policy(rocblas_handle handle, uint32_t policy);
+
+/*! \brief Get the rocblas_cache_policy of a handle, see rocblas_set_cache_policy
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_cache_policy(rocblas_handle handle, uint32_t* policy);
+
 /*! \brief Set rocblas_math_mode
  */
 ROCBLAS_EXPORT rocblas_status rocblas_set_math_mode(rocblas_handle    handle,
@@ -92,10 +502,154 @@ ROCBLAS_EXPORT rocblas_status rocblas_set_math_mode(rocblas_handle    handle,
 ROCBLAS_EXPORT rocblas_status rocblas_get_math_mode(rocblas_handle     handle,
                                                     rocblas_math_mode* math_mode);
 
+/*! \brief Set the number of slices of rocblas_dgemm_ozaki_math_op
+    \details
+    With rocblas_dgemm_ozaki_math_op, dgemm scales each row of op(A) and column of op(B) by a
+    power of two and splits it into slices of 7-bit integers. The slices are multiplied by
+    int8 gemms with exact int32 accumulation, and the slices*(slices + 1)/2 most significant
+    products are summed in double. More slices give a smaller error, at the cost of more int8
+    gemms: the error of each element is bounded by about
+    2^(-7*slices)*k*max|op(A)[i, :]|*max|op(B)[:, j]|. slices is between 1 and 8, and 7 by
+    default. The scheme needs device memory for slices*(m*k + k*n) int8 values and m*n int32 and
+    double values; dgemm calls for which it is not available are computed as usual.
+    @param[in]
+    handle    [rocblas_handle]
+              the handle of device
+    @param[in]
+    slices    [rocblas_int]
+              the number of slices of each operand
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_set_ozaki_slices(rocblas_handle handle, rocblas_int slices);
+
+/*! \brief Get the number of slices of rocblas_dgemm_ozaki_math_op
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_ozaki_slices(rocblas_handle handle, rocblas_int* slices);
+
+/*! \brief Set the order of the matrices of Level 2 and Level 3 functions
+    \details
+    With rocblas_order_row_major, the matrices passed to the functions below are taken in row
+    major order, with leading dimensions the strides between rows, as with CblasRowMajor. A row
+    major matrix is the transpose of the column major matrix on the same storage, so each call is
+    mapped onto the equivalent column major problem, swapping sides, fills, dimensions and
+    transposes, without moving any data. The log of the call shows the column major problem.
+
+    The order applies to the Level 2 functions gemv, gbmv, symv, sbmv, spmv, ger, syr, syr2, spr,
+    spr2, trmv, trsv, tbmv, tbsv, tpmv and tpsv, to the Level 3 functions gemm, symm, hemm, syrk,
+    herk, syr2k, her2k, syrkx, herkx, trmm, trsm, trtri, geam and dgmm, and to gemm_ex, gemm_ex3,
+    gemmt, geam_ex, gemv_ex, trsv_ex, convert_ex and the gemm and gemv of the fast functions, in
+    their batched, strided_batched and _64 forms. Level 1 functions take vectors and do not
+    depend on it.
+    op(A) = A^H of complex gemv, gbmv, trsv, trmv, tbmv, tbsv, tpmv and tpsv, gerc, and the
+    Hermitian Level 2 functions hemv, hbmv, hpmv, her, her2, hpr and hpr2 have no column major
+    equivalent without conjugating A, and return rocblas_status_not_implemented in row major
+    order, as do the beta Level 2 and Level 3 functions not listed above.
+    @param[in]
+    handle    [rocblas_handle]
+              the handle of device
+    @param[in]
+    order     [rocblas_order]
+              the order of the matrices, rocblas_order_column_major by default
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_set_order(rocblas_handle handle, rocblas_order order);
+
+/*! \brief Get the order of the matrices of Level 2 and Level 3 functions
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_order(rocblas_handle handle, rocblas_order* order);
+
+/*! \brief Get the cumulative counters of the calls made with a handle
+    \details
+    The counters are updated with relaxed atomics by every rocBLAS function called with the
+    handle, from any thread, so they are read while calls are running without synchronizing
+    with them.
+    @param[in]
+    handle    [rocblas_handle]
+              the handle of device
+    @param[out]
+    stats     [rocblas_handle_stats*]
+              the counters of the handle
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_handle_stats(rocblas_handle        handle,
+                                                       rocblas_handle_stats* stats);
+
+/*! \brief Get the number of calls of each rocBLAS function made with a handle
+    \details
+    If functions and calls are NULL, count is an output and is set to the number of functions
+    called with the handle. Otherwise they must point to arrays with at least count elements,
+    which are filled with the names of the functions and their number of calls, and count is
+    set to the number of elements filled in. The names are valid while rocBLAS is loaded.
+    @param[in]
+    handle    [rocblas_handle]
+              the handle of device
+    @param[inout]
+    count     [rocblas_int*]
+              the number of functions
+    @param[out]
+    functions [const char**]
+              the names of the functions, or NULL
+    @param[out]
+    calls     [uint64_t*]
+              the number of calls of each function, or NULL
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_handle_function_calls(rocblas_handle handle,
+                                                                rocblas_int*   count,
+                                                                const char**   functions,
+                                                                uint64_t*      calls);
+
+/*! \brief Reset the counters of a handle, see rocblas_get_handle_stats
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_reset_handle_stats(rocblas_handle handle);
+
 /*! \brief  Indicates whether the pointer is on the host or device.
  */
 ROCBLAS_EXPORT rocblas_pointer_mode rocblas_pointer_to_mode(void* ptr);
 
+/*! \brief Indicates whether the pointer is on the host or device, caching the answer in the handle
+    \details
+    rocblas_pointer_to_mode queries the driver on every call. This function keeps the address
+    ranges of the last 16 allocations it has classified in the handle: a device pointer is cached
+    with the range of its allocation and a host pointer with its page, so pointers into memory
+    seen before are classified without a driver query. The hits and misses of the cache are
+    counted in rocblas_get_handle_stats. The managed memory prefetch of
+    rocblas_set_managed_prefetch classifies the operands it prefetches through the same cache.
+
+    The cache is not told when memory is freed or reallocated. After freeing memory which may
+    have been classified, callers must clear the cache with rocblas_clear_pointer_cache before
+    classifying pointers into memory allocated since, as the new allocation may reuse the
+    addresses with another kind of memory.
+    @param[in]
+    handle    [rocblas_handle]
+              the handle of device
+    @param[in]
+    ptr       [const void*]
+              the pointer to classify
+    @param[out]
+    mode      [rocblas_pointer_mode*]
+              rocblas_pointer_mode_device for device memory, rocblas_pointer_mode_host otherwise
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_pointer_to_mode_cached(rocblas_handle        handle,
+                                                             const void*           ptr,
+                                                             rocblas_pointer_mode* mode);
+
+/*! \brief Clear the address ranges cached by rocblas_pointer_to_mode_cached, which must be done
+    after freeing or reallocating memory the cache may hold
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_clear_pointer_cache(rocblas_handle handle);
+
+/*! \brief Enable or disable the prefetch of managed memory operands
+    \details
+    With the prefetch enabled, the GEMM problems which rocBLAS runs with Tensile prefetch those of
+    their strided matrices which are in managed memory, allocated with hipMallocManaged, to the
+    device of the handle with hipMemPrefetchAsync on its stream before the kernels are launched,
+    instead of migrating them page by page on fault. The operands are classified through the
+    cache of rocblas_pointer_to_mode_cached, which must be cleared as documented there. Disabled
+    by default.
+    @param[in]
+    handle    the handle
+    @param[in]
+    enable    true to prefetch managed memory operands
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_set_managed_prefetch(rocblas_handle handle, bool enable);
+
 /*! \brief Copy vector from host to device
     @param[in]
     n           [rocblas_int]
@@ -226,6 +780,49 @@ ROCBLAS_EXPORT rocblas_status rocblas_get_matrix_64(int64_t     rows,
                                                     void*       b,
                                                     int64_t     ldb);
 
+/*! \brief Allocate pinned host memory on the NUMA node closest to a device
+    \details
+    Copies between the device and pinned host memory on another NUMA node of a multi-socket
+    host cross the inter-socket link, at a fraction of the bandwidth. The memory is allocated
+    on the node the PCI bus of the device is attached to when it has enough free memory, and
+    on any node otherwise, or if the node of the device is not known. It must be freed with
+    hipHostFree, and can be used as the host memory of the asynchronous copy functions.
+    The pinned staging buffers of the copy functions are allocated the same way.
+    @param[out]
+    ptr         the allocated memory, nullptr if size is 0
+    @param[in]
+    size        size in bytes
+    @param[in]
+    device      the device whose NUMA node the memory is allocated on
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_host_malloc_near_device(void** ptr, size_t size, int device);
+
+/*! \brief Set the size of the pinned host staging buffers of a handle
+    \details
+    hipMemcpy2DAsync with pageable host memory is performed synchronously, so with a non-zero
+    size the calls of rocblas_set_matrix_async and rocblas_get_matrix_async on the stream of the
+    handle copy pageable host matrices in chunks through two pinned buffers of that size,
+    overlapping the host-side memcpy of one chunk with the DMA of the other. The buffers are
+    allocated now, with rocblas_host_malloc_near_device, and freed when the size is changed or
+    the handle is destroyed, once the copies using them have completed. A size of 0, the default,
+    frees them. The default size comes from the environment variable
+    ROCBLAS_PINNED_STAGING_SIZE.
+    @param[in]
+    handle    the handle
+    @param[in]
+    size      size in bytes of each buffer
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_set_pinned_staging_size(rocblas_handle handle, size_t size);
+
+/*! \brief Get the size of the pinned host staging buffers of a handle, see
+    rocblas_set_pinned_staging_size
+    @param[in]
+    handle    the handle
+    @param[out]
+    size      size in bytes of each buffer, 0 without buffers
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_pinned_staging_size(rocblas_handle handle, size_t* size);
+
 /*! \brief Asynchronously copy vector from host to device
      \details
     rocblas_set_vector_async copies a vector from pinned host memory to device memory asynchronously.
@@ -392,8 +989,134 @@ ROCBLAS_EXPORT rocblas_status rocblas_get_matrix_async_64(int64_t     rows,
                                                           int64_t     ldb,
                                                           hipStream_t stream);
 
+/*! \brief Asynchronously copy matrix between devices
+     \details
+    rocblas_copy_matrix_peer_async copies a matrix from the memory of one device to the memory of
+    another device asynchronously. Peer access between the devices is enabled on first use when
+    the devices support it, so that the copy goes over the peer link instead of through the host.
+    @param[in]
+    rows        [rocblas_int]
+                number of rows in matrices
+    @param[in]
+    cols        [rocblas_int]
+                number of columns in matrices
+    @param[in]
+    elem_size   [rocblas_int]
+                number of bytes per element in the matrix
+    @param[in]
+    a           pointer to matrix on device src_device
+    @param[in]
+    lda         [rocblas_int]
+                specifies the leading dimension of A, lda >= rows
+    @param[in]
+    src_device  device of A
+    @param[out]
+    b           pointer to matrix on device dst_device
+    @param[in]
+    ldb         [rocblas_int]
+                specifies the leading dimension of B, ldb >= rows
+    @param[in]
+    dst_device  device of B
+    @param[in]
+    stream      specifies the stream into which this transfer request is queued, on either device
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_copy_matrix_peer_async(rocblas_int rows,
+                                                             rocblas_int cols,
+                                                             rocblas_int elem_size,
+                                                             const void* a,
+                                                             rocblas_int lda,
+                                                             int         src_device,
+                                                             void*       b,
+                                                             rocblas_int ldb,
+                                                             int         dst_device,
+                                                             hipStream_t stream);
+
+ROCBLAS_EXPORT rocblas_status rocblas_copy_matrix_peer_async_64(int64_t     rows,
+                                                                int64_t     cols,
+                                                                int64_t     elem_size,
+                                                                const void* a,
+                                                                int64_t     lda,
+                                                                int         src_device,
+                                                                void*       b,
+                                                                int64_t     ldb,
+                                                                int         dst_device,
+                                                                hipStream_t stream);
+
+/*! \brief Asynchronously copy strided batched matrices between devices
+     \details
+    rocblas_copy_matrix_peer_strided_batched_async copies batch_count matrices, stride_a elements
+    apart in the memory of one device, to matrices stride_b elements apart in the memory of
+    another device asynchronously. When the strides are multiples of the leading dimensions the
+    batch is copied in a single 3D copy.
+    @param[in]
+    rows        [rocblas_int]
+                number of rows in matrices
+    @param[in]
+    cols        [rocblas_int]
+                number of columns in matrices
+    @param[in]
+    elem_size   [rocblas_int]
+                number of bytes per element in the matrix
+    @param[in]
+    a           pointer to the first matrix on device src_device
+    @param[in]
+    lda         [rocblas_int]
+                specifies the leading dimension of A_i, lda >= rows
+    @param[in]
+    stride_a    [rocblas_stride]
+                stride in elements from the start of A_i to the start of A_(i + 1)
+    @param[in]
+    src_device  device of A
+    @param[out]
+    b           pointer to the first matrix on device dst_device
+    @param[in]
+    ldb         [rocblas_int]
+                specifies the leading dimension of B_i, ldb >= rows
+    @param[in]
+    stride_b    [rocblas_stride]
+                stride in elements from the start of B_i to the start of B_(i + 1)
+    @param[in]
+    dst_device  device of B
+    @param[in]
+    batch_count [rocblas_int]
+                number of matrices
+    @param[in]
+    stream      specifies the stream into which this transfer request is queued, on either device
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status
+    rocblas_copy_matrix_peer_strided_batched_async(rocblas_int    rows,
+                                                   rocblas_int    cols,
+                                                   rocblas_int    elem_size,
+                                                   const void*    a,
+                                                   rocblas_int    lda,
+                                                   rocblas_stride stride_a,
+                                                   int            src_device,
+                                                   void*          b,
+                                                   rocblas_int    ldb,
+                                                   rocblas_stride stride_b,
+                                                   int            dst_device,
+                                                   rocblas_int    batch_count,
+                                                   hipStream_t    stream);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_copy_matrix_peer_strided_batched_async_64(int64_t     rows,
+                                                      int64_t     cols,
+                                                      int64_t     elem_size,
+                                                      const void* a,
+                                                      int64_t     lda,
+                                                      int64_t     stride_a,
+                                                      int         src_device,
+                                                      void*       b,
+                                                      int64_t     ldb,
+                                                      int64_t     stride_b,
+                                                      int         dst_device,
+                                                      int64_t     batch_count,
+                                                      hipStream_t stream);
+
 /*******************************************************************************
  * Function to set start/stop event handlers (for internal use only)
+ * Each rocBLAS function called with the handle records startEvent on its stream
+ * before its first operation, and stopEvent after its last one.
  ******************************************************************************/
 ROCBLAS_EXPORT rocblas_status rocblas_set_start_stop_events(rocblas_handle handle,
                                                             hipEvent_t     startEvent,
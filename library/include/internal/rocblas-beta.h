@@ -1053,6 +1053,3626 @@ ROCBLAS_EXPORT rocblas_status rocblas_gemm_batched_ex3(rocblas_handle      handl
                                                        uint32_t            flags);
 //! @}
 
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    gemm_host performs the matrix-matrix operation:
+
+        C = alpha*op( A )*op( B ) + beta*C,
+
+    where A, B and C reside in host memory, so the matrices may be larger than device memory.
+    The matrices are streamed through the device in tiles, overlapping the copy of the next tiles
+    to the device, the computation on the current tiles, and the copy of the previous result tile
+    back to the host, using internal streams which are joined back to the stream of the handle.
+    The tile size is chosen so that the tile buffers fit in the device memory of the handle.
+
+    For the copies to overlap with computation, A, B and C should be in pinned host memory.
+    The operation is asynchronous with respect to the host only when the matrices are pinned.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    transA    [rocblas_operation]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [rocblas_operation]
+              specifies the form of op( B ).
+    @param[in]
+    m         [rocblas_int]
+              number or rows of matrices op( A ) and C.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of matrices op( B ) and C.
+    @param[in]
+    k         [rocblas_int]
+              number of columns of matrix op( A ) and number of rows of matrix op( B ).
+    @param[in]
+    alpha     host pointer specifying the scalar alpha, regardless of the pointer mode.
+    @param[in]
+    A         host pointer storing matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A.
+    @param[in]
+    B         host pointer storing matrix B.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of B.
+    @param[in]
+    beta      host pointer specifying the scalar beta, regardless of the pointer mode.
+    @param[in, out]
+    C         host pointer storing matrix C.
+    @param[in]
+    ldc       [rocblas_int]
+              specifies the leading dimension of C.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sgemm_host(rocblas_handle    handle,
+                                                 rocblas_operation transA,
+                                                 rocblas_operation transB,
+                                                 rocblas_int       m,
+                                                 rocblas_int       n,
+                                                 rocblas_int       k,
+                                                 const float*      alpha,
+                                                 const float*      A,
+                                                 rocblas_int       lda,
+                                                 const float*      B,
+                                                 rocblas_int       ldb,
+                                                 const float*      beta,
+                                                 float*            C,
+                                                 rocblas_int       ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemm_host(rocblas_handle    handle,
+                                                 rocblas_operation transA,
+                                                 rocblas_operation transB,
+                                                 rocblas_int       m,
+                                                 rocblas_int       n,
+                                                 rocblas_int       k,
+                                                 const double*     alpha,
+                                                 const double*     A,
+                                                 rocblas_int       lda,
+                                                 const double*     B,
+                                                 rocblas_int       ldb,
+                                                 const double*     beta,
+                                                 double*           C,
+                                                 rocblas_int       ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgemm_host(rocblas_handle               handle,
+                                                 rocblas_operation            transA,
+                                                 rocblas_operation            transB,
+                                                 rocblas_int                  m,
+                                                 rocblas_int                  n,
+                                                 rocblas_int                  k,
+                                                 const rocblas_float_complex* alpha,
+                                                 const rocblas_float_complex* A,
+                                                 rocblas_int                  lda,
+                                                 const rocblas_float_complex* B,
+                                                 rocblas_int                  ldb,
+                                                 const rocblas_float_complex* beta,
+                                                 rocblas_float_complex*       C,
+                                                 rocblas_int                  ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgemm_host(rocblas_handle                handle,
+                                                 rocblas_operation             transA,
+                                                 rocblas_operation             transB,
+                                                 rocblas_int                   m,
+                                                 rocblas_int                   n,
+                                                 rocblas_int                   k,
+                                                 const rocblas_double_complex* alpha,
+                                                 const rocblas_double_complex* A,
+                                                 rocblas_int                   lda,
+                                                 const rocblas_double_complex* B,
+                                                 rocblas_int                   ldb,
+                                                 const rocblas_double_complex* beta,
+                                                 rocblas_double_complex*       C,
+                                                 rocblas_int                   ldc);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    gemm_mgpu performs the matrix-matrix operation:
+
+        C = alpha*op( A )*op( B ) + beta*C,
+
+    on several devices, one handle per device. A, B and C reside on the device of handles[0].
+    C is split into a 2D grid of blocks, one per device, and each of the other devices copies
+    the panels of A and B its block needs over the peer links in chunks of k, overlapping the
+    copy of the next chunks with the computation on the current ones, then copies its block
+    back to C. The grid is chosen to balance the computation of a block against the copies over
+    a link, so small problems run on the first device alone. The link bandwidth assumed is
+    50 GB/s unless the environment variable ROCBLAS_MGPU_LINK_GBPS gives another.
+
+    The devices must be distinct, and devices which cannot access the memory of the first device
+    are not used. The other devices start after the work enqueued on the stream of handles[0],
+    which waits for them to finish; the streams of the other handles wait for their own copies.
+    Each handle provides the device memory of its device.
+
+    @param[in]
+    handles   host array of num_handles handles, each on a different device.
+    @param[in]
+    num_handles [rocblas_int]
+              number of handles.
+    @param[in]
+    transA    [rocblas_operation]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [rocblas_operation]
+              specifies the form of op( B ).
+    @param[in]
+    m         [rocblas_int]
+              number or rows of matrices op( A ) and C.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of matrices op( B ) and C.
+    @param[in]
+    k         [rocblas_int]
+              number of columns of matrix op( A ) and number of rows of matrix op( B ).
+    @param[in]
+    alpha     host pointer specifying the scalar alpha, regardless of the pointer mode.
+    @param[in]
+    A         pointer storing matrix A on the device of handles[0].
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A.
+    @param[in]
+    B         pointer storing matrix B on the device of handles[0].
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of B.
+    @param[in]
+    beta      host pointer specifying the scalar beta, regardless of the pointer mode.
+    @param[in, out]
+    C         pointer storing matrix C on the device of handles[0].
+    @param[in]
+    ldc       [rocblas_int]
+              specifies the leading dimension of C.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sgemm_mgpu(const rocblas_handle* handles,
+                                                 rocblas_int           num_handles,
+                                                 rocblas_operation     transA,
+                                                 rocblas_operation     transB,
+                                                 rocblas_int           m,
+                                                 rocblas_int           n,
+                                                 rocblas_int           k,
+                                                 const float*          alpha,
+                                                 const float*          A,
+                                                 rocblas_int           lda,
+                                                 const float*          B,
+                                                 rocblas_int           ldb,
+                                                 const float*          beta,
+                                                 float*                C,
+                                                 rocblas_int           ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemm_mgpu(const rocblas_handle* handles,
+                                                 rocblas_int           num_handles,
+                                                 rocblas_operation     transA,
+                                                 rocblas_operation     transB,
+                                                 rocblas_int           m,
+                                                 rocblas_int           n,
+                                                 rocblas_int           k,
+                                                 const double*         alpha,
+                                                 const double*         A,
+                                                 rocblas_int           lda,
+                                                 const double*         B,
+                                                 rocblas_int           ldb,
+                                                 const double*         beta,
+                                                 double*               C,
+                                                 rocblas_int           ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgemm_mgpu(const rocblas_handle*        handles,
+                                                 rocblas_int                  num_handles,
+                                                 rocblas_operation            transA,
+                                                 rocblas_operation            transB,
+                                                 rocblas_int                  m,
+                                                 rocblas_int                  n,
+                                                 rocblas_int                  k,
+                                                 const rocblas_float_complex* alpha,
+                                                 const rocblas_float_complex* A,
+                                                 rocblas_int                  lda,
+                                                 const rocblas_float_complex* B,
+                                                 rocblas_int                  ldb,
+                                                 const rocblas_float_complex* beta,
+                                                 rocblas_float_complex*       C,
+                                                 rocblas_int                  ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgemm_mgpu(const rocblas_handle*         handles,
+                                                 rocblas_int                   num_handles,
+                                                 rocblas_operation             transA,
+                                                 rocblas_operation             transB,
+                                                 rocblas_int                   m,
+                                                 rocblas_int                   n,
+                                                 rocblas_int                   k,
+                                                 const rocblas_double_complex* alpha,
+                                                 const rocblas_double_complex* A,
+                                                 rocblas_int                   lda,
+                                                 const rocblas_double_complex* B,
+                                                 rocblas_int                   ldb,
+                                                 const rocblas_double_complex* beta,
+                                                 rocblas_double_complex*       C,
+                                                 rocblas_int                   ldc);
+//! @}
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    gemm_strided_batched_ex_mgpu performs the strided batched matrix-matrix operations of
+    rocblas_gemm_strided_batched_ex on several devices, one handle per device:
+
+        D_i = alpha*op( A_i )*op( B_i ) + beta*C_i, for i = 1, ..., batch_count.
+
+    A, B, C and D reside on the device of handles[0]. The batch is shared between the devices in
+    proportion to their estimated throughput: the first device computes its share in place, and
+    each of the other devices copies the matrices of its share over the peer link in chunks,
+    overlapping the copies of the next chunk with the computation of the current one, and copies
+    its matrices of D back. The link bandwidth assumed is 50 GB/s unless the environment variable
+    ROCBLAS_MGPU_LINK_GBPS gives another.
+
+    The devices must be distinct, and devices which cannot access the memory of the first device
+    are not used. The other devices start after the work enqueued on the stream of handles[0],
+    which waits for them to finish. Each handle provides the device memory of its device.
+
+    The arguments after num_handles are those of rocblas_gemm_strided_batched_ex, for the handle
+    handles[0].
+
+    @param[in]
+    handles   host array of num_handles handles, each on a different device.
+    @param[in]
+    num_handles [rocblas_int]
+              number of handles.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status
+    rocblas_gemm_strided_batched_ex_mgpu(const rocblas_handle* handles,
+                                         rocblas_int           num_handles,
+                                         rocblas_operation     transA,
+                                         rocblas_operation     transB,
+                                         rocblas_int           m,
+                                         rocblas_int           n,
+                                         rocblas_int           k,
+                                         const void*           alpha,
+                                         const void*           a,
+                                         rocblas_datatype      a_type,
+                                         rocblas_int           lda,
+                                         rocblas_stride        stride_a,
+                                         const void*           b,
+                                         rocblas_datatype      b_type,
+                                         rocblas_int           ldb,
+                                         rocblas_stride        stride_b,
+                                         const void*           beta,
+                                         const void*           c,
+                                         rocblas_datatype      c_type,
+                                         rocblas_int           ldc,
+                                         rocblas_stride        stride_c,
+                                         void*                 d,
+                                         rocblas_datatype      d_type,
+                                         rocblas_int           ldd,
+                                         rocblas_stride        stride_d,
+                                         rocblas_int           batch_count,
+                                         rocblas_datatype      compute_type,
+                                         rocblas_gemm_algo     algo,
+                                         int32_t               solution_index,
+                                         uint32_t              flags);
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    trsm_strided_batched_mgpu solves the strided batched triangular systems of
+    rocblas_Xtrsm_strided_batched on several devices, one handle per device:
+
+        op(A_i)*X_i = alpha*B_i or X_i*op(A_i) = alpha*B_i, for i = 1, ..., batch_count.
+
+    A and B reside on the device of handles[0], and B is overwritten by X. The batch is shared
+    between the devices as in rocblas_gemm_strided_batched_ex_mgpu.
+
+    The arguments after num_handles are those of rocblas_Xtrsm_strided_batched, for the handle
+    handles[0].
+
+    @param[in]
+    handles   host array of num_handles handles, each on a different device.
+    @param[in]
+    num_handles [rocblas_int]
+              number of handles.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_strsm_strided_batched_mgpu(const rocblas_handle* handles,
+                                                                 rocblas_int           num_handles,
+                                                                 rocblas_side          side,
+                                                                 rocblas_fill          uplo,
+                                                                 rocblas_operation     transA,
+                                                                 rocblas_diagonal      diag,
+                                                                 rocblas_int           m,
+                                                                 rocblas_int           n,
+                                                                 const float*          alpha,
+                                                                 const float*          A,
+                                                                 rocblas_int           lda,
+                                                                 rocblas_stride        stride_A,
+                                                                 float*                B,
+                                                                 rocblas_int           ldb,
+                                                                 rocblas_stride        stride_B,
+                                                                 rocblas_int           batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrsm_strided_batched_mgpu(const rocblas_handle* handles,
+                                                                 rocblas_int           num_handles,
+                                                                 rocblas_side          side,
+                                                                 rocblas_fill          uplo,
+                                                                 rocblas_operation     transA,
+                                                                 rocblas_diagonal      diag,
+                                                                 rocblas_int           m,
+                                                                 rocblas_int           n,
+                                                                 const double*         alpha,
+                                                                 const double*         A,
+                                                                 rocblas_int           lda,
+                                                                 rocblas_stride        stride_A,
+                                                                 double*               B,
+                                                                 rocblas_int           ldb,
+                                                                 rocblas_stride        stride_B,
+                                                                 rocblas_int           batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_ctrsm_strided_batched_mgpu(const rocblas_handle*        handles,
+                                       rocblas_int                  num_handles,
+                                       rocblas_side                 side,
+                                       rocblas_fill                 uplo,
+                                       rocblas_operation            transA,
+                                       rocblas_diagonal             diag,
+                                       rocblas_int                  m,
+                                       rocblas_int                  n,
+                                       const rocblas_float_complex* alpha,
+                                       const rocblas_float_complex* A,
+                                       rocblas_int                  lda,
+                                       rocblas_stride               stride_A,
+                                       rocblas_float_complex*       B,
+                                       rocblas_int                  ldb,
+                                       rocblas_stride               stride_B,
+                                       rocblas_int                  batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_ztrsm_strided_batched_mgpu(const rocblas_handle*         handles,
+                                       rocblas_int                   num_handles,
+                                       rocblas_side                  side,
+                                       rocblas_fill                  uplo,
+                                       rocblas_operation             transA,
+                                       rocblas_diagonal              diag,
+                                       rocblas_int                   m,
+                                       rocblas_int                   n,
+                                       const rocblas_double_complex* alpha,
+                                       const rocblas_double_complex* A,
+                                       rocblas_int                   lda,
+                                       rocblas_stride                stride_A,
+                                       rocblas_double_complex*       B,
+                                       rocblas_int                   ldb,
+                                       rocblas_stride                stride_B,
+                                       rocblas_int                   batch_count);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    gemm_ex_prefetch prepares rocBLAS for a future call of gemm_ex or gemm_strided_batched_ex
+    with the given problem, with D equal to C. The solution for the problem is selected and the
+    code objects of its kernels are loaded on a background thread, so that the first call does
+    not load them synchronously when Tensile lazy loading is enabled. The call returns without
+    waiting, and does not enqueue any work on the stream of the handle.
+
+    The parameters correspond to gemm_strided_batched_ex, without the matrices. alpha and beta
+    are host pointers; only their values matter for solution selection. The problem is prefetched
+    with the settings of the handle at the time of the call.
+    rocblas_status_not_implemented is returned for datatype combinations which are not
+    supported for prefetching.
+
+    gemm_ex_prefetch_synchronize waits until all prefetches have completed.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_ex_prefetch(rocblas_handle    handle,
+                                                       rocblas_operation trans_a,
+                                                       rocblas_operation trans_b,
+                                                       rocblas_int       m,
+                                                       rocblas_int       n,
+                                                       rocblas_int       k,
+                                                       const void*       alpha,
+                                                       rocblas_datatype  a_type,
+                                                       rocblas_int       lda,
+                                                       rocblas_stride    stride_a,
+                                                       rocblas_datatype  b_type,
+                                                       rocblas_int       ldb,
+                                                       rocblas_stride    stride_b,
+                                                       const void*       beta,
+                                                       rocblas_datatype  c_type,
+                                                       rocblas_int       ldc,
+                                                       rocblas_stride    stride_c,
+                                                       rocblas_int       batch_count,
+                                                       rocblas_datatype  compute_type,
+                                                       uint32_t          flags);
+
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_ex_prefetch_synchronize(void);
+//! @}
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    set_gemm_epilogue sets an epilogue which gemm_ex and gemm_strided_batched_ex apply to their
+    result, computing
+        D = activation(diag(scale_row)*(alpha*op(A)*op(B) + beta*C)*diag(scale_column) + bias)
+    so that diagonal scaling, bias and activation do not need a separate pass over D. Other functions, including
+    gemm_batched_ex, ignore the epilogue. The epilogue stays set until it is replaced, or
+    cleared by passing a NULL epilogue.
+
+    The bias vector, and the optional aux matrix, have the datatype of D. A row bias is a
+    vector of length m, a column bias a vector of length n. If aux is not NULL, the value before
+    the activation is stored in aux, an m by n matrix with leading dimension ldaux >= m, for use
+    in the backward pass. Batch i uses bias + i*stride_bias and aux + i*stride_aux.
+
+    The optional scale_row and scale_column vectors, of length m and n with the datatype of D,
+    replace a dgmm before or after the gemm: scaling the rows of A, or the columns of B, is
+    scaling the rows, or the columns, of D when beta is zero. Batch i uses
+    scale_row + i*stride_scale_row and scale_column + i*stride_scale_column. Unused members of
+    the epilogue must be zero or NULL.
+
+    Epilogues are supported for real floating point compute types; other compute types return
+    rocblas_status_not_implemented when an epilogue is set.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    epilogue  [const rocblas_gemm_epilogue *]
+              host pointer to the epilogue, which is copied; NULL clears the epilogue.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_gemm_epilogue(rocblas_handle               handle,
+                                                        const rocblas_gemm_epilogue* epilogue);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    set_gemm_ex3_scales sets the quantization scales which gemm_ex3 and
+    gemm_strided_batched_ex3 apply to their result, computing
+        D = scale_d*(alpha*diag(scale_a)*op(A)*op(B)*diag(scale_b) + beta*C)
+    so that inputs quantized to f8 or bf8 with per-channel or per-block scales are dequantized,
+    and D requantized, as the product is accumulated instead of by separate passes.
+
+    scale_a holds one value per block_a consecutive rows of op(A), ceil(m/block_a) values, and
+    scale_b one value per block_b consecutive columns of op(B), ceil(n/block_b) values; a block
+    size of 1 gives per-channel scales. scale_d points to a single value multiplying D, e.g. the
+    reciprocal of the scale of a quantized D. Any of the pointers may be NULL, and batch i uses
+    scale_a + i*stride_scale_a and scale_b + i*stride_scale_b. Scales along k cannot be factored
+    out of the product and are not supported. The scales stay set until they are replaced, or
+    cleared by passing NULL.
+
+    If amax_d is not NULL, each call stores max|D| over all batches in it, computed with an
+    atomic maximum as D is stored rather than by reading D again, as delayed scaling of f8
+    training needs to choose the next scale_d. It may be set with all scales NULL.
+
+    While scales or amax_d are set, gemm_ex3 computes with its source kernels rather than Tensile.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    scales    [const rocblas_gemm_ex3_scales *]
+              host pointer to the scales, which are copied; NULL clears the scales.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_gemm_ex3_scales(rocblas_handle                 handle,
+                                                          const rocblas_gemm_ex3_scales* scales);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    set_gemm_batch_scalars sets arrays of scalars which gemm_batched_ex and
+    gemm_strided_batched_ex use in place of their alpha and beta arguments, batch i computing
+        D_i = alpha[i*stride_alpha]*op(A_i)*op(B_i) + beta[i*stride_beta]*C_i
+    so that batches with different scalars, as in attention or mixture-of-experts layers, do
+    not need a launch each. alpha and beta have the compute type and live in device memory
+    whatever the pointer mode. The alpha and beta arguments of the calls are still checked.
+    The scalars stay set until they are replaced, or cleared by passing NULL.
+
+    While the scalars are set, the rocblas_int interfaces of gemm_batched_ex and
+    gemm_strided_batched_ex compute with their source kernels rather than Tensile, and return
+    rocblas_status_not_implemented for datatypes the source kernels do not support. The 64-bit
+    interfaces ignore the scalars.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    scalars   [const rocblas_gemm_batch_scalars *]
+              host pointer to the scalars, which are copied; NULL clears the scalars.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status
+    rocblas_set_gemm_batch_scalars(rocblas_handle                    handle,
+                                   const rocblas_gemm_batch_scalars* scalars);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    set_gemv_epilogue sets an epilogue which gemv and gemv_strided_batched apply to their
+    result, computing
+        y = activation(alpha*op(A)*x + beta*y + bias + gamma*z)
+    so that a bias, a second axpy term and an activation do not need separate passes over y.
+    Other functions, including gemv_batched, the 64-bit gemv interfaces and gemv_ex, ignore the
+    epilogue. The epilogue stays set until it is replaced, or cleared by passing a NULL
+    epilogue.
+
+    bias, z and gamma have the datatype of y, with gamma read from the matching member of the
+    union. bias is a contiguous vector of the length of y and z a vector of the length of y with
+    increment incz; either may be NULL. Batch i uses bias + i*stride_bias and z + i*stride_z.
+    The activations apply to real datatypes only; complex gemv returns
+    rocblas_status_not_implemented when an activation is set.
+
+    The epilogue is applied as y is stored by the kernels for op(A) = A and for skinny
+    transposed matrices, and by one pass over y otherwise.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    epilogue  [const rocblas_gemv_epilogue *]
+              host pointer to the epilogue, which is copied; NULL clears the epilogue.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_gemv_epilogue(rocblas_handle               handle,
+                                                        const rocblas_gemv_epilogue* epilogue);
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    axpy_dot performs an axpy followed by a dot product with its result, reading each vector
+    once:
+
+        y = alpha*x + y,
+        result = y * z.
+
+    z may be the same vector as y, giving the squared norm of the updated y.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in x, y and z.
+    @param[in]
+    alpha     device pointer or host pointer specifying the scalar alpha.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[inout]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+    @param[in]
+    z         device pointer storing vector z.
+    @param[in]
+    incz      [rocblas_int]
+              specifies the increment for the elements of z.
+    @param[inout]
+    result
+              device pointer or host pointer to store the dot product.
+              return is 0.0 if n <= 0.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_saxpy_dot(rocblas_handle handle,
+                                                rocblas_int    n,
+                                                const float*   alpha,
+                                                const float*   x,
+                                                rocblas_int    incx,
+                                                float*         y,
+                                                rocblas_int    incy,
+                                                const float*   z,
+                                                rocblas_int    incz,
+                                                float*         result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_daxpy_dot(rocblas_handle handle,
+                                                rocblas_int    n,
+                                                const double*  alpha,
+                                                const double*  x,
+                                                rocblas_int    incx,
+                                                double*        y,
+                                                rocblas_int    incy,
+                                                const double*  z,
+                                                rocblas_int    incz,
+                                                double*        result);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    axpby_nrm2 scales and adds two vectors and computes the euclidean norm of the result, reading
+    each vector once:
+
+        y = alpha*x + beta*y,
+        result = ||y||.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in x and y.
+    @param[in]
+    alpha     device pointer or host pointer specifying the scalar alpha.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[in]
+    beta      device pointer or host pointer specifying the scalar beta.
+    @param[inout]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+    @param[inout]
+    result
+              device pointer or host pointer to store the norm.
+              return is 0.0 if n <= 0.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_saxpby_nrm2(rocblas_handle handle,
+                                                  rocblas_int    n,
+                                                  const float*   alpha,
+                                                  const float*   x,
+                                                  rocblas_int    incx,
+                                                  const float*   beta,
+                                                  float*         y,
+                                                  rocblas_int    incy,
+                                                  float*         result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_daxpby_nrm2(rocblas_handle handle,
+                                                  rocblas_int    n,
+                                                  const double*  alpha,
+                                                  const double*  x,
+                                                  rocblas_int    incx,
+                                                  const double*  beta,
+                                                  double*        y,
+                                                  rocblas_int    incy,
+                                                  double*        result);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    dot2 computes two dot products sharing the vector x, reading x once:
+
+        result[0] = x * y,
+        result[1] = x * z.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in x, y and z.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[in]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+    @param[in]
+    z         device pointer storing vector z.
+    @param[in]
+    incz      [rocblas_int]
+              specifies the increment for the elements of z.
+    @param[inout]
+    result
+              device pointer or host pointer to an array of 2 elements to store the dot
+              products. return is 0.0 if n <= 0.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sdot2(rocblas_handle handle,
+                                            rocblas_int    n,
+                                            const float*   x,
+                                            rocblas_int    incx,
+                                            const float*   y,
+                                            rocblas_int    incy,
+                                            const float*   z,
+                                            rocblas_int    incz,
+                                            float*         result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ddot2(rocblas_handle handle,
+                                            rocblas_int    n,
+                                            const double*  x,
+                                            rocblas_int    incx,
+                                            const double*  y,
+                                            rocblas_int    incy,
+                                            const double*  z,
+                                            rocblas_int    incz,
+                                            double*        result);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    normalize_strided_batched divides each vector of a batch by its euclidean norm, in place:
+
+        results[i] = ||x_i||,
+        x_i = x_i / ||x_i||,    for i = 1, ..., batch_count.
+
+    A zero vector is left unchanged. Vectors of up to 1024 elements are normalized by one thread
+    block each, which reads them once and holds them in registers between the reduction and the
+    scaling. Longer vectors are reduced as in nrm2_strided_batched and then scaled in a second
+    pass.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in each x_i.
+    @param[inout]
+    x         device pointer to the first vector x_1.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x_i. incx must be > 0.
+    @param[in]
+    stridex   [rocblas_stride]
+              stride from the start of one vector (x_i) to the next (x_i+1).
+    @param[in]
+    batch_count [rocblas_int]
+              number of vectors in the batch.
+    @param[out]
+    results
+              device pointer or host pointer to the array of batch_count norms, or nullptr if
+              the norms are not needed. The norms are 0.0 if n <= 0 or incx <= 0.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_snormalize_strided_batched(rocblas_handle handle,
+                                                                 rocblas_int    n,
+                                                                 float*         x,
+                                                                 rocblas_int    incx,
+                                                                 rocblas_stride stridex,
+                                                                 rocblas_int    batch_count,
+                                                                 float*         results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dnormalize_strided_batched(rocblas_handle handle,
+                                                                 rocblas_int    n,
+                                                                 double*        x,
+                                                                 rocblas_int    incx,
+                                                                 rocblas_stride stridex,
+                                                                 rocblas_int    batch_count,
+                                                                 double*        results);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_cnormalize_strided_batched(rocblas_handle         handle,
+                                       rocblas_int            n,
+                                       rocblas_float_complex* x,
+                                       rocblas_int            incx,
+                                       rocblas_stride         stridex,
+                                       rocblas_int            batch_count,
+                                       float*                 results);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_znormalize_strided_batched(rocblas_handle          handle,
+                                       rocblas_int             n,
+                                       rocblas_double_complex* x,
+                                       rocblas_int             incx,
+                                       rocblas_stride          stridex,
+                                       rocblas_int             batch_count,
+                                       double*                 results);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    mdot computes the dot products of the vector x with each column of the n by k matrix Y:
+
+        result[j] = x * Y[:, j],  j = 0, ..., k-1.
+
+    x is read once for a group of columns, and all k results are reduced in one launch, as in
+    the projections of Gram-Schmidt orthogonalization.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in x and rows of Y.
+    @param[in]
+    k         [rocblas_int]
+              the number of columns of Y.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[in]
+    Y         device pointer storing matrix Y.
+    @param[in]
+    ldy       [rocblas_int]
+              specifies the leading dimension of Y, ldy >= max(1, n).
+    @param[inout]
+    result
+              device pointer or host pointer to an array of k elements to store the dot
+              products. return is 0.0 if n <= 0.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_smdot(rocblas_handle handle,
+                                            rocblas_int    n,
+                                            rocblas_int    k,
+                                            const float*   x,
+                                            rocblas_int    incx,
+                                            const float*   Y,
+                                            rocblas_int    ldy,
+                                            float*         result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dmdot(rocblas_handle handle,
+                                            rocblas_int    n,
+                                            rocblas_int    k,
+                                            const double*  x,
+                                            rocblas_int    incx,
+                                            const double*  Y,
+                                            rocblas_int    ldy,
+                                            double*        result);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rot_sequence applies the sequence of n - 1 Givens rotations (c[k], s[k]) to the
+    consecutive column pairs of the m by n matrix A, in order k = 0, ..., n - 2:
+
+        [A[:, k], A[:, k+1]] = [c[k]*A[:, k] + s[k]*A[:, k+1], c[k]*A[:, k+1] - s[k]*A[:, k]].
+
+    Each rotation is the one applied by rot to the pair of columns. All rotations are applied
+    in a single launch which keeps the rotated column of each row in a register, so A is read
+    and written once, as in the rotation sequences of QR and SVD iterations.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    m         [rocblas_int]
+              the number of rows of A.
+    @param[in]
+    n         [rocblas_int]
+              the number of columns of A.
+    @param[in]
+    c         device pointer storing the n - 1 cosines of the rotations.
+    @param[in]
+    s         device pointer storing the n - 1 sines of the rotations.
+    @param[inout]
+    A         device pointer storing matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A, lda >= max(1, m).
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_srot_sequence(rocblas_handle handle,
+                                                    rocblas_int    m,
+                                                    rocblas_int    n,
+                                                    const float*   c,
+                                                    const float*   s,
+                                                    float*         A,
+                                                    rocblas_int    lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_drot_sequence(rocblas_handle handle,
+                                                    rocblas_int    m,
+                                                    rocblas_int    n,
+                                                    const double*  c,
+                                                    const double*  s,
+                                                    double*        A,
+                                                    rocblas_int    lda);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    rot_sequence_strided_batched applies the sequence of n - 1 Givens rotations
+    (c_i[k], s_i[k]) to the consecutive column pairs of each m by n matrix A_i, as in
+    rot_sequence, for i = 1, ..., batch_count.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    m         [rocblas_int]
+              the number of rows of each A_i.
+    @param[in]
+    n         [rocblas_int]
+              the number of columns of each A_i.
+    @param[in]
+    c         device pointer storing the n - 1 cosines of the first sequence.
+    @param[in]
+    stride_c  [rocblas_stride]
+              specifies the stride between the cosines of consecutive sequences.
+    @param[in]
+    s         device pointer storing the n - 1 sines of the first sequence.
+    @param[in]
+    stride_s  [rocblas_stride]
+              specifies the stride between the sines of consecutive sequences.
+    @param[inout]
+    A         device pointer storing the first matrix A_1.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of each A_i, lda >= max(1, m).
+    @param[in]
+    stride_A  [rocblas_stride]
+              specifies the stride from the start of one matrix (A_i) and the next one (A_i+1).
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_srot_sequence_strided_batched(rocblas_handle handle,
+                                                                    rocblas_int    m,
+                                                                    rocblas_int    n,
+                                                                    const float*   c,
+                                                                    rocblas_stride stride_c,
+                                                                    const float*   s,
+                                                                    rocblas_stride stride_s,
+                                                                    float*         A,
+                                                                    rocblas_int    lda,
+                                                                    rocblas_stride stride_A,
+                                                                    rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_drot_sequence_strided_batched(rocblas_handle handle,
+                                                                    rocblas_int    m,
+                                                                    rocblas_int    n,
+                                                                    const double*  c,
+                                                                    rocblas_stride stride_c,
+                                                                    const double*  s,
+                                                                    rocblas_stride stride_s,
+                                                                    double*        A,
+                                                                    rocblas_int    lda,
+                                                                    rocblas_stride stride_A,
+                                                                    rocblas_int    batch_count);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    amax_value and amin_value find the first index of the element of minimum or maximum
+    magnitude of a vector x, as iamax and iamin, and also return the magnitude of that element:
+
+        index = iamax(x),  value = |x[index]|  (|real(x[index])| + |imag(x[index])| for complex).
+
+    The value is returned by the same launch, so no separate gather of x[index] is needed.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in x.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x, incx > 0.
+    @param[inout]
+    index
+              device pointer or host pointer to store the 1-based index. Return is 0 if
+              n <= 0 or incx <= 0.
+    @param[inout]
+    value
+              device pointer or host pointer to store the magnitude of x[index]. Return is 0 if
+              n <= 0 or incx <= 0.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_isamax_value(rocblas_handle handle,
+                                                   rocblas_int    n,
+                                                   const float*   x,
+                                                   rocblas_int    incx,
+                                                   rocblas_int*   index,
+                                                   float*         value);
+
+ROCBLAS_EXPORT rocblas_status rocblas_idamax_value(rocblas_handle handle,
+                                                   rocblas_int    n,
+                                                   const double*  x,
+                                                   rocblas_int    incx,
+                                                   rocblas_int*   index,
+                                                   double*        value);
+
+ROCBLAS_EXPORT rocblas_status rocblas_icamax_value(rocblas_handle               handle,
+                                                   rocblas_int                  n,
+                                                   const rocblas_float_complex* x,
+                                                   rocblas_int                  incx,
+                                                   rocblas_int*                 index,
+                                                   float*                       value);
+
+ROCBLAS_EXPORT rocblas_status rocblas_izamax_value(rocblas_handle                handle,
+                                                   rocblas_int                   n,
+                                                   const rocblas_double_complex* x,
+                                                   rocblas_int                   incx,
+                                                   rocblas_int*                  index,
+                                                   double*                       value);
+
+ROCBLAS_EXPORT rocblas_status rocblas_isamin_value(rocblas_handle handle,
+                                                   rocblas_int    n,
+                                                   const float*   x,
+                                                   rocblas_int    incx,
+                                                   rocblas_int*   index,
+                                                   float*         value);
+
+ROCBLAS_EXPORT rocblas_status rocblas_idamin_value(rocblas_handle handle,
+                                                   rocblas_int    n,
+                                                   const double*  x,
+                                                   rocblas_int    incx,
+                                                   rocblas_int*   index,
+                                                   double*        value);
+
+ROCBLAS_EXPORT rocblas_status rocblas_icamin_value(rocblas_handle               handle,
+                                                   rocblas_int                  n,
+                                                   const rocblas_float_complex* x,
+                                                   rocblas_int                  incx,
+                                                   rocblas_int*                 index,
+                                                   float*                       value);
+
+ROCBLAS_EXPORT rocblas_status rocblas_izamin_value(rocblas_handle                handle,
+                                                   rocblas_int                   n,
+                                                   const rocblas_double_complex* x,
+                                                   rocblas_int                   incx,
+                                                   rocblas_int*                  index,
+                                                   double*                       value);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    amax_value_strided_batched and amin_value_strided_batched find the index and magnitude of
+    the element of maximum or minimum magnitude of each vector x_i, as amax_value and
+    amin_value, for i = 1, ..., batch_count, in one launch. With stridex = lda the vectors are
+    the columns of a matrix, as needed for the pivot search of a panel factorization.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in each x_i.
+    @param[in]
+    x         device pointer storing the first vector x_1.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x_i, incx > 0.
+    @param[in]
+    stridex   [rocblas_stride]
+              specifies the stride from the start of one vector (x_i) and the next one (x_i+1).
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch.
+    @param[inout]
+    index
+              device pointer or host pointer to an array of batch_count 1-based indices.
+    @param[inout]
+    value
+              device pointer or host pointer to an array of batch_count magnitudes.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_isamax_value_strided_batched(rocblas_handle handle,
+                                                                   rocblas_int    n,
+                                                                   const float*   x,
+                                                                   rocblas_int    incx,
+                                                                   rocblas_stride stridex,
+                                                                   rocblas_int    batch_count,
+                                                                   rocblas_int*   index,
+                                                                   float*         value);
+
+ROCBLAS_EXPORT rocblas_status rocblas_idamax_value_strided_batched(rocblas_handle handle,
+                                                                   rocblas_int    n,
+                                                                   const double*  x,
+                                                                   rocblas_int    incx,
+                                                                   rocblas_stride stridex,
+                                                                   rocblas_int    batch_count,
+                                                                   rocblas_int*   index,
+                                                                   double*        value);
+
+ROCBLAS_EXPORT rocblas_status rocblas_icamax_value_strided_batched(rocblas_handle               handle,
+                                                                   rocblas_int                  n,
+                                                                   const rocblas_float_complex* x,
+                                                                   rocblas_int incx,
+                                                                   rocblas_stride stridex,
+                                                                   rocblas_int batch_count,
+                                                                   rocblas_int* index,
+                                                                   float* value);
+
+ROCBLAS_EXPORT rocblas_status rocblas_izamax_value_strided_batched(rocblas_handle                handle,
+                                                                   rocblas_int                   n,
+                                                                   const rocblas_double_complex* x,
+                                                                   rocblas_int incx,
+                                                                   rocblas_stride stridex,
+                                                                   rocblas_int batch_count,
+                                                                   rocblas_int* index,
+                                                                   double* value);
+
+ROCBLAS_EXPORT rocblas_status rocblas_isamin_value_strided_batched(rocblas_handle handle,
+                                                                   rocblas_int    n,
+                                                                   const float*   x,
+                                                                   rocblas_int    incx,
+                                                                   rocblas_stride stridex,
+                                                                   rocblas_int    batch_count,
+                                                                   rocblas_int*   index,
+                                                                   float*         value);
+
+ROCBLAS_EXPORT rocblas_status rocblas_idamin_value_strided_batched(rocblas_handle handle,
+                                                                   rocblas_int    n,
+                                                                   const double*  x,
+                                                                   rocblas_int    incx,
+                                                                   rocblas_stride stridex,
+                                                                   rocblas_int    batch_count,
+                                                                   rocblas_int*   index,
+                                                                   double*        value);
+
+ROCBLAS_EXPORT rocblas_status rocblas_icamin_value_strided_batched(rocblas_handle               handle,
+                                                                   rocblas_int                  n,
+                                                                   const rocblas_float_complex* x,
+                                                                   rocblas_int incx,
+                                                                   rocblas_stride stridex,
+                                                                   rocblas_int batch_count,
+                                                                   rocblas_int* index,
+                                                                   float* value);
+
+ROCBLAS_EXPORT rocblas_status rocblas_izamin_value_strided_batched(rocblas_handle                handle,
+                                                                   rocblas_int                   n,
+                                                                   const rocblas_double_complex* x,
+                                                                   rocblas_int incx,
+                                                                   rocblas_stride stridex,
+                                                                   rocblas_int batch_count,
+                                                                   rocblas_int* index,
+                                                                   double* value);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    gemv_multi applies one matrix to k vectors:
+
+        Y[:, j] = alpha * op( A ) * X[:, j] + beta * Y[:, j],  j = 0, ..., k-1,
+
+        where alpha and beta are scalars, A is an m by n matrix, X holds the k vectors as
+        columns and op( A ) is one of
+
+        op( A ) = A      or
+        op( A ) = A**T   or
+        op( A ) = A**H.
+
+    Each element of A is loaded once for a group of up to 8 vectors instead of once per
+    vector, as in block-Krylov methods.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    transA    [rocblas_operation]
+              indicates whether matrix A is transposed (conjugated) or not.
+    @param[in]
+    m         [rocblas_int]
+              number of rows of matrix A.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of matrix A.
+    @param[in]
+    k         [rocblas_int]
+              number of vectors in X and Y.
+    @param[in]
+    alpha     device pointer or host pointer to scalar alpha.
+    @param[in]
+    A         device pointer storing matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A, lda >= max(1, m).
+    @param[in]
+    X         device pointer storing the vectors x as the columns of X.
+    @param[in]
+    ldx       [rocblas_int]
+              specifies the leading dimension of X,
+              ldx >= max(1, n) if transA == rocblas_operation_none, otherwise ldx >= max(1, m).
+    @param[in]
+    beta      device pointer or host pointer to scalar beta.
+    @param[inout]
+    Y         device pointer storing the vectors y as the columns of Y.
+    @param[in]
+    ldy       [rocblas_int]
+              specifies the leading dimension of Y,
+              ldy >= max(1, m) if transA == rocblas_operation_none, otherwise ldy >= max(1, n).
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sgemv_multi(rocblas_handle    handle,
+                                                  rocblas_operation transA,
+                                                  rocblas_int       m,
+                                                  rocblas_int       n,
+                                                  rocblas_int       k,
+                                                  const float*      alpha,
+                                                  const float*      A,
+                                                  rocblas_int       lda,
+                                                  const float*      X,
+                                                  rocblas_int       ldx,
+                                                  const float*      beta,
+                                                  float*            Y,
+                                                  rocblas_int       ldy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemv_multi(rocblas_handle    handle,
+                                                  rocblas_operation transA,
+                                                  rocblas_int       m,
+                                                  rocblas_int       n,
+                                                  rocblas_int       k,
+                                                  const double*     alpha,
+                                                  const double*     A,
+                                                  rocblas_int       lda,
+                                                  const double*     X,
+                                                  rocblas_int       ldx,
+                                                  const double*     beta,
+                                                  double*           Y,
+                                                  rocblas_int       ldy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgemv_multi(rocblas_handle               handle,
+                                                  rocblas_operation            transA,
+                                                  rocblas_int                  m,
+                                                  rocblas_int                  n,
+                                                  rocblas_int                  k,
+                                                  const rocblas_float_complex* alpha,
+                                                  const rocblas_float_complex* A,
+                                                  rocblas_int                  lda,
+                                                  const rocblas_float_complex* X,
+                                                  rocblas_int                  ldx,
+                                                  const rocblas_float_complex* beta,
+                                                  rocblas_float_complex*       Y,
+                                                  rocblas_int                  ldy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgemv_multi(rocblas_handle                handle,
+                                                  rocblas_operation             transA,
+                                                  rocblas_int                   m,
+                                                  rocblas_int                   n,
+                                                  rocblas_int                   k,
+                                                  const rocblas_double_complex* alpha,
+                                                  const rocblas_double_complex* A,
+                                                  rocblas_int                   lda,
+                                                  const rocblas_double_complex* X,
+                                                  rocblas_int                   ldx,
+                                                  const rocblas_double_complex* beta,
+                                                  rocblas_double_complex*       Y,
+                                                  rocblas_int                   ldy);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    trsm_invA computes the inverses of the diagonal blocks of a triangular matrix A once,
+    in the layout taken by the invA argument of rocblas_trsm_ex and rocblas_trsv_ex:
+
+        invA holds the inverses of the ROCBLAS_TRSM_NB by ROCBLAS_TRSM_NB diagonal blocks of A,
+        stored one after the other, followed by the inverse of the remaining diagonal block.
+
+    Passing invA to later rocblas_trsm_ex and rocblas_trsv_ex calls with the same A reduces each
+    of these solves to a sequence of gemm or gemv products, without inverting the diagonal
+    blocks again.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              rocblas_fill_upper:  A is an upper triangular matrix.
+              rocblas_fill_lower:  A is a lower triangular matrix.
+    @param[in]
+    diag      [rocblas_diagonal]
+              rocblas_diagonal_unit:     A is assumed to be unit triangular.
+              rocblas_diagonal_non_unit: A is not assumed to be unit triangular.
+    @param[in]
+    k         [rocblas_int]
+              k specifies the order of the matrix A.
+    @param[in]
+    A         device pointer storing matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A, lda >= max(1, k).
+    @param[out]
+    invA      device pointer storing the inverses of the diagonal blocks of A.
+    @param[in]
+    invA_size [rocblas_int]
+              number of elements of invA, invA_size >= ROCBLAS_TRSM_NB * k.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_strsm_invA(rocblas_handle   handle,
+                                                 rocblas_fill     uplo,
+                                                 rocblas_diagonal diag,
+                                                 rocblas_int      k,
+                                                 const float*     A,
+                                                 rocblas_int      lda,
+                                                 float*           invA,
+                                                 rocblas_int      invA_size);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrsm_invA(rocblas_handle   handle,
+                                                 rocblas_fill     uplo,
+                                                 rocblas_diagonal diag,
+                                                 rocblas_int      k,
+                                                 const double*    A,
+                                                 rocblas_int      lda,
+                                                 double*          invA,
+                                                 rocblas_int      invA_size);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ctrsm_invA(rocblas_handle               handle,
+                                                 rocblas_fill                 uplo,
+                                                 rocblas_diagonal             diag,
+                                                 rocblas_int                  k,
+                                                 const rocblas_float_complex* A,
+                                                 rocblas_int                  lda,
+                                                 rocblas_float_complex*       invA,
+                                                 rocblas_int                  invA_size);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ztrsm_invA(rocblas_handle                handle,
+                                                 rocblas_fill                  uplo,
+                                                 rocblas_diagonal              diag,
+                                                 rocblas_int                   k,
+                                                 const rocblas_double_complex* A,
+                                                 rocblas_int                   lda,
+                                                 rocblas_double_complex*       invA,
+                                                 rocblas_int                   invA_size);
+//! @}
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    set_trsm_invA registers with the handle the inverses of the diagonal blocks of a k by k
+    triangular matrix A, as computed by trsm_invA, so that later trsm calls solving with the
+    same A use them instead of inverting the diagonal blocks on every call.
+
+    A trsm call uses a registration when its A, lda, uplo, diag and datatype match it and k is
+    m for rocblas_side_left or n for rocblas_side_right. trsm_ex calls passing their own invA,
+    the batched, strided batched and 64-bit interfaces ignore the registrations.
+
+    The handle keeps the pointers only. invA must stay valid and be recomputed with trsm_invA
+    whenever the triangle of A changes, while it is registered. A registration of the same A,
+    lda, uplo, diag and datatype replaces the previous one.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    type      [rocblas_datatype]
+              datatype of A and invA, one of rocblas_datatype_f32_r, rocblas_datatype_f64_r,
+              rocblas_datatype_f32_c and rocblas_datatype_f64_c.
+    @param[in]
+    uplo      [rocblas_fill]
+              rocblas_fill_upper or rocblas_fill_lower triangle of A.
+    @param[in]
+    diag      [rocblas_diagonal]
+              rocblas_diagonal_unit or rocblas_diagonal_non_unit.
+    @param[in]
+    k         [rocblas_int]
+              k specifies the number of rows and columns of A.
+    @param[in]
+    A         device pointer of the matrix A; NULL clears all registrations of the handle.
+    @param[in]
+    lda       [rocblas_int]
+              lda specifies the leading dimension of A, lda >= max( 1, k ).
+    @param[in]
+    invA      device pointer of the inverses computed by trsm_invA for A; NULL removes the
+              registration of A.
+    @param[in]
+    invA_size [rocblas_int]
+              number of elements of invA, invA_size >= ROCBLAS_TRSM_NB * k.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_trsm_invA(rocblas_handle   handle,
+                                                    rocblas_datatype type,
+                                                    rocblas_fill     uplo,
+                                                    rocblas_diagonal diag,
+                                                    rocblas_int      k,
+                                                    const void*      A,
+                                                    rocblas_int      lda,
+                                                    const void*      invA,
+                                                    rocblas_int      invA_size);
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    ger_multi, geru_multi and gerc_multi apply k rank-1 updates to a matrix at once:
+
+        A := A + alpha * X * Y**T   (ger_multi, geru_multi) or
+        A := A + alpha * X * Y**H   (gerc_multi),
+
+        that is A := A + alpha * x_j * y_j**T (or y_j**H) for j = 0, ..., k-1, where alpha is a
+        scalar, A is an m by n matrix, and the vectors x_j and y_j are the columns of the m by k
+        matrix X and the n by k matrix Y.
+
+    Instead of reading and writing A once per update, as a sequence of ger calls does, the
+    updates are applied as a single rank-k gemm. A single update (k == 1) uses the ger kernels.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    m         [rocblas_int]
+              number of rows of matrix A.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of matrix A.
+    @param[in]
+    k         [rocblas_int]
+              number of rank-1 updates, the number of columns of X and Y.
+    @param[in]
+    alpha     device pointer or host pointer to scalar alpha.
+    @param[in]
+    X         device pointer storing the vectors x_j as the columns of X.
+    @param[in]
+    ldx       [rocblas_int]
+              specifies the leading dimension of X, ldx >= max(1, m).
+    @param[in]
+    Y         device pointer storing the vectors y_j as the columns of Y.
+    @param[in]
+    ldy       [rocblas_int]
+              specifies the leading dimension of Y, ldy >= max(1, n).
+    @param[inout]
+    A         device pointer storing matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A, lda >= max(1, m).
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sger_multi(rocblas_handle handle,
+                                                 rocblas_int    m,
+                                                 rocblas_int    n,
+                                                 rocblas_int    k,
+                                                 const float*   alpha,
+                                                 const float*   X,
+                                                 rocblas_int    ldx,
+                                                 const float*   Y,
+                                                 rocblas_int    ldy,
+                                                 float*         A,
+                                                 rocblas_int    lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dger_multi(rocblas_handle handle,
+                                                 rocblas_int    m,
+                                                 rocblas_int    n,
+                                                 rocblas_int    k,
+                                                 const double*  alpha,
+                                                 const double*  X,
+                                                 rocblas_int    ldx,
+                                                 const double*  Y,
+                                                 rocblas_int    ldy,
+                                                 double*        A,
+                                                 rocblas_int    lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgeru_multi(rocblas_handle               handle,
+                                                  rocblas_int                  m,
+                                                  rocblas_int                  n,
+                                                  rocblas_int                  k,
+                                                  const rocblas_float_complex* alpha,
+                                                  const rocblas_float_complex* X,
+                                                  rocblas_int                  ldx,
+                                                  const rocblas_float_complex* Y,
+                                                  rocblas_int                  ldy,
+                                                  rocblas_float_complex*       A,
+                                                  rocblas_int                  lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgeru_multi(rocblas_handle                handle,
+                                                  rocblas_int                   m,
+                                                  rocblas_int                   n,
+                                                  rocblas_int                   k,
+                                                  const rocblas_double_complex* alpha,
+                                                  const rocblas_double_complex* X,
+                                                  rocblas_int                   ldx,
+                                                  const rocblas_double_complex* Y,
+                                                  rocblas_int                   ldy,
+                                                  rocblas_double_complex*       A,
+                                                  rocblas_int                   lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgerc_multi(rocblas_handle               handle,
+                                                  rocblas_int                  m,
+                                                  rocblas_int                  n,
+                                                  rocblas_int                  k,
+                                                  const rocblas_float_complex* alpha,
+                                                  const rocblas_float_complex* X,
+                                                  rocblas_int                  ldx,
+                                                  const rocblas_float_complex* Y,
+                                                  rocblas_int                  ldy,
+                                                  rocblas_float_complex*       A,
+                                                  rocblas_int                  lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgerc_multi(rocblas_handle                handle,
+                                                  rocblas_int                   m,
+                                                  rocblas_int                   n,
+                                                  rocblas_int                   k,
+                                                  const rocblas_double_complex* alpha,
+                                                  const rocblas_double_complex* X,
+                                                  rocblas_int                   ldx,
+                                                  const rocblas_double_complex* Y,
+                                                  rocblas_int                   ldy,
+                                                  rocblas_double_complex*       A,
+                                                  rocblas_int                   lda);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    syr_multi and her_multi apply k symmetric or Hermitian rank-1 updates to a matrix at once:
+
+        A := A + alpha * X * X**T   (syr_multi) or
+        A := A + alpha * X * X**H   (her_multi, with a real alpha),
+
+        that is A := A + alpha * x_j * x_j**T (or x_j**H) for j = 0, ..., k-1, where A is an
+        n by n symmetric (Hermitian) matrix and the vectors x_j are the columns of the n by k
+        matrix X.
+
+    Instead of reading and writing A once per update, as a sequence of syr or her calls does, the
+    updates are applied as a single rank-k syrk or herk. A single update (k == 1) uses the syr
+    and her kernels.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              triangle of A is updated.
+    @param[in]
+    n         [rocblas_int]
+              the number of rows and columns of matrix A.
+    @param[in]
+    k         [rocblas_int]
+              number of rank-1 updates, the number of columns of X.
+    @param[in]
+    alpha     device pointer or host pointer to scalar alpha.
+    @param[in]
+    X         device pointer storing the vectors x_j as the columns of X.
+    @param[in]
+    ldx       [rocblas_int]
+              specifies the leading dimension of X, ldx >= max(1, n).
+    @param[inout]
+    A         device pointer storing matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A, lda >= max(1, n).
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr_multi(rocblas_handle handle,
+                                                 rocblas_fill   uplo,
+                                                 rocblas_int    n,
+                                                 rocblas_int    k,
+                                                 const float*   alpha,
+                                                 const float*   X,
+                                                 rocblas_int    ldx,
+                                                 float*         A,
+                                                 rocblas_int    lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr_multi(rocblas_handle handle,
+                                                 rocblas_fill   uplo,
+                                                 rocblas_int    n,
+                                                 rocblas_int    k,
+                                                 const double*  alpha,
+                                                 const double*  X,
+                                                 rocblas_int    ldx,
+                                                 double*        A,
+                                                 rocblas_int    lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csyr_multi(rocblas_handle               handle,
+                                                 rocblas_fill                 uplo,
+                                                 rocblas_int                  n,
+                                                 rocblas_int                  k,
+                                                 const rocblas_float_complex* alpha,
+                                                 const rocblas_float_complex* X,
+                                                 rocblas_int                  ldx,
+                                                 rocblas_float_complex*       A,
+                                                 rocblas_int                  lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zsyr_multi(rocblas_handle                handle,
+                                                 rocblas_fill                  uplo,
+                                                 rocblas_int                   n,
+                                                 rocblas_int                   k,
+                                                 const rocblas_double_complex* alpha,
+                                                 const rocblas_double_complex* X,
+                                                 rocblas_int                   ldx,
+                                                 rocblas_double_complex*       A,
+                                                 rocblas_int                   lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cher_multi(rocblas_handle               handle,
+                                                 rocblas_fill                 uplo,
+                                                 rocblas_int                  n,
+                                                 rocblas_int                  k,
+                                                 const float*                 alpha,
+                                                 const rocblas_float_complex* X,
+                                                 rocblas_int                  ldx,
+                                                 rocblas_float_complex*       A,
+                                                 rocblas_int                  lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zher_multi(rocblas_handle                handle,
+                                                 rocblas_fill                  uplo,
+                                                 rocblas_int                   n,
+                                                 rocblas_int                   k,
+                                                 const double*                 alpha,
+                                                 const rocblas_double_complex* X,
+                                                 rocblas_int                   ldx,
+                                                 rocblas_double_complex*       A,
+                                                 rocblas_int                   lda);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    tpttr copies a triangular, symmetric or Hermitian matrix from packed storage AP to the
+    corresponding triangle of full storage A, and trttp copies it back:
+
+        tpttr: A := AP,    trttp: AP := A.
+
+    The strictly opposite triangle of A is not referenced. Unpacking a matrix once allows
+    repeated tpmv, tpsv, spmv or hpmv operations on it to use the full storage trmv, trsv,
+    symv or hemv kernels instead, which read the matrix with coalesced accesses.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              triangle of A is stored in AP.
+    @param[in]
+    n         [rocblas_int]
+              the number of rows and columns of matrix A.
+    @param[in]
+    AP        device pointer storing the packed triangle of A, of at least n * (n + 1) / 2
+              elements. It is an input of tpttr and an output of trttp.
+    @param[in]
+    A         device pointer storing matrix A. It is an output of tpttr and an input of trttp.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A, lda >= max(1, n).
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_stpttr(rocblas_handle handle,
+                                             rocblas_fill   uplo,
+                                             rocblas_int    n,
+                                             const float*   AP,
+                                             float*         A,
+                                             rocblas_int    lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtpttr(rocblas_handle handle,
+                                             rocblas_fill   uplo,
+                                             rocblas_int    n,
+                                             const double*  AP,
+                                             double*        A,
+                                             rocblas_int    lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ctpttr(rocblas_handle               handle,
+                                             rocblas_fill                 uplo,
+                                             rocblas_int                  n,
+                                             const rocblas_float_complex* AP,
+                                             rocblas_float_complex*       A,
+                                             rocblas_int                  lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ztpttr(rocblas_handle                handle,
+                                             rocblas_fill                  uplo,
+                                             rocblas_int                   n,
+                                             const rocblas_double_complex* AP,
+                                             rocblas_double_complex*       A,
+                                             rocblas_int                   lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_strttp(rocblas_handle handle,
+                                             rocblas_fill   uplo,
+                                             rocblas_int    n,
+                                             const float*   A,
+                                             rocblas_int    lda,
+                                             float*         AP);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrttp(rocblas_handle handle,
+                                             rocblas_fill   uplo,
+                                             rocblas_int    n,
+                                             const double*  A,
+                                             rocblas_int    lda,
+                                             double*        AP);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ctrttp(rocblas_handle               handle,
+                                             rocblas_fill                 uplo,
+                                             rocblas_int                  n,
+                                             const rocblas_float_complex* A,
+                                             rocblas_int                  lda,
+                                             rocblas_float_complex*       AP);
+
+ROCBLAS_EXPORT rocblas_status rocblas_ztrttp(rocblas_handle                handle,
+                                             rocblas_fill                  uplo,
+                                             rocblas_int                   n,
+                                             const rocblas_double_complex* A,
+                                             rocblas_int                   lda,
+                                             rocblas_double_complex*       AP);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    tpttr_strided_batched and trttp_strided_batched convert each matrix of a batch between
+    packed storage AP_i and the corresponding triangle of full storage A_i, as tpttr and trttp:
+
+        tpttr: A_i := AP_i,    trttp: AP_i := A_i,    for i = 1, ..., batch_count.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              triangle of each A_i is stored in AP_i.
+    @param[in]
+    n         [rocblas_int]
+              the number of rows and columns of each matrix A_i.
+    @param[in]
+    AP        device pointer to the first packed matrix AP_1, of at least n * (n + 1) / 2
+              elements. It is an input of tpttr and an output of trttp.
+    @param[in]
+    stride_ap [rocblas_stride]
+              stride from the start of one packed matrix (AP_i) to the next (AP_i+1).
+    @param[in]
+    A         device pointer to the first matrix A_1. It is an output of tpttr and an input of
+              trttp.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of each A_i, lda >= max(1, n).
+    @param[in]
+    stride_a  [rocblas_stride]
+              stride from the start of one matrix (A_i) to the next (A_i+1).
+    @param[in]
+    batch_count [rocblas_int]
+              number of matrices in the batch.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_stpttr_strided_batched(rocblas_handle handle,
+                                                             rocblas_fill   uplo,
+                                                             rocblas_int    n,
+                                                             const float*   AP,
+                                                             rocblas_stride stride_ap,
+                                                             float*         A,
+                                                             rocblas_int    lda,
+                                                             rocblas_stride stride_a,
+                                                             rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtpttr_strided_batched(rocblas_handle handle,
+                                                             rocblas_fill   uplo,
+                                                             rocblas_int    n,
+                                                             const double*  AP,
+                                                             rocblas_stride stride_ap,
+                                                             double*        A,
+                                                             rocblas_int    lda,
+                                                             rocblas_stride stride_a,
+                                                             rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_ctpttr_strided_batched(rocblas_handle               handle,
+                                   rocblas_fill                 uplo,
+                                   rocblas_int                  n,
+                                   const rocblas_float_complex* AP,
+                                   rocblas_stride               stride_ap,
+                                   rocblas_float_complex*       A,
+                                   rocblas_int                  lda,
+                                   rocblas_stride               stride_a,
+                                   rocblas_int                  batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_ztpttr_strided_batched(rocblas_handle                handle,
+                                   rocblas_fill                  uplo,
+                                   rocblas_int                   n,
+                                   const rocblas_double_complex* AP,
+                                   rocblas_stride                stride_ap,
+                                   rocblas_double_complex*       A,
+                                   rocblas_int                   lda,
+                                   rocblas_stride                stride_a,
+                                   rocblas_int                   batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_strttp_strided_batched(rocblas_handle handle,
+                                                             rocblas_fill   uplo,
+                                                             rocblas_int    n,
+                                                             const float*   A,
+                                                             rocblas_int    lda,
+                                                             rocblas_stride stride_a,
+                                                             float*         AP,
+                                                             rocblas_stride stride_ap,
+                                                             rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dtrttp_strided_batched(rocblas_handle handle,
+                                                             rocblas_fill   uplo,
+                                                             rocblas_int    n,
+                                                             const double*  A,
+                                                             rocblas_int    lda,
+                                                             rocblas_stride stride_a,
+                                                             double*        AP,
+                                                             rocblas_stride stride_ap,
+                                                             rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_ctrttp_strided_batched(rocblas_handle               handle,
+                                   rocblas_fill                 uplo,
+                                   rocblas_int                  n,
+                                   const rocblas_float_complex* A,
+                                   rocblas_int                  lda,
+                                   rocblas_stride               stride_a,
+                                   rocblas_float_complex*       AP,
+                                   rocblas_stride               stride_ap,
+                                   rocblas_int                  batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_ztrttp_strided_batched(rocblas_handle                handle,
+                                   rocblas_fill                  uplo,
+                                   rocblas_int                   n,
+                                   const rocblas_double_complex* A,
+                                   rocblas_int                   lda,
+                                   rocblas_stride                stride_a,
+                                   rocblas_double_complex*       AP,
+                                   rocblas_stride                stride_ap,
+                                   rocblas_int                   batch_count);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    gbtge_strided_batched copies each m by n band matrix of a batch from band storage AB_i to
+    full storage A_i, writing zeros outside the band, and getgb_strided_batched copies the band
+    of each full matrix A_i to AB_i:
+
+        gbtge: A_i := AB_i,    getgb: AB_i := A_i,    for i = 1, ..., batch_count.
+
+    AB_i is stored as read by gbmv: element (i, j) of the band is in row ku + i - j of column j.
+    The elements of AB_i outside the matrix are not referenced. Triangular, symmetric and
+    Hermitian band matrices as read by tbmv, sbmv and hbmv are converted with kl = 0 and ku = k
+    for an upper triangle stored, and with kl = k and ku = 0 for a lower one.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    m         [rocblas_int]
+              the number of rows of each matrix A_i.
+    @param[in]
+    n         [rocblas_int]
+              the number of columns of each matrix A_i.
+    @param[in]
+    kl        [rocblas_int]
+              the number of sub-diagonals of each A_i, kl >= 0.
+    @param[in]
+    ku        [rocblas_int]
+              the number of super-diagonals of each A_i, ku >= 0.
+    @param[in]
+    AB / A    device pointer to the first source matrix AB_1 of gbtge or A_1 of getgb.
+    @param[in]
+    ldab / lda [rocblas_int]
+              specifies the leading dimension of the source matrices, ldab >= kl + ku + 1 for
+              gbtge and lda >= max(1, m) for getgb.
+    @param[in]
+    stride_ab / stride_a [rocblas_stride]
+              stride from the start of one source matrix to the next.
+    @param[out]
+    A / AB    device pointer to the first destination matrix A_1 of gbtge or AB_1 of getgb.
+    @param[in]
+    lda / ldab [rocblas_int]
+              specifies the leading dimension of the destination matrices, lda >= max(1, m) for
+              gbtge and ldab >= kl + ku + 1 for getgb.
+    @param[in]
+    stride_a / stride_ab [rocblas_stride]
+              stride from the start of one destination matrix to the next.
+    @param[in]
+    batch_count [rocblas_int]
+              number of matrices in the batch.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sgbtge_strided_batched(rocblas_handle handle,
+                                                             rocblas_int    m,
+                                                             rocblas_int    n,
+                                                             rocblas_int    kl,
+                                                             rocblas_int    ku,
+                                                             const float*   AB,
+                                                             rocblas_int    ldab,
+                                                             rocblas_stride stride_ab,
+                                                             float*         A,
+                                                             rocblas_int    lda,
+                                                             rocblas_stride stride_a,
+                                                             rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgbtge_strided_batched(rocblas_handle handle,
+                                                             rocblas_int    m,
+                                                             rocblas_int    n,
+                                                             rocblas_int    kl,
+                                                             rocblas_int    ku,
+                                                             const double*  AB,
+                                                             rocblas_int    ldab,
+                                                             rocblas_stride stride_ab,
+                                                             double*        A,
+                                                             rocblas_int    lda,
+                                                             rocblas_stride stride_a,
+                                                             rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_cgbtge_strided_batched(rocblas_handle               handle,
+                                   rocblas_int                  m,
+                                   rocblas_int                  n,
+                                   rocblas_int                  kl,
+                                   rocblas_int                  ku,
+                                   const rocblas_float_complex* AB,
+                                   rocblas_int                  ldab,
+                                   rocblas_stride               stride_ab,
+                                   rocblas_float_complex*       A,
+                                   rocblas_int                  lda,
+                                   rocblas_stride               stride_a,
+                                   rocblas_int                  batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_zgbtge_strided_batched(rocblas_handle                handle,
+                                   rocblas_int                   m,
+                                   rocblas_int                   n,
+                                   rocblas_int                   kl,
+                                   rocblas_int                   ku,
+                                   const rocblas_double_complex* AB,
+                                   rocblas_int                   ldab,
+                                   rocblas_stride                stride_ab,
+                                   rocblas_double_complex*       A,
+                                   rocblas_int                   lda,
+                                   rocblas_stride                stride_a,
+                                   rocblas_int                   batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sgetgb_strided_batched(rocblas_handle handle,
+                                                             rocblas_int    m,
+                                                             rocblas_int    n,
+                                                             rocblas_int    kl,
+                                                             rocblas_int    ku,
+                                                             const float*   A,
+                                                             rocblas_int    lda,
+                                                             rocblas_stride stride_a,
+                                                             float*         AB,
+                                                             rocblas_int    ldab,
+                                                             rocblas_stride stride_ab,
+                                                             rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgetgb_strided_batched(rocblas_handle handle,
+                                                             rocblas_int    m,
+                                                             rocblas_int    n,
+                                                             rocblas_int    kl,
+                                                             rocblas_int    ku,
+                                                             const double*  A,
+                                                             rocblas_int    lda,
+                                                             rocblas_stride stride_a,
+                                                             double*        AB,
+                                                             rocblas_int    ldab,
+                                                             rocblas_stride stride_ab,
+                                                             rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_cgetgb_strided_batched(rocblas_handle               handle,
+                                   rocblas_int                  m,
+                                   rocblas_int                  n,
+                                   rocblas_int                  kl,
+                                   rocblas_int                  ku,
+                                   const rocblas_float_complex* A,
+                                   rocblas_int                  lda,
+                                   rocblas_stride               stride_a,
+                                   rocblas_float_complex*       AB,
+                                   rocblas_int                  ldab,
+                                   rocblas_stride               stride_ab,
+                                   rocblas_int                  batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_zgetgb_strided_batched(rocblas_handle                handle,
+                                   rocblas_int                   m,
+                                   rocblas_int                   n,
+                                   rocblas_int                   kl,
+                                   rocblas_int                   ku,
+                                   const rocblas_double_complex* A,
+                                   rocblas_int                   lda,
+                                   rocblas_stride                stride_a,
+                                   rocblas_double_complex*       AB,
+                                   rocblas_int                   ldab,
+                                   rocblas_stride                stride_ab,
+                                   rocblas_int                   batch_count);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    symmetrize_strided_batched copies the uplo triangle of each n by n matrix A_i of a batch to
+    the opposite triangle, so that A_i is symmetric, and hermitize_strided_batched copies its
+    conjugate and zeros the imaginary part of the diagonal, so that A_i is Hermitian:
+
+        symmetrize: A_i := tri(A_i) + strict_tri(A_i)**T,
+        hermitize:  A_i := tri(A_i) + strict_tri(A_i)**H,    for i = 1, ..., batch_count.
+
+    A matrix written by syrk, herk or a triangular factorization is completed in this way for
+    routines, such as gemm, which read the full matrix.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              triangle of each A_i is copied to the opposite triangle.
+    @param[in]
+    n         [rocblas_int]
+              the number of rows and columns of each matrix A_i.
+    @param[inout]
+    A         device pointer to the first matrix A_1.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of each A_i, lda >= max(1, n).
+    @param[in]
+    stride_a  [rocblas_stride]
+              stride from the start of one matrix (A_i) to the next (A_i+1).
+    @param[in]
+    batch_count [rocblas_int]
+              number of matrices in the batch.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_ssymmetrize_strided_batched(rocblas_handle handle,
+                                                                  rocblas_fill   uplo,
+                                                                  rocblas_int    n,
+                                                                  float*         A,
+                                                                  rocblas_int    lda,
+                                                                  rocblas_stride stride_a,
+                                                                  rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsymmetrize_strided_batched(rocblas_handle handle,
+                                                                  rocblas_fill   uplo,
+                                                                  rocblas_int    n,
+                                                                  double*        A,
+                                                                  rocblas_int    lda,
+                                                                  rocblas_stride stride_a,
+                                                                  rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_csymmetrize_strided_batched(rocblas_handle         handle,
+                                        rocblas_fill           uplo,
+                                        rocblas_int            n,
+                                        rocblas_float_complex* A,
+                                        rocblas_int            lda,
+                                        rocblas_stride         stride_a,
+                                        rocblas_int            batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_zsymmetrize_strided_batched(rocblas_handle          handle,
+                                        rocblas_fill            uplo,
+                                        rocblas_int             n,
+                                        rocblas_double_complex* A,
+                                        rocblas_int             lda,
+                                        rocblas_stride          stride_a,
+                                        rocblas_int             batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_chermitize_strided_batched(rocblas_handle         handle,
+                                       rocblas_fill           uplo,
+                                       rocblas_int            n,
+                                       rocblas_float_complex* A,
+                                       rocblas_int            lda,
+                                       rocblas_stride         stride_a,
+                                       rocblas_int            batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_zhermitize_strided_batched(rocblas_handle          handle,
+                                       rocblas_fill            uplo,
+                                       rocblas_int             n,
+                                       rocblas_double_complex* A,
+                                       rocblas_int             lda,
+                                       rocblas_stride          stride_a,
+                                       rocblas_int             batch_count);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    sprk_strided_batched and hprk_strided_batched apply k symmetric or Hermitian rank-1 updates
+    to each packed matrix of a batch in one pass over it:
+
+        sprk: A_i := A_i + alpha * X_i * X_i**T,    hprk: A_i := A_i + alpha * X_i * X_i**H,
+
+    for i = 1, ..., batch_count, where the columns of the n by k matrix X_i are the vectors x of
+    k spr or hpr updates, and alpha is real for hprk. Each thread block updates a tile of the
+    triangle, so that X_i is read and AP_i written with coalesced accesses, k times fewer passes
+    over AP_i than k calls of spr or hpr.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              triangle of each A_i is stored in AP_i.
+    @param[in]
+    n         [rocblas_int]
+              the number of rows and columns of each matrix A_i.
+    @param[in]
+    k         [rocblas_int]
+              the number of vectors, columns of each X_i.
+    @param[in]
+    alpha     device pointer or host pointer specifying the scalar alpha, real for hprk.
+    @param[in]
+    X         device pointer to the first n by k matrix X_1.
+    @param[in]
+    ldx       [rocblas_int]
+              specifies the leading dimension of each X_i, ldx >= max(1, n).
+    @param[in]
+    stride_x  [rocblas_stride]
+              stride from the start of one matrix (X_i) to the next (X_i+1).
+    @param[inout]
+    AP        device pointer to the first packed matrix AP_1, of at least n * (n + 1) / 2
+              elements in each. The imaginary parts of the diagonal of a Hermitian matrix are
+              set to zero.
+    @param[in]
+    stride_ap [rocblas_stride]
+              stride from the start of one packed matrix (AP_i) to the next (AP_i+1).
+    @param[in]
+    batch_count [rocblas_int]
+              number of matrices in the batch.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_ssprk_strided_batched(rocblas_handle handle,
+                                                            rocblas_fill   uplo,
+                                                            rocblas_int    n,
+                                                            rocblas_int    k,
+                                                            const float*   alpha,
+                                                            const float*   X,
+                                                            rocblas_int    ldx,
+                                                            rocblas_stride stride_x,
+                                                            float*         AP,
+                                                            rocblas_stride stride_ap,
+                                                            rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsprk_strided_batched(rocblas_handle handle,
+                                                            rocblas_fill   uplo,
+                                                            rocblas_int    n,
+                                                            rocblas_int    k,
+                                                            const double*  alpha,
+                                                            const double*  X,
+                                                            rocblas_int    ldx,
+                                                            rocblas_stride stride_x,
+                                                            double*        AP,
+                                                            rocblas_stride stride_ap,
+                                                            rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_csprk_strided_batched(rocblas_handle               handle,
+                                  rocblas_fill                 uplo,
+                                  rocblas_int                  n,
+                                  rocblas_int                  k,
+                                  const rocblas_float_complex* alpha,
+                                  const rocblas_float_complex* X,
+                                  rocblas_int                  ldx,
+                                  rocblas_stride               stride_x,
+                                  rocblas_float_complex*       AP,
+                                  rocblas_stride               stride_ap,
+                                  rocblas_int                  batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_zsprk_strided_batched(rocblas_handle                handle,
+                                  rocblas_fill                  uplo,
+                                  rocblas_int                   n,
+                                  rocblas_int                   k,
+                                  const rocblas_double_complex* alpha,
+                                  const rocblas_double_complex* X,
+                                  rocblas_int                   ldx,
+                                  rocblas_stride                stride_x,
+                                  rocblas_double_complex*       AP,
+                                  rocblas_stride                stride_ap,
+                                  rocblas_int                   batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_chprk_strided_batched(rocblas_handle               handle,
+                                  rocblas_fill                 uplo,
+                                  rocblas_int                  n,
+                                  rocblas_int                  k,
+                                  const float*                 alpha,
+                                  const rocblas_float_complex* X,
+                                  rocblas_int                  ldx,
+                                  rocblas_stride               stride_x,
+                                  rocblas_float_complex*       AP,
+                                  rocblas_stride               stride_ap,
+                                  rocblas_int                  batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_zhprk_strided_batched(rocblas_handle                handle,
+                                  rocblas_fill                  uplo,
+                                  rocblas_int                   n,
+                                  rocblas_int                   k,
+                                  const double*                 alpha,
+                                  const rocblas_double_complex* X,
+                                  rocblas_int                   ldx,
+                                  rocblas_stride                stride_x,
+                                  rocblas_double_complex*       AP,
+                                  rocblas_stride                stride_ap,
+                                  rocblas_int                   batch_count);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    spr2k_strided_batched and hpr2k_strided_batched apply k symmetric or Hermitian rank-2
+    updates to each packed matrix of a batch in one pass over it:
+
+        spr2k: A_i := A_i + alpha * (X_i * Y_i**T + Y_i * X_i**T),
+        hpr2k: A_i := A_i + alpha * X_i * Y_i**H + conj(alpha) * Y_i * X_i**H,
+
+    for i = 1, ..., batch_count, where the columns of the n by k matrices X_i and Y_i are the
+    vectors x and y of k spr2 or hpr2 updates.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              triangle of each A_i is stored in AP_i.
+    @param[in]
+    n         [rocblas_int]
+              the number of rows and columns of each matrix A_i.
+    @param[in]
+    k         [rocblas_int]
+              the number of vectors, columns of each X_i and Y_i.
+    @param[in]
+    alpha     device pointer or host pointer specifying the scalar alpha.
+    @param[in]
+    X         device pointer to the first n by k matrix X_1.
+    @param[in]
+    ldx       [rocblas_int]
+              specifies the leading dimension of each X_i, ldx >= max(1, n).
+    @param[in]
+    stride_x  [rocblas_stride]
+              stride from the start of one matrix (X_i) to the next (X_i+1).
+    @param[in]
+    Y         device pointer to the first n by k matrix Y_1.
+    @param[in]
+    ldy       [rocblas_int]
+              specifies the leading dimension of each Y_i, ldy >= max(1, n).
+    @param[in]
+    stride_y  [rocblas_stride]
+              stride from the start of one matrix (Y_i) to the next (Y_i+1).
+    @param[inout]
+    AP        device pointer to the first packed matrix AP_1, of at least n * (n + 1) / 2
+              elements in each. The imaginary parts of the diagonal of a Hermitian matrix are
+              set to zero.
+    @param[in]
+    stride_ap [rocblas_stride]
+              stride from the start of one packed matrix (AP_i) to the next (AP_i+1).
+    @param[in]
+    batch_count [rocblas_int]
+              number of matrices in the batch.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sspr2k_strided_batched(rocblas_handle handle,
+                                                             rocblas_fill   uplo,
+                                                             rocblas_int    n,
+                                                             rocblas_int    k,
+                                                             const float*   alpha,
+                                                             const float*   X,
+                                                             rocblas_int    ldx,
+                                                             rocblas_stride stride_x,
+                                                             const float*   Y,
+                                                             rocblas_int    ldy,
+                                                             rocblas_stride stride_y,
+                                                             float*         AP,
+                                                             rocblas_stride stride_ap,
+                                                             rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dspr2k_strided_batched(rocblas_handle handle,
+                                                             rocblas_fill   uplo,
+                                                             rocblas_int    n,
+                                                             rocblas_int    k,
+                                                             const double*  alpha,
+                                                             const double*  X,
+                                                             rocblas_int    ldx,
+                                                             rocblas_stride stride_x,
+                                                             const double*  Y,
+                                                             rocblas_int    ldy,
+                                                             rocblas_stride stride_y,
+                                                             double*        AP,
+                                                             rocblas_stride stride_ap,
+                                                             rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_chpr2k_strided_batched(rocblas_handle               handle,
+                                   rocblas_fill                 uplo,
+                                   rocblas_int                  n,
+                                   rocblas_int                  k,
+                                   const rocblas_float_complex* alpha,
+                                   const rocblas_float_complex* X,
+                                   rocblas_int                  ldx,
+                                   rocblas_stride               stride_x,
+                                   const rocblas_float_complex* Y,
+                                   rocblas_int                  ldy,
+                                   rocblas_stride               stride_y,
+                                   rocblas_float_complex*       AP,
+                                   rocblas_stride               stride_ap,
+                                   rocblas_int                  batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_zhpr2k_strided_batched(rocblas_handle                handle,
+                                   rocblas_fill                  uplo,
+                                   rocblas_int                   n,
+                                   rocblas_int                   k,
+                                   const rocblas_double_complex* alpha,
+                                   const rocblas_double_complex* X,
+                                   rocblas_int                   ldx,
+                                   rocblas_stride                stride_x,
+                                   const rocblas_double_complex* Y,
+                                   rocblas_int                   ldy,
+                                   rocblas_stride                stride_y,
+                                   rocblas_double_complex*       AP,
+                                   rocblas_stride                stride_ap,
+                                   rocblas_int                   batch_count);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    gemm_int4 multiplies half or bfloat16 activations by int4 weights:
+
+        C = alpha * op( A ) * B + beta * C,
+
+        where op( A ) is an m by k matrix, B a k by n matrix of 4-bit weights and C an m by n
+        matrix, with
+
+        op( A ) = A  or  op( A ) = A**T.
+
+    B is stored by columns with two unsigned 4-bit values q per byte, the lower nibble holding
+    the weight of the even row. Weight l of column j is dequantized as it is loaded,
+
+        B[l, j] = scales[g + j*groups] * (q - zeros[g + j*groups]),  g = l / group_size,
+
+    with groups = ceil(k / group_size) scales and zero points per column. Without zero points
+    the weights are symmetric around 8. Products are accumulated in float, and the weights read
+    from memory are half the size of int8 weights. For m <= 8, as in decoding, each column of
+    B is read once for all rows of op( A ).
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    trans_a   [rocblas_operation]
+              specifies the form of op( A ).
+    @param[in]
+    m         [rocblas_int]
+              number of rows of op( A ) and C.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of B and C.
+    @param[in]
+    k         [rocblas_int]
+              number of columns of op( A ) and rows of B.
+    @param[in]
+    alpha     device pointer or host pointer to float scalar alpha.
+    @param[in]
+    A         device pointer storing matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A,
+              lda >= max(1, m) if trans_a == rocblas_operation_none, otherwise lda >= max(1, k).
+    @param[in]
+    B         device pointer storing the packed weights.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of B in bytes, ldb >= max(1, ceil(k / 2)).
+    @param[in]
+    scales    device pointer storing the groups by n scales of the weights.
+    @param[in]
+    zeros     device pointer storing the groups by n zero points of the weights, or NULL.
+    @param[in]
+    group_size [rocblas_int]
+              number of consecutive rows of B sharing a scale and zero point, group_size >= 1.
+    @param[in]
+    beta      device pointer or host pointer to float scalar beta.
+    @param[inout]
+    C         device pointer storing matrix C.
+    @param[in]
+    ldc       [rocblas_int]
+              specifies the leading dimension of C, ldc >= max(1, m).
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_hgemm_int4(rocblas_handle      handle,
+                                                 rocblas_operation   trans_a,
+                                                 rocblas_int         m,
+                                                 rocblas_int         n,
+                                                 rocblas_int         k,
+                                                 const float*        alpha,
+                                                 const rocblas_half* A,
+                                                 rocblas_int         lda,
+                                                 const uint8_t*      B,
+                                                 rocblas_int         ldb,
+                                                 const rocblas_half* scales,
+                                                 const rocblas_half* zeros,
+                                                 rocblas_int         group_size,
+                                                 const float*        beta,
+                                                 rocblas_half*       C,
+                                                 rocblas_int         ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_bfgemm_int4(rocblas_handle          handle,
+                                                  rocblas_operation       trans_a,
+                                                  rocblas_int             m,
+                                                  rocblas_int             n,
+                                                  rocblas_int             k,
+                                                  const float*            alpha,
+                                                  const rocblas_bfloat16* A,
+                                                  rocblas_int             lda,
+                                                  const uint8_t*          B,
+                                                  rocblas_int             ldb,
+                                                  const rocblas_bfloat16* scales,
+                                                  const rocblas_bfloat16* zeros,
+                                                  rocblas_int             group_size,
+                                                  const float*            beta,
+                                                  rocblas_bfloat16*       C,
+                                                  rocblas_int             ldc);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    gemm_sparse24 multiplies a 2:4 structured sparse matrix of half or bfloat16 weights:
+
+        C = alpha * A * op( B ) + beta * C,
+
+        where A is an m by k matrix with at most 2 nonzeros in each group of 4 consecutive
+        elements of a row, op( B ) a k by n matrix and C an m by n matrix, with
+
+        op( B ) = B  or  op( B ) = B**T.
+
+    A is given compressed, as produced by sparse24_compress: Ac is the m by k/2 matrix of the
+    2 values kept in each group, in the order of their columns, and meta the m by ceil(k/8)
+    matrix of bytes of their positions in the group. Each value has a 2 bit position, each
+    group a 4 bit nibble of the two, the lower bits for the first value, and each byte holds
+    two groups, the lower nibble for the even group. Only the kept values are multiplied, half
+    of the products of the dense gemm, and A is read at half its dense size plus one byte per
+    8 elements. Products are accumulated in float.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    trans_b   [rocblas_operation]
+              specifies the form of op( B ).
+    @param[in]
+    m         [rocblas_int]
+              number of rows of A and C.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of op( B ) and C.
+    @param[in]
+    k         [rocblas_int]
+              number of columns of A and rows of op( B ), a multiple of 4.
+    @param[in]
+    alpha     device pointer or host pointer to float scalar alpha.
+    @param[in]
+    Ac        device pointer storing the kept values of A.
+    @param[in]
+    ldac      [rocblas_int]
+              specifies the leading dimension of Ac, ldac >= max(1, m).
+    @param[in]
+    meta      device pointer storing the positions of the kept values of A.
+    @param[in]
+    ldmeta    [rocblas_int]
+              specifies the leading dimension of meta, ldmeta >= max(1, m).
+    @param[in]
+    B         device pointer storing matrix B.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of B,
+              ldb >= max(1, k) if trans_b == rocblas_operation_none, otherwise ldb >= max(1, n).
+    @param[in]
+    beta      device pointer or host pointer to float scalar beta.
+    @param[inout]
+    C         device pointer storing matrix C.
+    @param[in]
+    ldc       [rocblas_int]
+              specifies the leading dimension of C, ldc >= max(1, m).
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_hgemm_sparse24(rocblas_handle      handle,
+                                                     rocblas_operation   trans_b,
+                                                     rocblas_int         m,
+                                                     rocblas_int         n,
+                                                     rocblas_int         k,
+                                                     const float*        alpha,
+                                                     const rocblas_half* Ac,
+                                                     rocblas_int         ldac,
+                                                     const uint8_t*      meta,
+                                                     rocblas_int         ldmeta,
+                                                     const rocblas_half* B,
+                                                     rocblas_int         ldb,
+                                                     const float*        beta,
+                                                     rocblas_half*       C,
+                                                     rocblas_int         ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_bfgemm_sparse24(rocblas_handle          handle,
+                                                      rocblas_operation       trans_b,
+                                                      rocblas_int             m,
+                                                      rocblas_int             n,
+                                                      rocblas_int             k,
+                                                      const float*            alpha,
+                                                      const rocblas_bfloat16* Ac,
+                                                      rocblas_int             ldac,
+                                                      const uint8_t*          meta,
+                                                      rocblas_int             ldmeta,
+                                                      const rocblas_bfloat16* B,
+                                                      rocblas_int             ldb,
+                                                      const float*            beta,
+                                                      rocblas_bfloat16*       C,
+                                                      rocblas_int             ldc);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    sparse24_compress prunes an m by k matrix A of half or bfloat16 weights to 2:4 structured
+    sparsity and compresses it into the Ac and meta matrices of gemm_sparse24. The 2 elements
+    of largest magnitude of each group of 4 consecutive elements of a row are kept, the lower
+    index on ties, so a matrix that is already 2:4 sparse is compressed exactly.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    m         [rocblas_int]
+              number of rows of A.
+    @param[in]
+    k         [rocblas_int]
+              number of columns of A, a multiple of 4.
+    @param[in]
+    A         device pointer storing matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A, lda >= max(1, m).
+    @param[out]
+    Ac        device pointer storing the m by k/2 kept values of A.
+    @param[in]
+    ldac      [rocblas_int]
+              specifies the leading dimension of Ac, ldac >= max(1, m).
+    @param[out]
+    meta      device pointer storing the m by ceil(k/8) bytes of the positions of the kept
+              values.
+    @param[in]
+    ldmeta    [rocblas_int]
+              specifies the leading dimension of meta, ldmeta >= max(1, m).
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_hsparse24_compress(rocblas_handle      handle,
+                                                         rocblas_int         m,
+                                                         rocblas_int         k,
+                                                         const rocblas_half* A,
+                                                         rocblas_int         lda,
+                                                         rocblas_half*       Ac,
+                                                         rocblas_int         ldac,
+                                                         uint8_t*            meta,
+                                                         rocblas_int         ldmeta);
+
+ROCBLAS_EXPORT rocblas_status rocblas_bfsparse24_compress(rocblas_handle          handle,
+                                                          rocblas_int             m,
+                                                          rocblas_int             k,
+                                                          const rocblas_bfloat16* A,
+                                                          rocblas_int             lda,
+                                                          rocblas_bfloat16*       Ac,
+                                                          rocblas_int             ldac,
+                                                          uint8_t*                meta,
+                                                          rocblas_int             ldmeta);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    gemm_planar performs the complex matrix-matrix operation
+
+        C = alpha * op( A ) * op( B ) + beta * C,
+
+    on planar complex matrices, which store the real and imaginary parts of their elements in
+    separate real matrices: A = Ar + i * Ai, and likewise B and C. op( X ) is one of
+
+        op( X ) = X  or  op( X ) = X**T  or  op( X ) = X**H,
+
+    op( A ) is an m by k matrix, op( B ) a k by n matrix and C an m by n matrix. The product is
+    computed by four real gemm products of the parts, accumulated in Cr and Ci when alpha and
+    beta are real. For a complex alpha or beta the product is formed in the device workspace,
+    2 * m * n real elements, and scaled into C. A device pointer mode alpha and beta are copied to
+    the host, which synchronizes the stream.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    transA    [rocblas_operation]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [rocblas_operation]
+              specifies the form of op( B ).
+    @param[in]
+    m         [rocblas_int]
+              number of rows of matrices op( A ) and C.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of matrices op( B ) and C.
+    @param[in]
+    k         [rocblas_int]
+              number of columns of op( A ) and rows of op( B ).
+    @param[in]
+    alpha     device pointer or host pointer specifying the complex scalar alpha.
+    @param[in]
+    Ar, Ai    device pointers storing the real and imaginary parts of matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of Ar and Ai.
+    @param[in]
+    Br, Bi    device pointers storing the real and imaginary parts of matrix B.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of Br and Bi.
+    @param[in]
+    beta      device pointer or host pointer specifying the complex scalar beta.
+    @param[inout]
+    Cr, Ci    device pointers storing the real and imaginary parts of matrix C.
+    @param[in]
+    ldc       [rocblas_int]
+              specifies the leading dimension of Cr and Ci, ldc >= max(1, m).
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_cgemm_planar(rocblas_handle               handle,
+                                                   rocblas_operation            transA,
+                                                   rocblas_operation            transB,
+                                                   rocblas_int                  m,
+                                                   rocblas_int                  n,
+                                                   rocblas_int                  k,
+                                                   const rocblas_float_complex* alpha,
+                                                   const float*                 Ar,
+                                                   const float*                 Ai,
+                                                   rocblas_int                  lda,
+                                                   const float*                 Br,
+                                                   const float*                 Bi,
+                                                   rocblas_int                  ldb,
+                                                   const rocblas_float_complex* beta,
+                                                   float*                       Cr,
+                                                   float*                       Ci,
+                                                   rocblas_int                  ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgemm_planar(rocblas_handle                handle,
+                                                   rocblas_operation             transA,
+                                                   rocblas_operation             transB,
+                                                   rocblas_int                   m,
+                                                   rocblas_int                   n,
+                                                   rocblas_int                   k,
+                                                   const rocblas_double_complex* alpha,
+                                                   const double*                 Ar,
+                                                   const double*                 Ai,
+                                                   rocblas_int                   lda,
+                                                   const double*                 Br,
+                                                   const double*                 Bi,
+                                                   rocblas_int                   ldb,
+                                                   const rocblas_double_complex* beta,
+                                                   double*                       Cr,
+                                                   double*                       Ci,
+                                                   rocblas_int                   ldc);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    gemv_planar performs the complex matrix-vector operation
+
+        y = alpha * op( A ) * x + beta * y,
+
+    on a planar complex m by n matrix A = Ar + i * Ai and planar complex vectors x = xr + i * xi
+    and y = yr + i * yi, with op( A ) = A, A**T or A**H. As in gemm_planar the product is
+    computed by four real gemv products of the parts, and formed in the device workspace for a
+    complex alpha or beta.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    transA    [rocblas_operation]
+              specifies the form of op( A ).
+    @param[in]
+    m         [rocblas_int]
+              number of rows of matrix A.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of matrix A.
+    @param[in]
+    alpha     device pointer or host pointer specifying the complex scalar alpha.
+    @param[in]
+    Ar, Ai    device pointers storing the real and imaginary parts of matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of Ar and Ai, lda >= max(1, m).
+    @param[in]
+    xr, xi    device pointers storing the real and imaginary parts of vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of xr and xi.
+    @param[in]
+    beta      device pointer or host pointer specifying the complex scalar beta.
+    @param[inout]
+    yr, yi    device pointers storing the real and imaginary parts of vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of yr and yi.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_cgemv_planar(rocblas_handle               handle,
+                                                   rocblas_operation            transA,
+                                                   rocblas_int                  m,
+                                                   rocblas_int                  n,
+                                                   const rocblas_float_complex* alpha,
+                                                   const float*                 Ar,
+                                                   const float*                 Ai,
+                                                   rocblas_int                  lda,
+                                                   const float*                 xr,
+                                                   const float*                 xi,
+                                                   rocblas_int                  incx,
+                                                   const rocblas_float_complex* beta,
+                                                   float*                       yr,
+                                                   float*                       yi,
+                                                   rocblas_int                  incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgemv_planar(rocblas_handle                handle,
+                                                   rocblas_operation             transA,
+                                                   rocblas_int                   m,
+                                                   rocblas_int                   n,
+                                                   const rocblas_double_complex* alpha,
+                                                   const double*                 Ar,
+                                                   const double*                 Ai,
+                                                   rocblas_int                   lda,
+                                                   const double*                 xr,
+                                                   const double*                 xi,
+                                                   rocblas_int                   incx,
+                                                   const rocblas_double_complex* beta,
+                                                   double*                       yr,
+                                                   double*                       yi,
+                                                   rocblas_int                   incy);
+//! @}
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    trsm_refine solves the double precision triangular system
+
+        op( A )*X = alpha*B  or  X*op( A ) = alpha*B
+
+    by mixed-precision iterative refinement. X is first solved for in single precision, using
+    the inverses of the diagonal blocks of A computed once, and then refined by
+
+        R = alpha*B - op( A )*X (double precision),  op( A )*D = R (single precision),  X += D,
+
+    until max|R| <= tol * max|alpha*B| or max_iter corrections have been applied. When A is
+    well enough conditioned for single precision, this reaches double precision accuracy with
+    the single precision solves doing most of the work; with rocblas_xf32_xdl_math_op set the
+    single precision solves may also use xf32. Convergence is decided on the device, so the
+    iterations are enqueued without waiting for the host.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    side      [rocblas_side]
+              specifies whether op(A) multiplies X from the left or the right.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether A is an upper or lower triangular matrix.
+    @param[in]
+    transA    [rocblas_operation]
+              specifies the form of op(A).
+    @param[in]
+    diag      [rocblas_diagonal]
+              specifies whether A is assumed to be unit triangular.
+    @param[in]
+    m         [rocblas_int]
+              number of rows of B, m >= 0.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of B, n >= 0.
+    @param[in]
+    alpha     device pointer or host pointer specifying the scalar alpha.
+    @param[in]
+    A         device pointer storing matrix A, of dimension lda by m if side is
+              rocblas_side_left and lda by n otherwise.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A, lda >= max(1, m) if side is
+              rocblas_side_left and lda >= max(1, n) otherwise.
+    @param[inout]
+    B         device pointer storing matrix B, overwritten by the solution X.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of B, ldb >= max(1, m).
+    @param[in]
+    tol       [double]
+              tolerance of the residual relative to max|alpha*B|.
+    @param[in]
+    max_iter  [rocblas_int]
+              maximum number of corrections, max_iter >= 0.
+    @param[out]
+    iterations device pointer or host pointer to the number of corrections applied. It equals
+              max_iter when the tolerance was not reached.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_dtrsm_refine(rocblas_handle    handle,
+                                                   rocblas_side      side,
+                                                   rocblas_fill      uplo,
+                                                   rocblas_operation transA,
+                                                   rocblas_diagonal  diag,
+                                                   rocblas_int       m,
+                                                   rocblas_int       n,
+                                                   const double*     alpha,
+                                                   const double*     A,
+                                                   rocblas_int       lda,
+                                                   double*           B,
+                                                   rocblas_int       ldb,
+                                                   double            tol,
+                                                   rocblas_int       max_iter,
+                                                   rocblas_int*      iterations);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    trsm_ex2 solves
+
+        op(A)*X = alpha*B  or  X*op(A) = alpha*B
+
+    like rocblas_trsm_ex, for matrices A and B of datatype a_type and b_type. Half and bfloat16
+    matrices are solved with float computation, with alpha of type float, reading and writing
+    A and B in their own precision instead of converting them to float copies. The diagonal
+    blocks of A are solved for in float, and the rest of B is updated by gemm_ex with float
+    computation, the result of each update being rounded to the datatype of B.
+
+    Supported are a_type == b_type == rocblas_datatype_f16_r or rocblas_datatype_bf16_r with
+    compute_type == rocblas_datatype_f32_r; other types return rocblas_status_not_implemented.
+    The other arguments are as for rocblas_trsm_ex.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_trsm_ex2(rocblas_handle    handle,
+                                               rocblas_side      side,
+                                               rocblas_fill      uplo,
+                                               rocblas_operation transA,
+                                               rocblas_diagonal  diag,
+                                               rocblas_int       m,
+                                               rocblas_int       n,
+                                               const void*       alpha,
+                                               const void*       A,
+                                               rocblas_datatype  a_type,
+                                               rocblas_int       lda,
+                                               void*             B,
+                                               rocblas_datatype  b_type,
+                                               rocblas_int       ldb,
+                                               rocblas_datatype  compute_type);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    syrk_ex performs
+
+        C = alpha*op( A )*op( A )**T + beta*C,
+
+    like rocblas_ssyrk, for matrices A and C of datatype a_type and c_type, where op( A ) is an
+    n by k matrix and only the uplo triangle of the n by n symmetric matrix C is referenced.
+    Half and bfloat16 matrices are multiplied with float computation, with alpha and beta of
+    type float, without converting A and C to float copies. The parts of C outside its diagonal
+    blocks are computed by gemm_ex.
+
+    Supported are a_type == c_type == rocblas_datatype_f16_r or rocblas_datatype_bf16_r with
+    compute_type == rocblas_datatype_f32_r; other types return rocblas_status_not_implemented.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper or lower triangle of C is computed.
+    @param[in]
+    transA    [rocblas_operation]
+              op( A ) = A if rocblas_operation_none, op( A ) = A**T otherwise.
+    @param[in]
+    n         [rocblas_int]
+              order of C, n >= 0.
+    @param[in]
+    k         [rocblas_int]
+              number of columns of op( A ), k >= 0.
+    @param[in]
+    alpha     device pointer or host pointer to float scalar alpha.
+    @param[in]
+    A         device pointer storing matrix A.
+    @param[in]
+    a_type    [rocblas_datatype]
+              datatype of A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A, lda >= max(1, n) if transA is
+              rocblas_operation_none and lda >= max(1, k) otherwise.
+    @param[in]
+    beta      device pointer or host pointer to float scalar beta.
+    @param[inout]
+    C         device pointer storing matrix C.
+    @param[in]
+    c_type    [rocblas_datatype]
+              datatype of C.
+    @param[in]
+    ldc       [rocblas_int]
+              specifies the leading dimension of C, ldc >= max(1, n).
+    @param[in]
+    compute_type [rocblas_datatype]
+              specifies the datatype of computation.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_syrk_ex(rocblas_handle    handle,
+                                              rocblas_fill      uplo,
+                                              rocblas_operation transA,
+                                              rocblas_int       n,
+                                              rocblas_int       k,
+                                              const void*       alpha,
+                                              const void*       A,
+                                              rocblas_datatype  a_type,
+                                              rocblas_int       lda,
+                                              const void*       beta,
+                                              void*             C,
+                                              rocblas_datatype  c_type,
+                                              rocblas_int       ldc,
+                                              rocblas_datatype  compute_type);
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    syrk_diag and herk_diag perform a symmetric or Hermitian rank-k update with a diagonal
+    weight:
+
+        C := alpha * op( A ) * diag( d ) * op( A )**T + beta * C   (syrk_diag) or
+        C := alpha * op( A ) * diag( d ) * op( A )**H + beta * C   (herk_diag, with real alpha,
+                                                                    beta and d),
+
+    where op( A ) is an n by k matrix, d is a vector of k weights and only the uplo triangle of
+    the n by n matrix C is referenced. With transA == rocblas_operation_transpose (or
+    rocblas_operation_conjugate_transpose for herk_diag) this is the weighted normal matrix
+    A**T * D * A of Gauss-Newton and weighted least squares steps.
+
+    The weights are applied to the tiles of op( A ) as they are loaded, so unlike a dgmm into a
+    temporary matrix followed by syrkx, the weighted copy of A is neither allocated nor written
+    and read back.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              triangle of C is computed.
+    @param[in]
+    transA    [rocblas_operation]
+              op( A ) = A if rocblas_operation_none, op( A ) = A**T if
+              rocblas_operation_transpose (syrk_diag) and op( A ) = A**H if
+              rocblas_operation_conjugate_transpose (herk_diag). For real types both
+              transposes are accepted.
+    @param[in]
+    n         [rocblas_int]
+              order of C, n >= 0.
+    @param[in]
+    k         [rocblas_int]
+              number of columns of op( A ) and of weights, k >= 0.
+    @param[in]
+    alpha     device pointer or host pointer to scalar alpha.
+    @param[in]
+    A         device pointer storing matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A, lda >= max(1, n) if transA is
+              rocblas_operation_none and lda >= max(1, k) otherwise.
+    @param[in]
+    d         device pointer storing the k weights.
+    @param[in]
+    incd      [rocblas_int]
+              specifies the increment for the elements of d, incd != 0.
+    @param[in]
+    beta      device pointer or host pointer to scalar beta.
+    @param[inout]
+    C         device pointer storing matrix C.
+    @param[in]
+    ldc       [rocblas_int]
+              specifies the leading dimension of C, ldc >= max(1, n).
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_ssyrk_diag(rocblas_handle    handle,
+                                                 rocblas_fill      uplo,
+                                                 rocblas_operation transA,
+                                                 rocblas_int       n,
+                                                 rocblas_int       k,
+                                                 const float*      alpha,
+                                                 const float*      A,
+                                                 rocblas_int       lda,
+                                                 const float*      d,
+                                                 rocblas_int       incd,
+                                                 const float*      beta,
+                                                 float*            C,
+                                                 rocblas_int       ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyrk_diag(rocblas_handle    handle,
+                                                 rocblas_fill      uplo,
+                                                 rocblas_operation transA,
+                                                 rocblas_int       n,
+                                                 rocblas_int       k,
+                                                 const double*     alpha,
+                                                 const double*     A,
+                                                 rocblas_int       lda,
+                                                 const double*     d,
+                                                 rocblas_int       incd,
+                                                 const double*     beta,
+                                                 double*           C,
+                                                 rocblas_int       ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csyrk_diag(rocblas_handle               handle,
+                                                 rocblas_fill                 uplo,
+                                                 rocblas_operation            transA,
+                                                 rocblas_int                  n,
+                                                 rocblas_int                  k,
+                                                 const rocblas_float_complex* alpha,
+                                                 const rocblas_float_complex* A,
+                                                 rocblas_int                  lda,
+                                                 const rocblas_float_complex* d,
+                                                 rocblas_int                  incd,
+                                                 const rocblas_float_complex* beta,
+                                                 rocblas_float_complex*       C,
+                                                 rocblas_int                  ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zsyrk_diag(rocblas_handle                handle,
+                                                 rocblas_fill                  uplo,
+                                                 rocblas_operation             transA,
+                                                 rocblas_int                   n,
+                                                 rocblas_int                   k,
+                                                 const rocblas_double_complex* alpha,
+                                                 const rocblas_double_complex* A,
+                                                 rocblas_int                   lda,
+                                                 const rocblas_double_complex* d,
+                                                 rocblas_int                   incd,
+                                                 const rocblas_double_complex* beta,
+                                                 rocblas_double_complex*       C,
+                                                 rocblas_int                   ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cherk_diag(rocblas_handle               handle,
+                                                 rocblas_fill                 uplo,
+                                                 rocblas_operation            transA,
+                                                 rocblas_int                  n,
+                                                 rocblas_int                  k,
+                                                 const float*                 alpha,
+                                                 const rocblas_float_complex* A,
+                                                 rocblas_int                  lda,
+                                                 const float*                 d,
+                                                 rocblas_int                  incd,
+                                                 const float*                 beta,
+                                                 rocblas_float_complex*       C,
+                                                 rocblas_int                  ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zherk_diag(rocblas_handle                handle,
+                                                 rocblas_fill                  uplo,
+                                                 rocblas_operation             transA,
+                                                 rocblas_int                   n,
+                                                 rocblas_int                   k,
+                                                 const double*                 alpha,
+                                                 const rocblas_double_complex* A,
+                                                 rocblas_int                   lda,
+                                                 const double*                 d,
+                                                 rocblas_int                   incd,
+                                                 const double*                 beta,
+                                                 rocblas_double_complex*       C,
+                                                 rocblas_int                   ldc);
+//! @}
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    convert_ex converts the m by n matrices of a strided batch between float, half, bfloat16
+    and the 8-bit float types:
+
+        Y_i = convert( scale * X_i ),  amax[i] = max | X_i |,  i = 0, ..., batch_count - 1.
+
+    The downcasts round to nearest even, as in gemm_ex3. With
+    rocblas_gemm_flags_stochastic_rounding in flags, conversions to rocblas_datatype_f8_r and
+    rocblas_datatype_bf8_r round stochastically, seeded like gemm_ex3 from the state set by
+    rocblas_set_stochastic_rounding_seed.
+    The maxima of the inputs, as needed to scale the next conversion to an 8-bit type, are
+    computed in the same pass. Each thread converts up to 16 bytes at a time when the rows,
+    leading dimensions, strides and pointers allow it.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    m         [rocblas_int]
+              number of rows of each matrix, m >= 0.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of each matrix, n >= 0.
+    @param[in]
+    x         device pointer storing the first input matrix.
+    @param[in]
+    x_type    [rocblas_datatype]
+              datatype of the input: rocblas_datatype_f32_r, rocblas_datatype_f16_r,
+              rocblas_datatype_bf16_r, rocblas_datatype_f8_r or rocblas_datatype_bf8_r.
+    @param[in]
+    ldx       [rocblas_int]
+              leading dimension of the input, ldx >= max(1, m).
+    @param[in]
+    stride_x  [rocblas_stride]
+              stride from the start of one input matrix to the next.
+    @param[out]
+    y         device pointer storing the first output matrix.
+    @param[in]
+    y_type    [rocblas_datatype]
+              datatype of the output, one of the types of x_type.
+    @param[in]
+    ldy       [rocblas_int]
+              leading dimension of the output, ldy >= max(1, m).
+    @param[in]
+    stride_y  [rocblas_stride]
+              stride from the start of one output matrix to the next.
+    @param[in]
+    batch_count [rocblas_int]
+              number of matrices.
+    @param[in]
+    scale     device pointer to the float scale applied before the conversion, or NULL.
+    @param[out]
+    amax      device pointer to batch_count floats receiving the maxima of the absolute values
+              of the inputs, before scaling, or NULL.
+    @param[in]
+    flags     [uint32_t]
+              rocblas_gemm_flags_stochastic_rounding or 0.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_convert_ex(rocblas_handle   handle,
+                                                 rocblas_int      m,
+                                                 rocblas_int      n,
+                                                 const void*      x,
+                                                 rocblas_datatype x_type,
+                                                 rocblas_int      ldx,
+                                                 rocblas_stride   stride_x,
+                                                 void*            y,
+                                                 rocblas_datatype y_type,
+                                                 rocblas_int      ldy,
+                                                 rocblas_stride   stride_y,
+                                                 rocblas_int      batch_count,
+                                                 const float*     scale,
+                                                 float*           amax,
+                                                 uint32_t         flags);
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    gemv_ex performs
+
+        y = alpha*op( A )*x + beta*y,  op( A ) = A  or  op( A ) = A**T,
+
+    with independent datatypes of A, x, y and the computation, so that the matrix of a
+    bandwidth bound gemv, as in the decode phase of inference, can be read in a narrower type
+    than the vectors. The supported combinations are
+
+        a_type = x_type = y_type = compute_type, as rocblas_sgemv, dgemv, cgemv and zgemv,
+        a_type = x_type = f16_r or bf16_r, y_type = a_type or f32_r, compute_type = f32_r,
+        a_type = f8_r or bf8_r, x_type = y_type = compute_type = f32_r;
+
+    other combinations return rocblas_status_not_implemented. alpha and beta have the
+    compute_type. The arguments are those of rocblas_sgemv with the datatypes added.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemv_ex(rocblas_handle    handle,
+                                              rocblas_operation transA,
+                                              rocblas_int       m,
+                                              rocblas_int       n,
+                                              const void*       alpha,
+                                              const void*       A,
+                                              rocblas_datatype  a_type,
+                                              rocblas_int       lda,
+                                              const void*       x,
+                                              rocblas_datatype  x_type,
+                                              rocblas_int       incx,
+                                              const void*       beta,
+                                              void*             y,
+                                              rocblas_datatype  y_type,
+                                              rocblas_int       incy,
+                                              rocblas_datatype  compute_type);
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    The _fast functions compute what rocblas_Xscal, rocblas_Xaxpy, rocblas_Xgemv and
+    rocblas_Xgemm compute, with the same arguments, for callers making many calls at sizes
+    where the host time of a call is a large part of its latency. They go directly to the
+    kernels of the functions: the arguments are not checked, beyond a null handle and sizes
+    with nothing to compute, and the calls are not logged, have no numerics checks, are not
+    counted in rocblas_get_handle_stats, do not record the events of
+    rocblas_set_start_stop_events and do not apply the epilogues of rocblas_set_gemv_epilogue
+    or rocblas_set_gemm_epilogue. Invalid arguments give undefined results, so the functions
+    are meant for arguments the caller has validated, for example with a first call of the
+    checked function.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sscal_fast(
+    rocblas_handle handle, rocblas_int n, const float* alpha, float* x, rocblas_int incx);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dscal_fast(
+    rocblas_handle handle, rocblas_int n, const double* alpha, double* x, rocblas_int incx);
+
+ROCBLAS_EXPORT rocblas_status rocblas_saxpy_fast(rocblas_handle handle,
+                                                 rocblas_int    n,
+                                                 const float*   alpha,
+                                                 const float*   x,
+                                                 rocblas_int    incx,
+                                                 float*         y,
+                                                 rocblas_int    incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_daxpy_fast(rocblas_handle handle,
+                                                 rocblas_int    n,
+                                                 const double*  alpha,
+                                                 const double*  x,
+                                                 rocblas_int    incx,
+                                                 double*        y,
+                                                 rocblas_int    incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sgemv_fast(rocblas_handle    handle,
+                                                 rocblas_operation transA,
+                                                 rocblas_int       m,
+                                                 rocblas_int       n,
+                                                 const float*      alpha,
+                                                 const float*      A,
+                                                 rocblas_int       lda,
+                                                 const float*      x,
+                                                 rocblas_int       incx,
+                                                 const float*      beta,
+                                                 float*            y,
+                                                 rocblas_int       incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemv_fast(rocblas_handle    handle,
+                                                 rocblas_operation transA,
+                                                 rocblas_int       m,
+                                                 rocblas_int       n,
+                                                 const double*     alpha,
+                                                 const double*     A,
+                                                 rocblas_int       lda,
+                                                 const double*     x,
+                                                 rocblas_int       incx,
+                                                 const double*     beta,
+                                                 double*           y,
+                                                 rocblas_int       incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sgemm_fast(rocblas_handle    handle,
+                                                 rocblas_operation trans_a,
+                                                 rocblas_operation trans_b,
+                                                 rocblas_int       m,
+                                                 rocblas_int       n,
+                                                 rocblas_int       k,
+                                                 const float*      alpha,
+                                                 const float*      A,
+                                                 rocblas_int       lda,
+                                                 const float*      B,
+                                                 rocblas_int       ldb,
+                                                 const float*      beta,
+                                                 float*            C,
+                                                 rocblas_int       ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemm_fast(rocblas_handle    handle,
+                                                 rocblas_operation trans_a,
+                                                 rocblas_operation trans_b,
+                                                 rocblas_int       m,
+                                                 rocblas_int       n,
+                                                 rocblas_int       k,
+                                                 const double*     alpha,
+                                                 const double*     A,
+                                                 rocblas_int       lda,
+                                                 const double*     B,
+                                                 rocblas_int       ldb,
+                                                 const double*     beta,
+                                                 double*           C,
+                                                 rocblas_int       ldc);
+//! @}
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    gemm_indexed_batched_ex performs the gemm_batched_ex
+
+        D_i = alpha*op( A_i )*op( B_i ) + beta*C_i,  for i = 0, ..., batch_count - 1,
+
+    on matrices given by indices into pooled buffers rather than by arrays of pointers:
+
+        A_i = a + a_index[i]*stride_a,  B_i = b + b_index[i]*stride_b,
+        C_i = c + c_index[i]*stride_c,  D_i = d + d_index[i]*stride_d,
+
+    with the strides in elements of the types of the operands. A null index array takes the
+    index i for its operand, which is then strided as in gemm_strided_batched_ex. The index
+    arrays are in device memory and are read on the device when the call runs, so that the
+    batches of a paged cache can be gathered without pointer arrays built by the host. The
+    pointer arrays are formed in device memory of the handle, sizeof(void*)*4*batch_count bytes
+    in addition to the workspace of gemm_batched_ex. gemm_indexed_batched_ex takes int32_t
+    indices and gemm_indexed_batched_ex_i64 int64_t indices.
+
+    The other arguments are those of rocblas_gemm_batched_ex, and strides must not be negative.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_indexed_batched_ex(rocblas_handle    handle,
+                                                              rocblas_operation trans_a,
+                                                              rocblas_operation trans_b,
+                                                              rocblas_int       m,
+                                                              rocblas_int       n,
+                                                              rocblas_int       k,
+                                                              const void*       alpha,
+                                                              const void*       a,
+                                                              rocblas_datatype  a_type,
+                                                              rocblas_int       lda,
+                                                              rocblas_stride    stride_a,
+                                                              const int32_t*    a_index,
+                                                              const void*       b,
+                                                              rocblas_datatype  b_type,
+                                                              rocblas_int       ldb,
+                                                              rocblas_stride    stride_b,
+                                                              const int32_t*    b_index,
+                                                              const void*       beta,
+                                                              const void*       c,
+                                                              rocblas_datatype  c_type,
+                                                              rocblas_int       ldc,
+                                                              rocblas_stride    stride_c,
+                                                              const int32_t*    c_index,
+                                                              void*             d,
+                                                              rocblas_datatype  d_type,
+                                                              rocblas_int       ldd,
+                                                              rocblas_stride    stride_d,
+                                                              const int32_t*    d_index,
+                                                              rocblas_int       batch_count,
+                                                              rocblas_datatype  compute_type,
+                                                              rocblas_gemm_algo algo,
+                                                              int32_t           solution_index,
+                                                              uint32_t          flags);
+
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_indexed_batched_ex_i64(rocblas_handle    handle,
+                                                                  rocblas_operation trans_a,
+                                                                  rocblas_operation trans_b,
+                                                                  rocblas_int       m,
+                                                                  rocblas_int       n,
+                                                                  rocblas_int       k,
+                                                                  const void*       alpha,
+                                                                  const void*       a,
+                                                                  rocblas_datatype  a_type,
+                                                                  rocblas_int       lda,
+                                                                  rocblas_stride    stride_a,
+                                                                  const int64_t*    a_index,
+                                                                  const void*       b,
+                                                                  rocblas_datatype  b_type,
+                                                                  rocblas_int       ldb,
+                                                                  rocblas_stride    stride_b,
+                                                                  const int64_t*    b_index,
+                                                                  const void*       beta,
+                                                                  const void*       c,
+                                                                  rocblas_datatype  c_type,
+                                                                  rocblas_int       ldc,
+                                                                  rocblas_stride    stride_c,
+                                                                  const int64_t*    c_index,
+                                                                  void*             d,
+                                                                  rocblas_datatype  d_type,
+                                                                  rocblas_int       ldd,
+                                                                  rocblas_stride    stride_d,
+                                                                  const int64_t*    d_index,
+                                                                  rocblas_int       batch_count,
+                                                                  rocblas_datatype  compute_type,
+                                                                  rocblas_gemm_algo algo,
+                                                                  int32_t           solution_index,
+                                                                  uint32_t          flags);
+//! @}
+
+/*! \brief <b> BLAS BETA API </b>
+
+    \details
+    contraction_ex computes a tensor contraction
+
+        D = alpha*contraction(A, B) + beta*C,
+
+    given by its indices rather than by GEMM shapes, so that tensors of attention and
+    tensor-network workloads do not need to be permuted into GEMM layouts first. Each index has
+    a size and a stride in elements in each tensor it indexes: free_a indices index A, C and D,
+    free_b indices index B, C and D, bound indices index A and B and are summed over, and batch
+    indices index all four tensors. An index may be given a stride of 0 to broadcast a tensor
+    along it.
+
+    Indices of a kind which step through the tensors as one index would are merged. The
+    contraction is then computed by strided batched gemm_ex calls on the tensors in place: C and
+    D must be contiguous along a free index, A and B along a free or a bound index, and the
+    bound indices must merge into one. The other free and batch indices form the batch of the
+    GEMM, the largest one, or are looped over by the host. Contractions which cannot be mapped
+    onto GEMMs this way return rocblas_status_not_implemented.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    num_indices [int32_t]
+              number of indices.
+    @param[in]
+    indices   [const rocblas_contraction_index *]
+              host array of num_indices indices. Sizes and strides must not be negative.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha. Same datatype as compute_type.
+    @param[in]
+    a         [const void *]
+              device pointer storing tensor A.
+    @param[in]
+    a_type    [rocblas_datatype]
+              specifies the datatype of tensor A.
+    @param[in]
+    b         [const void *]
+              device pointer storing tensor B.
+    @param[in]
+    b_type    [rocblas_datatype]
+              specifies the datatype of tensor B.
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta. Same datatype as compute_type.
+    @param[in]
+    c         [const void *]
+              device pointer storing tensor C.
+    @param[in]
+    c_type    [rocblas_datatype]
+              specifies the datatype of tensor C.
+    @param[out]
+    d         [void *]
+              device pointer storing tensor D. If d and c are the same pointer, their strides
+              must be the same.
+    @param[in]
+    d_type    [rocblas_datatype]
+              specifies the datatype of tensor D.
+    @param[in]
+    compute_type
+              [rocblas_datatype]
+              specifies the datatype of computation.
+    @param[in]
+    algo      [rocblas_gemm_algo]
+              enumerant specifying the algorithm type.
+    @param[in]
+    solution_index
+              [int32_t]
+              if algo is rocblas_gemm_algo_solution_index, this controls which solution is used.
+    @param[in]
+    flags     [uint32_t]
+              optional gemm flags.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status
+    rocblas_contraction_ex(rocblas_handle                   handle,
+                           int32_t                          num_indices,
+                           const rocblas_contraction_index* indices,
+                           const void*                      alpha,
+                           const void*                      a,
+                           rocblas_datatype                 a_type,
+                           const void*                      b,
+                           rocblas_datatype                 b_type,
+                           const void*                      beta,
+                           const void*                      c,
+                           rocblas_datatype                 c_type,
+                           void*                            d,
+                           rocblas_datatype                 d_type,
+                           rocblas_datatype                 compute_type,
+                           rocblas_gemm_algo                algo,
+                           int32_t                          solution_index,
+                           uint32_t                         flags);
+
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    gemv_gathered_batched performs a batch of matrix-vector operations on rows gathered from a
+    table:
+
+        y_i := alpha * op(A_i) * x_i + beta * y_i,    i = 1, ..., batch_count,
+
+    where row r of the m by n matrix A_i is row index_i[r] of the column-major table A, and
+    op(A_i) is A_i, A_i**T or A_i**H. The rows are read from the table directly, as for the
+    embedding lookups of recommendation models, without gathering them into a strided batch of
+    matrices for gemv_strided_batched first.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    transA    [rocblas_operation]
+              indicates whether each A_i is transposed or conjugate transposed.
+    @param[in]
+    m         [rocblas_int]
+              number of rows of each matrix A_i, and of entries of each index_i.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of each matrix A_i and of the table A.
+    @param[in]
+    alpha     device pointer or host pointer specifying the scalar alpha.
+    @param[in]
+    A         device pointer storing the table of lda rows and n columns.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of the table, lda >= 1. Every index must be a
+              row of the table, so in [0, lda).
+    @param[in]
+    index     device pointer to the first index array index_1, of m row indices of the table.
+    @param[in]
+    stride_index [rocblas_stride]
+              stride from the start of one index array (index_i) to the next (index_i+1).
+    @param[in]
+    x         device pointer to the first vector x_1.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    stridex   [rocblas_stride]
+              stride from the start of one vector (x_i) to the next (x_i+1).
+    @param[in]
+    beta      device pointer or host pointer specifying the scalar beta.
+    @param[inout]
+    y         device pointer to the first vector y_1.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of each y_i.
+    @param[in]
+    stridey   [rocblas_stride]
+              stride from the start of one vector (y_i) to the next (y_i+1).
+    @param[in]
+    batch_count [rocblas_int]
+              number of instances in the batch.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sgemv_gathered_batched(rocblas_handle     handle,
+                                                             rocblas_operation  transA,
+                                                             rocblas_int        m,
+                                                             rocblas_int        n,
+                                                             const float*       alpha,
+                                                             const float*       A,
+                                                             rocblas_int        lda,
+                                                             const rocblas_int* index,
+                                                             rocblas_stride     stride_index,
+                                                             const float*       x,
+                                                             rocblas_int        incx,
+                                                             rocblas_stride     stridex,
+                                                             const float*       beta,
+                                                             float*             y,
+                                                             rocblas_int        incy,
+                                                             rocblas_stride     stridey,
+                                                             rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemv_gathered_batched(rocblas_handle     handle,
+                                                             rocblas_operation  transA,
+                                                             rocblas_int        m,
+                                                             rocblas_int        n,
+                                                             const double*      alpha,
+                                                             const double*      A,
+                                                             rocblas_int        lda,
+                                                             const rocblas_int* index,
+                                                             rocblas_stride     stride_index,
+                                                             const double*      x,
+                                                             rocblas_int        incx,
+                                                             rocblas_stride     stridex,
+                                                             const double*      beta,
+                                                             double*            y,
+                                                             rocblas_int        incy,
+                                                             rocblas_stride     stridey,
+                                                             rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_cgemv_gathered_batched(rocblas_handle               handle,
+                                   rocblas_operation            transA,
+                                   rocblas_int                  m,
+                                   rocblas_int                  n,
+                                   const rocblas_float_complex* alpha,
+                                   const rocblas_float_complex* A,
+                                   rocblas_int                  lda,
+                                   const rocblas_int*           index,
+                                   rocblas_stride               stride_index,
+                                   const rocblas_float_complex* x,
+                                   rocblas_int                  incx,
+                                   rocblas_stride               stridex,
+                                   const rocblas_float_complex* beta,
+                                   rocblas_float_complex*       y,
+                                   rocblas_int                  incy,
+                                   rocblas_stride               stridey,
+                                   rocblas_int                  batch_count);
+
+ROCBLAS_EXPORT rocblas_status
+    rocblas_zgemv_gathered_batched(rocblas_handle                handle,
+                                   rocblas_operation             transA,
+                                   rocblas_int                   m,
+                                   rocblas_int                   n,
+                                   const rocblas_double_complex* alpha,
+                                   const rocblas_double_complex* A,
+                                   rocblas_int                   lda,
+                                   const rocblas_int*            index,
+                                   rocblas_stride                stride_index,
+                                   const rocblas_double_complex* x,
+                                   rocblas_int                   incx,
+                                   rocblas_stride                stridex,
+                                   const rocblas_double_complex* beta,
+                                   rocblas_double_complex*       y,
+                                   rocblas_int                   incy,
+                                   rocblas_stride                stridey,
+                                   rocblas_int                   batch_count);
+//! @}
+
 #ifdef __cplusplus
 }
 #endif
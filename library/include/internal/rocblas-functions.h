@@ -21142,6 +21142,10 @@ ROCBLAS_EXPORT rocblas_status rocblas_zdgmm_strided_batched_64(rocblas_handle
         alpha and beta are scalars, and A, B and C are matrices, with
         op( A ) an m by n matrix, op( B ) an m by n matrix, and C an m by n matrix.
 
+        C may be the same matrix as A (or B) if ldc == lda (or ldb). For such an in-place
+        operation op( A ) (or op( B )) may be a transpose only if m == n, and not for both
+        A and B.
+
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
@@ -21819,6 +21823,15 @@ ROCBLAS_EXPORT rocblas_status rocblas_zgeam_strided_batched_64(rocblas_handle
     @param[in]
     algo      [rocblas_gemm_algo]
               enumerant specifying the algorithm type.
+              With rocblas_gemm_algo_3m, complex problems with all datatypes and the compute type
+              equal are computed as three real gemms on the real and imaginary parts of op( A )
+              and op( B ), with 25% fewer flops, using device memory for 3*(m*k + k*n + m*n) real
+              values. The real part of the result is as accurate as with the complex gemm, but
+              the error of the imaginary part is bounded relative to
+              (|Re(op( A ))| + |Im(op( A ))|)*(|Re(op( B ))| + |Im(op( B ))|) instead of
+              |op( A )|*|op( B )|, which is larger when the imaginary part of the result is small
+              compared with its terms. Other problems, or problems for which the device memory is
+              not available, are computed as with rocblas_gemm_algo_standard.
     @param[in]
     solution_index
               [int32_t]
@@ -22105,6 +22118,132 @@ ROCBLAS_EXPORT rocblas_status rocblas_gemm_batched_ex_64(rocblas_handle    handl
                                                          uint32_t          flags);
 //! @}
 
+/*! \brief <b> BLAS EX API </b>
+
+    \details
+    gemm_grouped_ex performs a group of batched matrix-matrix operations, where the size of the
+    problems may differ between groups:
+        D_gi = alpha_g*op(A_gi)*op(B_gi) + beta_g*C_gi, for i = 1, ..., group_size[g],
+                                                     and g = 1, ..., group_count.
+    All problems of a group have the same transposes, sizes and leading dimensions, so each
+    group is a shape class which runs as a single batched launch. The supported types are those
+    of gemm_batched_ex.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    group_count
+              [rocblas_int]
+              number of groups.
+    @param[in]
+    transA    [const rocblas_operation *]
+              host array of group_count operations specifying the form of op( A ) of each group.
+    @param[in]
+    transB    [const rocblas_operation *]
+              host array of group_count operations specifying the form of op( B ) of each group.
+    @param[in]
+    m         [const rocblas_int *]
+              host array of group_count matrix dimensions m.
+    @param[in]
+    n         [const rocblas_int *]
+              host array of group_count matrix dimensions n.
+    @param[in]
+    k         [const rocblas_int *]
+              host array of group_count matrix dimensions k.
+    @param[in]
+    alpha     [const void *]
+              device or host array of group_count scalars alpha, one per group.
+              Same datatype as compute_type.
+    @param[in]
+    a         [void *]
+              device array of pointers to each matrix A_gi, ordered by group. The array holds
+              the sum of group_size pointers.
+    @param[in]
+    a_type    [rocblas_datatype]
+              specifies the datatype of each matrix A_gi.
+    @param[in]
+    lda       [const rocblas_int *]
+              host array of group_count leading dimensions of A_gi.
+    @param[in]
+    b         [void *]
+              device array of pointers to each matrix B_gi, ordered by group.
+    @param[in]
+    b_type    [rocblas_datatype]
+              specifies the datatype of each matrix B_gi.
+    @param[in]
+    ldb       [const rocblas_int *]
+              host array of group_count leading dimensions of B_gi.
+    @param[in]
+    beta      [const void *]
+              device or host array of group_count scalars beta, one per group.
+              Same datatype as compute_type.
+    @param[in]
+    c         [void *]
+              device array of pointers to each matrix C_gi, ordered by group.
+    @param[in]
+    c_type    [rocblas_datatype]
+              specifies the datatype of each matrix C_gi.
+    @param[in]
+    ldc       [const rocblas_int *]
+              host array of group_count leading dimensions of C_gi.
+    @param[out]
+    d         [void *]
+              device array of pointers to each matrix D_gi, ordered by group.
+    @param[in]
+    d_type    [rocblas_datatype]
+              specifies the datatype of each matrix D_gi.
+    @param[in]
+    ldd       [const rocblas_int *]
+              host array of group_count leading dimensions of D_gi.
+    @param[in]
+    group_size
+              [const rocblas_int *]
+              host array of group_count numbers of problems in each group.
+    @param[in]
+    compute_type
+              [rocblas_datatype]
+              specifies the datatype of computation.
+    @param[in]
+    algo      [rocblas_gemm_algo]
+              enumerant specifying the algorithm type.
+    @param[in]
+    solution_index
+              [int32_t]
+              if algo is rocblas_gemm_algo_solution_index, this controls which solution is used
+              for every group.
+    @param[in]
+    flags     [uint32_t]
+              optional gemm flags.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_grouped_ex(rocblas_handle           handle,
+                                                      rocblas_int              group_count,
+                                                      const rocblas_operation* transA,
+                                                      const rocblas_operation* transB,
+                                                      const rocblas_int*       m,
+                                                      const rocblas_int*       n,
+                                                      const rocblas_int*       k,
+                                                      const void*              alpha,
+                                                      const void*              a,
+                                                      rocblas_datatype         a_type,
+                                                      const rocblas_int*       lda,
+                                                      const void*              b,
+                                                      rocblas_datatype         b_type,
+                                                      const rocblas_int*       ldb,
+                                                      const void*              beta,
+                                                      const void*              c,
+                                                      rocblas_datatype         c_type,
+                                                      const rocblas_int*       ldc,
+                                                      void*                    d,
+                                                      rocblas_datatype         d_type,
+                                                      const rocblas_int*       ldd,
+                                                      const rocblas_int*       group_size,
+                                                      rocblas_datatype         compute_type,
+                                                      rocblas_gemm_algo        algo,
+                                                      int32_t                  solution_index,
+                                                      uint32_t                 flags);
+
 /*! @{
     \brief <b> BLAS EX API </b>
 
@@ -24980,6 +25119,104 @@ ROCBLAS_EXPORT const char* rocblas_status_to_string(rocblas_status status);
  ******************************************************************************/
 ROCBLAS_EXPORT void rocblas_initialize(void);
 
+/*! \brief Initialize rocBLAS on a set of HIP devices, loading only what is needed.
+    \details
+    Like rocblas_initialize, but for each device whose bit is set in device_mask, and loading
+    only the code objects of GEMM-like kernels with the given datatypes of the A matrix, plus the
+    code objects which are not specific to a datatype. Devices which were already initialized
+    are not initialized again. Other devices keep being initialized on first use.
+    The devices are initialized concurrently, one thread per device, and share the Tensile host
+    library, which is only deserialized once, so initializing several devices takes about as
+    long as initializing one.
+    Filtering by datatype applies to Tensile lazy-loading libraries; libraries which store all
+    kernels in one code object are loaded completely.
+    @param[in]
+    device_mask   bit i selects HIP device i.
+    @param[in]
+    types         datatypes of the A matrix of the kernels to load. May be nullptr if
+                  type_count is 0.
+    @param[in]
+    type_count    number of entries of types, or 0 to load the kernels of all datatypes.
+    @param[out]
+    seconds       time spent initializing. May be nullptr.
+    @param[out]
+    bytes_loaded  total size of the code object files loaded. May be nullptr.
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_initialize_ex(uint64_t                device_mask,
+                                                    const rocblas_datatype* types,
+                                                    rocblas_int             type_count,
+                                                    double*                 seconds,
+                                                    size_t*                 bytes_loaded);
+
+/*! \brief Get the host time spent initializing Tensile, by phase
+    \details
+    rocBLAS initializes Tensile for a device in rocblas_initialize, rocblas_initialize_ex or the
+    first GEMM-like call on the device. This reports the time spent in each phase of those
+    initializations since the process started, summed over devices: locating the library files,
+    filling the code object cache, querying the devices, deserializing the library (on a
+    background thread, overlapping the other phases) and waiting for it, loading code objects
+    and seeding the solution selection cache. Code objects loaded lazily by later calls are not
+    included. While ROCBLAS_LAYER enables the trace log, the times of each device are also
+    written to it as a rocblas_tensile_startup line once the device is initialized.
+    @param[out]
+    times     the startup times.
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_startup_times(rocblas_startup_times* times);
+
+/*! \brief Get the statistics of the solution selection cache
+    \details
+    GEMM-like functions backed by Tensile cache the solution selected for a problem, per device,
+    so that repeated problems do not select a solution again. This reports the number of cache
+    hits and misses on the device of the handle since the process started.
+    @param[in]
+    handle    the handle
+    @param[out]
+    hits      number of problems whose solution was found in the cache. May be nullptr.
+    @param[out]
+    misses    number of problems whose solution had to be selected. May be nullptr.
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_solution_cache_stats(rocblas_handle handle,
+                                                               size_t*        hits,
+                                                               size_t*        misses);
+
+/*! \brief Set the file which persists solution selections across processes
+    \details
+    While a solution cache file is set, solutions selected for new problems are appended to it
+    together with the code object files their kernels come from, their workspace size and
+    their name. When rocBLAS initializes a
+    device, the code objects recorded for its architecture are loaded and the solution
+    selection cache is seeded from the file, so a process which restarts with a known set of
+    problems does not have to load code objects or select solutions again on first use.
+    The file can also be set with the environment variable ROCBLAS_TENSILE_SOLUTION_CACHE_FILE.
+    Seeding only applies to devices which are initialized after the file is set, so it should
+    be set before rocblas_initialize or the first function call.
+    @param[in]
+    path      path of the file, or nullptr to stop recording
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_set_solution_cache_file(const char* path);
+
+/*! \brief Write the solution index of a solution cache file
+    \details
+    The solution index holds the selections of a solution cache file in a flat binary form,
+    sorted for lookup. When the environment variable ROCBLAS_TENSILE_SOLUTION_INDEX names an
+    index file, rocBLAS memory-maps it read-only and searches it in place whenever a problem is
+    not in the solution selection cache, loading the code objects of a selection the first time
+    it is used on a device. Unlike the solution cache file it is not parsed at startup, and all
+    processes of a node share its pages, so a large set of known problems costs neither startup
+    time nor memory per process. Later lines of the cache file take precedence over earlier ones
+    for the same problem. The index is written to a temporary file and renamed, so it can be
+    rebuilt while processes are using it; they keep the index they mapped.
+    The workspace sizes recorded in the index are taken as they are, so that a problem found in
+    it goes from its signature to the launch of its kernels without asking the library again.
+    rocblas-gemm-tune --plan writes the index of a list of problems ahead of time.
+    @param[in]
+    cache_file  path of a solution cache file, see \ref rocblas_set_solution_cache_file
+    @param[in]
+    index_file  path of the index to write
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_build_solution_index(const char* cache_file,
+                                                           const char* index_file);
+
 /*
  * ===========================================================================
  *    build information
@@ -25068,6 +25305,23 @@ ROCBLAS_EXPORT void           rocblas_device_malloc_set_default_memory_size(size
  ******************************************************************************/
 ROCBLAS_EXPORT rocblas_status rocblas_get_device_memory_size(rocblas_handle handle, size_t* size);
 
+/*! \brief
+    \details
+    Gets the largest device workspace requirement of the problems seen so far by the handle.
+
+    The workspace requirements of Tensile-backed functions (such as gemm) and of trsm are memoized
+    per problem signature, both by size queries and by real calls. Repeated size queries of a
+    problem seen before are answered from this cache, and reallocation of rocBLAS-managed device
+    memory grows it to at least this size, so no dry run is needed to pre-size the workspace.
+    Returns rocblas_status_invalid_handle if handle is nullptr; rocblas_status_invalid_pointer if size is nullptr; rocblas_status_success otherwise
+    @param[in]
+    handle          rocblas handle
+    @param[out]
+    size            largest memoized device workspace requirement for the handle
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_cached_device_memory_size(rocblas_handle handle,
+                                                                    size_t*        size);
+
 /*! \brief
     \details
     Changes the size of allocated device memory at runtime.
@@ -25103,6 +25357,85 @@ ROCBLAS_EXPORT rocblas_status rocblas_set_device_memory_size(rocblas_handle hand
  ******************************************************************************/
 ROCBLAS_EXPORT rocblas_status rocblas_set_workspace(rocblas_handle handle, void* addr, size_t size);
 
+/*! \brief
+    \details
+    Enables or disables the size-classed device memory pool of the handle.
+
+    When enabled and device memory is rocBLAS-managed, a workspace request which does not fit in the
+    handle's device memory while it is in use is served from a pool of power-of-two sized arenas,
+    instead of failing. Arenas are reused by later calls and are folded back into a single block of
+    device memory, sized to the high-water mark, once no workspace is in use.
+    The pool can also be enabled with the environment variable ROCBLAS_DEVICE_MEMORY_POOL=1.
+
+    Returns rocblas_status_invalid_handle if handle is nullptr; rocblas_status_internal_error if the pool is disabled while in use; rocblas_status_success otherwise
+    @param[in]
+    handle          rocblas handle
+    @param[in]
+    enable          true to enable the pool, false to disable it and release its arenas
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_device_memory_pool(rocblas_handle handle, bool enable);
+
+/*! \brief
+    \details
+    Enables or disables the reservation of device memory for graph capture.
+
+    Allocating device memory while a stream is being captured into a HIP graph is invalid. When
+    enabled and device memory is rocBLAS-managed, the device memory of the handle is grown right
+    away, and again by rocblas_set_stream when the new stream is not being captured, so that it
+    holds at least the largest workspace requirement memoized by the handle (see
+    rocblas_get_cached_device_memory_size) and at least the default size. Running a sequence
+    once before capturing it therefore reserves what its calls need. While the stream is being
+    captured the handle then never allocates: a call whose workspace does not fit in the
+    reserved device memory returns rocblas_status_memory_error, and is recorded in the graph
+    capture audit (see rocblas_get_graph_capture_audit). Stream-ordered allocation is not
+    affected.
+
+    Returns rocblas_status_invalid_handle if handle is nullptr; rocblas_status_invalid_value if the stream is being captured when the reservation is enabled; rocblas_status_memory_error if the device memory cannot be reserved; rocblas_status_success otherwise
+    @param[in]
+    handle          rocblas handle
+    @param[in]
+    enable          true to reserve device memory and forbid allocation during capture
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_capture_workspace_reserve(rocblas_handle handle,
+                                                                    bool           enable);
+
+/*! \brief
+    \details
+    Sets the memory pool and release threshold used by the handle for stream-ordered allocation.
+
+    When stream-ordered allocation is enabled with the environment variable
+    ROCBLAS_STREAM_ORDER_ALLOC=1, and device memory is rocBLAS-managed, the temporary device memory
+    of each call is allocated from pool with hipMallocFromPoolAsync, instead of from the device's
+    default memory pool. A pool shared with the application is not trimmed when the handle is
+    destroyed. A nonzero release_threshold is set as the hipMemPoolAttrReleaseThreshold attribute of
+    pool, or of the device's default memory pool if pool is nullptr, so that up to that many bytes
+    stay reserved across synchronizations, rather than being released to the OS and re-faulted by
+    the next burst of calls. A release_threshold of 0 leaves the pool's threshold unchanged.
+
+    Returns rocblas_status_invalid_handle if handle is nullptr; rocblas_status_not_implemented if HIP does not support stream-ordered allocation; rocblas_status_success otherwise
+    @param[in]
+    handle              rocblas handle
+    @param[in]
+    pool                memory pool to allocate from, or nullptr for the device's default pool
+    @param[in]
+    release_threshold   release threshold in bytes to set on the pool, or 0 to leave it unchanged
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_stream_order_memory_pool(rocblas_handle handle,
+                                                                   hipMemPool_t   pool,
+                                                                   uint64_t release_threshold);
+
+/*! \brief
+    \details
+    Gets the largest amount of device memory (in bytes) used at once by the handle, including pool arenas.
+    Returns rocblas_status_invalid_handle if handle is nullptr; rocblas_status_invalid_pointer if size is nullptr; rocblas_status_success otherwise
+    @param[in]
+    handle          rocblas handle
+    @param[out]
+    size            high-water mark of device memory use for the handle
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_device_memory_high_water_mark(rocblas_handle handle,
+                                                                        size_t*        size);
+
 /*! \brief
     \details
     Returns true when device memory in handle is managed by rocBLAS
@@ -62,6 +62,19 @@
  */
 typedef struct _rocblas_handle* rocblas_handle;
 
+/*! \brief rocblas_plan is a chain of rocBLAS calls recorded on a handle
+ * between rocblas_plan_begin() and rocblas_plan_end(), which is replayed with
+ * rocblas_plan_launch(). It should be destroyed using rocblas_plan_destroy().
+ */
+typedef struct _rocblas_plan* rocblas_plan;
+
+/*! \brief rocblas_handle_pool is a bounded set of handles lent to threads with
+ * rocblas_handle_pool_acquire() and returned with rocblas_handle_pool_release().
+ * It must be created using rocblas_create_handle_pool() and destroyed using
+ * rocblas_destroy_handle_pool().
+ */
+typedef struct _rocblas_handle_pool* rocblas_handle_pool;
+
 /*! \brief Forward declaration of hipStream_t */
 typedef struct ihipStream_t* hipStream_t;
 
@@ -157,6 +170,13 @@ typedef enum rocblas_side_
     rocblas_side_both  = 143
 } rocblas_side;
 
+/*! \brief Indicates the order of the elements of matrices, see rocblas_set_order. */
+typedef enum rocblas_order_
+{
+    rocblas_order_row_major    = 101, /**< Rows are contiguous. */
+    rocblas_order_column_major = 102, /**< Columns are contiguous, the default. */
+} rocblas_order;
+
 /*! Parameter constants.
  *  Numbering continues into next free decimal range but not shared with other BLAS libraries
  */
@@ -242,8 +262,28 @@ typedef enum rocblas_atomics_mode_
     rocblas_atomics_not_allowed = 0,
     /*! \brief Algorithms will take advantage of atomics where applicable */
     rocblas_atomics_allowed = 1,
+    /*! \brief Algorithms will use atomics only where results stay bit-wise reproducible, such as
+     *   to elect the block finishing a multi-block reduction, and will reduce partial results
+     *   in a fixed order */
+    rocblas_atomics_deterministic = 2,
 } rocblas_atomics_mode;
 
+/*! \brief Operands which the source kernels of rocBLAS functions load and store with nontemporal
+*    memory accesses, so that operands streamed through once do not evict the data of other
+*    kernels from the caches. The values can be combined with bitwise or.
+*    Defaults to rocblas_cache_policy_default.  */
+typedef enum rocblas_cache_policy_
+{
+    /*! \brief All operands are accessed through the caches */
+    rocblas_cache_policy_default = 0x0,
+    /*! \brief Vector x is streamed, e.g. by axpy and copy */
+    rocblas_cache_policy_stream_x = 0x1,
+    /*! \brief Vector y is streamed, e.g. by axpy and copy */
+    rocblas_cache_policy_stream_y = 0x2,
+    /*! \brief Matrix A is streamed, e.g. by gemv with rocblas_operation_none */
+    rocblas_cache_policy_stream_a = 0x4,
+} rocblas_cache_policy;
+
 /*! \brief Indicates which performance metric Tensile uses when selecting the optimal
 *    solution for gemm problems.  */
 typedef enum rocblas_performance_metric_
@@ -254,9 +294,26 @@ typedef enum rocblas_performance_metric_
     rocblas_device_efficiency_performance_metric = 1,
     /*! \brief Select the solution with the highest GFlops per compute unit it uses. This
      * may be useful when running multiple small gemm problems simultaneously  */
-    rocblas_cu_efficiency_performance_metric = 2
+    rocblas_cu_efficiency_performance_metric = 2,
+    /*! \brief Select the solution with the lowest kernel time observed for the problem. The
+     * predicted solution and a few alternatives are timed as the problem is run, and the
+     * fastest is used from then on, with an occasional re-timing of the others  */
+    rocblas_measured_performance_metric = 3
 } rocblas_performance_metric;
 
+/*! \brief Indicates which library runs the GEMM problems of Tensile-backed functions, see
+*    rocblas_set_gemm_backend  */
+typedef enum rocblas_gemm_backend_
+{
+    /*! \brief Run all problems with Tensile */
+    rocblas_gemm_backend_tensile = 0,
+    /*! \brief Run the problems hipBLASLt supports with hipBLASLt, when it can be loaded */
+    rocblas_gemm_backend_hipblaslt = 1,
+    /*! \brief Choose per problem shape, from the tuning table of ROCBLAS_GEMM_BACKEND_TABLE or
+     * by timing both libraries when autotuning is enabled, and otherwise use Tensile  */
+    rocblas_gemm_backend_auto = 2
+} rocblas_gemm_backend;
+
 /*! \brief Indicates if layer is active with bitmask*/
 typedef enum rocblas_layer_mode_
 {
@@ -268,6 +325,10 @@ typedef enum rocblas_layer_mode_
     rocblas_layer_mode_log_bench = 0x2,
     /*! \brief Outputs a YAML description of each rocBLAS function called, along with its arguments and number of times it was called. */
     rocblas_layer_mode_log_profile = 0x4,
+    /*! \brief Pushes a roctx range named with the function and its sizes around each rocBLAS function call, and ranges around its internal phases, for use with rocprof and omnitrace. The ranges are pushed when libroctx64 can be loaded. */
+    rocblas_layer_mode_roctx = 0x8,
+    /*! \brief Outputs a YAML description of each Tensile solution selection, with the problem, the chosen solution and its predicted fitness, how it was chosen, and alternative candidate solutions. */
+    rocblas_layer_mode_log_explain = 0x10,
 } rocblas_layer_mode;
 
 /*! \brief Indicates if layer is active with bitmask*/
@@ -275,6 +336,8 @@ typedef enum rocblas_gemm_algo_
 {
     rocblas_gemm_algo_standard       = 0x0,
     rocblas_gemm_algo_solution_index = 0x1,
+    /*! \brief Complex gemm_ex as three real gemms (3M method), see rocblas_gemm_ex */
+    rocblas_gemm_algo_3m = 0x2,
 } rocblas_gemm_algo;
 
 /*! \brief Which mathematical geam-like operation to perform for geam_ex */
@@ -303,9 +366,141 @@ typedef enum rocblas_gemm_flags_
     rocblas_gemm_flags_fp16_alt_impl        = 0x4,
     rocblas_gemm_flags_check_solution_index = 0x8,
     rocblas_gemm_flags_fp16_alt_impl_rnz    = 0x10,
-    rocblas_gemm_flags_stochastic_rounding  = 0x20
+    rocblas_gemm_flags_stochastic_rounding  = 0x20,
+    /*! \brief Split the K dimension of gemm_ex problems into slices which are computed in
+    * parallel and reduced deterministically, using device memory of the handle for the partial
+    * results. By default rocBLAS only splits problems whose M and N are too small to occupy the
+    * device. Only non-batched problems are split. */
+    rocblas_gemm_flags_split_k = 0x40
 } rocblas_gemm_flags;
 
+/*! \brief Bias vector added by a gemm epilogue, see rocblas_set_gemm_epilogue */
+typedef enum rocblas_gemm_epilogue_bias_
+{
+    rocblas_gemm_epilogue_bias_none = 0x0,
+    /*! \brief One bias value per row of D, a vector of length m */
+    rocblas_gemm_epilogue_bias_row = 0x1,
+    /*! \brief One bias value per column of D, a vector of length n */
+    rocblas_gemm_epilogue_bias_column = 0x2,
+} rocblas_gemm_epilogue_bias;
+
+/*! \brief Activation applied elementwise by a gemm epilogue, see rocblas_set_gemm_epilogue */
+typedef enum rocblas_gemm_epilogue_activation_
+{
+    rocblas_gemm_epilogue_activation_none = 0x0,
+    /*! \brief max(x, 0) */
+    rocblas_gemm_epilogue_activation_relu = 0x1,
+    /*! \brief GELU, tanh approximation */
+    rocblas_gemm_epilogue_activation_gelu = 0x2,
+} rocblas_gemm_epilogue_activation;
+
+/*! \brief Epilogue applied to the result of gemm_ex and gemm_strided_batched_ex:
+    D = activation(diag(scale_row)*(alpha*op(A)*op(B) + beta*C)*diag(scale_column) + bias).
+    The bias, scale vectors and aux matrix have the datatype of D. If aux is not NULL, the value
+    before the activation is also stored in aux. */
+typedef struct rocblas_gemm_epilogue_
+{
+    rocblas_gemm_epilogue_bias       bias_mode;
+    const void*                      bias; // device pointer
+    rocblas_stride                   stride_bias; // between batches
+    rocblas_gemm_epilogue_activation activation;
+    void*                            aux; // optional device pointer
+    int64_t                          ldaux;
+    rocblas_stride                   stride_aux; // between batches
+    const void*                      scale_row; // optional device pointer, contiguous
+    rocblas_stride                   stride_scale_row; // between batches
+    const void*                      scale_column; // optional device pointer, contiguous
+    rocblas_stride                   stride_scale_column; // between batches
+} rocblas_gemm_epilogue;
+
+/*! \brief Quantization scales applied by gemm_ex3, see rocblas_set_gemm_ex3_scales:
+    D = scale_d*(alpha*diag(scale_a)*op(A)*op(B)*diag(scale_b) + beta*C), with one scale_a value
+    per block_a rows of op(A) and one scale_b value per block_b columns of op(B). If amax_d is not
+    NULL it receives max|D| over all batches, before D is rounded to its datatype. */
+typedef struct rocblas_gemm_ex3_scales_
+{
+    const float*   scale_a; // optional device pointer, contiguous
+    int64_t        block_a; // rows of op(A) sharing a scale
+    rocblas_stride stride_scale_a; // between batches
+    const float*   scale_b; // optional device pointer, contiguous
+    int64_t        block_b; // columns of op(B) sharing a scale
+    rocblas_stride stride_scale_b; // between batches
+    const float*   scale_d; // optional device pointer to a single value
+    float*         amax_d; // optional device pointer to a single value
+} rocblas_gemm_ex3_scales;
+
+/*! \brief Scalars of each batch of gemm_batched_ex and gemm_strided_batched_ex, see
+    rocblas_set_gemm_batch_scalars: batch i computes
+    D_i = alpha[i*stride_alpha]*op(A_i)*op(B_i) + beta[i*stride_beta]*C_i, in the compute type. */
+typedef struct rocblas_gemm_batch_scalars_
+{
+    const void*    alpha; // device pointer
+    rocblas_stride stride_alpha; // between batches
+    const void*    beta; // device pointer
+    rocblas_stride stride_beta; // between batches
+} rocblas_gemm_batch_scalars;
+
+/*! \brief Kind of an index of rocblas_contraction_ex, given by the tensors it indexes */
+typedef enum rocblas_contraction_index_kind_
+{
+    /*! \brief Free index of A, C and D */
+    rocblas_contraction_index_free_a = 0x0,
+    /*! \brief Free index of B, C and D */
+    rocblas_contraction_index_free_b = 0x1,
+    /*! \brief Bound index of A and B, summed over */
+    rocblas_contraction_index_bound = 0x2,
+    /*! \brief Batch index of A, B, C and D */
+    rocblas_contraction_index_batch = 0x3,
+} rocblas_contraction_index_kind;
+
+/*! \brief An index of rocblas_contraction_ex, with its size and its strides in elements in the
+    tensors it indexes. The strides in the other tensors are ignored. */
+typedef struct rocblas_contraction_index_
+{
+    rocblas_contraction_index_kind kind;
+    int64_t                        size;
+    rocblas_stride                 stride_a;
+    rocblas_stride                 stride_b;
+    rocblas_stride                 stride_c;
+    rocblas_stride                 stride_d;
+} rocblas_contraction_index;
+
+/*! \brief Cumulative counters of the calls made with a handle, see rocblas_get_handle_stats.
+    They count from the creation of the handle or the last rocblas_reset_handle_stats. */
+typedef struct rocblas_handle_stats_
+{
+    uint64_t api_calls; // rocBLAS functions called, see rocblas_get_handle_function_calls
+    uint64_t kernel_launches; // kernels launched by them
+    uint64_t tensile_selections; // Tensile solutions selected, not found in the solution cache
+    uint64_t tensile_selection_ns; // host time spent selecting them
+    uint64_t solution_cache_hits; // Tensile solutions found in the solution cache
+    uint64_t solution_cache_misses; // Tensile solutions the solution cache did not have
+    uint64_t workspace_allocations; // device memory allocations for workspace
+    uint64_t workspace_allocation_bytes; // bytes of device memory they allocated
+    uint64_t host_syncs; // times the host waited for the stream of the handle
+    uint64_t source_gemm_calls; // gemm computed by the source kernels instead of Tensile
+    uint64_t tensile_xf32_fallbacks; // xf32 gemm computed in f32, lacking an xf32 solution
+    uint64_t hipblaslt_gemm_calls; // gemm run by hipBLASLt, see rocblas_set_gemm_backend
+    uint64_t pointer_cache_hits; // pointers classified by the cache of the handle
+    uint64_t pointer_cache_misses; // pointers the cache did not have, classified by the driver
+} rocblas_handle_stats;
+
+/*! \brief Host time spent by rocBLAS initializing Tensile, in nanoseconds and summed over the
+    devices initialized so far, see rocblas_get_startup_times. */
+typedef struct rocblas_startup_times_
+{
+    uint64_t device_initializations; // devices whose Tensile library and adapter were initialized
+    uint64_t total_ns; // whole initialization of those devices, including the phases below
+    uint64_t path_discovery_ns; // locating the library files (dl_iterate_phdr, TestPath)
+    uint64_t code_object_cache_ns; // filling ROCBLAS_TENSILE_CODE_OBJECT_CACHE_DIR
+    uint64_t hardware_query_ns; // querying the device properties used for solution selection
+    uint64_t library_load_ns; // deserializing the library files, on a background thread
+    uint64_t library_wait_ns; // waiting for the library to be deserialized
+    uint64_t code_object_load_ns; // finding and loading code objects at initialization
+    uint64_t code_objects_loaded; // code objects loaded at initialization
+    uint64_t solution_cache_seed_ns; // seeding the selection cache from the solution cache file
+} rocblas_startup_times;
+
 /*! \brief Union for representing scalar values */
 typedef union rocblas_union_u
 {
@@ -317,6 +512,20 @@ typedef union rocblas_union_u
     rocblas_double_complex z;
 } rocblas_union_t;
 
+/*! \brief Epilogue applied to the result of gemv and gemv_strided_batched:
+    y = activation(alpha*op(A)*x + beta*y + bias + gamma*z), see rocblas_set_gemv_epilogue.
+    bias, z and gamma have the datatype of y. */
+typedef struct rocblas_gemv_epilogue_
+{
+    const void*                      bias; // optional device pointer, contiguous
+    rocblas_stride                   stride_bias; // between batches
+    const void*                      z; // optional device pointer
+    int64_t                          incz;
+    rocblas_stride                   stride_z; // between batches
+    rocblas_union_t                  gamma; // scalar of z
+    rocblas_gemm_epilogue_activation activation;
+} rocblas_gemv_epilogue;
+
 /*! \brief Numerical checking for verifying the Input and Output vector/matrix of the rocBLAS functions for a NaN, zero, infinity and denormal value*/
 typedef enum rocblas_check_numerics_mode_
 {
@@ -335,6 +544,17 @@ typedef enum rocblas_check_numerics_mode_
     //Limits checks to NaN and infinities
     rocblas_check_numerics_mode_only_nan_inf = 0x8,
 
+    //Accumulates the results of the checks on the device without waiting for them. They are
+    //reported and cleared by rocblas_get_check_numerics_status
+    rocblas_check_numerics_mode_async = 0x10,
+
+    //Checks only one call of the handle in 2^k, where k is the value of these bits (bits 8 to 11)
+    rocblas_check_numerics_mode_sample_calls = 0xf00,
+
+    //Checks only one tile of 16 by 16 elements in 2^k of each matrix, where k is the value of these
+    //bits (bits 12 to 15). The sampled tiles change from call to call.
+    rocblas_check_numerics_mode_sample_tiles = 0xf000,
+
 } rocblas_check_numerics_mode;
 
 typedef enum rocblas_math_mode_
@@ -345,6 +565,10 @@ typedef enum rocblas_math_mode_
     //Enable acceleration of single precision routines using XF32 xDL.
     rocblas_xf32_xdl_math_op = 0x1,
 
+    //Emulate dgemm with int8 gemms on slices of the operands (Ozaki scheme),
+    //see rocblas_set_ozaki_slices
+    rocblas_dgemm_ozaki_math_op = 0x2,
+
 } rocblas_math_mode;
 
 #endif /* ROCBLAS_TYPES_H */
@@ -74,12 +74,16 @@
 #define ROCBLAS_ZSYR2K_NB 16
 #define ROCBLAS_CHER2K_NB 32
 #define ROCBLAS_ZHER2K_NB 16
+#define ROCBLAS_SYR2K_SMALL_BATCHED_MAX_N 32
+#define ROCBLAS_SYR2K_SMALL_BATCHED_DIM 256
 
 #define ROCBLAS_SDTRMM_NB 32
 #define ROCBLAS_CZTRMM_NB 16
 #define ROCBLAS_TRMM_OUTOFPLACE_NB 512
 
 #define ROCBLAS_TRSM_NB 128
+#define ROCBLAS_TRSM_SKINNY_NB 32
+#define ROCBLAS_TRSM_SKINNY_MAX_RHS 8
 #define ROCBLAS_TRTRI_NB 16
 #define ROCBLAS_TRSV_EX_NB 128
 
@@ -27,6 +27,7 @@
 #include "int64_helpers.hpp"
 #include "rocblas.h"
 #include "rocblas_asum_nrm2.hpp"
+#include "roctx_ranges.hpp"
 
 /*
  * ===========================================================================
@@ -71,8 +72,12 @@
 // As you may see, if there is a mechanism to synchronize all the thread blocks
 // after local index is obtained in kernel 1 (without ending the kernel), then
 // Kernel 2's computation can be merged into Kernel 1. One such mechanism is called
-// atomic operation. However, atomic operation is new and is not used in rocBLAS
-// yet. rocBLAS still use the classic standard parallel reduction right now.
+// atomic operation: each thread block takes a ticket from an atomic counter after writing
+// its local result, and the thread block taking the last ticket performs Kernel 2's work.
+// rocBLAS uses this single kernel form unless the atomics mode of the handle is
+// rocblas_atomics_not_allowed, and the classic two kernel reduction otherwise. Both reduce
+// the partial results in the same fixed order, so the single kernel form is also used with
+// rocblas_atomics_deterministic.
 
 // kernel 1 writes partial results per thread block in workspace; number of partial results is
 // blocks
@@ -103,12 +108,10 @@ rocblas_reduction_kernel_part1(rocblas_int    n,
         workspace[blockIdx.y * nblocks + blockIdx.x] = sum;
 }
 
-// kernel 2 is used from non-strided reduction_batched see include file
-// kernel 2 gathers all the partial results in workspace and finishes the final reduction;
+// gathers all the partial results of a batch in workspace and finishes the final reduction;
 // number of threads (NB) loop blocks
 template <int NB, typename FINALIZE, typename To, typename Tr>
-ROCBLAS_KERNEL(NB)
-rocblas_reduction_kernel_part2(rocblas_int nblocks, To* workspace, Tr* result)
+__inline__ __device__ void rocblas_reduction_finish(rocblas_int nblocks, To* workspace, Tr* result)
 {
     rocblas_int tx = threadIdx.x;
     To          sum;
@@ -134,14 +137,100 @@ rocblas_reduction_kernel_part2(rocblas_int nblocks, To* workspace, Tr* result)
         result[blockIdx.y] = Tr(FINALIZE{}(sum));
 }
 
+// kernel 2 is used from non-strided reduction_batched see include file
+// kernel 2 gathers all the partial results in workspace and finishes the final reduction
+template <int NB, typename FINALIZE, typename To, typename Tr>
+ROCBLAS_KERNEL(NB)
+rocblas_reduction_kernel_part2(rocblas_int nblocks, To* workspace, Tr* result)
+{
+    rocblas_reduction_finish<NB, FINALIZE>(nblocks, workspace, result);
+}
+
+// kernel 1 and kernel 2 in a single launch, the last block of each batch to finish does the
+// work of kernel 2
+template <typename API_INT,
+          int NB,
+          typename FETCH,
+          typename FINALIZE,
+          typename TPtrX,
+          typename To,
+          typename Tr>
+ROCBLAS_KERNEL(NB)
+rocblas_reduction_kernel_single_pass(rocblas_int    n,
+                                     rocblas_int    nblocks,
+                                     TPtrX          xvec,
+                                     rocblas_stride shiftx,
+                                     API_INT        incx,
+                                     rocblas_stride stridex,
+                                     To*            workspace,
+                                     unsigned int*  tickets,
+                                     Tr*            result)
+{
+    int64_t tid = blockIdx.x * blockDim.x + threadIdx.x;
+    To      sum;
+
+    const auto* x = load_ptr_batch(xvec, blockIdx.y, shiftx, stridex);
+
+    // bound
+    if(tid < n)
+        sum = FETCH{}(x[tid * incx]);
+    else
+        sum = rocblas_default_value<To>{}(); // pad with default value
+
+    sum = rocblas_dot_block_reduce<NB, To>(sum); // sum reduction only
+
+    if(threadIdx.x == 0)
+        workspace[blockIdx.y * nblocks + blockIdx.x] = sum;
+
+    if(rocblas_reduction_last_block(tickets, nblocks))
+        rocblas_reduction_finish<NB, FINALIZE>(nblocks, workspace, result);
+}
+
+// Small n kernel for large batch counts: each block reduces NB_Y batches with one wavefront
+// of NB_X threads per batch, so no workspace or second kernel is needed
+template <typename API_INT,
+          int NB_X,
+          int NB_Y,
+          typename FETCH,
+          typename FINALIZE,
+          typename TPtrX,
+          typename To,
+          typename Tr>
+ROCBLAS_KERNEL(NB_X* NB_Y)
+rocblas_reduction_small_n_batched_kernel(rocblas_int    n,
+                                         TPtrX          xvec,
+                                         rocblas_stride shiftx,
+                                         API_INT        incx,
+                                         rocblas_stride stridex,
+                                         rocblas_int    batch_count,
+                                         To*            sum_type,
+                                         Tr*            result)
+{
+    // whole wavefronts return, so the wavefront reduction below is not affected
+    uint32_t batch = blockIdx.x * NB_Y + threadIdx.y;
+    if(batch >= batch_count)
+        return;
+
+    const auto* x = load_ptr_batch(xvec, batch, shiftx, stridex);
+
+    To sum = rocblas_default_value<To>{}();
+    for(rocblas_int tid = threadIdx.x; tid < n; tid += NB_X)
+        sum += FETCH{}(x[tid * int64_t(incx)]);
+
+    sum = rocblas_wavefront_reduce<NB_X>(sum);
+
+    if(threadIdx.x == 0)
+        result[batch] = Tr(FINALIZE{}(sum));
+}
+
 /*! \brief
 
     \details
     rocblas_reduction_strided_batched computes a reduction over multiple vectors x_i
               Template parameters allow threads per block, data, and specific phase kernel overrides
-              At least two kernels are needed to finish the reduction
               kernel 1 write partial result per thread block in workspace, blocks partial results
               kernel 2 gathers all the partial result in workspace and finishes the final reduction.
+              Unless atomics are not allowed, kernel 2 is done by the last block of kernel 1.
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
@@ -191,31 +280,128 @@ rocblas_status rocblas_internal_asum_nrm2_launcher(rocblas_handle handle,
 {
     // param REDUCE is always SUM for these kernels so not passed on
 
+    rocblas_roctx_phase roctx_phase(handle, "reduction", "N", n, "batch_count", batch_count);
+
+    if(n <= 1024 && batch_count >= 256)
+    {
+        // Optimized kernel for small n and bigger batch_count
+        static constexpr int NB_Y = 4;
+
+        dim3 grid((batch_count - 1) / NB_Y + 1);
+
+        Tr* output = result; // device mode output directly to result
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+            output = (Tr*)workspace;
+
+        // warpSize for (gfx10xx/gfx11xx/gfx12xx) is 32 and the rest is 64
+        int arch_major = handle->getArchMajor();
+        if(arch_major == 10 || arch_major == 11 || arch_major == 12)
+        {
+            static constexpr int NB_X = 32;
+            ROCBLAS_LAUNCH_KERNEL(
+                (rocblas_reduction_small_n_batched_kernel<API_INT, NB_X, NB_Y, FETCH, FINALIZE>),
+                grid,
+                dim3(NB_X, NB_Y),
+                0,
+                handle->get_stream(),
+                n,
+                x,
+                shiftx,
+                incx,
+                stridex,
+                batch_count,
+                workspace,
+                output);
+        }
+        else
+        {
+            static constexpr int NB_X = 64;
+            ROCBLAS_LAUNCH_KERNEL(
+                (rocblas_reduction_small_n_batched_kernel<API_INT, NB_X, NB_Y, FETCH, FINALIZE>),
+                grid,
+                dim3(NB_X, NB_Y),
+                0,
+                handle->get_stream(),
+                n,
+                x,
+                shiftx,
+                incx,
+                stridex,
+                batch_count,
+                workspace,
+                output);
+        }
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(result,
+                                               output,
+                                               batch_count * sizeof(Tr),
+                                               hipMemcpyDeviceToHost,
+                                               handle->get_stream()));
+            RETURN_IF_ROCBLAS_ERROR(handle->sync_host_results());
+        }
+        return rocblas_status_success;
+    }
+
     rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB);
 
-    ROCBLAS_LAUNCH_KERNEL((rocblas_reduction_kernel_part1<API_INT, NB, FETCH>),
-                          dim3(blocks, batch_count),
-                          NB,
-                          0,
-                          handle->get_stream(),
-                          n,
-                          blocks,
-                          x,
-                          shiftx,
-                          incx,
-                          stridex,
-                          workspace);
+    // While the stream is being captured, or with asynchronous host results, there is no host
+    // step after the copy, so the result is always finalized on the device
+    bool reduceKernel = handle->pointer_mode == rocblas_pointer_mode_device || blocks > 1
+                        || batch_count > 1 || handle->host_results_deferred();
 
-    if(handle->pointer_mode == rocblas_pointer_mode_device)
+    // kernel 2 is folded into kernel 1 if single-pass reduction counters are available
+    unsigned int* tickets = reduceKernel ? handle->get_reduction_tickets(batch_count) : nullptr;
+    if(tickets)
     {
-        ROCBLAS_LAUNCH_KERNEL((rocblas_reduction_kernel_part2<NB, FINALIZE>),
-                              dim3(1, batch_count),
+        Tr* output = handle->pointer_mode == rocblas_pointer_mode_device
+                         ? result
+                         : (Tr*)(workspace + size_t(batch_count) * blocks);
+
+        ROCBLAS_LAUNCH_KERNEL(
+            (rocblas_reduction_kernel_single_pass<API_INT, NB, FETCH, FINALIZE>),
+            dim3(blocks, batch_count),
+            NB,
+            0,
+            handle->get_stream(),
+            n,
+            blocks,
+            x,
+            shiftx,
+            incx,
+            stridex,
+            workspace,
+            tickets,
+            output);
+    }
+    else
+    {
+        ROCBLAS_LAUNCH_KERNEL((rocblas_reduction_kernel_part1<API_INT, NB, FETCH>),
+                              dim3(blocks, batch_count),
                               NB,
                               0,
                               handle->get_stream(),
+                              n,
                               blocks,
-                              workspace,
-                              result);
+                              x,
+                              shiftx,
+                              incx,
+                              stridex,
+                              workspace);
+    }
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+    {
+        if(!tickets)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_reduction_kernel_part2<NB, FINALIZE>),
+                                  dim3(1, batch_count),
+                                  NB,
+                                  0,
+                                  handle->get_stream(),
+                                  blocks,
+                                  workspace,
+                                  result);
     }
     else
     {
@@ -224,8 +410,7 @@ rocblas_status rocblas_internal_asum_nrm2_launcher(rocblas_handle handle,
         // it must be a standard layout type and its first member must be of type Tr.
         static_assert(std::is_standard_layout<To>{}, "To must be a standard layout type");
 
-        bool reduceKernel = blocks > 1 || batch_count > 1;
-        if(reduceKernel)
+        if(reduceKernel && !tickets)
         {
             ROCBLAS_LAUNCH_KERNEL((rocblas_reduction_kernel_part2<NB, FINALIZE>),
                                   dim3(1, batch_count),
@@ -247,7 +432,7 @@ rocblas_status rocblas_internal_asum_nrm2_launcher(rocblas_handle handle,
                                                batch_count * sizeof(Tr),
                                                hipMemcpyDeviceToHost,
                                                handle->get_stream()));
-            RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+            RETURN_IF_ROCBLAS_ERROR(handle->sync_host_results());
         }
         else
         {
@@ -259,7 +444,7 @@ rocblas_status rocblas_internal_asum_nrm2_launcher(rocblas_handle handle,
                                                batch_count * sizeof(To),
                                                hipMemcpyDeviceToHost,
                                                handle->get_stream()));
-            RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+            RETURN_IF_HIP_ERROR(handle->synchronize_stream());
             for(rocblas_int i = 0; i < batch_count; i++)
                 result[i] = Tr(FINALIZE{}(res[i]));
         }
@@ -66,6 +66,8 @@ namespace
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
 
+        rocblas_api_scope api_scope(handle, rocblas_axpy_batched_name<T>);
+
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle,
                       rocblas_axpy_batched_name<T>,
@@ -91,7 +93,7 @@ namespace
                       "--batch",
                       batch_count);
 
-        if(layer_mode & rocblas_layer_mode_log_profile)
+        if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             log_profile(handle,
                         rocblas_axpy_batched_name<T>,
                         "N",
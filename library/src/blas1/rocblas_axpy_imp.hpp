@@ -61,6 +61,8 @@ namespace
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+
+        rocblas_api_scope api_scope(handle, rocblas_axpy_name<T>);
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle,
                       rocblas_axpy_name<T>,
@@ -83,7 +85,7 @@ namespace
                       "--incy",
                       incy);
 
-        if(layer_mode & rocblas_layer_mode_log_profile)
+        if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             log_profile(handle, rocblas_axpy_name<T>, "N", n, "incx", incx, "incy", incy);
 
         static constexpr rocblas_int    batch_count_1 = 1;
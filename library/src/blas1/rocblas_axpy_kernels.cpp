@@ -24,6 +24,7 @@
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
 #include "rocblas_axpy.hpp"
+#include "rocblas_block_size_select.hpp"
 #include "rocblas_block_sizes.h"
 
 template <typename T>
@@ -42,20 +43,23 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                    rocblas_stride stride_y,
                                    rocblas_int    batch_count)
 {
-    return ROCBLAS_API(rocblas_internal_axpy_launcher)<rocblas_int, ROCBLAS_AXPY_NB, T>(
-        handle,
-        n,
-        alpha,
-        stride_alpha,
-        x,
-        offset_x,
-        incx,
-        stride_x,
-        y,
-        offset_y,
-        incy,
-        stride_y,
-        batch_count);
+    int nb = rocblas_select_block_size(handle, rocblas_block_size_routine::axpy, n);
+    return rocblas_dispatch_block_size<ROCBLAS_AXPY_NB>(nb, [&](auto NB) {
+        return ROCBLAS_API(rocblas_internal_axpy_launcher)<rocblas_int, decltype(NB)::value, T>(
+            handle,
+            n,
+            alpha,
+            stride_alpha,
+            x,
+            offset_x,
+            incx,
+            stride_x,
+            y,
+            offset_y,
+            incy,
+            stride_y,
+            batch_count);
+    });
 }
 
 template <typename T>
@@ -74,20 +78,23 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                            rocblas_stride  stride_y,
                                            rocblas_int     batch_count)
 {
-    return ROCBLAS_API(rocblas_internal_axpy_launcher)<rocblas_int, ROCBLAS_AXPY_NB, T>(
-        handle,
-        n,
-        alpha,
-        stride_alpha,
-        x,
-        offset_x,
-        incx,
-        stride_x,
-        y,
-        offset_y,
-        incy,
-        stride_y,
-        batch_count);
+    int nb = rocblas_select_block_size(handle, rocblas_block_size_routine::axpy, n);
+    return rocblas_dispatch_block_size<ROCBLAS_AXPY_NB>(nb, [&](auto NB) {
+        return ROCBLAS_API(rocblas_internal_axpy_launcher)<rocblas_int, decltype(NB)::value, T>(
+            handle,
+            n,
+            alpha,
+            stride_alpha,
+            x,
+            offset_x,
+            incx,
+            stride_x,
+            y,
+            offset_y,
+            incy,
+            stride_y,
+            batch_count);
+    });
 }
 
 template <typename T, typename U>
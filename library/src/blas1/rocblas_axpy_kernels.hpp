@@ -42,7 +42,9 @@ rocblas_axpy_kernel(rocblas_int    n,
                     Ty __restrict__ y,
                     rocblas_stride offset_y,
                     API_INT        incy,
-                    rocblas_stride stride_y)
+                    rocblas_stride stride_y,
+                    bool           stream_x,
+                    bool           stream_y)
 {
     auto alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
     if(!alpha)
@@ -56,26 +58,35 @@ rocblas_axpy_kernel(rocblas_int    n,
         auto tx = load_ptr_batch(x, blockIdx.y, offset_x + tid * incx, stride_x);
         auto ty = load_ptr_batch(y, blockIdx.y, offset_y + tid * incy, stride_y);
 
-        *ty = (*ty) + Tex(alpha) * (*tx);
+        rocblas_batch_elem_t<Ty> yv
+            = rocblas_stream_load(ty, stream_y) + Tex(alpha) * rocblas_stream_load(tx, stream_x);
+        rocblas_stream_store(ty, yv, stream_y);
     }
 }
 
 //!
-//! @brief Optimized kernel for the AXPY floating points.
+//! @brief Optimized kernel for the AXPY with unit increments, each thread updates 16 bytes of y
+//! with wide loads and stores when the vectors of its batch are aligned.
 //! @remark Increment are required to be equal to one, that's why they are unspecified.
 //!
 template <rocblas_int NB, typename Tex, typename Ta, typename Tx, typename Ty>
 ROCBLAS_KERNEL(NB)
-rocblas_saxpy_2_kernel(rocblas_int    n,
-                       Ta             alpha_device_host,
-                       rocblas_stride stride_alpha,
-                       Tx __restrict__ x,
-                       rocblas_stride offset_x,
-                       rocblas_stride stride_x,
-                       Ty __restrict__ y,
-                       rocblas_stride offset_y,
-                       rocblas_stride stride_y)
+rocblas_axpy_wide_kernel(rocblas_int    n,
+                         Ta             alpha_device_host,
+                         rocblas_stride stride_alpha,
+                         Tx __restrict__ x,
+                         rocblas_stride offset_x,
+                         rocblas_stride stride_x,
+                         Ty __restrict__ y,
+                         rocblas_stride offset_y,
+                         rocblas_stride stride_y,
+                         bool           stream_x,
+                         bool           stream_y)
 {
+    using Telem_x    = rocblas_batch_elem_t<Tx>;
+    using Telem_y    = rocblas_batch_elem_t<Ty>;
+    constexpr int VW = rocblas_wide_elements<Telem_y>;
+
     auto alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
     if(!alpha)
     {
@@ -84,21 +95,27 @@ rocblas_saxpy_2_kernel(rocblas_int    n,
     auto* tx = load_ptr_batch(x, blockIdx.y, offset_x, stride_x);
     auto* ty = load_ptr_batch(y, blockIdx.y, offset_y, stride_y);
 
-    int64_t tid = (blockIdx.x * blockDim.x + threadIdx.x) * 2;
+    int64_t tid = (blockIdx.x * blockDim.x + threadIdx.x) * int64_t(VW);
 
-    if(tid < n - 1)
+    if(tid + VW <= n && rocblas_is_wide_aligned(tx) && rocblas_is_wide_aligned(ty))
     {
-        // Each thread access contiguous elements for example Thread '0' access indices '0' and '1' of the vectors `x` and `y`
-        for(int j = 0; j < 2; ++j)
+        auto* wx = (const rocblas_wide_t<Telem_x>*)(tx + tid);
+        auto* wy = (rocblas_wide_t<Telem_y>*)(ty + tid);
+
+        rocblas_wide_t<Telem_x> xv = rocblas_stream_load(wx, stream_x);
+        rocblas_wide_t<Telem_y> yv = rocblas_stream_load(wy, stream_y);
+        for(int j = 0; j < VW; ++j)
         {
-            ty[tid + j] = ty[tid + j] + Tex(alpha) * tx[tid + j];
+            yv.val[j] = yv.val[j] + Tex(alpha) * xv.val[j];
         }
+        rocblas_stream_store(wy, yv, stream_y);
     }
-
-    // If `n` is odd then the computation of last element in the vectors is covered below.
-    if(n % 2 != 0 && tid == n - 1)
+    else
     {
-        ty[tid] = ty[tid] + Tex(alpha) * tx[tid];
+        for(int j = 0; j < VW && tid + j < n; ++j)
+        {
+            ty[tid + j] = ty[tid + j] + Tex(alpha) * tx[tid + j];
+        }
     }
 }
 
@@ -298,11 +315,20 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     static constexpr bool using_rocblas_float
         = std::is_same_v<Ty, rocblas_float*> || std::is_same_v<Ty, rocblas_float* const*>;
 
+    // Elements of y per wide memory access, x must use the same number
+    static constexpr int wide_elements
+        = sizeof(rocblas_batch_elem_t<Tx>) == sizeof(rocblas_batch_elem_t<Ty>)
+              ? rocblas_wide_elements<rocblas_batch_elem_t<Ty>>
+              : 1;
+
     static constexpr rocblas_stride stride_0 = 0;
 
     //  unit_inc is True only if incx == 1  && incy == 1.
     bool unit_inc = (incx == 1 && incy == 1);
 
+    bool stream_x = handle->cache_policy & rocblas_cache_policy_stream_x;
+    bool stream_y = handle->cache_policy & rocblas_cache_policy_stream_y;
+
     if(using_rocblas_half && unit_inc)
     {
         //
@@ -353,17 +379,18 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         }
     }
 
-    else if(using_rocblas_float && unit_inc && batch_count <= 8192)
+    else if(wide_elements > 1 && unit_inc && batch_count <= 8192)
     {
-        // Optimized kernel for float Datatype when incx==1 && incy==1 && batch_count <= 8192
-        dim3 blocks(1 + ((n - 1) / (NB * 2)), batch_count);
+        // Optimized kernel when incx==1 && incy==1 && batch_count <= 8192, alignment of the
+        // vectors is checked per batch in the kernel
+        dim3 blocks(1 + ((n - 1) / (NB * wide_elements)), batch_count);
         dim3 threads(NB);
 
         if(rocblas_pointer_mode_device == handle->pointer_mode)
         {
             // clang-format off
-            ROCBLAS_LAUNCH_KERNEL((rocblas_saxpy_2_kernel<NB, Tex>), blocks, threads, 0, handle->get_stream(), n, alpha,
-                               stride_alpha, x, offset_x, stride_x, y, offset_y, stride_y);
+            ROCBLAS_LAUNCH_KERNEL((rocblas_axpy_wide_kernel<NB, Tex>), blocks, threads, 0, handle->get_stream(), n, alpha,
+                               stride_alpha, x, offset_x, stride_x, y, offset_y, stride_y, stream_x, stream_y);
             // clang-format on
         }
 
@@ -371,8 +398,8 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         {
             // Note: We do not support batched alpha on host.
             // clang-format off
-            ROCBLAS_LAUNCH_KERNEL((rocblas_saxpy_2_kernel<NB, Tex>), blocks, threads, 0, handle->get_stream(), n, *alpha,
-                               stride_0, x, offset_x, stride_x, y, offset_y, stride_y);
+            ROCBLAS_LAUNCH_KERNEL((rocblas_axpy_wide_kernel<NB, Tex>), blocks, threads, 0, handle->get_stream(), n, *alpha,
+                               stride_0, x, offset_x, stride_x, y, offset_y, stride_y, stream_x, stream_y);
             // clang-format on
         }
     }
@@ -418,7 +445,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         {
             // clang-format off
             ROCBLAS_LAUNCH_KERNEL((rocblas_axpy_kernel<API_INT, NB, Tex>), blocks, threads, 0, handle->get_stream(), n, alpha,
-                               stride_alpha, x, shift_x, incx, stride_x, y,shift_y, incy, stride_y);
+                               stride_alpha, x, shift_x, incx, stride_x, y,shift_y, incy, stride_y, stream_x, stream_y);
             // clang-format on
         }
         else
@@ -426,7 +453,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
             // Note: We do not support batched alpha on host.
             // clang-format off
             ROCBLAS_LAUNCH_KERNEL((rocblas_axpy_kernel<API_INT, NB, Tex>), blocks, threads, 0, handle->get_stream(), n, *alpha,
-                               stride_0, x, shift_x, incx, stride_x, y, shift_y, incy, stride_y);
+                               stride_0, x, shift_x, incx, stride_x, y, shift_y, incy, stride_y, stream_x, stream_y);
             // clang-format on
         }
     }
@@ -36,42 +36,53 @@ ROCBLAS_KERNEL_NO_BOUNDS rocblas_copy_kernel(rocblas_int    n,
                                              U              ya,
                                              rocblas_stride shifty,
                                              API_INT        incy,
-                                             rocblas_stride stridey)
+                                             rocblas_stride stridey,
+                                             bool           stream_x,
+                                             bool           stream_y)
 {
     int64_t     tid = blockIdx.x * blockDim.x + threadIdx.x;
     const auto* x   = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
     auto*       y   = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
     if(tid < n)
     {
-
-        y[tid * incy] = x[tid * incx];
+        rocblas_stream_store(
+            y + tid * incy, rocblas_stream_load(x + tid * incx, stream_x), stream_y);
     }
 }
 
-//! @brief Optimized kernel for the floating points.
+//! @brief Optimized kernel for unit increments, each thread copies 16 bytes with one wide load
+//! and store when the vectors of its batch are aligned.
 //!
 template <rocblas_int NB, typename T, typename U>
 ROCBLAS_KERNEL(NB)
-rocblas_scopy_2_kernel(rocblas_int n,
-                       const T __restrict xa,
-                       rocblas_stride shiftx,
-                       rocblas_stride stridex,
-                       U __restrict ya,
-                       rocblas_stride shifty,
-                       rocblas_stride stridey)
+rocblas_copy_wide_kernel(rocblas_int n,
+                         const T __restrict xa,
+                         rocblas_stride shiftx,
+                         rocblas_stride stridex,
+                         U __restrict ya,
+                         rocblas_stride shifty,
+                         rocblas_stride stridey,
+                         bool           stream_x,
+                         bool           stream_y)
 {
-    int64_t     tid = (blockIdx.x * blockDim.x + threadIdx.x) * 2;
+    using Te         = rocblas_batch_elem_t<U>;
+    constexpr int VW = rocblas_wide_elements<Te>;
+
+    int64_t     tid = (blockIdx.x * blockDim.x + threadIdx.x) * int64_t(VW);
     const auto* x   = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
     auto*       y   = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
-    if(tid < n - 1)
+
+    if(tid + VW <= n && rocblas_is_wide_aligned(x) && rocblas_is_wide_aligned(y))
     {
-        for(int j = 0; j < 2; ++j)
-        {
+        rocblas_stream_store((rocblas_wide_t<Te>*)(y + tid),
+                             rocblas_stream_load((const rocblas_wide_t<Te>*)(x + tid), stream_x),
+                             stream_y);
+    }
+    else
+    {
+        for(int j = 0; j < VW && tid + j < n; ++j)
             y[tid + j] = x[tid + j];
-        }
     }
-    if(n % 2 != 0 && tid == n - 1)
-        y[tid] = x[tid];
 }
 
 template <typename API_INT, rocblas_int NB, typename T, typename U>
@@ -94,10 +105,12 @@ rocblas_status rocblas_internal_copy_launcher(rocblas_handle handle,
     if(!x || !y)
         return rocblas_status_invalid_pointer;
 
-    static constexpr bool using_rocblas_float
-        = std::is_same_v<U, rocblas_float*> || std::is_same_v<U, rocblas_float* const*>;
+    static constexpr int wide_elements = rocblas_wide_elements<rocblas_batch_elem_t<U>>;
+
+    bool stream_x = handle->cache_policy & rocblas_cache_policy_stream_x;
+    bool stream_y = handle->cache_policy & rocblas_cache_policy_stream_y;
 
-    if(!using_rocblas_float || incx != 1 || incy != 1)
+    if(wide_elements == 1 || incx != 1 || incy != 1)
     {
         // In case of negative inc shift pointer to end of data for negative indexing tid*inc
         int64_t shiftx = offsetx - ((incx < 0) ? int64_t(incx) * (n - 1) : 0);
@@ -120,32 +133,32 @@ rocblas_status rocblas_internal_copy_launcher(rocblas_handle handle,
                               y,
                               shifty,
                               incy,
-                              stridey);
+                              stridey,
+                              stream_x,
+                              stream_y);
     }
-    else if constexpr(using_rocblas_float)
+    else
     {
-        // Kernel function for improving the performance of SCOPY when incx==1 and incy==1
-
-        // In case of negative inc shift pointer to end of data for negative indexing tid*inc
-        int64_t shiftx = offsetx - 0;
-        int64_t shifty = offsety - 0;
-
-        int  blocks = 1 + ((n - 1) / (NB * 2));
+        // Kernel function for improving the performance of copy when incx==1 and incy==1,
+        // alignment of the vectors is checked per batch in the kernel
+        int  blocks = 1 + ((n - 1) / (NB * wide_elements));
         dim3 grid(blocks, batch_count);
         dim3 threads(NB);
 
-        ROCBLAS_LAUNCH_KERNEL(rocblas_scopy_2_kernel<NB>,
+        ROCBLAS_LAUNCH_KERNEL(rocblas_copy_wide_kernel<NB>,
                               grid,
                               threads,
                               0,
                               handle->get_stream(),
                               n,
                               x,
-                              shiftx,
+                              offsetx,
                               stridex,
                               y,
-                              shifty,
-                              stridey);
+                              offsety,
+                              stridey,
+                              stream_x,
+                              stream_y);
     }
     return rocblas_status_success;
 }
@@ -81,6 +81,8 @@ namespace
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+
+        rocblas_api_scope api_scope(handle, rocblas_dot_name<CONJ, T>);
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle, rocblas_dot_name<CONJ, T>, n, x, incx, y, incy);
 
@@ -95,7 +97,7 @@ namespace
                       "--incy",
                       incy);
 
-        if(layer_mode & rocblas_layer_mode_log_profile)
+        if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             log_profile(handle, rocblas_dot_name<CONJ, T>, "N", n, "incx", incx, "incy", incy);
 
         // Quick return if possible.
@@ -114,7 +116,7 @@ namespace
         if(!x || !y || !result)
             return rocblas_status_invalid_pointer;
 
-        auto w_mem = handle->device_malloc(dev_bytes);
+        auto w_mem = handle->reduction_malloc(dev_bytes);
         if(!w_mem)
             return rocblas_status_memory_error;
 
@@ -24,6 +24,7 @@
 
 #include "rocblas_block_sizes.h"
 #include "rocblas_dot.hpp"
+#include "roctx_ranges.hpp"
 
 template <typename T>
 constexpr int rocblas_dot_one_block_threshold()
@@ -40,9 +41,85 @@ constexpr int rocblas_dot_one_block_threshold()
     return single_block_threshold;
 }
 
-template <bool ONE_BLOCK, typename V, typename T>
+// v_dot2_f32_f16 is available on these architectures
+#if defined(__gfx906__) || defined(__gfx908__) || defined(__gfx90a__) || defined(__gfx940__) \
+    || defined(__gfx941__) || defined(__gfx942__) || defined(__gfx1030__)                     \
+    || defined(__gfx1100__) || defined(__gfx1101__) || defined(__gfx1102__)                   \
+    || defined(__gfx1151__) || defined(__gfx1200__) || defined(__gfx1201__)
+#define ROCBLAS_HAS_DOT2_F32_F16 1
+#else
+#define ROCBLAS_HAS_DOT2_F32_F16 0
+#endif
+
+// Half and bfloat16 vectors reduced in float are loaded two elements at a time in one dword
+template <typename U, typename V>
+constexpr bool rocblas_dot_packed_16bit
+    = std::is_same_v<V, float>
+      && (std::is_same_v<rocblas_batch_elem_t<U>, rocblas_half>
+          || std::is_same_v<rocblas_batch_elem_t<U>, rocblas_bfloat16>);
+
+// returns sum + x[0] * y[0] + x[1] * y[1] for dword aligned x and y
+template <typename T>
+__forceinline__ __device__ float rocblas_dot2_accumulate(const T* x, const T* y, float sum)
+{
+    if constexpr(std::is_same_v<T, rocblas_half>)
+    {
+        rocblas_half2 xv = *(const rocblas_half2*)x;
+        rocblas_half2 yv = *(const rocblas_half2*)y;
+#if ROCBLAS_HAS_DOT2_F32_F16
+        return __builtin_amdgcn_fdot2(xv, yv, sum, false);
+#else
+        sum += float(xv[0]) * float(yv[0]);
+        return sum + float(xv[1]) * float(yv[1]);
+#endif
+    }
+    else
+    {
+        // bfloat16 is the upper half of a float
+        uint32_t xv = *(const uint32_t*)x;
+        uint32_t yv = *(const uint32_t*)y;
+        sum += __uint_as_float(xv << 16) * __uint_as_float(yv << 16);
+        return sum + __uint_as_float(xv & 0xffff0000u) * __uint_as_float(yv & 0xffff0000u);
+    }
+}
+
+// reduces the n_sums partial results of a batch in a single block
+template <int NB, int WIN, typename V, typename T>
 __inline__ __device__ void
-    rocblas_dot_save_sum(V sum, V* __restrict__ workspace, T* __restrict__ out)
+    rocblas_dot_reduce_sums(int n_sums, V* __restrict__ in, T* __restrict__ out)
+{
+    V sum = 0;
+
+    size_t offset = size_t(blockIdx.y) * n_sums;
+    in += offset;
+
+    int inc = blockDim.x * WIN;
+
+    int i         = threadIdx.x * WIN;
+    int remainder = n_sums % WIN;
+    int end       = n_sums - remainder;
+    for(; i < end; i += inc) // cover all sums as 1 block
+    {
+        for(int j = 0; j < WIN; j++)
+            sum += in[i + j];
+    }
+    if(threadIdx.x < remainder)
+    {
+        sum += in[n_sums - 1 - threadIdx.x];
+    }
+
+    sum = rocblas_dot_block_reduce<NB>(sum);
+    if(threadIdx.x == 0)
+        out[blockIdx.y] = T(sum);
+}
+
+// If tickets is not null, the last block of each batch to finish reduces the partial results
+// in workspace, instead of a second kernel
+template <bool ONE_BLOCK, int NB, int WIN, typename V, typename T>
+__inline__ __device__ void rocblas_dot_save_sum(V sum,
+                                                V* __restrict__ workspace,
+                                                T* __restrict__ out,
+                                                unsigned int* __restrict__ tickets)
 {
     if(threadIdx.x == 0)
     {
@@ -51,6 +128,9 @@ __inline__ __device__ void
         else
             workspace[blockIdx.x + size_t(blockIdx.y) * gridDim.x] = sum;
     }
+
+    if(!ONE_BLOCK && tickets && gridDim.x > 1 && rocblas_reduction_last_block(tickets, gridDim.x))
+        rocblas_dot_reduce_sums<NB, WIN>(gridDim.x, workspace, out);
 }
 
 template <bool ONE_BLOCK, int NB, int WIN, bool CONJ, typename T, typename U, typename V>
@@ -63,7 +143,8 @@ rocblas_dot_kernel_inc1(rocblas_int n,
                         rocblas_stride shifty,
                         rocblas_stride stridey,
                         V* __restrict__ workspace,
-                        T* __restrict__ out)
+                        T* __restrict__ out,
+                        unsigned int* __restrict__ tickets)
 {
     const auto* x = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
     const auto* y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
@@ -81,7 +162,7 @@ rocblas_dot_kernel_inc1(rocblas_int n,
 
     sum = rocblas_dot_block_reduce<NB>(sum);
 
-    rocblas_dot_save_sum<ONE_BLOCK>(sum, workspace, out);
+    rocblas_dot_save_sum<ONE_BLOCK, NB, WIN>(sum, workspace, out, tickets);
 }
 
 template <bool ONE_BLOCK, int NB, int WIN, bool CONJ, typename T, typename U, typename V>
@@ -94,7 +175,8 @@ rocblas_dot_kernel_inc1by2(rocblas_int n,
                            rocblas_stride shifty,
                            rocblas_stride stridey,
                            V* __restrict__ workspace,
-                           T* __restrict__ out)
+                           T* __restrict__ out,
+                           unsigned int* __restrict__ tickets)
 {
     const auto* x = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
     const auto* y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
@@ -105,7 +187,33 @@ rocblas_dot_kernel_inc1by2(rocblas_int n,
     // sum WIN elements per thread
     int inc = !ONE_BLOCK ? blockDim.x * gridDim.x : blockDim.x;
 
-    if constexpr(
+    if constexpr(rocblas_dot_packed_16bit<U, V>)
+    {
+        i *= 2;
+        inc *= 2;
+        bool packed = ((uintptr_t(x) | uintptr_t(y)) & 3) == 0;
+        for(int j = 0; j < WIN && i < n - 1; j++, i += inc)
+        {
+            if(packed)
+            {
+                sum = rocblas_dot2_accumulate(x + i, y + i, sum);
+            }
+            else
+            {
+#pragma unroll
+                for(int k = 0; k < 2; ++k)
+                {
+                    sum += V(y[i + k]) * V(x[i + k]);
+                }
+            }
+        }
+        // If `n` is odd then the computation of last element is covered below.
+        if(n % 2 && i == n - 1)
+        {
+            sum += V(y[i]) * V(x[i]);
+        }
+    }
+    else if constexpr(
         std::is_same_v<
             T,
             rocblas_half> || std::is_same_v<T, rocblas_bfloat16> || std::is_same_v<T, rocblas_float>)
@@ -136,7 +244,7 @@ rocblas_dot_kernel_inc1by2(rocblas_int n,
 
     sum = rocblas_dot_block_reduce<NB>(sum);
 
-    rocblas_dot_save_sum<ONE_BLOCK>(sum, workspace, out);
+    rocblas_dot_save_sum<ONE_BLOCK, NB, WIN>(sum, workspace, out, tickets);
 }
 
 template <typename API_INT,
@@ -158,7 +266,8 @@ rocblas_dot_kernel(rocblas_int n,
                    API_INT        incy,
                    rocblas_stride stridey,
                    V* __restrict__ workspace,
-                   T* __restrict__ out)
+                   T* __restrict__ out,
+                   unsigned int* __restrict__ tickets)
 {
     const auto* x = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
     const auto* y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
@@ -176,7 +285,7 @@ rocblas_dot_kernel(rocblas_int n,
     }
     sum = rocblas_dot_block_reduce<NB>(sum);
 
-    rocblas_dot_save_sum<ONE_BLOCK>(sum, workspace, out);
+    rocblas_dot_save_sum<ONE_BLOCK, NB, WIN>(sum, workspace, out, tickets);
 }
 
 template <typename API_INT,
@@ -194,7 +303,8 @@ rocblas_dot_kernel_magsq(rocblas_int n,
                          API_INT        incx,
                          rocblas_stride stridex,
                          V* __restrict__ workspace,
-                         T* __restrict__ out)
+                         T* __restrict__ out,
+                         unsigned int* __restrict__ tickets)
 {
     const auto* x = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
 
@@ -211,36 +321,14 @@ rocblas_dot_kernel_magsq(rocblas_int n,
     }
     sum = rocblas_dot_block_reduce<NB>(sum);
 
-    rocblas_dot_save_sum<ONE_BLOCK>(sum, workspace, out);
+    rocblas_dot_save_sum<ONE_BLOCK, NB, WIN>(sum, workspace, out, tickets);
 }
 
 template <int NB, int WIN, typename V, typename T = V>
 ROCBLAS_KERNEL(NB)
 rocblas_dot_kernel_reduce(int n_sums, V* __restrict__ in, T* __restrict__ out)
 {
-    V sum = 0;
-
-    size_t offset = size_t(blockIdx.y) * n_sums;
-    in += offset;
-
-    int inc = blockDim.x * gridDim.x * WIN;
-
-    int i         = threadIdx.x * WIN;
-    int remainder = n_sums % WIN;
-    int end       = n_sums - remainder;
-    for(; i < end; i += inc) // cover all sums as 1 block
-    {
-        for(int j = 0; j < WIN; j++)
-            sum += in[i + j];
-    }
-    if(threadIdx.x < remainder)
-    {
-        sum += in[n_sums - 1 - threadIdx.x];
-    }
-
-    sum = rocblas_dot_block_reduce<NB>(sum);
-    if(threadIdx.x == 0)
-        out[blockIdx.y] = T(sum);
+    rocblas_dot_reduce_sums<NB, WIN>(n_sums, in, out);
 }
 
 template <typename API_INT, int NB_X, int NB_Y, bool CONJ, typename V, typename T, typename U>
@@ -297,10 +385,12 @@ rocblas_status rocblas_internal_dot_launcher(rocblas_handle __restrict__ handle,
                                              T* __restrict__ results,
                                              V* __restrict__ workspace)
 {
+    rocblas_roctx_phase roctx_phase(handle, "reduction", "N", n, "batch_count", batch_count);
 
     // One or two kernels are used to finish the reduction
     // kernel 1 write partial results per thread block in workspace, number of partial results is blocks
-    // kernel 2 if blocks > 1 the partial results in workspace are reduced to output
+    // kernel 2 if blocks > 1 the partial results in workspace are reduced to output, unless the
+    // last block of kernel 1 to finish reduces them (atomics allowed)
 
     // Quick return if possible.
     if(n <= 0 || batch_count == 0)
@@ -406,7 +496,7 @@ rocblas_status rocblas_internal_dot_launcher(rocblas_handle __restrict__ handle,
                                                sizeof(T) * batch_count,
                                                hipMemcpyDeviceToHost,
                                                handle->get_stream()));
-            RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+            RETURN_IF_ROCBLAS_ERROR(handle->sync_host_results());
         }
     }
     else if(n <= single_block_threshold)
@@ -448,7 +538,8 @@ rocblas_status rocblas_internal_dot_launcher(rocblas_handle __restrict__ handle,
                     shifty,
                     stridey,
                     workspace,
-                    output);
+                    output,
+                    nullptr);
             }
             else
             {
@@ -468,7 +559,8 @@ rocblas_status rocblas_internal_dot_launcher(rocblas_handle __restrict__ handle,
                     incy,
                     stridey,
                     workspace,
-                    output);
+                    output,
+                    nullptr);
             }
         }
         else // x dot x
@@ -485,7 +577,8 @@ rocblas_status rocblas_internal_dot_launcher(rocblas_handle __restrict__ handle,
                 incx,
                 stridex,
                 workspace,
-                output);
+                output,
+                nullptr);
         }
 
         if(handle->pointer_mode == rocblas_pointer_mode_host)
@@ -495,14 +588,19 @@ rocblas_status rocblas_internal_dot_launcher(rocblas_handle __restrict__ handle,
                                                sizeof(T) * batch_count,
                                                hipMemcpyDeviceToHost,
                                                handle->get_stream()));
-            RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+            RETURN_IF_ROCBLAS_ERROR(handle->sync_host_results());
         }
     }
     else
     {
         static constexpr bool ONE_BLOCK = false;
 
-        rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB * WIN);
+        // packed 16 bit inputs are summed two elements per thread and step
+        static constexpr bool packed = rocblas_dot_packed_16bit<U, V>;
+        bool                  inc1   = incx == 1 && incy == 1;
+
+        rocblas_int blocks
+            = rocblas_reduction_kernel_block_count(n, NB * WIN * (packed && inc1 ? 2 : 1));
         dim3        grid(blocks, batch_count);
         dim3        threads(NB);
 
@@ -513,9 +611,31 @@ rocblas_status rocblas_internal_dot_launcher(rocblas_handle __restrict__ handle,
             output        = (T*)(workspace + offset);
         }
 
+        // the reduce kernel is folded into the first if single-pass reduction counters are
+        // available
+        unsigned int* tickets = blocks > 1 ? handle->get_reduction_tickets(batch_count) : nullptr;
+
         if(x != y || incx != incy || offsetx != offsety || stridex != stridey)
         {
-            if(incx == 1 && incy == 1)
+            if(packed && inc1)
+            {
+                ROCBLAS_LAUNCH_KERNEL((rocblas_dot_kernel_inc1by2<ONE_BLOCK, NB, WIN, CONJ, T>),
+                                      grid,
+                                      threads,
+                                      0,
+                                      handle->get_stream(),
+                                      n,
+                                      x,
+                                      shiftx,
+                                      stridex,
+                                      y,
+                                      shifty,
+                                      stridey,
+                                      workspace,
+                                      output,
+                                      tickets);
+            }
+            else if(inc1)
             {
                 ROCBLAS_LAUNCH_KERNEL((rocblas_dot_kernel_inc1<ONE_BLOCK, NB, WIN, CONJ, T>),
                                       grid,
@@ -530,7 +650,8 @@ rocblas_status rocblas_internal_dot_launcher(rocblas_handle __restrict__ handle,
                                       shifty,
                                       stridey,
                                       workspace,
-                                      output);
+                                      output,
+                                      tickets);
             }
             else
             {
@@ -549,7 +670,8 @@ rocblas_status rocblas_internal_dot_launcher(rocblas_handle __restrict__ handle,
                                       incy,
                                       stridey,
                                       workspace,
-                                      output);
+                                      output,
+                                      tickets);
             }
         }
         else // x dot x
@@ -565,10 +687,11 @@ rocblas_status rocblas_internal_dot_launcher(rocblas_handle __restrict__ handle,
                                   incx,
                                   stridex,
                                   workspace,
-                                  output);
+                                  output,
+                                  tickets);
         }
 
-        if(blocks > 1) // if single block first kernel did all work
+        if(blocks > 1 && !tickets) // if single block first kernel did all work
             ROCBLAS_LAUNCH_KERNEL((rocblas_dot_kernel_reduce<NB, WIN>),
                                   dim3(1, batch_count),
                                   threads,
@@ -585,7 +708,7 @@ rocblas_status rocblas_internal_dot_launcher(rocblas_handle __restrict__ handle,
                                                sizeof(T) * batch_count,
                                                hipMemcpyDeviceToHost,
                                                handle->get_stream()));
-            RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+            RETURN_IF_ROCBLAS_ERROR(handle->sync_host_results());
         }
     }
     return rocblas_status_success;
@@ -90,6 +90,8 @@ namespace
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+
+        rocblas_api_scope api_scope(handle, rocblas_dot_strided_batched_name<CONJ, T>);
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle,
                       rocblas_dot_strided_batched_name<CONJ, T>,
@@ -119,7 +121,7 @@ namespace
                       "--batch_count",
                       batch_count);
 
-        if(layer_mode & rocblas_layer_mode_log_profile)
+        if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             log_profile(handle,
                         rocblas_dot_strided_batched_name<CONJ, T>,
                         "N",
@@ -154,7 +156,7 @@ namespace
         if(!x || !y || !results)
             return rocblas_status_invalid_pointer;
 
-        auto w_mem = handle->device_malloc(dev_bytes);
+        auto w_mem = handle->reduction_malloc(dev_bytes);
         if(!w_mem)
             return rocblas_status_memory_error;
 
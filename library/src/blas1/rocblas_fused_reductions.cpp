@@ -0,0 +1,757 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "logging.hpp"
+#include "rocblas_asum_nrm2_kernels.hpp"
+#include "rocblas_block_sizes.h"
+
+// Fused Level 1 operations of Krylov solvers: an axpy or axpby followed by a reduction of its
+// result, and two dot products sharing a vector, which read each vector once. The partial
+// results of the thread blocks are reduced as in rocblas_internal_asum_nrm2_launcher.
+// normalize_strided_batched divides each vector of a batch by its norm.
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_axpy_dot_name[] = "unknown";
+    template <>
+    constexpr char rocblas_axpy_dot_name<float>[] = "rocblas_saxpy_dot";
+    template <>
+    constexpr char rocblas_axpy_dot_name<double>[] = "rocblas_daxpy_dot";
+
+    template <typename>
+    constexpr char rocblas_axpby_nrm2_name[] = "unknown";
+    template <>
+    constexpr char rocblas_axpby_nrm2_name<float>[] = "rocblas_saxpby_nrm2";
+    template <>
+    constexpr char rocblas_axpby_nrm2_name<double>[] = "rocblas_daxpby_nrm2";
+
+    template <typename>
+    constexpr char rocblas_dot2_name[] = "unknown";
+    template <>
+    constexpr char rocblas_dot2_name<float>[] = "rocblas_sdot2";
+    template <>
+    constexpr char rocblas_dot2_name<double>[] = "rocblas_ddot2";
+
+    template <typename>
+    constexpr char rocblas_normalize_name[] = "unknown";
+    template <>
+    constexpr char rocblas_normalize_name<float>[] = "rocblas_snormalize_strided_batched";
+    template <>
+    constexpr char rocblas_normalize_name<double>[] = "rocblas_dnormalize_strided_batched";
+    template <>
+    constexpr char rocblas_normalize_name<rocblas_float_complex>[]
+        = "rocblas_cnormalize_strided_batched";
+    template <>
+    constexpr char rocblas_normalize_name<rocblas_double_complex>[]
+        = "rocblas_znormalize_strided_batched";
+
+    constexpr int ROCBLAS_FUSED_REDUCTION_NB = ROCBLAS_DOT_NB;
+
+    // Vectors of up to NB * REGS elements are normalized by one thread block each, holding the
+    // vector in registers between the reduction and the scaling
+    constexpr int ROCBLAS_NORMALIZE_NB   = 128;
+    constexpr int ROCBLAS_NORMALIZE_REGS = 8;
+
+    // In case of negative inc shift pointer to end of data for negative indexing tid*inc
+    template <typename T>
+    T* rocblas_fused_shift(T* x, rocblas_int n, rocblas_int incx)
+    {
+        return incx < 0 ? x - int64_t(incx) * (n - 1) : x;
+    }
+
+    // Stores the block sum of reduction k, and if tickets is not null, finishes the reductions
+    // in the last block to complete
+    template <int NB, int NUM_REDUCTIONS, typename FINALIZE, typename T>
+    __device__ void rocblas_fused_save_sums(
+        const T* sums, rocblas_int nblocks, T* workspace, unsigned int* tickets, T* result)
+    {
+        if(threadIdx.x == 0)
+            for(int k = 0; k < NUM_REDUCTIONS; k++)
+                workspace[k * nblocks + blockIdx.x] = sums[k];
+
+        if(tickets && rocblas_reduction_last_block(tickets, nblocks))
+            for(int k = 0; k < NUM_REDUCTIONS; k++)
+                rocblas_reduction_finish<NB, FINALIZE>(
+                    nblocks, workspace + k * nblocks, result + k);
+    }
+
+    // y = alpha * x + beta * y (beta is ignored unless SCALE_Y), and the block sums of y * z, or
+    // of y * y if z is null
+    template <int NB, bool SCALE_Y, typename FINALIZE, typename Ta, typename T>
+    ROCBLAS_KERNEL(NB)
+    rocblas_axpby_reduce_kernel(rocblas_int   n,
+                                Ta            alpha_device_host,
+                                const T*      x,
+                                int64_t       incx,
+                                Ta            beta_device_host,
+                                T*            y,
+                                int64_t       incy,
+                                const T*      z,
+                                int64_t       incz,
+                                rocblas_int   nblocks,
+                                T*            workspace,
+                                unsigned int* tickets,
+                                T*            result)
+    {
+        auto alpha = load_scalar(alpha_device_host);
+        auto beta  = SCALE_Y ? load_scalar(beta_device_host) : T(1);
+
+        int64_t tid = blockIdx.x * blockDim.x + threadIdx.x;
+        T       sum = T(0);
+
+        if(tid < n)
+        {
+            T yv = y[tid * incy];
+            if(alpha || (SCALE_Y && beta != 1))
+            {
+                yv = (SCALE_Y ? beta * yv : yv) + alpha * x[tid * incx];
+                y[tid * incy] = yv;
+            }
+            sum = yv * (z ? z[tid * incz] : yv);
+        }
+
+        sum = rocblas_dot_block_reduce<NB>(sum);
+
+        rocblas_fused_save_sums<NB, 1, FINALIZE>(&sum, nblocks, workspace, tickets, result);
+    }
+
+    // block sums of x * y and x * z
+    template <int NB, typename T>
+    ROCBLAS_KERNEL(NB)
+    rocblas_dot2_kernel(rocblas_int   n,
+                        const T*      x,
+                        int64_t       incx,
+                        const T*      y,
+                        int64_t       incy,
+                        const T*      z,
+                        int64_t       incz,
+                        rocblas_int   nblocks,
+                        T*            workspace,
+                        unsigned int* tickets,
+                        T*            result)
+    {
+        int64_t tid     = blockIdx.x * blockDim.x + threadIdx.x;
+        T       sums[2] = {T(0), T(0)};
+
+        if(tid < n)
+        {
+            T xv    = x[tid * incx];
+            sums[0] = xv * y[tid * incy];
+            sums[1] = xv * z[tid * incz];
+        }
+
+        sums[0] = rocblas_dot_block_reduce<NB>(sums[0]);
+        sums[1] = rocblas_dot_block_reduce<NB>(sums[1]);
+
+        rocblas_fused_save_sums<NB, 2, rocblas_finalize_identity>(
+            sums, nblocks, workspace, tickets, result);
+    }
+
+    // Normalizes vector blockIdx.x of the batch, read once into the REGS registers of each thread
+    template <int NB, int REGS, typename T, typename Tr>
+    ROCBLAS_KERNEL(NB)
+    rocblas_normalize_small_kernel(
+        rocblas_int n, T* x, int64_t incx, rocblas_stride stridex, Tr* norms)
+    {
+        __shared__ Tr s_norm;
+
+        x = load_ptr_batch(x, blockIdx.x, stridex);
+
+        T  v[REGS];
+        Tr sum = Tr(0);
+#pragma unroll
+        for(int k = 0; k < REGS; k++)
+        {
+            int64_t i = threadIdx.x + int64_t(k) * NB;
+            v[k]      = i < n ? x[i * incx] : T(0);
+            sum += fetch_abs2(v[k]);
+        }
+
+        sum = rocblas_dot_block_reduce<NB>(sum);
+        if(threadIdx.x == 0)
+        {
+            s_norm = sqrt(sum);
+            if(norms)
+                norms[blockIdx.x] = s_norm;
+        }
+        __syncthreads();
+
+        // a zero vector is left as it is
+        Tr norm = s_norm;
+        if(norm == 0)
+            return;
+
+        Tr scale = Tr(1) / norm;
+#pragma unroll
+        for(int k = 0; k < REGS; k++)
+        {
+            int64_t i = threadIdx.x + int64_t(k) * NB;
+            if(i < n)
+                x[i * incx] = v[k] * scale;
+        }
+    }
+
+    // Divides vector blockIdx.y of the batch by its norm computed by the nrm2 launcher
+    template <int NB, typename T, typename Tr>
+    ROCBLAS_KERNEL(NB)
+    rocblas_normalize_scale_kernel(
+        rocblas_int n, T* x, int64_t incx, rocblas_stride stridex, const Tr* norms)
+    {
+        int64_t tid  = blockIdx.x * int64_t(NB) + threadIdx.x;
+        Tr      norm = norms[blockIdx.y];
+        if(tid >= n || norm == 0)
+            return;
+
+        x = load_ptr_batch(x, blockIdx.y, stridex);
+        x[tid * incx] *= Tr(1) / norm;
+    }
+
+    // Launches a fused kernel, which takes (nblocks, workspace, tickets, output) as its last
+    // arguments, and finishes its NUM_REDUCTIONS reductions into result
+    template <int NB, int NUM_REDUCTIONS, typename FINALIZE, typename T, typename LAUNCH>
+    rocblas_status rocblas_fused_reduction_launcher(
+        rocblas_handle handle, rocblas_int n, T* workspace, T* result, LAUNCH launch)
+    {
+        rocblas_int   nblocks = rocblas_reduction_kernel_block_count(n, NB);
+        unsigned int* tickets = handle->get_reduction_tickets(1);
+        bool          device  = handle->pointer_mode == rocblas_pointer_mode_device;
+        T*            output  = device ? result : workspace + size_t(NUM_REDUCTIONS) * nblocks;
+
+        RETURN_IF_ROCBLAS_ERROR(
+            launch(dim3(nblocks), dim3(NB), nblocks, workspace, tickets, output));
+
+        if(!tickets)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_reduction_kernel_part2<NB, FINALIZE>),
+                                  dim3(1, NUM_REDUCTIONS),
+                                  NB,
+                                  0,
+                                  handle->get_stream(),
+                                  nblocks,
+                                  workspace,
+                                  output);
+
+        if(!device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(result,
+                                               output,
+                                               sizeof(T) * NUM_REDUCTIONS,
+                                               hipMemcpyDeviceToHost,
+                                               handle->get_stream()));
+            RETURN_IF_ROCBLAS_ERROR(handle->sync_host_results());
+        }
+        return rocblas_status_success;
+    }
+
+    template <typename T>
+    rocblas_status rocblas_fused_zero_results(rocblas_handle handle, T* result, int count)
+    {
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            RETURN_IF_HIP_ERROR(
+                hipMemsetAsync(result, 0, sizeof(T) * count, handle->get_stream()));
+        else
+            for(int k = 0; k < count; k++)
+                result[k] = T(0);
+        return rocblas_status_success;
+    }
+
+    // y = alpha * x + beta * y and result = reduction of y, z with FINALIZE
+    template <bool SCALE_Y, typename FINALIZE, typename T>
+    rocblas_status rocblas_axpby_reduce_impl(rocblas_handle handle,
+                                             const char*    name,
+                                             rocblas_int    n,
+                                             const T*       alpha,
+                                             const T*       x,
+                                             rocblas_int    incx,
+                                             const T*       beta,
+                                             T*             y,
+                                             rocblas_int    incy,
+                                             const T*       z,
+                                             rocblas_int    incz,
+                                             T*             result)
+    {
+        static constexpr int NB = ROCBLAS_FUSED_REDUCTION_NB;
+
+        size_t dev_bytes = rocblas_reduction_kernel_workspace_size<rocblas_int, NB, T>(n);
+        if(handle->is_device_memory_size_query())
+        {
+            if(n <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        {
+            if(SCALE_Y)
+                log_trace(handle,
+                          name,
+                          n,
+                          LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                          x,
+                          incx,
+                          LOG_TRACE_SCALAR_VALUE(handle, beta),
+                          y,
+                          incy);
+            else
+                log_trace(handle,
+                          name,
+                          n,
+                          LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                          x,
+                          incx,
+                          y,
+                          incy,
+                          z,
+                          incz);
+        }
+
+        if(!result)
+            return rocblas_status_invalid_pointer;
+        if(n <= 0)
+            return rocblas_fused_zero_results(handle, result, 1);
+        if(!alpha || (SCALE_Y && !beta))
+            return rocblas_status_invalid_pointer;
+        if(!x || !y || (!SCALE_Y && !z))
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->reduction_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        const T* xs = rocblas_fused_shift(x, n, incx);
+        T*       ys = rocblas_fused_shift(y, n, incy);
+        const T* zs = z ? rocblas_fused_shift(z, n, incz) : nullptr;
+
+        auto launch = [&](dim3          grid,
+                          dim3          threads,
+                          rocblas_int   nblocks,
+                          T*            workspace,
+                          unsigned int* tickets,
+                          T*            output) -> rocblas_status {
+            if(handle->pointer_mode == rocblas_pointer_mode_device)
+                ROCBLAS_LAUNCH_KERNEL((rocblas_axpby_reduce_kernel<NB, SCALE_Y, FINALIZE>),
+                                      grid,
+                                      threads,
+                                      0,
+                                      handle->get_stream(),
+                                      n,
+                                      alpha,
+                                      xs,
+                                      incx,
+                                      SCALE_Y ? beta : alpha,
+                                      ys,
+                                      incy,
+                                      zs,
+                                      incz,
+                                      nblocks,
+                                      workspace,
+                                      tickets,
+                                      output);
+            else
+                ROCBLAS_LAUNCH_KERNEL((rocblas_axpby_reduce_kernel<NB, SCALE_Y, FINALIZE>),
+                                      grid,
+                                      threads,
+                                      0,
+                                      handle->get_stream(),
+                                      n,
+                                      *alpha,
+                                      xs,
+                                      incx,
+                                      SCALE_Y ? *beta : *alpha,
+                                      ys,
+                                      incy,
+                                      zs,
+                                      incz,
+                                      nblocks,
+                                      workspace,
+                                      tickets,
+                                      output);
+            return rocblas_status_success;
+        };
+
+        return rocblas_fused_reduction_launcher<NB, 1, FINALIZE>(
+            handle, n, (T*)w_mem, result, launch);
+    }
+
+    template <typename T>
+    rocblas_status rocblas_axpy_dot_impl(rocblas_handle handle,
+                                         rocblas_int    n,
+                                         const T*       alpha,
+                                         const T*       x,
+                                         rocblas_int    incx,
+                                         T*             y,
+                                         rocblas_int    incy,
+                                         const T*       z,
+                                         rocblas_int    incz,
+                                         T*             result)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        return rocblas_axpby_reduce_impl<false, rocblas_finalize_identity>(handle,
+                                                                           rocblas_axpy_dot_name<T>,
+                                                                           n,
+                                                                           alpha,
+                                                                           x,
+                                                                           incx,
+                                                                           nullptr,
+                                                                           y,
+                                                                           incy,
+                                                                           z,
+                                                                           incz,
+                                                                           result);
+    }
+
+    template <typename T>
+    rocblas_status rocblas_axpby_nrm2_impl(rocblas_handle handle,
+                                           rocblas_int    n,
+                                           const T*       alpha,
+                                           const T*       x,
+                                           rocblas_int    incx,
+                                           const T*       beta,
+                                           T*             y,
+                                           rocblas_int    incy,
+                                           T*             result)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        return rocblas_axpby_reduce_impl<true, rocblas_finalize_nrm2>(handle,
+                                                                      rocblas_axpby_nrm2_name<T>,
+                                                                      n,
+                                                                      alpha,
+                                                                      x,
+                                                                      incx,
+                                                                      beta,
+                                                                      y,
+                                                                      incy,
+                                                                      (const T*)nullptr,
+                                                                      0,
+                                                                      result);
+    }
+
+    template <typename T>
+    rocblas_status rocblas_dot2_impl(rocblas_handle handle,
+                                     rocblas_int    n,
+                                     const T*       x,
+                                     rocblas_int    incx,
+                                     const T*       y,
+                                     rocblas_int    incy,
+                                     const T*       z,
+                                     rocblas_int    incz,
+                                     T*             result)
+    {
+        static constexpr int NB = ROCBLAS_FUSED_REDUCTION_NB;
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        size_t dev_bytes = rocblas_reduction_kernel_workspace_size<rocblas_int, NB, T>(n, 2);
+        if(handle->is_device_memory_size_query())
+        {
+            if(n <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle, rocblas_dot2_name<T>, n, x, incx, y, incy, z, incz);
+
+        if(!result)
+            return rocblas_status_invalid_pointer;
+        if(n <= 0)
+            return rocblas_fused_zero_results(handle, result, 2);
+        if(!x || !y || !z)
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->reduction_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        const T* xs = rocblas_fused_shift(x, n, incx);
+        const T* ys = rocblas_fused_shift(y, n, incy);
+        const T* zs = rocblas_fused_shift(z, n, incz);
+
+        auto launch = [&](dim3          grid,
+                          dim3          threads,
+                          rocblas_int   nblocks,
+                          T*            workspace,
+                          unsigned int* tickets,
+                          T*            output) -> rocblas_status {
+            ROCBLAS_LAUNCH_KERNEL((rocblas_dot2_kernel<NB>),
+                                  grid,
+                                  threads,
+                                  0,
+                                  handle->get_stream(),
+                                  n,
+                                  xs,
+                                  incx,
+                                  ys,
+                                  incy,
+                                  zs,
+                                  incz,
+                                  nblocks,
+                                  workspace,
+                                  tickets,
+                                  output);
+            return rocblas_status_success;
+        };
+
+        return rocblas_fused_reduction_launcher<NB, 2, rocblas_finalize_identity>(
+            handle, n, (T*)w_mem, result, launch);
+    }
+
+    // x_i = x_i / ||x_i|| and results[i] = ||x_i|| for each vector of the batch
+    template <typename T>
+    rocblas_status rocblas_normalize_strided_batched_impl(rocblas_handle handle,
+                                                          rocblas_int    n,
+                                                          T*             x,
+                                                          rocblas_int    incx,
+                                                          rocblas_stride stridex,
+                                                          rocblas_int    batch_count,
+                                                          real_t<T>*     results)
+    {
+        using Tr = real_t<T>;
+
+        static constexpr int NB_SMALL = ROCBLAS_NORMALIZE_NB;
+        static constexpr int REGS     = ROCBLAS_NORMALIZE_REGS;
+        static constexpr int NB       = ROCBLAS_NRM2_NB;
+        static constexpr int NB_SCAL  = ROCBLAS_SCAL_NB;
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // Longer vectors take their norms from the nrm2 launcher into the workspace, after its
+        // partial results, and a second pass scales them
+        bool   small        = n <= NB_SMALL * REGS;
+        bool   device       = handle->pointer_mode == rocblas_pointer_mode_device;
+        size_t norms_bytes  = sizeof(Tr) * std::max(batch_count, 1);
+        size_t reduce_bytes = small ? 0
+                                    : rocblas_reduction_kernel_workspace_size<rocblas_int, NB, Tr>(
+                                        n, batch_count);
+        bool   in_results   = results && device;
+        size_t dev_bytes    = reduce_bytes + (in_results || (small && !results) ? 0 : norms_bytes);
+        if(handle->is_device_memory_size_query())
+        {
+            if(n <= 0 || incx <= 0 || batch_count <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle, rocblas_normalize_name<T>, n, x, incx, stridex, batch_count);
+
+        if(batch_count <= 0)
+            return rocblas_status_success;
+        if(n <= 0 || incx <= 0)
+            return results ? rocblas_fused_zero_results(handle, results, batch_count)
+                           : rocblas_status_success;
+        if(!x)
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->reduction_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        Tr* norms = in_results ? results : (Tr*)w_mem + reduce_bytes / sizeof(Tr);
+
+        if(small)
+        {
+            ROCBLAS_LAUNCH_KERNEL((rocblas_normalize_small_kernel<NB_SMALL, REGS>),
+                                  dim3(batch_count),
+                                  dim3(NB_SMALL),
+                                  0,
+                                  handle->get_stream(),
+                                  n,
+                                  x,
+                                  incx,
+                                  stridex,
+                                  results ? norms : nullptr);
+        }
+        else
+        {
+            {
+                auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_device);
+                RETURN_IF_ROCBLAS_ERROR(
+                    (ROCBLAS_API(rocblas_internal_asum_nrm2_launcher)<rocblas_int,
+                                                                      NB,
+                                                                      rocblas_fetch_nrm2<Tr>,
+                                                                      rocblas_finalize_nrm2>(
+                        handle, n, (const T*)x, 0, incx, stridex, batch_count, (Tr*)w_mem, norms)));
+            }
+
+            for(int64_t b_base = 0; b_base < batch_count; b_base += c_i64_grid_YZ_chunk)
+            {
+                int32_t batches = int32_t(std::min(batch_count - b_base, c_i64_grid_YZ_chunk));
+                ROCBLAS_LAUNCH_KERNEL((rocblas_normalize_scale_kernel<NB_SCAL>),
+                                      dim3((n - 1) / NB_SCAL + 1, batches),
+                                      dim3(NB_SCAL),
+                                      0,
+                                      handle->get_stream(),
+                                      n,
+                                      x + b_base * stridex,
+                                      incx,
+                                      stridex,
+                                      norms + b_base);
+            }
+        }
+
+        if(results && !device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(results,
+                                               norms,
+                                               sizeof(Tr) * batch_count,
+                                               hipMemcpyDeviceToHost,
+                                               handle->get_stream()));
+            RETURN_IF_ROCBLAS_ERROR(handle->sync_host_results());
+        }
+        return rocblas_status_success;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(name_, T_)                                                                        \
+    rocblas_status name_(rocblas_handle handle,                                                \
+                         rocblas_int    n,                                                     \
+                         const T_*      alpha,                                                 \
+                         const T_*      x,                                                     \
+                         rocblas_int    incx,                                                  \
+                         T_*            y,                                                     \
+                         rocblas_int    incy,                                                  \
+                         const T_*      z,                                                     \
+                         rocblas_int    incz,                                                  \
+                         T_*            result)                                                \
+    try                                                                                        \
+    {                                                                                          \
+        return rocblas_axpy_dot_impl<T_>(handle, n, alpha, x, incx, y, incy, z, incz, result); \
+    }                                                                                          \
+    catch(...)                                                                                 \
+    {                                                                                          \
+        return exception_to_rocblas_status();                                                  \
+    }
+
+extern "C" {
+
+IMPL(rocblas_saxpy_dot, float);
+IMPL(rocblas_daxpy_dot, double);
+
+} // extern "C"
+
+#undef IMPL
+
+#define IMPL(name_, T_)                                                                       \
+    rocblas_status name_(rocblas_handle handle,                                               \
+                         rocblas_int    n,                                                    \
+                         const T_*      alpha,                                                \
+                         const T_*      x,                                                    \
+                         rocblas_int    incx,                                                 \
+                         const T_*      beta,                                                 \
+                         T_*            y,                                                    \
+                         rocblas_int    incy,                                                 \
+                         T_*            result)                                               \
+    try                                                                                       \
+    {                                                                                         \
+        return rocblas_axpby_nrm2_impl<T_>(handle, n, alpha, x, incx, beta, y, incy, result); \
+    }                                                                                         \
+    catch(...)                                                                                \
+    {                                                                                         \
+        return exception_to_rocblas_status();                                                 \
+    }
+
+extern "C" {
+
+IMPL(rocblas_saxpby_nrm2, float);
+IMPL(rocblas_daxpby_nrm2, double);
+
+} // extern "C"
+
+#undef IMPL
+
+#define IMPL(name_, T_)                                                             \
+    rocblas_status name_(rocblas_handle handle,                                     \
+                         rocblas_int    n,                                          \
+                         const T_*      x,                                          \
+                         rocblas_int    incx,                                       \
+                         const T_*      y,                                          \
+                         rocblas_int    incy,                                       \
+                         const T_*      z,                                          \
+                         rocblas_int    incz,                                       \
+                         T_*            result)                                     \
+    try                                                                             \
+    {                                                                               \
+        return rocblas_dot2_impl<T_>(handle, n, x, incx, y, incy, z, incz, result); \
+    }                                                                               \
+    catch(...)                                                                      \
+    {                                                                               \
+        return exception_to_rocblas_status();                                       \
+    }
+
+extern "C" {
+
+IMPL(rocblas_sdot2, float);
+IMPL(rocblas_ddot2, double);
+
+} // extern "C"
+
+#undef IMPL
+
+#define IMPL(name_, T_)                                         \
+    rocblas_status name_(rocblas_handle handle,                 \
+                         rocblas_int    n,                      \
+                         T_*            x,                      \
+                         rocblas_int    incx,                   \
+                         rocblas_stride stridex,                \
+                         rocblas_int    batch_count,            \
+                         real_t<T_>*    results)                \
+    try                                                         \
+    {                                                           \
+        return rocblas_normalize_strided_batched_impl<T_>(      \
+            handle, n, x, incx, stridex, batch_count, results); \
+    }                                                           \
+    catch(...)                                                  \
+    {                                                           \
+        return exception_to_rocblas_status();                   \
+    }
+
+extern "C" {
+
+IMPL(rocblas_snormalize_strided_batched, float);
+IMPL(rocblas_dnormalize_strided_batched, double);
+IMPL(rocblas_cnormalize_strided_batched, rocblas_float_complex);
+IMPL(rocblas_znormalize_strided_batched, rocblas_double_complex);
+
+} // extern "C"
+
+#undef IMPL
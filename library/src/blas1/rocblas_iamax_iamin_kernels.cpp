@@ -27,9 +27,9 @@
     \details
     rocblas_internal_iamax_iamin_launcher computes a reduction over multiple vectors x_i
               Template parameters allow threads per block, data, and specific phase kernel overrides
-              At least two kernels are needed to finish the reduction
               kernel 1 write partial result per thread block in workspace, blocks partial results
               kernel 2 gathers all the partial result in workspace and finishes the final reduction.
+              Unless atomics are not allowed, kernel 2 is done by the last block of kernel 1.
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
@@ -77,31 +77,127 @@ rocblas_status rocblas_internal_iamax_iamin_launcher(rocblas_handle handle,
                                                      To*            workspace,
                                                      Tr*            result)
 {
+    rocblas_roctx_phase roctx_phase(handle, "reduction", "N", n, "batch_count", batch_count);
+
+    if(n <= 1024 && batch_count >= 256)
+    {
+        // Optimized kernel for small n and bigger batch_count
+        static constexpr int NB_Y = 4;
+
+        dim3 grid((batch_count - 1) / NB_Y + 1);
+
+        Tr* output = result; // device mode output directly to result
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+            output = (Tr*)workspace;
+
+        // warpSize for (gfx10xx/gfx11xx/gfx12xx) is 32 and the rest is 64
+        int arch_major = handle->getArchMajor();
+        if(arch_major == 10 || arch_major == 11 || arch_major == 12)
+        {
+            static constexpr int NB_X = 32;
+            ROCBLAS_LAUNCH_KERNEL(
+                (rocblas_iamax_iamin_small_n_batched_kernel<NB_X, NB_Y, FETCH, REDUCE>),
+                grid,
+                dim3(NB_X, NB_Y),
+                0,
+                handle->get_stream(),
+                n,
+                x,
+                shiftx,
+                incx,
+                stridex,
+                batch_count,
+                workspace,
+                output);
+        }
+        else
+        {
+            static constexpr int NB_X = 64;
+            ROCBLAS_LAUNCH_KERNEL(
+                (rocblas_iamax_iamin_small_n_batched_kernel<NB_X, NB_Y, FETCH, REDUCE>),
+                grid,
+                dim3(NB_X, NB_Y),
+                0,
+                handle->get_stream(),
+                n,
+                x,
+                shiftx,
+                incx,
+                stridex,
+                batch_count,
+                workspace,
+                output);
+        }
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(result,
+                                               output,
+                                               batch_count * sizeof(Tr),
+                                               hipMemcpyDeviceToHost,
+                                               handle->get_stream()));
+            RETURN_IF_ROCBLAS_ERROR(handle->sync_host_results());
+        }
+        return rocblas_status_success;
+    }
+
     rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB);
 
-    ROCBLAS_LAUNCH_KERNEL((rocblas_iamax_iamin_kernel_part1<NB, FETCH, REDUCE>),
-                          dim3(blocks, batch_count),
-                          NB,
-                          0,
-                          handle->get_stream(),
-                          n,
-                          blocks,
-                          x,
-                          shiftx,
-                          incx,
-                          stridex,
-                          workspace);
+    bool reduceKernel
+        = handle->pointer_mode == rocblas_pointer_mode_device || blocks > 1 || batch_count > 1;
+    // result is in the beginning of workspace[0]+offset, and can be copied directly.
+    size_t offset = reduceKernel ? size_t(batch_count) * blocks : 0;
 
-    if(handle->pointer_mode == rocblas_pointer_mode_device)
+    // kernel 2 is folded into kernel 1 if single-pass reduction counters are available
+    unsigned int* tickets = reduceKernel ? handle->get_reduction_tickets(batch_count) : nullptr;
+    if(tickets)
     {
-        ROCBLAS_LAUNCH_KERNEL((rocblas_iamax_iamin_kernel_part2<NB, REDUCE>),
-                              dim3(1, batch_count),
+        Tr* output = handle->pointer_mode == rocblas_pointer_mode_device
+                         ? result
+                         : (Tr*)(workspace + offset);
+
+        ROCBLAS_LAUNCH_KERNEL((rocblas_iamax_iamin_kernel_single_pass<NB, FETCH, REDUCE>),
+                              dim3(blocks, batch_count),
                               NB,
                               0,
                               handle->get_stream(),
+                              n,
                               blocks,
+                              x,
+                              shiftx,
+                              incx,
+                              stridex,
                               workspace,
-                              result);
+                              tickets,
+                              output);
+    }
+    else
+    {
+        ROCBLAS_LAUNCH_KERNEL((rocblas_iamax_iamin_kernel_part1<NB, FETCH, REDUCE>),
+                              dim3(blocks, batch_count),
+                              NB,
+                              0,
+                              handle->get_stream(),
+                              n,
+                              blocks,
+                              x,
+                              shiftx,
+                              incx,
+                              stridex,
+                              workspace);
+    }
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+    {
+        if(!tickets)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_iamax_iamin_kernel_part2<NB, REDUCE>),
+                                  dim3(1, batch_count),
+                                  NB,
+                                  0,
+                                  handle->get_stream(),
+                                  blocks,
+                                  workspace,
+                                  result);
     }
     else
     {
@@ -110,11 +206,7 @@ rocblas_status rocblas_internal_iamax_iamin_launcher(rocblas_handle handle,
         // it must be a standard layout type and its first member must be of type Tr.
         static_assert(std::is_standard_layout<To>{}, "To must be a standard layout type");
 
-        bool reduceKernel = blocks > 1 || batch_count > 1;
-        // result is in the beginning of workspace[0]+offset, and can be copied directly.
-        size_t offset = reduceKernel ? size_t(batch_count) * blocks : 0;
-
-        if(reduceKernel)
+        if(reduceKernel && !tickets)
         {
             ROCBLAS_LAUNCH_KERNEL((rocblas_iamax_iamin_kernel_part2<NB, REDUCE>),
                                   dim3(1, batch_count),
@@ -131,7 +223,7 @@ rocblas_status rocblas_internal_iamax_iamin_launcher(rocblas_handle handle,
                                            batch_count * sizeof(Tr),
                                            hipMemcpyDeviceToHost,
                                            handle->get_stream()));
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+        RETURN_IF_ROCBLAS_ERROR(handle->sync_host_results());
     }
     return rocblas_status_success;
 }
@@ -25,6 +25,7 @@
 #include "rocblas_block_sizes.h"
 #include "rocblas_iamax_iamin.hpp"
 #include "rocblas_reduction.hpp"
+#include "roctx_ranges.hpp"
 
 // iamax, iamin kernels
 
@@ -101,11 +102,21 @@ rocblas_iamax_iamin_kernel_part1(rocblas_int    n,
         workspace[blockIdx.y * nblocks + blockIdx.x] = sum;
 }
 
-// kernel 2 gathers all the partial results in workspace and finishes the final reduction;
+// stores the index of the result of a reduction, or the whole index-value pair if Tr is To
+template <typename To, typename Tr>
+__forceinline__ __device__ void rocblas_iamax_iamin_store(Tr& result, const To& sum)
+{
+    if constexpr(std::is_same_v<Tr, To>)
+        result = sum;
+    else
+        result = sum.index;
+}
+
+// gathers all the partial results of a batch in workspace and finishes the final reduction;
 // number of threads (NB) loop blocks
 template <int NB, typename REDUCE, typename To, typename Tr>
-ROCBLAS_KERNEL(NB)
-rocblas_iamax_iamin_kernel_part2(rocblas_int nblocks, To* workspace, Tr* result)
+__inline__ __device__ void
+    rocblas_iamax_iamin_finish(rocblas_int nblocks, To* workspace, Tr* result)
 {
     rocblas_int tx = threadIdx.x;
     To          sum;
@@ -128,5 +139,83 @@ rocblas_iamax_iamin_kernel_part2(rocblas_int nblocks, To* workspace, Tr* result)
 
     // Store result on device or in workspace
     if(tx == 0)
-        result[blockIdx.y] = sum.index;
+        rocblas_iamax_iamin_store(result[blockIdx.y], sum);
+}
+
+// kernel 2 gathers all the partial results in workspace and finishes the final reduction
+template <int NB, typename REDUCE, typename To, typename Tr>
+ROCBLAS_KERNEL(NB)
+rocblas_iamax_iamin_kernel_part2(rocblas_int nblocks, To* workspace, Tr* result)
+{
+    rocblas_iamax_iamin_finish<NB, REDUCE>(nblocks, workspace, result);
+}
+
+// kernel 1 and kernel 2 in a single launch, the last block of each batch to finish does the
+// work of kernel 2
+template <int NB, typename FETCH, typename REDUCE, typename TPtrX, typename To, typename Tr>
+ROCBLAS_KERNEL(NB)
+rocblas_iamax_iamin_kernel_single_pass(rocblas_int    n,
+                                       rocblas_int    nblocks,
+                                       TPtrX          xvec,
+                                       rocblas_stride shiftx,
+                                       rocblas_int    incx,
+                                       rocblas_stride stridex,
+                                       To*            workspace,
+                                       unsigned int*  tickets,
+                                       Tr*            result)
+{
+    int64_t tid = blockIdx.x * blockDim.x + threadIdx.x;
+    To      sum;
+
+    const auto* x = load_ptr_batch(xvec, blockIdx.y, shiftx, stridex);
+
+    // bound
+    if(tid < n)
+        sum = FETCH{}(x[tid * incx], tid + 1); // 1-based indexing
+    else
+        sum = rocblas_default_value<To>{}(); // pad with default value
+
+    sum = rocblas_shuffle_block_reduce_method<NB, REDUCE>(sum);
+
+    if(threadIdx.x == 0)
+        workspace[blockIdx.y * nblocks + blockIdx.x] = sum;
+
+    if(rocblas_reduction_last_block(tickets, nblocks))
+        rocblas_iamax_iamin_finish<NB, REDUCE>(nblocks, workspace, result);
+}
+
+// Small n kernel for large batch counts: each block reduces NB_Y batches with one wavefront
+// of NB_X threads per batch, so no workspace or second kernel is needed
+template <int NB_X,
+          int NB_Y,
+          typename FETCH,
+          typename REDUCE,
+          typename TPtrX,
+          typename To,
+          typename Tr>
+ROCBLAS_KERNEL(NB_X* NB_Y)
+rocblas_iamax_iamin_small_n_batched_kernel(rocblas_int    n,
+                                           TPtrX          xvec,
+                                           rocblas_stride shiftx,
+                                           rocblas_int    incx,
+                                           rocblas_stride stridex,
+                                           rocblas_int    batch_count,
+                                           To*            sum_type,
+                                           Tr*            result)
+{
+    // whole wavefronts return, so the wavefront reduction below is not affected
+    uint32_t batch = blockIdx.x * NB_Y + threadIdx.y;
+    if(batch >= batch_count)
+        return;
+
+    const auto* x = load_ptr_batch(xvec, batch, shiftx, stridex);
+
+    To sum = rocblas_default_value<To>{}();
+    for(rocblas_int tid = threadIdx.x; tid < n; tid += NB_X)
+        REDUCE{}(sum, FETCH{}(x[tid * int64_t(incx)], tid + 1)); // 1-based indexing
+
+    sum = rocblas_wavefront_reduce_method<NB_X, REDUCE>(sum);
+
+    if(threadIdx.x == 0)
+        result[batch] = sum.index;
 }
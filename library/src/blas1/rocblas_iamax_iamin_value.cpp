@@ -0,0 +1,275 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "int64_helpers.hpp"
+#include "logging.hpp"
+#include "rocblas_block_sizes.h"
+#include "rocblas_iamax_iamin.hpp"
+#include "rocblas_iamax_iamin_kernels.hpp"
+
+namespace
+{
+    template <bool, typename>
+    constexpr char rocblas_iamax_iamin_value_name[] = "unknown";
+    template <>
+    constexpr char rocblas_iamax_iamin_value_name<true, float>[] = "rocblas_isamax_value";
+    template <>
+    constexpr char rocblas_iamax_iamin_value_name<true, double>[] = "rocblas_idamax_value";
+    template <>
+    constexpr char rocblas_iamax_iamin_value_name<true, rocblas_float_complex>[]
+        = "rocblas_icamax_value";
+    template <>
+    constexpr char rocblas_iamax_iamin_value_name<true, rocblas_double_complex>[]
+        = "rocblas_izamax_value";
+    template <>
+    constexpr char rocblas_iamax_iamin_value_name<false, float>[] = "rocblas_isamin_value";
+    template <>
+    constexpr char rocblas_iamax_iamin_value_name<false, double>[] = "rocblas_idamin_value";
+    template <>
+    constexpr char rocblas_iamax_iamin_value_name<false, rocblas_float_complex>[]
+        = "rocblas_icamin_value";
+    template <>
+    constexpr char rocblas_iamax_iamin_value_name<false, rocblas_double_complex>[]
+        = "rocblas_izamin_value";
+
+    // splits the index-value pairs of the reductions into the index and value arrays
+    template <int NB, typename To, typename S>
+    ROCBLAS_KERNEL(NB)
+    rocblas_iamax_iamin_value_split_kernel(rocblas_int  batch_count,
+                                           const To*    pairs,
+                                           rocblas_int* index,
+                                           S*           value)
+    {
+        int64_t b = blockIdx.x * int64_t(NB) + threadIdx.x;
+        if(b < batch_count)
+        {
+            index[b] = pairs[b].index;
+            value[b] = pairs[b].index ? pairs[b].value : S(0);
+        }
+    }
+
+    template <bool AMAX, typename T>
+    rocblas_status rocblas_iamax_iamin_value_impl(rocblas_handle handle,
+                                                  rocblas_int    n,
+                                                  const T*       x,
+                                                  rocblas_int    incx,
+                                                  rocblas_stride stridex,
+                                                  rocblas_int    batch_count,
+                                                  rocblas_int*   index,
+                                                  real_t<T>*     value)
+    {
+        using S           = real_t<T>;
+        using index_val_t = rocblas_index_value_t<S>;
+        using REDUCE      = std::conditional_t<AMAX, rocblas_reduce_amax, rocblas_reduce_amin>;
+        using FETCH       = rocblas_fetch_amax_amin<S>;
+
+        static constexpr int NB = ROCBLAS_IAMAX_NB;
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        bool   device = handle->pointer_mode == rocblas_pointer_mode_device;
+        size_t dev_bytes
+            = rocblas_reduction_kernel_workspace_size<rocblas_int, NB, index_val_t>(n, batch_count);
+        size_t index_bytes = device ? 0 : sizeof(rocblas_int) * batch_count;
+        size_t value_bytes = device ? 0 : sizeof(S) * batch_count;
+
+        if(handle->is_device_memory_size_query())
+        {
+            if(n <= 0 || incx <= 0 || batch_count <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes, index_bytes, value_bytes);
+        }
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_iamax_iamin_value_name<AMAX, T>,
+                      n,
+                      x,
+                      incx,
+                      stridex,
+                      batch_count);
+
+        if(!value)
+            return rocblas_status_invalid_pointer;
+
+        rocblas_status arg_status
+            = rocblas_iamax_iamin_arg_check(handle, n, x, incx, stridex, batch_count, index);
+        if(arg_status != rocblas_status_continue)
+        {
+            // the value of an empty reduction is 0 as its index
+            if(arg_status == rocblas_status_success && batch_count > 0)
+            {
+                if(device)
+                    RETURN_IF_HIP_ERROR(hipMemsetAsync(
+                        value, 0, sizeof(S) * batch_count, handle->get_stream()));
+                else
+                    std::fill_n(value, batch_count, S(0));
+            }
+            return arg_status;
+        }
+
+        auto w_mem = handle->device_malloc(dev_bytes, index_bytes, value_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        index_val_t* workspace = (index_val_t*)w_mem[0];
+        rocblas_int  blocks    = rocblas_reduction_kernel_block_count(n, NB);
+        index_val_t* pairs     = workspace + size_t(batch_count) * blocks;
+        rocblas_int* index_out = device ? index : (rocblas_int*)w_mem[1];
+        S*           value_out = device ? value : (S*)w_mem[2];
+
+        static constexpr rocblas_stride shiftx_0 = 0;
+
+        for(int64_t b_base = 0; b_base < batch_count; b_base += c_i64_grid_YZ_chunk)
+        {
+            rocblas_int  batches = rocblas_int(std::min(batch_count - b_base, c_i64_grid_YZ_chunk));
+            const T*     xb      = x + b_base * stridex;
+            index_val_t* wb      = workspace + b_base * blocks;
+
+            unsigned int* tickets = handle->get_reduction_tickets(batches);
+            if(tickets)
+            {
+                ROCBLAS_LAUNCH_KERNEL((rocblas_iamax_iamin_kernel_single_pass<NB, FETCH, REDUCE>),
+                                      dim3(blocks, batches),
+                                      NB,
+                                      0,
+                                      handle->get_stream(),
+                                      n,
+                                      blocks,
+                                      xb,
+                                      shiftx_0,
+                                      incx,
+                                      stridex,
+                                      wb,
+                                      tickets,
+                                      pairs + b_base);
+            }
+            else
+            {
+                ROCBLAS_LAUNCH_KERNEL((rocblas_iamax_iamin_kernel_part1<NB, FETCH, REDUCE>),
+                                      dim3(blocks, batches),
+                                      NB,
+                                      0,
+                                      handle->get_stream(),
+                                      n,
+                                      blocks,
+                                      xb,
+                                      shiftx_0,
+                                      incx,
+                                      stridex,
+                                      wb);
+
+                ROCBLAS_LAUNCH_KERNEL((rocblas_iamax_iamin_kernel_part2<NB, REDUCE>),
+                                      dim3(1, batches),
+                                      NB,
+                                      0,
+                                      handle->get_stream(),
+                                      blocks,
+                                      wb,
+                                      pairs + b_base);
+            }
+        }
+
+        ROCBLAS_LAUNCH_KERNEL((rocblas_iamax_iamin_value_split_kernel<NB>),
+                              dim3((batch_count - 1) / NB + 1),
+                              NB,
+                              0,
+                              handle->get_stream(),
+                              batch_count,
+                              pairs,
+                              index_out,
+                              value_out);
+
+        if(!device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                index, index_out, index_bytes, hipMemcpyDeviceToHost, handle->get_stream()));
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                value, value_out, value_bytes, hipMemcpyDeviceToHost, handle->get_stream()));
+            RETURN_IF_ROCBLAS_ERROR(handle->sync_host_results());
+        }
+        return rocblas_status_success;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(name_, AMAX_, T_)                                         \
+    rocblas_status name_(rocblas_handle handle,                        \
+                         rocblas_int    n,                             \
+                         const T_*      x,                             \
+                         rocblas_int    incx,                          \
+                         rocblas_int*   index,                         \
+                         real_t<T_>*    value)                         \
+    try                                                                \
+    {                                                                  \
+        return rocblas_iamax_iamin_value_impl<AMAX_, T_>(              \
+            handle, n, x, incx, 0, 1, index, value);                   \
+    }                                                                  \
+    catch(...)                                                         \
+    {                                                                  \
+        return exception_to_rocblas_status();                          \
+    }                                                                  \
+                                                                       \
+    rocblas_status name_##_strided_batched(rocblas_handle handle,      \
+                                           rocblas_int    n,           \
+                                           const T_*      x,           \
+                                           rocblas_int    incx,        \
+                                           rocblas_stride stridex,     \
+                                           rocblas_int    batch_count, \
+                                           rocblas_int*   index,       \
+                                           real_t<T_>*    value)       \
+    try                                                                \
+    {                                                                  \
+        return rocblas_iamax_iamin_value_impl<AMAX_, T_>(              \
+            handle, n, x, incx, stridex, batch_count, index, value);   \
+    }                                                                  \
+    catch(...)                                                         \
+    {                                                                  \
+        return exception_to_rocblas_status();                          \
+    }
+
+extern "C" {
+
+IMPL(rocblas_isamax_value, true, float);
+IMPL(rocblas_idamax_value, true, double);
+IMPL(rocblas_icamax_value, true, rocblas_float_complex);
+IMPL(rocblas_izamax_value, true, rocblas_double_complex);
+IMPL(rocblas_isamin_value, false, float);
+IMPL(rocblas_idamin_value, false, double);
+IMPL(rocblas_icamin_value, false, rocblas_float_complex);
+IMPL(rocblas_izamin_value, false, rocblas_double_complex);
+
+} // extern "C"
+
+#undef IMPL
@@ -0,0 +1,253 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "int64_helpers.hpp"
+#include "logging.hpp"
+#include "rocblas_block_sizes.h"
+#include "rocblas_dot_kernels.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_mdot_name[] = "unknown";
+    template <>
+    constexpr char rocblas_mdot_name<float>[] = "rocblas_smdot";
+    template <>
+    constexpr char rocblas_mdot_name<double>[] = "rocblas_dmdot";
+
+    // Columns of Y per thread block; each element of x loaded is reused for all of them
+    constexpr int ROCBLAS_MDOT_KB = 8;
+
+    // sums the nblocks partial results of one column in a single block
+    template <int NB, typename T>
+    __device__ void rocblas_mdot_finish(rocblas_int nblocks, const T* work, T* out)
+    {
+        T sum = T(0);
+        for(rocblas_int i = threadIdx.x; i < nblocks; i += NB)
+            sum += work[i];
+
+        sum = rocblas_dot_block_reduce<NB>(sum);
+        if(threadIdx.x == 0)
+            *out = sum;
+    }
+
+    // partial results of x * Y[:, j] for the KB columns j of blockIdx.y, stored in workspace
+    // at j * nblocks + blockIdx.x
+    template <int NB, int WIN, int KB, typename T>
+    ROCBLAS_KERNEL(NB)
+    rocblas_mdot_kernel(rocblas_int   n,
+                        rocblas_int   k,
+                        const T*      x,
+                        int64_t       incx,
+                        const T*      Y,
+                        int64_t       ldy,
+                        rocblas_int   nblocks,
+                        T*            workspace,
+                        unsigned int* tickets,
+                        T*            result)
+    {
+        int64_t col0 = int64_t(blockIdx.y) * KB;
+        T       sums[KB];
+        for(int c = 0; c < KB; c++)
+            sums[c] = T(0);
+
+        // sum WIN elements per thread
+        int inc = blockDim.x * gridDim.x;
+        int i   = blockIdx.x * blockDim.x + threadIdx.x;
+        for(int j = 0; j < WIN && i < n; j++, i += inc)
+        {
+            T xv = x[i * incx];
+#pragma unroll
+            for(int c = 0; c < KB; c++)
+                if(col0 + c < k)
+                    sums[c] += xv * Y[(col0 + c) * ldy + i];
+        }
+
+#pragma unroll
+        for(int c = 0; c < KB; c++)
+            sums[c] = rocblas_dot_block_reduce<NB>(sums[c]);
+
+        if(threadIdx.x == 0)
+            for(int c = 0; c < KB && col0 + c < k; c++)
+                workspace[(col0 + c) * nblocks + blockIdx.x] = sums[c];
+
+        if(tickets && rocblas_reduction_last_block(tickets, nblocks))
+            for(int c = 0; c < KB && col0 + c < k; c++)
+                rocblas_mdot_finish<NB>(
+                    nblocks, workspace + (col0 + c) * nblocks, result + col0 + c);
+    }
+
+    // finishes column blockIdx.y when the reduction is not done by the last block
+    template <int NB, typename T>
+    ROCBLAS_KERNEL(NB)
+    rocblas_mdot_reduce_kernel(rocblas_int nblocks, const T* workspace, T* result)
+    {
+        rocblas_mdot_finish<NB>(
+            nblocks, workspace + size_t(blockIdx.y) * nblocks, result + blockIdx.y);
+    }
+
+    template <typename T>
+    rocblas_status rocblas_mdot_impl(rocblas_handle handle,
+                                     rocblas_int    n,
+                                     rocblas_int    k,
+                                     const T*       x,
+                                     rocblas_int    incx,
+                                     const T*       Y,
+                                     rocblas_int    ldy,
+                                     T*             result)
+    {
+        static constexpr int NB  = ROCBLAS_DOT_NB;
+        static constexpr int WIN = rocblas_dot_WIN<T>();
+        static constexpr int KB  = ROCBLAS_MDOT_KB;
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        size_t dev_bytes = rocblas_reduction_kernel_workspace_size<rocblas_int, NB * WIN, T>(n, k);
+        if(handle->is_device_memory_size_query())
+        {
+            if(n <= 0 || k <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle, rocblas_mdot_name<T>, n, k, x, incx, Y, ldy);
+
+        if(k < 0 || ldy < std::max(n, 1))
+            return rocblas_status_invalid_size;
+        if(!k)
+            return rocblas_status_success;
+        if(!result)
+            return rocblas_status_invalid_pointer;
+
+        if(n <= 0)
+        {
+            if(handle->pointer_mode == rocblas_pointer_mode_device)
+                RETURN_IF_HIP_ERROR(
+                    hipMemsetAsync(result, 0, sizeof(T) * k, handle->get_stream()));
+            else
+                std::fill_n(result, k, T(0));
+            return rocblas_status_success;
+        }
+
+        if(!x || !Y)
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->reduction_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        T*          workspace = (T*)w_mem;
+        rocblas_int nblocks   = rocblas_reduction_kernel_block_count(n, NB * WIN);
+        bool        device    = handle->pointer_mode == rocblas_pointer_mode_device;
+        T*          output    = device ? result : workspace + size_t(k) * nblocks;
+
+        // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+        const T* xs = incx < 0 ? x - int64_t(incx) * (n - 1) : x;
+
+        // each launch covers up to c_i64_grid_YZ_chunk groups of KB columns
+        for(int64_t j_base = 0; j_base < k; j_base += c_i64_grid_YZ_chunk * KB)
+        {
+            rocblas_int k_chunk = rocblas_int(std::min(k - j_base, c_i64_grid_YZ_chunk * KB));
+            rocblas_int groups  = (k_chunk - 1) / KB + 1;
+
+            unsigned int* tickets = handle->get_reduction_tickets(groups);
+
+            ROCBLAS_LAUNCH_KERNEL((rocblas_mdot_kernel<NB, WIN, KB>),
+                                  dim3(nblocks, groups),
+                                  dim3(NB),
+                                  0,
+                                  handle->get_stream(),
+                                  n,
+                                  k_chunk,
+                                  xs,
+                                  incx,
+                                  Y + j_base * ldy,
+                                  ldy,
+                                  nblocks,
+                                  workspace + j_base * nblocks,
+                                  tickets,
+                                  output + j_base);
+
+            if(!tickets)
+                ROCBLAS_LAUNCH_KERNEL((rocblas_mdot_reduce_kernel<NB>),
+                                      dim3(1, k_chunk),
+                                      dim3(NB),
+                                      0,
+                                      handle->get_stream(),
+                                      nblocks,
+                                      workspace + j_base * nblocks,
+                                      output + j_base);
+        }
+
+        if(!device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(result,
+                                               output,
+                                               sizeof(T) * k,
+                                               hipMemcpyDeviceToHost,
+                                               handle->get_stream()));
+            RETURN_IF_ROCBLAS_ERROR(handle->sync_host_results());
+        }
+        return rocblas_status_success;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(name_, T_)                                                        \
+    rocblas_status name_(rocblas_handle handle,                                \
+                         rocblas_int    n,                                     \
+                         rocblas_int    k,                                     \
+                         const T_*      x,                                     \
+                         rocblas_int    incx,                                  \
+                         const T_*      Y,                                     \
+                         rocblas_int    ldy,                                   \
+                         T_*            result)                                \
+    try                                                                        \
+    {                                                                          \
+        return rocblas_mdot_impl<T_>(handle, n, k, x, incx, Y, ldy, result);   \
+    }                                                                          \
+    catch(...)                                                                 \
+    {                                                                          \
+        return exception_to_rocblas_status();                                  \
+    }
+
+extern "C" {
+
+IMPL(rocblas_smdot, float);
+IMPL(rocblas_dmdot, double);
+
+} // extern "C"
+
+#undef IMPL
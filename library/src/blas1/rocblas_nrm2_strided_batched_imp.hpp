@@ -74,6 +74,8 @@ namespace
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
 
+        rocblas_api_scope api_scope(handle, rocblas_nrm2_strided_batched_name<Ti>);
+
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(
                 handle, rocblas_nrm2_strided_batched_name<Ti>, n, x, incx, stridex, batch_count);
@@ -92,7 +94,7 @@ namespace
                       "--batch_count",
                       batch_count);
 
-        if(layer_mode & rocblas_layer_mode_log_profile)
+        if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             log_profile(handle,
                         rocblas_nrm2_strided_batched_name<Ti>,
                         "N",
@@ -111,7 +113,7 @@ namespace
         if(arg_status != rocblas_status_continue)
             return arg_status;
 
-        auto w_mem = handle->device_malloc(dev_bytes);
+        auto w_mem = handle->reduction_malloc(dev_bytes);
         if(!w_mem)
         {
             return rocblas_status_memory_error;
@@ -145,6 +145,31 @@ __inline__ __device__ T rocblas_dot_block_reduce(T val)
     return val;
 }
 
+// Single-pass reductions: every block stores its partial result and takes a ticket from the
+// counter of its batch (see _rocblas_handle::get_reduction_tickets). Returns true in the last
+// block of the batch to finish, which then sees the partial results of all blocks and finishes
+// the reduction in the same order as a second kernel would. The counter is reset for the next
+// launch.
+__inline__ __device__ bool rocblas_reduction_last_block(unsigned int* tickets, int nblocks)
+{
+    __shared__ bool last;
+
+    if(threadIdx.x == 0)
+    {
+        __threadfence(); // partial result of this block is visible before its ticket
+        unsigned int ticket = atomicAdd(tickets + blockIdx.y, 1u);
+        last                = ticket == unsigned(nblocks - 1);
+        if(last)
+            tickets[blockIdx.y] = 0;
+    }
+    __syncthreads();
+
+    if(last)
+        __threadfence();
+
+    return last;
+}
+
 template <typename API_INT>
 inline size_t rocblas_reduction_kernel_block_count(API_INT n, int NB)
 {
@@ -64,6 +64,8 @@ namespace
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+
+        rocblas_api_scope api_scope(handle, rocblas_rot_name<T, V>);
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle, rocblas_rot_name<T, V>, n, x, incx, y, incy, c, s);
         if(layer_mode & rocblas_layer_mode_log_bench)
@@ -80,7 +82,7 @@ namespace
                       incx,
                       "--incy",
                       incy);
-        if(layer_mode & rocblas_layer_mode_log_profile)
+        if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             log_profile(handle, rocblas_rot_name<T, V>, "N", n, "incx", incx, "incy", incy);
 
         if(n <= 0)
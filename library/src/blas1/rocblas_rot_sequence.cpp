@@ -0,0 +1,238 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "int64_helpers.hpp"
+#include "logging.hpp"
+#include "rocblas_block_sizes.h"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_rot_sequence_name[] = "unknown";
+    template <>
+    constexpr char rocblas_rot_sequence_name<float>[] = "rocblas_srot_sequence";
+    template <>
+    constexpr char rocblas_rot_sequence_name<double>[] = "rocblas_drot_sequence";
+
+    template <typename>
+    constexpr char rocblas_rot_sequence_strided_batched_name[] = "unknown";
+    template <>
+    constexpr char rocblas_rot_sequence_strided_batched_name<float>[]
+        = "rocblas_srot_sequence_strided_batched";
+    template <>
+    constexpr char rocblas_rot_sequence_strided_batched_name<double>[]
+        = "rocblas_drot_sequence_strided_batched";
+
+    // Each thread owns one row of A and carries the rotated column k in a register from
+    // rotation to rotation, so every element of A is loaded and stored once. The rotations
+    // are staged in LDS NB at a time, shared by the rows of the block.
+    template <int NB, typename T>
+    ROCBLAS_KERNEL(NB)
+    rocblas_rot_sequence_kernel(rocblas_int    m,
+                                rocblas_int    n,
+                                const T*       c,
+                                rocblas_stride stride_c,
+                                const T*       s,
+                                rocblas_stride stride_s,
+                                T*             A,
+                                int64_t        lda,
+                                rocblas_stride stride_A)
+    {
+        __shared__ T sc[NB];
+        __shared__ T ss[NB];
+
+        c += blockIdx.y * stride_c;
+        s += blockIdx.y * stride_s;
+
+        int64_t row    = blockIdx.x * int64_t(NB) + threadIdx.x;
+        bool    active = row < m;
+        T*      a      = A + blockIdx.y * stride_A + row;
+
+        T x = active ? a[0] : T(0);
+
+        for(rocblas_int k0 = 0; k0 < n - 1; k0 += NB)
+        {
+            rocblas_int kb = std::min(NB, n - 1 - k0);
+
+            __syncthreads();
+            if(threadIdx.x < kb)
+            {
+                sc[threadIdx.x] = c[k0 + threadIdx.x];
+                ss[threadIdx.x] = s[k0 + threadIdx.x];
+            }
+            __syncthreads();
+
+            if(active)
+            {
+                for(rocblas_int j = 0; j < kb; j++)
+                {
+                    int64_t k = k0 + j;
+                    T       y = a[(k + 1) * lda];
+
+                    a[k * lda] = sc[j] * x + ss[j] * y;
+                    x          = sc[j] * y - ss[j] * x;
+                }
+            }
+        }
+
+        if(active)
+            a[(n - 1) * lda] = x;
+    }
+
+    template <typename T>
+    rocblas_status rocblas_rot_sequence_impl(rocblas_handle handle,
+                                             rocblas_int    m,
+                                             rocblas_int    n,
+                                             const T*       c,
+                                             rocblas_stride stride_c,
+                                             const T*       s,
+                                             rocblas_stride stride_s,
+                                             T*             A,
+                                             rocblas_int    lda,
+                                             rocblas_stride stride_A,
+                                             rocblas_int    batch_count,
+                                             bool           strided_batched)
+    {
+        static constexpr int NB = ROCBLAS_ROT_NB;
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        {
+            if(strided_batched)
+                log_trace(handle,
+                          rocblas_rot_sequence_strided_batched_name<T>,
+                          m,
+                          n,
+                          c,
+                          stride_c,
+                          s,
+                          stride_s,
+                          A,
+                          lda,
+                          stride_A,
+                          batch_count);
+            else
+                log_trace(handle, rocblas_rot_sequence_name<T>, m, n, c, s, A, lda);
+        }
+
+        if(m < 0 || n < 0 || lda < std::max(m, 1) || batch_count < 0)
+            return rocblas_status_invalid_size;
+        if(!m || n <= 1 || !batch_count)
+            return rocblas_status_success;
+        if(!c || !s || !A)
+            return rocblas_status_invalid_pointer;
+
+        rocblas_int blocks = (m - 1) / NB + 1;
+
+        for(int64_t b_base = 0; b_base < batch_count; b_base += c_i64_grid_YZ_chunk)
+        {
+            rocblas_int batches = rocblas_int(std::min(batch_count - b_base, c_i64_grid_YZ_chunk));
+
+            ROCBLAS_LAUNCH_KERNEL((rocblas_rot_sequence_kernel<NB>),
+                                  dim3(blocks, batches),
+                                  dim3(NB),
+                                  0,
+                                  handle->get_stream(),
+                                  m,
+                                  n,
+                                  c + b_base * stride_c,
+                                  stride_c,
+                                  s + b_base * stride_s,
+                                  stride_s,
+                                  A + b_base * stride_A,
+                                  lda,
+                                  stride_A);
+        }
+        return rocblas_status_success;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(name_, T_)                                                                      \
+    rocblas_status name_(rocblas_handle handle,                                              \
+                         rocblas_int    m,                                                   \
+                         rocblas_int    n,                                                   \
+                         const T_*      c,                                                   \
+                         const T_*      s,                                                   \
+                         T_*            A,                                                   \
+                         rocblas_int    lda)                                                 \
+    try                                                                                      \
+    {                                                                                        \
+        return rocblas_rot_sequence_impl<T_>(handle, m, n, c, 0, s, 0, A, lda, 0, 1, false); \
+    }                                                                                        \
+    catch(...)                                                                               \
+    {                                                                                        \
+        return exception_to_rocblas_status();                                                \
+    }
+
+#ifdef IMPL_STRIDED_BATCHED
+#error IMPL_STRIDED_BATCHED ALREADY DEFINED
+#endif
+
+#define IMPL_STRIDED_BATCHED(name_, T_)                                                   \
+    rocblas_status name_(rocblas_handle handle,                                           \
+                         rocblas_int    m,                                                \
+                         rocblas_int    n,                                                \
+                         const T_*      c,                                                \
+                         rocblas_stride stride_c,                                         \
+                         const T_*      s,                                                \
+                         rocblas_stride stride_s,                                         \
+                         T_*            A,                                                \
+                         rocblas_int    lda,                                              \
+                         rocblas_stride stride_A,                                         \
+                         rocblas_int    batch_count)                                      \
+    try                                                                                   \
+    {                                                                                     \
+        return rocblas_rot_sequence_impl<T_>(                                             \
+            handle, m, n, c, stride_c, s, stride_s, A, lda, stride_A, batch_count, true); \
+    }                                                                                     \
+    catch(...)                                                                            \
+    {                                                                                     \
+        return exception_to_rocblas_status();                                             \
+    }
+
+extern "C" {
+
+IMPL(rocblas_srot_sequence, float);
+IMPL(rocblas_drot_sequence, double);
+IMPL_STRIDED_BATCHED(rocblas_srot_sequence_strided_batched, float);
+IMPL_STRIDED_BATCHED(rocblas_drot_sequence_strided_batched, double);
+
+} // extern "C"
+
+#undef IMPL
+#undef IMPL_STRIDED_BATCHED
@@ -69,6 +69,8 @@ namespace
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+
+        rocblas_api_scope api_scope(handle, rocblas_rot_name<T, V>);
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle,
                       rocblas_rot_name<T, V>,
@@ -102,7 +104,7 @@ namespace
                       stride_y,
                       "--batch_count",
                       batch_count);
-        if(layer_mode & rocblas_layer_mode_log_profile)
+        if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             log_profile(handle,
                         rocblas_rot_name<T, V>,
                         "N",
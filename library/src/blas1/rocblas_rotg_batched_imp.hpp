@@ -58,6 +58,8 @@ namespace
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+
+        rocblas_api_scope api_scope(handle, rocblas_rotg_name<T>);
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle, rocblas_rotg_name<T>, a, b, c, s, batch_count);
         if(layer_mode & rocblas_layer_mode_log_bench)
@@ -68,7 +70,7 @@ namespace
                       rocblas_precision_string<U>,
                       "--batch_count",
                       batch_count);
-        if(layer_mode & rocblas_layer_mode_log_profile)
+        if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             log_profile(handle, rocblas_rotg_name<T>, "batch_count", batch_count);
 
         if(batch_count <= 0)
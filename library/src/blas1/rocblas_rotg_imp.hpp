@@ -51,6 +51,8 @@ namespace
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+
+        rocblas_api_scope api_scope(handle, rocblas_rotg_name<T>);
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle, rocblas_rotg_name<T>, a, b, c, s);
         if(layer_mode & rocblas_layer_mode_log_bench)
@@ -59,7 +61,7 @@ namespace
                       rocblas_precision_string<T>,
                       "--b_type",
                       rocblas_precision_string<U>);
-        if(layer_mode & rocblas_layer_mode_log_profile)
+        if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             log_profile(handle, rocblas_rotg_name<T>);
 
         if(!a || !b || !c || !s)
@@ -55,6 +55,8 @@ namespace
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+
+        rocblas_api_scope api_scope(handle, rocblas_rotm_name<T>);
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle, rocblas_rotm_name<T>, n, x, incx, y, incy, param, batch_count);
         if(layer_mode & rocblas_layer_mode_log_bench)
@@ -69,7 +71,7 @@ namespace
                       incy,
                       "--batch_count",
                       batch_count);
-        if(layer_mode & rocblas_layer_mode_log_profile)
+        if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             log_profile(handle,
                         rocblas_rotm_name<T>,
                         "N",
@@ -53,6 +53,8 @@ namespace
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+
+        rocblas_api_scope api_scope(handle, rocblas_rotmg_name<T>);
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle, rocblas_rotmg_name<T>, d1, d2, x1, y1, param, batch_count);
         if(layer_mode & rocblas_layer_mode_log_bench)
@@ -61,7 +63,7 @@ namespace
                       rocblas_precision_string<T>,
                       "--batch_count",
                       batch_count);
-        if(layer_mode & rocblas_layer_mode_log_profile)
+        if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             log_profile(handle, rocblas_rotmg_name<T>, "batch_count", batch_count);
 
         if(batch_count <= 0)
@@ -48,11 +48,13 @@ namespace
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+
+        rocblas_api_scope api_scope(handle, rocblas_rotmg_name<T>);
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle, rocblas_rotmg_name<T>, d1, d2, x1, y1, param);
         if(layer_mode & rocblas_layer_mode_log_bench)
             log_bench(handle, ROCBLAS_API_BENCH " -f rotmg -r", rocblas_precision_string<T>);
-        if(layer_mode & rocblas_layer_mode_log_profile)
+        if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             log_profile(handle, rocblas_rotmg_name<T>);
 
         if(!d1 || !d2 || !x1 || !y1 || !param)
@@ -64,6 +64,8 @@ namespace
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
 
+        rocblas_api_scope api_scope(handle, rocblas_scal_name<T, U>);
+
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle,
                       rocblas_scal_name<T, U>,
@@ -93,7 +95,7 @@ namespace
                       batch_count);
         }
 
-        if(layer_mode & rocblas_layer_mode_log_profile)
+        if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             log_profile(
                 handle, rocblas_scal_name<T, U>, "N", n, "incx", incx, "batch_count", batch_count);
 
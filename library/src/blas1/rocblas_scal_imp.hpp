@@ -60,6 +60,8 @@ namespace
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
 
+        rocblas_api_scope api_scope(handle, rocblas_scal_name<T, U>);
+
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(
                 handle, rocblas_scal_name<T, U>, n, LOG_TRACE_SCALAR_VALUE(handle, alpha), x, incx);
@@ -82,7 +84,7 @@ namespace
                       incx);
         }
 
-        if(layer_mode & rocblas_layer_mode_log_profile)
+        if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             log_profile(handle, rocblas_scal_name<T, U>, "N", n, "incx", incx);
 
         if(n <= 0 || incx <= 0)
@@ -22,6 +22,7 @@
 
 #include "handle.hpp"
 #include "rocblas.h"
+#include "rocblas_block_size_select.hpp"
 #include "rocblas_block_sizes.h"
 
 #include "blas1/rocblas_scal.hpp"
@@ -39,8 +40,11 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                    rocblas_stride stride_x,
                                    rocblas_int    batch_count)
 {
-    return rocblas_internal_scal_launcher<rocblas_int, ROCBLAS_SCAL_NB, T, T>(
-        handle, n, alpha, stride_alpha, x, offset_x, incx, stride_x, batch_count);
+    int nb = rocblas_select_block_size(handle, rocblas_block_size_routine::scal, n);
+    return rocblas_dispatch_block_size<ROCBLAS_SCAL_NB>(nb, [&](auto NB) {
+        return rocblas_internal_scal_launcher<rocblas_int, decltype(NB)::value, T, T>(
+            handle, n, alpha, stride_alpha, x, offset_x, incx, stride_x, batch_count);
+    });
 }
 
 template <typename T, typename Ta>
@@ -55,8 +59,11 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                            rocblas_stride stride_x,
                                            rocblas_int    batch_count)
 {
-    return rocblas_internal_scal_launcher<rocblas_int, ROCBLAS_SCAL_NB, T, T>(
-        handle, n, alpha, stride_alpha, x, offset_x, incx, stride_x, batch_count);
+    int nb = rocblas_select_block_size(handle, rocblas_block_size_routine::scal, n);
+    return rocblas_dispatch_block_size<ROCBLAS_SCAL_NB>(nb, [&](auto NB) {
+        return rocblas_internal_scal_launcher<rocblas_int, decltype(NB)::value, T, T>(
+            handle, n, alpha, stride_alpha, x, offset_x, incx, stride_x, batch_count);
+    });
 }
 
 // Instantiations below will need to be manually updated to match any change in
@@ -48,41 +48,46 @@ rocblas_scal_kernel(rocblas_int    n,
 }
 
 //!
-//! @brief Optimized kernel for the SCAL floating points.
+//! @brief Optimized kernel for the SCAL with unit increment, each thread scales 16 bytes with
+//! a wide load and store when the vector of its batch is aligned.
 //! @remark Increment are required to be equal to one, that's why they are unspecified.
 //!
 template <int NB, typename T, typename Tex, typename Ta, typename Tx>
 ROCBLAS_KERNEL(NB)
-rocblas_sscal_2_kernel(rocblas_int    n,
-                       Ta             alpha_device_host,
-                       rocblas_stride stride_alpha,
-                       Tx __restrict__ xa,
-                       rocblas_stride offset_x,
-                       rocblas_stride stride_x)
+rocblas_scal_wide_kernel(rocblas_int    n,
+                         Ta             alpha_device_host,
+                         rocblas_stride stride_alpha,
+                         Tx __restrict__ xa,
+                         rocblas_stride offset_x,
+                         rocblas_stride stride_x)
 {
+    constexpr int VW = rocblas_wide_elements<T>;
+
     auto* x     = load_ptr_batch(xa, blockIdx.y, offset_x, stride_x);
     auto  alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
 
     if(alpha == 1)
         return;
 
-    uint32_t tid = (blockIdx.x * blockDim.x + threadIdx.x) * 2;
+    int64_t tid = (blockIdx.x * blockDim.x + threadIdx.x) * int64_t(VW);
 
-    if(tid + 1 < n)
+    if(tid + VW <= n && rocblas_is_wide_aligned(x))
     {
-        // Each thread access contiguous elements for example Thread '0' access indices '0' and '1' of the vector `x`
-        for(int32_t j = 0; j < 2; ++j)
+        rocblas_wide_t<T> xv = *(rocblas_wide_t<T>*)(x + tid);
+        for(int j = 0; j < VW; ++j)
         {
-            Tex res    = (Tex)x[tid + j] * alpha;
-            x[tid + j] = (T)res;
+            Tex res   = (Tex)xv.val[j] * alpha;
+            xv.val[j] = (T)res;
         }
+        *(rocblas_wide_t<T>*)(x + tid) = xv;
     }
-
-    // If `n` is odd then the computation of last element in the vector `x` is covered below.
-    if(n % 2 != 0 && tid == n - 1)
+    else
     {
-        Tex res = (Tex)x[tid] * alpha;
-        x[tid]  = (T)res;
+        for(int j = 0; j < VW && tid + j < n; ++j)
+        {
+            Tex res    = (Tex)x[tid + j] * alpha;
+            x[tid + j] = (T)res;
+        }
     }
 }
 
@@ -146,6 +151,38 @@ rocblas_hscal_mlt_4_kernel(rocblas_int    n,
     }
 }
 
+//!
+//! @brief Small n kernel for large batch counts, each block scales NB_Y vectors with NB_X
+//! threads per vector.
+//!
+template <typename API_INT, int NB_X, int NB_Y, typename T, typename Tex, typename Ta, typename Tx>
+ROCBLAS_KERNEL(NB_X* NB_Y)
+rocblas_scal_small_n_batched_kernel(rocblas_int    n,
+                                    Ta             alpha_device_host,
+                                    rocblas_stride stride_alpha,
+                                    Tx             xa,
+                                    rocblas_stride offset_x,
+                                    API_INT        incx,
+                                    rocblas_stride stride_x,
+                                    rocblas_int    batch_count)
+{
+    uint32_t batch = blockIdx.x * NB_Y + threadIdx.y;
+    if(batch >= batch_count)
+        return;
+
+    auto* x     = load_ptr_batch(xa, batch, offset_x, stride_x);
+    auto  alpha = load_scalar(alpha_device_host, batch, stride_alpha);
+
+    if(alpha == 1)
+        return;
+
+    for(rocblas_int tid = threadIdx.x; tid < n; tid += NB_X)
+    {
+        Tex res                = (Tex)x[tid * int64_t(incx)] * alpha;
+        x[tid * int64_t(incx)] = (T)res;
+    }
+}
+
 template <typename API_INT, int NB, typename T, typename Tex, typename Ta, typename Tx>
 ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     rocblas_internal_scal_launcher(rocblas_handle handle,
@@ -164,44 +201,51 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         return rocblas_status_success;
     }
 
-    static constexpr bool using_rocblas_float
-        = std::is_same_v<Tx, rocblas_float*> || std::is_same_v<Tx, rocblas_float* const*>;
+    static constexpr int wide_elements = rocblas_wide_elements<T>;
 
     // Using rocblas_half ?
     static constexpr bool using_rocblas_half
         = std::is_same_v<Ta, rocblas_half> && std::is_same_v<Tex, rocblas_half>;
 
-    if(using_rocblas_float && incx == 1)
+    if(n < NB && batch_count >= 256)
     {
-        // Kernel function for improving the performance of SSCAL when incx==1
-        int32_t blocks = 1 + ((n - 1) / (NB * 2));
-        dim3    grid(blocks, batch_count);
-        dim3    threads(NB);
+        // Optimized kernel for small n and bigger batch_count
+        static constexpr int NB_X = 64;
+        static constexpr int NB_Y = NB > NB_X ? NB / NB_X : 1;
+
+        dim3 grid((batch_count - 1) / NB_Y + 1);
+        dim3 threads(NB_X, NB_Y);
 
         if(rocblas_pointer_mode_device == handle->pointer_mode)
-            ROCBLAS_LAUNCH_KERNEL((rocblas_sscal_2_kernel<NB, T, Tex>),
-                                  grid,
-                                  threads,
-                                  0,
-                                  handle->get_stream(),
-                                  n,
-                                  alpha,
-                                  stride_alpha,
-                                  x,
-                                  offset_x,
-                                  stride_x);
+            ROCBLAS_LAUNCH_KERNEL(
+                (rocblas_scal_small_n_batched_kernel<API_INT, NB_X, NB_Y, T, Tex>),
+                grid,
+                threads,
+                0,
+                handle->get_stream(),
+                n,
+                alpha,
+                stride_alpha,
+                x,
+                offset_x,
+                incx,
+                stride_x,
+                batch_count);
         else // single alpha is on host
-            ROCBLAS_LAUNCH_KERNEL((rocblas_sscal_2_kernel<NB, T, Tex>),
-                                  grid,
-                                  threads,
-                                  0,
-                                  handle->get_stream(),
-                                  n,
-                                  *alpha,
-                                  stride_alpha,
-                                  x,
-                                  offset_x,
-                                  stride_x);
+            ROCBLAS_LAUNCH_KERNEL(
+                (rocblas_scal_small_n_batched_kernel<API_INT, NB_X, NB_Y, T, Tex>),
+                grid,
+                threads,
+                0,
+                handle->get_stream(),
+                n,
+                *alpha,
+                stride_alpha,
+                x,
+                offset_x,
+                incx,
+                stride_x,
+                batch_count);
     }
     else if(using_rocblas_half && incx == 1)
     {
@@ -244,6 +288,39 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                       stride_x);
         }
     }
+    else if(wide_elements > 1 && incx == 1)
+    {
+        // Kernel function for improving the performance of SCAL when incx==1, alignment of the
+        // vector is checked per batch in the kernel
+        int32_t blocks = 1 + ((n - 1) / (NB * wide_elements));
+        dim3    grid(blocks, batch_count);
+        dim3    threads(NB);
+
+        if(rocblas_pointer_mode_device == handle->pointer_mode)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_scal_wide_kernel<NB, T, Tex>),
+                                  grid,
+                                  threads,
+                                  0,
+                                  handle->get_stream(),
+                                  n,
+                                  alpha,
+                                  stride_alpha,
+                                  x,
+                                  offset_x,
+                                  stride_x);
+        else // single alpha is on host
+            ROCBLAS_LAUNCH_KERNEL((rocblas_scal_wide_kernel<NB, T, Tex>),
+                                  grid,
+                                  threads,
+                                  0,
+                                  handle->get_stream(),
+                                  n,
+                                  *alpha,
+                                  stride_alpha,
+                                  x,
+                                  offset_x,
+                                  stride_x);
+    }
     else
     {
         int  blocks = (n - 1) / NB + 1;
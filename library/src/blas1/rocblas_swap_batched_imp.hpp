@@ -59,6 +59,8 @@ namespace
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+
+        rocblas_api_scope api_scope(handle, rocblas_swap_batched_name<T>);
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle, rocblas_swap_batched_name<T>, n, x, incx, y, incy, batch_count);
         if(layer_mode & rocblas_layer_mode_log_bench)
@@ -73,7 +75,7 @@ namespace
                       incy,
                       "--batch_count",
                       batch_count);
-        if(layer_mode & rocblas_layer_mode_log_profile)
+        if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             log_profile(handle,
                         rocblas_swap_batched_name<T>,
                         "N",
@@ -55,6 +55,8 @@ namespace
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+
+        rocblas_api_scope api_scope(handle, rocblas_swap_name<T>);
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle, rocblas_swap_name<T>, n, x, incx, y, incy);
         if(layer_mode & rocblas_layer_mode_log_bench)
@@ -67,7 +69,7 @@ namespace
                       incx,
                       "--incy",
                       incy);
-        if(layer_mode & rocblas_layer_mode_log_profile)
+        if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             log_profile(handle, rocblas_swap_name<T>, "N", n, "incx", incx, "incy", incy);
 
         if(n <= 0)
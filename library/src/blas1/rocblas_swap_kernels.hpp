@@ -57,31 +57,34 @@ rocblas_swap_kernel(rocblas_int    n,
     }
 }
 
-//! @brief Optimized kernel for the floating points.
+//! @brief Optimized kernel for unit increments, each thread swaps 16 bytes with wide loads and
+//! stores when the vectors of its batch are aligned.
 //!
 template <rocblas_int NB, typename UPtr>
 ROCBLAS_KERNEL(NB)
-rocblas_sswap_2_kernel(rocblas_int n,
-                       UPtr __restrict__ xa,
-                       rocblas_stride offsetx,
-                       rocblas_stride stridex,
-                       UPtr __restrict__ ya,
-                       rocblas_stride offsety,
-                       rocblas_stride stridey)
+rocblas_swap_wide_kernel(rocblas_int n,
+                         UPtr __restrict__ xa,
+                         rocblas_stride offsetx,
+                         rocblas_stride stridex,
+                         UPtr __restrict__ ya,
+                         rocblas_stride offsety,
+                         rocblas_stride stridey)
 {
-    int64_t tid = (blockIdx.x * blockDim.x + threadIdx.x) * 2;
+    using Te         = rocblas_batch_elem_t<UPtr>;
+    constexpr int VW = rocblas_wide_elements<Te>;
+
+    int64_t tid = (blockIdx.x * blockDim.x + threadIdx.x) * int64_t(VW);
     auto*   x   = load_ptr_batch(xa, blockIdx.y, offsetx, stridex);
     auto*   y   = load_ptr_batch(ya, blockIdx.y, offsety, stridey);
-    if(tid < n - 1)
+
+    if(tid + VW <= n && rocblas_is_wide_aligned(x) && rocblas_is_wide_aligned(y))
     {
-        for(int j = 0; j < 2; ++j)
-        {
-            rocblas_swap_vals(x + tid + j, y + tid + j);
-        }
+        rocblas_swap_vals((rocblas_wide_t<Te>*)(x + tid), (rocblas_wide_t<Te>*)(y + tid));
     }
-    if(n % 2 != 0 && tid == n - 1)
+    else
     {
-        rocblas_swap_vals(x + tid, y + tid);
+        for(int j = 0; j < VW && tid + j < n; ++j)
+            rocblas_swap_vals(x + tid + j, y + tid + j);
     }
 }
 
@@ -102,10 +105,9 @@ rocblas_status rocblas_internal_swap_launcher(rocblas_handle handle,
     if(n <= 0 || batch_count <= 0)
         return rocblas_status_success;
 
-    static constexpr bool using_rocblas_float
-        = std::is_same_v<T, rocblas_float*> || std::is_same_v<T, rocblas_float* const*>;
+    static constexpr int wide_elements = rocblas_wide_elements<rocblas_batch_elem_t<T>>;
 
-    if(!using_rocblas_float || incx != 1 || incy != 1)
+    if(wide_elements == 1 || incx != 1 || incy != 1)
     {
         // in case of negative inc shift pointer to end of data for negative indexing tid*inc
         int64_t shiftx = incx < 0 ? offsetx - int64_t(incx) * (n - 1) : offsetx;
@@ -131,25 +133,23 @@ rocblas_status rocblas_internal_swap_launcher(rocblas_handle handle,
     }
     else
     {
-        // Kernel function for improving the performance of SSWAP when incx==1 and incy==1
-        int64_t shiftx = offsetx - 0;
-        int64_t shifty = offsety - 0;
-
-        int  blocks = 1 + ((n - 1) / (NB * 2));
+        // Kernel function for improving the performance of swap when incx==1 and incy==1,
+        // alignment of the vectors is checked per batch in the kernel
+        int  blocks = 1 + ((n - 1) / (NB * wide_elements));
         dim3 grid(blocks, batch_count);
         dim3 threads(NB);
 
-        ROCBLAS_LAUNCH_KERNEL((rocblas_sswap_2_kernel<NB>),
+        ROCBLAS_LAUNCH_KERNEL((rocblas_swap_wide_kernel<NB>),
                               grid,
                               threads,
                               0,
                               handle->get_stream(),
                               n,
                               x,
-                              shiftx,
+                              offsetx,
                               stridex,
                               y,
-                              shifty,
+                              offsety,
                               stridey);
     }
     return rocblas_status_success;
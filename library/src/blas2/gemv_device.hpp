@@ -56,6 +56,106 @@
 // uses recursive folding reduction
 #include "../blas1/reduction.hpp"
 
+// Epilogue of gemv set with rocblas_set_gemv_epilogue, applied to the results of y of type T as
+// they are stored: y = activation(v + bias + gamma * z)
+template <typename T>
+struct rocblas_gemv_epilogue_args
+{
+    const T*                         bias        = nullptr;
+    rocblas_stride                   stride_bias = 0;
+    const T*                         z           = nullptr;
+    int64_t                          incz        = 0;
+    rocblas_stride                   stride_z    = 0;
+    T                                gamma{0};
+    rocblas_gemm_epilogue_activation activation = rocblas_gemm_epilogue_activation_none;
+
+    rocblas_gemv_epilogue_args() = default;
+
+    // len is the length of y, used to shift z to its end for a negative incz
+    rocblas_gemv_epilogue_args(const rocblas_gemv_epilogue& epilogue, int64_t len)
+        : bias((const T*)epilogue.bias)
+        , stride_bias(epilogue.stride_bias)
+        , z((const T*)epilogue.z)
+        , incz(epilogue.incz)
+        , stride_z(epilogue.stride_z)
+        , activation(epilogue.activation)
+    {
+        if constexpr(std::is_same_v<T, float>)
+            gamma = epilogue.gamma.s;
+        else if constexpr(std::is_same_v<T, double>)
+            gamma = epilogue.gamma.d;
+        else if constexpr(std::is_same_v<T, rocblas_float_complex>)
+            gamma = epilogue.gamma.c;
+        else if constexpr(std::is_same_v<T, rocblas_double_complex>)
+            gamma = epilogue.gamma.z;
+
+        if(z && incz < 0)
+            z -= incz * (len - 1);
+    }
+
+    __host__ __device__ bool active() const
+    {
+        return bias || z || activation != rocblas_gemm_epilogue_activation_none;
+    }
+
+    // Epilogue of one batch
+    __device__ rocblas_gemv_epilogue_args batch(uint32_t b) const
+    {
+        rocblas_gemv_epilogue_args args = *this;
+        if(bias)
+            args.bias += b * stride_bias;
+        if(z)
+            args.z += b * stride_z;
+        return args;
+    }
+
+    // Result of element i of y
+    template <typename U>
+    __device__ U apply(U v, int64_t i) const
+    {
+        if(bias)
+            v += U(bias[i]);
+        if(z)
+            v += U(gamma * z[i * incz]);
+
+        if constexpr(!rocblas_is_complex<U>)
+        {
+            if(activation == rocblas_gemm_epilogue_activation_relu)
+            {
+                v = v > U(0) ? v : U(0);
+            }
+            else if(activation == rocblas_gemm_epilogue_activation_gelu)
+            {
+                using Tf = std::conditional_t<std::is_same_v<U, double>, double, float>;
+                Tf x     = Tf(v);
+                v        = U(Tf(0.5) * x
+                      * (Tf(1) + tanh(Tf(0.7978845608028654) * (x + Tf(0.044715) * x * x * x))));
+            }
+        }
+        return v;
+    }
+};
+
+// Used by the gemv kernels when no epilogue is applied
+struct rocblas_gemv_no_epilogue
+{
+    __host__ __device__ bool active() const
+    {
+        return false;
+    }
+
+    __device__ rocblas_gemv_no_epilogue batch(uint32_t) const
+    {
+        return *this;
+    }
+
+    template <typename U>
+    __device__ U apply(U v, int64_t) const
+    {
+        return v;
+    }
+};
+
 template <int NB, typename Tex, typename To>
 ROCBLAS_KERNEL_ILF void rocblas_gemv_scal_kernel_calc(
     rocblas_int n, Tex beta, rocblas_stride stride_beta, To* y, rocblas_int incy)
@@ -298,6 +398,7 @@ template <int DIM_X,
           typename Ti,
           typename Tex,
           typename To,
+          typename E,
           std::enable_if_t<!std::is_same_v<Ti, rocblas_double_complex>, int> = 0>
 ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int m,
                                                   rocblas_int n,
@@ -308,7 +409,9 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int m,
                                                   T_Index     incx,
                                                   Tex         beta,
                                                   To*         y,
-                                                  T_Index     incy)
+                                                  T_Index     incy,
+                                                  const E&    epilogue,
+                                                  bool        stream_a)
 {
     rocblas_int thread_id = threadIdx.x + threadIdx.y * DIM_X;
 
@@ -318,11 +421,15 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int m,
         {
             int64_t ind = blockIdx.x * DIM_X * 4 + thread_id;
             if(ind < m)
-                y[ind * T_Index(incy)] = beta ? (To)(beta * y[ind * T_Index(incy)]) : (To)0;
+                y[ind * T_Index(incy)] = (To)epilogue.apply(
+                    beta ? (Tex)(beta * y[ind * T_Index(incy)]) : (Tex)0, ind);
         }
         return;
     }
 
+    // the elements of A are used once, they are loaded bypassing the caches if A is streamed
+    auto load_A = [=](int64_t i) { return rocblas_stream_load(A + i, stream_a); };
+
     // threads are all configurated locally
     rocblas_int tx = threadIdx.x;
     rocblas_int ty = threadIdx.y;
@@ -350,31 +457,31 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int m,
 
         if(ind < m)
         {
-            res_A[0] += A[ind + (col + 0) * T_Index(lda)] * res_x[0];
-            res_A[0] += A[ind + (col + 1) * T_Index(lda)] * res_x[1];
-            res_A[0] += A[ind + (col + 2) * T_Index(lda)] * res_x[2];
-            res_A[0] += A[ind + (col + 3) * T_Index(lda)] * res_x[3];
+            res_A[0] += load_A(ind + (col + 0) * T_Index(lda)) * res_x[0];
+            res_A[0] += load_A(ind + (col + 1) * T_Index(lda)) * res_x[1];
+            res_A[0] += load_A(ind + (col + 2) * T_Index(lda)) * res_x[2];
+            res_A[0] += load_A(ind + (col + 3) * T_Index(lda)) * res_x[3];
 
             if(ind + DIM_X < m)
             {
-                res_A[1] += A[ind + DIM_X + (col + 0) * T_Index(lda)] * res_x[0];
-                res_A[1] += A[ind + DIM_X + (col + 1) * T_Index(lda)] * res_x[1];
-                res_A[1] += A[ind + DIM_X + (col + 2) * T_Index(lda)] * res_x[2];
-                res_A[1] += A[ind + DIM_X + (col + 3) * T_Index(lda)] * res_x[3];
+                res_A[1] += load_A(ind + DIM_X + (col + 0) * T_Index(lda)) * res_x[0];
+                res_A[1] += load_A(ind + DIM_X + (col + 1) * T_Index(lda)) * res_x[1];
+                res_A[1] += load_A(ind + DIM_X + (col + 2) * T_Index(lda)) * res_x[2];
+                res_A[1] += load_A(ind + DIM_X + (col + 3) * T_Index(lda)) * res_x[3];
 
                 if(ind + 2 * DIM_X < m)
                 {
-                    res_A[2] += A[ind + 2 * DIM_X + (col + 0) * T_Index(lda)] * res_x[0];
-                    res_A[2] += A[ind + 2 * DIM_X + (col + 1) * T_Index(lda)] * res_x[1];
-                    res_A[2] += A[ind + 2 * DIM_X + (col + 2) * T_Index(lda)] * res_x[2];
-                    res_A[2] += A[ind + 2 * DIM_X + (col + 3) * T_Index(lda)] * res_x[3];
+                    res_A[2] += load_A(ind + 2 * DIM_X + (col + 0) * T_Index(lda)) * res_x[0];
+                    res_A[2] += load_A(ind + 2 * DIM_X + (col + 1) * T_Index(lda)) * res_x[1];
+                    res_A[2] += load_A(ind + 2 * DIM_X + (col + 2) * T_Index(lda)) * res_x[2];
+                    res_A[2] += load_A(ind + 2 * DIM_X + (col + 3) * T_Index(lda)) * res_x[3];
 
                     if(ind + 3 * DIM_X < m)
                     {
-                        res_A[3] += A[ind + 3 * DIM_X + (col + 0) * T_Index(lda)] * res_x[0];
-                        res_A[3] += A[ind + 3 * DIM_X + (col + 1) * T_Index(lda)] * res_x[1];
-                        res_A[3] += A[ind + 3 * DIM_X + (col + 2) * T_Index(lda)] * res_x[2];
-                        res_A[3] += A[ind + 3 * DIM_X + (col + 3) * T_Index(lda)] * res_x[3];
+                        res_A[3] += load_A(ind + 3 * DIM_X + (col + 0) * T_Index(lda)) * res_x[0];
+                        res_A[3] += load_A(ind + 3 * DIM_X + (col + 1) * T_Index(lda)) * res_x[1];
+                        res_A[3] += load_A(ind + 3 * DIM_X + (col + 2) * T_Index(lda)) * res_x[2];
+                        res_A[3] += load_A(ind + 3 * DIM_X + (col + 3) * T_Index(lda)) * res_x[3];
                     }
                 }
             }
@@ -406,39 +513,47 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int m,
 
         if(ind < m)
         {
-            res_A[0] += A[ind + (col + 0) * T_Index(lda) * (col + 0 < n)] * res_x[0];
-            res_A[0] += A[ind + (col + 1) * T_Index(lda) * (col + 1 < n)] * res_x[1];
-            res_A[0] += A[ind + (col + 2) * T_Index(lda) * (col + 2 < n)] * res_x[2];
-            res_A[0] += A[ind + (col + 3) * T_Index(lda) * (col + 3 < n)] * res_x[3];
+            res_A[0] += load_A(ind + (col + 0) * T_Index(lda) * (col + 0 < n)) * res_x[0];
+            res_A[0] += load_A(ind + (col + 1) * T_Index(lda) * (col + 1 < n)) * res_x[1];
+            res_A[0] += load_A(ind + (col + 2) * T_Index(lda) * (col + 2 < n)) * res_x[2];
+            res_A[0] += load_A(ind + (col + 3) * T_Index(lda) * (col + 3 < n)) * res_x[3];
 
             if(ind + DIM_X < m)
             {
-                res_A[1] += A[ind + DIM_X + (col + 0) * T_Index(lda) * (col + 0 < n)] * res_x[0];
-                res_A[1] += A[ind + DIM_X + (col + 1) * T_Index(lda) * (col + 1 < n)] * res_x[1];
-                res_A[1] += A[ind + DIM_X + (col + 2) * T_Index(lda) * (col + 2 < n)] * res_x[2];
-                res_A[1] += A[ind + DIM_X + (col + 3) * T_Index(lda) * (col + 3 < n)] * res_x[3];
+                res_A[1]
+                    += load_A(ind + DIM_X + (col + 0) * T_Index(lda) * (col + 0 < n)) * res_x[0];
+                res_A[1]
+                    += load_A(ind + DIM_X + (col + 1) * T_Index(lda) * (col + 1 < n)) * res_x[1];
+                res_A[1]
+                    += load_A(ind + DIM_X + (col + 2) * T_Index(lda) * (col + 2 < n)) * res_x[2];
+                res_A[1]
+                    += load_A(ind + DIM_X + (col + 3) * T_Index(lda) * (col + 3 < n)) * res_x[3];
 
                 if(ind + 2 * DIM_X < m)
                 {
-                    res_A[2]
-                        += A[ind + 2 * DIM_X + (col + 0) * T_Index(lda) * (col + 0 < n)] * res_x[0];
-                    res_A[2]
-                        += A[ind + 2 * DIM_X + (col + 1) * T_Index(lda) * (col + 1 < n)] * res_x[1];
-                    res_A[2]
-                        += A[ind + 2 * DIM_X + (col + 2) * T_Index(lda) * (col + 2 < n)] * res_x[2];
-                    res_A[2]
-                        += A[ind + 2 * DIM_X + (col + 3) * T_Index(lda) * (col + 3 < n)] * res_x[3];
+                    res_A[2] += load_A(ind + 2 * DIM_X + (col + 0) * T_Index(lda) * (col + 0 < n))
+                                * res_x[0];
+                    res_A[2] += load_A(ind + 2 * DIM_X + (col + 1) * T_Index(lda) * (col + 1 < n))
+                                * res_x[1];
+                    res_A[2] += load_A(ind + 2 * DIM_X + (col + 2) * T_Index(lda) * (col + 2 < n))
+                                * res_x[2];
+                    res_A[2] += load_A(ind + 2 * DIM_X + (col + 3) * T_Index(lda) * (col + 3 < n))
+                                * res_x[3];
 
                     if(ind + 3 * DIM_X < m)
                     {
-                        res_A[3] += A[ind + 3 * DIM_X + (col + 0) * T_Index(lda) * (col + 0 < n)]
-                                    * res_x[0];
-                        res_A[3] += A[ind + 3 * DIM_X + (col + 1) * T_Index(lda) * (col + 1 < n)]
-                                    * res_x[1];
-                        res_A[3] += A[ind + 3 * DIM_X + (col + 2) * T_Index(lda) * (col + 2 < n)]
-                                    * res_x[2];
-                        res_A[3] += A[ind + 3 * DIM_X + (col + 3) * T_Index(lda) * (col + 3 < n)]
-                                    * res_x[3];
+                        res_A[3]
+                            += load_A(ind + 3 * DIM_X + (col + 0) * T_Index(lda) * (col + 0 < n))
+                               * res_x[0];
+                        res_A[3]
+                            += load_A(ind + 3 * DIM_X + (col + 1) * T_Index(lda) * (col + 1 < n))
+                               * res_x[1];
+                        res_A[3]
+                            += load_A(ind + 3 * DIM_X + (col + 2) * T_Index(lda) * (col + 2 < n))
+                               * res_x[2];
+                        res_A[3]
+                            += load_A(ind + 3 * DIM_X + (col + 3) * T_Index(lda) * (col + 3 < n))
+                               * res_x[3];
                     }
                 }
             }
@@ -460,15 +575,16 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int m,
         ind = blockIdx.x * DIM_X * 4 + thread_id;
 
         if(ind < m)
-            y[ind * T_Index(incy)]
-                = beta ? (To)(alpha * sdata[thread_id] + beta * y[ind * T_Index(incy)])
-                       : (To)(alpha * sdata[thread_id]);
+            y[ind * T_Index(incy)] = (To)epilogue.apply(
+                beta ? Tex(alpha * sdata[thread_id] + beta * y[ind * T_Index(incy)])
+                     : Tex(alpha * sdata[thread_id]),
+                ind);
     }
 }
 
 // Overload for double precision complex numbers. We run out of registers
 // if we use the above algorithm.
-template <int DIM_X, int DIM_Y, typename T_Index, typename U>
+template <int DIM_X, int DIM_Y, typename T_Index, typename U, typename E>
 ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int                   m,
                                                   rocblas_int                   n,
                                                   U                             alpha,
@@ -478,7 +594,9 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int
                                                   T_Index                       incx,
                                                   U                             beta,
                                                   rocblas_double_complex*       y,
-                                                  T_Index                       incy)
+                                                  T_Index                       incy,
+                                                  const E&                      epilogue,
+                                                  bool                          stream_a)
 {
     rocblas_int thread_id = threadIdx.x + threadIdx.y * blockDim.x;
 
@@ -488,11 +606,15 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int
         {
             int64_t ind = blockIdx.x * DIM_X + thread_id;
             if(ind < m)
-                y[ind * T_Index(incy)] = beta ? beta * y[ind * T_Index(incy)] : 0;
+                y[ind * T_Index(incy)] = epilogue.apply(
+                    beta ? beta * y[ind * T_Index(incy)] : rocblas_double_complex{0}, ind);
         }
         return;
     }
 
+    // the elements of A are used once, they are loaded bypassing the caches if A is streamed
+    auto load_A = [=](int64_t i) { return rocblas_stream_load(A + i, stream_a); };
+
     // threads are all configurated locally
     rocblas_int tx = thread_id % DIM_X;
     rocblas_int ty = thread_id / DIM_X;
@@ -514,7 +636,7 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int
 
         if(ind < m)
         {
-            res_A += A[ind + col * T_Index(lda)] * x[col * T_Index(incx)];
+            res_A += load_A(ind + col * T_Index(lda)) * x[col * T_Index(incx)];
         }
     }
 
@@ -528,7 +650,7 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int
 
         if(ind < m)
         {
-            res_A += A[ind + col * T_Index(lda) * (col < n)] * res_x;
+            res_A += load_A(ind + col * T_Index(lda) * (col < n)) * res_x;
         }
     }
 
@@ -546,8 +668,10 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvn_kernel_calc(rocblas_int
 
         if(ind < m)
         {
-            y[ind * T_Index(incy)] = beta ? alpha * sdata[thread_id] + beta * y[ind * T_Index(incy)]
-                                          : alpha * sdata[thread_id];
+            y[ind * T_Index(incy)] = epilogue.apply(
+                beta ? alpha * sdata[thread_id] + beta * y[ind * T_Index(incy)]
+                     : alpha * sdata[thread_id],
+                ind);
         }
     }
 }
@@ -797,9 +921,13 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvt_sn_kernel_calc(rocblas_int m,
     }
 }
 
-template <rocblas_int NB, rocblas_int WIN, typename Tex, typename To>
-ROCBLAS_KERNEL_ILF void rocblas_gemvt_sn_reduce_calc(
-    rocblas_int n_sums, Tex beta, To* __restrict__ y, rocblas_int incy, Tex* __restrict__ workspace)
+template <rocblas_int NB, rocblas_int WIN, typename Tex, typename To, typename E>
+ROCBLAS_KERNEL_ILF void rocblas_gemvt_sn_reduce_calc(rocblas_int n_sums,
+                                                     Tex         beta,
+                                                     To* __restrict__ y,
+                                                     rocblas_int incy,
+                                                     Tex* __restrict__ workspace,
+                                                     const E& epilogue)
 {
     Tex sum{0};
 
@@ -824,8 +952,8 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvt_sn_reduce_calc(
 
     if(threadIdx.x == 0)
     {
-        y[blockIdx.y * int64_t(incy)]
-            = beta ? (To)(y[blockIdx.y * int64_t(incy)] * beta + sum) : (To)sum;
+        y[blockIdx.y * int64_t(incy)] = (To)epilogue.apply(
+            beta ? Tex(y[blockIdx.y * int64_t(incy)] * beta + sum) : sum, blockIdx.y);
     }
 }
 
@@ -957,7 +1085,13 @@ rocblas_gemvt_double_buffered_kernel(rocblas_int    m,
         m, n, alpha, A, lda, x, incx, y, incy);
 }
 
-template <int DIM_X, int DIM_Y, typename T_Index, typename Ti, typename Tex, typename To>
+template <int DIM_X,
+          int DIM_Y,
+          typename T_Index,
+          typename Ti,
+          typename Tex,
+          typename To,
+          typename E>
 ROCBLAS_KERNEL(DIM_X* DIM_Y)
 rocblas_gemvn_kernel(rocblas_int    m,
                      rocblas_int    n,
@@ -976,7 +1110,9 @@ rocblas_gemvn_kernel(rocblas_int    m,
                      To*            ya,
                      rocblas_stride shifty,
                      T_Index        incy,
-                     rocblas_stride stridey)
+                     rocblas_stride stridey,
+                     E              epilogue,
+                     bool           stream_a)
 {
     rocblas_int num_threads = blockDim.x * blockDim.y * blockDim.z;
     if(DIM_X * DIM_Y != num_threads)
@@ -985,7 +1121,7 @@ rocblas_gemvn_kernel(rocblas_int    m,
     auto alpha = load_scalar(alpha_device_host, blockIdx.y, stride_alpha);
     auto beta  = load_scalar(beta_device_host, blockIdx.y, stride_beta);
 
-    if(!alpha && beta == 1)
+    if(!alpha && beta == 1 && !epilogue.active())
         return;
 
     const auto* A = cond_load_ptr_batch(alpha, Aa, blockIdx.y, shifta, strideA);
@@ -993,7 +1129,8 @@ rocblas_gemvn_kernel(rocblas_int    m,
 
     auto* y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
 
-    rocblas_gemvn_kernel_calc<DIM_X, DIM_Y, T_Index>(m, n, alpha, A, lda, x, incx, beta, y, incy);
+    rocblas_gemvn_kernel_calc<DIM_X, DIM_Y, T_Index>(
+        m, n, alpha, A, lda, x, incx, beta, y, incy, epilogue.batch(blockIdx.y), stream_a);
 }
 
 // lda always cast to size_t so single kernel
@@ -1093,7 +1230,25 @@ rocblas_gemvt_sn_kernel(rocblas_int    m,
     rocblas_gemvt_sn_kernel_calc<CONJ, NB_X, WIN, T_Index>(m, n, alpha, A, lda, x, incx, workspace);
 }
 
-template <int NB, int WIN, typename Tex, typename U, typename To>
+// Applies the epilogue to y in place, for results computed by kernels without an epilogue
+template <int NB, typename T>
+ROCBLAS_KERNEL(NB)
+rocblas_gemv_epilogue_kernel(rocblas_int                   n,
+                             T*                            ya,
+                             rocblas_stride                shifty,
+                             int64_t                       incy,
+                             rocblas_stride                stridey,
+                             rocblas_gemv_epilogue_args<T> epilogue)
+{
+    int64_t i = blockIdx.x * int64_t(NB) + threadIdx.x;
+    if(i < n)
+    {
+        auto* y     = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
+        y[i * incy] = epilogue.batch(blockIdx.y).apply(y[i * incy], i);
+    }
+}
+
+template <int NB, int WIN, typename Tex, typename U, typename To, typename E>
 ROCBLAS_KERNEL(NB)
 rocblas_gemvt_sn_reduce(rocblas_int    n_sums,
                         U              beta_device_host,
@@ -1102,12 +1257,14 @@ rocblas_gemvt_sn_reduce(rocblas_int    n_sums,
                         rocblas_stride shifty,
                         rocblas_int    incy,
                         rocblas_stride stridey,
-                        Tex* __restrict__ workspace)
+                        Tex* __restrict__ workspace,
+                        E              epilogue)
 {
     auto* y    = load_ptr_batch(ya, blockIdx.z, shifty, stridey);
     auto  beta = load_scalar(beta_device_host, blockIdx.z, stride_beta);
 
-    rocblas_gemvt_sn_reduce_calc<NB, WIN>(n_sums, beta, y, incy, workspace);
+    rocblas_gemvt_sn_reduce_calc<NB, WIN>(
+        n_sums, beta, y, incy, workspace, epilogue.batch(blockIdx.z));
 }
 
 template <bool CONJ, int NB_X, typename Ti, typename Tex, typename To>
@@ -1250,3 +1407,228 @@ rocblas_gemvn_sm_mn_batched_kernel(rocblas_int    m,
 
 #endif
 }
+
+// Number of small problems per thread block of rocblas_gemv_small_batched_kernel, keeping its
+// LDS within 18 KiB
+template <typename Tex>
+constexpr int rocblas_gemv_small_batched_NB()
+{
+    return sizeof(Tex) >= 16 ? 1 : sizeof(Tex) >= 8 ? 2 : 4;
+}
+
+template <bool TRANS,
+          bool CONJ,
+          int  DIM_X,
+          int  NB_BATCH,
+          int  TILE,
+          typename Ti,
+          typename Tex,
+          typename To>
+ROCBLAS_KERNEL_ILF void rocblas_gemv_small_batched_kernel_calc(bool        active,
+                                                               rocblas_int m,
+                                                               rocblas_int n,
+                                                               Tex         alpha,
+                                                               const Ti*   A,
+                                                               rocblas_int lda,
+                                                               const Ti*   x,
+                                                               rocblas_int incx,
+                                                               Tex         beta,
+                                                               To*         y,
+                                                               rocblas_int incy)
+{
+    // m, n <= DIM_X: row ty of the block computes one whole problem, lane tx one element of y
+    static_assert(DIM_X % TILE == 0);
+
+    const int tx = threadIdx.x;
+    const int ty = threadIdx.y;
+
+    // the problems of a block synchronize together, so inactive ones compute zeros
+    __shared__ Tex shared_x[NB_BATCH][DIM_X];
+
+    bool load = active && alpha;
+    shared_x[ty][tx] = load && tx < (TRANS ? m : n) ? alpha * x[tx * int64_t(incx)] : Tex(0);
+    __syncthreads();
+
+    Tex res = 0;
+    if(!TRANS)
+    {
+        // columns of A are read coalesced straight into registers
+        if(load && tx < m)
+            for(rocblas_int j = 0; j < n; j++)
+                res += (Tex)A[j * size_t(lda) + tx] * shared_x[ty][j];
+    }
+    else
+    {
+        // TILE rows of A at a time are loaded along the columns into LDS, padded against bank
+        // conflicts, and each lane reduces its column from there
+        __shared__ Tex shared_A[NB_BATCH][DIM_X][TILE + 1];
+
+        for(rocblas_int i0 = 0; i0 < m; i0 += TILE)
+        {
+            if(load)
+                for(rocblas_int e = tx; e < TILE * n; e += DIM_X)
+                {
+                    rocblas_int r = e % TILE;
+                    rocblas_int c = e / TILE;
+
+                    shared_A[ty][c][r] = i0 + r < m ? (Tex)A[c * size_t(lda) + i0 + r] : Tex(0);
+                }
+            __syncthreads();
+
+            if(load && tx < n)
+            {
+#pragma unroll
+                for(int r = 0; r < TILE; r++)
+                    res += (CONJ ? conj(shared_A[ty][tx][r]) : shared_A[ty][tx][r])
+                           * shared_x[ty][i0 + r];
+            }
+            __syncthreads();
+        }
+    }
+
+    if(active && tx < (TRANS ? n : m))
+    {
+        int64_t idx = tx * int64_t(incy);
+        y[idx]      = beta ? (To)(res + beta * y[idx]) : (To)res;
+    }
+}
+
+// Batched gemv of many problems with m, n <= DIM_X, NB_BATCH problems per thread block
+template <bool TRANS,
+          bool CONJ,
+          int  DIM_X,
+          int  NB_BATCH,
+          int  TILE,
+          typename Ti,
+          typename Tex,
+          typename To>
+ROCBLAS_KERNEL(DIM_X* NB_BATCH)
+rocblas_gemv_small_batched_kernel(rocblas_int    m,
+                                  rocblas_int    n,
+                                  Tex            alpha_device_host,
+                                  rocblas_stride stride_alpha,
+                                  const Ti*      Aa,
+                                  rocblas_stride shifta,
+                                  rocblas_int    lda,
+                                  rocblas_stride strideA,
+                                  const Ti*      xa,
+                                  rocblas_stride shiftx,
+                                  rocblas_int    incx,
+                                  rocblas_stride stridex,
+                                  Tex            beta_device_host,
+                                  rocblas_stride stride_beta,
+                                  To*            ya,
+                                  rocblas_stride shifty,
+                                  rocblas_int    incy,
+                                  rocblas_stride stridey,
+                                  rocblas_int    batch_count)
+{
+    const int b      = blockIdx.x * NB_BATCH + threadIdx.y;
+    bool      active = b < batch_count;
+    const int batch  = active ? b : batch_count - 1;
+
+    auto alpha = load_scalar(alpha_device_host, batch, stride_alpha);
+    auto beta  = load_scalar(beta_device_host, batch, stride_beta);
+
+    const auto* A = cond_load_ptr_batch(alpha, Aa, batch, shifta, strideA);
+    const auto* x = cond_load_ptr_batch(alpha, xa, batch, shiftx, stridex);
+
+    auto* y = load_ptr_batch(ya, batch, shifty, stridey);
+
+    rocblas_gemv_small_batched_kernel_calc<TRANS, CONJ, DIM_X, NB_BATCH, TILE>(
+        active && !(!alpha && beta == 1), m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+// Gathered batched gemv, y_b = alpha * op(A_b) * x_b + beta * y_b, where row i of the m by n
+// matrix A_b is row index_b[i] of the table A. The rows of A_b are read from the table directly,
+// so op(A_b) is never materialized, and the threads of a wavefront always read along a column of
+// the table. Without TRANS, column tx of the block computes one element of y_b, reducing over
+// columns ty + k * DIM_Y of A_b. With TRANS, row ty of the block computes one element of y_b,
+// reducing over rows tx + k * DIM_X of A_b. The partial sums are reduced through LDS.
+template <bool TRANS, bool CONJ, int DIM_X, int DIM_Y, typename T, typename TScal>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_gemv_gathered_kernel(rocblas_int        m,
+                             rocblas_int        n,
+                             TScal              alpha_device_host,
+                             const T*           A,
+                             int64_t            lda,
+                             const rocblas_int* index,
+                             rocblas_stride     stride_index,
+                             const T*           xa,
+                             rocblas_stride     shiftx,
+                             int64_t            incx,
+                             rocblas_stride     stridex,
+                             TScal              beta_device_host,
+                             T*                 ya,
+                             rocblas_stride     shifty,
+                             int64_t            incy,
+                             rocblas_stride     stridey)
+{
+    __shared__ T sdata[DIM_Y][DIM_X];
+
+    auto alpha = load_scalar(alpha_device_host);
+    auto beta  = load_scalar(beta_device_host);
+    if(!alpha && beta == 1)
+        return;
+
+    const int tx = threadIdx.x;
+    const int ty = threadIdx.y;
+
+    // out indexes y_b and the rows of op(A_b)
+    const rocblas_int out_len = TRANS ? n : m;
+    const int64_t     out
+        = TRANS ? int64_t(blockIdx.x) * DIM_Y + ty : int64_t(blockIdx.x) * DIM_X + tx;
+
+    index += blockIdx.y * stride_index;
+    const T* x = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
+    T*       y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
+
+    T res = 0;
+    if(alpha && out < out_len)
+    {
+        if(!TRANS)
+        {
+            // the row of A_b of this thread is gathered once
+            const T* row = A + index[out];
+            for(rocblas_int j = ty; j < n; j += DIM_Y)
+                res += row[j * lda] * x[j * incx];
+        }
+        else
+        {
+            // the threads of a row of the block read consecutive rows of a column of A_b
+            const T* col = A + out * lda;
+            for(rocblas_int i = tx; i < m; i += DIM_X)
+            {
+                T a = col[index[i]];
+                res += (CONJ ? conj(a) : a) * x[i * incx];
+            }
+        }
+    }
+    sdata[ty][tx] = res;
+    __syncthreads();
+
+    if(TRANS)
+    {
+        for(int k = DIM_X / 2; k > 0; k /= 2)
+        {
+            if(tx < k)
+                sdata[ty][tx] += sdata[ty][tx + k];
+            __syncthreads();
+        }
+
+        if(tx == 0 && out < out_len)
+        {
+            res         = sdata[ty][0];
+            int64_t idx = out * incy;
+            y[idx]      = beta ? T(alpha * res + beta * y[idx]) : T(alpha * res);
+        }
+    }
+    else if(ty == 0 && out < out_len)
+    {
+        for(int k = 1; k < DIM_Y; k++)
+            res += sdata[k][tx];
+
+        int64_t idx = out * incy;
+        y[idx]      = beta ? T(alpha * res + beta * y[idx]) : T(alpha * res);
+    }
+}
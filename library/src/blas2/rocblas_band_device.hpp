@@ -0,0 +1,169 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "utility.hpp"
+
+/**
+  *  Tiled products with a matrix in band storage, where the element A(i, j) of the matrix is
+  *  stored at A[off + i - j + j * lda] on the stored diagonal d = off + i - j, with off = ku for
+  *  general and upper triangular band matrices and off = 0 for lower triangular ones.
+  *
+  *  A thread block of DIM_X x DIM_Y threads computes the DIM_X results of the tile starting at
+  *  blockIdx.x * DIM_X; threadIdx.x selects the result and threadIdx.y splits the sum, so the
+  *  partial sums are added with rocblas_band_tile_sum. All threads of the block have to call
+  *  these functions, as they stage their operands in LDS.
+  */
+
+/**
+  *  Partial sums of A(i, j) * x[j] over the stored diagonals d_begin <= d < d_end for the rows i
+  *  of the tile, 0 <= i < m and 0 <= j < n. Consecutive rows read consecutive elements of each
+  *  column of the band, and the segment of x for DIM_X columns is loaded once into LDS and used
+  *  by all rows.
+  */
+template <int DIM_X, int DIM_Y, typename T>
+ROCBLAS_KERNEL_ILF T rocblas_band_rows_tile(rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_int off,
+                                            rocblas_int d_begin,
+                                            rocblas_int d_end,
+                                            const T* __restrict__ A,
+                                            int64_t lda,
+                                            const T* __restrict__ x,
+                                            int64_t incx)
+{
+    const int     tx = threadIdx.x;
+    const int     ty = threadIdx.y;
+    const int64_t r0 = int64_t(blockIdx.x) * DIM_X;
+    const int64_t i  = r0 + tx;
+
+    __shared__ T sx[DIM_X];
+
+    if(d_begin >= d_end)
+        return T(0);
+
+    // columns of the stored diagonals in the rows of the tile
+    int64_t j_begin = r0 + off - (d_end - 1);
+    int64_t j_end   = r0 + DIM_X + off - d_begin;
+    if(j_begin < 0)
+        j_begin = 0;
+    if(j_end > n)
+        j_end = n;
+
+    T res = T(0);
+    for(int64_t j0 = j_begin; j0 < j_end; j0 += DIM_X)
+    {
+        if(ty == 0)
+            sx[tx] = j0 + tx < j_end ? x[(j0 + tx) * incx] : T(0);
+        __syncthreads();
+
+        for(int jj = ty; jj < DIM_X; jj += DIM_Y)
+        {
+            int64_t j = j0 + jj;
+            int64_t d = off + i - j;
+            if(i < m && j < j_end && d >= d_begin && d < d_end)
+                res += A[d + j * lda] * sx[jj];
+        }
+        __syncthreads();
+    }
+    return res;
+}
+
+/**
+  *  Partial sums of op(A(i, j)) * x[i] over the stored diagonals d_begin <= d < d_end for the
+  *  columns j of the tile, 0 <= i < m and 0 <= j < n, where op is the conjugate if CONJ. A chunk
+  *  of DIM_X diagonals of the DIM_X columns is read along the columns into LDS, together with the
+  *  2 * DIM_X elements of x it is multiplied with, and each column then sums its own elements.
+  */
+template <int DIM_X, int DIM_Y, bool CONJ, typename T>
+ROCBLAS_KERNEL_ILF T rocblas_band_cols_tile(rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_int off,
+                                            rocblas_int d_begin,
+                                            rocblas_int d_end,
+                                            const T* __restrict__ A,
+                                            int64_t lda,
+                                            const T* __restrict__ x,
+                                            int64_t incx)
+{
+    const int     tx = threadIdx.x;
+    const int     ty = threadIdx.y;
+    const int     td = ty * DIM_X + tx;
+    const int64_t r0 = int64_t(blockIdx.x) * DIM_X;
+
+    __shared__ T sA[DIM_X][DIM_X + 1];
+    __shared__ T sx[2 * DIM_X];
+
+    // stored diagonals reaching rows 0 <= i < m from the columns of the tile
+    int64_t d_lo = off - r0 - (DIM_X - 1);
+    int64_t d_hi = m + off - r0;
+    if(d_lo < d_begin)
+        d_lo = d_begin;
+    if(d_hi > d_end)
+        d_hi = d_end;
+
+    T res = T(0);
+    for(int64_t d0 = d_lo; d0 < d_hi; d0 += DIM_X)
+    {
+        // element i of x used with diagonal d of column j is x[j - off + d]
+        int64_t i0 = r0 - off + d0;
+        for(int t = td; t < 2 * DIM_X; t += DIM_X * DIM_Y)
+            sx[t] = i0 + t >= 0 && i0 + t < m ? x[(i0 + t) * incx] : T(0);
+
+        int64_t d = d0 + tx;
+        for(int jj = ty; jj < DIM_X; jj += DIM_Y)
+        {
+            int64_t j = r0 + jj;
+            int64_t i = i0 + jj + tx;
+            if(d < d_hi && j < n && i >= 0 && i < m)
+                sA[jj][tx] = CONJ ? conj(A[d + j * lda]) : A[d + j * lda];
+            else
+                sA[jj][tx] = T(0);
+        }
+        __syncthreads();
+
+        for(int dd = ty; dd < DIM_X; dd += DIM_Y)
+            res += sA[tx][dd] * sx[tx + dd];
+        __syncthreads();
+    }
+    return res;
+}
+
+/**
+  *  Adds the partial sums of the threadIdx.y of the block, the sum is returned to threadIdx.y == 0.
+  */
+template <int DIM_X, int DIM_Y, typename T>
+ROCBLAS_KERNEL_ILF T rocblas_band_tile_sum(T res)
+{
+    __shared__ T sdata[DIM_Y][DIM_X];
+
+    sdata[threadIdx.y][threadIdx.x] = res;
+    __syncthreads();
+
+    if(threadIdx.y == 0)
+    {
+        for(int k = 1; k < DIM_Y; k++)
+            res += sdata[k][threadIdx.x];
+    }
+    return res;
+}
@@ -60,13 +60,25 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        // row major op(A) is op(A)^T of column major A, kl and ku swapped, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+        {
+            if(rocblas_is_complex<T> && transA == rocblas_operation_conjugate_transpose)
+                return rocblas_status_not_implemented;
+            transA = rocblas_row_major_transpose<T>(transA);
+            std::swap(m, n);
+            std::swap(kl, ku);
+        }
+
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+
+        rocblas_api_scope api_scope(handle, rocblas_gbmv_name<T>);
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-              | rocblas_layer_mode_log_profile))
+              | rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
         {
             auto transA_letter = rocblas_transpose_letter(transA);
 
@@ -113,7 +125,7 @@ namespace
                           "--batch_count",
                           batch_count);
 
-            if(layer_mode & rocblas_layer_mode_log_profile)
+            if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                 log_profile(handle,
                             rocblas_gbmv_name<T>,
                             "transA",
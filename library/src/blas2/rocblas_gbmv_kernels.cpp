@@ -22,6 +22,7 @@
 
 #include "check_numerics_matrix.hpp"
 #include "check_numerics_vector.hpp"
+#include "rocblas_band_device.hpp"
 #include "rocblas_gbmv.hpp"
 
 // uses shuffle reductions
@@ -267,6 +268,75 @@ rocblas_gbmvt_kernel(bool              host_ptr_mode,
         transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy);
 }
 
+/**
+  *  Tiled kernel for wide bands, computing DIM_X elements of y per thread block. The normal case
+  *  reads each column of the band along the rows of the tile and the (conjugate-)transpose case
+  *  stages chunks of the columns of the tile in LDS; both reuse the segments of x from LDS.
+  */
+template <int  DIM_X,
+          int  DIM_Y,
+          bool TRANS,
+          bool CONJ,
+          typename T,
+          typename TStruct,
+          typename V,
+          typename W>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_gbmv_tiled_kernel(bool           host_ptr_mode,
+                          rocblas_int    m,
+                          rocblas_int    n,
+                          rocblas_int    kl,
+                          rocblas_int    ku,
+                          TStruct        alpha_device_host,
+                          V              Aa,
+                          rocblas_stride shifta,
+                          int64_t        lda,
+                          rocblas_stride strideA,
+                          V              xa,
+                          rocblas_stride shiftx,
+                          int64_t        incx,
+                          rocblas_stride stridex,
+                          TStruct        beta_device_host,
+                          W              ya,
+                          rocblas_stride shifty,
+                          int64_t        incy,
+                          rocblas_stride stridey)
+{
+    const auto alpha = host_ptr_mode ? alpha_device_host.value
+                                     : load_scalar(alpha_device_host.ptr, blockIdx.y, 0);
+    const auto beta
+        = host_ptr_mode ? beta_device_host.value : load_scalar(beta_device_host.ptr, blockIdx.y, 0);
+
+    if(!alpha && beta == 1)
+        return;
+
+    const auto* A = cond_load_ptr_batch(alpha, Aa, blockIdx.y, shifta, strideA);
+    const auto* x = cond_load_ptr_batch(alpha, xa, blockIdx.y, shiftx, stridex);
+
+    auto* y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
+
+    int bands = kl + ku + 1;
+    T   res_A = T(0);
+    if(alpha)
+    {
+        if constexpr(TRANS)
+            res_A = rocblas_band_cols_tile<DIM_X, DIM_Y, CONJ>(m, n, ku, 0, bands, A, lda, x, incx);
+        else
+            res_A = rocblas_band_rows_tile<DIM_X, DIM_Y>(m, n, ku, 0, bands, A, lda, x, incx);
+
+        res_A = rocblas_band_tile_sum<DIM_X, DIM_Y>(res_A) * alpha;
+    }
+
+    rocblas_int ind = blockIdx.x * DIM_X + threadIdx.x;
+    if(threadIdx.y == 0 && ind < (TRANS ? n : m))
+    {
+        if(beta != 0)
+            y[ind * incy] = res_A + beta * y[ind * incy];
+        else
+            y[ind * incy] = res_A;
+    }
+}
+
 /**
   *  Here, U is either a `const T* const*` or a `const T*`
   *  V is either a `T*` or a `T* const*`
@@ -327,7 +397,47 @@ rocblas_status rocblas_internal_gbmv_launcher(rocblas_handle    handle,
     m, n, kl, ku, alpha_device_host, A, offseta, lda, strideA, x, shiftx, incx, stridex, \
         beta_device_host, y, shifty, incy, stridey
 
-    if(transA == rocblas_operation_none)
+    // Bands of at least GBMV_TILED_BANDS diagonals use the tiled kernels
+    static constexpr int GBMV_TILED_BANDS = 32;
+    static constexpr int GBMV_TILED_DIM_X = 32;
+    static constexpr int GBMV_TILED_DIM_Y = 8;
+
+    if(int64_t(kl) + ku + 1 >= GBMV_TILED_BANDS)
+    {
+        rocblas_int rows   = transA == rocblas_operation_none ? m : n;
+        rocblas_int blocks = (rows - 1) / GBMV_TILED_DIM_X + 1;
+        dim3        gbmv_grid(blocks, batch_count);
+        dim3        gbmv_threads(GBMV_TILED_DIM_X, GBMV_TILED_DIM_Y);
+
+        if(transA == rocblas_operation_none)
+            ROCBLAS_LAUNCH_KERNEL(
+                (rocblas_gbmv_tiled_kernel<GBMV_TILED_DIM_X, GBMV_TILED_DIM_Y, false, false, T>),
+                gbmv_grid,
+                gbmv_threads,
+                0,
+                handle->get_stream(),
+                host_ptr_mode,
+                GBMV_COMMON_ARGS);
+        else if(transA == rocblas_operation_transpose)
+            ROCBLAS_LAUNCH_KERNEL(
+                (rocblas_gbmv_tiled_kernel<GBMV_TILED_DIM_X, GBMV_TILED_DIM_Y, true, false, T>),
+                gbmv_grid,
+                gbmv_threads,
+                0,
+                handle->get_stream(),
+                host_ptr_mode,
+                GBMV_COMMON_ARGS);
+        else
+            ROCBLAS_LAUNCH_KERNEL(
+                (rocblas_gbmv_tiled_kernel<GBMV_TILED_DIM_X, GBMV_TILED_DIM_Y, true, true, T>),
+                gbmv_grid,
+                gbmv_threads,
+                0,
+                handle->get_stream(),
+                host_ptr_mode,
+                GBMV_COMMON_ARGS);
+    }
+    else if(transA == rocblas_operation_none)
     {
         if(is_arch_10_or_11_or_12)
         {
@@ -0,0 +1,232 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "int64_helpers.hpp"
+#include "logging.hpp"
+#include "rocblas_storage_index.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    template <bool, typename>
+    constexpr char rocblas_gbtge_name[] = "unknown";
+    template <>
+    constexpr char rocblas_gbtge_name<true, float>[] = "rocblas_sgbtge_strided_batched";
+    template <>
+    constexpr char rocblas_gbtge_name<true, double>[] = "rocblas_dgbtge_strided_batched";
+    template <>
+    constexpr char rocblas_gbtge_name<true, rocblas_float_complex>[]
+        = "rocblas_cgbtge_strided_batched";
+    template <>
+    constexpr char rocblas_gbtge_name<true, rocblas_double_complex>[]
+        = "rocblas_zgbtge_strided_batched";
+    template <>
+    constexpr char rocblas_gbtge_name<false, float>[] = "rocblas_sgetgb_strided_batched";
+    template <>
+    constexpr char rocblas_gbtge_name<false, double>[] = "rocblas_dgetgb_strided_batched";
+    template <>
+    constexpr char rocblas_gbtge_name<false, rocblas_float_complex>[]
+        = "rocblas_cgetgb_strided_batched";
+    template <>
+    constexpr char rocblas_gbtge_name<false, rocblas_double_complex>[]
+        = "rocblas_zgetgb_strided_batched";
+
+    // Copies matrix blockIdx.z of the batch between band and full storage. Row i of the x
+    // threads is a row of the destination, so consecutive threads write consecutive elements of
+    // a column: the full matrix is written with zeros outside the band, and the rows of the band
+    // storage outside the matrix are left as they are, as in LAPACK.
+    template <int DIM_X, int DIM_Y, bool TO_FULL, typename T>
+    ROCBLAS_KERNEL(DIM_X* DIM_Y)
+    rocblas_gbtge_kernel(rocblas_int    m,
+                         rocblas_int    n,
+                         rocblas_int    kl,
+                         rocblas_int    ku,
+                         const T*       src,
+                         int64_t        ld_src,
+                         rocblas_stride stride_src,
+                         T*             dst,
+                         int64_t        ld_dst,
+                         rocblas_stride stride_dst)
+    {
+        int64_t rows = TO_FULL ? m : int64_t(kl) + ku + 1;
+        int64_t r    = blockIdx.x * int64_t(DIM_X) + threadIdx.x;
+        if(r >= rows)
+            return;
+
+        src = load_ptr_batch(src, blockIdx.z, stride_src);
+        dst = load_ptr_batch(dst, blockIdx.z, stride_dst);
+
+        for(int64_t j = blockIdx.y * int64_t(DIM_Y) + threadIdx.y; j < n;
+            j += int64_t(gridDim.y) * DIM_Y)
+        {
+            // element (i, j) of the matrix
+            int64_t i       = TO_FULL ? r : r - ku + j;
+            bool    in_band = i >= 0 && i < m && i >= j - ku && i <= j + kl;
+
+            if(TO_FULL)
+                dst[j * ld_dst + i] = in_band ? src[rocblas_band_index(ku, i, j, ld_src)] : T(0);
+            else if(in_band)
+                dst[rocblas_band_index(ku, i, j, ld_dst)] = src[j * ld_src + i];
+        }
+    }
+
+    template <bool TO_FULL, typename T>
+    rocblas_status rocblas_gbtge_impl(rocblas_handle handle,
+                                      rocblas_int    m,
+                                      rocblas_int    n,
+                                      rocblas_int    kl,
+                                      rocblas_int    ku,
+                                      const T*       src,
+                                      rocblas_int    ld_src,
+                                      rocblas_stride stride_src,
+                                      T*             dst,
+                                      rocblas_int    ld_dst,
+                                      rocblas_stride stride_dst,
+                                      rocblas_int    batch_count)
+    {
+        static constexpr int DIM_X = 64;
+        static constexpr int DIM_Y = 8;
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // row major order, see rocblas_set_order, has no column major mapping here
+        RETURN_NOT_IMPLEMENTED_IF_ROW_MAJOR(handle);
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_gbtge_name<TO_FULL, T>,
+                      m,
+                      n,
+                      kl,
+                      ku,
+                      src,
+                      ld_src,
+                      stride_src,
+                      dst,
+                      ld_dst,
+                      stride_dst,
+                      batch_count);
+
+        int64_t ldab = TO_FULL ? ld_src : ld_dst;
+        int64_t lda  = TO_FULL ? ld_dst : ld_src;
+        if(m < 0 || n < 0 || kl < 0 || ku < 0 || ldab < int64_t(kl) + ku + 1
+           || lda < std::max(m, 1) || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        if(!m || !n || !batch_count)
+            return rocblas_status_success;
+
+        if(!src || !dst)
+            return rocblas_status_invalid_pointer;
+
+        int64_t rows     = TO_FULL ? m : int64_t(kl) + ku + 1;
+        int64_t blocks_x = (rows - 1) / DIM_X + 1;
+        int64_t blocks_y = std::min(int64_t((n - 1) / DIM_Y + 1), c_i64_grid_YZ_chunk);
+
+        for(int64_t b_base = 0; b_base < batch_count; b_base += c_i64_grid_YZ_chunk)
+        {
+            int32_t batches = int32_t(std::min(batch_count - b_base, c_i64_grid_YZ_chunk));
+
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gbtge_kernel<DIM_X, DIM_Y, TO_FULL>),
+                                  dim3(blocks_x, blocks_y, batches),
+                                  dim3(DIM_X, DIM_Y),
+                                  0,
+                                  handle->get_stream(),
+                                  m,
+                                  n,
+                                  kl,
+                                  ku,
+                                  src + b_base * stride_src,
+                                  ld_src,
+                                  stride_src,
+                                  dst + b_base * stride_dst,
+                                  ld_dst,
+                                  stride_dst);
+        }
+
+        return rocblas_status_success;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(name_, TO_FULL_, T_)                                                              \
+    rocblas_status name_(rocblas_handle handle,                                                \
+                         rocblas_int    m,                                                     \
+                         rocblas_int    n,                                                     \
+                         rocblas_int    kl,                                                    \
+                         rocblas_int    ku,                                                    \
+                         const T_*      src,                                                   \
+                         rocblas_int    ld_src,                                                \
+                         rocblas_stride stride_src,                                            \
+                         T_*            dst,                                                   \
+                         rocblas_int    ld_dst,                                                \
+                         rocblas_stride stride_dst,                                            \
+                         rocblas_int    batch_count)                                           \
+    try                                                                                        \
+    {                                                                                          \
+        return rocblas_gbtge_impl<TO_FULL_, T_>(handle,                                        \
+                                                m,                                             \
+                                                n,                                             \
+                                                kl,                                            \
+                                                ku,                                            \
+                                                src,                                           \
+                                                ld_src,                                        \
+                                                stride_src,                                    \
+                                                dst,                                           \
+                                                ld_dst,                                        \
+                                                stride_dst,                                    \
+                                                batch_count);                                  \
+    }                                                                                          \
+    catch(...)                                                                                 \
+    {                                                                                          \
+        return exception_to_rocblas_status();                                                  \
+    }
+
+extern "C" {
+
+IMPL(rocblas_sgbtge_strided_batched, true, float);
+IMPL(rocblas_dgbtge_strided_batched, true, double);
+IMPL(rocblas_cgbtge_strided_batched, true, rocblas_float_complex);
+IMPL(rocblas_zgbtge_strided_batched, true, rocblas_double_complex);
+
+IMPL(rocblas_sgetgb_strided_batched, false, float);
+IMPL(rocblas_dgetgb_strided_batched, false, double);
+IMPL(rocblas_cgetgb_strided_batched, false, rocblas_float_complex);
+IMPL(rocblas_zgetgb_strided_batched, false, rocblas_double_complex);
+
+} // extern "C"
+
+#undef IMPL
@@ -31,6 +31,14 @@ template <typename To>
 ROCBLAS_INTERNAL_EXPORT_NOINLINE size_t rocblas_internal_gemv_kernel_workspace_size(
     rocblas_operation transA, rocblas_int m, rocblas_int n, rocblas_int batch_count);
 
+// Batched gemv with m, n <= 64 and large batch_count computes whole problems per row of a thread
+// block, with the batch in the x dimension of the grid, instead of spreading each over a grid
+// mostly idle for such sizes
+inline bool rocblas_gemv_small_batched(int64_t m, int64_t n, int64_t batch_count)
+{
+    return m <= 64 && n <= 64 && batch_count >= 256;
+}
+
 template <typename API_INT, typename Ti, typename Tex, typename To>
 inline rocblas_status rocblas_internal_gemv_arg_check(rocblas_handle    handle,
                                                       rocblas_operation transA,
@@ -69,7 +77,8 @@ inline rocblas_status rocblas_internal_gemv_arg_check(rocblas_handle    handle,
 
     if(handle->pointer_mode == rocblas_pointer_mode_host)
     {
-        if(*alpha == 0 && *beta == 1)
+        // y still changes with alpha == 0 and beta == 1 when an epilogue is applied
+        if(*alpha == 0 && *beta == 1 && !handle->active_gemv_epilogue)
             return rocblas_status_success;
 
         if(!y || (*alpha != 0 && (!A || !x)))
@@ -153,6 +162,27 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                            rocblas_int       batch_count,
                                            T*                workspace = nullptr);
 
+// Gemv of each batch instance with the rows of A selected by index, see
+// rocblas_sgemv_gathered_batched. x and y are not offset, negative increments are handled here.
+template <typename T>
+rocblas_status rocblas_internal_gemv_gathered_launcher(rocblas_handle     handle,
+                                                       rocblas_operation  transA,
+                                                       rocblas_int        m,
+                                                       rocblas_int        n,
+                                                       const T*           alpha,
+                                                       const T*           A,
+                                                       int64_t            lda,
+                                                       const rocblas_int* index,
+                                                       rocblas_stride     stride_index,
+                                                       const T*           x,
+                                                       int64_t            incx,
+                                                       rocblas_stride     stridex,
+                                                       const T*           beta,
+                                                       T*                 y,
+                                                       int64_t            incy,
+                                                       rocblas_stride     stridey,
+                                                       rocblas_int        batch_count);
+
 template <typename Ti, typename To>
 rocblas_status rocblas_gemv_check_numerics(const char*       function_name,
                                            rocblas_handle    handle,
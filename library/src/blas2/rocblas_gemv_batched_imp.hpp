@@ -70,6 +70,15 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        // row major op(A) is op(A)^T of column major A, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+        {
+            if(rocblas_is_complex<Ti> && transA == rocblas_operation_conjugate_transpose)
+                return rocblas_status_not_implemented;
+            transA = rocblas_row_major_transpose<Ti>(transA);
+            std::swap(m, n);
+        }
+
         size_t dev_bytes = ROCBLAS_API(rocblas_internal_gemv_kernel_workspace_size)<Tex>(
             transA, m, n, batch_count);
         if(handle->is_device_memory_size_query())
@@ -78,9 +87,11 @@ namespace
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
 
+        rocblas_api_scope api_scope(handle, rocblas_gemv_name<Ti, To>);
+
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-              | rocblas_layer_mode_log_profile))
+              | rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
         {
             auto transA_letter = rocblas_transpose_letter(transA);
 
@@ -153,7 +164,7 @@ namespace
                 }
             }
 
-            if(layer_mode & rocblas_layer_mode_log_profile)
+            if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                 log_profile(handle,
                             rocblas_gemv_name<Ti, To>,
                             "transA",
@@ -0,0 +1,206 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * Gathered batched gemv,
+ *
+ *     y_i := alpha * op(A_i) * x_i + beta * y_i,    i = 1, ..., batch_count,
+ *
+ * where row r of the m by n matrix A_i is row index_i[r] of the table A, as in the embedding
+ * lookups of recommendation models. The rows are read from the table by the gemv kernel itself,
+ * rather than copied into a strided batch of matrices for gemv_strided_batched first.
+ */
+
+#include "handle.hpp"
+#include "int64_helpers.hpp"
+#include "logging.hpp"
+#include "rocblas_gemv.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_gemv_gathered_name[] = "unknown";
+    template <>
+    constexpr char rocblas_gemv_gathered_name<float>[] = "rocblas_sgemv_gathered_batched";
+    template <>
+    constexpr char rocblas_gemv_gathered_name<double>[] = "rocblas_dgemv_gathered_batched";
+    template <>
+    constexpr char rocblas_gemv_gathered_name<rocblas_float_complex>[]
+        = "rocblas_cgemv_gathered_batched";
+    template <>
+    constexpr char rocblas_gemv_gathered_name<rocblas_double_complex>[]
+        = "rocblas_zgemv_gathered_batched";
+
+    template <typename T>
+    rocblas_status rocblas_gemv_gathered_batched_impl(rocblas_handle     handle,
+                                                      rocblas_operation  transA,
+                                                      rocblas_int        m,
+                                                      rocblas_int        n,
+                                                      const T*           alpha,
+                                                      const T*           A,
+                                                      rocblas_int        lda,
+                                                      const rocblas_int* index,
+                                                      rocblas_stride     stride_index,
+                                                      const T*           x,
+                                                      rocblas_int        incx,
+                                                      rocblas_stride     stridex,
+                                                      const T*           beta,
+                                                      T*                 y,
+                                                      rocblas_int        incy,
+                                                      rocblas_stride     stridey,
+                                                      rocblas_int        batch_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // row major order, see rocblas_set_order, has no column major mapping here
+        RETURN_NOT_IMPLEMENTED_IF_ROW_MAJOR(handle);
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_gemv_gathered_name<T>,
+                      transA,
+                      m,
+                      n,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      A,
+                      lda,
+                      index,
+                      stride_index,
+                      x,
+                      incx,
+                      stridex,
+                      LOG_TRACE_SCALAR_VALUE(handle, beta),
+                      y,
+                      incy,
+                      stridey,
+                      batch_count);
+
+        if(transA != rocblas_operation_none && transA != rocblas_operation_transpose
+           && transA != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+
+        if(m < 0 || n < 0 || lda < 1 || !incx || !incy || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        if(!m || !n || !batch_count)
+            return rocblas_status_success;
+
+        if(!alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            if(*alpha == 0 && *beta == 1)
+                return rocblas_status_success;
+
+            if(!y || (*alpha != 0 && (!A || !index || !x)))
+                return rocblas_status_invalid_pointer;
+        }
+
+        return rocblas_internal_gemv_gathered_launcher(handle,
+                                                       transA,
+                                                       m,
+                                                       n,
+                                                       alpha,
+                                                       A,
+                                                       (int64_t)lda,
+                                                       index,
+                                                       stride_index,
+                                                       x,
+                                                       (int64_t)incx,
+                                                       stridex,
+                                                       beta,
+                                                       y,
+                                                       (int64_t)incy,
+                                                       stridey,
+                                                       batch_count);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(name_, T_)                                             \
+    rocblas_status name_(rocblas_handle     handle,                 \
+                         rocblas_operation  transA,                 \
+                         rocblas_int        m,                      \
+                         rocblas_int        n,                      \
+                         const T_*          alpha,                  \
+                         const T_*          A,                      \
+                         rocblas_int        lda,                    \
+                         const rocblas_int* index,                  \
+                         rocblas_stride     stride_index,           \
+                         const T_*          x,                      \
+                         rocblas_int        incx,                   \
+                         rocblas_stride     stridex,                \
+                         const T_*          beta,                   \
+                         T_*                y,                      \
+                         rocblas_int        incy,                   \
+                         rocblas_stride     stridey,                \
+                         rocblas_int        batch_count)            \
+    try                                                             \
+    {                                                               \
+        return rocblas_gemv_gathered_batched_impl<T_>(handle,       \
+                                                      transA,       \
+                                                      m,            \
+                                                      n,            \
+                                                      alpha,        \
+                                                      A,            \
+                                                      lda,          \
+                                                      index,        \
+                                                      stride_index, \
+                                                      x,            \
+                                                      incx,         \
+                                                      stridex,      \
+                                                      beta,         \
+                                                      y,            \
+                                                      incy,         \
+                                                      stridey,      \
+                                                      batch_count); \
+    }                                                               \
+    catch(...)                                                      \
+    {                                                               \
+        return exception_to_rocblas_status();                       \
+    }
+
+extern "C" {
+
+IMPL(rocblas_sgemv_gathered_batched, float);
+IMPL(rocblas_dgemv_gathered_batched, double);
+IMPL(rocblas_cgemv_gathered_batched, rocblas_float_complex);
+IMPL(rocblas_zgemv_gathered_batched, rocblas_double_complex);
+
+} // extern "C"
+
+#undef IMPL
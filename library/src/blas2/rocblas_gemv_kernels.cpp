@@ -115,6 +115,229 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE size_t rocblas_internal_gemv_kernel_workspace_s
     return sizeof(To) * blocks * n * batch_count;
 }
 
+template <bool TRANS, bool CONJ, typename Ti, typename Tex, typename To>
+rocblas_status rocblas_gemv_small_batched_launcher(rocblas_handle handle,
+                                                   rocblas_int    m,
+                                                   rocblas_int    n,
+                                                   const Tex*     alpha,
+                                                   rocblas_stride stride_alpha,
+                                                   const Ti*      A,
+                                                   rocblas_stride offseta,
+                                                   int64_t        lda,
+                                                   rocblas_stride strideA,
+                                                   const Ti*      x,
+                                                   rocblas_stride shiftx,
+                                                   int64_t        incx,
+                                                   rocblas_stride stridex,
+                                                   const Tex*     beta,
+                                                   rocblas_stride stride_beta,
+                                                   To*            y,
+                                                   rocblas_stride shifty,
+                                                   int64_t        incy,
+                                                   rocblas_stride stridey,
+                                                   rocblas_int    batch_count)
+{
+    static constexpr int DIM_X    = 64;
+    static constexpr int NB_BATCH = rocblas_gemv_small_batched_NB<Tex>();
+    static constexpr int TILE     = 16;
+
+    dim3 grid((batch_count - 1) / NB_BATCH + 1);
+    dim3 threads(DIM_X, NB_BATCH);
+
+#define gemv_small_batched_KARGS(alpha_, beta_)                                                  \
+    grid, threads, 0, handle->get_stream(), m, n, alpha_, stride_alpha, A, offseta, lda, strideA, \
+        x, shiftx, incx, stridex, beta_, stride_beta, y, shifty, incy, stridey, batch_count
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+    {
+        ROCBLAS_LAUNCH_KERNEL(
+            (rocblas_gemv_small_batched_kernel<TRANS, CONJ, DIM_X, NB_BATCH, TILE>),
+            gemv_small_batched_KARGS(alpha, beta));
+    }
+    else
+    {
+        if(!*alpha && *beta == 1)
+            return rocblas_status_success;
+
+        ROCBLAS_LAUNCH_KERNEL(
+            (rocblas_gemv_small_batched_kernel<TRANS, CONJ, DIM_X, NB_BATCH, TILE>),
+            gemv_small_batched_KARGS(*alpha, *beta));
+    }
+#undef gemv_small_batched_KARGS
+
+    return rocblas_status_success;
+}
+
+// Gemv applying the epilogue of the handle, see rocblas_set_gemv_epilogue. The epilogue is fused
+// into the stores of y by the general gemvn kernel and the skinny gemvt reduction, and applied by
+// one more pass over y after the other kernels.
+template <typename T>
+rocblas_status rocblas_gemv_epilogue_launcher(rocblas_handle    handle,
+                                              rocblas_operation transA,
+                                              rocblas_int       m,
+                                              rocblas_int       n,
+                                              const T*          alpha,
+                                              rocblas_stride    stride_alpha,
+                                              const T*          A,
+                                              rocblas_stride    offseta,
+                                              int64_t           lda,
+                                              rocblas_stride    strideA,
+                                              const T*          x,
+                                              rocblas_stride    offsetx,
+                                              int64_t           incx,
+                                              rocblas_stride    stridex,
+                                              const T*          beta,
+                                              rocblas_stride    stride_beta,
+                                              T*                y,
+                                              rocblas_stride    offsety,
+                                              int64_t           incy,
+                                              rocblas_stride    stridey,
+                                              rocblas_int       batch_count,
+                                              T*                workspace)
+{
+    rocblas_int                   y_len = transA == rocblas_operation_none ? m : n;
+    rocblas_gemv_epilogue_args<T> epilogue(*handle->active_gemv_epilogue, y_len);
+
+    // kernels launched from here do not apply the epilogue again
+    auto saved_epilogue = handle->push_gemv_epilogue(nullptr);
+
+    hipStream_t rocblas_stream = handle->get_stream();
+    bool        stream_a       = handle->cache_policy & rocblas_cache_policy_stream_a;
+    bool        device         = handle->pointer_mode == rocblas_pointer_mode_device;
+
+    auto shiftx = incx < 0 ? offsetx - incx * ((transA == rocblas_operation_none ? n : m) - 1)
+                           : offsetx;
+    auto shifty = incy < 0 ? offsety - incy * (y_len - 1) : offsety;
+
+    bool i64_indices = lda > c_i32_max || incx > c_i32_max || incx < c_i32_min
+                       || incy > c_i32_max || incy < c_i32_min || size_t(n) * lda > c_i32_max
+                       || size_t(transA == rocblas_operation_none ? n - 1 : m - 1) * std::abs(incx)
+                              >= c_i32_max
+                       || size_t(y_len - 1) * std::abs(incy) >= c_i32_max;
+
+    if(transA == rocblas_operation_none)
+    {
+        static constexpr int GEMVN_DIM_X = 64;
+        static constexpr int GEMVN_DIM_Y = 16;
+        rocblas_int          blocks      = (m - 1) / (GEMVN_DIM_X * 4) + 1;
+        if(std::is_same_v<T, rocblas_double_complex>)
+            blocks = (m - 1) / (GEMVN_DIM_X) + 1;
+        dim3 gemvn_grid(blocks, batch_count);
+        dim3 gemvn_threads(GEMVN_DIM_X, GEMVN_DIM_Y);
+
+#define gemvn_epilogue_KARGS(alpha_, beta_)                                                        \
+    gemvn_grid, gemvn_threads, 0, rocblas_stream, m, n, alpha_, stride_alpha, A, offseta, lda,     \
+        strideA, x, shiftx, incx, stridex, beta_, stride_beta, y, shifty, incy, stridey, epilogue, \
+        stream_a
+
+        if(device)
+        {
+            if(!i64_indices)
+                ROCBLAS_LAUNCH_KERNEL((rocblas_gemvn_kernel<GEMVN_DIM_X, GEMVN_DIM_Y, rocblas_int>),
+                                      gemvn_epilogue_KARGS(alpha, beta));
+            else
+                ROCBLAS_LAUNCH_KERNEL((rocblas_gemvn_kernel<GEMVN_DIM_X, GEMVN_DIM_Y, int64_t>),
+                                      gemvn_epilogue_KARGS(alpha, beta));
+        }
+        else
+        {
+            if(!i64_indices)
+                ROCBLAS_LAUNCH_KERNEL((rocblas_gemvn_kernel<GEMVN_DIM_X, GEMVN_DIM_Y, rocblas_int>),
+                                      gemvn_epilogue_KARGS(*alpha, *beta));
+            else
+                ROCBLAS_LAUNCH_KERNEL((rocblas_gemvn_kernel<GEMVN_DIM_X, GEMVN_DIM_Y, int64_t>),
+                                      gemvn_epilogue_KARGS(*alpha, *beta));
+        }
+#undef gemvn_epilogue_KARGS
+
+        return rocblas_status_success;
+    }
+
+    if(workspace && !i64_indices && rocblas_gemvt_skinny_n<T>(transA, m, n))
+    {
+        static constexpr int NB     = rocblas_gemvt_sn_NB();
+        static constexpr int WIN    = rocblas_gemvt_sn_WIN();
+        int                  blocks = rocblas_gemvt_sn_kernel_block_count(m);
+        dim3                 gemvt_grid(blocks, batch_count);
+        dim3                 gemvt_threads(NB);
+
+#define gemvt_sn_epilogue_KARGS(alpha_)                                                        \
+    gemvt_grid, gemvt_threads, 0, rocblas_stream, m, n, alpha_, stride_alpha, A, offseta, lda, \
+        strideA, x, shiftx, incx, stridex, workspace
+#define gemvt_sn_reduce_epilogue_KARGS(beta_)                                                 \
+    dim3(1, n, batch_count), gemvt_threads, 0, rocblas_stream, blocks, beta_, stride_beta, y, \
+        shifty, incy, stridey, workspace, epilogue
+
+        if(transA == rocblas_operation_transpose)
+        {
+            if(device)
+                ROCBLAS_LAUNCH_KERNEL((rocblas_gemvt_sn_kernel<false, NB, WIN, rocblas_int>),
+                                      gemvt_sn_epilogue_KARGS(alpha));
+            else
+                ROCBLAS_LAUNCH_KERNEL((rocblas_gemvt_sn_kernel<false, NB, WIN, rocblas_int>),
+                                      gemvt_sn_epilogue_KARGS(*alpha));
+        }
+        else
+        {
+            if(device)
+                ROCBLAS_LAUNCH_KERNEL((rocblas_gemvt_sn_kernel<true, NB, WIN, rocblas_int>),
+                                      gemvt_sn_epilogue_KARGS(alpha));
+            else
+                ROCBLAS_LAUNCH_KERNEL((rocblas_gemvt_sn_kernel<true, NB, WIN, rocblas_int>),
+                                      gemvt_sn_epilogue_KARGS(*alpha));
+        }
+
+        if(device)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemvt_sn_reduce<NB, 8>),
+                                  gemvt_sn_reduce_epilogue_KARGS(beta));
+        else
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemvt_sn_reduce<NB, 8>),
+                                  gemvt_sn_reduce_epilogue_KARGS(*beta));
+#undef gemvt_sn_reduce_epilogue_KARGS
+#undef gemvt_sn_epilogue_KARGS
+
+        return rocblas_status_success;
+    }
+
+    RETURN_IF_ROCBLAS_ERROR(rocblas_internal_gemv_launcher(handle,
+                                                           transA,
+                                                           m,
+                                                           n,
+                                                           alpha,
+                                                           stride_alpha,
+                                                           A,
+                                                           offseta,
+                                                           lda,
+                                                           strideA,
+                                                           x,
+                                                           offsetx,
+                                                           incx,
+                                                           stridex,
+                                                           beta,
+                                                           stride_beta,
+                                                           y,
+                                                           offsety,
+                                                           incy,
+                                                           stridey,
+                                                           batch_count,
+                                                           workspace));
+
+    static constexpr int NB = 256;
+    ROCBLAS_LAUNCH_KERNEL((rocblas_gemv_epilogue_kernel<NB>),
+                          dim3((y_len - 1) / NB + 1, batch_count),
+                          dim3(NB),
+                          0,
+                          rocblas_stream,
+                          y_len,
+                          y,
+                          shifty,
+                          incy,
+                          stridey,
+                          epilogue);
+
+    return rocblas_status_success;
+}
+
 template <typename Ti, typename Tex, typename To>
 rocblas_status rocblas_internal_gemv_launcher(rocblas_handle    handle,
                                               rocblas_operation transA,
@@ -143,7 +366,39 @@ rocblas_status rocblas_internal_gemv_launcher(rocblas_handle    handle,
     if(!m || !n || !batch_count)
         return rocblas_status_success;
 
+    // the epilogue of rocblas_set_gemv_epilogue is pushed by gemv and gemv_strided_batched only
+    if constexpr(std::is_same_v<Ti, Tex> && std::is_same_v<Ti, To>
+                 && (std::is_same_v<Ti, float> || std::is_same_v<Ti, double>
+                     || std::is_same_v<Ti, rocblas_float_complex>
+                     || std::is_same_v<Ti, rocblas_double_complex>))
+    {
+        if(handle->active_gemv_epilogue)
+            return rocblas_gemv_epilogue_launcher(handle,
+                                                  transA,
+                                                  m,
+                                                  n,
+                                                  alpha,
+                                                  stride_alpha,
+                                                  A,
+                                                  offseta,
+                                                  lda,
+                                                  strideA,
+                                                  x,
+                                                  offsetx,
+                                                  incx,
+                                                  stridex,
+                                                  beta,
+                                                  stride_beta,
+                                                  y,
+                                                  offsety,
+                                                  incy,
+                                                  stridey,
+                                                  batch_count,
+                                                  workspace);
+    }
+
     hipStream_t rocblas_stream = handle->get_stream();
+    bool        stream_a       = handle->cache_policy & rocblas_cache_policy_stream_a;
 
     // in case of negative inc shift pointer to end of data for negative indexing tid*inc
     auto shiftx = incx < 0
@@ -175,18 +430,19 @@ rocblas_status rocblas_internal_gemv_launcher(rocblas_handle    handle,
     const bool is_atomics_allowed = handle->atomics_mode == rocblas_atomics_allowed ? true : false;
 
     //Identifying the architecture to have an appropriate optimization
-    int  arch_major = handle->getArchMajor();
-    bool is_arch_10_or_11_or_12
-        = arch_major == 10 || arch_major == 11 || arch_major == 12 ? true : false;
-    bool is_gfx908 = handle->getArch() == 908 ? true : false;
-    bool is_gfx906 = handle->getArch() == 906 ? true : false;
     bool is_gfx90a = handle->getArch() == 910 ? true : false;
 
+    //Kernel selection thresholds of the architecture
+    const rocblas_level2_thresholds& thresholds = rocblas_level2_get_thresholds(handle);
+    static constexpr int             precision
+        = rocblas_level2_precision(is_float, is_double, is_complex_float, is_complex_double);
+
     if(transA == rocblas_operation_none)
     {
 #define gemvn_KARGS(alpha_, beta_)                                                             \
     gemvn_grid, gemvn_threads, 0, rocblas_stream, m, n, alpha_, stride_alpha, A, offseta, lda, \
-        strideA, x, shiftx, incx, stridex, beta_, stride_beta, y, shifty, incy, stridey
+        strideA, x, shiftx, incx, stridex, beta_, stride_beta, y, shifty, incy, stridey,       \
+        rocblas_gemv_no_epilogue{}, stream_a
 
         if(!i64_incs && is_gfx90a && m <= 32 && n <= 32 && batch_count >= 256)
         {
@@ -222,6 +478,29 @@ rocblas_status rocblas_internal_gemv_launcher(rocblas_handle    handle,
             }
 #undef gemvn_sm_mn_batched_KARGS
         }
+        else if(!i64_incs && rocblas_gemv_small_batched(m, n, batch_count))
+        {
+            return rocblas_gemv_small_batched_launcher<false, false>(handle,
+                                                                      m,
+                                                                      n,
+                                                                      alpha,
+                                                                      stride_alpha,
+                                                                      A,
+                                                                      offseta,
+                                                                      lda,
+                                                                      strideA,
+                                                                      x,
+                                                                      shiftx,
+                                                                      incx,
+                                                                      stridex,
+                                                                      beta,
+                                                                      stride_beta,
+                                                                      y,
+                                                                      shifty,
+                                                                      incy,
+                                                                      stridey,
+                                                                      batch_count);
+        }
         else if(n <= 128 && m >= 2048 * n)
         {
             // skinny tuned block size
@@ -337,22 +616,10 @@ rocblas_status rocblas_internal_gemv_launcher(rocblas_handle    handle,
             }
 #undef gemvn_double_buffered_KARGS
         }
-        //optimized gemvn kernel for gfx906 and gfx908.
-        else if((is_gfx908
-                 && (((is_float || is_double || is_complex_float) && m <= gemvn_gfx908_threshold
-                      && n <= gemvn_gfx908_threshold)
-                     || (is_complex_double && m <= zgemvn_gfx908_threshold
-                         && n <= zgemvn_gfx908_threshold)))
-
-                || (is_gfx906
-                    && (is_complex_float
-                        || ((is_float || is_double) && m <= gemvn_gfx906_threshold
-                            && n <= gemvn_gfx906_threshold)
-                        || (is_double
-                            && ((m >= dgemvn_gfx906_lower_threshold
-                                 && n >= dgemvn_gfx906_lower_threshold)
-                                || (m <= dgemvn_gfx906_upper_threshold
-                                    && n <= dgemvn_gfx906_upper_threshold))))))
+        //optimized gemvn kernel, tuned for gfx906 and gfx908.
+        else if((m <= thresholds.gemvn_upper[precision] && n <= thresholds.gemvn_upper[precision])
+                || (m >= thresholds.gemvn_lower[precision]
+                    && n >= thresholds.gemvn_lower[precision]))
         {
             static constexpr int GEMVN_DIM_X = 32;
             static constexpr int GEMVN_DIM_Y = 16;
@@ -428,7 +695,30 @@ rocblas_status rocblas_internal_gemv_launcher(rocblas_handle    handle,
         // transpose
         static constexpr bool CONJ = false;
 
-        if(!i64_incs && m <= 64 && batch_count > 8) // few rows, e.g. qmcpack
+        if(!i64_incs && rocblas_gemv_small_batched(m, n, batch_count))
+        {
+            return rocblas_gemv_small_batched_launcher<true, CONJ>(handle,
+                                                                    m,
+                                                                    n,
+                                                                    alpha,
+                                                                    stride_alpha,
+                                                                    A,
+                                                                    offseta,
+                                                                    lda,
+                                                                    strideA,
+                                                                    x,
+                                                                    shiftx,
+                                                                    incx,
+                                                                    stridex,
+                                                                    beta,
+                                                                    stride_beta,
+                                                                    y,
+                                                                    shifty,
+                                                                    incy,
+                                                                    stridey,
+                                                                    batch_count);
+        }
+        else if(!i64_incs && m <= 64 && batch_count > 8) // few rows, e.g. qmcpack
         {
             // number of columns on the y-dim of the grid
             static constexpr int NB = 256;
@@ -523,7 +813,8 @@ rocblas_status rocblas_internal_gemv_launcher(rocblas_handle    handle,
                                       shifty,
                                       incy,
                                       stridey,
-                                      (Tex*)workspace);
+                                      (Tex*)workspace,
+                                      rocblas_gemv_no_epilogue{});
             }
             else
             {
@@ -549,16 +840,16 @@ rocblas_status rocblas_internal_gemv_launcher(rocblas_handle    handle,
                                       shifty,
                                       incy,
                                       stridey,
-                                      workspace);
+                                      workspace,
+                                      rocblas_gemv_no_epilogue{});
             }
 
 #undef gemvt_sn_KARGS
         }
-        //optimized gemvt kernel with double buffered loads for gfx908.
+        //optimized gemvt kernel with double buffered loads, tuned for gfx908.
         else if(!i64_incs && is_atomics_allowed && (m == n) && (m % rocblas_gemv_bx() == 0)
-                && (is_gfx908
-                    && ((is_float && m > sgemvt_gfx908_lower_threshold)
-                        || (is_double && m > dgemvt_gfx908_lower_threshold))))
+                && (is_float || is_double)
+                && m > thresholds.gemvt_double_buffered_lower[precision])
         {
             if constexpr(is_float || is_double)
             {
@@ -641,12 +932,9 @@ rocblas_status rocblas_internal_gemv_launcher(rocblas_handle    handle,
     gemvt_grid, gemvt_threads, 0, rocblas_stream, m, n, alpha_, stride_alpha, A, offseta, lda, \
         strideA, x, shiftx, incx, stridex, beta_, stride_beta, y, shifty, incy, stridey
 
-        //Using kernel code with warp reduction for gfx1030.
-        else if(is_arch_10_or_11_or_12
-                && (is_double || is_complex_float
-                    || (is_float
-                        && (m < sgemvt_gfx_arch_10_11_threshold
-                            || n < sgemvt_gfx_arch_10_11_threshold))))
+        //Using kernel code with warp reduction, tuned for gfx10, gfx11 and gfx12.
+        else if(m < thresholds.gemvt_warp_reduce_upper[precision]
+                || n < thresholds.gemvt_warp_reduce_upper[precision])
         {
             //Number of threads per block
             static constexpr int NB = 256;
@@ -675,10 +963,10 @@ rocblas_status rocblas_internal_gemv_launcher(rocblas_handle    handle,
                                           gemvt_KARGS(*alpha, *beta));
             }
         }
-        //Using kernel code with shared memory reduction for single precision as well as for other precisions when m or n is less than 6000 and for complex double in gfx1030.
+        //Using kernel code with shared memory reduction when m or n is less than gemvt_shared_upper: always for single precision, and for complex double in gfx10, gfx11 and gfx12 by default.
         else if(!i64_incs
-                && ((is_float || m < gemvt_threshold || n < gemvt_threshold)
-                    || (is_arch_10_or_11_or_12 && is_complex_double)))
+                && (m < thresholds.gemvt_shared_upper[precision]
+                    || n < thresholds.gemvt_shared_upper[precision]))
         {
             //Number of threads per block
             static constexpr int NB = 256;
@@ -737,7 +1025,30 @@ rocblas_status rocblas_internal_gemv_launcher(rocblas_handle    handle,
         static constexpr bool CONJ = true;
         // conjugate transpose
 
-        if(!i64_incs && m <= 64 && batch_count > 8) // few rows, e.g. qmcpack
+        if(!i64_incs && rocblas_gemv_small_batched(m, n, batch_count))
+        {
+            return rocblas_gemv_small_batched_launcher<true, CONJ>(handle,
+                                                                    m,
+                                                                    n,
+                                                                    alpha,
+                                                                    stride_alpha,
+                                                                    A,
+                                                                    offseta,
+                                                                    lda,
+                                                                    strideA,
+                                                                    x,
+                                                                    shiftx,
+                                                                    incx,
+                                                                    stridex,
+                                                                    beta,
+                                                                    stride_beta,
+                                                                    y,
+                                                                    shifty,
+                                                                    incy,
+                                                                    stridey,
+                                                                    batch_count);
+        }
+        else if(!i64_incs && m <= 64 && batch_count > 8) // few rows, e.g. qmcpack
         {
             // number of columns on the y-dim of the grid
             static constexpr int NB = 256;
@@ -832,7 +1143,8 @@ rocblas_status rocblas_internal_gemv_launcher(rocblas_handle    handle,
                                       shifty,
                                       incy,
                                       stridey,
-                                      (Tex*)workspace);
+                                      (Tex*)workspace,
+                                      rocblas_gemv_no_epilogue{});
             }
             else
             {
@@ -858,16 +1170,16 @@ rocblas_status rocblas_internal_gemv_launcher(rocblas_handle    handle,
                                       shifty,
                                       incy,
                                       stridey,
-                                      workspace);
+                                      workspace,
+                                      rocblas_gemv_no_epilogue{});
             }
 
 #undef gemvt_sn_KARGS
         }
-        //optimized gemvt kernel with double buffered loads for gfx908.
+        //optimized gemvt kernel with double buffered loads, tuned for gfx908.
         else if(!i64_incs && is_atomics_allowed && (m == n) && (m % rocblas_gemv_bx() == 0)
-                && (is_gfx908
-                    && ((is_float && m > sgemvt_gfx908_lower_threshold)
-                        || (is_double && m > dgemvt_gfx908_lower_threshold))))
+                && (is_float || is_double)
+                && m > thresholds.gemvt_double_buffered_lower[precision])
         {
             if constexpr(is_float || is_double)
             {
@@ -1099,6 +1411,77 @@ rocblas_status rocblas_internal_gemv_batched_template(rocblas_handle    handle,
                                           workspace);
 }
 
+template <typename T>
+rocblas_status rocblas_internal_gemv_gathered_launcher(rocblas_handle     handle,
+                                                       rocblas_operation  transA,
+                                                       rocblas_int        m,
+                                                       rocblas_int        n,
+                                                       const T*           alpha,
+                                                       const T*           A,
+                                                       int64_t            lda,
+                                                       const rocblas_int* index,
+                                                       rocblas_stride     stride_index,
+                                                       const T*           x,
+                                                       int64_t            incx,
+                                                       rocblas_stride     stridex,
+                                                       const T*           beta,
+                                                       T*                 y,
+                                                       int64_t            incy,
+                                                       rocblas_stride     stridey,
+                                                       rocblas_int        batch_count)
+{
+    static constexpr int DIM_X = 64;
+    static constexpr int DIM_Y = 16;
+
+    const bool        trans = transA != rocblas_operation_none;
+    const rocblas_int x_len = trans ? m : n;
+    const rocblas_int y_len = trans ? n : m;
+
+    auto shiftx = incx < 0 ? -incx * (x_len - 1) : 0;
+    auto shifty = incy < 0 ? -incy * (y_len - 1) : 0;
+
+    hipStream_t rocblas_stream = handle->get_stream();
+    dim3        threads(DIM_X, DIM_Y);
+
+#define gemv_gathered_KARGS(alpha_, beta_)                                                      \
+    grid, threads, 0, rocblas_stream, m, n, alpha_, A, lda, index_b, stride_index, x_b, shiftx, \
+        incx, stridex, beta_, y_b, shifty, incy, stridey
+
+#define gemv_gathered_LAUNCH(TRANS_, CONJ_)                                                   \
+    if(handle->pointer_mode == rocblas_pointer_mode_device)                                   \
+        ROCBLAS_LAUNCH_KERNEL((rocblas_gemv_gathered_kernel<TRANS_, CONJ_, DIM_X, DIM_Y, T>), \
+                              gemv_gathered_KARGS(alpha, beta));                              \
+    else                                                                                      \
+        ROCBLAS_LAUNCH_KERNEL((rocblas_gemv_gathered_kernel<TRANS_, CONJ_, DIM_X, DIM_Y, T>), \
+                              gemv_gathered_KARGS(*alpha, *beta))
+
+    for(int64_t b_base = 0; b_base < batch_count; b_base += c_i64_grid_YZ_chunk)
+    {
+        int32_t            batches = int32_t(std::min(batch_count - b_base, c_i64_grid_YZ_chunk));
+        dim3               grid((y_len - 1) / (trans ? DIM_Y : DIM_X) + 1, batches);
+        const rocblas_int* index_b = index + b_base * stride_index;
+        const T*           x_b     = x + b_base * stridex;
+        T*                 y_b     = y + b_base * stridey;
+
+        if(transA == rocblas_operation_none)
+        {
+            gemv_gathered_LAUNCH(false, false);
+        }
+        else if(transA == rocblas_operation_transpose)
+        {
+            gemv_gathered_LAUNCH(true, false);
+        }
+        else
+        {
+            gemv_gathered_LAUNCH(true, true);
+        }
+    }
+#undef gemv_gathered_LAUNCH
+#undef gemv_gathered_KARGS
+
+    return rocblas_status_success;
+}
+
 template <typename Ti, typename To>
 rocblas_status rocblas_gemv_check_numerics(const char*       function_name,
                                            rocblas_handle    handle,
@@ -1267,6 +1650,37 @@ INSTANTIATE_GEMV_BATCHED_TEMPLATE(rocblas_double_complex)
 
 #undef INSTANTIATE_GEMV_BATCHED_TEMPLATE
 
+#ifdef INSTANTIATE_GEMV_GATHERED_LAUNCHER
+#error INSTANTIATE_GEMV_GATHERED_LAUNCHER already defined
+#endif
+
+#define INSTANTIATE_GEMV_GATHERED_LAUNCHER(T_)                                 \
+    template rocblas_status rocblas_internal_gemv_gathered_launcher<T_>(       \
+        rocblas_handle     handle,                                             \
+        rocblas_operation  transA,                                             \
+        rocblas_int        m,                                                  \
+        rocblas_int        n,                                                  \
+        const T_*          alpha,                                              \
+        const T_*          A,                                                  \
+        int64_t            lda,                                                \
+        const rocblas_int* index,                                              \
+        rocblas_stride     stride_index,                                       \
+        const T_*          x,                                                  \
+        int64_t            incx,                                               \
+        rocblas_stride     stridex,                                            \
+        const T_*          beta,                                               \
+        T_*                y,                                                  \
+        int64_t            incy,                                               \
+        rocblas_stride     stridey,                                            \
+        rocblas_int        batch_count);
+
+INSTANTIATE_GEMV_GATHERED_LAUNCHER(float)
+INSTANTIATE_GEMV_GATHERED_LAUNCHER(double)
+INSTANTIATE_GEMV_GATHERED_LAUNCHER(rocblas_float_complex)
+INSTANTIATE_GEMV_GATHERED_LAUNCHER(rocblas_double_complex)
+
+#undef INSTANTIATE_GEMV_GATHERED_LAUNCHER
+
 // For mixed-precision gemv
 #ifdef INST_GEMV_MIXED_LAUNCHER
 #error INST_GEMV_MIXED_LAUNCHER already defined
@@ -0,0 +1,384 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "../blas1/rocblas_reduction.hpp"
+#include "handle.hpp"
+#include "int64_helpers.hpp"
+#include "logging.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_gemv_multi_name[] = "unknown";
+    template <>
+    constexpr char rocblas_gemv_multi_name<float>[] = "rocblas_sgemv_multi";
+    template <>
+    constexpr char rocblas_gemv_multi_name<double>[] = "rocblas_dgemv_multi";
+    template <>
+    constexpr char rocblas_gemv_multi_name<rocblas_float_complex>[] = "rocblas_cgemv_multi";
+    template <>
+    constexpr char rocblas_gemv_multi_name<rocblas_double_complex>[] = "rocblas_zgemv_multi";
+
+    // Vectors per thread block; each element of A loaded is applied to all of them
+    constexpr int ROCBLAS_GEMV_MULTI_KB = 8;
+
+    template <typename T>
+    __device__ void rocblas_gemv_multi_store(T alpha, T beta, T sum, T* y)
+    {
+        *y = beta == T(0) ? alpha * sum : alpha * sum + beta * *y;
+    }
+
+    // Y[:, j] = alpha * A * X[:, j] + beta * Y[:, j] for the KB vectors j of blockIdx.y.
+    // Each thread accumulates one row of the DIM_Y column slices of A, and the slices are
+    // summed through LDS.
+    template <int DIM_X, int DIM_Y, int KB, typename T, typename U>
+    ROCBLAS_KERNEL(DIM_X* DIM_Y)
+    rocblas_gemv_multi_n_kernel(rocblas_int m,
+                                rocblas_int n,
+                                rocblas_int k,
+                                U           alpha_device_host,
+                                const T*    A,
+                                int64_t     lda,
+                                const T*    X,
+                                int64_t     ldx,
+                                U           beta_device_host,
+                                T*          Y,
+                                int64_t     ldy)
+    {
+        __shared__ T sdata[DIM_Y][DIM_X];
+
+        auto alpha = load_scalar(alpha_device_host);
+        auto beta  = load_scalar(beta_device_host);
+        if(!alpha && beta == 1)
+            return;
+
+        int     tx     = threadIdx.x;
+        int     ty     = threadIdx.y;
+        int64_t row    = blockIdx.x * int64_t(DIM_X) + tx;
+        int64_t col0   = int64_t(blockIdx.y) * KB;
+        int     kb     = std::min(int64_t(KB), k - col0);
+        bool    active = row < m;
+
+        X += col0 * ldx;
+        Y += col0 * ldy;
+
+        T sums[KB];
+#pragma unroll
+        for(int c = 0; c < KB; c++)
+            sums[c] = T(0);
+
+        if(alpha && active)
+        {
+            for(rocblas_int j = ty; j < n; j += DIM_Y)
+            {
+                T a = A[j * lda + row];
+#pragma unroll
+                for(int c = 0; c < KB; c++)
+                    if(c < kb)
+                        sums[c] += a * X[c * ldx + j];
+            }
+        }
+
+#pragma unroll
+        for(int c = 0; c < KB; c++)
+        {
+            if(c < kb)
+            {
+                sdata[ty][tx] = sums[c];
+                __syncthreads();
+
+                if(ty == 0 && active)
+                {
+                    T sum = T(0);
+                    for(int i = 0; i < DIM_Y; i++)
+                        sum += sdata[i][tx];
+                    rocblas_gemv_multi_store(alpha, beta, sum, Y + c * ldy + row);
+                }
+                __syncthreads();
+            }
+        }
+    }
+
+    // Y[:, j] = alpha * op(A) * X[:, j] + beta * Y[:, j] for the KB vectors j of blockIdx.y,
+    // with op(A) = A**T or A**H. Each block reduces column blockIdx.x of A against the vectors.
+    template <bool CONJ, int NB, int KB, typename T, typename U>
+    ROCBLAS_KERNEL(NB)
+    rocblas_gemv_multi_t_kernel(rocblas_int m,
+                                rocblas_int k,
+                                U           alpha_device_host,
+                                const T*    A,
+                                int64_t     lda,
+                                const T*    X,
+                                int64_t     ldx,
+                                U           beta_device_host,
+                                T*          Y,
+                                int64_t     ldy)
+    {
+        auto alpha = load_scalar(alpha_device_host);
+        auto beta  = load_scalar(beta_device_host);
+        if(!alpha && beta == 1)
+            return;
+
+        int64_t col  = blockIdx.x;
+        int64_t col0 = int64_t(blockIdx.y) * KB;
+        int     kb   = std::min(int64_t(KB), k - col0);
+
+        A += col * lda;
+        X += col0 * ldx;
+        Y += col0 * ldy;
+
+        T sums[KB];
+#pragma unroll
+        for(int c = 0; c < KB; c++)
+            sums[c] = T(0);
+
+        if(alpha)
+        {
+            for(rocblas_int i = threadIdx.x; i < m; i += NB)
+            {
+                T a = CONJ ? conj(A[i]) : A[i];
+#pragma unroll
+                for(int c = 0; c < KB; c++)
+                    if(c < kb)
+                        sums[c] += a * X[c * ldx + i];
+            }
+        }
+
+#pragma unroll
+        for(int c = 0; c < KB; c++)
+        {
+            if(c < kb)
+            {
+                T sum = rocblas_dot_block_reduce<NB>(sums[c]);
+                if(threadIdx.x == 0)
+                    rocblas_gemv_multi_store(alpha, beta, sum, Y + c * ldy + col);
+            }
+        }
+    }
+
+    template <typename T, typename U>
+    rocblas_status rocblas_gemv_multi_launch(rocblas_handle    handle,
+                                             rocblas_operation transA,
+                                             rocblas_int       m,
+                                             rocblas_int       n,
+                                             rocblas_int       k,
+                                             U                 alpha,
+                                             const T*          A,
+                                             rocblas_int       lda,
+                                             const T*          X,
+                                             rocblas_int       ldx,
+                                             U                 beta,
+                                             T*                Y,
+                                             rocblas_int       ldy)
+    {
+        static constexpr int KB          = ROCBLAS_GEMV_MULTI_KB;
+        static constexpr int GEMVN_DIM_X = 64;
+        static constexpr int GEMVN_DIM_Y = 8;
+        static constexpr int GEMVT_NB    = 256;
+
+        hipStream_t rocblas_stream = handle->get_stream();
+
+        // each launch covers up to c_i64_grid_YZ_chunk groups of KB vectors
+        for(int64_t j_base = 0; j_base < k; j_base += c_i64_grid_YZ_chunk * KB)
+        {
+            rocblas_int k_chunk = rocblas_int(std::min(k - j_base, c_i64_grid_YZ_chunk * KB));
+            rocblas_int groups  = (k_chunk - 1) / KB + 1;
+
+            const T* Xj = X + j_base * ldx;
+            T*       Yj = Y + j_base * ldy;
+
+            if(transA == rocblas_operation_none)
+                ROCBLAS_LAUNCH_KERNEL(
+                    (rocblas_gemv_multi_n_kernel<GEMVN_DIM_X, GEMVN_DIM_Y, KB>),
+                    dim3((m - 1) / GEMVN_DIM_X + 1, groups),
+                    dim3(GEMVN_DIM_X, GEMVN_DIM_Y),
+                    0,
+                    rocblas_stream,
+                    m,
+                    n,
+                    k_chunk,
+                    alpha,
+                    A,
+                    lda,
+                    Xj,
+                    ldx,
+                    beta,
+                    Yj,
+                    ldy);
+            else if(transA == rocblas_operation_transpose)
+                ROCBLAS_LAUNCH_KERNEL((rocblas_gemv_multi_t_kernel<false, GEMVT_NB, KB>),
+                                      dim3(n, groups),
+                                      dim3(GEMVT_NB),
+                                      0,
+                                      rocblas_stream,
+                                      m,
+                                      k_chunk,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      Xj,
+                                      ldx,
+                                      beta,
+                                      Yj,
+                                      ldy);
+            else
+                ROCBLAS_LAUNCH_KERNEL((rocblas_gemv_multi_t_kernel<true, GEMVT_NB, KB>),
+                                      dim3(n, groups),
+                                      dim3(GEMVT_NB),
+                                      0,
+                                      rocblas_stream,
+                                      m,
+                                      k_chunk,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      Xj,
+                                      ldx,
+                                      beta,
+                                      Yj,
+                                      ldy);
+        }
+        return rocblas_status_success;
+    }
+
+    template <typename T>
+    rocblas_status rocblas_gemv_multi_impl(rocblas_handle    handle,
+                                           rocblas_operation transA,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           rocblas_int       k,
+                                           const T*          alpha,
+                                           const T*          A,
+                                           rocblas_int       lda,
+                                           const T*          X,
+                                           rocblas_int       ldx,
+                                           const T*          beta,
+                                           T*                Y,
+                                           rocblas_int       ldy)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // row major order, see rocblas_set_order, has no column major mapping here
+        RETURN_NOT_IMPLEMENTED_IF_ROW_MAJOR(handle);
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_gemv_multi_name<T>,
+                      transA,
+                      m,
+                      n,
+                      k,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      A,
+                      lda,
+                      X,
+                      ldx,
+                      LOG_TRACE_SCALAR_VALUE(handle, beta),
+                      Y,
+                      ldy);
+
+        if(transA != rocblas_operation_none && transA != rocblas_operation_transpose
+           && transA != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+
+        // X holds the k vectors of length n (or m), and Y the k results of length m (or n)
+        bool        none  = transA == rocblas_operation_none;
+        rocblas_int x_len = none ? n : m;
+        rocblas_int y_len = none ? m : n;
+        if(m < 0 || n < 0 || k < 0 || lda < std::max(m, 1) || ldx < std::max(x_len, 1)
+           || ldy < std::max(y_len, 1))
+            return rocblas_status_invalid_size;
+
+        if(!m || !n || !k)
+            return rocblas_status_success;
+
+        if(!alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+        {
+            if(!A || !X || !Y)
+                return rocblas_status_invalid_pointer;
+
+            return rocblas_gemv_multi_launch(
+                handle, transA, m, n, k, alpha, A, lda, X, ldx, beta, Y, ldy);
+        }
+
+        if(*alpha == 0 && *beta == 1)
+            return rocblas_status_success;
+
+        if(!Y || (*alpha != 0 && (!A || !X)))
+            return rocblas_status_invalid_pointer;
+
+        return rocblas_gemv_multi_launch(
+            handle, transA, m, n, k, *alpha, A, lda, X, ldx, *beta, Y, ldy);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(name_, T_)                                                                   \
+    rocblas_status name_(rocblas_handle    handle,                                        \
+                         rocblas_operation transA,                                        \
+                         rocblas_int       m,                                             \
+                         rocblas_int       n,                                             \
+                         rocblas_int       k,                                             \
+                         const T_*         alpha,                                         \
+                         const T_*         A,                                             \
+                         rocblas_int       lda,                                           \
+                         const T_*         X,                                             \
+                         rocblas_int       ldx,                                           \
+                         const T_*         beta,                                          \
+                         T_*               Y,                                             \
+                         rocblas_int       ldy)                                           \
+    try                                                                                   \
+    {                                                                                     \
+        return rocblas_gemv_multi_impl<T_>(                                               \
+            handle, transA, m, n, k, alpha, A, lda, X, ldx, beta, Y, ldy);                \
+    }                                                                                     \
+    catch(...)                                                                            \
+    {                                                                                     \
+        return exception_to_rocblas_status();                                             \
+    }
+
+extern "C" {
+
+IMPL(rocblas_sgemv_multi, float);
+IMPL(rocblas_dgemv_multi, double);
+IMPL(rocblas_cgemv_multi, rocblas_float_complex);
+IMPL(rocblas_zgemv_multi, rocblas_double_complex);
+
+} // extern "C"
+
+#undef IMPL
@@ -80,10 +80,23 @@ namespace
     {
         if(!handle)
             return rocblas_status_invalid_handle;
+
+        // row major A is column major A^T += alpha*y*x^T, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+        {
+            if(CONJ)
+                return rocblas_status_not_implemented;
+            std::swap(m, n);
+            std::swap(x, y);
+            std::swap(incx, incy);
+        }
+
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+
+        rocblas_api_scope api_scope(handle, rocblas_ger_batched_name<CONJ, T>);
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle,
                       rocblas_ger_batched_name<CONJ, T>,
@@ -118,7 +131,7 @@ namespace
                       "--batch_count",
                       batch_count);
 
-        if(layer_mode & rocblas_layer_mode_log_profile)
+        if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             log_profile(handle,
                         rocblas_ger_batched_name<CONJ, T>,
                         "M",
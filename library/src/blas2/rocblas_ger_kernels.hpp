@@ -97,6 +97,63 @@ rocblas_ger_kernel(rocblas_int    m,
     }
 }
 
+// Batched ger with m, n <= 64 and large batch_count updates whole matrices per row of a thread
+// block, with the batch in the x dimension of the grid, instead of one mostly idle grid each
+inline bool rocblas_ger_small_batched(int64_t m, int64_t n, int64_t batch_count)
+{
+    return m <= 64 && n <= 64 && batch_count >= 256;
+}
+
+// lane tx of row ty of the block updates row tx of A for problem blockIdx.x * NB_BATCH + ty
+template <rocblas_int DIM_X,
+          rocblas_int NB_BATCH,
+          bool        CONJ,
+          typename T,
+          typename V,
+          typename U,
+          typename W>
+ROCBLAS_KERNEL(DIM_X* NB_BATCH)
+rocblas_ger_small_batched_kernel(rocblas_int    m,
+                                 rocblas_int    n,
+                                 V              alpha_device_host,
+                                 rocblas_stride stride_alpha,
+                                 const U __restrict__ xa,
+                                 rocblas_stride shiftx,
+                                 int64_t        incx,
+                                 rocblas_stride stridex,
+                                 const U __restrict__ ya,
+                                 rocblas_stride shifty,
+                                 int64_t        incy,
+                                 rocblas_stride stridey,
+                                 W __restrict__ Aa,
+                                 rocblas_stride shifta,
+                                 size_t         lda,
+                                 rocblas_stride strideA,
+                                 rocblas_int    batch_count)
+{
+    const int      tx    = threadIdx.x;
+    const uint32_t batch = blockIdx.x * NB_BATCH + threadIdx.y;
+    if(batch >= batch_count || tx >= m)
+        return;
+
+    auto alpha = load_scalar(alpha_device_host, batch, stride_alpha);
+    if(!alpha)
+        return;
+
+    const T* __restrict__ x = load_ptr_batch(xa, batch, shiftx, stridex);
+    const T* __restrict__ y = load_ptr_batch(ya, batch, shifty, stridey);
+
+    T* __restrict__ A = load_ptr_batch(Aa, batch, shifta, strideA);
+
+    // the columns of A are updated coalesced, each element of y is read by all lanes at once
+    const T x_value = alpha * x[tx * incx];
+    for(rocblas_int j = 0; j < n; j++)
+    {
+        const T y_value = y[j * incy];
+        A[tx + lda * j] += x_value * (CONJ ? conj(y_value) : y_value);
+    }
+}
+
 //optimized kernel for SGER
 template <rocblas_int DIM_X, typename T, typename V, typename U, typename W>
 ROCBLAS_KERNEL(DIM_X)
@@ -289,8 +346,29 @@ rocblas_status rocblas_internal_ger_launcher(rocblas_handle handle,
     ger_grid, ger_threads, 0, rocblas_stream, m, n, alpha_, stride_alpha, x, shiftx, incx, \
         stridex, y, shifty, incy, stridey, A, offsetA, lda, strideA
 
+    if(rocblas_ger_small_batched(m, n, batch_count))
+    {
+        static constexpr int DIM_X    = 64;
+        static constexpr int NB_BATCH = 4;
+
+        dim3 ger_grid((batch_count - 1) / NB_BATCH + 1);
+        dim3 ger_threads(DIM_X, NB_BATCH);
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+        {
+            ROCBLAS_LAUNCH_KERNEL((rocblas_ger_small_batched_kernel<DIM_X, NB_BATCH, CONJ, T>),
+                                  ger_KARGS(alpha),
+                                  batch_count);
+        }
+        else
+        {
+            ROCBLAS_LAUNCH_KERNEL((rocblas_ger_small_batched_kernel<DIM_X, NB_BATCH, CONJ, T>),
+                                  ger_KARGS(*alpha),
+                                  batch_count);
+        }
+    }
     //optimized double buffered loads kernel for float, double and float_complex precisions in gfx90a
-    if(is_gfx90a && (m > 2000) && (m == n)
+    else if(is_gfx90a && (m > 2000) && (m == n)
        && ((m % 64 == 0 && (is_double || is_complex_float)) || ((m % 128 == 0) && is_float)))
     {
         //The following rocblas_ger_double_buffered_kernel is only valid for the multiples of DIM_X
@@ -0,0 +1,187 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "../blas3/rocblas_gemm.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas_ger.hpp"
+
+namespace
+{
+    template <bool, typename>
+    constexpr char rocblas_ger_multi_name[] = "unknown";
+    template <>
+    constexpr char rocblas_ger_multi_name<false, float>[] = "rocblas_sger_multi";
+    template <>
+    constexpr char rocblas_ger_multi_name<false, double>[] = "rocblas_dger_multi";
+    template <>
+    constexpr char rocblas_ger_multi_name<false, rocblas_float_complex>[] = "rocblas_cgeru_multi";
+    template <>
+    constexpr char rocblas_ger_multi_name<false, rocblas_double_complex>[] = "rocblas_zgeru_multi";
+    template <>
+    constexpr char rocblas_ger_multi_name<true, rocblas_float_complex>[] = "rocblas_cgerc_multi";
+    template <>
+    constexpr char rocblas_ger_multi_name<true, rocblas_double_complex>[] = "rocblas_zgerc_multi";
+
+    template <bool CONJ, typename T>
+    rocblas_status rocblas_ger_multi_impl(rocblas_handle handle,
+                                          rocblas_int    m,
+                                          rocblas_int    n,
+                                          rocblas_int    k,
+                                          const T*       alpha,
+                                          const T*       X,
+                                          rocblas_int    ldx,
+                                          const T*       Y,
+                                          rocblas_int    ldy,
+                                          T*             A,
+                                          rocblas_int    lda)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // row major order, see rocblas_set_order, has no column major mapping here
+        RETURN_NOT_IMPLEMENTED_IF_ROW_MAJOR(handle);
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_ger_multi_name<CONJ, T>,
+                      m,
+                      n,
+                      k,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      X,
+                      ldx,
+                      Y,
+                      ldy,
+                      A,
+                      lda);
+
+        if(m < 0 || n < 0 || k < 0 || ldx < std::max(m, 1) || ldy < std::max(n, 1)
+           || lda < std::max(m, 1))
+            return rocblas_status_invalid_size;
+
+        if(!m || !n || !k)
+            return rocblas_status_success;
+
+        if(!alpha)
+            return rocblas_status_invalid_pointer;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host && *alpha == 0)
+            return rocblas_status_success;
+
+        if(!A || !X || !Y)
+            return rocblas_status_invalid_pointer;
+
+        // a single update is left to the ger kernels, which need no copy of a device alpha
+        if(k == 1)
+        {
+            if constexpr(CONJ)
+                return rocblas_internal_gerc_template(
+                    handle, m, n, alpha, 0, X, 0, 1, 0, Y, 0, 1, 0, A, 0, lda, 0, 1);
+            else
+                return rocblas_internal_ger_template(
+                    handle, m, n, alpha, 0, X, 0, 1, 0, Y, 0, 1, 0, A, 0, lda, 0, 1);
+        }
+
+        // A = alpha * X * op( Y ) + A reads and writes A once for all k updates
+        T        alpha_h, beta_h;
+        const T* beta = nullptr;
+        RETURN_IF_ROCBLAS_ERROR(
+            rocblas_copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, k));
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        if(*alpha == 0)
+            return rocblas_status_success;
+
+        const T one(1);
+        return rocblas_internal_gemm_template(handle,
+                                              rocblas_operation_none,
+                                              CONJ ? rocblas_operation_conjugate_transpose
+                                                   : rocblas_operation_transpose,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              X,
+                                              0,
+                                              ldx,
+                                              0,
+                                              Y,
+                                              0,
+                                              ldy,
+                                              0,
+                                              &one,
+                                              A,
+                                              0,
+                                              lda,
+                                              0,
+                                              1);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(name_, CONJ_, T_)                                                                \
+    rocblas_status name_(rocblas_handle handle,                                               \
+                         rocblas_int    m,                                                    \
+                         rocblas_int    n,                                                    \
+                         rocblas_int    k,                                                    \
+                         const T_*      alpha,                                                \
+                         const T_*      X,                                                    \
+                         rocblas_int    ldx,                                                  \
+                         const T_*      Y,                                                    \
+                         rocblas_int    ldy,                                                  \
+                         T_*            A,                                                    \
+                         rocblas_int    lda)                                                  \
+    try                                                                                       \
+    {                                                                                         \
+        return rocblas_ger_multi_impl<CONJ_, T_>(                                             \
+            handle, m, n, k, alpha, X, ldx, Y, ldy, A, lda);                                  \
+    }                                                                                         \
+    catch(...)                                                                                \
+    {                                                                                         \
+        return exception_to_rocblas_status();                                                 \
+    }
+
+extern "C" {
+
+IMPL(rocblas_sger_multi, false, float);
+IMPL(rocblas_dger_multi, false, double);
+IMPL(rocblas_cgeru_multi, false, rocblas_float_complex);
+IMPL(rocblas_zgeru_multi, false, rocblas_double_complex);
+IMPL(rocblas_cgerc_multi, true, rocblas_float_complex);
+IMPL(rocblas_zgerc_multi, true, rocblas_double_complex);
+
+} // extern "C"
+
+#undef IMPL
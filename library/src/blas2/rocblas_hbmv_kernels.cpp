@@ -22,82 +22,16 @@
 
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
+#include "rocblas_band_device.hpp"
 #include "rocblas_hbmv.hpp"
 
-/**
-  *  Helper for the non-transpose case. Iterates through each diagonal
-  *  and creates partial sums for each ty.
-  */
-template <rocblas_int DIM_Y, typename T>
-__device__ T rocblas_hbmvn_kernel_helper(rocblas_int ty,
-                                         rocblas_int ind,
-                                         bool        is_upper,
-                                         rocblas_int m,
-                                         rocblas_int k,
-                                         const T*    A,
-                                         int64_t     lda,
-                                         const T*    x,
-                                         int64_t     incx)
-{
-    T           res_A = 0.0;
-    rocblas_int col;
-
-    // Since the column is consistent, we can iterate up the diagonal
-    // ty defines the column of banded & regular matrix
-    for(col = ty; col < m; col += DIM_Y)
-    {
-        // We have to convert ind to banded matrix row
-        rocblas_int row = is_upper ? ind + (k - col) : ind - col;
-
-        if(ind < m)
-        {
-            if((ind <= col && is_upper) || (ind >= col && !is_upper))
-            {
-                // in is_upper/lower triangular part
-                if(row < k && row > 0)
-                {
-                    // not on main diagonal, simply multiply
-                    res_A += (A[row + col * size_t(lda)] * x[col * incx]);
-                }
-                else if(row == 0)
-                {
-                    // cppcheck-suppress knownConditionTrueFalse
-                    // If main diagonal, assume 0 imaginary part.
-                    if(!is_upper || (k == 0 && is_upper))
-                        res_A += (std::real(A[row + col * size_t(lda)]) * x[col * incx]);
-                    else
-                        res_A += (A[row + col * size_t(lda)] * x[col * incx]);
-                }
-                else if(row == k)
-                {
-                    // If main diagonal, assume 0 imaginary part.
-                    if(is_upper)
-                        res_A += (std::real(A[row + col * size_t(lda)]) * x[col * incx]);
-                    else
-                        res_A += (A[row + col * size_t(lda)] * x[col * incx]);
-                }
-            }
-            else
-            {
-                // in the opposite triangle, get conjugate of value at transposed position
-                rocblas_int trans_row = col;
-                rocblas_int trans_col = ind;
-                trans_row = is_upper ? trans_row + (k - trans_col) : trans_row - trans_col;
-                if(trans_row <= k && trans_row >= 0)
-                {
-                    res_A += (conj(A[trans_row + trans_col * size_t(lda)]) * x[col * incx]);
-                }
-            }
-        }
-    }
-    return res_A;
-}
-
 /**
   *  Computes y := alpha*A*x + beta*y where A is a Hermitian matrix.
   *  If uplo == upper, the strictly lower part of A is not referenced,
   *  if uplo == lower, the strictly upper part of A is not referenced.
   *  The imaginary part of the main diagonal is assumed to always be == 0.
+  *  Each thread block computes DIM_X elements of y: the strict stored triangle is applied
+  *  along its rows, and conjugated along its columns for the mirrored triangle.
   */
 template <rocblas_int DIM_X, rocblas_int DIM_Y, typename T>
 __device__ void rocblas_hbmvn_kernel_calc(bool        is_upper,
@@ -112,39 +46,28 @@ __device__ void rocblas_hbmvn_kernel_calc(bool        is_upper,
                                           T*          y,
                                           int64_t     incy)
 {
-    rocblas_int  thread_id = threadIdx.x + threadIdx.y * blockDim.x;
-    __shared__ T sdata[DIM_X * DIM_Y];
+    rocblas_int ind   = blockIdx.x * DIM_X + threadIdx.x;
+    T           res_A = T(0);
 
     if(alpha)
     {
-        // threads are all configurated locally
-        rocblas_int ty  = thread_id / DIM_X;
-        rocblas_int tx  = thread_id % DIM_X;
-        rocblas_int ind = blockIdx.x * DIM_X + tx;
-        sdata[tx + ty * DIM_X]
-            = rocblas_hbmvn_kernel_helper<DIM_Y>(ty, ind, is_upper, n, k, A, lda, x, incx);
-        __syncthreads();
-    }
+        // the main diagonal is on stored row k of upper and row 0 of lower band storage
+        rocblas_int off     = is_upper ? k : 0;
+        rocblas_int d_begin = is_upper ? 0 : 1;
+        rocblas_int d_end   = is_upper ? k : k + 1;
 
-    if(thread_id < DIM_X)
-    {
-        rocblas_int ind = blockIdx.x * DIM_X + thread_id;
-
-        if(alpha)
-        {
-            for(rocblas_int i = 1; i < DIM_Y; i++)
-                sdata[thread_id] += sdata[thread_id + DIM_X * i];
-
-            if(ind < n)
-                y[ind * incy] = beta ? alpha * sdata[thread_id] + beta * y[ind * incy]
-                                     : alpha * sdata[thread_id];
-        }
-        else
-        {
-            if(ind < n)
-                y[ind * incy] = beta ? y[ind * incy] * beta : 0;
-        }
+        res_A = rocblas_band_rows_tile<DIM_X, DIM_Y>(n, n, off, d_begin, d_end, A, lda, x, incx);
+        res_A += rocblas_band_cols_tile<DIM_X, DIM_Y, true>(
+            n, n, off, d_begin, d_end, A, lda, x, incx);
+
+        if(threadIdx.y == 0 && ind < n)
+            res_A += std::real(A[off + ind * lda]) * x[ind * incx];
+
+        res_A = rocblas_band_tile_sum<DIM_X, DIM_Y>(res_A) * alpha;
     }
+
+    if(threadIdx.y == 0 && ind < n)
+        y[ind * incy] = beta ? res_A + beta * y[ind * incy] : res_A;
 }
 
 /**
@@ -226,9 +149,8 @@ rocblas_status rocblas_internal_hbmv_launcher(rocblas_handle handle,
     auto shiftx = incx < 0 ? offsetx - incx * (n - 1) : offsetx;
     auto shifty = incy < 0 ? offsety - incy * (n - 1) : offsety;
 
-    // hbmvN_DIM_Y must be at least 4, 8 * 8 is very slow only 40Gflop/s
-    static constexpr int hbmvN_DIM_X = 64;
-    static constexpr int hbmvN_DIM_Y = 16;
+    static constexpr int hbmvN_DIM_X = 32;
+    static constexpr int hbmvN_DIM_Y = 8;
     rocblas_int          blocks      = (n - 1) / (hbmvN_DIM_X) + 1;
     dim3                 hbmvn_grid(blocks, batch_count);
     dim3                 hbmvn_threads(hbmvN_DIM_X, hbmvN_DIM_Y);
@@ -57,13 +57,19 @@ namespace
     {
         if(!handle)
             return rocblas_status_invalid_handle;
+
+        // row major Hermitian A is column major conj(A), see rocblas_set_order
+        RETURN_NOT_IMPLEMENTED_IF_ROW_MAJOR(handle);
+
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+
+        rocblas_api_scope api_scope(handle, rocblas_hbmv_name<T>);
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-              | rocblas_layer_mode_log_profile))
+              | rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
         {
             auto uplo_letter = rocblas_fill_letter(uplo);
 
@@ -113,7 +119,7 @@ namespace
                           "--batch_count",
                           batch_count);
 
-            if(layer_mode & rocblas_layer_mode_log_profile)
+            if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                 log_profile(handle,
                             rocblas_hbmv_name<T>,
                             "uplo",
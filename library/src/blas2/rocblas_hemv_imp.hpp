@@ -53,14 +53,18 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        // row major Hermitian A is column major conj(A), see rocblas_set_order
+        RETURN_NOT_IMPLEMENTED_IF_ROW_MAJOR(handle);
+
         auto check_numerics = handle->check_numerics;
 
+        rocblas_api_scope api_scope(handle, rocblas_hemv_name<T>);
         if(!handle->is_device_memory_size_query())
         {
             auto layer_mode = handle->layer_mode;
             if(layer_mode
                & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-                  | rocblas_layer_mode_log_profile))
+                  | rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             {
                 auto uplo_letter = rocblas_fill_letter(uplo);
 
@@ -95,7 +99,7 @@ namespace
                               "--incy",
                               incy);
 
-                if(layer_mode & rocblas_layer_mode_log_profile)
+                if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                     log_profile(handle,
                                 rocblas_hemv_name<T>,
                                 "uplo",
@@ -116,7 +120,7 @@ namespace
         if(arg_status != rocblas_status_continue)
             return arg_status;
 
-        size_t dev_bytes = rocblas_internal_hemv_symv_kernel_workspace_size<T>(n);
+        size_t dev_bytes = rocblas_hemv_symv_workspace_size<T>(handle, uplo, n);
         if(handle->is_device_memory_size_query())
             return handle->set_optimal_device_memory_size(dev_bytes);
 
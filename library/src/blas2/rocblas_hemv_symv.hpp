@@ -23,6 +23,7 @@
 #pragma once
 
 #include "handle.hpp"
+#include "rocblas_level2_threshold.hpp"
 
 /*! \brief rocblas_internal_hemv_kernel_workspace_size
     workspace buffer for column reductions: number of blocks * cols * batch_count
@@ -41,6 +42,47 @@ template <typename To>
 ROCBLAS_INTERNAL_EXPORT_NOINLINE size_t
     rocblas_internal_hemv_symv_kernel_workspace_size(rocblas_int n, rocblas_int batch_count = 1);
 
+/*! \brief rocblas_hemv_symv_double_buffered
+    true when the double buffered kernels, which accumulate into y with atomics, compute
+    hemv/symv of order n for the architecture of the handle
+    ********************************************************************/
+template <typename T>
+inline bool rocblas_hemv_symv_double_buffered(rocblas_handle handle, rocblas_fill uplo, int64_t n)
+{
+    static constexpr int precision
+        = rocblas_level2_precision(std::is_same_v<T, float>,
+                                   std::is_same_v<T, double>,
+                                   std::is_same_v<T, rocblas_float_complex>,
+                                   std::is_same_v<T, rocblas_double_complex>);
+
+    if(handle->atomics_mode != rocblas_atomics_allowed)
+        return false;
+
+    const rocblas_level2_thresholds& thresholds = rocblas_level2_get_thresholds(handle);
+    if(uplo == rocblas_fill_upper)
+        return n % 32 == 0 ? n < thresholds.symv_U_aligned[precision]
+                           : n < thresholds.symv_U_unaligned_upper[precision]
+                                 || n > thresholds.symv_U_unaligned_lower[precision];
+    else
+        return n % 32 == 0 ? n < thresholds.symv_L_aligned[precision]
+                           : n < thresholds.symv_L_unaligned_upper[precision]
+                                 || n > thresholds.symv_L_unaligned_lower[precision];
+}
+
+/*! \brief rocblas_hemv_symv_workspace_size
+    workspace buffer of hemv/symv, none when the double buffered kernels are used
+    ********************************************************************/
+template <typename To>
+inline size_t rocblas_hemv_symv_workspace_size(rocblas_handle handle,
+                                               rocblas_fill   uplo,
+                                               rocblas_int    n,
+                                               rocblas_int    batch_count = 1)
+{
+    return rocblas_hemv_symv_double_buffered<To>(handle, uplo, n)
+               ? 0
+               : rocblas_internal_hemv_symv_kernel_workspace_size<To>(n, batch_count);
+}
+
 template <typename API_INT, typename TScal, typename TConstPtr, typename TPtr>
 inline rocblas_status rocblas_hemv_symv_arg_check(rocblas_handle handle,
                                                   rocblas_fill   uplo,
@@ -110,6 +110,27 @@ ROCBLAS_KERNEL_ILF void hemv_zero_imaginary(rocblas_complex_num<T>& a)
     a.imag(0);
 }
 
+template <bool IS_HEMV, typename T>
+ROCBLAS_KERNEL_ILF T hemv_conj_if(const T& a)
+{
+    return IS_HEMV ? conj(a) : a;
+}
+
+/** atomicAdd of complex values adds the real and imaginary parts separately */
+template <typename T>
+ROCBLAS_KERNEL_ILF void hemv_atomic_add(T* y, T a)
+{
+    atomicAdd(y, a);
+}
+
+template <typename T>
+ROCBLAS_KERNEL_ILF void hemv_atomic_add(rocblas_complex_num<T>* y, rocblas_complex_num<T> a)
+{
+    T* y_ri = reinterpret_cast<T*>(y);
+    atomicAdd(y_ri, a.real());
+    atomicAdd(y_ri + 1, a.imag());
+}
+
 // treats sA as 16x64 block
 #define sA16(i_, j_) (sA[(i_)][(j_)]) // i.e., sA[ (i_)*(NB_X+3) + (j_) ]
 
@@ -1180,7 +1201,7 @@ rocblas_hemvn_kernel_lower_block_sum(rocblas_int    n,
 }
 // end hemvn_kernel_lower_block_sum_calc
 
-template <rocblas_int DIM_X, rocblas_int DIM_Y, typename T>
+template <bool IS_HEMV, rocblas_int DIM_X, rocblas_int DIM_Y, typename T>
 ROCBLAS_KERNEL_ILF void
     rocblas_symv_kernel_upper_double_buffered_diagonal_calc(rocblas_int n,
                                                             T           alpha,
@@ -1255,16 +1276,21 @@ ROCBLAS_KERNEL_ILF void
 #pragma unroll
     for(int j = 0; j < (DIM_X / 2); j += DIM_Y)
         if(abs(tx - ty) > (j + (DIM_X / 2)))
-            la[DIM_X * ((DIM_X / 2) + j + ty) + tx] = la[DIM_X * tx + (DIM_X / 2) + j + ty];
+            la[DIM_X * ((DIM_X / 2) + j + ty) + tx]
+                = hemv_conj_if<IS_HEMV>(la[DIM_X * tx + (DIM_X / 2) + j + ty]);
 
     // mirror first chunk
-    if(ty <= tx)
-        la[td] = la[tx * DIM_X + ty];
+    if(ty < tx)
+        la[td] = hemv_conj_if<IS_HEMV>(la[tx * DIM_X + ty]);
 
 #pragma unroll
     for(int j = DIM_Y; j < (DIM_X / 2); j += DIM_Y)
         if(abs(tx - ty) > j)
-            la[tx + (ty + j) * DIM_X] = la[ty + j + tx * DIM_X];
+            la[tx + (ty + j) * DIM_X] = hemv_conj_if<IS_HEMV>(la[ty + j + tx * DIM_X]);
+
+    //The main diagonal of matrix A should be real
+    if(IS_HEMV && ty == 0)
+        hemv_zero_imaginary(la[tx * (DIM_X + 1)]);
 
     __syncthreads();
 
@@ -1297,7 +1323,11 @@ ROCBLAS_KERNEL_ILF void
     }
 }
 
-template <rocblas_int DIM_X, rocblas_int DIM_Y, rocblas_int elements_per_thread, typename T>
+template <bool        IS_HEMV,
+          rocblas_int DIM_X,
+          rocblas_int DIM_Y,
+          rocblas_int elements_per_thread,
+          typename T>
 ROCBLAS_KERNEL_ILF void
     rocblas_symv_kernel_upper_double_buffered_non_diagonal_calc(rocblas_int n,
                                                                 T           alpha,
@@ -1389,7 +1419,7 @@ ROCBLAS_KERNEL_ILF void
         for(int k = 0; k < elements_per_thread; k++)
         {
             res_1_ += A_reg_upper[k] * xbuff[ty_ * elements_per_thread + k];
-            treg[k] += A_reg_upper[k] * x1;
+            treg[k] += hemv_conj_if<IS_HEMV>(A_reg_upper[k]) * x1;
         }
 
         // Advance to next block in A
@@ -1410,7 +1440,7 @@ ROCBLAS_KERNEL_ILF void
         for(int k = 0; k < elements_per_thread; k++)
         {
             res_2_ += A_reg_lower[k] * xbuff[ty_ * elements_per_thread + k];
-            treg[k] += A_reg_lower[k] * x2;
+            treg[k] += hemv_conj_if<IS_HEMV>(A_reg_lower[k]) * x2;
         }
 
         // Horizontal block should be stored in global memory
@@ -1426,7 +1456,7 @@ ROCBLAS_KERNEL_ILF void
                 res_1_ += accum[k * DIM_X + tx];
 
             // use atomics
-            atomicAdd(&ycopy[tx * incy], res_1_ * alpha);
+            hemv_atomic_add(&ycopy[tx * incy], res_1_ * alpha);
             ycopy += DIM_X * incy;
         }
     } // end of for loop on blocks
@@ -1445,11 +1475,11 @@ ROCBLAS_KERNEL_ILF void
             treg[0] += la[tx * (DIM_X / 2) + (k % (DIM_X / 2))];
 
         // use atomics
-        atomicAdd(&y[tx * incy], treg[0] * alpha);
+        hemv_atomic_add(&y[tx * incy], treg[0] * alpha);
     }
 }
 
-template <rocblas_int DIM_X, rocblas_int DIM_Y, typename T>
+template <bool IS_HEMV, rocblas_int DIM_X, rocblas_int DIM_Y, typename T>
 ROCBLAS_KERNEL_ILF void
     rocblas_symv_kernel_upper_double_buffered_diagonal_generic_calc(rocblas_int n,
                                                                     T           alpha,
@@ -1543,16 +1573,21 @@ ROCBLAS_KERNEL_ILF void
     for(int j = 0; j < (DIM_X / 2); j += DIM_Y)
         if(abs(tx - ty) > (j + (DIM_X / 2)))
             la_shared[DIM_X * ((DIM_X / 2) + j + ty) + tx]
-                = la_shared[DIM_X * tx + (DIM_X / 2) + j + ty];
+                = hemv_conj_if<IS_HEMV>(la_shared[DIM_X * tx + (DIM_X / 2) + j + ty]);
 
     // mirror elements in first chunk
-    if(ty <= tx)
-        la_shared[td] = la_shared[tx * DIM_X + ty];
+    if(ty < tx)
+        la_shared[td] = hemv_conj_if<IS_HEMV>(la_shared[tx * DIM_X + ty]);
 
 #pragma unroll
     for(int j = DIM_Y; j < (DIM_X / 2); j += DIM_Y)
         if(abs(tx - ty) > j)
-            la_shared[tx + (ty + j) * DIM_X] = la_shared[ty + j + tx * DIM_X];
+            la_shared[tx + (ty + j) * DIM_X]
+                = hemv_conj_if<IS_HEMV>(la_shared[ty + j + tx * DIM_X]);
+
+    //The main diagonal of matrix A should be real
+    if(IS_HEMV && ty == 0)
+        hemv_zero_imaginary(la_shared[tx * (DIM_X + 1)]);
 
     __syncthreads();
 
@@ -1586,7 +1621,8 @@ ROCBLAS_KERNEL_ILF void
     }
 }
 
-template <rocblas_int DIM_X,
+template <bool        IS_HEMV,
+          rocblas_int DIM_X,
           rocblas_int DIM_Y,
           rocblas_int elements_per_thread,
           rocblas_int irregular_part,
@@ -1739,7 +1775,7 @@ ROCBLAS_KERNEL_ILF void rocblas_symv_kernel_upper_double_buffered_non_diagonal_g
         for(int k = 0; k < elements_per_thread; k++)
         {
             res_1_ += A_reg_upper[k] * x_buff_shared[ty_ * elements_per_thread + k];
-            treg[k] += A_reg_upper[k] * x1;
+            treg[k] += hemv_conj_if<IS_HEMV>(A_reg_upper[k]) * x1;
         }
 
         // Advance to next block
@@ -1777,7 +1813,7 @@ ROCBLAS_KERNEL_ILF void rocblas_symv_kernel_upper_double_buffered_non_diagonal_g
         for(int k = 0; k < elements_per_thread; k++)
         {
             res_2_ += A_reg_lower[k] * x_buff_shared[ty_ * elements_per_thread + k];
-            treg[k] += A_reg_lower[k] * x2;
+            treg[k] += hemv_conj_if<IS_HEMV>(A_reg_lower[k]) * x2;
         }
 
         // Horizontal block should be stored in global memory
@@ -1794,7 +1830,7 @@ ROCBLAS_KERNEL_ILF void rocblas_symv_kernel_upper_double_buffered_non_diagonal_g
                 res_1_ += accum_shared[k * DIM_X + tx];
 
             // use atomics
-            atomicAdd(&ycopy[tx * incy], res_1_ * alpha);
+            hemv_atomic_add(&ycopy[tx * incy], res_1_ * alpha);
             ycopy += DIM_X * incy;
         }
     } // end of for loop on blocks
@@ -1814,11 +1850,11 @@ ROCBLAS_KERNEL_ILF void rocblas_symv_kernel_upper_double_buffered_non_diagonal_g
 
         // use atomics
         if(tx < n_mod_DIM_X || bx < gridDim.x - 1)
-            atomicAdd(&y[tx * incy], treg[0] * alpha);
+            hemv_atomic_add(&y[tx * incy], treg[0] * alpha);
     }
 }
 
-template <rocblas_int DIM_X, rocblas_int DIM_Y, typename T>
+template <bool IS_HEMV, rocblas_int DIM_X, rocblas_int DIM_Y, typename T>
 ROCBLAS_KERNEL_ILF void
     rocblas_symv_kernel_lower_double_buffered_diagonal_calc(rocblas_int n,
                                                             T           alpha,
@@ -1892,18 +1928,23 @@ ROCBLAS_KERNEL_ILF void
 
     // mirror necessary elements in first chunk
     if(ty > tx)
-        la[td] = la[tx * DIM_X + ty];
+        la[td] = hemv_conj_if<IS_HEMV>(la[tx * DIM_X + ty]);
 
 #pragma unroll
     for(int k = DIM_Y; k < (DIM_X / 2); k += DIM_Y)
         if(abs(tx - ty) < k)
-            la[tx + (ty + k) * DIM_X] = la[ty + k + tx * DIM_X];
+            la[tx + (ty + k) * DIM_X] = hemv_conj_if<IS_HEMV>(la[ty + k + tx * DIM_X]);
 
 // mirror second chunk
 #pragma unroll
     for(int k = 0; k < (DIM_X / 2); k += DIM_Y)
         if(abs(tx - ty) < (k + (DIM_X / 2)))
-            la[DIM_X * ((DIM_X / 2) + k + ty) + tx] = la[DIM_X * tx + (DIM_X / 2) + k + ty];
+            la[DIM_X * ((DIM_X / 2) + k + ty) + tx]
+                = hemv_conj_if<IS_HEMV>(la[DIM_X * tx + (DIM_X / 2) + k + ty]);
+
+    //The main diagonal of matrix A should be real
+    if(IS_HEMV && ty == 0)
+        hemv_zero_imaginary(la[tx * (DIM_X + 1)]);
 
     __syncthreads();
 
@@ -1936,7 +1977,11 @@ ROCBLAS_KERNEL_ILF void
     }
 }
 
-template <rocblas_int DIM_X, rocblas_int DIM_Y, rocblas_int elements_per_thread, typename T>
+template <bool        IS_HEMV,
+          rocblas_int DIM_X,
+          rocblas_int DIM_Y,
+          rocblas_int elements_per_thread,
+          typename T>
 ROCBLAS_KERNEL_ILF void
     rocblas_symv_kernel_lower_double_buffered_non_diagonal_calc(rocblas_int n,
                                                                 T           alpha,
@@ -2033,7 +2078,7 @@ ROCBLAS_KERNEL_ILF void
         for(int k = 0; k < elements_per_thread; k++)
         {
             res_1_ += A_reg_upper[k] * xbuff[ty_ * elements_per_thread + k];
-            treg[k] += A_reg_upper[k] * x1;
+            treg[k] += hemv_conj_if<IS_HEMV>(A_reg_upper[k]) * x1;
         }
 
         A += DIM_X;
@@ -2052,7 +2097,7 @@ ROCBLAS_KERNEL_ILF void
         for(int k = 0; k < elements_per_thread; k++)
         {
             res_2_ += A_reg_lower[k] * xbuff[ty_ * elements_per_thread + k];
-            treg[k] += A_reg_lower[k] * x2;
+            treg[k] += hemv_conj_if<IS_HEMV>(A_reg_lower[k]) * x2;
         }
 
         // Horizontal block should be stored in global memory
@@ -2069,7 +2114,7 @@ ROCBLAS_KERNEL_ILF void
                 res_1_ += accum[k * DIM_X + tx];
 
             // use atomics
-            atomicAdd(&ycopy[tx * incy], res_1_ * alpha);
+            hemv_atomic_add(&ycopy[tx * incy], res_1_ * alpha);
         }
     }
 
@@ -2090,12 +2135,12 @@ ROCBLAS_KERNEL_ILF void
                 treg[0] += la[tx * (DIM_X / 2) + (k % (DIM_X / 2))];
 
             // use atomics
-            atomicAdd(&y[tx * incy], treg[0] * alpha);
+            hemv_atomic_add(&y[tx * incy], treg[0] * alpha);
         }
     }
 }
 
-template <rocblas_int DIM_X, rocblas_int DIM_Y, typename T>
+template <bool IS_HEMV, rocblas_int DIM_X, rocblas_int DIM_Y, typename T>
 ROCBLAS_KERNEL_ILF void
     rocblas_symv_kernel_lower_double_buffered_diagonal_generic_calc(rocblas_int n,
                                                                     T           alpha,
@@ -2208,19 +2253,24 @@ ROCBLAS_KERNEL_ILF void
 
     // mirror necessary elements in first chunk
     if(ty > tx)
-        la_shared[td] = la_shared[tx * DIM_X + ty];
+        la_shared[td] = hemv_conj_if<IS_HEMV>(la_shared[tx * DIM_X + ty]);
 
 #pragma unroll
     for(int j = DIM_Y; j < (DIM_X / 2); j += DIM_Y)
         if(abs(tx - ty) < j)
-            la_shared[tx + (ty + j) * DIM_X] = la_shared[ty + j + tx * DIM_X];
+            la_shared[tx + (ty + j) * DIM_X]
+                = hemv_conj_if<IS_HEMV>(la_shared[ty + j + tx * DIM_X]);
 
 // mirror second chunk
 #pragma unroll
     for(int j = 0; j < (DIM_X / 2); j += DIM_Y)
         if(abs(tx - ty) < (j + (DIM_X / 2)))
             la_shared[DIM_X * ((DIM_X / 2) + j + ty) + tx]
-                = la_shared[DIM_X * tx + (DIM_X / 2) + j + ty];
+                = hemv_conj_if<IS_HEMV>(la_shared[DIM_X * tx + (DIM_X / 2) + j + ty]);
+
+    //The main diagonal of matrix A should be real
+    if(IS_HEMV && ty == 0)
+        hemv_zero_imaginary(la_shared[tx * (DIM_X + 1)]);
 
     __syncthreads();
 
@@ -2260,7 +2310,11 @@ ROCBLAS_KERNEL_ILF void
     }
 }
 
-template <rocblas_int DIM_X, rocblas_int DIM_Y, rocblas_int elements_per_thread, typename T>
+template <bool        IS_HEMV,
+          rocblas_int DIM_X,
+          rocblas_int DIM_Y,
+          rocblas_int elements_per_thread,
+          typename T>
 ROCBLAS_KERNEL_ILF void rocblas_symv_kernel_lower_double_buffered_non_diagonal_generic_calc(
     rocblas_int n,
     T           alpha,
@@ -2364,7 +2418,7 @@ ROCBLAS_KERNEL_ILF void rocblas_symv_kernel_lower_double_buffered_non_diagonal_g
         for(int k = 0; k < elements_per_thread; k++)
         {
             res_1_ += A_reg_upper[k] * x_buff_shared[ty_ * elements_per_thread + k];
-            treg[k] += A_reg_upper[k] * x1;
+            treg[k] += hemv_conj_if<IS_HEMV>(A_reg_upper[k]) * x1;
         }
 
         A += DIM_X;
@@ -2385,7 +2439,7 @@ ROCBLAS_KERNEL_ILF void rocblas_symv_kernel_lower_double_buffered_non_diagonal_g
         for(int k = 0; k < elements_per_thread; k++)
         {
             res_2_ += A_reg_lower[k] * x_buff_shared[ty_ * elements_per_thread + k];
-            treg[k] += A_reg_lower[k] * x2;
+            treg[k] += hemv_conj_if<IS_HEMV>(A_reg_lower[k]) * x2;
         }
 
         // Horizontal block should be stored in global memory
@@ -2402,7 +2456,7 @@ ROCBLAS_KERNEL_ILF void rocblas_symv_kernel_lower_double_buffered_non_diagonal_g
                 res_1_ += accum_shared[k * DIM_X + tx];
 
             // use atomics
-            atomicAdd(&ycopy[tx * incy], res_1_ * alpha);
+            hemv_atomic_add(&ycopy[tx * incy], res_1_ * alpha);
         }
     } // end of for loop on blocks
 
@@ -2445,14 +2499,14 @@ ROCBLAS_KERNEL_ILF void rocblas_symv_kernel_lower_double_buffered_non_diagonal_g
         for(int k = 0; k < elements_per_thread; k++)
         {
             res_1_ += A_reg_upper[k] * x_buff_shared[ty_ * elements_per_thread + k];
-            treg[k] += A_reg_upper[k] * x1;
+            treg[k] += hemv_conj_if<IS_HEMV>(A_reg_upper[k]) * x1;
         }
 
 #pragma unroll
         for(int k = 0; k < elements_per_thread; k++)
         {
             res_2_ += A_reg_lower[k] * x_buff_shared[ty_ * elements_per_thread + k];
-            treg[k] += A_reg_lower[k] * x2;
+            treg[k] += hemv_conj_if<IS_HEMV>(A_reg_lower[k]) * x2;
         }
 
         // Horizontal block reduction
@@ -2470,7 +2524,7 @@ ROCBLAS_KERNEL_ILF void rocblas_symv_kernel_lower_double_buffered_non_diagonal_g
 
             // use atomics
             if(tx < n_mod_DIM_X)
-                atomicAdd(&ycopy[tx * incy], res_1_ * alpha);
+                hemv_atomic_add(&ycopy[tx * incy], res_1_ * alpha);
         }
     }
 
@@ -2487,7 +2541,7 @@ ROCBLAS_KERNEL_ILF void rocblas_symv_kernel_lower_double_buffered_non_diagonal_g
         for(int k = tx; k < tx + (DIM_X / 2); k++)
             treg[0] += la_shared[tx * (DIM_X / 2) + (k % (DIM_X / 2))];
 
-        atomicAdd(&y[tx * incy], treg[0] * alpha);
+        hemv_atomic_add(&y[tx * incy], treg[0] * alpha);
     }
 }
 
@@ -2579,7 +2633,12 @@ rocblas_hemvn_kernel_lower(rocblas_int    n,
         n, alpha, A, lda, x, incx, workspace);
 }
 
-template <rocblas_int DIM_X, rocblas_int DIM_Y, typename TStruct, typename V, typename TPtr>
+template <bool        IS_HEMV,
+          rocblas_int DIM_X,
+          rocblas_int DIM_Y,
+          typename TStruct,
+          typename V,
+          typename TPtr>
 ROCBLAS_KERNEL(DIM_X* DIM_Y)
 rocblas_symv_kernel_upper_double_buffered_diagonal(bool           host_ptr_mode,
                                                    rocblas_int    n,
@@ -2612,11 +2671,12 @@ rocblas_symv_kernel_upper_double_buffered_diagonal(bool           host_ptr_mode,
     const auto* x = cond_load_ptr_batch(alpha, xa, blockIdx.y, shiftx, stridex);
     auto*       y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
 
-    rocblas_symv_kernel_upper_double_buffered_diagonal_calc<DIM_X, DIM_Y>(
+    rocblas_symv_kernel_upper_double_buffered_diagonal_calc<IS_HEMV, DIM_X, DIM_Y>(
         n, alpha, A, lda, x, incx, beta, y, incy);
 }
 
-template <rocblas_int DIM_X,
+template <bool        IS_HEMV,
+          rocblas_int DIM_X,
           rocblas_int DIM_Y,
           rocblas_int elements_per_thread,
           typename TStruct,
@@ -2650,11 +2710,19 @@ rocblas_symv_kernel_upper_double_buffered_non_diagonal(bool           host_ptr_m
     const auto* x = cond_load_ptr_batch(alpha, xa, blockIdx.z, shiftx, stridex);
     auto*       y = load_ptr_batch(ya, blockIdx.z, shifty, stridey);
 
-    rocblas_symv_kernel_upper_double_buffered_non_diagonal_calc<DIM_X, DIM_Y, elements_per_thread>(
+    rocblas_symv_kernel_upper_double_buffered_non_diagonal_calc<IS_HEMV,
+                                                                DIM_X,
+                                                                DIM_Y,
+                                                                elements_per_thread>(
         n, alpha, A, lda, x, incx, y, incy);
 }
 
-template <rocblas_int DIM_X, rocblas_int DIM_Y, typename TStruct, typename V, typename TPtr>
+template <bool        IS_HEMV,
+          rocblas_int DIM_X,
+          rocblas_int DIM_Y,
+          typename TStruct,
+          typename V,
+          typename TPtr>
 ROCBLAS_KERNEL(DIM_X* DIM_Y)
 rocblas_symv_kernel_upper_double_buffered_diagonal_generic(bool           host_ptr_mode,
                                                            rocblas_int    n,
@@ -2688,11 +2756,12 @@ rocblas_symv_kernel_upper_double_buffered_diagonal_generic(bool           host_p
     const auto* x = cond_load_ptr_batch(alpha, xa, blockIdx.y, shiftx, stridex);
     auto*       y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
 
-    rocblas_symv_kernel_upper_double_buffered_diagonal_generic_calc<DIM_X, DIM_Y>(
+    rocblas_symv_kernel_upper_double_buffered_diagonal_generic_calc<IS_HEMV, DIM_X, DIM_Y>(
         n, alpha, A, lda, x, incx, beta, y, incy, mod);
 }
 
-template <rocblas_int DIM_X,
+template <bool        IS_HEMV,
+          rocblas_int DIM_X,
           rocblas_int DIM_Y,
           rocblas_int elements_per_thread,
           rocblas_int irregular_part,
@@ -2728,14 +2797,20 @@ rocblas_symv_kernel_upper_double_buffered_non_diagonal_generic(bool           ho
     const auto* x = cond_load_ptr_batch(alpha, xa, blockIdx.z, shiftx, stridex);
     auto*       y = load_ptr_batch(ya, blockIdx.z, shifty, stridey);
 
-    rocblas_symv_kernel_upper_double_buffered_non_diagonal_generic_calc<DIM_X,
+    rocblas_symv_kernel_upper_double_buffered_non_diagonal_generic_calc<IS_HEMV,
+                                                                        DIM_X,
                                                                         DIM_Y,
                                                                         elements_per_thread,
                                                                         irregular_part>(
         n, alpha, A, lda, x, incx, y, incy, mod);
 }
 
-template <rocblas_int DIM_X, rocblas_int DIM_Y, typename TStruct, typename V, typename TPtr>
+template <bool        IS_HEMV,
+          rocblas_int DIM_X,
+          rocblas_int DIM_Y,
+          typename TStruct,
+          typename V,
+          typename TPtr>
 ROCBLAS_KERNEL(DIM_X* DIM_Y)
 rocblas_symv_kernel_lower_double_buffered_diagonal(bool           host_ptr_mode,
                                                    rocblas_int    n,
@@ -2768,11 +2843,12 @@ rocblas_symv_kernel_lower_double_buffered_diagonal(bool           host_ptr_mode,
     const auto* x = cond_load_ptr_batch(alpha, xa, blockIdx.y, shiftx, stridex);
     auto*       y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
 
-    rocblas_symv_kernel_lower_double_buffered_diagonal_calc<DIM_X, DIM_Y>(
+    rocblas_symv_kernel_lower_double_buffered_diagonal_calc<IS_HEMV, DIM_X, DIM_Y>(
         n, alpha, A, lda, x, incx, beta, y, incy);
 }
 
-template <rocblas_int DIM_X,
+template <bool        IS_HEMV,
+          rocblas_int DIM_X,
           rocblas_int DIM_Y,
           rocblas_int elements_per_thread,
           typename TStruct,
@@ -2806,11 +2882,19 @@ rocblas_symv_kernel_lower_double_buffered_non_diagonal(bool           host_ptr_m
     const auto* x = cond_load_ptr_batch(alpha, xa, blockIdx.z, shiftx, stridex);
     auto*       y = load_ptr_batch(ya, blockIdx.z, shifty, stridey);
 
-    rocblas_symv_kernel_lower_double_buffered_non_diagonal_calc<DIM_X, DIM_Y, elements_per_thread>(
+    rocblas_symv_kernel_lower_double_buffered_non_diagonal_calc<IS_HEMV,
+                                                                DIM_X,
+                                                                DIM_Y,
+                                                                elements_per_thread>(
         n, alpha, A, lda, x, incx, y, incy);
 }
 
-template <rocblas_int DIM_X, rocblas_int DIM_Y, typename TStruct, typename V, typename TPtr>
+template <bool        IS_HEMV,
+          rocblas_int DIM_X,
+          rocblas_int DIM_Y,
+          typename TStruct,
+          typename V,
+          typename TPtr>
 ROCBLAS_KERNEL(DIM_X* DIM_Y)
 rocblas_symv_kernel_lower_double_buffered_diagonal_generic(bool           host_ptr_mode,
                                                            rocblas_int    n,
@@ -2844,11 +2928,12 @@ rocblas_symv_kernel_lower_double_buffered_diagonal_generic(bool           host_p
     const auto* x = cond_load_ptr_batch(alpha, xa, blockIdx.y, shiftx, stridex);
     auto*       y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
 
-    rocblas_symv_kernel_lower_double_buffered_diagonal_generic_calc<DIM_X, DIM_Y>(
+    rocblas_symv_kernel_lower_double_buffered_diagonal_generic_calc<IS_HEMV, DIM_X, DIM_Y>(
         n, alpha, A, lda, x, incx, beta, y, incy, mod);
 }
 
-template <rocblas_int DIM_X,
+template <bool        IS_HEMV,
+          rocblas_int DIM_X,
           rocblas_int DIM_Y,
           rocblas_int elements_per_thread,
           typename TStruct,
@@ -2883,12 +2968,74 @@ rocblas_symv_kernel_lower_double_buffered_non_diagonal_generic(bool           ho
     const auto* x = cond_load_ptr_batch(alpha, xa, blockIdx.z, shiftx, stridex);
     auto*       y = load_ptr_batch(ya, blockIdx.z, shifty, stridey);
 
-    rocblas_symv_kernel_lower_double_buffered_non_diagonal_generic_calc<DIM_X,
+    rocblas_symv_kernel_lower_double_buffered_non_diagonal_generic_calc<IS_HEMV,
+                                                                        DIM_X,
                                                                         DIM_Y,
                                                                         elements_per_thread>(
         n, alpha, A, lda, x, incx, y, incy, mod);
 }
 
+// lane tx of row ty of the block computes element tx of y for problem blockIdx.x * NB_BATCH + ty,
+// reading the elements of A outside the stored triangle from their mirror
+template <bool        IS_HEMV,
+          rocblas_int DIM_X,
+          rocblas_int NB_BATCH,
+          typename T,
+          typename TScal,
+          typename TConstPtr,
+          typename TPtr>
+ROCBLAS_KERNEL(DIM_X* NB_BATCH)
+rocblas_symv_small_batched_kernel(bool           is_upper,
+                                  rocblas_int    n,
+                                  TScal          alpha_device_host,
+                                  rocblas_stride stride_alpha,
+                                  TConstPtr      Aa,
+                                  rocblas_stride shifta,
+                                  int64_t        lda,
+                                  rocblas_stride strideA,
+                                  TConstPtr      xa,
+                                  rocblas_stride shiftx,
+                                  int64_t        incx,
+                                  rocblas_stride stridex,
+                                  TScal          beta_device_host,
+                                  rocblas_stride stride_beta,
+                                  TPtr           ya,
+                                  rocblas_stride shifty,
+                                  int64_t        incy,
+                                  rocblas_stride stridey,
+                                  rocblas_int    batch_count)
+{
+    const int      tx    = threadIdx.x;
+    const uint32_t batch = blockIdx.x * NB_BATCH + threadIdx.y;
+    if(batch >= batch_count || tx >= n)
+        return;
+
+    const T alpha = load_scalar(alpha_device_host, batch, stride_alpha);
+    const T beta  = load_scalar(beta_device_host, batch, stride_beta);
+    if(!alpha && beta == 1)
+        return;
+
+    T res = 0;
+    if(alpha)
+    {
+        const auto* A = load_ptr_batch(Aa, batch, shifta, strideA);
+        const auto* x = load_ptr_batch(xa, batch, shiftx, stridex);
+
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            T a = (is_upper ? tx <= j : tx >= j) ? A[tx + j * lda]
+                                                 : hemv_conj_if<IS_HEMV>(A[j + tx * lda]);
+            if(IS_HEMV && tx == j)
+                hemv_zero_imaginary(a);
+            res += a * x[j * incx];
+        }
+    }
+
+    auto*   y   = load_ptr_batch(ya, batch, shifty, stridey);
+    int64_t idx = tx * incy;
+    y[idx]      = beta ? alpha * res + beta * y[idx] : alpha * res;
+}
+
 /**
   *  V is either: const T* OR const T* const*
   *  W is either:       T* OR       T* const*
@@ -2928,21 +3075,44 @@ rocblas_status rocblas_internal_symv_hemv_launcher(rocblas_handle handle,
     auto shiftx = incx < 0 ? offsetx - incx * (n - 1) : offsetx;
     auto shifty = incy < 0 ? offsety - incy * (n - 1) : offsety;
 
-    //Identifying the precision to have an appropriate optimization
-    static constexpr bool is_float
-        = std::is_same_v<TPtr, rocblas_float*> || std::is_same_v<TPtr, rocblas_float* const*>;
-
-    static constexpr bool is_double
-        = std::is_same_v<TPtr, double*> || std::is_same_v<TPtr, double* const*>;
-
     bool i64_indices = size_t(n) * lda > c_i32_max || size_t(n) * std::abs(incx) > c_i32_max
                        || size_t(n) * std::abs(incy) > c_i32_max;
 
-    const bool is_atomics_allowed = handle->atomics_mode == rocblas_atomics_allowed ? true : false;
+    if(rocblas_symv_small_batched(n, batch_count))
+    {
+        static constexpr int DIM_X    = 64;
+        static constexpr int NB_BATCH = 4;
+
+        dim3 grid((batch_count - 1) / NB_BATCH + 1);
+        dim3 threads(DIM_X, NB_BATCH);
 
-    //Identifying the specific architecture to have an appropriate optimization
-    bool is_gfx90a = handle->getArch() == 910 ? true : false;
-    bool is_gfx908 = handle->getArch() == 908 ? true : false;
+#define symv_small_batched_KARGS(alpha_, beta_)                                               \
+    grid, threads, 0, rocblas_stream, uplo == rocblas_fill_upper, n, alpha_, stride_alpha, A, \
+        offseta, lda, strideA, x, shiftx, incx, stridex, beta_, stride_beta, y, shifty, incy, \
+        stridey, batch_count
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+        {
+            ROCBLAS_LAUNCH_KERNEL(
+                (rocblas_symv_small_batched_kernel<IS_HEMV, DIM_X, NB_BATCH, T>),
+                symv_small_batched_KARGS(alpha, beta));
+        }
+        else
+        {
+            if(!*alpha && *beta == 1)
+                return rocblas_status_success;
+
+            ROCBLAS_LAUNCH_KERNEL(
+                (rocblas_symv_small_batched_kernel<IS_HEMV, DIM_X, NB_BATCH, T>),
+                symv_small_batched_KARGS(*alpha, *beta));
+        }
+#undef symv_small_batched_KARGS
+
+        return rocblas_status_success;
+    }
+
+    //The double buffered kernels accumulate into y with atomics and need no workspace
+    const bool is_double_buffered = rocblas_hemv_symv_double_buffered<T>(handle, uplo, n);
 
     static constexpr int HEMV_DIM_X         = rocblas_hemv_DIM_X();
     static constexpr int HEMV_DIM_Y         = 4;
@@ -2965,17 +3135,7 @@ rocblas_status rocblas_internal_symv_hemv_launcher(rocblas_handle handle,
 
     if(uplo == rocblas_fill_upper)
     {
-        if(is_atomics_allowed
-           && ((is_gfx90a
-                && ((is_float && n < ssymv_U_gfx908_gfx90a_higher_threshold)
-                    || (is_double && n < dsymv_U_gfx90a_higher_threshold)))
-               || (is_gfx908
-                   && ((is_float && n < ssymv_U_gfx908_gfx90a_higher_threshold)
-                       || (is_double
-                           && (((n % 32 == 0) && n < dsymv_U_gfx908_higher_threshold)
-                               || ((n % 32 != 0)
-                                   && (n < dsymv_U_gfx908_generic_higher_threshold
-                                       || n > dsymv_U_gfx908_generic_lower_threshold))))))))
+        if(is_double_buffered)
         {
             bool host_ptr_mode = handle->pointer_mode == rocblas_pointer_mode_host;
             rocblas_internal_val_ptr<T> alpha_device_host(host_ptr_mode, alpha);
@@ -2985,131 +3145,133 @@ rocblas_status rocblas_internal_symv_hemv_launcher(rocblas_handle handle,
             static constexpr rocblas_int block_y = 8;
             const rocblas_int            mod     = n % DIM_X;
 
-            if constexpr(is_float || is_double)
+            if(mod == 0)
             {
-                if(mod == 0)
-                {
-                    //The following symv_kernel_upper_double_buffered is only valid for the multiples of DIM_X
-                    static constexpr rocblas_int DIM_Y               = 4;
-                    static constexpr rocblas_int elements_per_thread = (DIM_X / (2 * DIM_Y));
-                    const int                    block_x             = n / DIM_X;
-
-                    dim3 threads(DIM_X, DIM_Y);
-                    dim3 grid(block_x, batch_count);
-                    dim3 grid_(block_x, block_y, batch_count);
+                //The following symv_kernel_upper_double_buffered is only valid for the multiples of DIM_X
+                static constexpr rocblas_int DIM_Y               = 4;
+                static constexpr rocblas_int elements_per_thread = (DIM_X / (2 * DIM_Y));
+                const int                    block_x             = n / DIM_X;
+
+                dim3 threads(DIM_X, DIM_Y);
+                dim3 grid(block_x, batch_count);
+                dim3 grid_(block_x, block_y, batch_count);
+
+                ROCBLAS_LAUNCH_KERNEL(
+                    (rocblas_symv_kernel_upper_double_buffered_diagonal<IS_HEMV, DIM_X, DIM_Y>),
+                    grid,
+                    threads,
+                    0,
+                    rocblas_stream,
+                    host_ptr_mode,
+                    n,
+                    alpha_device_host,
+                    stride_alpha,
+                    A,
+                    offseta,
+                    lda,
+                    strideA,
+                    x,
+                    shiftx,
+                    incx,
+                    stridex,
+                    beta_device_host,
+                    stride_beta,
+                    y,
+                    shifty,
+                    incy,
+                    stridey);
+
+                ROCBLAS_LAUNCH_KERNEL((rocblas_symv_kernel_upper_double_buffered_non_diagonal<
+                                          IS_HEMV,
+                                          DIM_X,
+                                          DIM_Y,
+                                          elements_per_thread>),
+                                      grid_,
+                                      threads,
+                                      0,
+                                      rocblas_stream,
+                                      host_ptr_mode,
+                                      n,
+                                      alpha_device_host,
+                                      stride_alpha,
+                                      A,
+                                      offseta,
+                                      lda,
+                                      strideA,
+                                      x,
+                                      shiftx,
+                                      incx,
+                                      stridex,
+                                      y,
+                                      shifty,
+                                      incy,
+                                      stridey);
+            }
+            else
+            {
+                static constexpr rocblas_int DIM_Y               = 8;
+                static constexpr rocblas_int elements_per_thread = (DIM_X / (2 * DIM_Y));
+                const rocblas_int            irregular_part      = mod % elements_per_thread;
+                const rocblas_int            block_x             = n / DIM_X + (mod != 0);
+
+                dim3 threads(DIM_X, DIM_Y);
+                dim3 grid(block_x, batch_count);
+                dim3 grid_(block_x, block_y, batch_count);
+
+                ROCBLAS_LAUNCH_KERNEL(
+                    (rocblas_symv_kernel_upper_double_buffered_diagonal_generic<IS_HEMV,
+                                                                                DIM_X,
+                                                                                DIM_Y>),
+                    grid,
+                    threads,
+                    0,
+                    rocblas_stream,
+                    host_ptr_mode,
+                    n,
+                    alpha_device_host,
+                    stride_alpha,
+                    A,
+                    offseta,
+                    lda,
+                    strideA,
+                    x,
+                    shiftx,
+                    incx,
+                    stridex,
+                    beta_device_host,
+                    stride_beta,
+                    y,
+                    shifty,
+                    incy,
+                    stridey,
+                    mod);
 
+#define symvu_KARGS                                                                          \
+    grid_, threads, 0, rocblas_stream, host_ptr_mode, n, alpha_device_host, stride_alpha, A, \
+        offseta, lda, strideA, x, shiftx, incx, stridex, y, shifty, incy, stridey, mod
+                if(irregular_part == 0)
+                {
                     ROCBLAS_LAUNCH_KERNEL(
-                        (rocblas_symv_kernel_upper_double_buffered_diagonal<DIM_X, DIM_Y>),
-                        grid,
-                        threads,
-                        0,
-                        rocblas_stream,
-                        host_ptr_mode,
-                        n,
-                        alpha_device_host,
-                        stride_alpha,
-                        A,
-                        offseta,
-                        lda,
-                        strideA,
-                        x,
-                        shiftx,
-                        incx,
-                        stridex,
-                        beta_device_host,
-                        stride_beta,
-                        y,
-                        shifty,
-                        incy,
-                        stridey);
-
-                    ROCBLAS_LAUNCH_KERNEL((rocblas_symv_kernel_upper_double_buffered_non_diagonal<
-                                              DIM_X,
-                                              DIM_Y,
-                                              elements_per_thread>),
-                                          grid_,
-                                          threads,
-                                          0,
-                                          rocblas_stream,
-                                          host_ptr_mode,
-                                          n,
-                                          alpha_device_host,
-                                          stride_alpha,
-                                          A,
-                                          offseta,
-                                          lda,
-                                          strideA,
-                                          x,
-                                          shiftx,
-                                          incx,
-                                          stridex,
-                                          y,
-                                          shifty,
-                                          incy,
-                                          stridey);
+                        (rocblas_symv_kernel_upper_double_buffered_non_diagonal_generic<
+                            IS_HEMV,
+                            DIM_X,
+                            DIM_Y,
+                            elements_per_thread,
+                            0>),
+                        symvu_KARGS);
                 }
-                else
+                else if(irregular_part == 1)
                 {
-                    static constexpr rocblas_int DIM_Y               = 8;
-                    static constexpr rocblas_int elements_per_thread = (DIM_X / (2 * DIM_Y));
-                    const rocblas_int            irregular_part      = mod % elements_per_thread;
-                    const rocblas_int            block_x             = n / DIM_X + (mod != 0);
-
-                    dim3 threads(DIM_X, DIM_Y);
-                    dim3 grid(block_x, batch_count);
-                    dim3 grid_(block_x, block_y, batch_count);
-
                     ROCBLAS_LAUNCH_KERNEL(
-                        (rocblas_symv_kernel_upper_double_buffered_diagonal_generic<DIM_X, DIM_Y>),
-                        grid,
-                        threads,
-                        0,
-                        rocblas_stream,
-                        host_ptr_mode,
-                        n,
-                        alpha_device_host,
-                        stride_alpha,
-                        A,
-                        offseta,
-                        lda,
-                        strideA,
-                        x,
-                        shiftx,
-                        incx,
-                        stridex,
-                        beta_device_host,
-                        stride_beta,
-                        y,
-                        shifty,
-                        incy,
-                        stridey,
-                        mod);
-
-#define symvu_KARGS                                                                          \
-    grid_, threads, 0, rocblas_stream, host_ptr_mode, n, alpha_device_host, stride_alpha, A, \
-        offseta, lda, strideA, x, shiftx, incx, stridex, y, shifty, incy, stridey, mod
-                    if(irregular_part == 0)
-                    {
-                        ROCBLAS_LAUNCH_KERNEL(
-                            (rocblas_symv_kernel_upper_double_buffered_non_diagonal_generic<
-                                DIM_X,
-                                DIM_Y,
-                                elements_per_thread,
-                                0>),
-                            symvu_KARGS);
-                    }
-                    else if(irregular_part == 1)
-                    {
-                        ROCBLAS_LAUNCH_KERNEL(
-                            (rocblas_symv_kernel_upper_double_buffered_non_diagonal_generic<
-                                DIM_X,
-                                DIM_Y,
-                                elements_per_thread,
-                                1>),
-                            symvu_KARGS);
-                    }
-#undef symvu_KARGS
+                        (rocblas_symv_kernel_upper_double_buffered_non_diagonal_generic<
+                            IS_HEMV,
+                            DIM_X,
+                            DIM_Y,
+                            elements_per_thread,
+                            1>),
+                        symvu_KARGS);
                 }
+#undef symvu_KARGS
             }
         }
         else
@@ -3186,13 +3348,7 @@ rocblas_status rocblas_internal_symv_hemv_launcher(rocblas_handle handle,
     }
     else
     {
-        if(is_atomics_allowed
-           && ((is_gfx908 && (is_float || is_double))
-               || (is_gfx90a
-                   && (((is_float && n < ssymv_L_gfx90a_higher_threshold)
-                        || ((n % 32 == 0 && is_double && n < dsymv_L_gfx90a_higher_threshold)
-                            || (n % 32 != 0 && is_double
-                                && n < dsymv_L_gfx90a_generic_higher_threshold)))))))
+        if(is_double_buffered)
         {
             //The following symv_kernel_upper_double_buffered is only valid for the multiples of DIM_X
             static constexpr rocblas_int DIM_X               = 32;
@@ -3210,115 +3366,116 @@ rocblas_status rocblas_internal_symv_hemv_launcher(rocblas_handle handle,
             rocblas_internal_val_ptr<T> alpha_device_host(host_ptr_mode, alpha);
             rocblas_internal_val_ptr<T> beta_device_host(host_ptr_mode, beta);
 
-            if constexpr(is_float || is_double)
+            if(mod == 0)
             {
-                if(mod == 0)
-                {
-                    ROCBLAS_LAUNCH_KERNEL(
-                        (rocblas_symv_kernel_lower_double_buffered_diagonal<DIM_X, DIM_Y>),
-                        grid,
-                        threads,
-                        0,
-                        rocblas_stream,
-                        host_ptr_mode,
-                        n,
-                        alpha_device_host,
-                        stride_alpha,
-                        A,
-                        offseta,
-                        lda,
-                        strideA,
-                        x,
-                        shiftx,
-                        incx,
-                        stridex,
-                        beta_device_host,
-                        stride_beta,
-                        y,
-                        shifty,
-                        incy,
-                        stridey);
-
-                    ROCBLAS_LAUNCH_KERNEL((rocblas_symv_kernel_lower_double_buffered_non_diagonal<
-                                              DIM_X,
-                                              DIM_Y,
-                                              elements_per_thread>),
-                                          grid_,
-                                          threads,
-                                          0,
-                                          rocblas_stream,
-                                          host_ptr_mode,
-                                          n,
-                                          alpha_device_host,
-                                          stride_alpha,
-                                          A,
-                                          offseta,
-                                          lda,
-                                          strideA,
-                                          x,
-                                          shiftx,
-                                          incx,
-                                          stridex,
-                                          y,
-                                          shifty,
-                                          incy,
-                                          stridey);
-                }
-                else
-                {
-                    ROCBLAS_LAUNCH_KERNEL(
-                        (rocblas_symv_kernel_lower_double_buffered_diagonal_generic<DIM_X, DIM_Y>),
-                        grid,
-                        threads,
-                        0,
-                        rocblas_stream,
-                        host_ptr_mode,
-                        n,
-                        alpha_device_host,
-                        stride_alpha,
-                        A,
-                        offseta,
-                        lda,
-                        strideA,
-                        x,
-                        shiftx,
-                        incx,
-                        stridex,
-                        beta_device_host,
-                        stride_beta,
-                        y,
-                        shifty,
-                        incy,
-                        stridey,
-                        mod);
-
-                    ROCBLAS_LAUNCH_KERNEL(
-                        (rocblas_symv_kernel_lower_double_buffered_non_diagonal_generic<
-                            DIM_X,
-                            DIM_Y,
-                            elements_per_thread>),
-                        grid_,
-                        threads,
-                        0,
-                        rocblas_stream,
-                        host_ptr_mode,
-                        n,
-                        alpha_device_host,
-                        stride_alpha,
-                        A,
-                        offseta,
-                        lda,
-                        strideA,
-                        x,
-                        shiftx,
-                        incx,
-                        stridex,
-                        y,
-                        shifty,
-                        incy,
-                        stridey,
-                        mod);
-                }
+                ROCBLAS_LAUNCH_KERNEL(
+                    (rocblas_symv_kernel_lower_double_buffered_diagonal<IS_HEMV, DIM_X, DIM_Y>),
+                    grid,
+                    threads,
+                    0,
+                    rocblas_stream,
+                    host_ptr_mode,
+                    n,
+                    alpha_device_host,
+                    stride_alpha,
+                    A,
+                    offseta,
+                    lda,
+                    strideA,
+                    x,
+                    shiftx,
+                    incx,
+                    stridex,
+                    beta_device_host,
+                    stride_beta,
+                    y,
+                    shifty,
+                    incy,
+                    stridey);
+
+                ROCBLAS_LAUNCH_KERNEL((rocblas_symv_kernel_lower_double_buffered_non_diagonal<
+                                          IS_HEMV,
+                                          DIM_X,
+                                          DIM_Y,
+                                          elements_per_thread>),
+                                      grid_,
+                                      threads,
+                                      0,
+                                      rocblas_stream,
+                                      host_ptr_mode,
+                                      n,
+                                      alpha_device_host,
+                                      stride_alpha,
+                                      A,
+                                      offseta,
+                                      lda,
+                                      strideA,
+                                      x,
+                                      shiftx,
+                                      incx,
+                                      stridex,
+                                      y,
+                                      shifty,
+                                      incy,
+                                      stridey);
+            }
+            else
+            {
+                ROCBLAS_LAUNCH_KERNEL(
+                    (rocblas_symv_kernel_lower_double_buffered_diagonal_generic<IS_HEMV,
+                                                                                DIM_X,
+                                                                                DIM_Y>),
+                    grid,
+                    threads,
+                    0,
+                    rocblas_stream,
+                    host_ptr_mode,
+                    n,
+                    alpha_device_host,
+                    stride_alpha,
+                    A,
+                    offseta,
+                    lda,
+                    strideA,
+                    x,
+                    shiftx,
+                    incx,
+                    stridex,
+                    beta_device_host,
+                    stride_beta,
+                    y,
+                    shifty,
+                    incy,
+                    stridey,
+                    mod);
+
+                ROCBLAS_LAUNCH_KERNEL(
+                    (rocblas_symv_kernel_lower_double_buffered_non_diagonal_generic<
+                        IS_HEMV,
+                        DIM_X,
+                        DIM_Y,
+                        elements_per_thread>),
+                    grid_,
+                    threads,
+                    0,
+                    rocblas_stream,
+                    host_ptr_mode,
+                    n,
+                    alpha_device_host,
+                    stride_alpha,
+                    A,
+                    offseta,
+                    lda,
+                    strideA,
+                    x,
+                    shiftx,
+                    incx,
+                    stridex,
+                    y,
+                    shifty,
+                    incy,
+                    stridey,
+                    mod);
             }
         }
         else
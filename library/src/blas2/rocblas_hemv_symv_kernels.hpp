@@ -24,6 +24,13 @@
 
 #include "handle.hpp"
 
+// Batched symv and hemv with n <= 64 and large batch_count compute whole problems per row of a
+// thread block, with the batch in the x dimension of the grid
+inline bool rocblas_symv_small_batched(int64_t n, int64_t batch_count)
+{
+    return n <= 64 && batch_count >= 256;
+}
+
 template <bool IS_HEMV, typename T, typename TScal, typename TConstPtr, typename TPtr>
 rocblas_status rocblas_internal_symv_hemv_launcher(rocblas_handle handle,
                                                    rocblas_fill   uplo,
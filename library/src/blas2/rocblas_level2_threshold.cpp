@@ -0,0 +1,199 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_level2_threshold.hpp"
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+namespace
+{
+    using row = rocblas_level2_thresholds::row;
+
+    constexpr int64_t c_max = rocblas_level2_max;
+
+    void rocblas_level2_set(row& r, int64_t s, int64_t d, int64_t c, int64_t z, int64_t h)
+    {
+        r[0] = s;
+        r[1] = d;
+        r[2] = c;
+        r[3] = z;
+        r[4] = h;
+    }
+
+    rocblas_level2_thresholds rocblas_level2_default_thresholds(int arch)
+    {
+        int  arch_major             = arch / 100;
+        bool is_arch_10_or_11_or_12 = arch_major == 10 || arch_major == 11 || arch_major == 12;
+
+        rocblas_level2_thresholds t;
+        rocblas_level2_set(t.gemvn_upper, 0, 0, 0, 0, 0);
+        rocblas_level2_set(t.gemvn_lower, c_max, c_max, c_max, c_max, c_max);
+        rocblas_level2_set(t.gemvt_double_buffered_lower, c_max, c_max, c_max, c_max, c_max);
+        rocblas_level2_set(t.gemvt_warp_reduce_upper, 0, 0, 0, 0, 0);
+        rocblas_level2_set(t.gemvt_shared_upper, c_max, 6000, 6000, 6000, 6000);
+        rocblas_level2_set(t.symv_U_aligned, 0, 0, 0, 0, 0);
+        rocblas_level2_set(t.symv_U_unaligned_upper, 0, 0, 0, 0, 0);
+        rocblas_level2_set(t.symv_U_unaligned_lower, c_max, c_max, c_max, c_max, c_max);
+        rocblas_level2_set(t.symv_L_aligned, 0, 0, 0, 0, 0);
+        rocblas_level2_set(t.symv_L_unaligned_upper, 0, 0, 0, 0, 0);
+        rocblas_level2_set(t.symv_L_unaligned_lower, c_max, c_max, c_max, c_max, c_max);
+
+        if(arch == 906)
+        {
+            rocblas_level2_set(t.gemvn_upper, 6000, 24000, c_max, 0, 0);
+            rocblas_level2_set(t.gemvn_lower, c_max, 15000, c_max, c_max, c_max);
+        }
+        else if(arch == 908)
+        {
+            rocblas_level2_set(t.gemvn_upper, 15000, 15000, 15000, 18000, 0);
+            rocblas_level2_set(t.gemvt_double_buffered_lower, 7000, 3000, c_max, c_max, c_max);
+            rocblas_level2_set(t.symv_U_aligned, 22000, 23000, 0, 0, 0);
+            rocblas_level2_set(t.symv_U_unaligned_upper, 22000, 14000, 0, 0, 0);
+            rocblas_level2_set(t.symv_U_unaligned_lower, c_max, 19000, c_max, c_max, c_max);
+            rocblas_level2_set(t.symv_L_aligned, c_max, c_max, 0, 0, 0);
+            rocblas_level2_set(t.symv_L_unaligned_upper, c_max, c_max, 0, 0, 0);
+        }
+        else if(arch == 910 || (arch >= 940 && arch <= 942)) // gfx90a, gfx94x
+        {
+            rocblas_level2_set(t.symv_U_aligned, 22000, 16000, 16000, 12000, 0);
+            rocblas_level2_set(t.symv_U_unaligned_upper, 22000, 16000, 16000, 12000, 0);
+            rocblas_level2_set(t.symv_L_aligned, 29000, 20000, 20000, 16000, 0);
+            rocblas_level2_set(t.symv_L_unaligned_upper, 29000, 26000, 20000, 16000, 0);
+        }
+        else if(is_arch_10_or_11_or_12)
+        {
+            rocblas_level2_set(t.gemvt_warp_reduce_upper, 4000, c_max, c_max, 0, 0);
+            rocblas_level2_set(t.gemvt_shared_upper, c_max, 6000, 6000, c_max, 6000);
+        }
+
+        return t;
+    }
+
+    row* rocblas_level2_find(rocblas_level2_thresholds& t, const std::string& name)
+    {
+#define ROCBLAS_LEVEL2_MEMBER(member_) \
+    if(name == #member_)               \
+        return &t.member_;
+
+        ROCBLAS_LEVEL2_MEMBER(gemvn_upper)
+        ROCBLAS_LEVEL2_MEMBER(gemvn_lower)
+        ROCBLAS_LEVEL2_MEMBER(gemvt_double_buffered_lower)
+        ROCBLAS_LEVEL2_MEMBER(gemvt_warp_reduce_upper)
+        ROCBLAS_LEVEL2_MEMBER(gemvt_shared_upper)
+        ROCBLAS_LEVEL2_MEMBER(symv_U_aligned)
+        ROCBLAS_LEVEL2_MEMBER(symv_U_unaligned_upper)
+        ROCBLAS_LEVEL2_MEMBER(symv_U_unaligned_lower)
+        ROCBLAS_LEVEL2_MEMBER(symv_L_aligned)
+        ROCBLAS_LEVEL2_MEMBER(symv_L_unaligned_upper)
+        ROCBLAS_LEVEL2_MEMBER(symv_L_unaligned_lower)
+
+#undef ROCBLAS_LEVEL2_MEMBER
+        return nullptr;
+    }
+
+    // Overrides the members listed in the file, leaving t unchanged if the file does not exist.
+    // Lines which cannot be parsed are reported and skipped.
+    void rocblas_level2_read_thresholds(rocblas_level2_thresholds& t, const std::string& path)
+    {
+        std::ifstream file(path);
+        std::string   line;
+        for(int line_number = 1; std::getline(file, line); line_number++)
+        {
+            std::istringstream fields(line.substr(0, line.find('#')));
+            std::string        name;
+            if(!(fields >> name))
+                continue;
+
+            row* r = rocblas_level2_find(t, name);
+            row  values;
+            bool valid = r != nullptr;
+            for(int p = 0; valid && p < rocblas_level2_precisions; p++)
+            {
+                std::string value;
+                valid = bool(fields >> value);
+                if(valid && value == "-")
+                    values[p] = (*r)[p];
+                else if(valid && value == "max")
+                    values[p] = c_max;
+                else if(valid)
+                {
+                    size_t end = 0;
+                    try
+                    {
+                        values[p] = std::stoll(value, &end);
+                    }
+                    catch(...)
+                    {
+                    }
+                    valid = end == value.size() && values[p] >= 0;
+                }
+            }
+
+            if(valid)
+                std::copy_n(values, rocblas_level2_precisions, *r);
+            else
+                rocblas_cerr << "rocBLAS warning: ignoring line " << line_number << " of " << path
+                             << std::endl;
+        }
+    }
+
+    const rocblas_level2_thresholds* rocblas_level2_load_thresholds(int device, int arch)
+    {
+        static std::mutex                                               mutex;
+        static std::unordered_map<int, const rocblas_level2_thresholds> tables;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto                        it = tables.find(device);
+        if(it == tables.end())
+        {
+            rocblas_level2_thresholds t = rocblas_level2_default_thresholds(arch);
+
+            const char* path = getenv("ROCBLAS_LEVEL2_TUNING_PATH");
+            if(path)
+            {
+                hipDeviceProp_t props;
+                if(hipGetDeviceProperties(&props, device) == hipSuccess)
+                {
+                    // strip out xnack/ecc from name
+                    std::string name(props.gcnArchName);
+                    name = name.substr(0, name.find(':'));
+                    rocblas_level2_read_thresholds(
+                        t, std::string(path) + "/Level2Tuning_" + name + ".txt");
+                }
+            }
+
+            it = tables.emplace(device, t).first;
+        }
+        return &it->second;
+    }
+} // namespace
+
+const rocblas_level2_thresholds& rocblas_level2_get_thresholds(rocblas_handle handle)
+{
+    if(!handle->level2_thresholds)
+        handle->level2_thresholds
+            = rocblas_level2_load_thresholds(handle->getDevice(), handle->getArch());
+    return *handle->level2_thresholds;
+}
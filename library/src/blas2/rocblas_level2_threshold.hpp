@@ -1,5 +1,5 @@
 /* ************************************************************************
- * Copyright (C) 2019-2022 Advanced Micro Devices, Inc. All rights reserved.
+ * Copyright (C) 2019-2024 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -21,39 +21,68 @@
  * ************************************************************************ */
 
 #pragma once
-#include "rocblas.h"
+#include "handle.hpp"
+#include <cstdint>
+#include <limits>
 
-/*********************************************************************gemv**********************************************************************/
+// Tuning of the Level-2 kernel selection. Each member holds one threshold per precision, indexed
+// by rocblas_level2_precision, and selects one kernel variant of gemv or symv/hemv. The defaults
+// are the values tuned for gfx906, gfx908, gfx90a and gfx10/11/12, gfx94x starting from the
+// symv/hemv values of gfx90a; other architectures fall back to the generic kernels. A table can be loaded for the architecture of a device from the directory
+// named by ROCBLAS_LEVEL2_TUNING_PATH, see rocblas_level2_get_thresholds.
 
-// Threshold values of (M, N) in gfx908 and gfx906 below which the threads per block should be 512 or less to get better performance
-constexpr int gemvn_gfx908_threshold        = 15000;
-constexpr int zgemvn_gfx908_threshold       = 18000;
-constexpr int gemvn_gfx906_threshold        = 6000;
-constexpr int dgemvn_gfx906_lower_threshold = 15000;
-constexpr int dgemvn_gfx906_upper_threshold = 24000;
-constexpr int gemvt_threshold               = 6000;
+// Precision index of the thresholds: s, d, c, z and the mixed precisions (half or bfloat16 input)
+constexpr int rocblas_level2_precisions = 5;
 
-// Threshold values of (M, N) in gfx10 and gfx11
-constexpr int sgemvt_gfx_arch_10_11_threshold = 4000;
+constexpr int rocblas_level2_precision(bool is_float,
+                                       bool is_double,
+                                       bool is_complex_float,
+                                       bool is_complex_double)
+{
+    return is_float ? 0 : is_double ? 1 : is_complex_float ? 2 : is_complex_double ? 3 : 4;
+}
 
-// Double buffered load optimized for single and double precision for gemv (transpose)
-constexpr int sgemvt_gfx908_lower_threshold = 7000;
-constexpr int dgemvt_gfx908_lower_threshold = 3000;
+// Threshold larger than any problem size: a variant selected below it is always taken, and one
+// selected above it never is
+constexpr int64_t rocblas_level2_max = std::numeric_limits<int64_t>::max();
 
-/*********************************************************************symv**********************************************************************/
+struct rocblas_level2_thresholds
+{
+    using row = int64_t[rocblas_level2_precisions];
 
-// Double buffered load optimized for single and double precision for symv (upper)
-constexpr int ssymv_U_gfx908_gfx90a_higher_threshold = 22000;
-constexpr int dsymv_U_gfx908_higher_threshold        = 23000;
-constexpr int dsymv_U_gfx90a_higher_threshold        = 16000;
+    /*****************************************************************gemv******************************************************************/
 
-// Double buffered load optimized for single and double precision for symv (lower)
-constexpr int ssymv_L_gfx90a_higher_threshold = 29000;
-constexpr int dsymv_L_gfx90a_higher_threshold = 20000;
+    // rocblas_gemvn_kernel with 512 threads per block when m and n are both <= gemvn_upper or
+    // both >= gemvn_lower
+    row gemvn_upper;
+    row gemvn_lower;
 
-// Double buffered load optimized for double precision for symv (lower) generic cases
-constexpr int dsymv_L_gfx90a_generic_higher_threshold = 26000;
+    // Double buffered load gemv (transpose) kernel when m == n > gemvt_double_buffered_lower,
+    // single and double precision
+    row gemvt_double_buffered_lower;
 
-// Double buffered load optimized for double precision for symv (upper) generic cases
-constexpr int dsymv_U_gfx908_generic_higher_threshold = 14000;
-constexpr int dsymv_U_gfx908_generic_lower_threshold  = 19000;
+    // Warp reduction gemv (transpose) kernel when m or n < gemvt_warp_reduce_upper
+    row gemvt_warp_reduce_upper;
+
+    // Shared memory reduction gemv (transpose) kernel when m or n < gemvt_shared_upper
+    row gemvt_shared_upper;
+
+    /*****************************************************************symv******************************************************************/
+
+    // Double buffered load symv kernels, single and double precision, when n < *_aligned for
+    // n % 32 == 0, and otherwise when n < *_unaligned_upper or n > *_unaligned_lower
+    row symv_U_aligned;
+    row symv_U_unaligned_upper;
+    row symv_U_unaligned_lower;
+    row symv_L_aligned;
+    row symv_L_unaligned_upper;
+    row symv_L_unaligned_lower;
+};
+
+// Thresholds for the device of the handle. The table is built once per device from the defaults
+// of its architecture, overridden by the file Level2Tuning_<arch>.txt (for example
+// Level2Tuning_gfx942.txt) in the directory named by ROCBLAS_LEVEL2_TUNING_PATH if it exists.
+// Each line of the file is "<member> <s> <d> <c> <z> <h>" with the name of a member above and
+// "max" standing for rocblas_level2_max and "-" keeping the default. Text following '#' is
+// ignored. clients/benchmarks/level2_tune/rocblas-level2-tune.py writes such a file.
+const rocblas_level2_thresholds& rocblas_level2_get_thresholds(rocblas_handle handle);
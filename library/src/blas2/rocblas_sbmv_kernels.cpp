@@ -22,61 +22,15 @@
 
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
+#include "rocblas_band_device.hpp"
 #include "rocblas_sbmv.hpp"
 
-/**
-  *  create partial sums for each ty.
-  */
-template <bool UPPER, rocblas_int DIM_Y, typename T>
-inline __device__ T rocblas_sbmv_kernel_helper(rocblas_int ty,
-                                               rocblas_int ind,
-                                               rocblas_int n,
-                                               rocblas_int k,
-                                               const T* __restrict__ A,
-                                               int64_t lda,
-                                               const T* __restrict__ x,
-                                               int64_t incx)
-{
-    T           res_A = 0.0;
-    rocblas_int col;
-
-    // Since the column is consistent, we iterate up diagonally in banded format
-    // ty defines the column of banded matrix
-    for(col = ty; col < n; col += DIM_Y)
-    {
-        // We have to convert ind to banded matrix row
-        rocblas_int row = UPPER ? ind + (k - col) : ind - col;
-
-        if(ind < n)
-        {
-            if((ind <= col && UPPER) || (ind >= col && !UPPER))
-            {
-                // in upper/lower triangular part
-                if(row <= k && row >= 0)
-                {
-                    res_A += A[row + col * size_t(lda)] * x[col * incx];
-                }
-            }
-            else
-            {
-                // in the opposite triangle, get value at transposed position
-                rocblas_int trans_row = col;
-                rocblas_int trans_col = ind;
-                trans_row             = UPPER ? trans_row + (k - trans_col) : trans_row - trans_col;
-                if(trans_row <= k && trans_row >= 0)
-                {
-                    res_A += A[trans_row + trans_col * size_t(lda)] * x[col * incx];
-                }
-            }
-        }
-    }
-    return res_A;
-}
-
 /**
   *  Computes y := alpha*A*x + beta*y where A is a symmetric matrix.
   *  If uplo == upper, the strictly lower part of A is not referenced,
   *  if uplo == lower, the strictly upper part of A is not referenced.
+  *  Each thread block computes DIM_X elements of y: the stored triangle is applied along its
+  *  rows and its strict part again along its columns for the mirrored triangle.
   */
 template <bool UPPER, rocblas_int DIM_X, rocblas_int DIM_Y, typename T>
 inline __device__ void rocblas_sbmv_kernel_calc(rocblas_int n,
@@ -90,43 +44,23 @@ inline __device__ void rocblas_sbmv_kernel_calc(rocblas_int n,
                                                 T* __restrict__ y,
                                                 int64_t incy)
 {
-    rocblas_int thread_id = threadIdx.x + threadIdx.y * blockDim.x;
+    rocblas_int ind   = blockIdx.x * DIM_X + threadIdx.x;
+    T           res_A = T(0);
 
-    if(!alpha)
+    if(alpha)
     {
-        rocblas_int ind = blockIdx.x * DIM_X + thread_id;
-        if(thread_id < DIM_X && ind < n)
-        {
-            y[ind * incy] = beta ? (beta * y[ind * incy]) : 0;
-        }
-        return;
-    }
-
-    // threads are all configurated locally
-    rocblas_int tx = thread_id % DIM_X;
-    rocblas_int ty = thread_id / DIM_X;
-
-    rocblas_int ind = blockIdx.x * DIM_X + tx;
-
-    __shared__ T sdata[DIM_X * DIM_Y];
+        // the main diagonal is on stored row k of upper and row 0 of lower band storage
+        rocblas_int off = UPPER ? k : 0;
 
-    T res_A;
+        res_A = rocblas_band_rows_tile<DIM_X, DIM_Y>(n, n, off, 0, k + 1, A, lda, x, incx);
+        res_A += rocblas_band_cols_tile<DIM_X, DIM_Y, false>(
+            n, n, off, UPPER ? 0 : 1, UPPER ? k : k + 1, A, lda, x, incx);
 
-    res_A = rocblas_sbmv_kernel_helper<UPPER, DIM_Y>(ty, ind, n, k, A, lda, x, incx);
-
-    sdata[tx + ty * DIM_X] = res_A;
-
-    __syncthreads();
-
-    ind = blockIdx.x * DIM_X + thread_id;
-    if(thread_id < DIM_X && ind < n)
-    {
-        for(rocblas_int i = 1; i < DIM_Y; i++)
-            sdata[thread_id] += sdata[thread_id + DIM_X * i];
-
-        y[ind * incy]
-            = beta ? (alpha * sdata[thread_id]) + (beta * y[ind * incy]) : alpha * sdata[thread_id];
+        res_A = rocblas_band_tile_sum<DIM_X, DIM_Y>(res_A) * alpha;
     }
+
+    if(threadIdx.y == 0 && ind < n)
+        y[ind * incy] = beta ? res_A + beta * y[ind * incy] : res_A;
 }
 
 /**
@@ -205,8 +139,8 @@ rocblas_status rocblas_internal_sbmv_launcher(rocblas_handle handle,
     auto shiftx = incx < 0 ? offset_x - incx * (n - 1) : offset_x;
     auto shifty = incy < 0 ? offset_y - incy * (n - 1) : offset_y;
 
-    static constexpr int sbmv_DIM_X = 64;
-    static constexpr int sbmv_DIM_Y = 16;
+    static constexpr int sbmv_DIM_X = 32;
+    static constexpr int sbmv_DIM_Y = 8;
     rocblas_int          blocks     = (n - 1) / (sbmv_DIM_X) + 1;
     dim3                 grid(blocks, batch_count);
     dim3                 threads(sbmv_DIM_X, sbmv_DIM_Y);
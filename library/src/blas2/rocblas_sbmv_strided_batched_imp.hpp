@@ -56,13 +56,20 @@ namespace
     {
         if(!handle)
             return rocblas_status_invalid_handle;
+
+        // row major symmetric A is column major A, of the other triangle, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+            uplo = rocblas_row_major_fill(uplo);
+
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+
+        rocblas_api_scope api_scope(handle, rocblas_sbmv_strided_batched_name<T>);
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-              | rocblas_layer_mode_log_profile))
+              | rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
         {
             auto uplo_letter = rocblas_fill_letter(uplo);
 
@@ -112,7 +119,7 @@ namespace
                           "--batch_count",
                           batch_count);
 
-            if(layer_mode & rocblas_layer_mode_log_profile)
+            if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                 log_profile(handle,
                             rocblas_sbmv_strided_batched_name<T>,
                             "uplo",
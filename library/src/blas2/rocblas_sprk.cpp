@@ -0,0 +1,385 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * Rank-k updates of packed symmetric and Hermitian matrices,
+ *
+ *     sprk:  AP += alpha * X * X**T,                        hprk:  AP += alpha * X * X**H,
+ *     spr2k: AP += alpha * (X * Y**T + Y * X**T),           hpr2k: AP += alpha * X * Y**H
+ *                                                                  + conj(alpha) * Y * X**H,
+ *
+ * for the n by k matrices X and Y holding k vectors as columns, which apply k spr, hpr, spr2 or
+ * hpr2 updates in one pass over AP. Each thread block computes a tile of the triangle from the
+ * rows of X and Y staged in LDS and adds it to AP, where the TILE rows of a column of the tile
+ * are consecutive, so the reads of X and Y and the updates of AP are all coalesced.
+ */
+
+#include "handle.hpp"
+#include "int64_helpers.hpp"
+#include "logging.hpp"
+#include "rocblas_storage_index.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    template <bool, bool, typename>
+    constexpr char rocblas_sprk_name[] = "unknown";
+    template <>
+    constexpr char rocblas_sprk_name<false, false, float>[] = "rocblas_ssprk_strided_batched";
+    template <>
+    constexpr char rocblas_sprk_name<false, false, double>[] = "rocblas_dsprk_strided_batched";
+    template <>
+    constexpr char rocblas_sprk_name<false, false, rocblas_float_complex>[]
+        = "rocblas_csprk_strided_batched";
+    template <>
+    constexpr char rocblas_sprk_name<false, false, rocblas_double_complex>[]
+        = "rocblas_zsprk_strided_batched";
+    template <>
+    constexpr char rocblas_sprk_name<true, false, rocblas_float_complex>[]
+        = "rocblas_chprk_strided_batched";
+    template <>
+    constexpr char rocblas_sprk_name<true, false, rocblas_double_complex>[]
+        = "rocblas_zhprk_strided_batched";
+    template <>
+    constexpr char rocblas_sprk_name<false, true, float>[] = "rocblas_sspr2k_strided_batched";
+    template <>
+    constexpr char rocblas_sprk_name<false, true, double>[] = "rocblas_dspr2k_strided_batched";
+    template <>
+    constexpr char rocblas_sprk_name<true, true, rocblas_float_complex>[]
+        = "rocblas_chpr2k_strided_batched";
+    template <>
+    constexpr char rocblas_sprk_name<true, true, rocblas_double_complex>[]
+        = "rocblas_zhpr2k_strided_batched";
+
+    // Tile blockIdx.x, in row order, of the lower triangle of tiles, transposed for an upper AP,
+    // of matrix blockIdx.z of the batch
+    template <int TILE, bool HERM, bool TWO, typename T, typename TScal>
+    ROCBLAS_KERNEL(TILE* TILE)
+    rocblas_sprk_kernel(bool           is_upper,
+                        rocblas_int    n,
+                        rocblas_int    k,
+                        TScal          alpha_device_host,
+                        const T*       X,
+                        int64_t        ldx,
+                        rocblas_stride stride_x,
+                        const T*       Y,
+                        int64_t        ldy,
+                        rocblas_stride stride_y,
+                        T*             AP,
+                        rocblas_stride stride_ap)
+    {
+        __shared__ T sxr[TILE][TILE + 1];
+        __shared__ T sxc[TILE][TILE + 1];
+        __shared__ T syr[TWO ? TILE : 1][TILE + 1];
+        __shared__ T syc[TWO ? TILE : 1][TILE + 1];
+
+        auto alpha = load_scalar(alpha_device_host);
+        if(alpha == 0)
+            return;
+
+        int ti = 0, tj = blockIdx.x;
+        while(tj > ti)
+            tj -= ++ti;
+
+        X  = load_ptr_batch(X, blockIdx.z, stride_x);
+        AP = load_ptr_batch(AP, blockIdx.z, stride_ap);
+        if(TWO)
+            Y = load_ptr_batch(Y, blockIdx.z, stride_y);
+
+        // element (i, j) of the stored triangle, rows rb and columns cb of the tile
+        int     tx = threadIdx.x % TILE, ty = threadIdx.x / TILE;
+        int64_t rb = int64_t(is_upper ? tj : ti) * TILE;
+        int64_t cb = int64_t(is_upper ? ti : tj) * TILE;
+
+        auto load = [&](const T* V, int64_t ldv, int64_t r, int64_t l) {
+            return r < n && l < k ? V[r + l * ldv] : T(0);
+        };
+
+        // s1 = sum_l X(i, l) * Y(j, l), s2 = sum_l Y(i, l) * X(j, l), conjugating the Y and X
+        // of column j for a Hermitian AP, and Y = X for a rank-k update
+        T s1 = 0, s2 = 0;
+        for(int64_t l0 = 0; l0 < k; l0 += TILE)
+        {
+            sxr[ty][tx] = load(X, ldx, rb + tx, l0 + ty);
+            sxc[ty][tx] = conj_if_true<HERM>(load(X, ldx, cb + tx, l0 + ty));
+            if(TWO)
+            {
+                syr[ty][tx] = load(Y, ldy, rb + tx, l0 + ty);
+                syc[ty][tx] = conj_if_true<HERM>(load(Y, ldy, cb + tx, l0 + ty));
+            }
+            __syncthreads();
+
+            for(int l = 0; l < TILE; l++)
+            {
+                if(TWO)
+                {
+                    s1 += sxr[l][tx] * syc[l][ty];
+                    s2 += syr[l][tx] * sxc[l][ty];
+                }
+                else
+                    s1 += sxr[l][tx] * sxc[l][ty];
+            }
+            __syncthreads();
+        }
+
+        int64_t i = rb + tx, j = cb + ty;
+        if(i >= n || j >= n || (is_upper ? i > j : i < j))
+            return;
+
+        T  update = TWO ? alpha * s1 + conj_if_true<HERM>(alpha) * s2 : alpha * s1;
+        T* a      = AP + rocblas_packed_index(is_upper, n, i, j);
+        *a += update;
+        if(HERM && i == j)
+            *a = std::real(*a);
+    }
+
+    template <bool HERM, bool TWO, typename T, typename U>
+    rocblas_status rocblas_sprk_impl(rocblas_handle handle,
+                                     rocblas_fill   uplo,
+                                     rocblas_int    n,
+                                     rocblas_int    k,
+                                     const U*       alpha,
+                                     const T*       X,
+                                     rocblas_int    ldx,
+                                     rocblas_stride stride_x,
+                                     const T*       Y,
+                                     rocblas_int    ldy,
+                                     rocblas_stride stride_y,
+                                     T*             AP,
+                                     rocblas_stride stride_ap,
+                                     rocblas_int    batch_count)
+    {
+        static constexpr int TILE = rocblas_is_complex<T> ? 16 : 32;
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // row major order, see rocblas_set_order, has no column major mapping here
+        RETURN_NOT_IMPLEMENTED_IF_ROW_MAJOR(handle);
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        {
+            if(TWO)
+                log_trace(handle,
+                          rocblas_sprk_name<HERM, TWO, T>,
+                          uplo,
+                          n,
+                          k,
+                          LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                          X,
+                          ldx,
+                          stride_x,
+                          Y,
+                          ldy,
+                          stride_y,
+                          AP,
+                          stride_ap,
+                          batch_count);
+            else
+                log_trace(handle,
+                          rocblas_sprk_name<HERM, TWO, T>,
+                          uplo,
+                          n,
+                          k,
+                          LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                          X,
+                          ldx,
+                          stride_x,
+                          AP,
+                          stride_ap,
+                          batch_count);
+        }
+
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_invalid_value;
+
+        if(n < 0 || k < 0 || ldx < std::max(n, 1) || (TWO && ldy < std::max(n, 1))
+           || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        if(!n || !k || !batch_count)
+            return rocblas_status_success;
+        if(!alpha)
+            return rocblas_status_invalid_pointer;
+        if(handle->pointer_mode == rocblas_pointer_mode_host && *alpha == 0)
+            return rocblas_status_success;
+        if(!AP || !X || (TWO && !Y))
+            return rocblas_status_invalid_pointer;
+
+        int64_t     tiles  = (n - 1) / TILE + 1;
+        hipStream_t stream = handle->get_stream();
+        bool        upper  = uplo == rocblas_fill_upper;
+
+        for(int64_t b_base = 0; b_base < batch_count; b_base += c_i64_grid_YZ_chunk)
+        {
+            int32_t  batches = int32_t(std::min(batch_count - b_base, c_i64_grid_YZ_chunk));
+            dim3     grid(tiles * (tiles + 1) / 2, 1, batches);
+            const T* Yb      = TWO ? Y + b_base * stride_y : nullptr;
+
+            if(handle->pointer_mode == rocblas_pointer_mode_device)
+                ROCBLAS_LAUNCH_KERNEL((rocblas_sprk_kernel<TILE, HERM, TWO>),
+                                      grid,
+                                      dim3(TILE * TILE),
+                                      0,
+                                      stream,
+                                      upper,
+                                      n,
+                                      k,
+                                      alpha,
+                                      X + b_base * stride_x,
+                                      ldx,
+                                      stride_x,
+                                      Yb,
+                                      ldy,
+                                      stride_y,
+                                      AP + b_base * stride_ap,
+                                      stride_ap);
+            else
+                ROCBLAS_LAUNCH_KERNEL((rocblas_sprk_kernel<TILE, HERM, TWO>),
+                                      grid,
+                                      dim3(TILE * TILE),
+                                      0,
+                                      stream,
+                                      upper,
+                                      n,
+                                      k,
+                                      *alpha,
+                                      X + b_base * stride_x,
+                                      ldx,
+                                      stride_x,
+                                      Yb,
+                                      ldy,
+                                      stride_y,
+                                      AP + b_base * stride_ap,
+                                      stride_ap);
+        }
+
+        return rocblas_status_success;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#ifdef IMPL_2K
+#error IMPL_2K ALREADY DEFINED
+#endif
+
+#define IMPL(name_, HERM_, T_, U_)                                     \
+    rocblas_status name_(rocblas_handle handle,                        \
+                         rocblas_fill   uplo,                          \
+                         rocblas_int    n,                             \
+                         rocblas_int    k,                             \
+                         const U_*      alpha,                         \
+                         const T_*      X,                             \
+                         rocblas_int    ldx,                           \
+                         rocblas_stride stride_x,                      \
+                         T_*            AP,                            \
+                         rocblas_stride stride_ap,                     \
+                         rocblas_int    batch_count)                   \
+    try                                                                \
+    {                                                                  \
+        return rocblas_sprk_impl<HERM_, false, T_>(handle,             \
+                                                   uplo,               \
+                                                   n,                  \
+                                                   k,                  \
+                                                   alpha,              \
+                                                   X,                  \
+                                                   ldx,                \
+                                                   stride_x,           \
+                                                   (const T_*)nullptr, \
+                                                   0,                  \
+                                                   0,                  \
+                                                   AP,                 \
+                                                   stride_ap,          \
+                                                   batch_count);       \
+    }                                                                  \
+    catch(...)                                                         \
+    {                                                                  \
+        return exception_to_rocblas_status();                          \
+    }
+
+#define IMPL_2K(name_, HERM_, T_)                               \
+    rocblas_status name_(rocblas_handle handle,                 \
+                         rocblas_fill   uplo,                   \
+                         rocblas_int    n,                      \
+                         rocblas_int    k,                      \
+                         const T_*      alpha,                  \
+                         const T_*      X,                      \
+                         rocblas_int    ldx,                    \
+                         rocblas_stride stride_x,               \
+                         const T_*      Y,                      \
+                         rocblas_int    ldy,                    \
+                         rocblas_stride stride_y,               \
+                         T_*            AP,                     \
+                         rocblas_stride stride_ap,              \
+                         rocblas_int    batch_count)            \
+    try                                                         \
+    {                                                           \
+        return rocblas_sprk_impl<HERM_, true, T_>(handle,       \
+                                                  uplo,         \
+                                                  n,            \
+                                                  k,            \
+                                                  alpha,        \
+                                                  X,            \
+                                                  ldx,          \
+                                                  stride_x,     \
+                                                  Y,            \
+                                                  ldy,          \
+                                                  stride_y,     \
+                                                  AP,           \
+                                                  stride_ap,    \
+                                                  batch_count); \
+    }                                                           \
+    catch(...)                                                  \
+    {                                                           \
+        return exception_to_rocblas_status();                   \
+    }
+
+extern "C" {
+
+IMPL(rocblas_ssprk_strided_batched, false, float, float);
+IMPL(rocblas_dsprk_strided_batched, false, double, double);
+IMPL(rocblas_csprk_strided_batched, false, rocblas_float_complex, rocblas_float_complex);
+IMPL(rocblas_zsprk_strided_batched, false, rocblas_double_complex, rocblas_double_complex);
+IMPL(rocblas_chprk_strided_batched, true, rocblas_float_complex, float);
+IMPL(rocblas_zhprk_strided_batched, true, rocblas_double_complex, double);
+
+IMPL_2K(rocblas_sspr2k_strided_batched, false, float);
+IMPL_2K(rocblas_dspr2k_strided_batched, false, double);
+IMPL_2K(rocblas_chpr2k_strided_batched, true, rocblas_float_complex);
+IMPL_2K(rocblas_zhpr2k_strided_batched, true, rocblas_double_complex);
+
+} // extern "C"
+
+#undef IMPL_2K
+#undef IMPL
@@ -0,0 +1,46 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "utility.hpp"
+
+/**
+  *  Offset of element (i, j) of the uplo triangle of an n by n matrix in packed storage, as
+  *  read by tpmv, tpsv, spmv, hpmv, spr and hpr: the columns of the triangle are stored one
+  *  after another.
+  */
+ROCBLAS_KERNEL_ILF size_t rocblas_packed_index(bool is_upper, int64_t n, int64_t i, int64_t j)
+{
+    return is_upper ? (size_t(j) * (j + 1)) / 2 + i
+                    : size_t(j) * n + (i - j) - (size_t(j) * (j - 1)) / 2;
+}
+
+/**
+  *  Offset of element (i, j) of a band matrix, as read by gbmv, sbmv, hbmv and tbmv: column j
+  *  is stored in column j of the band, and diagonal d = off + i - j in its row d, with
+  *  off = ku for general and upper triangular band matrices and off = 0 for lower ones.
+  */
+ROCBLAS_KERNEL_ILF size_t rocblas_band_index(int64_t off, int64_t i, int64_t j, int64_t lda)
+{
+    return size_t(off + i - j) + j * lda;
+}
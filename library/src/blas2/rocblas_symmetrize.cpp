@@ -0,0 +1,189 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "int64_helpers.hpp"
+#include "logging.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    template <bool, typename>
+    constexpr char rocblas_symmetrize_name[] = "unknown";
+    template <>
+    constexpr char rocblas_symmetrize_name<false, float>[] = "rocblas_ssymmetrize_strided_batched";
+    template <>
+    constexpr char rocblas_symmetrize_name<false, double>[] = "rocblas_dsymmetrize_strided_batched";
+    template <>
+    constexpr char rocblas_symmetrize_name<false, rocblas_float_complex>[]
+        = "rocblas_csymmetrize_strided_batched";
+    template <>
+    constexpr char rocblas_symmetrize_name<false, rocblas_double_complex>[]
+        = "rocblas_zsymmetrize_strided_batched";
+    template <>
+    constexpr char rocblas_symmetrize_name<true, rocblas_float_complex>[]
+        = "rocblas_chermitize_strided_batched";
+    template <>
+    constexpr char rocblas_symmetrize_name<true, rocblas_double_complex>[]
+        = "rocblas_zhermitize_strided_batched";
+
+    // Mirrors the uplo triangle of matrix blockIdx.z of the batch onto the other triangle, as
+    // its conjugate for a Hermitian matrix, whose diagonal is made real. A tile is read from the
+    // uplo triangle into LDS and written transposed, so that both the reads and the writes are
+    // of consecutive elements of a column.
+    template <int DIM, bool HERM, typename T>
+    ROCBLAS_KERNEL(DIM* DIM)
+    rocblas_symmetrize_kernel(bool           is_upper,
+                              rocblas_int    n,
+                              T*             A,
+                              int64_t        lda,
+                              rocblas_stride stride_a)
+    {
+        __shared__ T tile[DIM][DIM + 1];
+
+        // the tile (ti, tj), ti >= tj, of the lower triangle of tiles, blockIdx.x in row order
+        int ti = 0, tj = blockIdx.x;
+        while(tj > ti)
+            tj -= ++ti;
+
+        A = load_ptr_batch(A, blockIdx.z, stride_a);
+
+        // source element (r, c) of the uplo triangle, destination element (c, r)
+        int     tx = threadIdx.x, ty = threadIdx.y;
+        int64_t r  = int64_t(is_upper ? tj : ti) * DIM + tx;
+        int64_t c  = int64_t(is_upper ? ti : tj) * DIM + ty;
+        if(r < n && c < n)
+            tile[ty][tx] = A[c * lda + r];
+        __syncthreads();
+
+        int64_t i = int64_t(is_upper ? ti : tj) * DIM + tx;
+        int64_t j = int64_t(is_upper ? tj : ti) * DIM + ty;
+        if(i >= n || j >= n)
+            return;
+
+        if(i == j)
+        {
+            if(HERM)
+                A[j * lda + i] = std::real(A[j * lda + i]);
+        }
+        else if(is_upper ? i > j : i < j)
+            A[j * lda + i] = conj_if_true<HERM>(tile[tx][ty]);
+    }
+
+    template <bool HERM, typename T>
+    rocblas_status rocblas_symmetrize_impl(rocblas_handle handle,
+                                           rocblas_fill   uplo,
+                                           rocblas_int    n,
+                                           T*             A,
+                                           rocblas_int    lda,
+                                           rocblas_stride stride_a,
+                                           rocblas_int    batch_count)
+    {
+        static constexpr int DIM = 32;
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // row major order, see rocblas_set_order, has no column major mapping here
+        RETURN_NOT_IMPLEMENTED_IF_ROW_MAJOR(handle);
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(
+                handle, rocblas_symmetrize_name<HERM, T>, uplo, n, A, lda, stride_a, batch_count);
+
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_invalid_value;
+
+        if(n < 0 || lda < std::max(n, 1) || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        if(!n || !batch_count)
+            return rocblas_status_success;
+
+        if(!A)
+            return rocblas_status_invalid_pointer;
+
+        int64_t tiles = (n - 1) / DIM + 1;
+
+        for(int64_t b_base = 0; b_base < batch_count; b_base += c_i64_grid_YZ_chunk)
+        {
+            int32_t batches = int32_t(std::min(batch_count - b_base, c_i64_grid_YZ_chunk));
+
+            ROCBLAS_LAUNCH_KERNEL((rocblas_symmetrize_kernel<DIM, HERM>),
+                                  dim3(tiles * (tiles + 1) / 2, 1, batches),
+                                  dim3(DIM, DIM),
+                                  0,
+                                  handle->get_stream(),
+                                  uplo == rocblas_fill_upper,
+                                  n,
+                                  A + b_base * stride_a,
+                                  lda,
+                                  stride_a);
+        }
+
+        return rocblas_status_success;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(name_, HERM_, T_)                                                                 \
+    rocblas_status name_(rocblas_handle handle,                                                \
+                         rocblas_fill   uplo,                                                  \
+                         rocblas_int    n,                                                     \
+                         T_*            A,                                                     \
+                         rocblas_int    lda,                                                   \
+                         rocblas_stride stride_a,                                              \
+                         rocblas_int    batch_count)                                           \
+    try                                                                                        \
+    {                                                                                          \
+        return rocblas_symmetrize_impl<HERM_, T_>(                                             \
+            handle, uplo, n, A, lda, stride_a, batch_count);                                   \
+    }                                                                                          \
+    catch(...)                                                                                 \
+    {                                                                                          \
+        return exception_to_rocblas_status();                                                  \
+    }
+
+extern "C" {
+
+IMPL(rocblas_ssymmetrize_strided_batched, false, float);
+IMPL(rocblas_dsymmetrize_strided_batched, false, double);
+IMPL(rocblas_csymmetrize_strided_batched, false, rocblas_float_complex);
+IMPL(rocblas_zsymmetrize_strided_batched, false, rocblas_double_complex);
+IMPL(rocblas_chermitize_strided_batched, true, rocblas_float_complex);
+IMPL(rocblas_zhermitize_strided_batched, true, rocblas_double_complex);
+
+} // extern "C"
+
+#undef IMPL
@@ -57,13 +57,20 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        // row major A is column major A^T = A, of the other triangle, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+        {
+            uplo = rocblas_row_major_fill(uplo);
+        }
+
         auto check_numerics = handle->check_numerics;
+        rocblas_api_scope api_scope(handle, rocblas_symv_name<T>);
         if(!handle->is_device_memory_size_query())
         {
             auto layer_mode = handle->layer_mode;
             if(layer_mode
                & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-                  | rocblas_layer_mode_log_profile))
+                  | rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             {
                 auto uplo_letter = rocblas_fill_letter(uplo);
 
@@ -98,7 +105,7 @@ namespace
                               "--incy",
                               incy);
 
-                if(layer_mode & rocblas_layer_mode_log_profile)
+                if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                     log_profile(handle,
                                 rocblas_symv_name<T>,
                                 "uplo",
@@ -120,7 +127,7 @@ namespace
             return arg_status;
 
         //allocating the workspace identical to hemv
-        size_t dev_bytes = rocblas_internal_hemv_symv_kernel_workspace_size<T>(n);
+        size_t dev_bytes = rocblas_hemv_symv_workspace_size<T>(handle, uplo, n);
         if(handle->is_device_memory_size_query())
             return handle->set_optimal_device_memory_size(dev_bytes);
 
@@ -65,14 +65,21 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        // row major A is column major A^T = A, of the other triangle, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+        {
+            uplo = rocblas_row_major_fill(uplo);
+        }
+
         auto check_numerics = handle->check_numerics;
 
+        rocblas_api_scope api_scope(handle, rocblas_symv_strided_batched_name<T>);
         if(!handle->is_device_memory_size_query())
         {
             auto layer_mode = handle->layer_mode;
             if(layer_mode
                & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-                  | rocblas_layer_mode_log_profile))
+                  | rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             {
                 auto uplo_letter = rocblas_fill_letter(uplo);
 
@@ -119,7 +126,7 @@ namespace
                               "--batch_count",
                               batch_count);
 
-                if(layer_mode & rocblas_layer_mode_log_profile)
+                if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                     log_profile(handle,
                                 rocblas_symv_strided_batched_name<T>,
                                 "uplo",
@@ -167,7 +174,7 @@ namespace
             return arg_status;
 
         //allocating the workspace identical to hemv
-        size_t dev_bytes = rocblas_internal_hemv_symv_kernel_workspace_size<T>(n, batch_count);
+        size_t dev_bytes = rocblas_hemv_symv_workspace_size<T>(handle, uplo, n, batch_count);
         if(handle->is_device_memory_size_query())
             return handle->set_optimal_device_memory_size(dev_bytes);
 
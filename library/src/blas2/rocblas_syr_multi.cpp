@@ -0,0 +1,197 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "../blas3/rocblas_gemm.hpp"
+#include "../blas3/rocblas_syrk_herk.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas_her.hpp"
+#include "rocblas_syr.hpp"
+
+namespace
+{
+    template <bool, typename>
+    constexpr char rocblas_syr_multi_name[] = "unknown";
+    template <>
+    constexpr char rocblas_syr_multi_name<false, float>[] = "rocblas_ssyr_multi";
+    template <>
+    constexpr char rocblas_syr_multi_name<false, double>[] = "rocblas_dsyr_multi";
+    template <>
+    constexpr char rocblas_syr_multi_name<false, rocblas_float_complex>[] = "rocblas_csyr_multi";
+    template <>
+    constexpr char rocblas_syr_multi_name<false, rocblas_double_complex>[] = "rocblas_zsyr_multi";
+    template <>
+    constexpr char rocblas_syr_multi_name<true, rocblas_float_complex>[] = "rocblas_cher_multi";
+    template <>
+    constexpr char rocblas_syr_multi_name<true, rocblas_double_complex>[] = "rocblas_zher_multi";
+
+    // A = alpha * X * X**T + A (syr) or A = alpha * X * X**H + A (her, with a real alpha)
+    template <bool HERM, typename T, typename U>
+    rocblas_status rocblas_syr_multi_impl(rocblas_handle handle,
+                                          rocblas_fill   uplo,
+                                          rocblas_int    n,
+                                          rocblas_int    k,
+                                          const U*       alpha,
+                                          const T*       X,
+                                          rocblas_int    ldx,
+                                          T*             A,
+                                          rocblas_int    lda)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // row major order, see rocblas_set_order, has no column major mapping here
+        RETURN_NOT_IMPLEMENTED_IF_ROW_MAJOR(handle);
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_syr_multi_name<HERM, T>,
+                      uplo,
+                      n,
+                      k,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      X,
+                      ldx,
+                      A,
+                      lda);
+
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_invalid_value;
+
+        if(n < 0 || k < 0 || ldx < std::max(n, 1) || lda < std::max(n, 1))
+            return rocblas_status_invalid_size;
+
+        if(!n || !k)
+            return rocblas_status_success;
+
+        if(!alpha)
+            return rocblas_status_invalid_pointer;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host && *alpha == 0)
+            return rocblas_status_success;
+
+        if(!A || !X)
+            return rocblas_status_invalid_pointer;
+
+        // a single update is left to the syr and her kernels, which need no copy of a device
+        // alpha
+        if(k == 1)
+        {
+            if constexpr(HERM)
+                return rocblas_her_launcher(handle, uplo, n, alpha, X, 0, 1, 0, A, 0, lda, 0, 1);
+            else
+                return rocblas_internal_syr_template<T>(
+                    handle, uplo, n, alpha, 0, X, 0, 1, 0, A, 0, lda, 0, 1);
+        }
+
+        // the triangle of A is read and written once for all k updates
+        U        alpha_h, beta_h;
+        const U* beta = nullptr;
+        RETURN_IF_ROCBLAS_ERROR(
+            rocblas_copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, k));
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        if(*alpha == 0)
+            return rocblas_status_success;
+
+        const U one(1);
+        if constexpr(HERM)
+            return rocblas_internal_herk_template(handle,
+                                                  uplo,
+                                                  rocblas_operation_none,
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  X,
+                                                  0,
+                                                  ldx,
+                                                  0,
+                                                  &one,
+                                                  A,
+                                                  0,
+                                                  lda,
+                                                  0,
+                                                  1);
+        else
+            return rocblas_internal_syrk_template(handle,
+                                                  uplo,
+                                                  rocblas_operation_none,
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  X,
+                                                  0,
+                                                  ldx,
+                                                  0,
+                                                  &one,
+                                                  A,
+                                                  0,
+                                                  lda,
+                                                  0,
+                                                  1);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(name_, HERM_, T_, U_)                                                            \
+    rocblas_status name_(rocblas_handle handle,                                               \
+                         rocblas_fill   uplo,                                                 \
+                         rocblas_int    n,                                                    \
+                         rocblas_int    k,                                                    \
+                         const U_*      alpha,                                                \
+                         const T_*      X,                                                    \
+                         rocblas_int    ldx,                                                  \
+                         T_*            A,                                                    \
+                         rocblas_int    lda)                                                  \
+    try                                                                                       \
+    {                                                                                         \
+        return rocblas_syr_multi_impl<HERM_, T_>(handle, uplo, n, k, alpha, X, ldx, A, lda);  \
+    }                                                                                         \
+    catch(...)                                                                                \
+    {                                                                                         \
+        return exception_to_rocblas_status();                                                 \
+    }
+
+extern "C" {
+
+IMPL(rocblas_ssyr_multi, false, float, float);
+IMPL(rocblas_dsyr_multi, false, double, double);
+IMPL(rocblas_csyr_multi, false, rocblas_float_complex, rocblas_float_complex);
+IMPL(rocblas_zsyr_multi, false, rocblas_double_complex, rocblas_double_complex);
+IMPL(rocblas_cher_multi, true, rocblas_float_complex, float);
+IMPL(rocblas_zher_multi, true, rocblas_double_complex, double);
+
+} // extern "C"
+
+#undef IMPL
@@ -24,136 +24,14 @@
 #include "../blas1/rocblas_copy_kernels.hpp"
 #include "check_numerics_vector.hpp"
 #include "handle.hpp"
+#include "rocblas_band_device.hpp"
 #include "rocblas_tbmv.hpp"
 
-/**
-  *  Helper for the non-transpose case. Iterates through each diagonal
-  *  and creates partial sums for each ty.
-  */
-template <rocblas_int DIM_Y, typename T>
-__device__ T rocblas_tbmvn_kernel_helper(rocblas_int ty,
-                                         rocblas_int ind,
-                                         bool        is_upper,
-                                         bool        is_unit_diag,
-                                         rocblas_int n,
-                                         rocblas_int k,
-                                         const T*    A,
-                                         int64_t     lda,
-                                         const T*    w_x_copy)
-{
-    T           res_A = 0.0;
-    rocblas_int col;
-
-    // Since the column is consistent, we can iterate up the diagonal
-    // ty defines the column of banded & regular matrix
-    for(col = ty; col < n; col += DIM_Y)
-    {
-        // We have to convert ind to banded matrix row
-        rocblas_int row = is_upper ? ind + (k - col) : ind - col;
-
-        if(ind < n)
-        {
-            // Regular case, simply multiply
-            if(row < k && row > 0)
-            {
-                res_A += (A[row + col * size_t(lda)] * w_x_copy[col]);
-            }
-            else if(row == 0)
-            {
-                // If main diagonal && diag, don't reference matrix, assume 1.
-                if(is_unit_diag && (!is_upper || k == 0 && is_upper))
-                    res_A += w_x_copy[col];
-                else
-                    res_A += (A[row + col * size_t(lda)] * w_x_copy[col]);
-            }
-            else if(row == k)
-            {
-                // If diag, don't reference matrix, assume 1.
-                if(is_unit_diag && is_upper)
-                    res_A += w_x_copy[col];
-                else
-                    res_A += (A[row + col * size_t(lda)] * w_x_copy[col]);
-            }
-        }
-    }
-    return res_A;
-}
-
-/**
-  *  Helper for the (conjugate-)transpose case. Iterates through each diagonal
-  *  and creates partial sums for each ty.
-  *  The conjugate basically switches A from upper -> lower or lower -> upper
-  *  triangular matrix. Since A is compressed, the indexing changes, and we
-  *  basically just iterate down columns.
-  */
-template <rocblas_int DIM_Y, typename T>
-__device__ T rocblas_tbmvt_kernel_helper(bool        CONJ,
-                                         rocblas_int ty,
-                                         rocblas_int ind,
-                                         bool        is_upper,
-                                         bool        is_unit_diag,
-                                         rocblas_int n,
-                                         rocblas_int k,
-                                         const T*    A,
-                                         int64_t     lda,
-                                         const T*    w_x_copy)
-{
-    T           res_A = 0.0;
-    rocblas_int row;
-
-    // for transpose case, ty defines the row
-    for(row = ty; row < lda && row <= k; row += DIM_Y)
-    {
-        // We have to convert ind to banded matrix row
-        rocblas_int col = ind;
-
-        if(col < n)
-        {
-            if(is_upper)
-            {
-                // Regular case
-                rocblas_int min_row = k - col;
-                // cppcheck-suppress knownConditionTrueFalse
-                if(row < k && row >= k - col && row != k)
-                {
-                    res_A += ((CONJ ? conj(A[row + col * size_t(lda)]) : A[row + col * size_t(lda)])
-                              * w_x_copy[row - min_row]);
-                }
-                else if(row == k)
-                {
-                    // if main diagonal && diag then don't reference A, assume 1.
-                    if(is_unit_diag)
-                        res_A += w_x_copy[row - min_row];
-                    else
-                        res_A += ((CONJ ? conj(A[row + col * size_t(lda)])
-                                        : A[row + col * size_t(lda)])
-                                  * w_x_copy[row - min_row]);
-                }
-            }
-            else
-            {
-                if(row <= k && row <= n - 1 - col && row > 0)
-                {
-                    res_A += ((CONJ ? conj(A[row + col * size_t(lda)]) : A[row + col * size_t(lda)])
-                              * w_x_copy[row + col]);
-                }
-                else if(row == 0)
-                {
-                    if(is_unit_diag)
-                        res_A += w_x_copy[row + col];
-                    else
-                        res_A += ((CONJ ? conj(A[row + col * size_t(lda)])
-                                        : A[row + col * size_t(lda)])
-                                  * w_x_copy[row + col]);
-                }
-            }
-        }
-    }
-    return res_A;
-}
-
 /**
   *  A combined kernel to handle all tbmv cases (transpose, conjugate, normal).
+  *  Each thread block computes DIM_X elements of x from the copy w_x_copy: the strict triangle
+  *  is applied along its rows in the normal case and along its columns in the
+  *  (conjugate-)transpose case, and the main diagonal is added separately as it may be unit.
   */
 template <rocblas_int DIM_X, rocblas_int DIM_Y, typename T>
 ROCBLAS_KERNEL_ILF void rocblas_tbmvx_kernel_calc(rocblas_operation transA,
@@ -167,51 +45,40 @@ ROCBLAS_KERNEL_ILF void rocblas_tbmvx_kernel_calc(rocblas_operation transA,
                                                   T*                x,
                                                   int64_t           incx)
 {
-    rocblas_int thread_id = threadIdx.x + threadIdx.y * blockDim.x;
-
-    // threads are all configurated locally
-    // Create "tilted" blocks. With the compaction, each diagonal,
-    // (from top right to bottom left) is like a row in a normal
-    // matrix, so the blocks are "tilted" to the right.
-    rocblas_int tx = thread_id % DIM_X;
-    rocblas_int ty = thread_id / DIM_X;
+    rocblas_int ind = blockIdx.x * DIM_X + threadIdx.x;
 
-    rocblas_int ind = blockIdx.x * DIM_X + tx;
+    // the main diagonal is on stored row k of upper and row 0 of lower band storage
+    rocblas_int off     = is_upper ? k : 0;
+    rocblas_int d_begin = is_upper ? 0 : 1;
+    rocblas_int d_end   = is_upper ? k : k + 1;
 
-    __shared__ T sdata[DIM_X * DIM_Y];
-
-    T res_A = 0.0;
-    // Indexing is different for transpose/non-transpose case. To keep it clean
-    // it's separated in two helper functions. They could potentially be combined
-    // if more elegant logic is used.
+    T res_A;
     if(transA == rocblas_operation_none)
-    {
-        res_A = rocblas_tbmvn_kernel_helper<DIM_Y>(
-            ty, ind, is_upper, is_unit_diag, n, k, A, lda, w_x_copy);
-    }
+        res_A = rocblas_band_rows_tile<DIM_X, DIM_Y>(
+            n, n, off, d_begin, d_end, A, lda, w_x_copy, 1);
+    else if(transA == rocblas_operation_transpose)
+        res_A = rocblas_band_cols_tile<DIM_X, DIM_Y, false>(
+            n, n, off, d_begin, d_end, A, lda, w_x_copy, 1);
     else
+        res_A = rocblas_band_cols_tile<DIM_X, DIM_Y, true>(
+            n, n, off, d_begin, d_end, A, lda, w_x_copy, 1);
+
+    if(threadIdx.y == 0 && ind < n)
     {
-        bool CONJ = transA == rocblas_operation_conjugate_transpose;
-        res_A     = rocblas_tbmvt_kernel_helper<DIM_Y>(
-            CONJ, ty, ind, is_upper, is_unit_diag, n, k, A, lda, w_x_copy);
+        // If unit diagonal, don't reference matrix, assume 1.
+        if(is_unit_diag)
+            res_A += w_x_copy[ind];
+        else if(transA == rocblas_operation_conjugate_transpose)
+            res_A += conj(A[off + ind * lda]) * w_x_copy[ind];
+        else
+            res_A += A[off + ind * lda] * w_x_copy[ind];
     }
-    // Store partial sums for the diagonal
-    sdata[tx + ty * DIM_X] = res_A;
-    __syncthreads();
 
-    thread_id = threadIdx.x + threadIdx.y * blockDim.x;
-    ind       = blockIdx.x * DIM_X + thread_id;
-    if(thread_id < DIM_X && ind < n)
-    {
-        // Add the partial sums of each diagonal and store
-        for(rocblas_int i = 1; i < DIM_Y; i++)
-        {
-            sdata[thread_id] += sdata[thread_id + DIM_X * i];
-        }
+    res_A = rocblas_band_tile_sum<DIM_X, DIM_Y>(res_A);
 
-        // Update x.
-        x[ind * int64_t(incx)] = (sdata[thread_id]);
-    }
+    // Update x.
+    if(threadIdx.y == 0 && ind < n)
+        x[ind * incx] = res_A;
 }
 
 /**
@@ -333,15 +200,13 @@ rocblas_status rocblas_internal_tbmv_launcher(rocblas_handle    handle,
     // in case of negative inc shift pointer to end of data for negative indexing tid*inc
     ptrdiff_t shiftx = incx < 0 ? offsetx - ptrdiff_t(incx) * (n - 1) : offsetx;
 
-    // (gemv) TBMVX_DIM_Y must be at least 4, 8 * 8 is very slow only 40Gflop/s
-    static constexpr int TBMVX_DIM_X = 64;
-    static constexpr int TBMVX_DIM_Y = 16;
+    static constexpr int TBMVX_DIM_X = 32;
+    static constexpr int TBMVX_DIM_Y = 8;
     rocblas_int          blocks      = (n - 1) / (TBMVX_DIM_X) + 1;
     dim3                 tbmvx_grid(blocks, batch_count);
     dim3                 tbmvx_threads(TBMVX_DIM_X, TBMVX_DIM_Y);
 
-    // Launch a modified gemv kernel. The logic is similar to gemv just with modified
-    // indices for the banded matrices.
+    // Launch the tiled banded kernel
     ROCBLAS_LAUNCH_KERNEL((rocblas_tbmvx_kernel<TBMVX_DIM_X, TBMVX_DIM_Y>),
                           tbmvx_grid,
                           tbmvx_threads,
@@ -59,10 +59,21 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        // row major op(A) is op(A)^T of column major A, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+        {
+            if(rocblas_is_complex<T> && transA == rocblas_operation_conjugate_transpose)
+                return rocblas_status_not_implemented;
+            uplo   = rocblas_row_major_fill(uplo);
+            transA = rocblas_row_major_transpose<T>(transA);
+        }
+
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+
+        rocblas_api_scope api_scope(handle, rocblas_tbsv_name<T>);
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle,
                       rocblas_tbsv_name<T>,
@@ -79,7 +90,9 @@ namespace
                       stride_x,
                       batch_count);
 
-        if(layer_mode & (rocblas_layer_mode_log_bench | rocblas_layer_mode_log_profile))
+        if(layer_mode
+           & (rocblas_layer_mode_log_bench | rocblas_layer_mode_log_profile
+              | rocblas_layer_mode_roctx))
         {
             auto uplo_letter   = rocblas_fill_letter(uplo);
             auto transA_letter = rocblas_transpose_letter(transA);
@@ -113,7 +126,7 @@ namespace
                               batch_count);
             }
 
-            if(layer_mode & rocblas_layer_mode_log_profile)
+            if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                 log_profile(handle,
                             rocblas_tbsv_name<T>,
                             "uplo",
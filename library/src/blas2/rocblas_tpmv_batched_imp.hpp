@@ -55,12 +55,22 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        // row major op(A) is op(A)^T of column major A, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+        {
+            if(rocblas_is_complex<T> && transa == rocblas_operation_conjugate_transpose)
+                return rocblas_status_not_implemented;
+            uplo   = rocblas_row_major_fill(uplo);
+            transa = rocblas_row_major_transpose<T>(transa);
+        }
+
+        rocblas_api_scope api_scope(handle, rocblas_tpmv_batched_name<T>);
         if(!handle->is_device_memory_size_query())
         {
             auto layer_mode = handle->layer_mode;
             if(layer_mode
                & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-                  | rocblas_layer_mode_log_profile))
+                  | rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             {
                 auto uplo_letter   = rocblas_fill_letter(uplo);
                 auto transa_letter = rocblas_transpose_letter(transa);
@@ -98,7 +108,7 @@ namespace
                               batch_count);
                 }
 
-                if(layer_mode & rocblas_layer_mode_log_profile)
+                if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                 {
                     log_profile(handle,
                                 rocblas_tpmv_batched_name<T>,
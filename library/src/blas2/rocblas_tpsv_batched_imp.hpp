@@ -55,9 +55,20 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        // row major op(A) is op(A)^T of column major A, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+        {
+            if(rocblas_is_complex<T> && transA == rocblas_operation_conjugate_transpose)
+                return rocblas_status_not_implemented;
+            uplo   = rocblas_row_major_fill(uplo);
+            transA = rocblas_row_major_transpose<T>(transA);
+        }
+
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
         auto layer_mode = handle->layer_mode;
+
+        rocblas_api_scope api_scope(handle, rocblas_tpsv_batched_name<T>);
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle,
                       rocblas_tpsv_batched_name<T>,
@@ -70,7 +81,9 @@ namespace
                       incx,
                       batch_count);
 
-        if(layer_mode & (rocblas_layer_mode_log_bench | rocblas_layer_mode_log_profile))
+        if(layer_mode
+           & (rocblas_layer_mode_log_bench | rocblas_layer_mode_log_profile
+              | rocblas_layer_mode_roctx))
         {
             auto uplo_letter   = rocblas_fill_letter(uplo);
             auto transA_letter = rocblas_transpose_letter(transA);
@@ -96,7 +109,7 @@ namespace
                               batch_count);
             }
 
-            if(layer_mode & rocblas_layer_mode_log_profile)
+            if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                 log_profile(handle,
                             rocblas_tpsv_batched_name<T>,
                             "uplo",
@@ -23,6 +23,7 @@
 #include "../blas1/rocblas_copy.hpp"
 #include "check_numerics_vector.hpp"
 #include "rocblas_tpsv.hpp"
+#include "rocblas_trsv_small_device.hpp"
 
 ROCBLAS_KERNEL_ILF inline size_t rocblas_packed_matrix_index(
     bool upper, bool is_transpose, rocblas_int n, rocblas_int row, rocblas_int col)
@@ -246,6 +247,90 @@ rocblas_tpsv_kernel(rocblas_operation transA,
         rocblas_tpsv_backward_substitution_calc<CONJ, BLK_SIZE>(is_unit_diag, true, n, AP, x, incx);
 }
 
+// Solves SYS systems with n <= NMAX per thread block, each unpacked to its triangle in LDS
+template <rocblas_int NMAX, rocblas_int SYS, bool CONJ, typename TConstPtr, typename TPtr>
+ROCBLAS_KERNEL(NMAX* SYS)
+rocblas_tpsv_small_kernel(bool           is_upper,
+                          bool           trans,
+                          bool           is_unit_diag,
+                          rocblas_int    n,
+                          TConstPtr      APa,
+                          rocblas_stride shift_A,
+                          rocblas_stride stride_A,
+                          TPtr           xa,
+                          rocblas_stride shift_x,
+                          int64_t        incx,
+                          rocblas_stride stride_x,
+                          rocblas_int    batch_count)
+{
+    using T = rocblas_batch_elem_t<TPtr>;
+
+    __shared__ T sA[SYS][NMAX * (NMAX + 1)];
+    __shared__ T sx[SYS][2];
+
+    const rocblas_int i      = threadIdx.x;
+    const rocblas_int sys    = threadIdx.y;
+    const uint32_t    batch  = blockIdx.x * SYS + sys;
+    const bool        active = batch < batch_count;
+
+    T xi = T(0);
+    if(active && i < n)
+    {
+        const auto* AP = load_ptr_batch(APa, batch, shift_A, stride_A);
+        const auto* x  = load_ptr_batch(xa, batch, shift_x, stride_x);
+
+        // each column of the triangle is contiguous in packed storage
+        for(rocblas_int col = 0; col < n; col++)
+            if(is_upper ? i <= col : i >= col)
+                sA[sys][col * (NMAX + 1) + i]
+                    = AP[rocblas_packed_matrix_index(is_upper, false, n, i, col)];
+
+        xi = x[i * incx];
+    }
+    __syncthreads();
+
+    xi = rocblas_trsv_small_solve<NMAX, CONJ>(
+        is_upper, trans, is_unit_diag, n, sA[sys], sx[sys], xi);
+
+    if(active && i < n)
+        load_ptr_batch(xa, batch, shift_x, stride_x)[i * incx] = xi;
+}
+
+template <rocblas_int NMAX, typename TConstPtr, typename TPtr>
+rocblas_status rocblas_tpsv_small_launcher(rocblas_handle    handle,
+                                           rocblas_fill      uplo,
+                                           rocblas_operation transA,
+                                           rocblas_diagonal  diag,
+                                           rocblas_int       n,
+                                           TConstPtr         A,
+                                           rocblas_stride    shift_A,
+                                           rocblas_stride    stride_A,
+                                           TPtr              x,
+                                           rocblas_stride    shift_x,
+                                           int64_t           incx,
+                                           rocblas_stride    stride_x,
+                                           rocblas_int       batch_count)
+{
+    using T                          = rocblas_batch_elem_t<TPtr>;
+    static constexpr rocblas_int SYS = rocblas_trsv_small_systems<NMAX, T>();
+
+    dim3 grid((batch_count - 1) / SYS + 1);
+    dim3 threads(NMAX, SYS);
+
+#define TPSV_SMALL_PARAMS                                                               \
+    grid, threads, 0, handle->get_stream(), uplo == rocblas_fill_upper,                 \
+        transA != rocblas_operation_none, diag == rocblas_diagonal_unit, n, A, shift_A, \
+        stride_A, x, shift_x, incx, stride_x, batch_count
+
+    if(transA == rocblas_operation_conjugate_transpose)
+        ROCBLAS_LAUNCH_KERNEL((rocblas_tpsv_small_kernel<NMAX, SYS, true>), TPSV_SMALL_PARAMS);
+    else
+        ROCBLAS_LAUNCH_KERNEL((rocblas_tpsv_small_kernel<NMAX, SYS, false>), TPSV_SMALL_PARAMS);
+#undef TPSV_SMALL_PARAMS
+
+    return rocblas_status_success;
+}
+
 template <typename TConstPtr, typename TPtr>
 rocblas_status rocblas_internal_tpsv_launcher(rocblas_handle    handle,
                                               rocblas_fill      uplo,
@@ -271,6 +356,17 @@ rocblas_status rocblas_internal_tpsv_launcher(rocblas_handle    handle,
     ptrdiff_t shift_x = incx < 0 ? offset_x - incx * (n - 1) : offset_x;
     ptrdiff_t shift_A = offset_A;
 
+    // small systems are solved in LDS, several per thread block
+    constexpr rocblas_int SMALL_N = rocblas_trsv_small_n<rocblas_batch_elem_t<TPtr>>();
+    if(n <= 32)
+        return rocblas_tpsv_small_launcher<32>(
+            handle, uplo, transA, diag, n, A, shift_A, stride_A, x, shift_x, incx, stride_x,
+            batch_count);
+    else if(n <= SMALL_N)
+        return rocblas_tpsv_small_launcher<SMALL_N>(
+            handle, uplo, transA, diag, n, A, shift_A, stride_A, x, shift_x, incx, stride_x,
+            batch_count);
+
     static constexpr rocblas_int NB = ROCBLAS_TPSV_NB;
 
     //Currently NB=512 and it should be NB > 256 as this is required or else we get incorrect behaviour.
@@ -0,0 +1,332 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "int64_helpers.hpp"
+#include "logging.hpp"
+#include "rocblas_storage_index.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    template <bool, typename>
+    constexpr char rocblas_tpttr_name[] = "unknown";
+    template <>
+    constexpr char rocblas_tpttr_name<true, float>[] = "rocblas_stpttr";
+    template <>
+    constexpr char rocblas_tpttr_name<true, double>[] = "rocblas_dtpttr";
+    template <>
+    constexpr char rocblas_tpttr_name<true, rocblas_float_complex>[] = "rocblas_ctpttr";
+    template <>
+    constexpr char rocblas_tpttr_name<true, rocblas_double_complex>[] = "rocblas_ztpttr";
+    template <>
+    constexpr char rocblas_tpttr_name<false, float>[] = "rocblas_strttp";
+    template <>
+    constexpr char rocblas_tpttr_name<false, double>[] = "rocblas_dtrttp";
+    template <>
+    constexpr char rocblas_tpttr_name<false, rocblas_float_complex>[] = "rocblas_ctrttp";
+    template <>
+    constexpr char rocblas_tpttr_name<false, rocblas_double_complex>[] = "rocblas_ztrttp";
+
+    template <bool, typename>
+    constexpr char rocblas_tpttr_strided_batched_name[] = "unknown";
+    template <>
+    constexpr char rocblas_tpttr_strided_batched_name<true, float>[]
+        = "rocblas_stpttr_strided_batched";
+    template <>
+    constexpr char rocblas_tpttr_strided_batched_name<true, double>[]
+        = "rocblas_dtpttr_strided_batched";
+    template <>
+    constexpr char rocblas_tpttr_strided_batched_name<true, rocblas_float_complex>[]
+        = "rocblas_ctpttr_strided_batched";
+    template <>
+    constexpr char rocblas_tpttr_strided_batched_name<true, rocblas_double_complex>[]
+        = "rocblas_ztpttr_strided_batched";
+    template <>
+    constexpr char rocblas_tpttr_strided_batched_name<false, float>[]
+        = "rocblas_strttp_strided_batched";
+    template <>
+    constexpr char rocblas_tpttr_strided_batched_name<false, double>[]
+        = "rocblas_dtrttp_strided_batched";
+    template <>
+    constexpr char rocblas_tpttr_strided_batched_name<false, rocblas_float_complex>[]
+        = "rocblas_ctrttp_strided_batched";
+    template <>
+    constexpr char rocblas_tpttr_strided_batched_name<false, rocblas_double_complex>[]
+        = "rocblas_ztrttp_strided_batched";
+
+    // Copies the triangle of A between packed and full storage for matrix blockIdx.z of the
+    // batch. Column j of the triangle is contiguous in both layouts, so the threads of a row of
+    // the block read and write consecutive elements of one column.
+    template <int DIM_X, int DIM_Y, bool TO_FULL, typename T>
+    ROCBLAS_KERNEL(DIM_X* DIM_Y)
+    rocblas_tpttr_kernel(bool           is_upper,
+                         rocblas_int    n,
+                         const T*       src,
+                         rocblas_stride stride_src,
+                         T*             dst,
+                         rocblas_stride stride_dst,
+                         int64_t        lda)
+    {
+        int64_t i = blockIdx.x * int64_t(DIM_X) + threadIdx.x;
+        if(i >= n)
+            return;
+
+        src = load_ptr_batch(src, blockIdx.z, stride_src);
+        dst = load_ptr_batch(dst, blockIdx.z, stride_dst);
+
+        for(int64_t j = blockIdx.y * int64_t(DIM_Y) + threadIdx.y; j < n;
+            j += int64_t(gridDim.y) * DIM_Y)
+        {
+            if(is_upper ? i > j : i < j)
+                continue;
+
+            size_t packed = rocblas_packed_index(is_upper, n, i, j);
+            size_t full   = j * lda + i;
+
+            if(TO_FULL)
+                dst[full] = src[packed];
+            else
+                dst[packed] = src[full];
+        }
+    }
+
+    template <bool TO_FULL, typename T>
+    rocblas_status rocblas_tpttr_impl(rocblas_handle handle,
+                                      const char*    name,
+                                      rocblas_fill   uplo,
+                                      rocblas_int    n,
+                                      const T*       src,
+                                      rocblas_stride stride_src,
+                                      T*             dst,
+                                      rocblas_stride stride_dst,
+                                      rocblas_int    lda,
+                                      rocblas_int    batch_count,
+                                      bool           strided)
+    {
+        static constexpr int DIM_X = 64;
+        static constexpr int DIM_Y = 8;
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // row major order, see rocblas_set_order, has no column major mapping here
+        RETURN_NOT_IMPLEMENTED_IF_ROW_MAJOR(handle);
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        {
+            if(strided)
+                log_trace(handle,
+                          name,
+                          uplo,
+                          n,
+                          src,
+                          stride_src,
+                          dst,
+                          stride_dst,
+                          lda,
+                          batch_count);
+            else
+                log_trace(handle, name, uplo, n, src, dst, lda);
+        }
+
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_invalid_value;
+
+        if(n < 0 || lda < std::max(n, 1) || batch_count < 0)
+            return rocblas_status_invalid_size;
+
+        if(!n || !batch_count)
+            return rocblas_status_success;
+
+        if(!src || !dst)
+            return rocblas_status_invalid_pointer;
+
+        int64_t blocks_y = std::min(int64_t((n - 1) / DIM_Y + 1), c_i64_grid_YZ_chunk);
+
+        for(int64_t b_base = 0; b_base < batch_count; b_base += c_i64_grid_YZ_chunk)
+        {
+            int32_t batches = int32_t(std::min(batch_count - b_base, c_i64_grid_YZ_chunk));
+
+            ROCBLAS_LAUNCH_KERNEL((rocblas_tpttr_kernel<DIM_X, DIM_Y, TO_FULL>),
+                                  dim3((n - 1) / DIM_X + 1, blocks_y, batches),
+                                  dim3(DIM_X, DIM_Y),
+                                  0,
+                                  handle->get_stream(),
+                                  uplo == rocblas_fill_upper,
+                                  n,
+                                  src + b_base * stride_src,
+                                  stride_src,
+                                  dst + b_base * stride_dst,
+                                  stride_dst,
+                                  lda);
+        }
+
+        return rocblas_status_success;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#ifdef IMPL_TRTTP
+#error IMPL_TRTTP ALREADY DEFINED
+#endif
+
+#ifdef IMPL_STRIDED_BATCHED
+#error IMPL_STRIDED_BATCHED ALREADY DEFINED
+#endif
+
+#ifdef IMPL_TRTTP_STRIDED_BATCHED
+#error IMPL_TRTTP_STRIDED_BATCHED ALREADY DEFINED
+#endif
+
+#define IMPL(name_, T_)                                                                        \
+    rocblas_status name_(rocblas_handle handle,                                                \
+                         rocblas_fill   uplo,                                                  \
+                         rocblas_int    n,                                                     \
+                         const T_*      AP,                                                    \
+                         T_*            A,                                                     \
+                         rocblas_int    lda)                                                   \
+    try                                                                                        \
+    {                                                                                          \
+        return rocblas_tpttr_impl<true, T_>(                                                   \
+            handle, rocblas_tpttr_name<true, T_>, uplo, n, AP, 0, A, 0, lda, 1, false);        \
+    }                                                                                          \
+    catch(...)                                                                                 \
+    {                                                                                          \
+        return exception_to_rocblas_status();                                                  \
+    }
+
+#define IMPL_TRTTP(name_, T_)                                                                  \
+    rocblas_status name_(rocblas_handle handle,                                                \
+                         rocblas_fill   uplo,                                                  \
+                         rocblas_int    n,                                                     \
+                         const T_*      A,                                                     \
+                         rocblas_int    lda,                                                   \
+                         T_*            AP)                                                    \
+    try                                                                                        \
+    {                                                                                          \
+        return rocblas_tpttr_impl<false, T_>(                                                  \
+            handle, rocblas_tpttr_name<false, T_>, uplo, n, A, 0, AP, 0, lda, 1, false);       \
+    }                                                                                          \
+    catch(...)                                                                                 \
+    {                                                                                          \
+        return exception_to_rocblas_status();                                                  \
+    }
+
+#define IMPL_STRIDED_BATCHED(name_, T_)                                                        \
+    rocblas_status name_(rocblas_handle handle,                                                \
+                         rocblas_fill   uplo,                                                  \
+                         rocblas_int    n,                                                     \
+                         const T_*      AP,                                                    \
+                         rocblas_stride stride_ap,                                             \
+                         T_*            A,                                                     \
+                         rocblas_int    lda,                                                   \
+                         rocblas_stride stride_a,                                              \
+                         rocblas_int    batch_count)                                           \
+    try                                                                                        \
+    {                                                                                          \
+        return rocblas_tpttr_impl<true, T_>(handle,                                            \
+                                            rocblas_tpttr_strided_batched_name<true, T_>,      \
+                                            uplo,                                              \
+                                            n,                                                 \
+                                            AP,                                                \
+                                            stride_ap,                                         \
+                                            A,                                                 \
+                                            stride_a,                                          \
+                                            lda,                                               \
+                                            batch_count,                                       \
+                                            true);                                             \
+    }                                                                                          \
+    catch(...)                                                                                 \
+    {                                                                                          \
+        return exception_to_rocblas_status();                                                  \
+    }
+
+#define IMPL_TRTTP_STRIDED_BATCHED(name_, T_)                                                  \
+    rocblas_status name_(rocblas_handle handle,                                                \
+                         rocblas_fill   uplo,                                                  \
+                         rocblas_int    n,                                                     \
+                         const T_*      A,                                                     \
+                         rocblas_int    lda,                                                   \
+                         rocblas_stride stride_a,                                              \
+                         T_*            AP,                                                    \
+                         rocblas_stride stride_ap,                                             \
+                         rocblas_int    batch_count)                                           \
+    try                                                                                        \
+    {                                                                                          \
+        return rocblas_tpttr_impl<false, T_>(handle,                                           \
+                                             rocblas_tpttr_strided_batched_name<false, T_>,    \
+                                             uplo,                                             \
+                                             n,                                                \
+                                             A,                                                \
+                                             stride_a,                                         \
+                                             AP,                                               \
+                                             stride_ap,                                        \
+                                             lda,                                              \
+                                             batch_count,                                      \
+                                             true);                                            \
+    }                                                                                          \
+    catch(...)                                                                                 \
+    {                                                                                          \
+        return exception_to_rocblas_status();                                                  \
+    }
+
+extern "C" {
+
+IMPL(rocblas_stpttr, float);
+IMPL(rocblas_dtpttr, double);
+IMPL(rocblas_ctpttr, rocblas_float_complex);
+IMPL(rocblas_ztpttr, rocblas_double_complex);
+
+IMPL_TRTTP(rocblas_strttp, float);
+IMPL_TRTTP(rocblas_dtrttp, double);
+IMPL_TRTTP(rocblas_ctrttp, rocblas_float_complex);
+IMPL_TRTTP(rocblas_ztrttp, rocblas_double_complex);
+
+IMPL_STRIDED_BATCHED(rocblas_stpttr_strided_batched, float);
+IMPL_STRIDED_BATCHED(rocblas_dtpttr_strided_batched, double);
+IMPL_STRIDED_BATCHED(rocblas_ctpttr_strided_batched, rocblas_float_complex);
+IMPL_STRIDED_BATCHED(rocblas_ztpttr_strided_batched, rocblas_double_complex);
+
+IMPL_TRTTP_STRIDED_BATCHED(rocblas_strttp_strided_batched, float);
+IMPL_TRTTP_STRIDED_BATCHED(rocblas_dtrttp_strided_batched, double);
+IMPL_TRTTP_STRIDED_BATCHED(rocblas_ctrttp_strided_batched, rocblas_float_complex);
+IMPL_TRTTP_STRIDED_BATCHED(rocblas_ztrttp_strided_batched, rocblas_double_complex);
+
+} // extern "C"
+
+#undef IMPL_TRTTP_STRIDED_BATCHED
+#undef IMPL_STRIDED_BATCHED
+#undef IMPL_TRTTP
+#undef IMPL
@@ -23,6 +23,7 @@
 #include "check_numerics_matrix.hpp"
 #include "check_numerics_vector.hpp"
 #include "rocblas_trsv.hpp"
+#include "rocblas_trsv_small_device.hpp"
 
 // Copyright 2014-6, The Science and Technology Facilities Council (STFC)
 // All rights reserved.
@@ -773,6 +774,99 @@ rocblas_trsv_device(rocblas_int    n,
     __threadfence();
 }
 
+// Solves SYS systems with n <= NMAX per thread block, each with its triangle of A in LDS
+template <rocblas_int NMAX,
+          rocblas_int SYS,
+          bool        CONJ,
+          typename T,
+          typename ALPHATYPE,
+          typename ATYPE,
+          typename XTYPE>
+ROCBLAS_KERNEL(NMAX* SYS)
+rocblas_trsv_small_kernel(bool           is_upper,
+                          bool           trans,
+                          bool           is_unit_diag,
+                          rocblas_int    n,
+                          ATYPE          dA,
+                          rocblas_stride offset_A,
+                          int64_t        lda,
+                          rocblas_stride stride_A,
+                          ALPHATYPE      alpha_device_host,
+                          XTYPE          dx,
+                          rocblas_stride offset_x,
+                          int64_t        incx,
+                          rocblas_stride stride_x,
+                          rocblas_int    batch_count)
+{
+    __shared__ T sA[SYS][NMAX * (NMAX + 1)];
+    __shared__ T sx[SYS][2];
+
+    const rocblas_int i      = threadIdx.x;
+    const rocblas_int sys    = threadIdx.y;
+    const uint32_t    batch  = blockIdx.x * SYS + sys;
+    const bool        active = batch < batch_count;
+
+    T xi = T(0);
+    if(active)
+    {
+        const auto* __restrict__ A = load_ptr_batch(dA, batch, offset_A, stride_A);
+        const auto* __restrict__ x = load_ptr_batch(dx, batch, offset_x, stride_x);
+
+        // consecutive rows of each column of the triangle are read by consecutive threads
+        if(i < n)
+        {
+            for(rocblas_int col = 0; col < n; col++)
+                if(is_upper ? i <= col : i >= col)
+                    sA[sys][col * (NMAX + 1) + i] = A[col * lda + i];
+
+            xi = load_scalar(alpha_device_host) * x[i * incx];
+        }
+    }
+    __syncthreads();
+
+    xi = rocblas_trsv_small_solve<NMAX, CONJ>(
+        is_upper, trans, is_unit_diag, n, sA[sys], sx[sys], xi);
+
+    if(active && i < n)
+        load_ptr_batch(dx, batch, offset_x, stride_x)[i * incx] = xi;
+}
+
+template <rocblas_int NMAX, typename T, typename ALPHATYPE, typename TConstPtr, typename TPtr>
+rocblas_status rocblas_trsv_small_launcher(rocblas_handle    handle,
+                                           rocblas_fill      uplo,
+                                           rocblas_operation transA,
+                                           rocblas_diagonal  diag,
+                                           rocblas_int       n,
+                                           TConstPtr         dA,
+                                           rocblas_stride    offset_A,
+                                           int64_t           lda,
+                                           rocblas_stride    stride_A,
+                                           ALPHATYPE         alpha,
+                                           TPtr              dx,
+                                           rocblas_stride    offset_x,
+                                           int64_t           incx,
+                                           rocblas_stride    stride_x,
+                                           rocblas_int       batch_count)
+{
+    static constexpr rocblas_int SYS = rocblas_trsv_small_systems<NMAX, T>();
+
+    dim3 grid((batch_count - 1) / SYS + 1);
+    dim3 threads(NMAX, SYS);
+
+#define TRSV_SMALL_PARAMS                                                                      \
+    grid, threads, 0, handle->get_stream(), uplo == rocblas_fill_upper,                        \
+        transA != rocblas_operation_none, diag == rocblas_diagonal_unit, n, dA, offset_A, lda, \
+        stride_A, alpha, dx, offset_x, incx, stride_x, batch_count
+
+    if(transA == rocblas_operation_conjugate_transpose)
+        ROCBLAS_LAUNCH_KERNEL((rocblas_trsv_small_kernel<NMAX, SYS, true, T>), TRSV_SMALL_PARAMS);
+    else
+        ROCBLAS_LAUNCH_KERNEL((rocblas_trsv_small_kernel<NMAX, SYS, false, T>), TRSV_SMALL_PARAMS);
+#undef TRSV_SMALL_PARAMS
+
+    return rocblas_status_success;
+}
+
 template <rocblas_int DIM_X, typename T, typename TConstPtr, typename TPtr>
 rocblas_status rocblas_internal_trsv_substitution_template(rocblas_handle    handle,
                                                            rocblas_fill      uplo,
@@ -800,15 +894,6 @@ rocblas_status rocblas_internal_trsv_substitution_template(rocblas_handle    han
 
     offset_x = incx < 0 ? offset_x + incx * (1 - n) : offset_x;
 
-    constexpr rocblas_int DIM_Y  = 16;
-    rocblas_int           blocks = (n + DIM_X - 1) / DIM_X;
-    dim3                  threads(DIM_X, DIM_Y, 1);
-    dim3                  grid(blocks, batch_count);
-
-    // Initialize global variables
-    ROCBLAS_LAUNCH_KERNEL(
-        rocblas_trsv_init, dim3(batch_count), dim3(1), 0, handle->get_stream(), w_completed_sec);
-
     // trsv doesn't need alpha, but trsm using this kernel and does.
     // if alpha is passed as a nullptr, set to 1.0, else use as expected.
     bool alpha_exists = false;
@@ -820,6 +905,35 @@ rocblas_status rocblas_internal_trsv_substitution_template(rocblas_handle    han
             alpha_local = *alpha;
     }
 
+    // small systems are solved in LDS, several per thread block
+    constexpr rocblas_int SMALL_N = rocblas_trsv_small_n<T>();
+    if(n <= SMALL_N)
+    {
+#define TRSV_SMALL_PARAMS(alpha_)                                                           \
+    handle, uplo, transA, diag, n, dA, offset_A, lda, stride_A, alpha_, dx, offset_x, incx, \
+        stride_x, batch_count
+
+        bool device_alpha = handle->pointer_mode == rocblas_pointer_mode_device && alpha_exists;
+        if(n <= 32)
+            return device_alpha
+                       ? rocblas_trsv_small_launcher<32, T>(TRSV_SMALL_PARAMS(alpha))
+                       : rocblas_trsv_small_launcher<32, T>(TRSV_SMALL_PARAMS(alpha_local));
+        else
+            return device_alpha
+                       ? rocblas_trsv_small_launcher<SMALL_N, T>(TRSV_SMALL_PARAMS(alpha))
+                       : rocblas_trsv_small_launcher<SMALL_N, T>(TRSV_SMALL_PARAMS(alpha_local));
+#undef TRSV_SMALL_PARAMS
+    }
+
+    constexpr rocblas_int DIM_Y  = 16;
+    rocblas_int           blocks = (n + DIM_X - 1) / DIM_X;
+    dim3                  threads(DIM_X, DIM_Y, 1);
+    dim3                  grid(blocks, batch_count);
+
+    // Initialize global variables
+    ROCBLAS_LAUNCH_KERNEL(
+        rocblas_trsv_init, dim3(batch_count), dim3(1), 0, handle->get_stream(), w_completed_sec);
+
 #define TRSV_TEMPLATE_PARAMS(alpha_)                                                              \
     grid, threads, 0, handle->get_stream(), n, dA, offset_A, lda, stride_A, alpha_, dx, offset_x, \
         incx, stride_x, w_completed_sec
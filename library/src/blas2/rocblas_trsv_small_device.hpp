@@ -0,0 +1,92 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "utility.hpp"
+
+/**
+  *  Triangular solves of small systems held entirely in LDS, used for batched trsv and tbsv
+  *  with n <= 64, as in block-Jacobi preconditioners. A thread block of NMAX x SYS threads
+  *  solves SYS systems, threadIdx.y selecting the system and threadIdx.x the row, so a single
+  *  launch covers the batch without one block sized for large n per system.
+  */
+
+// the largest n solved in LDS; 64 x 64 tiles of double complex would not leave room for a
+// second system in a block
+template <typename T>
+constexpr rocblas_int rocblas_trsv_small_n()
+{
+    return sizeof(T) > 8 ? 32 : 64;
+}
+
+// systems per thread block; the tiles of the block take at most 48 KiB of LDS
+template <rocblas_int NMAX, typename T>
+constexpr rocblas_int rocblas_trsv_small_systems()
+{
+    constexpr size_t tile = size_t(NMAX) * (NMAX + 1) * sizeof(T);
+    return tile > 49152 ? 1 : rocblas_int(49152 / tile);
+}
+
+/**
+  *  Solves op(A) * x = b for the triangle of A stored column major in sA with leading dimension
+  *  NMAX + 1, where thread i of the system holds b[i] in xi and receives x[i]. Each step
+  *  finishes one element, broadcasts it through sx and subtracts it from the rows still to be
+  *  solved. All threads of the block have to call this function, as it synchronizes the block.
+  */
+template <rocblas_int NMAX, bool CONJ, typename T>
+ROCBLAS_KERNEL_ILF T rocblas_trsv_small_solve(
+    bool is_upper, bool trans, bool is_unit_diag, rocblas_int n, const T* sA, T* sx, T xi)
+{
+    const rocblas_int i = threadIdx.x;
+
+    // op(A) is upper triangular when exactly one of upper and transpose holds
+    const bool backward = is_upper != trans;
+
+    auto op_A = [=](rocblas_int row, rocblas_int col) {
+        if(!trans)
+            return sA[col * (NMAX + 1) + row];
+        T a = sA[row * (NMAX + 1) + col];
+        return CONJ ? conj(a) : a;
+    };
+
+    for(rocblas_int s = 0; s < n; s++)
+    {
+        rocblas_int j = backward ? n - 1 - s : s;
+        if(i == j)
+        {
+            if(!is_unit_diag)
+                xi = xi / op_A(j, j);
+            sx[s & 1] = xi;
+        }
+
+        // one barrier per step; sx is double buffered so the next step does not overwrite the
+        // element still being read by this one
+        __syncthreads();
+
+        T xj = sx[s & 1];
+        if(backward ? i < j : (i > j && i < n))
+            xi -= op_A(i, j) * xj;
+    }
+
+    return xi;
+}
@@ -24,14 +24,15 @@
 
 #ifdef BUILD_WITH_TENSILE
 #include "gemm_tensile.hpp"
-#else
-#include "blas3/rocblas_gemm_source.hpp"
 #endif
 
+#include "blas3/rocblas_gemm_source.hpp"
+
 #include "blas3/rocblas_gemm.hpp"
 
 #include "check_numerics_matrix.hpp"
 #include "handle.hpp"
+#include "roctx_ranges.hpp"
 
 /*
  * ===========================================================================
@@ -66,6 +67,9 @@ rocblas_status rocblas_internal_gemm(rocblas_handle    handle,
     if(!m || !n || !batch_count)
         return rocblas_status_success;
 
+    rocblas_roctx_phase roctx_phase(
+        handle, "gemm", "M", m, "N", n, "K", k, "batch_count", batch_count);
+
     TScal alpha_h, beta_h;
     RETURN_IF_ROCBLAS_ERROR(
         rocblas_copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, k));
@@ -73,6 +77,46 @@ rocblas_status rocblas_internal_gemm(rocblas_handle    handle,
 
 #ifdef BUILD_WITH_TENSILE
 
+    // the source kernels compute the precisions the Tensile library was not built for, and large
+    // batches of small problems, which leave most of the Tensile workgroups idle
+    constexpr bool tensile_type = rocblas_tensile_has_type<TScal>();
+    if(!tensile_type && handle->tensile_prefetch)
+        return rocblas_status_success;
+
+    if(!tensile_type
+       || (!handle->tensile_prefetch && rocblas_gemm_small_batched_supported(m, n, k, batch_count)))
+    {
+        // the source kernels take no workspace, so a size query must not launch them
+        if(handle->is_device_memory_size_query())
+            return rocblas_status_size_unchanged;
+
+        return rocblas_gemm_source_solution_64<BATCHED>(trans_a,
+                                                            trans_b,
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            *alpha,
+                                                            A,
+                                                            lda,
+                                                            stride_a,
+                                                            offset_a,
+                                                            B,
+                                                            ldb,
+                                                            stride_b,
+                                                            offset_b,
+                                                            *beta,
+                                                            C,
+                                                            ldc,
+                                                            stride_c,
+                                                            offset_c,
+                                                            C,
+                                                            ldc,
+                                                            stride_c,
+                                                            offset_c,
+                                                            batch_count,
+                                                            handle->get_stream());
+    }
+
     if(BATCHED)
     {
         return rocblas_call_tensile(handle,
@@ -130,6 +174,9 @@ rocblas_status rocblas_internal_gemm(rocblas_handle    handle,
                                     batch_count);
     }
 #else // BUILD_WITH_TENSILE
+    if(handle->is_device_memory_size_query())
+        return rocblas_status_size_unchanged;
+
     hipStream_t rocblas_stream = handle->get_stream();
 
     if(k == 0 || (alpha && *alpha == 0))
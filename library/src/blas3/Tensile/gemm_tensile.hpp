@@ -22,9 +22,24 @@
 
 #pragma once
 
+#include "blas3/rocblas_gemm_decode.hpp"
 #include "check_numerics_matrix.hpp"
 #include "handle.hpp"
 
+// Whether the Tensile library has problems whose A matrix is of type T. It has all of them unless
+// Tensile_PRECISIONS limited the build to some, as a mask of the rocblas_datatype values above
+// rocblas_datatype_f16_r; the others are computed with the source kernels.
+template <typename T>
+constexpr bool rocblas_tensile_has_type()
+{
+#ifdef ROCBLAS_TENSILE_PRECISIONS
+    constexpr int bit = rocblas_datatype_from_type<T> - rocblas_datatype_f16_r;
+    return bit >= 0 && bit < 64 && ((uint64_t(ROCBLAS_TENSILE_PRECISIONS) >> bit) & 1);
+#else
+    return true;
+#endif
+}
+
 #ifdef BUILD_WITH_TENSILE
 
 #include "tensile_host.hpp"
@@ -42,22 +57,22 @@ inline rocblas_status rocblas_call_tensile(rocblas_handle     handle,
                                            To* const*         batchD,
                                            rocblas_operation  trans_a,
                                            rocblas_operation  trans_b,
-                                           rocblas_int        ld_d,
+                                           int64_t            ld_d,
                                            rocblas_stride     stride_d,
                                            rocblas_stride     offset_d,
-                                           rocblas_int        ld_c,
+                                           int64_t            ld_c,
                                            rocblas_stride     stride_c,
                                            rocblas_stride     offset_c,
-                                           rocblas_int        ld_a,
+                                           int64_t            ld_a,
                                            rocblas_stride     stride_a,
                                            rocblas_stride     offset_a,
-                                           rocblas_int        ld_b,
+                                           int64_t            ld_b,
                                            rocblas_stride     stride_b,
                                            rocblas_stride     offset_b,
-                                           rocblas_int        m,
-                                           rocblas_int        n,
-                                           rocblas_int        k,
-                                           rocblas_int        batch_count = 1,
+                                           int64_t            m,
+                                           int64_t            n,
+                                           int64_t            k,
+                                           int64_t            batch_count = 1,
                                            rocblas_gemm_algo  algo = rocblas_gemm_algo_standard,
                                            int32_t            solution_index = 0,
                                            rocblas_gemm_flags flags = rocblas_gemm_flags_none)
@@ -102,22 +117,22 @@ inline rocblas_status rocblas_call_tensile(rocblas_handle     handle,
                                            To*                D,
                                            rocblas_operation  trans_a,
                                            rocblas_operation  trans_b,
-                                           rocblas_int        ld_d,
+                                           int64_t            ld_d,
                                            rocblas_stride     stride_d,
                                            rocblas_stride     offset_d,
-                                           rocblas_int        ld_c,
+                                           int64_t            ld_c,
                                            rocblas_stride     stride_c,
                                            rocblas_stride     offset_c,
-                                           rocblas_int        ld_a,
+                                           int64_t            ld_a,
                                            rocblas_stride     stride_a,
                                            rocblas_stride     offset_a,
-                                           rocblas_int        ld_b,
+                                           int64_t            ld_b,
                                            rocblas_stride     stride_b,
                                            rocblas_stride     offset_b,
-                                           rocblas_int        m,
-                                           rocblas_int        n,
-                                           rocblas_int        k,
-                                           rocblas_int        batch_count = 1,
+                                           int64_t            m,
+                                           int64_t            n,
+                                           int64_t            k,
+                                           int64_t            batch_count = 1,
                                            rocblas_gemm_algo  algo = rocblas_gemm_algo_standard,
                                            int32_t            solution_index = 0,
                                            rocblas_gemm_flags flags = rocblas_gemm_flags_none)
@@ -143,6 +158,38 @@ inline rocblas_status rocblas_call_tensile(rocblas_handle     handle,
     }
 #endif
 
+    // The shapes with decode GEMM kernels are matched exactly ahead of Tensile
+    if constexpr(rocblas_gemm_decode_has_type<Ti, To, Tc>())
+    {
+        if(!(algo == rocblas_gemm_algo_solution_index && solution_index > 0)
+           && !(flags & rocblas_gemm_flags_check_solution_index))
+        {
+            rocblas_status status = rocblas_internal_gemm_decode(handle,
+                                                                 trans_a,
+                                                                 trans_b,
+                                                                 m,
+                                                                 n,
+                                                                 k,
+                                                                 alpha,
+                                                                 A + offset_a,
+                                                                 ld_a,
+                                                                 stride_a,
+                                                                 B + offset_b,
+                                                                 ld_b,
+                                                                 stride_b,
+                                                                 beta,
+                                                                 C + offset_c,
+                                                                 ld_c,
+                                                                 stride_c,
+                                                                 D + offset_d,
+                                                                 ld_d,
+                                                                 stride_d,
+                                                                 batch_count);
+            if(status != rocblas_status_continue)
+                return status;
+        }
+    }
+
     // pre apply offsets for non-batched and strided
     RocblasContractionProblem<Ti, To, Tc> problem{handle,
                                                   trans_a,
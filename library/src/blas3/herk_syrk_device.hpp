@@ -1285,3 +1285,254 @@ rocblas_status rocblas_syr2k_her2k_dispatch(rocblas_fill      uplo,
 
     return rocblas_status_success;
 }
+
+/**
+  *  Small-n batched kernel: each workgroup of DIM threads computes PACK problems of size n <= NB.
+  *  The threads are mapped over the n * (n + 1) / 2 elements of the uplo triangle of C of each
+  *  problem only, and op(A) and op(B) of the problems are staged in KT wide K tiles, so beta and
+  *  both matrix multiplies are applied in a single launch.
+  */
+template <typename API_INT,
+          int  DIM,
+          int  NB,
+          int  PACK,
+          bool TWOK,
+          bool HERM,
+          bool TRANS,
+          typename T,
+          typename TConstPtr,
+          typename TPtr>
+ROCBLAS_KERNEL(DIM)
+rocblas_syr2k_her2k_small_batched_kernel(bool           is_upper,
+                                         rocblas_int    n,
+                                         API_INT        k,
+                                         T              alpha,
+                                         TConstPtr      AP_array,
+                                         API_INT        lda,
+                                         rocblas_stride a_st_or_of,
+                                         TConstPtr      BP_array,
+                                         API_INT        ldb,
+                                         rocblas_stride b_st_or_of,
+                                         T              beta,
+                                         TPtr           CP_array,
+                                         API_INT        ldc,
+                                         rocblas_stride c_st_or_of,
+                                         rocblas_int    batch_count)
+{
+    constexpr int KT    = 8;
+    constexpr int ELEMS = (PACK * NB * (NB + 1) / 2 - 1) / DIM + 1;
+
+    __shared__ T sA[PACK][KT][NB];
+    __shared__ T sB[PACK][KT][NB];
+
+    int tri   = n * (n + 1) / 2;
+    int first = blockIdx.x * PACK; // first problem of the workgroup
+
+    // problem, row and column of the triangle elements of the thread, problem -1 when invalid
+    int prob[ELEMS], row[ELEMS], col[ELEMS];
+    T   rC[ELEMS], rC2[ELEMS];
+
+    for(int l = 0; l < ELEMS; l++)
+    {
+        int idx = threadIdx.x + l * DIM;
+        int p   = idx / tri;
+        int e   = idx % tri;
+
+        // e is the r * (r + 1) / 2 + c element of the lower triangle, c <= r
+        int r = int((sqrtf(8.0f * e + 1.0f) - 1.0f) * 0.5f);
+        while((r + 1) * (r + 2) / 2 <= e)
+            r++;
+        while(r * (r + 1) / 2 > e)
+            r--;
+        int c = e - r * (r + 1) / 2;
+
+        prob[l] = p < PACK && first + p < batch_count ? p : -1;
+        row[l]  = is_upper ? c : r;
+        col[l]  = is_upper ? r : c;
+        rC[l]   = 0;
+        rC2[l]  = 0;
+    }
+
+    for(API_INT k_pos = 0; k_pos < k; k_pos += KT)
+    {
+        // stage op(A) and op(B), when HERM ^H instead of ^T, zero where invalid
+        for(int idx = threadIdx.x; idx < PACK * KT * NB; idx += DIM)
+        {
+            int     i  = idx % NB;
+            int     kk = (idx / NB) % KT;
+            int     p  = idx / (NB * KT);
+            API_INT kc = k_pos + kk;
+            T       a  = 0;
+            T       b  = 0;
+            if(i < n && kc < k && first + p < batch_count)
+            {
+                const auto* A = load_ptr_batch(AP_array, first + p, a_st_or_of);
+                const auto* B = load_ptr_batch(BP_array, first + p, b_st_or_of);
+
+                a = TRANS ? conj_if_true<HERM>(A[i * size_t(lda) + kc]) : A[kc * size_t(lda) + i];
+                b = TRANS ? conj_if_true<HERM>(B[i * size_t(ldb) + kc]) : B[kc * size_t(ldb) + i];
+            }
+            sA[p][kk][i] = a;
+            sB[p][kk][i] = b;
+        }
+
+        __syncthreads();
+
+        for(int l = 0; l < ELEMS; l++)
+        {
+            int p = prob[l];
+            if(p < 0)
+                continue;
+
+            for(int kk = 0; kk < KT; kk++)
+            {
+                rC[l] += sA[p][kk][row[l]] * conj_if_true<HERM>(sB[p][kk][col[l]]);
+                if(TWOK)
+                    rC2[l] += sB[p][kk][row[l]] * conj_if_true<HERM>(sA[p][kk][col[l]]);
+            }
+        }
+
+        __syncthreads();
+    }
+
+    for(int l = 0; l < ELEMS; l++)
+    {
+        if(prob[l] < 0)
+            continue;
+
+        auto* C = load_ptr_batch(CP_array, first + prob[l], c_st_or_of);
+        auto& e = C[col[l] * size_t(ldc) + row[l]];
+
+        T sum = alpha * rC[l];
+        if(TWOK)
+            sum += (HERM ? conj(alpha) : alpha) * rC2[l];
+
+        e = beta == 0 ? sum : beta * e + sum;
+        if(HERM && row[l] == col[l])
+            e = std::real(e);
+    }
+}
+
+template <typename API_INT,
+          int  NB,
+          bool TWOK,
+          bool HERM,
+          typename T,
+          typename TConstPtr,
+          typename TPtr>
+rocblas_status rocblas_syr2k_her2k_small_batched_launch(rocblas_fill      uplo,
+                                                        rocblas_operation trans,
+                                                        rocblas_int       n,
+                                                        API_INT           k,
+                                                        const T           alpha,
+                                                        TConstPtr         dA,
+                                                        API_INT           lda,
+                                                        rocblas_stride    a_st_or_of,
+                                                        TConstPtr         dB,
+                                                        API_INT           ldb,
+                                                        rocblas_stride    b_st_or_of,
+                                                        const T           beta,
+                                                        TPtr              dC,
+                                                        API_INT           ldc,
+                                                        rocblas_stride    c_st_or_of,
+                                                        rocblas_int       batch_count,
+                                                        hipStream_t       stream)
+{
+    // about two triangle elements of C per thread
+    static constexpr int DIM  = ROCBLAS_SYR2K_SMALL_BATCHED_DIM;
+    static constexpr int PACK = 1024 / (NB * NB);
+
+    dim3 grid((batch_count - 1) / PACK + 1);
+    dim3 threads(DIM);
+
+    if(trans == rocblas_operation_none)
+        ROCBLAS_LAUNCH_KERNEL(
+            (rocblas_syr2k_her2k_small_batched_kernel<API_INT, DIM, NB, PACK, TWOK, HERM, false>),
+            grid,
+            threads,
+            0,
+            stream,
+            uplo == rocblas_fill_upper,
+            n,
+            k,
+            alpha,
+            dA,
+            lda,
+            a_st_or_of,
+            dB,
+            ldb,
+            b_st_or_of,
+            beta,
+            dC,
+            ldc,
+            c_st_or_of,
+            batch_count);
+    else
+        ROCBLAS_LAUNCH_KERNEL(
+            (rocblas_syr2k_her2k_small_batched_kernel<API_INT, DIM, NB, PACK, TWOK, HERM, true>),
+            grid,
+            threads,
+            0,
+            stream,
+            uplo == rocblas_fill_upper,
+            n,
+            k,
+            alpha,
+            dA,
+            lda,
+            a_st_or_of,
+            dB,
+            ldb,
+            b_st_or_of,
+            beta,
+            dC,
+            ldc,
+            c_st_or_of,
+            batch_count);
+
+    return rocblas_status_success;
+}
+
+/**
+  *  Batches of n <= ROCBLAS_SYR2K_SMALL_BATCHED_MAX_N problems, one launch for all batches.
+  */
+template <typename API_INT, bool TWOK, bool HERM, typename T, typename TConstPtr, typename TPtr>
+rocblas_status rocblas_syr2k_her2k_small_batched_dispatch(rocblas_fill      uplo,
+                                                          rocblas_operation trans,
+                                                          rocblas_int       n,
+                                                          API_INT           k,
+                                                          const T           alpha,
+                                                          TConstPtr         dA,
+                                                          API_INT           lda,
+                                                          rocblas_stride    a_st_or_of,
+                                                          TConstPtr         dB,
+                                                          API_INT           ldb,
+                                                          rocblas_stride    b_st_or_of,
+                                                          const T           beta,
+                                                          TPtr              dC,
+                                                          API_INT           ldc,
+                                                          rocblas_stride    c_st_or_of,
+                                                          rocblas_int       batch_count,
+                                                          hipStream_t       stream)
+{
+    static_assert(ROCBLAS_SYR2K_SMALL_BATCHED_MAX_N == 32);
+
+    // same behavior for alpha == 0 and k == 0, only beta is applied
+    if(alpha == 0)
+        k = 0;
+
+    // clang-format off
+    if(n <= 8)
+        return rocblas_syr2k_her2k_small_batched_launch<API_INT, 8, TWOK, HERM>(
+            uplo, trans, n, k, alpha, dA, lda, a_st_or_of, dB, ldb, b_st_or_of,
+            beta, dC, ldc, c_st_or_of, batch_count, stream);
+    else if(n <= 16)
+        return rocblas_syr2k_her2k_small_batched_launch<API_INT, 16, TWOK, HERM>(
+            uplo, trans, n, k, alpha, dA, lda, a_st_or_of, dB, ldb, b_st_or_of,
+            beta, dC, ldc, c_st_or_of, batch_count, stream);
+    else
+        return rocblas_syr2k_her2k_small_batched_launch<API_INT, 32, TWOK, HERM>(
+            uplo, trans, n, k, alpha, dA, lda, a_st_or_of, dB, ldb, b_st_or_of,
+            beta, dC, ldc, c_st_or_of, batch_count, stream);
+    // clang-format on
+}
@@ -0,0 +1,803 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "../blas_ex/rocblas_gemm_ex.hpp"
+#include "logging.hpp"
+#include "rocblas_mgpu.hpp"
+#include "rocblas_trsm.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_trsm_strided_batched_mgpu_name[] = "unknown";
+    template <>
+    constexpr char rocblas_trsm_strided_batched_mgpu_name<float>[]
+        = "rocblas_strsm_strided_batched_mgpu";
+    template <>
+    constexpr char rocblas_trsm_strided_batched_mgpu_name<double>[]
+        = "rocblas_dtrsm_strided_batched_mgpu";
+    template <>
+    constexpr char rocblas_trsm_strided_batched_mgpu_name<rocblas_float_complex>[]
+        = "rocblas_ctrsm_strided_batched_mgpu";
+    template <>
+    constexpr char rocblas_trsm_strided_batched_mgpu_name<rocblas_double_complex>[]
+        = "rocblas_ztrsm_strided_batched_mgpu";
+
+    // The share of the batch of each of the other devices is copied and computed in chunks,
+    // so that the copies of the next chunk overlap the computation of the current one
+    constexpr int BATCHED_MGPU_SLOTS  = 2;
+    constexpr int BATCHED_MGPU_CHUNKS = 4;
+
+    // A strided batch of matrices on the device of the first handle, copied to the other
+    // devices when it is an input, and copied back when it is an output
+    struct batched_mgpu_operand
+    {
+        const void*    ptr       = nullptr;
+        size_t         elem_size = 0;
+        int64_t        rows = 0, cols = 0, ld = 0;
+        rocblas_stride stride = 0;
+        bool           input = false, output = false;
+
+        bool copied() const
+        {
+            return input || output;
+        }
+
+        // Elements spanned by count consecutive matrices of the batch
+        size_t span(int64_t count) const
+        {
+            return count ? (count - 1) * stride + (cols - 1) * ld + rows : 0;
+        }
+
+        const void* at(int64_t batch) const
+        {
+            return static_cast<const char*>(ptr) + batch * stride * elem_size;
+        }
+    };
+
+    // Copy the matrices of an output back, leaving the memory between them untouched, as one
+    // copy when the matrices are contiguous columns
+    rocblas_status batched_mgpu_copy_back(const batched_mgpu_operand& op,
+                                          const void*                 src,
+                                          void*                       dst,
+                                          int64_t                     count,
+                                          hipStream_t                 stream)
+    {
+        if(op.stride == op.ld * op.cols)
+            return rocblas_mgpu_copy_matrix(
+                op.rows, op.cols * count, op.elem_size, src, op.ld, dst, op.ld, stream);
+
+        for(int64_t b = 0; b < count; ++b)
+        {
+            size_t offset = b * op.stride * op.elem_size;
+            RETURN_IF_ROCBLAS_ERROR(rocblas_mgpu_copy_matrix(op.rows,
+                                                             op.cols,
+                                                             op.elem_size,
+                                                             static_cast<const char*>(src) + offset,
+                                                             op.ld,
+                                                             static_cast<char*>(dst) + offset,
+                                                             op.ld,
+                                                             stream));
+        }
+        return rocblas_status_success;
+    }
+
+    // Pipeline of one of the other devices: an input stream copies the next chunk while the
+    // stream of its handle computes the current one and an output stream copies the previous
+    // one back
+    struct batched_mgpu_device
+    {
+        rocblas_handle handle = nullptr;
+        hipStream_t    in{}, out{};
+        hipEvent_t     finished{};
+        hipEvent_t     ready[BATCHED_MGPU_SLOTS]{}, done[BATCHED_MGPU_SLOTS]{},
+            free[BATCHED_MGPU_SLOTS]{};
+
+        rocblas_status create(rocblas_handle h)
+        {
+            handle               = h;
+            auto saved_device_id = handle->push_device_id();
+            for(auto* s : {&in, &out})
+                RETURN_IF_HIP_ERROR(handle->create_helper_stream(s));
+            RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&finished, hipEventDisableTiming));
+            for(int i = 0; i < BATCHED_MGPU_SLOTS; ++i)
+                for(auto* e : {&ready[i], &done[i], &free[i]})
+                    RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(e, hipEventDisableTiming));
+            return rocblas_status_success;
+        }
+
+        // Pending work completes before the resources are released
+        ~batched_mgpu_device()
+        {
+            if(!handle)
+                return;
+            auto saved_device_id = handle->push_device_id();
+            for(auto s : {in, out})
+                if(s)
+                    (void)hipStreamDestroy(s);
+            if(finished)
+                (void)hipEventDestroy(finished);
+            for(int i = 0; i < BATCHED_MGPU_SLOTS; ++i)
+                for(auto e : {ready[i], done[i], free[i]})
+                    if(e)
+                        (void)hipEventDestroy(e);
+        }
+    };
+
+    // Shares of the batch of the devices, in proportion to their throughput: the first device
+    // computes at its peak, and each of the others at the lower of its own peak and the rate at
+    // which its matrices are copied over its link, since the two overlap
+    std::vector<int64_t> batched_mgpu_shares(int64_t                                  batch_count,
+                                             double                                   batch_flops,
+                                             const std::vector<batched_mgpu_operand>& ops,
+                                             const std::vector<double>&               flops)
+    {
+        size_t               devices = flops.size();
+        std::vector<int64_t> shares(devices, 0);
+        double               batch_bytes = 0;
+        for(auto& op : ops)
+            batch_bytes += (op.input + op.output) * double(op.rows) * op.cols * op.elem_size;
+
+        double link_time = batch_bytes / rocblas_mgpu_link_bytes_per_sec();
+        std::vector<double> rates(devices, 0);
+        double              total_rate = 0;
+        for(size_t d = 0; d < devices; ++d)
+        {
+            double time = flops[d] > 0 ? batch_flops / flops[d] : 0;
+            if(d)
+                time = std::max(time, link_time);
+            rates[d] = flops[d] > 0 && time > 0 ? 1 / time : 0;
+            total_rate += rates[d];
+        }
+        if(!(total_rate > 0) || !(rates[0] > 0))
+        {
+            shares[0] = batch_count;
+            return shares;
+        }
+
+        int64_t assigned = 0;
+        for(size_t d = 1; d < devices; ++d)
+            assigned += shares[d] = int64_t(batch_count * rates[d] / total_rate);
+        shares[0] = batch_count - assigned;
+        return shares;
+    }
+
+    // Run a strided batched function on the devices of the handles, each computing a share of
+    // the batch; run(handle, pointers, count) computes count matrices of the batch on the
+    // device of handle, with the pointers of the first matrix of each operand
+    template <typename RUN>
+    rocblas_status rocblas_batched_mgpu(const rocblas_handle*                    handles,
+                                        rocblas_int                              num_handles,
+                                        int64_t                                  batch_count,
+                                        double                                   batch_flops,
+                                        const std::vector<batched_mgpu_operand>& ops,
+                                        RUN&&                                    run)
+    {
+        rocblas_handle handle = handles[0];
+        auto           peers  = rocblas_mgpu_peers(handles, num_handles);
+
+        std::vector<int64_t> shares(1, batch_count);
+        if(peers.size() > 1)
+        {
+            std::vector<double> flops;
+            for(auto peer : peers)
+                flops.push_back(rocblas_mgpu_device_flops(peer->getDevice(), ops[0].elem_size));
+            shares = batched_mgpu_shares(batch_count, batch_flops, ops, flops);
+        }
+
+        std::vector<void*> ptrs(ops.size());
+        auto               home_ptrs = [&](int64_t first) {
+            for(size_t i = 0; i < ops.size(); ++i)
+                ptrs[i] = const_cast<void*>(ops[i].at(first));
+            return ptrs;
+        };
+
+        // The other devices start after the work already enqueued on the first handle, when
+        // the finished event of the first device is recorded
+        hipStream_t         home_stream = handle->get_stream();
+        batched_mgpu_device home_dev;
+        RETURN_IF_ROCBLAS_ERROR(home_dev.create(handle));
+        RETURN_IF_HIP_ERROR(hipEventRecord(home_dev.finished, home_stream));
+
+        std::vector<batched_mgpu_device> devices(peers.size());
+        int64_t                          first = shares[0];
+        for(size_t d = 1; d < peers.size(); first += shares[d++])
+        {
+            int64_t share = shares[d];
+            if(!share)
+                continue;
+
+            batched_mgpu_device& dev       = devices[d];
+            rocblas_handle       dh        = peers[d];
+            auto                 saved_id  = dh->push_device_id();
+            auto                 saved_ptr = dh->push_pointer_mode(rocblas_pointer_mode_host);
+            RETURN_IF_ROCBLAS_ERROR(dev.create(dh));
+            hipStream_t compute = dh->get_stream();
+
+            // The workspace run takes from the handle for the chunks, found with a device memory
+            // size query, for the full chunks and the last one
+            int64_t chunk     = (share + BATCHED_MGPU_CHUNKS - 1) / BATCHED_MGPU_CHUNKS;
+            auto    slot_size = [&](int64_t count) {
+                size_t bytes = 0;
+                for(auto& op : ops)
+                    if(op.copied())
+                        bytes += roundup_device_memory_size(op.span(count) * op.elem_size);
+                return bytes;
+            };
+            auto run_size = [&](int64_t count) {
+                size_t size = 0;
+                for(int64_t c : {count, share % count})
+                    if(c)
+                        size = std::max(size, dh->device_memory_size_of([&] {
+                            (void)run(dh, home_ptrs(first), c);
+                        }));
+                return size;
+            };
+
+            // Halve the chunks until the buffers of both slots and the workspace of run fit in
+            // the device memory of the handle together. They are reserved at once, so that the
+            // device memory of the handle then covers both, and the buffers are taken again on
+            // their own, leaving the workspace of run free while they are held.
+            size_t run_workspace = run_size(chunk);
+            auto   reserve       = [&] {
+                auto reserved
+                    = dh->device_malloc(BATCHED_MGPU_SLOTS * slot_size(chunk), run_workspace);
+                return bool(reserved);
+            };
+            while(!reserve())
+            {
+                if(chunk == 1)
+                    return rocblas_status_memory_error;
+                chunk         = (chunk + 1) / 2;
+                run_workspace = run_size(chunk);
+            }
+            auto w_mem = dh->device_malloc(BATCHED_MGPU_SLOTS * slot_size(chunk));
+            if(!w_mem)
+                return rocblas_status_memory_error;
+
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(dev.in, home_dev.finished, 0));
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(compute, home_dev.finished, 0));
+
+            for(int64_t done = 0, step = 0; done < share; done += chunk, ++step)
+            {
+                int64_t count = std::min(chunk, share - done);
+                int     s     = step % BATCHED_MGPU_SLOTS;
+                char*   slot  = static_cast<char*>(w_mem[0]) + s * slot_size(chunk);
+
+                // Copy in the chunk once the previous chunk of this slot was copied back
+                if(step >= BATCHED_MGPU_SLOTS)
+                    RETURN_IF_HIP_ERROR(hipStreamWaitEvent(dev.in, dev.free[s], 0));
+                home_ptrs(first + done);
+                for(size_t i = 0; i < ops.size(); ++i)
+                {
+                    if(!ops[i].copied())
+                        continue;
+                    size_t bytes = ops[i].span(count) * ops[i].elem_size;
+                    if(ops[i].input)
+                        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                            slot, ptrs[i], bytes, hipMemcpyDeviceToDevice, dev.in));
+                    ptrs[i] = slot;
+                    slot += roundup_device_memory_size(bytes);
+                }
+                RETURN_IF_HIP_ERROR(hipEventRecord(dev.ready[s], dev.in));
+
+                // run takes its workspace after the buffers, and must not grow the device memory
+                // of the handle while they are held
+                if(!dh->device_memory_fits_while_in_use(run_workspace))
+                    return rocblas_status_memory_error;
+                RETURN_IF_HIP_ERROR(hipStreamWaitEvent(compute, dev.ready[s], 0));
+                RETURN_IF_ROCBLAS_ERROR(run(dh, ptrs, count));
+                RETURN_IF_HIP_ERROR(hipEventRecord(dev.done[s], compute));
+
+                RETURN_IF_HIP_ERROR(hipStreamWaitEvent(dev.out, dev.done[s], 0));
+                for(size_t i = 0; i < ops.size(); ++i)
+                    if(ops[i].output)
+                        RETURN_IF_ROCBLAS_ERROR(
+                            batched_mgpu_copy_back(ops[i],
+                                                   ptrs[i],
+                                                   const_cast<void*>(ops[i].at(first + done)),
+                                                   count,
+                                                   dev.out));
+                RETURN_IF_HIP_ERROR(hipEventRecord(dev.free[s], dev.out));
+            }
+
+            // The stream of the handle waits for the copies back, which use its workspace
+            RETURN_IF_HIP_ERROR(hipEventRecord(dev.finished, dev.out));
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(compute, dev.finished, 0));
+        }
+
+        // The first device computes its share in place, while the others run
+        if(shares[0])
+            RETURN_IF_ROCBLAS_ERROR(run(handle, home_ptrs(0), shares[0]));
+
+        // Join the other devices back to the stream of the first handle
+        for(size_t d = 1; d < devices.size(); ++d)
+            if(devices[d].handle)
+                RETURN_IF_HIP_ERROR(hipStreamWaitEvent(home_stream, devices[d].finished, 0));
+
+        return rocblas_status_success;
+    }
+
+    // Whether a scalar of gemm_ex, of its compute type, is zero
+    bool batched_mgpu_scalar_is_zero(const void* scalar, rocblas_datatype compute_type)
+    {
+        switch(compute_type)
+        {
+        case rocblas_datatype_f16_r:
+            return rocblas_iszero(*static_cast<const rocblas_half*>(scalar));
+        case rocblas_datatype_f32_r:
+            return rocblas_iszero(*static_cast<const float*>(scalar));
+        case rocblas_datatype_f64_r:
+            return rocblas_iszero(*static_cast<const double*>(scalar));
+        case rocblas_datatype_i32_r:
+            return *static_cast<const int32_t*>(scalar) == 0;
+        case rocblas_datatype_f32_c:
+            return rocblas_iszero(*static_cast<const rocblas_float_complex*>(scalar));
+        case rocblas_datatype_f64_c:
+            return rocblas_iszero(*static_cast<const rocblas_double_complex*>(scalar));
+        default:
+            return false;
+        }
+    }
+
+    rocblas_status rocblas_gemm_strided_batched_ex_mgpu_impl(const rocblas_handle* handles,
+                                                             rocblas_int           num_handles,
+                                                             rocblas_operation     trans_a,
+                                                             rocblas_operation     trans_b,
+                                                             rocblas_int           m,
+                                                             rocblas_int           n,
+                                                             rocblas_int           k,
+                                                             const void*           alpha,
+                                                             const void*           a,
+                                                             rocblas_datatype      a_type,
+                                                             rocblas_int           lda,
+                                                             rocblas_stride        stride_a,
+                                                             const void*           b,
+                                                             rocblas_datatype      b_type,
+                                                             rocblas_int           ldb,
+                                                             rocblas_stride        stride_b,
+                                                             const void*           beta,
+                                                             const void*           c,
+                                                             rocblas_datatype      c_type,
+                                                             rocblas_int           ldc,
+                                                             rocblas_stride        stride_c,
+                                                             void*                 d,
+                                                             rocblas_datatype      d_type,
+                                                             rocblas_int           ldd,
+                                                             rocblas_stride        stride_d,
+                                                             rocblas_int           batch_count,
+                                                             rocblas_datatype      compute_type,
+                                                             rocblas_gemm_algo     algo,
+                                                             int32_t               solution_index,
+                                                             uint32_t              flags)
+    {
+        RETURN_IF_ROCBLAS_ERROR(rocblas_mgpu_check_handles(handles, num_handles));
+
+        rocblas_handle handle          = handles[0];
+        auto           saved_device_id = handle->push_device_id();
+
+        // the workspace of each device is taken when the batch is shared, which a device
+        // memory size query does not support
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        // alpha and beta are read on the host by every device
+        rocblas_union_t alpha_h, beta_h;
+        RETURN_IF_ROCBLAS_ERROR(rocblas_copy_alpha_beta_to_host_if_on_device(
+            handle, alpha, beta, alpha_h, beta_h, k, compute_type));
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        {
+            rocblas_internal_ostream alphass, betass;
+            if(log_trace_alpha_beta_ex(compute_type, alpha, beta, alphass, betass)
+               == rocblas_status_success)
+                log_trace(handle,
+                          "rocblas_gemm_strided_batched_ex_mgpu",
+                          num_handles,
+                          trans_a,
+                          trans_b,
+                          m,
+                          n,
+                          k,
+                          alphass.str(),
+                          a,
+                          rocblas_datatype_string(a_type),
+                          lda,
+                          stride_a,
+                          b,
+                          rocblas_datatype_string(b_type),
+                          ldb,
+                          stride_b,
+                          betass.str(),
+                          c,
+                          rocblas_datatype_string(c_type),
+                          ldc,
+                          stride_c,
+                          d,
+                          rocblas_datatype_string(d_type),
+                          ldd,
+                          stride_d,
+                          batch_count,
+                          rocblas_datatype_string(compute_type),
+                          algo,
+                          solution_index,
+                          rocblas_gemm_flags(flags));
+        }
+
+        auto validArgs = rocblas_gemm_ex_arg_check(handle,
+                                                   trans_a,
+                                                   trans_b,
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   a,
+                                                   lda,
+                                                   b,
+                                                   ldb,
+                                                   beta,
+                                                   c,
+                                                   c_type,
+                                                   ldc,
+                                                   d,
+                                                   d_type,
+                                                   ldd,
+                                                   compute_type,
+                                                   batch_count);
+        if(validArgs == rocblas_status_continue && c == d && stride_c != stride_d)
+            validArgs = rocblas_status_invalid_size;
+        if(validArgs != rocblas_status_continue)
+            return validArgs;
+
+        // A, B, C and D; in place, D is both read and written and C is not copied
+        bool in_place = c == d;
+        bool load_c   = !batched_mgpu_scalar_is_zero(beta, compute_type);
+        bool a_none   = trans_a == rocblas_operation_none;
+        bool b_none   = trans_b == rocblas_operation_none;
+
+        std::vector<batched_mgpu_operand> ops(4);
+        ops[0] = {a, rocblas_sizeof_datatype(a_type), a_none ? m : k, a_none ? k : m, lda};
+        ops[1] = {b, rocblas_sizeof_datatype(b_type), b_none ? k : n, b_none ? n : k, ldb};
+        ops[2] = {c, rocblas_sizeof_datatype(c_type), m, n, ldc, stride_c};
+        ops[3] = {d, rocblas_sizeof_datatype(d_type), m, n, ldd, stride_d};
+        ops[0].stride = stride_a;
+        ops[1].stride = stride_b;
+        ops[0].input = ops[1].input = true;
+        ops[2].input                = load_c && !in_place;
+        ops[3].input                = load_c && in_place;
+        ops[3].output               = true;
+
+        bool complex
+            = compute_type == rocblas_datatype_f32_c || compute_type == rocblas_datatype_f64_c;
+        double batch_flops = (complex ? 8.0 : 2.0) * m * n * k;
+
+        return rocblas_batched_mgpu(
+            handles,
+            num_handles,
+            batch_count,
+            batch_flops,
+            ops,
+            [&](rocblas_handle h, const std::vector<void*>& p, int64_t count) {
+                auto saved_ptr = h->push_pointer_mode(rocblas_pointer_mode_host);
+                return rocblas_gemm_ex_template<false>(h,
+                                                       trans_a,
+                                                       trans_b,
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       alpha,
+                                                       p[0],
+                                                       a_type,
+                                                       0,
+                                                       lda,
+                                                       stride_a,
+                                                       p[1],
+                                                       b_type,
+                                                       0,
+                                                       ldb,
+                                                       stride_b,
+                                                       beta,
+                                                       in_place ? p[3] : p[2],
+                                                       c_type,
+                                                       0,
+                                                       ldc,
+                                                       stride_c,
+                                                       p[3],
+                                                       d_type,
+                                                       0,
+                                                       ldd,
+                                                       stride_d,
+                                                       rocblas_int(count),
+                                                       compute_type,
+                                                       algo,
+                                                       solution_index,
+                                                       flags);
+            });
+    }
+
+    template <typename T>
+    rocblas_status rocblas_trsm_strided_batched_mgpu_impl(const rocblas_handle* handles,
+                                                          rocblas_int           num_handles,
+                                                          rocblas_side          side,
+                                                          rocblas_fill          uplo,
+                                                          rocblas_operation     transA,
+                                                          rocblas_diagonal      diag,
+                                                          rocblas_int           m,
+                                                          rocblas_int           n,
+                                                          const T*              alpha,
+                                                          const T*              A,
+                                                          rocblas_int           lda,
+                                                          rocblas_stride        stride_A,
+                                                          T*                    B,
+                                                          rocblas_int           ldb,
+                                                          rocblas_stride        stride_B,
+                                                          rocblas_int           batch_count)
+    {
+        RETURN_IF_ROCBLAS_ERROR(rocblas_mgpu_check_handles(handles, num_handles));
+
+        rocblas_handle handle          = handles[0];
+        auto           saved_device_id = handle->push_device_id();
+
+        // the workspace of each device is taken when the batch is shared, which a device
+        // memory size query does not support
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        // alpha is read on the host by every device
+        T alpha_h;
+        if(alpha && handle->pointer_mode == rocblas_pointer_mode_device)
+        {
+            RETURN_IF_ROCBLAS_ERROR(handle->check_capturable("device pointer mode alpha"));
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                &alpha_h, alpha, sizeof(T), hipMemcpyDeviceToHost, handle->get_stream()));
+            RETURN_IF_HIP_ERROR(handle->synchronize_stream());
+            alpha = &alpha_h;
+        }
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_trsm_strided_batched_mgpu_name<T>,
+                      num_handles,
+                      side,
+                      uplo,
+                      transA,
+                      diag,
+                      m,
+                      n,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      A,
+                      lda,
+                      stride_A,
+                      B,
+                      ldb,
+                      stride_B,
+                      batch_count);
+
+        rocblas_status arg_status = rocblas_trsm_arg_check(
+            handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
+        if(arg_status != rocblas_status_continue)
+            return arg_status;
+
+        rocblas_int                       ka = side == rocblas_side_left ? m : n;
+        std::vector<batched_mgpu_operand> ops(2);
+        ops[0]        = {A, sizeof(T), ka, ka, lda, stride_A};
+        ops[1]        = {B, sizeof(T), m, n, ldb, stride_B};
+        ops[0].input  = true;
+        ops[1].input  = !rocblas_iszero(*alpha);
+        ops[1].output = true;
+
+        double batch_flops = (rocblas_is_complex<T> ? 4.0 : 1.0) * m * n * ka;
+
+        return rocblas_batched_mgpu(
+            handles,
+            num_handles,
+            batch_count,
+            batch_flops,
+            ops,
+            [&](rocblas_handle h, const std::vector<void*>& p, int64_t count) -> rocblas_status {
+                auto  saved_ptr = h->push_pointer_mode(rocblas_pointer_mode_host);
+                auto  w_mem     = h->device_malloc(0);
+                void* w_mem_x_temp;
+                void* w_mem_x_temp_arr;
+                void* w_mem_invA;
+                void* w_mem_invA_arr;
+
+                rocblas_status perf_status
+                    = rocblas_internal_trsm_template_mem<false, T>(h,
+                                                                   side,
+                                                                   transA,
+                                                                   m,
+                                                                   n,
+                                                                   lda,
+                                                                   ldb,
+                                                                   rocblas_int(count),
+                                                                   w_mem,
+                                                                   w_mem_x_temp,
+                                                                   w_mem_x_temp_arr,
+                                                                   w_mem_invA,
+                                                                   w_mem_invA_arr,
+                                                                   (const T*)nullptr,
+                                                                   0);
+                if(perf_status != rocblas_status_success
+                   && perf_status != rocblas_status_perf_degraded)
+                    return perf_status;
+
+                RETURN_IF_ROCBLAS_ERROR(
+                    rocblas_internal_trsm_template<T>(h,
+                                                      side,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      static_cast<const T*>(p[0]),
+                                                      0,
+                                                      lda,
+                                                      stride_A,
+                                                      static_cast<T*>(p[1]),
+                                                      0,
+                                                      ldb,
+                                                      stride_B,
+                                                      rocblas_int(count),
+                                                      perf_status == rocblas_status_success,
+                                                      w_mem_x_temp,
+                                                      w_mem_x_temp_arr,
+                                                      w_mem_invA,
+                                                      w_mem_invA_arr));
+                return rocblas_status_success;
+            });
+    }
+
+} // namespace
+
+/*******************************************************************************
+ * Multi-GPU strided batched APIs
+ ******************************************************************************/
+
+extern "C" {
+
+rocblas_status rocblas_gemm_strided_batched_ex_mgpu(const rocblas_handle* handles,
+                                                    rocblas_int           num_handles,
+                                                    rocblas_operation     trans_a,
+                                                    rocblas_operation     trans_b,
+                                                    rocblas_int           m,
+                                                    rocblas_int           n,
+                                                    rocblas_int           k,
+                                                    const void*           alpha,
+                                                    const void*           a,
+                                                    rocblas_datatype      a_type,
+                                                    rocblas_int           lda,
+                                                    rocblas_stride        stride_a,
+                                                    const void*           b,
+                                                    rocblas_datatype      b_type,
+                                                    rocblas_int           ldb,
+                                                    rocblas_stride        stride_b,
+                                                    const void*           beta,
+                                                    const void*           c,
+                                                    rocblas_datatype      c_type,
+                                                    rocblas_int           ldc,
+                                                    rocblas_stride        stride_c,
+                                                    void*                 d,
+                                                    rocblas_datatype      d_type,
+                                                    rocblas_int           ldd,
+                                                    rocblas_stride        stride_d,
+                                                    rocblas_int           batch_count,
+                                                    rocblas_datatype      compute_type,
+                                                    rocblas_gemm_algo     algo,
+                                                    int32_t               solution_index,
+                                                    uint32_t              flags)
+try
+{
+    return rocblas_gemm_strided_batched_ex_mgpu_impl(handles,
+                                                     num_handles,
+                                                     trans_a,
+                                                     trans_b,
+                                                     m,
+                                                     n,
+                                                     k,
+                                                     alpha,
+                                                     a,
+                                                     a_type,
+                                                     lda,
+                                                     stride_a,
+                                                     b,
+                                                     b_type,
+                                                     ldb,
+                                                     stride_b,
+                                                     beta,
+                                                     c,
+                                                     c_type,
+                                                     ldc,
+                                                     stride_c,
+                                                     d,
+                                                     d_type,
+                                                     ldd,
+                                                     stride_d,
+                                                     batch_count,
+                                                     compute_type,
+                                                     algo,
+                                                     solution_index,
+                                                     flags);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                                  \
+    rocblas_status routine_name_(const rocblas_handle* handles,                  \
+                                 rocblas_int           num_handles,              \
+                                 rocblas_side          side,                     \
+                                 rocblas_fill          uplo,                     \
+                                 rocblas_operation     transA,                   \
+                                 rocblas_diagonal      diag,                     \
+                                 rocblas_int           m,                        \
+                                 rocblas_int           n,                        \
+                                 const T_*             alpha,                    \
+                                 const T_*             A,                        \
+                                 rocblas_int           lda,                      \
+                                 rocblas_stride        stride_A,                 \
+                                 T_*                   B,                        \
+                                 rocblas_int           ldb,                      \
+                                 rocblas_stride        stride_B,                 \
+                                 rocblas_int           batch_count)              \
+    try                                                                          \
+    {                                                                            \
+        return rocblas_trsm_strided_batched_mgpu_impl<T_>(handles,               \
+                                                          num_handles,           \
+                                                          side,                  \
+                                                          uplo,                  \
+                                                          transA,                \
+                                                          diag,                  \
+                                                          m,                     \
+                                                          n,                     \
+                                                          alpha,                 \
+                                                          A,                     \
+                                                          lda,                   \
+                                                          stride_A,              \
+                                                          B,                     \
+                                                          ldb,                   \
+                                                          stride_B,              \
+                                                          batch_count);          \
+    }                                                                            \
+    catch(...)                                                                   \
+    {                                                                            \
+        return exception_to_rocblas_status();                                    \
+    }
+
+extern "C" {
+
+IMPL(rocblas_strsm_strided_batched_mgpu, float);
+IMPL(rocblas_dtrsm_strided_batched_mgpu, double);
+IMPL(rocblas_ctrsm_strided_batched_mgpu, rocblas_float_complex);
+IMPL(rocblas_ztrsm_strided_batched_mgpu, rocblas_double_complex);
+
+} // extern "C"
+
+#undef IMPL
@@ -53,14 +53,23 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        // row major C^T = A^T*diag(x) swaps the side of diag(x), see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+        {
+            side = rocblas_row_major_side(side);
+            std::swap(m, n);
+        }
+
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
 
+        rocblas_api_scope api_scope(handle, rocblas_dgmm_name<T>);
+
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-              | rocblas_layer_mode_log_profile))
+              | rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
         {
             auto side_letter = rocblas_side_letter(side);
 
@@ -84,7 +93,7 @@ namespace
                           "--ldc",
                           ldc);
 
-            if(layer_mode & rocblas_layer_mode_log_profile)
+            if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                 log_profile(handle,
                             rocblas_dgmm_name<T>,
                             "side",
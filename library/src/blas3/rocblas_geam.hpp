@@ -53,8 +53,12 @@ inline rocblas_status rocblas_geam_arg_check(rocblas_handle    handle,
        || ldb < (transB == rocblas_operation_none ? m : n))
         return rocblas_status_invalid_size;
 
-    if((C == A && (lda != ldc || transA != rocblas_operation_none))
-       || (C == B && (ldb != ldc || transB != rocblas_operation_none)))
+    // In place, C can only be transposed if it is square, and not as both A and B
+    bool trans_a = transA != rocblas_operation_none;
+    bool trans_b = transB != rocblas_operation_none;
+    if((C == A && (lda != ldc || (trans_a && m != n)))
+       || (C == B && (ldb != ldc || (trans_b && m != n)))
+       || (C == A && C == B && trans_a && trans_b))
         return rocblas_status_invalid_size;
 
     if(!m || !n || !batch_count)
@@ -60,14 +60,20 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        // row major C^T = alpha*op(A)^T + beta*op(B)^T, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+            std::swap(m, n);
+
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
 
+        rocblas_api_scope api_scope(handle, rocblas_geam_batched_name<T>);
+
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-              | rocblas_layer_mode_log_profile))
+              | rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
         {
             auto transA_letter = rocblas_transpose_letter(transA);
             auto transB_letter = rocblas_transpose_letter(transB);
@@ -112,7 +118,7 @@ namespace
                           "--batch_count",
                           batch_count);
 
-            if(layer_mode & rocblas_layer_mode_log_profile)
+            if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                 log_profile(handle,
                             rocblas_geam_batched_name<T>,
                             "transA",
@@ -304,6 +304,128 @@ rocblas_geam_inplace_device(rocblas_operation transB,
     }
 }
 
+//  special case:
+//  C = alpha * op(A) with op(A) transposed, beta == 0. A TILE x TILE tile of A is staged in LDS,
+//  so that threads with consecutive threadIdx.x read consecutive elements of a column of A and
+//  write consecutive elements of a column of C. The padding column of the tile keeps the reads
+//  of the transposed tile free of bank conflicts.
+template <int TILE, int ROWS, typename TScal, typename TConstPtr, typename TPtr>
+ROCBLAS_KERNEL(TILE* ROWS)
+rocblas_geam_transpose_device(rocblas_operation transA,
+                              rocblas_int       m,
+                              rocblas_int       n,
+                              TScal             alpha_device_host,
+                              TConstPtr         Aa,
+                              rocblas_stride    offset_a,
+                              int64_t           lda,
+                              rocblas_stride    stride_a,
+                              TPtr              Ca,
+                              rocblas_stride    offset_c,
+                              int64_t           ldc,
+                              rocblas_stride    stride_c)
+{
+    using T = rocblas_batch_elem_t<TPtr>;
+    __shared__ T tile[TILE][TILE + 1];
+
+    auto alpha = load_scalar(alpha_device_host);
+
+    const auto* A = load_ptr_batch(Aa, blockIdx.z, offset_a, stride_a);
+    auto*       C = load_ptr_batch(Ca, blockIdx.z, offset_c, stride_c);
+
+    // C(i, j) = A(j, i) for i in [m0, m0 + TILE) and j in [n0, n0 + TILE)
+    size_t m0 = size_t(blockIdx.x) * TILE;
+    size_t n0 = size_t(blockIdx.y) * TILE;
+
+    // tile[i][j] = A(n0 + j, m0 + i)
+    for(int i = threadIdx.y; i < TILE; i += ROWS)
+        if(n0 + threadIdx.x < n && m0 + i < m)
+        {
+            T a_val = alpha ? A[(n0 + threadIdx.x) + (m0 + i) * lda] : T(0);
+            if(transA == rocblas_operation_conjugate_transpose)
+                a_val = conj(a_val);
+            tile[i][threadIdx.x] = a_val;
+        }
+
+    __syncthreads();
+
+    for(int j = threadIdx.y; j < TILE; j += ROWS)
+        if(m0 + threadIdx.x < m && n0 + j < n)
+            C[(m0 + threadIdx.x) + (n0 + j) * ldc] = alpha * tile[threadIdx.x][j];
+}
+
+//  special case:
+//  C = alpha * op(C) + beta * op(B) in place with op(C) transposed and C square. Each block
+//  transposes the pair of tiles (bx, by) and (by, bx) of C, bx <= by, through LDS: both are read
+//  before either is written, so no other block reads the elements it overwrites.
+template <int TILE, int ROWS, typename TScal, typename TConstPtr, typename TPtr>
+ROCBLAS_KERNEL(TILE* ROWS)
+rocblas_geam_transpose_inplace_device(rocblas_operation transC,
+                                      rocblas_operation transB,
+                                      rocblas_int       n,
+                                      TScal             alpha_device_host,
+                                      TScal             beta_device_host,
+                                      TConstPtr         Ba,
+                                      rocblas_stride    offset_b,
+                                      int64_t           ldb,
+                                      rocblas_stride    stride_b,
+                                      TPtr              Ca,
+                                      rocblas_stride    offset_c,
+                                      int64_t           ldc,
+                                      rocblas_stride    stride_c)
+{
+    if(blockIdx.x > blockIdx.y)
+        return;
+
+    using T = rocblas_batch_elem_t<TPtr>;
+    __shared__ T tiles[2][TILE][TILE + 1];
+
+    auto alpha = load_scalar(alpha_device_host);
+    auto beta  = load_scalar(beta_device_host);
+
+    auto* C = load_ptr_batch(Ca, blockIdx.z, offset_c, stride_c);
+
+    // tiles[t][i][j] = C(r0[t] + j, c0[t] + i), the transpose of tile t
+    const size_t r0[2] = {size_t(blockIdx.x) * TILE, size_t(blockIdx.y) * TILE};
+    const size_t c0[2] = {r0[1], r0[0]};
+
+    // a diagonal tile is its own pair
+    const int pair = blockIdx.x == blockIdx.y ? 1 : 2;
+
+    for(int t = 0; t < pair; t++)
+        for(int i = threadIdx.y; i < TILE; i += ROWS)
+            if(r0[t] + threadIdx.x < n && c0[t] + i < n)
+            {
+                T c_val = alpha ? C[(r0[t] + threadIdx.x) + (c0[t] + i) * ldc] : T(0);
+                if(transC == rocblas_operation_conjugate_transpose)
+                    c_val = conj(c_val);
+                tiles[t][i][threadIdx.x] = c_val;
+            }
+
+    __syncthreads();
+
+    // tile t of the transpose lands on the position of the other tile
+    const auto* B = beta ? load_ptr_batch(Ba, blockIdx.z, offset_b, stride_b) : nullptr;
+    for(int t = 0; t < pair; t++)
+        for(int j = threadIdx.y; j < TILE; j += ROWS)
+        {
+            size_t row = c0[t] + threadIdx.x;
+            size_t col = r0[t] + j;
+            if(row < n && col < n)
+            {
+                T val = alpha * tiles[t][threadIdx.x][j];
+                if(beta)
+                {
+                    T b_val = transB == rocblas_operation_none ? B[row + col * ldb]
+                                                               : B[col + row * ldb];
+                    if(transB == rocblas_operation_conjugate_transpose)
+                        b_val = conj(b_val);
+                    val += beta * b_val;
+                }
+                C[row + col * ldc] = val;
+            }
+        }
+}
+
 /*
  * ===========================================================================
  *    template interface
@@ -368,6 +490,118 @@ rocblas_status rocblas_geam_launcher(rocblas_handle    handle,
                               ldc,
                               stride_c);
     }
+    else if(C == A && transA != rocblas_operation_none)
+    {
+        // C <- alpha * op(C) + beta * op(B)
+        // m == n, C is transposed in place by pairs of tiles
+        static constexpr int GEAM_TILE      = 32;
+        static constexpr int GEAM_TILE_ROWS = 8;
+        rocblas_int          blocks         = (n - 1) / GEAM_TILE + 1;
+
+        dim3 geam_grid(blocks, blocks, batch_count);
+        dim3 geam_threads(GEAM_TILE, GEAM_TILE_ROWS);
+
+        if(pointer_mode == rocblas_pointer_mode_host)
+        {
+            ROCBLAS_LAUNCH_KERNEL(
+                (rocblas_geam_transpose_inplace_device<GEAM_TILE, GEAM_TILE_ROWS>),
+                geam_grid,
+                geam_threads,
+                0,
+                rocblas_stream,
+                transA,
+                transB,
+                n,
+                *alpha,
+                *beta,
+                B,
+                offset_b,
+                ldb,
+                stride_b,
+                C,
+                offset_c,
+                ldc,
+                stride_c);
+        }
+        else
+        {
+            ROCBLAS_LAUNCH_KERNEL(
+                (rocblas_geam_transpose_inplace_device<GEAM_TILE, GEAM_TILE_ROWS>),
+                geam_grid,
+                geam_threads,
+                0,
+                rocblas_stream,
+                transA,
+                transB,
+                n,
+                alpha,
+                beta,
+                B,
+                offset_b,
+                ldb,
+                stride_b,
+                C,
+                offset_c,
+                ldc,
+                stride_c);
+        }
+    }
+    else if(C == B && transB != rocblas_operation_none)
+    {
+        // C <- alpha * op(A) + beta * op(C)
+        // m == n, C is transposed in place by pairs of tiles
+        static constexpr int GEAM_TILE      = 32;
+        static constexpr int GEAM_TILE_ROWS = 8;
+        rocblas_int          blocks         = (n - 1) / GEAM_TILE + 1;
+
+        dim3 geam_grid(blocks, blocks, batch_count);
+        dim3 geam_threads(GEAM_TILE, GEAM_TILE_ROWS);
+
+        if(pointer_mode == rocblas_pointer_mode_host)
+        {
+            ROCBLAS_LAUNCH_KERNEL(
+                (rocblas_geam_transpose_inplace_device<GEAM_TILE, GEAM_TILE_ROWS>),
+                geam_grid,
+                geam_threads,
+                0,
+                rocblas_stream,
+                transB,
+                transA,
+                n,
+                *beta,
+                *alpha,
+                A,
+                offset_a,
+                lda,
+                stride_a,
+                C,
+                offset_c,
+                ldc,
+                stride_c);
+        }
+        else
+        {
+            ROCBLAS_LAUNCH_KERNEL(
+                (rocblas_geam_transpose_inplace_device<GEAM_TILE, GEAM_TILE_ROWS>),
+                geam_grid,
+                geam_threads,
+                0,
+                rocblas_stream,
+                transB,
+                transA,
+                n,
+                beta,
+                alpha,
+                A,
+                offset_a,
+                lda,
+                stride_a,
+                C,
+                offset_c,
+                ldc,
+                stride_c);
+        }
+    }
     else if(C == A)
     {
         // C <- alpha * C + beta * B
@@ -506,10 +740,41 @@ rocblas_status rocblas_geam_launcher(rocblas_handle    handle,
                                   offset_c,
                                   stride_c);
         }
+        else if(transA != rocblas_operation_none)
+        {
+            // beta == 0
+            // transpose of A staged through LDS tiles
+            static constexpr int GEAM_TILE      = 32;
+            static constexpr int GEAM_TILE_ROWS = 8;
+
+            rocblas_int blocksX = (m - 1) / GEAM_TILE + 1;
+            rocblas_int blocksY = (n - 1) / GEAM_TILE + 1;
+
+            dim3 geam_grid(blocksX, blocksY, batch_count);
+            dim3 geam_threads(GEAM_TILE, GEAM_TILE_ROWS);
+
+            ROCBLAS_LAUNCH_KERNEL((rocblas_geam_transpose_device<GEAM_TILE, GEAM_TILE_ROWS>),
+                                  geam_grid,
+                                  geam_threads,
+                                  0,
+                                  rocblas_stream,
+                                  transA,
+                                  m,
+                                  n,
+                                  *alpha,
+                                  A,
+                                  offset_a,
+                                  lda,
+                                  stride_a,
+                                  C,
+                                  offset_c,
+                                  ldc,
+                                  stride_c);
+        }
         else
         {
             // beta == 0
-            // general case for any transA, lda, ldc
+            // general case for transA == none, lda, ldc
             static constexpr int GEAM_DIM_X = 16;
             static constexpr int GEAM_DIM_Y = 16;
             rocblas_int          blocksX    = (m - 1) / GEAM_DIM_X + 1;
@@ -565,10 +830,41 @@ rocblas_status rocblas_geam_launcher(rocblas_handle    handle,
                                   offset_c,
                                   stride_c);
         }
+        else if(transB != rocblas_operation_none)
+        {
+            // alpha == 0
+            // transpose of B staged through LDS tiles
+            static constexpr int GEAM_TILE      = 32;
+            static constexpr int GEAM_TILE_ROWS = 8;
+
+            rocblas_int blocksX = (m - 1) / GEAM_TILE + 1;
+            rocblas_int blocksY = (n - 1) / GEAM_TILE + 1;
+
+            dim3 geam_grid(blocksX, blocksY, batch_count);
+            dim3 geam_threads(GEAM_TILE, GEAM_TILE_ROWS);
+
+            ROCBLAS_LAUNCH_KERNEL((rocblas_geam_transpose_device<GEAM_TILE, GEAM_TILE_ROWS>),
+                                  geam_grid,
+                                  geam_threads,
+                                  0,
+                                  rocblas_stream,
+                                  transB,
+                                  m,
+                                  n,
+                                  *beta,
+                                  B,
+                                  offset_b,
+                                  ldb,
+                                  stride_b,
+                                  C,
+                                  offset_c,
+                                  ldc,
+                                  stride_c);
+        }
         else
         {
             // alpha == 0
-            // general case for any transB, ldb, ldc
+            // general case for transB == none, ldb, ldc
             static constexpr int GEAM_DIM_X = 16;
             static constexpr int GEAM_DIM_Y = 16;
 
@@ -31,7 +31,10 @@
  * Right now Tensile requires alpha and beta to be passed by value on host.      *
  * If in device pointer mode, copy alpha and beta to host.                       *
  * If k == 0, we set alpha = 0 instead of copying from device.                   *
- * TODO: Make this asynchronous, putting synchronization closer to Tensile call. *
+ * Both copies are enqueued before a single stream synchronization so a device   *
+ * pointer mode call only stalls the host once. The synchronization cannot be    *
+ * captured in a graph, so during capture nothing is enqueued and                *
+ * rocblas_status_not_implemented is returned.                                   *
  *********************************************************************************/
 template <typename Ta, typename Tac, typename Tb, typename Tbc>
 rocblas_status rocblas_copy_alpha_beta_to_host_if_on_device(
@@ -39,6 +42,11 @@ rocblas_status rocblas_copy_alpha_beta_to_host_if_on_device(
 {
     if(handle->pointer_mode == rocblas_pointer_mode_device)
     {
+        if((alpha && k != 0) || beta)
+            RETURN_IF_ROCBLAS_ERROR(
+                handle->check_capturable("device pointer mode alpha/beta of Level 3 functions"));
+
+        bool need_sync = false;
         if(alpha)
         {
             if(k == 0)
@@ -47,17 +55,22 @@ rocblas_status rocblas_copy_alpha_beta_to_host_if_on_device(
             {
                 RETURN_IF_HIP_ERROR(hipMemcpyAsync(
                     &alpha_h, alpha, sizeof(Tac), hipMemcpyDeviceToHost, handle->get_stream()));
-                RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+                need_sync = true;
             }
-            alpha = &alpha_h;
         }
         if(beta)
         {
             RETURN_IF_HIP_ERROR(hipMemcpyAsync(
                 &beta_h, beta, sizeof(Tbc), hipMemcpyDeviceToHost, handle->get_stream()));
-            RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
-            beta = &beta_h;
+            need_sync = true;
         }
+        if(need_sync)
+            RETURN_IF_HIP_ERROR(handle->synchronize_stream());
+
+        if(alpha)
+            alpha = &alpha_h;
+        if(beta)
+            beta = &beta_h;
     }
     return rocblas_status_success;
 }
@@ -216,6 +229,30 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                            rocblas_stride    stride_c,
                                            rocblas_int       batch_count);
 
+// Device memory of a dgemm computed with rocblas_dgemm_ozaki_math_op, or 0 when the handle, or
+// the problem, does not use the Ozaki scheme
+size_t rocblas_internal_dgemm_ozaki_workspace_size(rocblas_handle handle,
+                                                   int64_t        m,
+                                                   int64_t        n,
+                                                   int64_t        k);
+
+// C = alpha * op(A) * op(B) + beta * C through int8 gemms on slices of A and B, with host alpha
+// and beta. Returns rocblas_status_continue, leaving C untouched, when the scheme is not used.
+rocblas_status rocblas_internal_dgemm_ozaki(rocblas_handle    handle,
+                                            rocblas_operation trans_a,
+                                            rocblas_operation trans_b,
+                                            int64_t           m,
+                                            int64_t           n,
+                                            int64_t           k,
+                                            double            alpha,
+                                            const double*     A,
+                                            int64_t           lda,
+                                            const double*     B,
+                                            int64_t           ldb,
+                                            double            beta,
+                                            double*           C,
+                                            int64_t           ldc);
+
 template <typename TConstPtrA, typename TConstPtrB, typename TPtr>
 rocblas_status rocblas_gemm_check_numerics(const char*       function_name,
                                            rocblas_handle    handle,
@@ -0,0 +1,65 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+
+// Whether the kernels specialized for the GEMM shapes of ROCBLAS_DECODE_GEMM_SHAPES, as decode
+// steps of inference run them, cover the types Ti, To and Tc. No kernels are built unless the
+// shapes are given when configuring.
+template <typename Ti, typename To, typename Tc>
+constexpr bool rocblas_gemm_decode_has_type()
+{
+#ifdef ROCBLAS_DECODE_GEMM
+    return std::is_same<Ti, To>{} && (std::is_same<Tc, Ti>{} || std::is_same<Tc, float>{})
+           && (std::is_same<Ti, rocblas_half>{} || std::is_same<Ti, rocblas_bfloat16>{}
+               || std::is_same<Ti, float>{} || std::is_same<Ti, double>{});
+#else
+    return false;
+#endif
+}
+
+// D = alpha * A**T * B + beta * C with the kernel specialized for m, n, k and Ti, with host alpha
+// and beta. Returns rocblas_status_continue, leaving D untouched, when no kernel matches exactly.
+template <typename Ti, typename To, typename Tc>
+rocblas_status rocblas_internal_gemm_decode(rocblas_handle    handle,
+                                            rocblas_operation trans_a,
+                                            rocblas_operation trans_b,
+                                            int64_t           m,
+                                            int64_t           n,
+                                            int64_t           k,
+                                            const Tc*         alpha,
+                                            const Ti*         A,
+                                            int64_t           lda,
+                                            rocblas_stride    stride_a,
+                                            const Ti*         B,
+                                            int64_t           ldb,
+                                            rocblas_stride    stride_b,
+                                            const Tc*         beta,
+                                            const To*         C,
+                                            int64_t           ldc,
+                                            rocblas_stride    stride_c,
+                                            To*               D,
+                                            int64_t           ldd,
+                                            rocblas_stride    stride_d,
+                                            int64_t           batch_count);
@@ -0,0 +1,259 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * Decode GEMM kernels are built for the exact shapes listed in ROCBLAS_DECODE_GEMM_SHAPES when
+ * configuring, for D = alpha * A**T * B + beta * C with one or a few columns of B, as in the
+ * decode steps of inference, where the same few shapes are run over and over. With m, n and k
+ * known at compile time, the loop over k is fully unrolled, the partial sums have a fixed LDS
+ * layout and no bounds are checked. Each kernel is chosen by an exact match of the shape ahead
+ * of Tensile.
+ */
+
+#include "rocblas_gemm_decode.hpp"
+#include "handle.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    // Types of the shape list, named as for Tensile_PRECISIONS
+    using rocblas_gemm_decode_type_f16_r  = rocblas_half;
+    using rocblas_gemm_decode_type_bf16_r = rocblas_bfloat16;
+    using rocblas_gemm_decode_type_f32_r  = float;
+    using rocblas_gemm_decode_type_f64_r  = double;
+
+    constexpr int     c_gemm_decode_NB          = 256;
+    constexpr int64_t c_gemm_decode_max_batches = 65535;
+
+    // One row of D per block: each thread sums every NB-th element of a column of A against the
+    // N columns of B, and the partial sums are reduced across the block in LDS
+    template <int NB, int M, int N, int K, typename Tacc, typename Ti, typename To>
+    ROCBLAS_KERNEL(NB)
+    rocblas_gemm_decode_kernel(Tacc           alpha,
+                               const Ti*      A,
+                               int64_t        lda,
+                               rocblas_stride stride_a,
+                               const Ti*      B,
+                               int64_t        ldb,
+                               rocblas_stride stride_b,
+                               Tacc           beta,
+                               const To*      C,
+                               int64_t        ldc,
+                               rocblas_stride stride_c,
+                               To*            D,
+                               int64_t        ldd,
+                               rocblas_stride stride_d)
+    {
+        static_assert(N <= NB, "decode GEMM kernels write one column of D per thread");
+
+        __shared__ Tacc partial[N][NB];
+
+        const int row = blockIdx.x;
+        const int tid = threadIdx.x;
+        A += blockIdx.y * stride_a + row * lda;
+        B += blockIdx.y * stride_b;
+        C += blockIdx.y * stride_c + row;
+        D += blockIdx.y * stride_d + row;
+
+        Tacc sum[N] = {};
+#pragma unroll
+        for(int i = 0; i < K / NB; i++)
+        {
+            Tacc a = Tacc(A[i * NB + tid]);
+#pragma unroll
+            for(int j = 0; j < N; j++)
+                sum[j] += a * Tacc(B[j * ldb + i * NB + tid]);
+        }
+        if constexpr(K % NB != 0)
+        {
+            if(tid < K % NB)
+            {
+                Tacc a = Tacc(A[K / NB * NB + tid]);
+#pragma unroll
+                for(int j = 0; j < N; j++)
+                    sum[j] += a * Tacc(B[j * ldb + K / NB * NB + tid]);
+            }
+        }
+
+#pragma unroll
+        for(int j = 0; j < N; j++)
+            partial[j][tid] = sum[j];
+        __syncthreads();
+
+#pragma unroll
+        for(int s = NB / 2; s > 0; s /= 2)
+        {
+            if(tid < s)
+            {
+#pragma unroll
+                for(int j = 0; j < N; j++)
+                    partial[j][tid] += partial[j][tid + s];
+            }
+            __syncthreads();
+        }
+
+        if(tid < N)
+        {
+            Tacc d = alpha * partial[tid][0];
+            if(beta != 0)
+                d += beta * Tacc(C[tid * ldc]);
+            D[tid * ldd] = To(d);
+        }
+    }
+
+    template <int M, int N, int K, typename Ti, typename To, typename Tc>
+    rocblas_status rocblas_gemm_decode_launcher(rocblas_handle handle,
+                                                Tc             alpha,
+                                                const Ti*      A,
+                                                int64_t        lda,
+                                                rocblas_stride stride_a,
+                                                const Ti*      B,
+                                                int64_t        ldb,
+                                                rocblas_stride stride_b,
+                                                Tc             beta,
+                                                const To*      C,
+                                                int64_t        ldc,
+                                                rocblas_stride stride_c,
+                                                To*            D,
+                                                int64_t        ldd,
+                                                rocblas_stride stride_d,
+                                                int64_t        batch_count)
+    {
+        // The partial sums of reduced precisions are kept in float
+        using Tacc = std::conditional_t<std::is_same<Ti, double>{}, double, float>;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+        if(handle->tensile_prefetch)
+            return rocblas_status_success;
+
+        ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_decode_kernel<c_gemm_decode_NB, M, N, K, Tacc, Ti, To>),
+                              dim3(M, batch_count),
+                              dim3(c_gemm_decode_NB),
+                              0,
+                              handle->get_stream(),
+                              Tacc(alpha),
+                              A,
+                              lda,
+                              stride_a,
+                              B,
+                              ldb,
+                              stride_b,
+                              Tacc(beta),
+                              C,
+                              ldc,
+                              stride_c,
+                              D,
+                              ldd,
+                              stride_d);
+        return rocblas_status_success;
+    }
+}
+
+template <typename Ti, typename To, typename Tc>
+rocblas_status rocblas_internal_gemm_decode(rocblas_handle    handle,
+                                            rocblas_operation trans_a,
+                                            rocblas_operation trans_b,
+                                            int64_t           m,
+                                            int64_t           n,
+                                            int64_t           k,
+                                            const Tc*         alpha,
+                                            const Ti*         A,
+                                            int64_t           lda,
+                                            rocblas_stride    stride_a,
+                                            const Ti*         B,
+                                            int64_t           ldb,
+                                            rocblas_stride    stride_b,
+                                            const Tc*         beta,
+                                            const To*         C,
+                                            int64_t           ldc,
+                                            rocblas_stride    stride_c,
+                                            To*               D,
+                                            int64_t           ldd,
+                                            rocblas_stride    stride_d,
+                                            int64_t           batch_count)
+{
+    // A with alpha == 0 is not read, which is left to the general path
+    if(trans_a != rocblas_operation_transpose || trans_b != rocblas_operation_none
+       || batch_count > c_gemm_decode_max_batches || float(*alpha) == 0)
+        return rocblas_status_continue;
+
+#define ROCBLAS_DECODE_GEMM_SHAPE(type_, m_, n_, k_)                      \
+    if constexpr(std::is_same<Ti, rocblas_gemm_decode_type_##type_>{})    \
+    {                                                                     \
+        if(m == m_ && n == n_ && k == k_)                                 \
+            return rocblas_gemm_decode_launcher<m_, n_, k_>(handle,       \
+                                                            *alpha,       \
+                                                            A,            \
+                                                            lda,          \
+                                                            stride_a,     \
+                                                            B,            \
+                                                            ldb,          \
+                                                            stride_b,     \
+                                                            *beta,        \
+                                                            C,            \
+                                                            ldc,          \
+                                                            stride_c,     \
+                                                            D,            \
+                                                            ldd,          \
+                                                            stride_d,     \
+                                                            batch_count); \
+    }
+
+#include "rocblas_gemm_decode_shapes.inc"
+
+#undef ROCBLAS_DECODE_GEMM_SHAPE
+
+    return rocblas_status_continue;
+}
+
+#define INSTANTIATE_GEMM_DECODE(Ti_, To_, Tc_)                           \
+    template rocblas_status rocblas_internal_gemm_decode<Ti_, To_, Tc_>( \
+        rocblas_handle    handle,                                        \
+        rocblas_operation trans_a,                                       \
+        rocblas_operation trans_b,                                       \
+        int64_t           m,                                             \
+        int64_t           n,                                             \
+        int64_t           k,                                             \
+        const Tc_*        alpha,                                         \
+        const Ti_*        A,                                             \
+        int64_t           lda,                                           \
+        rocblas_stride    stride_a,                                      \
+        const Ti_*        B,                                             \
+        int64_t           ldb,                                           \
+        rocblas_stride    stride_b,                                      \
+        const Tc_*        beta,                                          \
+        const To_*        C,                                             \
+        int64_t           ldc,                                           \
+        rocblas_stride    stride_c,                                      \
+        To_*              D,                                             \
+        int64_t           ldd,                                           \
+        rocblas_stride    stride_d,                                      \
+        int64_t           batch_count);
+
+INSTANTIATE_GEMM_DECODE(rocblas_half, rocblas_half, rocblas_half)
+INSTANTIATE_GEMM_DECODE(rocblas_half, rocblas_half, float)
+INSTANTIATE_GEMM_DECODE(rocblas_bfloat16, rocblas_bfloat16, rocblas_bfloat16)
+INSTANTIATE_GEMM_DECODE(rocblas_bfloat16, rocblas_bfloat16, float)
+INSTANTIATE_GEMM_DECODE(float, float, float)
+INSTANTIATE_GEMM_DECODE(double, double, double)
+
+#undef INSTANTIATE_GEMM_DECODE
@@ -0,0 +1,379 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "logging.hpp"
+#include "rocblas_gemm.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_gemm_host_name[] = "unknown";
+    template <>
+    constexpr char rocblas_gemm_host_name<float>[] = "rocblas_sgemm_host";
+    template <>
+    constexpr char rocblas_gemm_host_name<double>[] = "rocblas_dgemm_host";
+    template <>
+    constexpr char rocblas_gemm_host_name<rocblas_float_complex>[] = "rocblas_cgemm_host";
+    template <>
+    constexpr char rocblas_gemm_host_name<rocblas_double_complex>[] = "rocblas_zgemm_host";
+
+    // Largest tile dimension; each of the two pipeline slots holds an A, a B and a C tile
+    constexpr rocblas_int GEMM_HOST_MAX_TILE = 4096;
+    constexpr rocblas_int GEMM_HOST_MIN_TILE = 256;
+    constexpr int         GEMM_HOST_SLOTS    = 2;
+
+    // Streams and events of the copy-in / compute / copy-out pipeline
+    struct gemm_host_pipeline
+    {
+        enum
+        {
+            H2D,
+            COMPUTE,
+            D2H,
+            NUM_STREAMS
+        };
+
+        hipStream_t streams[NUM_STREAMS]{};
+        hipStream_t joined{};
+        hipEvent_t  start{};
+        hipEvent_t  ab_ready[GEMM_HOST_SLOTS]{}, ab_free[GEMM_HOST_SLOTS]{};
+        hipEvent_t  c_ready[GEMM_HOST_SLOTS]{}, c_done[GEMM_HOST_SLOTS]{};
+        hipEvent_t  c_free[GEMM_HOST_SLOTS]{};
+
+        rocblas_status create(rocblas_handle handle)
+        {
+            for(auto& s : streams)
+                RETURN_IF_HIP_ERROR(handle->create_helper_stream(&s));
+            RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&start, hipEventDisableTiming));
+            for(int i = 0; i < GEMM_HOST_SLOTS; ++i)
+                for(auto* e : {&ab_ready[i], &ab_free[i], &c_ready[i], &c_done[i], &c_free[i]})
+                    RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(e, hipEventDisableTiming));
+            return rocblas_status_success;
+        }
+
+        // Make the handle's stream wait on all pipeline streams; once started, the pipeline is
+        // joined back on every exit path, so that the handle's stream orders after all of its
+        // work before the device buffers are released and the streams are destroyed
+        rocblas_status join()
+        {
+            hipStream_t stream = joined;
+            joined             = nullptr;
+            for(auto s : streams)
+            {
+                RETURN_IF_HIP_ERROR(hipEventRecord(start, s));
+                RETURN_IF_HIP_ERROR(hipStreamWaitEvent(stream, start, 0));
+            }
+            return rocblas_status_success;
+        }
+
+        ~gemm_host_pipeline()
+        {
+            if(joined)
+                (void)join();
+            for(auto s : streams)
+                if(s)
+                    (void)hipStreamDestroy(s);
+            if(start)
+                (void)hipEventDestroy(start);
+            for(int i = 0; i < GEMM_HOST_SLOTS; ++i)
+                for(auto e : {ab_ready[i], ab_free[i], c_ready[i], c_done[i], c_free[i]})
+                    if(e)
+                        (void)hipEventDestroy(e);
+        }
+    };
+
+    template <typename T>
+    rocblas_status rocblas_gemm_host_impl(rocblas_handle    handle,
+                                          rocblas_operation trans_a,
+                                          rocblas_operation trans_b,
+                                          rocblas_int       m,
+                                          rocblas_int       n,
+                                          rocblas_int       k,
+                                          const T*          alpha,
+                                          const T*          A,
+                                          rocblas_int       lda,
+                                          const T*          B,
+                                          rocblas_int       ldb,
+                                          const T*          beta,
+                                          T*                C,
+                                          rocblas_int       ldc)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // row major order, see rocblas_set_order, has no column major mapping here
+        RETURN_NOT_IMPLEMENTED_IF_ROW_MAJOR(handle);
+
+        // alpha and beta are always host pointers, since all matrices are on the host
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        if(!handle->is_device_memory_size_query()
+           && handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_gemm_host_name<T>,
+                      trans_a,
+                      trans_b,
+                      m,
+                      n,
+                      k,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      A,
+                      lda,
+                      B,
+                      ldb,
+                      LOG_TRACE_SCALAR_VALUE(handle, beta),
+                      C,
+                      ldc);
+
+        rocblas_status arg_status = rocblas_gemm_arg_check(
+            handle, trans_a, trans_b, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+        if(arg_status != rocblas_status_continue)
+        {
+            RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+            return arg_status;
+        }
+
+        // With alpha == 0 only C is streamed, and it is scaled by beta
+        rocblas_int k_eff = *alpha == T(0) ? 0 : k;
+        bool        load_c = *beta != T(0);
+
+        // The gemm of a tile, from dA and dB of slot s into dC of slot c
+        const T one = 1;
+        T*      dA[GEMM_HOST_SLOTS]{}, *dB[GEMM_HOST_SLOTS]{}, *dC[GEMM_HOST_SLOTS]{};
+        auto    gemm_tile = [&](rocblas_int ib, rocblas_int jb, rocblas_int kbb, rocblas_int kk,
+                             int s, int c) {
+            return rocblas_internal_gemm_template<T>(
+                handle,
+                trans_a,
+                trans_b,
+                ib,
+                jb,
+                kbb,
+                alpha,
+                dA[s],
+                0,
+                std::max(trans_a == rocblas_operation_none ? ib : kbb, 1),
+                0,
+                dB[s],
+                0,
+                std::max(trans_b == rocblas_operation_none ? kbb : jb, 1),
+                0,
+                kk ? &one : beta,
+                dC[c],
+                0,
+                ib,
+                0,
+                1);
+        };
+
+        // Device buffers for both slots: A tile (mb x kb), B tile (kb x nb), C tile (mb x nb),
+        // and the workspace the gemms of the tiles take from the handle, found with a device
+        // memory size query for the full and the last tiles
+        rocblas_int tile = GEMM_HOST_MAX_TILE;
+        size_t      mb, nb, kb, a_bytes, b_bytes, c_bytes, gemm_workspace;
+        auto        set_tile_sizes = [&]() {
+            mb             = std::min(m, tile);
+            nb             = std::min(n, tile);
+            kb             = std::min(k_eff, tile);
+            a_bytes        = mb * kb * sizeof(T);
+            b_bytes        = kb * nb * sizeof(T);
+            c_bytes        = mb * nb * sizeof(T);
+            gemm_workspace = 0;
+            for(rocblas_int ib : {rocblas_int(mb), rocblas_int(m % mb)})
+                for(rocblas_int jb : {rocblas_int(nb), rocblas_int(n % nb)})
+                    for(rocblas_int kbb : {rocblas_int(kb), kb ? rocblas_int(k_eff % kb) : 0})
+                        if(ib && jb && (kbb || !kb))
+                            gemm_workspace = std::max(
+                                gemm_workspace, handle->device_memory_size_of([&] {
+                                    (void)gemm_tile(ib, jb, kbb, 0, 0, 0);
+                                }));
+        };
+        set_tile_sizes();
+
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(
+                a_bytes, a_bytes, b_bytes, b_bytes, c_bytes, c_bytes, gemm_workspace);
+
+        // Halve the tiles until the buffers and the workspace of the gemms fit in the device
+        // memory of the handle together. They are reserved at once, so that the device memory
+        // of the handle then covers both, and the buffers are taken again on their own, leaving
+        // the workspace of the gemms free while they are held.
+        auto reserve = [&] {
+            auto reserved = handle->device_malloc(
+                a_bytes, a_bytes, b_bytes, b_bytes, c_bytes, c_bytes, gemm_workspace);
+            return bool(reserved);
+        };
+        while(!reserve())
+        {
+            if(tile / 2 < GEMM_HOST_MIN_TILE)
+                return rocblas_status_memory_error;
+            tile /= 2;
+            set_tile_sizes();
+        }
+        auto w_mem = handle->device_malloc(a_bytes, a_bytes, b_bytes, b_bytes, c_bytes, c_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        for(int i = 0; i < GEMM_HOST_SLOTS; ++i)
+        {
+            dA[i] = static_cast<T*>(w_mem[i]);
+            dB[i] = static_cast<T*>(w_mem[GEMM_HOST_SLOTS + i]);
+            dC[i] = static_cast<T*>(w_mem[2 * GEMM_HOST_SLOTS + i]);
+        }
+
+        // Declared after w_mem, so that it is joined before the buffers are released
+        gemm_host_pipeline p;
+        RETURN_IF_ROCBLAS_ERROR(p.create(handle));
+        hipStream_t h2d = p.streams[p.H2D], compute = p.streams[p.COMPUTE],
+                    d2h = p.streams[p.D2H];
+
+        // All pipeline streams start after the work already enqueued on the handle's stream
+        RETURN_IF_HIP_ERROR(hipEventRecord(p.start, handle->get_stream()));
+        for(auto s : p.streams)
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(s, p.start, 0));
+        p.joined = handle->get_stream();
+
+        uint64_t step = 0, tile_id = 0;
+
+        for(rocblas_int j = 0; j < n; j += nb)
+        {
+            rocblas_int jb = std::min(rocblas_int(nb), n - j);
+            for(rocblas_int i = 0; i < m; i += mb, ++tile_id)
+            {
+                rocblas_int ib = std::min(rocblas_int(mb), m - i);
+                int         c  = tile_id % GEMM_HOST_SLOTS;
+
+                // Copy in the C tile once the previous tile in this slot has been copied out
+                RETURN_IF_HIP_ERROR(hipStreamWaitEvent(h2d, p.c_free[c], 0));
+                if(load_c)
+                    RETURN_IF_ROCBLAS_ERROR(rocblas_set_matrix_async(ib,
+                                                                     jb,
+                                                                     sizeof(T),
+                                                                     C + i + size_t(j) * ldc,
+                                                                     ldc,
+                                                                     dC[c],
+                                                                     ib,
+                                                                     h2d));
+                RETURN_IF_HIP_ERROR(hipEventRecord(p.c_ready[c], h2d));
+                RETURN_IF_HIP_ERROR(hipStreamWaitEvent(compute, p.c_ready[c], 0));
+
+                // Stream the k dimension; the first chunk applies beta, the rest accumulate
+                rocblas_int kk = 0;
+                do
+                {
+                    rocblas_int kbb = std::min(rocblas_int(kb), k_eff - kk);
+                    int         s   = step++ % GEMM_HOST_SLOTS;
+
+                    rocblas_int a_rows = trans_a == rocblas_operation_none ? ib : kbb;
+                    rocblas_int a_cols = trans_a == rocblas_operation_none ? kbb : ib;
+                    rocblas_int b_rows = trans_b == rocblas_operation_none ? kbb : jb;
+                    rocblas_int b_cols = trans_b == rocblas_operation_none ? jb : kbb;
+                    const T*    a_h    = trans_a == rocblas_operation_none
+                                             ? A + i + size_t(kk) * lda
+                                             : A + kk + size_t(i) * lda;
+                    const T*    b_h    = trans_b == rocblas_operation_none
+                                             ? B + kk + size_t(j) * ldb
+                                             : B + j + size_t(kk) * ldb;
+
+                    // Copy in the A and B tiles once the gemm which used this slot has finished
+                    RETURN_IF_HIP_ERROR(hipStreamWaitEvent(h2d, p.ab_free[s], 0));
+                    if(kbb)
+                    {
+                        RETURN_IF_ROCBLAS_ERROR(rocblas_set_matrix_async(
+                            a_rows, a_cols, sizeof(T), a_h, lda, dA[s], a_rows, h2d));
+                        RETURN_IF_ROCBLAS_ERROR(rocblas_set_matrix_async(
+                            b_rows, b_cols, sizeof(T), b_h, ldb, dB[s], b_rows, h2d));
+                    }
+                    RETURN_IF_HIP_ERROR(hipEventRecord(p.ab_ready[s], h2d));
+
+                    // Compute on the tiles, serialized on one stream so that any workspace
+                    // used internally by gemm is not shared between concurrent kernels. The gemm
+                    // takes its workspace after the buffers, and must not grow the device memory
+                    // of the handle while they are held.
+                    if(!handle->device_memory_fits_while_in_use(gemm_workspace))
+                        return rocblas_status_memory_error;
+                    RETURN_IF_HIP_ERROR(hipStreamWaitEvent(compute, p.ab_ready[s], 0));
+                    {
+                        auto saved_stream = handle->push_stream(compute);
+                        RETURN_IF_ROCBLAS_ERROR(gemm_tile(ib, jb, kbb, kk, s, c));
+                    }
+                    RETURN_IF_HIP_ERROR(hipEventRecord(p.ab_free[s], compute));
+                    kk += kbb;
+                } while(kk < k_eff);
+
+                // Copy out the C tile once all of its gemms have finished
+                RETURN_IF_HIP_ERROR(hipEventRecord(p.c_done[c], compute));
+                RETURN_IF_HIP_ERROR(hipStreamWaitEvent(d2h, p.c_done[c], 0));
+                RETURN_IF_ROCBLAS_ERROR(rocblas_get_matrix_async(
+                    ib, jb, sizeof(T), dC[c], ib, C + i + size_t(j) * ldc, ldc, d2h));
+                RETURN_IF_HIP_ERROR(hipEventRecord(p.c_free[c], d2h));
+            }
+        }
+
+        return p.join();
+    }
+
+} // namespace
+
+/*******************************************************************************
+ * Host-resident GEMM APIs
+ ******************************************************************************/
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                                      \
+    rocblas_status routine_name_(rocblas_handle    handle,                           \
+                                 rocblas_operation trans_a,                          \
+                                 rocblas_operation trans_b,                          \
+                                 rocblas_int       m,                                \
+                                 rocblas_int       n,                                \
+                                 rocblas_int       k,                                \
+                                 const T_*         alpha,                            \
+                                 const T_*         A,                                \
+                                 rocblas_int       lda,                              \
+                                 const T_*         B,                                \
+                                 rocblas_int       ldb,                              \
+                                 const T_*         beta,                             \
+                                 T_*               C,                                \
+                                 rocblas_int       ldc)                              \
+    try                                                                              \
+    {                                                                                \
+        return rocblas_gemm_host_impl<T_>(                                           \
+            handle, trans_a, trans_b, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc); \
+    }                                                                                \
+    catch(...)                                                                       \
+    {                                                                                \
+        return exception_to_rocblas_status();                                        \
+    }
+
+extern "C" {
+
+IMPL(rocblas_sgemm_host, float);
+IMPL(rocblas_dgemm_host, double);
+IMPL(rocblas_cgemm_host, rocblas_float_complex);
+IMPL(rocblas_zgemm_host, rocblas_double_complex);
+
+} // extern "C"
+
+#undef IMPL
@@ -62,7 +62,24 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
-        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+        // row major C^T = op(B)^T*op(A)^T is a column major gemm, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+        {
+            std::swap(trans_a, trans_b);
+            std::swap(m, n);
+            std::swap(A, B);
+            std::swap(lda, ldb);
+        }
+
+        if(handle->is_device_memory_size_query())
+        {
+            size_t ozaki_size = 0;
+            if constexpr(std::is_same_v<T, double>)
+                ozaki_size = rocblas_internal_dgemm_ozaki_workspace_size(handle, m, n, k);
+            if(!ozaki_size)
+                return rocblas_status_size_unchanged;
+            return handle->set_optimal_device_memory_size(ozaki_size);
+        }
 
         // Copy alpha and beta to host if on device
         T alpha_h, beta_h;
@@ -73,9 +90,11 @@ namespace
         // Perform logging
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+
+        rocblas_api_scope api_scope(handle, rocblas_gemm_name<T>);
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-              | rocblas_layer_mode_log_profile))
+              | rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
         {
             auto trans_a_letter = rocblas_transpose_letter(trans_a);
             auto trans_b_letter = rocblas_transpose_letter(trans_b);
@@ -122,7 +141,7 @@ namespace
                           ldc);
             }
 
-            if(layer_mode & rocblas_layer_mode_log_profile)
+            if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                 log_profile(handle,
                             rocblas_gemm_name<T>,
                             "transA",
@@ -188,27 +207,34 @@ namespace
         API_INT a_n2 = rocblas_operation_none == trans_a ? k : m;
         API_INT b_n2 = rocblas_operation_none == trans_b ? n : k;
 
-        status = ROCBLAS_API(rocblas_internal_gemm_template)(handle,
-                                                             trans_a,
-                                                             trans_b,
-                                                             m,
-                                                             n,
-                                                             k,
-                                                             alpha,
-                                                             A,
-                                                             0,
-                                                             lda,
-                                                             0,
-                                                             B,
-                                                             0,
-                                                             ldb,
-                                                             0,
-                                                             beta,
-                                                             C,
-                                                             0,
-                                                             ldc,
-                                                             0,
-                                                             1);
+        if constexpr(std::is_same_v<T, double>)
+            status = rocblas_internal_dgemm_ozaki(
+                handle, trans_a, trans_b, m, n, k, *alpha, A, lda, B, ldb, *beta, C, ldc);
+        else
+            status = rocblas_status_continue;
+
+        if(status == rocblas_status_continue)
+            status = ROCBLAS_API(rocblas_internal_gemm_template)(handle,
+                                                                 trans_a,
+                                                                 trans_b,
+                                                                 m,
+                                                                 n,
+                                                                 k,
+                                                                 alpha,
+                                                                 A,
+                                                                 0,
+                                                                 lda,
+                                                                 0,
+                                                                 B,
+                                                                 0,
+                                                                 ldb,
+                                                                 0,
+                                                                 beta,
+                                                                 C,
+                                                                 0,
+                                                                 ldc,
+                                                                 0,
+                                                                 1);
 
         if(status != rocblas_status_success)
             return status;
@@ -0,0 +1,425 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "logging.hpp"
+#include "rocblas_gemm.hpp"
+#include "rocblas_mgpu.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_gemm_mgpu_name[] = "unknown";
+    template <>
+    constexpr char rocblas_gemm_mgpu_name<float>[] = "rocblas_sgemm_mgpu";
+    template <>
+    constexpr char rocblas_gemm_mgpu_name<double>[] = "rocblas_dgemm_mgpu";
+    template <>
+    constexpr char rocblas_gemm_mgpu_name<rocblas_float_complex>[] = "rocblas_cgemm_mgpu";
+    template <>
+    constexpr char rocblas_gemm_mgpu_name<rocblas_double_complex>[] = "rocblas_zgemm_mgpu";
+
+    // Largest k chunk of the A and B panels copied to a device; each of the two pipeline
+    // slots of a device holds a chunk of its A panel and of its B panel
+    constexpr rocblas_int GEMM_MGPU_MAX_KB = 2048;
+    constexpr rocblas_int GEMM_MGPU_MIN_KB = 128;
+    constexpr int         GEMM_MGPU_SLOTS  = 2;
+
+    // 2D split of C over the devices: block (r, c) is computed by device r * cols + c, and
+    // block 0 by the device of the first handle, where A, B and C reside
+    struct gemm_mgpu_split
+    {
+        int         rows = 1, cols = 1;
+        rocblas_int mb = 0, nb = 0;
+    };
+
+    // Choose the split balancing the compute time of the largest block against the time to
+    // copy its A and B panels and its C block over a peer link, which overlap, so each device
+    // count and grid shape is estimated as the larger of the two
+    template <typename T>
+    gemm_mgpu_split gemm_mgpu_choose_split(
+        int devices, rocblas_int m, rocblas_int n, rocblas_int k, bool load_c, double flops)
+    {
+        constexpr double flops_per_fma = rocblas_is_complex<T> ? 8 : 2;
+        const double     link          = rocblas_mgpu_link_bytes_per_sec();
+
+        gemm_mgpu_split best;
+        best.mb          = m;
+        best.nb          = n;
+        double best_time = flops_per_fma * m * n * k / flops;
+
+        for(int p = 2; p <= devices; ++p)
+            for(int rows = 1; rows <= p; ++rows)
+            {
+                if(p % rows || rows > m || p / rows > n)
+                    continue;
+                int         cols = p / rows;
+                rocblas_int mb   = (m + rows - 1) / rows;
+                rocblas_int nb   = (n + cols - 1) / cols;
+
+                double compute = flops_per_fma * mb * nb * k / flops;
+                double bytes   = (double(mb) * k + double(k) * nb + (load_c ? 2.0 : 1.0) * mb * nb)
+                               * sizeof(T);
+                double time    = std::max(compute, bytes / link);
+
+                // a device is only added when it saves time
+                if(time < best_time)
+                {
+                    best_time = time;
+                    best      = {rows, cols, mb, nb};
+                }
+            }
+        return best;
+    }
+
+    // Pipeline of a device computing a block of C from copies of its A and B panels: a copy
+    // stream copies in the next k chunks while the stream of its handle computes the current
+    // ones, and copies the block back to C when they are done
+    struct gemm_mgpu_device
+    {
+        rocblas_handle handle = nullptr;
+        hipStream_t    copy{};
+        hipEvent_t     c_ready{}, done{}, finished{};
+        hipEvent_t     ab_ready[GEMM_MGPU_SLOTS]{}, ab_free[GEMM_MGPU_SLOTS]{};
+
+        rocblas_status create(rocblas_handle h)
+        {
+            handle               = h;
+            auto saved_device_id = handle->push_device_id();
+            RETURN_IF_HIP_ERROR(handle->create_helper_stream(&copy));
+            for(auto* e : {&c_ready, &done, &finished})
+                RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(e, hipEventDisableTiming));
+            for(int i = 0; i < GEMM_MGPU_SLOTS; ++i)
+                for(auto* e : {&ab_ready[i], &ab_free[i]})
+                    RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(e, hipEventDisableTiming));
+            return rocblas_status_success;
+        }
+
+        // Pending work completes before the resources are released
+        ~gemm_mgpu_device()
+        {
+            if(!handle)
+                return;
+            auto saved_device_id = handle->push_device_id();
+            if(copy)
+                (void)hipStreamDestroy(copy);
+            for(auto e : {c_ready, done, finished})
+                if(e)
+                    (void)hipEventDestroy(e);
+            for(int i = 0; i < GEMM_MGPU_SLOTS; ++i)
+                for(auto e : {ab_ready[i], ab_free[i]})
+                    if(e)
+                        (void)hipEventDestroy(e);
+        }
+    };
+
+    template <typename T>
+    rocblas_status rocblas_gemm_mgpu_impl(const rocblas_handle* handles,
+                                          rocblas_int           num_handles,
+                                          rocblas_operation     trans_a,
+                                          rocblas_operation     trans_b,
+                                          rocblas_int           m,
+                                          rocblas_int           n,
+                                          rocblas_int           k,
+                                          const T*              alpha,
+                                          const T*              A,
+                                          rocblas_int           lda,
+                                          const T*              B,
+                                          rocblas_int           ldb,
+                                          const T*              beta,
+                                          T*                    C,
+                                          rocblas_int           ldc)
+    {
+        RETURN_IF_ROCBLAS_ERROR(rocblas_mgpu_check_handles(handles, num_handles));
+
+        rocblas_handle handle          = handles[0];
+        auto           saved_device_id = handle->push_device_id();
+
+        // the workspace of each device is taken when the problem is split, which a device
+        // memory size query does not support
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        // alpha and beta are host pointers, read by every device
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_gemm_mgpu_name<T>,
+                      num_handles,
+                      trans_a,
+                      trans_b,
+                      m,
+                      n,
+                      k,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      A,
+                      lda,
+                      B,
+                      ldb,
+                      LOG_TRACE_SCALAR_VALUE(handle, beta),
+                      C,
+                      ldc);
+
+        rocblas_status arg_status = rocblas_gemm_arg_check(
+            handle, trans_a, trans_b, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+        if(arg_status != rocblas_status_continue)
+            return arg_status;
+
+        rocblas_int k_eff  = *alpha == T(0) ? 0 : k;
+        bool        load_c = *beta != T(0);
+
+        // With alpha == 0, the first device applies beta alone
+        int                         home  = handle->getDevice();
+        std::vector<rocblas_handle> peers = k_eff ? rocblas_mgpu_peers(handles, num_handles)
+                                                  : std::vector<rocblas_handle>{handle};
+
+        double          flops = rocblas_mgpu_device_flops(home, sizeof(real_t<T>));
+        gemm_mgpu_split split{1, 1, m, n};
+        if(flops > 0)
+            split = gemm_mgpu_choose_split<T>(peers.size(), m, n, k_eff, load_c, flops);
+
+        // The other devices start after the work already enqueued on the first handle, when
+        // the c_ready event of the first device is recorded
+        hipStream_t      home_stream = handle->get_stream();
+        gemm_mgpu_device home_dev;
+        RETURN_IF_ROCBLAS_ERROR(home_dev.create(handle));
+        hipEvent_t start = home_dev.c_ready;
+        RETURN_IF_HIP_ERROR(hipEventRecord(start, home_stream));
+
+        const T                       one = 1;
+        int                           num = split.rows * split.cols;
+        std::vector<gemm_mgpu_device> devices(num);
+
+        for(int d = 1; d < num; ++d)
+        {
+            rocblas_int i  = (d / split.cols) * split.mb;
+            rocblas_int j  = (d % split.cols) * split.nb;
+            rocblas_int ib = std::max(0, std::min(split.mb, m - i));
+            rocblas_int jb = std::max(0, std::min(split.nb, n - j));
+            if(!ib || !jb)
+                continue;
+
+            gemm_mgpu_device& dev       = devices[d];
+            rocblas_handle    dh        = peers[d];
+            auto              saved_id  = dh->push_device_id();
+            auto              saved_ptr = dh->push_pointer_mode(rocblas_pointer_mode_host);
+            RETURN_IF_ROCBLAS_ERROR(dev.create(dh));
+            hipStream_t compute = dh->get_stream();
+
+            // The gemm of a chunk of kbb of the panels, from dA and dB of slot s into dC
+            T*   dA[GEMM_MGPU_SLOTS]{}, *dB[GEMM_MGPU_SLOTS]{}, *dC = nullptr;
+            auto gemm_chunk = [&](rocblas_int kbb, int s, const T* beta_chunk) {
+                return rocblas_internal_gemm_template<T>(
+                    dh,
+                    trans_a,
+                    trans_b,
+                    ib,
+                    jb,
+                    kbb,
+                    alpha,
+                    dA[s],
+                    0,
+                    trans_a == rocblas_operation_none ? ib : kbb,
+                    0,
+                    dB[s],
+                    0,
+                    trans_b == rocblas_operation_none ? kbb : jb,
+                    0,
+                    beta_chunk,
+                    dC,
+                    0,
+                    ib,
+                    0,
+                    1);
+            };
+
+            // The workspace the gemms take from the handle, found with a device memory size
+            // query for the full chunks and the last one
+            rocblas_int kb = std::min(k_eff, GEMM_MGPU_MAX_KB);
+            size_t      a_bytes, b_bytes, c_bytes = size_t(ib) * jb * sizeof(T), gemm_workspace;
+            auto        set_chunk_sizes = [&]() {
+                a_bytes        = size_t(ib) * kb * sizeof(T);
+                b_bytes        = size_t(kb) * jb * sizeof(T);
+                gemm_workspace = 0;
+                for(rocblas_int kbb : {kb, k_eff % kb})
+                    if(kbb)
+                        gemm_workspace = std::max(gemm_workspace, dh->device_memory_size_of([&] {
+                            (void)gemm_chunk(kbb, 0, beta);
+                        }));
+            };
+
+            // Halve the k chunks until the buffers and the workspace of the gemms fit in the
+            // device memory of the handle together. They are reserved at once, so that the
+            // device memory of the handle then covers both, and the buffers are taken again on
+            // their own, leaving the workspace of the gemms free while they are held.
+            auto reserve = [&] {
+                auto reserved = dh->device_malloc(
+                    a_bytes, a_bytes, b_bytes, b_bytes, c_bytes, gemm_workspace);
+                return bool(reserved);
+            };
+            set_chunk_sizes();
+            while(!reserve())
+            {
+                if(kb / 2 < GEMM_MGPU_MIN_KB)
+                    return rocblas_status_memory_error;
+                kb /= 2;
+                set_chunk_sizes();
+            }
+            auto w_mem = dh->device_malloc(a_bytes, a_bytes, b_bytes, b_bytes, c_bytes);
+            if(!w_mem)
+                return rocblas_status_memory_error;
+
+            dA[0] = static_cast<T*>(w_mem[0]);
+            dA[1] = static_cast<T*>(w_mem[1]);
+            dB[0] = static_cast<T*>(w_mem[2]);
+            dB[1] = static_cast<T*>(w_mem[3]);
+            dC    = static_cast<T*>(w_mem[4]);
+
+            // Copy in the C block, and start the device after the first handle
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(dev.copy, start, 0));
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(compute, start, 0));
+            if(load_c)
+                RETURN_IF_ROCBLAS_ERROR(rocblas_mgpu_copy_matrix(
+                    ib, jb, sizeof(T), C + i + size_t(j) * ldc, ldc, dC, ib, dev.copy));
+            RETURN_IF_HIP_ERROR(hipEventRecord(dev.c_ready, dev.copy));
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(compute, dev.c_ready, 0));
+
+            // Stream the k dimension of the panels; the first chunk applies beta, the rest
+            // accumulate
+            for(rocblas_int kk = 0, step = 0; kk < k_eff; kk += kb, ++step)
+            {
+                rocblas_int kbb = std::min(kb, k_eff - kk);
+                int         s   = step % GEMM_MGPU_SLOTS;
+
+                rocblas_int a_rows = trans_a == rocblas_operation_none ? ib : kbb;
+                rocblas_int a_cols = trans_a == rocblas_operation_none ? kbb : ib;
+                rocblas_int b_rows = trans_b == rocblas_operation_none ? kbb : jb;
+                rocblas_int b_cols = trans_b == rocblas_operation_none ? jb : kbb;
+                const T*    a_src  = trans_a == rocblas_operation_none ? A + i + size_t(kk) * lda
+                                                                       : A + kk + size_t(i) * lda;
+                const T*    b_src  = trans_b == rocblas_operation_none ? B + kk + size_t(j) * ldb
+                                                                       : B + j + size_t(kk) * ldb;
+
+                // Copy in the chunks once the gemm which used this slot has finished
+                if(step >= GEMM_MGPU_SLOTS)
+                    RETURN_IF_HIP_ERROR(hipStreamWaitEvent(dev.copy, dev.ab_free[s], 0));
+                RETURN_IF_ROCBLAS_ERROR(rocblas_mgpu_copy_matrix(
+                    a_rows, a_cols, sizeof(T), a_src, lda, dA[s], a_rows, dev.copy));
+                RETURN_IF_ROCBLAS_ERROR(rocblas_mgpu_copy_matrix(
+                    b_rows, b_cols, sizeof(T), b_src, ldb, dB[s], b_rows, dev.copy));
+                RETURN_IF_HIP_ERROR(hipEventRecord(dev.ab_ready[s], dev.copy));
+
+                // The gemm takes its workspace after the buffers, and must not grow the device
+                // memory of the handle while they are held
+                if(!dh->device_memory_fits_while_in_use(gemm_workspace))
+                    return rocblas_status_memory_error;
+                RETURN_IF_HIP_ERROR(hipStreamWaitEvent(compute, dev.ab_ready[s], 0));
+                RETURN_IF_ROCBLAS_ERROR(gemm_chunk(kbb, s, kk ? &one : beta));
+                RETURN_IF_HIP_ERROR(hipEventRecord(dev.ab_free[s], compute));
+            }
+
+            // Copy the block back to C once all of its gemms have finished; the stream of the
+            // handle waits for the copy, which uses its workspace
+            RETURN_IF_HIP_ERROR(hipEventRecord(dev.done, compute));
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(dev.copy, dev.done, 0));
+            RETURN_IF_ROCBLAS_ERROR(rocblas_mgpu_copy_matrix(
+                ib, jb, sizeof(T), dC, ib, C + i + size_t(j) * ldc, ldc, dev.copy));
+            RETURN_IF_HIP_ERROR(hipEventRecord(dev.finished, dev.copy));
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(compute, dev.finished, 0));
+        }
+
+        // The first device computes block 0 in place, while the others run
+        RETURN_IF_ROCBLAS_ERROR(rocblas_internal_gemm_template<T>(handle,
+                                                                  trans_a,
+                                                                  trans_b,
+                                                                  std::min(split.mb, m),
+                                                                  std::min(split.nb, n),
+                                                                  k_eff,
+                                                                  alpha,
+                                                                  A,
+                                                                  0,
+                                                                  lda,
+                                                                  0,
+                                                                  B,
+                                                                  0,
+                                                                  ldb,
+                                                                  0,
+                                                                  beta,
+                                                                  C,
+                                                                  0,
+                                                                  ldc,
+                                                                  0,
+                                                                  1));
+
+        // Join the other devices back to the stream of the first handle
+        for(int d = 1; d < num; ++d)
+            if(devices[d].handle)
+                RETURN_IF_HIP_ERROR(hipStreamWaitEvent(home_stream, devices[d].finished, 0));
+
+        return rocblas_status_success;
+    }
+
+} // namespace
+
+/*******************************************************************************
+ * Multi-GPU GEMM APIs
+ ******************************************************************************/
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                                                  \
+    rocblas_status routine_name_(const rocblas_handle* handles,                                  \
+                                 rocblas_int           num_handles,                              \
+                                 rocblas_operation     trans_a,                                  \
+                                 rocblas_operation     trans_b,                                  \
+                                 rocblas_int           m,                                        \
+                                 rocblas_int           n,                                        \
+                                 rocblas_int           k,                                        \
+                                 const T_*             alpha,                                    \
+                                 const T_*             A,                                        \
+                                 rocblas_int           lda,                                      \
+                                 const T_*             B,                                        \
+                                 rocblas_int           ldb,                                      \
+                                 const T_*             beta,                                     \
+                                 T_*                   C,                                        \
+                                 rocblas_int           ldc)                                      \
+    try                                                                                          \
+    {                                                                                            \
+        return rocblas_gemm_mgpu_impl<T_>(                                                       \
+            handles, num_handles, trans_a, trans_b, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc); \
+    }                                                                                            \
+    catch(...)                                                                                   \
+    {                                                                                            \
+        return exception_to_rocblas_status();                                                    \
+    }
+
+extern "C" {
+
+IMPL(rocblas_sgemm_mgpu, float);
+IMPL(rocblas_dgemm_mgpu, double);
+IMPL(rocblas_cgemm_mgpu, rocblas_float_complex);
+IMPL(rocblas_zgemm_mgpu, rocblas_double_complex);
+
+} // extern "C"
+
+#undef IMPL
@@ -0,0 +1,349 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * dgemm through the Ozaki scheme: each row of op(A) and column of op(B) is scaled by a power of
+ * two below 1 and split into slices of 7-bit signed digits, so that
+ *
+ *     op(A) = diag(2^ea) * sum_s 2^(-7(s+1)) * A_s,    op(B) = sum_t 2^(-7(t+1)) * B_t * diag(2^eb)
+ *
+ * with int8 matrices A_s and B_t. Each product A_s * B_t is an int8 gemm with int32 accumulation,
+ * which is exact as long as k * 127 * 127 fits in int32, and the products with s + t < slices are
+ * scaled back and summed in double.
+ */
+
+#include "../blas_ex/rocblas_gemm_ex.hpp"
+#include "handle.hpp"
+#include "rocblas_gemm.hpp"
+
+namespace
+{
+    // Bits of one slice; the digits are within [-127, 127]
+    constexpr int c_ozaki_slice_bits = 7;
+
+    // Longest k of one int8 gemm, keeping its int32 accumulation exact
+    constexpr int64_t c_ozaki_max_k = int64_t(1) << 17;
+
+    constexpr int c_ozaki_NB = 256;
+
+    bool rocblas_dgemm_ozaki_supported(rocblas_handle handle, int64_t m, int64_t n, int64_t k)
+    {
+        int64_t max_dim = std::numeric_limits<rocblas_int>::max();
+        return handle->math_mode == rocblas_dgemm_ozaki_math_op && m > 0 && n > 0 && k > 0
+               && m <= max_dim && n <= max_dim && m * k <= max_dim && k * n <= max_dim
+               && m * n <= max_dim;
+    }
+
+    // exponents[v] such that all |X[v * stride_v + l * stride_l]| < 2^exponents[v]
+    template <int NB>
+    ROCBLAS_KERNEL(NB)
+    rocblas_ozaki_exponent_kernel(
+        rocblas_int len, const double* X, int64_t stride_v, int64_t stride_l, int* exponents)
+    {
+        __shared__ double smax[NB];
+
+        X += blockIdx.x * stride_v;
+
+        double amax = 0;
+        for(rocblas_int l = threadIdx.x; l < len; l += NB)
+            amax = fmax(amax, fabs(X[l * stride_l]));
+
+        smax[threadIdx.x] = amax;
+        __syncthreads();
+        for(int i = NB / 2; i > 0; i /= 2)
+        {
+            if(threadIdx.x < i)
+                smax[threadIdx.x] = fmax(smax[threadIdx.x], smax[threadIdx.x + i]);
+            __syncthreads();
+        }
+
+        if(threadIdx.x == 0)
+        {
+            int e = 0;
+            frexp(smax[0], &e);
+            exponents[blockIdx.x] = e;
+        }
+    }
+
+    // Splits the rows (V_INNER) or columns of a matrix into slices of int8 digits, stored as
+    // rows by size / rows column major matrices one after the other
+    template <int NB, bool V_INNER>
+    ROCBLAS_KERNEL(NB)
+    rocblas_ozaki_split_kernel(int64_t       rows,
+                               int64_t       size,
+                               const double* X,
+                               int64_t       stride_v,
+                               int64_t       stride_l,
+                               const int*    exponents,
+                               int           slices,
+                               int8_t*       digits)
+    {
+        for(int64_t idx = blockIdx.x * int64_t(NB) + threadIdx.x; idx < size;
+            idx += int64_t(gridDim.x) * NB)
+        {
+            int64_t v = V_INNER ? idx % rows : idx / rows;
+            int64_t l = V_INNER ? idx / rows : idx % rows;
+
+            // scaling by powers of two and removing the integer part are exact
+            double x = ldexp(X[v * stride_v + l * stride_l], -exponents[v]);
+            for(int s = 0; s < slices; s++)
+            {
+                x                      = ldexp(x, c_ozaki_slice_bits);
+                double d               = trunc(x);
+                digits[s * size + idx] = int8_t(d);
+                x                      = x - d;
+            }
+        }
+    }
+
+    // W += 2^(ea[i] + eb[j] - shift) * P for the m by n int32 product P of two slices
+    template <int NB>
+    ROCBLAS_KERNEL(NB)
+    rocblas_ozaki_accumulate_kernel(rocblas_int    m,
+                                    int64_t        size,
+                                    const int32_t* P,
+                                    const int*     ea,
+                                    const int*     eb,
+                                    int            shift,
+                                    bool           first,
+                                    double*        W)
+    {
+        for(int64_t idx = blockIdx.x * int64_t(NB) + threadIdx.x; idx < size;
+            idx += int64_t(gridDim.x) * NB)
+        {
+            double p = ldexp(double(P[idx]), ea[idx % m] + eb[idx / m] - shift);
+            W[idx]   = first ? p : W[idx] + p;
+        }
+    }
+
+    template <int NB>
+    ROCBLAS_KERNEL(NB)
+    rocblas_ozaki_store_kernel(rocblas_int   m,
+                               int64_t       size,
+                               double        alpha,
+                               const double* W,
+                               double        beta,
+                               double*       C,
+                               int64_t       ldc)
+    {
+        for(int64_t idx = blockIdx.x * int64_t(NB) + threadIdx.x; idx < size;
+            idx += int64_t(gridDim.x) * NB)
+        {
+            double* c = C + (idx / m) * ldc + idx % m;
+            *c        = beta == 0 ? alpha * W[idx] : alpha * W[idx] + beta * *c;
+        }
+    }
+
+    dim3 rocblas_ozaki_grid(int64_t size)
+    {
+        return dim3(rocblas_int(std::min((size - 1) / c_ozaki_NB + 1, c_i64_grid_X_chunk)));
+    }
+
+} // namespace
+
+size_t rocblas_internal_dgemm_ozaki_workspace_size(rocblas_handle handle,
+                                                   int64_t        m,
+                                                   int64_t        n,
+                                                   int64_t        k)
+{
+    if(!rocblas_dgemm_ozaki_supported(handle, m, n, k))
+        return 0;
+
+    // digits of A and B, the int32 product of two slices, the double sum, and the exponents
+    size_t slices = handle->ozaki_slices;
+    return slices * (m * k + k * n) + m * n * (sizeof(int32_t) + sizeof(double))
+           + (m + n) * sizeof(int);
+}
+
+rocblas_status rocblas_internal_dgemm_ozaki(rocblas_handle    handle,
+                                            rocblas_operation trans_a,
+                                            rocblas_operation trans_b,
+                                            int64_t           m,
+                                            int64_t           n,
+                                            int64_t           k,
+                                            double            alpha,
+                                            const double*     A,
+                                            int64_t           lda,
+                                            const double*     B,
+                                            int64_t           ldb,
+                                            double            beta,
+                                            double*           C,
+                                            int64_t           ldc)
+{
+    if(alpha == 0 || !rocblas_dgemm_ozaki_supported(handle, m, n, k))
+        return rocblas_status_continue;
+
+    int    slices = handle->ozaki_slices;
+    size_t size_a = size_t(m) * k, size_b = size_t(k) * n, size_c = size_t(m) * n;
+
+    auto w_mem = handle->device_malloc(slices * size_a,
+                                       slices * size_b,
+                                       size_c * sizeof(int32_t),
+                                       size_c * sizeof(double),
+                                       m * sizeof(int),
+                                       n * sizeof(int));
+    if(!w_mem)
+        return rocblas_status_continue;
+
+    int8_t*  digits_a = (int8_t*)w_mem[0];
+    int8_t*  digits_b = (int8_t*)w_mem[1];
+    int32_t* P        = (int32_t*)w_mem[2];
+    double*  W        = (double*)w_mem[3];
+    int*     ea       = (int*)w_mem[4];
+    int*     eb       = (int*)w_mem[5];
+
+    hipStream_t stream = handle->get_stream();
+
+    // element (v, l) of the rows of op(A) and of the columns of op(B)
+    bool    a_none = trans_a == rocblas_operation_none;
+    bool    b_none = trans_b == rocblas_operation_none;
+    int64_t a_v = a_none ? 1 : lda, a_l = a_none ? lda : 1;
+    int64_t b_v = b_none ? ldb : 1, b_l = b_none ? 1 : ldb;
+
+    ROCBLAS_LAUNCH_KERNEL((rocblas_ozaki_exponent_kernel<c_ozaki_NB>),
+                          dim3(m),
+                          dim3(c_ozaki_NB),
+                          0,
+                          stream,
+                          k,
+                          A,
+                          a_v,
+                          a_l,
+                          ea);
+    ROCBLAS_LAUNCH_KERNEL((rocblas_ozaki_exponent_kernel<c_ozaki_NB>),
+                          dim3(n),
+                          dim3(c_ozaki_NB),
+                          0,
+                          stream,
+                          k,
+                          B,
+                          b_v,
+                          b_l,
+                          eb);
+
+    // the slices of A are m by k and those of B k by n, both column major
+    ROCBLAS_LAUNCH_KERNEL((rocblas_ozaki_split_kernel<c_ozaki_NB, true>),
+                          rocblas_ozaki_grid(size_a),
+                          dim3(c_ozaki_NB),
+                          0,
+                          stream,
+                          m,
+                          size_a,
+                          A,
+                          a_v,
+                          a_l,
+                          ea,
+                          slices,
+                          digits_a);
+    ROCBLAS_LAUNCH_KERNEL((rocblas_ozaki_split_kernel<c_ozaki_NB, false>),
+                          rocblas_ozaki_grid(size_b),
+                          dim3(c_ozaki_NB),
+                          0,
+                          stream,
+                          k,
+                          size_b,
+                          B,
+                          b_v,
+                          b_l,
+                          eb,
+                          slices,
+                          digits_b);
+
+    int32_t one = 1, zero = 0;
+    bool    first = true;
+    for(int64_t kc = 0; kc < k; kc += c_ozaki_max_k)
+    {
+        rocblas_int k_chunk = rocblas_int(std::min(k - kc, c_ozaki_max_k));
+
+        // the smallest products first, summing terms of similar magnitude
+        for(int d = slices - 1; d >= 0; d--)
+        {
+            for(int s = 0; s <= d; s++)
+            {
+                int t = d - s;
+                RETURN_IF_ROCBLAS_ERROR(rocblas_gemm_ex_template<false>(handle,
+                                                                        rocblas_operation_none,
+                                                                        rocblas_operation_none,
+                                                                        m,
+                                                                        n,
+                                                                        k_chunk,
+                                                                        &one,
+                                                                        digits_a,
+                                                                        rocblas_datatype_i8_r,
+                                                                        s * size_a + kc * m,
+                                                                        m,
+                                                                        0,
+                                                                        digits_b,
+                                                                        rocblas_datatype_i8_r,
+                                                                        t * size_b + kc,
+                                                                        k,
+                                                                        0,
+                                                                        &zero,
+                                                                        P,
+                                                                        rocblas_datatype_i32_r,
+                                                                        0,
+                                                                        m,
+                                                                        0,
+                                                                        P,
+                                                                        rocblas_datatype_i32_r,
+                                                                        0,
+                                                                        m,
+                                                                        0,
+                                                                        1,
+                                                                        rocblas_datatype_i32_r,
+                                                                        rocblas_gemm_algo_standard,
+                                                                        0,
+                                                                        0));
+
+                ROCBLAS_LAUNCH_KERNEL((rocblas_ozaki_accumulate_kernel<c_ozaki_NB>),
+                                      rocblas_ozaki_grid(size_c),
+                                      dim3(c_ozaki_NB),
+                                      0,
+                                      stream,
+                                      m,
+                                      size_c,
+                                      P,
+                                      ea,
+                                      eb,
+                                      c_ozaki_slice_bits * (d + 2),
+                                      first,
+                                      W);
+                first = false;
+            }
+        }
+    }
+
+    ROCBLAS_LAUNCH_KERNEL((rocblas_ozaki_store_kernel<c_ozaki_NB>),
+                          rocblas_ozaki_grid(size_c),
+                          dim3(c_ozaki_NB),
+                          0,
+                          stream,
+                          m,
+                          size_c,
+                          alpha,
+                          W,
+                          beta,
+                          C,
+                          ldc);
+
+    return rocblas_status_success;
+}
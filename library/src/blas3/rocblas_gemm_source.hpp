@@ -27,6 +27,230 @@
 
 namespace
 {
+    // Kernel argument form of a rocblas_gemm_epilogue; bias, scales and aux have the type of D
+    struct rocblas_gemm_epilogue_args
+    {
+        const void*    bias                = nullptr;
+        rocblas_stride stride_bias         = 0;
+        void*          aux                 = nullptr;
+        int64_t        ldaux               = 0;
+        rocblas_stride stride_aux          = 0;
+        const void*    scale_row           = nullptr;
+        rocblas_stride stride_scale_row    = 0;
+        const void*    scale_column        = nullptr;
+        rocblas_stride stride_scale_column = 0;
+        int32_t        bias_row            = 0;
+        int32_t        activation          = rocblas_gemm_epilogue_activation_none;
+
+        // scalars of the batches in the compute type, which replace alpha and beta
+        const void*    alpha_batch  = nullptr;
+        rocblas_stride stride_alpha = 0;
+        const void*    beta_batch   = nullptr;
+        rocblas_stride stride_beta  = 0;
+
+        rocblas_gemm_epilogue_args() = default;
+
+        explicit rocblas_gemm_epilogue_args(const rocblas_gemm_epilogue*      epilogue,
+                                            const rocblas_gemm_batch_scalars* scalars = nullptr)
+        {
+            if(scalars)
+            {
+                alpha_batch  = scalars->alpha;
+                stride_alpha = scalars->stride_alpha;
+                beta_batch   = scalars->beta;
+                stride_beta  = scalars->stride_beta;
+            }
+            if(!epilogue)
+                return;
+            if(epilogue->bias_mode != rocblas_gemm_epilogue_bias_none)
+                bias = epilogue->bias;
+            stride_bias = epilogue->stride_bias;
+            aux         = epilogue->aux;
+            ldaux       = epilogue->ldaux;
+            stride_aux  = epilogue->stride_aux;
+            bias_row    = epilogue->bias_mode == rocblas_gemm_epilogue_bias_row;
+            activation  = epilogue->activation;
+
+            scale_row           = epilogue->scale_row;
+            stride_scale_row    = epilogue->stride_scale_row;
+            scale_column        = epilogue->scale_column;
+            stride_scale_column = epilogue->stride_scale_column;
+        }
+
+        __host__ __device__ bool active() const
+        {
+            return bias || aux || scale_row || scale_column
+                   || activation != rocblas_gemm_epilogue_activation_none;
+        }
+
+        __host__ __device__ bool batch_scalars() const
+        {
+            return alpha_batch;
+        }
+
+        // Epilogue of the batches starting at batch b_base, for launches split over batches
+        template <typename To>
+        rocblas_gemm_epilogue_args batch_offset(int64_t b_base) const
+        {
+            rocblas_gemm_epilogue_args args = *this;
+            if(bias)
+                args.bias = (const To*)bias + b_base * stride_bias;
+            if(aux)
+                args.aux = (To*)aux + b_base * stride_aux;
+            if(scale_row)
+                args.scale_row = (const To*)scale_row + b_base * stride_scale_row;
+            if(scale_column)
+                args.scale_column = (const To*)scale_column + b_base * stride_scale_column;
+            return args;
+        }
+    };
+
+    // Replaces alpha and beta by the scalars of a batch, when they are given
+    template <typename Tc>
+    ROCBLAS_KERNEL_ILF void rocblas_gemm_batch_scalars_load(
+        const rocblas_gemm_epilogue_args& epilogue, int64_t batch, Tc& alpha, Tc& beta)
+    {
+        if(epilogue.alpha_batch)
+        {
+            alpha = ((const Tc*)epilogue.alpha_batch)[batch * epilogue.stride_alpha];
+            beta  = ((const Tc*)epilogue.beta_batch)[batch * epilogue.stride_beta];
+        }
+    }
+
+    // Scales a result of D at (row, col) of a batch by the diagonal matrices, adds the bias,
+    // stores it to aux, and applies the activation
+    template <typename To, typename T>
+    ROCBLAS_KERNEL_ILF T rocblas_gemm_epilogue_apply(
+        const rocblas_gemm_epilogue_args& epilogue, T v, int64_t row, int64_t col, int batch)
+    {
+        if constexpr(!rocblas_is_complex<T>)
+        {
+            if(!epilogue.active())
+                return v;
+
+            if(epilogue.scale_row)
+            {
+                auto scale_row = (const To*)epilogue.scale_row;
+                v *= T(scale_row[batch * epilogue.stride_scale_row + row]);
+            }
+            if(epilogue.scale_column)
+            {
+                auto scale_column = (const To*)epilogue.scale_column;
+                v *= T(scale_column[batch * epilogue.stride_scale_column + col]);
+            }
+
+            if(epilogue.bias)
+                v += T(((const To*)epilogue.bias)[batch * epilogue.stride_bias
+                                                  + (epilogue.bias_row ? row : col)]);
+
+            if(epilogue.aux)
+                ((To*)epilogue.aux)[batch * epilogue.stride_aux + col * epilogue.ldaux + row]
+                    = To(v);
+
+            if(epilogue.activation == rocblas_gemm_epilogue_activation_relu)
+            {
+                v = v > T(0) ? v : T(0);
+            }
+            else if(epilogue.activation == rocblas_gemm_epilogue_activation_gelu)
+            {
+                using Tf = std::conditional_t<std::is_same_v<T, double>, double, float>;
+                Tf x     = Tf(v);
+                v        = T(Tf(0.5) * x
+                      * (Tf(1) + tanh(Tf(0.7978845608028654) * (x + Tf(0.044715) * x * x * x))));
+            }
+        }
+        return v;
+    }
+
+    // Applies the epilogue to D in place, for results computed by kernels without an epilogue
+    template <int DIM_X, int DIM_Y, typename Tc, typename To>
+    ROCBLAS_KERNEL(DIM_X* DIM_Y)
+    rocblas_gemm_epilogue_kernel(rocblas_int                m,
+                                 rocblas_int                n,
+                                 To*                        D,
+                                 rocblas_stride             shift_d,
+                                 int64_t                    ldd,
+                                 rocblas_stride             stride_d,
+                                 rocblas_int                batch_count,
+                                 rocblas_gemm_epilogue_args epilogue,
+                                 int64_t                    m_base,
+                                 int64_t                    n_base)
+    {
+        auto tx = blockIdx.x * blockDim.x + threadIdx.x;
+        auto ty = blockIdx.y * blockDim.y + threadIdx.y;
+
+        if(tx < m && ty < n)
+        {
+            for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+            {
+                auto* dD = D + shift_d + b * stride_d;
+                Tc    v  = Tc(dD[ty * ldd + tx]);
+
+                dD[ty * ldd + tx] = To(
+                    rocblas_gemm_epilogue_apply<To>(epilogue, v, m_base + tx, n_base + ty, b));
+            }
+        }
+    }
+
+    template <typename Tc, typename To>
+    rocblas_status
+        rocblas_gemm_epilogue_launcher_64(int64_t                           m_64,
+                                          int64_t                           n_64,
+                                          To*                               D,
+                                          rocblas_stride                    offset_d,
+                                          int64_t                           ldd_64,
+                                          rocblas_stride                    stride_d,
+                                          int64_t                           batch_count_64,
+                                          const rocblas_gemm_epilogue_args& epilogue,
+                                          hipStream_t                       rocblas_stream)
+    {
+        static constexpr int GEMM_DIM_X = 32;
+        static constexpr int GEMM_DIM_Y = 32;
+
+        // the kernel strides over the batch beyond the grid, so only the int32 range is chunked
+        for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i32_max)
+        {
+            int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i32_max));
+            int     blocksZ     = int(std::min(int64_t(batch_count), c_i64_grid_YZ_chunk));
+            auto    epilogue_b  = epilogue.batch_offset<To>(b_base);
+
+            for(int64_t n_base = 0; n_base < n_64; n_base += c_i64_grid_X_chunk)
+            {
+                int32_t n = int32_t(std::min(n_64 - n_base, c_i64_grid_X_chunk));
+
+                int blocksY = (n - 1) / GEMM_DIM_Y + 1;
+
+                for(int64_t m_base = 0; m_base < m_64; m_base += c_i64_grid_X_chunk)
+                {
+                    int32_t m = int32_t(std::min(m_64 - m_base, c_i64_grid_X_chunk));
+
+                    int blocksX = (m - 1) / GEMM_DIM_X + 1;
+
+                    dim3 gemm_grid(blocksX, blocksY, blocksZ);
+                    dim3 gemm_threads(GEMM_DIM_X, GEMM_DIM_Y);
+
+                    ROCBLAS_LAUNCH_KERNEL(
+                        (rocblas_gemm_epilogue_kernel<GEMM_DIM_X, GEMM_DIM_Y, Tc>),
+                        gemm_grid,
+                        gemm_threads,
+                        0,
+                        rocblas_stream,
+                        m,
+                        n,
+                        D,
+                        offset_d + b_base * stride_d + n_base * ldd_64 + m_base,
+                        ldd_64,
+                        stride_d,
+                        batch_count,
+                        epilogue_b,
+                        m_base,
+                        n_base);
+                } // m
+            } // n
+        } // batch
+
+        return rocblas_status_success;
+    }
 
     template <typename T, typename U, typename V>
     ROCBLAS_KERNEL_ILF void gemm_ex_scale_device(
@@ -56,13 +280,17 @@ namespace
                          V              DP_array,
                          rocblas_stride shift_d,
                          int64_t        ldd,
-                         rocblas_stride stride_d)
+                         rocblas_stride stride_d,
+                         rocblas_int    batch_count)
     {
         auto beta = load_scalar(beta_host_device);
 
-        auto C = cond_load_ptr_batch(beta != 0, CP_array, blockIdx.z, shift_c, stride_c);
-        auto D = load_ptr_batch(DP_array, blockIdx.z, shift_d, stride_d);
-        gemm_ex_scale_device(m, n, beta, C, ldc, D, ldd);
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            auto C = cond_load_ptr_batch(beta != 0, CP_array, b, shift_c, stride_c);
+            auto D = load_ptr_batch(DP_array, b, shift_d, stride_d);
+            gemm_ex_scale_device(m, n, beta, C, ldc, D, ldd);
+        }
     }
 
     template <typename TScal, typename TConstPtr, typename TPtr>
@@ -83,6 +311,9 @@ namespace
         static constexpr int GEMM_DIM_X = 32;
         static constexpr int GEMM_DIM_Y = 32;
 
+        // the kernel strides over the rest of the batch
+        int blocksZ = int(std::min(int64_t(batch_count), c_i64_grid_YZ_chunk));
+
         for(int64_t n_base = 0; n_base < n_64; n_base += c_i64_grid_X_chunk)
         {
             int32_t n = int32_t(std::min(n_64 - n_base, c_i64_grid_X_chunk));
@@ -98,7 +329,7 @@ namespace
 
                 int blocksX = (m - 1) / GEMM_DIM_X + 1;
 
-                dim3 gemm_grid(blocksX, blocksY, batch_count);
+                dim3 gemm_grid(blocksX, blocksY, blocksZ);
                 dim3 gemm_threads(GEMM_DIM_X, GEMM_DIM_Y);
 
                 ROCBLAS_LAUNCH_KERNEL((gemm_ex_scale_kernel<GEMM_DIM_X, GEMM_DIM_Y>),
@@ -116,7 +347,8 @@ namespace
                                       D,
                                       offset_d + d_n_shift + m_base,
                                       ldd_64,
-                                      stride_d);
+                                      stride_d,
+                                      batch_count);
 
             } // m
         } // n
@@ -149,12 +381,16 @@ namespace
                               TPtr           dC,
                               rocblas_stride shift_c,
                               int64_t        ldc,
-                              rocblas_stride stride_c)
+                              rocblas_stride stride_c,
+                              rocblas_int    batch_count)
     {
         auto beta = load_scalar(beta_host_device);
 
-        auto C = load_ptr_batch(dC, blockIdx.z, shift_c, stride_c);
-        rocblas_gemm_scale_device(m, n, beta, C, ldc);
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            auto C = load_ptr_batch(dC, b, shift_c, stride_c);
+            rocblas_gemm_scale_device(m, n, beta, C, ldc);
+        }
     }
 
     template <typename TScal, typename TConstPtr>
@@ -171,6 +407,9 @@ namespace
         static constexpr int GEMM_DIM_X = 32;
         static constexpr int GEMM_DIM_Y = 32;
 
+        // the kernel strides over the rest of the batch
+        int blocksZ = int(std::min(int64_t(batch_count), c_i64_grid_YZ_chunk));
+
         for(int64_t n_base = 0; n_base < n_64; n_base += c_i64_grid_X_chunk)
         {
             int32_t n = int32_t(std::min(n_64 - n_base, c_i64_grid_X_chunk));
@@ -185,7 +424,7 @@ namespace
 
                 int blocksX = (m - 1) / GEMM_DIM_X + 1;
 
-                dim3 gemm_grid(blocksX, blocksY, batch_count);
+                dim3 gemm_grid(blocksX, blocksY, blocksZ);
                 dim3 gemm_threads(GEMM_DIM_X, GEMM_DIM_Y);
 
                 ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_scale_kernel<GEMM_DIM_X, GEMM_DIM_Y>),
@@ -199,7 +438,8 @@ namespace
                                       C,
                                       offset_c + n_shift + m_base,
                                       ldc_64,
-                                      stride_c);
+                                      stride_c,
+                                      batch_count);
 
             } // m
         } // n
@@ -207,376 +447,657 @@ namespace
         return rocblas_status_success;
     }
 
-    // general alpha, beta, m, n, k
+    // Position (r, c) in the BLK_R x BLK_C tile of op(X) of the l-th element a thread of a
+    // workgroup loads per step; the elements contiguous in X are read by consecutive threads
+    template <int BLK_R, int BLK_C, int THREADS, char TRANS>
+    ROCBLAS_KERNEL_ILF void rocblas_gemm_tiled_coord(int t, int l, int& r, int& c)
+    {
+        if(TRANS == 'N')
+        {
+            static_assert(THREADS % BLK_R == 0, "a column of the tile is read by whole threads");
+            r = t % BLK_R;
+            c = t / BLK_R + l * (THREADS / BLK_R);
+        }
+        else
+        {
+            static_assert(THREADS % BLK_C == 0, "a row of the tile is read by whole threads");
+            c = t % BLK_C;
+            r = t / BLK_C + l * (THREADS / BLK_C);
+        }
+    }
+
+    // Element (i, j) of op(X) of a column major X
+    template <char TRANS, typename Tc, typename Ti>
+    ROCBLAS_KERNEL_ILF Tc rocblas_gemm_tiled_load(const Ti* X, int64_t ldx, int64_t i, int64_t j)
+    {
+        if(TRANS == 'N')
+            return Tc(X[i + j * size_t(ldx)]);
+        else if(TRANS == 'T')
+            return Tc(X[i * size_t(ldx) + j]);
+        else
+            return Tc(conj(X[i * size_t(ldx) + j]));
+    }
+
+    // Tiled gemm: each workgroup of DIM_M x DIM_N threads computes a BLK_M x BLK_N tile of D,
+    // staging BLK_K columns of op(A) and rows of op(B) at a time in LDS. The LDS tiles are double
+    // buffered: the next ones are read from global memory into registers while the current ones
+    // are multiplied, so that the loads are in flight during the math and one barrier per step
+    // suffices. Each thread accumulates a (BLK_M / DIM_M) x (BLK_N / DIM_N) block of D in
+    // registers, its elements DIM_M and DIM_N apart so that the LDS reads and the stores to D
+    // are contiguous across the threads. EDGE kernels check the bounds of m, n and k, the others
+    // require multiples of the tile sizes.
     template <typename Tc,
               int  DIM_M,
               int  DIM_N,
               int  BLK_M,
               int  BLK_N,
               int  BLK_K,
-              int  DIM_M_A,
-              int  DIM_N_A,
-              int  DIM_M_B,
-              int  DIM_N_B,
               char TRANS_A,
               char TRANS_B,
+              bool EDGE,
               typename TiConstPtr,
               typename ToConstPtr,
               typename ToPtr>
     ROCBLAS_KERNEL(DIM_M* DIM_N)
-    rocblas_gemm_batched_general_kernel(int64_t        M,
-                                        int64_t        N,
-                                        int64_t        K,
-                                        const Tc       alpha,
-                                        TiConstPtr*    dA_input,
-                                        int64_t        lda,
-                                        rocblas_stride a_st_or_of,
-                                        TiConstPtr*    dB_input,
-                                        int64_t        ldb,
-                                        rocblas_stride b_st_or_of,
-                                        const Tc       beta,
-                                        ToConstPtr*    dC_input,
-                                        int64_t        ldc,
-                                        rocblas_stride c_st_or_of,
-                                        ToPtr*         dD_input,
-                                        int64_t        ldd,
-                                        rocblas_stride d_st_or_of,
-                                        rocblas_int    batch_count)
+    rocblas_gemm_tiled_kernel(int64_t                    M,
+                              int64_t                    N,
+                              int64_t                    K,
+                              Tc                         alpha,
+                              TiConstPtr*                dA_input,
+                              int64_t                    lda,
+                              rocblas_stride             a_st_or_of,
+                              TiConstPtr*                dB_input,
+                              int64_t                    ldb,
+                              rocblas_stride             b_st_or_of,
+                              Tc                         beta,
+                              ToConstPtr*                dC_input,
+                              int64_t                    ldc,
+                              rocblas_stride             c_st_or_of,
+                              ToPtr*                     dD_input,
+                              int64_t                    ldd,
+                              rocblas_stride             d_st_or_of,
+                              rocblas_int                batch_count,
+                              rocblas_gemm_epilogue_args epilogue)
     {
-        int     thx = threadIdx.x; // thread's m position in C
-        int     thy = threadIdx.y; // thread's n position in C
-        int64_t idt = int64_t(DIM_M) * thy + thx; // thread's number
-        int     blx = blockIdx.x; // block's m position
-        int     bly = blockIdx.y; // block's n position
-        int     blz = blockIdx.z; // block's matrix in the batch
-
-        auto* dA = load_ptr_batch(dA_input, blz, a_st_or_of);
-        auto* dB = load_ptr_batch(dB_input, blz, b_st_or_of);
-        auto* dC = load_ptr_batch(dC_input, blz, c_st_or_of);
-        auto* dD = load_ptr_batch(dD_input, blz, d_st_or_of);
-
-        auto tmp = *dD;
-        using To = decltype(tmp);
-
-        __shared__ Tc sA[BLK_K][BLK_M]; // shared memory for A
-        __shared__ Tc sB[BLK_N][BLK_K]; // shared memory for B
-        Tc            rD[BLK_N / DIM_N][BLK_M / DIM_M]; // registers for D
+        using To                = rocblas_batch_elem_t<ToPtr*>;
+        constexpr int THREADS   = DIM_M * DIM_N;
+        constexpr int RM        = BLK_M / DIM_M; // rows of D per thread
+        constexpr int RN        = BLK_N / DIM_N; // columns of D per thread
+        constexpr int LA        = BLK_M * BLK_K / THREADS; // elements of op(A) per thread and step
+        constexpr int LB        = BLK_K * BLK_N / THREADS; // elements of op(B) per thread and step
+        static_assert(RM * DIM_M == BLK_M && RN * DIM_N == BLK_N, "tiles split over threads");
+        static_assert(LA * THREADS == BLK_M * BLK_K && LB * THREADS == BLK_K * BLK_N,
+                      "tiles of op(A) and op(B) loaded by whole threads");
+
+        int thx = threadIdx.x; // thread's m position in D
+        int thy = threadIdx.y; // thread's n position in D
+        int idt = DIM_M * thy + thx; // thread's number
+
+        int64_t bm = int64_t(blockIdx.x) * BLK_M; // first row of the tile of D
+        int64_t bn = int64_t(blockIdx.y) * BLK_N; // first column of the tile of D
+
+        // padded so that the threads storing a column of a transposed tile use distinct banks
+        __shared__ Tc sA[2][BLK_K][BLK_M + 1];
+        __shared__ Tc sB[2][BLK_K][BLK_N + 1];
+
+        // the grid covers up to c_i64_grid_YZ_chunk problems and strides over the batch
+        for(int blz = blockIdx.z; blz < batch_count; blz += gridDim.z)
+        {
+            auto* dA = load_ptr_batch(dA_input, blz, a_st_or_of);
+            auto* dB = load_ptr_batch(dB_input, blz, b_st_or_of);
+            auto* dC = load_ptr_batch(dC_input, blz, c_st_or_of);
+            auto* dD = load_ptr_batch(dD_input, blz, d_st_or_of);
+            rocblas_gemm_batch_scalars_load(epilogue, blz, alpha, beta);
 
-        for(int n = 0; n < BLK_N / DIM_N; ++n)
-            for(int m = 0; m < BLK_M / DIM_M; ++m)
-                rD[n][m] = 0.0;
+            Tc rA[LA]; // next elements of op(A) of the thread
+            Tc rB[LB]; // next elements of op(B) of the thread
 
-        {
-            int     thxA = idt % DIM_M_A; // thread's m position for loading A
-            int64_t thyA = idt / DIM_M_A; // thread's n position for loading A
-            int     thxB = idt % DIM_M_B; // thread's m position for loading B
-            int64_t thyB = idt / DIM_M_B; // thread's n position for loading B
-
-            int64_t a_i_offset = thxA + int64_t(BLK_M) * blx;
-            int64_t a_j_offset = thyA;
-            int64_t b_i_offset = thxB;
-            int64_t b_j_offset = thyB + int64_t(BLK_N) * bly;
-
-            int64_t kk = 0;
-            for(; kk < K; kk += BLK_K)
-            {
-                for(int n = 0; n < BLK_K; n += DIM_N_A)
+            auto read_tiles = [&](int64_t kk) {
+#pragma unroll
+                for(int l = 0; l < LA; ++l)
                 {
-                    for(int m = 0; m < BLK_M; m += DIM_M_A)
-                    {
-                        int64_t i = m + a_i_offset;
-                        int64_t j = n + kk + a_j_offset;
-                        if(i < M && j < K)
-                        {
-                            if(TRANS_A == 'N')
-                            {
-                                sA[n + thyA][m + thxA] = dA[i + j * size_t(lda)];
-                            }
-                            else if(TRANS_A == 'T')
-                            {
-                                sA[n + thyA][m + thxA] = dA[i * size_t(lda) + j];
-                            }
-                            else if(TRANS_A == 'C')
-                            {
-                                sA[n + thyA][m + thxA] = conj(dA[i * size_t(lda) + j]);
-                            }
-                        }
-                        else
-                        {
-                            sA[n + thyA][m + thxA] = 0.0;
-                        }
-                    }
+                    int i, j;
+                    rocblas_gemm_tiled_coord<BLK_M, BLK_K, THREADS, TRANS_A>(idt, l, i, j);
+                    if(!EDGE || (bm + i < M && kk + j < K))
+                        rA[l] = rocblas_gemm_tiled_load<TRANS_A, Tc>(dA, lda, bm + i, kk + j);
+                    else
+                        rA[l] = Tc(0);
+                }
+#pragma unroll
+                for(int l = 0; l < LB; ++l)
+                {
+                    int i, j;
+                    rocblas_gemm_tiled_coord<BLK_K, BLK_N, THREADS, TRANS_B>(idt, l, i, j);
+                    if(!EDGE || (kk + i < K && bn + j < N))
+                        rB[l] = rocblas_gemm_tiled_load<TRANS_B, Tc>(dB, ldb, kk + i, bn + j);
+                    else
+                        rB[l] = Tc(0);
                 }
+            };
 
-                for(int n = 0; n < BLK_N; n += DIM_N_B)
+            auto write_tiles = [&](int buf) {
+#pragma unroll
+                for(int l = 0; l < LA; ++l)
                 {
-                    for(int m = 0; m < BLK_K; m += DIM_M_B)
-                    {
-                        int64_t i = m + kk + b_i_offset;
-                        int64_t j = n + b_j_offset;
-                        if(i < K && j < N)
-                        {
-                            if(TRANS_B == 'N')
-                            {
-                                sB[n + thyB][m + thxB] = dB[i + j * size_t(ldb)];
-                            }
-                            else if(TRANS_B == 'T')
-                            {
-                                sB[n + thyB][m + thxB] = dB[i * size_t(ldb) + j];
-                            }
-                            else if(TRANS_B == 'C')
-                            {
-                                sB[n + thyB][m + thxB] = conj(dB[i * size_t(ldb) + j]);
-                            }
-                        }
-                        else
-                        {
-                            sB[n + thyB][m + thxB] = 0;
-                        }
-                    }
+                    int i, j;
+                    rocblas_gemm_tiled_coord<BLK_M, BLK_K, THREADS, TRANS_A>(idt, l, i, j);
+                    sA[buf][j][i] = rA[l];
+                }
+#pragma unroll
+                for(int l = 0; l < LB; ++l)
+                {
+                    int i, j;
+                    rocblas_gemm_tiled_coord<BLK_K, BLK_N, THREADS, TRANS_B>(idt, l, i, j);
+                    sB[buf][i][j] = rB[l];
                 }
+            };
 
-                __syncthreads();
+            Tc rD[RN][RM]; // registers for D
 
-                for(int k = 0; k < BLK_K; ++k)
-                    for(int n = 0; n < BLK_N / DIM_N; ++n)
-                        for(int m = 0; m < BLK_M / DIM_M; ++m)
-                            rD[n][m] += sA[k][m * DIM_M + thx] * sB[n * DIM_N + thy][k];
+#pragma unroll
+            for(int n = 0; n < RN; ++n)
+#pragma unroll
+                for(int m = 0; m < RM; ++m)
+                    rD[n][m] = Tc(0);
 
+            int64_t steps = (K - 1) / BLK_K + 1;
+            if(K > 0)
+            {
+                read_tiles(0);
+                write_tiles(0);
                 __syncthreads();
             }
-        }
+            else
+                steps = 0;
 
-        int64_t coord_dCn = int64_t(bly) * BLK_N + thy;
-        if(beta != Tc(0))
-        {
-            for(int n = 0; n < BLK_N / DIM_N && coord_dCn < N; ++n, coord_dCn += DIM_N)
+            for(int64_t s = 0; s < steps; ++s)
             {
-                int64_t nCIdx     = coord_dCn * size_t(ldc);
-                int64_t nDIdx     = coord_dCn * size_t(ldd);
-                int64_t coord_dCm = int64_t(blx) * BLK_M + thx;
+                int  buf  = s & 1;
+                bool next = s + 1 < steps;
+                if(next)
+                    read_tiles((s + 1) * BLK_K);
 
 #pragma unroll
-                for(int m = 0; m < BLK_M / DIM_M; ++m, coord_dCm += DIM_M)
+                for(int k = 0; k < BLK_K; ++k)
                 {
-                    if(coord_dCm < M)
-                        dD[nDIdx + coord_dCm] = To(alpha * rD[n][m] + beta * dC[nCIdx + coord_dCm]);
+                    Tc a[RM], b[RN];
+#pragma unroll
+                    for(int m = 0; m < RM; ++m)
+                        a[m] = sA[buf][k][m * DIM_M + thx];
+#pragma unroll
+                    for(int n = 0; n < RN; ++n)
+                        b[n] = sB[buf][k][n * DIM_N + thy];
+#pragma unroll
+                    for(int n = 0; n < RN; ++n)
+#pragma unroll
+                        for(int m = 0; m < RM; ++m)
+                            rD[n][m] += a[m] * b[n];
                 }
+
+                // the other buffer was last read in the previous step, before its barrier
+                if(next)
+                    write_tiles(buf ^ 1);
+                __syncthreads();
             }
-        }
-        else
-        {
-            for(int n = 0; n < BLK_N / DIM_N && coord_dCn < N; ++n, coord_dCn += DIM_N)
+
+            int64_t coord_dCn = bn + thy;
+#pragma unroll
+            for(int n = 0; n < RN; ++n, coord_dCn += DIM_N)
             {
-                int64_t nDIdx     = coord_dCn * size_t(ldd);
-                int64_t coord_dCm = int64_t(blx) * BLK_M + thx;
+                if(EDGE && coord_dCn >= N)
+                    break;
 
+                int64_t nCIdx     = coord_dCn * size_t(ldc);
+                int64_t nDIdx     = coord_dCn * size_t(ldd);
+                int64_t coord_dCm = bm + thx;
 #pragma unroll
-                for(int m = 0; m < BLK_M / DIM_M; ++m, coord_dCm += DIM_M)
+                for(int m = 0; m < RM; ++m, coord_dCm += DIM_M)
                 {
-                    if(coord_dCm < M)
-                        dD[nDIdx + coord_dCm] = To(alpha * rD[n][m]);
+                    if(EDGE && coord_dCm >= M)
+                        break;
+
+                    Tc d = alpha * rD[n][m];
+                    if(beta != Tc(0))
+                        d += beta * Tc(dC[nCIdx + coord_dCm]);
+                    dD[nDIdx + coord_dCm] = To(rocblas_gemm_epilogue_apply<To>(
+                        epilogue, d, coord_dCm, coord_dCn, blz));
                 }
             }
         }
     }
 
-    // general alpha, beta, restricted m, n, k to multiples of blocks
-    template <typename Tc,
-              int  DIM_M,
-              int  DIM_N,
-              int  BLK_M,
-              int  BLK_N,
-              int  BLK_K,
-              int  DIM_M_A,
-              int  DIM_N_A,
-              int  DIM_M_B,
-              int  DIM_N_B,
-              char TRANS_A,
-              char TRANS_B,
+    // Tile configurations of the tiled kernels, with 16 x 16 threads per workgroup: the large
+    // tiles reuse each element of op(A) and op(B) loaded to LDS more, the small ones give more
+    // workgroups to small problems
+    constexpr int     c_gemm_tiled_dim          = 16;
+    constexpr int     c_gemm_tiled_blk_k        = 8;
+    constexpr int     c_gemm_tiled_small_blk    = 32;
+    constexpr int     c_gemm_tiled_large_blk_n  = 64;
+    constexpr int64_t c_gemm_tiled_large_blocks = 240; // workgroups for the large tiles
+
+    // the accumulators of wider types would not fit in the registers with longer tiles
+    template <typename Tc>
+    constexpr int rocblas_gemm_tiled_large_blk_m = sizeof(Tc) <= 4 ? 128 : 64;
+
+    template <int BLK_M,
+              int BLK_N,
+              typename T,
               typename TiConstPtr,
               typename ToConstPtr,
               typename ToPtr>
-    ROCBLAS_KERNEL(DIM_M* DIM_N)
-    rocblas_gemm_batched_kernel(int64_t        M,
-                                int64_t        N,
-                                int64_t        K,
-                                const Tc       alpha,
-                                TiConstPtr*    dA_input,
-                                int64_t        lda,
-                                rocblas_stride a_st_or_of,
-                                TiConstPtr*    dB_input,
-                                int64_t        ldb,
-                                rocblas_stride b_st_or_of,
-                                const Tc       beta,
-                                ToConstPtr*    dC_input,
-                                int64_t        ldc,
-                                rocblas_stride c_st_or_of,
-                                ToPtr*         dD_input,
-                                int64_t        ldd,
-                                rocblas_stride d_st_or_of,
-                                rocblas_int    batch_count)
+    rocblas_status rocblas_gemm_tiled_launch(rocblas_operation                 trans_a,
+                                             rocblas_operation                 trans_b,
+                                             int64_t                           m,
+                                             int64_t                           n,
+                                             int64_t                           k,
+                                             const T                           alpha,
+                                             TiConstPtr*                       dA_krn,
+                                             int64_t                           lda,
+                                             rocblas_stride                    a_st_or_of,
+                                             TiConstPtr*                       dB_krn,
+                                             int64_t                           ldb,
+                                             rocblas_stride                    b_st_or_of,
+                                             const T                           beta,
+                                             ToConstPtr*                       dC_krn,
+                                             int64_t                           ldc,
+                                             rocblas_stride                    c_st_or_of,
+                                             ToPtr*                            dD_krn,
+                                             int64_t                           ldd,
+                                             rocblas_stride                    d_st_or_of,
+                                             rocblas_int                       batch_count,
+                                             hipStream_t                       stream,
+                                             const rocblas_gemm_epilogue_args& epilogue)
     {
-        int     thx = threadIdx.x; // thread's m position in C
-        int     thy = threadIdx.y; // thread's n position in C
-        int64_t idt = int64_t(DIM_M) * thy + thx; // thread's number
-        int     blx = blockIdx.x; // block's m position
-        int     bly = blockIdx.y; // block's n position
-        int     blz = blockIdx.z; // block's matrix in the batch
+        constexpr int dim_m = c_gemm_tiled_dim;
+        constexpr int dim_n = c_gemm_tiled_dim;
+        constexpr int blk_k = c_gemm_tiled_blk_k;
 
-        auto* dA = load_ptr_batch(dA_input, blz, a_st_or_of);
-        auto* dB = load_ptr_batch(dB_input, blz, b_st_or_of);
-        auto* dC = load_ptr_batch(dC_input, blz, c_st_or_of);
-        auto* dD = load_ptr_batch(dD_input, blz, d_st_or_of);
+        // the kernels stride over the rest of the batch
+        int  blocksZ = int(std::min(int64_t(batch_count), c_i64_grid_YZ_chunk));
+        dim3 dimBlock(dim_m, dim_n, 1);
+        dim3 dimGrid(((m - 1) / BLK_M) + 1, ((n - 1) / BLK_N) + 1, blocksZ);
+        bool edge = m % BLK_M || n % BLK_N || k % blk_k;
 
-        auto tmp = *dD;
-        using To = decltype(tmp);
+#define GEMM_SOURCE_PARAM_SCALARS                                                       \
+    dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of, dB_krn, ldb, \
+        b_st_or_of, beta, dC_krn, ldc, c_st_or_of, dD_krn, ldd, d_st_or_of, batch_count, \
+        epilogue
+
+#define GEMM_SOURCE_TILED_LAUNCH(TA_, TB_, EDGE_)                                        \
+    ROCBLAS_LAUNCH_KERNEL(                                                               \
+        (rocblas_gemm_tiled_kernel<T, dim_m, dim_n, BLK_M, BLK_N, blk_k, TA_, TB_, EDGE_>), \
+        GEMM_SOURCE_PARAM_SCALARS)
+
+#define GEMM_SOURCE_TILED_TRANS(TA_, TB_)         \
+    if(edge)                                      \
+        GEMM_SOURCE_TILED_LAUNCH(TA_, TB_, true); \
+    else                                          \
+        GEMM_SOURCE_TILED_LAUNCH(TA_, TB_, false);
+
+        char ta = rocblas_transpose_letter(trans_a);
+        char tb = rocblas_transpose_letter(trans_b);
+
+        // clang-format off
+        if(ta == 'N' && tb == 'N') { GEMM_SOURCE_TILED_TRANS('N', 'N') }
+        else if(ta == 'N' && tb == 'T') { GEMM_SOURCE_TILED_TRANS('N', 'T') }
+        else if(ta == 'N' && tb == 'C') { GEMM_SOURCE_TILED_TRANS('N', 'C') }
+        else if(ta == 'T' && tb == 'N') { GEMM_SOURCE_TILED_TRANS('T', 'N') }
+        else if(ta == 'T' && tb == 'T') { GEMM_SOURCE_TILED_TRANS('T', 'T') }
+        else if(ta == 'T' && tb == 'C') { GEMM_SOURCE_TILED_TRANS('T', 'C') }
+        else if(ta == 'C' && tb == 'N') { GEMM_SOURCE_TILED_TRANS('C', 'N') }
+        else if(ta == 'C' && tb == 'T') { GEMM_SOURCE_TILED_TRANS('C', 'T') }
+        else if(ta == 'C' && tb == 'C') { GEMM_SOURCE_TILED_TRANS('C', 'C') }
+        // clang-format on
+
+#undef GEMM_SOURCE_TILED_TRANS
+#undef GEMM_SOURCE_TILED_LAUNCH
+#undef GEMM_SOURCE_PARAM_SCALARS
+        return rocblas_status_success;
+    }
 
-        __shared__ Tc sA[BLK_K][BLK_M]; // shared memory for A
-        __shared__ Tc sB[BLK_N][BLK_K]; // shared memory for B
-        Tc            rD[BLK_N / DIM_N][BLK_M / DIM_M]; // registers for D
+    // Small batched gemm: the whole of op(A), op(B) and D of one problem fit in a TILE x TILE
+    // tile, so P problems are computed by each workgroup instead of one 32 x 32 tile each, and
+    // the workgroups loop over the batch. Each thread accumulates RM rows of one column of D in
+    // registers.
+    constexpr int     c_gemm_small_batched_max_dim       = 32;
+    constexpr int64_t c_gemm_small_batched_min_batch     = 256;
+    constexpr int64_t c_gemm_small_batched_max_blocks    = 4096;
+    constexpr size_t  c_gemm_small_batched_lds_per_block = 32768;
+
+    template <int TILE, int RM>
+    constexpr int rocblas_gemm_small_batched_threads = TILE / RM * TILE; // per problem
+
+    template <int TILE, int RM, typename Tc>
+    constexpr int rocblas_gemm_small_batched_problems = std::max(
+        1,
+        std::min(int(256 / rocblas_gemm_small_batched_threads<TILE, RM>),
+                 int(c_gemm_small_batched_lds_per_block / (2 * TILE * (TILE + 1) * sizeof(Tc)))));
+
+    inline bool rocblas_gemm_small_batched_supported(int64_t m, int64_t n, int64_t k, int64_t b)
+    {
+        return m <= c_gemm_small_batched_max_dim && n <= c_gemm_small_batched_max_dim
+               && k <= c_gemm_small_batched_max_dim && b >= c_gemm_small_batched_min_batch;
+    }
 
-        for(int n = 0; n < BLK_N / DIM_N; ++n)
-            for(int m = 0; m < BLK_M / DIM_M; ++m)
-                rD[n][m] = 0.0;
+    template <int TILE,
+              int RM,
+              int P,
+              typename Tc,
+              typename TiConstPtr,
+              typename ToConstPtr,
+              typename ToPtr>
+    ROCBLAS_KERNEL(rocblas_gemm_small_batched_threads<TILE, RM>* P)
+    rocblas_gemm_small_batched_kernel(rocblas_operation          trans_a,
+                                      rocblas_operation          trans_b,
+                                      int                        m,
+                                      int                        n,
+                                      int                        k,
+                                      Tc                         alpha,
+                                      TiConstPtr*                dA_input,
+                                      int64_t                    lda,
+                                      rocblas_stride             a_st_or_of,
+                                      TiConstPtr*                dB_input,
+                                      int64_t                    ldb,
+                                      rocblas_stride             b_st_or_of,
+                                      Tc                         beta,
+                                      ToConstPtr*                dC_input,
+                                      int64_t                    ldc,
+                                      rocblas_stride             c_st_or_of,
+                                      ToPtr*                     dD_input,
+                                      int64_t                    ldd,
+                                      rocblas_stride             d_st_or_of,
+                                      rocblas_int                batch_count,
+                                      rocblas_gemm_epilogue_args epilogue)
+    {
+        using To                = rocblas_batch_elem_t<ToPtr*>;
+        constexpr int THREADS   = rocblas_gemm_small_batched_threads<TILE, RM>;
+        constexpr int ROWS_STEP = TILE / RM;
 
-        {
-            int     thxA = idt % DIM_M_A; // thread's m position for loading A
-            int64_t thyA = idt / DIM_M_A; // thread's n position for loading A
-            int     thxB = idt % DIM_M_B; // thread's m position for loading B
-            int64_t thyB = idt / DIM_M_B; // thread's n position for loading B
-
-            size_t coord_A, coord_B;
-            if(TRANS_A == 'N')
-                coord_A = (thxA + int64_t(blx) * BLK_M) + (thyA)*size_t(lda);
-            else if(TRANS_A == 'T' || TRANS_A == 'C')
-                coord_A = (thxA + int64_t(blx) * BLK_M) * size_t(lda) + (thyA);
-
-            if(TRANS_B == 'N')
-                coord_B = thxB + (int64_t(bly) * BLK_N + thyB) * size_t(ldb);
-            else if(TRANS_B == 'T' || TRANS_B == 'C')
-                coord_B = thxB * size_t(ldb) + (int64_t(bly) * BLK_N + thyB);
-
-            int64_t kk = 0;
-            for(; kk < K; kk += BLK_K)
-            {
-                for(int n = 0; n < BLK_K; n += DIM_N_A)
-                    for(int m = 0; m < BLK_M; m += DIM_M_A)
-                        if(TRANS_A == 'N')
-                        {
-                            sA[n + thyA][m + thxA] = dA[coord_A + m + n * size_t(lda)];
-                        }
-                        else if(TRANS_A == 'T')
-                        {
-                            sA[n + thyA][m + thxA] = dA[coord_A + m * size_t(lda) + n];
-                        }
-                        else if(TRANS_A == 'C')
-                        {
-                            sA[n + thyA][m + thxA] = conj(dA[coord_A + m * size_t(lda) + n]);
-                        }
-
-                for(int n = 0; n < BLK_N; n += DIM_N_B)
-                    for(int m = 0; m < BLK_K; m += DIM_M_B)
-                        if(TRANS_B == 'N')
-                        {
-                            sB[n + thyB][m + thxB] = dB[coord_B + m + n * size_t(ldb)];
-                        }
-                        else if(TRANS_B == 'T')
-                        {
-                            sB[n + thyB][m + thxB] = dB[coord_B + m * size_t(ldb) + n];
-                        }
-                        else if(TRANS_B == 'C')
-                        {
-                            sB[n + thyB][m + thxB] = conj(dB[coord_B + m * size_t(ldb) + n]);
-                        }
+        __shared__ Tc sA[P][TILE][TILE + 1]; // sA[p][l][i] = op(A)(i, l)
+        __shared__ Tc sB[P][TILE][TILE + 1]; // sB[p][j][l] = op(B)(l, j)
 
-                __syncthreads();
+        int p   = threadIdx.x / THREADS; // problem of the thread in the workgroup
+        int t   = threadIdx.x % THREADS;
+        int row = t % ROWS_STEP; // first of the RM rows of D of the thread
+        int col = t / ROWS_STEP; // column of D of the thread
 
-                for(int k = 0; k < BLK_K; ++k)
-                    for(int n = 0; n < BLK_N / DIM_N; ++n)
-                        for(int m = 0; m < BLK_M / DIM_M; ++m)
-                            rD[n][m] += sA[k][m * DIM_M + thx] * sB[n * DIM_N + thy][k];
+        for(int64_t first = int64_t(blockIdx.x) * P; first < batch_count;
+            first += int64_t(gridDim.x) * P)
+        {
+            int  batch = int(first + p);
+            bool valid = batch < batch_count;
 
-                __syncthreads();
+            if(valid)
+            {
+                auto* dA = load_ptr_batch(dA_input, batch, a_st_or_of);
+                auto* dB = load_ptr_batch(dB_input, batch, b_st_or_of);
 
-                if(TRANS_A == 'N')
-                    coord_A += BLK_K * size_t(lda);
-                else if(TRANS_A == 'T' || TRANS_A == 'C')
-                    coord_A += BLK_K;
+                for(int e = t; e < TILE * TILE; e += THREADS)
+                {
+                    int i = e % TILE, l = e / TILE;
+                    Tc  a = 0;
+                    if(i < m && l < k)
+                    {
+                        a = Tc(trans_a == rocblas_operation_none ? dA[i + l * lda]
+                                                                 : dA[l + i * lda]);
+                        if(trans_a == rocblas_operation_conjugate_transpose)
+                            a = conj(a);
+                    }
+                    sA[p][l][i] = a;
 
-                if(TRANS_B == 'N')
-                    coord_B += BLK_K;
-                else if(TRANS_B == 'T' || TRANS_B == 'C')
-                    coord_B += BLK_K * size_t(ldb);
+                    int lb = e % TILE, j = e / TILE;
+                    Tc  b  = 0;
+                    if(lb < k && j < n)
+                    {
+                        b = Tc(trans_b == rocblas_operation_none ? dB[lb + j * ldb]
+                                                                 : dB[j + lb * ldb]);
+                        if(trans_b == rocblas_operation_conjugate_transpose)
+                            b = conj(b);
+                    }
+                    sB[p][j][lb] = b;
+                }
             }
-        }
 
-        int64_t coord_dCn = int64_t(bly) * BLK_N + thy;
-        if(beta != Tc(0))
-        {
-            for(int n = 0; n < BLK_N / DIM_N; ++n, coord_dCn += DIM_N)
-            {
-                int64_t nCIdx     = coord_dCn * size_t(ldc);
-                int64_t nDIdx     = coord_dCn * size_t(ldd);
-                int64_t coord_dCm = int64_t(blx) * BLK_M + thx;
+            __syncthreads();
 
+            if(valid && col < n)
+            {
+                Tc rD[RM];
 #pragma unroll
-                for(int m = 0; m < BLK_M / DIM_M; ++m, coord_dCm += DIM_M)
+                for(int r = 0; r < RM; r++)
+                    rD[r] = 0;
+
+                for(int l = 0; l < k; l++)
                 {
-                    dD[nDIdx + coord_dCm] = To(alpha * rD[n][m] + beta * dC[nCIdx + coord_dCm]);
+                    Tc b = sB[p][col][l];
+#pragma unroll
+                    for(int r = 0; r < RM; r++)
+                        rD[r] += sA[p][l][row + r * ROWS_STEP] * b;
                 }
-            }
-        }
-        else
-        {
-            for(int n = 0; n < BLK_N / DIM_N; ++n, coord_dCn += DIM_N)
-            {
-                int64_t nDIdx     = coord_dCn * size_t(ldd);
-                int64_t coord_dCm = int64_t(blx) * BLK_M + thx;
 
+                auto* dC = load_ptr_batch(dC_input, batch, c_st_or_of);
+                auto* dD = load_ptr_batch(dD_input, batch, d_st_or_of);
+                rocblas_gemm_batch_scalars_load(epilogue, batch, alpha, beta);
 #pragma unroll
-                for(int m = 0; m < BLK_M / DIM_M; ++m, coord_dCm += DIM_M)
+                for(int r = 0; r < RM; r++)
                 {
-                    dD[nDIdx + coord_dCm] = To(alpha * rD[n][m]);
+                    int i = row + r * ROWS_STEP;
+                    if(i < m)
+                    {
+                        Tc v = alpha * rD[r];
+                        if(beta != Tc(0))
+                            v += beta * Tc(dC[i + col * ldc]);
+                        dD[i + col * ldd]
+                            = To(rocblas_gemm_epilogue_apply<To>(epilogue, v, i, col, batch));
+                    }
                 }
             }
+
+            __syncthreads();
         }
     }
 
+    template <int TILE,
+              int RM,
+              typename T,
+              typename TiConstPtr,
+              typename ToConstPtr,
+              typename ToPtr>
+    rocblas_status
+        rocblas_gemm_small_batched_launch(rocblas_operation                 trans_a,
+                                          rocblas_operation                 trans_b,
+                                          int                               m,
+                                          int                               n,
+                                          int                               k,
+                                          const T                           alpha,
+                                          TiConstPtr*                       dA,
+                                          int64_t                           lda,
+                                          rocblas_stride                    a_st_or_of,
+                                          TiConstPtr*                       dB,
+                                          int64_t                           ldb,
+                                          rocblas_stride                    b_st_or_of,
+                                          const T                           beta,
+                                          ToConstPtr*                       dC,
+                                          int64_t                           ldc,
+                                          rocblas_stride                    c_st_or_of,
+                                          ToPtr*                            dD,
+                                          int64_t                           ldd,
+                                          rocblas_stride                    d_st_or_of,
+                                          rocblas_int                       batch_count,
+                                          hipStream_t                       stream,
+                                          const rocblas_gemm_epilogue_args& epilogue)
+    {
+        constexpr int P       = rocblas_gemm_small_batched_problems<TILE, RM, T>;
+        constexpr int THREADS = rocblas_gemm_small_batched_threads<TILE, RM> * P;
+        int64_t       groups  = (batch_count - 1) / P + 1;
+        dim3          grid(std::min(groups, c_gemm_small_batched_max_blocks));
+
+        ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_small_batched_kernel<TILE, RM, P, T>),
+                              grid,
+                              dim3(THREADS),
+                              0,
+                              stream,
+                              trans_a,
+                              trans_b,
+                              m,
+                              n,
+                              k,
+                              alpha,
+                              dA,
+                              lda,
+                              a_st_or_of,
+                              dB,
+                              ldb,
+                              b_st_or_of,
+                              beta,
+                              dC,
+                              ldc,
+                              c_st_or_of,
+                              dD,
+                              ldd,
+                              d_st_or_of,
+                              batch_count,
+                              epilogue);
+        return rocblas_status_success;
+    }
+
+    template <typename T, typename TiConstPtr, typename ToConstPtr, typename ToPtr>
+    rocblas_status
+        rocblas_gemm_small_batched_launcher(rocblas_operation                 trans_a,
+                                            rocblas_operation                 trans_b,
+                                            int                               m,
+                                            int                               n,
+                                            int                               k,
+                                            const T                           alpha,
+                                            TiConstPtr*                       dA,
+                                            int64_t                           lda,
+                                            rocblas_stride                    a_st_or_of,
+                                            TiConstPtr*                       dB,
+                                            int64_t                           ldb,
+                                            rocblas_stride                    b_st_or_of,
+                                            const T                           beta,
+                                            ToConstPtr*                       dC,
+                                            int64_t                           ldc,
+                                            rocblas_stride                    c_st_or_of,
+                                            ToPtr*                            dD,
+                                            int64_t                           ldd,
+                                            rocblas_stride                    d_st_or_of,
+                                            rocblas_int                       batch_count,
+                                            hipStream_t                       stream,
+                                            const rocblas_gemm_epilogue_args& epilogue)
+    {
+        int dim = std::max({m, n, k});
+        if(dim <= 8)
+            return rocblas_gemm_small_batched_launch<8, 2>(trans_a,
+                                                           trans_b,
+                                                           m,
+                                                           n,
+                                                           k,
+                                                           alpha,
+                                                           dA,
+                                                           lda,
+                                                           a_st_or_of,
+                                                           dB,
+                                                           ldb,
+                                                           b_st_or_of,
+                                                           beta,
+                                                           dC,
+                                                           ldc,
+                                                           c_st_or_of,
+                                                           dD,
+                                                           ldd,
+                                                           d_st_or_of,
+                                                           batch_count,
+                                                           stream,
+                                                           epilogue);
+        else if(dim <= 16)
+            return rocblas_gemm_small_batched_launch<16, 4>(trans_a,
+                                                            trans_b,
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            alpha,
+                                                            dA,
+                                                            lda,
+                                                            a_st_or_of,
+                                                            dB,
+                                                            ldb,
+                                                            b_st_or_of,
+                                                            beta,
+                                                            dC,
+                                                            ldc,
+                                                            c_st_or_of,
+                                                            dD,
+                                                            ldd,
+                                                            d_st_or_of,
+                                                            batch_count,
+                                                            stream,
+                                                            epilogue);
+        else
+            return rocblas_gemm_small_batched_launch<32, 8>(trans_a,
+                                                            trans_b,
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            alpha,
+                                                            dA,
+                                                            lda,
+                                                            a_st_or_of,
+                                                            dB,
+                                                            ldb,
+                                                            b_st_or_of,
+                                                            beta,
+                                                            dC,
+                                                            ldc,
+                                                            c_st_or_of,
+                                                            dD,
+                                                            ldd,
+                                                            d_st_or_of,
+                                                            batch_count,
+                                                            stream,
+                                                            epilogue);
+    }
+
     template <bool BATCHED, typename T, typename TiConstPtr, typename ToConstPtr, typename ToPtr>
-    rocblas_status rocblas_gemm_source_solution_64(rocblas_operation trans_a,
-                                                   rocblas_operation trans_b,
-                                                   int64_t           m,
-                                                   int64_t           n,
-                                                   int64_t           k,
-                                                   const T           alpha,
-                                                   TiConstPtr*       dA,
-                                                   int64_t           lda,
-                                                   rocblas_stride    stride_a,
-                                                   rocblas_stride    offset_a,
-                                                   TiConstPtr*       dB,
-                                                   int64_t           ldb,
-                                                   rocblas_stride    stride_b,
-                                                   rocblas_stride    offset_b,
-                                                   const T           beta,
-                                                   ToConstPtr*       dC,
-                                                   int64_t           ldc,
-                                                   rocblas_stride    stride_c,
-                                                   rocblas_stride    offset_c,
-                                                   ToPtr*            dD,
-                                                   int64_t           ldd,
-                                                   rocblas_stride    stride_d,
-                                                   rocblas_stride    offset_d,
-                                                   rocblas_int       batch_count,
-                                                   hipStream_t       stream)
+    rocblas_status rocblas_gemm_source_solution_64(rocblas_operation                 trans_a,
+                                                   rocblas_operation                 trans_b,
+                                                   int64_t                           m,
+                                                   int64_t                           n,
+                                                   int64_t                           k,
+                                                   const T                           alpha,
+                                                   TiConstPtr*                       dA,
+                                                   int64_t                           lda,
+                                                   rocblas_stride                    stride_a,
+                                                   rocblas_stride                    offset_a,
+                                                   TiConstPtr*                       dB,
+                                                   int64_t                           ldb,
+                                                   rocblas_stride                    stride_b,
+                                                   rocblas_stride                    offset_b,
+                                                   const T                           beta,
+                                                   ToConstPtr*                       dC,
+                                                   int64_t                           ldc,
+                                                   rocblas_stride                    stride_c,
+                                                   rocblas_stride                    offset_c,
+                                                   ToPtr*                            dD,
+                                                   int64_t                           ldd,
+                                                   rocblas_stride                    stride_d,
+                                                   rocblas_stride                    offset_d,
+                                                   rocblas_int                       batch_count,
+                                                   hipStream_t                       stream,
+                                                   const rocblas_gemm_epilogue_args& epilogue = {})
     {
+        if(rocblas_current_counters)
+            rocblas_count(rocblas_current_counters->source_gemm_calls);
+
         // gemm has same behavior for alpha == 0 and k == 0. Special code is needed
         // for alpha == 0, no special code is needed for k == 0. It is more efficient
         // setting k = 0 than adding extra code to a kernel to handle alpha == 0
-        if(alpha == T(0))
+        if(alpha == T(0) && !epilogue.batch_scalars())
             k = 0;
 
-        if(k == 0)
+        // The kernels below handle k == 0, and are used when the result needs an epilogue or
+        // the scalars of the batches
+        if(k == 0 && !epilogue.active() && !epilogue.batch_scalars())
         {
             return rocblas_gemm_ex_scale_launcher_64(m,
                                                      n,
@@ -625,142 +1146,82 @@ namespace
             d_st_or_of = stride_d;
         }
 
-#define GEMM_SOURCE_PARAM                                                                    \
-    dimGrid, dimBlock, 0, stream, m, n, k, dA_krn, lda, a_st_or_of, dB_krn, ldb, b_st_or_of, \
-        dC_krn, ldc, c_st_or_of, dD_krn, ldd, d_st_or_of, batch_count
-
-#define GEMM_SOURCE_PARAM_SCALARS                                                       \
-    dimGrid, dimBlock, 0, stream, m, n, k, alpha, dA_krn, lda, a_st_or_of, dB_krn, ldb, \
-        b_st_or_of, beta, dC_krn, ldc, c_st_or_of, dD_krn, ldd, d_st_or_of, batch_count
-
-        if((m % 64 == 0) && (n % 64 == 0) && (k % 4 == 0))
-        {
-            //m is mult of 64, n is mult of 64, k is mult of 4
-            const int dim_m = 16;
-            const int dim_n = 16;
-            const int blk_m = 64;
-            const int blk_n = 64;
-            const int blk_k = 4;
-            dim3      dimBlock(dim_m, dim_n, 1);
-            dim3      dimGrid(m / blk_m, n / blk_n, batch_count);
-
-            // general alpha, beta
-            // clang-format off
-            if(rocblas_operation_none == trans_a && rocblas_operation_none == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'N', 'N'>), GEMM_SOURCE_PARAM_SCALARS);
-            if(rocblas_operation_transpose == trans_a && rocblas_operation_none == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'T', 'N'>), GEMM_SOURCE_PARAM_SCALARS);
-            if(rocblas_operation_none == trans_a && rocblas_operation_transpose == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'N', 'T'>), GEMM_SOURCE_PARAM_SCALARS);
-            if(rocblas_operation_transpose == trans_a && rocblas_operation_transpose == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'T', 'T'>), GEMM_SOURCE_PARAM_SCALARS);
-            if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'C', 'C'>), GEMM_SOURCE_PARAM_SCALARS);
-            if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_none == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'C', 'N'>), GEMM_SOURCE_PARAM_SCALARS);
-            if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_transpose == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'C', 'T'>), GEMM_SOURCE_PARAM_SCALARS);
-            if(rocblas_operation_none == trans_a && rocblas_operation_conjugate_transpose == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'N', 'C'>), GEMM_SOURCE_PARAM_SCALARS);
-            if(rocblas_operation_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'T', 'C'>), GEMM_SOURCE_PARAM_SCALARS);
-            // clang-format on
-        }
-        else if((m % 32 == 0) && (n % 32 == 0) && (k % 8 == 0))
-        {
-            // m is mult of 32, n is mult of 32, k is mult of 8
-            const int dim_m = 16;
-            const int dim_n = 16;
-            const int blk_m = 32;
-            const int blk_n = 32;
-            const int blk_k = 8;
-            dim3      dimBlock(dim_m, dim_n, 1);
-            dim3      dimGrid(m / blk_m, n / blk_n, batch_count);
-
-            // general alpha, beta
-            // clang-format off
-            if(rocblas_operation_none == trans_a && rocblas_operation_none == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'N', 'N'>), GEMM_SOURCE_PARAM_SCALARS);
-            if(rocblas_operation_transpose == trans_a && rocblas_operation_none == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'T', 'N'>), GEMM_SOURCE_PARAM_SCALARS);
-            if(rocblas_operation_none == trans_a && rocblas_operation_transpose == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'N', 'T'>), GEMM_SOURCE_PARAM_SCALARS);
-            if(rocblas_operation_transpose == trans_a && rocblas_operation_transpose == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'T', 'T'>), GEMM_SOURCE_PARAM_SCALARS);
-            if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'C', 'C'>), GEMM_SOURCE_PARAM_SCALARS);
-            if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_none == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'C', 'N'>), GEMM_SOURCE_PARAM_SCALARS);
-            if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_transpose == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'C', 'T'>), GEMM_SOURCE_PARAM_SCALARS);
-            if(rocblas_operation_none == trans_a && rocblas_operation_conjugate_transpose == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'N', 'C'>), GEMM_SOURCE_PARAM_SCALARS);
-            if(rocblas_operation_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'T', 'C'>), GEMM_SOURCE_PARAM_SCALARS);
-            // clang-format on
-        }
+        if(rocblas_gemm_small_batched_supported(m, n, k, batch_count))
+            return rocblas_gemm_small_batched_launcher(trans_a,
+                                                       trans_b,
+                                                       int(m),
+                                                       int(n),
+                                                       int(k),
+                                                       alpha,
+                                                       dA_krn,
+                                                       lda,
+                                                       a_st_or_of,
+                                                       dB_krn,
+                                                       ldb,
+                                                       b_st_or_of,
+                                                       beta,
+                                                       dC_krn,
+                                                       ldc,
+                                                       c_st_or_of,
+                                                       dD_krn,
+                                                       ldd,
+                                                       d_st_or_of,
+                                                       batch_count,
+                                                       stream,
+                                                       epilogue);
+
+        // the large tiles when the problem gives enough of them to fill the device
+        constexpr int blk_m_large  = rocblas_gemm_tiled_large_blk_m<T>;
+        constexpr int blk_n_large  = c_gemm_tiled_large_blk_n;
+        int64_t       large_blocks = ((m - 1) / blk_m_large + 1) * ((n - 1) / blk_n_large + 1)
+                               * std::min(int64_t(batch_count), c_i64_grid_YZ_chunk);
+
+        if(large_blocks >= c_gemm_tiled_large_blocks)
+            return rocblas_gemm_tiled_launch<blk_m_large, blk_n_large>(trans_a,
+                                                                      trans_b,
+                                                                      m,
+                                                                      n,
+                                                                      k,
+                                                                      alpha,
+                                                                      dA_krn,
+                                                                      lda,
+                                                                      a_st_or_of,
+                                                                      dB_krn,
+                                                                      ldb,
+                                                                      b_st_or_of,
+                                                                      beta,
+                                                                      dC_krn,
+                                                                      ldc,
+                                                                      c_st_or_of,
+                                                                      dD_krn,
+                                                                      ldd,
+                                                                      d_st_or_of,
+                                                                      batch_count,
+                                                                      stream,
+                                                                      epilogue);
         else
-        {
-            const int dim_m = 16;
-            const int dim_n = 16;
-            const int blk_m = 32;
-            const int blk_n = 32;
-            const int blk_k = 8;
-            dim3      dimBlock(dim_m, dim_n, 1);
-            dim3      dimGrid(((m - 1) / blk_m) + 1, ((n - 1) / blk_n) + 1, batch_count);
-
-            // general m, n, k, alpha, beta
-            // clang-format off
-            if(rocblas_operation_none == trans_a && rocblas_operation_none == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_general_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'N', 'N'>), GEMM_SOURCE_PARAM_SCALARS);
-            if(rocblas_operation_transpose == trans_a && rocblas_operation_none == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_general_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'T', 'N'>), GEMM_SOURCE_PARAM_SCALARS);
-            if(rocblas_operation_none == trans_a && rocblas_operation_transpose == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_general_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'N', 'T'>), GEMM_SOURCE_PARAM_SCALARS);
-            if(rocblas_operation_transpose == trans_a && rocblas_operation_transpose == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_general_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'T', 'T'>), GEMM_SOURCE_PARAM_SCALARS);
-            if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_general_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'C', 'C'>), GEMM_SOURCE_PARAM_SCALARS);
-            if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_none == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_general_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'C', 'N'>), GEMM_SOURCE_PARAM_SCALARS);
-            if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_transpose == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_general_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'C', 'T'>), GEMM_SOURCE_PARAM_SCALARS);
-            if(rocblas_operation_none == trans_a && rocblas_operation_conjugate_transpose == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_general_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'N', 'C'>), GEMM_SOURCE_PARAM_SCALARS);
-            if(rocblas_operation_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
-                ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_batched_general_kernel
-                <T, dim_m, dim_n, blk_m, blk_n, blk_k, blk_m, blk_k, blk_k, blk_n, 'T', 'C'>), GEMM_SOURCE_PARAM_SCALARS);
-            // clang-format on
-        }
-
-#undef GEMM_SOURCE_PARAM
-#undef GEMM_SOURCE_PARAM_SCALARS
-        return rocblas_status_success;
+            return rocblas_gemm_tiled_launch<c_gemm_tiled_small_blk, c_gemm_tiled_small_blk>(
+                trans_a,
+                trans_b,
+                m,
+                n,
+                k,
+                alpha,
+                dA_krn,
+                lda,
+                a_st_or_of,
+                dB_krn,
+                ldb,
+                b_st_or_of,
+                beta,
+                dC_krn,
+                ldc,
+                c_st_or_of,
+                dD_krn,
+                ldd,
+                d_st_or_of,
+                batch_count,
+                stream,
+                epilogue);
     }
 }
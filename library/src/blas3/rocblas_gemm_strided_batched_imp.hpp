@@ -76,6 +76,17 @@ namespace
     {
         if(!handle)
             return rocblas_status_invalid_handle;
+
+        // row major C^T = op(B)^T*op(A)^T is a column major gemm, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+        {
+            std::swap(trans_a, trans_b);
+            std::swap(m, n);
+            std::swap(A, B);
+            std::swap(lda, ldb);
+            std::swap(stride_a, stride_b);
+        }
+
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
         // Copy alpha and beta to host if on device
@@ -86,9 +97,11 @@ namespace
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+
+        rocblas_api_scope api_scope(handle, rocblas_gemm_strided_batched_name<T>);
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-              | rocblas_layer_mode_log_profile))
+              | rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
         {
             auto trans_a_letter = rocblas_transpose_letter(trans_a);
             auto trans_b_letter = rocblas_transpose_letter(trans_b);
@@ -147,7 +160,7 @@ namespace
                           batch_count);
             }
 
-            if(layer_mode & rocblas_layer_mode_log_profile)
+            if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             {
                 log_profile(handle,
                             rocblas_gemm_strided_batched_name<T>,
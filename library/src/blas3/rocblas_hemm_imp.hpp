@@ -53,13 +53,29 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
-        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+        // row major C^T = B^T*A^T swaps the side of A, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+        {
+            side = rocblas_row_major_side(side);
+            uplo = rocblas_row_major_fill(uplo);
+            std::swap(m, n);
+        }
+
+        if(handle->is_device_memory_size_query())
+        {
+            size_t size = rocblas_internal_symm_hemm_workspace_size<T>(side, m, n);
+            if(!size)
+                return rocblas_status_size_unchanged;
+            return handle->set_optimal_device_memory_size(size);
+        }
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+
+        rocblas_api_scope api_scope(handle, rocblas_hemm_name<T>);
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-              | rocblas_layer_mode_log_profile))
+              | rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
         {
             auto side_letter = rocblas_side_letter(side);
             auto uplo_letter = rocblas_fill_letter(uplo);
@@ -101,7 +117,7 @@ namespace
                           "--ldc",
                           ldc);
 
-            if(layer_mode & rocblas_layer_mode_log_profile)
+            if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                 log_profile(handle,
                             rocblas_hemm_name<T>,
                             "side",
@@ -55,6 +55,15 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        // row major C^T = op(B)^T*op(A)^T, of the other triangle, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+        {
+            uplo  = rocblas_row_major_fill(uplo);
+            trans = rocblas_row_major_conjugate_transpose(trans);
+            std::swap(A, B);
+            std::swap(lda, ldb);
+        }
+
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
         // Copy alpha and beta to host if on device. This is because gemm is called and it
@@ -67,9 +76,11 @@ namespace
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+
+        rocblas_api_scope api_scope(handle, rocblas_her2k_name<T>);
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-              | rocblas_layer_mode_log_profile))
+              | rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
         {
             auto uplo_letter   = rocblas_fill_letter(uplo);
             auto transA_letter = rocblas_transpose_letter(trans);
@@ -114,7 +125,7 @@ namespace
                           "--batch_count",
                           batch_count);
 
-            if(layer_mode & rocblas_layer_mode_log_profile)
+            if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                 log_profile(handle,
                             rocblas_her2k_name<T>,
                             "uplo",
@@ -0,0 +1,125 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include <vector>
+
+/*********************************************************************************
+ * Helpers of the multi-GPU APIs, which take one handle per device and compute   *
+ * with the other devices on data residing on the device of the first handle,    *
+ * copied over the peer links                                                    *
+ *********************************************************************************/
+
+// Peer link bandwidth assumed when splitting work, one xGMI link per direction, unless
+// ROCBLAS_MGPU_LINK_GBPS is set
+constexpr double ROCBLAS_MGPU_LINK_GBPS = 50;
+
+inline double rocblas_mgpu_link_bytes_per_sec()
+{
+    static const double gbps = [] {
+        const char* env = getenv("ROCBLAS_MGPU_LINK_GBPS");
+        double      val = env ? atof(env) : 0;
+        return val > 0 ? val : ROCBLAS_MGPU_LINK_GBPS;
+    }();
+    return gbps * 1e9;
+}
+
+// Rough peak rate of a device for a precision of real_size bytes, from its compute units and
+// clock, for splitting work only; only its ratio to the link bandwidth matters
+inline double rocblas_mgpu_device_flops(int device, size_t real_size)
+{
+    int cus = 0, clock_khz = 0;
+    if(hipDeviceGetAttribute(&cus, hipDeviceAttributeMultiprocessorCount, device) != hipSuccess
+       || hipDeviceGetAttribute(&clock_khz, hipDeviceAttributeClockRate, device) != hipSuccess)
+        return 0;
+    double flops_per_cu_clock = real_size <= 4 ? 256 : 128;
+    return cus * (clock_khz * 1e3) * flops_per_cu_clock;
+}
+
+// The handles must be valid and on distinct devices
+inline rocblas_status rocblas_mgpu_check_handles(const rocblas_handle* handles,
+                                                 rocblas_int           num_handles)
+{
+    if(!handles || num_handles < 1)
+        return rocblas_status_invalid_handle;
+    for(rocblas_int d = 0; d < num_handles; ++d)
+    {
+        if(!handles[d])
+            return rocblas_status_invalid_handle;
+        // row major order, see rocblas_set_order, has no column major mapping here
+        RETURN_NOT_IMPLEMENTED_IF_ROW_MAJOR(handles[d]);
+        for(rocblas_int e = 0; e < d; ++e)
+            if(handles[e]->getDevice() == handles[d]->getDevice())
+                return rocblas_status_invalid_value;
+    }
+    return rocblas_status_success;
+}
+
+// The first handle, followed by the handles whose devices can read and write the memory of
+// its device over a peer link, with peer access enabled
+inline std::vector<rocblas_handle> rocblas_mgpu_peers(const rocblas_handle* handles,
+                                                      rocblas_int           num_handles)
+{
+    int                         home = handles[0]->getDevice();
+    std::vector<rocblas_handle> peers{handles[0]};
+    for(rocblas_int d = 1; d < num_handles; ++d)
+    {
+        int can_access = 0;
+        int device     = handles[d]->getDevice();
+        if(hipDeviceCanAccessPeer(&can_access, device, home) != hipSuccess || !can_access)
+            continue;
+
+        auto       saved_device_id = handles[d]->push_device_id();
+        hipError_t status          = hipDeviceEnablePeerAccess(home, 0);
+        if(status == hipErrorPeerAccessAlreadyEnabled)
+            (void)hipGetLastError();
+        else if(status != hipSuccess)
+            continue;
+        peers.push_back(handles[d]);
+    }
+    return peers;
+}
+
+// Copy a column major matrix of elements of elem_size bytes between devices, on a stream of
+// either device
+inline rocblas_status rocblas_mgpu_copy_matrix(int64_t     rows,
+                                               int64_t     cols,
+                                               size_t      elem_size,
+                                               const void* src,
+                                               int64_t     ld_src,
+                                               void*       dst,
+                                               int64_t     ld_dst,
+                                               hipStream_t stream)
+{
+    if(rows > 0 && cols > 0)
+        RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(dst,
+                                             ld_dst * elem_size,
+                                             src,
+                                             ld_src * elem_size,
+                                             rows * elem_size,
+                                             cols,
+                                             hipMemcpyDeviceToDevice,
+                                             stream));
+    return rocblas_status_success;
+}
@@ -122,6 +122,26 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                            rocblas_stride  strideC,
                                            rocblas_int     batch_count);
 
+// Large problems expand the referenced triangle of A into a full matrix in workspace and
+// compute C with one gemm, trading a pass over A for the efficiency of gemm
+constexpr int64_t c_symm_hemm_expand_min_ka = 1024; // order of A
+constexpr int64_t c_symm_hemm_expand_min_nk = 256; // other dimension of C
+
+inline bool rocblas_symm_hemm_use_expansion(rocblas_side side, int64_t m, int64_t n)
+{
+    int64_t ka = side == rocblas_side_left ? m : n;
+    int64_t nk = side == rocblas_side_left ? n : m;
+    return ka >= c_symm_hemm_expand_min_ka && nk >= c_symm_hemm_expand_min_nk;
+}
+
+// workspace bytes of symm and hemm for the expanded A; one matrix is expanded at a time
+template <typename T>
+inline size_t rocblas_internal_symm_hemm_workspace_size(rocblas_side side, int64_t m, int64_t n)
+{
+    int64_t ka = side == rocblas_side_left ? m : n;
+    return rocblas_symm_hemm_use_expansion(side, m, n) ? size_t(ka) * ka * sizeof(T) : 0;
+}
+
 template <bool HERM, typename T>
 rocblas_status rocblas_internal_symm_hemm_launcher(rocblas_handle handle,
                                                    rocblas_side   side,
@@ -1164,6 +1164,160 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
 }
 
 
+// W = A with the triangle which is not referenced filled from the stored one. Tiles in the
+// unreferenced triangle read the mirrored tile of A through LDS, so that both the reads of A and
+// the writes of W are coalesced.
+template <int DIM_X, int DIM_Y, bool HERM, typename T>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_symm_hemm_expand_kernel(bool is_upper, rocblas_int ka, const T* A, int64_t lda, T* W)
+{
+    __shared__ T tile[DIM_X][DIM_X + 1];
+
+    int64_t i0 = int64_t(blockIdx.x) * DIM_X;
+    int64_t j0 = int64_t(blockIdx.y) * DIM_X;
+
+    // the tile is entirely in the stored triangle
+    bool stored_tile = is_upper ? i0 + DIM_X - 1 <= j0 : i0 >= j0 + DIM_X - 1;
+
+    if(!stored_tile)
+    {
+        // tile[c][r] = A(j0 + r, i0 + c)
+        for(int c = threadIdx.y; c < DIM_X; c += DIM_Y)
+            if(j0 + threadIdx.x < ka && i0 + c < ka)
+                tile[c][threadIdx.x] = A[j0 + threadIdx.x + (i0 + c) * lda];
+        __syncthreads();
+    }
+
+    int64_t i = i0 + threadIdx.x;
+    for(int c = threadIdx.y; c < DIM_X; c += DIM_Y)
+    {
+        int64_t j = j0 + c;
+        if(i < ka && j < ka)
+        {
+            T v;
+            if(is_upper ? i <= j : i >= j)
+                v = A[i + j * lda];
+            else
+                v = HERM ? conj(tile[threadIdx.x][c]) : tile[threadIdx.x][c];
+
+            if(HERM && i == j)
+                v = std::real(v);
+            W[i + j * ka] = v;
+        }
+    }
+}
+
+// Computes C with one gemm per matrix of A expanded into the workspace. Returns
+// rocblas_status_continue when the problem is left to the blocked algorithm.
+template <bool HERM, typename T>
+rocblas_status rocblas_symm_hemm_expanded(rocblas_handle handle,
+                                          rocblas_side   side,
+                                          rocblas_fill   uplo,
+                                          rocblas_int    m,
+                                          rocblas_int    n,
+                                          const T*       alpha,
+                                          const T*       A,
+                                          rocblas_stride offsetA,
+                                          int64_t        lda,
+                                          rocblas_stride strideA,
+                                          const T*       B,
+                                          rocblas_stride offsetB,
+                                          int64_t        ldb,
+                                          rocblas_stride strideB,
+                                          const T*       beta,
+                                          T*             C,
+                                          rocblas_stride offsetC,
+                                          int64_t        ldc,
+                                          rocblas_stride strideC,
+                                          rocblas_int    batch_count)
+{
+    if(!rocblas_symm_hemm_use_expansion(side, m, n))
+        return rocblas_status_continue;
+
+    // without the workspace, e.g. when it was not queried, the blocked algorithm is used
+    auto w_mem = handle->device_malloc(rocblas_internal_symm_hemm_workspace_size<T>(side, m, n));
+    if(!w_mem)
+        return rocblas_status_continue;
+
+    T alpha_h, beta_h;
+    RETURN_IF_ROCBLAS_ERROR(
+        rocblas_copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, 1));
+    auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+    if(*alpha == T(0) && *beta == T(1))
+        return rocblas_status_success;
+
+    static constexpr int DIM_X = 32;
+    static constexpr int DIM_Y = 8;
+
+    T*          W     = (T*)w_mem;
+    rocblas_int ka    = side == rocblas_side_left ? m : n;
+    rocblas_int tiles = (ka - 1) / DIM_X + 1;
+
+    for(rocblas_int b = 0; b < batch_count; b++)
+    {
+        ROCBLAS_LAUNCH_KERNEL((rocblas_symm_hemm_expand_kernel<DIM_X, DIM_Y, HERM>),
+                              dim3(tiles, tiles),
+                              dim3(DIM_X, DIM_Y),
+                              0,
+                              handle->get_stream(),
+                              uplo == rocblas_fill_upper,
+                              ka,
+                              A + offsetA + b * strideA,
+                              lda,
+                              W);
+
+        const T* Bb = B + offsetB + b * strideB;
+        T*       Cb = C + offsetC + b * strideC;
+        if(side == rocblas_side_left)
+            RETURN_IF_ROCBLAS_ERROR((rocblas_internal_gemm_64<false>(handle,
+                                                                     rocblas_operation_none,
+                                                                     rocblas_operation_none,
+                                                                     m,
+                                                                     n,
+                                                                     m,
+                                                                     alpha,
+                                                                     (const T*)W,
+                                                                     0,
+                                                                     int64_t(ka),
+                                                                     0,
+                                                                     Bb,
+                                                                     0,
+                                                                     ldb,
+                                                                     0,
+                                                                     beta,
+                                                                     Cb,
+                                                                     0,
+                                                                     ldc,
+                                                                     0,
+                                                                     1)));
+        else
+            RETURN_IF_ROCBLAS_ERROR((rocblas_internal_gemm_64<false>(handle,
+                                                                     rocblas_operation_none,
+                                                                     rocblas_operation_none,
+                                                                     m,
+                                                                     n,
+                                                                     n,
+                                                                     alpha,
+                                                                     Bb,
+                                                                     0,
+                                                                     ldb,
+                                                                     0,
+                                                                     (const T*)W,
+                                                                     0,
+                                                                     int64_t(ka),
+                                                                     0,
+                                                                     beta,
+                                                                     Cb,
+                                                                     0,
+                                                                     ldc,
+                                                                     0,
+                                                                     1)));
+    }
+
+    return rocblas_status_success;
+}
+
 template <bool HERM , typename T>
 rocblas_status rocblas_internal_symm_hemm_launcher(rocblas_handle handle,
                                               rocblas_side   side,
@@ -1186,6 +1340,12 @@ rocblas_status rocblas_internal_symm_hemm_launcher(rocblas_handle handle,
                                               rocblas_stride strideC,
                                               rocblas_int        batch_count)
 {
+    rocblas_status status = rocblas_symm_hemm_expanded<HERM>(handle, side, uplo, m, n, alpha,
+        A, offsetA, lda, strideA,
+        B, offsetB, ldb, strideB, beta,
+        C, offsetC, ldc, strideC, batch_count);
+    if(status != rocblas_status_continue)
+        return status;
 
     if(batch_count == 1 )
     {
@@ -93,6 +93,22 @@ rocblas_status rocblas_syrkx_syr2k_dispatch(rocblas_fill      uplo,
     }
 }
 
+// The block-recursive algorithm handles one matrix per call, with two kernel launches for the
+// diagonal blocks and up to two gemm launches per doubling of the block size, while the
+// non-recursive algorithm launches one kernel per diagonal block and one gemm per off-diagonal
+// block for all batches. For strided batches this prefers the block-recursive algorithm applied
+// to each batch when it needs fewer launches, which is the case for few large matrices.
+template <rocblas_int MIN_NB>
+inline bool rocblas_syr2k_block_recursive_batches(rocblas_int n, rocblas_int batch_count)
+{
+    int64_t n_nb   = n / MIN_NB;
+    int64_t levels = 0;
+    for(int64_t nb = MIN_NB; nb < n; nb *= 2)
+        levels++;
+
+    return int64_t(batch_count) * (2 + 2 * levels) < 2 * n_nb;
+}
+
 #define OFFSET_A(i1) offset_a + i1* rocblas_stride(a_s1)
 #define OFFSET_B(i1) offset_b + i1* rocblas_stride(b_s1)
 #define OFFSET_C(i1, i2) offset_c + i1* rocblas_stride(c_s1) + i2* rocblas_stride(c_s2)
@@ -546,8 +562,25 @@ rocblas_status rocblas_internal_syr2k_her2k_template(rocblas_handle    handle,
     const T* alpha = &alpha_val;
     const T* beta  = &beta_val;
 
+    // Batches of small problems are launch bound, compute all of them in a single launch
+    if(n <= ROCBLAS_SYR2K_SMALL_BATCHED_MAX_N && batch_count > 1)
+    {
+        // clang-format off
+        if(BATCHED)
+            return rocblas_syr2k_her2k_small_batched_dispatch<API_INT, TWOK, HERK>(
+                uplo, trans, n, k, *alpha, dA_in, lda, offset_a, dB_in, ldb, offset_b,
+                *beta, dC_in, ldc, offset_c, batch_count, handle->get_stream());
+        else
+            return rocblas_syr2k_her2k_small_batched_dispatch<API_INT, TWOK, HERK>(
+                uplo, trans, n, k, *alpha, dA_in + offset_a, lda, stride_a, dB_in + offset_b, ldb,
+                stride_b, *beta, dC_in + offset_c, ldc, stride_c, batch_count,
+                handle->get_stream());
+        // clang-format on
+    }
+
     // Can't use block-recursive algorithm with batched version
-    // Can use block-recursive algorithm with strided_batched when batch_count == 1
+    // Can use block-recursive algorithm with strided_batched when batch_count == 1, and for each
+    // batch of strided_batched when that needs fewer launches
     if(!BATCHED && batch_count == 1)
     {
         return rocblas_internal_syr2k_syrkx_block_recursive_template<API_INT,
@@ -572,6 +605,21 @@ rocblas_status rocblas_internal_syr2k_her2k_template(rocblas_handle    handle,
                                                                         ldc);
     }
 
+    if(!BATCHED && rocblas_syr2k_block_recursive_batches<MIN_NB>(n, batch_count))
+    {
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            // clang-format off
+            RETURN_IF_ROCBLAS_ERROR((rocblas_internal_syr2k_syrkx_block_recursive_template<
+                API_INT, MIN_NB, TWOK, HERK, T>(handle, uplo, trans, n, k, alpha,
+                    dA_in, offset_a + b * stride_a, lda,
+                    dB_in, offset_b + b * stride_b, ldb, beta,
+                    dC_in, offset_c + b * stride_c, ldc)));
+            // clang-format on
+        }
+        return rocblas_status_success;
+    }
+
     API_INT a_s1 = rocblas_operation_none == trans ? 1 : lda;
     API_INT b_s1 = rocblas_operation_none == trans ? 1 : ldb;
     API_INT c_s1 = 1, c_s2 = ldc;
@@ -0,0 +1,283 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * syrk and herk with a diagonal weight, C = alpha * op(A) * diag(d) * op(A)**T + beta * C.
+ * The weights are applied to the tiles of op(A) as they are staged in LDS, so the weighted copy
+ * of A that a dgmm before syrk writes and reads again is never formed.
+ */
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "utility.hpp"
+
+namespace
+{
+    template <bool, typename>
+    constexpr char rocblas_syrk_diag_name[] = "unknown";
+    template <>
+    constexpr char rocblas_syrk_diag_name<false, float>[] = "rocblas_ssyrk_diag";
+    template <>
+    constexpr char rocblas_syrk_diag_name<false, double>[] = "rocblas_dsyrk_diag";
+    template <>
+    constexpr char rocblas_syrk_diag_name<false, rocblas_float_complex>[] = "rocblas_csyrk_diag";
+    template <>
+    constexpr char rocblas_syrk_diag_name<false, rocblas_double_complex>[] = "rocblas_zsyrk_diag";
+    template <>
+    constexpr char rocblas_syrk_diag_name<true, rocblas_float_complex>[] = "rocblas_cherk_diag";
+    template <>
+    constexpr char rocblas_syrk_diag_name<true, rocblas_double_complex>[] = "rocblas_zherk_diag";
+
+    // The tile (ti, tj), ti >= tj, of the lower triangle of C, tile blockIdx.x in row order,
+    // computes C(r, c) = alpha * sum_l op(A)(r, l) * d(l) * conj(op(A)(c, l)) + beta * C(r, c)
+    // for r >= c, stored as its conjugate in C(c, r) for an upper C
+    template <int TILE, bool HERM, typename T, typename D, typename TScal>
+    ROCBLAS_KERNEL(TILE* TILE)
+    rocblas_syrk_diag_kernel(bool        upper,
+                             bool        trans,
+                             rocblas_int n,
+                             rocblas_int k,
+                             TScal       alpha_device_host,
+                             const T*    A,
+                             int64_t     lda,
+                             const D*    d,
+                             int64_t     incd,
+                             TScal       beta_device_host,
+                             T*          C,
+                             int64_t     ldc)
+    {
+        __shared__ T sa[TILE][TILE + 1];
+        __shared__ T sb[TILE][TILE + 1];
+
+        auto alpha = load_scalar(alpha_device_host);
+        auto beta  = load_scalar(beta_device_host);
+
+        int ti = 0, tj = blockIdx.x;
+        while(tj > ti)
+            tj -= ++ti;
+
+        int     tx = threadIdx.x % TILE, ty = threadIdx.x / TILE;
+        int64_t rb = int64_t(ti) * TILE;
+        int64_t cb = int64_t(tj) * TILE;
+
+        // element l of row r of op(A), with op(A) = A**H for herk
+        auto op_a = [&](int64_t r, int64_t l) {
+            return r < n && l < k ? (trans ? conj_if_true<HERM>(A[l + r * lda]) : A[r + l * lda])
+                                  : T(0);
+        };
+
+        T sum = 0;
+        for(int64_t l0 = 0; alpha != 0 && l0 < k; l0 += TILE)
+        {
+            // consecutive threads load consecutive elements of A
+            int     i = trans ? ty : tx, l = trans ? tx : ty;
+            int64_t lk = l0 + l;
+            sa[i][l]   = lk < k ? op_a(rb + i, lk) * d[lk * incd] : T(0);
+            sb[i][l]   = conj_if_true<HERM>(op_a(cb + i, lk));
+            __syncthreads();
+
+            for(int j = 0; j < TILE; j++)
+                sum += sa[tx][j] * sb[ty][j];
+            __syncthreads();
+        }
+
+        int64_t r = rb + tx, c = cb + ty;
+        if(r < n && r >= c)
+        {
+            T* cv = upper ? C + r * ldc + c : C + c * ldc + r;
+            T  s  = upper ? conj_if_true<HERM>(alpha * sum) : alpha * sum;
+            *cv   = beta == 0 ? s : s + beta * *cv;
+            if(HERM && r == c)
+                *cv = std::real(*cv);
+        }
+    }
+
+    // C = alpha * op(A) * diag(d) * op(A)**T + beta * C (syrk), with **H and real alpha, beta and
+    // d (herk)
+    template <bool HERM, typename T, typename U>
+    rocblas_status rocblas_syrk_diag_impl(rocblas_handle    handle,
+                                          rocblas_fill      uplo,
+                                          rocblas_operation transA,
+                                          rocblas_int       n,
+                                          rocblas_int       k,
+                                          const U*          alpha,
+                                          const T*          A,
+                                          rocblas_int       lda,
+                                          const U*          d,
+                                          rocblas_int       incd,
+                                          const U*          beta,
+                                          T*                C,
+                                          rocblas_int       ldc)
+    {
+        static constexpr int TILE = rocblas_is_complex<T> ? 16 : 32;
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // row major order, see rocblas_set_order, has no column major mapping here
+        RETURN_NOT_IMPLEMENTED_IF_ROW_MAJOR(handle);
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_syrk_diag_name<HERM, T>,
+                      uplo,
+                      transA,
+                      n,
+                      k,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      A,
+                      lda,
+                      d,
+                      incd,
+                      LOG_TRACE_SCALAR_VALUE(handle, beta),
+                      C,
+                      ldc);
+
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_invalid_value;
+        if(transA != rocblas_operation_none && transA != rocblas_operation_transpose
+           && transA != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+        // complex syrk has no conjugate transpose, and herk no transpose
+        rocblas_operation invalid_trans
+            = HERM ? rocblas_operation_transpose : rocblas_operation_conjugate_transpose;
+        if(rocblas_is_complex<T> && transA == invalid_trans)
+            return rocblas_status_invalid_value;
+
+        bool trans = transA != rocblas_operation_none;
+        if(n < 0 || k < 0 || !incd || ldc < std::max(n, 1) || lda < std::max(trans ? k : n, 1))
+            return rocblas_status_invalid_size;
+
+        if(!n)
+            return rocblas_status_success;
+        if(!alpha || !beta)
+            return rocblas_status_invalid_pointer;
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            if((!k || *alpha == 0) && *beta == 1)
+                return rocblas_status_success;
+            if((k && *alpha != 0 && (!A || !d)) || !C)
+                return rocblas_status_invalid_pointer;
+        }
+        else if((k && (!A || !d)) || !C)
+            return rocblas_status_invalid_pointer;
+
+        // the weights are read with a negative increment from the end of d
+        const U* d_start = incd < 0 && k ? d - int64_t(k - 1) * incd : d;
+
+        rocblas_int tiles = (n - 1) / TILE + 1;
+        dim3        grid(int64_t(tiles) * (tiles + 1) / 2);
+        dim3        threads(TILE * TILE);
+        hipStream_t stream = handle->get_stream();
+        bool        upper  = uplo == rocblas_fill_upper;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_syrk_diag_kernel<TILE, HERM, T>),
+                                  grid,
+                                  threads,
+                                  0,
+                                  stream,
+                                  upper,
+                                  trans,
+                                  n,
+                                  k,
+                                  alpha,
+                                  A,
+                                  lda,
+                                  d_start,
+                                  incd,
+                                  beta,
+                                  C,
+                                  ldc);
+        else
+            ROCBLAS_LAUNCH_KERNEL((rocblas_syrk_diag_kernel<TILE, HERM, T>),
+                                  grid,
+                                  threads,
+                                  0,
+                                  stream,
+                                  upper,
+                                  trans,
+                                  n,
+                                  k,
+                                  *alpha,
+                                  A,
+                                  lda,
+                                  d_start,
+                                  incd,
+                                  *beta,
+                                  C,
+                                  ldc);
+
+        return rocblas_status_success;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(name_, HERM_, T_, U_)                                                         \
+    rocblas_status name_(rocblas_handle    handle,                                         \
+                         rocblas_fill      uplo,                                           \
+                         rocblas_operation transA,                                         \
+                         rocblas_int       n,                                              \
+                         rocblas_int       k,                                              \
+                         const U_*         alpha,                                          \
+                         const T_*         A,                                              \
+                         rocblas_int       lda,                                            \
+                         const U_*         d,                                              \
+                         rocblas_int       incd,                                           \
+                         const U_*         beta,                                           \
+                         T_*               C,                                              \
+                         rocblas_int       ldc)                                            \
+    try                                                                                    \
+    {                                                                                      \
+        return rocblas_syrk_diag_impl<HERM_, T_>(                                          \
+            handle, uplo, transA, n, k, alpha, A, lda, d, incd, beta, C, ldc);             \
+    }                                                                                      \
+    catch(...)                                                                             \
+    {                                                                                      \
+        return exception_to_rocblas_status();                                              \
+    }
+
+extern "C" {
+
+IMPL(rocblas_ssyrk_diag, false, float, float);
+IMPL(rocblas_dsyrk_diag, false, double, double);
+IMPL(rocblas_csyrk_diag, false, rocblas_float_complex, rocblas_float_complex);
+IMPL(rocblas_zsyrk_diag, false, rocblas_double_complex, rocblas_double_complex);
+IMPL(rocblas_cherk_diag, true, rocblas_float_complex, float);
+IMPL(rocblas_zherk_diag, true, rocblas_double_complex, double);
+
+} // extern "C"
+
+#undef IMPL
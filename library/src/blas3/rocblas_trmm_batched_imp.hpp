@@ -58,6 +58,14 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        // row major B^T = op(A)^T swaps the side of A, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+        {
+            side = rocblas_row_major_side(side);
+            uplo = rocblas_row_major_fill(uplo);
+            std::swap(m, n);
+        }
+
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
         T        alpha_h, beta_h;
@@ -68,9 +76,11 @@ namespace
 
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+
+        rocblas_api_scope api_scope(handle, rocblas_trmm_batched_name<T>);
         if(layer_mode
                & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-                  | rocblas_layer_mode_log_profile)
+                  | rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx)
            && (!handle->is_device_memory_size_query()))
         {
             auto side_letter   = rocblas_side_letter(side);
@@ -122,7 +132,7 @@ namespace
                           "--batch_count",
                           batch_count);
 
-            if(layer_mode & rocblas_layer_mode_log_profile)
+            if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                 log_profile(handle,
                             rocblas_trmm_batched_name<T>,
                             "side",
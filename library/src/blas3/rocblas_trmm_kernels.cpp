@@ -72,6 +72,21 @@ rocblas_int rocblas_get_trmm_recursive_nb(rocblas_int n)
     return rocblas_previous_po2(n - 1);
 }
 
+// rocblas_internal_trmm_outofplace_template handles one matrix per call, with two launches for
+// the diagonal blocks of size ROCBLAS_TRMM_OUTOFPLACE_NB and up to two gemm launches per doubling
+// of the block size, while the in-place recursion launches a kernel and a gemm for every block
+// of size NB of all batches. Strided batches of few large matrices are computed one batch at a
+// time by the out-of-place algorithm when it needs fewer launches.
+template <rocblas_int NB>
+inline bool rocblas_trmm_outofplace_batches(rocblas_int k, rocblas_int batch_count)
+{
+    int64_t levels = 0;
+    for(int64_t nb = ROCBLAS_TRMM_OUTOFPLACE_NB; nb < k; nb *= 2)
+        levels++;
+
+    return int64_t(batch_count) * (2 + 2 * levels) < 2 * (k / NB);
+}
+
 template <rocblas_int DIM_X, rocblas_int DIM_Y, typename TScal, typename TPtr>
 ROCBLAS_KERNEL(DIM_X* DIM_Y)
 rocblas_set_matrix_zero_if_alpha_zero_kernel(rocblas_int    m,
@@ -2156,35 +2171,43 @@ rocblas_status rocblas_internal_trmm_launcher(rocblas_handle    handle,
     if(!m || !n || !batch_count)
         return rocblas_status_success;
 
-    // rocblas_internal_trmm_outofplace_template() only supports single batches
-    bool inplace = (dB == dC) || BATCHED || batch_count != 1;
-
     rocblas_int k = side == rocblas_side_left ? m : n;
+
+    // rocblas_internal_trmm_outofplace_template() only supports single batches, so strided
+    // batches are computed by it one batch at a time
+    bool inplace = (dB == dC) || BATCHED
+                   || (batch_count != 1
+                       && (stride_alpha || !rocblas_trmm_outofplace_batches<NB>(k, batch_count)));
+
     if(!inplace)
     {
         // always !BATCHED here so avoiding reference to uninstantiated code
         if constexpr(!BATCHED)
         {
-            // single bathc so applying offset here
-            rocblas_set_matrix_zero_if_alpha_zero_template(
-                handle, m, n, &alpha_0<T>, 0, dC + offset_c, ldc, 0, 1);
-            return rocblas_internal_trmm_outofplace_template<T>(handle,
-                                                                side,
-                                                                uplo,
-                                                                trans_a,
-                                                                diag,
-                                                                m,
-                                                                n,
-                                                                alpha,
-                                                                dA,
-                                                                offset_a,
-                                                                lda,
-                                                                dB,
-                                                                offset_b,
-                                                                ldb,
-                                                                dC,
-                                                                offset_c,
-                                                                ldc);
+            RETURN_IF_ROCBLAS_ERROR(rocblas_set_matrix_zero_if_alpha_zero_template(
+                handle, m, n, &alpha_0<T>, 0, dC + offset_c, ldc, stride_c, batch_count));
+
+            for(rocblas_int b = 0; b < batch_count; b++)
+            {
+                RETURN_IF_ROCBLAS_ERROR(
+                    rocblas_internal_trmm_outofplace_template<T>(handle,
+                                                                 side,
+                                                                 uplo,
+                                                                 trans_a,
+                                                                 diag,
+                                                                 m,
+                                                                 n,
+                                                                 alpha,
+                                                                 dA,
+                                                                 offset_a + b * stride_a,
+                                                                 lda,
+                                                                 dB,
+                                                                 offset_b + b * stride_b,
+                                                                 ldb,
+                                                                 dC,
+                                                                 offset_c + b * stride_c,
+                                                                 ldc));
+            }
         }
     }
     else
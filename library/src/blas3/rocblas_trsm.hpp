@@ -247,3 +247,143 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                            rocblas_int       supplied_invA_size = 0,
                                            rocblas_stride    offset_invA        = 0,
                                            rocblas_stride    stride_invA        = 0);
+
+/*
+ * internal rocBLAS template functions for the trailing updates of blocked factorizations.
+ *
+ * rocblas_internal_trsm_gemm_template solves op(A) * X = alpha * B (side left) or
+ * X * op(A) = alpha * B (side right) for X, which overwrites the m x n matrix B, and then
+ * updates C := C - D * X (side left, C is k_update x n and D is k_update x m) or
+ * C := C - X * D (side right, C is m x k_update and D is n x k_update), as in blocked LU.
+ *
+ * rocblas_internal_trsm_syrk_template is the panel step of a blocked Cholesky factorization
+ * with the factored n x n diagonal block A. With uplo lower, B is the m x n panel below A and
+ * is overwritten by B * A**-H, then C := C - B * B**H; with uplo upper, B is the n x m panel
+ * to the right of A and is overwritten by A**-H * B, then C := C - B**H * B. Only the uplo
+ * triangle of the m x m matrix C is updated, with herk for complex types and syrk otherwise.
+ *
+ * The solve and the update are queued back to back on the handle stream, with the update
+ * coefficients in host memory so that no synchronization happens between them. The
+ * workspace is the one of the trsm, queried with rocblas_internal_trsm_workspace_size or
+ * rocblas_internal_trsm_batched_workspace_size, and may be reused for every panel.
+ * Arguments are not checked.
+ */
+template <typename T>
+ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
+    rocblas_internal_trsm_gemm_template(rocblas_handle    handle,
+                                        rocblas_side      side,
+                                        rocblas_fill      uplo,
+                                        rocblas_operation transA,
+                                        rocblas_diagonal  diag,
+                                        rocblas_int       m,
+                                        rocblas_int       n,
+                                        rocblas_int       k_update,
+                                        const T*          alpha,
+                                        const T*          A,
+                                        rocblas_stride    offset_A,
+                                        rocblas_int       lda,
+                                        rocblas_stride    stride_A,
+                                        T*                B,
+                                        rocblas_stride    offset_B,
+                                        rocblas_int       ldb,
+                                        rocblas_stride    stride_B,
+                                        const T*          D,
+                                        rocblas_stride    offset_D,
+                                        rocblas_int       ldd,
+                                        rocblas_stride    stride_D,
+                                        T*                C,
+                                        rocblas_stride    offset_C,
+                                        rocblas_int       ldc,
+                                        rocblas_stride    stride_C,
+                                        rocblas_int       batch_count,
+                                        bool              optimal_mem,
+                                        void*             w_x_temp,
+                                        void*             w_x_temparr,
+                                        void*             invA,
+                                        void*             invAarr);
+
+template <typename T>
+ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
+    rocblas_internal_trsm_gemm_batched_template(rocblas_handle    handle,
+                                                rocblas_side      side,
+                                                rocblas_fill      uplo,
+                                                rocblas_operation transA,
+                                                rocblas_diagonal  diag,
+                                                rocblas_int       m,
+                                                rocblas_int       n,
+                                                rocblas_int       k_update,
+                                                const T*          alpha,
+                                                const T* const*   A,
+                                                rocblas_stride    offset_A,
+                                                rocblas_int       lda,
+                                                rocblas_stride    stride_A,
+                                                T* const*         B,
+                                                rocblas_stride    offset_B,
+                                                rocblas_int       ldb,
+                                                rocblas_stride    stride_B,
+                                                const T* const*   D,
+                                                rocblas_stride    offset_D,
+                                                rocblas_int       ldd,
+                                                rocblas_stride    stride_D,
+                                                T* const*         C,
+                                                rocblas_stride    offset_C,
+                                                rocblas_int       ldc,
+                                                rocblas_stride    stride_C,
+                                                rocblas_int       batch_count,
+                                                bool              optimal_mem,
+                                                void*             w_x_temp,
+                                                void*             w_x_temparr,
+                                                void*             invA,
+                                                void*             invAarr);
+
+template <typename T>
+ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
+    rocblas_internal_trsm_syrk_template(rocblas_handle   handle,
+                                        rocblas_fill     uplo,
+                                        rocblas_diagonal diag,
+                                        rocblas_int      n,
+                                        rocblas_int      m,
+                                        const T*         A,
+                                        rocblas_stride   offset_A,
+                                        rocblas_int      lda,
+                                        rocblas_stride   stride_A,
+                                        T*               B,
+                                        rocblas_stride   offset_B,
+                                        rocblas_int      ldb,
+                                        rocblas_stride   stride_B,
+                                        T*               C,
+                                        rocblas_stride   offset_C,
+                                        rocblas_int      ldc,
+                                        rocblas_stride   stride_C,
+                                        rocblas_int      batch_count,
+                                        bool             optimal_mem,
+                                        void*            w_x_temp,
+                                        void*            w_x_temparr,
+                                        void*            invA,
+                                        void*            invAarr);
+
+template <typename T>
+ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
+    rocblas_internal_trsm_syrk_batched_template(rocblas_handle   handle,
+                                                rocblas_fill     uplo,
+                                                rocblas_diagonal diag,
+                                                rocblas_int      n,
+                                                rocblas_int      m,
+                                                const T* const*  A,
+                                                rocblas_stride   offset_A,
+                                                rocblas_int      lda,
+                                                rocblas_stride   stride_A,
+                                                T* const*        B,
+                                                rocblas_stride   offset_B,
+                                                rocblas_int      ldb,
+                                                rocblas_stride   stride_B,
+                                                T* const*        C,
+                                                rocblas_stride   offset_C,
+                                                rocblas_int      ldc,
+                                                rocblas_stride   stride_C,
+                                                rocblas_int      batch_count,
+                                                bool             optimal_mem,
+                                                void*            w_x_temp,
+                                                void*            w_x_temparr,
+                                                void*            invA,
+                                                void*            invAarr);
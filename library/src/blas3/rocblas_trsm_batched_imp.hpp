@@ -72,16 +72,25 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        // row major B^T = op(A)^T swaps the side of A, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+        {
+            side = rocblas_row_major_side(side);
+            uplo = rocblas_row_major_fill(uplo);
+            std::swap(m, n);
+        }
+
         auto check_numerics = handle->check_numerics;
         /////////////
         // LOGGING //
         /////////////
+        rocblas_api_scope api_scope(handle, rocblas_trsm_name<T>);
         if(!handle->is_device_memory_size_query())
         {
             auto layer_mode = handle->layer_mode;
             if(layer_mode
                & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-                  | rocblas_layer_mode_log_profile))
+                  | rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             {
                 auto side_letter   = rocblas_side_letter(side);
                 auto uplo_letter   = rocblas_fill_letter(uplo);
@@ -130,7 +139,7 @@ namespace
                               batch_count);
                 }
 
-                if(layer_mode & rocblas_layer_mode_log_profile)
+                if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                 {
                     log_profile(handle,
                                 rocblas_trsm_name<T>,
@@ -69,16 +69,42 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        // row major B^T = op(A)^T swaps the side of A, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+        {
+            side = rocblas_row_major_side(side);
+            uplo = rocblas_row_major_fill(uplo);
+            std::swap(m, n);
+        }
+
+        // use the inverses registered with rocblas_set_trsm_invA for A, if any
+        if(!supplied_invA && std::is_same_v<API_INT, rocblas_int>)
+        {
+            const auto* registered
+                = handle->find_trsm_invA(rocblas_datatype_from_type<T>,
+                                         uplo,
+                                         diag,
+                                         side == rocblas_side_left ? m : n,
+                                         A,
+                                         lda);
+            if(registered)
+            {
+                supplied_invA      = (const T*)registered->invA;
+                supplied_invA_size = registered->invA_size;
+            }
+        }
+
         auto check_numerics = handle->check_numerics;
         /////////////
         // LOGGING //
         /////////////
+        rocblas_api_scope api_scope(handle, rocblas_trsm_name<T>);
         if(!handle->is_device_memory_size_query())
         {
             auto layer_mode = handle->layer_mode;
             if(layer_mode
                & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-                  | rocblas_layer_mode_log_profile))
+                  | rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             {
                 auto side_letter   = rocblas_side_letter(side);
                 auto uplo_letter   = rocblas_fill_letter(uplo);
@@ -122,7 +148,7 @@ namespace
                               "--ldb",
                               ldb);
 
-                if(layer_mode & rocblas_layer_mode_log_profile)
+                if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                     log_profile(handle,
                                 rocblas_trsm_name<T>,
                                 "side",
@@ -31,6 +31,7 @@
 #include "rocblas_block_sizes.h"
 #include "rocblas_gemm.hpp"
 #include "rocblas_trsm.hpp"
+#include "rocblas_trsm_threshold.hpp"
 #include "src64/blas3/rocblas_gemm_64.hpp"
 #include "trtri_trsm.hpp"
 
@@ -1458,24 +1459,14 @@ inline bool
     return (side == rocblas_side_left && transA == rocblas_operation_none && m > n * 4 && m > 8192);
 }
 
-static const size_t rocblas_internal_trsm_reg_kernel_mem_limit = [] {
-    // 128 MB
-    // How much memory to limit usage of regular trsm_left and trsm_right kernels,
-    // when trsm_special can also be used, to increase performance
-    // i.e. reduce memory usage if possible if trying to allocate more than this amount of memory
-    constexpr size_t TRSM_REG_KERNEL_MEM_LIMIT = 128 * 1024 * 1024;
-    size_t           mem_limit;
-    const char*      env = getenv("ROCBLAS_INTERNAL_TRSM_REG_KERNEL_MEM_LIMIT");
-    return env && sscanf(env, "%zu", &mem_limit) == 1 ? mem_limit : TRSM_REG_KERNEL_MEM_LIMIT;
-}();
-
 template <rocblas_int BLOCK, bool BATCHED, typename T>
 inline bool trsm_use_special_kernel(rocblas_side      side,
                                     rocblas_operation transA,
                                     rocblas_int       m,
                                     rocblas_int       n,
                                     rocblas_int       batch_count,
-                                    rocblas_int       supplied_invA_size)
+                                    rocblas_int       supplied_invA_size,
+                                    size_t            mem_limit)
 {
 #ifndef BUILD_WITH_TENSILE
     return false;
@@ -1521,22 +1512,34 @@ inline bool trsm_use_special_kernel(rocblas_side      side,
         = x_temp_bytes + invA_temp_bytes + (BATCHED ? 2 * sizeof(T) * batch_count : 0);
 
     // If the regular kernel as calculated here needs too much memory, use special kernel, otherwise use regular kernel.
-    return total_regular_kernel_req_mem > rocblas_internal_trsm_reg_kernel_mem_limit;
+    return total_regular_kernel_req_mem > mem_limit;
 }
 
-inline bool rocblas_internal_trsm_use_substitution(rocblas_side side,
-                                                   rocblas_int  m,
-                                                   rocblas_int  n,
-                                                   rocblas_int  batch_count)
+template <typename T>
+inline bool rocblas_internal_trsm_use_substitution(const rocblas_trsm_thresholds& thresholds,
+                                                   rocblas_side                   side,
+                                                   rocblas_int                    m,
+                                                   rocblas_int                    n,
+                                                   rocblas_int                    batch_count)
 {
-    // from various rocBLAS profiling, the following bounds
-    // have been chosen to decide between substitution method/inversion method
-    // These are just empirically found and will not always be the best choice.
-    // TODO: These are very conservative numbers and should be updated with future work.
-    //       Ideally, we can use rocblas_trsm_blksize to determine whether or not to use
+    // The bounds deciding between substitution method/inversion method are found empirically,
+    // see rocblas_trsm_threshold.hpp. They can be tuned per architecture, they will not always
+    // be the best choice otherwise.
+    // TODO: Ideally, we can use rocblas_trsm_blksize to determine whether or not to use
     //       the rocblas_trsm_small_substitution function or not.
-    return side == rocblas_side_left
-           && ((n <= 32 && batch_count >= 16 && m < 512) || (n > 32 && n <= 128 && m <= 340));
+    return rocblas_trsm_use_substitution(
+        thresholds, rocblas_trsm_precision<T>(), side, m, n, batch_count);
+}
+
+// trsm with at most ROCBLAS_TRSM_SKINNY_MAX_RHS right-hand sides of more than 64 elements is
+// solved by the blocked multi-vector trsv rocblas_trsm_skinny_kernel, rather than by trtri and
+// gemms. A single right-hand side on the left is solved by trsv.
+inline bool rocblas_internal_trsm_use_skinny(rocblas_side side, rocblas_int m, rocblas_int n)
+{
+    const bool        left = side == rocblas_side_left;
+    const rocblas_int k    = left ? m : n;
+    const rocblas_int nrhs = left ? n : m;
+    return k > 64 && nrhs >= 1 && nrhs <= ROCBLAS_TRSM_SKINNY_MAX_RHS && !(left && nrhs == 1);
 }
 
 inline rocblas_int get_index(const rocblas_int* intervals, rocblas_int max, rocblas_int dim)
@@ -1671,6 +1674,17 @@ rocblas_status rocblas_internal_trsm_workspace_size(rocblas_side      side,
         return rocblas_status_success;
     }
 
+    // the blocked multi-vector trsv only needs the completion counters of the batches
+    if(rocblas_internal_trsm_use_skinny(side, m, n))
+    {
+        *w_x_tmp_size        = batch_count * sizeof(rocblas_int);
+        *w_x_tmp_arr_size    = 0;
+        *w_invA_size         = 0;
+        *w_invA_arr_size     = 0;
+        *w_x_tmp_size_backup = 0;
+        return rocblas_status_success;
+    }
+
     rocblas_int k = side == rocblas_side_left ? m : n;
 
     // no memory needed if using small kernels
@@ -1689,7 +1703,14 @@ rocblas_status rocblas_internal_trsm_workspace_size(rocblas_side      side,
     // no memory needed for substitution method, only used for specific sizes
     const bool  LEFT    = rocblas_side_left == side;
     rocblas_int blksize = rocblas_trsm_blksize<BATCHED, T>(LEFT ? m : n, LEFT ? n : m);
-    const bool  use_sub = rocblas_internal_trsm_use_substitution(side, m, n, batch_count);
+
+    // the thresholds of the current device, which the handle of the trsm call refers to
+    int device = 0;
+    RETURN_IF_HIP_ERROR(rocblas_get_current_device(&device));
+    const rocblas_trsm_thresholds& thresholds = rocblas_trsm_get_thresholds(device);
+
+    const bool use_sub
+        = rocblas_internal_trsm_use_substitution<T>(thresholds, side, m, n, batch_count);
 
     if(use_sub && blksize)
     {
@@ -1701,10 +1722,14 @@ rocblas_status rocblas_internal_trsm_workspace_size(rocblas_side      side,
         return rocblas_status_continue;
     }
 
-    // Whether size is an exact multiple of blocksize
-    const bool exact_blocks = (k % BLOCK) == 0;
-    const bool use_special  = trsm_use_special_kernel<BLOCK, BATCHED, T>(
-        side, transA, m, n, batch_count, supplied_invA_size);
+    const bool use_special = trsm_use_special_kernel<BLOCK, BATCHED, T>(
+        side,
+        transA,
+        m,
+        n,
+        batch_count,
+        supplied_invA_size,
+        thresholds.special_mem_limit[rocblas_trsm_precision<T>()]);
 
     size_t invA_temp_bytes     = 0;
     size_t c_temp_bytes        = 0;
@@ -1717,19 +1742,11 @@ rocblas_status rocblas_internal_trsm_workspace_size(rocblas_side      side,
         invA_temp_bytes = BLOCK * k * sizeof(T) * batch_count;
 
         // When k < BLOCK, C is unnecessary for trtri
-        // c_temp is not scaled by batch_count as trtri kernels are currently naive and
-        // just iterate through the batches using the same workspace memory
-        c_temp_bytes = ((k / BLOCK) * ((BLOCK / 2) * (BLOCK / 2))) * sizeof(T);
-
-        // For the TRTRI last diagonal block we need remainder space if k % BLOCK != 0
-        if(!exact_blocks)
-        {
-            // TODO: Make this more accurate -- right now it's much larger than necessary
-            size_t remainder_bytes = ROCBLAS_TRTRI_NB * BLOCK * 2 * sizeof(T);
-
-            // C is the maximum of the temporary space needed for TRTRI
-            c_temp_bytes = std::max(c_temp_bytes, remainder_bytes);
-        }
+        // Batched trtri runs the sub-block gemms of all batches at once, so each batch
+        // needs its own C; the strided version iterates over the batches reusing one C
+        c_temp_bytes = rocblas_trtri_trsm_c_temp_elements<BLOCK>(k) * sizeof(T);
+        if(BATCHED)
+            c_temp_bytes *= batch_count;
     }
 
     // non-special kernel (regular left/right kernel) when not exact blocks. Also used
@@ -1757,7 +1774,8 @@ rocblas_status rocblas_internal_trsm_workspace_size(rocblas_side      side,
     *w_x_tmp_arr_size    = BATCHED ? sizeof(T*) * batch_count : 0;
     *w_invA_size         = invA_temp_bytes;
     *w_invA_arr_size     = BATCHED ? sizeof(T*) * batch_count : 0;
-    *w_x_tmp_size_backup = x_temp_bytes_backup;
+    *w_x_tmp_size_backup = BATCHED ? std::max(x_temp_bytes_backup, c_temp_bytes)
+                                   : x_temp_bytes_backup;
 
     return rocblas_status_success;
 }
@@ -1889,6 +1907,22 @@ rocblas_status rocblas_internal_trsm_template_mem(rocblas_handle              ha
         return memory_status;
     }
 
+    // Memoize the requirement, so that rocBLAS-managed device memory is pre-sized for it
+    if(memory_status == rocblas_status_success)
+        handle->cache_workspace_size(
+            rocblas_workspace_signature("trsm",
+                                        rocblas_datatype_from_type<T>,
+                                        BATCHED,
+                                        side,
+                                        transA,
+                                        m,
+                                        n,
+                                        batch_count,
+                                        supplied_invA_size),
+            roundup_device_memory_size(w_x_tmp_size) + roundup_device_memory_size(w_x_tmp_arr_size)
+                + roundup_device_memory_size(w_invA_size)
+                + roundup_device_memory_size(w_invA_arr_size));
+
     if(handle->is_device_memory_size_query())
     {
         // indicates no memory needed
@@ -1926,7 +1960,9 @@ rocblas_status rocblas_internal_trsm_template_mem(rocblas_handle              ha
             workspace = handle->device_malloc(
                 w_x_tmp_size_backup, w_x_tmp_arr_size, w_invA_size, w_invA_arr_size);
 
-            if(!workspace)
+            // Without any workspace, rocblas_internal_trsm_launcher solves by blocked
+            // substitution with gemm updates. Only the trsv path (n == 1) cannot do without.
+            if(!workspace && n == 1 && side == rocblas_side_left)
                 return rocblas_status_memory_error;
 
             static auto& once = rocblas_cerr
@@ -1937,10 +1973,20 @@ rocblas_status rocblas_internal_trsm_template_mem(rocblas_handle              ha
             perf_status = rocblas_status_perf_degraded;
         }
 
-        w_mem_x_temp     = workspace[0];
-        w_mem_x_temp_arr = workspace[1];
-        w_mem_invA       = workspace[2];
-        w_mem_invA_arr   = workspace[3];
+        if(workspace)
+        {
+            w_mem_x_temp     = workspace[0];
+            w_mem_x_temp_arr = workspace[1];
+            w_mem_invA       = workspace[2];
+            w_mem_invA_arr   = workspace[3];
+        }
+        else
+        {
+            w_mem_x_temp     = nullptr;
+            w_mem_x_temp_arr = nullptr;
+            w_mem_invA       = nullptr;
+            w_mem_invA_arr   = nullptr;
+        }
     }
 
     return perf_status;
@@ -3094,9 +3140,8 @@ ROCBLAS_KERNEL_NO_BOUNDS rocblas_trsm_block_backward_substitution(rocblas_operat
     const int64_t ldb_norm  = TRANSB ? ldb : 1;
     const int64_t ldb_trans = TRANSB ? 1 : ldb;
 
-    const int     tx   = threadIdx.x;
-    const int     ty   = threadIdx.y;
-    const int64_t offY = blockIdx.y * blockDim.y + threadIdx.y;
+    const int tx = threadIdx.x;
+    const int ty = threadIdx.y;
 
     // passing as extern shared memory to avoid templating NB size
     // casting fails when going from double -> double complex and otherwise
@@ -3122,7 +3167,9 @@ ROCBLAS_KERNEL_NO_BOUNDS rocblas_trsm_block_backward_substitution(rocblas_operat
         lda_trans          = 1;
     }
 
-    if(offY < n && tx < m)
+    // the grid strides over the rows of B (columns for side left)
+    for(int64_t offY = blockIdx.y * int64_t(blockDim.y) + ty; offY < n && tx < m;
+        offY += int64_t(gridDim.y) * blockDim.y)
     {
         T valB = alpha * B[offY * size_t(ldb_norm) + tx * size_t(ldb_trans)];
         for(int64_t i = m - 1; i > 0; i--)
@@ -3198,9 +3245,8 @@ ROCBLAS_KERNEL_NO_BOUNDS rocblas_trsm_block_forward_substitution(rocblas_operati
     auto      B       = load_ptr_batch(Ba, batchid, offset_B, stride_B);
     auto      alpha   = load_scalar(alpha_dev_host);
 
-    const int     tx   = threadIdx.x;
-    const int     ty   = threadIdx.y;
-    const int64_t offY = blockIdx.y * blockDim.y + threadIdx.y;
+    const int tx = threadIdx.x;
+    const int ty = threadIdx.y;
 
     extern __shared__ rocblas_double_complex smem[];
     T*                                       sB = reinterpret_cast<T*>(smem);
@@ -3224,7 +3270,9 @@ ROCBLAS_KERNEL_NO_BOUNDS rocblas_trsm_block_forward_substitution(rocblas_operati
         lda_trans          = 1;
     }
 
-    if(offY < n && tx < m)
+    // the grid strides over the rows of B (columns for side left)
+    for(int64_t offY = blockIdx.y * int64_t(blockDim.y) + ty; offY < n && tx < m;
+        offY += int64_t(gridDim.y) * blockDim.y)
     {
         T   valB  = alpha * B[offY * size_t(ldb_norm) + tx * size_t(ldb_trans)];
         int sAoff = 1;
@@ -3300,7 +3348,8 @@ rocblas_status rocblas_trsm_small_substitution(rocblas_handle    handle,
     const int64_t  k2     = LEFT ? m : n;
     rocblas_int    NBX    = blk_size;
 
-    rocblas_int blocks = (k - 1) / (1024 / NBX) + 1;
+    // the substitution kernels stride over k beyond the grid
+    rocblas_int blocks = rocblas_int(std::min((k - 1) / (1024 / NBX) + 1, c_i64_grid_YZ_chunk));
 
     // kernel params for trsm substitution/solve portion
     dim3 grid(1, blocks, batch_count);
@@ -3455,7 +3504,8 @@ rocblas_status rocblas_trsm_small_substitution(rocblas_handle    handle,
 
     // solve last diagonal
     int64_t leftover = k2 - j;
-    blocks           = (k - 1) / (1024 / leftover) + 1;
+    blocks           = rocblas_int(
+        std::min((k - 1) / (1024 / leftover) + 1, c_i64_grid_YZ_chunk));
     grid             = dim3(1, blocks, batch_count);
     threads          = dim3(leftover, 1024 / leftover, 1);
     smem_size        = ((1024 / leftover) + (leftover * leftover)) * sizeof(T);
@@ -3594,6 +3644,269 @@ rocblas_status rocblas_internal_trsm_small_substitution_launcher(rocblas_handle
     return status;
 }
 
+/*! \brief Blocked multi-vector trsv solving op(A) * X = alpha * B for up to NRHS right-hand sides.
+ *         Each thread block solves the rows of X of one DIM_X diagonal block of op(A) for all
+ *         right-hand sides, after updating them with the blocks solved before it, which it waits
+ *         for on the completion counter of its batch like rocblas_trsv_device. The partial sums
+ *         of the right-hand sides are kept in registers.
+ *         Element (r, c) of op(A) is A(c, r) if TRANS and A(r, c) otherwise, conjugated if CONJ.
+ *         FORWARD is set when op(A) is lower triangular. Element (r, j) of B is at
+ *         r * inc_row + j * inc_rhs, so that trsm on the right solves with the transpose of B.
+ */
+template <rocblas_int DIM_X,
+          rocblas_int DIM_Y,
+          rocblas_int NRHS,
+          bool        FORWARD,
+          bool        TRANS,
+          bool        CONJ,
+          typename T,
+          typename ATYPE,
+          typename BTYPE>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_trsm_skinny_kernel(rocblas_int    k,
+                           rocblas_int    nrhs,
+                           bool           unit_diag,
+                           T              alpha,
+                           ATYPE          dA,
+                           rocblas_stride offset_A,
+                           int64_t        lda,
+                           rocblas_stride stride_A,
+                           BTYPE          dB,
+                           rocblas_stride offset_B,
+                           int64_t        inc_row,
+                           int64_t        inc_rhs,
+                           rocblas_stride stride_B,
+                           rocblas_int*   w_completed_sec)
+{
+    static_assert(DIM_Y >= NRHS && DIM_X % DIM_Y == 0, "invalid trsm skinny block dimensions");
+
+    const rocblas_int batch = blockIdx.y;
+    const auto* __restrict__ A = load_ptr_batch(dA, batch, offset_A, stride_A);
+    auto* __restrict__ B       = load_ptr_batch(dB, batch, offset_B, stride_B);
+
+    const rocblas_int tx         = threadIdx.x;
+    const rocblas_int ty         = threadIdx.y;
+    const rocblas_int tid        = ty * DIM_X + tx;
+    const rocblas_int num_blocks = gridDim.x;
+    const rocblas_int block_row  = FORWARD ? blockIdx.x : num_blocks - 1 - blockIdx.x;
+    const rocblas_int row0       = block_row * DIM_X;
+
+    auto op_A = [=](int64_t r, int64_t c) {
+        T a = TRANS ? A[c + r * lda] : A[r + c * lda];
+        return CONJ ? conj(a) : a;
+    };
+
+    __shared__ T sA[DIM_X][DIM_X + 1]; // diagonal block of op(A), inverted diagonal
+    __shared__ T sred[DIM_X][DIM_X + 1]; // partial sums to reduce
+    __shared__ T sx[NRHS][DIM_X]; // solved rows of X of a previous block
+    __shared__ T srhs[NRHS][DIM_X]; // updated right-hand sides of the block
+
+    // Load the diagonal block while the previous blocks are solved, out of range rows
+    // of the last block get an identity diagonal so they solve to zero
+    for(rocblas_int c = ty; c < DIM_X; c += DIM_Y)
+    {
+        const rocblas_int r  = tx;
+        const bool        in  = row0 + r < k && row0 + c < k;
+        const bool        tri = FORWARD ? r >= c : r <= c;
+        T                 a   = in && tri ? op_A(row0 + r, row0 + c) : T(0);
+        if(r == c)
+            a = !in || unit_diag ? T(1) : T(1) / a;
+        sA[r][c] = a;
+    }
+
+    // Update with the previous blocks, in the order they are solved
+    T val[DIM_X / DIM_Y][NRHS];
+    for(rocblas_int i = 0; i < DIM_X / DIM_Y; i++)
+        for(rocblas_int j = 0; j < NRHS; j++)
+            val[i][j] = T(0);
+
+    rocblas_int col_done = -1;
+    for(rocblas_int block_iter = 0; block_iter < rocblas_int(blockIdx.x); block_iter++)
+    {
+        const rocblas_int col0 = (FORWARD ? block_iter : num_blocks - 1 - block_iter) * DIM_X;
+
+        if(tid == 0 && col_done < block_iter)
+        {
+            while(w_completed_sec[batch] < block_iter)
+                __threadfence();
+            col_done = w_completed_sec[batch];
+        }
+        __threadfence();
+        __syncthreads();
+
+        for(rocblas_int e = tid; e < NRHS * DIM_X; e += DIM_X * DIM_Y)
+        {
+            const rocblas_int c = e % DIM_X;
+            const rocblas_int j = e / DIM_X;
+            // the first block of backward substitution may be the partial last block
+            sx[j][c] = j < nrhs && col0 + c < k ? B[(col0 + c) * inc_row + j * inc_rhs] : T(0);
+        }
+        __syncthreads();
+
+        // Consecutive threads read consecutive elements of A: rows of op(A) without TRANS,
+        // columns of op(A) with TRANS
+        for(rocblas_int i = 0; i < DIM_X / DIM_Y; i++)
+        {
+            const rocblas_int r = TRANS ? ty + i * DIM_Y : tx;
+            const rocblas_int c = TRANS ? tx : ty + i * DIM_Y;
+            if(row0 + r < k && col0 + c < k)
+            {
+                const T a = op_A(row0 + r, col0 + c);
+                for(rocblas_int j = 0; j < NRHS; j++)
+                    val[TRANS ? i : 0][j] += a * sx[j][c];
+            }
+        }
+        __syncthreads();
+    }
+
+    // Reduce the partial sums of each row, subtracted from alpha * B
+    for(rocblas_int j = 0; j < NRHS; j++)
+    {
+        if(TRANS)
+        {
+            for(rocblas_int i = 0; i < DIM_X / DIM_Y; i++)
+                sred[ty + i * DIM_Y][tx] = val[i][j];
+        }
+        else
+            sred[ty][tx] = val[0][j];
+        __syncthreads();
+
+        if(ty == 0)
+        {
+            T sum = T(0);
+            for(rocblas_int c = 0; c < (TRANS ? DIM_X : DIM_Y); c++)
+                sum += TRANS ? sred[tx][c] : sred[c][tx];
+
+            if(j < nrhs && row0 + tx < k)
+                srhs[j][tx] = alpha * B[(row0 + tx) * inc_row + j * inc_rhs] - sum;
+            else
+                srhs[j][tx] = T(0);
+        }
+        __syncthreads();
+    }
+
+    // Solve the diagonal block, thread (tx, ty) solves row tx of right-hand side ty
+    T x = ty < NRHS ? srhs[ty][tx] : T(0);
+    for(rocblas_int step = 0; step < DIM_X; step++)
+    {
+        const rocblas_int i = FORWARD ? step : DIM_X - 1 - step;
+        if(tx == i && ty < NRHS)
+        {
+            x *= sA[i][i];
+            sx[ty][i] = x;
+        }
+        __syncthreads();
+
+        if((FORWARD ? tx > i : tx < i) && ty < NRHS)
+            x -= sA[tx][i] * sx[ty][i];
+        __syncthreads();
+    }
+
+    if(ty < nrhs && row0 + tx < k)
+        B[(row0 + tx) * inc_row + ty * inc_rhs] = x;
+
+    // ensure the solved rows are visible before the next block is released
+    __threadfence();
+    __syncthreads();
+    if(tid == 0)
+        w_completed_sec[batch]++;
+
+    __threadfence();
+}
+
+template <typename T, typename U, typename V>
+rocblas_status rocblas_internal_trsm_skinny_launcher(rocblas_handle    handle,
+                                                     rocblas_side      side,
+                                                     rocblas_fill      uplo,
+                                                     rocblas_operation transA,
+                                                     rocblas_diagonal  diag,
+                                                     rocblas_int       m,
+                                                     rocblas_int       n,
+                                                     T                 alpha_h,
+                                                     U                 A,
+                                                     rocblas_stride    offset_A,
+                                                     int64_t           lda,
+                                                     rocblas_stride    stride_A,
+                                                     V                 B,
+                                                     rocblas_stride    offset_B,
+                                                     int64_t           ldb,
+                                                     rocblas_stride    stride_B,
+                                                     rocblas_int       batch_count,
+                                                     rocblas_int*      w_completed_sec)
+{
+    static constexpr rocblas_int DIM_X = ROCBLAS_TRSM_SKINNY_NB;
+    static constexpr rocblas_int DIM_Y = ROCBLAS_TRSM_SKINNY_MAX_RHS;
+    static constexpr rocblas_int NRHS  = ROCBLAS_TRSM_SKINNY_MAX_RHS;
+
+    // On the right, X * op(A) = alpha * B is solved as op(A)**T * X**T = alpha * B**T
+    const bool        left    = side == rocblas_side_left;
+    const bool        no_op   = transA == rocblas_operation_none;
+    const rocblas_int k       = left ? m : n;
+    const rocblas_int nrhs    = left ? n : m;
+    const bool        lower   = (uplo == rocblas_fill_lower) == no_op; // op(A) is lower
+    const bool        forward = left ? lower : !lower;
+    const bool        trans   = left ? !no_op : no_op;
+    const bool        conj_a  = transA == rocblas_operation_conjugate_transpose;
+    const int64_t     inc_row = left ? 1 : ldb;
+    const int64_t     inc_rhs = left ? ldb : 1;
+
+    // The last completed block of each batch, -1 before the first one
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(
+        w_completed_sec, 0xff, sizeof(rocblas_int) * batch_count, handle->get_stream()));
+
+    dim3 grid((k - 1) / DIM_X + 1, batch_count);
+    dim3 threads(DIM_X, DIM_Y);
+
+#define TRSM_SKINNY_LAUNCH(FORWARD_, TRANS_, CONJ_)                                         \
+    ROCBLAS_LAUNCH_KERNEL(                                                                  \
+        (rocblas_trsm_skinny_kernel<DIM_X, DIM_Y, NRHS, FORWARD_, TRANS_, CONJ_, T, U, V>), \
+        grid,                                                                               \
+        threads,                                                                            \
+        0,                                                                                  \
+        handle->get_stream(),                                                               \
+        k,                                                                                  \
+        nrhs,                                                                               \
+        diag == rocblas_diagonal_unit,                                                      \
+        alpha_h,                                                                            \
+        A,                                                                                  \
+        offset_A,                                                                           \
+        lda,                                                                                \
+        stride_A,                                                                           \
+        B,                                                                                  \
+        offset_B,                                                                           \
+        inc_row,                                                                            \
+        inc_rhs,                                                                            \
+        stride_B,                                                                           \
+        w_completed_sec)
+
+    // conjugation only differs from transposition for complex types
+    if(rocblas_is_complex<T> && conj_a)
+    {
+        if constexpr(rocblas_is_complex<T>)
+        {
+            if(forward && trans)
+                TRSM_SKINNY_LAUNCH(true, true, true);
+            else if(forward)
+                TRSM_SKINNY_LAUNCH(true, false, true);
+            else if(trans)
+                TRSM_SKINNY_LAUNCH(false, true, true);
+            else
+                TRSM_SKINNY_LAUNCH(false, false, true);
+        }
+    }
+    else if(forward && trans)
+        TRSM_SKINNY_LAUNCH(true, true, false);
+    else if(forward)
+        TRSM_SKINNY_LAUNCH(true, false, false);
+    else if(trans)
+        TRSM_SKINNY_LAUNCH(false, true, false);
+    else
+        TRSM_SKINNY_LAUNCH(false, false, false);
+#undef TRSM_SKINNY_LAUNCH
+
+    return rocblas_status_success;
+}
+
 //////////////////////////////
 //////////////////////////////
 //////////////////////////////
@@ -3666,9 +3979,10 @@ rocblas_status rocblas_internal_trsm_launcher(rocblas_handle    handle,
             alpha_h = *alpha;
         else
         {
+            RETURN_IF_ROCBLAS_ERROR(handle->check_capturable("device pointer mode alpha of trsm"));
             RETURN_IF_HIP_ERROR(hipMemcpyAsync(
                 &alpha_h, alpha, sizeof(T), hipMemcpyDeviceToHost, handle->get_stream()));
-            RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
+            RETURN_IF_HIP_ERROR(handle->synchronize_stream());
         }
         if(alpha_h == T(0.0))
         {
@@ -3797,6 +4111,29 @@ rocblas_status rocblas_internal_trsm_launcher(rocblas_handle    handle,
                 }
             }
         }
+        else if(w_x_temp && rocblas_internal_trsm_use_skinny(side, m, n))
+        {
+            // few right-hand sides: blocked trsv of all of them, with w_x_temp as the
+            // completion counters of the batches
+            return rocblas_internal_trsm_skinny_launcher(handle,
+                                                         side,
+                                                         uplo,
+                                                         transA,
+                                                         diag,
+                                                         m,
+                                                         n,
+                                                         alpha_h,
+                                                         A,
+                                                         offset_A,
+                                                         lda,
+                                                         stride_A,
+                                                         B,
+                                                         offset_B,
+                                                         ldb,
+                                                         stride_B,
+                                                         batch_count,
+                                                         (rocblas_int*)w_x_temp);
+        }
         else
         {
             // --------------------------------------------------------------
@@ -3808,7 +4145,21 @@ rocblas_status rocblas_internal_trsm_launcher(rocblas_handle    handle,
             const bool  LEFT    = rocblas_side_left == side;
             rocblas_int blksize = rocblas_trsm_blksize<BATCHED, T>(LEFT ? m : n, LEFT ? n : m);
 
-            const bool use_sub = rocblas_internal_trsm_use_substitution(side, m, n, batch_count);
+            const rocblas_trsm_thresholds& thresholds = rocblas_trsm_get_thresholds(handle);
+
+            bool use_sub
+                = rocblas_internal_trsm_use_substitution<T>(thresholds, side, m, n, batch_count);
+
+            // The inversion method needs workspace of the order of m * n. Without it, e.g. when
+            // the device memory of the handle is capped below even the backup size, substitution
+            // solves in place: the diagonal blocks are solved in LDS and the rest of B is updated
+            // by gemm, so only the block size differs from the tuned substitution cases.
+            if(!w_x_temp)
+            {
+                use_sub = true;
+                if(!blksize)
+                    blksize = std::min(k, 64);
+            }
 
             if(use_sub && blksize)
             {
@@ -3855,10 +4206,14 @@ rocblas_status rocblas_internal_trsm_launcher(rocblas_handle    handle,
                 stride_invA = BLOCK * k;
                 if(BATCHED)
                 {
-                    // for w_c_temp, we currently can use the same memory from each batch since
-                    // trtri_batched is naive (since gemm_batched is naive)
-                    RETURN_IF_ROCBLAS_ERROR(setup_batched_array<BLOCK>(
-                        handle->get_stream(), (T*)w_c_temp, 0, (T**)w_x_temparr, batch_count));
+                    // each batch gets its own w_c_temp as the trtri sub-block gemms of all
+                    // batches are launched together
+                    RETURN_IF_ROCBLAS_ERROR(
+                        setup_batched_array<BLOCK>(handle->get_stream(),
+                                                   (T*)w_c_temp,
+                                                   rocblas_trtri_trsm_c_temp_elements<BLOCK>(k),
+                                                   (T**)w_x_temparr,
+                                                   batch_count));
                     RETURN_IF_ROCBLAS_ERROR(setup_batched_array<BLOCK>(
                         handle->get_stream(), (T*)invA, stride_invA, (T**)invAarr, batch_count));
                 }
@@ -3883,7 +4238,13 @@ rocblas_status rocblas_internal_trsm_launcher(rocblas_handle    handle,
             }
 
             const bool use_special = trsm_use_special_kernel<BLOCK, BATCHED, T>(
-                side, transA, m, n, batch_count, supplied_invA_size);
+                side,
+                transA,
+                m,
+                n,
+                batch_count,
+                supplied_invA_size,
+                thresholds.special_mem_limit[rocblas_trsm_precision<T>()]);
             size_t B_chunk_size = optimal_mem ? size_t(m) + size_t(n) - size_t(k) : 1;
             size_t x_temp_els   = use_special ? BLOCK * B_chunk_size : size_t(m) * n;
             if(BATCHED)
@@ -0,0 +1,178 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_trsm_threshold.hpp"
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+namespace
+{
+    using row = rocblas_trsm_thresholds::row;
+
+    constexpr int64_t c_max = rocblas_trsm_max;
+
+    void rocblas_trsm_set(row& r, int64_t s, int64_t d, int64_t c, int64_t z)
+    {
+        r[0] = s;
+        r[1] = d;
+        r[2] = c;
+        r[3] = z;
+    }
+
+    rocblas_trsm_thresholds rocblas_trsm_default_thresholds()
+    {
+        // 128 MB
+        // How much memory to limit usage of regular trsm_left and trsm_right kernels,
+        // when trsm_special can also be used, to increase performance
+        // i.e. reduce memory usage if possible if trying to allocate more than this amount of
+        // memory
+        size_t      mem_limit = 128 * 1024 * 1024;
+        const char* env       = getenv("ROCBLAS_INTERNAL_TRSM_REG_KERNEL_MEM_LIMIT");
+        if(env)
+            sscanf(env, "%zu", &mem_limit);
+        int64_t limit = std::min(int64_t(mem_limit), c_max);
+
+        // from various rocBLAS profiling, the following bounds have been chosen to decide
+        // between substitution method/inversion method
+        rocblas_trsm_thresholds t;
+        rocblas_trsm_set(t.left_small_nrhs_upper, 32, 32, 32, 32);
+        rocblas_trsm_set(t.left_small_batch_lower, 16, 16, 16, 16);
+        rocblas_trsm_set(t.left_small_k_upper, 511, 511, 511, 511);
+        rocblas_trsm_set(t.left_nrhs_upper, 128, 128, 128, 128);
+        rocblas_trsm_set(t.left_k_upper, 340, 340, 340, 340);
+        rocblas_trsm_set(t.right_small_nrhs_upper, 32, 32, 32, 32);
+        rocblas_trsm_set(t.right_small_batch_lower, 16, 16, 16, 16);
+        rocblas_trsm_set(t.right_small_k_upper, 0, 0, 0, 0);
+        rocblas_trsm_set(t.right_nrhs_upper, 128, 128, 128, 128);
+        rocblas_trsm_set(t.right_k_upper, 0, 0, 0, 0);
+        rocblas_trsm_set(t.special_mem_limit, limit, limit, limit, limit);
+        return t;
+    }
+
+    row* rocblas_trsm_find(rocblas_trsm_thresholds& t, const std::string& name)
+    {
+#define ROCBLAS_TRSM_MEMBER(member_) \
+    if(name == #member_)             \
+        return &t.member_;
+
+        ROCBLAS_TRSM_MEMBER(left_small_nrhs_upper)
+        ROCBLAS_TRSM_MEMBER(left_small_batch_lower)
+        ROCBLAS_TRSM_MEMBER(left_small_k_upper)
+        ROCBLAS_TRSM_MEMBER(left_nrhs_upper)
+        ROCBLAS_TRSM_MEMBER(left_k_upper)
+        ROCBLAS_TRSM_MEMBER(right_small_nrhs_upper)
+        ROCBLAS_TRSM_MEMBER(right_small_batch_lower)
+        ROCBLAS_TRSM_MEMBER(right_small_k_upper)
+        ROCBLAS_TRSM_MEMBER(right_nrhs_upper)
+        ROCBLAS_TRSM_MEMBER(right_k_upper)
+        ROCBLAS_TRSM_MEMBER(special_mem_limit)
+
+#undef ROCBLAS_TRSM_MEMBER
+        return nullptr;
+    }
+
+    // Overrides the members listed in the file, leaving t unchanged if the file does not exist.
+    // Lines which cannot be parsed are reported and skipped.
+    void rocblas_trsm_read_thresholds(rocblas_trsm_thresholds& t, const std::string& path)
+    {
+        std::ifstream file(path);
+        std::string   line;
+        for(int line_number = 1; std::getline(file, line); line_number++)
+        {
+            std::istringstream fields(line.substr(0, line.find('#')));
+            std::string        name;
+            if(!(fields >> name))
+                continue;
+
+            row* r = rocblas_trsm_find(t, name);
+            row  values;
+            bool valid = r != nullptr;
+            for(int p = 0; valid && p < rocblas_trsm_precisions; p++)
+            {
+                std::string value;
+                valid = bool(fields >> value);
+                if(valid && value == "-")
+                    values[p] = (*r)[p];
+                else if(valid && value == "max")
+                    values[p] = c_max;
+                else if(valid)
+                {
+                    size_t end = 0;
+                    try
+                    {
+                        values[p] = std::stoll(value, &end);
+                    }
+                    catch(...)
+                    {
+                    }
+                    valid = end == value.size() && values[p] >= 0;
+                }
+            }
+
+            if(valid)
+                std::copy_n(values, rocblas_trsm_precisions, *r);
+            else
+                rocblas_cerr << "rocBLAS warning: ignoring line " << line_number << " of " << path
+                             << std::endl;
+        }
+    }
+} // namespace
+
+const rocblas_trsm_thresholds& rocblas_trsm_get_thresholds(int device)
+{
+    static std::mutex                                             mutex;
+    static std::unordered_map<int, const rocblas_trsm_thresholds> tables;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto                        it = tables.find(device);
+    if(it == tables.end())
+    {
+        rocblas_trsm_thresholds t = rocblas_trsm_default_thresholds();
+
+        const char* path = getenv("ROCBLAS_TRSM_TUNING_PATH");
+        if(path)
+        {
+            hipDeviceProp_t props;
+            if(hipGetDeviceProperties(&props, device) == hipSuccess)
+            {
+                // strip out xnack/ecc from name
+                std::string name(props.gcnArchName);
+                name = name.substr(0, name.find(':'));
+                rocblas_trsm_read_thresholds(t, std::string(path) + "/TrsmTuning_" + name + ".txt");
+            }
+        }
+
+        it = tables.emplace(device, t).first;
+    }
+    return it->second;
+}
+
+const rocblas_trsm_thresholds& rocblas_trsm_get_thresholds(rocblas_handle handle)
+{
+    if(!handle->trsm_thresholds)
+        handle->trsm_thresholds = &rocblas_trsm_get_thresholds(handle->getDevice());
+    return *handle->trsm_thresholds;
+}
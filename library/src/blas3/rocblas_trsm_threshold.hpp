@@ -0,0 +1,112 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#include "handle.hpp"
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+// Tuning of the trsm strategy selection. Each member holds one threshold per precision, indexed
+// by rocblas_trsm_precision, and decides between the substitution kernels
+// (rocblas_trsm_small_substitution), the inversion based trsm_left/trsm_right kernels and the
+// special kernel. The defaults are the values found by profiling on gfx90a and are used for all
+// architectures unless a table is loaded for the architecture of a device from the directory
+// named by ROCBLAS_TRSM_TUNING_PATH, see rocblas_trsm_get_thresholds.
+
+// Precision index of the thresholds: s, d, c, z
+constexpr int rocblas_trsm_precisions = 4;
+
+template <typename T>
+constexpr int rocblas_trsm_precision()
+{
+    return std::is_same_v<T, float>                   ? 0
+           : std::is_same_v<T, double>                ? 1
+           : std::is_same_v<T, rocblas_float_complex> ? 2
+                                                      : 3;
+}
+
+// Threshold larger than any problem size
+constexpr int64_t rocblas_trsm_max = std::numeric_limits<int64_t>::max();
+
+struct rocblas_trsm_thresholds
+{
+    using row = int64_t[rocblas_trsm_precisions];
+
+    // With k the order of A and nrhs the other dimension of B, the substitution kernels are used
+    // on the left side when
+    //     nrhs <= left_small_nrhs_upper && batch_count >= left_small_batch_lower
+    //         && k <= left_small_k_upper
+    // or when
+    //     nrhs > left_small_nrhs_upper && nrhs <= left_nrhs_upper && k <= left_k_upper
+    // and likewise on the right side. The substitution kernels are not used on the right side by
+    // default.
+    row left_small_nrhs_upper;
+    row left_small_batch_lower;
+    row left_small_k_upper;
+    row left_nrhs_upper;
+    row left_k_upper;
+    row right_small_nrhs_upper;
+    row right_small_batch_lower;
+    row right_small_k_upper;
+    row right_nrhs_upper;
+    row right_k_upper;
+
+    // Bytes of workspace above which the special kernel is used instead of trsm_left/trsm_right
+    // for skinny matrices, 128 MB by default or ROCBLAS_INTERNAL_TRSM_REG_KERNEL_MEM_LIMIT
+    row special_mem_limit;
+};
+
+// Thresholds for a device. The table is built once per device from the defaults, overridden by
+// the file TrsmTuning_<arch>.txt (for example TrsmTuning_gfx942.txt) in the directory named by
+// ROCBLAS_TRSM_TUNING_PATH if it exists. Each line of the file is "<member> <s> <d> <c> <z>"
+// with the name of a member above and "max" standing for rocblas_trsm_max and "-" keeping the
+// default. Text following '#' is ignored.
+// clients/benchmarks/trsm_tune/rocblas-trsm-tune.py writes such a file.
+const rocblas_trsm_thresholds& rocblas_trsm_get_thresholds(int device);
+
+// Thresholds for the device of the handle, cached in the handle
+const rocblas_trsm_thresholds& rocblas_trsm_get_thresholds(rocblas_handle handle);
+
+// Whether the substitution kernels are used for the rocblas_trsm_precision p
+inline bool rocblas_trsm_use_substitution(const rocblas_trsm_thresholds& t,
+                                          int                            p,
+                                          rocblas_side                   side,
+                                          int64_t                        m,
+                                          int64_t                        n,
+                                          int64_t                        batch_count)
+{
+    const bool    left = side == rocblas_side_left;
+    const int64_t k    = left ? m : n;
+    const int64_t nrhs = left ? n : m;
+
+    using row              = rocblas_trsm_thresholds::row;
+    const row& small_nrhs  = left ? t.left_small_nrhs_upper : t.right_small_nrhs_upper;
+    const row& small_batch = left ? t.left_small_batch_lower : t.right_small_batch_lower;
+    const row& small_k     = left ? t.left_small_k_upper : t.right_small_k_upper;
+    const row& nrhs_upper  = left ? t.left_nrhs_upper : t.right_nrhs_upper;
+    const row& k_upper     = left ? t.left_k_upper : t.right_k_upper;
+
+    if(nrhs <= small_nrhs[p])
+        return batch_count >= small_batch[p] && k <= small_k[p];
+    return nrhs <= nrhs_upper[p] && k <= k_upper[p];
+}
@@ -0,0 +1,616 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_syrk_herk.hpp"
+#include "rocblas_trsm_kernels.hpp"
+
+template <bool BATCHED, typename T, typename TConstPtr, typename TPtr>
+rocblas_status rocblas_internal_trsm_solve(rocblas_handle    handle,
+                                           rocblas_side      side,
+                                           rocblas_fill      uplo,
+                                           rocblas_operation transA,
+                                           rocblas_diagonal  diag,
+                                           rocblas_int       m,
+                                           rocblas_int       n,
+                                           const T*          alpha,
+                                           TConstPtr         A,
+                                           rocblas_stride    offset_A,
+                                           rocblas_int       lda,
+                                           rocblas_stride    stride_A,
+                                           TPtr              B,
+                                           rocblas_stride    offset_B,
+                                           rocblas_int       ldb,
+                                           rocblas_stride    stride_B,
+                                           rocblas_int       batch_count,
+                                           bool              optimal_mem,
+                                           void*             w_x_temp,
+                                           void*             w_x_temparr,
+                                           void*             invA,
+                                           void*             invAarr)
+{
+    if constexpr(BATCHED)
+        return rocblas_internal_trsm_batched_template<T>(handle,
+                                                         side,
+                                                         uplo,
+                                                         transA,
+                                                         diag,
+                                                         m,
+                                                         n,
+                                                         alpha,
+                                                         A,
+                                                         offset_A,
+                                                         lda,
+                                                         stride_A,
+                                                         B,
+                                                         offset_B,
+                                                         ldb,
+                                                         stride_B,
+                                                         batch_count,
+                                                         optimal_mem,
+                                                         w_x_temp,
+                                                         w_x_temparr,
+                                                         invA,
+                                                         invAarr);
+    else
+        return rocblas_internal_trsm_template<T>(handle,
+                                                 side,
+                                                 uplo,
+                                                 transA,
+                                                 diag,
+                                                 m,
+                                                 n,
+                                                 alpha,
+                                                 A,
+                                                 offset_A,
+                                                 lda,
+                                                 stride_A,
+                                                 B,
+                                                 offset_B,
+                                                 ldb,
+                                                 stride_B,
+                                                 batch_count,
+                                                 optimal_mem,
+                                                 w_x_temp,
+                                                 w_x_temparr,
+                                                 invA,
+                                                 invAarr);
+}
+
+template <bool BATCHED, typename T, typename TConstPtr, typename TPtr>
+rocblas_status rocblas_internal_trsm_gemm_launcher(rocblas_handle    handle,
+                                                   rocblas_side      side,
+                                                   rocblas_fill      uplo,
+                                                   rocblas_operation transA,
+                                                   rocblas_diagonal  diag,
+                                                   rocblas_int       m,
+                                                   rocblas_int       n,
+                                                   rocblas_int       k_update,
+                                                   const T*          alpha,
+                                                   TConstPtr         A,
+                                                   rocblas_stride    offset_A,
+                                                   rocblas_int       lda,
+                                                   rocblas_stride    stride_A,
+                                                   TPtr              B,
+                                                   rocblas_stride    offset_B,
+                                                   rocblas_int       ldb,
+                                                   rocblas_stride    stride_B,
+                                                   TConstPtr         D,
+                                                   rocblas_stride    offset_D,
+                                                   rocblas_int       ldd,
+                                                   rocblas_stride    stride_D,
+                                                   TPtr              C,
+                                                   rocblas_stride    offset_C,
+                                                   rocblas_int       ldc,
+                                                   rocblas_stride    stride_C,
+                                                   rocblas_int       batch_count,
+                                                   bool              optimal_mem,
+                                                   void*             w_x_temp,
+                                                   void*             w_x_temparr,
+                                                   void*             invA,
+                                                   void*             invAarr)
+{
+    if(!m || !n || !batch_count)
+        return rocblas_status_success;
+
+    RETURN_IF_ROCBLAS_ERROR((rocblas_internal_trsm_solve<BATCHED, T>(handle,
+                                                                     side,
+                                                                     uplo,
+                                                                     transA,
+                                                                     diag,
+                                                                     m,
+                                                                     n,
+                                                                     alpha,
+                                                                     A,
+                                                                     offset_A,
+                                                                     lda,
+                                                                     stride_A,
+                                                                     B,
+                                                                     offset_B,
+                                                                     ldb,
+                                                                     stride_B,
+                                                                     batch_count,
+                                                                     optimal_mem,
+                                                                     w_x_temp,
+                                                                     w_x_temparr,
+                                                                     invA,
+                                                                     invAarr)));
+
+    if(!k_update)
+        return rocblas_status_success;
+
+    // The update coefficients are host constants whatever the pointer mode of alpha
+    auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+    TConstPtr X = B;
+    if(side == rocblas_side_left)
+        return rocblas_internal_gemm<BATCHED>(handle,
+                                              rocblas_operation_none,
+                                              rocblas_operation_none,
+                                              k_update,
+                                              n,
+                                              m,
+                                              &alpha_negative_one<T>,
+                                              D,
+                                              offset_D,
+                                              ldd,
+                                              stride_D,
+                                              X,
+                                              offset_B,
+                                              ldb,
+                                              stride_B,
+                                              &beta_1<T>,
+                                              C,
+                                              offset_C,
+                                              ldc,
+                                              stride_C,
+                                              batch_count);
+    else
+        return rocblas_internal_gemm<BATCHED>(handle,
+                                              rocblas_operation_none,
+                                              rocblas_operation_none,
+                                              m,
+                                              k_update,
+                                              n,
+                                              &alpha_negative_one<T>,
+                                              X,
+                                              offset_B,
+                                              ldb,
+                                              stride_B,
+                                              D,
+                                              offset_D,
+                                              ldd,
+                                              stride_D,
+                                              &beta_1<T>,
+                                              C,
+                                              offset_C,
+                                              ldc,
+                                              stride_C,
+                                              batch_count);
+}
+
+template <bool BATCHED, typename T, typename TConstPtr, typename TPtr>
+rocblas_status rocblas_internal_trsm_syrk_launcher(rocblas_handle   handle,
+                                                   rocblas_fill     uplo,
+                                                   rocblas_diagonal diag,
+                                                   rocblas_int      n,
+                                                   rocblas_int      m,
+                                                   TConstPtr        A,
+                                                   rocblas_stride   offset_A,
+                                                   rocblas_int      lda,
+                                                   rocblas_stride   stride_A,
+                                                   TPtr             B,
+                                                   rocblas_stride   offset_B,
+                                                   rocblas_int      ldb,
+                                                   rocblas_stride   stride_B,
+                                                   TPtr             C,
+                                                   rocblas_stride   offset_C,
+                                                   rocblas_int      ldc,
+                                                   rocblas_stride   stride_C,
+                                                   rocblas_int      batch_count,
+                                                   bool             optimal_mem,
+                                                   void*            w_x_temp,
+                                                   void*            w_x_temparr,
+                                                   void*            invA,
+                                                   void*            invAarr)
+{
+    if(!m || !n || !batch_count)
+        return rocblas_status_success;
+
+    // Every coefficient is a host constant
+    auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+    const bool              lower = uplo == rocblas_fill_lower;
+    const rocblas_operation trans = rocblas_is_complex<T> ? rocblas_operation_conjugate_transpose
+                                                          : rocblas_operation_transpose;
+
+    // lower: B := B * A**-H, upper: B := A**-H * B
+    RETURN_IF_ROCBLAS_ERROR((rocblas_internal_trsm_solve<BATCHED, T>(
+        handle,
+        lower ? rocblas_side_right : rocblas_side_left,
+        uplo,
+        trans,
+        diag,
+        lower ? m : n,
+        lower ? n : m,
+        &alpha_1<T>,
+        A,
+        offset_A,
+        lda,
+        stride_A,
+        B,
+        offset_B,
+        ldb,
+        stride_B,
+        batch_count,
+        optimal_mem,
+        w_x_temp,
+        w_x_temparr,
+        invA,
+        invAarr)));
+
+    // lower: C := C - B * B**H, upper: C := C - B**H * B
+    TConstPtr               X       = B;
+    const rocblas_operation trans_X = lower ? rocblas_operation_none : trans;
+    if constexpr(rocblas_is_complex<T>)
+    {
+        if constexpr(BATCHED)
+            return rocblas_internal_herk_batched_template<T>(handle,
+                                                             uplo,
+                                                             trans_X,
+                                                             m,
+                                                             n,
+                                                             &alpha_negative_one<real_t<T>>,
+                                                             X,
+                                                             offset_B,
+                                                             ldb,
+                                                             stride_B,
+                                                             &beta_1<real_t<T>>,
+                                                             C,
+                                                             offset_C,
+                                                             ldc,
+                                                             stride_C,
+                                                             batch_count);
+        else
+            return rocblas_internal_herk_template<T>(handle,
+                                                     uplo,
+                                                     trans_X,
+                                                     m,
+                                                     n,
+                                                     &alpha_negative_one<real_t<T>>,
+                                                     X,
+                                                     offset_B,
+                                                     ldb,
+                                                     stride_B,
+                                                     &beta_1<real_t<T>>,
+                                                     C,
+                                                     offset_C,
+                                                     ldc,
+                                                     stride_C,
+                                                     batch_count);
+    }
+    else
+    {
+        if constexpr(BATCHED)
+            return rocblas_internal_syrk_batched_template<T>(handle,
+                                                             uplo,
+                                                             trans_X,
+                                                             m,
+                                                             n,
+                                                             &alpha_negative_one<T>,
+                                                             X,
+                                                             offset_B,
+                                                             ldb,
+                                                             stride_B,
+                                                             &beta_1<T>,
+                                                             C,
+                                                             offset_C,
+                                                             ldc,
+                                                             stride_C,
+                                                             batch_count);
+        else
+            return rocblas_internal_syrk_template<T>(handle,
+                                                     uplo,
+                                                     trans_X,
+                                                     m,
+                                                     n,
+                                                     &alpha_negative_one<T>,
+                                                     X,
+                                                     offset_B,
+                                                     ldb,
+                                                     stride_B,
+                                                     &beta_1<T>,
+                                                     C,
+                                                     offset_C,
+                                                     ldc,
+                                                     stride_C,
+                                                     batch_count);
+    }
+}
+
+#define TRSM_GEMM_TEMPLATE_PARAMS                                                               \
+    handle, side, uplo, transA, diag, m, n, k_update, alpha, A, offset_A, lda, stride_A, B,     \
+        offset_B, ldb, stride_B, D, offset_D, ldd, stride_D, C, offset_C, ldc, stride_C,        \
+        batch_count, optimal_mem, w_x_temp, w_x_temparr, invA, invAarr
+
+#define TRSM_SYRK_TEMPLATE_PARAMS                                                               \
+    handle, uplo, diag, n, m, A, offset_A, lda, stride_A, B, offset_B, ldb, stride_B, C,        \
+        offset_C, ldc, stride_C, batch_count, optimal_mem, w_x_temp, w_x_temparr, invA, invAarr
+
+template <typename T>
+ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
+    rocblas_internal_trsm_gemm_template(rocblas_handle    handle,
+                                        rocblas_side      side,
+                                        rocblas_fill      uplo,
+                                        rocblas_operation transA,
+                                        rocblas_diagonal  diag,
+                                        rocblas_int       m,
+                                        rocblas_int       n,
+                                        rocblas_int       k_update,
+                                        const T*          alpha,
+                                        const T*          A,
+                                        rocblas_stride    offset_A,
+                                        rocblas_int       lda,
+                                        rocblas_stride    stride_A,
+                                        T*                B,
+                                        rocblas_stride    offset_B,
+                                        rocblas_int       ldb,
+                                        rocblas_stride    stride_B,
+                                        const T*          D,
+                                        rocblas_stride    offset_D,
+                                        rocblas_int       ldd,
+                                        rocblas_stride    stride_D,
+                                        T*                C,
+                                        rocblas_stride    offset_C,
+                                        rocblas_int       ldc,
+                                        rocblas_stride    stride_C,
+                                        rocblas_int       batch_count,
+                                        bool              optimal_mem,
+                                        void*             w_x_temp,
+                                        void*             w_x_temparr,
+                                        void*             invA,
+                                        void*             invAarr)
+{
+    return rocblas_internal_trsm_gemm_launcher<false, T>(TRSM_GEMM_TEMPLATE_PARAMS);
+}
+
+template <typename T>
+ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
+    rocblas_internal_trsm_gemm_batched_template(rocblas_handle    handle,
+                                                rocblas_side      side,
+                                                rocblas_fill      uplo,
+                                                rocblas_operation transA,
+                                                rocblas_diagonal  diag,
+                                                rocblas_int       m,
+                                                rocblas_int       n,
+                                                rocblas_int       k_update,
+                                                const T*          alpha,
+                                                const T* const*   A,
+                                                rocblas_stride    offset_A,
+                                                rocblas_int       lda,
+                                                rocblas_stride    stride_A,
+                                                T* const*         B,
+                                                rocblas_stride    offset_B,
+                                                rocblas_int       ldb,
+                                                rocblas_stride    stride_B,
+                                                const T* const*   D,
+                                                rocblas_stride    offset_D,
+                                                rocblas_int       ldd,
+                                                rocblas_stride    stride_D,
+                                                T* const*         C,
+                                                rocblas_stride    offset_C,
+                                                rocblas_int       ldc,
+                                                rocblas_stride    stride_C,
+                                                rocblas_int       batch_count,
+                                                bool              optimal_mem,
+                                                void*             w_x_temp,
+                                                void*             w_x_temparr,
+                                                void*             invA,
+                                                void*             invAarr)
+{
+    return rocblas_internal_trsm_gemm_launcher<true, T>(TRSM_GEMM_TEMPLATE_PARAMS);
+}
+
+template <typename T>
+ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
+    rocblas_internal_trsm_syrk_template(rocblas_handle   handle,
+                                        rocblas_fill     uplo,
+                                        rocblas_diagonal diag,
+                                        rocblas_int      n,
+                                        rocblas_int      m,
+                                        const T*         A,
+                                        rocblas_stride   offset_A,
+                                        rocblas_int      lda,
+                                        rocblas_stride   stride_A,
+                                        T*               B,
+                                        rocblas_stride   offset_B,
+                                        rocblas_int      ldb,
+                                        rocblas_stride   stride_B,
+                                        T*               C,
+                                        rocblas_stride   offset_C,
+                                        rocblas_int      ldc,
+                                        rocblas_stride   stride_C,
+                                        rocblas_int      batch_count,
+                                        bool             optimal_mem,
+                                        void*            w_x_temp,
+                                        void*            w_x_temparr,
+                                        void*            invA,
+                                        void*            invAarr)
+{
+    return rocblas_internal_trsm_syrk_launcher<false, T>(TRSM_SYRK_TEMPLATE_PARAMS);
+}
+
+template <typename T>
+ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
+    rocblas_internal_trsm_syrk_batched_template(rocblas_handle   handle,
+                                                rocblas_fill     uplo,
+                                                rocblas_diagonal diag,
+                                                rocblas_int      n,
+                                                rocblas_int      m,
+                                                const T* const*  A,
+                                                rocblas_stride   offset_A,
+                                                rocblas_int      lda,
+                                                rocblas_stride   stride_A,
+                                                T* const*        B,
+                                                rocblas_stride   offset_B,
+                                                rocblas_int      ldb,
+                                                rocblas_stride   stride_B,
+                                                T* const*        C,
+                                                rocblas_stride   offset_C,
+                                                rocblas_int      ldc,
+                                                rocblas_stride   stride_C,
+                                                rocblas_int      batch_count,
+                                                bool             optimal_mem,
+                                                void*            w_x_temp,
+                                                void*            w_x_temparr,
+                                                void*            invA,
+                                                void*            invAarr)
+{
+    return rocblas_internal_trsm_syrk_launcher<true, T>(TRSM_SYRK_TEMPLATE_PARAMS);
+}
+
+#undef TRSM_SYRK_TEMPLATE_PARAMS
+#undef TRSM_GEMM_TEMPLATE_PARAMS
+
+#ifdef INSTANTIATE_TRSM_UPDATE_TEMPLATE
+#error INSTANTIATE_TRSM_UPDATE_TEMPLATE already defined
+#endif
+
+#define INSTANTIATE_TRSM_UPDATE_TEMPLATE(T_)                                                   \
+    template ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status                                   \
+        rocblas_internal_trsm_gemm_template<T_>(rocblas_handle    handle,                      \
+                                                rocblas_side      side,                        \
+                                                rocblas_fill      uplo,                        \
+                                                rocblas_operation transA,                      \
+                                                rocblas_diagonal  diag,                        \
+                                                rocblas_int       m,                           \
+                                                rocblas_int       n,                           \
+                                                rocblas_int       k_update,                    \
+                                                const T_*         alpha,                       \
+                                                const T_*         A,                           \
+                                                rocblas_stride    offset_A,                    \
+                                                rocblas_int       lda,                         \
+                                                rocblas_stride    stride_A,                    \
+                                                T_*               B,                           \
+                                                rocblas_stride    offset_B,                    \
+                                                rocblas_int       ldb,                         \
+                                                rocblas_stride    stride_B,                    \
+                                                const T_*         D,                           \
+                                                rocblas_stride    offset_D,                    \
+                                                rocblas_int       ldd,                         \
+                                                rocblas_stride    stride_D,                    \
+                                                T_*               C,                           \
+                                                rocblas_stride    offset_C,                    \
+                                                rocblas_int       ldc,                         \
+                                                rocblas_stride    stride_C,                    \
+                                                rocblas_int       batch_count,                 \
+                                                bool              optimal_mem,                 \
+                                                void*             w_x_temp,                    \
+                                                void*             w_x_temparr,                 \
+                                                void*             invA,                        \
+                                                void*             invAarr);                    \
+    template ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status                                   \
+        rocblas_internal_trsm_gemm_batched_template<T_>(rocblas_handle    handle,              \
+                                                        rocblas_side      side,                \
+                                                        rocblas_fill      uplo,                \
+                                                        rocblas_operation transA,              \
+                                                        rocblas_diagonal  diag,                \
+                                                        rocblas_int       m,                   \
+                                                        rocblas_int       n,                   \
+                                                        rocblas_int       k_update,            \
+                                                        const T_*         alpha,               \
+                                                        const T_* const*  A,                   \
+                                                        rocblas_stride    offset_A,            \
+                                                        rocblas_int       lda,                 \
+                                                        rocblas_stride    stride_A,            \
+                                                        T_* const*        B,                   \
+                                                        rocblas_stride    offset_B,            \
+                                                        rocblas_int       ldb,                 \
+                                                        rocblas_stride    stride_B,            \
+                                                        const T_* const*  D,                   \
+                                                        rocblas_stride    offset_D,            \
+                                                        rocblas_int       ldd,                 \
+                                                        rocblas_stride    stride_D,            \
+                                                        T_* const*        C,                   \
+                                                        rocblas_stride    offset_C,            \
+                                                        rocblas_int       ldc,                 \
+                                                        rocblas_stride    stride_C,            \
+                                                        rocblas_int       batch_count,         \
+                                                        bool              optimal_mem,         \
+                                                        void*             w_x_temp,            \
+                                                        void*             w_x_temparr,         \
+                                                        void*             invA,                \
+                                                        void*             invAarr);            \
+    template ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status                                   \
+        rocblas_internal_trsm_syrk_template<T_>(rocblas_handle   handle,                       \
+                                                rocblas_fill     uplo,                         \
+                                                rocblas_diagonal diag,                         \
+                                                rocblas_int      n,                            \
+                                                rocblas_int      m,                            \
+                                                const T_*        A,                            \
+                                                rocblas_stride   offset_A,                     \
+                                                rocblas_int      lda,                          \
+                                                rocblas_stride   stride_A,                     \
+                                                T_*              B,                            \
+                                                rocblas_stride   offset_B,                     \
+                                                rocblas_int      ldb,                          \
+                                                rocblas_stride   stride_B,                     \
+                                                T_*              C,                            \
+                                                rocblas_stride   offset_C,                     \
+                                                rocblas_int      ldc,                          \
+                                                rocblas_stride   stride_C,                     \
+                                                rocblas_int      batch_count,                  \
+                                                bool             optimal_mem,                  \
+                                                void*            w_x_temp,                     \
+                                                void*            w_x_temparr,                  \
+                                                void*            invA,                         \
+                                                void*            invAarr);                     \
+    template ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status                                   \
+        rocblas_internal_trsm_syrk_batched_template<T_>(rocblas_handle   handle,               \
+                                                        rocblas_fill     uplo,                 \
+                                                        rocblas_diagonal diag,                 \
+                                                        rocblas_int      n,                    \
+                                                        rocblas_int      m,                    \
+                                                        const T_* const* A,                    \
+                                                        rocblas_stride   offset_A,             \
+                                                        rocblas_int      lda,                  \
+                                                        rocblas_stride   stride_A,             \
+                                                        T_* const*       B,                    \
+                                                        rocblas_stride   offset_B,             \
+                                                        rocblas_int      ldb,                  \
+                                                        rocblas_stride   stride_B,             \
+                                                        T_* const*       C,                    \
+                                                        rocblas_stride   offset_C,             \
+                                                        rocblas_int      ldc,                  \
+                                                        rocblas_stride   stride_C,             \
+                                                        rocblas_int      batch_count,          \
+                                                        bool             optimal_mem,          \
+                                                        void*            w_x_temp,             \
+                                                        void*            w_x_temparr,          \
+                                                        void*            invA,                 \
+                                                        void*            invAarr);
+
+INSTANTIATE_TRSM_UPDATE_TEMPLATE(float)
+INSTANTIATE_TRSM_UPDATE_TEMPLATE(double)
+INSTANTIATE_TRSM_UPDATE_TEMPLATE(rocblas_float_complex)
+INSTANTIATE_TRSM_UPDATE_TEMPLATE(rocblas_double_complex)
+
+#undef INSTANTIATE_TRSM_UPDATE_TEMPLATE
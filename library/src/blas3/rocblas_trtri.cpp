@@ -51,6 +51,10 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        // row major inv(A) is column major inv(A^T), of the other triangle, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+            uplo = rocblas_row_major_fill(uplo);
+
         size_t size = rocblas_internal_trtri_temp_elements(n, 1) * sizeof(T);
         if(handle->is_device_memory_size_query())
         {
@@ -62,10 +66,12 @@ namespace
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
 
+        rocblas_api_scope api_scope(handle, rocblas_trtri_name<T>);
+
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle, rocblas_trtri_name<T>, uplo, diag, n, A, lda, invA, ldinvA);
 
-        if(layer_mode & rocblas_layer_mode_log_profile)
+        if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             log_profile(handle,
                         rocblas_trtri_name<T>,
                         "uplo",
@@ -26,6 +26,7 @@
 #include "handle.hpp"
 #include "rocblas_block_sizes.h"
 #include "rocblas_gemm.hpp"
+#include "rocblas_trmm.hpp"
 
 template <typename U, typename V>
 inline rocblas_status rocblas_trtri_arg_check(rocblas_handle   handle,
@@ -603,71 +604,83 @@ rocblas_status rocblas_trtri_gemm_block(rocblas_handle handle,
                                         rocblas_stride offset_invAg2c = 0,
                                         rocblas_stride offset_C       = 0)
 {
-    std::unique_ptr<T*[]> host_A;
-    std::unique_ptr<T*[]> host_invAg1;
-    std::unique_ptr<T*[]> host_invAg2a;
-    std::unique_ptr<T*[]> host_invAg2c;
-    std::unique_ptr<T*[]> host_C;
-
-    if(BATCHED)
-    {
-        host_A       = std::make_unique<T*[]>(batch_count);
-        host_invAg1  = std::make_unique<T*[]>(batch_count);
-        host_invAg2a = std::make_unique<T*[]>(batch_count);
-        host_invAg2c = std::make_unique<T*[]>(batch_count);
-        host_C       = std::make_unique<T*[]>(batch_count);
-
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-            &host_A[0], A, batch_count * sizeof(T*), hipMemcpyDeviceToHost, handle->get_stream()));
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(&host_invAg1[0],
-                                           invAg1,
-                                           batch_count * sizeof(T*),
-                                           hipMemcpyDeviceToHost,
-                                           handle->get_stream()));
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(&host_invAg2a[0],
-                                           invAg2a,
-                                           batch_count * sizeof(T*),
-                                           hipMemcpyDeviceToHost,
-                                           handle->get_stream()));
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(&host_invAg2c[0],
-                                           invAg2c,
-                                           batch_count * sizeof(T*),
-                                           hipMemcpyDeviceToHost,
-                                           handle->get_stream()));
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-            &host_C[0], C, batch_count * sizeof(T*), hipMemcpyDeviceToHost, handle->get_stream()));
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
-    }
-
     rocblas_status status       = rocblas_status_success;
     static const T one          = T(1);
     static const T zero         = T(0);
     static const T negative_one = T(-1);
 
+    if constexpr(BATCHED)
+    {
+        // The pointer arrays stay on the device: each diagonal sub-block is reached by adding
+        // its sub-block offset to the per-batch offsets, and all batches are handled by one
+        // batched gemm. This avoids a blocking copy of the pointer arrays to the host, so the
+        // pipeline stays stream ordered and can be captured into a graph.
+        for(int s = 0; s < sub_blocks; s++)
+        {
+            // first batched gemm compute C = A21*invA11 (lower) or C = A12*invA22 (upper)
+            status = rocblas_internal_gemm<true>(handle,
+                                                 rocblas_operation_none,
+                                                 rocblas_operation_none,
+                                                 M,
+                                                 N,
+                                                 N,
+                                                 &one,
+                                                 A,
+                                                 offset_A + s * sub_stride_A,
+                                                 ld_A,
+                                                 stride_A,
+                                                 invAg1,
+                                                 offset_invAg1 + s * sub_stride_invA,
+                                                 ld_invA,
+                                                 stride_invA,
+                                                 &zero,
+                                                 C,
+                                                 offset_C + s * sub_stride_C,
+                                                 ld_C,
+                                                 stride_C,
+                                                 batch_count);
+            if(status != rocblas_status_success)
+                break;
+
+            // second batched gemm compute  invA21 = -invA22 * C (lower) or invA12 = -invA11*C (upper)
+            status = rocblas_internal_gemm<true>(handle,
+                                                 rocblas_operation_none,
+                                                 rocblas_operation_none,
+                                                 M,
+                                                 N,
+                                                 M,
+                                                 &negative_one,
+                                                 invAg2a,
+                                                 offset_invAg2a + s * sub_stride_invA,
+                                                 ld_invA,
+                                                 stride_invA,
+                                                 (U)C,
+                                                 offset_C + s * sub_stride_C,
+                                                 ld_C,
+                                                 stride_C,
+                                                 &zero,
+                                                 invAg2c,
+                                                 offset_invAg2c + s * sub_stride_invA,
+                                                 ld_invA,
+                                                 stride_invA,
+                                                 batch_count);
+            if(status != rocblas_status_success)
+                break;
+        }
+
+        return status;
+    }
+
     // first batched gemm compute C = A21*invA11 (lower) or C = A12*invA22 (upper)
     // distance between each invA11 or invA22 is sub_stride_invA, sub_stride_A for each A21 or A12, C
     // of size IB * IB
     for(int b = 0; b < batch_count; b++)
     {
-        const T *aptr, *invAg1ptr, *invAg2ptr;
-        T *      cptr, *invAg2cptr;
-
-        if(BATCHED)
-        {
-            aptr       = load_ptr_batch(&host_A[0], b, offset_A, stride_A);
-            invAg1ptr  = load_ptr_batch(&host_invAg1[0], b, offset_invAg1, stride_invA);
-            invAg2ptr  = load_ptr_batch(&host_invAg2a[0], b, offset_invAg2a, stride_invA);
-            cptr       = load_ptr_batch(&host_C[0], b, offset_C, stride_C);
-            invAg2cptr = load_ptr_batch(&host_invAg2c[0], b, offset_invAg2c, stride_invA);
-        }
-        else
-        {
-            aptr       = load_ptr_batch(A, b, offset_A, stride_A);
-            invAg1ptr  = load_ptr_batch(invAg1, b, offset_invAg1, stride_invA);
-            invAg2ptr  = load_ptr_batch(invAg2a, b, offset_invAg2a, stride_invA);
-            cptr       = load_ptr_batch(C, b, offset_C, stride_C);
-            invAg2cptr = load_ptr_batch(invAg2c, b, offset_invAg2c, stride_invA);
-        }
+        const T* aptr      = load_ptr_batch(A, b, offset_A, stride_A);
+        const T* invAg1ptr = load_ptr_batch(invAg1, b, offset_invAg1, stride_invA);
+        const T* invAg2ptr = load_ptr_batch(invAg2a, b, offset_invAg2a, stride_invA);
+        T*       cptr      = load_ptr_batch(C, b, offset_C, stride_C);
+        T*       invAg2cptr = load_ptr_batch(invAg2c, b, offset_invAg2c, stride_invA);
 
         // We are naively iterating through the batches, and uses sub-batches in a strided_batched style.
         status = rocblas_internal_gemm<false>(handle,
@@ -1091,6 +1104,180 @@ rocblas_status rocblas_trtri_large(rocblas_handle   handle,
     return rocblas_status_success;
 }
 
+// Above this size trtri recurses on halves of the matrix, so that each level computes its
+// off-diagonal block with two large gemms instead of many launches of doubling block sizes
+constexpr rocblas_int c_trtri_recursive_min_n = 4096;
+
+// Size of the leading diagonal block of a recursion step. Powers of two need no workspace in
+// rocblas_trtri_large, so only the trailing block can need any.
+inline rocblas_int rocblas_trtri_recursive_split(rocblas_int n)
+{
+    return rocblas_is_po2(n) ? n / 2 : rocblas_previous_po2(n);
+}
+
+template <rocblas_int NB, bool BATCHED, typename T, typename U, typename V>
+rocblas_status rocblas_trtri_recursive(rocblas_handle   handle,
+                                       rocblas_fill     uplo,
+                                       rocblas_diagonal diag,
+                                       rocblas_int      n,
+                                       U                A,
+                                       rocblas_stride   offset_Ain,
+                                       rocblas_int      lda,
+                                       rocblas_stride   stride_A,
+                                       rocblas_stride   sub_stride_Ain,
+                                       V                invA,
+                                       rocblas_stride   offset_invAin,
+                                       rocblas_int      ldinvA,
+                                       rocblas_stride   stride_invA,
+                                       rocblas_stride   sub_stride_invAin,
+                                       rocblas_int      batch_count,
+                                       rocblas_int      sub_batch_count,
+                                       V                w_C_tmp)
+{
+    if(n <= c_trtri_recursive_min_n)
+        return rocblas_trtri_large<NB, BATCHED, T>(handle,
+                                                   uplo,
+                                                   diag,
+                                                   n,
+                                                   A,
+                                                   offset_Ain,
+                                                   lda,
+                                                   stride_A,
+                                                   sub_stride_Ain,
+                                                   invA,
+                                                   offset_invAin,
+                                                   ldinvA,
+                                                   stride_invA,
+                                                   sub_stride_invAin,
+                                                   batch_count,
+                                                   sub_batch_count,
+                                                   w_C_tmp);
+
+    static const T one          = T(1);
+    static const T zero         = T(0);
+    static const T negative_one = T(-1);
+
+    auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+    rocblas_int n1    = rocblas_trtri_recursive_split(n);
+    rocblas_int n2    = n - n1;
+    bool        lower = uplo == rocblas_fill_lower;
+
+    // offsets of the trailing diagonal block, the off-diagonal block of A, and the block in the
+    // opposite triangle of invA used as the workspace W of the step
+    rocblas_stride diag_A     = n1 + n1 * rocblas_stride(lda);
+    rocblas_stride diag_invA  = n1 + n1 * rocblas_stride(ldinvA);
+    rocblas_stride off_A      = lower ? n1 : n1 * rocblas_stride(lda);
+    rocblas_stride off_invA   = lower ? n1 : n1 * rocblas_stride(ldinvA);
+    rocblas_stride off_W      = lower ? n1 * rocblas_stride(ldinvA) : n1;
+    rocblas_int    rows_W     = lower ? n1 : n2;
+    rocblas_int    cols_W     = lower ? n2 : n1;
+    rocblas_stride off_first  = lower ? 0 : diag_invA; // block multiplied by A21 or A12
+    rocblas_stride off_second = lower ? diag_invA : 0;
+    rocblas_int    k_first    = lower ? n1 : n2;
+    rocblas_int    k_second   = lower ? n2 : n1;
+
+    for(rocblas_int s = 0; s < sub_batch_count; s++)
+    {
+        rocblas_stride o_A    = offset_Ain + s * sub_stride_Ain;
+        rocblas_stride o_invA = offset_invAin + s * sub_stride_invAin;
+
+        // invert the diagonal blocks
+        RETURN_IF_ROCBLAS_ERROR((rocblas_trtri_recursive<NB, BATCHED, T>(handle,
+                                                                         uplo,
+                                                                         diag,
+                                                                         n1,
+                                                                         A,
+                                                                         o_A,
+                                                                         lda,
+                                                                         stride_A,
+                                                                         0,
+                                                                         invA,
+                                                                         o_invA,
+                                                                         ldinvA,
+                                                                         stride_invA,
+                                                                         0,
+                                                                         batch_count,
+                                                                         1,
+                                                                         w_C_tmp)));
+        RETURN_IF_ROCBLAS_ERROR((rocblas_trtri_recursive<NB, BATCHED, T>(handle,
+                                                                         uplo,
+                                                                         diag,
+                                                                         n2,
+                                                                         A,
+                                                                         o_A + diag_A,
+                                                                         lda,
+                                                                         stride_A,
+                                                                         0,
+                                                                         invA,
+                                                                         o_invA + diag_invA,
+                                                                         ldinvA,
+                                                                         stride_invA,
+                                                                         0,
+                                                                         batch_count,
+                                                                         1,
+                                                                         w_C_tmp)));
+
+        // lower: W = (A21 * invA11)^T = invA11^T * A21^T, invA21 = -invA22 * W^T
+        // upper: W = (A12 * invA22)^T = invA22^T * A12^T, invA12 = -invA11 * W^T
+        // W is stored transposed so that it fits in the opposite triangle of invA
+        RETURN_IF_ROCBLAS_ERROR(rocblas_internal_gemm<BATCHED>(handle,
+                                                               rocblas_operation_transpose,
+                                                               rocblas_operation_transpose,
+                                                               rows_W,
+                                                               cols_W,
+                                                               k_first,
+                                                               &one,
+                                                               (U)invA,
+                                                               o_invA + off_first,
+                                                               ldinvA,
+                                                               stride_invA,
+                                                               A,
+                                                               o_A + off_A,
+                                                               lda,
+                                                               stride_A,
+                                                               &zero,
+                                                               invA,
+                                                               o_invA + off_W,
+                                                               ldinvA,
+                                                               stride_invA,
+                                                               batch_count));
+
+        RETURN_IF_ROCBLAS_ERROR(rocblas_internal_gemm<BATCHED>(handle,
+                                                               rocblas_operation_none,
+                                                               rocblas_operation_transpose,
+                                                               cols_W,
+                                                               rows_W,
+                                                               k_second,
+                                                               &negative_one,
+                                                               (U)invA,
+                                                               o_invA + off_second,
+                                                               ldinvA,
+                                                               stride_invA,
+                                                               (U)invA,
+                                                               o_invA + off_W,
+                                                               ldinvA,
+                                                               stride_invA,
+                                                               &zero,
+                                                               invA,
+                                                               o_invA + off_invA,
+                                                               ldinvA,
+                                                               stride_invA,
+                                                               batch_count));
+
+        // the opposite triangle of invA is zero, as the gemms of the parent step rely on
+        if constexpr(BATCHED)
+            RETURN_IF_ROCBLAS_ERROR(rocblas_set_matrix_zero_if_alpha_zero_template(
+                handle, rows_W, cols_W, &zero, 0, invA, ldinvA, o_invA + off_W, batch_count));
+        else
+            RETURN_IF_ROCBLAS_ERROR(rocblas_set_matrix_zero_if_alpha_zero_template(
+                handle, rows_W, cols_W, &zero, 0, invA + o_invA + off_W, ldinvA, stride_invA,
+                batch_count));
+    }
+
+    return rocblas_status_success;
+}
+
 /**
  * @brief internal trtri template. Can be used with regular trtri or trtri_strided_batched.
  *        Used by rocSOLVER, includes offset params for arrays.
@@ -53,6 +53,10 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        // row major inv(A) is column major inv(A^T), of the other triangle, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+            uplo = rocblas_row_major_fill(uplo);
+
         // Compute the optimal size for temporary device memory
         size_t els   = rocblas_internal_trtri_temp_elements(n, 1);
         size_t size  = els * batch_count * sizeof(T);
@@ -67,11 +71,13 @@ namespace
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
 
+        rocblas_api_scope api_scope(handle, rocblas_trtri_name<T>);
+
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(
                 handle, rocblas_trtri_name<T>, uplo, diag, n, A, lda, invA, ldinvA, batch_count);
 
-        if(layer_mode & rocblas_layer_mode_log_profile)
+        if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             log_profile(handle,
                         rocblas_trtri_name<T>,
                         "uplo",
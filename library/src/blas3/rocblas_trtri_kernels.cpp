@@ -22,6 +22,7 @@
 
 #include "check_numerics_matrix.hpp"
 #include "rocblas_trtri.hpp"
+#include "roctx_ranges.hpp"
 
 template <rocblas_int NB, bool BATCHED, typename T, typename U, typename V>
 rocblas_status rocblas_internal_trtri_template(rocblas_handle   handle,
@@ -45,6 +46,9 @@ rocblas_status rocblas_internal_trtri_template(rocblas_handle   handle,
     if(!n || !sub_batch_count)
         return rocblas_status_success;
 
+    rocblas_roctx_phase roctx_phase(
+        handle, "trtri", "N", n, "lda", lda, "batch_count", batch_count);
+
     if(n <= NB)
     {
         return rocblas_trtri_small<NB, T>(handle,
@@ -66,28 +70,28 @@ rocblas_status rocblas_internal_trtri_template(rocblas_handle   handle,
     }
     else
     {
-        return rocblas_trtri_large<NB, BATCHED, T>(handle,
-                                                   uplo,
-                                                   diag,
-                                                   n,
-                                                   A,
-                                                   offset_A,
-                                                   lda,
-                                                   stride_A,
-                                                   sub_stride_A,
-                                                   invA,
-                                                   offset_invA,
-                                                   ldinvA,
-                                                   stride_invA,
-                                                   sub_stride_invA,
-                                                   batch_count,
-                                                   sub_batch_count,
-                                                   w_C_tmp);
+        return rocblas_trtri_recursive<NB, BATCHED, T>(handle,
+                                                       uplo,
+                                                       diag,
+                                                       n,
+                                                       A,
+                                                       offset_A,
+                                                       lda,
+                                                       stride_A,
+                                                       sub_stride_A,
+                                                       invA,
+                                                       offset_invA,
+                                                       ldinvA,
+                                                       stride_invA,
+                                                       sub_stride_invA,
+                                                       batch_count,
+                                                       sub_batch_count,
+                                                       w_C_tmp);
     }
 }
 
-ROCBLAS_INTERNAL_EXPORT_NOINLINE size_t
-    rocblas_internal_trtri_temp_elements(rocblas_int n, rocblas_int batch_count)
+// workspace elements of rocblas_trtri_large
+static size_t rocblas_trtri_large_temp_elements(rocblas_int n, rocblas_int batch_count)
 {
     rocblas_int IB   = ROCBLAS_TRTRI_NB * 2;
     size_t      size = 0;
@@ -127,6 +131,19 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE size_t
     return size;
 }
 
+ROCBLAS_INTERNAL_EXPORT_NOINLINE size_t
+    rocblas_internal_trtri_temp_elements(rocblas_int n, rocblas_int batch_count)
+{
+    // the recursion only needs the workspace of the diagonal blocks it inverts
+    if(n > c_trtri_recursive_min_n)
+    {
+        rocblas_int n1 = rocblas_trtri_recursive_split(n);
+        return std::max(rocblas_internal_trtri_temp_elements(n1, batch_count),
+                        rocblas_internal_trtri_temp_elements(n - n1, batch_count));
+    }
+    return rocblas_trtri_large_temp_elements(n, batch_count);
+}
+
 #define TRTRI_TEMPLATE_PARAMS                                                                   \
     handle, uplo, diag, n, A, offset_A, lda, stride_A, sub_stride_A, invA, offset_invA, ldinvA, \
         stride_invA, sub_stride_invA, batch_count, sub_batch_count, w_C_tmp
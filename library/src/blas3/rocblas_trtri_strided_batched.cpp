@@ -55,6 +55,10 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        // row major inv(A) is column major inv(A^T), of the other triangle, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+            uplo = rocblas_row_major_fill(uplo);
+
         // Compute the optimal size for temporary device memory
         size_t size = rocblas_internal_trtri_temp_elements(n, batch_count) * sizeof(T);
         if(handle->is_device_memory_size_query())
@@ -67,6 +71,8 @@ namespace
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
 
+        rocblas_api_scope api_scope(handle, rocblas_trtri_name<T>);
+
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle,
                       rocblas_trtri_name<T>,
@@ -81,7 +87,7 @@ namespace
                       bsinvA,
                       batch_count);
 
-        if(layer_mode & rocblas_layer_mode_log_profile)
+        if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             log_profile(handle,
                         rocblas_trtri_name<T>,
                         "uplo",
@@ -26,6 +26,7 @@
 #include "rocblas_block_sizes.h"
 #include "rocblas_gemm.hpp"
 #include "rocblas_trtri.hpp"
+#include "roctx_ranges.hpp"
 
 /*
     Invert the IB by IB diagonal blocks of A of size n by n, where n is divisible by IB
@@ -105,6 +106,23 @@ rocblas_trtri_trsm_kernel(rocblas_fill     uplo,
 
     ********************************************************************/
 
+/*! \brief rocblas_trtri_trsm_c_temp_elements
+    Number of elements of C_tmp needed by one batch instance of
+    rocblas_trtri_trsm_template when inverting the diagonal blocks of an order k matrix.
+    ********************************************************************/
+template <rocblas_int BLOCK>
+constexpr size_t rocblas_trtri_trsm_c_temp_elements(rocblas_int k)
+{
+    size_t c_temp_els = size_t(k / BLOCK) * ((BLOCK / 2) * (BLOCK / 2));
+
+    // For the TRTRI last diagonal block we need remainder space if k % BLOCK != 0
+    // TODO: Make this more accurate -- right now it's much larger than necessary
+    if(k % BLOCK)
+        c_temp_els = std::max(c_temp_els, size_t(ROCBLAS_TRTRI_NB) * BLOCK * 2);
+
+    return c_temp_els;
+}
+
 // assume invA has already been allocated, and leading dimension of invA is NB
 // assume IB is exactly half of NB
 template <rocblas_int NB, bool BATCHED, typename T, typename U, typename V>
@@ -126,6 +144,9 @@ rocblas_status rocblas_trtri_trsm_template(rocblas_handle   handle,
     if(!n)
         return rocblas_status_success;
 
+    rocblas_roctx_phase roctx_phase(
+        handle, "trtri_trsm", "N", n, "lda", lda, "batch_count", batch_count);
+
     rocblas_status status;
 
     /* sub_blocks is number of divisible NB*NB sub_blocks, but 2 * sub_blocks of IB*IB sub_blocks.
@@ -226,6 +226,14 @@ namespace
         }
     }
 
+    /*
+     * The shared memory tiles are stored k-major, so that the threads of a wavefront read
+     * consecutive elements of a row of k in the inner loop without bank conflicts. Rows are padded
+     * by GEAM_EX_LDS_PAD elements so that the k-major stores of transposed A and non-transposed B
+     * go to distinct banks too.
+     */
+    constexpr rocblas_int GEAM_EX_LDS_PAD = 8;
+
     /*
      * Copies data from a to s_a, and b to s_b.
      */
@@ -244,8 +252,8 @@ namespace
               rocblas_int DIM_M_B,
               typename T,
               typename U>
-    __device__ void local_to_shared(__shared__ T s_a[BLK_M][BLK_K],
-                                    __shared__ T s_b[BLK_N][BLK_K],
+    __device__ void local_to_shared(__shared__ T s_a[BLK_K][BLK_M + GEAM_EX_LDS_PAD],
+                                    __shared__ T s_b[BLK_K][BLK_N + GEAM_EX_LDS_PAD],
                                     U            a[BUFA_M][BUFA_N],
                                     U            b[BUFB_M][BUFB_N],
                                     int          idx_a,
@@ -257,18 +265,18 @@ namespace
             for(int i = 0; i < BUFA_M; ++i)
             {
                 if(!TRANSA)
-                    s_a[i * DIM_M_A + idx_a][j * DIM_N_A + idy_a] = a[i][j];
-                else
                     s_a[j * DIM_N_A + idy_a][i * DIM_M_A + idx_a] = a[i][j];
+                else
+                    s_a[i * DIM_M_A + idx_a][j * DIM_N_A + idy_a] = a[i][j];
             }
 
         for(int j = 0; j < BUFB_N; ++j)
             for(int i = 0; i < BUFB_M; ++i)
             {
                 if(!TRANSB)
-                    s_b[j * DIM_N_B + idy_b][i * DIM_M_B + idx_b] = b[i][j];
-                else
                     s_b[i * DIM_M_B + idx_b][j * DIM_N_B + idy_b] = b[i][j];
+                else
+                    s_b[j * DIM_N_B + idy_b][i * DIM_M_B + idx_b] = b[i][j];
             }
     }
 
@@ -287,17 +295,17 @@ namespace
               std::enable_if_t<!rocblas_is_array2<T2>, int> = 0>
     __device__ void shared_to_local(T2           a[THR_M],
                                     T2           b[THR_N],
-                                    __shared__ T s_a[BLK_M][BLK_K],
-                                    __shared__ T s_b[BLK_N][BLK_K],
+                                    __shared__ T s_a[BLK_K][BLK_M + GEAM_EX_LDS_PAD],
+                                    __shared__ T s_b[BLK_K][BLK_N + GEAM_EX_LDS_PAD],
                                     int          k,
                                     int          idx,
                                     int          idy)
     {
         for(int i = 0; i < THR_M; i++)
-            a[i] = s_a[i * DIM_M + idx][k];
+            a[i] = s_a[k][i * DIM_M + idx];
 
         for(int j = 0; j < THR_N; j++)
-            b[j] = s_b[j * DIM_N + idy][k];
+            b[j] = s_b[k][j * DIM_N + idy];
     }
 
     template <rocblas_int THR_N,
@@ -312,22 +320,22 @@ namespace
               std::enable_if_t<rocblas_is_array2<T2>, int> = 0>
     __device__ void shared_to_local(T2           a[THR_M],
                                     T2           b[THR_N],
-                                    __shared__ T s_a[BLK_M][BLK_K],
-                                    __shared__ T s_b[BLK_N][BLK_K],
+                                    __shared__ T s_a[BLK_K][BLK_M + GEAM_EX_LDS_PAD],
+                                    __shared__ T s_b[BLK_K][BLK_N + GEAM_EX_LDS_PAD],
                                     int          k,
                                     int          idx,
                                     int          idy)
     {
         for(int i = 0; i < THR_M; i++)
         {
-            a[i].x = s_a[i * DIM_M + idx][k];
-            a[i].y = s_a[i * DIM_M + idx][k + 1];
+            a[i].x = s_a[k][i * DIM_M + idx];
+            a[i].y = s_a[k + 1][i * DIM_M + idx];
         }
 
         for(int j = 0; j < THR_N; j++)
         {
-            b[j].x = s_b[j * DIM_N + idy][k];
-            b[j].y = s_b[j * DIM_N + idy][k + 1];
+            b[j].x = s_b[k][j * DIM_N + idy];
+            b[j].y = s_b[k + 1][j * DIM_N + idy];
         }
     }
 
@@ -513,10 +521,10 @@ namespace
         T b0[BUFB_M][BUFB_N]; // local array for loading B
         T b1[BUFB_M][BUFB_N]; // local array for loading B
 
-        __shared__ T s_a0[BLK_M][BLK_K]; // shared memory for A
-        __shared__ T s_a1[BLK_M][BLK_K]; // shared memory for A
-        __shared__ T s_b0[BLK_N][BLK_K]; // shared memory for B
-        __shared__ T s_b1[BLK_N][BLK_K]; // shared memory for B
+        __shared__ T s_a0[BLK_K][BLK_M + GEAM_EX_LDS_PAD]; // shared memory for A
+        __shared__ T s_a1[BLK_K][BLK_M + GEAM_EX_LDS_PAD]; // shared memory for A
+        __shared__ T s_b0[BLK_K][BLK_N + GEAM_EX_LDS_PAD]; // shared memory for B
+        __shared__ T s_b1[BLK_K][BLK_N + GEAM_EX_LDS_PAD]; // shared memory for B
 
         Tab a[THR_M]; // input local array A
         Tab b[THR_N]; // input local array B
@@ -979,9 +987,11 @@ namespace
             return rocblas_status_success;
         }
 
+// The kernel loads K in pairs of BLK_K blocks, so only sizes of whole blocks and an even number of
+// K blocks are run without bounds checks
 #define LAUNCH_GEAM_SOURCE_KERNEL(                                               \
     TRANSA_, TRANSB_, DIM_M_A_, DIM_N_A_, DIM_M_B_, DIM_N_B_, MINPLUS_)          \
-    if(m % BLK_M == 0 && n % BLK_N == 0 && k % BLK_K == 0)                       \
+    if(m % BLK_M == 0 && n % BLK_N == 0 && k % (2 * BLK_K) == 0)                 \
     {                                                                            \
         dim3 dimBlock(DIM_M, DIM_N, 1);                                          \
         dim3 dimGrid(m / BLK_M, n / BLK_N, batch_count);                         \
@@ -52,9 +52,11 @@ namespace
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
         auto layer_mode = handle->layer_mode;
+
+        rocblas_api_scope api_scope(handle, ROCBLAS_API_STR(rocblas_axpy_ex));
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-              | rocblas_layer_mode_log_profile))
+              | rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
         {
             auto alpha_type_str = rocblas_datatype_string(alpha_type);
             auto x_type_str     = rocblas_datatype_string(x_type);
@@ -125,7 +127,7 @@ namespace
                           ex_type_str);
             }
 
-            if(layer_mode & rocblas_layer_mode_log_profile)
+            if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             {
                 log_profile(handle,
                             ROCBLAS_API_STR(rocblas_axpy_ex),
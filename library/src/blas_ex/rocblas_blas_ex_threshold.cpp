@@ -0,0 +1,144 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_blas_ex_threshold.hpp"
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+namespace
+{
+    using row = rocblas_gemmt_thresholds::row;
+
+    constexpr int64_t c_max = rocblas_gemmt_max;
+
+    void rocblas_gemmt_set(row& r, int64_t s, int64_t d, int64_t c, int64_t z)
+    {
+        r[0] = s;
+        r[1] = d;
+        r[2] = c;
+        r[3] = z;
+    }
+
+    // Threshold values of (N, K) found on gfx90a, common for single, double and complex-float
+    rocblas_gemmt_thresholds rocblas_gemmt_default_thresholds()
+    {
+        rocblas_gemmt_thresholds t;
+        rocblas_gemmt_set(t.recursive_n_lower, 1232, 1232, 1232, 932);
+        rocblas_gemmt_set(t.recursive_k_lower, 932, 932, 932, 2732);
+        return t;
+    }
+
+    row* rocblas_gemmt_find(rocblas_gemmt_thresholds& t, const std::string& name)
+    {
+        if(name == "recursive_n_lower")
+            return &t.recursive_n_lower;
+        if(name == "recursive_k_lower")
+            return &t.recursive_k_lower;
+        return nullptr;
+    }
+
+    // Overrides the members listed in the file, leaving t unchanged if the file does not exist.
+    // Lines which cannot be parsed are reported and skipped.
+    void rocblas_gemmt_read_thresholds(rocblas_gemmt_thresholds& t, const std::string& path)
+    {
+        std::ifstream file(path);
+        std::string   line;
+        for(int line_number = 1; std::getline(file, line); line_number++)
+        {
+            std::istringstream fields(line.substr(0, line.find('#')));
+            std::string        name;
+            if(!(fields >> name))
+                continue;
+
+            row* r = rocblas_gemmt_find(t, name);
+            row  values;
+            bool valid = r != nullptr;
+            for(int p = 0; valid && p < rocblas_gemmt_precisions; p++)
+            {
+                std::string value;
+                valid = bool(fields >> value);
+                if(valid && value == "-")
+                    values[p] = (*r)[p];
+                else if(valid && value == "max")
+                    values[p] = c_max;
+                else if(valid)
+                {
+                    size_t end = 0;
+                    try
+                    {
+                        values[p] = std::stoll(value, &end);
+                    }
+                    catch(...)
+                    {
+                    }
+                    valid = end == value.size() && values[p] >= 0;
+                }
+            }
+
+            if(valid)
+                std::copy_n(values, rocblas_gemmt_precisions, *r);
+            else
+                rocblas_cerr << "rocBLAS warning: ignoring line " << line_number << " of " << path
+                             << std::endl;
+        }
+    }
+} // namespace
+
+const rocblas_gemmt_thresholds& rocblas_gemmt_get_thresholds(int device)
+{
+    static std::mutex                                              mutex;
+    static std::unordered_map<int, const rocblas_gemmt_thresholds> tables;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto                        it = tables.find(device);
+    if(it == tables.end())
+    {
+        rocblas_gemmt_thresholds t = rocblas_gemmt_default_thresholds();
+
+        const char* path = getenv("ROCBLAS_GEMMT_TUNING_PATH");
+        if(path)
+        {
+            hipDeviceProp_t props;
+            if(hipGetDeviceProperties(&props, device) == hipSuccess)
+            {
+                // strip out xnack/ecc from name
+                std::string name(props.gcnArchName);
+                name = name.substr(0, name.find(':'));
+                rocblas_gemmt_read_thresholds(t,
+                                              std::string(path) + "/GemmtTuning_" + name + ".txt");
+            }
+        }
+
+        it = tables.emplace(device, t).first;
+    }
+    return it->second;
+}
+
+const rocblas_gemmt_thresholds& rocblas_gemmt_get_thresholds(rocblas_handle handle)
+{
+    if(!handle->gemmt_thresholds)
+        handle->gemmt_thresholds = &rocblas_gemmt_get_thresholds(handle->getDevice());
+    return *handle->gemmt_thresholds;
+}
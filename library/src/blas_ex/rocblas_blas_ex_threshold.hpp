@@ -1,5 +1,5 @@
 /* ************************************************************************
- * Copyright (C) 2019-2023 Advanced Micro Devices, Inc. All rights reserved.
+ * Copyright (C) 2019-2024 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -21,14 +21,57 @@
  * ************************************************************************ */
 
 #pragma once
-#include "rocblas.h"
+#include "handle.hpp"
+#include <cstdint>
+#include <limits>
+#include <type_traits>
 
 /*********************************************************************gemmt**********************************************************************/
 
-// Threshold values of (N, K) in gfx90a
-//TODO: Check the performance of other architectures as well
-constexpr int n_zgemmt_threshold = 932;
-constexpr int k_zgemmt_threshold = 2732;
-//common for single, double and complex-float
-constexpr int n_gemmt_threshold = 1232;
-constexpr int k_gemmt_threshold = 932;
+// Tuning of the gemmt path selection. Each member holds one threshold per precision, indexed by
+// rocblas_gemmt_precision, and decides between the GEMM based block recursive algorithm and the
+// direct gemmt kernels. The defaults are the values found on gfx90a and are used for all
+// architectures unless a table is loaded for the architecture of a device from the directory
+// named by ROCBLAS_GEMMT_TUNING_PATH, see rocblas_gemmt_get_thresholds.
+
+// Precision index of the thresholds: s, d, c, z
+constexpr int rocblas_gemmt_precisions = 4;
+
+template <typename T>
+constexpr int rocblas_gemmt_precision()
+{
+    return std::is_same_v<T, float>                   ? 0
+           : std::is_same_v<T, double>                ? 1
+           : std::is_same_v<T, rocblas_float_complex> ? 2
+                                                      : 3;
+}
+
+// Threshold larger than any problem size
+constexpr int64_t rocblas_gemmt_max = std::numeric_limits<int64_t>::max();
+
+struct rocblas_gemmt_thresholds
+{
+    using row = int64_t[rocblas_gemmt_precisions];
+
+    // The block recursive algorithm is used when n >= recursive_n_lower && k >= recursive_k_lower
+    row recursive_n_lower;
+    row recursive_k_lower;
+};
+
+// Thresholds for a device. The table is built once per device from the defaults, overridden by
+// the file GemmtTuning_<arch>.txt (for example GemmtTuning_gfx942.txt) in the directory named by
+// ROCBLAS_GEMMT_TUNING_PATH if it exists. Each line of the file is "<member> <s> <d> <c> <z>"
+// with the name of a member above and "max" standing for rocblas_gemmt_max and "-" keeping the
+// default. Text following '#' is ignored.
+// clients/benchmarks/gemmt_tune/rocblas-gemmt-tune.py writes such a file.
+const rocblas_gemmt_thresholds& rocblas_gemmt_get_thresholds(int device);
+
+// Thresholds for the device of the handle, cached in the handle
+const rocblas_gemmt_thresholds& rocblas_gemmt_get_thresholds(rocblas_handle handle);
+
+// Whether the block recursive algorithm is used for the rocblas_gemmt_precision p
+inline bool
+    rocblas_gemmt_use_recursive(const rocblas_gemmt_thresholds& t, int p, int64_t n, int64_t k)
+{
+    return n >= t.recursive_n_lower[p] && k >= t.recursive_k_lower[p];
+}
@@ -0,0 +1,504 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * contraction_ex computes a tensor contraction given by its indices and their strides in A, B, C
+ * and D. Indices of a kind which step through the tensors as one index would are merged, and the
+ * contraction is mapped onto strided batched gemm_ex calls on the tensors as they are laid out:
+ * a free index of each operand and the bound index become M, N and K, and the other free and
+ * batch indices become the batch of the GEMM, or are looped over by the host. No data is
+ * permuted. The loaded Tensile libraries hold GEMM solutions, so contractions which do not map
+ * onto GEMMs are not implemented.
+ */
+
+#include "handle.hpp"
+#include "int64_helpers.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_gemm_ex.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+    constexpr char rocblas_contraction_ex_name[] = "rocblas_contraction_ex";
+
+    // The tensors of a contraction, D = alpha * contraction(A, B) + beta * C
+    enum rocblas_contraction_tensor
+    {
+        tensor_a,
+        tensor_b,
+        tensor_c,
+        tensor_d,
+        tensor_count
+    };
+
+    // Whether indices of the kind index the tensor
+    constexpr bool rocblas_contraction_indexes(rocblas_contraction_index_kind kind, int tensor)
+    {
+        switch(kind)
+        {
+        case rocblas_contraction_index_free_a:
+            return tensor != tensor_b;
+        case rocblas_contraction_index_free_b:
+            return tensor != tensor_a;
+        case rocblas_contraction_index_bound:
+            return tensor == tensor_a || tensor == tensor_b;
+        default:
+            return true;
+        }
+    }
+
+    // An index of size above 1, with stride 0 in the tensors it does not index
+    struct rocblas_contraction_dim
+    {
+        rocblas_contraction_index_kind kind;
+        int64_t                        size;
+        int64_t                        stride[tensor_count];
+    };
+
+    // The strided batched GEMM computing the contraction for each combination of the loops
+    struct rocblas_contraction_gemm
+    {
+        bool                                 swap_ab = false; // D^T = op(B)^T * op(A)^T
+        rocblas_operation                    trans_a = rocblas_operation_none;
+        rocblas_operation                    trans_b = rocblas_operation_none;
+        int64_t                              m = 1, n = 1, k = 1;
+        int64_t                              lda = 1, ldb = 1, ldc = 1, ldd = 1;
+        int64_t                              batch_count = 1;
+        int64_t                              stride[tensor_count] = {};
+        std::vector<rocblas_contraction_dim> loops;
+    };
+
+    // Merges pairs of indices of a kind when the outer one steps by the size of the inner one
+    // times its strides in every tensor
+    void rocblas_contraction_coalesce(std::vector<rocblas_contraction_dim>& dims)
+    {
+        for(bool merged = true; merged;)
+        {
+            merged = false;
+            for(size_t i = 0; i < dims.size() && !merged; i++)
+                for(size_t j = 0; j < dims.size() && !merged; j++)
+                {
+                    if(i == j || dims[i].kind != dims[j].kind)
+                        continue;
+                    bool follows = true;
+                    for(int t = 0; t < tensor_count; t++)
+                        follows = follows && dims[j].stride[t] == dims[i].stride[t] * dims[i].size;
+                    if(follows)
+                    {
+                        dims[i].size *= dims[j].size;
+                        dims.erase(dims.begin() + j);
+                        merged = true;
+                    }
+                }
+        }
+    }
+
+    // Takes out the first index of the kind satisfying pred, or returns an index of size 1
+    template <typename P>
+    rocblas_contraction_dim rocblas_contraction_take(std::vector<rocblas_contraction_dim>& dims,
+                                                     rocblas_contraction_index_kind        kind,
+                                                     P                                     pred)
+    {
+        for(auto it = dims.begin(); it != dims.end(); ++it)
+            if(it->kind == kind && pred(*it))
+            {
+                auto dim = *it;
+                dims.erase(it);
+                return dim;
+            }
+        return {kind, 1, {}};
+    }
+
+    // The layout of a matrix op(X) of rows x cols in tensor t, stored as it is when contiguous
+    // along the rows and transposed when contiguous along the columns
+    bool rocblas_contraction_layout(const rocblas_contraction_dim& rows,
+                                    const rocblas_contraction_dim& cols,
+                                    int                            t,
+                                    rocblas_operation&             trans,
+                                    int64_t&                       ld)
+    {
+        if((rows.size == 1 || rows.stride[t] == 1)
+           && (cols.size == 1 || cols.stride[t] >= rows.size))
+        {
+            trans = rocblas_operation_none;
+            ld    = std::max(cols.stride[t], rows.size);
+            return true;
+        }
+        if((cols.size == 1 || cols.stride[t] == 1)
+           && (rows.size == 1 || rows.stride[t] >= cols.size))
+        {
+            trans = rocblas_operation_transpose;
+            ld    = std::max(rows.stride[t], cols.size);
+            return true;
+        }
+        return false;
+    }
+
+    // Validates the indices and maps the contraction onto a GEMM. Returns success when the
+    // contraction is empty.
+    rocblas_status rocblas_contraction_to_gemm(int32_t                          num_indices,
+                                               const rocblas_contraction_index* indices,
+                                               rocblas_contraction_gemm&        g)
+    {
+        if(num_indices < 0)
+            return rocblas_status_invalid_size;
+        if(num_indices && !indices)
+            return rocblas_status_invalid_pointer;
+
+        std::vector<rocblas_contraction_dim> dims;
+        bool                                 empty = false, k_zero = false;
+        for(int32_t i = 0; i < num_indices; i++)
+        {
+            const auto& index = indices[i];
+            if(index.kind != rocblas_contraction_index_free_a
+               && index.kind != rocblas_contraction_index_free_b
+               && index.kind != rocblas_contraction_index_bound
+               && index.kind != rocblas_contraction_index_batch)
+                return rocblas_status_invalid_value;
+
+            rocblas_contraction_dim dim{index.kind, index.size, {}};
+            const rocblas_stride    strides[tensor_count]
+                = {index.stride_a, index.stride_b, index.stride_c, index.stride_d};
+            for(int t = 0; t < tensor_count; t++)
+                if(rocblas_contraction_indexes(index.kind, t))
+                    dim.stride[t] = strides[t];
+            if(dim.size < 0 || std::any_of(dim.stride, dim.stride + tensor_count, [](int64_t s) {
+                   return s < 0;
+               }))
+                return rocblas_status_invalid_size;
+
+            if(!dim.size)
+                (index.kind == rocblas_contraction_index_bound ? k_zero : empty) = true;
+            else if(dim.size > 1)
+                dims.push_back(dim);
+        }
+        if(empty)
+            return rocblas_status_success;
+
+        // D = beta * C when the bound indices are empty, A and B are not read
+        if(k_zero)
+        {
+            dims.erase(std::remove_if(dims.begin(),
+                                      dims.end(),
+                                      [](const rocblas_contraction_dim& dim) {
+                                          return dim.kind == rocblas_contraction_index_bound;
+                                      }),
+                       dims.end());
+            g.k = 0;
+        }
+
+        rocblas_contraction_coalesce(dims);
+
+        // M is a free index along which D is contiguous, taken from B with D transposed when
+        // only B has one
+        auto unit_d = [](rocblas_contraction_index_kind kind) {
+            return [kind](const rocblas_contraction_dim& dim) {
+                return dim.kind == kind && dim.stride[tensor_c] == 1 && dim.stride[tensor_d] == 1;
+            };
+        };
+        g.swap_ab
+            = std::none_of(dims.begin(), dims.end(), unit_d(rocblas_contraction_index_free_a))
+              && std::any_of(dims.begin(), dims.end(), unit_d(rocblas_contraction_index_free_b));
+        if(g.swap_ab)
+            for(auto& dim : dims)
+            {
+                if(dim.kind == rocblas_contraction_index_free_a)
+                    dim.kind = rocblas_contraction_index_free_b;
+                else if(dim.kind == rocblas_contraction_index_free_b)
+                    dim.kind = rocblas_contraction_index_free_a;
+                std::swap(dim.stride[tensor_a], dim.stride[tensor_b]);
+            }
+
+        auto m = rocblas_contraction_take(
+            dims, rocblas_contraction_index_free_a, [](const rocblas_contraction_dim& dim) {
+                return dim.stride[tensor_c] == 1 && dim.stride[tensor_d] == 1;
+            });
+        auto n = rocblas_contraction_take(
+            dims, rocblas_contraction_index_free_b, [&](const rocblas_contraction_dim& dim) {
+                return dim.stride[tensor_c] >= m.size && dim.stride[tensor_d] >= m.size;
+            });
+        auto k = rocblas_contraction_take(
+            dims, rocblas_contraction_index_bound, [](const rocblas_contraction_dim&) {
+                return true;
+            });
+
+        // a sum over bound indices which cannot be merged is more than one GEMM
+        if(std::any_of(dims.begin(), dims.end(), [](const rocblas_contraction_dim& dim) {
+               return dim.kind == rocblas_contraction_index_bound;
+           }))
+            return rocblas_status_not_implemented;
+
+        if(!rocblas_contraction_layout(m, k, tensor_a, g.trans_a, g.lda)
+           || !rocblas_contraction_layout(k, n, tensor_b, g.trans_b, g.ldb))
+            return rocblas_status_not_implemented;
+
+        g.m = m.size;
+        g.n = n.size;
+        if(g.k)
+            g.k = k.size;
+        g.ldc = std::max(n.stride[tensor_c], m.size);
+        g.ldd = std::max(n.stride[tensor_d], m.size);
+
+        // The largest of the other indices is the batch of the GEMM, the rest are looped over
+        auto batch = std::max_element(
+            dims.begin(), dims.end(), [](const auto& x, const auto& y) { return x.size < y.size; });
+        if(batch != dims.end())
+        {
+            g.batch_count = batch->size;
+            std::copy(batch->stride, batch->stride + tensor_count, g.stride);
+            dims.erase(batch);
+        }
+        g.loops = std::move(dims);
+
+        for(int64_t v : {g.m, g.n, g.k, g.lda, g.ldb, g.ldc, g.ldd, g.batch_count})
+            if(v > c_i32_max)
+                return rocblas_status_not_implemented;
+
+        return rocblas_status_continue;
+    }
+
+    rocblas_status rocblas_contraction_ex_impl(rocblas_handle                   handle,
+                                               int32_t                          num_indices,
+                                               const rocblas_contraction_index* indices,
+                                               const void*                      alpha,
+                                               const void*                      a,
+                                               rocblas_datatype                 a_type,
+                                               const void*                      b,
+                                               rocblas_datatype                 b_type,
+                                               const void*                      beta,
+                                               const void*                      c,
+                                               rocblas_datatype                 c_type,
+                                               void*                            d,
+                                               rocblas_datatype                 d_type,
+                                               rocblas_datatype                 compute_type,
+                                               rocblas_gemm_algo                algo,
+                                               int32_t                          solution_index,
+                                               uint32_t                         flags)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // row major order, see rocblas_set_order, has no column major mapping here
+        RETURN_NOT_IMPLEMENTED_IF_ROW_MAJOR(handle);
+
+        rocblas_contraction_gemm g;
+        rocblas_status           mapped = rocblas_contraction_to_gemm(num_indices, indices, g);
+
+        // Copy alpha and beta to host if on device
+        rocblas_union_t alpha_h, beta_h;
+        RETURN_IF_ROCBLAS_ERROR(rocblas_copy_alpha_beta_to_host_if_on_device(
+            handle, alpha, beta, alpha_h, beta_h, rocblas_int(g.k), compute_type));
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        rocblas_api_scope api_scope(handle, rocblas_contraction_ex_name);
+        if(!handle->is_device_memory_size_query()
+           && handle->layer_mode & rocblas_layer_mode_log_trace)
+        {
+            rocblas_internal_ostream alphass, betass;
+            if(log_trace_alpha_beta_ex(compute_type, alpha, beta, alphass, betass)
+               == rocblas_status_success)
+                log_trace(handle,
+                          rocblas_contraction_ex_name,
+                          num_indices,
+                          (const void*)indices,
+                          alphass.str(),
+                          a,
+                          rocblas_datatype_string(a_type),
+                          b,
+                          rocblas_datatype_string(b_type),
+                          betass.str(),
+                          c,
+                          rocblas_datatype_string(c_type),
+                          d,
+                          rocblas_datatype_string(d_type),
+                          rocblas_datatype_string(compute_type),
+                          algo,
+                          solution_index,
+                          rocblas_gemm_flags(flags));
+        }
+
+        if(mapped != rocblas_status_continue)
+        {
+            if(mapped == rocblas_status_success)
+                RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+            return mapped;
+        }
+
+        if(g.swap_ab)
+        {
+            std::swap(a, b);
+            std::swap(a_type, b_type);
+        }
+
+        auto validArgs = rocblas_gemm_ex_arg_check(handle,
+                                                   g.trans_a,
+                                                   g.trans_b,
+                                                   rocblas_int(g.m),
+                                                   rocblas_int(g.n),
+                                                   rocblas_int(g.k),
+                                                   alpha,
+                                                   a,
+                                                   rocblas_int(g.lda),
+                                                   b,
+                                                   rocblas_int(g.ldb),
+                                                   beta,
+                                                   c,
+                                                   c_type,
+                                                   rocblas_int(g.ldc),
+                                                   d,
+                                                   d_type,
+                                                   rocblas_int(g.ldd),
+                                                   compute_type,
+                                                   rocblas_int(g.batch_count));
+        if(validArgs == rocblas_status_continue && c == d)
+        {
+            // C and D in place must have the same layout
+            bool same = g.ldc == g.ldd && g.stride[tensor_c] == g.stride[tensor_d];
+            for(const auto& loop : g.loops)
+                same = same && loop.stride[tensor_c] == loop.stride[tensor_d];
+            if(!same)
+                validArgs = rocblas_status_invalid_size;
+        }
+        if(validArgs != rocblas_status_continue)
+        {
+            if(validArgs == rocblas_status_success)
+                RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+            return validArgs;
+        }
+
+        auto gemm = [&](const int64_t* offset) {
+            return rocblas_gemm_ex_template<false>(handle,
+                                                   g.trans_a,
+                                                   g.trans_b,
+                                                   rocblas_int(g.m),
+                                                   rocblas_int(g.n),
+                                                   rocblas_int(g.k),
+                                                   alpha,
+                                                   a,
+                                                   a_type,
+                                                   offset[tensor_a],
+                                                   rocblas_int(g.lda),
+                                                   g.stride[tensor_a],
+                                                   b,
+                                                   b_type,
+                                                   offset[tensor_b],
+                                                   rocblas_int(g.ldb),
+                                                   g.stride[tensor_b],
+                                                   beta,
+                                                   c,
+                                                   c_type,
+                                                   offset[tensor_c],
+                                                   rocblas_int(g.ldc),
+                                                   g.stride[tensor_c],
+                                                   d,
+                                                   d_type,
+                                                   offset[tensor_d],
+                                                   rocblas_int(g.ldd),
+                                                   g.stride[tensor_d],
+                                                   rocblas_int(g.batch_count),
+                                                   compute_type,
+                                                   algo,
+                                                   solution_index,
+                                                   flags);
+        };
+
+        // every GEMM of the loops is the same problem, so one answers the size query
+        int64_t offset[tensor_count] = {};
+        if(handle->is_device_memory_size_query())
+            return gemm(offset);
+
+        // the loops step through their combinations as an odometer, innermost first
+        std::vector<int64_t> position(g.loops.size());
+        for(;;)
+        {
+            RETURN_IF_ROCBLAS_ERROR(gemm(offset));
+
+            size_t l = 0;
+            for(; l < g.loops.size(); l++)
+            {
+                const auto& loop = g.loops[l];
+                for(int t = 0; t < tensor_count; t++)
+                    offset[t] += loop.stride[t];
+                if(++position[l] < loop.size)
+                    break;
+                for(int t = 0; t < tensor_count; t++)
+                    offset[t] -= loop.size * loop.stride[t];
+                position[l] = 0;
+            }
+            if(l == g.loops.size())
+                return rocblas_status_success;
+        }
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_contraction_ex(rocblas_handle                   handle,
+                                                 int32_t                          num_indices,
+                                                 const rocblas_contraction_index* indices,
+                                                 const void*                      alpha,
+                                                 const void*                      a,
+                                                 rocblas_datatype                 a_type,
+                                                 const void*                      b,
+                                                 rocblas_datatype                 b_type,
+                                                 const void*                      beta,
+                                                 const void*                      c,
+                                                 rocblas_datatype                 c_type,
+                                                 void*                            d,
+                                                 rocblas_datatype                 d_type,
+                                                 rocblas_datatype                 compute_type,
+                                                 rocblas_gemm_algo                algo,
+                                                 int32_t                          solution_index,
+                                                 uint32_t                         flags)
+try
+{
+    return rocblas_contraction_ex_impl(handle,
+                                       num_indices,
+                                       indices,
+                                       alpha,
+                                       a,
+                                       a_type,
+                                       b,
+                                       b_type,
+                                       beta,
+                                       c,
+                                       c_type,
+                                       d,
+                                       d_type,
+                                       compute_type,
+                                       algo,
+                                       solution_index,
+                                       flags);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
@@ -0,0 +1,355 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * Conversions between float, half, bfloat16 and the 8-bit float types of strided batched
+ * matrices, through the same downcasts (explicit_downcast) and stochastic rounding as gemm_ex3.
+ * Each thread converts a vector of up to 16 bytes, and the amax of the input used for FP8
+ * scaling is reduced in the same pass.
+ */
+
+#include "handle.hpp"
+#include "int64_helpers.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_gemm_ex3.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    constexpr int c_convert_ex_NB = 256;
+
+    // Elements converted by one thread when the rows are aligned to them, loading or storing
+    // 16 bytes at a time for the wider of the two types
+    template <typename Tx, typename Ty>
+    constexpr int c_convert_ex_VEC = 16 / std::max(sizeof(Tx), sizeof(Ty));
+
+    template <typename T, int VEC>
+    struct alignas(sizeof(T) * VEC) rocblas_convert_ex_vec
+    {
+        T v[VEC];
+    };
+
+    // Y = downcast(scale * X) for the vectors of VEC elements of the strided batch blockIdx.y,
+    // with amax[batch] = max(amax[batch], max|X|) if amax is not NULL
+    template <int NB, int VEC, bool SR, typename Tx, typename Ty>
+    ROCBLAS_KERNEL(NB)
+    rocblas_convert_ex_kernel(int64_t        rows,
+                              int64_t        size,
+                              const Tx*      X,
+                              int64_t        ldx,
+                              rocblas_stride stride_x,
+                              Ty*            Y,
+                              int64_t        ldy,
+                              rocblas_stride stride_y,
+                              const float*   scale,
+                              float*         amax,
+                              uint32_t       seed)
+    {
+        using Vx = rocblas_convert_ex_vec<Tx, VEC>;
+        using Vy = rocblas_convert_ex_vec<Ty, VEC>;
+
+        int64_t   batch = blockIdx.y;
+        const Vx* x     = (const Vx*)(X + batch * stride_x);
+        Vy*       y     = (Vy*)(Y + batch * stride_y);
+        float     s     = scale ? *scale : 1.0f;
+        float     m     = 0;
+
+        for(int64_t idx = blockIdx.x * int64_t(NB) + threadIdx.x; idx < size;
+            idx += int64_t(gridDim.x) * NB)
+        {
+            int64_t r   = idx % rows, c = idx / rows;
+            int64_t gid = (batch * size + idx) * VEC;
+            Vx      xv  = x[c * ldx + r];
+            Vy      yv;
+#pragma unroll
+            for(int l = 0; l < VEC; l++)
+            {
+                float v = float(xv.v[l]);
+                m       = fmax(m, fabs(v));
+                v *= s;
+                uint32_t rng = SR ? prand_generator<float>(gid + l, seed, v) : 0;
+                yv.v[l]      = explicit_downcast<Ty, float, SR>(v, rng);
+            }
+            y[c * ldy + r] = yv;
+        }
+
+        if(!amax)
+            return;
+
+        __shared__ float smax[NB];
+
+        smax[threadIdx.x] = m;
+        __syncthreads();
+        for(int i = NB / 2; i > 0; i /= 2)
+        {
+            if(threadIdx.x < i)
+                smax[threadIdx.x] = fmax(smax[threadIdx.x], smax[threadIdx.x + i]);
+            __syncthreads();
+        }
+
+        // non-negative floats order like their bits
+        if(threadIdx.x == 0)
+            atomicMax((int*)amax + batch, __float_as_int(smax[0]));
+    }
+
+    template <bool SR, typename Tx, typename Ty>
+    rocblas_status rocblas_convert_ex_launch(rocblas_handle handle,
+                                             rocblas_int    m,
+                                             rocblas_int    n,
+                                             const void*    x,
+                                             rocblas_int    ldx,
+                                             rocblas_stride stride_x,
+                                             void*          y,
+                                             rocblas_int    ldy,
+                                             rocblas_stride stride_y,
+                                             rocblas_int    batch_count,
+                                             const float*   scale,
+                                             float*         amax,
+                                             uint32_t       seed)
+    {
+        static constexpr int NB  = c_convert_ex_NB;
+        static constexpr int VEC = c_convert_ex_VEC<Tx, Ty>;
+
+        const Tx* X = (const Tx*)x;
+        Ty*       Y = (Ty*)y;
+
+        // contiguous matrices are converted as one column
+        int64_t rows = m, cols = n;
+        if(ldx == m && ldy == m)
+            rows *= cols, cols = 1;
+
+        bool vec = rows % VEC == 0 && ldx % VEC == 0 && ldy % VEC == 0 && stride_x % VEC == 0
+                   && stride_y % VEC == 0
+                   && uintptr_t(X) % sizeof(rocblas_convert_ex_vec<Tx, VEC>) == 0
+                   && uintptr_t(Y) % sizeof(rocblas_convert_ex_vec<Ty, VEC>) == 0;
+
+        int64_t v    = vec ? VEC : 1;
+        int64_t size = rows / v * cols;
+        dim3    grid(rocblas_int(std::min((size - 1) / NB + 1, c_i64_grid_X_chunk)));
+
+        hipStream_t stream = handle->get_stream();
+        for(int64_t b = 0; b < batch_count; b += c_i64_grid_YZ_chunk)
+        {
+            grid.y = rocblas_int(std::min(batch_count - b, c_i64_grid_YZ_chunk));
+            if(vec)
+                ROCBLAS_LAUNCH_KERNEL((rocblas_convert_ex_kernel<NB, VEC, SR, Tx, Ty>),
+                                      grid,
+                                      dim3(NB),
+                                      0,
+                                      stream,
+                                      rows / VEC,
+                                      size,
+                                      X + b * stride_x,
+                                      ldx / VEC,
+                                      stride_x,
+                                      Y + b * stride_y,
+                                      ldy / VEC,
+                                      stride_y,
+                                      scale,
+                                      amax ? amax + b : nullptr,
+                                      seed);
+            else
+                ROCBLAS_LAUNCH_KERNEL((rocblas_convert_ex_kernel<NB, 1, SR, Tx, Ty>),
+                                      grid,
+                                      dim3(NB),
+                                      0,
+                                      stream,
+                                      rows,
+                                      size,
+                                      X + b * stride_x,
+                                      ldx,
+                                      stride_x,
+                                      Y + b * stride_y,
+                                      ldy,
+                                      stride_y,
+                                      scale,
+                                      amax ? amax + b : nullptr,
+                                      seed);
+        }
+        return rocblas_status_success;
+    }
+
+    // Stochastic rounding only applies to conversions to the 8-bit types
+    template <typename Tx, typename... Args>
+    rocblas_status rocblas_convert_ex_to(rocblas_datatype y_type, bool sr, Args... args)
+    {
+        switch(y_type)
+        {
+        case rocblas_datatype_f32_r:
+            return rocblas_convert_ex_launch<false, Tx, float>(args...);
+        case rocblas_datatype_f16_r:
+            return rocblas_convert_ex_launch<false, Tx, rocblas_half>(args...);
+        case rocblas_datatype_bf16_r:
+            return rocblas_convert_ex_launch<false, Tx, rocblas_bfloat16>(args...);
+        case rocblas_datatype_f8_r:
+            return sr ? rocblas_convert_ex_launch<true, Tx, rocblas_f8>(args...)
+                      : rocblas_convert_ex_launch<false, Tx, rocblas_f8>(args...);
+        case rocblas_datatype_bf8_r:
+            return sr ? rocblas_convert_ex_launch<true, Tx, rocblas_bf8>(args...)
+                      : rocblas_convert_ex_launch<false, Tx, rocblas_bf8>(args...);
+        default:
+            return rocblas_status_not_implemented;
+        }
+    }
+
+    bool rocblas_convert_ex_type_supported(rocblas_datatype type)
+    {
+        return type == rocblas_datatype_f32_r || type == rocblas_datatype_f16_r
+               || type == rocblas_datatype_bf16_r || type == rocblas_datatype_f8_r
+               || type == rocblas_datatype_bf8_r;
+    }
+
+    rocblas_status rocblas_convert_ex_impl(rocblas_handle   handle,
+                                           rocblas_int      m,
+                                           rocblas_int      n,
+                                           const void*      x,
+                                           rocblas_datatype x_type,
+                                           rocblas_int      ldx,
+                                           rocblas_stride   stride_x,
+                                           void*            y,
+                                           rocblas_datatype y_type,
+                                           rocblas_int      ldy,
+                                           rocblas_stride   stride_y,
+                                           rocblas_int      batch_count,
+                                           const float*     scale,
+                                           float*           amax,
+                                           uint32_t         flags)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // row major m x n matrices are column major n x m matrices, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+            std::swap(m, n);
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      "rocblas_convert_ex",
+                      m,
+                      n,
+                      x,
+                      rocblas_datatype_string(x_type),
+                      ldx,
+                      stride_x,
+                      y,
+                      rocblas_datatype_string(y_type),
+                      ldy,
+                      stride_y,
+                      batch_count,
+                      scale,
+                      amax,
+                      flags);
+
+        if(m < 0 || n < 0 || batch_count < 0 || ldx < std::max(m, 1) || ldy < std::max(m, 1))
+            return rocblas_status_invalid_size;
+        if(!rocblas_convert_ex_type_supported(x_type) || !rocblas_convert_ex_type_supported(y_type))
+            return rocblas_status_not_implemented;
+        if(!batch_count)
+            return rocblas_status_success;
+
+        if(amax)
+            RETURN_IF_HIP_ERROR(
+                hipMemsetAsync(amax, 0, sizeof(float) * batch_count, handle->get_stream()));
+        if(!m || !n)
+            return rocblas_status_success;
+        if(!x || !y)
+            return rocblas_status_invalid_pointer;
+
+        bool     sr   = flags & rocblas_gemm_flags_stochastic_rounding;
+        uint32_t seed = 0, unused_seed_b, unused_seed_c;
+        if(sr && (y_type == rocblas_datatype_f8_r || y_type == rocblas_datatype_bf8_r))
+            rocblas_gemm_ex3_stochastic_rounding_seeds(handle, seed, unused_seed_b, unused_seed_c);
+
+#define CONVERT_EX_ARGS \
+    y_type, sr, handle, m, n, x, ldx, stride_x, y, ldy, stride_y, batch_count, scale, amax, seed
+
+        switch(x_type)
+        {
+        case rocblas_datatype_f32_r:
+            return rocblas_convert_ex_to<float>(CONVERT_EX_ARGS);
+        case rocblas_datatype_f16_r:
+            return rocblas_convert_ex_to<rocblas_half>(CONVERT_EX_ARGS);
+        case rocblas_datatype_bf16_r:
+            return rocblas_convert_ex_to<rocblas_bfloat16>(CONVERT_EX_ARGS);
+        case rocblas_datatype_f8_r:
+            return rocblas_convert_ex_to<rocblas_f8>(CONVERT_EX_ARGS);
+        case rocblas_datatype_bf8_r:
+            return rocblas_convert_ex_to<rocblas_bf8>(CONVERT_EX_ARGS);
+        default:
+            return rocblas_status_not_implemented;
+        }
+
+#undef CONVERT_EX_ARGS
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_convert_ex(rocblas_handle   handle,
+                                  rocblas_int      m,
+                                  rocblas_int      n,
+                                  const void*      x,
+                                  rocblas_datatype x_type,
+                                  rocblas_int      ldx,
+                                  rocblas_stride   stride_x,
+                                  void*            y,
+                                  rocblas_datatype y_type,
+                                  rocblas_int      ldy,
+                                  rocblas_stride   stride_y,
+                                  rocblas_int      batch_count,
+                                  const float*     scale,
+                                  float*           amax,
+                                  uint32_t         flags)
+try
+{
+    return rocblas_convert_ex_impl(handle,
+                                   m,
+                                   n,
+                                   x,
+                                   x_type,
+                                   ldx,
+                                   stride_x,
+                                   y,
+                                   y_type,
+                                   ldy,
+                                   stride_y,
+                                   batch_count,
+                                   scale,
+                                   amax,
+                                   flags);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
@@ -59,9 +59,11 @@ namespace
         }
 
         auto layer_mode = handle->layer_mode;
+
+        rocblas_api_scope api_scope(handle, name);
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-              | rocblas_layer_mode_log_profile))
+              | rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
         {
             auto x_type_str      = rocblas_datatype_string(x_type);
             auto y_type_str      = rocblas_datatype_string(y_type);
@@ -104,7 +106,7 @@ namespace
                           ex_type_str);
             }
 
-            if(layer_mode & rocblas_layer_mode_log_profile)
+            if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             {
                 log_profile(handle,
                             name,
@@ -140,7 +142,7 @@ namespace
         if(!x || !y || !result)
             return rocblas_status_invalid_pointer;
 
-        auto w_mem = handle->device_malloc(dev_bytes);
+        auto w_mem = handle->reduction_malloc(dev_bytes);
         if(!w_mem)
             return rocblas_status_memory_error;
 
@@ -0,0 +1,319 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * The _fast entry points of scal, axpy, gemv and gemm call the internal templates directly. The
+ * arguments are taken as valid, and the logging, numerics checks, call counters, events and
+ * epilogues of the handle are skipped, so that the host time of a call at tiny sizes is that of
+ * the launch of its kernels.
+ */
+
+#include "../blas1/rocblas_axpy.hpp"
+#include "../blas1/rocblas_scal.hpp"
+#include "../blas2/rocblas_gemv.hpp"
+#include "../blas3/rocblas_gemm.hpp"
+#include "handle.hpp"
+
+namespace
+{
+    // The device of the handle is current for the call, as in rocblas_api_scope
+    class rocblas_fast_scope
+    {
+        int saved_device;
+
+    public:
+        explicit rocblas_fast_scope(rocblas_handle handle)
+            : saved_device(rocblas_current_device)
+        {
+            rocblas_current_device = handle->getDevice();
+        }
+
+        ~rocblas_fast_scope()
+        {
+            rocblas_current_device = saved_device;
+        }
+    };
+
+    template <typename T>
+    rocblas_status rocblas_scal_fast_impl(rocblas_handle handle,
+                                          rocblas_int    n,
+                                          const T*       alpha,
+                                          T*             x,
+                                          rocblas_int    incx)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+        if(n <= 0)
+            return rocblas_status_success;
+
+        rocblas_fast_scope scope(handle);
+        return rocblas_internal_scal_template(handle, n, alpha, 0, x, 0, incx, 0, 1);
+    }
+
+    template <typename T>
+    rocblas_status rocblas_axpy_fast_impl(rocblas_handle handle,
+                                          rocblas_int    n,
+                                          const T*       alpha,
+                                          const T*       x,
+                                          rocblas_int    incx,
+                                          T*             y,
+                                          rocblas_int    incy)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+        if(n <= 0)
+            return rocblas_status_success;
+
+        rocblas_fast_scope scope(handle);
+        return rocblas_internal_axpy_template(handle, n, alpha, 0, x, 0, incx, 0, y, 0, incy, 0, 1);
+    }
+
+    template <typename T>
+    rocblas_status rocblas_gemv_fast_impl(rocblas_handle    handle,
+                                          rocblas_operation transA,
+                                          rocblas_int       m,
+                                          rocblas_int       n,
+                                          const T*          alpha,
+                                          const T*          A,
+                                          rocblas_int       lda,
+                                          const T*          x,
+                                          rocblas_int       incx,
+                                          const T*          beta,
+                                          T*                y,
+                                          rocblas_int       incy)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // row major op(A) is op(A)^T of column major A, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+        {
+            if(rocblas_is_complex<T> && transA == rocblas_operation_conjugate_transpose)
+                return rocblas_status_not_implemented;
+            transA = rocblas_row_major_transpose<T>(transA);
+            std::swap(m, n);
+        }
+
+        size_t dev_bytes = rocblas_internal_gemv_kernel_workspace_size<T>(transA, m, n, 1);
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(dev_bytes);
+        if(m <= 0 || n <= 0)
+            return rocblas_status_success;
+
+        rocblas_fast_scope scope(handle);
+
+        // only the transposed kernels reduce through the workspace
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(dev_bytes && !w_mem)
+            return rocblas_status_memory_error;
+
+        return rocblas_internal_gemv_template(handle,
+                                              transA,
+                                              m,
+                                              n,
+                                              alpha,
+                                              0,
+                                              A,
+                                              0,
+                                              lda,
+                                              0,
+                                              x,
+                                              0,
+                                              incx,
+                                              0,
+                                              beta,
+                                              0,
+                                              y,
+                                              0,
+                                              incy,
+                                              0,
+                                              1,
+                                              dev_bytes ? (T*)w_mem[0] : nullptr);
+    }
+
+    template <typename T>
+    rocblas_status rocblas_gemm_fast_impl(rocblas_handle    handle,
+                                          rocblas_operation trans_a,
+                                          rocblas_operation trans_b,
+                                          rocblas_int       m,
+                                          rocblas_int       n,
+                                          rocblas_int       k,
+                                          const T*          alpha,
+                                          const T*          A,
+                                          rocblas_int       lda,
+                                          const T*          B,
+                                          rocblas_int       ldb,
+                                          const T*          beta,
+                                          T*                C,
+                                          rocblas_int       ldc)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // row major C^T = op(B)^T*op(A)^T is a column major gemm, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+        {
+            std::swap(trans_a, trans_b);
+            std::swap(m, n);
+            std::swap(A, B);
+            std::swap(lda, ldb);
+        }
+
+        if(m <= 0 || n <= 0)
+            return rocblas_status_success;
+
+        rocblas_fast_scope scope(handle);
+        return rocblas_internal_gemm_template(handle,
+                                              trans_a,
+                                              trans_b,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              0,
+                                              lda,
+                                              0,
+                                              B,
+                                              0,
+                                              ldb,
+                                              0,
+                                              beta,
+                                              C,
+                                              0,
+                                              ldc,
+                                              0,
+                                              1);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+extern "C" {
+
+#define IMPL(name_, T_)                                                                 \
+    rocblas_status name_(                                                               \
+        rocblas_handle handle, rocblas_int n, const T_* alpha, T_* x, rocblas_int incx) \
+    try                                                                                 \
+    {                                                                                   \
+        return rocblas_scal_fast_impl(handle, n, alpha, x, incx);                       \
+    }                                                                                   \
+    catch(...)                                                                          \
+    {                                                                                   \
+        return exception_to_rocblas_status();                                           \
+    }
+
+IMPL(rocblas_sscal_fast, float);
+IMPL(rocblas_dscal_fast, double);
+
+#undef IMPL
+
+#define IMPL(name_, T_)                                                    \
+    rocblas_status name_(rocblas_handle handle,                            \
+                         rocblas_int    n,                                 \
+                         const T_*      alpha,                             \
+                         const T_*      x,                                 \
+                         rocblas_int    incx,                              \
+                         T_*            y,                                 \
+                         rocblas_int    incy)                              \
+    try                                                                    \
+    {                                                                      \
+        return rocblas_axpy_fast_impl(handle, n, alpha, x, incx, y, incy); \
+    }                                                                      \
+    catch(...)                                                             \
+    {                                                                      \
+        return exception_to_rocblas_status();                              \
+    }
+
+IMPL(rocblas_saxpy_fast, float);
+IMPL(rocblas_daxpy_fast, double);
+
+#undef IMPL
+
+#define IMPL(name_, T_)                                                   \
+    rocblas_status name_(rocblas_handle    handle,                        \
+                         rocblas_operation transA,                        \
+                         rocblas_int       m,                             \
+                         rocblas_int       n,                             \
+                         const T_*         alpha,                         \
+                         const T_*         A,                             \
+                         rocblas_int       lda,                           \
+                         const T_*         x,                             \
+                         rocblas_int       incx,                          \
+                         const T_*         beta,                          \
+                         T_*               y,                             \
+                         rocblas_int       incy)                          \
+    try                                                                   \
+    {                                                                     \
+        return rocblas_gemv_fast_impl(                                    \
+            handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy); \
+    }                                                                     \
+    catch(...)                                                            \
+    {                                                                     \
+        return exception_to_rocblas_status();                             \
+    }
+
+IMPL(rocblas_sgemv_fast, float);
+IMPL(rocblas_dgemv_fast, double);
+
+#undef IMPL
+
+#define IMPL(name_, T_)                                                              \
+    rocblas_status name_(rocblas_handle    handle,                                   \
+                         rocblas_operation trans_a,                                  \
+                         rocblas_operation trans_b,                                  \
+                         rocblas_int       m,                                        \
+                         rocblas_int       n,                                        \
+                         rocblas_int       k,                                        \
+                         const T_*         alpha,                                    \
+                         const T_*         A,                                        \
+                         rocblas_int       lda,                                      \
+                         const T_*         B,                                        \
+                         rocblas_int       ldb,                                      \
+                         const T_*         beta,                                     \
+                         T_*               C,                                        \
+                         rocblas_int       ldc)                                      \
+    try                                                                              \
+    {                                                                                \
+        return rocblas_gemm_fast_impl(                                               \
+            handle, trans_a, trans_b, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc); \
+    }                                                                                \
+    catch(...)                                                                       \
+    {                                                                                \
+        return exception_to_rocblas_status();                                        \
+    }
+
+IMPL(rocblas_sgemm_fast, float);
+IMPL(rocblas_dgemm_fast, double);
+
+#undef IMPL
+
+} // extern "C"
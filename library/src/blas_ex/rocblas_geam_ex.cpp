@@ -54,16 +54,30 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        // row major D^T = op(B)^T op op(A)^T is a column major geam_ex, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+        {
+            std::swap(transA, transB);
+            std::swap(m, n);
+            std::swap(A, B);
+            std::swap(a_type, b_type);
+            std::swap(lda, ldb);
+        }
+
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
         // Perform logging
         auto layer_mode = handle->layer_mode;
+
+        rocblas_api_scope api_scope(handle, "rocblas_geam_ex");
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-              | rocblas_layer_mode_log_profile))
+              | rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
         {
             char trans_a_letter, trans_b_letter;
-            if(layer_mode & (rocblas_layer_mode_log_bench | rocblas_layer_mode_log_profile))
+            if(layer_mode
+               & (rocblas_layer_mode_log_bench | rocblas_layer_mode_log_profile
+                  | rocblas_layer_mode_roctx))
             {
                 trans_a_letter = rocblas_transpose_letter(transA);
                 trans_b_letter = rocblas_transpose_letter(transB);
@@ -152,7 +166,7 @@ namespace
                     }
                 }
 
-                if(layer_mode & rocblas_layer_mode_log_profile)
+                if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                 {
                     log_profile(handle,
                                 "rocblas_geam_ex",
@@ -218,7 +232,7 @@ namespace
                               compute_type_string,
                               geam_ex_op);
                 }
-                if(layer_mode & rocblas_layer_mode_log_profile)
+                if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                 {
                     log_profile(handle,
                                 "rocblas_geam_ex",
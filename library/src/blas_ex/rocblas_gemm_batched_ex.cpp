@@ -62,6 +62,16 @@ rocblas_status rocblas_gemm_batched_ex_get_solutions(rocblas_handle    handle,
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        // row major C^T = op(B)^T*op(A)^T is a column major gemm, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+        {
+            std::swap(trans_a, trans_b);
+            std::swap(m, n);
+            std::swap(a, b);
+            std::swap(a_type, b_type);
+            std::swap(lda, ldb);
+        }
+
         const bool HPA = compute_type == rocblas_datatype_f32_r
                          && (a_type == rocblas_datatype_f16_r || a_type == rocblas_datatype_bf16_r);
 
@@ -60,6 +60,16 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        // row major C^T = op(B)^T*op(A)^T is a column major gemm, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+        {
+            std::swap(trans_a, trans_b);
+            std::swap(m, n);
+            std::swap(a, b);
+            std::swap(a_type, b_type);
+            std::swap(lda, ldb);
+        }
+
         const bool HPA = compute_type == rocblas_datatype_f32_r
                          && (a_type == rocblas_datatype_f16_r || a_type == rocblas_datatype_bf16_r);
 
@@ -72,16 +82,19 @@ namespace
             handle, alpha, beta, alpha_h, beta_h, k, compute_type));
         auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
 
+        rocblas_api_scope api_scope(handle, ROCBLAS_API_STR(rocblas_gemm_batched_ex));
         if(!handle->is_device_memory_size_query())
         {
             // Perform logging
             auto layer_mode = handle->layer_mode;
             if(layer_mode
                & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-                  | rocblas_layer_mode_log_profile))
+                  | rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             {
                 char trans_a_letter, trans_b_letter;
-                if(layer_mode & (rocblas_layer_mode_log_bench | rocblas_layer_mode_log_profile))
+                if(layer_mode
+                   & (rocblas_layer_mode_log_bench | rocblas_layer_mode_log_profile
+                      | rocblas_layer_mode_roctx))
                 {
                     trans_a_letter = rocblas_transpose_letter(trans_a);
                     trans_b_letter = rocblas_transpose_letter(trans_b);
@@ -178,7 +191,7 @@ namespace
                     }
                 }
 
-                if(layer_mode & rocblas_layer_mode_log_profile)
+                if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                 {
                     log_profile(handle,
                                 ROCBLAS_API_STR(rocblas_gemm_batched_ex),
@@ -254,6 +267,11 @@ namespace
             return validArgs;
         }
 
+        // the scalars of the batches apply to the rocblas_int interface only
+        const rocblas_gemm_batch_scalars* batch_scalars
+            = std::is_same_v<API_INT, rocblas_int> ? handle->get_gemm_batch_scalars() : nullptr;
+        auto saved_batch_scalars = handle->push_gemm_batch_scalars(batch_scalars);
+
         auto stride_a = rocblas_stride(lda) * (trans_a == rocblas_operation_none ? k : m);
         auto stride_b = rocblas_stride(ldb) * (trans_b == rocblas_operation_none ? n : k);
         auto stride_c = rocblas_stride(ldc) * n;
@@ -231,3 +231,19 @@ inline rocblas_status rocblas_gemm_ex_arg_check(rocblas_handle    handle,
 
     return rocblas_status_continue;
 }
+
+// Checks the epilogue set on the handle against the gemm_ex problem it is applied to
+template <typename API_INT>
+inline rocblas_status rocblas_gemm_epilogue_arg_check(const rocblas_gemm_epilogue& epilogue,
+                                                      API_INT                      m,
+                                                      rocblas_datatype             compute_type)
+{
+    if(compute_type != rocblas_datatype_f16_r && compute_type != rocblas_datatype_f32_r
+       && compute_type != rocblas_datatype_f64_r)
+        return rocblas_status_not_implemented;
+
+    if(epilogue.aux && epilogue.ldaux < m)
+        return rocblas_status_invalid_size;
+
+    return rocblas_status_success;
+}
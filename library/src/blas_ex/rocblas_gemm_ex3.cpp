@@ -56,6 +56,17 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        // row major C^T = op(B)^T*op(A)^T is a column major gemm, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+        {
+            std::swap(trans_a, trans_b);
+            std::swap(m, n);
+            std::swap(a, b);
+            std::swap(a_type, b_type);
+            std::swap(lda, ldb);
+        }
+
+        rocblas_api_scope api_scope(handle, "rocblas_gemm_ex3");
         if(handle->getArch() >= 940 && handle->getArch() < 1000)
         {
             // Copy alpha and beta to host if on device
@@ -75,10 +86,12 @@ namespace
                 auto layer_mode = handle->layer_mode;
                 if(layer_mode
                    & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-                      | rocblas_layer_mode_log_profile))
+                      | rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                 {
                     char trans_a_letter, trans_b_letter;
-                    if(layer_mode & (rocblas_layer_mode_log_bench | rocblas_layer_mode_log_profile))
+                    if(layer_mode
+                       & (rocblas_layer_mode_log_bench | rocblas_layer_mode_log_profile
+                          | rocblas_layer_mode_roctx))
                     {
                         trans_a_letter = rocblas_transpose_letter(trans_a);
                         trans_b_letter = rocblas_transpose_letter(trans_b);
@@ -171,7 +184,7 @@ namespace
                         }
                     }
 
-                    if(layer_mode & rocblas_layer_mode_log_profile)
+                    if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                     {
                         log_profile(handle,
                                     "rocblas_gemm_ex3",
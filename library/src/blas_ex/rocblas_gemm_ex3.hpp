@@ -119,6 +119,58 @@ ROCBLAS_KERNEL_ILF uint32_t prand_generator(int64_t tid, uint32_t seed, T val)
     return 0;
 }
 
+/*
+ *  Seeds of the stochastic rounding of A, B and D for one call, drawn from the Philox4x32-10
+ *  counter-based generator keyed by the handle, whose counter advances by one per call
+ */
+inline void rocblas_gemm_ex3_stochastic_rounding_seeds(rocblas_handle handle,
+                                                       uint32_t&      seedA,
+                                                       uint32_t&      seedB,
+                                                       uint32_t&      seedC)
+{
+    // seeds fixed by the environment, read once
+    static const auto env_seeds = [] {
+        std::array<std::pair<bool, uint32_t>, 3> seeds;
+        const char*                              names[] = {"SR_SEED_A", "SR_SEED_B", "SR_SEED_C"};
+        for(int i = 0; i < 3; i++)
+        {
+            const char* value = std::getenv(names[i]);
+            seeds[i] = {value != nullptr, value ? uint32_t(std::strtol(value, nullptr, 10)) : 0};
+        }
+        return seeds;
+    }();
+
+    if(!handle->stochastic_rounding_seeded)
+    {
+        std::random_device rd;
+        handle->stochastic_rounding_key    = (uint64_t(rd()) << 32) | rd();
+        handle->stochastic_rounding_seeded = true;
+    }
+
+    uint64_t counter = handle->stochastic_rounding_counter++;
+    uint64_t k64     = handle->stochastic_rounding_key;
+    uint32_t c[4]    = {uint32_t(counter), uint32_t(counter >> 32), 0, 0};
+    uint32_t key[2]  = {uint32_t(k64), uint32_t(k64 >> 32)};
+
+    for(int round = 0; round < 10; round++)
+    {
+        uint64_t p0 = uint64_t(0xD2511F53) * c[0];
+        uint64_t p1 = uint64_t(0xCD9E8D57) * c[2];
+        uint32_t n0 = uint32_t(p1 >> 32) ^ c[1] ^ key[0];
+        uint32_t n2 = uint32_t(p0 >> 32) ^ c[3] ^ key[1];
+        c[1]        = uint32_t(p1);
+        c[3]        = uint32_t(p0);
+        c[0]        = n0;
+        c[2]        = n2;
+        key[0] += 0x9E3779B9;
+        key[1] += 0xBB67AE85;
+    }
+
+    seedA = env_seeds[0].first ? env_seeds[0].second : c[0];
+    seedB = env_seeds[1].first ? env_seeds[1].second : c[1];
+    seedC = env_seeds[2].first ? env_seeds[2].second : c[2];
+}
+
 /***************************************************************************************
     Quantization: New single matrix conversion routine
 ****************************************************************************************/
@@ -219,27 +271,28 @@ template <
                      int> = 0>
 __attribute__((amdgpu_flat_work_group_size(DIM_M * DIM_N, DIM_M* DIM_N)))
 ROCBLAS_KERNEL(DIM_M* DIM_N)
-    gemm_batched_general_kernel(rocblas_int    M,
-                                rocblas_int    N,
-                                rocblas_int    K,
-                                const Tacc     alpha,
-                                const TiA*     dA_array, // NOTE: may work only for non-batch
-                                rocblas_int    lda,
-                                rocblas_stride stride_a,
-                                const TiB*     dB_array,
-                                rocblas_int    ldb,
-                                rocblas_stride stride_b,
-                                const Tacc     beta,
-                                const To*      dC_array,
-                                rocblas_int    ldc,
-                                rocblas_stride stride_c,
-                                To*            dD_array,
-                                rocblas_int    ldd,
-                                rocblas_stride stride_d,
-                                rocblas_int    batch_count,
-                                uint32_t       seedA,
-                                uint32_t       seedB,
-                                uint32_t       seedC)
+    gemm_batched_general_kernel(rocblas_int             M,
+                                rocblas_int             N,
+                                rocblas_int             K,
+                                const Tacc              alpha,
+                                const TiA*              dA_array, // may work only for non-batch
+                                rocblas_int             lda,
+                                rocblas_stride          stride_a,
+                                const TiB*              dB_array,
+                                rocblas_int             ldb,
+                                rocblas_stride          stride_b,
+                                const Tacc              beta,
+                                const To*               dC_array,
+                                rocblas_int             ldc,
+                                rocblas_stride          stride_c,
+                                To*                     dD_array,
+                                rocblas_int             ldd,
+                                rocblas_stride          stride_d,
+                                rocblas_int             batch_count,
+                                uint32_t                seedA,
+                                uint32_t                seedB,
+                                uint32_t                seedC,
+                                rocblas_gemm_ex3_scales scales)
 {
     int thx  = threadIdx.x; // thread's m position in C
     int thy  = threadIdx.y; // thread's n position in C
@@ -378,6 +431,11 @@ ROCBLAS_KERNEL(DIM_M* DIM_N)
         __syncthreads();
     }
 
+    const float* scale_a = scales.scale_a ? scales.scale_a + blz * scales.stride_scale_a : nullptr;
+    const float* scale_b = scales.scale_b ? scales.scale_b + blz * scales.stride_scale_b : nullptr;
+    Tacc         scale_d = scales.scale_d ? Tacc(*scales.scale_d) : Tacc(1);
+    float        d_max   = 0;
+
     for(int n = 0; n < BLK_N / DIM_N; ++n)
     {
         for(int m = 0; m < BLK_M / DIM_M; ++m)
@@ -386,34 +444,31 @@ ROCBLAS_KERNEL(DIM_M* DIM_N)
             int coord_dCn = bly * BLK_N + n * DIM_N + thy;
             if(coord_dCn < N && coord_dCm < M)
             {
-                if(BETA_EQ_ZERO)
-                {
-                    int      gid = coord_dCn * ldc + coord_dCm;
-                    uint32_t rng = 0;
-                    if(stochastic_rounding)
-                        rng = prand_generator<Tacc>(gid, seedC, alpha * rC[n][m]);
-
-                    dD[coord_dCn * ldc + coord_dCm]
-                        = explicit_downcast<To, Tacc, stochastic_rounding>(alpha * rC[n][m], rng);
-                }
-                else
-                {
-                    int      gid = coord_dCn * ldc + coord_dCm;
-                    uint32_t rng = 0;
-                    if(stochastic_rounding)
-                        rng = prand_generator<Tacc>(
-                            gid,
-                            seedC,
-                            alpha * rC[n][m] + beta * dC[coord_dCn * size_t(ldc) + coord_dCm]);
-
-                    dD[coord_dCn * ldc + coord_dCm]
-                        = explicit_downcast<To, Tacc, stochastic_rounding>(
-                            (alpha * rC[n][m] + beta * dC[coord_dCn * size_t(ldc) + coord_dCm]),
-                            rng);
-                }
+                // dequantize the product with the scales of its row and column
+                Tacc ab = alpha * rC[n][m];
+                if(scale_a)
+                    ab *= Tacc(scale_a[coord_dCm / scales.block_a]);
+                if(scale_b)
+                    ab *= Tacc(scale_b[coord_dCn / scales.block_b]);
+
+                Tacc v = BETA_EQ_ZERO ? ab : ab + beta * dC[coord_dCn * size_t(ldc) + coord_dCm];
+                v *= scale_d;
+                d_max = fmax(d_max, fabs(float(v)));
+
+                int      gid = coord_dCn * ldc + coord_dCm;
+                uint32_t rng = 0;
+                if(stochastic_rounding)
+                    rng = prand_generator<Tacc>(gid, seedC, v);
+
+                dD[coord_dCn * ldc + coord_dCm]
+                    = explicit_downcast<To, Tacc, stochastic_rounding>(v, rng);
             }
         }
     }
+
+    // non-negative floats order like their bits
+    if(scales.amax_d)
+        atomicMax((int*)scales.amax_d, __float_as_int(d_max));
 }
 
 /***************************************************************************************/
@@ -505,32 +560,13 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
     bool     stochastic_rounding = flags & rocblas_gemm_flags_stochastic_rounding;
     uint32_t seedA = 0, seedB = 0, seedC = 0;
     if(stochastic_rounding)
-    {
-        std::random_device                      rd;
-        std::mt19937                            gen(rd());
-        std::uniform_int_distribution<uint32_t> distribution(0, 0xFFFFFFFF);
-
-        const char* sr_seed_string_a = std::getenv("SR_SEED_A");
-        const char* sr_seed_string_b = std::getenv("SR_SEED_B");
-        const char* sr_seed_string_c = std::getenv("SR_SEED_C");
-
-        if(sr_seed_string_a != NULL)
-            seedA = std::strtol(sr_seed_string_a, NULL, 10);
-        else
-            seedA = distribution(gen);
-
-        if(sr_seed_string_b != NULL)
-            seedB = std::strtol(sr_seed_string_b, NULL, 10);
-        else
-            seedB = distribution(gen);
-
-        if(sr_seed_string_c != NULL)
-            seedC = std::strtol(sr_seed_string_c, NULL, 10);
-        else
-            seedC = distribution(gen);
-    }
+        rocblas_gemm_ex3_stochastic_rounding_seeds(handle, seedA, seedB, seedC);
+
+    rocblas_gemm_ex3_scales scales = handle->gemm_ex3_scales;
 
     hipStream_t stream = handle->get_stream();
+    if(scales.amax_d)
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(scales.amax_d, 0, sizeof(float), stream));
     const int   dim_m  = 16;
     const int   dim_n  = 16;
     const int   blk_m  = 32;
@@ -587,7 +623,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             ldd,
             stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
 
         else // non SR
             ROCBLAS_LAUNCH_KERNEL((gemm_batched_general_kernel
@@ -632,7 +668,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             ldd,
             stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
     }
 
     else if(rocblas_operation_transpose == trans_a && rocblas_operation_none == trans_b)
@@ -658,7 +694,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
 
         else // non SR
             ROCBLAS_LAUNCH_KERNEL((gemm_batched_general_kernel
@@ -681,7 +717,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
 
 
     }
@@ -708,7 +744,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
         else // non SR
             ROCBLAS_LAUNCH_KERNEL((gemm_batched_general_kernel
                                     <TiA,
@@ -730,7 +766,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
     }
 
     else if(rocblas_operation_transpose == trans_a && rocblas_operation_transpose == trans_b)
@@ -756,7 +792,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
         else // non SR
             ROCBLAS_LAUNCH_KERNEL((gemm_batched_general_kernel
                                     <TiA,
@@ -778,7 +814,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
 
     }
 
@@ -805,7 +841,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
         else // non SR
             ROCBLAS_LAUNCH_KERNEL((gemm_batched_general_kernel
                                     <TiA,
@@ -827,7 +863,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
     }
 
     else if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_none == trans_b)
@@ -853,7 +889,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
         else // non SR
             ROCBLAS_LAUNCH_KERNEL((gemm_batched_general_kernel
                                     <TiA,
@@ -875,7 +911,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
     }
 
     else if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_transpose == trans_b)
@@ -901,7 +937,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
         else // no SR
             ROCBLAS_LAUNCH_KERNEL((gemm_batched_general_kernel
                                     <TiA,
@@ -923,7 +959,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
     }
 
     else if(rocblas_operation_none == trans_a && rocblas_operation_conjugate_transpose == trans_b)
@@ -949,7 +985,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
         else // non SR
             ROCBLAS_LAUNCH_KERNEL((gemm_batched_general_kernel
                                     <TiA,
@@ -971,7 +1007,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
     }
 
     else if(rocblas_operation_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
@@ -997,7 +1033,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
         else // non SR
             ROCBLAS_LAUNCH_KERNEL((gemm_batched_general_kernel
                                     <TiA,
@@ -1019,7 +1055,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
     }
         // clang-format on
     }
@@ -1058,7 +1094,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
                     ldd,
                     stride_d,
                     batch_count,
-                    seedA, seedB, seedC);
+                    seedA, seedB, seedC, scales);
         else // non SR
             ROCBLAS_LAUNCH_KERNEL((gemm_batched_general_kernel
                                     <TiA,
@@ -1089,7 +1125,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
                     ldd,
                     stride_d,
                     batch_count,
-                    seedA, seedB, seedC);
+                    seedA, seedB, seedC, scales);
     }
     else if(rocblas_operation_transpose == trans_a && rocblas_operation_none == trans_b)
     {
@@ -1114,7 +1150,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
         else // non SR
             ROCBLAS_LAUNCH_KERNEL((gemm_batched_general_kernel
                                     <TiA,
@@ -1136,7 +1172,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
     }
 
     else if(rocblas_operation_none == trans_a && rocblas_operation_transpose == trans_b)
@@ -1162,7 +1198,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
         else // non SR
             ROCBLAS_LAUNCH_KERNEL((gemm_batched_general_kernel
                                     <TiA,
@@ -1184,7 +1220,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
     }
 
     else if(rocblas_operation_transpose == trans_a && rocblas_operation_transpose == trans_b)
@@ -1210,7 +1246,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
         else // non SR
             ROCBLAS_LAUNCH_KERNEL((gemm_batched_general_kernel
                                     <TiA,
@@ -1232,7 +1268,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
 
     }
     else if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
@@ -1258,7 +1294,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
         else // non SR
             ROCBLAS_LAUNCH_KERNEL((gemm_batched_general_kernel
                                     <TiA,
@@ -1280,7 +1316,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
     }
     else if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_none == trans_b)
     {
@@ -1305,7 +1341,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
         else // non SR
             ROCBLAS_LAUNCH_KERNEL((gemm_batched_general_kernel
                                     <TiA,
@@ -1327,7 +1363,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
     }
     else if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_transpose == trans_b)
     {
@@ -1352,7 +1388,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
         else // non SR
             ROCBLAS_LAUNCH_KERNEL((gemm_batched_general_kernel
                                     <TiA,
@@ -1374,7 +1410,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
     }
     else if(rocblas_operation_none == trans_a && rocblas_operation_conjugate_transpose == trans_b)
     {
@@ -1399,7 +1435,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
         else // non SR
             ROCBLAS_LAUNCH_KERNEL((gemm_batched_general_kernel
                                     <TiA,
@@ -1421,7 +1457,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
 
     }
     else if(rocblas_operation_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
@@ -1447,7 +1483,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
         else // non SR
             ROCBLAS_LAUNCH_KERNEL((gemm_batched_general_kernel
                                     <TiA,
@@ -1469,7 +1505,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scales);
 
     }
         // clang-format on
@@ -1478,6 +1514,37 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
     return rocblas_status_success;
 }
 
+template <typename T>
+constexpr bool rocblas_is_8bit_float
+    = std::is_same_v<T, rocblas_f8> || std::is_same_v<T, rocblas_bf8>;
+
+// The type tuples, with f32 compute, which gemm_ex3_typecasting_tensile hands to Tensile without
+// converting A, B, C or D
+template <typename TiA, typename TiB, typename To>
+constexpr bool rocblas_gemm_ex3_native_types
+    = rocblas_is_8bit_float<TiA> && rocblas_is_8bit_float<TiB>
+      && (std::is_same_v<To, float> || std::is_same_v<To, rocblas_half>
+          || (std::is_same_v<To, rocblas_f8> && std::is_same_v<TiA, rocblas_f8>
+              && std::is_same_v<TiB, rocblas_f8>)
+          || (std::is_same_v<To, rocblas_bf8>
+              && !(std::is_same_v<TiA, rocblas_f8> && std::is_same_v<TiB, rocblas_f8>)));
+
+// Skinny problems have no efficient Tensile kernel, and the Tensile problems of gemm_ex3 carry
+// no scales, so both take the source kernels
+inline bool rocblas_gemm_ex3_use_fallback(rocblas_handle    handle,
+                                          rocblas_operation trans_a,
+                                          rocblas_operation trans_b,
+                                          rocblas_int       m,
+                                          rocblas_int       n)
+{
+    const rocblas_gemm_ex3_scales& scales = handle->gemm_ex3_scales;
+    return (trans_a == rocblas_operation_transpose && trans_b == rocblas_operation_transpose
+            && n < 4)
+           || (trans_a == rocblas_operation_none
+               && (m < 4 || (trans_b == rocblas_operation_transpose && n < 4)))
+           || scales.scale_a || scales.scale_b || scales.scale_d || scales.amax_d;
+}
+
 template <bool BATCHED,
           typename TiA,
           typename TiB = TiA,
@@ -1625,30 +1692,7 @@ rocblas_status gemm_ex3_quantize(rocblas_handle     handle,
 
     uint32_t seedA = 0, seedB = 0, seedC = 0;
     if(stochastic_rounding)
-    {
-        std::random_device                      rd;
-        std::mt19937                            gen(rd());
-        std::uniform_int_distribution<uint32_t> distribution(0, 0xFFFFFFFF);
-
-        const char* sr_seed_string_a = std::getenv("SR_SEED_A");
-        const char* sr_seed_string_b = std::getenv("SR_SEED_B");
-        const char* sr_seed_string_c = std::getenv("SR_SEED_C");
-
-        if(sr_seed_string_a != NULL)
-            seedA = std::strtol(sr_seed_string_a, NULL, 10);
-        else
-            seedA = distribution(gen);
-
-        if(sr_seed_string_b != NULL)
-            seedB = std::strtol(sr_seed_string_b, NULL, 10);
-        else
-            seedB = distribution(gen);
-
-        if(sr_seed_string_c != NULL)
-            seedC = std::strtol(sr_seed_string_c, NULL, 10);
-        else
-            seedC = distribution(gen);
-    }
+        rocblas_gemm_ex3_stochastic_rounding_seeds(handle, seedA, seedB, seedC);
 
     // A conversion
     // clang-format off
@@ -2155,8 +2199,7 @@ rocblas_status gemm_ex3_typecasting_tensile(rocblas_handle    handle,
        || !isAligned(d, sizeof(To)))
         return rocblas_status_invalid_size;
 
-    bool fallback = (trans_a == rocblas_operation_transpose && trans_b == rocblas_operation_transpose && n<4) ||
-            (trans_a == rocblas_operation_none && (m<4 || (trans_b == rocblas_operation_transpose && n<4)));
+    bool fallback = rocblas_gemm_ex3_use_fallback(handle, trans_a, trans_b, m, n);
 
     if(check_numerics && !std::is_same_v<TiA, signed char> && !std::is_same_v<TiB, signed char>)
     {
@@ -2719,6 +2762,147 @@ rocblas_status rocblas_gemm_ex3_template(rocblas_handle      handle,
 
 #undef EX_TYPECASTING_PARM
 
+/*
+ * Single launch batched gemm_ex3 through Tensile's pointer-array path.
+ * Only used when A and B are 8-bit floats which Tensile consumes directly, so the
+ * device pointer arrays can be handed to Tensile without copying them to the host.
+ */
+template <typename TiA, typename TiB, typename To>
+rocblas_status gemm_ex3_tensile_batched(rocblas_handle    handle,
+                                        rocblas_operation trans_a,
+                                        rocblas_operation trans_b,
+                                        rocblas_int       m,
+                                        rocblas_int       n,
+                                        rocblas_int       k,
+                                        const void*       alpha,
+                                        const void*       a,
+                                        rocblas_int       offset_a,
+                                        rocblas_int       lda,
+                                        const void*       b,
+                                        rocblas_int       offset_b,
+                                        rocblas_int       ldb,
+                                        const void*       beta,
+                                        const void*       c,
+                                        rocblas_int       offset_c,
+                                        rocblas_int       ldc,
+                                        void*             d,
+                                        rocblas_int       offset_d,
+                                        rocblas_int       ldd,
+                                        rocblas_int       batch_count,
+                                        rocblas_gemm_flags flags)
+{
+    float alpha_h, beta_h;
+    RETURN_IF_ROCBLAS_ERROR(
+        rocblas_copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, k));
+    auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+    if(!isAligned(a, sizeof(TiA*)) || !isAligned(b, sizeof(TiB*)) || !isAligned(c, sizeof(To*))
+       || !isAligned(d, sizeof(To*)))
+        return rocblas_status_invalid_size;
+
+    auto batch_a = (const TiA* const*)a;
+    auto batch_b = (const TiB* const*)b;
+    auto batch_c = (const To* const*)c;
+    auto batch_d = (To* const*)d;
+
+    rocblas_stride stride_a = rocblas_stride(lda) * (trans_a == rocblas_operation_none ? k : m);
+    rocblas_stride stride_b = rocblas_stride(ldb) * (trans_b == rocblas_operation_none ? n : k);
+    rocblas_stride stride_c = rocblas_stride(ldc) * n;
+    rocblas_stride stride_d = rocblas_stride(ldd) * n;
+
+    auto check_numerics = handle->check_numerics;
+    if(check_numerics)
+    {
+        bool           is_input = true;
+        rocblas_status gemm_ex_check_numerics_status
+            = rocblas_gemm_check_numerics("rocblas_gemm_batched_ex3",
+                                          handle,
+                                          trans_a,
+                                          trans_b,
+                                          m,
+                                          n,
+                                          k,
+                                          batch_a,
+                                          offset_a,
+                                          lda,
+                                          stride_a,
+                                          batch_b,
+                                          offset_b,
+                                          ldb,
+                                          stride_b,
+                                          batch_c,
+                                          offset_c,
+                                          ldc,
+                                          stride_c,
+                                          batch_count,
+                                          check_numerics,
+                                          is_input);
+        if(gemm_ex_check_numerics_status != rocblas_status_success)
+            return gemm_ex_check_numerics_status;
+    }
+
+    RocblasContractionProblem<TiA, To, float, TiB, TiA, TiB> problem{
+        handle,   trans_a, trans_b,  m,        n,           k,        (const float*)alpha,
+        nullptr,  batch_a, lda,      stride_a, offset_a,    nullptr,  batch_b,
+        ldb,      stride_b, offset_b, (const float*)beta,   nullptr,  batch_c,
+        ldc,      stride_c, offset_c, nullptr,  batch_d,     ldd,      stride_d,
+        offset_d, batch_count, false, flags};
+
+    rocblas_status status = runContractionProblem(problem);
+
+    if(check_numerics)
+    {
+        bool           is_input = false;
+        rocblas_status gemm_ex_check_numerics_status
+            = rocblas_gemm_check_numerics("rocblas_gemm_batched_ex3",
+                                          handle,
+                                          trans_a,
+                                          trans_b,
+                                          m,
+                                          n,
+                                          k,
+                                          batch_a,
+                                          offset_a,
+                                          lda,
+                                          stride_a,
+                                          batch_b,
+                                          offset_b,
+                                          ldb,
+                                          stride_b,
+                                          batch_d,
+                                          offset_d,
+                                          ldd,
+                                          stride_d,
+                                          batch_count,
+                                          check_numerics,
+                                          is_input);
+        if(gemm_ex_check_numerics_status != rocblas_status_success)
+            return gemm_ex_check_numerics_status;
+    }
+
+    return status;
+}
+
+// Runs the per-batch fallback of the batched ex3 functions, spreading the batches across the
+// auxiliary streams of the handle if it has any. A size query of the first batch tells whether
+// the batches need device workspace, which they cannot share when running concurrently.
+template <typename F>
+rocblas_status rocblas_gemm_ex3_run_batches(rocblas_handle handle, rocblas_int batch_count, F&& gemm_batch)
+{
+    size_t batch_workspace_size = 0;
+    if(handle->has_auxiliary_streams() && !handle->is_device_memory_size_query() && batch_count > 1)
+    {
+        RETURN_IF_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        rocblas_status status = gemm_batch(0);
+        RETURN_IF_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &batch_workspace_size));
+        if(status != rocblas_status_success && status != rocblas_status_size_increased
+           && status != rocblas_status_size_unchanged)
+            return status;
+    }
+
+    return handle->run_batches(batch_count, batch_workspace_size, gemm_batch);
+}
+
 template <bool BATCHED, typename TiA,  typename TiB, typename To>
 rocblas_status rocblas_gemm_batched_ex3_typecasting(rocblas_handle      handle,
                                          rocblas_operation   trans_a,
@@ -2756,6 +2940,38 @@ rocblas_status rocblas_gemm_batched_ex3_typecasting(rocblas_handle      handle,
 
     if(BATCHED)
     {
+        // The type tuples which gemm_ex3_typecasting_tensile hands to Tensile unconverted are
+        // launched at once using the device pointer arrays. The per-batch host loop is only
+        // needed for the conversion kernels and the source fallback.
+        if(rocblas_gemm_ex3_native_types<TiA, TiB, To> && compute_type == rocblas_compute_type_f32
+           && !rocblas_gemm_ex3_use_fallback(handle, trans_a, trans_b, m, n))
+            return gemm_ex3_tensile_batched<TiA, TiB, To>(handle,
+                                                          trans_a,
+                                                          trans_b,
+                                                          m,
+                                                          n,
+                                                          k,
+                                                          alpha,
+                                                          a,
+                                                          offsetAin,
+                                                          lda,
+                                                          b,
+                                                          offsetBin,
+                                                          ldb,
+                                                          beta,
+                                                          c,
+                                                          offsetCin,
+                                                          ldc,
+                                                          d,
+                                                          offsetDin,
+                                                          ldd,
+                                                          batch_count,
+                                                          rocblas_gemm_flags(flags));
+
+        // The pointer arrays are read on the host, which cannot be captured in a graph
+        RETURN_IF_ROCBLAS_ERROR(
+            handle->check_capturable("pointer array readback of gemm_batched_ex3"));
+
         std::unique_ptr<TiA*[]> a_host = std::make_unique<TiA*[]>(batch_count);
         std::unique_ptr<TiB*[]> b_host = std::make_unique<TiB*[]>(batch_count);
         std::unique_ptr<To*[]> c_host = std::make_unique<To*[]>(batch_count);
@@ -2786,83 +3002,81 @@ rocblas_status rocblas_gemm_batched_ex3_typecasting(rocblas_handle      handle,
                             hipMemcpyDeviceToHost,
                             handle->get_stream()));
 
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
-
-        for(int i = 0; i<batch_count; i++)
-        {
-            rb_status = rocblas_gemm_ex3_template<true>(handle,
-                                                        trans_a,
-                                                        trans_b,
-                                                        m,
-                                                        n,
-                                                        k,
-                                                        alpha,
-                                                        a==nullptr ? a : a_host[i],
-                                                        a_type,
-                                                        offsetAin,
-                                                        lda,
-                                                        stride_a,
-                                                        b==nullptr ? b :  b_host[i],
-                                                        b_type,
-                                                        offsetBin,
-                                                        ldb,
-                                                        stride_b,
-                                                        beta,
-                                                        c==nullptr ? c :  c_host[i],
-                                                        c_type,
-                                                        offsetCin,
-                                                        ldc,
-                                                        stride_c,
-                                                        d==nullptr ? d :  d_host[i],
-                                                        d_type,
-                                                        offsetDin,
-                                                        ldd,
-                                                        stride_d,
-                                                        1,
-                                                        compute_type,
-                                                        flags);
-            if(rb_status!=rocblas_status_success)
-                return rb_status;
-        }
+        RETURN_IF_HIP_ERROR(handle->synchronize_stream());
+
+        auto gemm_batch = [&](rocblas_int i) {
+            return rocblas_gemm_ex3_template<true>(handle,
+                                                   trans_a,
+                                                   trans_b,
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   a==nullptr ? a : a_host[i],
+                                                   a_type,
+                                                   offsetAin,
+                                                   lda,
+                                                   stride_a,
+                                                   b==nullptr ? b :  b_host[i],
+                                                   b_type,
+                                                   offsetBin,
+                                                   ldb,
+                                                   stride_b,
+                                                   beta,
+                                                   c==nullptr ? c :  c_host[i],
+                                                   c_type,
+                                                   offsetCin,
+                                                   ldc,
+                                                   stride_c,
+                                                   d==nullptr ? d :  d_host[i],
+                                                   d_type,
+                                                   offsetDin,
+                                                   ldd,
+                                                   stride_d,
+                                                   1,
+                                                   compute_type,
+                                                   flags);
+        };
+
+        rb_status = rocblas_gemm_ex3_run_batches(handle, batch_count, gemm_batch);
     }
     else
     {
-        for(rocblas_int i = 0; i<batch_count; i++)
-        {
-            rb_status = rocblas_gemm_ex3_template<false>(handle,
-                                                        trans_a,
-                                                        trans_b,
-                                                        m,
-                                                        n,
-                                                        k,
-                                                        alpha,
-                                                        (const TiA *)a + i*stride_a,
-                                                        a_type,
-                                                        offsetAin,
-                                                        lda,
-                                                        stride_a,
-                                                        (const TiB *)b + i*stride_b,
-                                                        b_type,
-                                                        offsetBin,
-                                                        ldb,
-                                                        stride_b,
-                                                        beta,
-                                                        (const To *)c + i*stride_c,
-                                                        c_type,
-                                                        offsetCin,
-                                                        ldc,
-                                                        stride_c,
-                                                        (To *)d + i*stride_d,
-                                                        d_type,
-                                                        offsetDin,
-                                                        ldd,
-                                                        stride_d,
-                                                        1,
-                                                        compute_type,
-                                                        flags);
-            if(rb_status!=rocblas_status_success)
-                return rb_status;
-        }
+        auto gemm_batch = [&](rocblas_int i) {
+            return rocblas_gemm_ex3_template<false>(handle,
+                                                    trans_a,
+                                                    trans_b,
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    alpha,
+                                                    (const TiA *)a + i*stride_a,
+                                                    a_type,
+                                                    offsetAin,
+                                                    lda,
+                                                    stride_a,
+                                                    (const TiB *)b + i*stride_b,
+                                                    b_type,
+                                                    offsetBin,
+                                                    ldb,
+                                                    stride_b,
+                                                    beta,
+                                                    (const To *)c + i*stride_c,
+                                                    c_type,
+                                                    offsetCin,
+                                                    ldc,
+                                                    stride_c,
+                                                    (To *)d + i*stride_d,
+                                                    d_type,
+                                                    offsetDin,
+                                                    ldd,
+                                                    stride_d,
+                                                    1,
+                                                    compute_type,
+                                                    flags);
+        };
+
+        rb_status = rocblas_gemm_ex3_run_batches(handle, batch_count, gemm_batch);
     }
 
     return rb_status;
@@ -59,6 +59,16 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        // row major C^T = op(B)^T*op(A)^T is a column major gemm, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+        {
+            std::swap(trans_a, trans_b);
+            std::swap(m, n);
+            std::swap(a, b);
+            std::swap(a_type, b_type);
+            std::swap(lda, ldb);
+        }
+
         const bool HPA = compute_type == rocblas_datatype_f32_r
                          && (a_type == rocblas_datatype_f16_r || a_type == rocblas_datatype_bf16_r);
 
@@ -72,6 +82,7 @@ namespace
         auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
 
         // If this is a solution fitness query (internal testing), bypass logging and error checks
+        rocblas_api_scope api_scope(handle, ROCBLAS_API_STR(rocblas_gemm_ex));
         if(!handle->get_solution_fitness_query())
         {
             if(!handle->is_device_memory_size_query())
@@ -80,10 +91,12 @@ namespace
                 auto layer_mode = handle->layer_mode;
                 if(layer_mode
                    & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-                      | rocblas_layer_mode_log_profile))
+                      | rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                 {
                     char trans_a_letter, trans_b_letter;
-                    if(layer_mode & (rocblas_layer_mode_log_bench | rocblas_layer_mode_log_profile))
+                    if(layer_mode
+                       & (rocblas_layer_mode_log_bench | rocblas_layer_mode_log_profile
+                          | rocblas_layer_mode_roctx))
                     {
                         trans_a_letter = rocblas_transpose_letter(trans_a);
                         trans_b_letter = rocblas_transpose_letter(trans_b);
@@ -176,7 +189,7 @@ namespace
                         }
                     }
 
-                    if(layer_mode & rocblas_layer_mode_log_profile)
+                    if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                     {
                         log_profile(handle,
                                     ROCBLAS_API_STR(rocblas_gemm_ex),
@@ -257,6 +270,12 @@ namespace
         // TODO: These strides could be 0 ( {} ) instead of 1 ( {1} ) once Tensile is fixed
         rocblas_stride stride_a{1}, stride_b{1}, stride_c{1}, stride_d{1};
 
+        // Apply the epilogue set on the handle, if any, to this call only
+        auto epilogue       = handle->get_gemm_epilogue();
+        auto saved_epilogue = handle->push_gemm_epilogue(epilogue);
+        if(epilogue)
+            RETURN_IF_ROCBLAS_ERROR(rocblas_gemm_epilogue_arg_check(*epilogue, m, compute_type));
+
         return ROCBLAS_API(rocblas_gemm_ex_template)<false>(handle,
                                                             trans_a,
                                                             trans_b,
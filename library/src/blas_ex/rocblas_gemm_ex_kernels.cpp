@@ -26,6 +26,7 @@
 #include "../../src/src64/blas_ex/rocblas_gemm_ex_64.hpp"
 #endif
 
+#include "../blas3/rocblas_gemm_source.hpp"
 #include "handle.hpp"
 #include "logging.hpp"
 #include "rocblas_gemm_ex.hpp"
@@ -131,6 +132,532 @@ rocblas_status rocblas_internal_gemm_ex(rocblas_handle     handle,
     }
 }
 
+// Split-K: problems whose M x N output covers too few macro tiles to occupy the device are split
+// along K into slices computed as one strided batched Tensile call, and the partial results
+// are summed in a fixed order so the result does not depend on scheduling
+constexpr int64_t c_split_k_tile      = 128; // typical Tensile macro tile edge
+constexpr int64_t c_split_k_min_slice = 256; // minimum depth of a K slice
+constexpr int64_t c_split_k_max       = 16;
+
+inline rocblas_int rocblas_gemm_split_k_count(rocblas_handle     handle,
+                                              rocblas_int        m,
+                                              rocblas_int        n,
+                                              rocblas_int        k,
+                                              rocblas_int        batch_count,
+                                              rocblas_gemm_algo  algo,
+                                              int32_t            solution_index,
+                                              rocblas_gemm_flags flags)
+{
+    // a user selected solution is kept for the whole problem
+    if(batch_count != 1 || handle->tensile_prefetch
+       || (algo == rocblas_gemm_algo_solution_index && solution_index > 0))
+        return 1;
+
+    bool    forced = flags & rocblas_gemm_flags_split_k;
+    int64_t tiles  = ((m - 1) / c_split_k_tile + 1) * ((n - 1) / c_split_k_tile + 1);
+    int64_t cus    = handle->getCUCount();
+
+    if(!forced && (tiles * 2 > cus || k < 8 * int64_t(std::max(m, n))))
+        return 1;
+
+    int64_t split = std::min({(cus - 1) / tiles + 1, k / c_split_k_min_slice, c_split_k_max});
+    if(forced)
+        split = std::min(std::max(split, int64_t(2)), int64_t(k));
+
+    return split > 1 ? rocblas_int(split) : 1;
+}
+
+template <int DIM_X, int DIM_Y, typename TScal, typename Tc, typename To>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_gemm_split_k_reduce_kernel(rocblas_int m,
+                                   rocblas_int n,
+                                   rocblas_int split_k,
+                                   TScal       alpha_device_host,
+                                   const Tc*   partials,
+                                   TScal       beta_device_host,
+                                   const To*   C,
+                                   rocblas_int ldc,
+                                   To*         D,
+                                   rocblas_int ldd)
+{
+    auto tx = blockIdx.x * blockDim.x + threadIdx.x;
+    auto ty = blockIdx.y * blockDim.y + threadIdx.y;
+
+    if(tx < m && ty < n)
+    {
+        auto alpha = load_scalar(alpha_device_host);
+        auto beta  = load_scalar(beta_device_host);
+
+        size_t mn  = size_t(m) * n;
+        size_t idx = size_t(ty) * m + tx;
+        Tc     sum = partials[idx];
+        for(rocblas_int s = 1; s < split_k; s++)
+            sum += partials[s * mn + idx];
+
+        Tc v = alpha * sum;
+        if(beta != 0)
+            v += beta * Tc(C[size_t(ty) * ldc + tx]);
+        D[size_t(ty) * ldd + tx] = To(v);
+    }
+}
+
+// Computes D = alpha * A * B + beta * C with K split into split_k slices. Returns
+// rocblas_status_continue when the partial results do not fit in device memory, so the caller
+// can run the problem unsplit.
+template <typename Ti, typename To, typename Tc>
+rocblas_status rocblas_gemm_ex_split_k(rocblas_handle     handle,
+                                       rocblas_operation  trans_a,
+                                       rocblas_operation  trans_b,
+                                       rocblas_int        m,
+                                       rocblas_int        n,
+                                       rocblas_int        k,
+                                       rocblas_int        split_k,
+                                       const Tc*          alpha,
+                                       const Ti*          A,
+                                       rocblas_int        lda,
+                                       const Ti*          B,
+                                       rocblas_int        ldb,
+                                       const Tc*          beta,
+                                       const To*          C,
+                                       rocblas_int        ldc,
+                                       To*                D,
+                                       rocblas_int        ldd,
+                                       rocblas_gemm_algo  algo,
+                                       int32_t            solution_index,
+                                       rocblas_gemm_flags flags)
+{
+    size_t         partials_size = sizeof(Tc) * size_t(m) * n * split_k;
+    rocblas_stride stride_p      = rocblas_stride(m) * n;
+    rocblas_int    kc            = k / split_k;
+    rocblas_int    k_last        = k - kc * (split_k - 1);
+
+    rocblas_stride slice_a = trans_a == rocblas_operation_none ? rocblas_stride(kc) * lda : kc;
+    rocblas_stride slice_b = trans_b == rocblas_operation_none ? kc : rocblas_stride(kc) * ldb;
+
+    if(handle->is_device_memory_size_query())
+        return handle->set_optimal_device_memory_size(partials_size);
+
+    auto w_mem = handle->device_malloc(partials_size);
+    if(!w_mem)
+        return rocblas_status_continue;
+    Tc* partials = (Tc*)w_mem[0];
+
+    // slices are computed with alpha = 1 and beta = 0, scaling is applied by the reduction
+    const Tc one  = 1;
+    const Tc zero = 0;
+    {
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        if(split_k > 1)
+        {
+            RETURN_IF_ROCBLAS_ERROR(rocblas_call_tensile(handle,
+                                                         &one,
+                                                         &zero,
+                                                         A,
+                                                         B,
+                                                         (const Tc*)partials,
+                                                         partials,
+                                                         trans_a,
+                                                         trans_b,
+                                                         m,
+                                                         stride_p,
+                                                         0,
+                                                         m,
+                                                         stride_p,
+                                                         0,
+                                                         lda,
+                                                         slice_a,
+                                                         0,
+                                                         ldb,
+                                                         slice_b,
+                                                         0,
+                                                         m,
+                                                         n,
+                                                         kc,
+                                                         split_k - 1,
+                                                         algo,
+                                                         solution_index,
+                                                         flags));
+        }
+
+        // the last slice also takes the remainder of K
+        rocblas_stride last = split_k - 1;
+        RETURN_IF_ROCBLAS_ERROR(rocblas_call_tensile(handle,
+                                                     &one,
+                                                     &zero,
+                                                     A + last * slice_a,
+                                                     B + last * slice_b,
+                                                     (const Tc*)partials + last * stride_p,
+                                                     partials + last * stride_p,
+                                                     trans_a,
+                                                     trans_b,
+                                                     m,
+                                                     stride_p,
+                                                     0,
+                                                     m,
+                                                     stride_p,
+                                                     0,
+                                                     lda,
+                                                     0,
+                                                     0,
+                                                     ldb,
+                                                     0,
+                                                     0,
+                                                     m,
+                                                     n,
+                                                     k_last,
+                                                     1,
+                                                     algo,
+                                                     solution_index,
+                                                     flags));
+    }
+
+    static constexpr int DIM_X = 32;
+    static constexpr int DIM_Y = 32;
+
+    dim3        grid((m - 1) / DIM_X + 1, (n - 1) / DIM_Y + 1);
+    dim3        threads(DIM_X, DIM_Y);
+    hipStream_t rocblas_stream = handle->get_stream();
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+        ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_split_k_reduce_kernel<DIM_X, DIM_Y>),
+                              grid,
+                              threads,
+                              0,
+                              rocblas_stream,
+                              m,
+                              n,
+                              split_k,
+                              alpha,
+                              (const Tc*)partials,
+                              beta,
+                              C,
+                              ldc,
+                              D,
+                              ldd);
+    else
+        ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_split_k_reduce_kernel<DIM_X, DIM_Y>),
+                              grid,
+                              threads,
+                              0,
+                              rocblas_stream,
+                              m,
+                              n,
+                              split_k,
+                              *alpha,
+                              (const Tc*)partials,
+                              *beta,
+                              C,
+                              ldc,
+                              D,
+                              ldd);
+
+    return rocblas_status_success;
+}
+
+// 3M method: with op(A) = Ar + i*Ai and op(B) = Br + i*Bi, the real gemms
+//     P1 = Ar * Br,  P2 = Ai * Bi,  P3 = (Ar + Ai) * (Br + Bi)
+// give op(A) * op(B) = (P1 - P2) + i*(P3 - P1 - P2) with three quarters of the flops of the
+// complex gemm. The parts of op(A) and op(B) are stored one after the other, so the three
+// products are one strided batched Tensile call.
+template <int NB, typename T, typename Tr>
+ROCBLAS_KERNEL(NB)
+rocblas_gemm_3m_split_kernel(
+    rocblas_int rows, int64_t size, rocblas_operation trans, const T* X, int64_t ldx, Tr* parts)
+{
+    for(int64_t idx = blockIdx.x * int64_t(NB) + threadIdx.x; idx < size;
+        idx += int64_t(gridDim.x) * NB)
+    {
+        int64_t r = idx % rows;
+        int64_t c = idx / rows;
+        T       x = trans == rocblas_operation_none ? X[c * ldx + r] : X[r * ldx + c];
+        if(trans == rocblas_operation_conjugate_transpose)
+            x = conj(x);
+
+        parts[idx]            = x.real();
+        parts[size + idx]     = x.imag();
+        parts[2 * size + idx] = x.real() + x.imag();
+    }
+}
+
+template <int DIM_X, int DIM_Y, typename TScal, typename T, typename Tr>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_gemm_3m_combine_kernel(rocblas_int m,
+                               rocblas_int n,
+                               TScal       alpha_device_host,
+                               const Tr*   P,
+                               TScal       beta_device_host,
+                               const T*    C,
+                               rocblas_int ldc,
+                               T*          D,
+                               rocblas_int ldd)
+{
+    auto tx = blockIdx.x * blockDim.x + threadIdx.x;
+    auto ty = blockIdx.y * blockDim.y + threadIdx.y;
+
+    if(tx < m && ty < n)
+    {
+        auto alpha = load_scalar(alpha_device_host);
+        auto beta  = load_scalar(beta_device_host);
+
+        size_t mn  = size_t(m) * n;
+        size_t idx = size_t(ty) * m + tx;
+        Tr     p1  = P[idx];
+        Tr     p2  = P[mn + idx];
+        Tr     p3  = P[2 * mn + idx];
+
+        T v = alpha * T(p1 - p2, p3 - p1 - p2);
+        if(beta != 0)
+            v += beta * C[size_t(ty) * ldc + tx];
+        D[size_t(ty) * ldd + tx] = v;
+    }
+}
+
+// Computes D = alpha * op(A) * op(B) + beta * C for complex types with the 3M method. Returns
+// rocblas_status_continue for other types and problems, or when the real parts do not fit in
+// device memory, so the caller runs the complex gemm.
+template <typename Ti, typename To, typename Tc>
+rocblas_status rocblas_gemm_ex_3m(rocblas_handle     handle,
+                                  rocblas_operation  trans_a,
+                                  rocblas_operation  trans_b,
+                                  rocblas_int        m,
+                                  rocblas_int        n,
+                                  rocblas_int        k,
+                                  const Tc*          alpha,
+                                  const Ti*          A,
+                                  rocblas_int        lda,
+                                  const Ti*          B,
+                                  rocblas_int        ldb,
+                                  const Tc*          beta,
+                                  const To*          C,
+                                  rocblas_int        ldc,
+                                  To*                D,
+                                  rocblas_int        ldd,
+                                  rocblas_int        batch_count,
+                                  rocblas_gemm_flags flags)
+{
+    if constexpr(rocblas_is_complex<Ti> && std::is_same_v<Ti, To> && std::is_same_v<Ti, Tc>)
+    {
+        using Tr = real_t<Ti>;
+
+        if(batch_count != 1 || !k || handle->tensile_prefetch
+           || (handle->pointer_mode == rocblas_pointer_mode_host && *alpha == Tc(0)))
+            return rocblas_status_continue;
+
+        int64_t size_a = int64_t(m) * k, size_b = int64_t(k) * n, size_p = int64_t(m) * n;
+        size_t  parts_size = sizeof(Tr) * 3 * (size_a + size_b + size_p);
+
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(parts_size);
+
+        auto w_mem = handle->device_malloc(parts_size);
+        if(!w_mem)
+            return rocblas_status_continue;
+        Tr* parts_a = (Tr*)w_mem[0];
+        Tr* parts_b = parts_a + 3 * size_a;
+        Tr* P       = parts_b + 3 * size_b;
+
+        static constexpr int NB = 256;
+
+        hipStream_t rocblas_stream = handle->get_stream();
+        dim3        grid_a(rocblas_int(std::min((size_a - 1) / NB + 1, c_i64_grid_X_chunk)));
+        dim3        grid_b(rocblas_int(std::min((size_b - 1) / NB + 1, c_i64_grid_X_chunk)));
+
+        ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_3m_split_kernel<NB>),
+                              grid_a,
+                              dim3(NB),
+                              0,
+                              rocblas_stream,
+                              m,
+                              size_a,
+                              trans_a,
+                              A,
+                              lda,
+                              parts_a);
+        ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_3m_split_kernel<NB>),
+                              grid_b,
+                              dim3(NB),
+                              0,
+                              rocblas_stream,
+                              k,
+                              size_b,
+                              trans_b,
+                              B,
+                              ldb,
+                              parts_b);
+
+        // the products are computed with alpha = 1 and beta = 0, scaling is applied on combining
+        const Tr one  = 1;
+        const Tr zero = 0;
+        {
+            auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+            RETURN_IF_ROCBLAS_ERROR(rocblas_call_tensile(handle,
+                                                         &one,
+                                                         &zero,
+                                                         (const Tr*)parts_a,
+                                                         (const Tr*)parts_b,
+                                                         (const Tr*)P,
+                                                         P,
+                                                         rocblas_operation_none,
+                                                         rocblas_operation_none,
+                                                         m,
+                                                         size_p,
+                                                         0,
+                                                         m,
+                                                         size_p,
+                                                         0,
+                                                         m,
+                                                         size_a,
+                                                         0,
+                                                         k,
+                                                         size_b,
+                                                         0,
+                                                         m,
+                                                         n,
+                                                         k,
+                                                         3,
+                                                         rocblas_gemm_algo_standard,
+                                                         0,
+                                                         flags));
+        }
+
+        static constexpr int DIM_X = 32;
+        static constexpr int DIM_Y = 32;
+
+        dim3 grid((m - 1) / DIM_X + 1, (n - 1) / DIM_Y + 1);
+        dim3 threads(DIM_X, DIM_Y);
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_3m_combine_kernel<DIM_X, DIM_Y>),
+                                  grid,
+                                  threads,
+                                  0,
+                                  rocblas_stream,
+                                  m,
+                                  n,
+                                  alpha,
+                                  (const Tr*)P,
+                                  beta,
+                                  C,
+                                  ldc,
+                                  D,
+                                  ldd);
+        else
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_3m_combine_kernel<DIM_X, DIM_Y>),
+                                  grid,
+                                  threads,
+                                  0,
+                                  rocblas_stream,
+                                  m,
+                                  n,
+                                  *alpha,
+                                  (const Tr*)P,
+                                  *beta,
+                                  C,
+                                  ldc,
+                                  D,
+                                  ldd);
+
+        return rocblas_status_success;
+    }
+    return rocblas_status_continue;
+}
+
+// Many small problems: Tensile launches a workgroup per macro tile of each problem, mostly idle
+// for m, n, k <= 32, so large batches of them are computed by the persistent source kernel,
+// which also applies the epilogue. Tensile kernels take alpha and beta by value, so problems
+// with the scalars of rocblas_set_gemm_batch_scalars are computed by the source kernels too.
+// rocblas_status_continue is returned when they are not used.
+template <bool     BATCHED,
+          typename Ti,
+          typename To,
+          typename Tc,
+          typename TiConstPtr,
+          typename ToConstPtr,
+          typename ToPtr>
+rocblas_status rocblas_gemm_ex_small_batched(rocblas_handle    handle,
+                                             rocblas_operation trans_a,
+                                             rocblas_operation trans_b,
+                                             rocblas_int       m,
+                                             rocblas_int       n,
+                                             rocblas_int       k,
+                                             const Tc*         alpha,
+                                             TiConstPtr*       a,
+                                             rocblas_stride    offset_a,
+                                             rocblas_int       lda,
+                                             rocblas_stride    stride_a,
+                                             TiConstPtr*       b,
+                                             rocblas_stride    offset_b,
+                                             rocblas_int       ldb,
+                                             rocblas_stride    stride_b,
+                                             const Tc*         beta,
+                                             ToConstPtr*       c,
+                                             rocblas_stride    offset_c,
+                                             rocblas_int       ldc,
+                                             rocblas_stride    stride_c,
+                                             ToPtr*            d,
+                                             rocblas_stride    offset_d,
+                                             rocblas_int       ldd,
+                                             rocblas_stride    stride_d,
+                                             rocblas_int       batch_count,
+                                             rocblas_gemm_algo algo,
+                                             int32_t           solution_index)
+{
+    constexpr bool types_supported
+        = std::is_same_v<Ti, To>
+          && (std::is_same_v<Tc, Ti>
+              || (std::is_same_v<Tc, float>
+                  && (std::is_same_v<Ti, rocblas_half> || std::is_same_v<Ti, rocblas_bfloat16>)));
+
+    auto batch_scalars = handle->active_gemm_batch_scalars;
+    if(batch_scalars)
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+    if constexpr(types_supported)
+    {
+        // a user selected solution is kept, and alpha and beta must be on the host unless the
+        // scalars of the batches replace them; the precisions the Tensile library was not built
+        // for have no other solution
+        if((handle->pointer_mode == rocblas_pointer_mode_host || batch_scalars)
+           && !handle->tensile_prefetch
+           && !handle->is_device_memory_size_query()
+           && !(algo == rocblas_gemm_algo_solution_index && solution_index > 0 && !batch_scalars)
+           && (batch_scalars || !rocblas_tensile_has_type<Ti>()
+               || rocblas_gemm_small_batched_supported(m, n, k, batch_count)))
+        {
+            rocblas_gemm_epilogue_args epilogue(handle->active_gemm_epilogue, batch_scalars);
+            return rocblas_gemm_source_solution_64<BATCHED>(trans_a,
+                                                            trans_b,
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            batch_scalars ? Tc(1) : *alpha,
+                                                            a,
+                                                            lda,
+                                                            stride_a,
+                                                            offset_a,
+                                                            b,
+                                                            ldb,
+                                                            stride_b,
+                                                            offset_b,
+                                                            batch_scalars ? Tc(1) : *beta,
+                                                            c,
+                                                            ldc,
+                                                            stride_c,
+                                                            offset_c,
+                                                            d,
+                                                            ldd,
+                                                            stride_d,
+                                                            offset_d,
+                                                            batch_count,
+                                                            handle->get_stream(),
+                                                            epilogue);
+        }
+    }
+    return batch_scalars ? rocblas_status_not_implemented : rocblas_status_continue;
+}
+
 template <bool BATCHED, typename Ti, typename To = Ti, typename Tc = To>
 rocblas_status gemm_ex_typecasting(rocblas_handle     handle,
                                    rocblas_operation  trans_a,
@@ -208,34 +735,62 @@ rocblas_status gemm_ex_typecasting(rocblas_handle     handle,
                 return gemm_ex_check_numerics_status;
         }
 
-        status = rocblas_internal_gemm_ex<BATCHED>(handle,
-                                                   trans_a,
-                                                   trans_b,
-                                                   m,
-                                                   n,
-                                                   k,
-                                                   (const Tc*)alpha,
-                                                   (const Ti* const*)a,
-                                                   offsetAin,
-                                                   lda,
-                                                   stride_a,
-                                                   (const Ti* const*)b,
-                                                   offsetBin,
-                                                   ldb,
-                                                   stride_b,
-                                                   (const Tc*)beta,
-                                                   (const To* const*)c,
-                                                   offsetCin,
-                                                   ldc,
-                                                   stride_c,
-                                                   (To* const*)d,
-                                                   offsetDin,
-                                                   ldd,
-                                                   stride_d,
-                                                   batch_count,
-                                                   algo,
-                                                   solution_index,
-                                                   flags);
+        status = rocblas_gemm_ex_small_batched<BATCHED, Ti, To>(handle,
+                                                                trans_a,
+                                                                trans_b,
+                                                                m,
+                                                                n,
+                                                                k,
+                                                                (const Tc*)alpha,
+                                                                (const Ti* const*)a,
+                                                                offsetAin,
+                                                                lda,
+                                                                stride_a,
+                                                                (const Ti* const*)b,
+                                                                offsetBin,
+                                                                ldb,
+                                                                stride_b,
+                                                                (const Tc*)beta,
+                                                                (const To* const*)c,
+                                                                offsetCin,
+                                                                ldc,
+                                                                stride_c,
+                                                                (To* const*)d,
+                                                                offsetDin,
+                                                                ldd,
+                                                                stride_d,
+                                                                batch_count,
+                                                                algo,
+                                                                solution_index);
+        if(status == rocblas_status_continue)
+            status = rocblas_internal_gemm_ex<BATCHED>(handle,
+                                                       trans_a,
+                                                       trans_b,
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       (const Tc*)alpha,
+                                                       (const Ti* const*)a,
+                                                       offsetAin,
+                                                       lda,
+                                                       stride_a,
+                                                       (const Ti* const*)b,
+                                                       offsetBin,
+                                                       ldb,
+                                                       stride_b,
+                                                       (const Tc*)beta,
+                                                       (const To* const*)c,
+                                                       offsetCin,
+                                                       ldc,
+                                                       stride_c,
+                                                       (To* const*)d,
+                                                       offsetDin,
+                                                       ldd,
+                                                       stride_d,
+                                                       batch_count,
+                                                       algo,
+                                                       solution_index,
+                                                       flags);
         if(status != rocblas_status_success)
             return status;
 
@@ -305,37 +860,133 @@ rocblas_status gemm_ex_typecasting(rocblas_handle     handle,
                 return gemm_ex_check_numerics_status;
         }
 
-        status = rocblas_internal_gemm_ex<BATCHED>(handle,
-                                                   trans_a,
-                                                   trans_b,
-                                                   m,
-                                                   n,
-                                                   k,
-                                                   (const Tc*)alpha,
-                                                   (const Ti*)a,
-                                                   offsetAin,
-                                                   lda,
-                                                   stride_a,
-                                                   (const Ti*)b,
-                                                   offsetBin,
-                                                   ldb,
-                                                   stride_b,
-                                                   (const Tc*)beta,
-                                                   (const To*)c,
-                                                   offsetCin,
-                                                   ldc,
-                                                   stride_c,
-                                                   (To*)d,
-                                                   offsetDin,
-                                                   ldd,
-                                                   stride_d,
-                                                   batch_count,
-                                                   algo,
-                                                   solution_index,
-                                                   flags);
+        // small M x N problems with a deep K are split along K to occupy more of the device
+        rocblas_int split_k = 1;
+        if(k > 1 && !(handle->pointer_mode == rocblas_pointer_mode_host && !*(const Tc*)alpha))
+            split_k = rocblas_gemm_split_k_count(
+                handle, m, n, k, batch_count, algo, solution_index, flags);
+
+        status = rocblas_gemm_ex_small_batched<BATCHED, Ti, To>(handle,
+                                                                trans_a,
+                                                                trans_b,
+                                                                m,
+                                                                n,
+                                                                k,
+                                                                (const Tc*)alpha,
+                                                                (const Ti*)a,
+                                                                offsetAin,
+                                                                lda,
+                                                                stride_a,
+                                                                (const Ti*)b,
+                                                                offsetBin,
+                                                                ldb,
+                                                                stride_b,
+                                                                (const Tc*)beta,
+                                                                (const To*)c,
+                                                                offsetCin,
+                                                                ldc,
+                                                                stride_c,
+                                                                (To*)d,
+                                                                offsetDin,
+                                                                ldd,
+                                                                stride_d,
+                                                                batch_count,
+                                                                algo,
+                                                                solution_index);
+        bool fused_epilogue = status != rocblas_status_continue;
+
+        if(status == rocblas_status_continue && algo == rocblas_gemm_algo_3m)
+            status = rocblas_gemm_ex_3m(handle,
+                                        trans_a,
+                                        trans_b,
+                                        m,
+                                        n,
+                                        k,
+                                        (const Tc*)alpha,
+                                        (const Ti*)a + offsetAin,
+                                        lda,
+                                        (const Ti*)b + offsetBin,
+                                        ldb,
+                                        (const Tc*)beta,
+                                        (const To*)c + offsetCin,
+                                        ldc,
+                                        (To*)d + offsetDin,
+                                        ldd,
+                                        batch_count,
+                                        flags);
+
+        if(status == rocblas_status_continue && split_k > 1)
+            status = rocblas_gemm_ex_split_k(handle,
+                                             trans_a,
+                                             trans_b,
+                                             m,
+                                             n,
+                                             k,
+                                             split_k,
+                                             (const Tc*)alpha,
+                                             (const Ti*)a + offsetAin,
+                                             lda,
+                                             (const Ti*)b + offsetBin,
+                                             ldb,
+                                             (const Tc*)beta,
+                                             (const To*)c + offsetCin,
+                                             ldc,
+                                             (To*)d + offsetDin,
+                                             ldd,
+                                             algo,
+                                             solution_index,
+                                             flags);
+
+        if(status == rocblas_status_continue)
+            status = rocblas_internal_gemm_ex<BATCHED>(handle,
+                                                       trans_a,
+                                                       trans_b,
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       (const Tc*)alpha,
+                                                       (const Ti*)a,
+                                                       offsetAin,
+                                                       lda,
+                                                       stride_a,
+                                                       (const Ti*)b,
+                                                       offsetBin,
+                                                       ldb,
+                                                       stride_b,
+                                                       (const Tc*)beta,
+                                                       (const To*)c,
+                                                       offsetCin,
+                                                       ldc,
+                                                       stride_c,
+                                                       (To*)d,
+                                                       offsetDin,
+                                                       ldd,
+                                                       stride_d,
+                                                       batch_count,
+                                                       algo,
+                                                       solution_index,
+                                                       flags);
         if(status != rocblas_status_success)
             return status;
 
+        // Tensile kernels have no epilogue, so it is applied to D in a single pass
+        if(!fused_epilogue && handle->active_gemm_epilogue
+           && !handle->is_device_memory_size_query() && !handle->tensile_prefetch)
+        {
+            status = rocblas_gemm_epilogue_launcher_64<Tc>(
+                m,
+                n,
+                (To*)d,
+                offsetDin,
+                ldd,
+                stride_d,
+                batch_count,
+                rocblas_gemm_epilogue_args(handle->active_gemm_epilogue),
+                handle->get_stream());
+            if(status != rocblas_status_success)
+                return status;
+        }
+
         if(check_numerics && !std::is_same_v<Ti, signed char>)
         {
             bool           is_input                      = false;
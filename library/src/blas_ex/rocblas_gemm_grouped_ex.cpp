@@ -0,0 +1,290 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "handle.hpp"
+#include "rocblas.h"
+
+#include "logging.hpp"
+#include "rocblas_gemm_ex.hpp"
+#include "utility.hpp"
+#include <vector>
+
+namespace
+{
+    rocblas_status rocblas_gemm_grouped_ex_impl(rocblas_handle           handle,
+                                                rocblas_int              group_count,
+                                                const rocblas_operation* trans_a,
+                                                const rocblas_operation* trans_b,
+                                                const rocblas_int*       m,
+                                                const rocblas_int*       n,
+                                                const rocblas_int*       k,
+                                                const void*              alpha,
+                                                const void*              a,
+                                                rocblas_datatype         a_type,
+                                                const rocblas_int*       lda,
+                                                const void*              b,
+                                                rocblas_datatype         b_type,
+                                                const rocblas_int*       ldb,
+                                                const void*              beta,
+                                                const void*              c,
+                                                rocblas_datatype         c_type,
+                                                const rocblas_int*       ldc,
+                                                void*                    d,
+                                                rocblas_datatype         d_type,
+                                                const rocblas_int*       ldd,
+                                                const rocblas_int*       group_size,
+                                                rocblas_datatype         compute_type,
+                                                rocblas_gemm_algo        algo,
+                                                int32_t                  solution_index,
+                                                uint32_t                 flags)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // row major order, see rocblas_set_order, has no column major mapping here
+        RETURN_NOT_IMPLEMENTED_IF_ROW_MAJOR(handle);
+
+        const bool HPA = compute_type == rocblas_datatype_f32_r
+                         && (a_type == rocblas_datatype_f16_r || a_type == rocblas_datatype_bf16_r);
+
+        if(!HPA)
+            RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        rocblas_api_scope api_scope(handle, "rocblas_gemm_grouped_ex");
+        if(!handle->is_device_memory_size_query())
+        {
+            auto layer_mode = handle->layer_mode;
+            if(layer_mode & rocblas_layer_mode_log_trace)
+                log_trace(handle,
+                          "rocblas_gemm_grouped_ex",
+                          group_count,
+                          rocblas_datatype_string(a_type),
+                          rocblas_datatype_string(b_type),
+                          rocblas_datatype_string(c_type),
+                          rocblas_datatype_string(d_type),
+                          rocblas_datatype_string(compute_type),
+                          algo,
+                          solution_index,
+                          rocblas_gemm_flags(flags));
+        }
+
+        if(group_count < 0)
+            return rocblas_status_invalid_size;
+        if(!group_count)
+        {
+            RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+            return rocblas_status_success;
+        }
+
+        if(!trans_a || !trans_b || !m || !n || !k || !lda || !ldb || !ldc || !ldd || !group_size)
+            return rocblas_status_invalid_pointer;
+
+        // Check the arguments of every group, with its scalars copied to the host, before
+        // launching any of them, so that an invalid group does not leave the earlier groups
+        // computed
+        size_t                       scalar_size = rocblas_sizeof_datatype(compute_type);
+        std::vector<rocblas_union_t> alpha_h(group_count), beta_h(group_count);
+        std::vector<const void*>     alpha_g(group_count), beta_g(group_count);
+        std::vector<rocblas_status>  group_status(group_count);
+        size_t                       offset = 0;
+        for(rocblas_int g = 0; g < group_count; offset += group_size[g++])
+        {
+            alpha_g[g]      = alpha ? (const char*)alpha + g * scalar_size : nullptr;
+            beta_g[g]       = beta ? (const char*)beta + g * scalar_size : nullptr;
+            const void* a_g = a ? (const void* const*)a + offset : nullptr;
+            const void* b_g = b ? (const void* const*)b + offset : nullptr;
+            const void* c_g = c ? (const void* const*)c + offset : nullptr;
+            const void* d_g = d ? (void* const*)d + offset : nullptr;
+
+            RETURN_IF_ROCBLAS_ERROR(rocblas_copy_alpha_beta_to_host_if_on_device(
+                handle, alpha_g[g], beta_g[g], alpha_h[g], beta_h[g], k[g], compute_type));
+            auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+            group_status[g] = rocblas_gemm_ex_arg_check(handle,
+                                                        trans_a[g],
+                                                        trans_b[g],
+                                                        m[g],
+                                                        n[g],
+                                                        k[g],
+                                                        alpha_g[g],
+                                                        a_g,
+                                                        lda[g],
+                                                        b_g,
+                                                        ldb[g],
+                                                        beta_g[g],
+                                                        c_g,
+                                                        c_type,
+                                                        ldc[g],
+                                                        d_g,
+                                                        d_type,
+                                                        ldd[g],
+                                                        compute_type,
+                                                        group_size[g]);
+            if(group_status[g] != rocblas_status_success
+               && group_status[g] != rocblas_status_continue)
+                return group_status[g];
+        }
+
+        // Each group is one shape class, and runs as a single batched launch
+        rocblas_status query = rocblas_status_size_unchanged;
+        offset               = 0;
+        for(rocblas_int g = 0; g < group_count; offset += group_size[g++])
+        {
+            // empty groups
+            if(group_status[g] == rocblas_status_success)
+                continue;
+
+            const void* a_g = a ? (const void* const*)a + offset : nullptr;
+            const void* b_g = b ? (const void* const*)b + offset : nullptr;
+            const void* c_g = c ? (const void* const*)c + offset : nullptr;
+            void*       d_g = d ? (void**)d + offset : nullptr;
+
+            auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+            auto stride_a
+                = rocblas_stride(lda[g]) * (trans_a[g] == rocblas_operation_none ? k[g] : m[g]);
+            auto stride_b
+                = rocblas_stride(ldb[g]) * (trans_b[g] == rocblas_operation_none ? n[g] : k[g]);
+            auto stride_c = rocblas_stride(ldc[g]) * n[g];
+            auto stride_d = rocblas_stride(ldd[g]) * n[g];
+
+            rocblas_status status = rocblas_gemm_ex_template<true>(handle,
+                                                                   trans_a[g],
+                                                                   trans_b[g],
+                                                                   m[g],
+                                                                   n[g],
+                                                                   k[g],
+                                                                   alpha_g[g],
+                                                                   a_g,
+                                                                   a_type,
+                                                                   0,
+                                                                   lda[g],
+                                                                   stride_a,
+                                                                   b_g,
+                                                                   b_type,
+                                                                   0,
+                                                                   ldb[g],
+                                                                   stride_b,
+                                                                   beta_g[g],
+                                                                   c_g,
+                                                                   c_type,
+                                                                   0,
+                                                                   ldc[g],
+                                                                   stride_c,
+                                                                   d_g,
+                                                                   d_type,
+                                                                   0,
+                                                                   ldd[g],
+                                                                   stride_d,
+                                                                   group_size[g],
+                                                                   compute_type,
+                                                                   algo,
+                                                                   solution_index,
+                                                                   flags);
+
+            // The workspace of a grouped call is the largest workspace of its groups
+            if(handle->is_device_memory_size_query())
+            {
+                if(status == rocblas_status_size_increased)
+                    query = status;
+                else if(status != rocblas_status_size_unchanged)
+                    return status;
+            }
+            else if(status != rocblas_status_success)
+                return status;
+        }
+
+        return handle->is_device_memory_size_query() ? query : rocblas_status_success;
+    }
+}
+// namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_gemm_grouped_ex(rocblas_handle           handle,
+                                       rocblas_int              group_count,
+                                       const rocblas_operation* trans_a,
+                                       const rocblas_operation* trans_b,
+                                       const rocblas_int*       m,
+                                       const rocblas_int*       n,
+                                       const rocblas_int*       k,
+                                       const void*              alpha,
+                                       const void*              a,
+                                       rocblas_datatype         a_type,
+                                       const rocblas_int*       lda,
+                                       const void*              b,
+                                       rocblas_datatype         b_type,
+                                       const rocblas_int*       ldb,
+                                       const void*              beta,
+                                       const void*              c,
+                                       rocblas_datatype         c_type,
+                                       const rocblas_int*       ldc,
+                                       void*                    d,
+                                       rocblas_datatype         d_type,
+                                       const rocblas_int*       ldd,
+                                       const rocblas_int*       group_size,
+                                       rocblas_datatype         compute_type,
+                                       rocblas_gemm_algo        algo,
+                                       int32_t                  solution_index,
+                                       uint32_t                 flags)
+try
+{
+    return rocblas_gemm_grouped_ex_impl(handle,
+                                        group_count,
+                                        trans_a,
+                                        trans_b,
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        a,
+                                        a_type,
+                                        lda,
+                                        b,
+                                        b_type,
+                                        ldb,
+                                        beta,
+                                        c,
+                                        c_type,
+                                        ldc,
+                                        d,
+                                        d_type,
+                                        ldd,
+                                        group_size,
+                                        compute_type,
+                                        algo,
+                                        solution_index,
+                                        flags);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
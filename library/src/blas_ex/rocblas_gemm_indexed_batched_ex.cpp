@@ -0,0 +1,372 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * gemm_batched_ex on matrices given by index arrays into pooled buffers. The matrix of batch i
+ * of an operand starts index[i] * stride elements after its base pointer. The pointer arrays
+ * of gemm_batched_ex are formed from the indices by a kernel in device memory of the handle, so
+ * that the indices can change on the device, as in a paged cache, without pointer arrays built
+ * and copied by the host for every call.
+ */
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_gemm_ex.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_gemm_indexed_batched_ex_name[] = "unknown";
+    template <>
+    constexpr char rocblas_gemm_indexed_batched_ex_name<int32_t>[]
+        = "rocblas_gemm_indexed_batched_ex";
+    template <>
+    constexpr char rocblas_gemm_indexed_batched_ex_name<int64_t>[]
+        = "rocblas_gemm_indexed_batched_ex_i64";
+
+    constexpr int NB_INDEXED = 256;
+
+    // An operand of the batches, matrix i at base + index[i] * stride bytes, or i * stride
+    // without indices
+    template <typename I>
+    struct rocblas_indexed_operand
+    {
+        const char* base;
+        int64_t     stride;
+        const I*    index;
+    };
+
+    // The pointer arrays for the operands A, B, C and D in blockIdx.y, one after the other
+    template <typename I>
+    ROCBLAS_KERNEL(NB_INDEXED)
+    rocblas_gemm_indexed_pointers_kernel(rocblas_int                batch_count,
+                                         rocblas_indexed_operand<I> a,
+                                         rocblas_indexed_operand<I> b,
+                                         rocblas_indexed_operand<I> c,
+                                         rocblas_indexed_operand<I> d,
+                                         const void**               pointers)
+    {
+        int64_t i = blockIdx.x * int64_t(NB_INDEXED) + threadIdx.x;
+        if(i >= batch_count)
+            return;
+
+        auto op = blockIdx.y == 0 ? a : blockIdx.y == 1 ? b : blockIdx.y == 2 ? c : d;
+        pointers[blockIdx.y * int64_t(batch_count) + i]
+            = op.base ? op.base + (op.index ? int64_t(op.index[i]) : i) * op.stride : nullptr;
+    }
+
+    template <typename I>
+    rocblas_status rocblas_gemm_indexed_batched_ex_impl(rocblas_handle    handle,
+                                                        rocblas_operation trans_a,
+                                                        rocblas_operation trans_b,
+                                                        rocblas_int       m,
+                                                        rocblas_int       n,
+                                                        rocblas_int       k,
+                                                        const void*       alpha,
+                                                        const void*       a,
+                                                        rocblas_datatype  a_type,
+                                                        rocblas_int       lda,
+                                                        rocblas_stride    stride_a,
+                                                        const I*          a_index,
+                                                        const void*       b,
+                                                        rocblas_datatype  b_type,
+                                                        rocblas_int       ldb,
+                                                        rocblas_stride    stride_b,
+                                                        const I*          b_index,
+                                                        const void*       beta,
+                                                        const void*       c,
+                                                        rocblas_datatype  c_type,
+                                                        rocblas_int       ldc,
+                                                        rocblas_stride    stride_c,
+                                                        const I*          c_index,
+                                                        void*             d,
+                                                        rocblas_datatype  d_type,
+                                                        rocblas_int       ldd,
+                                                        rocblas_stride    stride_d,
+                                                        const I*          d_index,
+                                                        rocblas_int       batch_count,
+                                                        rocblas_datatype  compute_type,
+                                                        rocblas_gemm_algo algo,
+                                                        int32_t           solution_index,
+                                                        uint32_t          flags)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // row major order, see rocblas_set_order, has no column major mapping here
+        RETURN_NOT_IMPLEMENTED_IF_ROW_MAJOR(handle);
+
+        // Copy alpha and beta to host if on device
+        rocblas_union_t alpha_h, beta_h;
+        RETURN_IF_ROCBLAS_ERROR(rocblas_copy_alpha_beta_to_host_if_on_device(
+            handle, alpha, beta, alpha_h, beta_h, k, compute_type));
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        rocblas_api_scope api_scope(handle, rocblas_gemm_indexed_batched_ex_name<I>);
+        if(!handle->is_device_memory_size_query()
+           && handle->layer_mode & rocblas_layer_mode_log_trace)
+        {
+            rocblas_internal_ostream alphass, betass;
+            if(log_trace_alpha_beta_ex(compute_type, alpha, beta, alphass, betass)
+               == rocblas_status_success)
+                log_trace(handle,
+                          rocblas_gemm_indexed_batched_ex_name<I>,
+                          trans_a,
+                          trans_b,
+                          m,
+                          n,
+                          k,
+                          alphass.str(),
+                          a,
+                          rocblas_datatype_string(a_type),
+                          lda,
+                          stride_a,
+                          a_index,
+                          b,
+                          rocblas_datatype_string(b_type),
+                          ldb,
+                          stride_b,
+                          b_index,
+                          betass.str(),
+                          c,
+                          rocblas_datatype_string(c_type),
+                          ldc,
+                          stride_c,
+                          c_index,
+                          d,
+                          rocblas_datatype_string(d_type),
+                          ldd,
+                          stride_d,
+                          d_index,
+                          batch_count,
+                          rocblas_datatype_string(compute_type),
+                          algo,
+                          solution_index,
+                          rocblas_gemm_flags(flags));
+        }
+
+        auto validArgs = rocblas_gemm_ex_arg_check(handle,
+                                                   trans_a,
+                                                   trans_b,
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   a,
+                                                   lda,
+                                                   b,
+                                                   ldb,
+                                                   beta,
+                                                   c,
+                                                   c_type,
+                                                   ldc,
+                                                   d,
+                                                   d_type,
+                                                   ldd,
+                                                   compute_type,
+                                                   batch_count);
+        if(validArgs != rocblas_status_continue)
+        {
+            if(validArgs == rocblas_status_success)
+                RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+            return validArgs;
+        }
+        if(stride_a < 0 || stride_b < 0 || stride_c < 0 || stride_d < 0)
+            return rocblas_status_invalid_size;
+
+        // the strides of the matrices of gemm_batched_ex, the indices replace them
+        auto ld_stride_a = rocblas_stride(lda) * (trans_a == rocblas_operation_none ? k : m);
+        auto ld_stride_b = rocblas_stride(ldb) * (trans_b == rocblas_operation_none ? n : k);
+        auto ld_stride_c = rocblas_stride(ldc) * n;
+        auto ld_stride_d = rocblas_stride(ldd) * n;
+
+        // the pointer arrays of the operands, one after the other, null in the size query
+        size_t pointer_bytes = sizeof(void*) * 4 * size_t(batch_count);
+        auto   gemm          = [&](const void** pointers) {
+            auto array = [&](int op) {
+                return pointers ? pointers + op * int64_t(batch_count) : nullptr;
+            };
+            return rocblas_gemm_ex_template<true>(handle,
+                                                  trans_a,
+                                                  trans_b,
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  array(0),
+                                                  a_type,
+                                                  0,
+                                                  lda,
+                                                  ld_stride_a,
+                                                  array(1),
+                                                  b_type,
+                                                  0,
+                                                  ldb,
+                                                  ld_stride_b,
+                                                  beta,
+                                                  array(2),
+                                                  c_type,
+                                                  0,
+                                                  ldc,
+                                                  ld_stride_c,
+                                                  array(3),
+                                                  d_type,
+                                                  0,
+                                                  ldd,
+                                                  ld_stride_d,
+                                                  batch_count,
+                                                  compute_type,
+                                                  algo,
+                                                  solution_index,
+                                                  flags);
+        };
+
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(
+                pointer_bytes, handle->nested_device_memory_size_query([&] { gemm(nullptr); }));
+
+        auto w_mem = handle->device_malloc(pointer_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+        auto pointers = (const void**)w_mem[0];
+
+        // the strides are in elements of each type
+        auto operand
+            = [](const void* base, rocblas_datatype type, rocblas_stride stride, const I* index) {
+                  return rocblas_indexed_operand<I>{
+                      (const char*)base, int64_t(stride * rocblas_sizeof_datatype(type)), index};
+              };
+
+        dim3 grid((batch_count - 1) / NB_INDEXED + 1, 4);
+        dim3 threads(NB_INDEXED);
+        ROCBLAS_LAUNCH_KERNEL(rocblas_gemm_indexed_pointers_kernel<I>,
+                              grid,
+                              threads,
+                              0,
+                              handle->get_stream(),
+                              batch_count,
+                              operand(a, a_type, stride_a, a_index),
+                              operand(b, b_type, stride_b, b_index),
+                              operand(c, c_type, stride_c, c_index),
+                              operand(d, d_type, stride_d, d_index),
+                              pointers);
+
+        return gemm(pointers);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(name_, I_)                                             \
+    rocblas_status name_(rocblas_handle    handle,                  \
+                         rocblas_operation trans_a,                 \
+                         rocblas_operation trans_b,                 \
+                         rocblas_int       m,                       \
+                         rocblas_int       n,                       \
+                         rocblas_int       k,                       \
+                         const void*       alpha,                   \
+                         const void*       a,                       \
+                         rocblas_datatype  a_type,                  \
+                         rocblas_int       lda,                     \
+                         rocblas_stride    stride_a,                \
+                         const I_*         a_index,                 \
+                         const void*       b,                       \
+                         rocblas_datatype  b_type,                  \
+                         rocblas_int       ldb,                     \
+                         rocblas_stride    stride_b,                \
+                         const I_*         b_index,                 \
+                         const void*       beta,                    \
+                         const void*       c,                       \
+                         rocblas_datatype  c_type,                  \
+                         rocblas_int       ldc,                     \
+                         rocblas_stride    stride_c,                \
+                         const I_*         c_index,                 \
+                         void*             d,                       \
+                         rocblas_datatype  d_type,                  \
+                         rocblas_int       ldd,                     \
+                         rocblas_stride    stride_d,                \
+                         const I_*         d_index,                 \
+                         rocblas_int       batch_count,             \
+                         rocblas_datatype  compute_type,            \
+                         rocblas_gemm_algo algo,                    \
+                         int32_t           solution_index,          \
+                         uint32_t          flags)                   \
+    try                                                             \
+    {                                                               \
+        return rocblas_gemm_indexed_batched_ex_impl(handle,         \
+                                                    trans_a,        \
+                                                    trans_b,        \
+                                                    m,              \
+                                                    n,              \
+                                                    k,              \
+                                                    alpha,          \
+                                                    a,              \
+                                                    a_type,         \
+                                                    lda,            \
+                                                    stride_a,       \
+                                                    a_index,        \
+                                                    b,              \
+                                                    b_type,         \
+                                                    ldb,            \
+                                                    stride_b,       \
+                                                    b_index,        \
+                                                    beta,           \
+                                                    c,              \
+                                                    c_type,         \
+                                                    ldc,            \
+                                                    stride_c,       \
+                                                    c_index,        \
+                                                    d,              \
+                                                    d_type,         \
+                                                    ldd,            \
+                                                    stride_d,       \
+                                                    d_index,        \
+                                                    batch_count,    \
+                                                    compute_type,   \
+                                                    algo,           \
+                                                    solution_index, \
+                                                    flags);         \
+    }                                                               \
+    catch(...)                                                      \
+    {                                                               \
+        return exception_to_rocblas_status();                       \
+    }
+
+extern "C" {
+
+IMPL(rocblas_gemm_indexed_batched_ex, int32_t);
+IMPL(rocblas_gemm_indexed_batched_ex_i64, int64_t);
+
+} // extern "C"
+
+#undef IMPL
@@ -0,0 +1,460 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "../blas1/rocblas_reduction.hpp"
+#include "handle.hpp"
+#include "int64_helpers.hpp"
+#include "logging.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_gemm_int4_name[] = "unknown";
+    template <>
+    constexpr char rocblas_gemm_int4_name<rocblas_half>[] = "rocblas_hgemm_int4";
+    template <>
+    constexpr char rocblas_gemm_int4_name<rocblas_bfloat16>[] = "rocblas_bfgemm_int4";
+
+    // Rows of op(A) up to which each thread block reduces one column of B against all rows,
+    // reading every packed weight once as in the decode phase of a language model
+    constexpr rocblas_int ROCBLAS_GEMM_INT4_SMALL_M = 8;
+
+    // Weight l of column j of B, dequantized with the scale and zero point of its group
+    template <typename T>
+    __device__ float rocblas_gemm_int4_weight(const uint8_t* Bj,
+                                              const T*       scales_j,
+                                              const T*       zeros_j,
+                                              rocblas_int    group_size,
+                                              rocblas_int    l)
+    {
+        uint8_t     packed = Bj[l >> 1];
+        int         q      = (l & 1) ? packed >> 4 : packed & 0xf;
+        rocblas_int g      = l / group_size;
+        float       zero   = zeros_j ? float(zeros_j[g]) : 8.0f;
+        return float(scales_j[g]) * (float(q) - zero);
+    }
+
+    template <typename T>
+    __device__ void rocblas_gemm_int4_store(float alpha, float beta, float sum, T* c)
+    {
+        *c = T(beta == 0 ? alpha * sum : alpha * sum + beta * float(*c));
+    }
+
+    // C[:, j] = alpha * op(A) * B[:, j] + beta * C[:, j] for column j = blockIdx.x and m <=
+    // SMALL_M. Each thread dequantizes a strided slice of the column and applies it to all rows.
+    template <int NB, int SMALL_M, typename T, typename U>
+    ROCBLAS_KERNEL(NB)
+    rocblas_gemm_int4_small_m_kernel(bool           trans_a,
+                                     rocblas_int    m,
+                                     rocblas_int    k,
+                                     U              alpha_device_host,
+                                     const T*       A,
+                                     int64_t        lda,
+                                     const uint8_t* B,
+                                     int64_t        ldb,
+                                     const T*       scales,
+                                     const T*       zeros,
+                                     rocblas_int    group_size,
+                                     U              beta_device_host,
+                                     T*             C,
+                                     int64_t        ldc)
+    {
+        float alpha = load_scalar(alpha_device_host);
+        float beta  = load_scalar(beta_device_host);
+        if(!alpha && beta == 1)
+            return;
+
+        int64_t     col    = blockIdx.x;
+        rocblas_int groups = (k - 1) / group_size + 1;
+
+        const uint8_t* Bj       = B + col * ldb;
+        const T*       scales_j = scales + col * groups;
+        const T*       zeros_j  = zeros ? zeros + col * groups : nullptr;
+
+        float sums[SMALL_M];
+#pragma unroll
+        for(int r = 0; r < SMALL_M; r++)
+            sums[r] = 0;
+
+        if(alpha)
+        {
+            for(rocblas_int l = threadIdx.x; l < k; l += NB)
+            {
+                float w = rocblas_gemm_int4_weight(Bj, scales_j, zeros_j, group_size, l);
+#pragma unroll
+                for(int r = 0; r < SMALL_M; r++)
+                    if(r < m)
+                        sums[r] += w * float(trans_a ? A[r * lda + l] : A[l * lda + r]);
+            }
+        }
+
+#pragma unroll
+        for(int r = 0; r < SMALL_M; r++)
+        {
+            if(r < m)
+            {
+                float sum = rocblas_dot_block_reduce<NB>(sums[r]);
+                if(threadIdx.x == 0)
+                    rocblas_gemm_int4_store(alpha, beta, sum, C + col * ldc + r);
+            }
+        }
+    }
+
+    // C = alpha * op(A) * B + beta * C with BLK_M by BLK_N tiles of C per block. The tiles of
+    // A are converted, and the tiles of B dequantized, to float as they are staged in LDS.
+    template <int DIM_M, int DIM_N, int BLK_M, int BLK_N, int BLK_K, typename T, typename U>
+    ROCBLAS_KERNEL(DIM_M* DIM_N)
+    rocblas_gemm_int4_kernel(bool           trans_a,
+                             rocblas_int    m,
+                             rocblas_int    n,
+                             rocblas_int    k,
+                             U              alpha_device_host,
+                             const T*       A,
+                             int64_t        lda,
+                             const uint8_t* B,
+                             int64_t        ldb,
+                             const T*       scales,
+                             const T*       zeros,
+                             rocblas_int    group_size,
+                             U              beta_device_host,
+                             T*             C,
+                             int64_t        ldc)
+    {
+        static constexpr int NT = DIM_M * DIM_N;
+
+        __shared__ float sA[BLK_K][BLK_M + 1];
+        __shared__ float sB[BLK_N][BLK_K + 1];
+
+        float alpha = load_scalar(alpha_device_host);
+        float beta  = load_scalar(beta_device_host);
+        if(!alpha && beta == 1)
+            return;
+
+        int         thx    = threadIdx.x;
+        int         thy    = threadIdx.y;
+        int         tid    = DIM_M * thy + thx;
+        int64_t     row0   = int64_t(blockIdx.x) * BLK_M;
+        int64_t     col0   = int64_t(blockIdx.y) * BLK_N;
+        rocblas_int groups = (k - 1) / group_size + 1;
+
+        float rC[BLK_N / DIM_N][BLK_M / DIM_M];
+        for(int c = 0; c < BLK_N / DIM_N; c++)
+            for(int r = 0; r < BLK_M / DIM_M; r++)
+                rC[c][r] = 0;
+
+        for(rocblas_int kk = 0; alpha && kk < k; kk += BLK_K)
+        {
+            // element e of the A tile, contiguous along the rows of A in memory
+            for(int e = tid; e < BLK_M * BLK_K; e += NT)
+            {
+                int     r = trans_a ? e / BLK_K : e % BLK_M;
+                int     l = trans_a ? e % BLK_K : e / BLK_M;
+                int64_t i = row0 + r;
+                int64_t p = kk + l;
+                float   a = 0;
+                if(i < m && p < k)
+                    a = float(trans_a ? A[i * lda + p] : A[p * lda + i]);
+                sA[l][r] = a;
+            }
+
+            // each byte of the B tile holds two consecutive weights of a column
+            for(int e = tid; e < BLK_N * BLK_K / 2; e += NT)
+            {
+                int     b = e % (BLK_K / 2);
+                int     c = e / (BLK_K / 2);
+                int64_t j = col0 + c;
+                for(int h = 0; h < 2; h++)
+                {
+                    rocblas_int l = kk + 2 * b + h;
+                    float       w = 0;
+                    if(j < n && l < k)
+                        w = rocblas_gemm_int4_weight(B + j * ldb,
+                                                     scales + j * groups,
+                                                     zeros ? zeros + j * groups : nullptr,
+                                                     group_size,
+                                                     l);
+                    sB[c][2 * b + h] = w;
+                }
+            }
+
+            __syncthreads();
+
+            for(int l = 0; l < BLK_K; l++)
+                for(int c = 0; c < BLK_N / DIM_N; c++)
+                    for(int r = 0; r < BLK_M / DIM_M; r++)
+                        rC[c][r] += sA[l][r * DIM_M + thx] * sB[c * DIM_N + thy][l];
+
+            __syncthreads();
+        }
+
+        for(int c = 0; c < BLK_N / DIM_N; c++)
+        {
+            for(int r = 0; r < BLK_M / DIM_M; r++)
+            {
+                int64_t i = row0 + r * DIM_M + thx;
+                int64_t j = col0 + c * DIM_N + thy;
+                if(i < m && j < n)
+                    rocblas_gemm_int4_store(alpha, beta, rC[c][r], C + j * ldc + i);
+            }
+        }
+    }
+
+    template <typename T, typename U>
+    rocblas_status rocblas_gemm_int4_launch(rocblas_handle    handle,
+                                            rocblas_operation trans_a,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            rocblas_int       k,
+                                            U                 alpha,
+                                            const T*          A,
+                                            rocblas_int       lda,
+                                            const uint8_t*    B,
+                                            rocblas_int       ldb,
+                                            const T*          scales,
+                                            const T*          zeros,
+                                            rocblas_int       group_size,
+                                            U                 beta,
+                                            T*                C,
+                                            rocblas_int       ldc)
+    {
+        static constexpr int SMALL_M = ROCBLAS_GEMM_INT4_SMALL_M;
+        static constexpr int NB      = 256;
+        static constexpr int DIM_M   = 16;
+        static constexpr int DIM_N   = 16;
+        static constexpr int BLK_M   = 64;
+        static constexpr int BLK_N   = 64;
+        static constexpr int BLK_K   = 32;
+
+        hipStream_t rocblas_stream = handle->get_stream();
+        bool        trans          = trans_a != rocblas_operation_none;
+
+        if(m <= SMALL_M)
+        {
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_int4_small_m_kernel<NB, SMALL_M>),
+                                  dim3(n),
+                                  dim3(NB),
+                                  0,
+                                  rocblas_stream,
+                                  trans,
+                                  m,
+                                  k,
+                                  alpha,
+                                  A,
+                                  lda,
+                                  B,
+                                  ldb,
+                                  scales,
+                                  zeros,
+                                  group_size,
+                                  beta,
+                                  C,
+                                  ldc);
+            return rocblas_status_success;
+        }
+
+        // each launch covers up to c_i64_grid_YZ_chunk tiles of BLK_N columns
+        rocblas_int groups = (k - 1) / group_size + 1;
+        for(int64_t j_base = 0; j_base < n; j_base += c_i64_grid_YZ_chunk * BLK_N)
+        {
+            rocblas_int n_chunk = rocblas_int(std::min(n - j_base, c_i64_grid_YZ_chunk * BLK_N));
+
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemm_int4_kernel<DIM_M, DIM_N, BLK_M, BLK_N, BLK_K>),
+                                  dim3((m - 1) / BLK_M + 1, (n_chunk - 1) / BLK_N + 1),
+                                  dim3(DIM_M, DIM_N),
+                                  0,
+                                  rocblas_stream,
+                                  trans,
+                                  m,
+                                  n_chunk,
+                                  k,
+                                  alpha,
+                                  A,
+                                  lda,
+                                  B + j_base * ldb,
+                                  ldb,
+                                  scales + j_base * groups,
+                                  zeros ? zeros + j_base * groups : nullptr,
+                                  group_size,
+                                  beta,
+                                  C + j_base * ldc,
+                                  ldc);
+        }
+        return rocblas_status_success;
+    }
+
+    template <typename T>
+    rocblas_status rocblas_gemm_int4_impl(rocblas_handle    handle,
+                                          rocblas_operation trans_a,
+                                          rocblas_int       m,
+                                          rocblas_int       n,
+                                          rocblas_int       k,
+                                          const float*      alpha,
+                                          const T*          A,
+                                          rocblas_int       lda,
+                                          const uint8_t*    B,
+                                          rocblas_int       ldb,
+                                          const T*          scales,
+                                          const T*          zeros,
+                                          rocblas_int       group_size,
+                                          const float*      beta,
+                                          T*                C,
+                                          rocblas_int       ldc)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // row major order, see rocblas_set_order, has no column major mapping here
+        RETURN_NOT_IMPLEMENTED_IF_ROW_MAJOR(handle);
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_gemm_int4_name<T>,
+                      trans_a,
+                      m,
+                      n,
+                      k,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      A,
+                      lda,
+                      B,
+                      ldb,
+                      scales,
+                      zeros,
+                      group_size,
+                      LOG_TRACE_SCALAR_VALUE(handle, beta),
+                      C,
+                      ldc);
+
+        if(trans_a != rocblas_operation_none && trans_a != rocblas_operation_transpose
+           && trans_a != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+
+        // B packs two weights per byte along its columns
+        rocblas_int a_rows = trans_a == rocblas_operation_none ? m : k;
+        if(m < 0 || n < 0 || k < 0 || group_size < 1 || lda < std::max(a_rows, 1)
+           || ldb < std::max(k / 2 + k % 2, 1) || ldc < std::max(m, 1))
+            return rocblas_status_invalid_size;
+
+        if(!m || !n)
+            return rocblas_status_success;
+
+        if(!alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+        {
+            if(!C || (k && (!A || !B || !scales)))
+                return rocblas_status_invalid_pointer;
+
+            return rocblas_gemm_int4_launch(handle,
+                                            trans_a,
+                                            m,
+                                            n,
+                                            k,
+                                            alpha,
+                                            A,
+                                            lda,
+                                            B,
+                                            ldb,
+                                            scales,
+                                            zeros,
+                                            group_size,
+                                            beta,
+                                            C,
+                                            ldc);
+        }
+
+        if(*alpha == 0 && *beta == 1)
+            return rocblas_status_success;
+
+        if(!C || (k && *alpha != 0 && (!A || !B || !scales)))
+            return rocblas_status_invalid_pointer;
+
+        // with k == 0 only C is scaled by beta
+        return rocblas_gemm_int4_launch(handle,
+                                        trans_a,
+                                        m,
+                                        n,
+                                        k,
+                                        k ? *alpha : 0.0f,
+                                        A,
+                                        lda,
+                                        B,
+                                        ldb,
+                                        scales,
+                                        zeros,
+                                        group_size,
+                                        *beta,
+                                        C,
+                                        ldc);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(name_, T_)                                                                       \
+    rocblas_status name_(rocblas_handle    handle,                                            \
+                         rocblas_operation trans_a,                                           \
+                         rocblas_int       m,                                                 \
+                         rocblas_int       n,                                                 \
+                         rocblas_int       k,                                                 \
+                         const float*      alpha,                                             \
+                         const T_*         A,                                                 \
+                         rocblas_int       lda,                                               \
+                         const uint8_t*    B,                                                 \
+                         rocblas_int       ldb,                                               \
+                         const T_*         scales,                                            \
+                         const T_*         zeros,                                             \
+                         rocblas_int       group_size,                                        \
+                         const float*      beta,                                              \
+                         T_*               C,                                                 \
+                         rocblas_int       ldc)                                               \
+    try                                                                                       \
+    {                                                                                         \
+        return rocblas_gemm_int4_impl<T_>(                                                    \
+            handle, trans_a, m, n, k, alpha, A, lda, B, ldb, scales, zeros, group_size, beta, \
+            C, ldc);                                                                          \
+    }                                                                                         \
+    catch(...)                                                                                \
+    {                                                                                         \
+        return exception_to_rocblas_status();                                                 \
+    }
+
+extern "C" {
+
+IMPL(rocblas_hgemm_int4, rocblas_half);
+IMPL(rocblas_bfgemm_int4, rocblas_bfloat16);
+
+} // extern "C"
+
+#undef IMPL
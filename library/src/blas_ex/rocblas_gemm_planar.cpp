@@ -0,0 +1,514 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * gemm and gemv on planar complex matrices, which store the real and imaginary parts of their
+ * elements in separate real matrices. The complex product is formed from four real gemm or gemv
+ * products of the parts, so that pipelines keeping their data planar skip the passes that would
+ * interleave it for cgemm or zgemm and split the result again, and every load of the real
+ * kernels is of consecutive real elements.
+ */
+
+#include "../blas2/rocblas_gemv.hpp"
+#include "../blas3/rocblas_gemm.hpp"
+#include "handle.hpp"
+#include "int64_helpers.hpp"
+#include "logging.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_gemm_planar_name[] = "unknown";
+    template <>
+    constexpr char rocblas_gemm_planar_name<rocblas_float_complex>[] = "rocblas_cgemm_planar";
+    template <>
+    constexpr char rocblas_gemm_planar_name<rocblas_double_complex>[] = "rocblas_zgemm_planar";
+
+    template <typename>
+    constexpr char rocblas_gemv_planar_name[] = "unknown";
+    template <>
+    constexpr char rocblas_gemv_planar_name<rocblas_float_complex>[] = "rocblas_cgemv_planar";
+    template <>
+    constexpr char rocblas_gemv_planar_name<rocblas_double_complex>[] = "rocblas_zgemv_planar";
+
+    // C := alpha * P + beta * C for the m by n planar matrices P, stored contiguously, and C,
+    // whose element (i, j) is at i * inc + j * ldc. C is not read when beta is zero, nor P when
+    // alpha is.
+    template <int DIM_X, int DIM_Y, typename T, typename U>
+    ROCBLAS_KERNEL(DIM_X* DIM_Y)
+    rocblas_planar_combine_kernel(rocblas_int m,
+                                  rocblas_int n,
+                                  T           alpha,
+                                  const U*    Pr,
+                                  const U*    Pi,
+                                  T           beta,
+                                  U*          Cr,
+                                  U*          Ci,
+                                  int64_t     inc,
+                                  int64_t     ldc)
+    {
+        int64_t i = blockIdx.x * int64_t(DIM_X) + threadIdx.x;
+        if(i >= m)
+            return;
+
+        for(int64_t j = blockIdx.y * int64_t(DIM_Y) + threadIdx.y; j < n;
+            j += int64_t(gridDim.y) * DIM_Y)
+        {
+            T      c   = alpha == T(0) ? T(0) : alpha * T(Pr[j * m + i], Pi[j * m + i]);
+            size_t idx = i * inc + j * ldc;
+            if(beta != T(0))
+                c += beta * T(Cr[idx], Ci[idx]);
+            Cr[idx] = std::real(c);
+            Ci[idx] = std::imag(c);
+        }
+    }
+
+    template <typename T, typename U>
+    rocblas_status rocblas_planar_combine(rocblas_handle handle,
+                                          rocblas_int    m,
+                                          rocblas_int    n,
+                                          T              alpha,
+                                          const U*       Pr,
+                                          const U*       Pi,
+                                          T              beta,
+                                          U*             Cr,
+                                          U*             Ci,
+                                          int64_t        inc,
+                                          int64_t        ldc)
+    {
+        static constexpr int DIM_X = 64;
+        static constexpr int DIM_Y = 8;
+
+        int64_t blocks_y = std::min(int64_t((n - 1) / DIM_Y + 1), c_i64_grid_YZ_chunk);
+        ROCBLAS_LAUNCH_KERNEL((rocblas_planar_combine_kernel<DIM_X, DIM_Y>),
+                              dim3((m - 1) / DIM_X + 1, blocks_y),
+                              dim3(DIM_X, DIM_Y),
+                              0,
+                              handle->get_stream(),
+                              m,
+                              n,
+                              alpha,
+                              Pr,
+                              Pi,
+                              beta,
+                              Cr,
+                              Ci,
+                              inc,
+                              ldc);
+        return rocblas_status_success;
+    }
+
+    // The conjugate transpose of a planar matrix is the transpose of its real part and the
+    // negated transpose of its imaginary part
+    inline rocblas_operation rocblas_planar_real_op(rocblas_operation trans)
+    {
+        return trans == rocblas_operation_none ? rocblas_operation_none
+                                               : rocblas_operation_transpose;
+    }
+
+    inline int rocblas_planar_imag_sign(rocblas_operation trans)
+    {
+        return trans == rocblas_operation_conjugate_transpose ? -1 : 1;
+    }
+
+    // C = alpha * op(A) * op(B) + beta * C with planar complex A, B and C
+    template <typename T>
+    rocblas_status rocblas_gemm_planar_impl(rocblas_handle    handle,
+                                            rocblas_operation transA,
+                                            rocblas_operation transB,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            rocblas_int       k,
+                                            const T*          alpha,
+                                            const real_t<T>*  Ar,
+                                            const real_t<T>*  Ai,
+                                            rocblas_int       lda,
+                                            const real_t<T>*  Br,
+                                            const real_t<T>*  Bi,
+                                            rocblas_int       ldb,
+                                            const T*          beta,
+                                            real_t<T>*        Cr,
+                                            real_t<T>*        Ci,
+                                            rocblas_int       ldc)
+    {
+        using U = real_t<T>;
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // row major order, see rocblas_set_order, has no column major mapping here
+        RETURN_NOT_IMPLEMENTED_IF_ROW_MAJOR(handle);
+
+        // the product is formed in the workspace for a complex alpha or beta
+        size_t dev_bytes = sizeof(U) * 2 * std::max(m, 0) * std::max(n, 0);
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(dev_bytes);
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_gemm_planar_name<T>,
+                      transA,
+                      transB,
+                      m,
+                      n,
+                      k,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      Ar,
+                      Ai,
+                      lda,
+                      Br,
+                      Bi,
+                      ldb,
+                      LOG_TRACE_SCALAR_VALUE(handle, beta),
+                      Cr,
+                      Ci,
+                      ldc);
+
+        if(transA != rocblas_operation_none && transA != rocblas_operation_transpose
+           && transA != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+        if(transB != rocblas_operation_none && transB != rocblas_operation_transpose
+           && transB != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+
+        rocblas_int rows_a = transA == rocblas_operation_none ? m : k;
+        rocblas_int rows_b = transB == rocblas_operation_none ? k : n;
+        if(m < 0 || n < 0 || k < 0 || lda < std::max(rows_a, 1) || ldb < std::max(rows_b, 1)
+           || ldc < std::max(m, 1))
+            return rocblas_status_invalid_size;
+
+        if(!m || !n)
+            return rocblas_status_success;
+        if(!alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        // the real products take alpha and beta on the host
+        T alpha_h, beta_h;
+        RETURN_IF_ROCBLAS_ERROR(
+            rocblas_copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, k));
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        T a = k ? *alpha : T(0), b = *beta;
+        if(a == T(0) && b == T(1))
+            return rocblas_status_success;
+        if(!Cr || !Ci || (a != T(0) && (!Ar || !Ai || !Br || !Bi)))
+            return rocblas_status_invalid_pointer;
+
+        rocblas_operation op_a = rocblas_planar_real_op(transA);
+        rocblas_operation op_b = rocblas_planar_real_op(transB);
+        int               sa   = rocblas_planar_imag_sign(transA);
+        int               sb   = rocblas_planar_imag_sign(transB);
+
+        // C_ := scale * op(A_) * op(B_) + beta_ * C_ with the real gemm
+        auto gemm = [&](U scale, const U* A_, const U* B_, U beta_, U* C_, rocblas_int ldc_) {
+            return rocblas_internal_gemm_template<U>(handle,
+                                                     op_a,
+                                                     op_b,
+                                                     m,
+                                                     n,
+                                                     k,
+                                                     &scale,
+                                                     A_,
+                                                     0,
+                                                     lda,
+                                                     0,
+                                                     B_,
+                                                     0,
+                                                     ldb,
+                                                     0,
+                                                     &beta_,
+                                                     C_,
+                                                     0,
+                                                     ldc_,
+                                                     0,
+                                                     1);
+        };
+
+        // With real alpha and beta the four products accumulate directly in the parts of C:
+        //   Cr = alpha * (Ar * Br - Ai * Bi) + beta * Cr,
+        //   Ci = alpha * (Ar * Bi + Ai * Br) + beta * Ci,
+        // with the signs of the imaginary parts of conjugate transposed operands reversed
+        if(std::imag(a) == 0 && std::imag(b) == 0)
+        {
+            U ar = std::real(a), br = std::real(b);
+            RETURN_IF_ROCBLAS_ERROR(gemm(ar, Ar, Br, br, Cr, ldc));
+            RETURN_IF_ROCBLAS_ERROR(gemm(sb * ar, Ar, Bi, br, Ci, ldc));
+            if(ar != 0)
+            {
+                RETURN_IF_ROCBLAS_ERROR(gemm(-sa * sb * ar, Ai, Bi, 1, Cr, ldc));
+                RETURN_IF_ROCBLAS_ERROR(gemm(sa * ar, Ai, Br, 1, Ci, ldc));
+            }
+            return rocblas_status_success;
+        }
+
+        // Otherwise the product P = op(A) * op(B) is formed in the workspace and scaled into C
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        U* Pr = (U*)w_mem[0];
+        U* Pi = Pr + size_t(m) * n;
+        if(a != T(0))
+        {
+            RETURN_IF_ROCBLAS_ERROR(gemm(1, Ar, Br, 0, Pr, m));
+            RETURN_IF_ROCBLAS_ERROR(gemm(-sa * sb, Ai, Bi, 1, Pr, m));
+            RETURN_IF_ROCBLAS_ERROR(gemm(sb, Ar, Bi, 0, Pi, m));
+            RETURN_IF_ROCBLAS_ERROR(gemm(sa, Ai, Br, 1, Pi, m));
+        }
+
+        return rocblas_planar_combine(handle, m, n, a, Pr, Pi, b, Cr, Ci, 1, ldc);
+    }
+
+    // y = alpha * op(A) * x + beta * y with planar complex A, x and y
+    template <typename T>
+    rocblas_status rocblas_gemv_planar_impl(rocblas_handle    handle,
+                                            rocblas_operation transA,
+                                            rocblas_int       m,
+                                            rocblas_int       n,
+                                            const T*          alpha,
+                                            const real_t<T>*  Ar,
+                                            const real_t<T>*  Ai,
+                                            rocblas_int       lda,
+                                            const real_t<T>*  xr,
+                                            const real_t<T>*  xi,
+                                            rocblas_int       incx,
+                                            const T*          beta,
+                                            real_t<T>*        yr,
+                                            real_t<T>*        yi,
+                                            rocblas_int       incy)
+    {
+        using U = real_t<T>;
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // row major order, see rocblas_set_order, has no column major mapping here
+        RETURN_NOT_IMPLEMENTED_IF_ROW_MAJOR(handle);
+
+        rocblas_operation op_a    = rocblas_planar_real_op(transA);
+        rocblas_int       len_x   = transA == rocblas_operation_none ? n : m;
+        rocblas_int       len_y   = transA == rocblas_operation_none ? m : n;
+        size_t            p_bytes = sizeof(U) * 2 * std::max(len_y, 0);
+        size_t            gemv_bytes
+            = ROCBLAS_API(rocblas_internal_gemv_kernel_workspace_size)<U>(op_a, m, n, 1);
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(gemv_bytes, p_bytes);
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_gemv_planar_name<T>,
+                      transA,
+                      m,
+                      n,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      Ar,
+                      Ai,
+                      lda,
+                      xr,
+                      xi,
+                      incx,
+                      LOG_TRACE_SCALAR_VALUE(handle, beta),
+                      yr,
+                      yi,
+                      incy);
+
+        if(transA != rocblas_operation_none && transA != rocblas_operation_transpose
+           && transA != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+
+        if(m < 0 || n < 0 || lda < std::max(m, 1) || !incx || !incy)
+            return rocblas_status_invalid_size;
+
+        if(!m || !n)
+            return rocblas_status_success;
+        if(!alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        T alpha_h, beta_h;
+        RETURN_IF_ROCBLAS_ERROR(rocblas_copy_alpha_beta_to_host_if_on_device(
+            handle, alpha, beta, alpha_h, beta_h, len_x));
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        T a = *alpha, b = *beta;
+        if(a == T(0) && b == T(1))
+            return rocblas_status_success;
+        if(!yr || !yi || (a != T(0) && (!Ar || !Ai || !xr || !xi)))
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->device_malloc(gemv_bytes, p_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        int sa = rocblas_planar_imag_sign(transA);
+
+        // y_ := scale * op(A_) * x_ + beta_ * y_ with the real gemv
+        auto gemv = [&](U scale, const U* A_, const U* x_, U beta_, U* y_, rocblas_int incy_) {
+            return rocblas_internal_gemv_template<U>(handle,
+                                                     op_a,
+                                                     m,
+                                                     n,
+                                                     &scale,
+                                                     0,
+                                                     A_,
+                                                     0,
+                                                     lda,
+                                                     0,
+                                                     x_,
+                                                     0,
+                                                     incx,
+                                                     0,
+                                                     &beta_,
+                                                     0,
+                                                     y_,
+                                                     0,
+                                                     incy_,
+                                                     0,
+                                                     1,
+                                                     (U*)w_mem[0]);
+        };
+
+        if(std::imag(a) == 0 && std::imag(b) == 0)
+        {
+            U ar = std::real(a), br = std::real(b);
+            RETURN_IF_ROCBLAS_ERROR(gemv(ar, Ar, xr, br, yr, incy));
+            RETURN_IF_ROCBLAS_ERROR(gemv(ar, Ar, xi, br, yi, incy));
+            if(ar != 0)
+            {
+                RETURN_IF_ROCBLAS_ERROR(gemv(-sa * ar, Ai, xi, 1, yr, incy));
+                RETURN_IF_ROCBLAS_ERROR(gemv(sa * ar, Ai, xr, 1, yi, incy));
+            }
+            return rocblas_status_success;
+        }
+
+        U* Pr = (U*)w_mem[1];
+        U* Pi = Pr + len_y;
+        if(a != T(0))
+        {
+            RETURN_IF_ROCBLAS_ERROR(gemv(1, Ar, xr, 0, Pr, 1));
+            RETURN_IF_ROCBLAS_ERROR(gemv(-sa, Ai, xi, 1, Pr, 1));
+            RETURN_IF_ROCBLAS_ERROR(gemv(1, Ar, xi, 0, Pi, 1));
+            RETURN_IF_ROCBLAS_ERROR(gemv(sa, Ai, xr, 1, Pi, 1));
+        }
+
+        // y is combined as a len_y by 1 matrix, from its first element in memory for incy < 0
+        int64_t shift = incy < 0 ? int64_t(len_y - 1) * incy : 0;
+        return rocblas_planar_combine(
+            handle, len_y, 1, a, Pr, Pi, b, yr - shift, yi - shift, incy, 0);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#ifdef IMPL_GEMM
+#error IMPL_GEMM ALREADY DEFINED
+#endif
+
+#ifdef IMPL_GEMV
+#error IMPL_GEMV ALREADY DEFINED
+#endif
+
+#define IMPL_GEMM(name_, T_)                                                                   \
+    rocblas_status name_(rocblas_handle    handle,                                             \
+                         rocblas_operation transA,                                             \
+                         rocblas_operation transB,                                             \
+                         rocblas_int       m,                                                  \
+                         rocblas_int       n,                                                  \
+                         rocblas_int       k,                                                  \
+                         const T_*         alpha,                                              \
+                         const real_t<T_>* Ar,                                                 \
+                         const real_t<T_>* Ai,                                                 \
+                         rocblas_int       lda,                                                \
+                         const real_t<T_>* Br,                                                 \
+                         const real_t<T_>* Bi,                                                 \
+                         rocblas_int       ldb,                                                \
+                         const T_*         beta,                                               \
+                         real_t<T_>*       Cr,                                                 \
+                         real_t<T_>*       Ci,                                                 \
+                         rocblas_int       ldc)                                                \
+    try                                                                                        \
+    {                                                                                          \
+        return rocblas_gemm_planar_impl<T_>(handle,                                            \
+                                            transA,                                            \
+                                            transB,                                            \
+                                            m,                                                 \
+                                            n,                                                 \
+                                            k,                                                 \
+                                            alpha,                                             \
+                                            Ar,                                                \
+                                            Ai,                                                \
+                                            lda,                                               \
+                                            Br,                                                \
+                                            Bi,                                                \
+                                            ldb,                                               \
+                                            beta,                                              \
+                                            Cr,                                                \
+                                            Ci,                                                \
+                                            ldc);                                              \
+    }                                                                                          \
+    catch(...)                                                                                 \
+    {                                                                                          \
+        return exception_to_rocblas_status();                                                  \
+    }
+
+#define IMPL_GEMV(name_, T_)                                                                   \
+    rocblas_status name_(rocblas_handle    handle,                                             \
+                         rocblas_operation transA,                                             \
+                         rocblas_int       m,                                                  \
+                         rocblas_int       n,                                                  \
+                         const T_*         alpha,                                              \
+                         const real_t<T_>* Ar,                                                 \
+                         const real_t<T_>* Ai,                                                 \
+                         rocblas_int       lda,                                                \
+                         const real_t<T_>* xr,                                                 \
+                         const real_t<T_>* xi,                                                 \
+                         rocblas_int       incx,                                               \
+                         const T_*         beta,                                               \
+                         real_t<T_>*       yr,                                                 \
+                         real_t<T_>*       yi,                                                 \
+                         rocblas_int       incy)                                               \
+    try                                                                                        \
+    {                                                                                          \
+        return rocblas_gemv_planar_impl<T_>(                                                   \
+            handle, transA, m, n, alpha, Ar, Ai, lda, xr, xi, incx, beta, yr, yi, incy);       \
+    }                                                                                          \
+    catch(...)                                                                                 \
+    {                                                                                          \
+        return exception_to_rocblas_status();                                                  \
+    }
+
+extern "C" {
+
+IMPL_GEMM(rocblas_cgemm_planar, rocblas_float_complex);
+IMPL_GEMM(rocblas_zgemm_planar, rocblas_double_complex);
+
+IMPL_GEMV(rocblas_cgemv_planar, rocblas_float_complex);
+IMPL_GEMV(rocblas_zgemv_planar, rocblas_double_complex);
+
+} // extern "C"
+
+#undef IMPL_GEMV
+#undef IMPL_GEMM
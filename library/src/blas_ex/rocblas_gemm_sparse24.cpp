@@ -0,0 +1,489 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * gemm with a 2:4 structured sparse A of half or bfloat16 weights. Each group of 4 consecutive
+ * elements of a row of A holds at most 2 nonzeros, stored compressed as the m by k/2 matrix Ac
+ * of the kept values and the m by ceil(k/8) matrix meta of their positions in the group, 2 bits
+ * per value, 4 bits per group and 2 groups per byte, the lower nibble holding the even group.
+ * The kernel multiplies only the kept values, half of the products of the dense gemm.
+ */
+
+#include "handle.hpp"
+#include "int64_helpers.hpp"
+#include "logging.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_gemm_sparse24_name[] = "unknown";
+    template <>
+    constexpr char rocblas_gemm_sparse24_name<rocblas_half>[] = "rocblas_hgemm_sparse24";
+    template <>
+    constexpr char rocblas_gemm_sparse24_name<rocblas_bfloat16>[] = "rocblas_bfgemm_sparse24";
+
+    template <typename>
+    constexpr char rocblas_sparse24_compress_name[] = "unknown";
+    template <>
+    constexpr char rocblas_sparse24_compress_name<rocblas_half>[] = "rocblas_hsparse24_compress";
+    template <>
+    constexpr char rocblas_sparse24_compress_name<rocblas_bfloat16>[]
+        = "rocblas_bfsparse24_compress";
+
+    // Position in its group of 4 of the kept value q of a row, from the meta byte of the row
+    __device__ inline int rocblas_sparse24_index(uint8_t meta, int64_t q)
+    {
+        int64_t g = q / 2;
+        return (meta >> (4 * (g % 2) + 2 * (q % 2))) & 3;
+    }
+
+    // C = alpha * A * op(B) + beta * C with BLK_M by BLK_N tiles of C per block. The kept values
+    // of A are staged in LDS in float with their column in the K tile, and each is multiplied
+    // by the row of the B tile it selects.
+    template <int DIM_M, int DIM_N, int BLK_M, int BLK_N, int BLK_K, typename T, typename U>
+    ROCBLAS_KERNEL(DIM_M* DIM_N)
+    rocblas_gemm_sparse24_kernel(bool           trans_b,
+                                 rocblas_int    m,
+                                 rocblas_int    n,
+                                 rocblas_int    k,
+                                 U              alpha_device_host,
+                                 const T*       Ac,
+                                 int64_t        ldac,
+                                 const uint8_t* meta,
+                                 int64_t        ldmeta,
+                                 const T*       B,
+                                 int64_t        ldb,
+                                 U              beta_device_host,
+                                 T*             C,
+                                 int64_t        ldc)
+    {
+        static constexpr int NT = DIM_M * DIM_N;
+        static constexpr int KC = BLK_K / 2;
+
+        __shared__ float   sA[KC][BLK_M + 1];
+        __shared__ uint8_t sL[KC][BLK_M + 1];
+        __shared__ float   sB[BLK_N][BLK_K + 1];
+
+        float alpha = load_scalar(alpha_device_host);
+        float beta  = load_scalar(beta_device_host);
+        if(!alpha && beta == 1)
+            return;
+
+        int     thx  = threadIdx.x;
+        int     thy  = threadIdx.y;
+        int     tid  = DIM_M * thy + thx;
+        int64_t row0 = int64_t(blockIdx.x) * BLK_M;
+        int64_t col0 = int64_t(blockIdx.y) * BLK_N;
+
+        float rC[BLK_N / DIM_N][BLK_M / DIM_M];
+        for(int c = 0; c < BLK_N / DIM_N; c++)
+            for(int r = 0; r < BLK_M / DIM_M; r++)
+                rC[c][r] = 0;
+
+        for(rocblas_int kk = 0; alpha && kk < k; kk += BLK_K)
+        {
+            // kept value p of the tile of each row, contiguous along the rows of Ac
+            for(int e = tid; e < BLK_M * KC; e += NT)
+            {
+                int     r = e % BLK_M;
+                int     p = e / BLK_M;
+                int64_t i = row0 + r;
+                int64_t q = kk / 2 + p;
+                float   a = 0;
+                int     l = 0;
+                if(i < m && q < k / 2)
+                {
+                    a = float(Ac[q * ldac + i]);
+                    l = 4 * (p / 2) + rocblas_sparse24_index(meta[(q / 4) * ldmeta + i], q);
+                }
+                sA[p][r] = a;
+                sL[p][r] = l;
+            }
+
+            // element e of the B tile, contiguous along the rows of B in memory
+            for(int e = tid; e < BLK_N * BLK_K; e += NT)
+            {
+                int     c = trans_b ? e % BLK_N : e / BLK_K;
+                int     l = trans_b ? e / BLK_N : e % BLK_K;
+                int64_t j = col0 + c;
+                int64_t p = kk + l;
+                float   b = 0;
+                if(j < n && p < k)
+                    b = float(trans_b ? B[p * ldb + j] : B[j * ldb + p]);
+                sB[c][l] = b;
+            }
+
+            __syncthreads();
+
+            for(int p = 0; p < KC; p++)
+                for(int r = 0; r < BLK_M / DIM_M; r++)
+                {
+                    float a = sA[p][r * DIM_M + thx];
+                    int   l = sL[p][r * DIM_M + thx];
+                    for(int c = 0; c < BLK_N / DIM_N; c++)
+                        rC[c][r] += a * sB[c * DIM_N + thy][l];
+                }
+
+            __syncthreads();
+        }
+
+        for(int c = 0; c < BLK_N / DIM_N; c++)
+        {
+            for(int r = 0; r < BLK_M / DIM_M; r++)
+            {
+                int64_t i = row0 + r * DIM_M + thx;
+                int64_t j = col0 + c * DIM_N + thy;
+                if(i < m && j < n)
+                {
+                    T* cv = C + j * ldc + i;
+                    *cv   = T(beta == 0 ? alpha * rC[c][r] : alpha * rC[c][r] + beta * float(*cv));
+                }
+            }
+        }
+    }
+
+    // Keeps the 2 elements of largest magnitude of each group of 4 of row i = blockIdx.x * NB +
+    // threadIdx.x, the lower index on ties, for the pairs of groups of the meta columns y
+    template <int NB, typename T>
+    ROCBLAS_KERNEL(NB)
+    rocblas_sparse24_compress_kernel(rocblas_int m,
+                                     rocblas_int k,
+                                     const T*    A,
+                                     int64_t     lda,
+                                     T*          Ac,
+                                     int64_t     ldac,
+                                     uint8_t*    meta,
+                                     int64_t     ldmeta)
+    {
+        int64_t i = int64_t(blockIdx.x) * NB + threadIdx.x;
+        if(i >= m)
+            return;
+
+        rocblas_int groups = k / 4;
+        for(int64_t y = blockIdx.y; y < (groups + 1) / 2; y += gridDim.y)
+        {
+            uint8_t byte = 0;
+            for(int h = 0; h < 2 && 2 * y + h < groups; h++)
+            {
+                int64_t g = 2 * y + h;
+                T       v[4];
+                float   mag[4];
+                for(int l = 0; l < 4; l++)
+                {
+                    v[l]   = A[(4 * g + l) * lda + i];
+                    mag[l] = std::abs(float(v[l]));
+                }
+
+                int first = 0;
+                for(int l = 1; l < 4; l++)
+                    if(mag[l] > mag[first])
+                        first = l;
+                int second = first ? 0 : 1;
+                for(int l = 0; l < 4; l++)
+                    if(l != first && mag[l] > mag[second])
+                        second = l;
+
+                // the kept values in the order of their columns
+                int lo = std::min(first, second), hi = std::max(first, second);
+                Ac[(2 * g) * ldac + i]     = v[lo];
+                Ac[(2 * g + 1) * ldac + i] = v[hi];
+                byte |= uint8_t((lo | hi << 2) << (4 * h));
+            }
+            meta[y * ldmeta + i] = byte;
+        }
+    }
+
+    template <typename T, typename U>
+    rocblas_status rocblas_gemm_sparse24_launch(rocblas_handle    handle,
+                                                rocblas_operation trans_b,
+                                                rocblas_int       m,
+                                                rocblas_int       n,
+                                                rocblas_int       k,
+                                                U                 alpha,
+                                                const T*          Ac,
+                                                rocblas_int       ldac,
+                                                const uint8_t*    meta,
+                                                rocblas_int       ldmeta,
+                                                const T*          B,
+                                                rocblas_int       ldb,
+                                                U                 beta,
+                                                T*                C,
+                                                rocblas_int       ldc)
+    {
+        static constexpr int DIM_M = 16;
+        static constexpr int DIM_N = 16;
+        static constexpr int BLK_M = 64;
+        static constexpr int BLK_N = 64;
+        static constexpr int BLK_K = 32;
+
+        hipStream_t rocblas_stream = handle->get_stream();
+        bool        trans          = trans_b != rocblas_operation_none;
+
+        // each launch covers up to c_i64_grid_YZ_chunk tiles of BLK_N columns
+        for(int64_t j_base = 0; j_base < n; j_base += c_i64_grid_YZ_chunk * BLK_N)
+        {
+            rocblas_int n_chunk = rocblas_int(std::min(n - j_base, c_i64_grid_YZ_chunk * BLK_N));
+
+            ROCBLAS_LAUNCH_KERNEL(
+                (rocblas_gemm_sparse24_kernel<DIM_M, DIM_N, BLK_M, BLK_N, BLK_K>),
+                dim3((m - 1) / BLK_M + 1, (n_chunk - 1) / BLK_N + 1),
+                dim3(DIM_M, DIM_N),
+                0,
+                rocblas_stream,
+                trans,
+                m,
+                n_chunk,
+                k,
+                alpha,
+                Ac,
+                ldac,
+                meta,
+                ldmeta,
+                trans ? B + j_base : B + j_base * ldb,
+                ldb,
+                beta,
+                C + j_base * ldc,
+                ldc);
+        }
+        return rocblas_status_success;
+    }
+
+    template <typename T>
+    rocblas_status rocblas_gemm_sparse24_impl(rocblas_handle    handle,
+                                              rocblas_operation trans_b,
+                                              rocblas_int       m,
+                                              rocblas_int       n,
+                                              rocblas_int       k,
+                                              const float*      alpha,
+                                              const T*          Ac,
+                                              rocblas_int       ldac,
+                                              const uint8_t*    meta,
+                                              rocblas_int       ldmeta,
+                                              const T*          B,
+                                              rocblas_int       ldb,
+                                              const float*      beta,
+                                              T*                C,
+                                              rocblas_int       ldc)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // row major order, see rocblas_set_order, has no column major mapping here
+        RETURN_NOT_IMPLEMENTED_IF_ROW_MAJOR(handle);
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_gemm_sparse24_name<T>,
+                      trans_b,
+                      m,
+                      n,
+                      k,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      Ac,
+                      ldac,
+                      meta,
+                      ldmeta,
+                      B,
+                      ldb,
+                      LOG_TRACE_SCALAR_VALUE(handle, beta),
+                      C,
+                      ldc);
+
+        if(trans_b != rocblas_operation_none && trans_b != rocblas_operation_transpose
+           && trans_b != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+
+        rocblas_int b_rows = trans_b == rocblas_operation_none ? k : n;
+        if(m < 0 || n < 0 || k < 0 || k % 4 || ldac < std::max(m, 1) || ldmeta < std::max(m, 1)
+           || ldb < std::max(b_rows, 1) || ldc < std::max(m, 1))
+            return rocblas_status_invalid_size;
+
+        if(!m || !n)
+            return rocblas_status_success;
+
+        if(!alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+        {
+            if(!C || (k && (!Ac || !meta || !B)))
+                return rocblas_status_invalid_pointer;
+
+            return rocblas_gemm_sparse24_launch(
+                handle, trans_b, m, n, k, alpha, Ac, ldac, meta, ldmeta, B, ldb, beta, C, ldc);
+        }
+
+        if(*alpha == 0 && *beta == 1)
+            return rocblas_status_success;
+
+        if(!C || (k && *alpha != 0 && (!Ac || !meta || !B)))
+            return rocblas_status_invalid_pointer;
+
+        // with k == 0 only C is scaled by beta
+        return rocblas_gemm_sparse24_launch(handle,
+                                            trans_b,
+                                            m,
+                                            n,
+                                            k,
+                                            k ? *alpha : 0.0f,
+                                            Ac,
+                                            ldac,
+                                            meta,
+                                            ldmeta,
+                                            B,
+                                            ldb,
+                                            *beta,
+                                            C,
+                                            ldc);
+    }
+
+    template <typename T>
+    rocblas_status rocblas_sparse24_compress_impl(rocblas_handle handle,
+                                                  rocblas_int    m,
+                                                  rocblas_int    k,
+                                                  const T*       A,
+                                                  rocblas_int    lda,
+                                                  T*             Ac,
+                                                  rocblas_int    ldac,
+                                                  uint8_t*       meta,
+                                                  rocblas_int    ldmeta)
+    {
+        static constexpr int NB = 256;
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // row major order, see rocblas_set_order, has no column major mapping here
+        RETURN_NOT_IMPLEMENTED_IF_ROW_MAJOR(handle);
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_sparse24_compress_name<T>,
+                      m,
+                      k,
+                      A,
+                      lda,
+                      Ac,
+                      ldac,
+                      meta,
+                      ldmeta);
+
+        if(m < 0 || k < 0 || k % 4 || lda < std::max(m, 1) || ldac < std::max(m, 1)
+           || ldmeta < std::max(m, 1))
+            return rocblas_status_invalid_size;
+
+        if(!m || !k)
+            return rocblas_status_success;
+
+        if(!A || !Ac || !meta)
+            return rocblas_status_invalid_pointer;
+
+        int64_t pairs = (k / 4 + 1) / 2;
+        ROCBLAS_LAUNCH_KERNEL((rocblas_sparse24_compress_kernel<NB>),
+                              dim3((m - 1) / NB + 1, std::min(pairs, c_i64_grid_YZ_chunk)),
+                              dim3(NB),
+                              0,
+                              handle->get_stream(),
+                              m,
+                              k,
+                              A,
+                              lda,
+                              Ac,
+                              ldac,
+                              meta,
+                              ldmeta);
+        return rocblas_status_success;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(name_, T_)                                                                       \
+    rocblas_status name_(rocblas_handle    handle,                                            \
+                         rocblas_operation trans_b,                                           \
+                         rocblas_int       m,                                                 \
+                         rocblas_int       n,                                                 \
+                         rocblas_int       k,                                                 \
+                         const float*      alpha,                                             \
+                         const T_*         Ac,                                                \
+                         rocblas_int       ldac,                                              \
+                         const uint8_t*    meta,                                              \
+                         rocblas_int       ldmeta,                                            \
+                         const T_*         B,                                                 \
+                         rocblas_int       ldb,                                               \
+                         const float*      beta,                                              \
+                         T_*               C,                                                 \
+                         rocblas_int       ldc)                                               \
+    try                                                                                       \
+    {                                                                                         \
+        return rocblas_gemm_sparse24_impl<T_>(                                                \
+            handle, trans_b, m, n, k, alpha, Ac, ldac, meta, ldmeta, B, ldb, beta, C, ldc);   \
+    }                                                                                         \
+    catch(...)                                                                                \
+    {                                                                                         \
+        return exception_to_rocblas_status();                                                 \
+    }
+
+#define IMPL_COMPRESS(name_, T_)                                                              \
+    rocblas_status name_(rocblas_handle handle,                                               \
+                         rocblas_int    m,                                                    \
+                         rocblas_int    k,                                                    \
+                         const T_*      A,                                                    \
+                         rocblas_int    lda,                                                  \
+                         T_*            Ac,                                                   \
+                         rocblas_int    ldac,                                                 \
+                         uint8_t*       meta,                                                 \
+                         rocblas_int    ldmeta)                                               \
+    try                                                                                       \
+    {                                                                                         \
+        return rocblas_sparse24_compress_impl<T_>(                                            \
+            handle, m, k, A, lda, Ac, ldac, meta, ldmeta);                                    \
+    }                                                                                         \
+    catch(...)                                                                                \
+    {                                                                                         \
+        return exception_to_rocblas_status();                                                 \
+    }
+
+extern "C" {
+
+IMPL(rocblas_hgemm_sparse24, rocblas_half);
+IMPL(rocblas_bfgemm_sparse24, rocblas_bfloat16);
+IMPL_COMPRESS(rocblas_hsparse24_compress, rocblas_half);
+IMPL_COMPRESS(rocblas_bfsparse24_compress, rocblas_bfloat16);
+
+} // extern "C"
+
+#undef IMPL
+#undef IMPL_COMPRESS
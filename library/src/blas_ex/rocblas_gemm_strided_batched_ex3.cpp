@@ -65,6 +65,18 @@ try
     if(!handle)
         return rocblas_status_invalid_handle;
 
+    // row major C^T = op(B)^T*op(A)^T is a column major gemm, see rocblas_set_order
+    if(handle->order == rocblas_order_row_major)
+    {
+        std::swap(trans_a, trans_b);
+        std::swap(m, n);
+        std::swap(a, b);
+        std::swap(a_type, b_type);
+        std::swap(lda, ldb);
+        std::swap(stride_a, stride_b);
+    }
+
+    rocblas_api_scope api_scope(handle, "rocblas_gemm_strided_batched_ex3");
     if(handle->getArch() >= 940 && handle->getArch() < 1000)
     {
 
@@ -80,10 +92,12 @@ try
             auto layer_mode = handle->layer_mode;
             if(layer_mode
                & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-                  | rocblas_layer_mode_log_profile))
+                  | rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             {
                 char trans_a_letter, trans_b_letter;
-                if(layer_mode & (rocblas_layer_mode_log_bench | rocblas_layer_mode_log_profile))
+                if(layer_mode
+                   & (rocblas_layer_mode_log_bench | rocblas_layer_mode_log_profile
+                      | rocblas_layer_mode_roctx))
                 {
                     trans_a_letter = rocblas_transpose_letter(trans_a);
                     trans_b_letter = rocblas_transpose_letter(trans_b);
@@ -191,7 +205,7 @@ try
                     }
                 }
 
-                if(layer_mode & rocblas_layer_mode_log_profile)
+                if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                 {
                     log_profile(handle,
                                 "rocblas_gemm_strided_batched_ex3",
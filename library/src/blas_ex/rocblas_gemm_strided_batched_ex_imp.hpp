@@ -63,6 +63,17 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        // row major C^T = op(B)^T*op(A)^T is a column major gemm, see rocblas_set_order
+        if(handle->order == rocblas_order_row_major)
+        {
+            std::swap(trans_a, trans_b);
+            std::swap(m, n);
+            std::swap(a, b);
+            std::swap(a_type, b_type);
+            std::swap(lda, ldb);
+            std::swap(stride_a, stride_b);
+        }
+
         const bool HPA = compute_type == rocblas_datatype_f32_r
                          && (a_type == rocblas_datatype_f16_r || a_type == rocblas_datatype_bf16_r);
 
@@ -75,16 +86,19 @@ namespace
             handle, alpha, beta, alpha_h, beta_h, k, compute_type));
         auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
 
+        rocblas_api_scope api_scope(handle, ROCBLAS_API_STR(rocblas_gemm_strided_batched_ex));
         if(!handle->is_device_memory_size_query())
         {
             // Perform logging
             auto layer_mode = handle->layer_mode;
             if(layer_mode
                & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-                  | rocblas_layer_mode_log_profile))
+                  | rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             {
                 char trans_a_letter, trans_b_letter;
-                if(layer_mode & (rocblas_layer_mode_log_bench | rocblas_layer_mode_log_profile))
+                if(layer_mode
+                   & (rocblas_layer_mode_log_bench | rocblas_layer_mode_log_profile
+                      | rocblas_layer_mode_roctx))
                 {
                     trans_a_letter = rocblas_transpose_letter(trans_a);
                     trans_b_letter = rocblas_transpose_letter(trans_b);
@@ -192,7 +206,7 @@ namespace
                     }
                 }
 
-                if(layer_mode & rocblas_layer_mode_log_profile)
+                if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
                 {
                     log_profile(handle,
                                 ROCBLAS_API_STR(rocblas_gemm_strided_batched_ex),
@@ -282,6 +296,18 @@ namespace
             return validArgs;
         }
 
+        // Apply the epilogue set on the handle, if any, to this call only
+        auto epilogue       = handle->get_gemm_epilogue();
+        auto saved_epilogue = handle->push_gemm_epilogue(epilogue);
+        if(epilogue)
+            RETURN_IF_ROCBLAS_ERROR(rocblas_gemm_epilogue_arg_check(*epilogue, m, compute_type));
+
+        // the scalars of the batches apply to the rocblas_int interface only, as the epilogue
+        // of gemv
+        const rocblas_gemm_batch_scalars* batch_scalars
+            = std::is_same_v<API_INT, rocblas_int> ? handle->get_gemm_batch_scalars() : nullptr;
+        auto saved_batch_scalars = handle->push_gemm_batch_scalars(batch_scalars);
+
         return ROCBLAS_API(rocblas_gemm_ex_template)<false>(handle,
                                                             trans_a,
                                                             trans_b,
@@ -980,16 +980,9 @@ rocblas_status rocblas_internal_gemmt_launcher(rocblas_handle    handle,
                                                rocblas_stride    stride_c,
                                                rocblas_int       batch_count)
 {
-    //Identifying the precision to have an appropriate optimization
-    static constexpr bool is_float                  = std::is_same_v<TScal, float>;
-    static constexpr bool is_double                 = std::is_same_v<TScal, double>;
-    static constexpr bool rocblas_is_complex_float  = std::is_same_v<TScal, rocblas_float_complex>;
-    static constexpr bool rocblas_is_complex_double = std::is_same_v<TScal, rocblas_double_complex>;
-
     // GEMM based block recursive algorithm
-    if((n >= n_zgemmt_threshold && k >= k_zgemmt_threshold && rocblas_is_complex_double)
-       || (n >= n_gemmt_threshold && k >= k_gemmt_threshold
-           && (is_float || is_double || rocblas_is_complex_float)))
+    if(rocblas_gemmt_use_recursive(
+           rocblas_gemmt_get_thresholds(handle), rocblas_gemmt_precision<TScal>(), n, k))
     {
         // BATCHED is true for _batched and false for _strided_batched and non-batched
         constexpr bool BATCHED
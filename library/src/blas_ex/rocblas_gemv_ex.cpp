@@ -0,0 +1,330 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * gemv_ex selects the gemv for the datatypes of A, x, y and the computation. Half and bfloat16
+ * A and x use the mixed precision gemv launcher with float computation, and f8 and bf8 A with
+ * float x and y the kernels below, reading one byte per element of A.
+ */
+
+#include "../blas1/rocblas_reduction.hpp"
+#include "handle.hpp"
+#include "int64_helpers.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "utility.hpp"
+
+namespace
+{
+    constexpr int c_gemv_ex_NB = 256;
+
+    // y = alpha * A * x + beta * y, one row of A per thread
+    template <int NB, typename Ta, typename TScal>
+    ROCBLAS_KERNEL(NB)
+    rocblas_gemv_ex_f8_kernel(rocblas_int  m,
+                              rocblas_int  n,
+                              TScal        alpha_device_host,
+                              const Ta*    A,
+                              int64_t      lda,
+                              const float* x,
+                              int64_t      incx,
+                              TScal        beta_device_host,
+                              float*       y,
+                              int64_t      incy)
+    {
+        float   alpha = load_scalar(alpha_device_host);
+        float   beta  = load_scalar(beta_device_host);
+        int64_t i     = blockIdx.x * int64_t(NB) + threadIdx.x;
+        if(i >= m)
+            return;
+
+        float sum = 0;
+        if(alpha != 0)
+            for(rocblas_int j = 0; j < n; j++)
+                sum += float(A[j * lda + i]) * x[j * incx];
+
+        float* yi = y + i * incy;
+        *yi       = beta == 0 ? alpha * sum : alpha * sum + beta * *yi;
+    }
+
+    // y = alpha * A**T * x + beta * y, one column of A per block
+    template <int NB, typename Ta, typename TScal>
+    ROCBLAS_KERNEL(NB)
+    rocblas_gemv_ex_f8_trans_kernel(rocblas_int  m,
+                                    TScal        alpha_device_host,
+                                    const Ta*    A,
+                                    int64_t      lda,
+                                    const float* x,
+                                    int64_t      incx,
+                                    TScal        beta_device_host,
+                                    float*       y,
+                                    int64_t      incy)
+    {
+        float alpha = load_scalar(alpha_device_host);
+        float beta  = load_scalar(beta_device_host);
+
+        const Ta* a   = A + blockIdx.x * lda;
+        float     sum = 0;
+        if(alpha != 0)
+            for(rocblas_int i = threadIdx.x; i < m; i += NB)
+                sum += float(a[i]) * x[i * incx];
+
+        sum = rocblas_dot_block_reduce<NB>(sum);
+        if(threadIdx.x == 0)
+        {
+            float* yj = y + blockIdx.x * incy;
+            *yj       = beta == 0 ? alpha * sum : alpha * sum + beta * *yj;
+        }
+    }
+
+    template <typename Ta, typename TScal>
+    rocblas_status rocblas_gemv_ex_f8_launch(rocblas_handle    handle,
+                                             rocblas_operation transA,
+                                             rocblas_int       m,
+                                             rocblas_int       n,
+                                             TScal             alpha,
+                                             const Ta*         A,
+                                             rocblas_int       lda,
+                                             const float*      x,
+                                             rocblas_int       incx,
+                                             TScal             beta,
+                                             float*            y,
+                                             rocblas_int       incy)
+    {
+        static constexpr int NB = c_gemv_ex_NB;
+
+        bool        trans  = transA != rocblas_operation_none;
+        int64_t     lx     = trans ? m : n;
+        int64_t     ly     = trans ? n : m;
+        hipStream_t stream = handle->get_stream();
+
+        // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+        const float* xs = incx < 0 ? x - int64_t(incx) * (lx - 1) : x;
+        float*       ys = incy < 0 ? y - int64_t(incy) * (ly - 1) : y;
+
+        if(trans)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemv_ex_f8_trans_kernel<NB, Ta>),
+                                  dim3(n),
+                                  dim3(NB),
+                                  0,
+                                  stream,
+                                  m,
+                                  alpha,
+                                  A,
+                                  lda,
+                                  xs,
+                                  incx,
+                                  beta,
+                                  ys,
+                                  incy);
+        else
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemv_ex_f8_kernel<NB, Ta>),
+                                  dim3((m - 1) / NB + 1),
+                                  dim3(NB),
+                                  0,
+                                  stream,
+                                  m,
+                                  n,
+                                  alpha,
+                                  A,
+                                  lda,
+                                  xs,
+                                  incx,
+                                  beta,
+                                  ys,
+                                  incy);
+        return rocblas_status_success;
+    }
+
+    template <typename Ta>
+    rocblas_status rocblas_gemv_ex_f8(rocblas_handle    handle,
+                                      rocblas_operation transA,
+                                      rocblas_int       m,
+                                      rocblas_int       n,
+                                      const float*      alpha,
+                                      const Ta*         A,
+                                      rocblas_int       lda,
+                                      const float*      x,
+                                      rocblas_int       incx,
+                                      const float*      beta,
+                                      float*            y,
+                                      rocblas_int       incy)
+    {
+        if(transA != rocblas_operation_none && transA != rocblas_operation_transpose
+           && transA != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+        if(m < 0 || n < 0 || lda < m || lda < 1 || !incx || !incy)
+            return rocblas_status_invalid_size;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        if(!m || !n)
+            return rocblas_status_success;
+        if(!alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            if(*alpha == 0 && *beta == 1)
+                return rocblas_status_success;
+            if(!y || (*alpha != 0 && (!A || !x)))
+                return rocblas_status_invalid_pointer;
+            return rocblas_gemv_ex_f8_launch(
+                handle, transA, m, n, *alpha, A, lda, x, incx, *beta, y, incy);
+        }
+
+        if(!A || !x || !y)
+            return rocblas_status_invalid_pointer;
+        return rocblas_gemv_ex_f8_launch(
+            handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_gemv_ex(rocblas_handle    handle,
+                               rocblas_operation transA,
+                               rocblas_int       m,
+                               rocblas_int       n,
+                               const void*       alpha,
+                               const void*       A,
+                               rocblas_datatype  a_type,
+                               rocblas_int       lda,
+                               const void*       x,
+                               rocblas_datatype  x_type,
+                               rocblas_int       incx,
+                               const void*       beta,
+                               void*             y,
+                               rocblas_datatype  y_type,
+                               rocblas_int       incy,
+                               rocblas_datatype  compute_type)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle,
+                  "rocblas_gemv_ex",
+                  transA,
+                  m,
+                  n,
+                  alpha,
+                  A,
+                  rocblas_datatype_string(a_type),
+                  lda,
+                  x,
+                  rocblas_datatype_string(x_type),
+                  incx,
+                  beta,
+                  y,
+                  rocblas_datatype_string(y_type),
+                  incy,
+                  rocblas_datatype_string(compute_type));
+
+#define GEMV_EX_ARGS(T_, TO_, TC_)                                                  \
+    handle, transA, m, n, (const TC_*)alpha, (const T_*)A, lda, (const T_*)x, incx, \
+        (const TC_*)beta, (TO_*)y, incy
+
+#define GEMV_EX_MIXED_ARGS(T_, TO_)                                                      \
+    handle, transA, m, n, (const float*)alpha, (const T_*)A, lda, 0, (const T_*)x, incx, \
+        0, (const float*)beta, (TO_*)y, incy, 0, 1
+
+    if(a_type == x_type && x_type == y_type && y_type == compute_type)
+    {
+        switch(a_type)
+        {
+        case rocblas_datatype_f32_r:
+            return rocblas_sgemv(GEMV_EX_ARGS(float, float, float));
+        case rocblas_datatype_f64_r:
+            return rocblas_dgemv(GEMV_EX_ARGS(double, double, double));
+        case rocblas_datatype_f32_c:
+            return rocblas_cgemv(GEMV_EX_ARGS(
+                rocblas_float_complex, rocblas_float_complex, rocblas_float_complex));
+        case rocblas_datatype_f64_c:
+            return rocblas_zgemv(GEMV_EX_ARGS(
+                rocblas_double_complex, rocblas_double_complex, rocblas_double_complex));
+        default:
+            break;
+        }
+    }
+
+    if(compute_type != rocblas_datatype_f32_r)
+        return rocblas_status_not_implemented;
+
+    if(a_type == x_type && a_type == rocblas_datatype_f16_r)
+    {
+        if(y_type == rocblas_datatype_f16_r)
+            return rocblas_hshgemv_strided_batched(GEMV_EX_MIXED_ARGS(rocblas_half, rocblas_half));
+        if(y_type == rocblas_datatype_f32_r)
+            return rocblas_hssgemv_strided_batched(GEMV_EX_MIXED_ARGS(rocblas_half, float));
+    }
+
+    if(a_type == x_type && a_type == rocblas_datatype_bf16_r)
+    {
+        if(y_type == rocblas_datatype_bf16_r)
+            return rocblas_tstgemv_strided_batched(
+                GEMV_EX_MIXED_ARGS(rocblas_bfloat16, rocblas_bfloat16));
+        if(y_type == rocblas_datatype_f32_r)
+            return rocblas_tssgemv_strided_batched(GEMV_EX_MIXED_ARGS(rocblas_bfloat16, float));
+    }
+
+    if(x_type == rocblas_datatype_f32_r && y_type == rocblas_datatype_f32_r)
+    {
+        // row major op(A) is op(A)^T of column major A, see rocblas_set_order, the other
+        // paths map it in gemv
+        if(handle->order == rocblas_order_row_major)
+        {
+            transA = rocblas_row_major_transpose<float>(transA);
+            std::swap(m, n);
+        }
+
+#define GEMV_EX_F8_ARGS(T_)                                                              \
+    handle, transA, m, n, (const float*)alpha, (const T_*)A, lda, (const float*)x, incx, \
+        (const float*)beta, (float*)y, incy
+
+        if(a_type == rocblas_datatype_f8_r)
+            return rocblas_gemv_ex_f8(GEMV_EX_F8_ARGS(rocblas_f8));
+        if(a_type == rocblas_datatype_bf8_r)
+            return rocblas_gemv_ex_f8(GEMV_EX_F8_ARGS(rocblas_bf8));
+
+#undef GEMV_EX_F8_ARGS
+    }
+
+    return rocblas_status_not_implemented;
+
+#undef GEMV_EX_MIXED_ARGS
+#undef GEMV_EX_ARGS
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
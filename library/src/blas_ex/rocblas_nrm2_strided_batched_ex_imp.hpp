@@ -68,6 +68,8 @@ namespace
         auto result_type_str = rocblas_datatype_string(result_type);
         auto ex_type_str     = rocblas_datatype_string(execution_type);
         auto layer_mode      = handle->layer_mode;
+
+        rocblas_api_scope api_scope(handle, ROCBLAS_API_STR(nrm2_strided_batched_ex));
         if(layer_mode & rocblas_layer_mode_log_trace)
         {
             log_trace(handle,
@@ -97,7 +99,7 @@ namespace
                       log_bench_ex_precisions(x_type, result_type, execution_type));
         }
 
-        if(layer_mode & rocblas_layer_mode_log_profile)
+        if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
         {
             log_profile(handle,
                         ROCBLAS_API_STR(nrm2_strided_batched_ex),
@@ -147,7 +149,7 @@ namespace
             return rocblas_status_invalid_pointer;
         }
 
-        auto w_mem = handle->device_malloc(dev_bytes);
+        auto w_mem = handle->reduction_malloc(dev_bytes);
         if(!w_mem)
         {
             return rocblas_status_memory_error;
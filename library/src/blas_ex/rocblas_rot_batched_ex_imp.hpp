@@ -56,6 +56,8 @@ namespace
         auto y_type_str  = rocblas_datatype_string(y_type);
         auto cs_type_str = rocblas_datatype_string(cs_type);
         auto ex_type_str = rocblas_datatype_string(execution_type);
+
+        rocblas_api_scope api_scope(handle, ROCBLAS_API_STR(rocblas_rot_batched_ex));
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle,
                       ROCBLAS_API_STR(rocblas_rot_batched_ex),
@@ -89,7 +91,7 @@ namespace
                       incy,
                       "--batch_count",
                       batch_count);
-        if(layer_mode & rocblas_layer_mode_log_profile)
+        if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             log_profile(handle,
                         ROCBLAS_API_STR(rocblas_rot_batched_ex),
                         "N",
@@ -55,6 +55,8 @@ namespace
         auto y_type_str  = rocblas_datatype_string(y_type);
         auto cs_type_str = rocblas_datatype_string(cs_type);
         auto ex_type_str = rocblas_datatype_string(execution_type);
+
+        rocblas_api_scope api_scope(handle, ROCBLAS_API_STR(rocblas_rot_ex));
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle,
                       ROCBLAS_API_STR(rocblas_rot_ex),
@@ -85,7 +87,7 @@ namespace
                       incx,
                       "--incy",
                       incy);
-        if(layer_mode & rocblas_layer_mode_log_profile)
+        if(layer_mode & (rocblas_layer_mode_log_profile | rocblas_layer_mode_roctx))
             log_profile(handle,
                         ROCBLAS_API_STR(rocblas_rot_ex),
                         "N",
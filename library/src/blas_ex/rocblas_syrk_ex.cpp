@@ -0,0 +1,301 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * syrk for half and bfloat16 matrices with float computation, without converting A and C to
+ * float copies. C is processed in block columns of DB: the part of a block column outside the
+ * diagonal block is computed by gemm_ex with float computation, and the triangles of all
+ * diagonal blocks by a tiled kernel, so that the other triangle of C is never written.
+ */
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_gemm_ex.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    // Order of the diagonal blocks, and of the tiles of the diagonal blocks
+    constexpr int c_syrk_ex_DB   = 256;
+    constexpr int c_syrk_ex_TILE = 32;
+
+    // The tiles (ti, tj), ti >= tj, of the lower triangle of the diagonal block blockIdx.y
+    // compute C(r, c) = alpha * op(A)(r, :) * op(A)(c, :)**T + beta * C(r, c) for r >= c, stored
+    // in C(c, r) instead for an upper C
+    template <int DB, int TILE, typename T, typename TScal>
+    ROCBLAS_KERNEL(TILE* TILE)
+    rocblas_syrk_ex_diag_kernel(bool        upper,
+                                bool        trans,
+                                rocblas_int n,
+                                rocblas_int k,
+                                TScal       alpha_device_host,
+                                const T*    A,
+                                int64_t     lda,
+                                TScal       beta_device_host,
+                                T*          C,
+                                int64_t     ldc)
+    {
+        __shared__ float sa[TILE][TILE + 1];
+        __shared__ float sb[TILE][TILE + 1];
+
+        float alpha = load_scalar(alpha_device_host);
+        float beta  = load_scalar(beta_device_host);
+
+        int ti = 0, tj = blockIdx.x;
+        while(tj > ti)
+            tj -= ++ti;
+
+        int     tx = threadIdx.x % TILE, ty = threadIdx.x / TILE;
+        int64_t rb = int64_t(blockIdx.y) * DB + ti * TILE;
+        int64_t cb = int64_t(blockIdx.y) * DB + tj * TILE;
+        if(rb >= n)
+            return;
+
+        // element l of row r of op(A)
+        auto op_a = [&](int64_t r, int64_t l) {
+            return r < n && l < k ? float(trans ? A[l + r * lda] : A[r + l * lda]) : 0.0f;
+        };
+
+        float sum = 0;
+        for(int64_t l0 = 0; alpha != 0 && l0 < k; l0 += TILE)
+        {
+            // consecutive threads load consecutive elements of A
+            int i = trans ? ty : tx, l = trans ? tx : ty;
+            sa[i][l] = op_a(rb + i, l0 + l);
+            sb[i][l] = op_a(cb + i, l0 + l);
+            __syncthreads();
+
+            for(int j = 0; j < TILE; j++)
+                sum += sa[tx][j] * sb[ty][j];
+            __syncthreads();
+        }
+
+        int64_t r = rb + tx, c = cb + ty;
+        if(r < n && r >= c)
+        {
+            T* cv = upper ? C + r * ldc + c : C + c * ldc + r;
+            *cv   = T(beta == 0 ? alpha * sum : alpha * sum + beta * float(*cv));
+        }
+    }
+
+    template <typename T>
+    rocblas_status rocblas_syrk_ex_impl(rocblas_handle    handle,
+                                        rocblas_fill      uplo,
+                                        rocblas_operation transA,
+                                        rocblas_int       n,
+                                        rocblas_int       k,
+                                        const float*      alpha,
+                                        const T*          A,
+                                        rocblas_datatype  a_type,
+                                        rocblas_int       lda,
+                                        const float*      beta,
+                                        T*                C,
+                                        rocblas_int       ldc)
+    {
+        static constexpr int DB   = c_syrk_ex_DB;
+        static constexpr int TILE = c_syrk_ex_TILE;
+
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_invalid_value;
+        if(transA != rocblas_operation_none && transA != rocblas_operation_transpose
+           && transA != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+
+        bool trans = transA != rocblas_operation_none;
+        if(n < 0 || k < 0 || ldc < n || lda < (trans ? k : n) || ldc < 1 || lda < 1)
+            return rocblas_status_invalid_size;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        if(!n)
+            return rocblas_status_success;
+        if(!alpha || !beta)
+            return rocblas_status_invalid_pointer;
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            if((!k || *alpha == 0) && *beta == 1)
+                return rocblas_status_success;
+            if((k && *alpha != 0 && !A) || !C)
+                return rocblas_status_invalid_pointer;
+        }
+        else if(!A || !C)
+            return rocblas_status_invalid_pointer;
+
+        hipStream_t stream = handle->get_stream();
+        rocblas_int blocks = (n - 1) / DB + 1;
+        dim3        grid((DB / TILE) * (DB / TILE + 1) / 2, blocks);
+        bool        upper = uplo == rocblas_fill_upper;
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_syrk_ex_diag_kernel<DB, TILE, T>),
+                                  grid,
+                                  dim3(TILE * TILE),
+                                  0,
+                                  stream,
+                                  upper,
+                                  trans,
+                                  n,
+                                  k,
+                                  alpha,
+                                  A,
+                                  lda,
+                                  beta,
+                                  C,
+                                  ldc);
+        else
+            ROCBLAS_LAUNCH_KERNEL((rocblas_syrk_ex_diag_kernel<DB, TILE, T>),
+                                  grid,
+                                  dim3(TILE * TILE),
+                                  0,
+                                  stream,
+                                  upper,
+                                  trans,
+                                  n,
+                                  k,
+                                  *alpha,
+                                  A,
+                                  lda,
+                                  *beta,
+                                  C,
+                                  ldc);
+
+        // C(P, Q) = alpha * op(A)(P, :) * op(A)(Q, :)**T + beta * C(P, Q) with the rows below
+        // the diagonal block as P for a lower C, and as Q for an upper C
+        for(rocblas_int b = 0; b < blocks - 1; b++)
+        {
+            int64_t     j0   = int64_t(b) * DB;
+            int64_t     r0   = j0 + DB;
+            rocblas_int rows = rocblas_int(n - r0);
+            int64_t     p0 = upper ? j0 : r0, q0 = upper ? r0 : j0;
+
+            RETURN_IF_ROCBLAS_ERROR(
+                rocblas_gemm_ex_template<false>(handle,
+                                                trans ? rocblas_operation_transpose
+                                                      : rocblas_operation_none,
+                                                trans ? rocblas_operation_none
+                                                      : rocblas_operation_transpose,
+                                                upper ? DB : rows,
+                                                upper ? rows : DB,
+                                                k,
+                                                alpha,
+                                                A,
+                                                a_type,
+                                                trans ? p0 * lda : p0,
+                                                lda,
+                                                0,
+                                                A,
+                                                a_type,
+                                                trans ? q0 * lda : q0,
+                                                lda,
+                                                0,
+                                                beta,
+                                                C,
+                                                a_type,
+                                                p0 + q0 * ldc,
+                                                ldc,
+                                                0,
+                                                C,
+                                                a_type,
+                                                p0 + q0 * ldc,
+                                                ldc,
+                                                0,
+                                                1,
+                                                rocblas_datatype_f32_r,
+                                                rocblas_gemm_algo_standard,
+                                                0,
+                                                0));
+        }
+
+        return rocblas_status_success;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_syrk_ex(rocblas_handle    handle,
+                               rocblas_fill      uplo,
+                               rocblas_operation transA,
+                               rocblas_int       n,
+                               rocblas_int       k,
+                               const void*       alpha,
+                               const void*       A,
+                               rocblas_datatype  a_type,
+                               rocblas_int       lda,
+                               const void*       beta,
+                               void*             C,
+                               rocblas_datatype  c_type,
+                               rocblas_int       ldc,
+                               rocblas_datatype  compute_type)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // row major order, see rocblas_set_order, has no column major mapping here
+    RETURN_NOT_IMPLEMENTED_IF_ROW_MAJOR(handle);
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle,
+                  "rocblas_syrk_ex",
+                  uplo,
+                  transA,
+                  n,
+                  k,
+                  alpha,
+                  A,
+                  rocblas_datatype_string(a_type),
+                  lda,
+                  beta,
+                  C,
+                  rocblas_datatype_string(c_type),
+                  ldc,
+                  rocblas_datatype_string(compute_type));
+
+#define SYRK_EX_ARGS(T_)                                                                    \
+    handle, uplo, transA, n, k, static_cast<const float*>(alpha), static_cast<const T_*>(A), \
+        a_type, lda, static_cast<const float*>(beta), static_cast<T_*>(C), ldc
+
+    if(a_type == c_type && compute_type == rocblas_datatype_f32_r)
+    {
+        if(a_type == rocblas_datatype_f16_r)
+            return rocblas_syrk_ex_impl(SYRK_EX_ARGS(rocblas_half));
+        if(a_type == rocblas_datatype_bf16_r)
+            return rocblas_syrk_ex_impl(SYRK_EX_ARGS(rocblas_bfloat16));
+    }
+    return rocblas_status_not_implemented;
+
+#undef SYRK_EX_ARGS
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
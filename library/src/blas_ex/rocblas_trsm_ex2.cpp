@@ -0,0 +1,325 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * trsm for half and bfloat16 matrices with float computation, without converting A and B to
+ * float copies. The k by k triangular matrix A is processed in diagonal blocks of NB: each block
+ * is solved for by a kernel computing in float, and the part of B still to be solved for is
+ * updated by gemm_ex with float computation, directly on the half or bfloat16 data.
+ */
+
+#include "../blas3/rocblas_trsm.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_gemm_ex.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    constexpr int c_trsm_ex2_NB = 64;
+
+    template <int NB, typename T, typename TScal>
+    ROCBLAS_KERNEL(NB)
+    rocblas_trsm_ex2_scale_kernel(
+        rocblas_int m, int64_t size, TScal alpha_device_host, T* B, int64_t ldb)
+    {
+        float alpha = load_scalar(alpha_device_host);
+        for(int64_t idx = blockIdx.x * int64_t(NB) + threadIdx.x; idx < size;
+            idx += int64_t(gridDim.x) * NB)
+        {
+            T* b = B + (idx / m) * ldb + idx % m;
+            *b   = alpha == 0 ? T(0.0f) : T(alpha * float(*b));
+        }
+    }
+
+    // Solves T * x = b for the nb by nb diagonal block T of the columns (left) or the transposed
+    // rows (right) of B, with T = A if direct and T = A**T otherwise
+    template <int NB, typename T>
+    ROCBLAS_KERNEL(NB)
+    rocblas_trsm_ex2_diag_kernel(bool        left,
+                                 bool        lower,
+                                 bool        direct,
+                                 bool        unit,
+                                 rocblas_int nb,
+                                 int64_t     vecs,
+                                 const T*    A,
+                                 int64_t     lda,
+                                 T*          B,
+                                 int64_t     ldb)
+    {
+        __shared__ float sT[NB][NB + 1];
+        __shared__ float sx[NB][NB];
+
+        for(int idx = threadIdx.x; idx < nb * nb; idx += NB)
+        {
+            int   r = idx % nb, c = idx / nb;
+            float v = 0;
+            if(r == c && unit)
+                v = 1;
+            else if(lower ? r >= c : r <= c)
+                v = float(direct ? A[r + c * lda] : A[c + r * lda]);
+            sT[r][c] = v;
+        }
+        __syncthreads();
+
+        int64_t v = blockIdx.x * int64_t(NB) + threadIdx.x;
+        if(v >= vecs)
+            return;
+
+        int64_t inc = left ? 1 : ldb;
+        T*      b   = B + (left ? v * ldb : v);
+        int     t   = threadIdx.x;
+
+        for(int l = 0; l < nb; l++)
+            sx[l][t] = float(b[l * inc]);
+
+        for(int s = 0; s < nb; s++)
+        {
+            int   i   = lower ? s : nb - 1 - s;
+            float sum = sx[i][t];
+            if(lower)
+                for(int j = 0; j < i; j++)
+                    sum -= sT[i][j] * sx[j][t];
+            else
+                for(int j = i + 1; j < nb; j++)
+                    sum -= sT[i][j] * sx[j][t];
+            sx[i][t] = sum / sT[i][i];
+        }
+
+        for(int l = 0; l < nb; l++)
+            b[l * inc] = T(sx[l][t]);
+    }
+
+    template <typename T>
+    rocblas_status rocblas_trsm_ex2_impl(rocblas_handle    handle,
+                                         rocblas_side      side,
+                                         rocblas_fill      uplo,
+                                         rocblas_operation transA,
+                                         rocblas_diagonal  diag,
+                                         rocblas_int       m,
+                                         rocblas_int       n,
+                                         const float*      alpha,
+                                         const T*          A,
+                                         rocblas_datatype  a_type,
+                                         rocblas_int       lda,
+                                         T*                B,
+                                         rocblas_int       ldb)
+    {
+        static constexpr int NB = c_trsm_ex2_NB;
+
+        rocblas_status arg_status = rocblas_trsm_arg_check(
+            handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, rocblas_int(1));
+        if(arg_status != rocblas_status_continue)
+            return arg_status;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        hipStream_t stream = handle->get_stream();
+        int64_t     size_b = int64_t(m) * n;
+        dim3        grid_b(rocblas_int(std::min((size_b - 1) / NB + 1, c_i64_grid_X_chunk)));
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_trsm_ex2_scale_kernel<NB, T>),
+                                  grid_b,
+                                  dim3(NB),
+                                  0,
+                                  stream,
+                                  m,
+                                  size_b,
+                                  alpha,
+                                  B,
+                                  ldb);
+        else if(*alpha != 1)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_trsm_ex2_scale_kernel<NB, T>),
+                                  grid_b,
+                                  dim3(NB),
+                                  0,
+                                  stream,
+                                  m,
+                                  size_b,
+                                  *alpha,
+                                  B,
+                                  ldb);
+
+        if(handle->pointer_mode == rocblas_pointer_mode_host && *alpha == 0)
+            return rocblas_status_success;
+
+        // cppcheck-suppress unreadVariable
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        // The diagonal blocks are solved for in order of dependence: forward for a lower T,
+        // with T = op(A) on the left and T = op(A)**T on the right
+        bool    left      = side == rocblas_side_left;
+        bool    none      = transA == rocblas_operation_none;
+        bool    direct    = left == none;
+        bool    lower     = left == ((uplo == rocblas_fill_lower) == none);
+        bool    unit      = diag == rocblas_diagonal_unit;
+        int64_t ka        = left ? m : n;
+        int64_t vecs      = left ? n : m;
+        int64_t blocks    = (ka - 1) / NB + 1;
+        float   minus_one = -1.0f, one = 1.0f;
+
+        for(int64_t s = 0; s < blocks; s++)
+        {
+            int64_t     b   = lower ? s : blocks - 1 - s;
+            int64_t     kb0 = b * NB;
+            rocblas_int nb  = rocblas_int(std::min(int64_t(NB), ka - kb0));
+
+            ROCBLAS_LAUNCH_KERNEL((rocblas_trsm_ex2_diag_kernel<NB, T>),
+                                  dim3(rocblas_int((vecs - 1) / NB + 1)),
+                                  dim3(NB),
+                                  0,
+                                  stream,
+                                  left,
+                                  lower,
+                                  direct,
+                                  unit,
+                                  nb,
+                                  vecs,
+                                  A + kb0 * lda + kb0,
+                                  lda,
+                                  B + (left ? kb0 : kb0 * ldb),
+                                  ldb);
+
+            // the rows (left) or columns (right) of B still to be solved for
+            int64_t     rest0 = lower ? kb0 + nb : 0;
+            rocblas_int rest  = rocblas_int(lower ? ka - rest0 : kb0);
+            if(!rest)
+                continue;
+
+            // op(A)(rest, kb) on the left, op(A)(kb, rest) on the right
+            rocblas_stride a_off = direct ? rest0 + kb0 * lda : kb0 + rest0 * lda;
+            rocblas_stride x_off = left ? kb0 : kb0 * ldb;
+            rocblas_stride c_off = left ? rest0 : rest0 * ldb;
+
+            RETURN_IF_ROCBLAS_ERROR(
+                rocblas_gemm_ex_template<false>(handle,
+                                                left ? transA : rocblas_operation_none,
+                                                left ? rocblas_operation_none : transA,
+                                                left ? rest : m,
+                                                left ? n : rest,
+                                                nb,
+                                                &minus_one,
+                                                left ? (const void*)A : (const void*)B,
+                                                a_type,
+                                                left ? a_off : x_off,
+                                                left ? lda : ldb,
+                                                0,
+                                                left ? (const void*)B : (const void*)A,
+                                                a_type,
+                                                left ? x_off : a_off,
+                                                left ? ldb : lda,
+                                                0,
+                                                &one,
+                                                B,
+                                                a_type,
+                                                c_off,
+                                                ldb,
+                                                0,
+                                                B,
+                                                a_type,
+                                                c_off,
+                                                ldb,
+                                                0,
+                                                1,
+                                                rocblas_datatype_f32_r,
+                                                rocblas_gemm_algo_standard,
+                                                0,
+                                                0));
+        }
+
+        return rocblas_status_success;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_trsm_ex2(rocblas_handle    handle,
+                                rocblas_side      side,
+                                rocblas_fill      uplo,
+                                rocblas_operation transA,
+                                rocblas_diagonal  diag,
+                                rocblas_int       m,
+                                rocblas_int       n,
+                                const void*       alpha,
+                                const void*       A,
+                                rocblas_datatype  a_type,
+                                rocblas_int       lda,
+                                void*             B,
+                                rocblas_datatype  b_type,
+                                rocblas_int       ldb,
+                                rocblas_datatype  compute_type)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // row major order, see rocblas_set_order, has no column major mapping here
+    RETURN_NOT_IMPLEMENTED_IF_ROW_MAJOR(handle);
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle,
+                  "rocblas_trsm_ex2",
+                  side,
+                  uplo,
+                  transA,
+                  diag,
+                  m,
+                  n,
+                  alpha,
+                  A,
+                  rocblas_datatype_string(a_type),
+                  lda,
+                  B,
+                  rocblas_datatype_string(b_type),
+                  ldb,
+                  rocblas_datatype_string(compute_type));
+
+#define TRSM_EX2_ARGS(T_)                                                     \
+    handle, side, uplo, transA, diag, m, n, static_cast<const float*>(alpha), \
+        static_cast<const T_*>(A), a_type, lda, static_cast<T_*>(B), ldb
+
+    if(a_type == b_type && compute_type == rocblas_datatype_f32_r)
+    {
+        if(a_type == rocblas_datatype_f16_r)
+            return rocblas_trsm_ex2_impl(TRSM_EX2_ARGS(rocblas_half));
+        if(a_type == rocblas_datatype_bf16_r)
+            return rocblas_trsm_ex2_impl(TRSM_EX2_ARGS(rocblas_bfloat16));
+    }
+    return rocblas_status_not_implemented;
+
+#undef TRSM_EX2_ARGS
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,140 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "../blas3/trtri_trsm.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_block_sizes.h"
+#include "utility.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_trsm_invA_name[] = "unknown";
+    template <>
+    constexpr char rocblas_trsm_invA_name<float>[] = "rocblas_strsm_invA";
+    template <>
+    constexpr char rocblas_trsm_invA_name<double>[] = "rocblas_dtrsm_invA";
+    template <>
+    constexpr char rocblas_trsm_invA_name<rocblas_float_complex>[] = "rocblas_ctrsm_invA";
+    template <>
+    constexpr char rocblas_trsm_invA_name<rocblas_double_complex>[] = "rocblas_ztrsm_invA";
+
+    // trsm_ex and trsv_ex accept the inverses of the diagonal blocks in the same layout
+    static_assert(ROCBLAS_TRSM_NB == ROCBLAS_TRSV_EX_NB);
+
+    template <typename T>
+    rocblas_status rocblas_trsm_invA_impl(rocblas_handle   handle,
+                                          rocblas_fill     uplo,
+                                          rocblas_diagonal diag,
+                                          rocblas_int      k,
+                                          const T*         A,
+                                          rocblas_int      lda,
+                                          T*               invA,
+                                          rocblas_int      invA_size)
+    {
+        static constexpr rocblas_int BLOCK = ROCBLAS_TRSM_NB;
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // row major order, see rocblas_set_order, has no column major mapping here
+        RETURN_NOT_IMPLEMENTED_IF_ROW_MAJOR(handle);
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(
+                handle, rocblas_trsm_invA_name<T>, uplo, diag, k, A, lda, invA, invA_size);
+
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_invalid_value;
+        if(diag != rocblas_diagonal_unit && diag != rocblas_diagonal_non_unit)
+            return rocblas_status_invalid_value;
+        if(k < 0 || lda < std::max(k, 1) || invA_size / BLOCK < k)
+            return rocblas_status_invalid_size;
+
+        if(!k)
+        {
+            RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+            return rocblas_status_success;
+        }
+
+        // Workspace of the sub-block gemms of trtri
+        size_t c_temp_bytes = rocblas_trtri_trsm_c_temp_elements<BLOCK>(k) * sizeof(T);
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(c_temp_bytes);
+
+        if(!A || !invA)
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->device_malloc(c_temp_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        // Temporarily switch to host pointer mode, restoring on return
+        // cppcheck-suppress unreadVariable
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        return rocblas_trtri_trsm_template<BLOCK, false, T>(
+            handle, (T*)w_mem[0], uplo, diag, k, A, 0, lda, 0, invA, 0, BLOCK * k, 1);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(name_, T_)                                                                     \
+    rocblas_status name_(rocblas_handle   handle,                                           \
+                         rocblas_fill     uplo,                                             \
+                         rocblas_diagonal diag,                                             \
+                         rocblas_int      k,                                                \
+                         const T_*        A,                                                \
+                         rocblas_int      lda,                                              \
+                         T_*              invA,                                             \
+                         rocblas_int      invA_size)                                        \
+    try                                                                                     \
+    {                                                                                       \
+        return rocblas_trsm_invA_impl<T_>(handle, uplo, diag, k, A, lda, invA, invA_size); \
+    }                                                                                       \
+    catch(...)                                                                              \
+    {                                                                                       \
+        return exception_to_rocblas_status();                                               \
+    }
+
+extern "C" {
+
+IMPL(rocblas_strsm_invA, float);
+IMPL(rocblas_dtrsm_invA, double);
+IMPL(rocblas_ctrsm_invA, rocblas_float_complex);
+IMPL(rocblas_ztrsm_invA, rocblas_double_complex);
+
+} // extern "C"
+
+#undef IMPL
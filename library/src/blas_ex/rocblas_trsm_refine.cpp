@@ -0,0 +1,499 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*
+ * dtrsm through mixed-precision iterative refinement: the system is solved in single precision
+ * with the inverses of the diagonal blocks of A computed once, and the solution X is refined by
+ *
+ *     R = alpha * B - op(A) * X,    op(A) * D = R (single precision),    X = X + D
+ *
+ * with the residual R in double precision until max|R| <= tol * max|alpha * B|. Convergence is
+ * decided on the device, so no iteration waits for the host.
+ */
+
+#include "../blas3/rocblas_trmm.hpp"
+#include "../blas3/rocblas_trsm.hpp"
+#include "../blas3/trtri_trsm.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_block_sizes.h"
+#include "utility.hpp"
+
+namespace
+{
+    constexpr int c_refine_NB = 256;
+
+    // Maxima are kept as the bits of non-negative doubles, which order like the values
+    struct rocblas_trsm_refine_state
+    {
+        unsigned long long r_max;
+        unsigned long long b_max;
+        rocblas_int        converged;
+        rocblas_int        iterations;
+    };
+
+    template <int NB>
+    __device__ void rocblas_refine_block_max(double v, unsigned long long* out)
+    {
+        __shared__ double smax[NB];
+
+        smax[threadIdx.x] = v;
+        __syncthreads();
+        for(int i = NB / 2; i > 0; i /= 2)
+        {
+            if(threadIdx.x < i)
+                smax[threadIdx.x] = fmax(smax[threadIdx.x], smax[threadIdx.x + i]);
+            __syncthreads();
+        }
+
+        if(threadIdx.x == 0)
+            atomicMax(out, (unsigned long long)__double_as_longlong(smax[0]));
+    }
+
+    // A32 = A and R32 = Bs = alpha * B, recording max|alpha * B|
+    template <int NB, typename TScal>
+    ROCBLAS_KERNEL(NB)
+    rocblas_trsm_refine_init_kernel(rocblas_int                m,
+                                    int64_t                    size,
+                                    TScal                      alpha_device_host,
+                                    const double*              B,
+                                    int64_t                    ldb,
+                                    double*                    Bs,
+                                    float*                     R32,
+                                    rocblas_trsm_refine_state* state)
+    {
+        double alpha = load_scalar(alpha_device_host);
+        double b_max = 0;
+        for(int64_t idx = blockIdx.x * int64_t(NB) + threadIdx.x; idx < size;
+            idx += int64_t(gridDim.x) * NB)
+        {
+            double b = alpha * B[(idx / m) * ldb + idx % m];
+            Bs[idx]  = b;
+            R32[idx] = float(b);
+            b_max    = fmax(b_max, fabs(b));
+        }
+
+        rocblas_refine_block_max<NB>(b_max, &state->b_max);
+    }
+
+    template <int NB>
+    ROCBLAS_KERNEL(NB)
+    rocblas_trsm_refine_convert_kernel(
+        rocblas_int k, int64_t size, const double* A, int64_t lda, float* A32)
+    {
+        for(int64_t idx = blockIdx.x * int64_t(NB) + threadIdx.x; idx < size;
+            idx += int64_t(gridDim.x) * NB)
+            A32[idx] = float(A[(idx / k) * lda + idx % k]);
+    }
+
+    // R = R + Bs and R32 = R for R = -op(A) * X, recording max|R|
+    template <int NB>
+    ROCBLAS_KERNEL(NB)
+    rocblas_trsm_refine_residual_kernel(int64_t                    size,
+                                        const double*              Bs,
+                                        double*                    R,
+                                        float*                     R32,
+                                        rocblas_trsm_refine_state* state)
+    {
+        if(state->converged)
+            return;
+
+        double r_max = 0;
+        for(int64_t idx = blockIdx.x * int64_t(NB) + threadIdx.x; idx < size;
+            idx += int64_t(gridDim.x) * NB)
+        {
+            double r = R[idx] + Bs[idx];
+            R32[idx] = float(r);
+            r_max    = fmax(r_max, fabs(r));
+        }
+
+        rocblas_refine_block_max<NB>(r_max, &state->r_max);
+    }
+
+    // Decides whether the residual of iteration it is small enough, counting the corrections
+    ROCBLAS_KERNEL(1)
+    rocblas_trsm_refine_check_kernel(rocblas_int it, double tol, rocblas_trsm_refine_state* state)
+    {
+        if(!state->converged)
+        {
+            double r_max = __longlong_as_double((long long)state->r_max);
+            double b_max = __longlong_as_double((long long)state->b_max);
+            if(r_max <= tol * b_max)
+                state->converged = 1;
+            else
+                state->iterations = it;
+        }
+        state->r_max = 0;
+    }
+
+    // X = D on the first solve, X = X + D afterwards, for the single precision solution D
+    template <int NB>
+    ROCBLAS_KERNEL(NB)
+    rocblas_trsm_refine_update_kernel(rocblas_int                      m,
+                                      int64_t                          size,
+                                      const float*                     D,
+                                      bool                             first,
+                                      double*                          X,
+                                      int64_t                          ldx,
+                                      const rocblas_trsm_refine_state* state)
+    {
+        if(state->converged)
+            return;
+
+        for(int64_t idx = blockIdx.x * int64_t(NB) + threadIdx.x; idx < size;
+            idx += int64_t(gridDim.x) * NB)
+        {
+            double* x = X + (idx / m) * ldx + idx % m;
+            *x        = first ? double(D[idx]) : *x + double(D[idx]);
+        }
+    }
+
+    dim3 rocblas_trsm_refine_grid(int64_t size)
+    {
+        return dim3(rocblas_int(std::min((size - 1) / c_refine_NB + 1, c_i64_grid_X_chunk)));
+    }
+
+    rocblas_status rocblas_dtrsm_refine_impl(rocblas_handle    handle,
+                                             rocblas_side      side,
+                                             rocblas_fill      uplo,
+                                             rocblas_operation transA,
+                                             rocblas_diagonal  diag,
+                                             rocblas_int       m,
+                                             rocblas_int       n,
+                                             const double*     alpha,
+                                             const double*     A,
+                                             rocblas_int       lda,
+                                             double*           B,
+                                             rocblas_int       ldb,
+                                             double            tol,
+                                             rocblas_int       max_iter,
+                                             rocblas_int*      iterations)
+    {
+        static constexpr rocblas_int BLOCK = ROCBLAS_TRSM_NB;
+
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        // row major order, see rocblas_set_order, has no column major mapping here
+        RETURN_NOT_IMPLEMENTED_IF_ROW_MAJOR(handle);
+
+        if(handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      "rocblas_dtrsm_refine",
+                      side,
+                      uplo,
+                      transA,
+                      diag,
+                      m,
+                      n,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      A,
+                      lda,
+                      B,
+                      ldb,
+                      tol,
+                      max_iter,
+                      iterations);
+
+        rocblas_status arg_status = rocblas_trsm_arg_check(
+            handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, rocblas_int(1));
+        if(arg_status != rocblas_status_continue)
+            return arg_status;
+        if(max_iter < 0)
+            return rocblas_status_invalid_size;
+
+        rocblas_int ka         = side == rocblas_side_left ? m : n;
+        size_t      size_a     = size_t(ka) * ka;
+        size_t      size_b     = size_t(m) * n;
+        rocblas_int invA_size  = BLOCK * ka;
+        size_t      c_temp_els = rocblas_trtri_trsm_c_temp_elements<BLOCK>(ka);
+
+        // A32, invA32, the work of trtri, Bs, R, R32 and the state, then the work of the trsm
+        size_t sizes[] = {size_a * sizeof(float),
+                          size_t(invA_size) * sizeof(float),
+                          c_temp_els * sizeof(float),
+                          size_b * sizeof(double),
+                          size_b * sizeof(double),
+                          size_b * sizeof(float),
+                          sizeof(rocblas_trsm_refine_state)};
+
+        if(handle->is_device_memory_size_query())
+        {
+            size_t x_temp, x_temp_arr, invA, invA_arr, x_temp_backup;
+            RETURN_IF_ROCBLAS_ERROR(rocblas_internal_trsm_workspace_size<float>(side,
+                                                                               transA,
+                                                                               m,
+                                                                               n,
+                                                                               1,
+                                                                               invA_size,
+                                                                               &x_temp,
+                                                                               &x_temp_arr,
+                                                                               &invA,
+                                                                               &invA_arr,
+                                                                               &x_temp_backup));
+            return handle->set_optimal_device_memory_size(sizes[0],
+                                                          sizes[1],
+                                                          sizes[2],
+                                                          sizes[3],
+                                                          sizes[4],
+                                                          sizes[5],
+                                                          sizes[6],
+                                                          x_temp,
+                                                          x_temp_arr,
+                                                          invA,
+                                                          invA_arr);
+        }
+
+        if(!A || !iterations)
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->device_malloc(
+            sizes[0], sizes[1], sizes[2], sizes[3], sizes[4], sizes[5], sizes[6]);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        float*                     A32    = (float*)w_mem[0];
+        float*                     invA32 = (float*)w_mem[1];
+        float*                     c_temp = (float*)w_mem[2];
+        double*                    Bs     = (double*)w_mem[3];
+        double*                    R      = (double*)w_mem[4];
+        float*                     R32    = (float*)w_mem[5];
+        rocblas_trsm_refine_state* state  = (rocblas_trsm_refine_state*)w_mem[6];
+
+        hipStream_t stream = handle->get_stream();
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(state, 0, sizeof(*state), stream));
+
+        ROCBLAS_LAUNCH_KERNEL((rocblas_trsm_refine_convert_kernel<c_refine_NB>),
+                              rocblas_trsm_refine_grid(size_a),
+                              dim3(c_refine_NB),
+                              0,
+                              stream,
+                              ka,
+                              size_a,
+                              A,
+                              lda,
+                              A32);
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_trsm_refine_init_kernel<c_refine_NB>),
+                                  rocblas_trsm_refine_grid(size_b),
+                                  dim3(c_refine_NB),
+                                  0,
+                                  stream,
+                                  m,
+                                  size_b,
+                                  alpha,
+                                  B,
+                                  ldb,
+                                  Bs,
+                                  R32,
+                                  state);
+        else
+            ROCBLAS_LAUNCH_KERNEL((rocblas_trsm_refine_init_kernel<c_refine_NB>),
+                                  rocblas_trsm_refine_grid(size_b),
+                                  dim3(c_refine_NB),
+                                  0,
+                                  stream,
+                                  m,
+                                  size_b,
+                                  *alpha,
+                                  B,
+                                  ldb,
+                                  Bs,
+                                  R32,
+                                  state);
+
+        // The device mode of the caller only applies to alpha and iterations
+        bool device = handle->pointer_mode == rocblas_pointer_mode_device;
+        // cppcheck-suppress unreadVariable
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        RETURN_IF_ROCBLAS_ERROR((rocblas_trtri_trsm_template<BLOCK, false, float>(
+            handle, c_temp, uplo, diag, ka, (const float*)A32, 0, ka, 0, invA32, 0, invA_size, 1)));
+
+        {
+            auto  w_mem_trsm = handle->device_malloc(0);
+            void* w_mem_x_temp;
+            void* w_mem_x_temp_arr;
+            void* w_mem_invA;
+            void* w_mem_invA_arr;
+
+            rocblas_status perf_status
+                = rocblas_internal_trsm_template_mem<false, float>(handle,
+                                                                   side,
+                                                                   transA,
+                                                                   m,
+                                                                   n,
+                                                                   ka,
+                                                                   m,
+                                                                   1,
+                                                                   w_mem_trsm,
+                                                                   w_mem_x_temp,
+                                                                   w_mem_x_temp_arr,
+                                                                   w_mem_invA,
+                                                                   w_mem_invA_arr,
+                                                                   (const float*)invA32,
+                                                                   invA_size);
+            if(perf_status != rocblas_status_success && perf_status != rocblas_status_perf_degraded)
+                return perf_status;
+
+            bool         optimal_mem = perf_status == rocblas_status_success;
+            const float  one_f       = 1.0f;
+            const double minus_one   = -1.0;
+
+            // R32 = solution of op(A32) * D = R32, X = X + D
+            auto solve_update = [&](bool first) -> rocblas_status {
+                RETURN_IF_ROCBLAS_ERROR(rocblas_internal_trsm_template<float>(handle,
+                                                                              side,
+                                                                              uplo,
+                                                                              transA,
+                                                                              diag,
+                                                                              m,
+                                                                              n,
+                                                                              &one_f,
+                                                                              A32,
+                                                                              0,
+                                                                              ka,
+                                                                              0,
+                                                                              R32,
+                                                                              0,
+                                                                              m,
+                                                                              0,
+                                                                              1,
+                                                                              optimal_mem,
+                                                                              w_mem_x_temp,
+                                                                              w_mem_x_temp_arr,
+                                                                              w_mem_invA,
+                                                                              w_mem_invA_arr,
+                                                                              invA32,
+                                                                              invA_size));
+
+                ROCBLAS_LAUNCH_KERNEL((rocblas_trsm_refine_update_kernel<c_refine_NB>),
+                                      rocblas_trsm_refine_grid(size_b),
+                                      dim3(c_refine_NB),
+                                      0,
+                                      stream,
+                                      m,
+                                      size_b,
+                                      R32,
+                                      first,
+                                      B,
+                                      ldb,
+                                      state);
+                return rocblas_status_success;
+            };
+
+            RETURN_IF_ROCBLAS_ERROR(solve_update(true));
+
+            // Once converged the kernels return at once; trmm and trsm are still enqueued, as
+            // the host does not know when the refinement stops
+            for(rocblas_int it = 1; it <= max_iter; it++)
+            {
+                RETURN_IF_ROCBLAS_ERROR(rocblas_internal_trmm_template<double>(handle,
+                                                                               side,
+                                                                               uplo,
+                                                                               transA,
+                                                                               diag,
+                                                                               m,
+                                                                               n,
+                                                                               &minus_one,
+                                                                               0,
+                                                                               A,
+                                                                               0,
+                                                                               lda,
+                                                                               0,
+                                                                               B,
+                                                                               0,
+                                                                               ldb,
+                                                                               0,
+                                                                               R,
+                                                                               0,
+                                                                               m,
+                                                                               0,
+                                                                               1));
+
+                ROCBLAS_LAUNCH_KERNEL((rocblas_trsm_refine_residual_kernel<c_refine_NB>),
+                                      rocblas_trsm_refine_grid(size_b),
+                                      dim3(c_refine_NB),
+                                      0,
+                                      stream,
+                                      size_b,
+                                      Bs,
+                                      R,
+                                      R32,
+                                      state);
+
+                ROCBLAS_LAUNCH_KERNEL(
+                    rocblas_trsm_refine_check_kernel, dim3(1), dim3(1), 0, stream, it, tol, state);
+
+                RETURN_IF_ROCBLAS_ERROR(solve_update(false));
+            }
+        }
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(iterations,
+                                           &state->iterations,
+                                           sizeof(rocblas_int),
+                                           device ? hipMemcpyDeviceToDevice : hipMemcpyDeviceToHost,
+                                           stream));
+        if(!device)
+            RETURN_IF_ROCBLAS_ERROR(handle->sync_host_results());
+
+        return rocblas_status_success;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocblas_dtrsm_refine(rocblas_handle    handle,
+                                    rocblas_side      side,
+                                    rocblas_fill      uplo,
+                                    rocblas_operation transA,
+                                    rocblas_diagonal  diag,
+                                    rocblas_int       m,
+                                    rocblas_int       n,
+                                    const double*     alpha,
+                                    const double*     A,
+                                    rocblas_int       lda,
+                                    double*           B,
+                                    rocblas_int       ldb,
+                                    double            tol,
+                                    rocblas_int       max_iter,
+                                    rocblas_int*      iterations)
+try
+{
+    return rocblas_dtrsm_refine_impl(
+        handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, tol, max_iter, iterations);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+} // extern "C"
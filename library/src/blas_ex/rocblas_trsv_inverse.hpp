@@ -822,8 +822,12 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         stride_invA = BLOCK * m;
         if(BATCHED)
         {
-            RETURN_IF_ROCBLAS_ERROR(setup_batched_array<BLOCK>(
-                handle->get_stream(), (T*)c_temp, 0, (T**)x_temparr, batch_count));
+            RETURN_IF_ROCBLAS_ERROR(
+                setup_batched_array<BLOCK>(handle->get_stream(),
+                                           (T*)c_temp,
+                                           rocblas_trtri_trsm_c_temp_elements<BLOCK>(m),
+                                           (T**)x_temparr,
+                                           batch_count));
             RETURN_IF_ROCBLAS_ERROR(setup_batched_array<BLOCK>(
                 handle->get_stream(), (T*)invA, stride_invA, (T**)invAarr, batch_count));
         }
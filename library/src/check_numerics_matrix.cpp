@@ -22,11 +22,12 @@
 
 #include "check_numerics_matrix.hpp"
 #include "int64_helpers.hpp"
+#include "roctx_ranges.hpp"
 #include "utility.hpp"
 
 /**
   *
-  * rocblas_check_numerics_ge_matrix_kernel(m, n, Aa, offset_a, lda, stride_a, abnormal)
+  * rocblas_check_numerics_ge_matrix_kernel(m, n, Aa, offset_a, lda, stride_a, tile_stride, tile_phase, abnormal)
   *
   * Info about rocblas_check_numerics_ge_matrix_kernel function:
   *
@@ -39,6 +40,8 @@
   *                offset_a     : Offset of matrix 'Aa'
   *                lda          : specifies the leading dimension of matrix 'Aa'
   *                stride_a     : Specifies the pointer increment between one matrix 'A_i' and the next one (Aa_i+1) (where (Aa_i) is the i-th instance of the batch)
+  *                tile_stride  : Each block of the grid checks one tile of DIM_X x DIM_Y elements in tile_stride of a column of tiles
+  *                tile_phase   : Rotates the sampled tiles of each column of tiles, from 0 to tile_stride - 1
   *                abnormal     : Device pointer to the rocblas_check_numerics_t structure
   *
   * Return Value : Nothing --
@@ -53,10 +56,13 @@ rocblas_check_numerics_ge_matrix_kernel(rocblas_int               m,
                                         rocblas_stride            offset_a,
                                         int64_t                   lda,
                                         rocblas_stride            stride_a,
+                                        rocblas_int               tile_stride,
+                                        rocblas_int               tile_phase,
                                         rocblas_check_numerics_t* abnormal)
 {
-    rocblas_int tx = blockIdx.x * blockDim.x + threadIdx.x;
-    rocblas_int ty = blockIdx.y * blockDim.y + threadIdx.y;
+    rocblas_int tile_y = blockIdx.y * tile_stride + (blockIdx.x + tile_phase) % tile_stride;
+    rocblas_int tx     = blockIdx.x * blockDim.x + threadIdx.x;
+    rocblas_int ty     = tile_y * blockDim.y + threadIdx.y;
 
     //Check every element of the A matrix for a NaN/zero/Inf/denormal value
     if(tx < m && ty < n)
@@ -78,7 +84,7 @@ rocblas_check_numerics_ge_matrix_kernel(rocblas_int               m,
 
 /**
   *
-  * rocblas_check_numerics_sym_herm_tri_matrix_kernel(is_upper, n, Aa, offset_a, lda, stride_a, abnormal)
+  * rocblas_check_numerics_sym_herm_tri_matrix_kernel(is_upper, n, Aa, offset_a, lda, stride_a, tile_stride, tile_phase, abnormal)
   *
   * Info about rocblas_check_numerics_sym_herm_tri_matrix_kernel function:
   *
@@ -92,6 +98,8 @@ rocblas_check_numerics_ge_matrix_kernel(rocblas_int               m,
   *                offset_a     : Offset of matrix 'Aa'
   *                lda          : specifies the leading dimension of matrix 'Aa'
   *                stride_a     : Specifies the pointer increment between one matrix 'A_i' and the next one (Aa_i+1) (where (Aa_i) is the i-th instance of the batch)
+  *                tile_stride  : Each block of the grid checks one tile of DIM_X x DIM_Y elements in tile_stride of a column of tiles
+  *                tile_phase   : Rotates the sampled tiles of each column of tiles, from 0 to tile_stride - 1
   *                abnormal     : Device pointer to the rocblas_check_numerics_t structure
   *
   * Return Value : Nothing --
@@ -106,10 +114,13 @@ rocblas_check_numerics_sym_herm_tri_matrix_kernel(bool                      is_u
                                                   rocblas_stride            offset_a,
                                                   int64_t                   lda,
                                                   rocblas_stride            stride_a,
+                                                  rocblas_int               tile_stride,
+                                                  rocblas_int               tile_phase,
                                                   rocblas_check_numerics_t* abnormal)
 {
-    rocblas_int tx = blockIdx.x * blockDim.x + threadIdx.x;
-    rocblas_int ty = blockIdx.y * blockDim.y + threadIdx.y;
+    rocblas_int tile_y = blockIdx.y * tile_stride + (blockIdx.x + tile_phase) % tile_stride;
+    rocblas_int tx     = blockIdx.x * blockDim.x + threadIdx.x;
+    rocblas_int ty     = tile_y * blockDim.y + threadIdx.y;
 
     //Check every element of the A matrix for a NaN/zero/Inf/denormal value
     if(is_upper ? ty < n && tx <= ty : tx < n && ty <= tx)
@@ -173,9 +184,15 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                                     const int                 check_numerics,
                                                     bool                      is_input)
 {
+    //Quick return: call not sampled
+    if(!rocblas_check_numerics_sampled_call(handle, check_numerics))
+        return rocblas_status_success;
+
+    bool async_check = check_numerics & rocblas_check_numerics_mode_async;
+
     //Graph capture do not support any use of sync APIs.
-    //Quick return: check numerics not supported
-    if(handle->is_stream_in_capture_mode())
+    //Quick return: check numerics not supported, unless the results are accumulated on the device
+    if(!async_check && handle->is_stream_in_capture_mode())
     {
         return rocblas_status_success;
     }
@@ -184,13 +201,19 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     if(!m_64 || !n_64 || !batch_count_64 || !A)
         return rocblas_status_success;
 
-    //Creating structure host object
-    rocblas_check_numerics_t h_abnormal;
+    rocblas_roctx_phase roctx_phase(
+        handle, "check_numerics", "function", function_name, "is_input", is_input);
 
-    //Allocating memory for device structure
-    auto d_abnormal = handle->device_malloc(sizeof(rocblas_check_numerics_t));
+    //Allocating memory for device structure. The asynchronous checks use the flags of the handle
+    //instead, which are only cleared when they are reported.
+    auto w_abnormal = handle->device_malloc(async_check ? 0 : sizeof(rocblas_check_numerics_t));
+    auto d_abnormal = async_check ? handle->get_check_numerics_flags(is_input)
+                                  : (rocblas_check_numerics_t*)w_abnormal;
+    if(async_check && !d_abnormal && handle->is_stream_in_capture_mode())
+        return rocblas_status_success;
 
-    if(!d_abnormal)
+    hipStream_t rocblas_stream = handle->get_stream();
+    if(!w_abnormal || !d_abnormal)
     {
         rocblas_cerr << "rocBLAS internal error: No workspace memory available to allocate the "
                         "struct d_abnormal in "
@@ -199,14 +222,17 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         return rocblas_status_memory_error;
     }
 
-    hipStream_t rocblas_stream = handle->get_stream();
+    //Resetting the rocblas_check_numerics_t structure on the device
+    if(!async_check)
+        RETURN_IF_HIP_ERROR(
+            hipMemsetAsync(d_abnormal, 0, sizeof(rocblas_check_numerics_t), rocblas_stream));
 
-    //Transferring the rocblas_check_numerics_t structure from host to the device
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync((rocblas_check_numerics_t*)d_abnormal,
-                                       &h_abnormal,
-                                       sizeof(rocblas_check_numerics_t),
-                                       hipMemcpyHostToDevice,
-                                       rocblas_stream));
+    //With tile sampling each launch checks one tile in tile_stride, starting from the tile phase
+    //of the call, so that successive sampled calls cover the whole matrix
+    int         call_shift  = (check_numerics & rocblas_check_numerics_mode_sample_calls) >> 8;
+    int         tile_shift  = (check_numerics & rocblas_check_numerics_mode_sample_tiles) >> 12;
+    rocblas_int tile_stride = rocblas_int(1) << tile_shift;
+    rocblas_int tile_phase  = rocblas_int((handle->call_serial >> call_shift) % tile_stride);
 
     //Checking trans_a to transpose a matrix 'A'
     int64_t rows_64 = trans_a == rocblas_operation_none ? m_64 : n_64;
@@ -232,7 +258,7 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                 static constexpr int DIM_X    = 16;
                 static constexpr int DIM_Y    = 16;
                 rocblas_int          blocks_X = (m - 1) / DIM_X + 1;
-                rocblas_int          blocks_Y = (n - 1) / DIM_Y + 1;
+                rocblas_int          blocks_Y = ((n - 1) / DIM_Y) / tile_stride + 1;
 
                 dim3 blocks(blocks_X, blocks_Y, batch_count);
                 dim3 threads(DIM_X, DIM_Y);
@@ -250,7 +276,9 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                           shift_a,
                                           lda,
                                           stride_a,
-                                          (rocblas_check_numerics_t*)d_abnormal);
+                                          tile_stride,
+                                          tile_phase,
+                                          d_abnormal);
                 }
                 else if(matrix_type == rocblas_client_symmetric_matrix
                         || matrix_type == rocblas_client_hermitian_matrix
@@ -268,19 +296,26 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                         shift_a,
                         lda,
                         stride_a,
-                        (rocblas_check_numerics_t*)d_abnormal);
+                        tile_stride,
+                        tile_phase,
+                        d_abnormal);
                 }
             }
         }
     }
 
+    //The asynchronous checks are reported by rocblas_get_check_numerics_status
+    if(async_check)
+        return rocblas_status_success;
+
     //Transferring the rocblas_check_numerics_t structure from device to the host
+    rocblas_check_numerics_t h_abnormal;
     RETURN_IF_HIP_ERROR(hipMemcpyAsync(&h_abnormal,
-                                       (rocblas_check_numerics_t*)d_abnormal,
+                                       d_abnormal,
                                        sizeof(rocblas_check_numerics_t),
                                        hipMemcpyDeviceToHost,
                                        rocblas_stream));
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(rocblas_stream));
+    RETURN_IF_HIP_ERROR(handle->synchronize_stream());
 
     return rocblas_check_numerics_abnormal_struct(
         function_name, check_numerics, is_input, &h_abnormal);
@@ -22,6 +22,7 @@
 
 #include "check_numerics_vector.hpp"
 #include "int64_helpers.hpp"
+#include "roctx_ranges.hpp"
 #include "utility.hpp"
 
 /**
@@ -170,9 +171,15 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                                     const int      check_numerics,
                                                     bool           is_input)
 {
+    //Quick return: call not sampled
+    if(!rocblas_check_numerics_sampled_call(handle, check_numerics))
+        return rocblas_status_success;
+
+    bool async_check = check_numerics & rocblas_check_numerics_mode_async;
+
     //Graph capture do not support any use of sync APIs.
-    //Quick return: check numerics not supported
-    if(handle->is_stream_in_capture_mode())
+    //Quick return: check numerics not supported, unless the results are accumulated on the device
+    if(!async_check && handle->is_stream_in_capture_mode())
     {
         return rocblas_status_success;
     }
@@ -183,13 +190,19 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         return rocblas_status_success;
     }
 
-    //Creating structure host object
-    rocblas_check_numerics_t h_abnormal;
+    rocblas_roctx_phase roctx_phase(
+        handle, "check_numerics", "function", function_name, "is_input", is_input);
+
+    //Allocating memory for device structure. The asynchronous checks use the flags of the handle
+    //instead, which are only cleared when they are reported.
+    auto w_abnormal = handle->device_malloc(async_check ? 0 : sizeof(rocblas_check_numerics_t));
+    auto d_abnormal = async_check ? handle->get_check_numerics_flags(is_input)
+                                  : (rocblas_check_numerics_t*)w_abnormal;
+    if(async_check && !d_abnormal && handle->is_stream_in_capture_mode())
+        return rocblas_status_success;
 
-    //Allocating memory for device structure
-    auto        d_abnormal     = handle->device_malloc(sizeof(rocblas_check_numerics_t));
     hipStream_t rocblas_stream = handle->get_stream();
-    if(!d_abnormal)
+    if(!w_abnormal || !d_abnormal)
     {
         rocblas_cerr << "rocBLAS internal error: No workspace memory available to allocate the "
                         "struct d_abnormal in "
@@ -198,12 +211,10 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
         return rocblas_status_memory_error;
     }
 
-    //Transferring the rocblas_check_numerics_t structure from host to the device
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync((rocblas_check_numerics_t*)d_abnormal,
-                                       &h_abnormal,
-                                       sizeof(rocblas_check_numerics_t),
-                                       hipMemcpyHostToDevice,
-                                       rocblas_stream));
+    //Resetting the rocblas_check_numerics_t structure on the device
+    if(!async_check)
+        RETURN_IF_HIP_ERROR(
+            hipMemsetAsync(d_abnormal, 0, sizeof(rocblas_check_numerics_t), rocblas_stream));
     constexpr rocblas_int NB = 256;
 
     size_t abs_inc = inc_x < 0 ? -inc_x : inc_x;
@@ -229,17 +240,22 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                   offset_x + abs_inc * n_base,
                                   abs_inc,
                                   stride_x,
-                                  (rocblas_check_numerics_t*)d_abnormal);
+                                  d_abnormal);
         }
     }
 
+    //The asynchronous checks are reported by rocblas_get_check_numerics_status
+    if(async_check)
+        return rocblas_status_success;
+
     //Transferring the rocblas_check_numerics_t structure from device to the host
+    rocblas_check_numerics_t h_abnormal;
     RETURN_IF_HIP_ERROR(hipMemcpyAsync(&h_abnormal,
-                                       (rocblas_check_numerics_t*)d_abnormal,
+                                       d_abnormal,
                                        sizeof(rocblas_check_numerics_t),
                                        hipMemcpyDeviceToHost,
                                        rocblas_stream));
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(rocblas_stream));
+    RETURN_IF_HIP_ERROR(handle->synchronize_stream());
 
     return rocblas_check_numerics_abnormal_struct(
         function_name, check_numerics, is_input, &h_abnormal);
@@ -19,9 +19,15 @@
  * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  *
  * ************************************************************************ */
+#include "check_numerics_vector.hpp"
 #include "handle.hpp"
+#include "logging.hpp"
 #include <cstdarg>
+#include <cstring>
+#include <hip/hip_ext.h>
 #include <limits>
+#include <mutex>
+#include <unordered_map>
 #ifdef WIN32
 #include <windows.h>
 #endif
@@ -66,6 +72,89 @@ extern "C" void rocblas_device_malloc_set_default_memory_size(size_t size)
     t_rocblas_device_malloc_default_memory_size = size;
 }
 
+/*******************************************************************************
+ * handle stats
+ ******************************************************************************/
+thread_local rocblas_handle_counters* rocblas_current_counters = nullptr;
+thread_local int                      rocblas_current_device   = -1;
+thread_local std::atomic<uint64_t>*   rocblas_launch_counter   = nullptr;
+
+// Names of the functions by index, filled in by open addressing on the address of the name
+static std::atomic<const char*> rocblas_api_function_names[ROCBLAS_API_FUNCTIONS_MAX];
+
+int rocblas_api_function_id(const char* name)
+{
+    static_assert((ROCBLAS_API_FUNCTIONS_MAX & (ROCBLAS_API_FUNCTIONS_MAX - 1)) == 0,
+                  "ROCBLAS_API_FUNCTIONS_MAX must be a power of 2");
+
+    size_t hash = (uintptr_t(name) * 0x9e3779b97f4a7c15ull) >> 32;
+    for(int probe = 0; probe < ROCBLAS_API_FUNCTIONS_MAX; ++probe)
+    {
+        int         id  = int((hash + probe) & (ROCBLAS_API_FUNCTIONS_MAX - 1));
+        const char* cur = rocblas_api_function_names[id].load(std::memory_order_acquire);
+        if(cur == name)
+            return id;
+        if(!cur
+           && (rocblas_api_function_names[id].compare_exchange_strong(
+                   cur, name, std::memory_order_acq_rel)
+               || cur == name))
+            return id;
+    }
+    return -1;
+}
+
+const char* rocblas_api_function_name(int id)
+{
+    return id >= 0 && id < ROCBLAS_API_FUNCTIONS_MAX
+               ? rocblas_api_function_names[id].load(std::memory_order_acquire)
+               : nullptr;
+}
+
+void rocblas_handle_counters::get(rocblas_handle_stats& stats) const
+{
+    constexpr auto relaxed = std::memory_order_relaxed;
+
+    stats.api_calls = other_calls.load(relaxed);
+    for(auto& calls : function_calls)
+        stats.api_calls += calls.load(relaxed);
+    stats.kernel_launches            = kernel_launches.load(relaxed);
+    stats.tensile_selections         = tensile_selections.load(relaxed);
+    stats.tensile_selection_ns       = tensile_selection_ns.load(relaxed);
+    stats.solution_cache_hits        = solution_cache_hits.load(relaxed);
+    stats.solution_cache_misses      = solution_cache_misses.load(relaxed);
+    stats.workspace_allocations      = workspace_allocations.load(relaxed);
+    stats.workspace_allocation_bytes = workspace_allocation_bytes.load(relaxed);
+    stats.host_syncs                 = host_syncs.load(relaxed);
+    stats.source_gemm_calls          = source_gemm_calls.load(relaxed);
+    stats.tensile_xf32_fallbacks     = tensile_xf32_fallbacks.load(relaxed);
+    stats.hipblaslt_gemm_calls       = hipblaslt_gemm_calls.load(relaxed);
+    stats.pointer_cache_hits         = pointer_cache_hits.load(relaxed);
+    stats.pointer_cache_misses       = pointer_cache_misses.load(relaxed);
+}
+
+void rocblas_handle_counters::reset()
+{
+    constexpr auto relaxed = std::memory_order_relaxed;
+
+    for(auto* counter : {&kernel_launches,
+                         &tensile_selections,
+                         &tensile_selection_ns,
+                         &solution_cache_hits,
+                         &solution_cache_misses,
+                         &workspace_allocations,
+                         &workspace_allocation_bytes,
+                         &host_syncs,
+                         &source_gemm_calls,
+                         &tensile_xf32_fallbacks,
+                         &hipblaslt_gemm_calls,
+                         &pointer_cache_hits,
+                         &pointer_cache_misses,
+                         &other_calls})
+        counter->store(0, relaxed);
+    for(auto& calls : function_calls)
+        calls.store(0, relaxed);
+}
+
 static inline int getActiveDevice()
 {
     int device;
@@ -73,7 +162,7 @@ static inline int getActiveDevice()
     return device;
 }
 
-static Processor getActiveArch(int deviceId)
+static Processor queryActiveArch(int deviceId)
 {
     hipDeviceProp_t deviceProperties;
     hipGetDeviceProperties(&deviceProperties, deviceId);
@@ -152,6 +241,208 @@ static Processor getActiveArch(int deviceId)
     return static_cast<Processor>(0);
 }
 
+// Querying the device properties is slow compared to the rest of handle creation,
+// so the architecture of each device is only queried once
+static Processor getActiveArch(int deviceId)
+{
+    static std::mutex                         mutex;
+    static std::unordered_map<int, Processor> archs;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto                        it = archs.find(deviceId);
+    if(it == archs.end())
+        it = archs.emplace(deviceId, queryActiveArch(deviceId)).first;
+    return it->second;
+}
+
+int _rocblas_handle::getCUCount()
+{
+    if(cu_mask_count)
+        return cu_mask_count;
+
+    static std::mutex                   mutex;
+    static std::unordered_map<int, int> cu_counts;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto                        it = cu_counts.find(device);
+    if(it == cu_counts.end())
+    {
+        int cu_count = 0;
+        THROW_IF_HIP_ERROR(
+            hipDeviceGetAttribute(&cu_count, hipDeviceAttributeMultiprocessorCount, device));
+        it = cu_counts.emplace(device, cu_count).first;
+    }
+    return it->second;
+}
+
+// The tickets only elect the block finishing a reduction, which reduces the partial results in
+// a fixed order, so they are handed out with rocblas_atomics_deterministic too
+unsigned int* _rocblas_handle::get_reduction_tickets(int64_t batch_count)
+{
+    if(atomics_mode == rocblas_atomics_not_allowed || batch_count > REDUCTION_TICKET_COUNT)
+        return nullptr;
+
+    if(!reduction_tickets)
+    {
+        // allocation is not stream ordered, so it is not done while the stream is captured
+        if(is_stream_in_capture_mode())
+            return nullptr;
+
+        auto          saved_device_id = push_device_id();
+        unsigned int* tickets         = nullptr;
+        size_t        size            = sizeof(unsigned int) * REDUCTION_TICKET_COUNT;
+        if((hipMalloc)(&tickets, size) != hipSuccess)
+            return nullptr;
+        if(hipMemsetAsync(tickets, 0, size, stream) != hipSuccess)
+        {
+            (void)(hipFree)(tickets);
+            return nullptr;
+        }
+        reduction_tickets = tickets;
+    }
+    group_share_workspace();
+    return reduction_tickets;
+}
+
+void* _rocblas_handle::get_reduction_workspace(size_t size)
+{
+    if(!size || size > REDUCTION_WORKSPACE_MAX_SIZE
+       || device_memory_owner != rocblas_device_memory_ownership::rocblas_managed)
+        return nullptr;
+
+    if(size > reduction_workspace_size)
+    {
+        // allocation is not stream ordered, so it is not done while the stream is captured
+        if(is_stream_in_capture_mode())
+            return nullptr;
+
+        // grow geometrically so that a slowly increasing n reallocates rarely
+        size_t new_size = std::min(std::max(roundup_device_memory_size(size),
+                                            2 * reduction_workspace_size),
+                                   REDUCTION_WORKSPACE_MAX_SIZE);
+
+        auto saved_device_id = push_device_id();
+
+        // hipFree waits for the device, so no kernel still uses the previous workspace
+        if(reduction_workspace && (hipFree)(reduction_workspace) != hipSuccess)
+            return nullptr;
+        reduction_workspace      = nullptr;
+        reduction_workspace_size = 0;
+
+        if((hipMalloc)(&reduction_workspace, new_size) != hipSuccess)
+        {
+            reduction_workspace = nullptr;
+            return nullptr;
+        }
+        reduction_workspace_size = new_size;
+        counters.count_workspace_allocation(new_size);
+    }
+    group_share_workspace();
+    return reduction_workspace;
+}
+
+rocblas_status _rocblas_handle::get_host_results_event(hipEvent_t* event)
+{
+    if(!host_results_event)
+    {
+        auto saved_device_id = push_device_id();
+        RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&host_results_event, hipEventDisableTiming));
+    }
+    *event = host_results_event;
+    return rocblas_status_success;
+}
+
+rocblas_check_numerics_t* _rocblas_handle::get_check_numerics_flags(bool is_input)
+{
+    if(!check_numerics_flags)
+    {
+        // allocation is not stream ordered, so it is not done while the stream is captured
+        if(is_stream_in_capture_mode())
+            return nullptr;
+
+        auto                      saved_device_id = push_device_id();
+        rocblas_check_numerics_t* flags           = nullptr;
+        size_t                    size            = 2 * sizeof(rocblas_check_numerics_t);
+        if((hipMalloc)(&flags, size) != hipSuccess)
+            return nullptr;
+        if(hipMemsetAsync(flags, 0, size, stream) != hipSuccess)
+        {
+            (void)(hipFree)(flags);
+            return nullptr;
+        }
+        check_numerics_flags = flags;
+        counters.count_workspace_allocation(size);
+    }
+    return check_numerics_flags + is_input;
+}
+
+rocblas_status _rocblas_handle::report_check_numerics_flags()
+{
+    if(!check_numerics_flags)
+        return rocblas_status_success;
+    RETURN_IF_ROCBLAS_ERROR(check_capturable("rocblas_get_check_numerics_status"));
+
+    auto                     saved_device_id = push_device_id();
+    rocblas_check_numerics_t h_flags[2];
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        h_flags, check_numerics_flags, sizeof(h_flags), hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(check_numerics_flags, 0, sizeof(h_flags), stream));
+    RETURN_IF_HIP_ERROR(synchronize_stream());
+
+    rocblas_status status = rocblas_status_success;
+    for(bool is_input : {true, false})
+    {
+        rocblas_status flags_status = rocblas_check_numerics_abnormal_struct(
+            "rocblas_get_check_numerics_status", check_numerics, is_input, &h_flags[is_input]);
+        if(flags_status != rocblas_status_success)
+            status = flags_status;
+    }
+    return status;
+}
+
+_rocblas_handle::pointer_range _rocblas_handle::classify_range(const void* ptr)
+{
+    auto address = uintptr_t(ptr);
+    for(const auto& range : pointer_ranges)
+        if(address >= range.begin && address < range.end)
+        {
+            rocblas_count(counters.pointer_cache_hits);
+            return range;
+        }
+    rocblas_count(counters.pointer_cache_misses);
+
+    hipPointerAttribute_t attribute{};
+    hipPointerGetAttributes(&attribute, ptr);
+    bool device  = ptr == attribute.devicePointer;
+    bool managed = attribute.isManaged;
+
+    // A device pointer is cached with the range of its allocation, and a host pointer with its
+    // page, since device allocations are made of whole pages
+    constexpr uintptr_t page       = 4096;
+    uintptr_t           page_begin = address & ~(page - 1);
+    pointer_range       range{page_begin, page_begin + page, rocblas_pointer_mode_host, managed};
+    if(device)
+    {
+        void*  base;
+        size_t size;
+        if(hipMemGetAddressRange(&base, &size, const_cast<void*>(ptr)) != hipSuccess)
+            return {address, address + 1, rocblas_pointer_mode_device, managed};
+        range = {uintptr_t(base), uintptr_t(base) + size, rocblas_pointer_mode_device, managed};
+    }
+
+    pointer_ranges[pointer_ranges_next] = range;
+    pointer_ranges_next                 = (pointer_ranges_next + 1) % POINTER_RANGE_CACHE_ENTRIES;
+    return range;
+}
+
+void _rocblas_handle::prefetch_managed(const void* ptr, size_t bytes)
+{
+    if(!managed_prefetch || !ptr || !bytes || is_device_memory_size_query())
+        return;
+    if(classify_range(ptr).managed)
+        (void)hipMemPrefetchAsync(ptr, bytes, device, stream);
+}
+
 /*******************************************************************************
  * constructor
  ******************************************************************************/
@@ -171,14 +462,36 @@ _rocblas_handle::_rocblas_handle()
         stream_order_alloc             = stream_order_alloc_env_val ? true : false;
     }
 
+    //ROCBLAS_DEVICE_MEMORY_POOL
+    const char* device_memory_pool_env = read_env("ROCBLAS_DEVICE_MEMORY_POOL");
+    if(device_memory_pool_env)
+        device_memory_pool = strtoul(device_memory_pool_env, nullptr, 0) != 0;
+
     //ROCBLAS_DEFAULT_ATOMICS_MODE
     const char* atomics_mode_env = read_env("ROCBLAS_DEFAULT_ATOMICS_MODE");
     if(atomics_mode_env)
     {
-        atomics_mode = strtoul(atomics_mode_env, nullptr, 0) ? rocblas_atomics_allowed
-                                                             : rocblas_atomics_not_allowed;
+        unsigned long mode = strtoul(atomics_mode_env, nullptr, 0);
+        atomics_mode       = mode == 0   ? rocblas_atomics_not_allowed
+                             : mode == 2 ? rocblas_atomics_deterministic
+                                         : rocblas_atomics_allowed;
+    }
+
+    //ROCBLAS_GEMM_BACKEND
+    const char* gemm_backend_env = read_env("ROCBLAS_GEMM_BACKEND");
+    if(gemm_backend_env)
+    {
+        if(!strcmp(gemm_backend_env, "hipblaslt"))
+            gemm_backend = rocblas_gemm_backend_hipblaslt;
+        else if(!strcmp(gemm_backend_env, "auto"))
+            gemm_backend = rocblas_gemm_backend_auto;
     }
 
+    //ROCBLAS_PINNED_STAGING_SIZE
+    const char* pinned_staging_env = read_env("ROCBLAS_PINNED_STAGING_SIZE");
+    if(pinned_staging_env)
+        (void)set_pinned_staging_size(strtoull(pinned_staging_env, nullptr, 0));
+
     // Device memory size
     const char* env = read_env("ROCBLAS_DEVICE_MEMORY_SIZE");
     if(env)
@@ -208,9 +521,8 @@ _rocblas_handle::_rocblas_handle()
     }
 
     if(!stream_order_alloc)
-    { // Allocate device memory
-        if(device_memory_size)
-            THROW_IF_HIP_ERROR((hipMalloc)(&device_memory, device_memory_size));
+    { // Device memory is allocated on first use, so that creating a handle does not allocate
+        device_memory_deferred = device_memory_size != 0;
     }
     else
     {
@@ -240,18 +552,139 @@ _rocblas_handle::_rocblas_handle()
     init_check_numerics();
 }
 
+/*******************************************************************************
+ * clone constructor
+ ******************************************************************************/
+_rocblas_handle::_rocblas_handle(const _rocblas_handle* src)
+    : device(src->device)
+    , arch(src->arch)
+    , archMajor(src->archMajor)
+    , archMajorMinor(src->archMajorMinor)
+{
+    stream_order_alloc = src->stream_order_alloc;
+    stream_order_pool  = src->stream_order_pool;
+    device_memory_pool = src->device_memory_pool;
+    pointer_mode       = src->pointer_mode;
+    atomics_mode       = src->atomics_mode;
+    cache_policy       = src->cache_policy;
+    performance_metric = src->performance_metric;
+    check_numerics     = src->check_numerics;
+    math_mode          = src->math_mode;
+    ozaki_slices       = src->ozaki_slices;
+    order              = src->order;
+    layer_mode         = src->layer_mode;
+
+    autotune_candidates = src->autotune_candidates;
+    autotune_budget_ms  = src->autotune_budget_ms;
+    gemm_backend        = src->gemm_backend;
+    async_host_results  = src->async_host_results;
+    managed_prefetch    = src->managed_prefetch;
+
+    // The gemm epilogue, gemm_ex3 scales and batch scalars point to device memory owned by the
+    // user of src, which may be freed or reused while the clone runs on another stream, so the
+    // clone starts without them
+
+    // A user-managed size is kept, but a user-owned workspace cannot be shared between handles
+    if(src->device_memory_owner == rocblas_device_memory_ownership::user_managed)
+    {
+        device_memory_owner = rocblas_device_memory_ownership::user_managed;
+        device_memory_size  = src->device_memory_size;
+    }
+    else
+    {
+        device_memory_owner = rocblas_device_memory_ownership::rocblas_managed;
+        device_memory_size  = getDefaultDeviceMemorySize();
+    }
+
+    // Device memory is allocated on first use
+    device_memory_deferred = !stream_order_alloc && device_memory_size != 0;
+
+    // The clone has staging buffers of its own
+    (void)set_pinned_staging_size(src->pinned_staging_size);
+
+    open_log_streams();
+}
+
 /*******************************************************************************
  * destructor
  ******************************************************************************/
 _rocblas_handle::~_rocblas_handle()
 {
-    if(device_memory_in_use)
+    if(device_memory_in_use || device_memory_arenas_in_use)
     {
         rocblas_cerr
             << "rocBLAS internal error: Handle object destroyed while device memory still in use."
             << std::endl;
         rocblas_abort();
     }
+
+    // Device events of the Chrome trace log are written before the stream can be destroyed
+    if(log_chrome_trace)
+        log_chrome_trace->flush(this);
+
+    // A plan still being recorded is abandoned, which restores the stream and workspace
+    if(plan_recording)
+    {
+        rocblas_plan plan = nullptr;
+        if(rocblas_plan_end(this, &plan) == rocblas_status_success)
+            (void)rocblas_plan_destroy(plan);
+    }
+
+    // The staging buffers are freed once the copies using them have completed
+    (void)set_pinned_staging_size(0);
+
+    (void)release_auxiliary_streams();
+    (void)release_group_streams();
+
+    if(cu_mask_stream && hipStreamDestroy(cu_mask_stream) != hipSuccess)
+    {
+        rocblas_cerr << "rocBLAS error during destroying of CU-masked stream in handle destructor"
+                     << std::endl;
+    }
+
+    if(host_results_event && hipEventDestroy(host_results_event) != hipSuccess)
+    {
+        rocblas_cerr << "rocBLAS error during destroying of host results event in handle "
+                        "destructor"
+                     << std::endl;
+        rocblas_abort();
+    }
+
+    // The flags which have not been reported yet are printed if check_numerics asks for it
+    if(check_numerics_flags)
+    {
+        if(check_numerics & (rocblas_check_numerics_mode_info | rocblas_check_numerics_mode_warn))
+            (void)report_check_numerics_flags();
+        if((hipFree)(check_numerics_flags) != hipSuccess)
+        {
+            rocblas_cerr << "rocBLAS error during freeing of numerics check flags in handle "
+                            "destructor"
+                         << std::endl;
+            rocblas_abort();
+        }
+    }
+
+    if(reduction_tickets && (hipFree)(reduction_tickets) != hipSuccess)
+    {
+        rocblas_cerr << "rocBLAS error during freeing of reduction counters in handle destructor"
+                     << std::endl;
+        rocblas_abort();
+    }
+
+    if(reduction_workspace && (hipFree)(reduction_workspace) != hipSuccess)
+    {
+        rocblas_cerr << "rocBLAS error during freeing of reduction workspace in handle destructor"
+                     << std::endl;
+        rocblas_abort();
+    }
+
+    if(device_memory_pool_release() != rocblas_status_success)
+    {
+        rocblas_cerr << "rocBLAS error during freeing of device memory pool in handle destructor"
+                     << std::endl;
+        rocblas_abort();
+    }
+
     // Free device memory unless it's user-owned
     if(device_memory_owner != rocblas_device_memory_ownership::user_owned)
     {
@@ -285,6 +718,10 @@ _rocblas_handle::~_rocblas_handle()
                 rocblas_abort();
             };
 
+            // A user-provided pool is shared with the application, and is left as it is
+            if(stream_order_pool)
+                return;
+
             hipMemPool_t mem_pool;
             int          device;
             hipStatus = hipGetDevice(&device);
@@ -320,11 +757,53 @@ _rocblas_handle::~_rocblas_handle()
 #if ROCBLAS_REALLOC_ON_DEMAND
 bool _rocblas_handle::device_allocator(size_t size)
 {
+    // Device memory reserved for graph capture is used as it is while the stream is captured
+    if(capture_allocation_forbidden())
+    {
+        bool success = !device_memory_deferred && size <= device_memory_size - device_memory_in_use;
+        if(!success)
+            (void)check_capturable("workspace larger than the capture reservation");
+        return success;
+    }
+
+    // Device memory of a new handle is allocated on first use
+    if(device_memory_deferred && size)
+    {
+        device_memory_deferred = false;
+
+        // Temporarily change the thread's default device ID to the handle's device ID
+        // cppcheck-suppress unreadVariable
+        auto saved_device_id = push_device_id();
+
+        // If the request doesn't fit, rocBLAS-managed memory is allocated below instead
+        if(size > device_memory_size
+           && device_memory_owner == rocblas_device_memory_ownership::rocblas_managed)
+            device_memory_size = 0;
+        else if((hipMalloc)(&device_memory, device_memory_size) != hipSuccess)
+        {
+            device_memory      = nullptr;
+            device_memory_size = 0;
+        }
+        else
+            counters.count_workspace_allocation(device_memory_size);
+    }
+
     bool success = size <= device_memory_size - device_memory_in_use;
-    if(!success && device_memory_owner == rocblas_device_memory_ownership::rocblas_managed)
+
+    // Once nothing is in use, replace idle pool arenas with a single block which covers the
+    // high-water mark, so the following calls are served from device_memory again
+    bool consolidate = !device_memory_in_use && !device_memory_arenas_in_use
+                       && !device_memory_arenas.empty();
+
+    if((!success || consolidate)
+       && device_memory_owner == rocblas_device_memory_ownership::rocblas_managed)
     {
         if(device_memory_in_use)
         {
+            // The request is served from the overflow pool instead
+            if(device_memory_pool)
+                return false;
+
             rocblas_cerr << "rocBLAS internal error: Cannot reallocate device memory while it is "
                             "already in use."
                          << std::endl;
@@ -335,17 +814,31 @@ bool _rocblas_handle::device_allocator(size_t size)
         // cppcheck-suppress unreadVariable
         auto saved_device_id = push_device_id();
 
+        if(consolidate)
+        {
+            if(device_memory_pool_release() != rocblas_status_success)
+                return success;
+            size = std::max(size, device_memory_high_water);
+            if(size <= device_memory_size)
+                return true;
+        }
+
         device_memory_size = 0;
 
         //Add an additional device memory on top of default size.
         //This is to support kernels requiring large workspace with numerical checking enabled.
-        size_t total_size = size + getDefaultDeviceMemorySize();
+        //Grow to the largest memoized requirement, so that problems seen before do not cause
+        //another reallocation.
+        size_t total_size = std::max(size, workspace_size_cache_max) + getDefaultDeviceMemorySize();
 
         if(!device_memory || (hipFree)(device_memory) == hipSuccess)
         {
             success = (hipMalloc)(&device_memory, total_size) == hipSuccess;
             if(success)
+            {
                 device_memory_size = total_size;
+                counters.count_workspace_allocation(total_size);
+            }
             else
                 device_memory = nullptr;
         }
@@ -354,6 +847,80 @@ bool _rocblas_handle::device_allocator(size_t size)
 }
 #endif
 
+/*******************************************************************************
+ * helpers for the size-classed device memory pool
+ ******************************************************************************/
+void* _rocblas_handle::device_memory_pool_allocate(size_t size)
+{
+    if(device_memory_owner != rocblas_device_memory_ownership::rocblas_managed)
+        return nullptr;
+
+    // Round up to a power of two, so that arenas can be reused across differing sizes
+    size_t arena_size = DEVICE_MEMORY_ARENA_MIN_SIZE;
+    while(arena_size < size)
+        arena_size *= 2;
+
+    auto arena = std::find_if(
+        device_memory_arenas.begin(), device_memory_arenas.end(), [=](const auto& a) {
+            return !a.in_use && a.size == arena_size;
+        });
+
+    if(arena == device_memory_arenas.end())
+    {
+        if(capture_allocation_forbidden())
+            return nullptr;
+
+        // Temporarily change the thread's default device ID to the handle's device ID
+        // cppcheck-suppress unreadVariable
+        auto saved_device_id = push_device_id();
+
+        void* ptr = nullptr;
+        if((hipMalloc)(&ptr, arena_size) != hipSuccess)
+            return nullptr;
+        counters.count_workspace_allocation(arena_size);
+        device_memory_arenas.push_back({ptr, arena_size, false});
+        arena = device_memory_arenas.end() - 1;
+    }
+
+    arena->in_use = true;
+    device_memory_arenas_in_use += arena->size;
+    return arena->ptr;
+}
+
+void _rocblas_handle::device_memory_pool_free(void* ptr)
+{
+    for(auto& arena : device_memory_arenas)
+    {
+        if(arena.ptr == ptr && arena.in_use)
+        {
+            arena.in_use = false;
+            device_memory_arenas_in_use -= arena.size;
+            return;
+        }
+    }
+
+    rocblas_cerr << "rocBLAS internal error: device memory pool arena freed twice or not found."
+                 << std::endl;
+    rocblas_abort();
+}
+
+rocblas_status _rocblas_handle::device_memory_pool_release()
+{
+    if(device_memory_arenas_in_use)
+        return rocblas_status_internal_error;
+
+    // Temporarily change the thread's default device ID to the handle's device ID
+    // cppcheck-suppress unreadVariable
+    auto saved_device_id = push_device_id();
+
+    while(!device_memory_arenas.empty())
+    {
+        RETURN_IF_HIP_ERROR((hipFree)(device_memory_arenas.back().ptr));
+        device_memory_arenas.pop_back();
+    }
+    return rocblas_status_success;
+}
+
 /*******************************************************************************
  * start device memory size queries
  ******************************************************************************/
@@ -412,6 +979,24 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+/*******************************************************************************
+ * Get the largest workspace requirement memoized by the handle
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_cached_device_memory_size(rocblas_handle handle, size_t* size)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!size)
+        return rocblas_status_invalid_pointer;
+    *size = handle->workspace_size_cache_max;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 /*******************************************************************************
  * Free any allocated memory unless owned by user, and reset the handle to being
  * rocBLAS-managed
@@ -424,6 +1009,9 @@ static rocblas_status free_existing_device_memory(rocblas_handle handle)
     if(handle->device_memory_in_use)
         return rocblas_status_internal_error;
 
+    // Release the overflow arenas, which are never user-owned
+    RETURN_IF_ROCBLAS_ERROR(handle->device_memory_pool_release());
+
     // Free existing device memory in handle, unless owned by user
     if(handle->device_memory
        && handle->device_memory_owner != rocblas_device_memory_ownership::user_owned)
@@ -439,7 +1027,8 @@ static rocblas_status free_existing_device_memory(rocblas_handle handle)
     }
 
     // Clear the memory size and address, and set the memory to be rocBLAS-managed
-    handle->device_memory_size  = 0;
+    handle->device_memory_deferred = false;
+    handle->device_memory_size     = 0;
     handle->device_memory       = nullptr;
     handle->device_memory_owner = rocblas_device_memory_ownership::rocblas_managed;
 
@@ -478,7 +1067,7 @@ try
 // Support for default stream added in hip version 5.3.0
 #if HIP_VERSION >= 50300000
     else
-        hipStatus = (hipMallocAsync)(&handle->device_memory, size, handle->stream);
+        hipStatus = handle->stream_order_malloc(&handle->device_memory, size, handle->stream);
 #endif
 
     if(hipStatus != hipSuccess)
@@ -493,6 +1082,7 @@ try
         // If allocation succeeds, set size, mark it under user-management, and return success
         handle->device_memory_size  = size;
         handle->device_memory_owner = rocblas_device_memory_ownership::user_managed;
+        handle->counters.count_workspace_allocation(size);
         return rocblas_status_success;
     }
 }
@@ -535,6 +1125,300 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+/*******************************************************************************
+ * Run the kernels of the handle on a CU-masked stream owned by the handle, and
+ * select Tensile solutions for the compute units of the mask
+ ******************************************************************************/
+extern "C" rocblas_status
+    rocblas_set_cu_mask(rocblas_handle handle, rocblas_int cu_mask_size, const uint32_t* cu_mask)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_cu_mask", cu_mask_size, cu_mask);
+
+    if(cu_mask_size < 0)
+        return rocblas_status_invalid_size;
+    if(cu_mask_size && !cu_mask)
+        return rocblas_status_invalid_pointer;
+    if(handle->is_group_open() || handle->plan_recording)
+        return rocblas_status_invalid_value;
+
+    auto saved_device_id = handle->push_device_id();
+
+    // Count the enabled compute units which the device has
+    int device_cus = 0, enabled_cus = 0;
+    RETURN_IF_HIP_ERROR(hipDeviceGetAttribute(
+        &device_cus, hipDeviceAttributeMultiprocessorCount, handle->getDevice()));
+    for(int cu = 0; cu < std::min(device_cus, 32 * cu_mask_size); cu++)
+        enabled_cus += (cu_mask[cu / 32] >> (cu % 32)) & 1;
+    if(cu_mask_size && !enabled_cus)
+        return rocblas_status_invalid_value;
+
+    hipStream_t masked = nullptr;
+    if(cu_mask_size)
+        RETURN_IF_HIP_ERROR(hipExtStreamCreateWithCUMask(&masked, cu_mask_size, cu_mask));
+
+    // The work enqueued so far completes before the kernels move to the new stream
+    hipError_t sync_status = handle->synchronize_stream();
+    if(sync_status != hipSuccess)
+    {
+        if(masked)
+            (void)hipStreamDestroy(masked);
+        RETURN_IF_HIP_ERROR(sync_status);
+    }
+
+    if(handle->cu_mask_stream)
+        RETURN_IF_HIP_ERROR(hipStreamDestroy(handle->cu_mask_stream));
+    else
+        handle->cu_mask_saved_stream = handle->stream;
+
+    handle->cu_mask_stream = masked;
+    handle->cu_mask_count  = masked ? enabled_cus : 0;
+    handle->stream         = masked ? masked : handle->cu_mask_saved_stream;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Enable or disable the size-classed device memory pool
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_device_memory_pool(rocblas_handle handle, bool enable)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(!enable)
+    {
+        // Arenas cannot be released while a device_malloc object still refers to one
+        if(handle->device_memory_arenas_in_use)
+            return rocblas_status_internal_error;
+
+        RETURN_IF_ROCBLAS_ERROR(handle->device_memory_pool_release());
+    }
+
+    handle->device_memory_pool = enable;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Reserve device memory for graph capture, and forbid allocation during capture
+ ******************************************************************************/
+rocblas_status _rocblas_handle::reserve_capture_workspace()
+{
+    if(device_memory_owner != rocblas_device_memory_ownership::rocblas_managed
+       || stream_order_alloc)
+        return rocblas_status_success;
+
+    // Device memory cannot be reallocated while a device_malloc object is using it
+    if(device_memory_in_use || device_memory_arenas_in_use)
+        return rocblas_status_internal_error;
+
+#if ROCBLAS_REALLOC_ON_DEMAND
+    // The reservation holds the largest memoized requirement and at least the default size:
+    // requesting at least one byte allocates deferred device memory of the default size, and
+    // growing adds the default size on top of the request, as any reallocation does
+    size_t size = std::max<size_t>(workspace_size_cache_max, 1);
+    if(size > device_memory_size || device_memory_deferred)
+        return device_allocator(size) ? rocblas_status_success : rocblas_status_memory_error;
+#endif
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocblas_set_capture_workspace_reserve(rocblas_handle handle, bool enable)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_capture_workspace_reserve", enable);
+
+    if(enable)
+    {
+        if(handle->is_stream_in_capture_mode())
+            return rocblas_status_invalid_value;
+
+        RETURN_IF_ROCBLAS_ERROR(handle->reserve_capture_workspace());
+    }
+
+    handle->capture_workspace_reserve = enable;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Set the memory pool and release threshold used for stream-ordered allocation
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_stream_order_memory_pool(rocblas_handle handle,
+                                                               hipMemPool_t   pool,
+                                                               uint64_t       release_threshold)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+// hipMallocFromPoolAsync and the memory pool attributes are defined in hip version 5.2.0
+// Support for default stream added in hip version 5.3.0
+#if HIP_VERSION >= 50300000
+    // Temporarily change the thread's default device ID to the handle's device ID
+    auto saved_device_id = handle->push_device_id();
+
+    hipMemPool_t mem_pool = pool;
+    if(!mem_pool)
+        RETURN_IF_HIP_ERROR(hipDeviceGetDefaultMemPool(&mem_pool, handle->getDevice()));
+
+    // Memory below the threshold stays in the pool instead of returning to the OS at
+    // each synchronization, so bursts of calls do not re-fault their workspace
+    if(release_threshold)
+        RETURN_IF_HIP_ERROR(
+            hipMemPoolSetAttribute(mem_pool, hipMemPoolAttrReleaseThreshold, &release_threshold));
+
+    handle->stream_order_pool = pool;
+    return rocblas_status_success;
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Release the events used by the auxiliary streams; the streams belong to the user
+ ******************************************************************************/
+rocblas_status _rocblas_handle::release_auxiliary_streams()
+{
+    rocblas_status status = rocblas_status_success;
+    if(aux_fork_event && hipEventDestroy(aux_fork_event) != hipSuccess)
+        status = rocblas_status_internal_error;
+    for(auto e : aux_join_events)
+        if(hipEventDestroy(e) != hipSuccess)
+            status = rocblas_status_internal_error;
+    aux_fork_event = nullptr;
+    aux_join_events.clear();
+    aux_streams.clear();
+    aux_priorities.clear();
+    aux_lanes_valid = false;
+    return status;
+}
+
+/*******************************************************************************
+ * Open an asynchronous call group on num_streams group streams, forked from the
+ * stream of the handle
+ ******************************************************************************/
+rocblas_status _rocblas_handle::begin_group(rocblas_int num_streams)
+{
+    auto saved_device_id = push_device_id();
+
+    // The group streams have the priority of the stream they are forked from
+    int priority = get_stream_priority();
+    if(!group_streams.empty() && priority != group_priority)
+        RETURN_IF_ROCBLAS_ERROR(release_group_streams());
+    group_priority = priority;
+
+    if(!group_fork_event)
+    {
+        RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&group_fork_event, hipEventDisableTiming));
+        RETURN_IF_HIP_ERROR(
+            hipEventCreateWithFlags(&group_workspace_event, hipEventDisableTiming));
+    }
+    while(group_streams.size() < size_t(num_streams))
+    {
+        hipStream_t s;
+        hipEvent_t  e;
+        RETURN_IF_HIP_ERROR(create_helper_stream(&s));
+        group_streams.push_back(s);
+        RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&e, hipEventDisableTiming));
+        group_join_events.push_back(e);
+    }
+
+    // The group streams, and the first call to take shared memory, start after the work
+    // already enqueued on the stream
+    RETURN_IF_HIP_ERROR(hipEventRecord(group_fork_event, stream));
+    RETURN_IF_HIP_ERROR(hipEventRecord(group_workspace_event, stream));
+    for(rocblas_int i = 0; i < num_streams; i++)
+        RETURN_IF_HIP_ERROR(hipStreamWaitEvent(group_streams[i], group_fork_event, 0));
+
+    group_main_stream = stream;
+    group_size        = num_streams;
+    group_next        = 0;
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ * Close the asynchronous call group, joining its streams back to the stream of
+ * the handle
+ ******************************************************************************/
+rocblas_status _rocblas_handle::end_group()
+{
+    auto   saved_device_id = push_device_id();
+    size_t used            = std::min(group_next, group_size);
+    group_size             = 0;
+
+    for(size_t i = 0; i < used; i++)
+    {
+        RETURN_IF_HIP_ERROR(hipEventRecord(group_join_events[i], group_streams[i]));
+        RETURN_IF_HIP_ERROR(hipStreamWaitEvent(stream, group_join_events[i], 0));
+    }
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ * Destroy the streams and events of the asynchronous call groups
+ ******************************************************************************/
+rocblas_status _rocblas_handle::release_group_streams()
+{
+    rocblas_status status = rocblas_status_success;
+    for(auto s : group_streams)
+        if(hipStreamDestroy(s) != hipSuccess)
+            status = rocblas_status_internal_error;
+    for(auto e : group_join_events)
+        if(hipEventDestroy(e) != hipSuccess)
+            status = rocblas_status_internal_error;
+    for(auto e : {group_fork_event, group_workspace_event})
+        if(e && hipEventDestroy(e) != hipSuccess)
+            status = rocblas_status_internal_error;
+    group_streams.clear();
+    group_join_events.clear();
+    group_fork_event      = nullptr;
+    group_workspace_event = nullptr;
+    return status;
+}
+
+/*******************************************************************************
+ * Get the largest amount of device memory in use at once
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_device_memory_high_water_mark(rocblas_handle handle,
+                                                                    size_t*        size)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!size)
+        return rocblas_status_invalid_pointer;
+    *size = handle->device_memory_high_water;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 /*******************************************************************************
  * Returns whether device memory is rocblas-managed
  ******************************************************************************/
@@ -772,19 +1656,39 @@ void _rocblas_handle::init_logging()
     if(str_layer_mode)
     {
         layer_mode = static_cast<rocblas_layer_mode>(strtol(str_layer_mode, 0, 0));
+        open_log_streams();
+    }
+}
 
-        // open log_trace file
-        if(layer_mode & rocblas_layer_mode_log_trace)
-            log_trace_os = open_log_stream("ROCBLAS_LOG_TRACE_PATH");
+/*******************************************************************************
+ * Open the log streams needed by layer_mode
+ ******************************************************************************/
+void _rocblas_handle::open_log_streams()
+{
+    // open log_trace file
+    if(layer_mode & rocblas_layer_mode_log_trace)
+    {
+        log_trace_os     = open_log_stream("ROCBLAS_LOG_TRACE_PATH");
+        log_chrome_trace = rocblas_chrome_trace_log::open(
+            read_env("ROCBLAS_LOG_TRACE_CHROME_PATH"), read_env("ROCBLAS_LOG_TRACE_CHROME_DEVICE"));
+    }
 
-        // open log_bench file
-        if(layer_mode & rocblas_layer_mode_log_bench)
+    // open log_bench file, unless calls are logged in the binary bench log
+    if(layer_mode & rocblas_layer_mode_log_bench)
+    {
+        const char* binary_path = read_env("ROCBLAS_LOG_BENCH_BINARY_PATH");
+        log_bench_binary        = rocblas_bench_binary_log::open(binary_path);
+        if(!log_bench_binary)
             log_bench_os = open_log_stream("ROCBLAS_LOG_BENCH_PATH");
-
-        // open log_profile file
-        if(layer_mode & rocblas_layer_mode_log_profile)
-            log_profile_os = open_log_stream("ROCBLAS_LOG_PROFILE_PATH");
     }
+
+    // open log_profile file
+    if(layer_mode & rocblas_layer_mode_log_profile)
+        log_profile_os = open_log_stream("ROCBLAS_LOG_PROFILE_PATH");
+
+    // open log_explain file
+    if(layer_mode & rocblas_layer_mode_log_explain)
+        log_explain_os = open_log_stream("ROCBLAS_LOG_EXPLAIN_PATH");
 }
 
 /*******************************************************************************
@@ -840,3 +1744,190 @@ void _rocblas_handle::init_check_numerics()
             = static_cast<rocblas_check_numerics_mode>(strtol(str_check_numerics_mode, 0, 0));
     }
 }
+
+/*******************************************************************************
+ * A chain of calls recorded into a graph by rocblas_plan_begin and
+ * rocblas_plan_end, with the workspace the recorded calls use
+ ******************************************************************************/
+struct _rocblas_plan
+{
+    int            device;
+    hipStream_t    capture_stream = nullptr;
+    hipGraph_t     graph          = nullptr;
+    hipGraphExec_t exec           = nullptr;
+    void*          workspace      = nullptr;
+    size_t         workspace_size = 0;
+
+    // State of the handle replaced while recording, restored by rocblas_plan_end
+    hipStream_t                     saved_stream;
+    void*                           saved_device_memory;
+    size_t                          saved_device_memory_size;
+    bool                            saved_device_memory_deferred;
+    rocblas_device_memory_ownership saved_device_memory_owner;
+    bool                            saved_device_memory_pool;
+    std::vector<const char*>        saved_capture_audit_log;
+
+    explicit _rocblas_plan(int device)
+        : device(device)
+    {
+    }
+
+    ~_rocblas_plan()
+    {
+        _rocblas_handle::_rocblas_saved_device_id saved_device_id(device);
+
+        // Freeing the workspace waits for the launches of the plan
+        if(workspace)
+            PRINT_IF_HIP_ERROR((hipFree)(workspace));
+        if(exec)
+            PRINT_IF_HIP_ERROR(hipGraphExecDestroy(exec));
+        if(graph)
+            PRINT_IF_HIP_ERROR(hipGraphDestroy(graph));
+        if(capture_stream)
+            PRINT_IF_HIP_ERROR(hipStreamDestroy(capture_stream));
+    }
+};
+
+/*******************************************************************************
+ * Begin recording a plan: the handle enqueues on the capture stream of the plan
+ * and borrows its workspace until rocblas_plan_end
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_plan_begin(rocblas_handle handle, size_t workspace_size)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_plan_begin", workspace_size);
+
+    // One plan is recorded at a time, on a handle whose stream is not already being captured
+    if(handle->plan_recording || handle->is_stream_in_capture_mode())
+        return rocblas_status_invalid_value;
+
+    // The workspace cannot be swapped while a device_malloc object is using it
+    if(handle->device_memory_in_use || handle->device_memory_arenas_in_use)
+        return rocblas_status_internal_error;
+
+    auto saved_device_id = handle->push_device_id();
+    auto plan            = std::make_unique<_rocblas_plan>(handle->getDevice());
+
+    plan->workspace_size = workspace_size ? workspace_size : handle->getDefaultDeviceMemorySize();
+    RETURN_IF_HIP_ERROR((hipMalloc)(&plan->workspace, plan->workspace_size));
+    RETURN_IF_HIP_ERROR(hipStreamCreateWithFlags(&plan->capture_stream, hipStreamNonBlocking));
+    RETURN_IF_HIP_ERROR(
+        hipStreamBeginCapture(plan->capture_stream, hipStreamCaptureModeThreadLocal));
+
+    plan->saved_stream                 = handle->stream;
+    plan->saved_device_memory          = handle->device_memory;
+    plan->saved_device_memory_size     = handle->device_memory_size;
+    plan->saved_device_memory_deferred = handle->device_memory_deferred;
+    plan->saved_device_memory_owner    = handle->device_memory_owner;
+    plan->saved_device_memory_pool     = handle->device_memory_pool;
+    plan->saved_capture_audit_log.swap(handle->capture_audit_log);
+
+    // The recorded calls use the workspace of the plan, which lives as long as the graph.
+    // Arenas of the pool would not, so the pool is disabled while recording.
+    handle->stream                 = plan->capture_stream;
+    handle->device_memory          = plan->workspace;
+    handle->device_memory_size     = plan->workspace_size;
+    handle->device_memory_deferred = false;
+    handle->device_memory_owner    = rocblas_device_memory_ownership::user_owned;
+    handle->device_memory_pool     = false;
+    handle->plan_recording         = plan.release();
+
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * End recording a plan, restoring the stream and workspace of the handle, and
+ * instantiate its graph
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_plan_end(rocblas_handle handle, rocblas_plan* plan)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!plan)
+        return rocblas_status_invalid_pointer;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_plan_end", plan);
+
+    if(!handle->plan_recording)
+        return rocblas_status_invalid_value;
+    if(handle->device_memory_in_use)
+        return rocblas_status_internal_error;
+
+    auto                           saved_device_id = handle->push_device_id();
+    std::unique_ptr<_rocblas_plan> recorded(handle->plan_recording);
+    handle->plan_recording = nullptr;
+
+    handle->stream                 = recorded->saved_stream;
+    handle->device_memory          = recorded->saved_device_memory;
+    handle->device_memory_size     = recorded->saved_device_memory_size;
+    handle->device_memory_deferred = recorded->saved_device_memory_deferred;
+    handle->device_memory_owner    = recorded->saved_device_memory_owner;
+    handle->device_memory_pool     = recorded->saved_device_memory_pool;
+
+    // Paths which could not be captured were recorded in the audit log while recording; they
+    // are kept in the log of the handle, and the chain they belong to is incomplete
+    bool incomplete = !handle->capture_audit_log.empty();
+    for(const char* path : handle->capture_audit_log)
+        if(std::find(recorded->saved_capture_audit_log.begin(),
+                     recorded->saved_capture_audit_log.end(),
+                     path)
+           == recorded->saved_capture_audit_log.end())
+            recorded->saved_capture_audit_log.push_back(path);
+    handle->capture_audit_log.swap(recorded->saved_capture_audit_log);
+
+    hipError_t capture_status = hipStreamEndCapture(recorded->capture_stream, &recorded->graph);
+    if(incomplete)
+        return rocblas_status_not_implemented;
+    RETURN_IF_HIP_ERROR(capture_status);
+    RETURN_IF_HIP_ERROR(hipGraphInstantiate(&recorded->exec, recorded->graph, nullptr, nullptr, 0));
+
+    *plan = recorded.release();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Replay a plan. Arguments were checked, calls logged and solutions selected
+ * when it was recorded, so this is a single graph launch.
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_plan_launch(rocblas_plan plan, hipStream_t stream)
+try
+{
+    if(!plan)
+        return rocblas_status_invalid_pointer;
+
+    _rocblas_handle::_rocblas_saved_device_id saved_device_id(plan->device);
+    RETURN_IF_HIP_ERROR(hipGraphLaunch(plan->exec, stream));
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Destroy a plan
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_plan_destroy(rocblas_plan plan)
+try
+{
+    delete plan;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
@@ -0,0 +1,465 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*****************************************************************************
+ * The rocBLAS<->hipBLASLt interface layer. The few hipBLASLt C API types   *
+ * and constants used are mirrored here, so that the headers of hipBLASLt   *
+ * are not needed to build rocBLAS, and the library is loaded with dlopen.  *
+ * When the headers are found they are used instead, and the mirrored ABI   *
+ * is checked against them.                                                 *
+ *****************************************************************************/
+
+#include "hipblaslt_host.hpp"
+#include "rocblas_ostream.hpp"
+#include <cstddef>
+#include <cstring>
+#include <hip/library_types.h>
+#include <limits>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+
+#ifndef WIN32
+#include <dlfcn.h>
+#endif
+
+#if __has_include(<hipblaslt/hipblaslt.h>)
+#include <hipblaslt/hipblaslt.h>
+#define ROCBLAS_HIPBLASLT_HEADERS
+#endif
+
+namespace rocblas_hipblaslt_abi
+{
+    using hipblasStatus_t             = int;
+    using hipblasLtHandle_t           = void*;
+    using hipblasLtMatmulDesc_t       = void*;
+    using hipblasLtMatrixLayout_t     = void*;
+    using hipblasLtMatmulPreference_t = void*;
+
+    constexpr hipblasStatus_t HIPBLAS_STATUS_SUCCESS = 0;
+
+    // hipblasComputeType_t and the attributes of hipblasLtMatrixLayoutAttribute_t,
+    // hipblasLtMatmulDescAttributes_t and hipblasLtMatmulPreferenceAttributes_t
+    constexpr int HIPBLAS_COMPUTE_32F                          = 2;
+    constexpr int HIPBLASLT_MATRIX_LAYOUT_BATCH_COUNT          = 0;
+    constexpr int HIPBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET = 1;
+    constexpr int HIPBLASLT_MATMUL_DESC_TRANSA                 = 0;
+    constexpr int HIPBLASLT_MATMUL_DESC_TRANSB                 = 1;
+    constexpr int HIPBLASLT_MATMUL_PREF_MAX_WORKSPACE_BYTES    = 1;
+
+    struct hipblasLtMatmulAlgo_t
+    {
+        uint8_t data[16];
+        size_t  max_workspace_bytes;
+    };
+
+    struct hipblasLtMatmulHeuristicResult_t
+    {
+        hipblasLtMatmulAlgo_t algo;
+        size_t                workspaceSize;
+        hipblasStatus_t       state;
+        float                 wavesCount;
+        int                   reserved[4];
+    };
+}
+
+#ifdef ROCBLAS_HIPBLASLT_HEADERS
+namespace
+{
+    namespace abi = rocblas_hipblaslt_abi;
+
+    static_assert(sizeof(abi::hipblasStatus_t) == sizeof(hipblasStatus_t)
+                      && abi::HIPBLAS_STATUS_SUCCESS == HIPBLAS_STATUS_SUCCESS,
+                  "the mirrored hipblasStatus_t does not match hipBLASLt");
+    static_assert(abi::HIPBLAS_COMPUTE_32F == HIPBLAS_COMPUTE_32F,
+                  "the mirrored hipblasComputeType_t does not match hipBLASLt");
+    static_assert(abi::HIPBLASLT_MATRIX_LAYOUT_BATCH_COUNT == HIPBLASLT_MATRIX_LAYOUT_BATCH_COUNT
+                      && abi::HIPBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET
+                             == HIPBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET
+                      && abi::HIPBLASLT_MATMUL_DESC_TRANSA == HIPBLASLT_MATMUL_DESC_TRANSA
+                      && abi::HIPBLASLT_MATMUL_DESC_TRANSB == HIPBLASLT_MATMUL_DESC_TRANSB
+                      && abi::HIPBLASLT_MATMUL_PREF_MAX_WORKSPACE_BYTES
+                             == HIPBLASLT_MATMUL_PREF_MAX_WORKSPACE_BYTES,
+                  "the mirrored hipBLASLt attributes do not match hipBLASLt");
+    static_assert(sizeof(abi::hipblasLtMatmulAlgo_t) == sizeof(hipblasLtMatmulAlgo_t)
+                      && offsetof(abi::hipblasLtMatmulAlgo_t, max_workspace_bytes)
+                             == offsetof(hipblasLtMatmulAlgo_t, max_workspace_bytes),
+                  "the mirrored hipblasLtMatmulAlgo_t does not match hipBLASLt");
+    static_assert(sizeof(abi::hipblasLtMatmulHeuristicResult_t)
+                          == sizeof(hipblasLtMatmulHeuristicResult_t)
+                      && offsetof(abi::hipblasLtMatmulHeuristicResult_t, workspaceSize)
+                             == offsetof(hipblasLtMatmulHeuristicResult_t, workspaceSize)
+                      && offsetof(abi::hipblasLtMatmulHeuristicResult_t, state)
+                             == offsetof(hipblasLtMatmulHeuristicResult_t, state),
+                  "the mirrored hipblasLtMatmulHeuristicResult_t does not match hipBLASLt");
+    static_assert(HIPBLAS_OP_N == rocblas_operation_none
+                      && HIPBLAS_OP_T == rocblas_operation_transpose
+                      && HIPBLAS_OP_C == rocblas_operation_conjugate_transpose,
+                  "rocblas_operation does not match hipblasOperation_t");
+}
+#else
+using namespace rocblas_hipblaslt_abi;
+#endif
+
+namespace
+{
+    static_assert(sizeof(hipblasLtMatmulAlgo_t::data) == sizeof(rocblas_hipblaslt_algo::data),
+                  "hipBLASLt and rocBLAS algorithms are not the same size");
+
+    // hipblasOperation_t has the values of rocblas_operation
+    static_assert(rocblas_operation_none == 111 && rocblas_operation_transpose == 112
+                      && rocblas_operation_conjugate_transpose == 113,
+                  "rocblas_operation does not match hipblasOperation_t");
+
+    // The oldest hipBLASLt with the mirrored API, in the encoding of hipblasLtGetVersion,
+    // major * 100000 + minor * 100 + patch
+    constexpr int ROCBLAS_HIPBLASLT_MIN_VERSION = 600;
+
+    struct rocblas_hipblaslt_api
+    {
+        hipblasStatus_t (*get_version)(hipblasLtHandle_t, int*) = nullptr;
+        hipblasStatus_t (*create)(hipblasLtHandle_t*) = nullptr;
+        hipblasStatus_t (*layout_create)(
+            hipblasLtMatrixLayout_t*, hipDataType, uint64_t, uint64_t, int64_t)
+            = nullptr;
+        hipblasStatus_t (*layout_set)(hipblasLtMatrixLayout_t, int, const void*, size_t)
+            = nullptr;
+        hipblasStatus_t (*layout_destroy)(hipblasLtMatrixLayout_t)                 = nullptr;
+        hipblasStatus_t (*desc_create)(hipblasLtMatmulDesc_t*, int, hipDataType)   = nullptr;
+        hipblasStatus_t (*desc_set)(hipblasLtMatmulDesc_t, int, const void*, size_t) = nullptr;
+        hipblasStatus_t (*desc_destroy)(hipblasLtMatmulDesc_t)                     = nullptr;
+        hipblasStatus_t (*pref_create)(hipblasLtMatmulPreference_t*)               = nullptr;
+        hipblasStatus_t (*pref_set)(hipblasLtMatmulPreference_t, int, const void*, size_t)
+            = nullptr;
+        hipblasStatus_t (*pref_destroy)(hipblasLtMatmulPreference_t) = nullptr;
+        hipblasStatus_t (*heuristic)(hipblasLtHandle_t,
+                                     hipblasLtMatmulDesc_t,
+                                     hipblasLtMatrixLayout_t,
+                                     hipblasLtMatrixLayout_t,
+                                     hipblasLtMatrixLayout_t,
+                                     hipblasLtMatrixLayout_t,
+                                     hipblasLtMatmulPreference_t,
+                                     int,
+                                     hipblasLtMatmulHeuristicResult_t*,
+                                     int*)
+            = nullptr;
+        hipblasStatus_t (*matmul)(hipblasLtHandle_t,
+                                  hipblasLtMatmulDesc_t,
+                                  const void*,
+                                  const void*,
+                                  hipblasLtMatrixLayout_t,
+                                  const void*,
+                                  hipblasLtMatrixLayout_t,
+                                  const void*,
+                                  const void*,
+                                  hipblasLtMatrixLayout_t,
+                                  void*,
+                                  hipblasLtMatrixLayout_t,
+                                  const hipblasLtMatmulAlgo_t*,
+                                  void*,
+                                  size_t,
+                                  hipStream_t)
+            = nullptr;
+
+        bool loaded = false;
+
+        // One hipBLASLt handle per device, created on its first use
+        std::mutex                                 mutex;
+        std::unordered_map<int, hipblasLtHandle_t> handles;
+
+        rocblas_hipblaslt_api()
+        {
+#ifndef WIN32
+            void* lib = dlopen("libhipblaslt.so", RTLD_NOW | RTLD_LOCAL);
+            if(!lib)
+                lib = dlopen("libhipblaslt.so.0", RTLD_NOW | RTLD_LOCAL);
+            if(!lib)
+                return;
+
+            auto load = [lib](auto& fn, const char* name) {
+                fn = reinterpret_cast<std::remove_reference_t<decltype(fn)>>(dlsym(lib, name));
+                return fn != nullptr;
+            };
+            loaded = load(get_version, "hipblasLtGetVersion") && load(create, "hipblasLtCreate")
+                     && load(layout_create, "hipblasLtMatrixLayoutCreate")
+                     && load(layout_set, "hipblasLtMatrixLayoutSetAttribute")
+                     && load(layout_destroy, "hipblasLtMatrixLayoutDestroy")
+                     && load(desc_create, "hipblasLtMatmulDescCreate")
+                     && load(desc_set, "hipblasLtMatmulDescSetAttribute")
+                     && load(desc_destroy, "hipblasLtMatmulDescDestroy")
+                     && load(pref_create, "hipblasLtMatmulPreferenceCreate")
+                     && load(pref_set, "hipblasLtMatmulPreferenceSetAttribute")
+                     && load(pref_destroy, "hipblasLtMatmulPreferenceDestroy")
+                     && load(heuristic, "hipblasLtMatmulAlgoGetHeuristic")
+                     && load(matmul, "hipblasLtMatmul");
+            if(!loaded)
+            {
+                rocblas_cerr << "rocBLAS warning: libhipblaslt does not have the expected API, "
+                                "GEMMs will only use Tensile"
+                             << std::endl;
+                return;
+            }
+
+            // The version is that of a handle, which is kept for the current device
+            int               device = 0, version = 0;
+            hipblasLtHandle_t lt = nullptr;
+            loaded = hipGetDevice(&device) == hipSuccess && create(&lt) == HIPBLAS_STATUS_SUCCESS
+                     && get_version(lt, &version) == HIPBLAS_STATUS_SUCCESS
+                     && version >= ROCBLAS_HIPBLASLT_MIN_VERSION;
+            if(lt)
+                handles[device] = lt;
+            if(!loaded)
+                rocblas_cerr << "rocBLAS warning: libhipblaslt version " << version
+                             << " is older than " << ROCBLAS_HIPBLASLT_MIN_VERSION
+                             << " or could not be read, GEMMs will only use Tensile"
+                             << std::endl;
+#endif
+        }
+
+        // The handles are not destroyed, since hipBLASLt may be unloaded before rocBLAS
+        hipblasLtHandle_t get_handle(int device)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto                        it = handles.find(device);
+            if(it != handles.end())
+                return it->second;
+            hipblasLtHandle_t lt = nullptr;
+            if(create(&lt) != HIPBLAS_STATUS_SUCCESS)
+                lt = nullptr;
+            return handles[device] = lt;
+        }
+    };
+
+    rocblas_hipblaslt_api& rocblas_hipblaslt_get_api()
+    {
+        static rocblas_hipblaslt_api api;
+        return api;
+    }
+
+    // The hipDataType of a rocblas_datatype, or HIP_R_64F for types which are not routed
+    hipDataType rocblas_hipblaslt_datatype(rocblas_datatype type)
+    {
+        switch(type)
+        {
+        case rocblas_datatype_f16_r:
+            return HIP_R_16F;
+        case rocblas_datatype_bf16_r:
+            return HIP_R_16BF;
+        case rocblas_datatype_f32_r:
+            return HIP_R_32F;
+        case rocblas_datatype_f8_r:
+            return HIP_R_8F_E4M3_FNUZ;
+        case rocblas_datatype_bf8_r:
+            return HIP_R_8F_E5M2_FNUZ;
+        default:
+            return HIP_R_64F;
+        }
+    }
+
+    // The descriptors of a problem, destroyed with it
+    class rocblas_hipblaslt_descriptors
+    {
+        rocblas_hipblaslt_api& api;
+
+    public:
+        hipblasLtMatmulDesc_t   desc = nullptr;
+        hipblasLtMatrixLayout_t a = nullptr, b = nullptr, c = nullptr, d = nullptr;
+        bool                    valid = false;
+
+        rocblas_hipblaslt_descriptors(rocblas_hipblaslt_api&            api,
+                                      const rocblas_hipblaslt_problem& p)
+            : api(api)
+        {
+            int32_t     trans_a = p.trans_a, trans_b = p.trans_b;
+            bool        ta      = p.trans_a != rocblas_operation_none;
+            bool        tb      = p.trans_b != rocblas_operation_none;
+            hipDataType c_type  = rocblas_hipblaslt_datatype(p.c_type);
+
+            valid = api.desc_create(
+                        &desc, HIPBLAS_COMPUTE_32F, rocblas_hipblaslt_datatype(p.scale_type))
+                        == HIPBLAS_STATUS_SUCCESS
+                    && api.desc_set(desc, HIPBLASLT_MATMUL_DESC_TRANSA, &trans_a, sizeof(trans_a))
+                           == HIPBLAS_STATUS_SUCCESS
+                    && api.desc_set(desc, HIPBLASLT_MATMUL_DESC_TRANSB, &trans_b, sizeof(trans_b))
+                           == HIPBLAS_STATUS_SUCCESS
+                    && layout(&a,
+                              rocblas_hipblaslt_datatype(p.a_type),
+                              ta ? p.k : p.m,
+                              ta ? p.m : p.k,
+                              p.lda,
+                              p.stride_a,
+                              p.batch_count)
+                    && layout(&b,
+                              rocblas_hipblaslt_datatype(p.b_type),
+                              tb ? p.n : p.k,
+                              tb ? p.k : p.n,
+                              p.ldb,
+                              p.stride_b,
+                              p.batch_count)
+                    && layout(&c, c_type, p.m, p.n, p.ldc, p.stride_c, p.batch_count)
+                    && layout(&d, c_type, p.m, p.n, p.ldd, p.stride_d, p.batch_count);
+        }
+
+        ~rocblas_hipblaslt_descriptors()
+        {
+            for(auto l : {a, b, c, d})
+                if(l)
+                    api.layout_destroy(l);
+            if(desc)
+                api.desc_destroy(desc);
+        }
+
+        rocblas_hipblaslt_descriptors(const rocblas_hipblaslt_descriptors&) = delete;
+        rocblas_hipblaslt_descriptors& operator=(const rocblas_hipblaslt_descriptors&) = delete;
+
+    private:
+        bool layout(hipblasLtMatrixLayout_t* l,
+                    hipDataType              type,
+                    int64_t                  rows,
+                    int64_t                  cols,
+                    int64_t                  ld,
+                    int64_t                  stride,
+                    int64_t                  batch_count)
+        {
+            int32_t batch = int32_t(batch_count);
+            return api.layout_create(l, type, rows, cols, ld) == HIPBLAS_STATUS_SUCCESS
+                   && (batch == 1
+                       || (api.layout_set(
+                               *l, HIPBLASLT_MATRIX_LAYOUT_BATCH_COUNT, &batch, sizeof(batch))
+                               == HIPBLAS_STATUS_SUCCESS
+                           && api.layout_set(*l,
+                                             HIPBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET,
+                                             &stride,
+                                             sizeof(stride))
+                                  == HIPBLAS_STATUS_SUCCESS));
+        }
+    };
+}
+
+bool rocblas_hipblaslt_available()
+{
+    return rocblas_hipblaslt_get_api().loaded;
+}
+
+bool rocblas_hipblaslt_supports_types(rocblas_datatype a_type,
+                                      rocblas_datatype b_type,
+                                      rocblas_datatype c_type,
+                                      rocblas_datatype scale_type)
+{
+    // The inputs are 16 or 8 bit types, and the output is not an 8 bit type
+    auto input = [](rocblas_datatype type) {
+        return type == rocblas_datatype_f16_r || type == rocblas_datatype_bf16_r
+               || type == rocblas_datatype_f8_r || type == rocblas_datatype_bf8_r;
+    };
+    return input(a_type) && input(b_type) && scale_type == rocblas_datatype_f32_r
+           && (c_type == rocblas_datatype_f16_r || c_type == rocblas_datatype_bf16_r
+               || c_type == rocblas_datatype_f32_r);
+}
+
+bool rocblas_hipblaslt_find_algo(rocblas_handle                   handle,
+                                 const rocblas_hipblaslt_problem& prob,
+                                 size_t                           max_workspace,
+                                 rocblas_hipblaslt_algo*          algo)
+{
+    auto& api = rocblas_hipblaslt_get_api();
+    if(!api.loaded || prob.batch_count > std::numeric_limits<int32_t>::max())
+        return false;
+    hipblasLtHandle_t lt = api.get_handle(handle->getDevice());
+    if(!lt)
+        return false;
+
+    rocblas_hipblaslt_descriptors descriptors(api, prob);
+    hipblasLtMatmulPreference_t   pref = nullptr;
+    if(!descriptors.valid || api.pref_create(&pref) != HIPBLAS_STATUS_SUCCESS)
+        return false;
+
+    uint64_t                         workspace = max_workspace;
+    hipblasLtMatmulHeuristicResult_t result{};
+    int                              returned = 0;
+    bool                             found
+        = api.pref_set(
+              pref, HIPBLASLT_MATMUL_PREF_MAX_WORKSPACE_BYTES, &workspace, sizeof(workspace))
+              == HIPBLAS_STATUS_SUCCESS
+          && api.heuristic(lt,
+                           descriptors.desc,
+                           descriptors.a,
+                           descriptors.b,
+                           descriptors.c,
+                           descriptors.d,
+                           pref,
+                           1,
+                           &result,
+                           &returned)
+                 == HIPBLAS_STATUS_SUCCESS
+          && returned > 0 && result.state == HIPBLAS_STATUS_SUCCESS
+          && result.workspaceSize <= max_workspace;
+    api.pref_destroy(pref);
+
+    if(found)
+    {
+        memcpy(algo->data, result.algo.data, sizeof(algo->data));
+        algo->max_workspace_bytes = result.algo.max_workspace_bytes;
+        algo->workspace_size      = result.workspaceSize;
+    }
+    return found;
+}
+
+rocblas_status rocblas_hipblaslt_run(rocblas_handle                   handle,
+                                     const rocblas_hipblaslt_problem& prob,
+                                     const rocblas_hipblaslt_algo&    algo,
+                                     void*                            workspace)
+{
+    auto& api = rocblas_hipblaslt_get_api();
+    if(!api.loaded)
+        return rocblas_status_not_implemented;
+    hipblasLtHandle_t lt = api.get_handle(handle->getDevice());
+    if(!lt)
+        return rocblas_status_not_implemented;
+
+    rocblas_hipblaslt_descriptors descriptors(api, prob);
+    if(!descriptors.valid)
+        return rocblas_status_internal_error;
+
+    hipblasLtMatmulAlgo_t lt_algo;
+    memcpy(lt_algo.data, algo.data, sizeof(lt_algo.data));
+    lt_algo.max_workspace_bytes = algo.max_workspace_bytes;
+
+    return api.matmul(lt,
+                      descriptors.desc,
+                      prob.alpha,
+                      prob.A,
+                      descriptors.a,
+                      prob.B,
+                      descriptors.b,
+                      prob.beta,
+                      prob.C,
+                      descriptors.c,
+                      prob.D,
+                      descriptors.d,
+                      &lt_algo,
+                      workspace,
+                      algo.workspace_size,
+                      handle->get_stream())
+                   == HIPBLAS_STATUS_SUCCESS
+               ? rocblas_status_success
+               : rocblas_status_internal_error;
+}
@@ -26,6 +26,14 @@
 
 #include "handle.hpp"
 
+// Whether the running call of the handle is checked with the call sampling of check_numerics,
+// see rocblas_check_numerics_mode_sample_calls
+inline bool rocblas_check_numerics_sampled_call(rocblas_handle handle, int check_numerics)
+{
+    int shift = (check_numerics & rocblas_check_numerics_mode_sample_calls) >> 8;
+    return !(handle->call_serial & ((uint64_t(1) << shift) - 1));
+}
+
 rocblas_status rocblas_check_numerics_abnormal_struct(const char*               function_name,
                                                       const int                 check_numerics,
                                                       bool                      is_input,
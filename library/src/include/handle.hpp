@@ -26,12 +26,17 @@
 #include "rocblas.h"
 #include "rocblas_ostream.hpp"
 #include "utility.hpp"
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <hip/hip_runtime.h>
 #include <memory>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
 #ifdef WIN32
 #include <stdio.h>
 #define STDOUT_FILENO _fileno(stdout)
@@ -70,6 +75,114 @@ enum class rocblas_device_memory_ownership
     user_owned,
 };
 
+// Signature of a problem (function name, precision, dimensions, batch count and any other
+// arguments which affect it), used by the handle to memoize device workspace requirements
+struct rocblas_workspace_signature
+{
+    static constexpr size_t MAX_ARGS = 16;
+
+    std::string_view              function;
+    size_t                        num_args;
+    std::array<int64_t, MAX_ARGS> args;
+
+    template <typename... Ts>
+    explicit rocblas_workspace_signature(std::string_view function, Ts... ts)
+        : function(function)
+        , num_args(sizeof...(Ts))
+        , args{int64_t(ts)...}
+    {
+        static_assert(sizeof...(Ts) <= MAX_ARGS, "too many arguments in workspace signature");
+    }
+
+    bool operator==(const rocblas_workspace_signature& rhs) const
+    {
+        return function == rhs.function && num_args == rhs.num_args && args == rhs.args;
+    }
+};
+
+struct rocblas_workspace_signature_hash
+{
+    size_t operator()(const rocblas_workspace_signature& sig) const
+    {
+        size_t hash = std::hash<std::string_view>{}(sig.function);
+        for(size_t i = 0; i < sig.num_args; ++i)
+            hash ^= std::hash<int64_t>{}(sig.args[i]) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        return hash;
+    }
+};
+
+// Most functions whose calls are counted separately by the handles
+constexpr int ROCBLAS_API_FUNCTIONS_MAX = 2048;
+
+// Index of a function among the call counters of the handles, or -1 if more functions than
+// ROCBLAS_API_FUNCTIONS_MAX were called. Functions are told apart by the address of their name.
+int rocblas_api_function_id(const char* name);
+
+// Name of the function of an index returned by rocblas_api_function_id, or nullptr
+const char* rocblas_api_function_name(int id);
+
+inline void rocblas_count(std::atomic<uint64_t>& counter, uint64_t n = 1)
+{
+    counter.fetch_add(n, std::memory_order_relaxed);
+}
+
+// Cumulative counters of a handle, returned by rocblas_get_handle_stats. They are relaxed
+// atomics, as calls may be made with the handle from several threads.
+struct rocblas_handle_counters
+{
+    std::atomic<uint64_t> kernel_launches{0};
+    std::atomic<uint64_t> tensile_selections{0};
+    std::atomic<uint64_t> tensile_selection_ns{0};
+    std::atomic<uint64_t> solution_cache_hits{0};
+    std::atomic<uint64_t> solution_cache_misses{0};
+    std::atomic<uint64_t> workspace_allocations{0};
+    std::atomic<uint64_t> workspace_allocation_bytes{0};
+    std::atomic<uint64_t> host_syncs{0};
+    std::atomic<uint64_t> source_gemm_calls{0};
+    std::atomic<uint64_t> tensile_xf32_fallbacks{0};
+    std::atomic<uint64_t> hipblaslt_gemm_calls{0};
+    std::atomic<uint64_t> pointer_cache_hits{0};
+    std::atomic<uint64_t> pointer_cache_misses{0};
+
+    // Calls of each function by rocblas_api_function_id, and of the functions without an index
+    std::atomic<uint64_t> function_calls[ROCBLAS_API_FUNCTIONS_MAX]{};
+    std::atomic<uint64_t> other_calls{0};
+
+    void count_call(const char* name)
+    {
+        int id = rocblas_api_function_id(name);
+        rocblas_count(id < 0 ? other_calls : function_calls[id]);
+    }
+
+    void count_workspace_allocation(size_t bytes)
+    {
+        rocblas_count(workspace_allocations);
+        rocblas_count(workspace_allocation_bytes, bytes);
+    }
+
+    void get(rocblas_handle_stats& stats) const;
+    void reset();
+};
+
+// Counters of the handle of the rocBLAS function running on this thread, or nullptr
+extern thread_local rocblas_handle_counters* rocblas_current_counters;
+
+// HIP device current on this thread as rocBLAS last set or assumed it, or -1 if unknown. A
+// rocBLAS function runs on the device of its handle, which is current during the call (see
+// rocblas_api_scope) and during push_device_id, so that nested device queries and switches do
+// not call hipGetDevice again.
+extern thread_local int rocblas_current_device;
+
+// The current HIP device of this thread, by hipGetDevice only if rocblas_current_device is not
+// known
+inline hipError_t rocblas_get_current_device(int* device)
+{
+    if(rocblas_current_device < 0)
+        return hipGetDevice(device);
+    *device = rocblas_current_device;
+    return hipSuccess;
+}
+
 enum class Processor : int
 {
     // matching enum used in hipGcnArch
@@ -97,6 +210,25 @@ enum class Processor : int
     gfx1201 = 1201
 };
 
+// Level-2 kernel selection table, see rocblas_level2_threshold.hpp
+struct rocblas_level2_thresholds;
+
+// trsm strategy selection table, see rocblas_trsm_threshold.hpp
+struct rocblas_trsm_thresholds;
+
+// gemmt path selection table, see rocblas_blas_ex_threshold.hpp
+struct rocblas_gemmt_thresholds;
+
+// Binary bench log, see logging.hpp
+class rocblas_bench_binary_log;
+class rocblas_chrome_trace_log;
+
+// Pinned host staging buffers of the async matrix copies, see rocblas_auxiliary.cpp
+class rocblas_pinned_staging;
+
+// Chain of calls recorded into a graph, see rocblas_plan_begin
+struct _rocblas_plan;
+
 // helper function in handle.cpp
 static rocblas_status free_existing_device_memory(rocblas_handle);
 
@@ -104,7 +236,9 @@ static rocblas_status free_existing_device_memory(rocblas_handle);
  * \brief rocblas_handle is a structure holding the rocblas library context.
  * It must be initialized using rocblas_create_handle() and the returned handle mus
  * It should be destroyed at the end using rocblas_destroy_handle().
- * Exactly like CUBLAS, ROCBLAS only uses one stream for one API routine
+ * Exactly like CUBLAS, ROCBLAS only uses one stream for one API routine, except that
+ * independent per-batch work may be spread across auxiliary streams attached with
+ * rocblas_set_auxiliary_streams(), which are joined back to the stream before returning.
  ******************************************************************************/
 struct _rocblas_handle
 {
@@ -123,33 +257,41 @@ private:
     // clang-format off
     class [[nodiscard]] _rocblas_saved_device_id
     {
-        int device_id;
-        int old_device_id;
+        int  device_id;
+        int  old_device_id;
+        int  old_current_device;
+        bool restore = true;
 
     public:
         // Constructor
         explicit _rocblas_saved_device_id(int device_id)
             : device_id(device_id)
             , old_device_id(-1)
+            , old_current_device(rocblas_current_device)
         {
-            hipGetDevice(&old_device_id);
+            rocblas_get_current_device(&old_device_id);
             if(device_id != old_device_id)
                 hipSetDevice(device_id);
+            rocblas_current_device = device_id;
         }
 
         // Old device ID is restored on destruction
         ~_rocblas_saved_device_id()
         {
+            if(!restore)
+                return;
             if(device_id != old_device_id)
                 hipSetDevice(old_device_id);
+            rocblas_current_device = old_current_device;
         }
 
         // Move constructor
         _rocblas_saved_device_id(_rocblas_saved_device_id&& other)
             : device_id(other.device_id)
             , old_device_id(other.old_device_id)
+            , old_current_device(other.old_current_device)
         {
-            other.device_id = other.old_device_id;
+            other.restore = false;
         }
 
         _rocblas_saved_device_id(const _rocblas_saved_device_id&) = delete;
@@ -206,6 +348,10 @@ public:
     _rocblas_handle();
     ~_rocblas_handle();
 
+    // Create a handle on the same device with the configuration of src, without reading the
+    // environment or querying the device again (see rocblas_clone_handle)
+    explicit _rocblas_handle(const _rocblas_handle* src);
+
     _rocblas_handle(const _rocblas_handle&) = delete;
     _rocblas_handle& operator=(const _rocblas_handle&) = delete;
 
@@ -235,6 +381,41 @@ public:
         return archMajorMinor;
     }
 
+    // Number of compute units the kernels of the handle run on: those of the device, queried
+    // once per device, or those enabled by the CU mask of the handle
+    int getCUCount();
+
+    // Number of compute units enabled by the CU mask set with rocblas_set_cu_mask, or 0
+    int get_cu_mask_count() const
+    {
+        return cu_mask_count;
+    }
+
+    // Zeroed counters for single-pass reductions, one per batch of a launch, which the kernels
+    // reset before exiting. Allocated on first use. Returns nullptr if atomics are not allowed,
+    // batch_count exceeds the number of counters, or they cannot be allocated, in which case the
+    // two kernel reduction is used.
+    static constexpr int64_t     REDUCTION_TICKET_COUNT = 1 << 16;
+    unsigned int* ROCBLAS_EXPORT get_reduction_tickets(int64_t batch_count);
+
+    // Device memory kept by the handle for the partial results of reductions, grown to the
+    // largest requirement seen up to REDUCTION_WORKSPACE_MAX_SIZE bytes, so that consecutive
+    // reductions do not allocate. Returns nullptr if size exceeds the maximum, the device memory
+    // is not managed by rocBLAS, or the workspace cannot grow, in which case reduction_malloc
+    // takes the workspace from the device memory of the handle.
+    static constexpr size_t REDUCTION_WORKSPACE_MAX_SIZE = size_t(1) << 22;
+    void* ROCBLAS_EXPORT    get_reduction_workspace(size_t size);
+
+    // Flags of the numerics checks made with rocblas_check_numerics_mode_async, which accumulate
+    // on the device until they are reported by report_check_numerics_flags, one set for inputs
+    // and one for outputs. Allocated and zeroed on first use. Returns nullptr if they cannot be
+    // allocated, or if the stream is being captured before they are allocated.
+    rocblas_check_numerics_t* ROCBLAS_EXPORT get_check_numerics_flags(bool is_input);
+
+    // Waits for the asynchronous numerics checks, reports their flags as check_numerics requests
+    // and clears them
+    rocblas_status ROCBLAS_EXPORT report_check_numerics_flags();
+
     int getMaxSharedMemPerBlock()
     {
         int max_mem = -1;
@@ -256,9 +437,12 @@ public:
         }
     }
 
-    // hipEvent_t pointers (for internal use only)
-    hipEvent_t startEvent = nullptr;
-    hipEvent_t stopEvent  = nullptr;
+    // Events recorded on the stream at the start and the end of each rocBLAS call, see
+    // rocblas_set_start_stop_events (for internal use only). start_stop_recorded is set while
+    // the rocblas_api_scope of the outermost call records them.
+    hipEvent_t startEvent          = nullptr;
+    hipEvent_t stopEvent           = nullptr;
+    bool       start_stop_recorded = false;
 
     // default pointer_mode is on host
     rocblas_pointer_mode pointer_mode = rocblas_pointer_mode_host;
@@ -266,35 +450,150 @@ public:
     // default logging_mode is no logging
     rocblas_layer_mode layer_mode = rocblas_layer_mode_none;
 
+    // see rocblas_get_handle_stats
+    rocblas_handle_counters counters;
+
     // default atomics mode allows atomic operations
     rocblas_atomics_mode atomics_mode = rocblas_atomics_allowed;
 
+    // operands streamed with nontemporal accesses, see rocblas_set_cache_policy
+    uint32_t cache_policy = rocblas_cache_policy_default;
+
     // Selects the benchmark library to be used for solution selection
     rocblas_performance_metric performance_metric = rocblas_default_performance_metric;
 
     // default check_numerics_mode is no numeric_check
     rocblas_check_numerics_mode check_numerics = rocblas_check_numerics_mode_no_check;
 
+    // Number of rocBLAS calls of the handle which have returned, counted by rocblas_api_scope,
+    // so that it is the zero-based serial number of the running call
+    uint64_t call_serial = 0;
+
     // default math_mode is default_math
     rocblas_math_mode math_mode = rocblas_default_math;
 
+    // slices of each operand of a dgemm computed with rocblas_dgemm_ozaki_math_op
+    rocblas_int ozaki_slices = 7;
+
+    // order of the matrices of Level 2 and Level 3 functions, see rocblas_set_order
+    rocblas_order order = rocblas_order_column_major;
+
+    // Graph capture audit: paths which cannot be captured that were hit while auditing was
+    // enabled or the stream was being captured, see rocblas_get_graph_capture_audit
+    bool                     capture_audit = false;
+    std::vector<const char*> capture_audit_log;
+
+    // Host pointer mode results of reductions are copied to the host without waiting for them;
+    // completion is recorded in the host results event, see rocblas_set_async_host_results
+    bool async_host_results = false;
+
+    // Tensile-backed functions select solutions and load their code objects without launching
+    // any kernels (set on the internal handles of rocblas_gemm_ex_prefetch)
+    bool tensile_prefetch = false;
+
+    // Online autotuning of Tensile solution selection, see rocblas_set_autotune
+    rocblas_int autotune_candidates = 0;
+    float       autotune_budget_ms  = 0;
+
+    // Library running the problems of runContractionProblem, see rocblas_set_gemm_backend
+    rocblas_gemm_backend gemm_backend = rocblas_gemm_backend_tensile;
+
+    // Counter-based state of the stochastic rounding of gemm_ex3, see
+    // rocblas_set_stochastic_rounding_seed. The seeds of a call are derived from the key and the
+    // counter, which advances by one per call. An unseeded handle draws a random key on first use.
+    uint64_t stochastic_rounding_key     = 0;
+    uint64_t stochastic_rounding_counter = 0;
+    bool     stochastic_rounding_seeded  = false;
+
+    // Epilogue set with rocblas_set_gemm_epilogue. active_gemm_epilogue is only set while a
+    // gemm_ex or gemm_strided_batched_ex call applies it, so internal gemm calls ignore it.
+    rocblas_gemm_epilogue        gemm_epilogue{};
+    const rocblas_gemm_epilogue* active_gemm_epilogue = nullptr;
+
+    // Quantization scales set with rocblas_set_gemm_ex3_scales, applied by gemm_ex3
+    rocblas_gemm_ex3_scales gemm_ex3_scales{};
+
+    // Scalars of the batches set with rocblas_set_gemm_batch_scalars, active only during
+    // gemm_batched_ex and gemm_strided_batched_ex calls like the gemm epilogue
+    rocblas_gemm_batch_scalars        gemm_batch_scalars{};
+    const rocblas_gemm_batch_scalars* active_gemm_batch_scalars = nullptr;
+
+    // Epilogue set with rocblas_set_gemv_epilogue, active only during gemv and
+    // gemv_strided_batched calls like the gemm epilogue
+    rocblas_gemv_epilogue        gemv_epilogue{};
+    const rocblas_gemv_epilogue* active_gemv_epilogue = nullptr;
+
+    // Inverses of the diagonal blocks of triangular matrices registered with
+    // rocblas_set_trsm_invA, used by trsm calls solving with the same matrix
+    struct trsm_invA_entry
+    {
+        rocblas_datatype type;
+        rocblas_fill     uplo;
+        rocblas_diagonal diag;
+        rocblas_int      k;
+        const void*      A;
+        int64_t          lda;
+        const void*      invA;
+        rocblas_int      invA_size;
+    };
+    std::vector<trsm_invA_entry> trsm_invA_entries;
+
+    // Address ranges classified by rocblas_pointer_to_mode_cached and the managed memory
+    // prefetch, so that pointers into memory seen before are classified without querying the
+    // driver. Entries are replaced round robin, and cleared by rocblas_clear_pointer_cache.
+    struct pointer_range
+    {
+        uintptr_t            begin;
+        uintptr_t            end;
+        rocblas_pointer_mode mode;
+        bool                 managed;
+    };
+    static constexpr size_t                                POINTER_RANGE_CACHE_ENTRIES = 16;
+    std::array<pointer_range, POINTER_RANGE_CACHE_ENTRIES> pointer_ranges{};
+    size_t                                                 pointer_ranges_next = 0;
+
     // logging streams
     std::unique_ptr<rocblas_internal_ostream> log_trace_os;
     std::unique_ptr<rocblas_internal_ostream> log_bench_os;
     std::unique_ptr<rocblas_internal_ostream> log_profile_os;
+    std::unique_ptr<rocblas_internal_ostream> log_explain_os;
+    rocblas_bench_binary_log*                 log_bench_binary = nullptr;
+    rocblas_chrome_trace_log*                 log_chrome_trace = nullptr;
     void                                      init_logging();
+    void                                      open_log_streams();
     void                                      init_check_numerics();
 
+    // Pinned host staging buffers of the async matrix copies on the stream of the handle, see
+    // rocblas_set_pinned_staging_size
+    rocblas_pinned_staging* pinned_staging      = nullptr;
+    size_t                  pinned_staging_size = 0;
+    rocblas_status          set_pinned_staging_size(size_t size);
+
     // C interfaces for manipulating device memory
     friend rocblas_status(::rocblas_start_device_memory_size_query)(_rocblas_handle*);
     friend rocblas_status(::rocblas_stop_device_memory_size_query)(_rocblas_handle*, size_t*);
     friend rocblas_status(::rocblas_get_device_memory_size)(_rocblas_handle*, size_t*);
+    friend rocblas_status(::rocblas_get_cached_device_memory_size)(_rocblas_handle*, size_t*);
     friend rocblas_status(::rocblas_set_device_memory_size)(_rocblas_handle*, size_t);
     friend rocblas_status(::free_existing_device_memory)(rocblas_handle);
     friend rocblas_status(::rocblas_set_workspace)(_rocblas_handle*, void*, size_t);
     friend bool(::rocblas_is_managing_device_memory)(_rocblas_handle*);
     friend bool(::rocblas_is_user_managing_device_memory)(_rocblas_handle*);
+    friend rocblas_status(::rocblas_set_device_memory_pool)(_rocblas_handle*, bool);
+    friend rocblas_status(::rocblas_set_capture_workspace_reserve)(_rocblas_handle*, bool);
+    friend rocblas_status(::rocblas_set_stream_order_memory_pool)(_rocblas_handle*,
+                                                                  hipMemPool_t,
+                                                                  uint64_t);
+    friend rocblas_status(::rocblas_get_device_memory_high_water_mark)(_rocblas_handle*, size_t*);
     friend rocblas_status(::rocblas_set_stream)(_rocblas_handle*, hipStream_t);
+    friend rocblas_status(::rocblas_set_auxiliary_streams)(_rocblas_handle*,
+                                                           rocblas_int,
+                                                           const hipStream_t*);
+    friend rocblas_status(::rocblas_set_cu_mask)(_rocblas_handle*, rocblas_int, const uint32_t*);
+    friend rocblas_status(::rocblas_plan_begin)(_rocblas_handle*, size_t);
+    friend rocblas_status(::rocblas_plan_end)(_rocblas_handle*, _rocblas_plan**);
+    friend rocblas_status(::rocblas_plan_launch)(_rocblas_plan*, hipStream_t);
+    friend struct ::_rocblas_plan;
 
     // C interfaces that interact with the solution selection process
     friend rocblas_status(::rocblas_set_solution_fitness_query)(_rocblas_handle*, double*);
@@ -314,6 +613,14 @@ public:
         return (device_memory_size - device_memory_in_use);
     }
 
+    // Whether a request of size bytes can be served while device memory is in use, without
+    // having to reallocate the rocBLAS-managed device memory of the handle
+    bool device_memory_fits_while_in_use(size_t size) const
+    {
+        return size <= device_memory_size - device_memory_in_use || device_memory_pool
+               || device_memory_owner != rocblas_device_memory_ownership::rocblas_managed;
+    }
+
     // Get the solution fitness query
     auto* get_solution_fitness_query() const
     {
@@ -325,6 +632,17 @@ public:
         stream_order_alloc = flag;
     }
 
+// hipMallocAsync and hipMallocFromPoolAsync are defined in hip version 5.2.0
+// Support for default stream added in hip version 5.3.0
+#if HIP_VERSION >= 50300000
+    // Stream-ordered allocation from the handle's memory pool
+    hipError_t stream_order_malloc(void** ptr, size_t size, hipStream_t stream) const
+    {
+        return stream_order_pool ? hipMallocFromPoolAsync(ptr, size, stream_order_pool, stream)
+                                 : hipMallocAsync(ptr, size, stream);
+    }
+#endif
+
     // Sets the optimal size(s) of device memory for a kernel call
     // Maximum size is accumulated in device_memory_query_size
     // Returns rocblas_status_size_increased or rocblas_status_size_unchanged
@@ -349,12 +667,128 @@ public:
                                                 : rocblas_status_size_unchanged;
     }
 
+    // Returns the size requested by the device memory size query of a nested call, so that a
+    // function holding device memory of its own during the call can request the sum of both
+    template <typename F>
+    size_t nested_device_memory_size_query(F&& query)
+    {
+        size_t saved             = device_memory_query_size;
+        device_memory_query_size = 0;
+        query();
+        size_t size              = device_memory_query_size;
+        device_memory_query_size = saved;
+        return size;
+    }
+
+    // Returns the size a call would request as a device memory size query, outside of a query,
+    // so that a function which holds device memory of its own while it makes the call can
+    // reserve both before taking its own
+    template <typename F>
+    size_t device_memory_size_of(F&& call)
+    {
+        auto saved_query = _pushed_state<bool>(device_memory_size_query, true);
+        auto saved_size  = _pushed_state<size_t>(device_memory_query_size, 0);
+        call();
+        return device_memory_query_size;
+    }
+
+    // Look up the memoized workspace requirement of a problem seen before by this handle
+    bool get_cached_workspace_size(const rocblas_workspace_signature& sig, size_t* size) const
+    {
+        auto it = workspace_size_cache.find(sig);
+        if(it == workspace_size_cache.end())
+            return false;
+        *size = it->second;
+        return true;
+    }
+
+    // Memoize the workspace requirement of a problem, from either a size query or a real call
+    void cache_workspace_size(const rocblas_workspace_signature& sig, size_t size)
+    {
+        // Bound the cache for workloads with an unbounded number of shapes
+        if(workspace_size_cache.size() >= WORKSPACE_SIZE_CACHE_MAX_ENTRIES)
+            workspace_size_cache.clear();
+        workspace_size_cache[sig] = size;
+        workspace_size_cache_max  = std::max(workspace_size_cache_max, size);
+    }
+
     // Temporarily change pointer mode, returning object which restores old mode when destroyed
     auto push_pointer_mode(rocblas_pointer_mode mode)
     {
         return _pushed_state<rocblas_pointer_mode>(pointer_mode, mode);
     }
 
+    // The epilogue set with rocblas_set_gemm_epilogue, or nullptr if none is set
+    const rocblas_gemm_epilogue* get_gemm_epilogue() const
+    {
+        bool set = gemm_epilogue.bias_mode != rocblas_gemm_epilogue_bias_none
+                   || gemm_epilogue.activation != rocblas_gemm_epilogue_activation_none
+                   || gemm_epilogue.aux || gemm_epilogue.scale_row || gemm_epilogue.scale_column;
+        return set ? &gemm_epilogue : nullptr;
+    }
+
+    // Temporarily change the epilogue applied by gemm_ex calls
+    auto push_gemm_epilogue(const rocblas_gemm_epilogue* epilogue)
+    {
+        return _pushed_state<const rocblas_gemm_epilogue*>(active_gemm_epilogue, epilogue);
+    }
+
+    // The scalars of the batches set with rocblas_set_gemm_batch_scalars, or nullptr if none
+    const rocblas_gemm_batch_scalars* get_gemm_batch_scalars() const
+    {
+        return gemm_batch_scalars.alpha ? &gemm_batch_scalars : nullptr;
+    }
+
+    // Temporarily change the scalars of the batches of gemm_ex calls
+    auto push_gemm_batch_scalars(const rocblas_gemm_batch_scalars* scalars)
+    {
+        return _pushed_state<const rocblas_gemm_batch_scalars*>(active_gemm_batch_scalars,
+                                                                 scalars);
+    }
+
+    // The epilogue set with rocblas_set_gemv_epilogue, or nullptr if none is set
+    const rocblas_gemv_epilogue* get_gemv_epilogue() const
+    {
+        bool set = gemv_epilogue.bias || gemv_epilogue.z
+                   || gemv_epilogue.activation != rocblas_gemm_epilogue_activation_none;
+        return set ? &gemv_epilogue : nullptr;
+    }
+
+    // Temporarily change the epilogue applied by gemv calls
+    auto push_gemv_epilogue(const rocblas_gemv_epilogue* epilogue)
+    {
+        return _pushed_state<const rocblas_gemv_epilogue*>(active_gemv_epilogue, epilogue);
+    }
+
+    // The inverses registered with rocblas_set_trsm_invA for the k by k triangle of A, or nullptr
+    const trsm_invA_entry* find_trsm_invA(rocblas_datatype type,
+                                          rocblas_fill     uplo,
+                                          rocblas_diagonal diag,
+                                          int64_t          k,
+                                          const void*      A,
+                                          int64_t          lda) const
+    {
+        for(const auto& e : trsm_invA_entries)
+            if(e.A == A && e.type == type && e.uplo == uplo && e.diag == diag && e.k == k
+               && e.lda == lda)
+                return &e;
+        return nullptr;
+    }
+
+    // The range of ptr, from pointer_ranges or the driver
+    pointer_range classify_range(const void* ptr);
+
+    // Whether ptr is a device or host pointer, from pointer_ranges or the driver
+    rocblas_pointer_mode classify_pointer(const void* ptr)
+    {
+        return classify_range(ptr).mode;
+    }
+
+    // Prefetch the bytes at ptr to the device of the handle on its stream if they are managed
+    // memory, see rocblas_set_managed_prefetch
+    bool managed_prefetch = false;
+    void prefetch_managed(const void* ptr, size_t bytes);
+
     // Whether to use any_order scheduling in Tensile calls
     bool any_order = false;
 
@@ -370,6 +804,86 @@ public:
         return stream;
     }
 
+    // Waits for the current stream, counted in the host syncs of the handle
+    hipError_t synchronize_stream()
+    {
+        rocblas_count(counters.host_syncs);
+        return hipStreamSynchronize(stream);
+    }
+
+    // Priority of the stream of the handle. The streams rocBLAS creates for the work of the
+    // handle are given the same priority, and work is not spread onto lower priority auxiliary
+    // streams, so that the work of a high priority stream does not queue behind other work.
+    int get_stream_priority() const
+    {
+        int priority = 0;
+        if(hipStreamGetPriority(stream, &priority) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            return 0;
+        }
+        return priority;
+    }
+
+    // Creates a non-blocking stream with the priority of the stream of the handle
+    hipError_t create_helper_stream(hipStream_t* helper) const
+    {
+        return hipStreamCreateWithPriority(helper, hipStreamNonBlocking, get_stream_priority());
+    }
+
+    // Temporarily change the stream used by internal calls, restoring it when destroyed
+    auto push_stream(hipStream_t new_stream)
+    {
+        return _pushed_state<hipStream_t>(stream, new_stream);
+    }
+
+    // Whether auxiliary streams are attached to spread per-batch work across
+    bool has_auxiliary_streams() const
+    {
+        return !aux_streams.empty();
+    }
+
+    // Runs func(i) for each batch i, where func enqueues its work on get_stream().
+    // If auxiliary streams are attached, the batches are distributed round-robin across the
+    // handle's stream and the auxiliary streams of at least its priority, which are forked from
+    // and joined back to the handle's stream. Batches sharing the device workspace cannot run
+    // concurrently, so this only happens if each batch needs no workspace or allocations are
+    // stream ordered.
+    template <typename F>
+    rocblas_status run_batches(rocblas_int batch_count, size_t batch_workspace_size, F&& func)
+    {
+        auto   lanes_aux = get_auxiliary_lanes(); // copied, as func may change the stream
+        size_t lanes     = lanes_aux.size() + 1;
+        if(lanes == 1 || batch_count < 2 || (batch_workspace_size && !stream_order_alloc))
+        {
+            for(rocblas_int i = 0; i < batch_count; i++)
+                RETURN_IF_ROCBLAS_ERROR(func(i));
+            return rocblas_status_success;
+        }
+
+        hipStream_t main_stream = stream;
+        RETURN_IF_HIP_ERROR(hipEventRecord(aux_fork_event, main_stream));
+        for(auto j : lanes_aux)
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(aux_streams[j], aux_fork_event, 0));
+
+        rocblas_status status = rocblas_status_success;
+        for(rocblas_int i = 0; i < batch_count && status == rocblas_status_success; i++)
+        {
+            size_t      lane         = i % lanes;
+            hipStream_t lane_stream  = lane ? aux_streams[lanes_aux[lane - 1]] : main_stream;
+            auto        saved_stream = push_stream(lane_stream);
+            status                   = func(i);
+        }
+
+        // The handle's stream waits for all auxiliary streams used, even after an error
+        for(auto j : lanes_aux)
+        {
+            RETURN_IF_HIP_ERROR(hipEventRecord(aux_join_events[j], aux_streams[j]));
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(main_stream, aux_join_events[j], 0));
+        }
+        return status;
+    }
+
     bool is_stream_in_capture_mode()
     {
         hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
@@ -390,6 +904,97 @@ public:
             return true; // returns true for both hipStreamCaptureStatusActive & hipStreamCaptureStatusInvalidated
     }
 
+    // Waits for device to host copies of results into host memory. While the stream is being
+    // captured the copies become nodes of the graph and the results are written when the graph
+    // is launched, so there is nothing to wait for. With async_host_results the completion of
+    // the copies is recorded in the host results event instead of waited for.
+    rocblas_status sync_host_results()
+    {
+        if(is_stream_in_capture_mode())
+            return rocblas_status_success;
+
+        if(async_host_results)
+        {
+            hipEvent_t event;
+            RETURN_IF_ROCBLAS_ERROR(get_host_results_event(&event));
+            RETURN_IF_HIP_ERROR(hipEventRecord(event, stream));
+        }
+        else
+        {
+            RETURN_IF_HIP_ERROR(synchronize_stream());
+        }
+        return rocblas_status_success;
+    }
+
+    // Whether results copied to host memory are not read on the host before the call returns,
+    // so they have to be finalized on the device
+    bool host_results_deferred()
+    {
+        return async_host_results || is_stream_in_capture_mode();
+    }
+
+    // Event recorded after the latest copies of results to host memory with async_host_results,
+    // created on first use
+    rocblas_status ROCBLAS_EXPORT get_host_results_event(hipEvent_t* event);
+
+    // Checks a path which has to read device memory on the host before it can continue. The
+    // path is recorded in the graph capture audit if auditing is enabled or the stream is being
+    // captured. During capture rocblas_status_not_implemented is returned before anything is
+    // enqueued, so that the capture is not invalidated by a stream synchronization.
+    rocblas_status check_capturable(const char* path)
+    {
+        bool capturing = is_stream_in_capture_mode();
+        if(capture_audit || capturing)
+        {
+            auto same_path
+                = [path](const char* logged) { return std::string_view(logged) == path; };
+            if(std::none_of(capture_audit_log.begin(), capture_audit_log.end(), same_path))
+                capture_audit_log.push_back(path);
+        }
+        return capturing ? rocblas_status_not_implemented : rocblas_status_success;
+    }
+
+    // Asynchronous call group, see rocblas_group_begin. While a group is open, each outermost
+    // rocBLAS call, delimited by its rocblas_api_scope, is issued on the next group stream.
+    static constexpr rocblas_int  GROUP_DEFAULT_STREAMS = 4;
+    rocblas_status ROCBLAS_EXPORT begin_group(rocblas_int num_streams);
+    rocblas_status ROCBLAS_EXPORT end_group();
+
+    bool is_group_open() const
+    {
+        return group_size != 0;
+    }
+
+    void group_call_begin()
+    {
+        if(!group_size || group_call_depth++)
+            return;
+        stream = group_streams[group_next++ % group_size];
+    }
+
+    void group_call_end()
+    {
+        if(!group_size || --group_call_depth)
+            return;
+        if(group_call_workspace)
+        {
+            (void)hipEventRecord(group_workspace_event, stream);
+            group_call_workspace = false;
+        }
+        stream = group_main_stream;
+    }
+
+    // Called where a grouped call takes memory of the handle shared by all calls, so that the
+    // calls of a group which take it run after each other while the others run concurrently
+    void group_share_workspace()
+    {
+        if(group_call_depth && !group_call_workspace)
+        {
+            group_call_workspace = true;
+            (void)hipStreamWaitEvent(stream, group_workspace_event, 0);
+        }
+    }
+
 private:
     // device memory work buffer
     static constexpr size_t DEFAULT_DEVICE_MEMORY_SIZE          = 32 * 1024 * 1024;
@@ -400,18 +1005,145 @@ private:
     size_t                          device_memory_size         = 0;
     size_t                          device_memory_in_use       = 0;
     bool                            device_memory_size_query   = false;
+    bool                            device_memory_deferred     = false;
     bool                            alpha_beta_memcpy_complete = false;
     rocblas_device_memory_ownership device_memory_owner;
     size_t                          device_memory_query_size;
 
     bool stream_order_alloc = false;
 
+    // Memory pool used for stream-ordered allocation; nullptr selects the device's default pool
+    hipMemPool_t stream_order_pool = nullptr;
+
+    // Memoized workspace requirements, and the largest of them, which is used to pre-size
+    // device memory when it has to be reallocated
+    static constexpr size_t WORKSPACE_SIZE_CACHE_MAX_ENTRIES = 4096;
+    std::unordered_map<rocblas_workspace_signature, size_t, rocblas_workspace_signature_hash>
+           workspace_size_cache;
+    size_t workspace_size_cache_max = 0;
+
+    // Optional pool of size-classed overflow arenas. When enabled, an allocation which does not
+    // fit in device_memory while part of it is in use is served from an arena instead of failing.
+    // Idle arenas are folded back into device_memory the next time it is not in use.
+    struct device_memory_arena
+    {
+        void*  ptr;
+        size_t size;
+        bool   in_use;
+    };
+    static constexpr size_t          DEVICE_MEMORY_ARENA_MIN_SIZE = 1024 * 1024;
+    bool                             device_memory_pool           = false;
+    std::vector<device_memory_arena> device_memory_arenas;
+    size_t                           device_memory_arenas_in_use = 0;
+    size_t                           device_memory_high_water    = 0;
+
+    void* ROCBLAS_EXPORT          device_memory_pool_allocate(size_t size);
+    void ROCBLAS_EXPORT           device_memory_pool_free(void* ptr);
+    rocblas_status ROCBLAS_EXPORT device_memory_pool_release();
+
+    // With capture_workspace_reserve, rocBLAS-managed device memory is kept at least as large as
+    // the largest memoized workspace requirement, grown by reserve_capture_workspace outside of
+    // capture, and nothing is allocated while the stream is being captured, see
+    // rocblas_set_capture_workspace_reserve
+    bool                          capture_workspace_reserve = false;
+    rocblas_status ROCBLAS_EXPORT reserve_capture_workspace();
+
+    bool capture_allocation_forbidden()
+    {
+        return capture_workspace_reserve && is_stream_in_capture_mode();
+    }
+
+    // Counters used by get_reduction_tickets
+    unsigned int* reduction_tickets = nullptr;
+
+    // Workspace returned by get_reduction_workspace
+    void*  reduction_workspace      = nullptr;
+    size_t reduction_workspace_size = 0;
+
+    // Event used by get_host_results_event
+    hipEvent_t host_results_event = nullptr;
+
+    // Flags returned by get_check_numerics_flags, outputs first
+    rocblas_check_numerics_t* check_numerics_flags = nullptr;
+
+    void update_device_memory_high_water()
+    {
+        device_memory_high_water = std::max(device_memory_high_water,
+                                            device_memory_in_use + device_memory_arenas_in_use);
+    }
+
     // Solution fitness query (used for internal testing)
     double* solution_fitness_query = nullptr;
 
     // rocblas by default take the system default stream 0 users cannot create
     hipStream_t stream = 0;
 
+    // Auxiliary streams for spreading per-batch work, with the events which fork them from
+    // and join them back to stream
+    std::vector<hipStream_t> aux_streams;
+    hipEvent_t               aux_fork_event = nullptr;
+    std::vector<hipEvent_t>  aux_join_events;
+    std::vector<int>         aux_priorities;
+    rocblas_status           release_auxiliary_streams();
+
+    // Indices of the auxiliary streams of at least the priority of stream, which run_batches
+    // spreads work onto, updated when the stream changes
+    std::vector<size_t> aux_lanes;
+    hipStream_t         aux_lanes_stream = nullptr;
+    bool                aux_lanes_valid  = false;
+
+    const std::vector<size_t>& get_auxiliary_lanes()
+    {
+        if(!aux_lanes_valid || aux_lanes_stream != stream)
+        {
+            int priority = get_stream_priority();
+            aux_lanes.clear();
+            for(size_t j = 0; j < aux_streams.size(); j++)
+                if(aux_priorities[j] <= priority) // lower numbers are higher priorities
+                    aux_lanes.push_back(j);
+            aux_lanes_stream = stream;
+            aux_lanes_valid  = true;
+        }
+        return aux_lanes;
+    }
+
+    // Streams of asynchronous call groups, created by begin_group and owned by the handle. They
+    // are forked from group_main_stream when a group is opened, and joined back to it when it is
+    // closed. Calls which take shared memory of the handle wait for group_workspace_event,
+    // recorded after the last of them.
+    std::vector<hipStream_t> group_streams;
+    std::vector<hipEvent_t>  group_join_events;
+    hipEvent_t               group_fork_event      = nullptr;
+    hipEvent_t               group_workspace_event = nullptr;
+    hipStream_t              group_main_stream     = nullptr;
+    int                      group_priority        = 0;
+    size_t                   group_size            = 0;
+    size_t                   group_next            = 0;
+    int                      group_call_depth      = 0;
+    bool                     group_call_workspace  = false;
+    rocblas_status           release_group_streams();
+
+    // Level-2 kernel selection table of the device, set on first use by
+    // rocblas_level2_get_thresholds
+    const rocblas_level2_thresholds* level2_thresholds = nullptr;
+
+    // trsm strategy selection table of the device, set on first use by
+    // rocblas_trsm_get_thresholds
+    const rocblas_trsm_thresholds* trsm_thresholds = nullptr;
+
+    // gemmt path selection table of the device, set on first use by
+    // rocblas_gemmt_get_thresholds
+    const rocblas_gemmt_thresholds* gemmt_thresholds = nullptr;
+
+    // CU-masked stream created by rocblas_set_cu_mask, the stream it replaced, and the number
+    // of compute units it enables
+    hipStream_t cu_mask_stream       = nullptr;
+    hipStream_t cu_mask_saved_stream = nullptr;
+    int         cu_mask_count        = 0;
+
+    // Plan being recorded on the handle, between rocblas_plan_begin and rocblas_plan_end
+    _rocblas_plan* plan_recording = nullptr;
+
 #if ROCBLAS_REALLOC_ON_DEMAND
     // Helper for device memory allocator
     bool ROCBLAS_EXPORT device_allocator(size_t size);
@@ -437,8 +1169,8 @@ private:
         void*          dev_mem = nullptr;
         hipStream_t    stream_in_use;
         bool           success;
+        bool           from_pool = false;
 
-    private:
         std::vector<void*> pointers; // Important: must come last
 
         // Allocate one or more pointers to buffers of different sizes
@@ -462,13 +1194,15 @@ private:
                 if(!size)
                     return decltype(pointers)(sizeof...(sizes));
 
-                hipError_t hipStatus = hipMallocAsync(&dev_mem, size, stream_in_use);
+                hipError_t hipStatus
+                    = handle->stream_order_malloc(&dev_mem, size, stream_in_use);
                 if(hipStatus != hipSuccess)
                 {
                     success = false;
                     rocblas_cerr << " rocBLAS internal error: hipMallocAsync() failed to allocate memory of size : " << size << std::endl;
                     return decltype(pointers)(sizeof...(sizes));
                 }
+                handle->counters.count_workspace_allocation(size);
                 addr = static_cast<char*>(dev_mem);
 #endif
             }
@@ -476,6 +1210,13 @@ private:
             {
 #if ROCBLAS_REALLOC_ON_DEMAND
                 success = handle->device_allocator(size);
+
+                // If device memory cannot grow because it is in use, try the overflow pool
+                if(!success && handle->device_memory_pool)
+                {
+                    dev_mem = handle->device_memory_pool_allocate(size);
+                    success = from_pool = dev_mem != nullptr;
+                }
 #else
                 success = size <= handle->device_memory_size - handle->device_memory_in_use;
 #endif
@@ -485,8 +1226,15 @@ private:
                     return decltype(pointers)(sizeof...(sizes));
 
                 // We allocate the total amount needed, taking it from the available device memory.
-                addr = static_cast<char*>(handle->device_memory) + handle->device_memory_in_use;
-                handle->device_memory_in_use += size;
+                if(from_pool)
+                    addr = static_cast<char*>(dev_mem);
+                else
+                {
+                    addr = static_cast<char*>(handle->device_memory) + handle->device_memory_in_use;
+                    handle->device_memory_in_use += size;
+                }
+                handle->update_device_memory_high_water();
+                handle->group_share_workspace();
             }
             // An array of pointers to all of the allocated arrays is formed.
             // If a size is 0, the corresponding pointer is nullptr
@@ -523,7 +1271,8 @@ private:
 // hipMallocAsync and hipFreeAsync are defined in hip version 5.2.0
 // Support for default stream added in hip version 5.3.0
 #if HIP_VERSION >= 50300000
-                bool status = hipMallocAsync(&dev_mem, size, stream_in_use) == hipSuccess ;
+                bool status
+                    = handle->stream_order_malloc(&dev_mem, size, stream_in_use) == hipSuccess;
 
                 for(auto i= 0 ; i < count ; i++)
                     pointers.push_back(status ? dev_mem : nullptr);
@@ -533,16 +1282,29 @@ private:
             {
 #if ROCBLAS_REALLOC_ON_DEMAND
             success = handle->device_allocator(size);
+
+            // If device memory cannot grow because it is in use, try the overflow pool
+            if(!success && handle->device_memory_pool)
+            {
+                dev_mem = handle->device_memory_pool_allocate(size);
+                success = from_pool = dev_mem != nullptr;
+            }
 #else
             success = size <= handle->device_memory_size - handle->device_memory_in_use;
 #endif
+            char* addr = !success ? nullptr : from_pool ? static_cast<char*>(dev_mem)
+                       : static_cast<char*>(handle->device_memory) + handle->device_memory_in_use;
             for(auto i= 0 ; i < count ; i++)
-            {    pointers.push_back(success ? static_cast<char*>(handle->device_memory)
-                                         + handle->device_memory_in_use : nullptr);
+            {    pointers.push_back(addr);
             }
 
-            if(success)
+            if(success && !from_pool)
                 handle->device_memory_in_use += size;
+            if(success)
+            {
+                handle->update_device_memory_high_water();
+                handle->group_share_workspace();
+            }
             }
         }
 
@@ -560,6 +1322,7 @@ private:
             , dev_mem(other.dev_mem)
             , stream_in_use(other.stream_in_use)
             , success(other.success)
+            , from_pool(other.from_pool)
             , pointers(std::move(other.pointers))
         {
             other.success = false;
@@ -603,6 +1366,12 @@ private:
                         }
 #endif
                 }
+                else if(from_pool)
+                {
+                    // Pool arenas are independent of the LIFO device memory stack
+                    handle->device_memory_pool_free(dev_mem);
+                    dev_mem = nullptr;
+                }
                 else
                 {
                     // Subtract size from the handle's device_memory_in_use, making sure
@@ -687,6 +1456,22 @@ private:
     };
     // clang-format on
 
+    // Workspace of a reduction, from the persistent reduction workspace of the handle if it can
+    // hold size bytes, else from the device memory of the handle
+    class [[nodiscard]] _reduction_malloc final : public _device_malloc
+    {
+    public:
+        _reduction_malloc(rocblas_handle handle, void* reduction_workspace, size_t size)
+            : _device_malloc(handle, reduction_workspace ? 0 : size)
+        {
+            if(reduction_workspace)
+                pointers[0] = reduction_workspace;
+        }
+
+        // Move constructor allows initialization by rvalues and returns from functions
+        _reduction_malloc(_reduction_malloc&&) = default;
+    };
+
 public:
     // Allocate one or more sizes
     template <typename... Ss,
@@ -697,6 +1482,12 @@ public:
         return _device_malloc(this, size_t(sizes)...);
     }
 
+    // Allocate the workspace of a reduction
+    auto reduction_malloc(size_t size)
+    {
+        return _reduction_malloc(this, get_reduction_workspace(size), size);
+    }
+
     template <typename... Ss,
               std::enable_if_t<sizeof...(Ss) && conjunction<std::is_convertible<Ss, size_t>...>{},
                                int> = 0>
@@ -745,6 +1536,15 @@ public:
             return rocblas_status_size_unchanged;    \
     } while(0)
 
+// Level 2 and Level 3 functions which have no column major equivalent of the row major order,
+// see rocblas_set_order, must not compute on the transposed matrices
+#define RETURN_NOT_IMPLEMENTED_IF_ROW_MAJOR(h)     \
+    do                                             \
+    {                                              \
+        if((h)->order == rocblas_order_row_major)  \
+            return rocblas_status_not_implemented; \
+    } while(0)
+
 // Warn about potentially unsafe and synchronizing uses of hipMalloc and hipFree
 #define hipMalloc(ptr, size)                                                                     \
     _Pragma(                                                                                     \
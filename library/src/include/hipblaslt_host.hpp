@@ -0,0 +1,101 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/***************************************************************************
+ * Declaration of the rocBLAS<->hipBLASLt interface layer. hipBLASLt is    *
+ * loaded with dlopen when it is first used, so that rocBLAS neither links *
+ * nor depends on it; GEMMs which it cannot run are left to Tensile.       *
+ ***************************************************************************/
+
+#pragma once
+
+#include "handle.hpp"
+
+// A strided batched D = alpha * op(A) * op(B) + beta * C, with host alpha and beta of the
+// scale type and pointers which already include the offsets of the matrices
+struct rocblas_hipblaslt_problem
+{
+    rocblas_operation trans_a;
+    rocblas_operation trans_b;
+    int64_t           m;
+    int64_t           n;
+    int64_t           k;
+    int64_t           batch_count;
+    rocblas_datatype  a_type;
+    rocblas_datatype  b_type;
+    rocblas_datatype  c_type;
+    rocblas_datatype  scale_type;
+    const void*       alpha;
+    const void*       beta;
+    const void*       A;
+    int64_t           lda;
+    int64_t           stride_a;
+    const void*       B;
+    int64_t           ldb;
+    int64_t           stride_b;
+    const void*       C;
+    int64_t           ldc;
+    int64_t           stride_c;
+    void*             D;
+    int64_t           ldd;
+    int64_t           stride_d;
+};
+
+// The algorithm hipBLASLt selects for a problem, and the workspace it needs
+struct rocblas_hipblaslt_algo
+{
+    uint8_t data[16];
+    size_t  max_workspace_bytes;
+    size_t  workspace_size;
+};
+
+/***************************************************************************
+ * Whether hipBLASLt could be loaded. The first call tries to load it.     *
+ ***************************************************************************/
+bool rocblas_hipblaslt_available();
+
+/***************************************************************************
+ * Whether hipBLASLt supports the types of a problem, before asking it     *
+ ***************************************************************************/
+bool rocblas_hipblaslt_supports_types(rocblas_datatype a_type,
+                                      rocblas_datatype b_type,
+                                      rocblas_datatype c_type,
+                                      rocblas_datatype scale_type);
+
+/***************************************************************************
+ * Finds the algorithm of the best hipBLASLt heuristic for a problem which *
+ * needs no more than max_workspace bytes. Returns false if hipBLASLt has  *
+ * no algorithm for the problem, or if it is not available.                *
+ ***************************************************************************/
+bool rocblas_hipblaslt_find_algo(rocblas_handle                   handle,
+                                 const rocblas_hipblaslt_problem& prob,
+                                 size_t                           max_workspace,
+                                 rocblas_hipblaslt_algo*          algo);
+
+/***************************************************************************
+ * Runs a problem with an algorithm found for it on the stream of handle,  *
+ * with a workspace of at least algo.workspace_size bytes                  *
+ ***************************************************************************/
+rocblas_status rocblas_hipblaslt_run(rocblas_handle                   handle,
+                                     const rocblas_hipblaslt_problem& prob,
+                                     const rocblas_hipblaslt_algo&    algo,
+                                     void*                            workspace);
@@ -24,6 +24,7 @@
 
 #include <cstdint>
 #include <rocblas.h>
+#include <type_traits>
 
 #if defined(ROCBLAS_INTERNAL_ILP64)
 #define ROCBLAS_API(_f) _f##_64
@@ -58,6 +59,13 @@ constexpr int64_t c_i64_grid_YZ_chunk
 constexpr int64_t c_i32_max = int64_t(std::numeric_limits<int32_t>::max());
 constexpr int64_t c_i32_min = int64_t(std::numeric_limits<int32_t>::min());
 
+// batches per call of an int32 launcher, bounded by the y and z grid dimensions unless its
+// kernels take the batch in the x dimension of the grid
+constexpr int64_t rocblas_i64_batch_chunk(bool batch_in_grid_x)
+{
+    return batch_in_grid_x ? c_i32_max : c_i64_grid_YZ_chunk;
+}
+
 // int64 outer loop helpers
 
 // For device pointers (used by non-batched and _strided_batched functions)
@@ -97,3 +105,57 @@ __forceinline__ __device__ __host__ auto
 {
     return p + block;
 }
+
+// Batch windows: a device pointer (non-batched and _strided_batched functions) or device array
+// of device pointers (_batched functions) with the first batch and the number of batches of a
+// range of the batch. Kernels taking windows address their batches with 64-bit indices, so one
+// launch covers any range of batches without host pointer arithmetic.
+template <typename TPtr>
+struct rocblas_batch_window
+{
+    TPtr    p;
+    int64_t base;
+    int64_t count;
+};
+
+template <typename TPtr>
+__forceinline__ __device__ __host__ rocblas_batch_window<TPtr>
+    rocblas_make_batch_window(TPtr p, int64_t base, int64_t count)
+{
+    return {p, base, count};
+}
+
+// The window of the batches from block on
+template <typename TPtr>
+__forceinline__ __device__ __host__ rocblas_batch_window<TPtr>
+    adjust_ptr_batch(rocblas_batch_window<TPtr> w, int64_t block, rocblas_stride stride)
+{
+    return {w.p, w.base + block, w.count - block};
+}
+
+// Batch block of the window, with offset and, for device pointers, stride
+template <typename TPtr>
+__forceinline__ __device__ __host__ auto load_ptr_batch(rocblas_batch_window<TPtr> w,
+                                                        int64_t                    block,
+                                                        rocblas_stride             offset,
+                                                        rocblas_stride             stride)
+{
+    int64_t b = w.base + block;
+    if constexpr(std::is_pointer_v<std::remove_pointer_t<TPtr>>)
+        return w.p[b] + offset;
+    else
+        return w.p + b * stride + offset;
+}
+
+// Batched scalars with 64-bit batch indices, for kernels taking windows
+template <typename T>
+__forceinline__ __device__ __host__ T load_scalar_64(const T* x, int64_t idx, rocblas_stride inc)
+{
+    return x[idx * inc];
+}
+
+template <typename T>
+__forceinline__ __device__ __host__ T load_scalar_64(T x, int64_t idx, rocblas_stride inc)
+{
+    return x;
+}
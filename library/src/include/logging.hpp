@@ -24,7 +24,9 @@
 
 #include "handle.hpp"
 #include "rocblas_ostream.hpp"
+#include "roctx_ranges.hpp"
 #include "tuple_helper.hpp"
+#include <chrono>
 #include <cmath>
 #include <cstdlib>
 #include <iomanip>
@@ -35,14 +37,52 @@
 #include <mutex>
 #include <shared_mutex>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 /************************************************************************************
  * Profile kernel arguments
  ************************************************************************************/
+
+// Device time of the calls made with one set of arguments, in microseconds. The histogram counts
+// the calls by decade, from under 10us to 1s and over.
+constexpr int rocblas_profile_bins = 7;
+
+struct rocblas_profile_time
+{
+    size_t timed_count = 0;
+    double total_us    = 0;
+    double min_us      = 0;
+    double max_us      = 0;
+    size_t bins[rocblas_profile_bins]{};
+
+    void add(double us);
+};
+
+// Starts timing a call on stream, ending the previous call timed on this thread, which is all it
+// does when time is null. The time of a call runs from its start to its last kernel launch, and
+// is added to *time once its events have completed. Times are added holding
+// rocblas_profile_mutex().
+void        rocblas_profile_start(hipStream_t stream, rocblas_profile_time* time);
+std::mutex& rocblas_profile_mutex();
+
+// Waits for the calls still being timed, and adds their times
+void rocblas_profile_flush();
+
+// Floating-point operations and bytes moved by one call of the gemm functions named after their
+// precision, or false for other functions
+bool rocblas_profile_gemm_model(const char* func,
+                                int64_t     m,
+                                int64_t     n,
+                                int64_t     k,
+                                int64_t     batch_count,
+                                double&     flops,
+                                double&     bytes);
+
 template <typename TUP>
 class argument_profile
 {
@@ -52,20 +92,61 @@ class argument_profile
     // Mutex for multithreaded access to table
     mutable std::shared_timed_mutex mutex;
 
-    // Table mapping argument tuples into counts
-    // size_t is used for the map target type since atomic types are not movable, and
+    // Count and device time of the calls with one set of arguments
+    struct entry
+    {
+        size_t               count = 0;
+        rocblas_profile_time time;
+    };
+
+    // Table mapping argument tuples into counts and times
+    // size_t is used for the count since atomic types are not movable, and
     // the map elements will only be moved when we hold an exclusive lock to the map.
+    // Elements are never erased, so the times can be referred to while calls are being timed.
     std::unordered_map<TUP,
-                       size_t,
+                       entry,
                        typename tuple_helper::hash_t<TUP>,
                        typename tuple_helper::equal_t<TUP>>
         map;
 
+    // Operation and byte counts of one call, for the functions which have a model
+    static bool model(const TUP& tup, double& flops, double& bytes)
+    {
+        const char* func = nullptr;
+        int64_t     m = -1, n = -1, k = -1, batch_count = 1;
+
+        tuple_helper::apply_pairs(
+            [&](const char* name, const auto& value) {
+                using V = std::decay_t<decltype(value)>;
+                if constexpr(std::is_same_v<V, const char*>)
+                {
+                    if(!strcmp(name, "rocblas_function"))
+                        func = value;
+                }
+                else if constexpr(std::is_integral_v<V>)
+                {
+                    if(!strcmp(name, "M"))
+                        m = value;
+                    else if(!strcmp(name, "N"))
+                        n = value;
+                    else if(!strcmp(name, "K"))
+                        k = value;
+                    else if(!strcmp(name, "batch_count"))
+                        batch_count = value;
+                }
+            },
+            tup);
+
+        return func && m >= 0 && n >= 0 && k >= 0
+               && rocblas_profile_gemm_model(func, m, n, k, batch_count, flops, bytes);
+    }
+
 public:
     // A tuple of arguments is looked up in an unordered map.
     // A count of the number of calls with these arguments is kept.
     // arg is assumed to be an rvalue for efficiency
-    void operator()(TUP&& arg)
+    // The time of the entry is returned, for the call to be timed.
+    rocblas_profile_time* operator()(TUP&& arg)
     {
         { // Acquire a shared lock for reading map
             std::shared_lock<std::shared_timed_mutex> lock(mutex);
@@ -76,8 +157,8 @@ public:
             // If tuple already exists, atomically increment count and return
             if(p != map.end())
             {
-                __atomic_fetch_add(&p->second, 1, __ATOMIC_SEQ_CST);
-                return;
+                __atomic_fetch_add(&p->second.count, 1, __ATOMIC_SEQ_CST);
+                return &p->second.time;
             }
         } // Release shared lock
 
@@ -87,7 +168,9 @@ public:
             // If doesn't already exist, insert tuple by moving arg and initializing count to 0.
             // Increment the count after searching for tuple and returning old or new match.
             // We hold a lock to the map, so we don't have to increment the count atomically.
-            map.emplace(std::move(arg), 0).first->second++;
+            auto& e = map.emplace(std::move(arg), entry{}).first->second;
+            e.count++;
+            return &e.time;
         } // Release exclusive lock
     }
 
@@ -101,18 +184,56 @@ public:
     // Dump the current profile
     void dump() const
     {
-        // Acquire an exclusive lock to use map
+        // Add the times of the calls still being timed
+        rocblas_profile_flush();
+
+        // Acquire an exclusive lock to use map, and the lock of the times
         std::lock_guard<std::shared_timed_mutex> lock(mutex);
+        std::lock_guard<std::mutex>              time_lock(rocblas_profile_mutex());
+
+        static constexpr const char* bin_names[rocblas_profile_bins] = {"us_lt_10",
+                                                                        "us_lt_100",
+                                                                        "us_lt_1000",
+                                                                        "us_lt_10000",
+                                                                        "us_lt_100000",
+                                                                        "us_lt_1000000",
+                                                                        "us_ge_1000000"};
 
         // Clear the output buffer
         os.clear();
 
-        // Print all of the tuples in the map
+        // Print all of the tuples in the map, followed by their count and times
         for(const auto& p : map)
         {
+            // delim starts as "{ " and becomes ", " afterwards
+            const char* delim      = "{ ";
+            auto        print_pair = [&](const char* name, const auto& value) {
+                os << delim << std::make_pair(name, value);
+                delim = ", ";
+            };
+
             os << "- ";
-            tuple_helper::print_tuple_pairs(
-                os, std::tuple_cat(p.first, std::make_tuple("call_count", p.second)));
+            tuple_helper::apply_pairs(print_pair, p.first);
+            print_pair("call_count", p.second.count);
+
+            const rocblas_profile_time& t = p.second.time;
+            if(t.timed_count)
+            {
+                print_pair("timed_count", t.timed_count);
+                print_pair("mean_us", t.total_us / t.timed_count);
+                print_pair("min_us", t.min_us);
+                print_pair("max_us", t.max_us);
+                for(int i = 0; i < rocblas_profile_bins; i++)
+                    print_pair(bin_names[i], t.bins[i]);
+
+                double flops, bytes;
+                if(t.total_us > 0 && model(p.first, flops, bytes))
+                {
+                    print_pair("gflops", flops * t.timed_count / t.total_us * 1e-3);
+                    print_pair("gbytes_per_s", bytes * t.timed_count / t.total_us * 1e-3);
+                }
+            }
+            os << " }\n";
         }
 
         // Flush out the dump
@@ -131,13 +252,159 @@ public:
     }
 };
 
+/************************************************************************************
+ * Chrome trace log
+ ************************************************************************************/
+// With trace logging enabled and ROCBLAS_LOG_TRACE_CHROME_PATH set, the rocBLAS calls are also
+// written to a file in the JSON array format of Chrome trace events, which Perfetto and
+// chrome://tracing open. The host event of a call runs from its entry to its return, on the
+// track of its thread. With ROCBLAS_LOG_TRACE_CHROME_DEVICE set, a call also has a device event
+// on the track of its stream, between events recorded on the stream at its entry and return.
+// Device events are written once they have completed, and at the latest when their handle is
+// destroyed. Times are in microseconds since the log was opened.
+class rocblas_chrome_trace_log
+{
+    struct pending_call
+    {
+        rocblas_handle handle;
+        const char*    name;
+        int            device;
+        int            track;
+        hipEvent_t     start;
+        hipEvent_t     stop;
+    };
+
+    rocblas_internal_ostream              os;
+    std::mutex                            mutex;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    bool                                  device_events;
+
+    std::unordered_map<std::thread::id, int> threads;
+    std::unordered_map<hipStream_t, int>     streams;
+
+    // Event recorded on each device when its first device event started, with its host time
+    std::unordered_map<int, std::pair<hipEvent_t, double>> device_origins;
+
+    std::vector<pending_call> pending;
+    std::vector<hipEvent_t>   pool;
+
+    rocblas_chrome_trace_log(const char* path, bool device_events);
+
+    double     now_us() const;
+    hipEvent_t get_event();
+    int        thread_track();
+    int        stream_track(int device, hipStream_t stream);
+    void       complete(bool wait, rocblas_handle handle);
+
+public:
+    // Host start time and start event of a call
+    struct call
+    {
+        double     start_us = 0;
+        hipEvent_t start    = nullptr;
+    };
+
+    // Opens the log at path when it is set; the log is shared by all handles, and opened once
+    static rocblas_chrome_trace_log* open(const char* path, bool device_events);
+
+    void begin(rocblas_handle handle, call& c);
+    void end(rocblas_handle handle, const char* name, call& c);
+
+    // Writes the device events of the handle, waiting for them
+    void flush(rocblas_handle handle);
+};
+
+/************************************************************************************
+ * Scope of a rocBLAS function
+ ************************************************************************************/
+// Declared by each rocBLAS function where it reads the layer mode of the handle. It counts
+// the call in the stats of the handle, makes the kernels launched by the function count in
+// them too, records the start and stop events of the handle around the function, pops the
+// roctx range pushed by log_profile when the function returns, records the call in the Chrome
+// trace log, and then advances the call serial used by the sampled numerics checks. Within an
+// asynchronous call group the outermost function runs on the next group stream.
+class rocblas_api_scope
+{
+    rocblas_handle                 handle;
+    const char*                    name;
+    rocblas_handle_counters*       saved_counters;
+    std::atomic<uint64_t>*         saved_launch_counter;
+    int                            saved_device;
+    int                            roctx_depth       = -1;
+    bool                           record_start_stop = false;
+    rocblas_chrome_trace_log::call chrome_call;
+
+public:
+    rocblas_api_scope(rocblas_handle handle, const char* name)
+        : handle(handle)
+        , name(name)
+        , saved_counters(rocblas_current_counters)
+        , saved_launch_counter(rocblas_launch_counter)
+        , saved_device(rocblas_current_device)
+    {
+        // the device of the handle is current for the call
+        rocblas_current_device = handle->getDevice();
+        handle->group_call_begin();
+        handle->counters.count_call(name);
+        rocblas_current_counters = &handle->counters;
+        rocblas_launch_counter   = &handle->counters.kernel_launches;
+        if(handle->layer_mode & rocblas_layer_mode_roctx)
+            roctx_depth = rocblas_roctx_depth;
+        if(handle->log_chrome_trace)
+            handle->log_chrome_trace->begin(handle, chrome_call);
+
+        // Only the outermost call of the handle records its events, and size queries launch
+        // nothing to time
+        if((handle->startEvent || handle->stopEvent) && !handle->start_stop_recorded
+           && !handle->is_device_memory_size_query())
+        {
+            record_start_stop           = true;
+            handle->start_stop_recorded = true;
+            if(handle->startEvent)
+                (void)hipEventRecord(handle->startEvent, handle->get_stream());
+        }
+    }
+
+    ~rocblas_api_scope()
+    {
+        if(record_start_stop)
+        {
+            if(handle->stopEvent)
+                (void)hipEventRecord(handle->stopEvent, handle->get_stream());
+            handle->start_stop_recorded = false;
+        }
+        rocblas_current_counters = saved_counters;
+        rocblas_launch_counter   = saved_launch_counter;
+        rocblas_current_device   = saved_device;
+        if(roctx_depth >= 0)
+            while(rocblas_roctx_depth > roctx_depth)
+                rocblas_roctx_pop();
+        if(handle->log_chrome_trace)
+            handle->log_chrome_trace->end(handle, name, chrome_call);
+        handle->call_serial++;
+        handle->group_call_end();
+    }
+
+    rocblas_api_scope(const rocblas_api_scope&)            = delete;
+    rocblas_api_scope& operator=(const rocblas_api_scope&) = delete;
+};
+
 // if profile logging is turned on with
 // (handle->layer_mode & rocblas_layer_mode_log_profile) != 0
 // log_profile will call argument_profile to profile actual arguments,
 // keeping count of the number of times each set of arguments is used
+// and timing the kernels launched on the stream of the handle by each call.
+// With (handle->layer_mode & rocblas_layer_mode_roctx) != 0 it pushes the
+// roctx range of the call, named with the same arguments.
 template <typename... Ts>
 void log_profile(rocblas_handle handle, const char* func, Ts&&... xs)
 {
+    if(handle->layer_mode & rocblas_layer_mode_roctx)
+        rocblas_roctx_push(rocblas_roctx_name(func, xs...).c_str());
+
+    if(!(handle->layer_mode & rocblas_layer_mode_log_profile))
+        return;
+
     // Make a tuple with the arguments
     auto tup = std::make_tuple(
         "rocblas_function", func, "atomics_mode", handle->atomics_mode, std::forward<Ts>(xs)...);
@@ -148,8 +415,10 @@ void log_profile(rocblas_handle handle, const char* func, Ts&&... xs)
     // Add at_quick_exit handler in case the program exits early
     static int aqe = at_quick_exit([] { profile.~argument_profile(); });
 
-    // Profile the tuple
-    profile(std::move(tup));
+    // Profile the tuple, timing the call unless it is captured in a graph
+    rocblas_profile_time* time = profile(std::move(tup));
+    rocblas_profile_start(handle->get_stream(),
+                          handle->is_stream_in_capture_mode() ? nullptr : time);
 }
 
 /********************************************
@@ -167,22 +436,141 @@ void log_arguments(rocblas_internal_ostream& os, const char* sep, H&& head, Ts&&
 
 // if trace logging is turned on with
 // (handle->layer_mode & rocblas_layer_mode_log_trace) != 0
-// log_function will call log_arguments to log arguments with a comma separator
+// log_trace will queue the arguments to be logged with a comma separator,
+// they are formatted by the worker thread of the log file
 template <typename... Ts>
 void log_trace(rocblas_handle handle, Ts&&... xs)
 {
-    log_arguments(*handle->log_trace_os, ",", std::forward<Ts>(xs)..., handle->atomics_mode);
+    handle->log_trace_os->log_line(",", std::forward<Ts>(xs)..., handle->atomics_mode);
 }
 
+/************************************************************************************
+ * Binary bench log
+ ************************************************************************************/
+
+// When ROCBLAS_LOG_BENCH_BINARY_PATH names a file, bench logging writes a compact binary record
+// of the rocblas-bench arguments of each call, with the time, thread, handle, stream and pointer
+// mode of the call, instead of the command lines. clients/benchmarks/bench_replay decodes the
+// file into rocblas-bench YAML and replays it.
+//
+// The file starts with the 8 bytes "RBBENCH1", followed by records in native byte order:
+//   string: uint8 1, uint32 id, uint32 length, characters
+//   call:   uint8 2, uint64 nanoseconds since the log was opened, uint64 thread, uint64 handle,
+//           uint64 stream, uint8 pointer mode, uint16 argument count, arguments
+// Each argument is a uint8 tag followed by its value:
+//   int64 (0), uint64 (1), double (2), char (3), uint32 id of a string record (4),
+//   or uint32 length and characters of text (5)
+// String records are written before the first call using them. Arguments which are not numbers
+// or strings are stored as the text rocblas_internal_ostream formats them to.
+class rocblas_bench_binary_log
+{
+    enum : uint8_t
+    {
+        record_string = 1,
+        record_call   = 2,
+    };
+
+    enum : uint8_t
+    {
+        tag_int64  = 0,
+        tag_uint64 = 1,
+        tag_double = 2,
+        tag_char   = 3,
+        tag_string = 4,
+        tag_text   = 5,
+    };
+
+    rocblas_internal_ostream                  os;
+    std::mutex                                mutex;
+    std::unordered_map<std::string, uint32_t> strings;
+    std::chrono::steady_clock::time_point     start = std::chrono::steady_clock::now();
+
+    // Records of the call being logged, and of the strings it uses first
+    std::string record;
+    std::string new_strings;
+
+    explicit rocblas_bench_binary_log(const char* path);
+
+    template <typename T>
+    void put_raw(std::string& buffer, T x)
+    {
+        buffer.append(reinterpret_cast<const char*>(&x), sizeof(x));
+    }
+
+    void put_string(const char* s);
+    void put_text(const std::string& s);
+    void begin(rocblas_handle handle, size_t count);
+    void end();
+
+    template <typename T>
+    void put(const T& x)
+    {
+        if constexpr(std::is_same_v<T, char>)
+        {
+            put_raw(record, tag_char);
+            put_raw(record, x);
+        }
+        else if constexpr(std::is_integral_v<T> && std::is_signed_v<T>)
+        {
+            put_raw(record, tag_int64);
+            put_raw(record, int64_t(x));
+        }
+        else if constexpr(std::is_integral_v<T>)
+        {
+            put_raw(record, tag_uint64);
+            put_raw(record, uint64_t(x));
+        }
+        else if constexpr(std::is_floating_point_v<T>)
+        {
+            put_raw(record, tag_double);
+            put_raw(record, double(x));
+        }
+        else if constexpr(std::is_same_v<T, const char*> || std::is_same_v<T, char*>)
+            put_string(x);
+        else if constexpr(std::is_same_v<T, std::string>)
+            put_text(x);
+        else
+        {
+            rocblas_internal_ostream text;
+            text << x;
+            put_text(text.str());
+        }
+    }
+
+public:
+    // Opens the log at path when it is set; the log is shared by all handles, and opened once
+    static rocblas_bench_binary_log* open(const char* path);
+
+    template <typename... Ts>
+    void log(rocblas_handle handle, Ts&&... xs)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        begin(handle, sizeof...(xs));
+        (put<std::decay_t<Ts>>(xs), ...);
+        end();
+    }
+};
+
 // if bench logging is turned on with
 // (handle->layer_mode & rocblas_layer_mode_log_bench) != 0
 // log_bench will call log_arguments to log a string that
-// can be input to the executable rocblas-bench.
+// can be input to the executable rocblas-bench,
+// or record the arguments in the binary bench log
 template <typename... Ts>
 void log_bench(rocblas_handle handle, Ts&&... xs)
 {
-    if(handle->atomics_mode == rocblas_atomics_not_allowed)
-        log_arguments(*handle->log_bench_os, " ", std::forward<Ts>(xs)..., "--atomics_not_allowed");
+    const char* atomics = handle->atomics_mode == rocblas_atomics_not_allowed
+                              ? "--atomics_not_allowed"
+                              : "--atomics_deterministic";
+    if(handle->log_bench_binary)
+    {
+        if(handle->atomics_mode != rocblas_atomics_allowed)
+            handle->log_bench_binary->log(handle, std::forward<Ts>(xs)..., atomics);
+        else
+            handle->log_bench_binary->log(handle, std::forward<Ts>(xs)...);
+    }
+    else if(handle->atomics_mode != rocblas_atomics_allowed)
+        log_arguments(*handle->log_bench_os, " ", std::forward<Ts>(xs)..., atomics);
     else
         log_arguments(*handle->log_bench_os, " ", std::forward<Ts>(xs)...);
 }
@@ -216,9 +604,15 @@ std::string log_trace_scalar_value(rocblas_handle handle, const T* value)
     T                        host;
     if(value && handle->pointer_mode == rocblas_pointer_mode_device)
     {
-        hipMemcpyAsync(&host, value, sizeof(host), hipMemcpyDeviceToHost, handle->get_stream());
-        hipStreamSynchronize(handle->get_stream());
-        value = &host;
+        // Device scalars are logged as NaN during graph capture, which cannot synchronize
+        if(handle->is_stream_in_capture_mode())
+            value = nullptr;
+        else
+        {
+            hipMemcpyAsync(&host, value, sizeof(host), hipMemcpyDeviceToHost, handle->get_stream());
+            handle->synchronize_stream();
+            value = &host;
+        }
     }
     os << log_trace_scalar_value(value);
     return os.str();
@@ -261,9 +655,15 @@ std::string log_bench_scalar_value(rocblas_handle handle, const char* name, cons
     T host;
     if(value && handle->pointer_mode == rocblas_pointer_mode_device)
     {
-        hipMemcpyAsync(&host, value, sizeof(host), hipMemcpyDeviceToHost, handle->get_stream());
-        hipStreamSynchronize(handle->get_stream());
-        value = &host;
+        // Device scalars are logged as NaN during graph capture, which cannot synchronize
+        if(handle->is_stream_in_capture_mode())
+            value = nullptr;
+        else
+        {
+            hipMemcpyAsync(&host, value, sizeof(host), hipMemcpyDeviceToHost, handle->get_stream());
+            handle->synchronize_stream();
+            value = &host;
+        }
     }
     return log_bench_scalar_value(name, value);
 }
@@ -44,6 +44,8 @@
 #define ROCBLAS_KERNEL_ILF __device__ __attribute__((always_inline))
 
 // we ignore pre-existing hipGetLastError as all internal hip calls should be guarded and so an external error
+// while profile logging times a call, the stop event of the call is recorded after each launch,
+// and the launch is counted in the stats of the handle
 #define ROCBLAS_LAUNCH_KERNEL(...)                                                 \
     do                                                                             \
     {                                                                              \
@@ -52,6 +54,10 @@
         hipError_t status = hipPeekAtLastError();                                  \
         if(status != hipSuccess && status != pre_status)                           \
             return rocblas_internal_convert_hip_to_rocblas_status_and_log(status); \
+        if(rocblas_profile_timing)                                                 \
+            rocblas_profile_launched();                                            \
+        if(rocblas_launch_counter)                                                 \
+            rocblas_launch_counter->fetch_add(1, std::memory_order_relaxed);       \
     } while(0)
 
 #define ROCBLAS_LAUNCH_KERNEL_GRID(grid_, ...)                                         \
@@ -64,5 +70,9 @@
             hipError_t status = hipPeekAtLastError();                                  \
             if(status != hipSuccess && status != pre_status)                           \
                 return rocblas_internal_convert_hip_to_rocblas_status_and_log(status); \
+            if(rocblas_profile_timing)                                                 \
+                rocblas_profile_launched();                                            \
+            if(rocblas_launch_counter)                                                 \
+                rocblas_launch_counter->fetch_add(1, std::memory_order_relaxed);       \
         }                                                                              \
     } while(0)
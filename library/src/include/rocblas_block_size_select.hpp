@@ -0,0 +1,109 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include "rocblas_block_sizes.h"
+
+#include <type_traits>
+
+// Source kernels whose block size is chosen per launch instead of fixed at compile time
+enum class rocblas_block_size_routine
+{
+    axpy,
+    scal,
+};
+
+// Smallest block size instantiated for the routines above. The launchers are instantiated
+// for ROCBLAS_RUNTIME_NB_MIN, twice and four times that; the selection below only halves.
+#define ROCBLAS_RUNTIME_NB_MIN 128
+#define ROCBLAS_RUNTIME_NB_MAX 512
+
+// Blocks per compute unit below which a smaller block size is used to spread the grid
+#define ROCBLAS_RUNTIME_NB_MIN_BLOCKS_PER_CU 4
+
+struct rocblas_block_size_entry
+{
+    rocblas_block_size_routine routine;
+    int                        arch_major; // 0 matches any architecture
+    int                        nb; // block size for problems that fill the device
+};
+
+// Tuned block sizes, the first entry matching the routine and architecture is used.
+// wave64 parts with many compute units stream large vectors faster with 512 threads.
+constexpr rocblas_block_size_entry rocblas_block_size_table[] = {
+    {rocblas_block_size_routine::axpy, 9, 512},
+    {rocblas_block_size_routine::axpy, 0, ROCBLAS_AXPY_NB},
+    {rocblas_block_size_routine::scal, 9, 512},
+    {rocblas_block_size_routine::scal, 0, ROCBLAS_SCAL_NB},
+};
+
+static_assert(ROCBLAS_AXPY_NB >= ROCBLAS_RUNTIME_NB_MIN && ROCBLAS_AXPY_NB <= ROCBLAS_RUNTIME_NB_MAX
+                  && ROCBLAS_SCAL_NB >= ROCBLAS_RUNTIME_NB_MIN
+                  && ROCBLAS_SCAL_NB <= ROCBLAS_RUNTIME_NB_MAX,
+              "default block sizes must be among the runtime-selected block sizes");
+
+/*! \brief Returns the block size to launch the source kernel of routine with for n elements.
+ *         The tuned size of the architecture is halved while the grid would give fewer than
+ *         ROCBLAS_RUNTIME_NB_MIN_BLOCKS_PER_CU blocks to each compute unit of the handle.
+ */
+inline int rocblas_select_block_size(rocblas_handle             handle,
+                                     rocblas_block_size_routine routine,
+                                     int64_t                    n)
+{
+    int nb         = ROCBLAS_RUNTIME_NB_MIN;
+    int arch_major = handle->getArchMajor();
+    for(const auto& entry : rocblas_block_size_table)
+    {
+        if(entry.routine == routine && (!entry.arch_major || entry.arch_major == arch_major))
+        {
+            nb = entry.nb;
+            break;
+        }
+    }
+
+    int64_t min_blocks = int64_t(handle->getCUCount()) * ROCBLAS_RUNTIME_NB_MIN_BLOCKS_PER_CU;
+    while(nb > ROCBLAS_RUNTIME_NB_MIN && (n - 1) / nb + 1 < min_blocks)
+        nb /= 2;
+
+    return nb;
+}
+
+/*! \brief Calls launch with std::integral_constant<int, NB> for the instantiated block size
+ *         matching nb so the launcher can take it as a template argument, NB_DEFAULT otherwise.
+ */
+template <int NB_DEFAULT, typename F>
+inline rocblas_status rocblas_dispatch_block_size(int nb, F&& launch)
+{
+    switch(nb)
+    {
+    case ROCBLAS_RUNTIME_NB_MIN:
+        return launch(std::integral_constant<int, ROCBLAS_RUNTIME_NB_MIN>{});
+    case ROCBLAS_RUNTIME_NB_MIN * 2:
+        return launch(std::integral_constant<int, ROCBLAS_RUNTIME_NB_MIN * 2>{});
+    case ROCBLAS_RUNTIME_NB_MAX:
+        return launch(std::integral_constant<int, ROCBLAS_RUNTIME_NB_MAX>{});
+    default:
+        return launch(std::integral_constant<int, NB_DEFAULT>{});
+    }
+}
@@ -24,9 +24,11 @@
 
 #include "rocblas.h"
 #include "utility.hpp"
+#include <atomic>
 #include <cmath>
 #include <complex>
 #include <condition_variable>
+#include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
@@ -41,6 +43,7 @@
 #include <string>
 #include <sys/stat.h>
 #include <thread>
+#include <tuple>
 #include <utility>
 #ifdef WIN32
 #include <io.h>
@@ -79,37 +82,22 @@ class ROCBLAS_INTERNAL_EXPORT rocblas_internal_ostream
      **************************************************************************/
     class worker
     {
-        // task_t represents a payload of data and a promise to finish
-        class task_t
-        {
-            std::string        m_str;
-            std::promise<void> m_promise;
-
-        public:
-            // The task takes ownership of the string payload and promise
-            task_t(std::string&& str, std::promise<void>&& promise)
-                : m_str(std::move(str))
-                , m_promise(std::move(promise))
-            {
-            }
+        // A record in the queue of the worker holds either the arguments of a line, which the
+        // worker thread formats, or a string. format writes the line or the string to os and
+        // destroys what the record holds. Records with a promise are waited for by the caller,
+        // and a record with exit set makes the worker thread exit.
+        static constexpr size_t record_bytes = 512;
+        static constexpr size_t queue_size   = 1024;
 
-            // Notify the future to wake up
-            void set_value()
-            {
-                m_promise.set_value();
-            }
+        using format_t = void (*)(void* data, rocblas_internal_ostream& os);
 
-            // Size of the string payload
-            size_t size() const
-            {
-                return m_str.size();
-            }
-
-            // Data of the string payload
-            const char* data() const
-            {
-                return m_str.data();
-            }
+        struct record
+        {
+            std::atomic<size_t> seq;
+            format_t            format;
+            std::promise<void>* done;
+            bool                exit;
+            alignas(std::max_align_t) unsigned char data[record_bytes];
         };
 
         // FILE is used for safety in the presence of signals
@@ -118,25 +106,96 @@ class ROCBLAS_INTERNAL_EXPORT rocblas_internal_ostream
         // This worker's thread
         std::thread m_thread;
 
-        // Condition variable for worker notification
+        // Bounded queue of records, written by any thread and read by the worker thread without
+        // locking. The record at position pos is free when its seq is pos, and holds data for
+        // the worker thread when its seq is pos + 1.
+        std::unique_ptr<record[]> m_queue;
+
+        // Next position claimed by a writer, and next position read by the worker thread
+        std::atomic<size_t> m_tail{0};
+        size_t              m_head = 0;
+
+        // The worker thread waits on the condition variable while the queue is empty, and
+        // writers only lock the mutex to wake it up
+        std::atomic<bool>       m_sleeping{false};
         std::condition_variable m_cond;
+        std::mutex              m_mutex;
 
-        // Mutex for this thread's queue
-        std::mutex m_mutex;
+        // Claim the record at the next position, waiting while the queue is full
+        record& claim(size_t& pos);
 
-        // Queue of tasks
-        std::queue<task_t> m_queue;
+        // Hand the claimed record at pos to the worker thread
+        void publish(record& r, size_t pos);
 
-        // Worker thread which waits for and handles tasks sequentially
+        // Hand the claimed record at pos to the worker thread and wait until it is written
+        void publish_and_wait(record& r, size_t pos);
+
+        static void format_string(void* data, rocblas_internal_ostream& os);
+
+        template <typename ARGS>
+        static void format_line(void* data, rocblas_internal_ostream& os)
+        {
+            auto& args = *static_cast<ARGS*>(data);
+            write_line(args, os);
+            args.~ARGS();
+        }
+
+        // Worker thread which waits for and handles records sequentially
         void thread_function();
 
     public:
         // Worker constructor creates a worker thread for a raw filehandle
         explicit worker(int fd);
 
-        // Send a string to be written
+        // Send a string to be written, waiting until it has been written
+        // Empty strings tell the worker thread to exit
         void send(std::string);
 
+        // Wait until the records queued so far have been written
+        void drain();
+
+        // Queue a string to be written, without waiting
+        void post_string(std::string&& str);
+
+        // Write a line of the values of the tuple (sep, x1, x2, ...) separated by sep
+        template <typename ARGS>
+        static void write_line(const ARGS& args, rocblas_internal_ostream& os)
+        {
+            std::apply(
+                [&](const char* sep, const auto& head, const auto&... xs) {
+                    os << head;
+                    ((os << sep << xs), ...);
+                    os << '\n';
+                },
+                args);
+        }
+
+        // Queue a line of the arguments separated by sep, without waiting. The arguments are
+        // copied into the record and formatted by the worker thread, so const char* arguments
+        // must be static strings. Lines too large for a record are formatted here.
+        template <typename... Ts>
+        void post(const char* sep, Ts&&... xs)
+        {
+            using args_t = std::tuple<const char*, std::decay_t<Ts>...>;
+
+            args_t args(sep, std::forward<Ts>(xs)...);
+            if constexpr(sizeof(args_t) <= record_bytes
+                         && alignof(args_t) <= alignof(std::max_align_t))
+            {
+                size_t  pos;
+                record& r = claim(pos);
+                new(r.data) args_t(std::move(args));
+                r.format = format_line<args_t>;
+                publish(r, pos);
+            }
+            else
+            {
+                rocblas_internal_ostream os;
+                write_line(args, os);
+                post_string(os.str());
+            }
+        }
+
         // Destroy a worker when all std::shared_ptr references to it are gone
         ~worker();
     };
@@ -160,10 +219,21 @@ class ROCBLAS_INTERNAL_EXPORT rocblas_internal_ostream
     };
 
     // Map from file_id to a worker shared_ptr
+    // Workers which are still referenced when the map is destroyed write out their queue
+    struct worker_map_t : std::map<file_id_t, std::shared_ptr<worker>, file_id_less>
+    {
+        ~worker_map_t()
+        {
+            for(auto& p : *this)
+                if(p.second && p.second.use_count() > 1)
+                    p.second->drain();
+        }
+    };
+
     // Implemented as singleton to avoid the static initialization order fiasco
     static auto& worker_map()
     {
-        static std::map<file_id_t, std::shared_ptr<worker>, file_id_less> file_id_to_worker_map;
+        static worker_map_t file_id_to_worker_map;
         return file_id_to_worker_map;
     }
 
@@ -249,6 +319,36 @@ public:
     // Flush the output
     void flush();
 
+    // Queue data to be written as it is, without waiting, on streams with a worker
+    void post(std::string&& data)
+    {
+        if(m_worker_ptr)
+        {
+            if(m_os.tellp() > 0)
+                flush();
+            m_worker_ptr->post_string(std::move(data));
+        }
+        else
+            m_os.write(data.data(), data.size());
+    }
+
+    // Write a line of the arguments separated by sep. Streams with a worker queue the arguments
+    // to be formatted by the worker thread, without waiting, so const char* arguments must be
+    // static strings.
+    template <typename... Ts>
+    void log_line(const char* sep, Ts&&... xs)
+    {
+        if(m_worker_ptr)
+        {
+            // Anything already buffered is written first
+            if(m_os.tellp() > 0)
+                flush();
+            m_worker_ptr->post(sep, std::forward<Ts>(xs)...);
+        }
+        else
+            worker::write_line(std::forward_as_tuple(sep, xs...), *this);
+    }
+
     // csv friendly output set true
     void set_csv(bool flag)
     {
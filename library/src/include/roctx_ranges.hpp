@@ -0,0 +1,90 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include "rocblas_ostream.hpp"
+#include <string>
+
+/************************************************************************************
+ * roctx ranges
+ *
+ * With (handle->layer_mode & rocblas_layer_mode_roctx) != 0, each rocBLAS function
+ * pushes a roctx range named with the arguments it passes to log_profile, which its
+ * rocblas_api_scope pops when it returns, and the internal phases it runs push ranges
+ * of their own, so that profilers such as rocprof and omnitrace show which call and
+ * phase launched each kernel. libroctx64 is loaded when the first range is pushed;
+ * without it no ranges are pushed.
+ ************************************************************************************/
+
+// Number of ranges pushed on this thread and not popped yet
+extern thread_local int rocblas_roctx_depth;
+
+// Return whether the range was pushed
+bool rocblas_roctx_push(const char* name);
+void rocblas_roctx_pop();
+
+// Name of a range, the name followed by its arguments as "name key=value, key=value"
+template <typename... Ts>
+std::string rocblas_roctx_name(const char* name, Ts&&... xs)
+{
+    rocblas_internal_ostream os;
+    os << name;
+    if constexpr(sizeof...(Ts) > 0)
+    {
+        int i = 0;
+        ((os << (i++ ? (i % 2 ? ", " : "=") : " ") << std::forward<Ts>(xs)), ...);
+    }
+    return os.str();
+}
+
+// Range of an internal phase of a rocBLAS function, such as trtri, gemm, a reduction, the
+// numerics check or the Tensile solution selection, which ends when it is destroyed or ended
+class rocblas_roctx_phase
+{
+    bool pushed = false;
+
+public:
+    template <typename... Ts>
+    rocblas_roctx_phase(rocblas_handle handle, const char* name, Ts&&... xs)
+    {
+        if(handle->layer_mode & rocblas_layer_mode_roctx)
+            pushed = rocblas_roctx_push(
+                rocblas_roctx_name(name, std::forward<Ts>(xs)...).c_str());
+    }
+
+    void end()
+    {
+        if(pushed)
+            rocblas_roctx_pop();
+        pushed = false;
+    }
+
+    ~rocblas_roctx_phase()
+    {
+        end();
+    }
+
+    rocblas_roctx_phase(const rocblas_roctx_phase&)            = delete;
+    rocblas_roctx_phase& operator=(const rocblas_roctx_phase&) = delete;
+};
@@ -118,32 +118,32 @@ struct RocblasContractionProblem
     RocblasContractionProblem(rocblas_handle     handle,
                               rocblas_operation  trans_a,
                               rocblas_operation  trans_b,
-                              rocblas_int        m,
-                              rocblas_int        n,
-                              rocblas_int        k,
+                              int64_t            m,
+                              int64_t            n,
+                              int64_t            k,
                               const Tc*          alpha,
                               const TiA*         A,
                               const TiA* const*  batch_A,
-                              rocblas_int        ld_a,
+                              int64_t            ld_a,
                               rocblas_stride     batch_stride_a,
                               rocblas_stride     offset_a,
                               const TiB*         B,
                               const TiB* const*  batch_B,
-                              rocblas_int        ld_b,
+                              int64_t            ld_b,
                               rocblas_stride     batch_stride_b,
                               rocblas_stride     offset_b,
                               const Tc*          beta,
                               const To*          C,
                               const To* const*   batch_C,
-                              rocblas_int        ld_c,
+                              int64_t            ld_c,
                               rocblas_stride     batch_stride_c,
                               rocblas_stride     offset_c,
                               To*                D,
                               To* const*         batch_D,
-                              rocblas_int        ld_d,
+                              int64_t            ld_d,
                               rocblas_stride     batch_stride_d,
                               rocblas_stride     offset_d,
-                              rocblas_int        batch_count,
+                              int64_t            batch_count,
                               bool               strided_batch,
                               rocblas_gemm_flags flags)
         : handle(handle)
@@ -24,12 +24,14 @@
 
 #include "definitions.hpp"
 #include "rocblas.h"
+#include <atomic>
 #include <cmath>
 #include <complex>
 #include <exception>
 #include <hip/hip_runtime.h>
 #include <new>
 #include <type_traits>
+#include <utility>
 
 #pragma STDC CX_LIMITED_RANGE ON
 
@@ -183,6 +185,114 @@ __forceinline__ __device__ __host__ T*
 }
 // clang-format on
 
+// Element type of the vectors of a non-batched, strided batched or batched pointer argument
+template <typename TPtr>
+using rocblas_batch_elem_t = std::remove_cv_t<
+    std::remove_pointer_t<decltype(load_ptr_batch(std::declval<TPtr>(), 0, 0, 0))>>;
+
+// Number of elements of T in a 16 byte global memory access, 1 if T does not divide 16 bytes
+template <typename T>
+constexpr int rocblas_wide_elements = sizeof(T) < 16 && 16 % sizeof(T) == 0 ? 16 / sizeof(T) : 1;
+
+// 16 byte vector of T, loaded and stored with a single wide memory instruction
+template <typename T>
+struct alignas(16) rocblas_wide_t
+{
+    T val[rocblas_wide_elements<T>];
+};
+
+template <typename T>
+__forceinline__ __device__ bool rocblas_is_wide_aligned(const T* p)
+{
+    return reinterpret_cast<uintptr_t>(p) % sizeof(rocblas_wide_t<T>) == 0;
+}
+
+// Bytes of the words T is moved in by nontemporal loads and stores, 0 if T has no such words
+template <typename T>
+constexpr int rocblas_nontemporal_word_bytes
+    = alignof(T) >= 16 && sizeof(T) % 16 == 0 ? 16
+      : alignof(T) >= 8 && sizeof(T) % 8 == 0 ? 8
+      : alignof(T) >= 4 && sizeof(T) % 4 == 0 ? 4
+                                              : 0;
+
+template <int BYTES>
+struct rocblas_nontemporal_word;
+
+template <>
+struct rocblas_nontemporal_word<16>
+{
+    using type = int32_t __attribute__((ext_vector_type(4)));
+};
+
+template <>
+struct rocblas_nontemporal_word<8>
+{
+    using type = int64_t;
+};
+
+template <>
+struct rocblas_nontemporal_word<4>
+{
+    using type = int32_t;
+};
+
+//! @brief Loads *p, with a nontemporal load bypassing the caches when streaming is set, see
+//! rocblas_set_cache_policy. Types without 4, 8 or 16 byte words are loaded normally.
+template <typename T>
+__forceinline__ __device__ T rocblas_stream_load(const T* p, bool streaming)
+{
+    if constexpr(std::is_arithmetic_v<T>)
+    {
+        return streaming ? __builtin_nontemporal_load(p) : *p;
+    }
+    else if constexpr(rocblas_nontemporal_word_bytes<T> != 0)
+    {
+        if(!streaming)
+            return *p;
+
+        using W = typename rocblas_nontemporal_word<rocblas_nontemporal_word_bytes<T>>::type;
+        const W* src = reinterpret_cast<const W*>(p);
+        T        v;
+        for(size_t i = 0; i < sizeof(T) / sizeof(W); i++)
+            reinterpret_cast<W*>(&v)[i] = __builtin_nontemporal_load(src + i);
+        return v;
+    }
+    else
+    {
+        return *p;
+    }
+}
+
+//! @brief Stores v to *p, with a nontemporal store when streaming is set, see rocblas_stream_load.
+template <typename T>
+__forceinline__ __device__ void rocblas_stream_store(T* p, const T& v, bool streaming)
+{
+    if constexpr(std::is_arithmetic_v<T>)
+    {
+        if(streaming)
+            __builtin_nontemporal_store(v, p);
+        else
+            *p = v;
+    }
+    else if constexpr(rocblas_nontemporal_word_bytes<T> != 0)
+    {
+        if(!streaming)
+        {
+            *p = v;
+            return;
+        }
+
+        using W = typename rocblas_nontemporal_word<rocblas_nontemporal_word_bytes<T>>::type;
+        W* dst = reinterpret_cast<W*>(p);
+        for(size_t i = 0; i < sizeof(T) / sizeof(W); i++)
+            __builtin_nontemporal_store(reinterpret_cast<const W*>(&v)[i], dst + i);
+    }
+    else
+    {
+        *p = v;
+    }
+}
+
 /*******************************************************************************
  * \brief convert hipError_t to rocblas_status
  ******************************************************************************/
@@ -192,6 +302,20 @@ ROCBLAS_INTERNAL_EXPORT rocblas_status
 ROCBLAS_INTERNAL_EXPORT rocblas_status
     rocblas_internal_convert_hip_to_rocblas_status_and_log(hipError_t status);
 
+/*******************************************************************************
+ * \brief set while profile logging times a call on this thread, see log_profile.
+ * rocblas_profile_launched records the stop event of the call after a kernel launch.
+ ******************************************************************************/
+ROCBLAS_INTERNAL_EXPORT extern thread_local bool rocblas_profile_timing;
+
+ROCBLAS_INTERNAL_EXPORT void rocblas_profile_launched();
+
+/*******************************************************************************
+ * \brief kernel launch counter of the handle of the rocBLAS function running on
+ * this thread, or nullptr, see rocblas_get_handle_stats.
+ ******************************************************************************/
+ROCBLAS_INTERNAL_EXPORT extern thread_local std::atomic<uint64_t>* rocblas_launch_counter;
+
 #ifndef GOOGLE_TEST
 
 // Helper for batched functions with temporary memory, currently just trsm and trsv.
@@ -303,6 +427,54 @@ constexpr char rocblas_diag_letter(rocblas_diagonal diag)
     return ' ';
 }
 
+// A matrix in row major order, see rocblas_set_order, is the transpose of the column major
+// matrix on the same storage: these return the arguments of the equivalent column major problem
+constexpr rocblas_side rocblas_row_major_side(rocblas_side side)
+{
+    switch(side)
+    {
+    case rocblas_side_left:  return rocblas_side_right;
+    case rocblas_side_right: return rocblas_side_left;
+    default:                 return side;
+    }
+}
+
+constexpr rocblas_fill rocblas_row_major_fill(rocblas_fill fill)
+{
+    switch(fill)
+    {
+    case rocblas_fill_upper: return rocblas_fill_lower;
+    case rocblas_fill_lower: return rocblas_fill_upper;
+    default:                 return fill;
+    }
+}
+
+// op(A)^T as an operation on A^T. op(A) = A^H is A^T for real T, and has no equivalent for
+// complex T, for which it is returned unchanged
+template <typename T>
+constexpr rocblas_operation rocblas_row_major_transpose(rocblas_operation trans)
+{
+    switch(trans)
+    {
+    case rocblas_operation_none:      return rocblas_operation_transpose;
+    case rocblas_operation_transpose: return rocblas_operation_none;
+    case rocblas_operation_conjugate_transpose:
+        return rocblas_is_complex<T> ? trans : rocblas_operation_none;
+    }
+    return trans;
+}
+
+// op(A) of the Hermitian rank-k updates on A^T, see rocblas_set_order: A^H for A and A for A^H
+constexpr rocblas_operation rocblas_row_major_conjugate_transpose(rocblas_operation trans)
+{
+    switch(trans)
+    {
+    case rocblas_operation_none:                return rocblas_operation_conjugate_transpose;
+    case rocblas_operation_conjugate_transpose: return rocblas_operation_none;
+    default:                                    return trans;
+    }
+}
+
 // return precision string for rocblas_datatype
 constexpr const char* rocblas_datatype_string(rocblas_datatype type)
 {
@@ -377,7 +549,9 @@ constexpr size_t rocblas_sizeof_datatype(rocblas_datatype type)
 // Convert atomics mode to string
 constexpr const char* rocblas_atomics_mode_to_string(rocblas_atomics_mode mode)
 {
-    return mode != rocblas_atomics_not_allowed ? "atomics_allowed" : "atomics_not_allowed";
+    return mode == rocblas_atomics_not_allowed     ? "atomics_not_allowed"
+           : mode == rocblas_atomics_deterministic ? "atomics_deterministic"
+                                                   : "atomics_allowed";
 }
 
 // Convert gemm flags to string
@@ -0,0 +1,585 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "logging.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#ifndef WIN32
+#include <dlfcn.h>
+#endif
+
+thread_local bool rocblas_profile_timing = false;
+
+namespace
+{
+    // Events of one timed call, and the time it is added to
+    struct rocblas_profile_call
+    {
+        hipEvent_t            start = nullptr;
+        hipEvent_t            stop  = nullptr;
+        rocblas_profile_time* time  = nullptr;
+    };
+
+    // Calls whose time has not been added yet, and events free for reuse
+    struct rocblas_profile_events
+    {
+        std::mutex                                     mutex;
+        std::vector<rocblas_profile_call>              pending;
+        std::vector<std::pair<hipEvent_t, hipEvent_t>> pool;
+
+        // Adds the times of the completed calls, waiting for all of them if wait is set.
+        // The mutex must be held.
+        void complete(bool wait)
+        {
+            size_t kept = 0;
+            for(auto& call : pending)
+            {
+                if(wait)
+                    (void)hipEventSynchronize(call.stop);
+
+                hipError_t status = hipEventQuery(call.stop);
+                if(status == hipErrorNotReady)
+                {
+                    pending[kept++] = call;
+                    continue;
+                }
+
+                // calls whose events failed are counted but not timed
+                float ms;
+                if(status == hipSuccess
+                   && hipEventElapsedTime(&ms, call.start, call.stop) == hipSuccess)
+                    call.time->add(ms * 1000.0);
+                pool.emplace_back(call.start, call.stop);
+            }
+            pending.resize(kept);
+        }
+    };
+
+    // Never destroyed, so that profiles dumped during static destruction can still use it
+    rocblas_profile_events& rocblas_profile_get_events()
+    {
+        static auto* events = new rocblas_profile_events;
+        return *events;
+    }
+
+    // The call being timed on this thread, and the stream its kernels are launched on. It is
+    // moved to the pending calls when the next call on the thread starts or the thread exits.
+    struct rocblas_profile_current
+    {
+        rocblas_profile_call call;
+        hipStream_t          stream = nullptr;
+
+        void close()
+        {
+            if(!call.time)
+                return;
+
+            auto&                       events = rocblas_profile_get_events();
+            std::lock_guard<std::mutex> lock(events.mutex);
+            events.pending.push_back(call);
+            call                   = {};
+            rocblas_profile_timing = false;
+        }
+
+        ~rocblas_profile_current()
+        {
+            close();
+        }
+    };
+
+    thread_local rocblas_profile_current rocblas_profile_current_call;
+}
+
+void rocblas_profile_time::add(double us)
+{
+    min_us = timed_count ? std::min(min_us, us) : us;
+    max_us = std::max(max_us, us);
+    total_us += us;
+    timed_count++;
+
+    int bin = 0;
+    for(double limit = 10; bin + 1 < rocblas_profile_bins && us >= limit; limit *= 10)
+        bin++;
+    bins[bin]++;
+}
+
+std::mutex& rocblas_profile_mutex()
+{
+    return rocblas_profile_get_events().mutex;
+}
+
+void rocblas_profile_start(hipStream_t stream, rocblas_profile_time* time)
+{
+    auto& current = rocblas_profile_current_call;
+    current.close();
+    if(!time)
+        return;
+
+    auto&                events = rocblas_profile_get_events();
+    rocblas_profile_call call;
+    {
+        std::lock_guard<std::mutex> lock(events.mutex);
+        events.complete(false);
+        if(!events.pool.empty())
+        {
+            std::tie(call.start, call.stop) = events.pool.back();
+            events.pool.pop_back();
+        }
+    }
+
+    if(!call.start)
+    {
+        if(hipEventCreate(&call.start) != hipSuccess)
+            return;
+        if(hipEventCreate(&call.stop) != hipSuccess)
+        {
+            (void)hipEventDestroy(call.start);
+            return;
+        }
+    }
+
+    // The stop event is recorded with the start event for calls which launch no kernels
+    if(hipEventRecord(call.start, stream) != hipSuccess
+       || hipEventRecord(call.stop, stream) != hipSuccess)
+    {
+        std::lock_guard<std::mutex> lock(events.mutex);
+        events.pool.emplace_back(call.start, call.stop);
+        return;
+    }
+
+    call.time              = time;
+    current.call           = call;
+    current.stream         = stream;
+    rocblas_profile_timing = true;
+}
+
+void rocblas_profile_launched()
+{
+    auto& current = rocblas_profile_current_call;
+    if(current.call.time)
+        (void)hipEventRecord(current.call.stop, current.stream);
+}
+
+void rocblas_profile_flush()
+{
+    rocblas_profile_current_call.close();
+
+    auto&                       events = rocblas_profile_get_events();
+    std::lock_guard<std::mutex> lock(events.mutex);
+    events.complete(true);
+}
+
+bool rocblas_profile_gemm_model(const char* func,
+                                int64_t     m,
+                                int64_t     n,
+                                int64_t     k,
+                                int64_t     batch_count,
+                                double&     flops,
+                                double&     bytes)
+{
+    // rocblas_<precision>gemm, with the batched, strided batched and _64 variants
+    static constexpr char prefix[] = "rocblas_";
+    constexpr size_t      len      = sizeof(prefix) - 1;
+    if(strncmp(func, prefix, len) || !func[len] || strncmp(func + len + 1, "gemm", 4)
+       || (func[len + 5] && func[len + 5] != '_'))
+        return false;
+
+    double size, ops;
+    switch(func[len])
+    {
+    case 'h':
+        size = 2, ops = 2;
+        break;
+    case 's':
+        size = 4, ops = 2;
+        break;
+    case 'd':
+        size = 8, ops = 2;
+        break;
+    case 'c':
+        size = 8, ops = 8;
+        break;
+    case 'z':
+        size = 16, ops = 8;
+        break;
+    default:
+        return false;
+    }
+
+    // C is read and written
+    double batches = double(std::max(batch_count, int64_t(1)));
+    flops          = ops * m * n * k * batches;
+    bytes          = size * (double(m) * k + double(k) * n + 2.0 * m * n) * batches;
+    return true;
+}
+
+/************************************************************************************
+ * Binary bench log
+ ************************************************************************************/
+
+rocblas_bench_binary_log::rocblas_bench_binary_log(const char* path)
+    : os(path)
+{
+    os.post(std::string("RBBENCH1"));
+}
+
+rocblas_bench_binary_log* rocblas_bench_binary_log::open(const char* path)
+{
+    // Never destroyed, the worker of the file writes out its queue at exit
+    static rocblas_bench_binary_log* log = path ? new rocblas_bench_binary_log(path) : nullptr;
+    return log;
+}
+
+// Strings are stored once, and referred to by their id afterwards
+void rocblas_bench_binary_log::put_string(const char* s)
+{
+    auto p = strings.emplace(s, uint32_t(strings.size()));
+    if(p.second)
+    {
+        const std::string& str = p.first->first;
+        put_raw(new_strings, record_string);
+        put_raw(new_strings, p.first->second);
+        put_raw(new_strings, uint32_t(str.size()));
+        new_strings += str;
+    }
+    put_raw(record, tag_string);
+    put_raw(record, p.first->second);
+}
+
+void rocblas_bench_binary_log::put_text(const std::string& s)
+{
+    put_raw(record, tag_text);
+    put_raw(record, uint32_t(s.size()));
+    record += s;
+}
+
+void rocblas_bench_binary_log::begin(rocblas_handle handle, size_t count)
+{
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                  std::chrono::steady_clock::now() - start)
+                  .count();
+
+    record.clear();
+    new_strings.clear();
+    put_raw(record, record_call);
+    put_raw(record, uint64_t(ns));
+    put_raw(record, uint64_t(std::hash<std::thread::id>{}(std::this_thread::get_id())));
+    put_raw(record, uint64_t(uintptr_t(handle)));
+    put_raw(record, uint64_t(uintptr_t(handle->get_stream())));
+    put_raw(record, uint8_t(handle->pointer_mode));
+    put_raw(record, uint16_t(count));
+}
+
+// The strings used first by the call are queued before its record
+void rocblas_bench_binary_log::end()
+{
+    os.post(new_strings + record);
+}
+
+/************************************************************************************
+ * Chrome trace log
+ ************************************************************************************/
+
+namespace
+{
+    constexpr int chrome_trace_host_pid = 1;
+
+    // Devices have processes of their own, whose threads are the streams
+    int chrome_trace_device_pid(int device)
+    {
+        return 2 + device;
+    }
+
+    std::string chrome_trace_metadata(const char* kind, int pid, int tid, const std::string& name)
+    {
+        char buffer[256];
+        snprintf(buffer,
+                 sizeof(buffer),
+                 "{\"name\":\"%s\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,"
+                 "\"args\":{\"name\":\"%s\"}},\n",
+                 kind,
+                 pid,
+                 tid,
+                 name.c_str());
+        return buffer;
+    }
+
+    std::string chrome_trace_event(const char* name,
+                                   const char* cat,
+                                   int         pid,
+                                   int         tid,
+                                   double      ts,
+                                   double      dur,
+                                   const void* handle)
+    {
+        char buffer[256];
+        snprintf(buffer,
+                 sizeof(buffer),
+                 "{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f,"
+                 "\"dur\":%.3f,\"args\":{\"handle\":\"%p\"}},\n",
+                 name,
+                 cat,
+                 pid,
+                 tid,
+                 ts,
+                 dur,
+                 handle);
+        return buffer;
+    }
+}
+
+rocblas_chrome_trace_log::rocblas_chrome_trace_log(const char* path, bool device_events)
+    : os(path)
+    , device_events(device_events)
+{
+    // The closing bracket of the array is optional in the format, so events can be appended
+    // until the process exits
+    os.post(std::string("[\n")
+            + chrome_trace_metadata("process_name", chrome_trace_host_pid, 0, "rocBLAS host"));
+}
+
+rocblas_chrome_trace_log* rocblas_chrome_trace_log::open(const char* path, bool device_events)
+{
+    // Never destroyed, the worker of the file writes out its queue at exit
+    static rocblas_chrome_trace_log* log
+        = path ? new rocblas_chrome_trace_log(path, device_events) : nullptr;
+    return log;
+}
+
+double rocblas_chrome_trace_log::now_us() const
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+// The mutex must be held
+hipEvent_t rocblas_chrome_trace_log::get_event()
+{
+    hipEvent_t event = nullptr;
+    if(!pool.empty())
+    {
+        event = pool.back();
+        pool.pop_back();
+    }
+    else if(hipEventCreate(&event) != hipSuccess)
+        event = nullptr;
+    return event;
+}
+
+// Threads and streams have small track numbers, named in metadata events. The mutex must be held.
+int rocblas_chrome_trace_log::thread_track()
+{
+    auto p = threads.emplace(std::this_thread::get_id(), int(threads.size()) + 1);
+    if(p.second)
+        os.post(chrome_trace_metadata("thread_name",
+                                      chrome_trace_host_pid,
+                                      p.first->second,
+                                      "thread " + std::to_string(p.first->second)));
+    return p.first->second;
+}
+
+int rocblas_chrome_trace_log::stream_track(int device, hipStream_t stream)
+{
+    auto p = streams.emplace(stream, int(streams.size()) + 1);
+    if(p.second)
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "stream %p", (void*)stream);
+        os.post(chrome_trace_metadata(
+            "thread_name", chrome_trace_device_pid(device), p.first->second, name));
+    }
+    return p.first->second;
+}
+
+void rocblas_chrome_trace_log::begin(rocblas_handle handle, call& c)
+{
+    c.start_us = now_us();
+    if(!device_events || handle->is_stream_in_capture_mode())
+        return;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    c.start = get_event();
+    if(c.start && hipEventRecord(c.start, handle->get_stream()) != hipSuccess)
+    {
+        pool.push_back(c.start);
+        c.start = nullptr;
+    }
+}
+
+void rocblas_chrome_trace_log::end(rocblas_handle handle, const char* name, call& c)
+{
+    double end_us = now_us();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    os.post(chrome_trace_event(name,
+                               "host",
+                               chrome_trace_host_pid,
+                               thread_track(),
+                               c.start_us,
+                               end_us - c.start_us,
+                               handle));
+
+    if(!c.start)
+        return;
+
+    hipEvent_t stop = get_event();
+    if(!stop || hipEventRecord(stop, handle->get_stream()) != hipSuccess)
+    {
+        pool.push_back(c.start);
+        if(stop)
+            pool.push_back(stop);
+        return;
+    }
+
+    // The device times are taken relative to an event on the device whose host time is known
+    int device = handle->getDevice();
+    if(!device_origins.count(device))
+    {
+        hipEvent_t origin = get_event();
+        if(!origin || hipEventRecord(origin, handle->get_stream()) != hipSuccess
+           || hipEventSynchronize(origin) != hipSuccess)
+        {
+            pool.push_back(c.start);
+            pool.push_back(stop);
+            if(origin)
+                pool.push_back(origin);
+            return;
+        }
+        device_origins[device] = {origin, now_us()};
+        os.post(chrome_trace_metadata("process_name",
+                                      chrome_trace_device_pid(device),
+                                      0,
+                                      "rocBLAS device " + std::to_string(device)));
+    }
+
+    pending.push_back(
+        {handle, name, device, stream_track(device, handle->get_stream()), c.start, stop});
+    complete(false, nullptr);
+}
+
+// Writes the device events which have completed, waiting for those of handle. The mutex must be
+// held.
+void rocblas_chrome_trace_log::complete(bool wait, rocblas_handle handle)
+{
+    size_t kept = 0;
+    for(auto& call : pending)
+    {
+        if(wait && call.handle == handle)
+            (void)hipEventSynchronize(call.stop);
+
+        hipError_t status = hipEventQuery(call.stop);
+        if(status == hipErrorNotReady)
+        {
+            pending[kept++] = call;
+            continue;
+        }
+
+        // calls whose events failed are not written
+        auto& origin = device_origins[call.device];
+        float start_ms, stop_ms;
+        if(status == hipSuccess
+           && hipEventElapsedTime(&start_ms, origin.first, call.start) == hipSuccess
+           && hipEventElapsedTime(&stop_ms, origin.first, call.stop) == hipSuccess)
+            os.post(chrome_trace_event(call.name,
+                                       "device",
+                                       chrome_trace_device_pid(call.device),
+                                       call.track,
+                                       origin.second + start_ms * 1000.0,
+                                       (stop_ms - start_ms) * 1000.0,
+                                       call.handle));
+        pool.push_back(call.start);
+        pool.push_back(call.stop);
+    }
+    pending.resize(kept);
+}
+
+void rocblas_chrome_trace_log::flush(rocblas_handle handle)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    complete(true, handle);
+}
+
+/************************************************************************************
+ * roctx ranges
+ ************************************************************************************/
+
+thread_local int rocblas_roctx_depth = 0;
+
+namespace
+{
+    // roctx is loaded when it is first used, so that rocBLAS does not depend on it
+    struct rocblas_roctx_api
+    {
+        int (*push)(const char*) = nullptr;
+        int (*pop)()             = nullptr;
+
+        rocblas_roctx_api()
+        {
+#ifndef WIN32
+            void* lib = dlopen("libroctx64.so", RTLD_NOW | RTLD_LOCAL);
+            if(!lib)
+                lib = dlopen("libroctx64.so.4", RTLD_NOW | RTLD_LOCAL);
+            if(lib)
+            {
+                push = reinterpret_cast<int (*)(const char*)>(dlsym(lib, "roctxRangePushA"));
+                pop  = reinterpret_cast<int (*)()>(dlsym(lib, "roctxRangePop"));
+            }
+#endif
+            if(!push || !pop)
+            {
+                push = nullptr;
+                pop  = nullptr;
+                rocblas_cerr << "rocBLAS warning: libroctx64 could not be loaded, no roctx "
+                                "ranges will be pushed"
+                             << std::endl;
+            }
+        }
+    };
+
+    const rocblas_roctx_api& rocblas_roctx_get_api()
+    {
+        static const rocblas_roctx_api api;
+        return api;
+    }
+}
+
+bool rocblas_roctx_push(const char* name)
+{
+    auto& api = rocblas_roctx_get_api();
+    if(!api.push || api.push(name) < 0)
+        return false;
+    rocblas_roctx_depth++;
+    return true;
+}
+
+void rocblas_roctx_pop()
+{
+    auto& api = rocblas_roctx_get_api();
+    if(api.pop && rocblas_roctx_depth > 0)
+    {
+        api.pop();
+        rocblas_roctx_depth--;
+    }
+}
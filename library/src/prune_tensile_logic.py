@@ -0,0 +1,245 @@
+#!/usr/bin/env python3
+# ########################################################################
+# Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+# ########################################################################
+
+"""Reduce Tensile logic files to the problems of a shape manifest.
+
+The manifest lists the GEMM problems an application runs, one per line, either as
+
+    <a_type> <transA><transB> <m> <n> <k> [<batch_count>]
+
+where each size is a value, a lo:hi range or * for any, e.g. "f16_r NT 1024 1:8192 512", or as
+the rocblas-bench command lines of a bench log (ROCBLAS_LAYER=2), whose gemm calls are taken
+as they are. Lines starting with # are comments.
+
+The logic files of problem types which no problem of the manifest has are dropped. In the others,
+the exact logic entries whose sizes are within the ranges of a problem are kept, together with
+the entry nearest to each problem, so that every problem still selects among the solutions tuned
+for its neighbourhood; the solutions no kept entry refers to are dropped and the others
+renumbered. Files matching a --keep pattern, the generic fallback libraries by default, are
+copied whole. The reduced logic is written to the output directory with the same layout, to be
+used as the logic directory of the Tensile library build (Tensile_LOGIC_MANIFEST in CMake).
+
+With --types instead of or in addition to a manifest, the logic files of the problem types whose
+A matrix has another datatype are dropped as well, and the others are kept whole unless a
+manifest reduces them (Tensile_PRECISIONS in CMake).
+"""
+
+import argparse
+import fnmatch
+import os
+import shutil
+import sys
+
+try:
+    import yaml
+except ImportError:
+    sys.exit("prune_tensile_logic.py requires PyYAML")
+
+Loader = getattr(yaml, "CSafeLoader", yaml.SafeLoader)
+Dumper = getattr(yaml, "CSafeDumper", yaml.SafeDumper)
+
+# Tensile data types of the rocBLAS type names and precision letters of the bench
+DATA_TYPES = {
+    "f32_r": {0, "S", "s"}, "s": {0, "S", "s"},
+    "f64_r": {1, "D", "d"}, "d": {1, "D", "d"},
+    "f32_c": {2, "C", "c"}, "c": {2, "C", "c"},
+    "f64_c": {3, "Z", "z"}, "z": {3, "Z", "z"},
+    "f16_r": {4, "H", "h"}, "h": {4, "H", "h"},
+    "bf16_r": {7, "B", "b"},
+    "i8_r": {5, 8, "4xi8", "I8"},
+}
+
+GEMM_FUNCTIONS = ("gemm", "gemm_batched", "gemm_strided_batched", "gemm_ex", "gemm_batched_ex",
+                  "gemm_strided_batched_ex", "hgemm", "sgemm", "dgemm", "cgemm", "zgemm")
+
+# Positions of the sizes in the exact logic entries, in the default index order
+M, N, BATCH, K = 0, 1, 2, 3
+
+
+def parse_range(text):
+    if text == "*":
+        return (0, float("inf"))
+    if ":" in text:
+        lo, hi = text.split(":", 1)
+        return (int(lo), int(hi))
+    return (int(text), int(text))
+
+
+def parse_bench(tokens):
+    """Problem of a rocblas-bench command line, or None if it is not a gemm"""
+    opts, i = {}, 0
+    while i < len(tokens):
+        if tokens[i].startswith("-") and i + 1 < len(tokens):
+            opts[tokens[i].lstrip("-")] = tokens[i + 1]
+            i += 2
+        else:
+            i += 1
+    function = opts.get("f", opts.get("function", ""))
+    if function not in GEMM_FUNCTIONS:
+        return None
+    a_type = opts.get("a_type", opts.get("r", opts.get("precision", "f32_r")))
+    if function[0] in "hsdcz" and function[1:].startswith("gemm"):
+        a_type = function[0]
+    size = lambda key: parse_range(opts.get(key, "128"))
+    return {
+        "type": a_type,
+        "trans": (opts.get("transposeA", "N"), opts.get("transposeB", "N")),
+        "m": size("m"), "n": size("n"), "k": size("k"),
+        "batch": parse_range(opts.get("batch_count", "1")),
+    }
+
+
+def read_manifest(path):
+    problems = []
+    with open(path) as f:
+        for number, line in enumerate(f, 1):
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            tokens = line.split()
+            if "-f" in tokens or "--function" in tokens:
+                problem = parse_bench(tokens)
+                if problem:
+                    problems.append(problem)
+                continue
+            if len(tokens) < 5 or len(tokens[1]) != 2:
+                sys.exit("%s:%d: expected <a_type> <transA><transB> <m> <n> <k> [<batch_count>]"
+                         % (path, number))
+            problems.append({
+                "type": tokens[0],
+                "trans": (tokens[1][0], tokens[1][1]),
+                "m": parse_range(tokens[2]), "n": parse_range(tokens[3]),
+                "k": parse_range(tokens[4]),
+                "batch": parse_range(tokens[5]) if len(tokens) > 5 else (1, 1),
+            })
+    return problems
+
+
+def matches_type(problem, problem_type):
+    types = DATA_TYPES.get(problem["type"])
+    if types is None or problem_type.get("DataType") not in types:
+        return False
+    # conjugate transposes are transposes of complex problem types
+    trans_a, trans_b = (t.upper() != "N" for t in problem["trans"])
+    return (bool(problem_type.get("TransposeA")) == trans_a
+            and bool(problem_type.get("TransposeB")) == trans_b)
+
+
+def in_range(problem, size):
+    sizes = [problem["m"], problem["n"], problem["batch"], problem["k"]]
+    return all(lo <= size[i] <= hi for i, (lo, hi) in enumerate(sizes) if i < len(size))
+
+
+def distance(problem, size):
+    """Distance of the sizes of an entry to the nearest size of the ranges of a problem"""
+    sizes = [problem["m"], problem["n"], problem["batch"], problem["k"]]
+    return sum((min(max(size[i], lo), hi) - size[i]) ** 2
+               for i, (lo, hi) in enumerate(sizes) if i < len(size) and hi != float("inf"))
+
+
+def prune(logic, problems, types):
+    """Reduced logic of a list-format logic file, or None if its type is not wanted"""
+    problem_type, solutions, exact = logic[4], logic[5], logic[7]
+    if types and not any(problem_type.get("DataType") in DATA_TYPES[t] for t in types):
+        return None
+    if problems is None:
+        return logic
+    wanted = [p for p in problems if matches_type(p, problem_type)]
+    if not wanted:
+        return None
+
+    keep = {i for i, (size, _) in enumerate(exact) if any(in_range(p, size) for p in wanted)}
+    for p in wanted:
+        if exact:
+            keep.add(min(range(len(exact)), key=lambda i: distance(p, exact[i][0])))
+    entries = [exact[i] for i in sorted(keep)]
+
+    # Solutions are referred to by their index in the list, which is their SolutionIndex
+    used = sorted({entry[1][0] for entry in entries})
+    renumber = {old: new for new, old in enumerate(used)}
+    logic[5] = []
+    for old in used:
+        solution = dict(solutions[old])
+        solution["SolutionIndex"] = renumber[old]
+        logic[5].append(solution)
+    logic[7] = [[size, [renumber[result[0]]] + list(result[1:])] for size, result in entries]
+    return logic
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("logic", help="directory of the Tensile logic files, e.g. Logic/asm_full")
+    parser.add_argument("-o", "--output", required=True, help="directory of the reduced logic")
+    parser.add_argument("--manifest", help="problems to keep, or a bench log")
+    parser.add_argument("--types", nargs="+", choices=sorted(DATA_TYPES), default=[],
+                        help="datatypes of the A matrix of the problem types to keep")
+    parser.add_argument("--keep", action="append", default=None,
+                        help="pattern of logic files copied whole (default: *allback*)")
+    args = parser.parse_args()
+
+    if not args.manifest and not args.types:
+        parser.error("a manifest or types are required")
+    problems = read_manifest(args.manifest) if args.manifest else None
+    if problems == []:
+        sys.exit("no GEMM problems in %s" % args.manifest)
+    keep_patterns = args.keep or ["*allback*"]
+
+    if os.path.isdir(args.output):
+        shutil.rmtree(args.output)
+    files = kept = solutions_in = solutions_out = 0
+    for root, _, names in os.walk(args.logic):
+        out_dir = os.path.join(args.output, os.path.relpath(root, args.logic))
+        for name in names:
+            source = os.path.join(root, name)
+            target = os.path.join(out_dir, name)
+            os.makedirs(out_dir, exist_ok=True)
+            if not name.endswith(".yaml") or any(fnmatch.fnmatch(name, p) for p in keep_patterns):
+                shutil.copy2(source, target)
+                continue
+
+            files += 1
+            with open(source) as f:
+                logic = yaml.load(f, Loader=Loader)
+            if not isinstance(logic, list) or len(logic) < 9:
+                # not in the list format, kept as it is
+                shutil.copy2(source, target)
+                kept += 1
+                continue
+
+            solutions_in += len(logic[5])
+            logic = prune(logic, problems, args.types)
+            if logic is None:
+                continue
+            solutions_out += len(logic[5])
+            kept += 1
+            with open(target, "w") as f:
+                yaml.dump(logic, f, Dumper=Dumper, default_flow_style=None)
+
+    print("kept %d of %d logic files and %d of %d solutions" % (kept, files, solutions_out,
+                                                                 solutions_in))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
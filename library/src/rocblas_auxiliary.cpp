@@ -23,10 +23,23 @@
 #include "handle.hpp"
 #include "logging.hpp"
 #include "rocblas-auxiliary.h"
+#include "rocblas_block_sizes.h"
+#include <algorithm>
 #include <cctype>
 #include <cstdlib>
+#include <cstring>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <new>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#ifndef WIN32
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 /* ============================================================================================ */
 
@@ -42,6 +55,69 @@ extern "C" rocblas_pointer_mode rocblas_pointer_to_mode(void* ptr)
     return ptr == attribute.devicePointer ? rocblas_pointer_mode_device : rocblas_pointer_mode_host;
 }
 
+/*******************************************************************************
+ * ! \brief indicates whether the pointer is on the host or device, using the
+ * address ranges cached by the handle
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_pointer_to_mode_cached(rocblas_handle        handle,
+                                                         const void*           ptr,
+                                                         rocblas_pointer_mode* mode)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!mode)
+        return rocblas_status_invalid_pointer;
+
+    *mode = handle->classify_pointer(ptr);
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_pointer_to_mode_cached", ptr, *mode);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief clear the address ranges cached by rocblas_pointer_to_mode_cached
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_clear_pointer_cache(rocblas_handle handle)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_clear_pointer_cache");
+
+    handle->pointer_ranges.fill({});
+    handle->pointer_ranges_next = 0;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief enable or disable the prefetch of managed memory operands
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_managed_prefetch(rocblas_handle handle, bool enable)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_managed_prefetch", enable);
+
+    handle->managed_prefetch = enable;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 /*******************************************************************************
  * ! \brief get pointer mode, can be host or device
  ******************************************************************************/
@@ -120,6 +196,50 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+/*******************************************************************************
+ * ! \brief get cache policy
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_cache_policy(rocblas_handle handle, uint32_t* policy)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!policy)
+        return rocblas_status_invalid_pointer;
+    *policy = handle->cache_policy;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_cache_policy", *policy);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief set cache policy
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_cache_policy(rocblas_handle handle, uint32_t policy)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_cache_policy", policy);
+    if(policy
+       & ~uint32_t(rocblas_cache_policy_stream_x | rocblas_cache_policy_stream_y
+                   | rocblas_cache_policy_stream_a))
+        return rocblas_status_invalid_value;
+    handle->cache_policy = policy;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 /*******************************************************************************
  * ! \brief get math mode
  ******************************************************************************/
@@ -158,6 +278,9 @@ try
     case rocblas_xf32_xdl_math_op:
         supported = rocblas_internal_tensile_supports_xdl_math_op(mode);
         break;
+    case rocblas_dgemm_ozaki_math_op:
+        supported = true;
+        break;
     default:
         supported = false;
         break;
@@ -182,6 +305,181 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+/*******************************************************************************
+ * ! \brief set the number of slices of rocblas_dgemm_ozaki_math_op
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_ozaki_slices(rocblas_handle handle, rocblas_int slices)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_ozaki_slices", slices);
+
+    // 8 slices of 7 bits hold all 53 bits of a double
+    if(slices < 1 || slices > 8)
+        return rocblas_status_invalid_value;
+
+    handle->ozaki_slices = slices;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief get the number of slices of rocblas_dgemm_ozaki_math_op
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_ozaki_slices(rocblas_handle handle, rocblas_int* slices)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!slices)
+        return rocblas_status_invalid_pointer;
+
+    *slices = handle->ozaki_slices;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_ozaki_slices", *slices);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief set the order of the matrices of Level 2 and Level 3 functions
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_order(rocblas_handle handle, rocblas_order order)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_order", order);
+
+    if(order != rocblas_order_row_major && order != rocblas_order_column_major)
+        return rocblas_status_invalid_value;
+
+    handle->order = order;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief get the order of the matrices of Level 2 and Level 3 functions
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_order(rocblas_handle handle, rocblas_order* order)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!order)
+        return rocblas_status_invalid_pointer;
+
+    *order = handle->order;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_order", *order);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief get the cumulative counters of the calls made with a handle
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_handle_stats(rocblas_handle        handle,
+                                                   rocblas_handle_stats* stats)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!stats)
+        return rocblas_status_invalid_pointer;
+
+    handle->counters.get(*stats);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief get the number of calls of each function made with a handle
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_handle_function_calls(rocblas_handle handle,
+                                                            rocblas_int*   count,
+                                                            const char**   functions,
+                                                            uint64_t*      calls)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!count || !functions != !calls)
+        return rocblas_status_invalid_pointer;
+    if(functions && *count < 0)
+        return rocblas_status_invalid_size;
+
+    // A name used in several files may have several addresses, so the calls are summed by name
+    std::map<std::string_view, std::pair<const char*, uint64_t>> by_name;
+    for(int id = 0; id < ROCBLAS_API_FUNCTIONS_MAX; ++id)
+    {
+        uint64_t id_calls = handle->counters.function_calls[id].load(std::memory_order_relaxed);
+        if(!id_calls)
+            continue;
+        const char* name  = rocblas_api_function_name(id);
+        auto&       entry = by_name[name];
+        entry.first       = name;
+        entry.second += id_calls;
+    }
+
+    rocblas_int filled = 0;
+    for(auto& entry : by_name)
+    {
+        if(functions)
+        {
+            if(filled == *count)
+                break;
+            functions[filled] = entry.second.first;
+            calls[filled]     = entry.second.second;
+        }
+        filled++;
+    }
+    *count = filled;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief reset the counters of a handle
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_reset_handle_stats(rocblas_handle handle)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    handle->counters.reset();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 /*******************************************************************************
  * ! \brief create rocblas handle called before any rocblas library routines
  ******************************************************************************/
@@ -205,6 +503,29 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+/*******************************************************************************
+ *! \brief create a rocblas handle with the configuration of an existing one
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_clone_handle(rocblas_handle src, rocblas_handle* handle)
+try
+{
+    // if handle not valid
+    if(!src || !handle)
+        return rocblas_status_invalid_handle;
+
+    // allocate on heap
+    *handle = new _rocblas_handle(src);
+
+    if((*handle)->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(*handle, "rocblas_clone_handle", src);
+
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 /*******************************************************************************
  *! \brief release rocblas handle, will implicitly synchronize host and device
  ******************************************************************************/
@@ -242,60 +563,909 @@ try
     if(handle->layer_mode & rocblas_layer_mode_log_trace)
         log_trace(handle, "rocblas_set_stream", stream);
 
-    // If the stream is unchanged, return immediately
-    if(stream == handle->stream)
+    // If the stream is unchanged, return immediately
+    if(stream == handle->stream)
+        return rocblas_status_success;
+
+    // The stream is the one the calls of an open group are joined back to, or the CU-masked
+    // stream of the handle
+    if(handle->is_group_open() || handle->get_cu_mask_count())
+        return rocblas_status_invalid_value;
+
+    //Verify if the new stream is in capture mode
+    hipStreamCaptureStatus stream_status = hipStreamCaptureStatusNone;
+    if(stream != 0)
+    {
+        bool status = hipStreamIsCapturing(stream, &stream_status) == hipSuccess;
+
+        if(!status)
+            return rocblas_status_invalid_value;
+    }
+
+    // Stream capture does not allow use of hipStreamQuery
+    // If the current stream or new stream is in capture mode, skip use of hipStreamQuery()
+    if((handle->stream == 0 || !handle->is_stream_in_capture_mode())
+       && stream_status == hipStreamCaptureStatusNone)
+    {
+        // The new stream must be valid
+        if(stream != 0 && hipStreamQuery(stream) == hipErrorInvalidHandle)
+            return rocblas_status_invalid_value;
+    }
+
+    // Set the new stream
+    handle->stream = stream;
+
+    // Device memory reserved for graph capture grows to the problems seen up to now, before
+    // the new stream can be captured
+    if(handle->capture_workspace_reserve && stream_status == hipStreamCaptureStatusNone)
+        return handle->reserve_capture_workspace();
+
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Attach auxiliary streams used to spread independent per-batch work
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_auxiliary_streams(rocblas_handle     handle,
+                                                        rocblas_int        count,
+                                                        const hipStream_t* streams)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(count < 0)
+        return rocblas_status_invalid_size;
+    if(count && !streams)
+        return rocblas_status_invalid_pointer;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_auxiliary_streams", count, streams);
+
+    // Temporarily change the thread's default device ID to the handle's device ID
+    auto saved_device_id = handle->push_device_id();
+
+    RETURN_IF_ROCBLAS_ERROR(handle->release_auxiliary_streams());
+    if(!count)
+        return rocblas_status_success;
+
+    RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&handle->aux_fork_event, hipEventDisableTiming));
+    for(rocblas_int i = 0; i < count; i++)
+    {
+        hipEvent_t event;
+        int        priority = 0;
+        RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&event, hipEventDisableTiming));
+        RETURN_IF_HIP_ERROR(hipStreamGetPriority(streams[i], &priority));
+        handle->aux_join_events.push_back(event);
+        handle->aux_streams.push_back(streams[i]);
+        handle->aux_priorities.push_back(priority);
+    }
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Set online autotuning of solution selection
+ ******************************************************************************/
+extern "C" rocblas_status
+    rocblas_set_autotune(rocblas_handle handle, rocblas_int max_candidates, float budget_ms)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(max_candidates < 0 || budget_ms < 0)
+        return rocblas_status_invalid_value;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_autotune", max_candidates, budget_ms);
+
+    handle->autotune_candidates = max_candidates;
+    handle->autotune_budget_ms  = budget_ms;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Set the backend of GEMM problems
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_gemm_backend(rocblas_handle       handle,
+                                                   rocblas_gemm_backend backend)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(backend != rocblas_gemm_backend_tensile && backend != rocblas_gemm_backend_hipblaslt
+       && backend != rocblas_gemm_backend_auto)
+        return rocblas_status_invalid_value;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_gemm_backend", backend);
+
+    handle->gemm_backend = backend;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Get the backend of GEMM problems
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_gemm_backend(rocblas_handle        handle,
+                                                   rocblas_gemm_backend* backend)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!backend)
+        return rocblas_status_invalid_pointer;
+
+    *backend = handle->gemm_backend;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Seed the stochastic rounding of gemm_ex3
+ ******************************************************************************/
+extern "C" rocblas_status
+    rocblas_set_stochastic_rounding_seed(rocblas_handle handle, uint64_t seed, uint64_t offset)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_stochastic_rounding_seed", seed, offset);
+
+    handle->stochastic_rounding_key     = seed;
+    handle->stochastic_rounding_counter = offset;
+    handle->stochastic_rounding_seeded  = true;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Get the stochastic rounding state of gemm_ex3
+ ******************************************************************************/
+extern "C" rocblas_status
+    rocblas_get_stochastic_rounding_seed(rocblas_handle handle, uint64_t* seed, uint64_t* offset)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!seed || !offset)
+        return rocblas_status_invalid_pointer;
+
+    // the key drawn by an unseeded handle is only known after its first use
+    if(!handle->stochastic_rounding_seeded)
+        return rocblas_status_invalid_value;
+
+    *seed   = handle->stochastic_rounding_key;
+    *offset = handle->stochastic_rounding_counter;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Set the epilogue applied by gemm_ex and gemm_strided_batched_ex, or clear it
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_gemm_epilogue(rocblas_handle               handle,
+                                                    const rocblas_gemm_epilogue* epilogue)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+    {
+        if(epilogue)
+            log_trace(handle,
+                      "rocblas_set_gemm_epilogue",
+                      int(epilogue->bias_mode),
+                      epilogue->bias,
+                      epilogue->stride_bias,
+                      int(epilogue->activation),
+                      epilogue->aux,
+                      epilogue->ldaux,
+                      epilogue->stride_aux,
+                      epilogue->scale_row,
+                      epilogue->stride_scale_row,
+                      epilogue->scale_column,
+                      epilogue->stride_scale_column);
+        else
+            log_trace(handle, "rocblas_set_gemm_epilogue", epilogue);
+    }
+
+    if(!epilogue)
+    {
+        handle->gemm_epilogue = {};
+        return rocblas_status_success;
+    }
+
+    if(epilogue->bias_mode != rocblas_gemm_epilogue_bias_none
+       && epilogue->bias_mode != rocblas_gemm_epilogue_bias_row
+       && epilogue->bias_mode != rocblas_gemm_epilogue_bias_column)
+        return rocblas_status_invalid_value;
+    if(epilogue->activation != rocblas_gemm_epilogue_activation_none
+       && epilogue->activation != rocblas_gemm_epilogue_activation_relu
+       && epilogue->activation != rocblas_gemm_epilogue_activation_gelu)
+        return rocblas_status_invalid_value;
+    if(epilogue->bias_mode != rocblas_gemm_epilogue_bias_none && !epilogue->bias)
+        return rocblas_status_invalid_pointer;
+    if(epilogue->stride_bias < 0 || epilogue->stride_aux < 0 || epilogue->ldaux < 0
+       || epilogue->stride_scale_row < 0 || epilogue->stride_scale_column < 0)
+        return rocblas_status_invalid_size;
+
+    handle->gemm_epilogue = *epilogue;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Set the quantization scales applied by gemm_ex3, or clear them
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_gemm_ex3_scales(rocblas_handle                 handle,
+                                                      const rocblas_gemm_ex3_scales* scales)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+    {
+        if(scales)
+            log_trace(handle,
+                      "rocblas_set_gemm_ex3_scales",
+                      scales->scale_a,
+                      scales->block_a,
+                      scales->stride_scale_a,
+                      scales->scale_b,
+                      scales->block_b,
+                      scales->stride_scale_b,
+                      scales->scale_d,
+                      scales->amax_d);
+        else
+            log_trace(handle, "rocblas_set_gemm_ex3_scales", scales);
+    }
+
+    if(!scales)
+    {
+        handle->gemm_ex3_scales = {};
+        return rocblas_status_success;
+    }
+
+    if((scales->scale_a && scales->block_a < 1) || (scales->scale_b && scales->block_b < 1)
+       || scales->stride_scale_a < 0 || scales->stride_scale_b < 0)
+        return rocblas_status_invalid_size;
+
+    handle->gemm_ex3_scales = *scales;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Set the scalars of the batches of gemm_batched_ex and gemm_strided_batched_ex, or
+ * clear them
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_gemm_batch_scalars(rocblas_handle                    handle,
+                                                         const rocblas_gemm_batch_scalars* scalars)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+    {
+        if(scalars)
+            log_trace(handle,
+                      "rocblas_set_gemm_batch_scalars",
+                      scalars->alpha,
+                      scalars->stride_alpha,
+                      scalars->beta,
+                      scalars->stride_beta);
+        else
+            log_trace(handle, "rocblas_set_gemm_batch_scalars", scalars);
+    }
+
+    if(!scalars)
+    {
+        handle->gemm_batch_scalars = {};
+        return rocblas_status_success;
+    }
+
+    if(!scalars->alpha || !scalars->beta)
+        return rocblas_status_invalid_pointer;
+    if(scalars->stride_alpha < 0 || scalars->stride_beta < 0)
+        return rocblas_status_invalid_size;
+
+    handle->gemm_batch_scalars = *scalars;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Set the epilogue applied by gemv and gemv_strided_batched, or clear it
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_gemv_epilogue(rocblas_handle               handle,
+                                                    const rocblas_gemv_epilogue* epilogue)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+    {
+        if(epilogue)
+            log_trace(handle,
+                      "rocblas_set_gemv_epilogue",
+                      epilogue->bias,
+                      epilogue->stride_bias,
+                      epilogue->z,
+                      epilogue->incz,
+                      epilogue->stride_z,
+                      int(epilogue->activation));
+        else
+            log_trace(handle, "rocblas_set_gemv_epilogue", epilogue);
+    }
+
+    if(!epilogue)
+    {
+        handle->gemv_epilogue = {};
+        return rocblas_status_success;
+    }
+
+    if(epilogue->activation != rocblas_gemm_epilogue_activation_none
+       && epilogue->activation != rocblas_gemm_epilogue_activation_relu
+       && epilogue->activation != rocblas_gemm_epilogue_activation_gelu)
+        return rocblas_status_invalid_value;
+    if(epilogue->stride_bias < 0 || epilogue->stride_z < 0 || (epilogue->z && !epilogue->incz))
+        return rocblas_status_invalid_size;
+
+    handle->gemv_epilogue = *epilogue;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Register the inverses of the diagonal blocks of a triangular matrix for trsm
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_trsm_invA(rocblas_handle   handle,
+                                                rocblas_datatype type,
+                                                rocblas_fill     uplo,
+                                                rocblas_diagonal diag,
+                                                rocblas_int      k,
+                                                const void*      A,
+                                                rocblas_int      lda,
+                                                const void*      invA,
+                                                rocblas_int      invA_size)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle,
+                  "rocblas_set_trsm_invA",
+                  type,
+                  uplo,
+                  diag,
+                  k,
+                  A,
+                  lda,
+                  invA,
+                  invA_size);
+
+    auto& entries = handle->trsm_invA_entries;
+
+    // a NULL A clears all registrations
+    if(!A)
+    {
+        entries.clear();
+        return rocblas_status_success;
+    }
+
+    if(type != rocblas_datatype_f32_r && type != rocblas_datatype_f64_r
+       && type != rocblas_datatype_f32_c && type != rocblas_datatype_f64_c)
+        return rocblas_status_invalid_value;
+    if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+        return rocblas_status_invalid_value;
+    if(diag != rocblas_diagonal_unit && diag != rocblas_diagonal_non_unit)
+        return rocblas_status_invalid_value;
+    if(k < 0 || lda < std::max(k, 1) || (invA && invA_size / ROCBLAS_TRSM_NB < k))
+        return rocblas_status_invalid_size;
+
+    // a NULL invA removes the registration of A
+    auto it = std::find_if(entries.begin(), entries.end(), [&](const auto& e) {
+        return e.A == A && e.type == type && e.uplo == uplo && e.diag == diag && e.lda == lda;
+    });
+    if(!invA)
+    {
+        if(it != entries.end())
+            entries.erase(it);
+        return rocblas_status_success;
+    }
+
+    _rocblas_handle::trsm_invA_entry entry{type, uplo, diag, k, A, lda, invA, invA_size};
+    if(it != entries.end())
+        *it = entry;
+    else
+        entries.push_back(entry);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Enable or disable the graph capture audit; either clears the audit log
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_graph_capture_audit(rocblas_handle handle, bool enable)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_graph_capture_audit", enable);
+
+    handle->capture_audit = enable;
+    handle->capture_audit_log.clear();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Report the paths recorded by the graph capture audit
+ ******************************************************************************/
+extern "C" rocblas_status
+    rocblas_get_graph_capture_audit(rocblas_handle handle, rocblas_int* count, const char** paths)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!count || (*count > 0 && !paths))
+        return rocblas_status_invalid_pointer;
+
+    size_t logged = handle->capture_audit_log.size();
+    size_t copied = std::min(logged, size_t(std::max(*count, 0)));
+    std::copy_n(handle->capture_audit_log.begin(), copied, paths);
+    *count = rocblas_int(logged);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Enable or disable asynchronous host pointer mode results
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_async_host_results(rocblas_handle handle, bool enable)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_async_host_results", enable);
+
+    handle->async_host_results = enable;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Get the event recorded after asynchronous host pointer mode results
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_host_results_event(rocblas_handle handle, hipEvent_t* event)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!event)
+        return rocblas_status_invalid_pointer;
+
+    return handle->get_host_results_event(event);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Open an asynchronous call group on the handle
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_group_begin(rocblas_handle handle, rocblas_int num_streams)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_group_begin", num_streams);
+
+    if(num_streams < 0)
+        return rocblas_status_invalid_size;
+    if(handle->is_group_open())
+        return rocblas_status_invalid_value;
+
+    return handle->begin_group(num_streams ? num_streams : handle->GROUP_DEFAULT_STREAMS);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Close the asynchronous call group of the handle
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_group_end(rocblas_handle handle)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_group_end");
+
+    if(!handle->is_group_open())
+        return rocblas_status_invalid_value;
+
+    return handle->end_group();
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Report the results of the asynchronous numerics checks
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_check_numerics_status(rocblas_handle handle)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_check_numerics_status");
+
+    return handle->report_check_numerics_flags();
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ *! \brief   get rocblas stream used for all subsequent library function calls.
+ *   If not set, all hip kernels will take the default NULL stream.
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_stream(rocblas_handle handle, hipStream_t* stream_id)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!stream_id)
+        return rocblas_status_invalid_pointer;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_stream", *stream_id);
+    *stream_id = handle->get_stream();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Strided vectors of small elements are copied by packing them contiguously,
+ * since hipMemcpy2D with rows of only a few bytes is very slow on most DMA
+ * engines. The host side is gathered or scattered by several threads, and the
+ * device side by a kernel into a staging buffer, so that the transfer itself
+ * is a single contiguous copy. Threads are only started for vectors of 2 MiB
+ * or more, where their start up is small next to the copy.
+ ******************************************************************************/
+constexpr size_t      VECTOR_PACK_MAX_ELEM_SIZE    = 16;
+constexpr int64_t     VECTOR_PACK_MIN_N            = 1024;
+constexpr size_t      VECTOR_PACK_MIN_BYTES_THREAD = 1 << 20;
+constexpr size_t      VECTOR_PACK_MAX_THREADS      = 8;
+constexpr rocblas_int VECTOR_PACK_DIM_X            = 256;
+constexpr int64_t     VECTOR_PACK_MAX_BLOCKS       = 65536;
+
+ROCBLAS_KERNEL(VECTOR_PACK_DIM_X)
+rocblas_copy_void_ptr_vector_kernel(int64_t     n,
+                                    size_t      elem_size_u64,
+                                    const void* x,
+                                    int64_t     incx,
+                                    void*       y,
+                                    int64_t     incy)
+{
+    for(int64_t i = blockIdx.x * int64_t(blockDim.x) + threadIdx.x; i < n;
+        i += int64_t(gridDim.x) * blockDim.x)
+        memcpy((char*)y + size_t(i) * incy * elem_size_u64,
+               (const char*)x + size_t(i) * incx * elem_size_u64,
+               elem_size_u64);
+}
+
+// Copies n elements between host vectors, splitting large vectors over several threads
+static void rocblas_host_copy_strided_vector(int64_t     n,
+                                             size_t      elem_size_u64,
+                                             const void* x,
+                                             int64_t     incx,
+                                             void*       y,
+                                             int64_t     incy)
+{
+    auto copy = [=](int64_t begin, int64_t end) {
+        const char* src = static_cast<const char*>(x) + size_t(begin) * incx * elem_size_u64;
+        char*       dst = static_cast<char*>(y) + size_t(begin) * incy * elem_size_u64;
+        for(int64_t i = begin; i < end; ++i)
+        {
+            memcpy(dst, src, elem_size_u64);
+            src += size_t(incx) * elem_size_u64;
+            dst += size_t(incy) * elem_size_u64;
+        }
+    };
+
+    size_t num_threads = std::min({size_t(std::thread::hardware_concurrency()),
+                                   n * elem_size_u64 / VECTOR_PACK_MIN_BYTES_THREAD,
+                                   VECTOR_PACK_MAX_THREADS});
+    if(num_threads <= 1)
+        return copy(0, n);
+
+    // The calling thread copies the last part
+    int64_t                  chunk = (n + num_threads - 1) / num_threads;
+    std::vector<std::thread> threads;
+    for(int64_t begin = 0; begin + chunk < n; begin += chunk)
+        threads.emplace_back(copy, begin, begin + chunk);
+    copy(int64_t(threads.size()) * chunk, n);
+    for(auto& thread : threads)
+        thread.join();
+}
+
+// Whether a strided vector copy is done by packing instead of with hipMemcpy2D
+static bool rocblas_pack_strided_vector(int64_t n, size_t elem_size_u64)
+{
+    return elem_size_u64 <= VECTOR_PACK_MAX_ELEM_SIZE && n >= VECTOR_PACK_MIN_N;
+}
+
+// Copies a strided vector with hipMemcpy2D, each element being a row
+static hipError_t rocblas_memcpy_strided_vector(void*         y,
+                                                int64_t       incy,
+                                                const void*   x,
+                                                int64_t       incx,
+                                                size_t        elem_size_u64,
+                                                int64_t       n,
+                                                hipMemcpyKind kind)
+{
+    return hipMemcpy2D(y, elem_size_u64 * incy, x, elem_size_u64 * incx, elem_size_u64, n, kind);
+}
+
+/*******************************************************************************
+ * Staging buffers of the packed copies, one pair per device. They are kept
+ * between calls and only grow, so that repeated copies do not allocate. A copy
+ * holds the mutex until it has completed, since all copies of a device share
+ * its buffers. The buffers are never released, as hipFree may not be called
+ * once the HIP runtime is torn down at exit.
+ ******************************************************************************/
+struct rocblas_vector_pack_staging
+{
+    std::mutex              mutex;
+    void*                   device      = nullptr;
+    size_t                  device_size = 0;
+    std::unique_ptr<char[]> host;
+    size_t                  host_size = 0;
+
+    // Returns a device buffer of at least bytes, or nullptr if it cannot be allocated
+    void* get_device(size_t bytes)
+    {
+        if(bytes > device_size)
+        {
+            if(device)
+                (void)(hipFree)(device);
+            device_size = 0;
+            if((hipMalloc)(&device, bytes) != hipSuccess)
+            {
+                (void)hipGetLastError(); // clear the out of memory error
+                device = nullptr;
+                return nullptr;
+            }
+            device_size = bytes;
+        }
+        return device;
+    }
+
+    // Returns a host buffer of at least bytes, or nullptr if it cannot be allocated
+    char* get_host(size_t bytes)
+    {
+        if(bytes > host_size)
+        {
+            host.reset(new(std::nothrow) char[bytes]);
+            host_size = host ? bytes : 0;
+        }
+        return host.get();
+    }
+};
+
+// Returns the staging buffers of the current device
+static rocblas_vector_pack_staging* rocblas_get_vector_pack_staging()
+{
+    static auto* staging = [] {
+        int count = 0;
+        if(hipGetDeviceCount(&count) != hipSuccess)
+            count = 0;
+        return new std::vector<rocblas_vector_pack_staging>(std::max(count, 1));
+    }();
+
+    int device = 0;
+    if(hipGetDevice(&device) != hipSuccess || device < 0 || size_t(device) >= staging->size())
+        return nullptr;
+    return &(*staging)[device];
+}
+
+// Copies a strided host vector to a strided device vector through contiguous buffers,
+// falling back to hipMemcpy2D when a buffer cannot be allocated
+static rocblas_status rocblas_set_vector_packed(
+    int64_t n, size_t elem_size_u64, const void* x_h, int64_t incx, void* y_d, int64_t incy)
+{
+    size_t bytes   = elem_size_u64 * n;
+    auto*  staging = rocblas_get_vector_pack_staging();
+    if(!staging)
+    {
+        RETURN_IF_HIP_ERROR(rocblas_memcpy_strided_vector(
+            y_d, incy, x_h, incx, elem_size_u64, n, hipMemcpyHostToDevice));
         return rocblas_status_success;
+    }
 
-    //Verify if the new stream is in capture mode
-    hipStreamCaptureStatus stream_status = hipStreamCaptureStatusNone;
-    if(stream != 0)
+    std::lock_guard<std::mutex> lock(staging->mutex);
+
+    // Gather the host vector
+    const void* src     = x_h;
+    int64_t     inc_src = incx;
+    if(incx != 1)
     {
-        bool status = hipStreamIsCapturing(stream, &stream_status) == hipSuccess;
+        char* packed_h = staging->get_host(bytes);
+        if(packed_h)
+        {
+            rocblas_host_copy_strided_vector(n, elem_size_u64, x_h, incx, packed_h, 1);
+            src     = packed_h;
+            inc_src = 1;
+        }
+    }
 
-        if(!status)
-            return rocblas_status_invalid_value;
+    if(inc_src == 1 && incy == 1)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpy(y_d, src, bytes, hipMemcpyHostToDevice));
+        return rocblas_status_success;
     }
 
-    // Stream capture does not allow use of hipStreamQuery
-    // If the current stream or new stream is in capture mode, skip use of hipStreamQuery()
-    if((handle->stream == 0 || !handle->is_stream_in_capture_mode())
-       && stream_status == hipStreamCaptureStatusNone)
+    // Copy to a contiguous temporary, and scatter it into the device vector
+    void* packed_d = inc_src == 1 ? staging->get_device(bytes) : nullptr;
+    if(!packed_d)
     {
-        // The new stream must be valid
-        if(stream != 0 && hipStreamQuery(stream) == hipErrorInvalidHandle)
-            return rocblas_status_invalid_value;
+        RETURN_IF_HIP_ERROR(rocblas_memcpy_strided_vector(
+            y_d, incy, src, inc_src, elem_size_u64, n, hipMemcpyHostToDevice));
+        return rocblas_status_success;
     }
 
-    // Set the new stream
-    handle->stream = stream;
+    RETURN_IF_HIP_ERROR(hipMemcpy(packed_d, src, bytes, hipMemcpyHostToDevice));
+
+    int64_t blocks = std::min((n - 1) / VECTOR_PACK_DIM_X + 1, VECTOR_PACK_MAX_BLOCKS);
+    ROCBLAS_LAUNCH_KERNEL(rocblas_copy_void_ptr_vector_kernel,
+                          dim3(blocks),
+                          dim3(VECTOR_PACK_DIM_X),
+                          0,
+                          0,
+                          n,
+                          elem_size_u64,
+                          packed_d,
+                          1,
+                          y_d,
+                          incy);
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(0));
     return rocblas_status_success;
 }
-catch(...)
-{
-    return exception_to_rocblas_status();
-}
 
-/*******************************************************************************
- *! \brief   get rocblas stream used for all subsequent library function calls.
- *   If not set, all hip kernels will take the default NULL stream.
- ******************************************************************************/
-extern "C" rocblas_status rocblas_get_stream(rocblas_handle handle, hipStream_t* stream_id)
-try
+// Copies a strided device vector to a strided host vector through contiguous buffers,
+// falling back to hipMemcpy2D when a buffer cannot be allocated
+static rocblas_status rocblas_get_vector_packed(
+    int64_t n, size_t elem_size_u64, const void* x_d, int64_t incx, void* y_h, int64_t incy)
 {
-    // if handle not valid
-    if(!handle)
-        return rocblas_status_invalid_handle;
-    if(!stream_id)
-        return rocblas_status_invalid_pointer;
-    if(handle->layer_mode & rocblas_layer_mode_log_trace)
-        log_trace(handle, "rocblas_get_stream", *stream_id);
-    *stream_id = handle->get_stream();
+    size_t bytes   = elem_size_u64 * n;
+    auto*  staging = rocblas_get_vector_pack_staging();
+    if(!staging)
+    {
+        RETURN_IF_HIP_ERROR(rocblas_memcpy_strided_vector(
+            y_h, incy, x_d, incx, elem_size_u64, n, hipMemcpyDeviceToHost));
+        return rocblas_status_success;
+    }
+
+    std::lock_guard<std::mutex> lock(staging->mutex);
+
+    // Gather the device vector into a contiguous temporary
+    const void* src     = x_d;
+    int64_t     inc_src = incx;
+    if(incx != 1)
+    {
+        void* packed_d = staging->get_device(bytes);
+        if(packed_d)
+        {
+            int64_t blocks = std::min((n - 1) / VECTOR_PACK_DIM_X + 1, VECTOR_PACK_MAX_BLOCKS);
+            ROCBLAS_LAUNCH_KERNEL(rocblas_copy_void_ptr_vector_kernel,
+                                  dim3(blocks),
+                                  dim3(VECTOR_PACK_DIM_X),
+                                  0,
+                                  0,
+                                  n,
+                                  elem_size_u64,
+                                  x_d,
+                                  incx,
+                                  packed_d,
+                                  1);
+            src     = packed_d;
+            inc_src = 1;
+        }
+    }
+
+    if(inc_src == 1 && incy == 1)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpy(y_h, src, bytes, hipMemcpyDeviceToHost));
+        return rocblas_status_success;
+    }
+
+    // Copy to a contiguous host buffer, and scatter it into the host vector
+    char* packed_h = inc_src == 1 ? staging->get_host(bytes) : nullptr;
+    if(!packed_h)
+    {
+        RETURN_IF_HIP_ERROR(rocblas_memcpy_strided_vector(
+            y_h, incy, src, inc_src, elem_size_u64, n, hipMemcpyDeviceToHost));
+        return rocblas_status_success;
+    }
+
+    RETURN_IF_HIP_ERROR(hipMemcpy(packed_h, src, bytes, hipMemcpyDeviceToHost));
+    rocblas_host_copy_strided_vector(n, elem_size_u64, packed_h, 1, y_h, incy);
     return rocblas_status_success;
 }
-catch(...)
-{
-    return exception_to_rocblas_status();
-}
 
 /*******************************************************************************
  *! \brief   copies void* vector x with stride incx on host to void* vector
@@ -319,16 +1489,15 @@ try
     {
         PRINT_IF_HIP_ERROR(hipMemcpy(y_d, x_h, elem_size_u64 * n, hipMemcpyHostToDevice));
     }
+    else if(rocblas_pack_strided_vector(n, elem_size_u64))
+    {
+        return rocblas_set_vector_packed(n, elem_size_u64, x_h, incx, y_d, incy);
+    }
     else // either non-contiguous host vector or non-contiguous device vector
     {
         // pretend data is 2D to compensate for non unit increments
-        PRINT_IF_HIP_ERROR(hipMemcpy2D(y_d,
-                                       elem_size_u64 * incy,
-                                       x_h,
-                                       elem_size_u64 * incx,
-                                       elem_size,
-                                       n,
-                                       hipMemcpyHostToDevice));
+        PRINT_IF_HIP_ERROR(rocblas_memcpy_strided_vector(
+            y_d, incy, x_h, incx, elem_size_u64, n, hipMemcpyHostToDevice));
     }
     return rocblas_status_success;
 }
@@ -368,16 +1537,15 @@ try
     {
         PRINT_IF_HIP_ERROR(hipMemcpy(y_h, x_d, elem_size_u64 * n, hipMemcpyDeviceToHost));
     }
+    else if(rocblas_pack_strided_vector(n, elem_size_u64))
+    {
+        return rocblas_get_vector_packed(n, elem_size_u64, x_d, incx, y_h, incy);
+    }
     else
     {
         // pretend data is 2D to compensate for non unit increments
-        PRINT_IF_HIP_ERROR(hipMemcpy2D(y_h,
-                                       elem_size_u64 * incy,
-                                       x_d,
-                                       elem_size_u64 * incx,
-                                       elem_size,
-                                       n,
-                                       hipMemcpyDeviceToHost));
+        PRINT_IF_HIP_ERROR(rocblas_memcpy_strided_vector(
+            y_h, incy, x_d, incx, elem_size_u64, n, hipMemcpyDeviceToHost));
     }
     return rocblas_status_success;
 }
@@ -656,6 +1824,552 @@ extern "C" rocblas_status rocblas_get_matrix(rocblas_int rows,
     return rocblas_get_matrix_64(rows, cols, elem_size, a_d, lda, b_h, ldb);
 }
 
+/*******************************************************************************
+ * Pinned host memory on the NUMA node closest to a device. The node is read from
+ * sysfs for the PCI bus ID of the device, and the pages are allocated under a
+ * preferred policy for that node, which hipHostMalloc follows with
+ * hipHostMallocNumaUser as it touches the pages when pinning them.
+ ******************************************************************************/
+#ifndef WIN32
+static int rocblas_device_numa_node(int device)
+{
+    char bus_id[64];
+    if(hipDeviceGetPCIBusId(bus_id, sizeof(bus_id), device) != hipSuccess)
+        return -1;
+    for(char* c = bus_id; *c; ++c)
+        *c = tolower(*c);
+
+    std::string path = std::string("/sys/bus/pci/devices/") + bus_id + "/numa_node";
+    FILE*       file = fopen(path.c_str(), "r");
+    int         node = -1;
+    if(file)
+    {
+        if(fscanf(file, "%d", &node) != 1)
+            node = -1;
+        fclose(file);
+    }
+    return node;
+}
+#endif
+
+static hipError_t rocblas_host_malloc_near(void** ptr, size_t size, int device)
+{
+#ifndef WIN32
+    // Linux memory policy modes and the size of their node masks, from linux/mempolicy.h
+    constexpr int    MPOL_PREFERRED_MODE = 1;
+    constexpr size_t MAX_NODES           = 1024;
+    constexpr size_t MASK_BITS           = 8 * sizeof(unsigned long);
+
+    int node = rocblas_device_numa_node(device);
+    if(node >= 0 && size_t(node) < MAX_NODES)
+    {
+        int           old_mode = 0;
+        unsigned long old_mask[MAX_NODES / MASK_BITS]{};
+        unsigned long mask[MAX_NODES / MASK_BITS]{};
+        mask[node / MASK_BITS] = 1ul << (node % MASK_BITS);
+
+        if(syscall(SYS_get_mempolicy, &old_mode, old_mask, MAX_NODES, nullptr, 0) == 0
+           && syscall(SYS_set_mempolicy, MPOL_PREFERRED_MODE, mask, MAX_NODES) == 0)
+        {
+            hipError_t status = (hipHostMalloc)(ptr, size, hipHostMallocNumaUser);
+            syscall(SYS_set_mempolicy, old_mode, old_mask, MAX_NODES);
+            return status;
+        }
+    }
+#endif
+    return (hipHostMalloc)(ptr, size, hipHostMallocDefault);
+}
+
+extern "C" rocblas_status rocblas_host_malloc_near_device(void** ptr, size_t size, int device)
+try
+{
+    if(!ptr)
+        return rocblas_status_invalid_pointer;
+    *ptr = nullptr;
+
+    int num_devices = 0;
+    if(hipGetDeviceCount(&num_devices) != hipSuccess || device < 0 || device >= num_devices)
+        return rocblas_status_invalid_value;
+    if(!size)
+        return rocblas_status_success;
+
+    return rocblas_host_malloc_near(ptr, size, device) == hipSuccess
+               ? rocblas_status_success
+               : rocblas_status_memory_error;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+namespace
+{
+    // Returns whether host memory is pageable, i.e. not pinned or registered with HIP
+    bool rocblas_is_pageable(const void* ptr)
+    {
+        unsigned int flags;
+        if(hipHostGetFlags(&flags, const_cast<void*>(ptr)) == hipSuccess)
+            return false;
+        (void)hipGetLastError(); // clear the error set by hipHostGetFlags
+        return true;
+    }
+
+} // namespace
+
+/***************************************************************************
+ * Double-buffered pinned host staging buffers of a handle for the async matrix
+ * copies. hipMemcpy2DAsync with pageable host memory is performed synchronously,
+ * so pageable matrices copied on the stream of a handle with staging buffers
+ * are instead copied in chunks through its pinned buffers, overlapping the
+ * host-side memcpy of one chunk with the DMA of the other. The copy functions
+ * take a stream rather than a handle, so the buffers of the handles are found
+ * by the stream of the copy. The buffers are on the NUMA node closest to the
+ * device, see rocblas_set_pinned_staging_size.
+ ***************************************************************************/
+class rocblas_pinned_staging
+{
+    static constexpr int NUM_BUFFERS = 2;
+
+    rocblas_handle handle;
+    size_t         buffer_size = 0;
+    void*          buffers[NUM_BUFFERS]{};
+    hipEvent_t     events[NUM_BUFFERS]{};
+    std::mutex     mutex;
+
+    // The staging buffers of all handles
+    static std::mutex                           registry_mutex;
+    static std::vector<rocblas_pinned_staging*> registry;
+
+    // Whether the staging buffers can be used for a copy on stream
+    bool usable(const void* host_ptr, hipStream_t stream)
+    {
+        int current_device;
+        if(handle->get_stream() != stream
+           || rocblas_get_current_device(&current_device) != hipSuccess
+           || current_device != handle->getDevice() || !rocblas_is_pageable(host_ptr))
+            return false;
+
+        // Host-side memcpy cannot be captured in a graph
+        hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+        return stream == 0
+               || (hipStreamIsCapturing(stream, &capture_status) == hipSuccess
+                   && capture_status == hipStreamCaptureStatusNone);
+    }
+
+    // Calls copy(col, ncols, row_byte, nbytes, buffer) for each chunk of a column-major
+    // matrix with width bytes per column, so that each chunk fits in one buffer
+    template <typename F>
+    hipError_t for_each_chunk(size_t width, size_t cols, F copy)
+    {
+        size_t chunk_cols  = width <= buffer_size ? std::min(cols, buffer_size / width) : 1;
+        size_t chunk_bytes = std::min(width, buffer_size);
+        int    buf         = 0;
+
+        for(size_t col = 0; col < cols; col += chunk_cols)
+        {
+            size_t ncols = std::min(chunk_cols, cols - col);
+            for(size_t byte = 0; byte < width; byte += chunk_bytes, buf ^= 1)
+            {
+                size_t     nbytes = std::min(chunk_bytes, width - byte);
+                hipError_t status = copy(col, ncols, byte, nbytes, buf);
+                if(status != hipSuccess)
+                    return status;
+            }
+        }
+        return hipSuccess;
+    }
+
+    // Copies a pageable host matrix to the device through the staging buffers
+    void set_matrix_staged(size_t      width,
+                           size_t      cols,
+                           const void* a_h,
+                           size_t      spitch,
+                           void*       b_d,
+                           size_t      dpitch,
+                           hipStream_t stream,
+                           hipError_t& status);
+
+    // Copies a device matrix to pageable host memory through the staging buffers
+    void get_matrix_staged(size_t      width,
+                           size_t      cols,
+                           const void* a_d,
+                           size_t      spitch,
+                           void*       b_h,
+                           size_t      dpitch,
+                           hipStream_t stream,
+                           hipError_t& status);
+
+    // Runs copy on the staging buffers of a handle which can be used for the copy, with
+    // their lock held. Returns false if there are none, and the caller copies directly.
+    template <typename F>
+    static bool with_staging(const void* host_ptr, hipStream_t stream, F copy)
+    {
+        std::unique_lock<std::mutex> registry_lock(registry_mutex);
+        for(rocblas_pinned_staging* staging : registry)
+        {
+            std::unique_lock<std::mutex> lock(staging->mutex, std::try_to_lock);
+            if(lock && staging->usable(host_ptr, stream))
+            {
+                registry_lock.unlock();
+                copy(*staging);
+                return true;
+            }
+        }
+        return false;
+    }
+
+public:
+    // Allocates the buffers; buffer_size stays 0 if they cannot be allocated
+    rocblas_pinned_staging(rocblas_handle handle, size_t size)
+        : handle(handle)
+    {
+        for(int i = 0; i < NUM_BUFFERS; ++i)
+        {
+            if(rocblas_host_malloc_near(&buffers[i], size, handle->getDevice()) != hipSuccess
+               || hipEventCreateWithFlags(&events[i], hipEventDisableTiming) != hipSuccess)
+                return;
+            // Mark the buffer as idle
+            if(hipEventRecord(events[i], 0) != hipSuccess)
+                return;
+        }
+        buffer_size = size;
+
+        std::lock_guard<std::mutex> registry_lock(registry_mutex);
+        registry.push_back(this);
+    }
+
+    // Waits for the copies using the buffers, which the DMA may still read, and frees them
+    ~rocblas_pinned_staging()
+    {
+        {
+            std::lock_guard<std::mutex> registry_lock(registry_mutex);
+            registry.erase(std::remove(registry.begin(), registry.end(), this), registry.end());
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        for(int i = 0; i < NUM_BUFFERS; ++i)
+        {
+            if(events[i])
+            {
+                (void)hipEventSynchronize(events[i]);
+                (void)hipEventDestroy(events[i]);
+            }
+            if(buffers[i])
+                (void)(hipHostFree)(buffers[i]);
+        }
+    }
+
+    bool allocated() const
+    {
+        return buffer_size != 0;
+    }
+
+    rocblas_pinned_staging(const rocblas_pinned_staging&)            = delete;
+    rocblas_pinned_staging& operator=(const rocblas_pinned_staging&) = delete;
+
+    // Copies a pageable host matrix to the device through the staging buffers of a handle.
+    // Returns false if no staging buffers can be used, and the caller copies directly.
+    static bool set_matrix(size_t      width,
+                           size_t      cols,
+                           const void* a_h,
+                           size_t      spitch,
+                           void*       b_d,
+                           size_t      dpitch,
+                           hipStream_t stream,
+                           hipError_t& status)
+    {
+        return with_staging(a_h, stream, [&](rocblas_pinned_staging& staging) {
+            staging.set_matrix_staged(width, cols, a_h, spitch, b_d, dpitch, stream, status);
+        });
+    }
+
+    // Copies a device matrix to pageable host memory through the staging buffers of a handle.
+    // The copy has completed when this returns, as with a pageable hipMemcpy2DAsync.
+    // Returns false if no staging buffers can be used, and the caller copies directly.
+    static bool get_matrix(size_t      width,
+                           size_t      cols,
+                           const void* a_d,
+                           size_t      spitch,
+                           void*       b_h,
+                           size_t      dpitch,
+                           hipStream_t stream,
+                           hipError_t& status)
+    {
+        return with_staging(b_h, stream, [&](rocblas_pinned_staging& staging) {
+            staging.get_matrix_staged(width, cols, a_d, spitch, b_h, dpitch, stream, status);
+        });
+    }
+};
+
+std::mutex                           rocblas_pinned_staging::registry_mutex;
+std::vector<rocblas_pinned_staging*> rocblas_pinned_staging::registry;
+
+/*******************************************************************************
+ * Replace the staging buffers of the handle
+ ******************************************************************************/
+rocblas_status _rocblas_handle::set_pinned_staging_size(size_t size)
+{
+    // The events of the buffers are on the device of the handle
+    auto saved_device_id = push_device_id();
+
+    delete pinned_staging;
+    pinned_staging      = nullptr;
+    pinned_staging_size = 0;
+    if(!size)
+        return rocblas_status_success;
+
+    auto staging = std::make_unique<rocblas_pinned_staging>(this, size);
+    if(!staging->allocated())
+        return rocblas_status_memory_error;
+
+    pinned_staging      = staging.release();
+    pinned_staging_size = size;
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocblas_set_pinned_staging_size(rocblas_handle handle, size_t size)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_pinned_staging_size", size);
+
+    return handle->set_pinned_staging_size(size);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_get_pinned_staging_size(rocblas_handle handle, size_t* size)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!size)
+        return rocblas_status_invalid_pointer;
+
+    *size = handle->pinned_staging_size;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+void rocblas_pinned_staging::set_matrix_staged(size_t      width,
+                                               size_t      cols,
+                                               const void* a_h,
+                                               size_t      spitch,
+                                               void*       b_d,
+                                               size_t      dpitch,
+                                               hipStream_t stream,
+                                               hipError_t& status)
+{
+    status = for_each_chunk(
+        width, cols, [&](size_t col, size_t ncols, size_t byte, size_t nbytes, int buf) {
+            // Wait until the previous DMA out of this buffer has completed
+            hipError_t err = hipEventSynchronize(events[buf]);
+            if(err != hipSuccess)
+                return err;
+
+            // Pack the chunk contiguously into the pinned buffer
+            char* pinned = static_cast<char*>(buffers[buf]);
+            for(size_t j = 0; j < ncols; ++j)
+                memcpy(pinned + j * nbytes,
+                       static_cast<const char*>(a_h) + (col + j) * spitch + byte,
+                       nbytes);
+
+            err = hipMemcpy2DAsync(static_cast<char*>(b_d) + col * dpitch + byte,
+                                   dpitch,
+                                   pinned,
+                                   nbytes,
+                                   nbytes,
+                                   ncols,
+                                   hipMemcpyHostToDevice,
+                                   stream);
+            return err != hipSuccess ? err : hipEventRecord(events[buf], stream);
+        });
+}
+
+void rocblas_pinned_staging::get_matrix_staged(size_t      width,
+                                               size_t      cols,
+                                               const void* a_d,
+                                               size_t      spitch,
+                                               void*       b_h,
+                                               size_t      dpitch,
+                                               hipStream_t stream,
+                                               hipError_t& status)
+{
+    // Unpacks the chunk in buffer buf once its DMA has completed
+    struct
+    {
+        size_t col, ncols, byte, nbytes;
+        int    buf = -1;
+    } pending;
+
+    auto unpack = [&]() {
+        if(pending.buf < 0)
+            return hipSuccess;
+        hipError_t err = hipEventSynchronize(events[pending.buf]);
+        if(err != hipSuccess)
+            return err;
+
+        const char* pinned = static_cast<const char*>(buffers[pending.buf]);
+        for(size_t j = 0; j < pending.ncols; ++j)
+            memcpy(static_cast<char*>(b_h) + (pending.col + j) * dpitch + pending.byte,
+                   pinned + j * pending.nbytes,
+                   pending.nbytes);
+        pending.buf = -1;
+        return hipSuccess;
+    };
+
+    status = for_each_chunk(
+        width, cols, [&](size_t col, size_t ncols, size_t byte, size_t nbytes, int buf) {
+            hipError_t err
+                = hipMemcpy2DAsync(buffers[buf],
+                                   nbytes,
+                                   static_cast<const char*>(a_d) + col * spitch + byte,
+                                   spitch,
+                                   nbytes,
+                                   ncols,
+                                   hipMemcpyDeviceToHost,
+                                   stream);
+            if(err == hipSuccess)
+                err = hipEventRecord(events[buf], stream);
+
+            // Unpack the previous chunk while this one is being transferred
+            if(err == hipSuccess)
+                err = unpack();
+
+            pending = {col, ncols, byte, nbytes, buf};
+            return err;
+        });
+
+    if(status == hipSuccess)
+        status = unpack();
+}
+
+namespace
+{
+    /***************************************************************************
+     * Internal streams splitting large async matrix copies with pinned host
+     * memory into bands of columns, so that the bands are spread over the DMA
+     * engines of the device instead of serializing on one. The internal streams
+     * are forked from and joined back to the stream of the copy with events,
+     * keeping the copy ordered with the other work of that stream.
+     * Enabled by setting ROCBLAS_COPY_STREAMS to the number of internal
+     * streams; copies smaller than ROCBLAS_COPY_SPLIT_SIZE bytes (default
+     * 64 MiB) are not split. The streams live for the lifetime of the process.
+     ***************************************************************************/
+    class rocblas_copy_streams
+    {
+        static constexpr int MAX_STREAMS = 8;
+
+        int         num_streams = 0;
+        int         device      = -1;
+        size_t      split_size  = size_t(64) << 20;
+        hipStream_t streams[MAX_STREAMS]{};
+        hipEvent_t  fork{};
+        hipEvent_t  joins[MAX_STREAMS]{};
+        std::mutex  mutex;
+
+        rocblas_copy_streams()
+        {
+            const char* env = getenv("ROCBLAS_COPY_STREAMS");
+            int         num = env ? std::min(atoi(env), MAX_STREAMS) : 0;
+            if(num < 2 || hipGetDevice(&device) != hipSuccess)
+                return;
+
+            const char* size = getenv("ROCBLAS_COPY_SPLIT_SIZE");
+            if(size)
+                split_size = strtoull(size, nullptr, 0);
+
+            if(hipEventCreateWithFlags(&fork, hipEventDisableTiming) != hipSuccess)
+                return;
+            for(int i = 0; i < num; ++i)
+            {
+                if(hipStreamCreateWithFlags(&streams[i], hipStreamNonBlocking) != hipSuccess
+                   || hipEventCreateWithFlags(&joins[i], hipEventDisableTiming) != hipSuccess)
+                    return;
+            }
+            num_streams = num;
+        }
+
+    public:
+        static rocblas_copy_streams& instance()
+        {
+            // Intentionally never destroyed, since HIP may be shut down before static destructors
+            static auto* copy_streams = new rocblas_copy_streams;
+            return *copy_streams;
+        }
+
+        // Copies a column-major matrix with width bytes per column in one band of columns per
+        // internal stream, or in bands of bytes if it has a single column.
+        // Returns false if the copy is not split, and the caller copies directly.
+        bool copy_matrix(size_t        width,
+                         size_t        cols,
+                         const void*   src,
+                         size_t        spitch,
+                         void*         dst,
+                         size_t        dpitch,
+                         hipMemcpyKind kind,
+                         hipStream_t   stream,
+                         hipError_t&   status)
+        {
+            if(!num_streams || width * cols < split_size)
+                return false;
+
+            int current_device;
+            if(rocblas_get_current_device(&current_device) != hipSuccess
+               || current_device != device
+               || rocblas_is_pageable(kind == hipMemcpyHostToDevice ? src : dst))
+                return false;
+
+            std::unique_lock<std::mutex> lock(mutex, std::try_to_lock);
+            if(!lock)
+                return false;
+
+            size_t extent = cols == 1 ? width : cols;
+            size_t band   = (extent - 1) / num_streams + 1;
+
+            status = hipEventRecord(fork, stream);
+            for(int i = 0; i < num_streams && status == hipSuccess && i * band < extent; ++i)
+            {
+                size_t first = i * band;
+                size_t count = std::min(band, extent - first);
+
+                status = hipStreamWaitEvent(streams[i], fork, 0);
+                if(status != hipSuccess)
+                    break;
+
+                if(cols == 1)
+                    status = hipMemcpyAsync(static_cast<char*>(dst) + first,
+                                            static_cast<const char*>(src) + first,
+                                            count,
+                                            kind,
+                                            streams[i]);
+                else
+                    status = hipMemcpy2DAsync(static_cast<char*>(dst) + first * dpitch,
+                                              dpitch,
+                                              static_cast<const char*>(src) + first * spitch,
+                                              spitch,
+                                              width,
+                                              count,
+                                              kind,
+                                              streams[i]);
+
+                if(status == hipSuccess)
+                    status = hipEventRecord(joins[i], streams[i]);
+                if(status == hipSuccess)
+                    status = hipStreamWaitEvent(stream, joins[i], 0);
+            }
+            return true;
+        }
+    };
+} // namespace
+
 /*******************************************************************************
  *! \brief   copies void* matrix a_h with leading dimentsion lda on host to
      void* matrix b_d with leading dimension ldb on device. Matrices have
@@ -680,8 +2394,53 @@ try
 
     size_t elem_size_u64(elem_size);
 
+    // pageable host matrix -> device matrix, pipelined through pinned staging buffers
+    hipError_t staging_status;
+    if(lda == rows && ldb == rows
+           ? rocblas_pinned_staging::set_matrix(elem_size_u64 * rows * cols,
+                                                1,
+                                                a_h,
+                                                0,
+                                                b_d,
+                                                0,
+                                                stream,
+                                                staging_status)
+           : rocblas_pinned_staging::set_matrix(elem_size_u64 * rows,
+                                                cols,
+                                                a_h,
+                                                elem_size_u64 * lda,
+                                                b_d,
+                                                elem_size_u64 * ldb,
+                                                stream,
+                                                staging_status))
+    {
+        PRINT_IF_HIP_ERROR(staging_status);
+    }
+    // large pinned host matrix -> device matrix, split over the internal copy streams
+    else if(lda == rows && ldb == rows
+                ? rocblas_copy_streams::instance().copy_matrix(elem_size_u64 * rows * cols,
+                                                               1,
+                                                               a_h,
+                                                               0,
+                                                               b_d,
+                                                               0,
+                                                               hipMemcpyHostToDevice,
+                                                               stream,
+                                                               staging_status)
+                : rocblas_copy_streams::instance().copy_matrix(elem_size_u64 * rows,
+                                                               cols,
+                                                               a_h,
+                                                               elem_size_u64 * lda,
+                                                               b_d,
+                                                               elem_size_u64 * ldb,
+                                                               hipMemcpyHostToDevice,
+                                                               stream,
+                                                               staging_status))
+    {
+        PRINT_IF_HIP_ERROR(staging_status);
+    }
     // contiguous host matrix -> contiguous device matrix
-    if(lda == rows && ldb == rows)
+    else if(lda == rows && ldb == rows)
     {
         size_t bytes_to_copy = elem_size_u64 * rows * cols;
         PRINT_IF_HIP_ERROR(hipMemcpyAsync(b_d, a_h, bytes_to_copy, hipMemcpyHostToDevice, stream));
@@ -742,8 +2501,53 @@ try
 
     size_t elem_size_u64(elem_size);
 
+    // device matrix -> pageable host matrix, pipelined through pinned staging buffers
+    hipError_t staging_status;
+    if(lda == rows && ldb == rows
+           ? rocblas_pinned_staging::get_matrix(elem_size_u64 * rows * cols,
+                                                1,
+                                                a_d,
+                                                0,
+                                                b_h,
+                                                0,
+                                                stream,
+                                                staging_status)
+           : rocblas_pinned_staging::get_matrix(elem_size_u64 * rows,
+                                                cols,
+                                                a_d,
+                                                elem_size_u64 * lda,
+                                                b_h,
+                                                elem_size_u64 * ldb,
+                                                stream,
+                                                staging_status))
+    {
+        PRINT_IF_HIP_ERROR(staging_status);
+    }
+    // large device matrix -> pinned host matrix, split over the internal copy streams
+    else if(lda == rows && ldb == rows
+                ? rocblas_copy_streams::instance().copy_matrix(elem_size_u64 * rows * cols,
+                                                               1,
+                                                               a_d,
+                                                               0,
+                                                               b_h,
+                                                               0,
+                                                               hipMemcpyDeviceToHost,
+                                                               stream,
+                                                               staging_status)
+                : rocblas_copy_streams::instance().copy_matrix(elem_size_u64 * rows,
+                                                               cols,
+                                                               a_d,
+                                                               elem_size_u64 * lda,
+                                                               b_h,
+                                                               elem_size_u64 * ldb,
+                                                               hipMemcpyDeviceToHost,
+                                                               stream,
+                                                               staging_status))
+    {
+        PRINT_IF_HIP_ERROR(staging_status);
+    }
     // contiguous host matrix -> contiguous device matrix
-    if(lda == rows && ldb == rows)
+    else if(lda == rows && ldb == rows)
     {
         size_t bytes_to_copy = elem_size_u64 * rows * cols;
         PRINT_IF_HIP_ERROR(hipMemcpyAsync(b_h, a_d, bytes_to_copy, hipMemcpyDeviceToHost, stream));
@@ -779,6 +2583,182 @@ extern "C" rocblas_status rocblas_get_matrix_async(rocblas_int rows,
     return rocblas_get_matrix_async_64(rows, cols, elem_size, a_d, lda, b_h, ldb, stream);
 }
 
+/*******************************************************************************
+ * Enables access of device to the memory of peer, once per pair of devices, so
+ * that copies between them go over the peer link instead of through the host.
+ * Returns whether access is enabled.
+ ******************************************************************************/
+static bool rocblas_enable_peer_access(int device, int peer)
+{
+    static std::mutex              mutex;
+    static std::map<int64_t, bool> enabled;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto                        it = enabled.find(int64_t(device) << 32 | peer);
+    if(it != enabled.end())
+        return it->second;
+
+    int  can_access = 0, old_device = -1;
+    bool access     = false;
+    if(hipDeviceCanAccessPeer(&can_access, device, peer) == hipSuccess && can_access
+       && hipGetDevice(&old_device) == hipSuccess && hipSetDevice(device) == hipSuccess)
+    {
+        hipError_t status = hipDeviceEnablePeerAccess(peer, 0);
+        access            = status == hipSuccess || status == hipErrorPeerAccessAlreadyEnabled;
+        (void)hipGetLastError();
+        (void)hipSetDevice(old_device);
+    }
+    enabled.emplace(int64_t(device) << 32 | peer, access);
+    return access;
+}
+
+/*******************************************************************************
+ *! \brief   copies batch_count void* matrices a with leading dimension lda on
+     device src_device to void* matrices b with leading dimension ldb on device
+     dst_device. Matrices have size rows * cols with element size elem_size, and
+     are stride_a and stride_b elements apart.
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_copy_matrix_peer_strided_batched_async_64(int64_t     rows,
+                                                                          int64_t     cols,
+                                                                          int64_t     elem_size,
+                                                                          const void* a,
+                                                                          int64_t     lda,
+                                                                          int64_t     stride_a,
+                                                                          int         src_device,
+                                                                          void*       b,
+                                                                          int64_t     ldb,
+                                                                          int64_t     stride_b,
+                                                                          int         dst_device,
+                                                                          int64_t     batch_count,
+                                                                          hipStream_t stream)
+try
+{
+    if(rows == 0 || cols == 0 || batch_count == 0) // quick return
+        return rocblas_status_success;
+    if(rows < 0 || cols < 0 || lda <= 0 || ldb <= 0 || rows > lda || rows > ldb || elem_size <= 0
+       || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(!a || !b)
+        return rocblas_status_invalid_pointer;
+
+    int num_devices = 0;
+    if(hipGetDeviceCount(&num_devices) != hipSuccess || src_device < 0 || dst_device < 0
+       || src_device >= num_devices || dst_device >= num_devices)
+        return rocblas_status_invalid_value;
+
+    // The copy engines of either device may serve the copy
+    if(src_device != dst_device)
+    {
+        rocblas_enable_peer_access(dst_device, src_device);
+        rocblas_enable_peer_access(src_device, dst_device);
+    }
+
+    size_t elem_size_u64(elem_size);
+
+    // contiguous matrices -> contiguous matrices, one linear copy
+    if(lda == rows && ldb == rows
+       && (batch_count == 1 || (stride_a == rows * cols && stride_b == rows * cols)))
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(b,
+                                           a,
+                                           elem_size_u64 * rows * cols * batch_count,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+    }
+    // batches which are slices of 3D arrays, whose strides are multiples of their leading
+    // dimensions of at least cols columns, one 3D copy
+    else if(batch_count > 1 && stride_a % lda == 0 && stride_b % ldb == 0
+            && stride_a / lda >= cols && stride_b / ldb >= cols)
+    {
+        hipMemcpy3DParms params{};
+        params.srcPtr = make_hipPitchedPtr(
+            const_cast<void*>(a), elem_size_u64 * lda, elem_size_u64 * rows, stride_a / lda);
+        params.dstPtr
+            = make_hipPitchedPtr(b, elem_size_u64 * ldb, elem_size_u64 * rows, stride_b / ldb);
+        params.extent = make_hipExtent(elem_size_u64 * rows, cols, batch_count);
+        params.kind   = hipMemcpyDeviceToDevice;
+        RETURN_IF_HIP_ERROR(hipMemcpy3DAsync(&params, stream));
+    }
+    // otherwise one 2D copy per matrix
+    else
+    {
+        for(int64_t i = 0; i < batch_count; i++)
+            RETURN_IF_HIP_ERROR(
+                hipMemcpy2DAsync(static_cast<char*>(b) + elem_size_u64 * stride_b * i,
+                                 elem_size_u64 * ldb,
+                                 static_cast<const char*>(a) + elem_size_u64 * stride_a * i,
+                                 elem_size_u64 * lda,
+                                 elem_size_u64 * rows,
+                                 cols,
+                                 hipMemcpyDeviceToDevice,
+                                 stream));
+    }
+    return rocblas_status_success;
+}
+catch(...) // catch all exceptions
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_copy_matrix_peer_strided_batched_async(rocblas_int    rows,
+                                                                         rocblas_int    cols,
+                                                                         rocblas_int    elem_size,
+                                                                         const void*    a,
+                                                                         rocblas_int    lda,
+                                                                         rocblas_stride stride_a,
+                                                                         int            src_device,
+                                                                         void*          b,
+                                                                         rocblas_int    ldb,
+                                                                         rocblas_stride stride_b,
+                                                                         int            dst_device,
+                                                                         rocblas_int    batch_count,
+                                                                         hipStream_t    stream)
+{
+    return rocblas_copy_matrix_peer_strided_batched_async_64(rows,
+                                                             cols,
+                                                             elem_size,
+                                                             a,
+                                                             lda,
+                                                             stride_a,
+                                                             src_device,
+                                                             b,
+                                                             ldb,
+                                                             stride_b,
+                                                             dst_device,
+                                                             batch_count,
+                                                             stream);
+}
+
+extern "C" rocblas_status rocblas_copy_matrix_peer_async_64(int64_t     rows,
+                                                          int64_t     cols,
+                                                          int64_t     elem_size,
+                                                          const void* a,
+                                                          int64_t     lda,
+                                                          int         src_device,
+                                                          void*       b,
+                                                          int64_t     ldb,
+                                                          int         dst_device,
+                                                          hipStream_t stream)
+{
+    return rocblas_copy_matrix_peer_strided_batched_async_64(
+        rows, cols, elem_size, a, lda, 0, src_device, b, ldb, 0, dst_device, 1, stream);
+}
+
+extern "C" rocblas_status rocblas_copy_matrix_peer_async(rocblas_int rows,
+                                                       rocblas_int cols,
+                                                       rocblas_int elem_size,
+                                                       const void* a,
+                                                       rocblas_int lda,
+                                                       int         src_device,
+                                                       void*       b,
+                                                       rocblas_int ldb,
+                                                       int         dst_device,
+                                                       hipStream_t stream)
+{
+    return rocblas_copy_matrix_peer_strided_batched_async_64(
+        rows, cols, elem_size, a, lda, 0, src_device, b, ldb, 0, dst_device, 1, stream);
+}
+
 // Convert rocblas_status to string
 extern "C" const char* rocblas_status_to_string(rocblas_status status)
 {
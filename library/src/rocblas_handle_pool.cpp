@@ -0,0 +1,251 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas-auxiliary.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+/*******************************************************************************
+ * A bounded set of handles lent to threads. The handles are clones of a handle
+ * of the pool, each with a workspace of its own, which is reused in stream
+ * order when a handle is lent to another stream.
+ ******************************************************************************/
+struct _rocblas_handle_pool
+{
+    struct slot
+    {
+        rocblas_handle  handle    = nullptr;
+        void*           workspace = nullptr;
+        hipEvent_t      released  = nullptr; // recorded on the stream of the last borrower
+        std::thread::id borrower;
+        bool            in_use = false;
+    };
+
+    rocblas_handle          base = nullptr; // configuration of the handles, never lent
+    size_t                  workspace_size;
+    rocblas_int             max_handles;
+    std::vector<slot>       slots;
+    std::mutex              mutex;
+    std::condition_variable slot_released;
+
+    ~_rocblas_handle_pool()
+    {
+        auto saved_device_id = base->push_device_id();
+        for(auto& s : slots)
+            release_slot(s);
+        PRINT_IF_ROCBLAS_ERROR(rocblas_destroy_handle(base));
+    }
+
+    // The handles do not own their workspace, and freeing it waits for their work
+    static void release_slot(slot& s)
+    {
+        if(s.handle)
+            PRINT_IF_ROCBLAS_ERROR(rocblas_destroy_handle(s.handle));
+        if(s.workspace)
+            PRINT_IF_HIP_ERROR((hipFree)(s.workspace));
+        if(s.released)
+            PRINT_IF_HIP_ERROR(hipEventDestroy(s.released));
+    }
+
+    // Add a slot, with a clone of base using a new workspace
+    rocblas_status add_slot()
+    {
+        auto           saved_device_id = base->push_device_id();
+        slot           s;
+        rocblas_status status = rocblas_clone_handle(base, &s.handle);
+        if(status == rocblas_status_success
+           && (hipMalloc)(&s.workspace, workspace_size) != hipSuccess)
+            status = rocblas_status_memory_error;
+        if(status == rocblas_status_success)
+            status = rocblas_internal_convert_hip_to_rocblas_status(
+                hipEventCreateWithFlags(&s.released, hipEventDisableTiming));
+        if(status == rocblas_status_success)
+            status = rocblas_set_workspace(s.handle, s.workspace, workspace_size);
+
+        if(status == rocblas_status_success)
+            slots.push_back(s);
+        else
+            release_slot(s);
+        return status;
+    }
+};
+
+/*******************************************************************************
+ * Create a pool of up to max_handles handles on the current device
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_create_handle_pool(rocblas_handle_pool* pool,
+                                                     rocblas_int          max_handles,
+                                                     size_t               workspace_size)
+try
+{
+    if(!pool)
+        return rocblas_status_invalid_pointer;
+    *pool = nullptr;
+    if(max_handles < 1)
+        return rocblas_status_invalid_size;
+
+    auto created = std::make_unique<_rocblas_handle_pool>();
+    RETURN_IF_ROCBLAS_ERROR(rocblas_create_handle(&created->base));
+
+    if(created->base->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(created->base, "rocblas_create_handle_pool", max_handles, workspace_size);
+
+    created->workspace_size
+        = workspace_size ? workspace_size : created->base->getDefaultDeviceMemorySize();
+    created->max_handles = max_handles;
+
+    // Slots are never moved, as lent handles refer to them
+    created->slots.reserve(max_handles);
+
+    *pool = created.release();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Destroy a pool and its handles, which must all have been released
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_destroy_handle_pool(rocblas_handle_pool pool)
+try
+{
+    if(!pool)
+        return rocblas_status_invalid_pointer;
+
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        for(const auto& s : pool->slots)
+            if(s.in_use)
+                return rocblas_status_invalid_value;
+    }
+
+    delete pool;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Lend a handle of the pool to the calling thread, to enqueue on stream, or on
+ * the per-thread default stream of the calling thread if stream is 0. The handle
+ * the thread released last is preferred. If all max_handles handles are lent,
+ * waits for one to be released.
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_handle_pool_acquire(rocblas_handle_pool pool,
+                                                      hipStream_t         stream,
+                                                      rocblas_handle*     handle)
+try
+{
+    if(!pool || !handle)
+        return rocblas_status_invalid_pointer;
+
+    auto thread = std::this_thread::get_id();
+
+    _rocblas_handle_pool::slot* lent = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(pool->mutex);
+        while(!lent)
+        {
+            for(auto& s : pool->slots)
+            {
+                if(s.in_use)
+                    continue;
+                if(!lent || s.borrower == thread)
+                    lent = &s;
+                if(s.borrower == thread)
+                    break;
+            }
+
+            if(!lent && pool->slots.size() < size_t(pool->max_handles))
+            {
+                RETURN_IF_ROCBLAS_ERROR(pool->add_slot());
+                lent = &pool->slots.back();
+            }
+
+            if(!lent)
+                pool->slot_released.wait(lock);
+        }
+        lent->in_use   = true;
+        lent->borrower = thread;
+    }
+
+    if(!stream)
+        stream = hipStreamPerThread;
+
+    // The workspace may still be in use by work of the previous borrower on another stream
+    auto saved_device_id = lent->handle->push_device_id();
+    RETURN_IF_HIP_ERROR(hipStreamWaitEvent(stream, lent->released, 0));
+    RETURN_IF_ROCBLAS_ERROR(rocblas_set_stream(lent->handle, stream));
+
+    *handle = lent->handle;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Return a handle to the pool. Its work need not have completed: the next
+ * borrower of the handle waits for it in stream order.
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_handle_pool_release(rocblas_handle_pool pool,
+                                                      rocblas_handle      handle)
+try
+{
+    if(!pool)
+        return rocblas_status_invalid_pointer;
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    for(auto& s : pool->slots)
+    {
+        if(s.handle != handle || !s.in_use)
+            continue;
+
+        auto saved_device_id = handle->push_device_id();
+        RETURN_IF_HIP_ERROR(hipEventRecord(s.released, handle->get_stream()));
+
+        // Handles are lent with the configuration of the pool
+        RETURN_IF_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pool->base->pointer_mode));
+        RETURN_IF_ROCBLAS_ERROR(rocblas_set_atomics_mode(handle, pool->base->atomics_mode));
+
+        s.in_use = false;
+        pool->slot_released.notify_one();
+        return rocblas_status_success;
+    }
+
+    // Not a lent handle of this pool
+    return rocblas_status_invalid_handle;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
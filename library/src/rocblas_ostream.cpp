@@ -198,6 +198,12 @@ void rocblas_internal_ostream::flush()
 void rocblas_internal_ostream::clear_workers()
 {
     std::lock_guard<std::recursive_mutex> lock(worker_map_mutex());
+
+    // Workers which are still referenced write out their queue
+    for(auto& p : worker_map())
+        if(p.second && p.second.use_count() > 1)
+            p.second->drain();
+
     worker_map().clear();
 }
 
@@ -216,96 +222,183 @@ std::ostream& rocblas_internal_ostream::yaml_off(std::ostream& os)
  * rocblas_internal_ostream::worker functions handle logging in a single thread *
  ***********************************************************************/
 
-// Send a string to the worker thread for this stream's device/inode
-// Empty strings tell the worker thread to exit
-void rocblas_internal_ostream::worker::send(std::string str)
+// Claim the record at the next position of the queue, waiting while the queue is full
+rocblas_internal_ostream::worker::record& rocblas_internal_ostream::worker::claim(size_t& pos)
 {
-    // Create a promise to wait for the operation to complete
-    std::promise<void> promise;
-
-    // The future indicating when the operation has completed
-    auto future = promise.get_future();
-
-#ifdef WIN32
-    // Passing an empty string will make the worker thread exit.
-    // The below flag will be used to handle worker thread exit condition for Windows
-    bool empty_string = str.empty();
-#endif
+    pos = m_tail.load(std::memory_order_relaxed);
+    while(true)
+    {
+        record&   r    = m_queue[pos % queue_size];
+        ptrdiff_t diff = ptrdiff_t(r.seq.load(std::memory_order_acquire) - pos);
+        if(!diff)
+        {
+            // The record is free, claim it unless another thread claimed it first
+            if(m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                r.format = nullptr;
+                r.done   = nullptr;
+                r.exit   = false;
+                return r;
+            }
+        }
+        else
+        {
+            // The queue is full, the worker thread has not read the record of the last round
+            if(diff < 0)
+                std::this_thread::yield();
+            pos = m_tail.load(std::memory_order_relaxed);
+        }
+    }
+}
 
-    // task_t consists of string and promise
-    // std::move transfers ownership of str and promise to task
-    task_t worker_task(std::move(str), std::move(promise));
+// Hand a record to the worker thread, waking it up if it waits for records
+void rocblas_internal_ostream::worker::publish(record& r, size_t pos)
+{
+    r.seq.store(pos + 1, std::memory_order_release);
 
-    // Submit the task to the worker assigned to this device/inode
-    // Hold mutex for as short as possible, to reduce contention
+    // Pairs with the fence of the worker thread between setting m_sleeping and checking the queue
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if(m_sleeping.load(std::memory_order_relaxed))
     {
         std::lock_guard<std::mutex> lock(m_mutex);
-        m_queue.push(std::move(worker_task));
-
-        // no lock needed for notification but keeping here
         m_cond.notify_one();
     }
+}
+
+// Hand a record to the worker thread and wait until it has been written
+void rocblas_internal_ostream::worker::publish_and_wait(record& r, size_t pos)
+{
+    // Create a promise to wait for the operation to complete
+    std::promise<void> promise;
+
+    // The future indicating when the operation has completed
+    auto future = promise.get_future();
 
-// Wait for the task to be completed, to ensure flushed IO
+    bool exit = r.exit;
+    r.done    = &promise;
+    publish(r, pos);
+
+// Wait for the record to be written, to ensure flushed IO
 #ifdef WIN32
-    if(empty_string)
+    if(exit)
         // Occassionaly this thread is not getting the promise set by the 'worker' thread during exit condition.
         // Added a timed wait to exit after one second, if we do not get the promise from worker thread.
         future.wait_for(std::chrono::seconds(1));
     else
         future.get();
 #else
+    (void)exit;
     future.get();
 #endif
 }
 
+void rocblas_internal_ostream::worker::format_string(void* data, rocblas_internal_ostream& os)
+{
+    auto& str = *static_cast<std::string*>(data);
+    os.m_os << str;
+    str.~basic_string();
+}
+
+// Queue a string for the worker thread, without waiting
+void rocblas_internal_ostream::worker::post_string(std::string&& str)
+{
+    size_t  pos;
+    record& r = claim(pos);
+    new(r.data) std::string(std::move(str));
+    r.format = format_string;
+    publish(r, pos);
+}
+
+// Send a string to the worker thread for this stream's device/inode, waiting until it is written
+// Empty strings tell the worker thread to exit
+void rocblas_internal_ostream::worker::send(std::string str)
+{
+    size_t  pos;
+    record& r = claim(pos);
+    if(str.size())
+    {
+        new(r.data) std::string(std::move(str));
+        r.format = format_string;
+    }
+    else
+        r.exit = true;
+    publish_and_wait(r, pos);
+}
+
+// Wait until the records queued so far have been written
+void rocblas_internal_ostream::worker::drain()
+{
+    size_t  pos;
+    record& r = claim(pos);
+    publish_and_wait(r, pos);
+}
+
 // Worker thread which serializes data to be written to a device/inode
 void rocblas_internal_ostream::worker::thread_function()
 {
     // Clear any errors in the FILE
     clearerr(m_file);
 
-    // Lock the mutex in preparation for cond.wait
-    std::unique_lock<std::mutex> lock(m_mutex);
+    // Stream formatting the records
+    rocblas_internal_ostream os;
+
+    // After an error the records are still read, so that writers do not wait, but not written
+    bool failed = false;
+    auto check  = [&](bool error) {
+        if(error && !failed)
+        {
+            perror("Error writing log file");
+            failed = true;
+        }
+    };
 
     while(true)
     {
-        // Wait for any data, ignoring spurious wakeups, locks lock on continue
-        m_cond.wait(lock, [&] { return !m_queue.empty(); });
-
-        // With the mutex locked, get and pop data from the front of queue
-        task_t task = std::move(m_queue.front());
-        m_queue.pop();
+        record& r     = m_queue[m_head % queue_size];
+        auto    ready = [&] { return r.seq.load(std::memory_order_acquire) == m_head + 1; };
 
-        // Temporarily unlock queue mutex, unblocking other threads
-        lock.unlock();
-
-        // An empty message indicates the closing of the stream
-        if(!task.size())
+        if(!ready())
         {
-            // Tell future to wake up
-            task.set_value();
-            break;
+            // Flush the C FILE stream while the queue is empty, and wait for records
+            if(!failed)
+                check(ferror(m_file) || fflush(m_file));
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_sleeping.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            m_cond.wait(lock, ready);
+            m_sleeping.store(false, std::memory_order_relaxed);
         }
 
+        // Format the line or string held by the record
+        if(r.format)
+            r.format(r.data, os);
+        std::promise<void>* done = r.done;
+        bool                exit = r.exit;
+
+        // Free the record for the next round of the queue
+        r.seq.store(m_head + queue_size, std::memory_order_release);
+        m_head++;
+
         // Write the data
-        fwrite(task.data(), 1, task.size(), m_file);
+        std::string str = os.str();
+        os.clear();
+        if(!failed && str.size())
+            check(fwrite(str.data(), 1, str.size(), m_file) != str.size());
 
-        // Detect any error and flush the C FILE stream
-        if(ferror(m_file) || fflush(m_file))
+        // Records which are waited for are flushed before the writer is woken up
+        if(done)
         {
-            perror("Error writing log file");
+            if(!failed)
+                check(ferror(m_file) || fflush(m_file));
 
-            // Tell future to wake up
-            task.set_value();
-            break;
+            // Promise that the data has been written
+            done->set_value();
         }
 
-        // Promise that the data has been written
-        task.set_value();
-
-        // Re-lock the mutex in preparation for cond.wait
-        lock.lock();
+        // An exit record indicates the closing of the stream
+        if(exit)
+            break;
     }
 }
 
@@ -326,6 +419,11 @@ rocblas_internal_ostream::worker::worker(int fd)
         rocblas_abort();
     }
 
+    // The records are free for the first round of the queue
+    m_queue.reset(new record[queue_size]);
+    for(size_t pos = 0; pos < queue_size; pos++)
+        m_queue[pos].seq.store(pos, std::memory_order_relaxed);
+
     // Create a worker thread, capturing *this
     m_thread = std::thread([=] { thread_function(); });
 
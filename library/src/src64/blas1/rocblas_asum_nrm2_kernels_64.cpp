@@ -41,144 +41,24 @@ rocblas_status rocblas_internal_asum_nrm2_launcher_64(rocblas_handle handle,
                                                       To*            workspace,
                                                       Tr*            result)
 {
-    int64_t n_passes = (n_64 - 1) / c_i64_grid_X_chunk + 1;
-
-    if(std::abs(incx_64) <= c_i32_max)
-    {
-        if(n_64 <= c_i32_max && batch_count_64 < c_i64_grid_YZ_chunk)
-        {
-            // valid to use original 32bit API with truncated 64bit args
-            return rocblas_internal_asum_nrm2_launcher<rocblas_int, NB, FETCH, FINALIZE>(
-                handle, n_64, x, shiftx, incx_64, stridex, batch_count_64, workspace, result);
-        }
-
-        for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
-        {
-            auto    x_ptr       = adjust_ptr_batch(x, b_base, stridex);
-            int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
-
-            Tr* output = &result[b_base];
-            if(handle->pointer_mode == rocblas_pointer_mode_host)
-            {
-                output = (Tr*)(workspace);
-            }
-
-            // Additional workspace if n_passes as result are only partial sum
-            To* partial_results = (To*)(workspace);
-
-            for(int64_t n_base = 0, pass = 0; n_base < n_64; n_base += c_i64_grid_X_chunk, pass++)
-            {
-                int32_t n = int32_t(std::min(n_64 - n_base, c_i64_grid_X_chunk));
-
-                int64_t offsetx = shiftx + n_base * incx_64; // negative inc is quick return
-
-                // 32bit API call
-                rocblas_status status = rocblas_internal_asum_nrm2_kernel_launcher<false,
-                                                                                   rocblas_int,
-                                                                                   NB,
-                                                                                   FETCH,
-                                                                                   FINALIZE>(
-                    handle,
-                    rocblas_int(n),
-                    x_ptr,
-                    offsetx,
-                    rocblas_int(incx_64),
-                    stridex,
-                    batch_count,
-                    workspace + n_passes * batch_count,
-                    partial_results + pass * batch_count);
-                if(status != rocblas_status_success)
-                    return status;
-            }
-            // sum final partial_results to output
-            ROCBLAS_LAUNCH_KERNEL((rocblas_reduction_kernel_part2_64<true, NB, FINALIZE>),
-                                  dim3(1, batch_count),
-                                  dim3(NB),
-                                  0,
-                                  handle->get_stream(),
-                                  n_passes,
-                                  partial_results,
-                                  output);
-
-            // Transfer final output to result
-            if(handle->pointer_mode == rocblas_pointer_mode_host)
-            {
-                RETURN_IF_HIP_ERROR(hipMemcpyAsync(&result[b_base],
-                                                   output,
-                                                   sizeof(Tr) * batch_count,
-                                                   hipMemcpyDeviceToHost,
-                                                   handle->get_stream()));
-            }
-        }
-    }
-    else
+    if(std::abs(incx_64) <= c_i32_max && n_64 <= c_i32_max && batch_count_64 < c_i64_grid_YZ_chunk)
     {
-        for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
-        {
-            auto    x_ptr       = adjust_ptr_batch(x, b_base, stridex);
-            int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
-
-            Tr* output = &result[b_base];
-            if(handle->pointer_mode == rocblas_pointer_mode_host)
-            {
-                output = (Tr*)(workspace);
-            }
-
-            // Additional workspace if n_passes as result are only partial sum
-            To* partial_results = (To*)(workspace);
-
-            for(int64_t n_base = 0, pass = 0; n_base < n_64; n_base += c_i64_grid_X_chunk, pass++)
-            {
-                int32_t n = int32_t(std::min(n_64 - n_base, c_i64_grid_X_chunk));
-
-                // in case of negative inc only partial sums are doing summation in that direction
-                int64_t offsetx = shiftx + n_base * incx_64; // negative inc is quick return
-
-                // new instantiation for 64bit incx/y
-                rocblas_status status = rocblas_internal_asum_nrm2_kernel_launcher<false,
-                                                                                   int64_t,
-                                                                                   NB,
-                                                                                   FETCH,
-                                                                                   FINALIZE>(
-                    handle,
-                    rocblas_int(n),
-                    x_ptr,
-                    offsetx,
-                    incx_64,
-                    stridex,
-                    batch_count,
-                    workspace + n_passes * batch_count,
-                    partial_results + pass * batch_count);
-                if(status != rocblas_status_success)
-                    return status;
-            }
-            // sum final partial_results to output
-            ROCBLAS_LAUNCH_KERNEL((rocblas_reduction_kernel_part2_64<true, NB, FINALIZE>),
-                                  dim3(1, batch_count),
-                                  dim3(NB),
-                                  0,
-                                  handle->get_stream(),
-                                  n_passes,
-                                  partial_results,
-                                  output);
-
-            // Transfer final output to result
-            if(handle->pointer_mode == rocblas_pointer_mode_host)
-            {
-                RETURN_IF_HIP_ERROR(hipMemcpyAsync(&result[b_base],
-                                                   output,
-                                                   sizeof(Tr) * batch_count,
-                                                   hipMemcpyDeviceToHost,
-                                                   handle->get_stream()));
-            }
-        }
+        // valid to use original 32bit API with truncated 64bit args
+        return rocblas_internal_asum_nrm2_launcher<rocblas_int, NB, FETCH, FINALIZE>(
+            handle, n_64, x, shiftx, incx_64, stridex, batch_count_64, workspace, result);
     }
-    if(handle->pointer_mode == rocblas_pointer_mode_host)
-    {
-        // sync here to match legacy BLAS
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
-    }
-    return rocblas_status_success;
+
+    // negative inc is quick return
+    auto views = [=](int64_t b_base) {
+        return rocblas_asum_nrm2_view_64<API_INT, FETCH, TPtrX>{
+            rocblas_make_batch_window(x, b_base, batch_count_64 - b_base),
+            shiftx,
+            incx_64,
+            stridex};
+    };
+
+    return rocblas_reduction_launcher_64<NB, 1, rocblas_reduce_sum, FINALIZE>(
+        handle, n_64, batch_count_64, views, workspace, result);
 }
 
 // Instantiations below will need to be manually updated to match any change in
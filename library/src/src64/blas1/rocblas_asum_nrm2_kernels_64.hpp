@@ -26,84 +26,23 @@
 #include "int64_helpers.hpp"
 #include "rocblas_asum_nrm2_64.hpp"
 #include "rocblas_block_sizes.h"
+#include "rocblas_reduction_64.hpp"
 
 #include "blas1/rocblas_asum_nrm2.hpp" // rocblas_int API called
 #include "blas1/rocblas_asum_nrm2_kernels.hpp" // inst kernels with int64_t
 
-// rocblas_reduction_kernel_part2_64 gathers all the partial results in workspace and finishes the final reduction;
-template <bool is_finalize, int NB, typename FINALIZE, typename To, typename Tr>
-ROCBLAS_KERNEL(NB)
-rocblas_reduction_kernel_part2_64(rocblas_int nblocks, To* workspace, Tr* result)
+// elements of the batches of x for rocblas_reduction_kernel_64
+template <typename API_INT, typename FETCH, typename TPtrX>
+struct rocblas_asum_nrm2_view_64
 {
-    rocblas_int tx = threadIdx.x;
-    To          sum;
+    rocblas_batch_window<TPtrX> x;
+    rocblas_stride              shiftx;
+    API_INT                     incx;
+    rocblas_stride              stridex;
 
-    if(tx < nblocks)
+    __device__ auto operator()(uint32_t batch) const
     {
-        To* work = workspace + blockIdx.y * nblocks;
-        sum      = work[tx];
-
-        // bound, loop
-        for(rocblas_int i = tx + NB; i < nblocks; i += NB)
-            sum += work[i];
-    }
-    else
-    { // pad with default value
-        sum = rocblas_default_value<To>{}();
+        const auto* xb = load_ptr_batch(x, batch, shiftx, stridex);
+        return [xb, incx = int64_t(incx)](int64_t i) { return FETCH{}(xb[i * incx]); };
     }
-
-    sum = rocblas_dot_block_reduce<NB, To>(sum);
-
-    // Store result on device or in workspace
-    if(tx == 0)
-        result[blockIdx.y] = Tr(is_finalize ? FINALIZE{}(sum) : sum);
-}
-
-//Using specialized launcher which does the FINALIZE only when bool is_finalize is true.
-template <bool is_finalize,
-          typename API_INT,
-          int NB,
-          typename FETCH,
-          typename FINALIZE,
-          typename TPtrX,
-          typename To,
-          typename Tr>
-rocblas_status rocblas_internal_asum_nrm2_kernel_launcher(rocblas_handle handle,
-                                                          rocblas_int    n,
-                                                          TPtrX          x,
-                                                          rocblas_stride shiftx,
-                                                          API_INT        incx,
-                                                          rocblas_stride stridex,
-                                                          rocblas_int    batch_count,
-                                                          To*            workspace,
-                                                          Tr*            result)
-{
-    // param REDUCE is always SUM for these kernels so not passed on
-
-    rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB);
-
-    //Calling the original rocblas_reduction_kernel_part1 kernel in rocbblas_asum_nrm2_kernels.hpp
-    ROCBLAS_LAUNCH_KERNEL((rocblas_reduction_kernel_part1<API_INT, NB, FETCH>),
-                          dim3(blocks, batch_count),
-                          NB,
-                          0,
-                          handle->get_stream(),
-                          n,
-                          blocks,
-                          x,
-                          shiftx,
-                          incx,
-                          stridex,
-                          workspace);
-
-    ROCBLAS_LAUNCH_KERNEL((rocblas_reduction_kernel_part2_64<is_finalize, NB, FINALIZE>),
-                          dim3(1, batch_count),
-                          NB,
-                          0,
-                          handle->get_stream(),
-                          blocks,
-                          workspace,
-                          result);
-
-    return rocblas_status_success;
-}
+};
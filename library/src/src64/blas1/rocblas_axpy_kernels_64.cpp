@@ -27,6 +27,38 @@
 #include "rocblas_axpy_64.hpp"
 #include "rocblas_block_sizes.h"
 
+//!
+//! @brief 64-bit kernel of axpy, the grid strides over n and over the batch.
+//!
+template <rocblas_int NB, typename Tex, typename Ta, typename Tx, typename Ty>
+ROCBLAS_KERNEL(NB)
+rocblas_axpy_kernel_64(int64_t                  n,
+                       Ta                       alpha_device_host,
+                       rocblas_stride           stride_alpha,
+                       rocblas_batch_window<Tx> x,
+                       rocblas_stride           offset_x,
+                       int64_t                  incx,
+                       rocblas_stride           stride_x,
+                       rocblas_batch_window<Ty> y,
+                       rocblas_stride           offset_y,
+                       int64_t                  incy,
+                       rocblas_stride           stride_y)
+{
+    for(int64_t b = blockIdx.y; b < y.count; b += gridDim.y)
+    {
+        auto alpha = load_scalar_64(alpha_device_host, b, stride_alpha);
+        if(!alpha)
+            continue;
+
+        auto* tx = load_ptr_batch(x, b, offset_x, stride_x);
+        auto* ty = load_ptr_batch(y, b, offset_y, stride_y);
+
+        for(int64_t tid = blockIdx.x * int64_t(NB) + threadIdx.x; tid < n;
+            tid += int64_t(gridDim.x) * NB)
+            ty[tid * incy] = ty[tid * incy] + Tex(alpha) * tx[tid * incx];
+    }
+}
+
 template <typename API_INT, rocblas_int NB, typename Tex, typename Ta, typename Tx, typename Ty>
 rocblas_status rocblas_internal_axpy_launcher_64(rocblas_handle handle,
                                                  API_INT        n,
@@ -48,112 +80,71 @@ rocblas_status rocblas_internal_axpy_launcher_64(rocblas_handle handle,
         return rocblas_status_success;
     }
 
-    if(incx < c_i32_max && incy < c_i32_max && incx > c_i32_min && incy > c_i32_min)
+    if(incx < c_i32_max && incy < c_i32_max && incx > c_i32_min && incy > c_i32_min
+       && n <= c_i64_grid_X_chunk && batch_count < c_i64_grid_YZ_chunk)
     {
-        // increments can fit in int32_t
-        for(int64_t b = 0; b < batch_count; b += c_i64_grid_YZ_chunk)
-        {
-            auto    x_ptr         = adjust_ptr_batch(x, b, stride_x);
-            auto    y_ptr         = adjust_ptr_batch(y, b, stride_y);
-            int32_t batch_count32 = int32_t(std::min(batch_count - b, c_i64_grid_YZ_chunk));
-
-            auto alpha_ptr = rocblas_pointer_mode_device == handle->pointer_mode
-                                 ? alpha + b * stride_alpha
-                                 : alpha;
-
-            for(int64_t n_base = 0; n_base < n; n_base += c_i64_grid_X_chunk)
-            {
-                int32_t n32 = int32_t(std::min(n - n_base, c_i64_grid_X_chunk));
-
-                // If negative we inc we still need to start at end of array.
-                // This offset shifts to start of 32-bit arrays beginning with last
-                // 32-bit array, launcher shifts to end of array.
-                int64_t shiftx
-                    = offset_x + ((incx < 0) ? -incx * (n - n32 - n_base) : n_base * incx);
-                int64_t shifty
-                    = offset_y + ((incy < 0) ? -incy * (n - n32 - n_base) : n_base * incy);
-
-                // 32-bit API call
-                rocblas_status status
-                    = rocblas_internal_axpy_launcher<rocblas_int, NB, Tex>(handle,
-                                                                           rocblas_int(n32),
-                                                                           alpha_ptr,
-                                                                           stride_alpha,
-                                                                           x_ptr,
-                                                                           shiftx,
-                                                                           rocblas_int(incx),
-                                                                           stride_x,
-                                                                           y_ptr,
-                                                                           shifty,
-                                                                           rocblas_int(incy),
-                                                                           stride_y,
-                                                                           batch_count32);
-
-                if(status != rocblas_status_success)
-                    return status;
-            }
-        }
+        // valid to use original 32bit API with truncated 64bit args
+        return rocblas_internal_axpy_launcher<rocblas_int, NB, Tex>(handle,
+                                                                    rocblas_int(n),
+                                                                    alpha,
+                                                                    stride_alpha,
+                                                                    x,
+                                                                    offset_x,
+                                                                    rocblas_int(incx),
+                                                                    stride_x,
+                                                                    y,
+                                                                    offset_y,
+                                                                    rocblas_int(incy),
+                                                                    stride_y,
+                                                                    rocblas_int(batch_count));
     }
-    else
-    {
-        // increments need 64 bits, can't ust 32-bit launcher
-        for(int64_t b = 0; b < batch_count; b += c_i64_grid_YZ_chunk)
-        {
-            auto    x_ptr         = adjust_ptr_batch(x, b, stride_x);
-            auto    y_ptr         = adjust_ptr_batch(y, b, stride_y);
-            int32_t batch_count32 = int32_t(std::min(batch_count - b, c_i64_grid_YZ_chunk));
 
-            for(int64_t n_base = 0; n_base < n; n_base += c_i64_grid_X_chunk)
-            {
-                int32_t n32 = int32_t(std::min(n - n_base, c_i64_grid_X_chunk));
+    // Not using launcher, so shifting to very end of 64-bit array
+    int64_t shiftx = offset_x + ((incx < 0) ? -incx * (n - 1) : 0);
+    int64_t shifty = offset_y + ((incy < 0) ? -incy * (n - 1) : 0);
 
-                int  blocks = (n32 - 1) / NB + 1;
-                dim3 grid(blocks, batch_count32);
-                dim3 threads(NB);
+    int64_t blocks = std::min((n - 1) / NB + 1, c_i64_grid_X_chunk);
+    dim3    threads(NB);
 
-                // Not using launcher, so shifting to very end of 64-bit array
-                int64_t shiftx
-                    = offset_x + ((incx < 0) ? -incx * ((n - 1 - n_base)) : n_base * incx);
-                int64_t shifty
-                    = offset_y + ((incy < 0) ? -incy * ((n - 1 - n_base)) : n_base * incy);
+    // one launch covers all of n and all batches
+    dim3 grid(blocks, std::min(int64_t(batch_count), c_i64_grid_YZ_chunk));
+    auto x_w = rocblas_make_batch_window(x, 0, batch_count);
+    auto y_w = rocblas_make_batch_window(y, 0, batch_count);
 
-                if(handle->pointer_mode == rocblas_pointer_mode_device)
-                    ROCBLAS_LAUNCH_KERNEL((rocblas_axpy_kernel<int64_t, NB, Tex>),
-                                          grid,
-                                          threads,
-                                          0,
-                                          handle->get_stream(),
-                                          n32,
-                                          alpha + b * stride_alpha,
-                                          stride_alpha,
-                                          x_ptr,
-                                          shiftx,
-                                          incx,
-                                          stride_x,
-                                          y_ptr,
-                                          shifty,
-                                          incy,
-                                          stride_y);
-                else
-                    ROCBLAS_LAUNCH_KERNEL((rocblas_axpy_kernel<int64_t, NB, Tex>),
-                                          grid,
-                                          threads,
-                                          0,
-                                          handle->get_stream(),
-                                          n32,
-                                          *alpha,
-                                          stride_alpha,
-                                          x_ptr,
-                                          shiftx,
-                                          incx,
-                                          stride_x,
-                                          y_ptr,
-                                          shifty,
-                                          incy,
-                                          stride_y);
-            }
-        }
-    }
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+        ROCBLAS_LAUNCH_KERNEL((rocblas_axpy_kernel_64<NB, Tex>),
+                              grid,
+                              threads,
+                              0,
+                              handle->get_stream(),
+                              n,
+                              alpha,
+                              stride_alpha,
+                              x_w,
+                              shiftx,
+                              incx,
+                              stride_x,
+                              y_w,
+                              shifty,
+                              incy,
+                              stride_y);
+    else
+        ROCBLAS_LAUNCH_KERNEL((rocblas_axpy_kernel_64<NB, Tex>),
+                              grid,
+                              threads,
+                              0,
+                              handle->get_stream(),
+                              n,
+                              *alpha,
+                              stride_alpha,
+                              x_w,
+                              shiftx,
+                              incx,
+                              stride_x,
+                              y_w,
+                              shifty,
+                              incy,
+                              stride_y);
 
     return rocblas_status_success;
 }
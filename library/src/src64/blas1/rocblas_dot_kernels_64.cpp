@@ -28,6 +28,31 @@
 #include "blas1/rocblas_dot.hpp" // int32 API called
 #include "blas1/rocblas_dot_kernels.hpp"
 
+#include "rocblas_reduction_64.hpp"
+
+// products of the elements of the batches of x and y for rocblas_reduction_kernel_64
+template <bool CONJ, typename V, typename U>
+struct rocblas_dot_view_64
+{
+    rocblas_batch_window<U> x;
+    rocblas_stride          shiftx;
+    int64_t                 incx;
+    rocblas_stride          stridex;
+    rocblas_batch_window<U> y;
+    rocblas_stride          shifty;
+    int64_t                 incy;
+    rocblas_stride          stridey;
+
+    __device__ auto operator()(uint32_t batch) const
+    {
+        const auto* xb = load_ptr_batch(x, batch, shiftx, stridex);
+        const auto* yb = load_ptr_batch(y, batch, shifty, stridey);
+        return [xb, yb, incx = incx, incy = incy](int64_t i) {
+            return V(yb[i * incy]) * V(CONJ ? conj(xb[i * incx]) : xb[i * incx]);
+        };
+    }
+};
+
 // assume workspace has already been allocated, recommended for repeated calling of dot_strided_batched product
 // routine
 template <typename API_INT, int NB, bool CONJ, typename T, typename U, typename V>
@@ -45,11 +70,6 @@ rocblas_status rocblas_internal_dot_launcher_64(rocblas_handle __restrict__ hand
                                                 T* __restrict__ results,
                                                 V* __restrict__ workspace)
 {
-
-    // Original launcher may only provide partial results
-    // Second reduction used for all iterative results within a batch
-    // batch_count loops are independent results so don't require additional reduction
-
     // Quick return if possible.
     if(n_64 <= 0 || batch_count_64 == 0)
     {
@@ -68,263 +88,45 @@ rocblas_status rocblas_internal_dot_launcher_64(rocblas_handle __restrict__ hand
         return rocblas_status_success;
     }
 
-    static constexpr int WIN      = rocblas_dot_WIN<T>();
-    int64_t              n_passes = (n_64 - 1) / c_i64_grid_X_chunk + 1;
-
-    if(std::abs(incx_64) <= c_i32_max && std::abs(incy_64) < c_i32_max)
-    {
-        if(n_64 <= c_i32_max && batch_count_64 < c_i64_grid_YZ_chunk)
-        {
-            // valid to use original 32bit API with truncated 64bit args
-            return rocblas_internal_dot_launcher<rocblas_int, NB, CONJ, T, U, V>(handle,
-                                                                                 n_64,
-                                                                                 x,
-                                                                                 offsetx,
-                                                                                 incx_64,
-                                                                                 stridex,
-                                                                                 y,
-                                                                                 offsety,
-                                                                                 incy_64,
-                                                                                 stridey,
-                                                                                 batch_count_64,
-                                                                                 results,
-                                                                                 workspace);
-        }
-
-        for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
-        {
-            auto    x_ptr       = adjust_ptr_batch(x, b_base, stridex);
-            auto    y_ptr       = adjust_ptr_batch(y, b_base, stridey);
-            int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
-
-            T* output = &results[b_base];
-            if(handle->pointer_mode == rocblas_pointer_mode_host)
-            {
-                output = (T*)(workspace);
-            }
-
-            // additional workspace if n_passes as results are only partial sum
-            V* partial_results = (V*)(workspace);
-
-            for(int64_t n_base = 0, pass = 0; n_base < n_64; n_base += c_i64_grid_X_chunk, pass++)
-            {
-                int32_t n = int32_t(std::min(n_64 - n_base, c_i64_grid_X_chunk));
-
-                int64_t shiftx
-                    = offsetx + (incx_64 < 0 ? -incx_64 * (n_64 - n - n_base) : n_base * incx_64);
-                int64_t shifty
-                    = offsety + (incy_64 < 0 ? -incy_64 * (n_64 - n - n_base) : n_base * incy_64);
-
-                // 32bit API call but with new instantiation for V, U, V for high precision output
-                rocblas_status status
-                    = rocblas_internal_dot_launcher<rocblas_int, NB, CONJ, V, U, V>(
-                        handle,
-                        n,
-                        x_ptr,
-                        shiftx,
-                        int32_t(incx_64),
-                        stridex,
-                        y_ptr,
-                        shifty,
-                        int32_t(incy_64),
-                        stridey,
-                        batch_count,
-                        partial_results + pass * batch_count,
-                        workspace + n_passes * batch_count);
-                if(status != rocblas_status_success)
-                    return status;
-            }
-            // reduce n partitions within batch chunk
-
-            // sum partial_results to results always needed if only to down convert
-            ROCBLAS_LAUNCH_KERNEL((rocblas_dot_kernel_reduce<NB, WIN>),
-                                  dim3(1, batch_count),
-                                  dim3(NB),
-                                  0,
-                                  handle->get_stream(),
-                                  n_passes,
-                                  partial_results,
-                                  output);
-
-            if(handle->pointer_mode == rocblas_pointer_mode_host)
-            {
-                RETURN_IF_HIP_ERROR(hipMemcpyAsync(&results[b_base],
-                                                   output,
-                                                   sizeof(T) * batch_count,
-                                                   hipMemcpyDeviceToHost,
-                                                   handle->get_stream()));
-            }
-
-        } // for chunk of batches
-    } // small incx/y
-    else
-    { // int64_t incx/y
-
-        static constexpr int single_block_threshold = rocblas_dot_one_block_threshold<T>();
-
-        if(n_64 > single_block_threshold)
-        {
-            // non single block closer to form above reusing 32bit API
-
-            static constexpr bool ONE_BLOCK = false;
-
-            for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
-            {
-                auto    x_ptr = adjust_ptr_batch(x, b_base, stridex);
-                auto    y_ptr = adjust_ptr_batch(y, b_base, stridey);
-                int32_t batch_count
-                    = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
-
-                T* output = &results[b_base];
-                if(handle->pointer_mode == rocblas_pointer_mode_host)
-                {
-                    output = (T*)(workspace);
-                }
-
-                // additional workspace if n_passes as results are only partial sum
-                V* partial_results = (V*)(workspace);
-
-                {
-                    // defeat synch copy of partial results by pushing pointer_mode_device
-
-                    // cppcheck-suppress unreadVariable
-                    auto saved_pointer_mode
-                        = handle->push_pointer_mode(rocblas_pointer_mode_device);
-
-                    for(int64_t n_base = 0, pass = 0; n_base < n_64;
-                        n_base += c_i64_grid_X_chunk, pass++)
-                    {
-                        int32_t n      = int32_t(std::min(n_64 - n_base, c_i64_grid_X_chunk));
-                        int64_t blocks = rocblas_reduction_kernel_block_count(n, NB * WIN);
-
-                        // in case of negative inc only partial sums are doing summation in that direction
-                        int64_t shiftx
-                            = offsetx
-                              + (incx_64 < 0 ? -incx_64 * (n_64 - n - n_base) : n_base * incx_64);
-                        int64_t shifty
-                            = offsety
-                              + (incy_64 < 0 ? -incy_64 * (n_64 - n - n_base) : n_base * incy_64);
-
-                        // 32bit template call but with new instantiation for V, U, V for high precision output
-                        rocblas_status status
-                            = rocblas_internal_dot_launcher<int64_t, NB, CONJ, V, U, V>(
-                                handle,
-                                n,
-                                x_ptr,
-                                shiftx,
-                                (incx_64),
-                                stridex,
-                                y_ptr,
-                                shifty,
-                                (incy_64),
-                                stridey,
-                                batch_count,
-                                partial_results + pass * batch_count,
-                                workspace + n_passes * batch_count);
-                        if(status != rocblas_status_success)
-                            return status;
-
-                    } // for n
-
-                } // original pointer mode
-
-                // reduce n partitions within batch chunk
-                // sum partial_results to results always needed as may down convert
-                ROCBLAS_LAUNCH_KERNEL((rocblas_dot_kernel_reduce<NB, WIN>),
-                                      dim3(1, batch_count),
-                                      dim3(NB),
-                                      0,
-                                      handle->get_stream(),
-                                      n_passes,
-                                      partial_results,
-                                      output);
-
-                if(handle->pointer_mode == rocblas_pointer_mode_host)
-                {
-                    RETURN_IF_HIP_ERROR(hipMemcpyAsync(&results[b_base],
-                                                       output,
-                                                       sizeof(T) * batch_count,
-                                                       hipMemcpyDeviceToHost,
-                                                       handle->get_stream()));
-                }
-
-            } // for batch
-        } // not single block
-        else
-        {
-            // single block so no n looping required
-
-            // we only reduce the block count to 1 so safe to ignore extra workspace allocated in caller
-            int32_t n = n_64;
-
-            // in case of negative inc shift pointer to end of data for negative indexing tid*inc
-            int64_t shiftx = incx_64 < 0 ? offsetx - (incx_64) * (n - 1) : offsetx;
-            int64_t shifty = incx_64 < 0 ? offsety - (incx_64) * (n - 1) : offsety;
-
-            static constexpr int NB_OB  = 1024;
-            static constexpr int WIN_OB = 32; // 32K max n threshold, assert guard below
-
-            int64_t blocks = rocblas_reduction_kernel_block_count(n, NB_OB * WIN_OB);
-            assert(blocks == 1);
-            static constexpr bool ONE_BLOCK = true;
-
-            for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
-            {
-                auto    x_ptr = adjust_ptr_batch(x, b_base, stridex);
-                auto    y_ptr = adjust_ptr_batch(y, b_base, stridey);
-                int32_t batch_count
-                    = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
-
-                T* output = &results[b_base];
-                if(handle->pointer_mode == rocblas_pointer_mode_host)
-                {
-                    output = (T*)(workspace);
-                }
-
-                {
-                    // defeat synch copy of partial results by pushing pointer_mode_device
-                    auto saved_pointer_mode
-                        = handle->push_pointer_mode(rocblas_pointer_mode_device);
-
-                    rocblas_status status
-                        = rocblas_internal_dot_launcher<int64_t, NB, CONJ, T, U, V>(handle,
-                                                                                    n,
-                                                                                    x_ptr,
-                                                                                    shiftx,
-                                                                                    (incx_64),
-                                                                                    stridex,
-                                                                                    y_ptr,
-                                                                                    shifty,
-                                                                                    (incy_64),
-                                                                                    stridey,
-                                                                                    batch_count,
-                                                                                    output,
-                                                                                    workspace);
-                    if(status != rocblas_status_success)
-                        return status;
-
-                } // pointer mode override
-
-                if(handle->pointer_mode == rocblas_pointer_mode_host)
-                {
-                    // non sync as partial results
-                    RETURN_IF_HIP_ERROR(hipMemcpyAsync(&results[b_base],
-                                                       output,
-                                                       sizeof(T) * batch_count,
-                                                       hipMemcpyDeviceToHost,
-                                                       handle->get_stream()));
-                }
-            } // for batch
-        } // single block
-    }
-
-    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    if(std::abs(incx_64) <= c_i32_max && std::abs(incy_64) <= c_i32_max && n_64 <= c_i32_max
+       && batch_count_64 < c_i64_grid_YZ_chunk)
     {
-        // sync here to match legacy BLAS
-        hipStreamSynchronize(handle->get_stream());
+        // valid to use original 32bit API with truncated 64bit args
+        return rocblas_internal_dot_launcher<rocblas_int, NB, CONJ, T, U, V>(handle,
+                                                                             n_64,
+                                                                             x,
+                                                                             offsetx,
+                                                                             incx_64,
+                                                                             stridex,
+                                                                             y,
+                                                                             offsety,
+                                                                             incy_64,
+                                                                             stridey,
+                                                                             batch_count_64,
+                                                                             results,
+                                                                             workspace);
     }
 
-    return rocblas_status_success;
+    static constexpr int WIN = rocblas_dot_WIN<T>();
+
+    // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+    int64_t shiftx = incx_64 < 0 ? offsetx - incx_64 * (n_64 - 1) : offsetx;
+    int64_t shifty = incy_64 < 0 ? offsety - incy_64 * (n_64 - 1) : offsety;
+
+    auto views = [=](int64_t b_base) {
+        int64_t count = batch_count_64 - b_base;
+        return rocblas_dot_view_64<CONJ, V, U>{rocblas_make_batch_window(x, b_base, count),
+                                               shiftx,
+                                               incx_64,
+                                               stridex,
+                                               rocblas_make_batch_window(y, b_base, count),
+                                               shifty,
+                                               incy_64,
+                                               stridey};
+    };
+
+    return rocblas_reduction_launcher_64<NB, WIN, rocblas_reduce_sum, rocblas_finalize_identity>(
+        handle, n_64, batch_count_64, views, workspace, results);
 }
 
 template <typename T, typename Tex>
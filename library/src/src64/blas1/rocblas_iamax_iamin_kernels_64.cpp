@@ -29,9 +29,7 @@
     \details
     rocblas_internal_iamax_iamin_launcher computes a reduction over multiple vectors x_i
               Template parameters allow threads per block, data, and specific phase kernel overrides
-              At least two kernels are needed to finish the reduction
-              kernel 1 write partial result per thread block in workspace, blocks partial results
-              kernel 2 gathers all the partial result in workspace and finishes the final reduction.
+              The reduction is a single launch for any n (see rocblas_reduction_launcher_64).
     @param[in]
     handle    rocblas_handle.
               handle to the rocblas library context queue.
@@ -80,86 +78,17 @@ rocblas_status rocblas_internal_iamax_iamin_launcher_64(rocblas_handle handle,
                                                         Tr*            results)
 {
 
-    int64_t n_passes = (n_64 - 1) / c_i64_grid_X_chunk + 1;
-
-    for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
-    {
-        int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
-
-        auto x_ptr = adjust_ptr_batch(x, b_base, stridex);
-
-        Tr* output = &results[b_base];
-        if(handle->pointer_mode == rocblas_pointer_mode_host)
-        {
-            output = (Tr*)(workspace);
-        }
-
-        // additional workspace if n_passes as results are only partial sum
-        To* partial_results = workspace;
-
-        int64_t total_blocks = 0;
-        int64_t batch_offset = 0;
-        int     block_size   = 0;
-
-        for(int64_t n_base = 0, pass = 0; n_base < n_64; n_base += c_i64_grid_X_chunk, pass++)
-        {
-            int32_t n      = int32_t(std::min(n_64 - n_base, c_i64_grid_X_chunk));
-            int     blocks = rocblas_reduction_kernel_block_count(n, NB);
-            total_blocks += blocks;
-            if(n_base == 0)
-            {
-                // this is size of partial results even for last smaller chunk
-                block_size   = blocks;
-                batch_offset = block_size * n_passes;
-            }
-
-            int64_t offsetx = n_base * incx_64; // negative inc is quick return
-
-            ROCBLAS_LAUNCH_KERNEL((rocblas_iamax_iamin_kernel_part1_64<NB, FETCH, REDUCE>),
-                                  dim3(blocks, batch_count),
-                                  NB,
-                                  0,
-                                  handle->get_stream(),
-                                  n,
-                                  x_ptr,
-                                  offsetx,
-                                  incx_64,
-                                  stridex,
-                                  batch_offset,
-                                  n_base,
-                                  partial_results + pass * block_size);
-        }
-
-        // reduce all n partial results within batch chunk
-
-        ROCBLAS_LAUNCH_KERNEL((rocblas_iamax_iamin_kernel_part2_64<NB, REDUCE>),
-                              dim3(1, batch_count),
-                              NB,
-                              0,
-                              handle->get_stream(),
-                              total_blocks,
-                              batch_offset,
-                              partial_results,
-                              output);
-
-        if(handle->pointer_mode == rocblas_pointer_mode_host)
-        {
-            RETURN_IF_HIP_ERROR(hipMemcpyAsync(&results[b_base],
-                                               output,
-                                               sizeof(Tr) * batch_count,
-                                               hipMemcpyDeviceToHost,
-                                               handle->get_stream()));
-        }
-
-    } // for chunk of batch_count
-
-    if(handle->pointer_mode == rocblas_pointer_mode_host)
-    {
-        // sync here to match legacy BLAS
-        hipStreamSynchronize(handle->get_stream());
-    }
-
-    return rocblas_status_success;
+    // negative inc is quick return
+    auto views = [=](int64_t b_base) {
+        return rocblas_iamax_iamin_view_64<FETCH, TPtrX>{
+            rocblas_make_batch_window(x, b_base, batch_count_64 - b_base),
+            shiftx,
+            incx_64,
+            stridex};
+    };
+
+    return rocblas_reduction_launcher_64<NB, 1, REDUCE, rocblas_finalize_index_64>(
+        handle, n_64, batch_count_64, views, workspace, results);
 }
 
 template <typename T, typename S>
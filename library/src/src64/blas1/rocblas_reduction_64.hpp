@@ -0,0 +1,187 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include "int64_helpers.hpp"
+
+#include "blas1/reduction.hpp"
+#include "blas1/rocblas_reduction.hpp"
+
+// Single launch reductions of the 64-bit API, shared by asum, nrm2, dot and iamax/iamin.
+//
+// Each batch is reduced by at most c_i64_reduction_blocks blocks of NB threads which
+// grid-stride over all of n, so one launch covers any n. Every thread reduces its elements in
+// registers, every block reduces its threads and stores one partial result, and the last block
+// of the batch to finish (rocblas_reduction_last_block) reduces the partial results. As the
+// elements of each thread and the order of the partial results only depend on the grid, the
+// result is the same whichever block finishes last. A second kernel finishes the reduction
+// only if reduction tickets are not available.
+static constexpr int64_t c_i64_reduction_blocks = 4096;
+
+// blocks reducing each batch of n elements, each thread being given at least WIN elements
+template <int NB, int WIN = 1>
+inline int rocblas_reduction_64_block_count(int64_t n)
+{
+    int64_t blocks = int64_t(rocblas_reduction_kernel_block_count(n, NB * WIN));
+    return int(std::min(blocks, c_i64_reduction_blocks));
+}
+
+// block reduction with REDUCE; the result is only valid in thread 0
+template <int NB, typename REDUCE, typename To>
+__inline__ __device__ To rocblas_reduction_64_block_reduce(To val)
+{
+    if constexpr(std::is_same_v<REDUCE, rocblas_reduce_sum>)
+        return rocblas_dot_block_reduce<NB, To>(val);
+    else
+    {
+        __shared__ To vals[NB];
+
+        vals[threadIdx.x] = val;
+        rocblas_reduction<NB, REDUCE>(threadIdx.x, vals);
+        return vals[0];
+    }
+}
+
+// reduces the nblocks partial results of batch blockIdx.y in block order
+template <int NB, typename REDUCE, typename FINALIZE, typename To, typename Tr>
+__inline__ __device__ void rocblas_reduction_64_finish(int nblocks, const To* workspace, Tr* result)
+{
+    const To* work = workspace + size_t(blockIdx.y) * nblocks;
+    To        val  = rocblas_default_value<To>{}();
+
+    for(int i = threadIdx.x; i < nblocks; i += NB)
+        REDUCE{}(val, work[i]);
+
+    val = rocblas_reduction_64_block_reduce<NB, REDUCE>(val);
+
+    if(threadIdx.x == 0)
+        result[blockIdx.y] = Tr(FINALIZE{}(val));
+}
+
+// VIEW(batch) returns the functor loading element i of the batch as To
+template <int NB, typename REDUCE, typename FINALIZE, typename VIEW, typename To, typename Tr>
+ROCBLAS_KERNEL(NB)
+rocblas_reduction_kernel_64(int64_t n, VIEW view, To* workspace, unsigned int* tickets, Tr* result)
+{
+    int  nblocks = gridDim.x;
+    auto elem    = view(blockIdx.y);
+    To   val     = rocblas_default_value<To>{}();
+
+    for(int64_t i = blockIdx.x * int64_t(NB) + threadIdx.x; i < n; i += int64_t(nblocks) * NB)
+        REDUCE{}(val, To(elem(i)));
+
+    val = rocblas_reduction_64_block_reduce<NB, REDUCE>(val);
+
+    if(threadIdx.x == 0)
+        workspace[size_t(blockIdx.y) * nblocks + blockIdx.x] = val;
+
+    if(tickets && rocblas_reduction_last_block(tickets, nblocks))
+        rocblas_reduction_64_finish<NB, REDUCE, FINALIZE>(nblocks, workspace, result);
+}
+
+template <int NB, typename REDUCE, typename FINALIZE, typename To, typename Tr>
+ROCBLAS_KERNEL(NB)
+rocblas_reduction_finish_kernel_64(int nblocks, const To* workspace, Tr* result)
+{
+    rocblas_reduction_64_finish<NB, REDUCE, FINALIZE>(nblocks, workspace, result);
+}
+
+/*! \brief
+
+    \details
+    rocblas_reduction_launcher_64 reduces n elements of each of batch_count batches with a
+              single launch per chunk of c_i64_grid_YZ_chunk batches.
+    @param[in]
+    views     host callable, views(b_base) returns the VIEW of the batches starting at b_base.
+    @param[out]
+    workspace To*
+              temporary GPU buffer of at least
+              (rocblas_reduction_64_block_count<NB, WIN>(n) + 1) * c_i64_grid_YZ_chunk elements,
+              fewer if batch_count is smaller, for the partial results of each batch and the
+              results when result is a host pointer.
+    @param[out]
+    results   Tr* batch_count results, either on the host CPU or device GPU.
+    ********************************************************************/
+template <int NB,
+          int WIN,
+          typename REDUCE,
+          typename FINALIZE,
+          typename VIEWS,
+          typename To,
+          typename Tr>
+rocblas_status rocblas_reduction_launcher_64(rocblas_handle handle,
+                                             int64_t        n,
+                                             int64_t        batch_count_64,
+                                             VIEWS          views,
+                                             To*            workspace,
+                                             Tr*            results)
+{
+    int  nblocks = rocblas_reduction_64_block_count<NB, WIN>(n);
+    bool host    = handle->pointer_mode == rocblas_pointer_mode_host;
+
+    for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
+    {
+        int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
+
+        // host results are gathered after the partial results
+        Tr* output = host ? (Tr*)(workspace + size_t(batch_count) * nblocks) : results + b_base;
+
+        unsigned int* tickets = handle->get_reduction_tickets(batch_count);
+
+        ROCBLAS_LAUNCH_KERNEL((rocblas_reduction_kernel_64<NB, REDUCE, FINALIZE>),
+                              dim3(nblocks, batch_count),
+                              NB,
+                              0,
+                              handle->get_stream(),
+                              n,
+                              views(b_base),
+                              workspace,
+                              tickets,
+                              output);
+
+        if(!tickets)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_reduction_finish_kernel_64<NB, REDUCE, FINALIZE>),
+                                  dim3(1, batch_count),
+                                  NB,
+                                  0,
+                                  handle->get_stream(),
+                                  nblocks,
+                                  workspace,
+                                  output);
+
+        if(host)
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(&results[b_base],
+                                               output,
+                                               sizeof(Tr) * batch_count,
+                                               hipMemcpyDeviceToHost,
+                                               handle->get_stream()));
+    }
+
+    if(host)
+    {
+        // sync here to match legacy BLAS
+        RETURN_IF_ROCBLAS_ERROR(handle->sync_host_results());
+    }
+    return rocblas_status_success;
+}
@@ -28,6 +28,36 @@
 #include "blas1/rocblas_scal.hpp" // rocblas_int API called
 #include "blas1/rocblas_scal_kernels.hpp" // inst kernels with int64_t
 
+//!
+//! @brief 64-bit kernel of scal, the grid strides over n and over the batch.
+//!
+template <int NB, typename T, typename Tex, typename Ta, typename Tx>
+ROCBLAS_KERNEL(NB)
+rocblas_scal_kernel_64(int64_t                  n,
+                       Ta                       alpha_device_host,
+                       rocblas_stride           stride_alpha,
+                       rocblas_batch_window<Tx> xa,
+                       rocblas_stride           offset_x,
+                       int64_t                  incx,
+                       rocblas_stride           stride_x)
+{
+    for(int64_t b = blockIdx.y; b < xa.count; b += gridDim.y)
+    {
+        auto* x     = load_ptr_batch(xa, b, offset_x, stride_x);
+        auto  alpha = load_scalar_64(alpha_device_host, b, stride_alpha);
+
+        if(alpha == 1)
+            continue;
+
+        for(int64_t tid = blockIdx.x * int64_t(NB) + threadIdx.x; tid < n;
+            tid += int64_t(gridDim.x) * NB)
+        {
+            Tex res       = (Tex)x[tid * incx] * alpha;
+            x[tid * incx] = (T)res;
+        }
+    }
+}
+
 template <typename API_INT, int NB, typename T, typename Tex, typename Ta, typename Tx>
 rocblas_status rocblas_internal_scal_launcher_64(rocblas_handle handle,
                                                  API_INT        n_64,
@@ -45,84 +75,55 @@ rocblas_status rocblas_internal_scal_launcher_64(rocblas_handle handle,
         return rocblas_status_success;
     }
 
-    if(incx_64 <= c_i32_max)
-    {
-        for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
-        {
-            auto    x_ptr       = adjust_ptr_batch(x, b_base, stride_x);
-            int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
-
-            for(int64_t n_base = 0; n_base < n_64; n_base += c_i64_grid_X_chunk)
-            {
-                int32_t n         = int32_t(std::min(n_64 - n_base, c_i64_grid_X_chunk));
-                auto    alpha_ptr = rocblas_pointer_mode_device == handle->pointer_mode
-                                        ? alpha + n_base * stride_alpha
-                                        : alpha;
-
-                // 32bit API call
-                rocblas_status status
-                    = rocblas_internal_scal_launcher<rocblas_int, NB, T, Tex, Ta, Tx>(
-                        handle,
-                        rocblas_int(n),
-                        alpha_ptr,
-                        stride_alpha,
-                        x_ptr,
-                        offset_x + n_base * incx_64, // incx > 0
-                        rocblas_int(incx_64),
-                        stride_x,
-                        batch_count);
-                if(status != rocblas_status_success)
-                    return status;
-            }
-        }
-    }
-    else
+    if(incx_64 <= c_i32_max && n_64 <= c_i64_grid_X_chunk && batch_count_64 < c_i64_grid_YZ_chunk)
     {
-        for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
-        {
-            auto    x_ptr       = adjust_ptr_batch(x, b_base, stride_x);
-            int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
-
-            for(int64_t n_base = 0; n_base < n_64; n_base += c_i64_grid_X_chunk)
-            {
-                int32_t n = int32_t(std::min(n_64 - n_base, c_i64_grid_X_chunk));
-
-                int  blocks = (n - 1) / NB + 1;
-                dim3 grid(blocks, batch_count);
-                dim3 threads(NB);
-
-                int64_t shiftx = offset_x + n_base * incx_64;
-
-                if(rocblas_pointer_mode_device == handle->pointer_mode)
-                    ROCBLAS_LAUNCH_KERNEL((rocblas_scal_kernel<int64_t, NB, T, Tex>),
-                                          grid,
-                                          threads,
-                                          0,
-                                          handle->get_stream(),
-                                          n,
-                                          alpha + n_base * stride_alpha,
-                                          stride_alpha,
-                                          x_ptr,
-                                          shiftx,
-                                          incx_64,
-                                          stride_x);
-                else // single alpha is on host
-                    ROCBLAS_LAUNCH_KERNEL((rocblas_scal_kernel<int64_t, NB, T, Tex>),
-                                          grid,
-                                          threads,
-                                          0,
-                                          handle->get_stream(),
-                                          n,
-                                          *alpha,
-                                          stride_alpha,
-                                          x_ptr,
-                                          shiftx,
-                                          incx_64,
-                                          stride_x);
-            }
-        }
+        // valid to use original 32bit API with truncated 64bit args
+        return rocblas_internal_scal_launcher<rocblas_int, NB, T, Tex, Ta, Tx>(
+            handle,
+            rocblas_int(n_64),
+            alpha,
+            stride_alpha,
+            x,
+            offset_x,
+            rocblas_int(incx_64),
+            stride_x,
+            rocblas_int(batch_count_64));
     }
 
+    int64_t blocks = std::min((n_64 - 1) / NB + 1, c_i64_grid_X_chunk);
+    dim3    threads(NB);
+
+    // one launch covers all of n and all batches
+    dim3 grid(blocks, std::min(int64_t(batch_count_64), c_i64_grid_YZ_chunk));
+    auto x_w = rocblas_make_batch_window(x, 0, batch_count_64);
+
+    if(rocblas_pointer_mode_device == handle->pointer_mode)
+        ROCBLAS_LAUNCH_KERNEL((rocblas_scal_kernel_64<NB, T, Tex>),
+                              grid,
+                              threads,
+                              0,
+                              handle->get_stream(),
+                              n_64,
+                              alpha,
+                              stride_alpha,
+                              x_w,
+                              offset_x,
+                              incx_64,
+                              stride_x);
+    else // single alpha is on host
+        ROCBLAS_LAUNCH_KERNEL((rocblas_scal_kernel_64<NB, T, Tex>),
+                              grid,
+                              threads,
+                              0,
+                              handle->get_stream(),
+                              n_64,
+                              *alpha,
+                              stride_alpha,
+                              x_w,
+                              offset_x,
+                              incx_64,
+                              stride_x);
+
     return rocblas_status_success;
 }
 
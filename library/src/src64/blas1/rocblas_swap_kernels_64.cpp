@@ -28,6 +28,32 @@
 #include "blas1/rocblas_swap.hpp" // rocblas_int API called
 #include "blas1/rocblas_swap_kernels.hpp" // inst kernels with int64_t
 
+//!
+//! @brief 64-bit kernel of swap, the grid strides over n and over the batch.
+//!
+template <int NB, typename UPtr>
+ROCBLAS_KERNEL(NB)
+rocblas_swap_kernel_64(int64_t                    n,
+                       rocblas_batch_window<UPtr> xa,
+                       rocblas_stride             offsetx,
+                       int64_t                    incx,
+                       rocblas_stride             stridex,
+                       rocblas_batch_window<UPtr> ya,
+                       rocblas_stride             offsety,
+                       int64_t                    incy,
+                       rocblas_stride             stridey)
+{
+    for(int64_t b = blockIdx.y; b < ya.count; b += gridDim.y)
+    {
+        auto* x = load_ptr_batch(xa, b, offsetx, stridex);
+        auto* y = load_ptr_batch(ya, b, offsety, stridey);
+
+        for(int64_t tid = blockIdx.x * int64_t(NB) + threadIdx.x; tid < n;
+            tid += int64_t(gridDim.x) * NB)
+            rocblas_swap_vals(x + tid * incx, y + tid * incy);
+    }
+}
+
 template <typename API_INT, int NB, typename T>
 rocblas_status rocblas_internal_swap_launcher_64(rocblas_handle handle,
                                                  API_INT        n_64,
@@ -41,91 +67,45 @@ rocblas_status rocblas_internal_swap_launcher_64(rocblas_handle handle,
                                                  rocblas_stride stridey,
                                                  API_INT        batch_count_64)
 {
-    if(std::abs(incx_64) <= c_i32_max && std::abs(incy_64) < c_i32_max)
-    {
-        if(n_64 <= c_i32_max && batch_count_64 < c_i64_grid_YZ_chunk)
-        {
-            // valid to use original 32bit API with truncated 64bit args
-            return rocblas_internal_swap_launcher<rocblas_int, NB, T>(handle,
-                                                                      n_64,
-                                                                      x,
-                                                                      offsetx,
-                                                                      incx_64,
-                                                                      stridex,
-                                                                      y,
-                                                                      offsety,
-                                                                      incy_64,
-                                                                      stridey,
-                                                                      batch_count_64);
-        }
-
-        for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
-        {
-            auto    x_ptr       = adjust_ptr_batch(x, b_base, stridex);
-            auto    y_ptr       = adjust_ptr_batch(y, b_base, stridey);
-            int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
-
-            for(int64_t n_base = 0; n_base < n_64; n_base += c_i64_grid_X_chunk)
-            {
-                int32_t n = int32_t(std::min(n_64 - n_base, c_i64_grid_X_chunk));
-
-                int64_t shiftx
-                    = offsetx + (incx_64 < 0 ? -incx_64 * (n_64 - n - n_base) : n_base * incx_64);
-                int64_t shifty
-                    = offsety + (incy_64 < 0 ? -incy_64 * (n_64 - n - n_base) : n_base * incy_64);
-
-                // 32bit API call
-                rocblas_status status
-                    = rocblas_internal_swap_launcher<rocblas_int, NB, T>(handle,
-                                                                         rocblas_int(n),
-                                                                         x_ptr,
-                                                                         shiftx,
-                                                                         rocblas_int(incx_64),
-                                                                         stridex,
-                                                                         y_ptr,
-                                                                         shifty,
-                                                                         rocblas_int(incy_64),
-                                                                         stridey,
-                                                                         batch_count);
-                if(status != rocblas_status_success)
-                    return status;
-            }
-        }
-    }
-    else
+    if(std::abs(incx_64) <= c_i32_max && std::abs(incy_64) < c_i32_max
+       && n_64 <= c_i64_grid_X_chunk && batch_count_64 < c_i64_grid_YZ_chunk)
     {
-        for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
-        {
-            auto    x_ptr       = adjust_ptr_batch(x, b_base, stridex);
-            auto    y_ptr       = adjust_ptr_batch(y, b_base, stridey);
-            int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
-
-            for(int64_t n_base = 0; n_base < n_64; n_base += c_i64_grid_X_chunk)
-            {
-                int32_t n = int32_t(std::min(n_64 - n_base, c_i64_grid_X_chunk));
-
-                int64_t shiftx
-                    = offsetx + (incx_64 < 0 ? -incx_64 * (n_64 - n - n_base) : n_base * incx_64);
-                int64_t shifty
-                    = offsety + (incy_64 < 0 ? -incy_64 * (n_64 - n - n_base) : n_base * incy_64);
-
-                // new instantiation for 64bit incx/y
-                rocblas_status status = rocblas_internal_swap_launcher<int64_t, NB, T>(handle,
-                                                                                       n,
-                                                                                       x_ptr,
-                                                                                       shiftx,
-                                                                                       incx_64,
-                                                                                       stridex,
-                                                                                       y_ptr,
-                                                                                       shifty,
-                                                                                       incy_64,
-                                                                                       stridey,
-                                                                                       batch_count);
-                if(status != rocblas_status_success)
-                    return status;
-            }
-        }
+        // valid to use original 32bit API with truncated 64bit args
+        return rocblas_internal_swap_launcher<rocblas_int, NB, T>(handle,
+                                                                  n_64,
+                                                                  x,
+                                                                  offsetx,
+                                                                  incx_64,
+                                                                  stridex,
+                                                                  y,
+                                                                  offsety,
+                                                                  incy_64,
+                                                                  stridey,
+                                                                  batch_count_64);
     }
+
+    // shifting to the very end of the 64-bit arrays for negative increments
+    int64_t shiftx = offsetx + (incx_64 < 0 ? -incx_64 * (n_64 - 1) : 0);
+    int64_t shifty = offsety + (incy_64 < 0 ? -incy_64 * (n_64 - 1) : 0);
+
+    int64_t blocks = std::min((n_64 - 1) / NB + 1, c_i64_grid_X_chunk);
+
+    // one launch covers all of n and all batches
+    ROCBLAS_LAUNCH_KERNEL((rocblas_swap_kernel_64<NB>),
+                          dim3(blocks, std::min(int64_t(batch_count_64), c_i64_grid_YZ_chunk)),
+                          dim3(NB),
+                          0,
+                          handle->get_stream(),
+                          n_64,
+                          rocblas_make_batch_window(x, 0, batch_count_64),
+                          shiftx,
+                          incx_64,
+                          stridex,
+                          rocblas_make_batch_window(y, 0, batch_count_64),
+                          shifty,
+                          incy_64,
+                          stridey);
+
     return rocblas_status_success;
 }
 
@@ -26,6 +26,16 @@
 
 #include "int64_helpers.hpp"
 
+// When m or n exceeds c_i32_max, reductions longer than c_i32_max are split into slices of
+// c_gemv_64_slice elements, the partial results of which are summed by a second kernel
+constexpr int64_t c_gemv_64_slice = 1 << 20;
+
+inline int64_t rocblas_gemv_64_slices(rocblas_operation transA, int64_t m_64, int64_t n_64)
+{
+    int64_t r = transA == rocblas_operation_none ? n_64 : m_64;
+    return r > c_i32_max ? (r - 1) / c_gemv_64_slice + 1 : 0;
+}
+
 template <typename To>
 ROCBLAS_INTERNAL_EXPORT_NOINLINE size_t rocblas_internal_gemv_kernel_workspace_size_64(
     rocblas_operation transA, int64_t m_64, int64_t n_64, int64_t batch_count_64)
@@ -36,8 +46,12 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE size_t rocblas_internal_gemv_kernel_workspace_s
     rocblas_int batch_count = std::min(c_i64_grid_YZ_chunk, batch_count_64);
     size_t work_size = rocblas_internal_gemv_kernel_workspace_size<To>(transA, m, n, batch_count);
     if(m_64 > c_i32_max || n_64 > c_i32_max)
-        work_size
-            += sizeof(rocblas_double_complex); // for temporary beta during accumulation passes
+    {
+        // partial sums of the reduction slices of the native int64 kernels
+        int64_t outputs = transA == rocblas_operation_none ? m_64 : n_64;
+        int64_t slices  = rocblas_gemv_64_slices(transA, m_64, n_64);
+        work_size = sizeof(rocblas_double_complex) * slices * outputs * batch_count;
+    }
     return work_size;
 }
 
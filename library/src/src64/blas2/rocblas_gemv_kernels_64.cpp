@@ -25,8 +25,356 @@
 #include "rocblas-types.h"
 #include "rocblas_gemv_64.hpp"
 
+#include "blas1/rocblas_reduction.hpp"
 #include "blas2/rocblas_gemv.hpp" // int32 API called
 
+// Native int64 kernels used when m or n exceeds c_i32_max. The reduction over the columns (or
+// rows for transpose) is not chunked, so y is read, scaled and written once per output.
+constexpr int c_gemv_64_NB = 256;
+
+template <bool TRANS, bool CONJ, typename Tex, typename Ti>
+__device__ __forceinline__ Tex rocblas_gemv_64_product(
+    const Ti* A, int64_t lda, const Ti* x, int64_t incx, int64_t o, int64_t r)
+{
+    auto a = TRANS ? A[r + o * lda] : A[o + r * lda];
+    if constexpr(CONJ)
+        a = conj(a);
+    return Tex(a) * Tex(x[r * incx]);
+}
+
+// each thread computes rows of y (columns of A for transpose) over the whole reduction
+template <int  NB,
+          bool TRANS,
+          bool CONJ,
+          typename Tex,
+          typename TScal,
+          typename TiPtr,
+          typename ToPtr>
+ROCBLAS_KERNEL(NB)
+rocblas_gemv_rows_kernel_64(int64_t        outputs,
+                            int64_t        r_len,
+                            TScal          alpha_device_host,
+                            rocblas_stride stride_alpha,
+                            TiPtr          Aa,
+                            rocblas_stride offsetA,
+                            int64_t        lda,
+                            rocblas_stride strideA,
+                            TiPtr          xa,
+                            rocblas_stride shiftx,
+                            int64_t        incx,
+                            rocblas_stride stridex,
+                            TScal          beta_device_host,
+                            rocblas_stride stride_beta,
+                            ToPtr          ya,
+                            rocblas_stride shifty,
+                            int64_t        incy,
+                            rocblas_stride stridey)
+{
+    uint32_t b     = blockIdx.y;
+    Tex      alpha = load_scalar(alpha_device_host, b, stride_alpha);
+    Tex      beta  = load_scalar(beta_device_host, b, stride_beta);
+    if(alpha == 0 && beta == 1)
+        return;
+
+    const auto* A = load_ptr_batch(Aa, b, offsetA, strideA);
+    const auto* x = load_ptr_batch(xa, b, shiftx, stridex);
+    auto*       y = load_ptr_batch(ya, b, shifty, stridey);
+
+    using To = rocblas_batch_elem_t<ToPtr>;
+
+    for(int64_t o = blockIdx.x * int64_t(NB) + threadIdx.x; o < outputs;
+        o += int64_t(gridDim.x) * NB)
+    {
+        Tex sum = 0;
+        if(alpha != 0)
+            for(int64_t r = 0; r < r_len; r++)
+                sum += rocblas_gemv_64_product<TRANS, CONJ, Tex>(A, lda, x, incx, o, r);
+
+        Tex res = alpha * sum;
+        if(beta != 0)
+            res += beta * Tex(y[o * incy]);
+        y[o * incy] = To(res);
+    }
+}
+
+// each block sums one slice of the reduction for one row of y (column of A for transpose)
+template <int NB, bool TRANS, bool CONJ, typename Tex, typename TScal, typename TiPtr>
+ROCBLAS_KERNEL(NB)
+rocblas_gemv_slices_kernel_64(int64_t        outputs,
+                              int64_t        r_len,
+                              int64_t        slices,
+                              TScal          alpha_device_host,
+                              rocblas_stride stride_alpha,
+                              TiPtr          Aa,
+                              rocblas_stride offsetA,
+                              int64_t        lda,
+                              rocblas_stride strideA,
+                              TiPtr          xa,
+                              rocblas_stride shiftx,
+                              int64_t        incx,
+                              rocblas_stride stridex,
+                              Tex*           workspace)
+{
+    uint32_t b     = blockIdx.z;
+    Tex      alpha = load_scalar(alpha_device_host, b, stride_alpha);
+    if(alpha == 0)
+        return;
+
+    const auto* A = load_ptr_batch(Aa, b, offsetA, strideA);
+    const auto* x = load_ptr_batch(xa, b, shiftx, stridex);
+
+    for(int64_t o = blockIdx.y; o < outputs; o += gridDim.y)
+    {
+        for(int64_t s = blockIdx.x; s < slices; s += gridDim.x)
+        {
+            int64_t r_end = std::min(r_len, (s + 1) * c_gemv_64_slice);
+
+            Tex sum = 0;
+            for(int64_t r = s * c_gemv_64_slice + threadIdx.x; r < r_end; r += NB)
+                sum += rocblas_gemv_64_product<TRANS, CONJ, Tex>(A, lda, x, incx, o, r);
+
+            sum = rocblas_dot_block_reduce<NB>(sum);
+            if(threadIdx.x == 0)
+                workspace[(b * outputs + o) * slices + s] = sum;
+        }
+    }
+}
+
+// sums the slices of each row of y and applies alpha and beta
+template <int NB, typename Tex, typename TScal, typename ToPtr>
+ROCBLAS_KERNEL(NB)
+rocblas_gemv_slices_reduce_kernel_64(int64_t        outputs,
+                                     int64_t        slices,
+                                     TScal          alpha_device_host,
+                                     rocblas_stride stride_alpha,
+                                     const Tex*     workspace,
+                                     TScal          beta_device_host,
+                                     rocblas_stride stride_beta,
+                                     ToPtr          ya,
+                                     rocblas_stride shifty,
+                                     int64_t        incy,
+                                     rocblas_stride stridey)
+{
+    uint32_t b     = blockIdx.y;
+    Tex      alpha = load_scalar(alpha_device_host, b, stride_alpha);
+    Tex      beta  = load_scalar(beta_device_host, b, stride_beta);
+    if(alpha == 0 && beta == 1)
+        return;
+
+    auto* y = load_ptr_batch(ya, b, shifty, stridey);
+
+    using To = rocblas_batch_elem_t<ToPtr>;
+
+    for(int64_t o = blockIdx.x; o < outputs; o += gridDim.x)
+    {
+        Tex sum = 0;
+        if(alpha != 0)
+        {
+            const Tex* partial = workspace + (b * outputs + o) * slices;
+            for(int64_t s = threadIdx.x; s < slices; s += NB)
+                sum += partial[s];
+            sum = rocblas_dot_block_reduce<NB>(sum);
+        }
+
+        if(threadIdx.x == 0)
+        {
+            Tex res = alpha * sum;
+            if(beta != 0)
+                res += beta * Tex(y[o * incy]);
+            y[o * incy] = To(res);
+        }
+    }
+}
+
+template <bool TRANS, bool CONJ, typename Ti, typename Tex, typename To>
+rocblas_status rocblas_gemv_native_launcher_64(rocblas_handle handle,
+                                               int64_t        m_64,
+                                               int64_t        n_64,
+                                               Tex const*     alpha,
+                                               rocblas_stride stride_alpha,
+                                               Ti const*      A,
+                                               rocblas_stride offsetA,
+                                               int64_t        lda_64,
+                                               rocblas_stride strideA,
+                                               Ti const*      x,
+                                               rocblas_stride offsetx,
+                                               int64_t        incx_64,
+                                               rocblas_stride stridex,
+                                               Tex const*     beta,
+                                               rocblas_stride stride_beta,
+                                               To*            y,
+                                               rocblas_stride offsety,
+                                               int64_t        incy_64,
+                                               rocblas_stride stridey,
+                                               int64_t        batch_count_64,
+                                               Tex*           workspace)
+{
+    static constexpr int NB = c_gemv_64_NB;
+
+    int64_t outputs = TRANS ? n_64 : m_64;
+    int64_t r_len   = TRANS ? m_64 : n_64;
+    int64_t slices  = rocblas_gemv_64_slices(TRANS ? rocblas_operation_transpose
+                                                   : rocblas_operation_none,
+                                            m_64,
+                                            n_64);
+
+    // shifting to the very end of the 64-bit arrays for negative increments
+    int64_t shiftx = offsetx + (incx_64 < 0 ? -incx_64 * (r_len - 1) : 0);
+    int64_t shifty = offsety + (incy_64 < 0 ? -incy_64 * (outputs - 1) : 0);
+
+    bool        device = handle->pointer_mode == rocblas_pointer_mode_device;
+    hipStream_t stream = handle->get_stream();
+
+    for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
+    {
+        auto    x_ptr       = adjust_ptr_batch(x, b_base, stridex);
+        auto    y_ptr       = adjust_ptr_batch(y, b_base, stridey);
+        auto    A_ptr       = adjust_ptr_batch(A, b_base, strideA);
+        auto    alpha_ptr   = device ? alpha + b_base * stride_alpha : alpha;
+        auto    beta_ptr    = device ? beta + b_base * stride_beta : beta;
+        int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
+
+        if(!slices)
+        {
+            dim3 grid(std::min((outputs - 1) / NB + 1, c_i64_grid_X_chunk), batch_count);
+
+            if(device)
+                ROCBLAS_LAUNCH_KERNEL((rocblas_gemv_rows_kernel_64<NB, TRANS, CONJ, Tex>),
+                                      grid,
+                                      dim3(NB),
+                                      0,
+                                      stream,
+                                      outputs,
+                                      r_len,
+                                      alpha_ptr,
+                                      stride_alpha,
+                                      A_ptr,
+                                      offsetA,
+                                      lda_64,
+                                      strideA,
+                                      x_ptr,
+                                      shiftx,
+                                      incx_64,
+                                      stridex,
+                                      beta_ptr,
+                                      stride_beta,
+                                      y_ptr,
+                                      shifty,
+                                      incy_64,
+                                      stridey);
+            else
+                ROCBLAS_LAUNCH_KERNEL((rocblas_gemv_rows_kernel_64<NB, TRANS, CONJ, Tex>),
+                                      grid,
+                                      dim3(NB),
+                                      0,
+                                      stream,
+                                      outputs,
+                                      r_len,
+                                      *alpha,
+                                      stride_alpha,
+                                      A_ptr,
+                                      offsetA,
+                                      lda_64,
+                                      strideA,
+                                      x_ptr,
+                                      shiftx,
+                                      incx_64,
+                                      stridex,
+                                      *beta,
+                                      stride_beta,
+                                      y_ptr,
+                                      shifty,
+                                      incy_64,
+                                      stridey);
+            continue;
+        }
+
+        dim3 grid(std::min(slices, c_i64_grid_X_chunk),
+                  std::min(outputs, c_i64_grid_YZ_chunk),
+                  batch_count);
+        dim3 reduce_grid(std::min(outputs, c_i64_grid_X_chunk), batch_count);
+
+        if(device)
+        {
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemv_slices_kernel_64<NB, TRANS, CONJ, Tex>),
+                                  grid,
+                                  dim3(NB),
+                                  0,
+                                  stream,
+                                  outputs,
+                                  r_len,
+                                  slices,
+                                  alpha_ptr,
+                                  stride_alpha,
+                                  A_ptr,
+                                  offsetA,
+                                  lda_64,
+                                  strideA,
+                                  x_ptr,
+                                  shiftx,
+                                  incx_64,
+                                  stridex,
+                                  workspace);
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemv_slices_reduce_kernel_64<NB, Tex>),
+                                  reduce_grid,
+                                  dim3(NB),
+                                  0,
+                                  stream,
+                                  outputs,
+                                  slices,
+                                  alpha_ptr,
+                                  stride_alpha,
+                                  (const Tex*)workspace,
+                                  beta_ptr,
+                                  stride_beta,
+                                  y_ptr,
+                                  shifty,
+                                  incy_64,
+                                  stridey);
+        }
+        else
+        {
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemv_slices_kernel_64<NB, TRANS, CONJ, Tex>),
+                                  grid,
+                                  dim3(NB),
+                                  0,
+                                  stream,
+                                  outputs,
+                                  r_len,
+                                  slices,
+                                  *alpha,
+                                  stride_alpha,
+                                  A_ptr,
+                                  offsetA,
+                                  lda_64,
+                                  strideA,
+                                  x_ptr,
+                                  shiftx,
+                                  incx_64,
+                                  stridex,
+                                  workspace);
+            ROCBLAS_LAUNCH_KERNEL((rocblas_gemv_slices_reduce_kernel_64<NB, Tex>),
+                                  reduce_grid,
+                                  dim3(NB),
+                                  0,
+                                  stream,
+                                  outputs,
+                                  slices,
+                                  *alpha,
+                                  stride_alpha,
+                                  (const Tex*)workspace,
+                                  *beta,
+                                  stride_beta,
+                                  y_ptr,
+                                  shifty,
+                                  incy_64,
+                                  stridey);
+        }
+    }
+
+    return rocblas_status_success;
+}
+
 template <typename Ti, typename Tex, typename To>
 __attribute__((noinline)) rocblas_status
     rocblas_internal_gemv_launcher_64(rocblas_handle    handle,
@@ -56,156 +404,81 @@ __attribute__((noinline)) rocblas_status
     if(!m_64 || !n_64 || !batch_count_64)
         return rocblas_status_success;
 
-    bool dims_32bit = m_64 <= c_i32_max && n_64 <= c_i32_max;
-
-    Tex* beta_one{nullptr};
-    Tex  one(1.0);
-    if(!dims_32bit)
+    // m or n beyond int32 use the native int64 kernels, one launch per batch chunk
+    if(m_64 > c_i32_max || n_64 > c_i32_max)
     {
-        if(handle->pointer_mode == rocblas_pointer_mode_device)
-        {
-            beta_one = workspace++;
-            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-                beta_one, &one, sizeof(Tex), hipMemcpyHostToDevice, handle->get_stream()));
-        }
+#define ROCBLAS_GEMV_NATIVE_64(TRANS_, CONJ_)                      \
+    rocblas_gemv_native_launcher_64<TRANS_, CONJ_>(handle,         \
+                                                   m_64,           \
+                                                   n_64,           \
+                                                   alpha,          \
+                                                   stride_alpha,   \
+                                                   A,              \
+                                                   offsetA,        \
+                                                   lda_64,         \
+                                                   strideA,        \
+                                                   x,              \
+                                                   offsetx,        \
+                                                   incx_64,        \
+                                                   stridex,        \
+                                                   beta,           \
+                                                   stride_beta,    \
+                                                   y,              \
+                                                   offsety,        \
+                                                   incy_64,        \
+                                                   stridey,        \
+                                                   batch_count_64, \
+                                                   workspace)
+
+        if(transA == rocblas_operation_none)
+            return ROCBLAS_GEMV_NATIVE_64(false, false);
+        else if(transA == rocblas_operation_transpose)
+            return ROCBLAS_GEMV_NATIVE_64(true, false);
         else
-        {
-            beta_one = &one;
-        }
+            return ROCBLAS_GEMV_NATIVE_64(true, true);
+
+#undef ROCBLAS_GEMV_NATIVE_64
     }
 
-    for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
+    // small problems are computed with the batch in the x dimension of the grid
+    bool batch_major = rocblas_gemv_small_batched(m_64, n_64, batch_count_64)
+                       && !handle->active_gemv_epilogue && lda_64 <= c_i32_max
+                       && std::abs(incx_64) <= c_i32_max && std::abs(incy_64) <= c_i32_max;
+    int64_t batch_chunk = rocblas_i64_batch_chunk(batch_major);
+
+    for(int64_t b_base = 0; b_base < batch_count_64; b_base += batch_chunk)
     {
         auto    x_ptr       = adjust_ptr_batch(x, b_base, stridex);
         auto    y_ptr       = adjust_ptr_batch(y, b_base, stridey);
         auto    A_ptr       = adjust_ptr_batch(A, b_base, strideA);
         auto    alpha_ptr   = adjust_ptr_batch(alpha, b_base, stride_alpha);
         auto    beta_ptr    = adjust_ptr_batch(beta, b_base, stride_beta);
-        int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
-
-        if(dims_32bit)
-        {
-            rocblas_status status = rocblas_internal_gemv_launcher(handle,
-                                                                   transA,
-                                                                   (int)m_64,
-                                                                   (int)n_64,
-                                                                   alpha_ptr,
-                                                                   stride_alpha,
-                                                                   A_ptr,
-                                                                   offsetA,
-                                                                   lda_64,
-                                                                   strideA,
-                                                                   x_ptr,
-                                                                   offsetx,
-                                                                   incx_64,
-                                                                   stridex,
-                                                                   beta_ptr,
-                                                                   stride_beta,
-                                                                   y_ptr,
-                                                                   offsety,
-                                                                   incy_64,
-                                                                   stridey,
-                                                                   batch_count,
-                                                                   workspace);
-            if(status != rocblas_status_success)
-                return status;
-        }
-        else if(transA == rocblas_operation_none)
-        {
-            // outer loop over non reduction
-            for(int64_t m_base = 0; m_base < m_64; m_base += c_i64_grid_X_chunk)
-            {
-                int32_t m = int32_t(std::min(m_64 - m_base, c_i64_grid_X_chunk));
-
-                int64_t shifty
-                    = offsety + (incy_64 < 0 ? -incy_64 * (m_64 - m - m_base) : m_base * incy_64);
-
-                // reduction loop
-                for(int64_t n_base = 0; n_base < n_64; n_base += c_i64_grid_YZ_chunk)
-                {
-                    int32_t n = int32_t(std::min(n_64 - n_base, c_i64_grid_YZ_chunk));
-
-                    int64_t shiftx
-                        = offsetx
-                          + (incx_64 < 0 ? -incx_64 * (n_64 - n - n_base) : n_base * incx_64);
-
-                    rocblas_status status
-                        = rocblas_internal_gemv_launcher(handle,
-                                                         transA,
-                                                         m,
-                                                         n,
-                                                         alpha_ptr,
-                                                         stride_alpha,
-                                                         A_ptr,
-                                                         offsetA + m_base + n_base * lda_64,
-                                                         lda_64,
-                                                         strideA,
-                                                         x_ptr,
-                                                         shiftx,
-                                                         incx_64,
-                                                         stridex,
-                                                         n_base == 0 ? beta_ptr : beta_one,
-                                                         n_base == 0 ? stride_beta : 0,
-                                                         y_ptr, // used for accumulation
-                                                         shifty,
-                                                         incy_64,
-                                                         stridey,
-                                                         batch_count,
-                                                         workspace);
-                    if(status != rocblas_status_success)
-                        return status;
-                }
-            }
-        }
-        else // if(transA != rocblas_operation_none)
-        {
-
-            // outer loop over non reduction
-            for(int64_t n_base = 0; n_base < n_64; n_base += c_i64_grid_YZ_chunk)
-            {
-                int32_t n = int32_t(std::min(n_64 - n_base, c_i64_grid_YZ_chunk));
-
-                int64_t shifty
-                    = offsety + (incy_64 < 0 ? -incy_64 * (n_64 - n - n_base) : n_base * incy_64);
-
-                // reduction loop
-                for(int64_t m_base = 0; m_base < m_64; m_base += c_i64_grid_X_chunk)
-                {
-                    int32_t m = int32_t(std::min(m_64 - m_base, c_i64_grid_X_chunk));
-
-                    int64_t shiftx
-                        = offsetx
-                          + (incx_64 < 0 ? -incx_64 * (m_64 - m - m_base) : m_base * incx_64);
-
-                    rocblas_status status
-                        = rocblas_internal_gemv_launcher(handle,
-                                                         transA,
-                                                         m,
-                                                         n,
-                                                         alpha_ptr,
-                                                         stride_alpha,
-                                                         A_ptr,
-                                                         offsetA + n_base * lda_64 + m_base,
-                                                         lda_64,
-                                                         strideA,
-                                                         x_ptr,
-                                                         shiftx,
-                                                         incx_64,
-                                                         stridex,
-                                                         m_base == 0 ? beta_ptr : beta_one,
-                                                         m_base == 0 ? stride_beta : 0,
-                                                         y_ptr, // used for accumulation
-                                                         shifty,
-                                                         incy_64,
-                                                         stridey,
-                                                         batch_count,
-                                                         workspace);
-                    if(status != rocblas_status_success)
-                        return status;
-                }
-            }
-        }
-
+        int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, batch_chunk));
+
+        rocblas_status status = rocblas_internal_gemv_launcher(handle,
+                                                               transA,
+                                                               (int)m_64,
+                                                               (int)n_64,
+                                                               alpha_ptr,
+                                                               stride_alpha,
+                                                               A_ptr,
+                                                               offsetA,
+                                                               lda_64,
+                                                               strideA,
+                                                               x_ptr,
+                                                               offsetx,
+                                                               incx_64,
+                                                               stridex,
+                                                               beta_ptr,
+                                                               stride_beta,
+                                                               y_ptr,
+                                                               offsety,
+                                                               incy_64,
+                                                               stridey,
+                                                               batch_count,
+                                                               workspace);
+        if(status != rocblas_status_success)
+            return status;
     } // batch
 
     return rocblas_status_success;
@@ -50,12 +50,16 @@ rocblas_status rocblas_internal_ger_launcher_64(rocblas_handle handle,
     if(!m_64 || !n_64 || !batch_count_64)
         return rocblas_status_success;
 
-    for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
+    // small problems are updated with the batch in the x dimension of the grid
+    bool    batch_major = rocblas_ger_small_batched(m_64, n_64, batch_count_64);
+    int64_t batch_chunk = rocblas_i64_batch_chunk(batch_major);
+
+    for(int64_t b_base = 0; b_base < batch_count_64; b_base += batch_chunk)
     {
         auto    x_ptr       = adjust_ptr_batch(x, b_base, stridex);
         auto    y_ptr       = adjust_ptr_batch(y, b_base, stridey);
         auto    A_ptr       = adjust_ptr_batch(A, b_base, strideA);
-        int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
+        int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, batch_chunk));
 
         for(int64_t n_base = 0; n_base < n_64; n_base += c_i64_grid_X_chunk)
         {
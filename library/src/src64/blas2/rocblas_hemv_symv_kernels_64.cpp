@@ -57,12 +57,15 @@ rocblas_status rocblas_internal_symv_hemv_launcher_64(rocblas_handle handle,
     if(n_64 > c_i32_max)
         return rocblas_status_invalid_size; // defer adding new kernels for sizes exceeding practical memory
 
-    for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
+    // small problems are computed with the batch in the x dimension of the grid
+    int64_t batch_chunk = rocblas_i64_batch_chunk(rocblas_symv_small_batched(n_64, batch_count_64));
+
+    for(int64_t b_base = 0; b_base < batch_count_64; b_base += batch_chunk)
     {
         auto    x_ptr       = adjust_ptr_batch(x, b_base, stridex);
         auto    y_ptr       = adjust_ptr_batch(y, b_base, stridey);
         auto    A_ptr       = adjust_ptr_batch(A, b_base, strideA);
-        int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
+        int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, batch_chunk));
 
         rocblas_status status = rocblas_internal_symv_hemv_launcher<IS_HEMV>(handle,
                                                                              uplo,
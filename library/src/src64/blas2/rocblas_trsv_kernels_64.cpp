@@ -25,6 +25,7 @@
 #include "rocblas_trsv_64.hpp"
 
 #include "blas2/rocblas_trsv.hpp" // int32 API called
+#include "blas2/rocblas_trsv_small_device.hpp"
 
 template <rocblas_int DIM_X, typename T, typename TConstPtr, typename TPtr>
 rocblas_status rocblas_internal_trsv_substitution_template_64(rocblas_handle    handle,
@@ -51,11 +52,14 @@ rocblas_status rocblas_internal_trsv_substitution_template_64(rocblas_handle
     if(n_64 > c_i32_max)
         return rocblas_status_invalid_size; // defer adding new kernels for sizes exceeding practical memory
 
-    for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
+    // small systems are solved with the batch in the x dimension of the grid
+    int64_t batch_chunk = rocblas_i64_batch_chunk(n_64 <= rocblas_trsv_small_n<T>());
+
+    for(int64_t b_base = 0; b_base < batch_count_64; b_base += batch_chunk)
     {
         auto    x_ptr       = adjust_ptr_batch(x, b_base, stride_x);
         auto    A_ptr       = adjust_ptr_batch(A, b_base, stride_A);
-        int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
+        int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, batch_chunk));
 
         auto shift_A = offset_A;
 
@@ -25,6 +25,43 @@
 #include "rocblas-types.h"
 #include "rocblas_dgmm_64.hpp"
 
+// Native int64 kernel used when m or n exceeds c_i32_max, striding over the matrix and the batch
+// so that one launch covers them
+template <int DIM_X, int DIM_Y, bool side_right, typename TConstPtr, typename TPtr>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_dgmm_kernel_64(int64_t                         m,
+                       int64_t                         n,
+                       rocblas_batch_window<TConstPtr> Aw,
+                       rocblas_stride                  offset_a,
+                       int64_t                         lda,
+                       rocblas_stride                  stride_a,
+                       rocblas_batch_window<TConstPtr> Xw,
+                       int64_t                         shift_x,
+                       int64_t                         incx,
+                       rocblas_stride                  stride_x,
+                       rocblas_batch_window<TPtr>      Cw,
+                       rocblas_stride                  offset_c,
+                       int64_t                         ldc,
+                       rocblas_stride                  stride_c)
+{
+    for(int64_t b = blockIdx.z; b < Cw.count; b += gridDim.z)
+    {
+        auto* A = load_ptr_batch(Aw, b, offset_a, stride_a);
+        auto* X = load_ptr_batch(Xw, b, shift_x, stride_x);
+        auto* C = load_ptr_batch(Cw, b, offset_c, stride_c);
+
+        for(int64_t ty = blockIdx.y * int64_t(DIM_Y) + threadIdx.y; ty < n;
+            ty += int64_t(gridDim.y) * DIM_Y)
+        {
+            for(int64_t tx = blockIdx.x * int64_t(DIM_X) + threadIdx.x; tx < m;
+                tx += int64_t(gridDim.x) * DIM_X)
+            {
+                C[tx + ldc * ty] = A[tx + lda * ty] * X[(side_right ? ty : tx) * incx];
+            }
+        }
+    }
+}
+
 /*
  * ===========================================================================
  *    template interface
@@ -63,7 +100,37 @@ rocblas_status rocblas_internal_dgmm_launcher_64(rocblas_handle handle,
     if(!m_64 || !n_64 || !batch_count_64)
         return rocblas_status_success;
 
-    bool dims_32bit = m_64 <= c_i32_max && n_64 <= c_i32_max;
+    // m or n beyond int32 use the native int64 kernel, one launch for the whole operation
+    if(m_64 > c_i32_max || n_64 > c_i32_max)
+    {
+        static constexpr int DGMM_DIM_X = 64;
+        static constexpr int DGMM_DIM_Y = 4;
+
+        // in case of negative incx shift pointer to end of data for negative indexing
+        int64_t k       = side == rocblas_side_left ? m_64 : n_64;
+        int64_t shift_x = offset_x - (incx_64 < 0 ? incx_64 * (k - 1) : 0);
+
+        dim3 dgmm_grid(std::min((m_64 - 1) / DGMM_DIM_X + 1, c_i64_grid_X_chunk),
+                       std::min((n_64 - 1) / DGMM_DIM_Y + 1, c_i64_grid_YZ_chunk),
+                       std::min(batch_count_64, c_i64_grid_YZ_chunk));
+        dim3 dgmm_threads(DGMM_DIM_X, DGMM_DIM_Y);
+
+#define dgmm_64_KARGS                                                                \
+    dgmm_grid, dgmm_threads, 0, handle->get_stream(), m_64, n_64,                    \
+        rocblas_make_batch_window(A, 0, batch_count_64), offset_A, lda_64, stride_A, \
+        rocblas_make_batch_window(x, 0, batch_count_64), shift_x, incx_64, stride_x, \
+        rocblas_make_batch_window(C, 0, batch_count_64), offset_C, ldc_64, stride_C
+
+        if(side == rocblas_side_left)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_dgmm_kernel_64<DGMM_DIM_X, DGMM_DIM_Y, false>),
+                                  dgmm_64_KARGS);
+        else
+            ROCBLAS_LAUNCH_KERNEL((rocblas_dgmm_kernel_64<DGMM_DIM_X, DGMM_DIM_Y, true>),
+                                  dgmm_64_KARGS);
+#undef dgmm_64_KARGS
+
+        return rocblas_status_success;
+    }
 
     for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
     {
@@ -72,102 +139,25 @@ rocblas_status rocblas_internal_dgmm_launcher_64(rocblas_handle handle,
         auto    C_ptr       = adjust_ptr_batch(C, b_base, stride_C);
         int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
 
-        if(dims_32bit)
-        {
-            rocblas_status status = rocblas_internal_dgmm_launcher(handle,
-                                                                   side,
-                                                                   (int)m_64,
-                                                                   (int)n_64,
-                                                                   A_ptr,
-                                                                   offset_A,
-                                                                   lda_64,
-                                                                   stride_A,
-                                                                   x_ptr,
-                                                                   offset_x,
-                                                                   incx_64,
-                                                                   stride_x,
-                                                                   C_ptr,
-                                                                   offset_C,
-                                                                   ldc_64,
-                                                                   stride_C,
-                                                                   batch_count);
-            if(status != rocblas_status_success)
-                return status;
-        }
-        else if(side == rocblas_side_left)
-        {
-            for(int64_t n_base = 0; n_base < n_64; n_base += c_i64_grid_YZ_chunk)
-            {
-                int32_t n = int32_t(std::min(n_64 - n_base, c_i64_grid_YZ_chunk));
-
-                for(int64_t m_base = 0; m_base < m_64; m_base += c_i64_grid_X_chunk)
-                {
-                    int32_t m = int32_t(std::min(m_64 - m_base, c_i64_grid_X_chunk));
-
-                    int64_t shift_x
-                        = offset_x
-                          + (incx_64 < 0 ? -incx_64 * (m_64 - m - m_base) : m_base * incx_64);
-
-                    rocblas_status status
-                        = rocblas_internal_dgmm_launcher(handle,
-                                                         side,
-                                                         m,
-                                                         n,
-                                                         A_ptr,
-                                                         offset_A + m_base + n_base * lda_64,
-                                                         lda_64,
-                                                         stride_A,
-                                                         x_ptr,
-                                                         shift_x,
-                                                         incx_64,
-                                                         stride_x,
-                                                         C_ptr,
-                                                         offset_C + m_base + n_base * ldc_64,
-                                                         ldc_64,
-                                                         stride_C,
-                                                         batch_count);
-                    if(status != rocblas_status_success)
-                        return status;
-                }
-            }
-        }
-        else // if(side == rocblas_side_right)
-        {
-            for(int64_t n_base = 0; n_base < n_64; n_base += c_i64_grid_YZ_chunk)
-            {
-                int32_t n = int32_t(std::min(n_64 - n_base, c_i64_grid_YZ_chunk));
-
-                int64_t shift_x
-                    = offset_x + (incx_64 < 0 ? -incx_64 * (n_64 - n - n_base) : n_base * incx_64);
-
-                for(int64_t m_base = 0; m_base < m_64; m_base += c_i64_grid_X_chunk)
-                {
-                    int32_t m = int32_t(std::min(m_64 - m_base, c_i64_grid_X_chunk));
-
-                    rocblas_status status
-                        = rocblas_internal_dgmm_launcher(handle,
-                                                         side,
-                                                         m,
-                                                         n,
-                                                         A_ptr,
-                                                         offset_A + m_base + n_base * lda_64,
-                                                         lda_64,
-                                                         stride_A,
-                                                         x_ptr,
-                                                         shift_x,
-                                                         incx_64,
-                                                         stride_x,
-                                                         C_ptr,
-                                                         offset_C + m_base + n_base * ldc_64,
-                                                         ldc_64,
-                                                         stride_C,
-                                                         batch_count);
-                    if(status != rocblas_status_success)
-                        return status;
-                }
-            }
-        }
-
+        rocblas_status status = rocblas_internal_dgmm_launcher(handle,
+                                                               side,
+                                                               (int)m_64,
+                                                               (int)n_64,
+                                                               A_ptr,
+                                                               offset_A,
+                                                               lda_64,
+                                                               stride_A,
+                                                               x_ptr,
+                                                               offset_x,
+                                                               incx_64,
+                                                               stride_x,
+                                                               C_ptr,
+                                                               offset_C,
+                                                               ldc_64,
+                                                               stride_C,
+                                                               batch_count);
+        if(status != rocblas_status_success)
+            return status;
     } // batch
 
     return rocblas_status_success;
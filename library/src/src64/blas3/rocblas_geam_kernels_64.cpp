@@ -25,6 +25,105 @@
 #include "rocblas-types.h"
 #include "rocblas_geam_64.hpp"
 
+// Stages op(X)(m0 + i, n0 + j) at tile[j][i], reading along the columns of X for any op, or zeros
+// for X == nullptr
+template <int TILE, int ROWS, typename T>
+ROCBLAS_KERNEL_ILF void rocblas_geam_load_tile_64(rocblas_operation trans,
+                                                  const T*          X,
+                                                  int64_t           ldx,
+                                                  int64_t           m,
+                                                  int64_t           n,
+                                                  int64_t           m0,
+                                                  int64_t           n0,
+                                                  T (*tile)[TILE + 1])
+{
+    for(int r = threadIdx.y; r < TILE; r += ROWS)
+    {
+        if(trans == rocblas_operation_none)
+        {
+            int64_t i = m0 + threadIdx.x;
+            int64_t j = n0 + r;
+
+            tile[r][threadIdx.x] = X && i < m && j < n ? X[i + j * ldx] : T(0);
+        }
+        else
+        {
+            int64_t i = m0 + r;
+            int64_t j = n0 + threadIdx.x;
+
+            T val = X && i < m && j < n ? X[j + i * ldx] : T(0);
+
+            tile[threadIdx.x][r] = trans == rocblas_operation_conjugate_transpose ? conj(val) : val;
+        }
+    }
+}
+
+// Native int64 kernel used when m or n exceeds c_i32_max, striding over TILE x TILE tiles of C and
+// the batch so that one launch covers them. Transposed operands go through LDS so their reads
+// coalesce as well as the writes of C.
+template <int TILE, int ROWS, typename TScal, typename TConstPtr, typename TPtr>
+ROCBLAS_KERNEL(TILE* ROWS)
+rocblas_geam_kernel_64(rocblas_operation               transA,
+                       rocblas_operation               transB,
+                       int64_t                         m,
+                       int64_t                         n,
+                       TScal                           alpha_device_host,
+                       rocblas_batch_window<TConstPtr> Aw,
+                       rocblas_stride                  offset_a,
+                       int64_t                         lda,
+                       rocblas_stride                  stride_a,
+                       TScal                           beta_device_host,
+                       rocblas_batch_window<TConstPtr> Bw,
+                       rocblas_stride                  offset_b,
+                       int64_t                         ldb,
+                       rocblas_stride                  stride_b,
+                       rocblas_batch_window<TPtr>      Cw,
+                       rocblas_stride                  offset_c,
+                       int64_t                         ldc,
+                       rocblas_stride                  stride_c)
+{
+    using T = rocblas_batch_elem_t<TPtr>;
+
+    __shared__ T tile_a[TILE][TILE + 1];
+    __shared__ T tile_b[TILE][TILE + 1];
+
+    auto alpha = load_scalar(alpha_device_host);
+    auto beta  = load_scalar(beta_device_host);
+
+    int64_t tiles_m = (m - 1) / TILE + 1;
+    int64_t tiles_n = (n - 1) / TILE + 1;
+
+    for(int64_t b = blockIdx.z; b < Cw.count; b += gridDim.z)
+    {
+        const T* A = alpha ? load_ptr_batch(Aw, b, offset_a, stride_a) : nullptr;
+        const T* B = beta ? load_ptr_batch(Bw, b, offset_b, stride_b) : nullptr;
+        T*       C = load_ptr_batch(Cw, b, offset_c, stride_c);
+
+        for(int64_t tn = blockIdx.y; tn < tiles_n; tn += gridDim.y)
+        {
+            for(int64_t tm = blockIdx.x; tm < tiles_m; tm += gridDim.x)
+            {
+                int64_t m0 = tm * TILE;
+                int64_t n0 = tn * TILE;
+
+                rocblas_geam_load_tile_64<TILE, ROWS>(transA, A, lda, m, n, m0, n0, tile_a);
+                rocblas_geam_load_tile_64<TILE, ROWS>(transB, B, ldb, m, n, m0, n0, tile_b);
+                __syncthreads();
+
+                int64_t i = m0 + threadIdx.x;
+                for(int r = threadIdx.y; r < TILE; r += ROWS)
+                {
+                    int64_t j = n0 + r;
+                    if(i < m && j < n)
+                        C[i + j * ldc]
+                            = beta * tile_b[r][threadIdx.x] + alpha * tile_a[r][threadIdx.x];
+                }
+                __syncthreads();
+            }
+        }
+    }
+}
+
 template <typename TScal, typename TConstPtr, typename TPtr>
 rocblas_status rocblas_geam_launcher_64(rocblas_handle    handle,
                                         rocblas_operation transA,
@@ -51,7 +150,38 @@ rocblas_status rocblas_geam_launcher_64(rocblas_handle    handle,
     if(!m_64 || !n_64 || !batch_count_64)
         return rocblas_status_success;
 
-    bool dims_32bit = m_64 <= c_i32_max && n_64 <= c_i32_max;
+    // m or n beyond int32 use the native int64 kernel, one launch for the whole operation
+    if(m_64 > c_i32_max || n_64 > c_i32_max)
+    {
+        // in-place transposes need m == n, beyond practical memory at these sizes
+        if((C == A && transA != rocblas_operation_none)
+           || (C == B && transB != rocblas_operation_none))
+            return rocblas_status_invalid_size;
+
+        static constexpr int GEAM_TILE      = 32;
+        static constexpr int GEAM_TILE_ROWS = 8;
+
+        dim3 geam_grid(std::min((m_64 - 1) / GEAM_TILE + 1, c_i64_grid_X_chunk),
+                       std::min((n_64 - 1) / GEAM_TILE + 1, c_i64_grid_YZ_chunk),
+                       std::min(batch_count_64, c_i64_grid_YZ_chunk));
+        dim3 geam_threads(GEAM_TILE, GEAM_TILE_ROWS);
+
+#define geam_64_KARGS(alpha_, beta_)                                                        \
+    geam_grid, geam_threads, 0, handle->get_stream(), transA, transB, m_64, n_64, alpha_,   \
+        rocblas_make_batch_window(A, 0, batch_count_64), offset_A, lda_64, stride_A, beta_, \
+        rocblas_make_batch_window(B, 0, batch_count_64), offset_B, ldb_64, stride_B,        \
+        rocblas_make_batch_window(C, 0, batch_count_64), offset_C, ldc_64, stride_C
+
+        if(handle->pointer_mode == rocblas_pointer_mode_device)
+            ROCBLAS_LAUNCH_KERNEL((rocblas_geam_kernel_64<GEAM_TILE, GEAM_TILE_ROWS>),
+                                  geam_64_KARGS(alpha, beta));
+        else
+            ROCBLAS_LAUNCH_KERNEL((rocblas_geam_kernel_64<GEAM_TILE, GEAM_TILE_ROWS>),
+                                  geam_64_KARGS(*alpha, *beta));
+#undef geam_64_KARGS
+
+        return rocblas_status_success;
+    }
 
     for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
     {
@@ -60,69 +190,28 @@ rocblas_status rocblas_geam_launcher_64(rocblas_handle    handle,
         auto    C_ptr       = adjust_ptr_batch(C, b_base, stride_C);
         int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
 
-        if(dims_32bit)
-        {
-            rocblas_status status = rocblas_geam_launcher(handle,
-                                                          transA,
-                                                          transB,
-                                                          (int)m_64,
-                                                          (int)n_64,
-                                                          alpha,
-                                                          A_ptr,
-                                                          offset_A,
-                                                          lda_64,
-                                                          stride_A,
-                                                          beta,
-                                                          B_ptr,
-                                                          offset_B,
-                                                          ldb_64,
-                                                          stride_B,
-                                                          C_ptr,
-                                                          offset_C,
-                                                          ldc_64,
-                                                          stride_C,
-                                                          batch_count);
-            if(status != rocblas_status_success)
-                return status;
-        }
-        else
-        {
-            for(int64_t n_base = 0; n_base < n_64; n_base += c_i64_grid_YZ_chunk)
-            {
-                int32_t n = int32_t(std::min(n_64 - n_base, c_i64_grid_YZ_chunk));
-
-                for(int64_t m_base = 0; m_base < m_64; m_base += c_i64_grid_X_chunk)
-                {
-                    int32_t m = int32_t(std::min(m_64 - m_base, c_i64_grid_X_chunk));
-
-                    rocblas_status status = rocblas_geam_launcher(
-                        handle,
-                        transA,
-                        transB,
-                        m,
-                        n,
-                        alpha,
-                        A_ptr,
-                        transA == rocblas_operation_none ? offset_A + m_base + n_base * lda_64
-                                                         : offset_A + m_base * lda_64 + n_base,
-                        lda_64,
-                        stride_A,
-                        beta,
-                        B_ptr,
-                        transB == rocblas_operation_none ? offset_B + m_base + n_base * ldb_64
-                                                         : offset_B + m_base * ldb_64 + n_base,
-                        ldb_64,
-                        stride_B,
-                        C_ptr,
-                        offset_C + m_base + n_base * ldc_64,
-                        ldc_64,
-                        stride_C,
-                        batch_count);
-                    if(status != rocblas_status_success)
-                        return status;
-                }
-            }
-        }
+        rocblas_status status = rocblas_geam_launcher(handle,
+                                                      transA,
+                                                      transB,
+                                                      (int)m_64,
+                                                      (int)n_64,
+                                                      alpha,
+                                                      A_ptr,
+                                                      offset_A,
+                                                      lda_64,
+                                                      stride_A,
+                                                      beta,
+                                                      B_ptr,
+                                                      offset_B,
+                                                      ldb_64,
+                                                      stride_B,
+                                                      C_ptr,
+                                                      offset_C,
+                                                      ldc_64,
+                                                      stride_C,
+                                                      batch_count);
+        if(status != rocblas_status_success)
+            return status;
     }
     return rocblas_status_success;
 }
@@ -60,15 +60,17 @@ rocblas_status rocblas_internal_gemm_64(rocblas_handle    handle,
 
     rocblas_status status = rocblas_status_success;
 
+    // Tensile and the source kernels take the whole int32 batch range in one problem, the
+    // source kernels stride over the batch beyond the grid
     if(dims_32bit && leading_32bit)
     {
-        for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
+        for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i32_max)
         {
             auto A_ptr = adjust_ptr_batch(A, b_base, stride_a);
             auto B_ptr = adjust_ptr_batch(B, b_base, stride_b);
             auto C_ptr = adjust_ptr_batch(C, b_base, stride_c);
 
-            int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
+            int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i32_max));
 
             status = rocblas_internal_gemm<BATCHED>(handle,
                                                     trans_a,
@@ -107,18 +109,25 @@ rocblas_status rocblas_internal_gemm_64(rocblas_handle    handle,
 
         hipStream_t rocblas_stream = handle->get_stream();
 
-        for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
+        for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i32_max)
         {
             auto A_ptr = adjust_ptr_batch(A, b_base, stride_a);
             auto B_ptr = adjust_ptr_batch(B, b_base, stride_b);
             auto C_ptr = adjust_ptr_batch(C, b_base, stride_c);
 
-            int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
+            int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i32_max));
 
             if(k_64 == 0 || (alpha && *alpha == 0))
             {
-                status = rocblas_gemm_scale_launcher_64(
-                    m_64, n_64, *beta, C, offset_c, ldc_64, stride_c, batch_count, rocblas_stream);
+                status = rocblas_gemm_scale_launcher_64(m_64,
+                                                        n_64,
+                                                        *beta,
+                                                        C_ptr,
+                                                        offset_c,
+                                                        ldc_64,
+                                                        stride_c,
+                                                        batch_count,
+                                                        rocblas_stream);
             }
             else
             {
@@ -96,25 +96,26 @@ rocblas_status rocblas_internal_trsm_launcher_64(rocblas_handle    handle,
                                                                      offset_invA,
                                                                      stride_invA);
 
-    for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
+    // may be able to call 32-bit trsm while only iterating through batches. Need to be careful
+    // about allocated memory and offsets between groups of kernel launches
+    if(n_64 <= c_i32_max && m_64 < c_i32_max && lda_64 < c_i32_max && ldb_64 < c_i32_max
+       && supplied_invA_size_64 < c_i32_max)
     {
-        int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
-
-        auto A_ptr = adjust_ptr_batch(A, b_base, stride_A);
-        auto B_ptr = adjust_ptr_batch(B, b_base, stride_B);
-        // with w_x_ptr we don't have to offset as we can reuse the memory between kernel launches
-        // with invA we don't have to offset either. However, this is NOT true for trsm_ex. This adjustment should work
-        // for trsm_ex, but it isn't supported yet so it isn't tested either
-        auto invA_ptr
-            = adjust_ptr_batch((const T*)invA, b_base, (supplied_invA ? supplied_invA_size_64 : 0));
-        auto invAarr_ptr
-            = adjust_ptr_batch((const T* const*)invAarr, (supplied_invA ? b_base : 0), 0);
-
-        // may be able to call 32-bit trsm while only iterating through batches. Need to be careful about
-        // allocated memory and offsets between groups of kernel launches
-        if(n_64 <= c_i32_max && m_64 < c_i32_max && lda_64 < c_i32_max && ldb_64 < c_i32_max
-           && supplied_invA_size_64 < c_i32_max)
+        for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
         {
+            int32_t batch_count
+                = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
+
+            auto A_ptr = adjust_ptr_batch(A, b_base, stride_A);
+            auto B_ptr = adjust_ptr_batch(B, b_base, stride_B);
+            // with w_x_ptr we don't have to offset as we can reuse the memory between kernel launches
+            // with invA we don't have to offset either. However, this is NOT true for trsm_ex. This adjustment should work
+            // for trsm_ex, but it isn't supported yet so it isn't tested either
+            auto invA_ptr = adjust_ptr_batch(
+                (const T*)invA, b_base, (supplied_invA ? supplied_invA_size_64 : 0));
+            auto invAarr_ptr
+                = adjust_ptr_batch((const T* const*)invAarr, (supplied_invA ? b_base : 0), 0);
+
             auto status
                 = rocblas_internal_trsm_launcher<BLOCK, DIM_X, BATCHED>(handle,
                                                                         side,
@@ -146,78 +147,89 @@ rocblas_status rocblas_internal_trsm_launcher_64(rocblas_handle    handle,
             if(status != rocblas_status_success)
                 return status;
         }
-        else
+        return rocblas_status_success;
+    }
+
+    // A couple cases are possible here:
+    // 1. side == LEFT
+    //     a) m > 32-bit
+    //        - this isn't possible with current memory restrictions as A is m x m
+    //     b) n > 32-bit
+    //        - this is possible, but m and ldb will have to be fairly small given memory restrictions
+    //        - this can use a simple substitution method that doesn't need GEMMs
+    //     c) lda > 32-bit
+    //        - this is possible, but m will have to be fairly small
+    //        - can use simple substitution without GEMM
+    //     d) ldb > 32-bit
+    //        - this is possible, but n will have to be fairly small
+    //        - here, m can be large. We can use a substitution method which uses GEMMs for better performance
+    // 2. side == RIGHT
+    //     a) m > 32-bit
+    //        - this is possible, but n will be fairly small
+    //        - can use substitution method with GEMMs
+    //     b) n > 32-bit
+    //        - this isn't possible with current memory restrictions
+    //     c) lda > 32-bit
+    //        - essentially the same as the large m case as n must be small
+    //     d) ldb > 32-bit
+    //        - essentially the same as the large m case as n must be small
+
+    // In all cases we'll be using the substitution method in trsm for now.
+    // Tensile doesn't currently support 64-bit params, so we need to have a solution which doesn't depend
+    // on Tensile. The substitution kernels stride over the rows (columns for side left) of B and
+    // the updates use the 64-bit gemm, so each batch chunk is solved over all of m and n.
+
+    // not worrying about tuning block sizes right now
+    rocblas_int blksize = 64;
+
+    // Temporarily switch to host pointer mode, saving current pointer mode, restored on return
+    auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+    // Get alpha - Check if zero for quick return
+    T alpha_h;
+    if(saved_pointer_mode == rocblas_pointer_mode_host)
+        alpha_h = *alpha;
+    else
+    {
+        RETURN_IF_ROCBLAS_ERROR(handle->check_capturable("device pointer mode alpha of trsm_64"));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &alpha_h, alpha, sizeof(T), hipMemcpyDeviceToHost, handle->get_stream()));
+        RETURN_IF_HIP_ERROR(handle->synchronize_stream());
+    }
+
+    for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
+    {
+        int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
+
+        auto A_ptr = adjust_ptr_batch(A, b_base, stride_A);
+        auto B_ptr = adjust_ptr_batch(B, b_base, stride_B);
+
+        if(alpha_h == T(0.0))
         {
-            // A couple cases are possible here:
-            // 1. side == LEFT
-            //     a) m > 32-bit
-            //        - this isn't possible with current memory restrictions as A is m x m
-            //     b) n > 32-bit
-            //        - this is possible, but m and ldb will have to be fairly small given memory restrictions
-            //        - this can use a simple substitution method that doesn't need GEMMs
-            //     c) lda > 32-bit
-            //        - this is possible, but m will have to be fairly small
-            //        - can use simple substitution without GEMM
-            //     d) ldb > 32-bit
-            //        - this is possible, but n will have to be fairly small
-            //        - here, m can be large. We can use a substitution method which uses GEMMs for better performance
-            // 2. side == RIGHT
-            //     a) m > 32-bit
-            //        - this is possible, but n will be fairly small
-            //        - can use substitution method with GEMMs
-            //     b) n > 32-bit
-            //        - this isn't possible with current memory restrictions
-            //     c) lda > 32-bit
-            //        - essentially the same as the large m case as n must be small
-            //     d) ldb > 32-bit
-            //        - essentially the same as the large m case as n must be small
-
-            // In all cases we'll be using the substitution method in trsm for now.
-            // Tensile doesn't currently support 64-bit params, so we need to have a solution which doesn't depend
-            // on Tensile
-
-            // not worrying about tuning block sizes right now
-            rocblas_int blksize = 64;
-
-            // Temporarily switch to host pointer mode, saving current pointer mode, restored on return
-            auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
-
-            // Get alpha - Check if zero for quick return
-            T alpha_h;
-            if(saved_pointer_mode == rocblas_pointer_mode_host)
-                alpha_h = *alpha;
-            else
-            {
-                RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-                    &alpha_h, alpha, sizeof(T), hipMemcpyDeviceToHost, handle->get_stream()));
-                RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->get_stream()));
-            }
-
-            if(alpha_h == T(0.0))
-            {
-                return set_block_unit<T>(
-                    handle, m_64, n_64, B, ldb_64, stride_B, batch_count, 0.0, offset_B);
-            }
-
-            return rocblas_internal_trsm_small_substitution_launcher<BATCHED>(handle,
-                                                                              side,
-                                                                              uplo,
-                                                                              transA,
-                                                                              diag,
-                                                                              m_64,
-                                                                              n_64,
-                                                                              alpha_h,
-                                                                              A_ptr,
-                                                                              offset_A,
-                                                                              lda_64,
-                                                                              stride_A,
-                                                                              B_ptr,
-                                                                              offset_B,
-                                                                              ldb_64,
-                                                                              stride_B,
-                                                                              batch_count,
-                                                                              blksize);
+            RETURN_IF_ROCBLAS_ERROR(set_block_unit<T>(
+                handle, m_64, n_64, B_ptr, ldb_64, stride_B, batch_count, 0.0, offset_B));
+            continue;
         }
+
+        RETURN_IF_ROCBLAS_ERROR(
+            rocblas_internal_trsm_small_substitution_launcher<BATCHED>(handle,
+                                                                       side,
+                                                                       uplo,
+                                                                       transA,
+                                                                       diag,
+                                                                       m_64,
+                                                                       n_64,
+                                                                       alpha_h,
+                                                                       A_ptr,
+                                                                       offset_A,
+                                                                       lda_64,
+                                                                       stride_A,
+                                                                       B_ptr,
+                                                                       offset_B,
+                                                                       ldb_64,
+                                                                       stride_B,
+                                                                       batch_count,
+                                                                       blksize));
     }
 
     return rocblas_status_success;
@@ -28,6 +28,10 @@
 #include "blas3/rocblas_gemm_source.hpp"
 #include "blas_ex/rocblas_gemm_ex.hpp" // int32 API called
 
+#ifdef BUILD_WITH_TENSILE
+#include "blas3/Tensile/gemm_tensile.hpp"
+#endif
+
 template <bool BATCHED, typename Ti, typename To, typename TScal>
 rocblas_status rocblas_internal_gemm_ex_typecasting_64(rocblas_handle     handle,
                                                        rocblas_operation  trans_a,
@@ -117,14 +121,24 @@ rocblas_status rocblas_internal_gemm_ex_typecasting_64(rocblas_handle     handle
             return gemm_ex_check_numerics_status;
     }
 
+    rocblas_gemm_epilogue_args epilogue(handle->active_gemm_epilogue);
+
     constexpr int64_t limit = c_i32_max * 16; // source kernels must have m and n blocks >= 16
     bool              source_dims_supported = (m_64 <= limit && n_64 <= limit) || k_64 == 0;
     if(!source_dims_supported)
         return rocblas_status_invalid_size;
 
-    for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
+#ifdef BUILD_WITH_TENSILE
+    // Sizes within int32 are solved by Tensile, which takes the 64-bit leading dimensions and
+    // strides in a single problem descriptor, the source kernels are the fallback if Tensile
+    // has no solution
+    bool use_tensile = m_64 <= c_i32_max && n_64 <= c_i32_max && k_64 <= c_i32_max && k_64 > 0
+                       && !handle->active_gemm_epilogue;
+#endif
+
+    for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i32_max)
     {
-        int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
+        int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i32_max));
 
         rocblas_stride offsetA = offsetAin;
         rocblas_stride offsetB = offsetBin;
@@ -136,6 +150,48 @@ rocblas_status rocblas_internal_gemm_ex_typecasting_64(rocblas_handle     handle
         auto C_ptr = adjust_ptr_batch((Tc)c, b_base, stride_c);
         auto D_ptr = adjust_ptr_batch((Td)d, b_base, stride_d);
 
+#ifdef BUILD_WITH_TENSILE
+        if(use_tensile)
+        {
+            status = rocblas_call_tensile(handle,
+                                          (const TScal*)alpha,
+                                          (const TScal*)beta,
+                                          A_ptr,
+                                          B_ptr,
+                                          C_ptr,
+                                          D_ptr,
+                                          trans_a,
+                                          trans_b,
+                                          ldd_64,
+                                          stride_d,
+                                          offsetD,
+                                          ldc_64,
+                                          stride_c,
+                                          offsetC,
+                                          lda_64,
+                                          stride_a,
+                                          offsetA,
+                                          ldb_64,
+                                          stride_b,
+                                          offsetB,
+                                          m_64,
+                                          n_64,
+                                          k_64,
+                                          batch_count,
+                                          algo,
+                                          solution_index,
+                                          flags);
+
+            use_tensile = status != rocblas_status_not_implemented;
+            if(use_tensile)
+            {
+                if(status != rocblas_status_success)
+                    return status;
+                continue;
+            }
+        }
+#endif
+
         status = rocblas_gemm_source_solution_64<BATCHED>(trans_a,
                                                           trans_b,
                                                           m_64,
@@ -160,7 +216,8 @@ rocblas_status rocblas_internal_gemm_ex_typecasting_64(rocblas_handle     handle
                                                           stride_d,
                                                           offsetD,
                                                           batch_count,
-                                                          rocblas_stream);
+                                                          rocblas_stream,
+                                                          epilogue.batch_offset<To>(b_base));
 
         if(status != rocblas_status_success)
             return status;
@@ -241,9 +298,9 @@ rocblas_status rocblas_gemm_ex_template_64(rocblas_handle    handle,
     // if all dims are 32-bit, can use regular gemm_ex
     if(dims_32bit)
     {
-        for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i64_grid_YZ_chunk)
+        for(int64_t b_base = 0; b_base < batch_count_64; b_base += c_i32_max)
         {
-            int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i64_grid_YZ_chunk));
+            int32_t batch_count = int32_t(std::min(batch_count_64 - b_base, c_i32_max));
 
             rocblas_stride offsetA = offsetAin;
             rocblas_stride offsetB = offsetBin;
@@ -271,6 +328,29 @@ rocblas_status rocblas_gemm_ex_template_64(rocblas_handle    handle,
                 offsetD += b_base * stride_d;
             }
 
+            // The epilogue vectors of later batch chunks are offset like the matrices
+            rocblas_gemm_epilogue epilogue_b;
+            auto                  epilogue = handle->active_gemm_epilogue;
+            if(epilogue && b_base > 0)
+            {
+                size_t size_d = rocblas_sizeof_datatype(d_type);
+
+                epilogue_b = *epilogue;
+                if(epilogue_b.bias)
+                    epilogue_b.bias
+                        = (const char*)epilogue_b.bias + b_base * epilogue_b.stride_bias * size_d;
+                if(epilogue_b.aux)
+                    epilogue_b.aux = (char*)epilogue_b.aux + b_base * epilogue_b.stride_aux * size_d;
+                if(epilogue_b.scale_row)
+                    epilogue_b.scale_row = (const char*)epilogue_b.scale_row
+                                           + b_base * epilogue_b.stride_scale_row * size_d;
+                if(epilogue_b.scale_column)
+                    epilogue_b.scale_column = (const char*)epilogue_b.scale_column
+                                              + b_base * epilogue_b.stride_scale_column * size_d;
+                epilogue = &epilogue_b;
+            }
+            auto saved_epilogue = handle->push_gemm_epilogue(epilogue);
+
             rocblas_status status = rocblas_gemm_ex_template<BATCHED>(handle,
                                                                       trans_a,
                                                                       trans_b,
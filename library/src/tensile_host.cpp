@@ -29,6 +29,8 @@
  * or reference Tensile identifiers. tensile_host.hpp defines the interface. *
  *****************************************************************************/
 
+#include "hipblaslt_host.hpp"
+#include "roctx_ranges.hpp"
 #include "tensile_host.hpp"
 //#include <Tensile/AMDGPU.hpp>
 #include <Tensile/Contractions.hpp>
@@ -41,16 +43,29 @@
 #include <Tensile/hip/HipHardware.hpp>
 #include <Tensile/hip/HipSolutionAdapter.hpp>
 #include <Tensile/hip/HipUtils.hpp>
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <complex>
+#include <condition_variable>
+#include <deque>
 #include <exception>
+#include <fstream>
+#include <functional>
 #include <future>
+#include <hip/hip_ext.h>
 #include <iomanip>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <regex>
+#include <shared_mutex>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #ifdef WIN32
@@ -59,11 +74,15 @@
 #include <fileapi.h>
 #include <io.h>
 #include <libloaderapi.h>
+#include <process.h>
 #define ROCBLAS_LIB_PATH "C:/hipSDK/rocblas/bin"
 #else
+#include <fcntl.h>
 #include <glob.h>
 #include <libgen.h>
 #include <link.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #define ROCBLAS_LIB_PATH "/opt/rocm/lib"
 #endif
@@ -366,6 +385,33 @@ namespace
         // It optimizes all problems with alpha==0 into K=0 and alpha=(don't care)
         auto k = prob.k && *prob.alpha ? prob.k : 0;
 
+        // A strided batch with A or B broadcast (batch stride 0) is one larger GEMM when the
+        // batches of the other operand and of C and D follow each other along the free index:
+        // the batch is folded into N when A is shared and into M when B is shared, so that the
+        // shared operand is read once rather than by the workgroups of each batch.
+        size_t m = prob.m, n = prob.n, batch_count = prob.batch_count;
+        if(prob.strided_batch && batch_count > 1)
+        {
+            size_t stride_m_a = prob.trans_a == rocblas_operation_none ? prob.row_stride_a
+                                                                       : prob.col_stride_a;
+            size_t stride_n_b = prob.trans_b == rocblas_operation_none ? prob.col_stride_b
+                                                                       : prob.row_stride_b;
+            if(!prob.batch_stride_a && prob.batch_stride_b == stride_n_b * n
+               && prob.batch_stride_c == prob.col_stride_c * n
+               && prob.batch_stride_d == prob.col_stride_d * n)
+            {
+                n *= batch_count;
+                batch_count = 1;
+            }
+            else if(!prob.batch_stride_b && prob.batch_stride_a == stride_m_a * m
+                    && prob.batch_stride_c == prob.row_stride_c * m
+                    && prob.batch_stride_d == prob.row_stride_d * m)
+            {
+                m *= batch_count;
+                batch_count = 1;
+            }
+        }
+
         // clang-format off
 
         // If A is transposed, swap the free and bound dimensions and their ranks
@@ -373,7 +419,7 @@ namespace
         {
             a = {
                     Tensile_TiA,
-                    {k, prob.m, prob.batch_count},
+                    {k, m, batch_count},
                     {prob.row_stride_a, prob.col_stride_a, prob.batch_stride_a},
                     prob.buffer_offset_a
                 };
@@ -384,7 +430,7 @@ namespace
         {
             a = {
                     Tensile_TiA,
-                    {prob.m, k, prob.batch_count},
+                    {m, k, batch_count},
                     {prob.row_stride_a, prob.col_stride_a, prob.batch_stride_a},
                     prob.buffer_offset_a
                 };
@@ -401,7 +447,7 @@ namespace
         {
             b = {
                     Tensile_TiB,
-                    {prob.n, k, prob.batch_count},
+                    {n, k, batch_count},
                     {prob.row_stride_b, prob.col_stride_b, prob.batch_stride_b},
                     prob.buffer_offset_b
                 };
@@ -412,7 +458,7 @@ namespace
         {
             b = {
                     Tensile_TiB,
-                    {k, prob.n, prob.batch_count},
+                    {k, n, batch_count},
                     {prob.row_stride_b, prob.col_stride_b, prob.batch_stride_b},
                     prob.buffer_offset_b
                 };
@@ -428,13 +474,13 @@ namespace
 
         // Descriptor for input matrix C
         Tensile::TensorDescriptor c{Tensile_To,
-                                    {prob.m, prob.n, prob.batch_count},
+                                    {m, n, batch_count},
                                     {prob.row_stride_c, prob.col_stride_c, prob.batch_stride_c},
                                     prob.buffer_offset_c};
 
         // Descriptor for output matrix D
         Tensile::TensorDescriptor d{Tensile_To,
-                                    {prob.m, prob.n, prob.batch_count},
+                                    {m, n, batch_count},
                                     {prob.row_stride_d, prob.col_stride_d, prob.batch_stride_d},
                                     prob.buffer_offset_d};
 
@@ -483,7 +529,7 @@ namespace
 
         // Pass atomics mode to Tensile interface
         tensileProblem.setDeterministicMode(prob.handle->atomics_mode
-                                            == rocblas_atomics_not_allowed);
+                                            != rocblas_atomics_allowed);
 
         // set batch mode
         tensileProblem.setStridedBatched(prob.strided_batch);
@@ -494,7 +540,9 @@ namespace
         if(prob.flags & rocblas_gemm_flags_use_cu_efficiency)
             tensileProblem.setPerformanceMetric(Tensile::PerformanceMetric::CUEfficiency);
         //Otherwise use handle to determine metric
-        else if(metric != rocblas_default_performance_metric)
+        //The measured metric starts from the default prediction
+        else if(metric != rocblas_default_performance_metric
+                && metric != rocblas_measured_performance_metric)
             tensileProblem.setPerformanceMetric(performanceMetricMap(metric));
 
         if(std::is_same<TiA, float>() && prob.handle->math_mode == rocblas_xf32_xdl_math_op)
@@ -538,6 +586,99 @@ namespace
         return tensileProblem;
     }
 
+    /*****************************************************************************
+     * Per-thread cache of constructed Tensile ContractionProblems, so that small  *
+     * problems repeated with the same shape do not rebuild their descriptors and  *
+     * index vectors on every call. The key holds everything the construction     *
+     * reads except alpha and C==D, which are patched into a cached problem, and  *
+     * the pointers, alpha and beta, which are only in the inputs. There is one   *
+     * cache per instantiation, replaced round robin.                             *
+     *****************************************************************************/
+    template <typename TiA,
+              typename To,
+              typename Tc,
+              typename TiB = TiA,
+              typename TcA = TiA,
+              typename TcB = TiA>
+    Tensile::ContractionProblem&
+        GetCachedTensileProblem(const RocblasContractionProblem<TiA, To, Tc, TiB, TcA, TcB>& prob)
+    {
+        static constexpr size_t MAX_ENTRIES = 8;
+
+        struct entry
+        {
+            std::array<int64_t, 23>     key;
+            Tensile::ContractionProblem problem;
+        };
+        thread_local std::vector<entry> entries;
+        thread_local size_t             next = 0;
+
+        auto    handle = prob.handle;
+        auto    k      = prob.k && *prob.alpha ? prob.k : 0;
+        int64_t ws     = handle->is_device_memory_size_query()
+                             ? -1
+                             : int64_t(handle->get_available_workspace());
+        const std::array<int64_t, 23> key{
+            int64_t(prob.trans_a) | int64_t(prob.trans_b) << 8 | int64_t(prob.flags) << 16
+                | int64_t(handle->math_mode) << 32 | int64_t(handle->atomics_mode) << 40
+                | int64_t(handle->performance_metric) << 44 | int64_t(prob.strided_batch) << 52,
+            int64_t(prob.m),
+            int64_t(prob.n),
+            int64_t(k),
+            int64_t(prob.batch_count),
+            int64_t(prob.row_stride_a),
+            int64_t(prob.col_stride_a),
+            int64_t(prob.batch_stride_a),
+            int64_t(prob.row_stride_b),
+            int64_t(prob.col_stride_b),
+            int64_t(prob.batch_stride_b),
+            int64_t(prob.row_stride_c),
+            int64_t(prob.col_stride_c),
+            int64_t(prob.batch_stride_c),
+            int64_t(prob.row_stride_d),
+            int64_t(prob.col_stride_d),
+            int64_t(prob.batch_stride_d),
+            int64_t(prob.buffer_offset_a),
+            int64_t(prob.buffer_offset_b),
+            int64_t(prob.buffer_offset_c),
+            int64_t(prob.buffer_offset_d),
+            int64_t(value_category(*prob.beta)),
+            ws};
+
+        for(auto& e : entries)
+        {
+            if(e.key != key)
+                continue;
+
+            typename AlphaBeta<TiA, To, Tc>::tensile_type tensileAlpha;
+            if(prob.k)
+                AlphaBeta<TiA, To, Tc>::copy(&tensileAlpha, prob.alpha);
+            else
+                memset(&tensileAlpha, 0, sizeof(tensileAlpha));
+            e.problem.setAlphaRestriction(Tensile::toScalarValueEnum(tensileAlpha));
+            e.problem.setCEqualsD(prob.C == prob.D);
+
+            // Undo an XF32 fallback of the previous call
+            if(std::is_same<TiA, float>() && handle->math_mode == rocblas_xf32_xdl_math_op)
+                e.problem.setF32XdlMathOp(Tensile::DataType::XFloat32);
+            return e.problem;
+        }
+
+        // The entries are reserved up front, so that references to them stay valid
+        if(entries.size() < MAX_ENTRIES)
+        {
+            entries.reserve(MAX_ENTRIES);
+            entries.push_back({key, ConstructTensileProblem(prob)});
+            return entries.back().problem;
+        }
+
+        auto& e   = entries[next];
+        next      = (next + 1) % MAX_ENTRIES;
+        e.key     = key;
+        e.problem = ConstructTensileProblem(prob);
+        return e.problem;
+    }
+
     /***************************************************************
      * Construct the inputs to a Tensile ContractionProblem        *
      ***************************************************************/
@@ -600,7 +741,1306 @@ namespace
             memset(&inputs.alpha, 0, sizeof(inputs.alpha));
         AlphaBeta<TiA, To, Tc>::copy(&inputs.beta, prob.beta);
 
-        return inputs;
+        return inputs;
+    }
+
+    /***************************************************************************
+     * Bounded cache of the solutions selected for recently seen problems, so   *
+     * that repeated problems skip findBestSolution. There is one per device.   *
+     * Lookups only take a shared lock and do not write shared state unless an  *
+     * entry was inserted since the entry was last used, so concurrent hits do  *
+     * not contend. Eviction is approximately least recently used.              *
+     ***************************************************************************/
+    class solution_cache_s
+    {
+        static constexpr size_t MAX_ENTRIES = 1024;
+
+        struct entry
+        {
+            std::shared_ptr<Tensile::ContractionSolution> solution;
+            bool                                          xf32_fallback = false;
+            mutable std::atomic<size_t>                   last_used{0};
+            mutable std::atomic<bool>                     persisted{false};
+        };
+
+        std::unordered_map<rocblas_workspace_signature, entry, rocblas_workspace_signature_hash>
+                                  entries;
+        mutable std::shared_mutex mutex;
+
+        // Incremented by each insertion, and used as the recency of entries
+        std::atomic<size_t> generation{0};
+
+        alignas(64) std::atomic<size_t> hits{0};
+        std::atomic<size_t> misses{0};
+
+    public:
+        // Returns the cached solution of key, whether it was selected after the XF32 fallback
+        // and whether it has been recorded in the solution cache file, or nullptr if key is not
+        // cached
+        std::shared_ptr<Tensile::ContractionSolution>
+            find(const rocblas_workspace_signature& key, bool& xf32_fallback, bool& persisted)
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex);
+            auto                                it = entries.find(key);
+            if(it == entries.end())
+            {
+                misses.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            hits.fetch_add(1, std::memory_order_relaxed);
+
+            auto& e   = it->second;
+            auto  gen = generation.load(std::memory_order_relaxed);
+            if(e.last_used.load(std::memory_order_relaxed) != gen)
+                e.last_used.store(gen, std::memory_order_relaxed);
+            xf32_fallback = e.xf32_fallback;
+            persisted     = e.persisted.load(std::memory_order_relaxed);
+            return e.solution;
+        }
+
+        void insert(const rocblas_workspace_signature&                   key,
+                    const std::shared_ptr<Tensile::ContractionSolution>& solution,
+                    bool                                                 xf32_fallback,
+                    bool                                                 persisted = false)
+        {
+            std::unique_lock<std::shared_mutex> lock(mutex);
+            if(entries.count(key))
+                return;
+            if(entries.size() >= MAX_ENTRIES)
+            {
+                auto lru = std::min_element(
+                    entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) {
+                        return lhs.second.last_used.load(std::memory_order_relaxed)
+                               < rhs.second.last_used.load(std::memory_order_relaxed);
+                    });
+                entries.erase(lru);
+            }
+            auto& e         = entries[key];
+            e.solution      = solution;
+            e.xf32_fallback = xf32_fallback;
+            e.persisted.store(persisted, std::memory_order_relaxed);
+            e.last_used.store(generation.fetch_add(1, std::memory_order_relaxed) + 1,
+                              std::memory_order_relaxed);
+        }
+
+        // Marks key as recorded in the solution cache file. Returns false if it is not cached
+        // or was already marked, so that each entry is recorded once.
+        bool mark_persisted(const rocblas_workspace_signature& key)
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex);
+            auto                                it = entries.find(key);
+            return it != entries.end()
+                   && !it->second.persisted.exchange(true, std::memory_order_relaxed);
+        }
+
+        void get_stats(size_t* hit_count, size_t* miss_count) const
+        {
+            if(hit_count)
+                *hit_count = hits.load(std::memory_order_relaxed);
+            if(miss_count)
+                *miss_count = misses.load(std::memory_order_relaxed);
+        }
+    };
+
+    /*****************************************************************************
+     * History of the kernel times observed for recently seen problems, used by   *
+     * rocblas_measured_performance_metric. The predicted solution and up to      *
+     * MAX_CANDIDATES - 1 alternatives, needing no more workspace, are each run   *
+     * MIN_SAMPLES times by the calls of the problem, and the fastest is used     *
+     * from then on. The launches are timed with a pair of events per problem,    *
+     * which are read without blocking by a later call, so the observed times     *
+     * follow the clocks and power state of the device as they change. Every     *
+     * RETIME_PERIOD calls one of the other candidates is timed again. There is   *
+     * one history per device.                                                    *
+     *****************************************************************************/
+    class solution_history_s
+    {
+        static constexpr size_t MAX_ENTRIES    = 1024;
+        static constexpr size_t MAX_CANDIDATES = 4;
+        static constexpr size_t MIN_SAMPLES    = 2;
+        static constexpr size_t RETIME_PERIOD  = 1024;
+        static constexpr double SMOOTHING      = 0.125;
+
+        struct candidate
+        {
+            std::shared_ptr<Tensile::ContractionSolution> solution;
+            double                                        mean_ms = 0;
+            size_t                                        samples = 0;
+        };
+
+        struct entry
+        {
+            std::vector<candidate> candidates;
+            size_t                 calls     = 0;
+            size_t                 last_used = 0;
+            hipEvent_t             start     = nullptr;
+            hipEvent_t             stop      = nullptr;
+            int                    pending   = -1;
+        };
+
+        std::unordered_map<rocblas_workspace_signature, entry, rocblas_workspace_signature_hash>
+                   entries;
+        std::mutex mutex;
+        size_t     generation = 0;
+
+        // Folds the time of the pending launch of e into its candidate, once it has completed
+        static void read_pending(entry& e)
+        {
+            if(e.pending < 0)
+                return;
+
+            hipError_t status = hipEventQuery(e.stop);
+            if(status == hipErrorNotReady)
+                return;
+
+            float ms;
+            if(status == hipSuccess && hipEventElapsedTime(&ms, e.start, e.stop) == hipSuccess)
+            {
+                auto& c   = e.candidates[e.pending];
+                c.mean_ms = c.samples ? c.mean_ms + SMOOTHING * (ms - c.mean_ms) : ms;
+                c.samples++;
+            }
+            else
+                (void)hipGetLastError(); // clear the error of an event which was not recorded
+            e.pending = -1;
+        }
+
+        static void destroy_events(entry& e)
+        {
+            if(e.start)
+                (void)hipEventDestroy(e.start);
+            if(e.stop)
+                (void)hipEventDestroy(e.stop);
+        }
+
+    public:
+        // Returns the solution to run for key. find_alternatives() returns the alternatives to
+        // predicted the first time key is seen. If the launch is to be timed, *start and *stop
+        // are set to the events to record around it; start and stop are nullptr if the launch
+        // cannot be timed.
+        template <typename F>
+        std::shared_ptr<Tensile::ContractionSolution>
+            choose(const rocblas_workspace_signature&                   key,
+                   const std::shared_ptr<Tensile::ContractionSolution>& predicted,
+                   F                                                    find_alternatives,
+                   hipEvent_t*                                          start,
+                   hipEvent_t*                                          stop)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            auto it = entries.find(key);
+            if(it == entries.end())
+            {
+                if(entries.size() >= MAX_ENTRIES)
+                {
+                    auto lru = std::min_element(
+                        entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) {
+                            return lhs.second.last_used < rhs.second.last_used;
+                        });
+                    destroy_events(lru->second);
+                    entries.erase(lru);
+                }
+
+                it = entries.emplace(key, entry{}).first;
+                it->second.candidates.push_back({predicted});
+                for(auto& solution : find_alternatives())
+                {
+                    if(it->second.candidates.size() >= MAX_CANDIDATES)
+                        break;
+                    if(solution != predicted)
+                        it->second.candidates.push_back({solution});
+                }
+            }
+
+            auto& e     = it->second;
+            e.last_used = ++generation;
+            if(e.candidates.size() < 2)
+                return predicted;
+
+            read_pending(e);
+
+            // Candidates short of samples are timed first, then the fastest is used
+            size_t best = 0, timed = e.candidates.size();
+            for(size_t i = 0; i < e.candidates.size(); i++)
+            {
+                auto& c = e.candidates[i];
+                if(c.samples < MIN_SAMPLES && timed == e.candidates.size())
+                    timed = i;
+                auto& b = e.candidates[best];
+                if(c.samples && (!b.samples || c.mean_ms < b.mean_ms))
+                    best = i;
+            }
+            if(timed == e.candidates.size())
+            {
+                timed = best;
+                if(++e.calls % RETIME_PERIOD == 0)
+                    timed = (best + 1 + e.calls / RETIME_PERIOD % (e.candidates.size() - 1))
+                            % e.candidates.size();
+            }
+
+            // The fastest candidate is run untimed while the previous launch is still pending
+            if(e.pending >= 0 || !start || !stop)
+                return e.candidates[best].samples ? e.candidates[best].solution : predicted;
+
+            if((!e.start && hipEventCreate(&e.start) != hipSuccess)
+               || (!e.stop && hipEventCreate(&e.stop) != hipSuccess))
+                return e.candidates[best].samples ? e.candidates[best].solution : predicted;
+
+            *start    = e.start;
+            *stop     = e.stop;
+            e.pending = int(timed);
+            return e.candidates[timed].solution;
+        }
+    };
+
+    /*****************************************************************************
+     * Optional solution cache file, which persists solution selections across    *
+     * processes. Each line records the arch, solution index, XF32 fallback, the  *
+     * code object files the kernels came from and the problem signature. When a  *
+     * device is initialized, the code objects of its arch are loaded and its     *
+     * solution cache is seeded; new selections are appended as they are used.    *
+     *****************************************************************************/
+    class solution_cache_file_s
+    {
+        std::mutex                           mutex;
+        std::string                          path;
+        std::unordered_map<int, std::string> device_arch;
+
+        static constexpr std::string_view signature_name = "tensile_solution";
+
+    public:
+        solution_cache_file_s()
+        {
+            const char* env = getenv("ROCBLAS_TENSILE_SOLUTION_CACHE_FILE");
+            if(env)
+                path = env;
+        }
+
+        void set_path(const char* new_path)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            path = new_path ? new_path : "";
+        }
+
+        bool enabled()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return !path.empty();
+        }
+
+        // Preload the code objects and seed the solution cache of a device from the file
+        void seed(int                                                          deviceId,
+                  const std::string&                                           arch,
+                  const std::string&                                           code_object_dir,
+                  Tensile::hip::SolutionAdapter&                               adapter,
+                  Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>& library,
+                  solution_cache_s&                                            cache)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            device_arch[deviceId] = arch;
+            if(path.empty())
+                return;
+
+            std::ifstream                   in(path);
+            std::string                     line;
+            std::unordered_set<std::string> loaded;
+            while(std::getline(in, line))
+            {
+                std::istringstream is(line);
+                std::string        line_arch, code_objects;
+                int                solution_index;
+                bool               xf32_fallback;
+                size_t             num_args;
+                if(!(is >> line_arch >> solution_index >> xf32_fallback >> code_objects >> num_args)
+                   || line_arch != arch || num_args > rocblas_workspace_signature::MAX_ARGS)
+                    continue;
+
+                rocblas_workspace_signature key(signature_name);
+                key.num_args = num_args;
+                for(size_t i = 0; i < num_args && is; i++)
+                    is >> key.args[i];
+                if(!is)
+                    continue;
+
+                if(code_objects != "-")
+                {
+                    std::istringstream cos(code_objects);
+                    std::string        file;
+                    while(std::getline(cos, file, ','))
+                        if(loaded.insert(file).second)
+                            adapter.loadCodeObjectFile(code_object_dir + "/" + file);
+                }
+
+                auto solution = library.getSolutionByIndex(solution_index);
+                if(solution)
+                    cache.insert(key, solution, xf32_fallback, true);
+            }
+        }
+
+        // Append a selection to the file, with the workspace size and name of the solution
+        // after the signature
+        void record(int                                           deviceId,
+                    const rocblas_workspace_signature&            key,
+                    const Tensile::ContractionSolution&           solution,
+                    bool                                          xf32_fallback,
+                    const std::vector<Tensile::KernelInvocation>& kernels,
+                    size_t                                        workspace_size)
+        {
+            std::string code_objects;
+            for(auto& kernel : kernels)
+            {
+                if(kernel.codeObjectFile.empty()
+                   || ("," + code_objects + ",").find("," + kernel.codeObjectFile + ",")
+                          != std::string::npos)
+                    continue;
+                if(!code_objects.empty())
+                    code_objects += ",";
+                code_objects += kernel.codeObjectFile;
+            }
+            if(code_objects.empty())
+                code_objects = "-";
+
+            std::lock_guard<std::mutex> lock(mutex);
+            auto                        arch = device_arch.find(deviceId);
+            if(path.empty() || arch == device_arch.end())
+                return;
+
+            std::ostringstream os;
+            os << arch->second << ' ' << solution.index << ' ' << xf32_fallback << ' '
+               << code_objects << ' ' << key.num_args;
+            for(size_t i = 0; i < key.num_args; i++)
+                os << ' ' << key.args[i];
+            os << ' ' << workspace_size << ' ' << solution.name() << '\n';
+
+            // A single write of the whole line keeps lines intact when several processes
+            // append to the same file
+            std::string text = os.str();
+            if(FILE* file = fopen(path.c_str(), "a"))
+            {
+                fwrite(text.data(), 1, text.size(), file);
+                fclose(file);
+            }
+        }
+    };
+
+    solution_cache_file_s& get_solution_cache_file()
+    {
+        static solution_cache_file_s file;
+        return file;
+    }
+
+    /*****************************************************************************
+     * Optional solution index, a flat binary form of the solution cache file     *
+     * built by rocblas_build_solution_index. It is memory-mapped read-only and   *
+     * searched in place, so it costs no parsing at startup and its pages are     *
+     * shared by all processes of a node through the page cache. It is looked up  *
+     * on solution cache misses only, and the code objects of a record are loaded *
+     * when one of its problems is first seen on a device, so each process only   *
+     * touches the records and code objects of the problem types it runs.         *
+     *                                                                            *
+     * The file is a header, the records sorted by hash and a table of the        *
+     * nul-terminated strings of the records: their solution names and their      *
+     * comma-separated lists of code object files.                                *
+     *****************************************************************************/
+    struct solution_index_header
+    {
+        char     magic[8];
+        uint64_t num_records;
+        uint64_t strings_offset;
+    };
+
+    struct solution_index_record
+    {
+        uint64_t hash; // of the arch and the problem signature
+        uint64_t arch_hash;
+        int64_t  args[rocblas_workspace_signature::MAX_ARGS];
+        uint32_t num_args;
+        int32_t  solution_index;
+        uint32_t xf32_fallback;
+        uint32_t code_objects; // offset in the string table
+        uint32_t solution_name; // offset in the string table
+        uint64_t workspace_size; // required by the solution, or NO_WORKSPACE_SIZE if not recorded
+    };
+
+    constexpr char     SOLUTION_INDEX_MAGIC[8] = {'R', 'B', 'S', 'I', 'D', 'X', '0', '2'};
+    constexpr uint64_t NO_WORKSPACE_SIZE       = ~uint64_t(0);
+
+    class solution_index_s
+    {
+        const char*                  data         = nullptr;
+        size_t                       size         = 0;
+        const solution_index_record* records      = nullptr;
+        size_t                       num_records  = 0;
+        const char*                  strings      = nullptr;
+        size_t                       strings_size = 0;
+
+#ifdef WIN32
+        std::vector<char> contents;
+#endif
+
+        std::mutex                                               mutex;
+        std::unordered_map<int, uint64_t>                        device_arch;
+        std::unordered_map<int, std::unordered_set<std::string>> loaded;
+
+        // FNV-1a, which unlike std::hash is the same in every process
+        static uint64_t fnv1a(const void* bytes, size_t n, uint64_t hash = 0xcbf29ce484222325)
+        {
+            for(size_t i = 0; i < n; i++)
+            {
+                hash ^= static_cast<const unsigned char*>(bytes)[i];
+                hash *= 0x100000001b3;
+            }
+            return hash;
+        }
+
+        bool validate() const
+        {
+            if(size < sizeof(solution_index_header) || data[size - 1] != '\0')
+                return false;
+            auto header = reinterpret_cast<const solution_index_header*>(data);
+            return !memcmp(header->magic, SOLUTION_INDEX_MAGIC, sizeof(SOLUTION_INDEX_MAGIC))
+                   && header->num_records
+                          <= (size - sizeof(solution_index_header))
+                                 / sizeof(solution_index_record)
+                   && header->strings_offset
+                          == sizeof(solution_index_header)
+                                 + header->num_records * sizeof(solution_index_record);
+        }
+
+    public:
+        static uint64_t arch_hash(const std::string& arch)
+        {
+            return fnv1a(arch.data(), arch.size());
+        }
+
+        static uint64_t record_hash(uint64_t arch, const rocblas_workspace_signature& key)
+        {
+            uint64_t num_args = key.num_args;
+            uint64_t hash     = fnv1a(&arch, sizeof(arch));
+            hash              = fnv1a(&num_args, sizeof(num_args), hash);
+            return fnv1a(key.args.data(), key.num_args * sizeof(int64_t), hash);
+        }
+
+        solution_index_s()
+        {
+            const char* path = getenv("ROCBLAS_TENSILE_SOLUTION_INDEX");
+            if(!path || !*path)
+                return;
+
+#ifdef WIN32
+            std::ifstream in(path, std::ios::binary);
+            contents.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+            data = contents.data();
+            size = contents.size();
+#else
+            int fd = open(path, O_RDONLY | O_CLOEXEC);
+            if(fd < 0)
+                return;
+            struct stat st;
+            if(!fstat(fd, &st) && st.st_size > 0)
+            {
+                void* map = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+                if(map != MAP_FAILED)
+                {
+                    data = static_cast<const char*>(map);
+                    size = st.st_size;
+                }
+            }
+            close(fd);
+#endif
+
+            if(!data)
+                return;
+            if(!validate())
+            {
+                rocblas_cerr << "\nrocBLAS warning: ignoring invalid solution index " << path
+                             << std::endl;
+                return;
+            }
+
+            auto header  = reinterpret_cast<const solution_index_header*>(data);
+            records      = reinterpret_cast<const solution_index_record*>(header + 1);
+            num_records  = header->num_records;
+            strings      = data + header->strings_offset;
+            strings_size = size - header->strings_offset;
+        }
+
+        ~solution_index_s()
+        {
+#ifndef WIN32
+            if(data)
+                munmap(const_cast<char*>(data), size);
+#endif
+        }
+
+        solution_index_s(const solution_index_s&) = delete;
+        solution_index_s& operator=(const solution_index_s&) = delete;
+
+        void add_device(int deviceId, const std::string& arch)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            device_arch[deviceId] = arch_hash(arch);
+        }
+
+        // Returns the record of key on the arch of a device, or nullptr if there is none
+        const solution_index_record* find(int deviceId, const rocblas_workspace_signature& key)
+        {
+            if(!num_records)
+                return nullptr;
+
+            uint64_t arch;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                auto                        it = device_arch.find(deviceId);
+                if(it == device_arch.end())
+                    return nullptr;
+                arch = it->second;
+            }
+
+            uint64_t hash = record_hash(arch, key);
+            auto     it   = std::lower_bound(
+                records, records + num_records, hash, [](const auto& record, uint64_t hash) {
+                    return record.hash < hash;
+                });
+            for(; it != records + num_records && it->hash == hash; ++it)
+                if(it->arch_hash == arch && it->num_args == key.num_args
+                   && std::equal(key.args.begin(), key.args.begin() + key.num_args, it->args)
+                   && it->code_objects < strings_size && it->solution_name < strings_size)
+                    return it;
+            return nullptr;
+        }
+
+        // Load the code objects of a record which are not loaded on a device yet
+        void load_code_objects(int                            deviceId,
+                               const solution_index_record&   record,
+                               const std::string&             code_object_dir,
+                               Tensile::hip::SolutionAdapter& adapter)
+        {
+            std::istringstream          cos(strings + record.code_objects);
+            std::string                 file;
+            std::lock_guard<std::mutex> lock(mutex);
+            auto&                       device_loaded = loaded[deviceId];
+            while(std::getline(cos, file, ','))
+                if(file != "-" && device_loaded.insert(file).second)
+                    adapter.loadCodeObjectFile(code_object_dir + "/" + file);
+        }
+
+        // Write the index of the selections of a solution cache file, the last selection of a
+        // problem taking precedence
+        static rocblas_status build(const char* cache_path, const char* index_path)
+        {
+            std::ifstream in(cache_path);
+            if(!in)
+                return rocblas_status_invalid_value;
+
+            // Selections by arch and problem signature
+            std::unordered_map<
+                std::string,
+                std::pair<solution_index_record, std::pair<std::string, std::string>>>
+                        selections;
+            std::string line;
+            while(std::getline(in, line))
+            {
+                std::istringstream is(line);
+                std::string        arch, code_objects;
+                int                solution_index;
+                bool               xf32_fallback;
+                size_t             num_args;
+                if(!(is >> arch >> solution_index >> xf32_fallback >> code_objects >> num_args)
+                   || num_args > rocblas_workspace_signature::MAX_ARGS)
+                    continue;
+
+                rocblas_workspace_signature key("tensile_solution");
+                key.num_args = num_args;
+                for(size_t i = 0; i < num_args && is; i++)
+                    is >> key.args[i];
+                if(!is)
+                    continue;
+
+                // not in the lines of older files
+                uint64_t    workspace_size = NO_WORKSPACE_SIZE;
+                std::string name           = "-";
+                if(!(is >> workspace_size >> name))
+                    workspace_size = NO_WORKSPACE_SIZE;
+
+                solution_index_record record{};
+                record.arch_hash      = arch_hash(arch);
+                record.hash           = record_hash(record.arch_hash, key);
+                record.num_args       = num_args;
+                record.solution_index = solution_index;
+                record.xf32_fallback  = xf32_fallback;
+                record.workspace_size = workspace_size;
+                std::copy(key.args.begin(), key.args.begin() + num_args, record.args);
+
+                std::ostringstream problem;
+                problem << arch;
+                for(size_t i = 0; i < num_args; i++)
+                    problem << ' ' << key.args[i];
+                selections[problem.str()] = {record, {code_objects, name}};
+            }
+
+            std::vector<std::pair<solution_index_record, std::pair<std::string, std::string>>>
+                sorted;
+            for(auto& selection : selections)
+                sorted.push_back(selection.second);
+            std::sort(sorted.begin(), sorted.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.first.hash < rhs.first.hash;
+            });
+
+            std::string                               table;
+            std::unordered_map<std::string, uint32_t> offsets;
+            auto                                      offset = [&](const std::string& text) {
+                auto it = offsets.find(text);
+                if(it == offsets.end())
+                {
+                    it = offsets.emplace(text, uint32_t(table.size())).first;
+                    table += text;
+                    table += '\0';
+                }
+                return it->second;
+            };
+            for(auto& [record, strings] : sorted)
+            {
+                record.code_objects  = offset(strings.first);
+                record.solution_name = offset(strings.second);
+            }
+            if(table.empty())
+                table += '\0';
+
+            solution_index_header header{};
+            memcpy(header.magic, SOLUTION_INDEX_MAGIC, sizeof(header.magic));
+            header.num_records    = sorted.size();
+            header.strings_offset = sizeof(header) + sorted.size() * sizeof(solution_index_record);
+
+            // Written to a temporary file and renamed, so processes mapping the index never
+            // see it partially written
+            std::string tmp_path = std::string(index_path) + ".tmp";
+            {
+                std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+                out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                for(auto& selection : sorted)
+                    out.write(reinterpret_cast<const char*>(&selection.first),
+                              sizeof(solution_index_record));
+                out.write(table.data(), table.size());
+                if(!out)
+                {
+                    out.close();
+                    remove(tmp_path.c_str());
+                    return rocblas_status_internal_error;
+                }
+            }
+            if(rename(tmp_path.c_str(), index_path))
+            {
+                remove(tmp_path.c_str());
+                return rocblas_status_internal_error;
+            }
+            return rocblas_status_success;
+        }
+    };
+
+    solution_index_s& get_solution_index()
+    {
+        static solution_index_s index;
+        return index;
+    }
+
+    /*****************************************************************************
+     * Tuning table of rocblas_gemm_backend_auto, read from the text file named  *
+     * by ROCBLAS_GEMM_BACKEND_TABLE. Each line gives the backend of a shape:    *
+     *   arch a_type b_type d_type transA transB M N K batch_count backend       *
+     * where backend is tensile or hipblaslt. Lines starting with # are ignored. *
+     *****************************************************************************/
+    class gemm_backend_table_s
+    {
+        static constexpr int KEY_FIELDS = 10;
+
+        std::unordered_map<std::string, bool> shapes;
+
+    public:
+        gemm_backend_table_s()
+        {
+            const char* path = getenv("ROCBLAS_GEMM_BACKEND_TABLE");
+            if(!path || !*path)
+                return;
+
+            std::ifstream in(path);
+            std::string   line;
+            while(std::getline(in, line))
+            {
+                std::istringstream fields(line);
+                std::string        field, key;
+                int                num_fields = 0;
+                while(num_fields < KEY_FIELDS && fields >> field)
+                    key += (num_fields++ ? " " : "") + field;
+                if(!num_fields || key[0] == '#')
+                    continue;
+
+                std::string backend;
+                if(num_fields == KEY_FIELDS && fields >> backend
+                   && (backend == "tensile" || backend == "hipblaslt"))
+                    shapes[key] = backend == "hipblaslt";
+                else
+                    rocblas_cerr << "\nrocBLAS warning: ignoring invalid line of " << path
+                                 << ": " << line << std::endl;
+            }
+        }
+
+        // Returns 1 if the table runs a problem on the arch of the current device with
+        // hipBLASLt, 0 if it runs it with Tensile, and -1 if the problem is not in the table
+        template <typename TiA, typename To, typename Tc, typename TiB, typename TcA, typename TcB>
+        int find(const RocblasContractionProblem<TiA, To, Tc, TiB, TcA, TcB>& prob) const
+        {
+            if(shapes.empty())
+                return -1;
+
+            std::ostringstream key;
+            key << rocblas_internal_get_arch_name() << ' ' << rocblas_precision_string<TiA> << ' '
+                << rocblas_precision_string<TiB> << ' ' << rocblas_precision_string<To> << ' '
+                << rocblas_transpose_letter(prob.trans_a) << ' '
+                << rocblas_transpose_letter(prob.trans_b) << ' ' << prob.m << ' ' << prob.n
+                << ' ' << prob.k << ' ' << prob.batch_count;
+            auto it = shapes.find(key.str());
+            return it == shapes.end() ? -1 : it->second;
+        }
+    };
+
+    const gemm_backend_table_s& get_gemm_backend_table()
+    {
+        static const gemm_backend_table_s table;
+        return table;
+    }
+
+    /*****************************************************************************
+     * Backends chosen for the problems of a device, with the hipBLASLt          *
+     * algorithm of those it runs. The choices of rocblas_gemm_backend_hipblaslt *
+     * and rocblas_gemm_backend_auto are kept apart. Once it is full, the cache  *
+     * is cleared, and the problems it held are decided again.                   *
+     *****************************************************************************/
+    class gemm_backend_cache_s
+    {
+        static constexpr size_t MAX_ENTRIES = 1024;
+
+    public:
+        struct choice
+        {
+            bool                   hipblaslt = false;
+            rocblas_hipblaslt_algo algo{};
+        };
+
+    private:
+        std::unordered_map<rocblas_workspace_signature, choice, rocblas_workspace_signature_hash>
+                                  entries[2];
+        mutable std::shared_mutex mutex;
+
+    public:
+        bool find(rocblas_gemm_backend               backend,
+                  const rocblas_workspace_signature& key,
+                  choice&                            found) const
+        {
+            auto& map = entries[backend == rocblas_gemm_backend_auto];
+            std::shared_lock<std::shared_mutex> lock(mutex);
+            auto                                it = map.find(key);
+            if(it == map.end())
+                return false;
+            found = it->second;
+            return true;
+        }
+
+        void insert(rocblas_gemm_backend               backend,
+                    const rocblas_workspace_signature& key,
+                    const choice&                      chosen)
+        {
+            auto& map = entries[backend == rocblas_gemm_backend_auto];
+            std::unique_lock<std::shared_mutex> lock(mutex);
+            if(map.size() >= MAX_ENTRIES)
+                map.clear();
+            map[key] = chosen;
+        }
+    };
+
+    /*****************************************************************************
+     * Code object preload request of rocblas_initialize_ex. It is set for the    *
+     * calling thread only, so that devices initialized on first use elsewhere   *
+     * keep loading lazily.                                                      *
+     *****************************************************************************/
+    struct code_object_preload_s
+    {
+        // Tensile type tags of the A matrix of the code objects to load, or empty for all
+        std::vector<std::string> type_tags;
+        size_t                   bytes_loaded = 0;
+
+        // Code objects which are not specific to a problem type are always loaded
+        bool wanted(const std::string& file) const
+        {
+            auto type = file.find("_Type_");
+            if(type_tags.empty() || type == std::string::npos)
+                return true;
+            type += 6;
+            return std::any_of(type_tags.begin(), type_tags.end(), [&](const std::string& tag) {
+                return file.compare(type, tag.size(), tag) == 0;
+            });
+        }
+    };
+
+    code_object_preload_s*& current_code_object_preload()
+    {
+        thread_local code_object_preload_s* preload = nullptr;
+        return preload;
+    }
+
+    /*****************************************************************************
+     * Host time spent initializing Tensile, by phase and summed over the devices *
+     * initialized so far, returned by rocblas_get_startup_times                  *
+     *****************************************************************************/
+    struct startup_times_s
+    {
+        std::atomic<uint64_t> device_initializations{0};
+        std::atomic<uint64_t> total_ns{0};
+        std::atomic<uint64_t> path_discovery_ns{0};
+        std::atomic<uint64_t> code_object_cache_ns{0};
+        std::atomic<uint64_t> hardware_query_ns{0};
+        std::atomic<uint64_t> library_load_ns{0};
+        std::atomic<uint64_t> library_wait_ns{0};
+        std::atomic<uint64_t> code_object_load_ns{0};
+        std::atomic<uint64_t> code_objects_loaded{0};
+        std::atomic<uint64_t> solution_cache_seed_ns{0};
+
+        rocblas_startup_times snapshot() const
+        {
+            return {device_initializations.load(std::memory_order_relaxed),
+                    total_ns.load(std::memory_order_relaxed),
+                    path_discovery_ns.load(std::memory_order_relaxed),
+                    code_object_cache_ns.load(std::memory_order_relaxed),
+                    hardware_query_ns.load(std::memory_order_relaxed),
+                    library_load_ns.load(std::memory_order_relaxed),
+                    library_wait_ns.load(std::memory_order_relaxed),
+                    code_object_load_ns.load(std::memory_order_relaxed),
+                    code_objects_loaded.load(std::memory_order_relaxed),
+                    solution_cache_seed_ns.load(std::memory_order_relaxed)};
+        }
+    };
+
+    startup_times_s& get_startup_times()
+    {
+        static startup_times_s times;
+        return times;
+    }
+
+    // Adds the time from its construction to end() or its destruction to a startup phase
+    class startup_phase_timer
+    {
+        std::atomic<uint64_t>*                phase;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    public:
+        explicit startup_phase_timer(std::atomic<uint64_t>& phase)
+            : phase(&phase)
+        {
+        }
+
+        void end()
+        {
+            if(phase)
+                rocblas_count(*phase,
+                              std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                  std::chrono::steady_clock::now() - start)
+                                  .count());
+            phase = nullptr;
+        }
+
+        ~startup_phase_timer()
+        {
+            end();
+        }
+
+        startup_phase_timer(const startup_phase_timer&)            = delete;
+        startup_phase_timer& operator=(const startup_phase_timer&) = delete;
+    };
+
+    // Writes the startup times of the initialization of a device, the difference of the
+    // startup times after and before it, to the trace log if ROCBLAS_LAYER enables it. As the
+    // times are summed over devices, devices initialized concurrently share their phases.
+    void log_startup_times(int                          deviceId,
+                           const std::string&           arch,
+                           const rocblas_startup_times& before,
+                           const rocblas_startup_times& after)
+    {
+        const char* layer = getenv("ROCBLAS_LAYER");
+        if(!layer || !(strtol(layer, nullptr, 0) & rocblas_layer_mode_log_trace))
+            return;
+        const char* path = getenv("ROCBLAS_LOG_TRACE_PATH");
+        if(!path)
+            path = getenv("ROCBLAS_LOG_PATH");
+        auto os = path ? std::make_unique<rocblas_internal_ostream>(path)
+                       : std::make_unique<rocblas_internal_ostream>(STDERR_FILENO);
+
+        auto us = [&](uint64_t rocblas_startup_times::*ns) {
+            return (after.*ns - before.*ns) / 1000;
+        };
+        os->log_line(",",
+                     "rocblas_tensile_startup",
+                     "device",
+                     deviceId,
+                     "arch",
+                     arch,
+                     "total_us",
+                     us(&rocblas_startup_times::total_ns),
+                     "path_discovery_us",
+                     us(&rocblas_startup_times::path_discovery_ns),
+                     "code_object_cache_us",
+                     us(&rocblas_startup_times::code_object_cache_ns),
+                     "hardware_query_us",
+                     us(&rocblas_startup_times::hardware_query_ns),
+                     "library_load_us",
+                     us(&rocblas_startup_times::library_load_ns),
+                     "library_wait_us",
+                     us(&rocblas_startup_times::library_wait_ns),
+                     "code_object_load_us",
+                     us(&rocblas_startup_times::code_object_load_ns),
+                     "code_objects_loaded",
+                     after.code_objects_loaded - before.code_objects_loaded,
+                     "solution_cache_seed_us",
+                     us(&rocblas_startup_times::solution_cache_seed_ns));
+    }
+
+    /*****************************************************************************
+     * Background worker for rocblas_gemm_ex_prefetch. Prefetches run in order on *
+     * a single thread, each on its own copy of the handle it was requested with. *
+     *****************************************************************************/
+    class gemm_prefetch_worker_s
+    {
+        std::mutex                        mutex;
+        std::condition_variable           work_cv, idle_cv;
+        std::deque<std::function<void()>> queue;
+        bool                              busy = false;
+        bool                              stop = false;
+
+        // Code objects loaded by prefetches, per device, so that each is loaded once
+        std::unordered_map<int, std::unordered_set<std::string>> code_objects;
+
+        std::thread thread;
+
+        void run()
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            while(true)
+            {
+                work_cv.wait(lock, [this] { return stop || !queue.empty(); });
+                if(queue.empty())
+                    return;
+                auto work = std::move(queue.front());
+                queue.pop_front();
+                busy = true;
+                lock.unlock();
+                work();
+                lock.lock();
+                busy = false;
+                if(queue.empty())
+                    idle_cv.notify_all();
+            }
+        }
+
+    public:
+        gemm_prefetch_worker_s()
+            : thread([this] { run(); })
+        {
+        }
+
+        ~gemm_prefetch_worker_s()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stop = true;
+                queue.clear();
+            }
+            work_cv.notify_all();
+            thread.join();
+        }
+
+        void enqueue(std::function<void()> work)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                queue.push_back(std::move(work));
+            }
+            work_cv.notify_one();
+        }
+
+        void synchronize()
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            idle_cv.wait(lock, [this] { return queue.empty() && !busy; });
+        }
+
+        // Returns true if file has not been loaded by a prefetch on device yet
+        bool claim_code_object(int deviceId, const std::string& file)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return code_objects[deviceId].insert(file).second;
+        }
+    };
+
+    /*****************************************************************************
+     * Optional bound of the device memory of Tensile code objects, in MiB per    *
+     * device, set by ROCBLAS_TENSILE_CODE_OBJECT_BUDGET_MB. While it is set,     *
+     * kernels are launched from modules which rocBLAS loads itself with          *
+     * hipModuleLoadData the first time one of their kernels is launched, rather  *
+     * than from the modules of the Tensile adapter, and the least recently used  *
+     * modules of a device are unloaded when loading another one would exceed the *
+     * budget. A module is only unloaded once its last launch has completed and   *
+     * no launch is being issued from it; modules launched during stream capture  *
+     * are never unloaded, since the graphs keep referencing their kernels.       *
+     *****************************************************************************/
+    class code_object_residency_s
+    {
+        struct module_s
+        {
+            hipModule_t                                    module    = nullptr;
+            size_t                                         bytes     = 0;
+            size_t                                         last_used = 0;
+            int                                            users     = 0;
+            bool                                           pinned    = false;
+            std::unordered_map<std::string, hipFunction_t> functions;
+
+            // Event recorded after the last launch from the module on each stream
+            std::unordered_map<hipStream_t, hipEvent_t> launches;
+
+            bool idle() const
+            {
+                return !users && !pinned
+                       && std::all_of(launches.begin(), launches.end(), [](const auto& launch) {
+                              return hipEventQuery(launch.second) == hipSuccess;
+                          });
+            }
+        };
+
+        struct device_s
+        {
+            std::unordered_map<std::string, module_s> modules;
+            size_t                                    resident_bytes = 0;
+            size_t                                    clock          = 0;
+        };
+
+        size_t                            budget = 0;
+        std::mutex                        mutex;
+        std::unordered_map<int, device_s> devices;
+
+        // Unload least recently used modules until needed more bytes fit in the budget, or
+        // no more module can be unloaded
+        void evict(device_s& device, size_t needed)
+        {
+            while(device.resident_bytes + needed > budget)
+            {
+                auto lru = device.modules.end();
+                for(auto it = device.modules.begin(); it != device.modules.end(); ++it)
+                {
+                    if((lru == device.modules.end() || it->second.last_used < lru->second.last_used)
+                       && it->second.idle())
+                        lru = it;
+                }
+                if(lru == device.modules.end())
+                    return;
+
+                PRINT_IF_HIP_ERROR(hipModuleUnload(lru->second.module));
+                for(auto& launch : lru->second.launches)
+                    PRINT_IF_HIP_ERROR(hipEventDestroy(launch.second));
+                device.resident_bytes -= lru->second.bytes;
+                device.modules.erase(lru);
+            }
+        }
+
+        // The module of a code object file, loaded if it is not resident
+        hipError_t get_module(device_s&          device,
+                              const std::string& code_object_dir,
+                              const std::string& file,
+                              module_s*&         m)
+        {
+            auto it = device.modules.find(file);
+            if(it == device.modules.end())
+            {
+                // The file is mapped rather than read, so that its pages are shared with the
+                // other processes loading it
+                std::string path = code_object_dir + "/" + file;
+#ifdef WIN32
+                std::ifstream     in(path, std::ios::binary);
+                std::vector<char> contents((std::istreambuf_iterator<char>(in)),
+                                           std::istreambuf_iterator<char>());
+                const void*       image = contents.data();
+                size_t            size  = contents.size();
+#else
+                const void* image = nullptr;
+                size_t      size  = 0;
+                int         fd    = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+                struct stat st;
+                if(fd >= 0 && !fstat(fd, &st) && st.st_size > 0)
+                {
+                    image = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                    size  = image == MAP_FAILED ? 0 : st.st_size;
+                }
+                if(fd >= 0)
+                    close(fd);
+#endif
+                if(!size)
+                    return hipErrorFileNotFound;
+
+                evict(device, size);
+                hipModule_t module;
+                hipError_t  status = hipModuleLoadData(&module, image);
+#ifndef WIN32
+                munmap(const_cast<void*>(image), size);
+#endif
+                if(status != hipSuccess)
+                    return status;
+
+                it                = device.modules.emplace(file, module_s{}).first;
+                it->second.module = module;
+                it->second.bytes  = size;
+                device.resident_bytes += size;
+            }
+            m = &it->second;
+            return hipSuccess;
+        }
+
+        // Resolve the kernel functions, marking their modules as in use
+        hipError_t acquire(int                                           deviceId,
+                           const std::string&                            code_object_dir,
+                           const std::vector<Tensile::KernelInvocation>& kernels,
+                           bool                                          pin,
+                           std::vector<std::pair<module_s*, hipFunction_t>>& resolved)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto&                       device = devices[deviceId];
+            for(auto& kernel : kernels)
+            {
+                module_s*     m        = nullptr;
+                hipFunction_t function = nullptr;
+                hipError_t status = get_module(device, code_object_dir, kernel.codeObjectFile, m);
+                if(status == hipSuccess)
+                {
+                    auto it = m->functions.find(kernel.kernelName);
+                    if(it != m->functions.end())
+                        function = it->second;
+                    else if((status = hipModuleGetFunction(
+                                 &function, m->module, kernel.kernelName.c_str()))
+                            == hipSuccess)
+                        m->functions.emplace(kernel.kernelName, function);
+                }
+                if(status != hipSuccess)
+                {
+                    for(auto& r : resolved)
+                        r.first->users--;
+                    resolved.clear();
+                    return status;
+                }
+                m->users++;
+                m->last_used = ++device.clock;
+                m->pinned |= pin;
+                resolved.emplace_back(m, function);
+            }
+            return hipSuccess;
+        }
+
+    public:
+        code_object_residency_s()
+        {
+            const char* env = getenv("ROCBLAS_TENSILE_CODE_OBJECT_BUDGET_MB");
+            if(env && atoll(env) > 0)
+                budget = size_t(atoll(env)) << 20;
+        }
+
+        bool enabled() const
+        {
+            return budget != 0;
+        }
+
+        // Whether the kernels all come from code object files, which rocBLAS can load itself;
+        // other kernels are launched by the Tensile adapter
+        static bool covers(const std::vector<Tensile::KernelInvocation>& kernels)
+        {
+            return std::none_of(kernels.begin(), kernels.end(), [](const auto& kernel) {
+                return kernel.codeObjectFile.empty();
+            });
+        }
+
+        // Load the modules of the kernels without launching them
+        hipError_t load(int                                           deviceId,
+                        const std::string&                            code_object_dir,
+                        const std::vector<Tensile::KernelInvocation>& kernels)
+        {
+            std::vector<std::pair<module_s*, hipFunction_t>> resolved;
+            hipError_t status = acquire(deviceId, code_object_dir, kernels, false, resolved);
+
+            std::lock_guard<std::mutex> lock(mutex);
+            for(auto& r : resolved)
+                r.first->users--;
+            return status;
+        }
+
+        // Launch the kernels on stream, recording start before the first and stop after the
+        // last if they are not nullptr, as the adapter does
+        hipError_t launch(int                                           deviceId,
+                          const std::string&                            code_object_dir,
+                          const std::vector<Tensile::KernelInvocation>& kernels,
+                          hipStream_t                                   stream,
+                          hipEvent_t                                    start,
+                          hipEvent_t                                    stop,
+                          bool                                          capturing)
+        {
+            std::vector<std::pair<module_s*, hipFunction_t>> resolved;
+            hipError_t status = acquire(deviceId, code_object_dir, kernels, capturing, resolved);
+            if(status != hipSuccess)
+                return status;
+
+            if(start)
+                status = hipEventRecord(start, stream);
+            for(size_t i = 0; status == hipSuccess && i < kernels.size(); i++)
+            {
+                auto&  kernel    = kernels[i];
+                size_t args_size = kernel.args.size();
+                void*  config[]  = {HIP_LAUNCH_PARAM_BUFFER_POINTER,
+                                  const_cast<void*>(kernel.args.data()),
+                                  HIP_LAUNCH_PARAM_BUFFER_SIZE,
+                                  &args_size,
+                                  HIP_LAUNCH_PARAM_END};
+                status = hipExtModuleLaunchKernel(resolved[i].second,
+                                                  kernel.numWorkItems.x,
+                                                  kernel.numWorkItems.y,
+                                                  kernel.numWorkItems.z,
+                                                  kernel.workGroupSize.x,
+                                                  kernel.workGroupSize.y,
+                                                  kernel.workGroupSize.z,
+                                                  kernel.sharedMemBytes,
+                                                  stream,
+                                                  nullptr,
+                                                  config);
+            }
+            if(status == hipSuccess && stop)
+                status = hipEventRecord(stop, stream);
+
+            // The last launch from each module on the stream tells when it can be unloaded, even
+            // if later launches failed. Modules launched during capture are pinned instead.
+            std::lock_guard<std::mutex> lock(mutex);
+            for(auto& r : resolved)
+            {
+                auto& m = *r.first;
+                if(!capturing)
+                {
+                    auto& event = m.launches[stream];
+                    if(!event)
+                        PRINT_IF_HIP_ERROR(hipEventCreateWithFlags(&event, hipEventDisableTiming));
+                    if(event)
+                        PRINT_IF_HIP_ERROR(hipEventRecord(event, stream));
+                }
+                m.users--;
+            }
+            return status;
+        }
+    };
+
+    code_object_residency_s& get_code_object_residency()
+    {
+        static code_object_residency_s residency;
+        return residency;
     }
 
     /**************************************************
@@ -612,12 +2052,20 @@ namespace
         std::shared_ptr<Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>> m_library;
         std::unordered_map<std::string, std::shared_ptr<hipDeviceProp_t>> m_devicePropMap;
 
+        // Whether problem overrides were loaded from ROCBLAS_TENSILE_GEMM_OVERRIDE_PATH
+        bool m_overrides = false;
+
         // The adapter object. mutable is used to allow adapters to be modified
-        // even when they are stored in a const vector which is immutable in size
+        // even when they are stored in a const vector which is immutable in size.
+        // hardware and code_object_dir are set before adapter is published with a release
+        // store, and do not change afterwards, so once adapter is seen non-null they are read
+        // without locking.
         struct adapter_s
         {
             mutable std::atomic<Tensile::hip::SolutionAdapter*> adapter{nullptr};
             mutable std::mutex                                  mutex;
+            mutable std::shared_ptr<Tensile::Hardware>          hardware;
+            mutable std::string                                 code_object_dir;
         };
 
         // Each device contains an adapter
@@ -662,6 +2110,11 @@ namespace
             return m_library;
         }
 
+        bool has_overrides() const
+        {
+            return m_overrides;
+        }
+
         auto& get_device_property(const std::string& deviceName) const
         {
             return m_devicePropMap.at(deviceName);
@@ -672,6 +2125,28 @@ namespace
             return m_adapters;
         }
 
+        // The solution cache of a device. It does not depend on the library being initialized,
+        // so that its statistics can be queried at any time
+        static solution_cache_s& get_solution_cache(int deviceId)
+        {
+            static std::vector<solution_cache_s> caches(GetDeviceCount());
+            return caches.at(deviceId);
+        }
+
+        // The kernel time history of a device, used by the measured performance metric
+        static solution_history_s& get_solution_history(int deviceId)
+        {
+            static std::vector<solution_history_s> histories(GetDeviceCount());
+            return histories.at(deviceId);
+        }
+
+        // The backends chosen for the problems of a device, see rocblas_set_gemm_backend
+        static gemm_backend_cache_s& get_gemm_backend_cache(int deviceId)
+        {
+            static std::vector<gemm_backend_cache_s> caches(GetDeviceCount());
+            return caches.at(deviceId);
+        }
+
         /*******************************************************
          * Testpath() tests that a path exists and is readable *
          *******************************************************/
@@ -684,11 +2159,80 @@ namespace
 #endif
         }
 
+        /*****************************************************************************
+         * Node-local copy of the library files of an arch, in a directory of        *
+         * ROCBLAS_TENSILE_CODE_OBJECT_CACHE_DIR named after the arch and the rocBLAS *
+         * and Tensile commits, so that processes started on the same node read the  *
+         * code objects through its page cache instead of from the install location. *
+         * The first process copies the files which are missing, each to a temporary *
+         * file renamed in place, so that concurrent processes never see partial     *
+         * files. Returns the directory to load from, which is path if the cache is  *
+         * not set or cannot be filled.                                              *
+         *****************************************************************************/
+        static std::string code_object_cache_path(const std::string& path,
+                                                  const std::string& processor)
+        {
+            const char* env = getenv("ROCBLAS_TENSILE_CODE_OBJECT_CACHE_DIR");
+            if(!env || !*env)
+                return path;
+
+            static std::mutex                                   mutex;
+            static std::unordered_map<std::string, std::string> mirrors;
+            std::lock_guard<std::mutex>                         lock(mutex);
+            auto                                                it = mirrors.find(path);
+            if(it != mirrors.end())
+                return it->second;
+
+            const char* commits[] = {ROCBLAS_TENSILE_COMMIT_ID};
+            fs::path    mirror    = fs::path(env)
+                                / (processor + "-" + commits[0] + "-" + commits[1]);
+#ifdef WIN32
+            int pid = _getpid();
+#else
+            int pid = getpid();
+#endif
+
+            std::error_code ec;
+            bool            ok = fs::create_directories(mirror, ec) || !ec;
+            for(fs::directory_iterator it(path, ec), end; ok && !ec && it != end; it.increment(ec))
+            {
+                auto source = it->path();
+                auto name   = source.filename().string();
+                if(!fs::is_regular_file(source, ec)
+                   || (name.find(processor) == std::string::npos
+                       && name.rfind("TensileLibrary.", 0) != 0))
+                    continue;
+
+                auto target = mirror / name;
+                auto size   = fs::file_size(source, ec);
+                if(fs::exists(target, ec) && fs::file_size(target, ec) == size)
+                    continue;
+
+                auto tmp = mirror / (name + ".tmp." + std::to_string(pid));
+                fs::copy_file(source, tmp, fs::copy_options::overwrite_existing, ec);
+                if(!ec)
+                    fs::rename(tmp, target, ec);
+                if(ec)
+                {
+                    std::error_code ignored;
+                    fs::remove(tmp, ignored);
+                    ok = false;
+                }
+            }
+            ok = ok && !ec;
+
+            if(!ok)
+                rocblas_cerr << "\nrocBLAS warning: cannot fill the code object cache "
+                             << mirror.string() << ": " << ec.message() << std::endl;
+            return mirrors[path] = ok ? mirror.string() : path;
+        }
+
         /*********************************************************************
          * Initialize adapter and library according to environment variables *
          * and default paths based on librocblas.so location and GPU         *
          *********************************************************************/
-        void initialize(Tensile::hip::SolutionAdapter& adapter, rocblas_int deviceId)
+        // Returns the directory of the code objects of the device
+        std::string initialize(Tensile::hip::SolutionAdapter& adapter, rocblas_int deviceId)
         {
             std::string path;
             std::string tensileLibraryPath;
@@ -700,6 +2244,13 @@ namespace
                                                                 ftr_lib;
             static std::unordered_set<Tensile::LazyLoadingInit> tensileDeviceSet;
 
+            // Deserializes the library, timed on the thread it runs on
+            auto load_library = [](const std::string&                          file,
+                                   const std::vector<Tensile::LazyLoadingInit>& preload) {
+                startup_phase_timer library_load(get_startup_times().library_load_ns);
+                return Tensile::LoadLibraryFilePreload<Tensile::ContractionProblem>(file, preload);
+            };
+
 #ifndef WIN32
             path.reserve(PATH_MAX);
 #endif
@@ -716,6 +2267,9 @@ namespace
             else if(xnack == "xnack-")
                 skip_xnack = "xnack+";
 
+            auto&               times = get_startup_times();
+            startup_phase_timer path_discovery(times.path_discovery_ns);
+
             static std::string base_path;
             static int         determine_tensile_base_path = [&] {
                 const char* env = getenv("ROCBLAS_TENSILE_LIBPATH");
@@ -790,6 +2344,12 @@ namespace
             path = base_path;
             if(TestPath(path + "/" + processor))
                 path += "/" + processor;
+            {
+                path_discovery.end();
+                startup_phase_timer code_object_cache(times.code_object_cache_ns);
+                path = code_object_cache_path(path, processor);
+            }
+            startup_phase_timer library_path_discovery(times.path_discovery_ns);
 
 #ifdef TENSILE_YAML
             tensileLibraryPath = path + "/TensileLibrary_lazy_" + processor + ".yaml";
@@ -840,9 +2400,11 @@ namespace
             }
             else
                 tensile_lazy_load_enabled = true;
+            library_path_discovery.end();
 
             //Supports multi architecture configuration in lazy library loading mode
             static int initialize_once = [&] {
+                startup_phase_timer hardware_query(get_startup_times().hardware_query_ns);
                 hipDeviceProp_t prop;
                 int             count;
                 HIP_CHECK_EXC(hipGetDeviceCount(&count));
@@ -866,18 +2428,35 @@ namespace
                 return 0;
             }();
 
-            if(!tensile_lazy_load_enabled || rocblas_initialize_called())
+            auto* preload = current_code_object_preload();
+            if(!tensile_lazy_load_enabled || rocblas_initialize_called() || preload)
             {
+                auto load_code_object = [&](const std::string& file) {
+                    if(preload)
+                    {
+                        if(!preload->wanted(fs::path(file).filename().string()))
+                            return;
+                        std::error_code ec;
+                        auto            size = fs::file_size(file, ec);
+                        if(!ec)
+                            preload->bytes_loaded += size;
+                    }
+                    adapter.loadCodeObjectFile(file);
+                    rocblas_count(times.code_objects_loaded);
+                };
 
                 static int once = [&] {
-                    ftr_lib = std::async(
-                        std::launch::async,
-                        Tensile::LoadLibraryFilePreload<Tensile::ContractionProblem>,
-                        tensileLibraryPath,
-                        std::vector<Tensile::LazyLoadingInit>{Tensile::LazyLoadingInit::All});
+                    ftr_lib = std::async(std::launch::async,
+                                         load_library,
+                                         tensileLibraryPath,
+                                         std::vector<Tensile::LazyLoadingInit>{
+                                             Tensile::LazyLoadingInit::All});
                     return 0;
                 }();
 
+                // The code objects are found and loaded while the library is deserialized
+                startup_phase_timer code_object_load(times.code_object_load_ns);
+
                 // only load modules for the current architecture
                 auto dir = path + "/*" + processor + "*co";
 
@@ -897,7 +2476,7 @@ namespace
                         // Skip experimental libraries
                         if(codeObjectFile.find("Experimental") != std::string::npos)
                             continue;
-                        adapter.loadCodeObjectFile(codeObjectFile.c_str());
+                        load_code_object(codeObjectFile);
                     } while(FindNextFileA(hfine, &finddata));
                 }
                 else
@@ -917,7 +2496,7 @@ namespace
                             continue;
                         if(cofile.find("Experimental") != std::string::npos)
                             continue;
-                        adapter.loadCodeObjectFile(cofile);
+                        load_code_object(cofile);
                     }
                 }
                 else if(g == GLOB_NOMATCH)
@@ -949,11 +2528,10 @@ namespace
             else // initialize lazy loading
             {
                 static int once = [&] {
-                    ftr_lib
-                        = std::async(std::launch::async,
-                                     Tensile::LoadLibraryFilePreload<Tensile::ContractionProblem>,
-                                     tensileLibraryPath,
-                                     std::vector<Tensile::LazyLoadingInit>{});
+                    ftr_lib = std::async(std::launch::async,
+                                         load_library,
+                                         tensileLibraryPath,
+                                         std::vector<Tensile::LazyLoadingInit>{});
                     return 0;
                 }();
             }
@@ -963,7 +2541,8 @@ namespace
                 adapter.initializeLazyLoading(processor, path);
 
                 static int once = [&] {
-                    auto lib = ftr_lib.get();
+                    startup_phase_timer library_wait(get_startup_times().library_wait_ns);
+                    auto                lib = ftr_lib.get();
                     if(!lib)
                         rocblas_cerr << "\nrocBLAS error: Could not load " << tensileLibraryPath
                                      << std::endl;
@@ -990,6 +2569,7 @@ namespace
                 std::shared_ptr<Tensile::Hardware> hardware     = Tensile::hip::GetDevice(
                     *(get_device_property(rocblas_internal_get_arch_name())));
                 bool success = m_library->setOverridesFromFile(*hardware, overridePath);
+                m_overrides  = success;
 
                 if(!success)
                 {
@@ -998,22 +2578,41 @@ namespace
                         << overridePath << std::endl;
                 }
             }
+
+            return path;
         }
     };
 
-    // Return the library and adapter for the current HIP device
+    // The TensileHost is constructed on the first call. This does not initialize any device.
+    TensileHost& get_tensile_host()
+    {
+        static TensileHost host;
+        return host;
+    }
+
+    // The worker is constructed after the TensileHost, so that it is destroyed, and its
+    // thread joined, before the TensileHost is
+    gemm_prefetch_worker_s& get_gemm_prefetch_worker()
+    {
+        get_tensile_host();
+        static gemm_prefetch_worker_s worker;
+        return worker;
+    }
+
+    // Return the library, hardware and adapter for the current HIP device. After the first call
+    // on a device this only does an acquire load: the library and hardware are immutable once
+    // published and live as long as the process, so they are returned without reference counting.
     auto& get_library_and_adapter(
-        std::shared_ptr<Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>>* library
-        = nullptr,
-        std::shared_ptr<hipDeviceProp_t>* deviceProp = nullptr,
-        int                               device     = -1)
+        Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>** library  = nullptr,
+        const Tensile::Hardware**                                     hardware = nullptr,
+        int                                                           device   = -1,
+        const std::string**                                           code_object_dir = nullptr)
     try
     {
-        // TensileHost is initialized on the first call
-        static TensileHost host;
+        auto& host = get_tensile_host();
 
         if(device == -1)
-            hipGetDevice(&device);
+            rocblas_get_current_device(&device);
 
         // Adapter entry for the current HIP device ID
         auto& a       = host.get_adapters().at(device);
@@ -1028,11 +2627,38 @@ namespace
             adapter = a.adapter.load(std::memory_order_relaxed);
             if(!adapter)
             {
+                auto&               times  = get_startup_times();
+                auto                before = times.snapshot();
+                startup_phase_timer total(times.total_ns);
+
                 // Allocate a new adapter using the current HIP device
                 adapter = new Tensile::hip::SolutionAdapter;
 
                 // Initialize the adapter and possibly the library
-                host.initialize(*adapter, device);
+                a.code_object_dir = host.initialize(*adapter, device);
+
+                // The hardware used for solution selection on this device
+                auto arch = rocblas_internal_get_arch_name();
+                {
+                    startup_phase_timer hardware_query(times.hardware_query_ns);
+                    a.hardware = Tensile::hip::GetDevice(*host.get_device_property(arch));
+                }
+
+                // Warm start from the solution cache file, if there is one
+                {
+                    startup_phase_timer seed(times.solution_cache_seed_ns);
+                    get_solution_cache_file().seed(device,
+                                                   arch,
+                                                   a.code_object_dir,
+                                                   *adapter,
+                                                   *host.get_library(),
+                                                   TensileHost::get_solution_cache(device));
+                }
+                get_solution_index().add_device(device, arch);
+
+                total.end();
+                rocblas_count(times.device_initializations);
+                log_startup_times(device, arch, before, times.snapshot());
 
                 // Atomically change the adapter stored for this device ID
                 a.adapter.store(adapter, std::memory_order_release);
@@ -1041,9 +2667,11 @@ namespace
 
         // If an adapter is found, it is assumed that the library is initialized
         if(library)
-            *library = host.get_library();
-        if(deviceProp)
-            *deviceProp = host.get_device_property(rocblas_internal_get_arch_name());
+            *library = host.get_library().get();
+        if(hardware)
+            *hardware = a.hardware.get();
+        if(code_object_dir)
+            *code_object_dir = &a.code_object_dir;
 
         return *adapter;
     }
@@ -1061,6 +2689,88 @@ namespace
         rocblas_abort();
     }
 
+    /*******************************************************************************
+     * Tenants of the devices: the handles which ran contractions on a device in the *
+     * last ROCBLAS_TENANT_WINDOW_US microseconds. When the window is set, solutions *
+     * are selected for the share of the compute units each of the concurrent        *
+     * tenants can expect, rather than as if each kernel had the whole device.       *
+     *******************************************************************************/
+    class tenant_tracker
+    {
+        using clock   = std::chrono::steady_clock;
+        using tenants = std::unordered_map<const void*, clock::time_point>;
+
+        std::chrono::microseconds        window{0};
+        std::mutex                       mutex;
+        std::unordered_map<int, tenants> seen;
+
+        tenant_tracker()
+        {
+            const char* env = getenv("ROCBLAS_TENANT_WINDOW_US");
+            if(env)
+                window = std::chrono::microseconds(std::max(strtoll(env, nullptr, 0), 0ll));
+        }
+
+    public:
+        static tenant_tracker& instance()
+        {
+            static tenant_tracker tracker;
+            return tracker;
+        }
+
+        // Records a submission of handle on device, and returns the number of tenants of the
+        // device including it, or 1 if tenants are not tracked
+        size_t submit(int device, rocblas_handle handle)
+        {
+            if(!window.count())
+                return 1;
+
+            auto                        now = clock::now();
+            std::lock_guard<std::mutex> lock(mutex);
+            auto&                       device_tenants = seen[device];
+            device_tenants[handle]                     = now;
+            for(auto it = device_tenants.begin(); it != device_tenants.end();)
+                it = now - it->second > window ? device_tenants.erase(it) : std::next(it);
+            return device_tenants.size();
+        }
+    };
+
+    // The hardware solutions are selected for with a handle: that of the device, or the device
+    // with the compute units the kernels of the handle can expect: those of the CU mask set by
+    // rocblas_set_cu_mask, shared with the other tenants of the device seen by tenant_tracker.
+    // selection_cus is set to the number of compute units selected for, or 0 for the device.
+    // Contractions which run, unlike size queries and solution listings, are submissions.
+    const Tensile::Hardware* get_handle_hardware(rocblas_handle           handle,
+                                                 const Tensile::Hardware* device_hardware,
+                                                 bool                     submission    = false,
+                                                 int*                     selection_cus = nullptr)
+    {
+        size_t tenants = submission && !handle->is_device_memory_size_query()
+                             ? tenant_tracker::instance().submit(handle->getDevice(), handle)
+                             : 1;
+
+        int cu_count = 0;
+        if(handle->get_cu_mask_count() || tenants > 1)
+            cu_count = std::max(1, int(handle->getCUCount() / tenants));
+        if(selection_cus)
+            *selection_cus = cu_count;
+        if(!cu_count)
+            return device_hardware;
+
+        static std::mutex mutex;
+        static std::unordered_map<int64_t, std::shared_ptr<Tensile::Hardware>> partitions;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto& hardware = partitions[int64_t(handle->getDevice()) << 32 | cu_count];
+        if(!hardware)
+        {
+            auto prop = *get_tensile_host().get_device_property(rocblas_internal_get_arch_name());
+            prop.multiProcessorCount = cu_count;
+            hardware                 = Tensile::hip::GetDevice(prop);
+        }
+        return hardware.get();
+    }
+
     /**************************************************************************
     * We normally print error messages only once, to avoid excessive logging *
     **************************************************************************/
@@ -1097,6 +2807,305 @@ inline bool fallbackTensileProblem(Tensile::ContractionProblem& tensile_prob)
     return false;
 }
 
+/*******************************************************************************
+ * With rocblas_layer_mode_log_explain, explainSolution describes a solution    *
+ * selection: the problem, the solution, its predicted fitness, how it was      *
+ * chosen, and up to ROCBLAS_LOG_EXPLAIN_CANDIDATES (default 4) other solutions *
+ * of the library which can solve the problem, in library order.                *
+ *******************************************************************************/
+template <typename TiA, typename To, typename Tc, typename TiB, typename TcA, typename TcB>
+void explainSolution(const RocblasContractionProblem<TiA, To, Tc, TiB, TcA, TcB>& prob,
+                     const Tensile::ContractionProblem&                           tensile_prob,
+                     const std::shared_ptr<Tensile::ContractionSolution>&         solution,
+                     double                                                       fitness,
+                     const char*                                                  source,
+                     bool                                                         xf32_fallback,
+                     Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>& library,
+                     const Tensile::Hardware&                                     hardware)
+{
+    static const int max_candidates = [] {
+        const char* env = getenv("ROCBLAS_LOG_EXPLAIN_CANDIDATES");
+        return env ? std::max(0, atoi(env)) : 4;
+    }();
+
+    rocblas_internal_ostream os;
+    os << "- problem: " << prob;
+    if(!solution)
+    {
+        os << "  solution: ~\n";
+    }
+    else
+    {
+        os << "  solution: { name: " << solution->name() << ", index: " << solution->index
+           << ", source: " << source << ", xf32_fallback: " << (xf32_fallback ? "true" : "false")
+           << ", overrides: " << (get_tensile_host().has_overrides() ? "true" : "false")
+           << ", lazy_load: " << (ROCBLAS_TENSILE_LAZY_LOAD ? "true" : "false");
+        if(fitness != std::numeric_limits<double>::lowest())
+            os << ", fitness: " << fitness;
+        os << " }\n";
+    }
+
+    os << "  candidates: [";
+    int count = 0;
+    if(max_candidates)
+        for(auto& candidate : library.findAllSolutions(tensile_prob, hardware))
+        {
+            if(candidate == solution || !candidate->canSolve(tensile_prob, hardware))
+                continue;
+            os << (count ? ", " : " ") << "{ name: " << candidate->name()
+               << ", index: " << candidate->index << " }";
+            if(++count >= max_candidates)
+                break;
+        }
+    os << (count ? " ]\n" : "]\n");
+
+    prob.handle->log_explain_os->post(os.str());
+}
+
+/*******************************************************************************
+ * Autotuning times up to handle->autotune_candidates solutions of a problem,   *
+ * starting with the predicted one, on the stream of the handle, and returns   *
+ * the fastest. Each candidate gets a warm-up run, which may load its code      *
+ * objects, and two timed runs. No further candidates are timed once the time   *
+ * spent exceeds handle->autotune_budget_ms, if it is positive. Running a       *
+ * candidate writes D, so this is only used when the result does not depend on *
+ * how often the problem is run.                                               *
+ *******************************************************************************/
+template <typename TiA, typename To, typename Tc, typename TiB, typename TcA, typename TcB>
+bool canAutotuneProblem(const RocblasContractionProblem<TiA, To, Tc, TiB, TcA, TcB>& prob)
+{
+    // Pointer arrays may alias elements, which cannot be checked on the host
+    if(!prob.strided_batch)
+        return false;
+    const void* D = prob.D;
+    return D != prob.A && D != prob.B && (D != prob.C || value_category(*prob.beta) == 0);
+}
+
+template <typename TiA, typename To, typename Tc, typename TiB, typename TcA, typename TcB>
+std::shared_ptr<Tensile::ContractionSolution>
+    autotuneSolution(const RocblasContractionProblem<TiA, To, Tc, TiB, TcA, TcB>& prob,
+                     const Tensile::ContractionProblem&                           tensile_prob,
+                     const std::shared_ptr<Tensile::ContractionSolution>&         predicted,
+                     Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>& library,
+                     const Tensile::Hardware&                                     hardware,
+                     Tensile::hip::SolutionAdapter&                               adapter)
+{
+    auto handle = prob.handle;
+    auto stream = handle->get_stream();
+
+    std::vector<std::shared_ptr<Tensile::ContractionSolution>> candidates{predicted};
+    for(auto& candidate : library.findAllSolutions(tensile_prob, hardware))
+    {
+        if(candidates.size() >= size_t(handle->autotune_candidates))
+            break;
+        if(candidate != predicted && candidate->canSolve(tensile_prob, hardware))
+            candidates.push_back(candidate);
+    }
+    if(candidates.size() < 2)
+        return predicted;
+
+    hipEvent_t start, stop;
+    if(hipEventCreate(&start) != hipSuccess)
+        return predicted;
+    if(hipEventCreate(&stop) != hipSuccess)
+    {
+        hipEventDestroy(start);
+        return predicted;
+    }
+
+    auto  best      = predicted;
+    float best_time = std::numeric_limits<float>::infinity();
+    float spent     = 0;
+    for(auto& candidate : candidates)
+    {
+        if(handle->autotune_budget_ms > 0 && spent >= handle->autotune_budget_ms)
+            break;
+
+        size_t workspace_size = candidate->requiredWorkspaceSize(tensile_prob, hardware);
+        auto   gsu_malloc     = handle->gsu_malloc_by_size(workspace_size);
+        if(workspace_size && !gsu_malloc)
+            continue;
+
+        auto  kernels = candidate->solve(tensile_prob, GetTensileInputs(prob), hardware);
+        float time    = std::numeric_limits<float>::infinity();
+        for(int run = 0; run < 3; run++)
+        {
+            float ms;
+            if(hipEventRecord(start, stream) != hipSuccess
+               || adapter.launchKernels(kernels, stream, nullptr, nullptr) != hipSuccess
+               || hipEventRecord(stop, stream) != hipSuccess
+               || hipEventSynchronize(stop) != hipSuccess
+               || hipEventElapsedTime(&ms, start, stop) != hipSuccess)
+            {
+                time = std::numeric_limits<float>::infinity();
+                break;
+            }
+            spent += ms;
+            if(run)
+                time = std::min(time, ms);
+        }
+
+        if(time < best_time)
+        {
+            best_time = time;
+            best      = candidate;
+        }
+    }
+
+    hipEventDestroy(start);
+    hipEventDestroy(stop);
+    return best;
+}
+
+/*******************************************************************************
+ * GetHipblasltProblem describes a problem to hipBLASLt, and returns false if   *
+ * it is not one which is routed to it: strided or non-batched problems of the  *
+ * types hipBLASLt supports, without flags, which may use atomics.              *
+ *******************************************************************************/
+template <typename TiA, typename To, typename Tc, typename TiB, typename TcA, typename TcB>
+bool GetHipblasltProblem(const RocblasContractionProblem<TiA, To, Tc, TiB, TcA, TcB>& prob,
+                         rocblas_hipblaslt_problem*                                   lt_prob)
+{
+    if(!std::is_same<TiA, TcA>{} || !std::is_same<TiB, TcB>{} || !prob.strided_batch || !prob.k
+       || prob.flags != rocblas_gemm_flags_none
+       || prob.handle->atomics_mode != rocblas_atomics_allowed
+       || prob.handle->math_mode != rocblas_default_math
+       || !rocblas_hipblaslt_supports_types(rocblas_datatype_from_type<TiA>,
+                                            rocblas_datatype_from_type<TiB>,
+                                            rocblas_datatype_from_type<To>,
+                                            rocblas_datatype_from_type<Tc>))
+        return false;
+
+    *lt_prob = {prob.trans_a,
+                prob.trans_b,
+                int64_t(prob.m),
+                int64_t(prob.n),
+                int64_t(prob.k),
+                int64_t(prob.batch_count),
+                rocblas_datatype_from_type<TiA>,
+                rocblas_datatype_from_type<TiB>,
+                rocblas_datatype_from_type<To>,
+                rocblas_datatype_from_type<Tc>,
+                prob.alpha,
+                prob.beta,
+                prob.A + prob.buffer_offset_a,
+                int64_t(prob.col_stride_a),
+                int64_t(prob.batch_stride_a),
+                prob.B + prob.buffer_offset_b,
+                int64_t(prob.col_stride_b),
+                int64_t(prob.batch_stride_b),
+                prob.C + prob.buffer_offset_c,
+                int64_t(prob.col_stride_c),
+                int64_t(prob.batch_stride_c),
+                prob.D + prob.buffer_offset_d,
+                int64_t(prob.col_stride_d),
+                int64_t(prob.batch_stride_d)};
+    return true;
+}
+
+/*******************************************************************************
+ * runHipblasltProblem runs a problem with hipBLASLt, recording the events of   *
+ * the handle around it like the launches of Tensile solutions. It returns      *
+ * rocblas_status_continue, for Tensile to run the problem, when the workspace  *
+ * of the algorithm, available when it was chosen, can no longer be allocated.  *
+ *******************************************************************************/
+static rocblas_status runHipblasltProblem(rocblas_handle                   handle,
+                                          const rocblas_hipblaslt_problem& lt_prob,
+                                          const rocblas_hipblaslt_algo&    lt_algo)
+{
+    auto w_mem = handle->device_malloc(lt_algo.workspace_size);
+    if(!w_mem)
+        return rocblas_status_continue;
+
+    bool       scoped = handle->start_stop_recorded;
+    hipEvent_t start  = scoped ? nullptr : handle->startEvent;
+    hipEvent_t stop   = scoped ? nullptr : handle->stopEvent;
+    auto       stream = handle->get_stream();
+
+    if(start)
+        RETURN_IF_HIP_ERROR(hipEventRecord(start, stream));
+    RETURN_IF_ROCBLAS_ERROR(rocblas_hipblaslt_run(handle, lt_prob, lt_algo, w_mem[0]));
+    if(stop)
+        RETURN_IF_HIP_ERROR(hipEventRecord(stop, stream));
+
+    if(rocblas_profile_timing)
+        rocblas_profile_launched();
+    rocblas_count(handle->counters.kernel_launches);
+    rocblas_count(handle->counters.hipblaslt_gemm_calls);
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ * hipblasltIsFaster times a problem with a Tensile solution and with hipBLASLt *
+ * on the stream of the handle, like autotuneSolution times its candidates,    *
+ * and returns whether hipBLASLt was faster                                    *
+ *******************************************************************************/
+template <typename TiA, typename To, typename Tc, typename TiB, typename TcA, typename TcB>
+bool hipblasltIsFaster(const RocblasContractionProblem<TiA, To, Tc, TiB, TcA, TcB>& prob,
+                       const Tensile::ContractionProblem&                           tensile_prob,
+                       const Tensile::ContractionSolution&                          solution,
+                       const Tensile::Hardware&                                     hardware,
+                       Tensile::hip::SolutionAdapter&                               adapter,
+                       const rocblas_hipblaslt_problem&                             lt_prob,
+                       const rocblas_hipblaslt_algo&                                lt_algo)
+{
+    auto handle = prob.handle;
+    auto stream = handle->get_stream();
+
+    hipEvent_t start, stop;
+    if(hipEventCreate(&start) != hipSuccess)
+        return false;
+    if(hipEventCreate(&stop) != hipSuccess)
+    {
+        hipEventDestroy(start);
+        return false;
+    }
+
+    // The best of two timed runs after a warm-up run
+    auto time = [&](auto&& launch) {
+        float best = std::numeric_limits<float>::infinity();
+        for(int run = 0; run < 3; run++)
+        {
+            float ms;
+            if(hipEventRecord(start, stream) != hipSuccess || !launch()
+               || hipEventRecord(stop, stream) != hipSuccess
+               || hipEventSynchronize(stop) != hipSuccess
+               || hipEventElapsedTime(&ms, start, stop) != hipSuccess)
+                return std::numeric_limits<float>::infinity();
+            if(run)
+                best = std::min(best, ms);
+        }
+        return best;
+    };
+
+    float tensile_time = std::numeric_limits<float>::infinity();
+    {
+        size_t workspace_size = solution.requiredWorkspaceSize(tensile_prob, hardware);
+        auto   gsu_malloc     = handle->gsu_malloc_by_size(workspace_size);
+        if(!workspace_size || gsu_malloc)
+        {
+            auto kernels = solution.solve(tensile_prob, GetTensileInputs(prob), hardware);
+            tensile_time = time([&] {
+                return adapter.launchKernels(kernels, stream, nullptr, nullptr) == hipSuccess;
+            });
+        }
+    }
+
+    float hipblaslt_time = std::numeric_limits<float>::infinity();
+    {
+        auto w_mem = handle->device_malloc(lt_algo.workspace_size);
+        if(w_mem)
+            hipblaslt_time = time([&] {
+                return rocblas_hipblaslt_run(handle, lt_prob, lt_algo, w_mem[0])
+                       == rocblas_status_success;
+            });
+    }
+
+    hipEventDestroy(start);
+    hipEventDestroy(stop);
+    return hipblaslt_time < tensile_time;
+}
+
 /******************************************************************************
  * runContractionProblem calls Tensile to run a contraction problem described *
  * by RocblasContractionProblem                                               *
@@ -1112,21 +3121,176 @@ rocblas_status
 
     try
     {
-        std::shared_ptr<Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>> library;
-        std::shared_ptr<hipDeviceProp_t>                                             deviceProp;
-        std::shared_ptr<Tensile::Hardware>                                           hardware;
-
-        auto& adapter = get_library_and_adapter(&library, &deviceProp, prob.handle->getDevice());
-
-        hardware = Tensile::hip::GetDevice(*deviceProp);
-
-        auto  tensile_prob  = ConstructTensileProblem(prob);
         auto  handle        = prob.handle;
         auto* fitness_query = handle->get_solution_fitness_query();
 
-        if(algo == rocblas_gemm_algo_solution_index && solution_index > 0)
+        // The workspace requirement is memoized per problem, so that a size query of a problem
+        // seen before does not have to select a solution again
+        const rocblas_workspace_signature workspace_signature(
+            "tensile_contraction",
+            (int64_t(rocblas_datatype_from_type<TiA>) << 48)
+                | (int64_t(rocblas_datatype_from_type<To>) << 32)
+                | (int64_t(rocblas_datatype_from_type<Tc>) << 16)
+                | int64_t(rocblas_datatype_from_type<TiB>),
+            prob.trans_a,
+            prob.trans_b,
+            prob.m,
+            prob.n,
+            prob.k && *prob.alpha ? prob.k : 0,
+            prob.batch_count,
+            prob.col_stride_a,
+            prob.col_stride_b,
+            prob.col_stride_c,
+            prob.col_stride_d,
+            prob.flags,
+            handle->math_mode,
+            prob.strided_batch,
+            value_category(*prob.beta),
+            algo == rocblas_gemm_algo_solution_index ? solution_index : 0);
+
+        size_t cached_workspace_size;
+        if(!fitness_query && handle->is_device_memory_size_query()
+           && handle->get_cached_workspace_size(workspace_signature, &cached_workspace_size))
+            return handle->set_optimal_device_memory_size(cached_workspace_size);
+
+        // Strided operands in managed memory are prefetched to the device, see
+        // rocblas_set_managed_prefetch
+        if(handle->managed_prefetch && prob.m && prob.n && prob.batch_count)
+        {
+            size_t m = prob.m, n = prob.n, k = prob.k, batches = prob.batch_count;
+            auto   prefetch
+                = [&](const auto* ptr, size_t rows, size_t cols, size_t ld, size_t stride) {
+                      size_t elements = (cols - 1) * ld + rows + (batches - 1) * stride;
+                      if(ptr && rows && cols)
+                          handle->prefetch_managed(ptr, elements * sizeof(*ptr));
+                  };
+
+            bool a_n = prob.trans_a == rocblas_operation_none;
+            bool b_n = prob.trans_b == rocblas_operation_none;
+            if(!prob.batch_A)
+                prefetch(prob.A + prob.buffer_offset_a,
+                         a_n ? m : k,
+                         a_n ? k : m,
+                         prob.col_stride_a,
+                         prob.batch_stride_a);
+            if(!prob.batch_B)
+                prefetch(prob.B + prob.buffer_offset_b,
+                         b_n ? k : n,
+                         b_n ? n : k,
+                         prob.col_stride_b,
+                         prob.batch_stride_b);
+            if(!prob.batch_C && prob.C != prob.D)
+                prefetch(
+                    prob.C + prob.buffer_offset_c, m, n, prob.col_stride_c, prob.batch_stride_c);
+            if(!prob.batch_D)
+                prefetch(
+                    prob.D + prob.buffer_offset_d, m, n, prob.col_stride_d, prob.batch_stride_d);
+        }
+
+        Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>* library;
+        const Tensile::Hardware*                                     hardware;
+        const std::string*                                           code_object_dir;
+
+        auto& adapter = get_library_and_adapter(
+            &library, &hardware, handle->getDevice(), &code_object_dir);
+        int selection_cus;
+        hardware = get_handle_hardware(handle, hardware, true, &selection_cus);
+
+        auto& tensile_prob = GetCachedTensileProblem(prob);
+
+        // Solutions selected by findBestSolution are cached per device, keyed by everything
+        // in the problem which takes part in solution selection. Explicit solution indices and
+        // fitness queries always go to the library.
+        bool use_solution_cache
+            = !fitness_query && !(algo == rocblas_gemm_algo_solution_index && solution_index > 0);
+        auto& solution_cache = TensileHost::get_solution_cache(handle->getDevice());
+        const rocblas_workspace_signature solution_signature(
+            "tensile_solution",
+            workspace_signature.args[0],
+            int64_t(prob.trans_a) | int64_t(prob.trans_b) << 8 | int64_t(prob.flags) << 16
+                | int64_t(handle->math_mode) << 32 | int64_t(handle->atomics_mode) << 40
+                | int64_t(handle->performance_metric) << 44 | int64_t(prob.strided_batch) << 52
+                | int64_t(prob.C == prob.D) << 53,
+            prob.m,
+            prob.n,
+            workspace_signature.args[5],
+            prob.batch_count,
+            prob.col_stride_a,
+            prob.col_stride_b,
+            prob.col_stride_c,
+            prob.col_stride_d,
+            prob.batch_stride_a,
+            prob.batch_stride_b,
+            prob.batch_stride_c,
+            prob.batch_stride_d,
+            int64_t(selection_cus) << 16 | int64_t(value_category(*prob.beta)) << 8
+                | (int64_t(workspace_signature.args[5] ? value_category(*prob.alpha) : 0) & 0xff),
+            handle->is_device_memory_size_query() ? -1 : handle->get_available_workspace());
+
+        // Problems routed to hipBLASLt do not select a Tensile solution, unless it is timed
+        // against hipBLASLt to choose the backend of the problem, see rocblas_set_gemm_backend
+        auto  backend       = handle->gemm_backend;
+        auto& backend_cache = TensileHost::get_gemm_backend_cache(handle->getDevice());
+        rocblas_hipblaslt_problem    lt_prob;
+        gemm_backend_cache_s::choice lt_choice;
+        bool                         lt_timing = false;
+        if(backend != rocblas_gemm_backend_tensile && use_solution_cache
+           && !handle->is_device_memory_size_query() && !handle->tensile_prefetch
+           && GetHipblasltProblem(prob, &lt_prob) && rocblas_hipblaslt_available()
+           && !backend_cache.find(backend, solution_signature, lt_choice))
+        {
+            bool found = rocblas_hipblaslt_find_algo(
+                handle, lt_prob, handle->get_available_workspace(), &lt_choice.algo);
+            int listed = found && backend == rocblas_gemm_backend_auto
+                             ? get_gemm_backend_table().find(prob)
+                             : int(found);
+
+            // Shapes which are not in the tuning table are timed when autotuning is enabled,
+            // and otherwise use Tensile
+            lt_choice.hipblaslt = listed > 0;
+            lt_timing = listed < 0 && handle->autotune_candidates > 1 && canAutotuneProblem(prob)
+                        && !handle->is_stream_in_capture_mode();
+            if(!lt_timing && (listed >= 0 || !handle->is_stream_in_capture_mode()))
+                backend_cache.insert(backend, solution_signature, lt_choice);
+        }
+        if(lt_choice.hipblaslt)
+        {
+            auto lt_status = runHipblasltProblem(handle, lt_prob, lt_choice.algo);
+            if(lt_status != rocblas_status_continue)
+                return lt_status;
+        }
+
+        // Solution selection, with the autotuning of problems seen for the first time
+        rocblas_roctx_phase selection(
+            handle, "tensile_selection", "M", prob.m, "N", prob.n, "K", prob.k);
+        auto selection_start = std::chrono::steady_clock::now();
+
+        // The predicted fitness is also taken for the explain log of the selection
+        bool explain = (handle->layer_mode & rocblas_layer_mode_log_explain) && !fitness_query;
+
+        double      explain_fitness   = std::numeric_limits<double>::lowest();
+        double*     selection_fitness = explain ? &explain_fitness : fitness_query;
+        const char* selection_source  = "predicted";
+
+        bool xf32_fallback = false, persisted = true;
+        if(use_solution_cache)
+            solution = solution_cache.find(solution_signature, xf32_fallback, persisted);
+        bool from_solution_cache = solution != nullptr;
+        if(use_solution_cache)
+            rocblas_count(from_solution_cache ? handle->counters.solution_cache_hits
+                                              : handle->counters.solution_cache_misses);
+        bool                         from_index   = false;
+        const solution_index_record* index_record = nullptr;
+
+        if(from_solution_cache)
+        {
+            if(xf32_fallback)
+                tensile_prob.setF32XdlMathOp(Tensile::DataType::Float);
+        }
+        else if(algo == rocblas_gemm_algo_solution_index && solution_index > 0)
         {
-            solution = library->getSolutionByIndex(solution_index - 1);
+            selection_source = "solution_index";
+            solution         = library->getSolutionByIndex(solution_index - 1);
             // load solution if not already loaded
             if(!solution)
             {
@@ -1136,11 +3300,132 @@ rocblas_status
         }
         else
         {
-            solution = library->findBestSolution(tensile_prob, *hardware, fitness_query);
+            index_record = use_solution_cache ? get_solution_index().find(handle->getDevice(),
+                                                                          solution_signature)
+                                              : nullptr;
+            if(index_record
+               && (solution = library->getSolutionByIndex(index_record->solution_index)))
+            {
+                // Selections of the solution index are taken as they are, like cached ones
+                selection_source = "solution_index_file";
+                from_index       = true;
+                xf32_fallback    = index_record->xf32_fallback;
+                if(xf32_fallback)
+                    tensile_prob.setF32XdlMathOp(Tensile::DataType::Float);
+                get_solution_index().load_code_objects(
+                    handle->getDevice(), *index_record, *code_object_dir, adapter);
+            }
+            else
+                solution = library->findBestSolution(tensile_prob, *hardware, selection_fitness);
         }
 
         if(!solution && fallbackTensileProblem(tensile_prob))
-            solution = library->findBestSolution(tensile_prob, *hardware, fitness_query);
+        {
+            solution      = library->findBestSolution(tensile_prob, *hardware, selection_fitness);
+            xf32_fallback = true;
+        }
+
+        // The first time a problem is seen, the autotuned solution replaces the prediction
+        if(solution && use_solution_cache && !from_solution_cache && !from_index
+           && handle->autotune_candidates > 1 && !handle->is_device_memory_size_query()
+           && !handle->tensile_prefetch && !(prob.flags & rocblas_gemm_flags_check_solution_index)
+           && canAutotuneProblem(prob) && !handle->is_stream_in_capture_mode())
+        {
+            auto predicted = solution;
+            solution       = autotuneSolution(
+                prob, tensile_prob, predicted, *library, *hardware, adapter);
+            if(solution != predicted)
+                selection_source = "autotune";
+        }
+
+        if(solution && use_solution_cache && !from_solution_cache)
+        {
+            solution_cache.insert(solution_signature, solution, xf32_fallback, from_index);
+            persisted = from_index;
+        }
+        selection.end();
+
+        if(lt_timing)
+        {
+            lt_choice.hipblaslt = !solution
+                                  || hipblasltIsFaster(prob,
+                                                       tensile_prob,
+                                                       *solution,
+                                                       *hardware,
+                                                       adapter,
+                                                       lt_prob,
+                                                       lt_choice.algo);
+            backend_cache.insert(backend, solution_signature, lt_choice);
+            if(lt_choice.hipblaslt)
+            {
+                auto lt_status = runHipblasltProblem(handle, lt_prob, lt_choice.algo);
+                if(lt_status != rocblas_status_continue)
+                    return lt_status;
+            }
+        }
+
+        // The measured metric replaces the selection with the fastest candidate observed so far,
+        // or with a candidate which is still being timed by this launch
+        hipEvent_t measured_start = nullptr, measured_stop = nullptr;
+        if(solution && use_solution_cache && !from_index
+           && handle->performance_metric == rocblas_measured_performance_metric
+           && !handle->is_device_memory_size_query() && !handle->tensile_prefetch
+           && !(prob.flags & rocblas_gemm_flags_check_solution_index)
+           && !handle->is_stream_in_capture_mode())
+        {
+            // The alternatives must not need more workspace than the prediction
+            auto predicted         = solution;
+            auto find_alternatives = [&] {
+                size_t max_workspace = predicted->requiredWorkspaceSize(tensile_prob, *hardware);
+                std::vector<std::shared_ptr<Tensile::ContractionSolution>> alternatives;
+                for(auto& candidate : library->findAllSolutions(tensile_prob, *hardware))
+                    if(candidate->canSolve(tensile_prob, *hardware)
+                       && candidate->requiredWorkspaceSize(tensile_prob, *hardware)
+                              <= max_workspace)
+                        alternatives.push_back(candidate);
+                return alternatives;
+            };
+
+            // Launches can only be timed when the handle's events are not recorded around them
+            bool timeable = handle->start_stop_recorded
+                            || (!handle->startEvent && !handle->stopEvent);
+            solution = TensileHost::get_solution_history(handle->getDevice())
+                           .choose(solution_signature,
+                                   predicted,
+                                   find_alternatives,
+                                   timeable ? &measured_start : nullptr,
+                                   timeable ? &measured_stop : nullptr);
+            if(solution != predicted)
+                selection_source = "measured";
+        }
+
+        if(!from_solution_cache)
+        {
+            auto selection_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - selection_start);
+            rocblas_count(handle->counters.tensile_selections);
+            rocblas_count(handle->counters.tensile_selection_ns, selection_ns.count());
+        }
+        if(solution && xf32_fallback)
+            rocblas_count(handle->counters.tensile_xf32_fallbacks);
+
+        // Selections made for new problems are explained, not those taken from the cache
+        if(explain && !from_solution_cache)
+            explainSolution(prob,
+                            tensile_prob,
+                            solution,
+                            explain_fitness,
+                            selection_source,
+                            xf32_fallback,
+                            *library,
+                            *hardware);
+
+        // The workspace size recorded in the solution index saves asking the solution again
+        auto required_workspace_size = [&] {
+            return from_index && index_record->workspace_size != NO_WORKSPACE_SIZE
+                       ? size_t(index_record->workspace_size)
+                       : solution->requiredWorkspaceSize(tensile_prob, *hardware);
+        };
 
         if(!solution)
         {
@@ -1161,33 +3446,106 @@ rocblas_status
             {
                 status = rocblas_status_success;
             }
+            else if(handle->tensile_prefetch)
+            {
+                // Load the code objects of the kernels without launching them, as resident
+                // modules when their residency is bounded
+                auto  kernels = solution->solve(tensile_prob, GetTensileInputs(prob), *hardware);
+                auto& residency = get_code_object_residency();
+                if(residency.enabled() && residency.covers(kernels))
+                {
+                    hipError_t hip_status
+                        = residency.load(handle->getDevice(), *code_object_dir, kernels);
+                    status = rocblas_internal_convert_hip_to_rocblas_status(hip_status);
+                }
+                else
+                {
+                    std::string loaded;
+                    for(auto& kernel : kernels)
+                    {
+                        if(kernel.codeObjectFile.empty()
+                           || ("," + loaded + ",").find("," + kernel.codeObjectFile + ",")
+                                  != std::string::npos
+                           || !get_gemm_prefetch_worker().claim_code_object(
+                               handle->getDevice(), kernel.codeObjectFile))
+                            continue;
+                        adapter.loadCodeObjectFile(*code_object_dir + "/"
+                                                   + kernel.codeObjectFile);
+                        loaded += "," + kernel.codeObjectFile;
+                    }
+                    status = rocblas_status_success;
+                }
+            }
             else if(handle->is_device_memory_size_query())
             {
-                status = handle->set_optimal_device_memory_size(
-                    ((solution->requiredWorkspaceSize(tensile_prob, *hardware)
-                      + HPA_GSU_WORKSPACE_SIZE_GRANULARITY - 1)
-                     / HPA_GSU_WORKSPACE_SIZE_GRANULARITY)
-                    * HPA_GSU_WORKSPACE_SIZE_GRANULARITY);
+                size_t WorkspaceSize
+                    = ((required_workspace_size() + HPA_GSU_WORKSPACE_SIZE_GRANULARITY - 1)
+                       / HPA_GSU_WORKSPACE_SIZE_GRANULARITY)
+                      * HPA_GSU_WORKSPACE_SIZE_GRANULARITY;
+                handle->cache_workspace_size(workspace_signature, WorkspaceSize);
+                status = handle->set_optimal_device_memory_size(WorkspaceSize);
             }
             else
             {
                 // check if the solution requires workspace for GSU and allocate it.
-                size_t WorkspaceSize = solution->requiredWorkspaceSize(tensile_prob, *hardware);
-                auto   gsu_malloc    = prob.handle->gsu_malloc_by_size(WorkspaceSize);
+                size_t WorkspaceSize = required_workspace_size();
+                handle->cache_workspace_size(
+                    workspace_signature,
+                    ((WorkspaceSize + HPA_GSU_WORKSPACE_SIZE_GRANULARITY - 1)
+                     / HPA_GSU_WORKSPACE_SIZE_GRANULARITY)
+                        * HPA_GSU_WORKSPACE_SIZE_GRANULARITY);
+                auto gsu_malloc = prob.handle->gsu_malloc_by_size(WorkspaceSize);
 
                 if(solution->canSolve(tensile_prob, *hardware))
                 {
                     if(!(prob.flags & rocblas_gemm_flags_check_solution_index))
                     {
-                        hipError_t hip_status = adapter.launchKernels(
-                            solution->solve(tensile_prob, GetTensileInputs(prob), *hardware),
-                            handle->get_stream(),
-                            handle->startEvent,
-                            handle->stopEvent);
+                        auto kernels
+                            = solution->solve(tensile_prob, GetTensileInputs(prob), *hardware);
+
+                        // The code objects are only known from the kernels, so selections are
+                        // recorded in the solution cache file when they are first launched
+                        if(!persisted && get_solution_cache_file().enabled()
+                           && solution_cache.mark_persisted(solution_signature))
+                            get_solution_cache_file().record(handle->getDevice(),
+                                                             solution_signature,
+                                                             *solution,
+                                                             xf32_fallback,
+                                                             kernels,
+                                                             WorkspaceSize);
+
+                        // The events are recorded around the whole call when it has a scope
+                        bool       scoped    = handle->start_stop_recorded;
+                        hipEvent_t start     = scoped ? nullptr : handle->startEvent;
+                        hipEvent_t stop      = scoped ? nullptr : handle->stopEvent;
+
+                        // Launches timed for the measured metric use the events of its history
+                        if(!start && !stop)
+                        {
+                            start = measured_start;
+                            stop  = measured_stop;
+                        }
+                        auto&      residency = get_code_object_residency();
+                        hipError_t hip_status
+                            = residency.enabled() && residency.covers(kernels)
+                                  ? residency.launch(handle->getDevice(),
+                                                     *code_object_dir,
+                                                     kernels,
+                                                     handle->get_stream(),
+                                                     start,
+                                                     stop,
+                                                     handle->is_stream_in_capture_mode())
+                                  : adapter.launchKernels(
+                                      kernels, handle->get_stream(), start, stop);
                         if(hip_status != hipSuccess)
                             status = rocblas_internal_convert_hip_to_rocblas_status(hip_status);
                         else
+                        {
                             status = rocblas_status_success;
+                            if(rocblas_profile_timing)
+                                rocblas_profile_launched();
+                            rocblas_count(handle->counters.kernel_launches, kernels.size());
+                        }
                     }
                     else
                     {
@@ -1227,12 +3585,11 @@ rocblas_status getAllSolutions(const RocblasContractionProblem<TiA, To, Tc, TiB,
     std::set<std::shared_ptr<Tensile::ContractionSolution>> solutions;
     try
     {
-        std::shared_ptr<Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>> library;
-        std::shared_ptr<hipDeviceProp_t>                                             deviceProp;
-        std::shared_ptr<Tensile::Hardware>                                           hardware;
+        Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>* library;
+        const Tensile::Hardware*                                     hardware;
 
-        auto& adapter = get_library_and_adapter(&library, &deviceProp, prob.handle->getDevice());
-        hardware      = Tensile::hip::GetDevice(*deviceProp);
+        auto& adapter = get_library_and_adapter(&library, &hardware, prob.handle->getDevice());
+        hardware      = get_handle_hardware(prob.handle, hardware);
         auto tensile_prob = ConstructTensileProblem(prob);
 
         if(option == CAN_SOLVE)
@@ -1293,6 +3650,351 @@ extern "C" void rocblas_initialize()
     get_library_and_adapter();
 }
 
+/*******************************************************************************
+ * ! \brief  Set the file which persists solution selections across processes.  *
+ *******************************************************************************/
+extern "C" rocblas_status rocblas_set_solution_cache_file(const char* path)
+try
+{
+    get_solution_cache_file().set_path(path);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief  Report the host time spent initializing Tensile, by phase.         *
+ *******************************************************************************/
+extern "C" rocblas_status rocblas_get_startup_times(rocblas_startup_times* times)
+try
+{
+    if(!times)
+        return rocblas_status_invalid_pointer;
+    *times = get_startup_times().snapshot();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief  Write the memory-mapped solution index of a solution cache file.   *
+ *******************************************************************************/
+extern "C" rocblas_status rocblas_build_solution_index(const char* cache_file,
+                                                       const char* index_file)
+try
+{
+    if(!cache_file || !index_file)
+        return rocblas_status_invalid_pointer;
+    return solution_index_s::build(cache_file, index_file);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief  Report the hits and misses of the solution selection cache of the  *
+ * device of the handle.                                                       *
+ *******************************************************************************/
+extern "C" rocblas_status
+    rocblas_get_solution_cache_stats(rocblas_handle handle, size_t* hits, size_t* misses)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!hits && !misses)
+        return rocblas_status_invalid_pointer;
+
+    TensileHost::get_solution_cache(handle->getDevice()).get_stats(hits, misses);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Queue a problem for rocblas_gemm_ex_prefetch. The prefetch runs on a copy of *
+ * the handle, so that the caller may keep using it.                           *
+ *******************************************************************************/
+template <typename TiA, typename To = TiA, typename Tc = To>
+rocblas_status gemm_ex_prefetch_template(rocblas_handle    handle,
+                                         rocblas_operation trans_a,
+                                         rocblas_operation trans_b,
+                                         rocblas_int       m,
+                                         rocblas_int       n,
+                                         rocblas_int       k,
+                                         const void*       alpha,
+                                         rocblas_int       lda,
+                                         rocblas_stride    stride_a,
+                                         rocblas_int       ldb,
+                                         rocblas_stride    stride_b,
+                                         const void*       beta,
+                                         rocblas_int       ldc,
+                                         rocblas_stride    stride_c,
+                                         rocblas_int       batch_count,
+                                         uint32_t          flags)
+{
+    Tc alpha_h = *static_cast<const Tc*>(alpha);
+    Tc beta_h  = *static_cast<const Tc*>(beta);
+
+    auto prefetch_handle              = std::make_shared<_rocblas_handle>(handle);
+    prefetch_handle->layer_mode       = rocblas_layer_mode_none;
+    prefetch_handle->check_numerics   = rocblas_check_numerics_mode_no_check;
+    prefetch_handle->tensile_prefetch = true;
+
+    get_gemm_prefetch_worker().enqueue([=] {
+        // The matrices are never accessed, since no kernels are launched
+        static char unused[1];
+        auto        saved_device_id = prefetch_handle->push_device_id();
+
+        RocblasContractionProblem<TiA, To, Tc> problem{prefetch_handle.get(),
+                                                       trans_a,
+                                                       trans_b,
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       &alpha_h,
+                                                       reinterpret_cast<const TiA*>(unused),
+                                                       nullptr,
+                                                       lda,
+                                                       stride_a,
+                                                       0,
+                                                       reinterpret_cast<const TiA*>(unused),
+                                                       nullptr,
+                                                       ldb,
+                                                       stride_b,
+                                                       0,
+                                                       &beta_h,
+                                                       reinterpret_cast<const To*>(unused),
+                                                       nullptr,
+                                                       ldc,
+                                                       stride_c,
+                                                       0,
+                                                       reinterpret_cast<To*>(unused),
+                                                       nullptr,
+                                                       ldc,
+                                                       stride_c,
+                                                       0,
+                                                       batch_count,
+                                                       true,
+                                                       rocblas_gemm_flags(flags)};
+        runContractionProblem(problem, rocblas_gemm_algo_standard, 0);
+    });
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocblas_gemm_ex_prefetch(rocblas_handle    handle,
+                                                   rocblas_operation trans_a,
+                                                   rocblas_operation trans_b,
+                                                   rocblas_int       m,
+                                                   rocblas_int       n,
+                                                   rocblas_int       k,
+                                                   const void*       alpha,
+                                                   rocblas_datatype  a_type,
+                                                   rocblas_int       lda,
+                                                   rocblas_stride    stride_a,
+                                                   rocblas_datatype  b_type,
+                                                   rocblas_int       ldb,
+                                                   rocblas_stride    stride_b,
+                                                   const void*       beta,
+                                                   rocblas_datatype  c_type,
+                                                   rocblas_int       ldc,
+                                                   rocblas_stride    stride_c,
+                                                   rocblas_int       batch_count,
+                                                   rocblas_datatype  compute_type,
+                                                   uint32_t          flags)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(m < 0 || n < 0 || k < 0 || batch_count < 0 || ldc < m
+       || lda < (trans_a == rocblas_operation_none ? m : k)
+       || ldb < (trans_b == rocblas_operation_none ? k : n))
+        return rocblas_status_invalid_size;
+    if(!alpha || !beta)
+        return rocblas_status_invalid_pointer;
+    if(a_type != b_type)
+        return rocblas_status_not_implemented;
+    if(!m || !n || !batch_count)
+        return rocblas_status_success;
+
+#define GEMM_EX_PREFETCH(...)                                                                  \
+    return gemm_ex_prefetch_template<__VA_ARGS__>(handle,                                     \
+                                                  trans_a,                                    \
+                                                  trans_b,                                    \
+                                                  m,                                          \
+                                                  n,                                          \
+                                                  k,                                          \
+                                                  alpha,                                      \
+                                                  lda,                                        \
+                                                  stride_a,                                   \
+                                                  ldb,                                        \
+                                                  stride_b,                                   \
+                                                  beta,                                       \
+                                                  ldc,                                        \
+                                                  stride_c,                                   \
+                                                  batch_count,                                \
+                                                  flags)
+
+    if(a_type == rocblas_datatype_f64_r && c_type == a_type && compute_type == a_type)
+        GEMM_EX_PREFETCH(double);
+    if(a_type == rocblas_datatype_f32_r && c_type == a_type && compute_type == a_type)
+        GEMM_EX_PREFETCH(float);
+    if(a_type == rocblas_datatype_f64_c && c_type == a_type && compute_type == a_type)
+        GEMM_EX_PREFETCH(rocblas_double_complex);
+    if(a_type == rocblas_datatype_f32_c && c_type == a_type && compute_type == a_type)
+        GEMM_EX_PREFETCH(rocblas_float_complex);
+    if(a_type == rocblas_datatype_f16_r && c_type == a_type && compute_type == a_type)
+        GEMM_EX_PREFETCH(rocblas_half);
+    if(a_type == rocblas_datatype_f16_r && c_type == a_type
+       && compute_type == rocblas_datatype_f32_r)
+        GEMM_EX_PREFETCH(rocblas_half, rocblas_half, float);
+    if(a_type == rocblas_datatype_f16_r && c_type == rocblas_datatype_f32_r
+       && compute_type == rocblas_datatype_f32_r)
+        GEMM_EX_PREFETCH(rocblas_half, float, float);
+    if(a_type == rocblas_datatype_bf16_r && c_type == a_type
+       && compute_type == rocblas_datatype_f32_r)
+        GEMM_EX_PREFETCH(rocblas_bfloat16, rocblas_bfloat16, float);
+    if(a_type == rocblas_datatype_bf16_r && c_type == rocblas_datatype_f32_r
+       && compute_type == rocblas_datatype_f32_r)
+        GEMM_EX_PREFETCH(rocblas_bfloat16, float, float);
+    if(a_type == rocblas_datatype_i8_r && c_type == rocblas_datatype_i32_r
+       && compute_type == rocblas_datatype_i32_r)
+        GEMM_EX_PREFETCH(int8_t, int32_t, int32_t);
+
+#undef GEMM_EX_PREFETCH
+
+    return rocblas_status_not_implemented;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_gemm_ex_prefetch_synchronize()
+try
+{
+    get_gemm_prefetch_worker().synchronize();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief  Initialize rocBLAS for a set of devices, preloading only the code  *
+ * objects of the given datatypes, and report the time and bytes loaded.       *
+ *******************************************************************************/
+extern "C" rocblas_status rocblas_initialize_ex(uint64_t                device_mask,
+                                                const rocblas_datatype* types,
+                                                rocblas_int             type_count,
+                                                double*                 seconds,
+                                                size_t*                 bytes_loaded)
+try
+{
+    if(type_count < 0)
+        return rocblas_status_invalid_size;
+    if(type_count && !types)
+        return rocblas_status_invalid_pointer;
+
+    code_object_preload_s preload;
+    for(rocblas_int i = 0; i < type_count; i++)
+    {
+        switch(types[i])
+        {
+        case rocblas_datatype_f16_r:
+            preload.type_tags.push_back("H");
+            break;
+        case rocblas_datatype_bf16_r:
+            preload.type_tags.push_back("B");
+            break;
+        case rocblas_datatype_f32_r:
+            preload.type_tags.push_back("S");
+            break;
+        case rocblas_datatype_f64_r:
+            preload.type_tags.push_back("D");
+            break;
+        case rocblas_datatype_f32_c:
+            preload.type_tags.push_back("C");
+            break;
+        case rocblas_datatype_f64_c:
+            preload.type_tags.push_back("Z");
+            break;
+        case rocblas_datatype_i8_r:
+            preload.type_tags.push_back("I8");
+            break;
+        case rocblas_datatype_f8_r:
+            preload.type_tags.push_back("F8");
+            break;
+        case rocblas_datatype_bf8_r:
+            preload.type_tags.push_back("B8");
+            break;
+        default:
+            return rocblas_status_invalid_value;
+        }
+    }
+
+    int count;
+    RETURN_IF_HIP_ERROR(hipGetDeviceCount(&count));
+
+    auto start = std::chrono::steady_clock::now();
+
+    // The devices are initialized concurrently, each on its own thread, which makes it the
+    // current HIP device as device initialization loads code objects for the current device.
+    // The host library is deserialized once and shared by all devices.
+    std::vector<int> devices;
+    for(int device = 0; device < count && device < 64; device++)
+        if(device_mask & (uint64_t(1) << device))
+            devices.push_back(device);
+
+    std::vector<code_object_preload_s> preloads(devices.size(), preload);
+    std::vector<rocblas_status>        statuses(devices.size(), rocblas_status_success);
+    std::vector<std::thread>           threads;
+    for(size_t i = 0; i < devices.size(); i++)
+        threads.emplace_back([&, i] {
+            try
+            {
+                statuses[i] = rocblas_internal_convert_hip_to_rocblas_status(
+                    hipSetDevice(devices[i]));
+                if(statuses[i] != rocblas_status_success)
+                    return;
+                current_code_object_preload() = &preloads[i];
+                get_library_and_adapter(nullptr, nullptr, devices[i]);
+                current_code_object_preload() = nullptr;
+            }
+            catch(...)
+            {
+                statuses[i] = exception_to_rocblas_status();
+            }
+        });
+    for(auto& thread : threads)
+        thread.join();
+
+    if(seconds)
+        *seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if(bytes_loaded)
+    {
+        *bytes_loaded = 0;
+        for(auto& device_preload : preloads)
+            *bytes_loaded += device_preload.bytes_loaded;
+    }
+    for(auto status : statuses)
+        if(status != rocblas_status_success)
+            return status;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    current_code_object_preload() = nullptr;
+    return exception_to_rocblas_status();
+}
+
 /******************************************************************************
  * Intantiate the cases of runContractionProblem which are needed to satisfy  *
  * rocBLAS dependencies. This file's template functions are not defined in a  *
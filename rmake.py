@@ -106,6 +106,15 @@ def parse_args():
     experimental_opts.add_argument('-l', '--logic', dest='tensile_logic', type=str, required=False, default="asm_full",
                         help='Specify the Tensile logic target, e.g., asm_full, asm_lite, etc. (optional, default: asm_full)')
 
+    experimental_opts.add_argument(     '--logic-manifest', dest='tensile_logic_manifest', type=str, required=False, default="",
+                        help='Build the Tensile library only for the GEMM problems of a shape manifest or bench log, plus the generic fallbacks (optional)')
+
+    experimental_opts.add_argument(     '--tensile-precisions', dest='tensile_precisions', type=str, required=False, default="",
+                        help='Build the Tensile library only for these comma separated A matrix types, e.g. f32_r,f16_r; the others use the source kernels (optional)')
+
+    experimental_opts.add_argument(     '--decode-gemm-shapes', dest='decode_gemm_shapes', type=str, required=False, default="",
+                        help='Build GEMM kernels specialized for these semicolon separated m,n,k,type shapes of A**T * B, e.g. 4096,16,4096,f16_r;5120,1,5120,bf16_r (optional)')
+
     experimental_opts.add_argument(    '--lazy-library-loading', dest='tensile_lazy_library_loading', required=False, default=True, action='store_true',
                         help='Enable on-demand loading of Tensile Library files, speeds up the rocblas initialization. (Default is enabled)')
 
@@ -115,6 +124,9 @@ def parse_args():
     experimental_opts.add_argument(     '--library-path', dest='library_dir_installed', type=str, required=False, default="",
                         help='Specify path to a pre-built rocBLAS library, when building clients only using --clients-only flag. (optional, default: /opt/rocm/rocblas)')
 
+    experimental_opts.add_argument(     '--no-offload-compress', dest='offload_compress', required=False, default=True, action='store_false',
+                        help='Do not compress the device code of the source kernels (optional, default: compressed when the compiler supports it)')
+
     experimental_opts.add_argument('-n', '--no_tensile', dest='build_tensile', required=False, default=True, action='store_false',
                         help='Build a subset of rocBLAS library which does not require Tensile.')
 
@@ -434,6 +446,8 @@ def config_cmd():
             fatal("Could not detect GPU as requested. Not continuing.")
     # not just for tensile
     cmake_options.append(f'-DAMDGPU_TARGETS=\"{args.gpu_architecture}\"')
+    if not args.offload_compress:
+        cmake_options.append(f"-DBUILD_OFFLOAD_COMPRESS=OFF")
 
     if not args.build_tensile:
         cmake_options.append(f"-DBUILD_WITH_TENSILE=OFF")
@@ -441,6 +455,13 @@ def config_cmd():
         cmake_options.append(f"-DTensile_CODE_OBJECT_VERSION=default")
         if args.tensile_logic:
             cmake_options.append(f"-DTensile_LOGIC={args.tensile_logic}")
+        if args.tensile_logic_manifest:
+            cmake_options.append(f"-DTensile_LOGIC_MANIFEST={os.path.abspath(args.tensile_logic_manifest)}")
+        if args.tensile_precisions:
+            precisions = args.tensile_precisions.replace(",", ";")
+            cmake_options.append(f"\"-DTensile_PRECISIONS={precisions}\"")
+        if args.decode_gemm_shapes:
+            cmake_options.append(f"\"-DROCBLAS_DECODE_GEMM_SHAPES={args.decode_gemm_shapes}\"")
         if args.tensile_fork:
             cmake_options.append(f"-Dtensile_fork={args.tensile_fork}")
         if args.tensile_tag: